@@ -0,0 +1,1476 @@
+/*
+ * Python extension module jeod_batch: batched JEOD computations on arrays.
+ *
+ * The functions accept any object that exports a C-contiguous buffer of
+ * doubles (NumPy arrays, array.array, memoryviews) and pass the buffer
+ * memory directly to the batched JEOD kernels; the inputs are not copied
+ * or converted. Results are written to the buffers given as out arguments
+ * or, if none are given, to new buffers returned as memoryviews, which
+ * numpy.asarray wraps without a copy.
+ *
+ * Array layouts follow the kernels:
+ *   elements_from_cartesian, elements_to_cartesian
+ *     States are N x 3 arrays, one row per state. Element sets are N x 8
+ *     arrays whose columns are named by ELEMENT_FIELDS.
+ *   cart_to_ellip, cart_to_spher
+ *     Positions are 3 x N arrays, one row per axis. The results are 3 x N
+ *     arrays whose rows are the altitudes, latitudes, and longitudes.
+ *   GravityField.gravitation
+ *     Positions and accelerations are 3 x N arrays, one row per axis;
+ *     potentials are N-element arrays.
+ *   De4xxFile.states
+ *     Times are N-element arrays; positions and velocities are N x 3.
+ *
+ * JEOD failures are raised as RuntimeError rather than terminating the
+ * interpreter. The module is built by the JEOD_PYTHON option and is
+ * installed in lib/jeod/python, which setup.py adds to the search path.
+ */
+
+// Python.h must precede the system headers.
+#include <Python.h>
+
+// System includes
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// JEOD includes
+#include "environment/ephemerides/de4xx_ephem/include/de4xx_base.hh"
+#include "environment/ephemerides/de4xx_ephem/include/de4xx_file.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/gravity/include/spherical_harmonics_offload.hh"
+#include "environment/planet/include/planet.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/memory_manager.hh"
+#include "utils/message/include/suppressed_code_message_handler.hh"
+#include "utils/orbital_elements/include/orbital_elements.hh"
+#include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
+#include "utils/sim_interface/include/checkpoint_input_manager.hh"
+#include "utils/sim_interface/include/checkpoint_output_manager.hh"
+#include "utils/sim_interface/include/memory_interface.hh"
+#include "utils/sim_interface/include/simulation_interface.hh"
+
+using namespace jeod;
+
+
+namespace {
+
+/**
+ * Number of element sets converted per call to the batched orbital
+ * elements kernels.
+ */
+const unsigned int Element_batch_size = 64;
+
+/**
+ * Number of columns in an element set array.
+ */
+const unsigned int Num_element_fields = 8;
+
+/**
+ * Names of the element set array columns.
+ */
+const char * const Element_fields[Num_element_fields] = {
+   "semi_major_axis", "semiparam", "e_mag", "inclination",
+   "arg_periapsis", "long_asc_node", "true_anom", "mean_anom"};
+
+/**
+ * Julian date of truncated Julian time zero.
+ */
+const double Tjt_jd_offset = 2440000.5;
+
+/**
+ * Size of a formatted message.
+ */
+const unsigned int Message_size = 4096;
+
+
+/**
+ * A fatal JEOD message, thrown by the module's message handler in place of
+ * terminating the process. The functions that make JEOD calls catch it and
+ * raise it as a RuntimeError.
+ */
+class JeodFailure : public std::runtime_error {
+
+public:
+
+   explicit JeodFailure (const std::string & message)
+   :
+      std::runtime_error(message)
+   {}
+};
+
+
+/**
+ * Message handler for the module. Non-fatal messages are written to the
+ * Python standard error stream; fatal messages are thrown as JeodFailure.
+ */
+class PythonMessageHandler : public SuppressedCodeMessageHandler {
+
+public:
+
+   PythonMessageHandler () {}
+
+   ~PythonMessageHandler () override {}
+
+protected:
+
+   void process_message (
+      int severity,
+      const char * prefix,
+      const char * file,
+      unsigned int line,
+      const char * msg_code,
+      const char * format,
+      va_list args)
+   const override
+   {
+      if ((severity >= 0) && (! message_is_to_be_printed (severity, msg_code))) {
+         return;
+      }
+
+      char buffer[Message_size];
+      std::vsnprintf (buffer, sizeof(buffer), format, args); // flawfinder: ignore
+
+      char message[2 * Message_size];
+      std::snprintf (message, sizeof(message),
+                     "%s %s at %s line %u:\n%s",
+                     prefix, msg_code, file, line, buffer);
+
+      if (severity < 0) {
+         throw JeodFailure (message);
+      }
+
+      PySys_FormatStderr ("\n%s\n", message);
+   }
+};
+
+
+/**
+ * Memory interface for the module. Allocations are tracked by the memory
+ * manager only; there is no simulation engine to register them with.
+ */
+class PythonMemoryInterface : public JeodMemoryInterface {
+
+public:
+
+   PythonMemoryInterface () {}
+
+   ~PythonMemoryInterface () override {}
+
+   const JEOD_ATTRIBUTES_POINTER_TYPE find_attributes (
+      const std::string &) const override
+   {
+      return nullptr;
+   }
+
+   const JEOD_ATTRIBUTES_POINTER_TYPE find_attributes (
+      const std::type_info &) const override
+   {
+      return nullptr;
+   }
+
+   JEOD_ATTRIBUTES_TYPE primitive_attributes (
+      const std::type_info &) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   JEOD_ATTRIBUTES_TYPE pointer_attributes (
+      const JEOD_ATTRIBUTES_TYPE &) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   JEOD_ATTRIBUTES_TYPE void_pointer_attributes (void) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   JEOD_ATTRIBUTES_TYPE structure_attributes (
+      const JEOD_ATTRIBUTES_POINTER_TYPE,
+      std::size_t) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   bool register_allocation (
+      const void *, const JeodMemoryItem &,
+      const JeodMemoryTypeDescriptor &, const char *, unsigned int) override
+   {
+      return false;
+   }
+
+   void deregister_allocation (
+      const void *, const JeodMemoryItem &,
+      const JeodMemoryTypeDescriptor &, const char *, unsigned int) override
+   {}
+
+   void register_container (
+      const void *, const JeodMemoryTypeDescriptor &, const char *,
+      JeodCheckpointable &) override
+   {}
+
+   void deregister_container (
+      const void *, const JeodMemoryTypeDescriptor &, const char *,
+      JeodCheckpointable &) override
+   {}
+
+   bool is_checkpoint_restart_supported (void) const override
+   {
+      return false;
+   }
+
+   const std::string get_name_at_address (
+      const void *, const JeodMemoryTypeDescriptor *) const override
+   {
+      return "";
+   }
+
+   void * get_address_at_name (const std::string &) const override
+   {
+      return nullptr;
+   }
+};
+
+
+/**
+ * Simulation interface for the module: a memory manager that uses a
+ * PythonMemoryInterface, and neither integration nor checkpoint/restart.
+ */
+class PythonSimInterface : public JeodSimulationInterface {
+
+public:
+
+   PythonSimInterface ()
+   :
+      memory_interface(),
+      memory_manager(memory_interface)
+   {}
+
+   ~PythonSimInterface () override {}
+
+protected:
+
+   JeodIntegratorInterface * create_integrator_internal (void) override
+   {
+      return nullptr;
+   }
+
+   double get_job_cycle_internal (void) override
+   {
+      return 0.0;
+   }
+
+   JeodMemoryInterface & get_memory_interface_internal (void) override
+   {
+      return memory_interface;
+   }
+
+   SectionedInputStream get_checkpoint_reader_internal (
+      const std::string &) override
+   {
+      return SectionedInputStream ();
+   }
+
+   SectionedOutputStream get_checkpoint_writer_internal (
+      const std::string &) override
+   {
+      return SectionedOutputStream ();
+   }
+
+private:
+
+   PythonSimInterface (const PythonSimInterface &);
+   PythonSimInterface & operator= (const PythonSimInterface &);
+
+   PythonMemoryInterface memory_interface;
+   JeodMemoryManager memory_manager;
+};
+
+
+/**
+ * The module's message handler. It and the simulation interface are
+ * created when the module is imported and are never destroyed: objects of
+ * the module's types may be released after the module itself.
+ */
+PythonMessageHandler * message_handler = nullptr;
+
+
+/**
+ * A buffer of doubles exported by a Python object, released on
+ * destruction.
+ */
+class DoubleBuffer {
+
+public:
+
+   DoubleBuffer () : acquired(false) {}
+
+   ~DoubleBuffer ()
+   {
+      if (acquired) {
+         PyBuffer_Release (&view);
+      }
+   }
+
+   /**
+    * Get the buffer exported by an object and check its layout.
+    * @return True on success; on failure a Python exception is set
+    * \param[in] obj Exporting object
+    * \param[in] name Argument name, for error messages
+    * \param[in] writable Is the buffer to be written?
+    * \param[in] ndim Required number of dimensions, 1 or 2
+    * \param[in] rows Required first dimension, or -1 for any
+    * \param[in] cols Required second dimension, or -1 for any
+    */
+   bool acquire (
+      PyObject * obj,
+      const char * name,
+      bool writable,
+      int ndim,
+      Py_ssize_t rows,
+      Py_ssize_t cols = -1)
+   {
+      int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+      if (writable) {
+         flags |= PyBUF_WRITABLE;
+      }
+      if (PyObject_GetBuffer (obj, &view, flags) != 0) {
+         return false;
+      }
+      acquired = true;
+
+      const char * format = (view.format != nullptr) ? view.format : "B";
+      if ((format[0] == '@') || (format[0] == '=') || (format[0] == '<')) {
+         ++format;
+      }
+      if ((std::strcmp (format, "d") != 0) ||
+          (view.itemsize != static_cast<Py_ssize_t> (sizeof(double)))) {
+         PyErr_Format (PyExc_TypeError,
+                       "%s must be an array of float64, not '%s'",
+                       name, view.format);
+         return false;
+      }
+
+      if ((view.ndim != ndim) ||
+          ((rows >= 0) && (view.shape[0] != rows)) ||
+          ((ndim == 2) && (cols >= 0) && (view.shape[1] != cols))) {
+         std::string shape = "(" + dimension (rows) +
+                             ((ndim == 1) ? ",)" : ", " + dimension (cols) + ")");
+         PyErr_Format (PyExc_ValueError,
+                       "%s must have shape %s", name, shape.c_str());
+         return false;
+      }
+
+      if (view.shape[ndim - 1] > static_cast<Py_ssize_t> (UINT_MAX)) {
+         PyErr_Format (PyExc_ValueError, "%s is too large", name);
+         return false;
+      }
+
+      return true;
+   }
+
+   double * data () const
+   {
+      return static_cast<double *> (view.buf);
+   }
+
+   Py_ssize_t shape (int dim) const
+   {
+      return view.shape[dim];
+   }
+
+private:
+
+   /**
+    * Format a required dimension for an error message.
+    */
+   static std::string dimension (Py_ssize_t size)
+   {
+      return (size < 0) ? std::string("N") : std::to_string (size);
+   }
+
+   DoubleBuffer (const DoubleBuffer &);
+   DoubleBuffer & operator= (const DoubleBuffer &);
+
+   Py_buffer view;
+   bool acquired;
+};
+
+
+/**
+ * Get the object to receive a result: the out argument if one was given,
+ * otherwise a new float64 memoryview of the given shape.
+ * @return New reference, or null with a Python exception set
+ * \param[in] out Out argument, or None
+ * \param[in] ndim Number of dimensions, 1 or 2
+ * \param[in] rows First dimension
+ * \param[in] cols Second dimension
+ */
+PyObject *
+output_array (
+   PyObject * out,
+   int ndim,
+   Py_ssize_t rows,
+   Py_ssize_t cols = 1)
+{
+   if ((out != nullptr) && (out != Py_None)) {
+      Py_INCREF (out);
+      return out;
+   }
+
+   PyObject * bytes = PyByteArray_FromStringAndSize (
+                         nullptr, rows * cols * sizeof(double));
+   if (bytes == nullptr) {
+      return nullptr;
+   }
+   PyObject * raw = PyMemoryView_FromObject (bytes);
+   Py_DECREF (bytes);
+   if (raw == nullptr) {
+      return nullptr;
+   }
+
+   PyObject * result = (ndim == 1) ?
+      PyObject_CallMethod (raw, "cast", "s(n)", "d", rows) :
+      PyObject_CallMethod (raw, "cast", "s(nn)", "d", rows, cols);
+   Py_DECREF (raw);
+   return result;
+}
+
+
+/**
+ * Store an element set in a row of an element set array.
+ * \param[in] elem Element set
+ * \param[out] row Array row, Num_element_fields long
+ */
+void
+store_elements (
+   const OrbitalElements & elem,
+   double * row)
+{
+   row[0] = elem.semi_major_axis;
+   row[1] = elem.semiparam;
+   row[2] = elem.e_mag;
+   row[3] = elem.inclination;
+   row[4] = elem.arg_periapsis;
+   row[5] = elem.long_asc_node;
+   row[6] = elem.true_anom;
+   row[7] = elem.mean_anom;
+}
+
+
+/**
+ * Load an element set from a row of an element set array.
+ * \param[in] row Array row, Num_element_fields long
+ * \param[in] from_mean_anom Is the mean anomaly to be used?
+ * \param[out] elem Element set
+ */
+void
+load_elements (
+   const double * row,
+   bool from_mean_anom,
+   OrbitalElements & elem)
+{
+   elem.semi_major_axis = row[0];
+   elem.semiparam = row[1];
+   elem.e_mag = row[2];
+   elem.inclination = row[3];
+   elem.arg_periapsis = row[4];
+   elem.long_asc_node = row[5];
+   elem.true_anom = row[6];
+   elem.mean_anom = row[7];
+   if (! from_mean_anom) {
+      elem.sin_v = std::sin (elem.true_anom);
+      elem.cos_v = std::cos (elem.true_anom);
+   }
+}
+
+
+PyObject *
+elements_from_cartesian (
+   PyObject *,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {"mu", "pos", "vel", "out", nullptr};
+   double mu;
+   PyObject * pos_obj;
+   PyObject * vel_obj;
+   PyObject * out_obj = Py_None;
+
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "dOO|O:elements_from_cartesian",
+            const_cast<char **> (keywords),
+            &mu, &pos_obj, &vel_obj, &out_obj)) {
+      return nullptr;
+   }
+   if (! (mu > 0.0)) {
+      PyErr_SetString (PyExc_ValueError, "mu must be positive");
+      return nullptr;
+   }
+
+   DoubleBuffer pos;
+   DoubleBuffer vel;
+   if ((! pos.acquire (pos_obj, "pos", false, 2, -1, 3)) ||
+       (! vel.acquire (vel_obj, "vel", false, 2, pos.shape(0), 3))) {
+      return nullptr;
+   }
+   unsigned int num = static_cast<unsigned int> (pos.shape(0));
+
+   PyObject * result = output_array (out_obj, 2, num, Num_element_fields);
+   DoubleBuffer out;
+   if ((result == nullptr) ||
+       (! out.acquire (result, "out", true, 2, num, Num_element_fields))) {
+      Py_XDECREF (result);
+      return nullptr;
+   }
+
+   const double (* pos_rows)[3] = reinterpret_cast<const double (*)[3]> (pos.data());
+   const double (* vel_rows)[3] = reinterpret_cast<const double (*)[3]> (vel.data());
+   OrbitalElements elements[Element_batch_size];
+   OrbitalElements * element_ptrs[Element_batch_size];
+   for (unsigned int ii = 0; ii < Element_batch_size; ++ii) {
+      element_ptrs[ii] = &elements[ii];
+   }
+
+   try {
+      for (unsigned int first = 0; first < num; first += Element_batch_size) {
+         unsigned int count = std::min (num - first, Element_batch_size);
+         OrbitalElements::from_cartesian_batch (
+            mu, count, pos_rows + first, vel_rows + first, element_ptrs);
+         for (unsigned int ii = 0; ii < count; ++ii) {
+            store_elements (elements[ii],
+                            out.data() + (first + ii) * Num_element_fields);
+         }
+      }
+   }
+   catch (const JeodFailure & failure) {
+      PyErr_SetString (PyExc_RuntimeError, failure.what());
+      Py_DECREF (result);
+      return nullptr;
+   }
+
+   return result;
+}
+
+
+PyObject *
+elements_to_cartesian (
+   PyObject *,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {
+      "mu", "elements", "from_mean_anom", "pos_out", "vel_out", nullptr};
+   double mu;
+   PyObject * elem_obj;
+   int from_mean_anom = 0;
+   PyObject * pos_out_obj = Py_None;
+   PyObject * vel_out_obj = Py_None;
+
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "dO|pOO:elements_to_cartesian",
+            const_cast<char **> (keywords),
+            &mu, &elem_obj, &from_mean_anom, &pos_out_obj, &vel_out_obj)) {
+      return nullptr;
+   }
+   if (! (mu > 0.0)) {
+      PyErr_SetString (PyExc_ValueError, "mu must be positive");
+      return nullptr;
+   }
+
+   DoubleBuffer elem;
+   if (! elem.acquire (elem_obj, "elements", false, 2, -1, Num_element_fields)) {
+      return nullptr;
+   }
+   unsigned int num = static_cast<unsigned int> (elem.shape(0));
+
+   PyObject * pos_result = output_array (pos_out_obj, 2, num, 3);
+   PyObject * vel_result = output_array (vel_out_obj, 2, num, 3);
+   DoubleBuffer pos;
+   DoubleBuffer vel;
+   if ((pos_result == nullptr) || (vel_result == nullptr) ||
+       (! pos.acquire (pos_result, "pos_out", true, 2, num, 3)) ||
+       (! vel.acquire (vel_result, "vel_out", true, 2, num, 3))) {
+      Py_XDECREF (pos_result);
+      Py_XDECREF (vel_result);
+      return nullptr;
+   }
+
+   double (* pos_rows)[3] = reinterpret_cast<double (*)[3]> (pos.data());
+   double (* vel_rows)[3] = reinterpret_cast<double (*)[3]> (vel.data());
+   OrbitalElements elements[Element_batch_size];
+   OrbitalElements * element_ptrs[Element_batch_size];
+   for (unsigned int ii = 0; ii < Element_batch_size; ++ii) {
+      element_ptrs[ii] = &elements[ii];
+   }
+
+   unsigned int num_failed = 0;
+   try {
+      for (unsigned int first = 0; first < num; first += Element_batch_size) {
+         unsigned int count = std::min (num - first, Element_batch_size);
+         for (unsigned int ii = 0; ii < count; ++ii) {
+            load_elements (elem.data() + (first + ii) * Num_element_fields,
+                           from_mean_anom != 0, elements[ii]);
+         }
+         num_failed += OrbitalElements::to_cartesian_batch (
+            mu, count, element_ptrs, from_mean_anom != 0,
+            pos_rows + first, vel_rows + first);
+      }
+   }
+   catch (const JeodFailure & failure) {
+      PyErr_SetString (PyExc_RuntimeError, failure.what());
+      Py_DECREF (pos_result);
+      Py_DECREF (vel_result);
+      return nullptr;
+   }
+   if (num_failed != 0) {
+      PyErr_Format (PyExc_RuntimeError,
+                    "%u element sets could not be converted", num_failed);
+      Py_DECREF (pos_result);
+      Py_DECREF (vel_result);
+      return nullptr;
+   }
+
+   return Py_BuildValue ("(NN)", pos_result, vel_result);
+}
+
+
+/**
+ * Convert planet-fixed positions to altitude, latitude, and longitude with
+ * one of the batched PlanetFixedPosition conversions.
+ * @return New reference to the result, or null with an exception set
+ * \param[in] ellip Elliptical (true) or spherical (false) coordinates?
+ * \param[in] cart_obj Positions, 3 x N
+ * \param[in] r_eq Equatorial radius\n Units: M
+ * \param[in] flat_inv Inverse flattening; zero for a sphere
+ * \param[in] out_obj Out argument, or None
+ */
+PyObject *
+convert_cart (
+   bool ellip,
+   PyObject * cart_obj,
+   double r_eq,
+   double flat_inv,
+   PyObject * out_obj)
+{
+   if (! (r_eq > 0.0)) {
+      PyErr_SetString (PyExc_ValueError, "r_eq must be positive");
+      return nullptr;
+   }
+   if ((flat_inv != 0.0) && (! (flat_inv > 1.0))) {
+      PyErr_SetString (PyExc_ValueError,
+                       "flat_inv must be zero or greater than one");
+      return nullptr;
+   }
+
+   DoubleBuffer cart;
+   if (! cart.acquire (cart_obj, "cart", false, 2, 3, -1)) {
+      return nullptr;
+   }
+   unsigned int num = static_cast<unsigned int> (cart.shape(1));
+
+   PyObject * result = output_array (out_obj, 2, 3, num);
+   DoubleBuffer out;
+   if ((result == nullptr) ||
+       (! out.acquire (result, "out", true, 2, 3, num))) {
+      Py_XDECREF (result);
+      return nullptr;
+   }
+
+   // The shape parameters as set by Planet::initialize from flat_inv.
+   Planet planet;
+   planet.r_eq = r_eq;
+   if (flat_inv != 0.0) {
+      planet.flat_inv = flat_inv;
+      planet.flat_coeff = 1.0 / flat_inv;
+      planet.e_ellip_sq = (2.0 * planet.flat_coeff) -
+                          (planet.flat_coeff * planet.flat_coeff);
+      planet.e_ellipsoid = std::sqrt (planet.e_ellip_sq);
+      planet.r_pol = r_eq * (1.0 - planet.flat_coeff);
+   }
+   else {
+      planet.r_pol = r_eq;
+   }
+
+   PlanetFixedPosition posn;
+   posn.planet = &planet;
+
+   const double * axes[3] = {
+      cart.data(), cart.data() + num, cart.data() + 2 * num};
+   double * alt = out.data();
+   double * lat = out.data() + num;
+   double * lon = out.data() + 2 * num;
+
+   try {
+      if (ellip) {
+         posn.convert_cart_to_ellip (num, axes, alt, lat, lon);
+      }
+      else {
+         posn.convert_cart_to_spher (num, axes, alt, lat, lon);
+      }
+   }
+   catch (const JeodFailure & failure) {
+      PyErr_SetString (PyExc_RuntimeError, failure.what());
+      Py_DECREF (result);
+      return nullptr;
+   }
+
+   return result;
+}
+
+
+PyObject *
+cart_to_ellip (
+   PyObject *,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {"cart", "r_eq", "flat_inv", "out", nullptr};
+   PyObject * cart_obj;
+   double r_eq;
+   double flat_inv = 0.0;
+   PyObject * out_obj = Py_None;
+
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "Od|dO:cart_to_ellip",
+            const_cast<char **> (keywords),
+            &cart_obj, &r_eq, &flat_inv, &out_obj)) {
+      return nullptr;
+   }
+
+   return convert_cart (true, cart_obj, r_eq, flat_inv, out_obj);
+}
+
+
+PyObject *
+cart_to_spher (
+   PyObject *,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {"cart", "r_eq", "out", nullptr};
+   PyObject * cart_obj;
+   double r_eq;
+   PyObject * out_obj = Py_None;
+
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "Od|O:cart_to_spher",
+            const_cast<char **> (keywords),
+            &cart_obj, &r_eq, &out_obj)) {
+      return nullptr;
+   }
+
+   return convert_cart (false, cart_obj, r_eq, 0.0, out_obj);
+}
+
+
+/**
+ * A spherical harmonics gravity field, evaluated on the host with the
+ * SphericalHarmonicsOffload kernel (or on the device, when JEOD is built
+ * with JEOD_OFFLOAD and one is present).
+ */
+struct GravityFieldObject {
+   PyObject_HEAD
+   SphericalHarmonicsGravitySource * source;
+   SphericalHarmonicsOffload * offload;
+};
+
+
+void
+GravityField_dealloc (
+   GravityFieldObject * self)
+{
+   if (self->offload != nullptr) {
+      JEOD_DELETE_OBJECT (self->offload);
+   }
+   if (self->source != nullptr) {
+      JEOD_DELETE_OBJECT (self->source);
+   }
+   PyTypeObject * type = Py_TYPE(self);
+   type->tp_free (reinterpret_cast<PyObject *> (self));
+   Py_DECREF (type);
+}
+
+
+int
+GravityField_init (
+   GravityFieldObject * self,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {"coeff_file", "data_module", nullptr};
+   const char * coeff_file = nullptr;
+   const char * data_module = nullptr;
+
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "|zz:GravityField",
+            const_cast<char **> (keywords), &coeff_file, &data_module)) {
+      return -1;
+   }
+   if ((coeff_file == nullptr) == (data_module == nullptr)) {
+      PyErr_SetString (PyExc_TypeError,
+                       "exactly one of coeff_file and data_module is required");
+      return -1;
+   }
+   if (self->source != nullptr) {
+      PyErr_SetString (PyExc_RuntimeError, "GravityField is already loaded");
+      return -1;
+   }
+
+   self->source = JEOD_ALLOC_CLASS_OBJECT (SphericalHarmonicsGravitySource, ());
+   self->offload = JEOD_ALLOC_CLASS_OBJECT (SphericalHarmonicsOffload, ());
+   self->offload->allow_host_execution = true;
+
+   try {
+      if (coeff_file != nullptr) {
+         self->source->map_coefficient_file (coeff_file);
+      }
+      else {
+         self->source->load_data_module (data_module);
+      }
+      self->source->initialize_body ();
+   }
+   catch (const JeodFailure & failure) {
+      PyErr_SetString (PyExc_RuntimeError, failure.what());
+      JEOD_DELETE_OBJECT (self->offload);
+      JEOD_DELETE_OBJECT (self->source);
+      self->offload = nullptr;
+      self->source = nullptr;
+      return -1;
+   }
+
+   return 0;
+}
+
+
+/**
+ * Check that a GravityField has been loaded.
+ * @return True if loaded; otherwise a Python exception is set
+ */
+bool
+GravityField_loaded (
+   GravityFieldObject * self)
+{
+   if (self->source == nullptr) {
+      PyErr_SetString (PyExc_RuntimeError, "GravityField is not loaded");
+      return false;
+   }
+   return true;
+}
+
+
+PyObject *
+GravityField_gravitation (
+   GravityFieldObject * self,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {
+      "posn", "degree", "order", "T_inertial_pfix", "spherical",
+      "accel_out", "pot_out", nullptr};
+   PyObject * posn_obj;
+   int degree = -1;
+   int order = -1;
+   PyObject * T_obj = Py_None;
+   int spherical = 1;
+   PyObject * accel_out_obj = Py_None;
+   PyObject * pot_out_obj = Py_None;
+
+   if (! GravityField_loaded (self)) {
+      return nullptr;
+   }
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "O|iiOpOO:gravitation",
+            const_cast<char **> (keywords),
+            &posn_obj, &degree, &order, &T_obj, &spherical,
+            &accel_out_obj, &pot_out_obj)) {
+      return nullptr;
+   }
+
+   SphericalHarmonicsGravitySource & source = *self->source;
+   unsigned int eval_degree = (degree < 0) ?
+      source.degree : static_cast<unsigned int> (degree);
+   if (eval_degree > source.degree) {
+      PyErr_Format (PyExc_ValueError,
+                    "degree %u exceeds the model degree %u",
+                    eval_degree, source.degree);
+      return nullptr;
+   }
+   unsigned int eval_order = (order < 0) ?
+      eval_degree : std::min (static_cast<unsigned int> (order), eval_degree);
+
+   double T_pfix[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+   if (T_obj != Py_None) {
+      DoubleBuffer T;
+      if (! T.acquire (T_obj, "T_inertial_pfix", false, 2, 3, 3)) {
+         return nullptr;
+      }
+      std::memcpy (T_pfix, T.data(), sizeof(T_pfix));
+   }
+
+   DoubleBuffer posn;
+   if (! posn.acquire (posn_obj, "posn", false, 2, 3, -1)) {
+      return nullptr;
+   }
+   unsigned int num = static_cast<unsigned int> (posn.shape(1));
+
+   PyObject * accel_result = output_array (accel_out_obj, 2, 3, num);
+   PyObject * pot_result = output_array (pot_out_obj, 1, num);
+   DoubleBuffer accel;
+   DoubleBuffer pot;
+   if ((accel_result == nullptr) || (pot_result == nullptr) ||
+       (! accel.acquire (accel_result, "accel_out", true, 2, 3, num)) ||
+       (! pot.acquire (pot_result, "pot_out", true, 1, num))) {
+      Py_XDECREF (accel_result);
+      Py_XDECREF (pot_result);
+      return nullptr;
+   }
+
+   // Non-spherical terms, as SphericalHarmonicsGravityControls evaluates
+   // them on its offload backend.
+   if ((eval_degree >= 2) && (num > 0)) {
+      try {
+         source.require_degree (eval_degree);
+         double local_C20 = source.packed_terms[
+            SphericalHarmonicsGravitySource::packed_row(2)].Cnm;
+
+         double * staged = self->offload->stage_positions (num);
+         std::memcpy (staged, posn.data(), 3 * num * sizeof(double));
+         self->offload->evaluate (source, T_pfix, eval_degree, eval_order,
+                                  local_C20);
+      }
+      catch (const JeodFailure & failure) {
+         PyErr_SetString (PyExc_RuntimeError, failure.what());
+         Py_DECREF (accel_result);
+         Py_DECREF (pot_result);
+         return nullptr;
+      }
+      std::memcpy (accel.data(), self->offload->get_accelerations(),
+                   3 * num * sizeof(double));
+      std::memcpy (pot.data(), self->offload->get_potentials(),
+                   num * sizeof(double));
+   }
+   else {
+      std::fill (accel.data(), accel.data() + 3 * num, 0.0);
+      std::fill (pot.data(), pot.data() + num, 0.0);
+   }
+
+   // Spherical term, as GravityControls::calc_spherical adds it.
+   if (spherical) {
+      const double * x = posn.data();
+      const double * y = x + num;
+      const double * z = y + num;
+      double * ax = accel.data();
+      double * ay = ax + num;
+      double * az = ay + num;
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         double r_sq = x[ii] * x[ii] + y[ii] * y[ii] + z[ii] * z[ii];
+         double r_mag = std::sqrt (r_sq);
+         double scale = -source.mu / (r_sq * r_mag);
+         ax[ii] += scale * x[ii];
+         ay[ii] += scale * y[ii];
+         az[ii] += scale * z[ii];
+         pot.data()[ii] += source.mu / r_mag;
+      }
+   }
+
+   return Py_BuildValue ("(NN)", accel_result, pot_result);
+}
+
+
+PyObject *
+GravityField_get_name (
+   GravityFieldObject * self,
+   void *)
+{
+   if (! GravityField_loaded (self)) {
+      return nullptr;
+   }
+   return PyUnicode_FromString (self->source->name.c_str());
+}
+
+
+PyObject *
+GravityField_get_mu (
+   GravityFieldObject * self,
+   void *)
+{
+   if (! GravityField_loaded (self)) {
+      return nullptr;
+   }
+   return PyFloat_FromDouble (self->source->mu);
+}
+
+
+PyObject *
+GravityField_get_radius (
+   GravityFieldObject * self,
+   void *)
+{
+   if (! GravityField_loaded (self)) {
+      return nullptr;
+   }
+   return PyFloat_FromDouble (self->source->radius);
+}
+
+
+PyObject *
+GravityField_get_degree (
+   GravityFieldObject * self,
+   void *)
+{
+   if (! GravityField_loaded (self)) {
+      return nullptr;
+   }
+   return PyLong_FromUnsignedLong (self->source->degree);
+}
+
+
+PyObject *
+GravityField_get_order (
+   GravityFieldObject * self,
+   void *)
+{
+   if (! GravityField_loaded (self)) {
+      return nullptr;
+   }
+   return PyLong_FromUnsignedLong (self->source->order);
+}
+
+
+PyMethodDef GravityField_methods[] = {
+   {"gravitation",
+    reinterpret_cast<PyCFunction> (
+       reinterpret_cast<void (*) (void)> (GravityField_gravitation)),
+    METH_VARARGS | METH_KEYWORDS,
+    "gravitation(posn, degree=-1, order=-1, T_inertial_pfix=None,\n"
+    "            spherical=True, accel_out=None, pot_out=None)\n"
+    "--\n\n"
+    "Gravitational acceleration and specific potential at a batch of\n"
+    "points. posn (3 x N, m) holds the positions relative to the field's\n"
+    "body, inertial coordinates; T_inertial_pfix (3 x 3) transforms\n"
+    "inertial to planet-fixed coordinates and defaults to the identity.\n"
+    "A negative degree or order selects the model's. With spherical\n"
+    "false, only the non-spherical terms are returned.\n"
+    "Returns (accel, pot): 3 x N (m/s2) and N (m2/s2)."},
+   {nullptr, nullptr, 0, nullptr}
+};
+
+
+PyGetSetDef GravityField_getset[] = {
+   {const_cast<char *> ("name"),
+    reinterpret_cast<getter> (GravityField_get_name), nullptr,
+    const_cast<char *> ("Body name"), nullptr},
+   {const_cast<char *> ("mu"),
+    reinterpret_cast<getter> (GravityField_get_mu), nullptr,
+    const_cast<char *> ("Gravitational parameter, m3/s2"), nullptr},
+   {const_cast<char *> ("radius"),
+    reinterpret_cast<getter> (GravityField_get_radius), nullptr,
+    const_cast<char *> ("Reference radius, m"), nullptr},
+   {const_cast<char *> ("degree"),
+    reinterpret_cast<getter> (GravityField_get_degree), nullptr,
+    const_cast<char *> ("Model degree"), nullptr},
+   {const_cast<char *> ("order"),
+    reinterpret_cast<getter> (GravityField_get_order), nullptr,
+    const_cast<char *> ("Model order"), nullptr},
+   {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+
+PyType_Slot GravityField_slots[] = {
+   {Py_tp_dealloc, reinterpret_cast<void *> (GravityField_dealloc)},
+   {Py_tp_init, reinterpret_cast<void *> (GravityField_init)},
+   {Py_tp_methods, GravityField_methods},
+   {Py_tp_getset, GravityField_getset},
+   {Py_tp_doc, const_cast<char *> (
+      "GravityField(coeff_file=None, data_module=None)\n"
+      "--\n\n"
+      "A spherical harmonics gravity field, loaded from a binary\n"
+      "coefficient file or a gravity data module (e.g., 'earth_GGM05C').")},
+   {0, nullptr}
+};
+
+
+PyType_Spec GravityField_spec = {
+   "jeod_batch.GravityField",
+   sizeof(GravityFieldObject),
+   0,
+   Py_TPFLAGS_DEFAULT,
+   GravityField_slots
+};
+
+
+/**
+ * A DE4xx ephemeris file, read with De4xxFile.
+ */
+struct De4xxFileObject {
+   PyObject_HEAD
+   De4xxFile * file;
+   int init_state; // 0: not initialized, 1: initialized, -1: failed
+};
+
+
+void
+De4xxFile_dealloc (
+   De4xxFileObject * self)
+{
+   if (self->file != nullptr) {
+      JEOD_DELETE_OBJECT (self->file);
+   }
+   PyTypeObject * type = Py_TYPE(self);
+   type->tp_free (reinterpret_cast<PyObject *> (self));
+   Py_DECREF (type);
+}
+
+
+int
+De4xxFile_init (
+   De4xxFileObject * self,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {
+      "model_number", "directory", "binary_file", nullptr};
+   int model_number = 440;
+   const char * directory = nullptr;
+   const char * binary_file = nullptr;
+
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "|izz:De4xxFile",
+            const_cast<char **> (keywords),
+            &model_number, &directory, &binary_file)) {
+      return -1;
+   }
+   if (self->file != nullptr) {
+      PyErr_SetString (PyExc_RuntimeError, "De4xxFile is already set up");
+      return -1;
+   }
+
+   self->file = JEOD_ALLOC_CLASS_OBJECT (De4xxFile, ());
+   self->init_state = 0;
+
+   De4xxFileSpec & spec = self->file->file_spec;
+   spec.set_model_number (model_number);
+   if (binary_file != nullptr) {
+      spec.set_binary_file (binary_file);
+   }
+   if (directory != nullptr) {
+      spec.set_file_directory (directory);
+   }
+
+   return 0;
+}
+
+
+PyObject *
+De4xxFile_states (
+   De4xxFileObject * self,
+   PyObject * args,
+   PyObject * kwargs)
+{
+   static const char * keywords[] = {
+      "item", "times", "pos_out", "vel_out", nullptr};
+   int item;
+   PyObject * times_obj;
+   PyObject * pos_out_obj = Py_None;
+   PyObject * vel_out_obj = Py_None;
+
+   if (self->file == nullptr) {
+      PyErr_SetString (PyExc_RuntimeError, "De4xxFile is not set up");
+      return nullptr;
+   }
+   if (! PyArg_ParseTupleAndKeywords (
+            args, kwargs, "iO|OO:states",
+            const_cast<char **> (keywords),
+            &item, &times_obj, &pos_out_obj, &vel_out_obj)) {
+      return nullptr;
+   }
+
+   DoubleBuffer times;
+   if (! times.acquire (times_obj, "times", false, 1, -1)) {
+      return nullptr;
+   }
+   unsigned int num = static_cast<unsigned int> (times.shape(0));
+
+   PyObject * pos_result = output_array (pos_out_obj, 2, num, 3);
+   PyObject * vel_result = output_array (vel_out_obj, 2, num, 3);
+   DoubleBuffer pos;
+   DoubleBuffer vel;
+   if ((pos_result == nullptr) || (vel_result == nullptr) ||
+       (! pos.acquire (pos_result, "pos_out", true, 2, num, 3)) ||
+       (! vel.acquire (vel_result, "vel_out", true, 2, num, 3))) {
+      Py_XDECREF (pos_result);
+      Py_XDECREF (vel_result);
+      return nullptr;
+   }
+   if (num == 0) {
+      return Py_BuildValue ("(NN)", pos_result, vel_result);
+   }
+
+   De4xxFile & file = *self->file;
+   const double * tjt = times.data();
+
+   // The file is opened at the first time requested, as De4xxEphemeris
+   // opens it at the simulation start time.
+   if (self->init_state == 0) {
+      try {
+         file.initialize (Tjt_jd_offset, 0.0, 0.0, tjt[0] * 86400.0);
+         self->init_state = 1;
+      }
+      catch (const JeodFailure & failure) {
+         PyErr_SetString (PyExc_RuntimeError, failure.what());
+         self->init_state = -1;
+      }
+   }
+   if (self->init_state != 1) {
+      if (! PyErr_Occurred()) {
+         PyErr_SetString (PyExc_RuntimeError,
+                          "De4xxFile could not be initialized");
+      }
+      Py_DECREF (pos_result);
+      Py_DECREF (vel_result);
+      return nullptr;
+   }
+
+   uint32_t num_items = file.io.metaData->number_file_items;
+   if ((item < 0) || (static_cast<uint32_t> (item) >= num_items) ||
+       (! file.item[item].avail)) {
+      PyErr_Format (PyExc_ValueError,
+                    "item %d is not in the ephemeris file", item);
+      Py_DECREF (pos_result);
+      Py_DECREF (vel_result);
+      return nullptr;
+   }
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      if (! file.time_is_in_range (tjt[ii] * 86400.0)) {
+         PyErr_Format (PyExc_ValueError,
+                       "times[%u] is outside the ephemeris file", ii);
+         Py_DECREF (pos_result);
+         Py_DECREF (vel_result);
+         return nullptr;
+      }
+   }
+
+   for (uint32_t ii = 0; ii < num_items; ++ii) {
+      file.item[ii].active = (ii == static_cast<uint32_t> (item));
+   }
+
+   const De4xxFileItem & file_item = file.item[item];
+   double * pos_row = pos.data();
+   double * vel_row = vel.data();
+   try {
+      for (unsigned int ii = 0; ii < num; ++ii, pos_row += 3, vel_row += 3) {
+         file.update (tjt[ii] * 86400.0);
+         pos_row[0] = file_item.state[0][0];
+         pos_row[1] = file_item.state[0][1];
+         pos_row[2] = file_item.state[0][2];
+         vel_row[0] = file_item.state[1][0];
+         vel_row[1] = file_item.state[1][1];
+         vel_row[2] = file_item.state[1][2];
+      }
+   }
+   catch (const JeodFailure & failure) {
+      PyErr_SetString (PyExc_RuntimeError, failure.what());
+      Py_DECREF (pos_result);
+      Py_DECREF (vel_result);
+      return nullptr;
+   }
+
+   return Py_BuildValue ("(NN)", pos_result, vel_result);
+}
+
+
+PyMethodDef De4xxFile_methods[] = {
+   {"states",
+    reinterpret_cast<PyCFunction> (
+       reinterpret_cast<void (*) (void)> (De4xxFile_states)),
+    METH_VARARGS | METH_KEYWORDS,
+    "states(item, times, pos_out=None, vel_out=None)\n"
+    "--\n\n"
+    "States of a file item (one of the DE4XX_FILE constants) at a vector\n"
+    "of times, given as Terrestrial Time truncated Julian dates (days).\n"
+    "The file is opened at the first time of the first call; every time\n"
+    "must lie within the file. Positions are in m and velocities in m/s,\n"
+    "as stored in the file (e.g., the Moon relative to the Earth).\n"
+    "Returns (pos, vel), each N x 3."},
+   {nullptr, nullptr, 0, nullptr}
+};
+
+
+PyType_Slot De4xxFile_slots[] = {
+   {Py_tp_dealloc, reinterpret_cast<void *> (De4xxFile_dealloc)},
+   {Py_tp_init, reinterpret_cast<void *> (De4xxFile_init)},
+   {Py_tp_methods, De4xxFile_methods},
+   {Py_tp_doc, const_cast<char *> (
+      "De4xxFile(model_number=440, directory=None, binary_file=None)\n"
+      "--\n\n"
+      "A DE4xx ephemeris, from the generated library libde<model_number>.so\n"
+      "in directory (build/de4xx_lib by default) or from a JPL binary file.")},
+   {0, nullptr}
+};
+
+
+PyType_Spec De4xxFile_spec = {
+   "jeod_batch.De4xxFile",
+   sizeof(De4xxFileObject),
+   0,
+   Py_TPFLAGS_DEFAULT,
+   De4xxFile_slots
+};
+
+
+PyMethodDef module_methods[] = {
+   {"elements_from_cartesian",
+    reinterpret_cast<PyCFunction> (
+       reinterpret_cast<void (*) (void)> (elements_from_cartesian)),
+    METH_VARARGS | METH_KEYWORDS,
+    "elements_from_cartesian(mu, pos, vel, out=None)\n"
+    "--\n\n"
+    "Orbital elements of a batch of inertial states about a body with\n"
+    "gravitational parameter mu (m3/s2). pos (m) and vel (m/s) are N x 3.\n"
+    "Returns the N x 8 element sets; see ELEMENT_FIELDS."},
+   {"elements_to_cartesian",
+    reinterpret_cast<PyCFunction> (
+       reinterpret_cast<void (*) (void)> (elements_to_cartesian)),
+    METH_VARARGS | METH_KEYWORDS,
+    "elements_to_cartesian(mu, elements, from_mean_anom=False,\n"
+    "                      pos_out=None, vel_out=None)\n"
+    "--\n\n"
+    "Inertial states of a batch of N x 8 element sets (see ELEMENT_FIELDS)\n"
+    "about a body with gravitational parameter mu (m3/s2). The semiparam,\n"
+    "e_mag, inclination, arg_periapsis, and long_asc_node columns are used,\n"
+    "with true_anom, or mean_anom if from_mean_anom is true.\n"
+    "Returns (pos, vel), each N x 3."},
+   {"cart_to_ellip",
+    reinterpret_cast<PyCFunction> (
+       reinterpret_cast<void (*) (void)> (cart_to_ellip)),
+    METH_VARARGS | METH_KEYWORDS,
+    "cart_to_ellip(cart, r_eq, flat_inv=0.0, out=None)\n"
+    "--\n\n"
+    "Elliptical (geodetic) altitudes, latitudes, and longitudes of 3 x N\n"
+    "planet-fixed positions (m) about an ellipsoid with equatorial radius\n"
+    "r_eq (m) and inverse flattening flat_inv (zero for a sphere).\n"
+    "Returns a 3 x N array whose rows are alt (m), lat, and lon (rad)."},
+   {"cart_to_spher",
+    reinterpret_cast<PyCFunction> (
+       reinterpret_cast<void (*) (void)> (cart_to_spher)),
+    METH_VARARGS | METH_KEYWORDS,
+    "cart_to_spher(cart, r_eq, out=None)\n"
+    "--\n\n"
+    "Spherical (geocentric) altitudes, latitudes, and longitudes of 3 x N\n"
+    "planet-fixed positions (m) about a body with equatorial radius r_eq.\n"
+    "Returns a 3 x N array whose rows are alt (m), lat, and lon (rad)."},
+   {nullptr, nullptr, 0, nullptr}
+};
+
+
+PyModuleDef module_def = {
+   PyModuleDef_HEAD_INIT,
+   "jeod_batch",
+   "Batched JEOD computations on arrays that export the buffer protocol.",
+   -1,
+   module_methods,
+   nullptr, nullptr, nullptr, nullptr
+};
+
+
+/**
+ * Add an object to the module, taking over the reference to it.
+ * @return True on success; on failure a Python exception is set
+ * \param[in] module Module
+ * \param[in] name Attribute name
+ * \param[in] obj Object; null if its creation failed
+ */
+bool
+add_object (
+   PyObject * module,
+   const char * name,
+   PyObject * obj)
+{
+   if (obj == nullptr) {
+      return false;
+   }
+   if (PyModule_AddObject (module, name, obj) != 0) {
+      Py_DECREF (obj);
+      return false;
+   }
+   return true;
+}
+
+
+/**
+ * Create the JEOD message handler and simulation interface used by the
+ * module.
+ */
+void
+create_jeod_services ()
+{
+   if (message_handler != nullptr) {
+      return;
+   }
+   message_handler = new PythonMessageHandler;
+   new PythonSimInterface;
+}
+
+}
+
+
+PyMODINIT_FUNC
+PyInit_jeod_batch (
+   void)
+{
+   create_jeod_services ();
+
+   PyObject * module = PyModule_Create (&module_def);
+   if (module == nullptr) {
+      return nullptr;
+   }
+
+   static const struct {
+      const char * name;
+      int value;
+   } items[] = {
+      {"DE4XX_FILE_MERCURY", De4xxBase::De4xx_File_Mercury},
+      {"DE4XX_FILE_VENUS", De4xxBase::De4xx_File_Venus},
+      {"DE4XX_FILE_EMBARY", De4xxBase::De4xx_File_EMbary},
+      {"DE4XX_FILE_MARS", De4xxBase::De4xx_File_Mars},
+      {"DE4XX_FILE_JUPITER", De4xxBase::De4xx_File_Jupiter},
+      {"DE4XX_FILE_SATURN", De4xxBase::De4xx_File_Saturn},
+      {"DE4XX_FILE_URANUS", De4xxBase::De4xx_File_Uranus},
+      {"DE4XX_FILE_NEPTUNE", De4xxBase::De4xx_File_Neptune},
+      {"DE4XX_FILE_PLUTO", De4xxBase::De4xx_File_Pluto},
+      {"DE4XX_FILE_MOON", De4xxBase::De4xx_File_Moon},
+      {"DE4XX_FILE_SUN", De4xxBase::De4xx_File_Sun},
+      {"DE4XX_FILE_ENUTATION", De4xxBase::De4xx_File_ENutation},
+      {"DE4XX_FILE_LLIBRATION", De4xxBase::De4xx_File_LLibration},
+      {"DE4XX_FILE_LANGVEL", De4xxBase::De4xx_File_LAngVel},
+      {"DE4XX_FILE_TT_TDB", De4xxBase::De4xx_File_tt_tdb}};
+
+   bool ok = true;
+   for (unsigned int ii = 0; ok && (ii < sizeof(items) / sizeof(items[0])); ++ii) {
+      ok = (PyModule_AddIntConstant (module, items[ii].name, items[ii].value) == 0);
+   }
+
+   PyObject * fields = ok ? PyTuple_New (Num_element_fields) : nullptr;
+   for (unsigned int ii = 0; (fields != nullptr) && (ii < Num_element_fields); ++ii) {
+      PyTuple_SET_ITEM (fields, ii, PyUnicode_FromString (Element_fields[ii]));
+   }
+   ok = add_object (module, "ELEMENT_FIELDS", fields) &&
+        add_object (module, "GravityField",
+                    PyType_FromSpec (&GravityField_spec)) &&
+        add_object (module, "De4xxFile",
+                    PyType_FromSpec (&De4xxFile_spec));
+
+   if (! ok) {
+      Py_DECREF (module);
+      return nullptr;
+   }
+
+   return module;
+}
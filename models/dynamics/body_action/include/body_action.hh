@@ -135,6 +135,11 @@ class BodyAction {
 
    DynBody * get_subject_dyn_body();
 
+   /**
+    * Make this a time-triggered action, activated at the specified time.
+    */
+   void set_activation_time (double time, int priority = 0);
+
    /**
     * Controls when the action is performed.
     * The action will be performed when the action is activated via this flag
@@ -167,6 +172,43 @@ class BodyAction {
     */
    std::string action_name; //!< trick_units(--)
 
+   /**
+    * Indicates whether the action is held by the dynamics manager until
+    * the activation_time is reached.
+    * A time-triggered action is kept out of the dynamics manager's list of
+    * pending actions until the dynamics manager timestamp reaches the
+    * activation time, at which point the action is activated and enqueued.
+    * This flag must be set before the action is added to the dynamics
+    * manager. The default value for this flag is false.
+    */
+   bool time_triggered; //!< trick_units(--)
+
+   /**
+    * Dynamics manager timestamp at which a time-triggered action is to be
+    * activated. Ignored if time_triggered is false.
+    */
+   double activation_time; //!< trick_units(s)
+
+   /**
+    * Orders time-triggered actions that share an activation time.
+    * Actions with a lower priority value are enqueued first; ties are
+    * resolved by the order in which the actions were added.
+    */
+   int activation_priority; //!< trick_units(--)
+
+   /**
+    * Order in which the dynamics manager received this time-triggered action.
+    * Set by the dynamics manager; not for user input.
+    */
+   unsigned int activation_sequence; //!< trick_units(--)
+
+   /**
+    * Is the action held by the dynamics manager, either in its queue or
+    * awaiting its activation time? Set by the dynamics manager; not for
+    * user input.
+    */
+   bool queued; //!< trick_units(--)
+
 
  protected:
 
@@ -67,6 +67,8 @@ class BodyAction;
 class BodyActionMessages;
 
 class DynBodyFrameSwitch;
+class DynBodyFreeze;
+class DynBodyWake;
 
 class DynBodyInit;
 class DynBodyInitLvlhRotState;
@@ -143,6 +143,16 @@ class DynBodyFrameSwitch : public BodyAction {
     */
    double switch_distance; //!< trick_units(m)
 
+   /**
+    * Upper bound on the speed of the subject body relative to the origin of
+    * the frame that defines the sphere of influence. When positive, the
+    * switch condition is not evaluated again until the body could have
+    * covered, at this speed, the distance to the sphere found by the
+    * previous evaluation. When zero (the default), the condition is
+    * evaluated on every pass.
+    */
+   double max_relative_speed; //!< trick_units(m/s)
+
 
  protected:
    /**
@@ -150,6 +160,33 @@ class DynBodyFrameSwitch : public BodyAction {
     */
    EphemerisRefFrame * integ_frame; //!< trick_io(**)
 
+   /**
+    * The dynamics manager, the source of the current time.
+    */
+   const DynManager * manager; //!< trick_io(**)
+
+   /**
+    * Dynamics manager time at which the switch condition was last
+    * evaluated.
+    */
+   double last_check_time; //!< trick_units(s)
+
+   /**
+    * Dynamics manager time before which the switch cannot occur.
+    */
+   double next_check_time; //!< trick_units(s)
+
+   /**
+    * Set when evaluate_switches has determined the verdict that the next
+    * call to is_ready is to return.
+    */
+   bool verdict_pending; //!< trick_units(--)
+
+   /**
+    * The pending verdict.
+    */
+   bool verdict; //!< trick_units(--)
+
 
  // Member functions
 
@@ -172,6 +209,20 @@ class DynBodyFrameSwitch : public BodyAction {
    // the appropriate sphere of influence?
    bool is_ready (void) override;
 
+   // evaluate_switches: Evaluate a set of frame switches together.
+   static void evaluate_switches (
+      unsigned int count,
+      DynBodyFrameSwitch * const * switches);
+
+
+ protected:
+
+   // is_due: Can the switch have occurred by the given time?
+   bool is_due (double time) const;
+
+   // distance_squared: Square of the distance that defines the switch.
+   double distance_squared (void) const;
+
 };
 
 } // End JEOD namespace
@@ -0,0 +1,140 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup BodyAction
+ * @{
+ *
+ * @file models/dynamics/body_action/include/dyn_body_freeze.hh
+ * Define the class DynBodyFreeze, the BodyAction derived class used for
+ * freezing a DynBody in place with respect to a reference frame.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/dyn_body_freeze.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DYN_BODY_FREEZE_HH
+#define JEOD_DYN_BODY_FREEZE_HH
+
+
+// System includes
+#include <string>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/class_declarations.hh"
+#include "utils/ref_frames/include/class_declarations.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+#include "body_action.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Freeze a DynBody in place with respect to a reference frame, such as a
+ * planet-fixed frame for a landed vehicle. See DynBody::freeze.
+ * This is inherently an asynchronous BodyAction.
+ * The is_ready() method simply returns the action's active flag.
+ */
+class DynBodyFreeze : public BodyAction {
+
+ JEOD_MAKE_SIM_INTERFACES(DynBodyFreeze)
+
+
+ // Member data
+
+ public:
+
+   /**
+    * The name of the frame to which the body is to be frozen.
+    */
+   std::string frame_name; //!< trick_units(--)
+
+
+ protected:
+
+   /**
+    * The reference frame corresponding to the input frame_name.
+    */
+   RefFrame * frame; //!< trick_io(**)
+
+
+ // Member functions
+
+ public:
+
+   // Default constructor.
+   DynBodyFreeze ();
+
+   // Destructor.
+   ~DynBodyFreeze () override;
+
+   // initialize: Initialize the action.
+   void initialize (DynManager & dyn_manager) override;
+
+   // apply: Freeze the body.
+   void apply (DynManager & dyn_manager) override;
+
+   // is_ready: Is the action ready? (In this case, is the active flag set?)
+   bool is_ready (void) override;
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -69,6 +69,7 @@ Library dependencies:
 // JEOD includes
 #include "utils/lvlh_frame/include/lvlh_type.hh"
 #include "utils/lvlh_frame/include/lvlh_frame.hh"
+#include "utils/lvlh_frame/include/lvlh_frame_registry.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -104,6 +105,12 @@ private:
     */
    LvlhFrame * lvlh_object_ptr; //!< trick_units(--)
 
+   /**
+    * A pointer to a user-supplied registry from which to obtain the
+    * reference vehicle's LVLH frame, in lieu of constructing one.
+    */
+   LvlhFrameRegistry * lvlh_registry; //!< trick_units(--)
+
 
 // Member functions
 
@@ -116,6 +123,9 @@ public:
    //set_lvlh_frame_object: Sets a pointer to user-supplied LvlhFrame
    void set_lvlh_frame_object (LvlhFrame & lvh_frame_object);
 
+   //set_lvlh_frame_registry: Sets a pointer to a user-supplied registry
+   void set_lvlh_frame_registry (LvlhFrameRegistry & registry);
+
    // initialize: Initialize the initializer.
    void initialize (DynManager & dyn_manager) override;
 
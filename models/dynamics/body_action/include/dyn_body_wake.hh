@@ -0,0 +1,148 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup BodyAction
+ * @{
+ *
+ * @file models/dynamics/body_action/include/dyn_body_wake.hh
+ * Define the class DynBodyWake, the BodyAction derived class used for
+ * returning a frozen DynBody to integration.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/dyn_body_wake.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DYN_BODY_WAKE_HH
+#define JEOD_DYN_BODY_WAKE_HH
+
+
+// System includes
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/class_declarations.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+#include "body_action.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class IntegrationEvent;
+
+/**
+ * Wake a frozen DynBody. See DynBody::wake.
+ * Without a trigger, the action is ready when its active flag is set.
+ * With a trigger, the action is ready when its active flag is set and the
+ * trigger has fired since the action was initialized, so that, e.g., a
+ * landed vehicle wakes when another vehicle comes within some distance.
+ */
+class DynBodyWake : public BodyAction {
+
+ JEOD_MAKE_SIM_INTERFACES(DynBodyWake)
+
+
+ // Member data
+
+ public:
+
+   /**
+    * Optional event that triggers the wake-up. The event must be checked
+    * by an integration group that integrates something other than the
+    * frozen body.
+    */
+   IntegrationEvent * trigger; //!< trick_units(--)
+
+
+ protected:
+
+   /**
+    * The trigger's event count when the action was initialized.
+    */
+   unsigned int trigger_count; //!< trick_units(--)
+
+
+ // Member functions
+
+ public:
+
+   // Default constructor.
+   DynBodyWake ();
+
+   // Destructor.
+   ~DynBodyWake () override;
+
+   // initialize: Initialize the action.
+   void initialize (DynManager & dyn_manager) override;
+
+   // apply: Wake the body.
+   void apply (DynManager & dyn_manager) override;
+
+   // is_ready: Is the action ready?
+   // In this case, is the active flag set and has the trigger, if any, fired?
+   bool is_ready (void) override;
+
+};
+
+} // End JEOD namespace
+
+#ifdef TRICK_VER
+#include "utils/integration/include/integration_event.hh"
+#endif
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -61,6 +61,11 @@ BodyAction::BodyAction (
    active(true),
    terminate_on_error(true),
    action_name(),
+   time_triggered(false),
+   activation_time(0.0),
+   activation_priority(0),
+   activation_sequence(0),
+   queued(false),
    mass_subject(nullptr),
    dyn_subject(nullptr),
    action_identifier()
@@ -143,6 +148,24 @@ BodyAction::is_ready (
    return active;
 }
 
+/**
+ * Make the action time-triggered. The action is inactive until the dynamics
+ * manager activates it at the specified time.
+ * This must be called before the action is added to the dynamics manager.
+ * \param[in] time Activation time\n Units: s
+ * \param[in] priority Ordering among actions sharing an activation time
+ */
+void
+BodyAction::set_activation_time (
+   double time,
+   int priority)
+{
+   time_triggered = true;
+   activation_time = time;
+   activation_priority = priority;
+   active = false;
+}
+
 void BodyAction::set_subject_body(MassBody &mass_body_in)
 {
     mass_subject = &mass_body_in;
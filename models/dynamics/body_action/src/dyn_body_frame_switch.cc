@@ -31,6 +31,7 @@ Library dependencies:
 
 
 // System includes
+#include <cmath>
 #include <cstddef>
 
 // JEOD includes
@@ -61,7 +62,13 @@ DynBodyFrameSwitch::DynBodyFrameSwitch (
    switch_sense(SwitchOnApproach),
    sort_grav_controls(false),
    switch_distance(9e99),
-   integ_frame(nullptr)
+   max_relative_speed(0.0),
+   integ_frame(nullptr),
+   manager(nullptr),
+   last_check_time(0.0),
+   next_check_time(0.0),
+   verdict_pending(false),
+   verdict(false)
 {
    return; // Empty
 }
@@ -128,11 +135,28 @@ DynBodyFrameSwitch::initialize (
       return;
    }
 
+   // Sanity check: The speed bound cannot be negative.
+   if (max_relative_speed < 0.0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::invalid_object,
+         "%s failed:\n"
+         "The maximum relative speed (%g) is negative.",
+         action_identifier.c_str(), max_relative_speed);
+
+      // Not reached
+      return;
+   }
+
    // (Temporarily) subscribe to the new integration frame to force it to be
    // placed in the reference frame tree.
    // The subscription will be withdrawn by apply().
    dyn_manager.subscribe_to_frame (*integ_frame);
 
+   // The first evaluation is not deferred.
+   manager = &dyn_manager;
+   last_check_time = next_check_time = dyn_manager.timestamp();
+   verdict_pending = false;
+
    return;
 }
 
@@ -189,31 +213,144 @@ DynBodyFrameSwitch::apply (
  * Determine whether it is time to switch frames.
  * A frame-switch action is ready if it is activated and if the
  * vehicle has entered/left the appropriate sphere of influence.
+ * The verdict of a preceding evaluate_switches is used if there is one.
  * @return Can action be applied?
  */
 bool
 DynBodyFrameSwitch::is_ready (
    void)
 {
-   bool ready;
+   if (! BodyAction::is_ready()) {
+      verdict_pending = false;
+      return false;
+   }
+
+   if (! verdict_pending) {
+      DynBodyFrameSwitch * self = this;
+      evaluate_switches (1, &self);
+   }
+   verdict_pending = false;
+
+   return verdict;
+}
+
+
+/**
+ * Evaluate the switch conditions of a set of frame switches, leaving each
+ * switch's verdict for its next is_ready call. Only the switches that are
+ * active and due have their distances computed. The tests and the
+ * rescheduling are then done for all of those switches together, as
+ * straight-line arithmetic over contiguous arrays.
+ *
+ * A switch that is not ready is next evaluated once enough time has passed
+ * for the body to cover the distance to the sphere of influence at the
+ * switch's max_relative_speed.
+ * \param[in] count Number of switches
+ * \param[in,out] switches The switches
+ */
+void
+DynBodyFrameSwitch::evaluate_switches (
+   unsigned int count,
+   DynBodyFrameSwitch * const * switches)
+{
+   static const unsigned int chunk_size = 32;
+   DynBodyFrameSwitch * due[chunk_size];
+   double dist_sq[chunk_size];
+   double radius[chunk_size];
+   double sense[chunk_size];
+   double inv_speed[chunk_size];
+   double margin[chunk_size];
+
+   unsigned int idx = 0;
+   while (idx < count) {
+
+      // Gather the switches that are due, with their distances.
+      unsigned int num_due = 0;
+      for (; (idx < count) && (num_due < chunk_size); ++idx) {
+         DynBodyFrameSwitch * frame_switch = switches[idx];
+         frame_switch->verdict_pending = true;
+         frame_switch->verdict = false;
+
+         if ((! frame_switch->BodyAction::is_ready()) ||
+             (! frame_switch->is_due (frame_switch->manager->timestamp()))) {
+            continue;
+         }
+
+         double speed = frame_switch->max_relative_speed;
+         due[num_due] = frame_switch;
+         dist_sq[num_due] = frame_switch->distance_squared ();
+         radius[num_due] = frame_switch->switch_distance;
+         sense[num_due] =
+            (frame_switch->switch_sense == SwitchOnApproach) ? 1.0 : -1.0;
+         inv_speed[num_due] = (speed > 0.0) ? 1.0 / speed : 0.0;
+         ++num_due;
+      }
 
-   if (BodyAction::is_ready()) {
-      if (switch_sense == SwitchOnApproach) {
-         double rel_pos[3];
-         dyn_subject->composite_body.compute_position_from (*integ_frame, rel_pos);
-         ready = Vector3::vmagsq(rel_pos) < switch_distance * switch_distance;
+      // Compute the signed distance to each sphere of influence, positive
+      // when the switch has not happened.
+      for (unsigned int ii = 0; ii < num_due; ++ii) {
+         margin[ii] =
+            sense[ii] * (dist_sq[ii] - radius[ii] * radius[ii]);
       }
-      else {
-         ready =
-            Vector3::vmagsq(dyn_subject->composite_body.state.trans.position) >
-            switch_distance * switch_distance;
+
+      // Record the verdicts and schedule the next evaluations. The time to
+      // the sphere is zero for a switch that evaluates on every pass.
+      for (unsigned int ii = 0; ii < num_due; ++ii) {
+         DynBodyFrameSwitch * frame_switch = due[ii];
+         double time = frame_switch->manager->timestamp();
+         bool ready = margin[ii] < 0.0;
+         double time_to_sphere = 0.0;
+         if ((! ready) && (inv_speed[ii] > 0.0)) {
+            time_to_sphere =
+               sense[ii] * (std::sqrt (dist_sq[ii]) - radius[ii]) *
+               inv_speed[ii];
+         }
+         frame_switch->verdict = ready;
+         frame_switch->last_check_time = time;
+         frame_switch->next_check_time = time + time_to_sphere;
       }
    }
+}
+
+
+/**
+ * Determine whether the switch condition needs to be evaluated at the
+ * given time. It does unless the condition was evaluated earlier and the
+ * body cannot yet have reached the sphere of influence. A time earlier
+ * than that of the last evaluation also forces an evaluation.
+ * @return True if the condition is to be evaluated
+ * \param[in] time Dynamics manager time\n Units: s
+ */
+bool
+DynBodyFrameSwitch::is_due (
+   double time)
+const
+{
+   return (max_relative_speed <= 0.0) ||
+          (time < last_check_time) ||
+          (time >= next_check_time);
+}
+
+
+/**
+ * Compute the square of the distance that defines the switch: the distance
+ * from the new integration frame on approach, from the current integration
+ * frame on departure.
+ * @return Distance squared\n Units: m2
+ */
+double
+DynBodyFrameSwitch::distance_squared (
+   void)
+const
+{
+   if (switch_sense == SwitchOnApproach) {
+      double rel_pos[3];
+      dyn_subject->composite_body.compute_position_from (*integ_frame, rel_pos);
+      return Vector3::vmagsq (rel_pos);
+   }
    else {
-      ready = false;
+      return Vector3::vmagsq (dyn_subject->composite_body.state.trans.position);
    }
-
-   return ready;
 }
 
 } // End JEOD namespace
@@ -0,0 +1,190 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup BodyAction
+ * @{
+ *
+ * @file models/dynamics/body_action/src/dyn_body_freeze.cc
+ * Define methods for the class DynBodyFreeze.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((dyn_body_freeze.cc)
+   (body_action.cc)
+   (body_action_messages.cc)
+   (dynamics/dyn_body/src/dyn_body.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+
+// Model includes
+#include "../include/body_action_messages.hh"
+#include "../include/dyn_body_freeze.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a DynBodyFreeze instance.
+ */
+DynBodyFreeze::DynBodyFreeze (
+   void)
+:
+   BodyAction(),
+   frame_name(),
+   frame(nullptr)
+{
+   active = false;
+
+   return;
+}
+
+
+/**
+ * Destruct a DynBodyFreeze instance.
+ */
+DynBodyFreeze::~DynBodyFreeze (
+   void)
+{
+   return; // Empty
+}
+
+
+/**
+ * Initialize a DynBodyFreeze instance.
+ * \param[in,out] dyn_manager Dynamics manager
+ */
+void
+DynBodyFreeze::initialize (
+   DynManager & dyn_manager)
+{
+
+   // Forward the request up the chain.
+   BodyAction::initialize (dyn_manager);
+
+   // Sanity check: The subject MassBody must be a DynBody.
+   if (dyn_subject == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::invalid_object,
+         "%s failed:\n"
+         "Subject body '%s' is not of a class based on DynBody.\n"
+         "A subject body of a class derived from DynBody is required.",
+         action_identifier.c_str(), mass_subject->name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   // Sanity check: Protect against an empty frame name.
+   if (frame_name.empty()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::invalid_name,
+         "%s failed:\n"
+         "The frame name was not specified.",
+         action_identifier.c_str());
+
+      // Not reached
+      return;
+   }
+
+   // Find the frame corresponding to the specified name.
+   frame = dyn_manager.find_ref_frame (frame_name.c_str());
+   if (frame == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::invalid_name,
+         "%s failed:\n"
+         "The frame name '%s' does not specify a valid reference frame.",
+         action_identifier.c_str(), frame_name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   // Subscribe to the frame so that its state is kept current while the
+   // body is frozen to it.
+   dyn_manager.subscribe_to_frame (*frame);
+
+   return;
+}
+
+
+/**
+ * Freeze the body.
+ * \param[in,out] dyn_manager Jeod manager
+ */
+void
+DynBodyFreeze::apply (
+   DynManager & dyn_manager)
+{
+   // Freezing succeeded: Debug.
+   if (dyn_subject->freeze (*frame)) {
+      MessageHandler::debug (
+         __FILE__, __LINE__, BodyActionMessages::trace,
+         "%s: %s frozen with respect to %s.",
+         action_identifier.c_str(),
+         dyn_subject->name.c_str(), frame_name.c_str());
+   }
+
+   // Freezing failed: Terminate the sim if terminate_on_error is set.
+   else if (terminate_on_error) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::fatal_error,
+         "%s failed to freeze %s."
+         "The terminate_on_failure flag set and a freeze error occurred.\n"
+         "The freeze error described above is fatal per this setting.",
+         action_identifier.c_str(), dyn_subject->name.c_str());
+   }
+
+   // Freezing failed, terminate_ not set: Tell the user about the problem.
+   else {
+      MessageHandler::error (
+         __FILE__, __LINE__, BodyActionMessages::not_performed,
+         "%s failed to freeze %s.",
+         action_identifier.c_str(), dyn_subject->name.c_str());
+   }
+
+   // Forward the action up the chain.
+   BodyAction::apply (dyn_manager);
+
+   return;
+}
+
+
+/**
+ * Queries whether the "active" flag has been set.
+ * @return Can the body be frozen?
+ */
+bool
+DynBodyFreeze::is_ready (
+   void)
+{
+   return active;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -18,6 +18,7 @@ Purpose:
 Library dependencies:
   ((dyn_body_init_lvlh_state.cc)
    (dynamics/derived_state/src/lvlh_relative_derived_state.cc)
+   (utils/lvlh_frame/src/lvlh_frame_registry.cc)
    (utils/ref_frames/src/ref_frame.cc))
 
 
@@ -51,7 +52,8 @@ DynBodyInitLvlhState::DynBodyInitLvlhState (
 :
    DynBodyInitPlanetDerived(),
    lvlh_type (LvlhType::Rectilinear),
-   lvlh_object_ptr (nullptr)
+   lvlh_object_ptr (nullptr),
+   lvlh_registry (nullptr)
 {
    required_items = RefFrameItems::Pos_Vel;
    return;
@@ -79,6 +81,20 @@ DynBodyInitLvlhState::set_lvlh_frame_object (
 }
 
 
+/**
+ * Cache a pointer to a user-supplied LvlhFrameRegistry object.
+ * The reference vehicle's LVLH frame is obtained from the registry
+ * unless an LvlhFrame object has been supplied.
+ * \param[in] registry LVLH frame registry
+ */
+void
+DynBodyInitLvlhState::set_lvlh_frame_registry (
+   LvlhFrameRegistry & registry)
+{
+   lvlh_registry = &registry;
+}
+
+
 /**
  * Initialize the initializer.
  * \param[in,out] dyn_manager Dynamics manager
@@ -119,6 +135,13 @@ DynBodyInitLvlhState::apply (
    if (lvlh_object_ptr != nullptr) {
       lvlh_object_ptr->update();
       reference_ref_frame = &lvlh_object_ptr->frame;
+   } else if (lvlh_registry != nullptr) {
+      // Use the shared LVLH frame. The reference vehicle's state may have
+      // just been initialized, so update the frame unconditionally.
+      LvlhFrame & shared_frame = lvlh_registry->get_frame (
+         ref_body->composite_body, *planet, dyn_manager);
+      shared_frame.update ();
+      reference_ref_frame = &shared_frame.frame;
    } else {
       // Construct the LVLH frame.
       lvlh_frame.set_subject_frame (ref_body->composite_body);
@@ -165,16 +188,10 @@ DynBodyInitLvlhState::apply (
       Vector3::copy(lvlh_state.rel_state.trans.velocity, velocity);
       Vector3::copy(lvlh_state.rel_state.rot.ang_vel_this, ang_velocity);
 
-      Matrix3x3::copy(lvlh_state.rel_state.rot.T_parent_this, orientation.trans);
-
-      orientation.quat = lvlh_state.rel_state.rot.Q_parent_this;
-
-      Orientation::compute_euler_angles_from_matrix
-          (orientation.trans, orientation.euler_sequence,
-           orientation.euler_angles);
-      Orientation::compute_eigen_rotation_from_matrix
-          (orientation.trans, &(orientation.eigen_angle),
-           orientation.eigen_axis);
+      // The remaining representations are computed only if requested.
+      orientation.set_transformation_and_quaternion (
+         lvlh_state.rel_state.rot.T_parent_this,
+         lvlh_state.rel_state.rot.Q_parent_this);
    }
 
    else if (lvlh_type == LvlhType::EllipticalCurvilinear) {
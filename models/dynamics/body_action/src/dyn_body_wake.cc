@@ -0,0 +1,169 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup BodyAction
+ * @{
+ *
+ * @file models/dynamics/body_action/src/dyn_body_wake.cc
+ * Define methods for the class DynBodyWake.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((dyn_body_wake.cc)
+   (body_action.cc)
+   (body_action_messages.cc)
+   (dynamics/dyn_body/src/dyn_body.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "utils/integration/include/integration_event.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/body_action_messages.hh"
+#include "../include/dyn_body_wake.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a DynBodyWake instance.
+ */
+DynBodyWake::DynBodyWake (
+   void)
+:
+   BodyAction(),
+   trigger(nullptr),
+   trigger_count(0)
+{
+   active = false;
+
+   return;
+}
+
+
+/**
+ * Destruct a DynBodyWake instance.
+ */
+DynBodyWake::~DynBodyWake (
+   void)
+{
+   return; // Empty
+}
+
+
+/**
+ * Initialize a DynBodyWake instance.
+ * \param[in,out] dyn_manager Dynamics manager
+ */
+void
+DynBodyWake::initialize (
+   DynManager & dyn_manager)
+{
+
+   // Forward the request up the chain.
+   BodyAction::initialize (dyn_manager);
+
+   // Sanity check: The subject MassBody must be a DynBody.
+   if (dyn_subject == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::invalid_object,
+         "%s failed:\n"
+         "Subject body '%s' is not of a class based on DynBody.\n"
+         "A subject body of a class derived from DynBody is required.",
+         action_identifier.c_str(), mass_subject->name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   // Only events that occur from here on trigger the action.
+   if (trigger != nullptr) {
+      trigger_count = trigger->event_count;
+   }
+
+   return;
+}
+
+
+/**
+ * Wake the body.
+ * \param[in,out] dyn_manager Jeod manager
+ */
+void
+DynBodyWake::apply (
+   DynManager & dyn_manager)
+{
+   // Waking succeeded: Debug.
+   if (dyn_subject->wake ()) {
+      MessageHandler::debug (
+         __FILE__, __LINE__, BodyActionMessages::trace,
+         "%s: %s woken.",
+         action_identifier.c_str(), dyn_subject->name.c_str());
+   }
+
+   // Waking failed: Terminate the sim if terminate_on_error is set.
+   else if (terminate_on_error) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, BodyActionMessages::fatal_error,
+         "%s failed to wake %s."
+         "The terminate_on_failure flag set and a wake error occurred.\n"
+         "The wake error described above is fatal per this setting.",
+         action_identifier.c_str(), dyn_subject->name.c_str());
+   }
+
+   // Waking failed, terminate_ not set: Tell the user about the problem.
+   else {
+      MessageHandler::error (
+         __FILE__, __LINE__, BodyActionMessages::not_performed,
+         "%s failed to wake %s.",
+         action_identifier.c_str(), dyn_subject->name.c_str());
+   }
+
+   // Forward the action up the chain.
+   BodyAction::apply (dyn_manager);
+
+   return;
+}
+
+
+/**
+ * Determine whether it is time to wake the body.
+ * @return Can action be applied?
+ */
+bool
+DynBodyWake::is_ready (
+   void)
+{
+   if (! BodyAction::is_ready()) {
+      return false;
+   }
+
+   return (trigger == nullptr) || (trigger->event_count != trigger_count);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
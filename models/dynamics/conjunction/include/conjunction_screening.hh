@@ -0,0 +1,321 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Conjunction
+ * @{
+ *
+ * @file models/dynamics/conjunction/include/conjunction_screening.hh
+ * Define the classes ConjunctionEvent and ConjunctionScreening, which screen
+ * the DynManager's bodies for close approaches.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Hoots, F. R., Crawford, L. L. and Roehrich, R. L.)
+    (An Analytic Method to Determine Future Close Approaches Between
+     Satellites)
+    (Celestial Mechanics, 33, 1984)))
+
+Assumptions and limitations:
+  ((Only root bodies are screened; attached bodies move with their roots.)
+   (Motion between screening samples is the cubic Hermite interpolant of
+    the sampled positions and velocities.)
+   (The sample interval must be short compared to the orbital periods.))
+
+Library dependencies:
+  ((../src/conjunction_screening.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_CONJUNCTION_SCREENING_HH
+#define JEOD_CONJUNCTION_SCREENING_HH
+
+// System includes
+#include <string>
+#include <utility>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+class DynManager;
+class RefFrame;
+
+
+/**
+ * A detected close approach between two bodies.
+ */
+class ConjunctionEvent {
+
+   JEOD_MAKE_SIM_INTERFACES(ConjunctionEvent)
+
+public:
+
+   /**
+    * The first body of the pair; a primary if primaries were designated.
+    */
+   DynBody * subject; //!< trick_units(--)
+
+   /**
+    * The second body of the pair.
+    */
+   DynBody * target; //!< trick_units(--)
+
+   /**
+    * Time of closest approach, in the time scale passed to update().
+    */
+   double time; //!< trick_units(s)
+
+   /**
+    * Separation at the time of closest approach.
+    */
+   double miss_distance; //!< trick_units(m)
+
+   /**
+    * Relative speed at the time of closest approach.
+    */
+   double relative_speed; //!< trick_units(m/s)
+
+   ConjunctionEvent ()
+   :
+      subject(nullptr),
+      target(nullptr),
+      time(0.0),
+      miss_distance(0.0),
+      relative_speed(0.0)
+   { }
+};
+
+
+/**
+ * Screens the DynManager's root bodies for close approaches at each
+ * update. Bodies are sampled in a planet's inertial frame and indexed in a
+ * uniform grid whose cells are wide enough that any pair that closes to
+ * within the screening distance during the last sample interval lies in
+ * neighboring cells. Candidate pairs then pass, cheapest first, through a
+ * perigee/apogee filter, a time filter that bounds the interpolated
+ * separation over the interval, and finally a refinement that locates the
+ * time of closest approach on the cubic Hermite interpolant of the two
+ * sampled states. Each approach is reported once, in the interval in which
+ * the pair stops closing.
+ */
+class ConjunctionScreening {
+
+   JEOD_MAKE_SIM_INTERFACES(ConjunctionScreening)
+
+public:
+
+   // Member data
+
+   /**
+    * Name of the planet whose inertial frame is used for screening.
+    */
+   std::string planet_name; //!< trick_units(--)
+
+   /**
+    * Separation below which a close approach is reported.
+    */
+   double screening_distance; //!< trick_units(m)
+
+   /**
+    * Minimum grid cell size. The cell size actually used is the larger of
+    * this and the size required by the screening distance and the body
+    * speeds over the sample interval.
+    */
+   double cell_size; //!< trick_units(m)
+
+   /**
+    * Send an informational message for each detected close approach.
+    */
+   bool report_events; //!< trick_units(--)
+
+
+   // Member functions
+
+   ConjunctionScreening ();
+
+   ~ConjunctionScreening ();
+
+   // Designate a body whose approaches are of interest.
+   void add_primary (DynBody & body);
+
+   // Find the screening frame and collect the bodies to be screened.
+   void initialize (DynManager & manager);
+
+   // Sample the bodies and screen the interval since the previous sample.
+   void update (double time);
+
+   // Discard the recorded events.
+   void clear_events ();
+
+   /**
+    * Get the number of recorded close approaches.
+    * @return Event count
+    */
+   unsigned int get_num_events () const
+   {
+      return static_cast<unsigned int> (events.size());
+   }
+
+   /**
+    * Get a recorded close approach.
+    * @return Event
+    * \param[in] index Event index, less than get_num_events()
+    */
+   const ConjunctionEvent & get_event (unsigned int index) const
+   {
+      return events[index];
+   }
+
+   /**
+    * Get the number of pairs refined by the last update.
+    * @return Pairs that passed all filters
+    */
+   unsigned int get_num_refined () const
+   {
+      return num_refined;
+   }
+
+
+protected:
+
+   /**
+    * A screened body and its two most recent samples.
+    */
+   struct BodySample {
+      DynBody * body;        //!< The screened body
+      double pos[3];         //!< Current position
+      double vel[3];         //!< Current velocity
+      double prev_pos[3];    //!< Position at the previous sample
+      double prev_vel[3];    //!< Velocity at the previous sample
+      double perigee;        //!< Osculating periapsis radius
+      double apogee;         //!< Osculating apoapsis radius
+      bool primary;          //!< Body is a designated primary
+      bool sampled;          //!< Previous sample is valid
+      bool active;           //!< Both samples are valid
+   };
+
+   // Screen a candidate pair over the last interval.
+   void screen_pair (
+      const BodySample & first, const BodySample & second,
+      double start_time, double interval);
+
+   /**
+    * Bodies designated as primaries.
+    */
+   std::vector<DynBody *> primaries; //!< trick_io(**)
+
+   /**
+    * Screened bodies, in DynManager order.
+    */
+   std::vector<BodySample> samples; //!< trick_io(**)
+
+   /**
+    * Indices in samples of the primary bodies.
+    */
+   std::vector<unsigned int> primary_samples; //!< trick_io(**)
+
+   /**
+    * Grid cell key and sample index of each indexed body, sorted by key.
+    */
+   std::vector<std::pair<unsigned long long, unsigned int> > cells; //!< trick_io(**)
+
+   /**
+    * Recorded close approaches.
+    */
+   std::vector<ConjunctionEvent> events; //!< trick_io(**)
+
+   /**
+    * The screening frame.
+    */
+   const RefFrame * ref_frame; //!< trick_units(--)
+
+   /**
+    * Gravitational parameter of the screening planet.
+    */
+   double mu; //!< trick_units(m3/s2)
+
+   /**
+    * Time of the previous sample.
+    */
+   double prev_time; //!< trick_units(s)
+
+   /**
+    * Number of pairs refined by the last update.
+    */
+   unsigned int num_refined; //!< trick_units(count)
+
+   /**
+    * Set once a sample has been taken.
+    */
+   bool have_prev; //!< trick_units(--)
+
+
+private:
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   ConjunctionScreening (const ConjunctionScreening &);
+   ConjunctionScreening & operator= (const ConjunctionScreening &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
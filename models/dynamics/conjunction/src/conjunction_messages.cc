@@ -0,0 +1,60 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Conjunction
+ * @{
+ *
+ * @file models/dynamics/conjunction/src/conjunction_messages.cc
+ * Implement the class ConjunctionMessages.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  ((TBS))
+
+Library dependencies:
+  ((conjunction_messages.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "../include/conjunction_messages.hh"
+
+#define PATH "dynamics/conjunction/"
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Static member data
+
+char const * ConjunctionMessages::entry_not_found =
+   PATH "entry_not_found";
+
+char const * ConjunctionMessages::invalid_entry =
+   PATH "invalid_entry";
+
+char const * ConjunctionMessages::close_approach =
+   PATH "close_approach";
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,557 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Conjunction
+ * @{
+ *
+ * @file models/dynamics/conjunction/src/conjunction_screening.cc
+ * Define member functions for the class ConjunctionScreening.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  ((TBS))
+
+Library dependencies:
+  ((conjunction_screening.cc)
+   (conjunction_messages.cc)
+   (dynamics/dyn_body/src/dyn_body.cc)
+   (dynamics/dyn_manager/src/dyn_manager.cc)
+   (utils/ref_frames/src/ref_frame.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "environment/planet/include/planet.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/conjunction_messages.hh"
+#include "../include/conjunction_screening.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+// Grid cell coordinates are packed into 21-bit fields of the cell key.
+const long long cell_bias = 1LL << 20;
+
+
+/**
+ * Compute a grid cell coordinate, clamped so that the coordinate and its
+ * neighbors fit in a key field.
+ * @return Cell coordinate
+ * \param[in] x Position component
+ * \param[in] inv_cell Reciprocal of the cell size
+ */
+long long
+cell_coord (
+   double x,
+   double inv_cell)
+{
+   double scaled = std::floor (x * inv_cell);
+   double limit = static_cast<double> (cell_bias - 2);
+
+   if (scaled > limit) {
+      scaled = limit;
+   }
+   else if (scaled < -limit) {
+      scaled = -limit;
+   }
+   return static_cast<long long> (scaled);
+}
+
+
+/**
+ * Pack three cell coordinates into a cell key.
+ * @return Cell key
+ * \param[in] ix,iy,iz Cell coordinates
+ */
+unsigned long long
+cell_key (
+   long long ix,
+   long long iy,
+   long long iz)
+{
+   return (static_cast<unsigned long long> (ix + cell_bias) << 42) |
+          (static_cast<unsigned long long> (iy + cell_bias) << 21) |
+          static_cast<unsigned long long> (iz + cell_bias);
+}
+
+
+/**
+ * Evaluate the cubic Hermite interpolant of a relative trajectory and its
+ * first two derivatives with respect to the normalized time.
+ * \param[in] r0,r1 Relative positions at the interval ends
+ * \param[in] w0,w1 Relative velocities at the interval ends, times the
+ *                  interval length
+ * \param[in] s Normalized time, 0 to 1
+ * \param[out] p Interpolated relative position
+ * \param[out] dp First derivative of p
+ * \param[out] ddp Second derivative of p
+ */
+void
+hermite_eval (
+   const double r0[3],
+   const double r1[3],
+   const double w0[3],
+   const double w1[3],
+   double s,
+   double p[3],
+   double dp[3],
+   double ddp[3])
+{
+   double s2 = s * s;
+   double s3 = s2 * s;
+
+   double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+   double h10 = s3 - 2.0 * s2 + s;
+   double h01 = -2.0 * s3 + 3.0 * s2;
+   double h11 = s3 - s2;
+
+   double d00 = 6.0 * s2 - 6.0 * s;
+   double d10 = 3.0 * s2 - 4.0 * s + 1.0;
+   double d11 = 3.0 * s2 - 2.0 * s;
+
+   double dd00 = 12.0 * s - 6.0;
+   double dd10 = 6.0 * s - 4.0;
+   double dd11 = 6.0 * s - 2.0;
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      p[ii]   = h00 * r0[ii] + h10 * w0[ii] + h01 * r1[ii] + h11 * w1[ii];
+      dp[ii]  = d00 * (r0[ii] - r1[ii]) + d10 * w0[ii] + d11 * w1[ii];
+      ddp[ii] = dd00 * (r0[ii] - r1[ii]) + dd10 * w0[ii] + dd11 * w1[ii];
+   }
+}
+
+} // End anonymous namespace
+
+
+// Constructor
+ConjunctionScreening::ConjunctionScreening ()
+:
+   planet_name(),
+   screening_distance(1000.0),
+   cell_size(0.0),
+   report_events(false),
+   primaries(),
+   samples(),
+   primary_samples(),
+   cells(),
+   events(),
+   ref_frame(nullptr),
+   mu(0.0),
+   prev_time(0.0),
+   num_refined(0),
+   have_prev(false)
+{
+   return;
+}
+
+
+// Destructor
+ConjunctionScreening::~ConjunctionScreening ()
+{
+   return;
+}
+
+
+/**
+ * Designate a body whose approaches are of interest. Once any primary is
+ * designated, only pairs that include a primary are screened.
+ * \param[in] body Primary body
+ */
+void
+ConjunctionScreening::add_primary (
+   DynBody & body)
+{
+   if (std::find (primaries.begin(), primaries.end(), &body) ==
+       primaries.end()) {
+      primaries.push_back (&body);
+   }
+}
+
+
+/**
+ * Find the screening frame and collect the bodies to be screened.
+ * \param[in] manager Dynamics manager whose bodies are screened
+ */
+void
+ConjunctionScreening::initialize (
+   DynManager & manager)
+{
+   Planet * planet = manager.find_planet (planet_name.c_str());
+
+   if ((planet == nullptr) || (planet->grav_source == nullptr)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, ConjunctionMessages::entry_not_found,
+         "Could not find a planet with gravity named '%s'.",
+         planet_name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   if (screening_distance <= 0.0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, ConjunctionMessages::invalid_entry,
+         "The screening distance must be positive.");
+
+      // Not reached
+      return;
+   }
+
+   ref_frame = &planet->inertial;
+   mu = planet->grav_source->mu;
+
+   std::vector<DynBody *> bodies = manager.get_dyn_bodies();
+
+   samples.clear();
+   samples.reserve (bodies.size());
+   primary_samples.clear();
+   for (DynBody * body : bodies) {
+      BodySample sample;
+      sample.body = body;
+      sample.perigee = 0.0;
+      sample.apogee = 0.0;
+      sample.primary =
+         std::find (primaries.begin(), primaries.end(), body) !=
+         primaries.end();
+      sample.sampled = false;
+      sample.active = false;
+      if (sample.primary) {
+         primary_samples.push_back (
+            static_cast<unsigned int> (samples.size()));
+      }
+      samples.push_back (sample);
+   }
+
+   for (DynBody * primary : primaries) {
+      if (std::find (bodies.begin(), bodies.end(), primary) == bodies.end()) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, ConjunctionMessages::entry_not_found,
+            "Primary body '%s' is not registered with the dynamics manager.",
+            primary->name.c_str());
+
+         // Not reached
+         return;
+      }
+   }
+
+   cells.reserve (samples.size());
+   events.clear();
+   have_prev = false;
+   num_refined = 0;
+}
+
+
+/**
+ * Sample the bodies and screen the interval since the previous sample.
+ * \param[in] time Current time; events are reported in this time scale
+ */
+void
+ConjunctionScreening::update (
+   double time)
+{
+   RefFrameState state;
+   double max_reach = 0.0;
+
+   // Sample the root bodies and their osculating apsides.
+   for (BodySample & sample : samples) {
+      if (! sample.body->is_root_body()) {
+         sample.sampled = false;
+         sample.active = false;
+         continue;
+      }
+
+      Vector3::copy (sample.pos, sample.prev_pos);
+      Vector3::copy (sample.vel, sample.prev_vel);
+
+      sample.body->composite_body.compute_relative_state (*ref_frame, state);
+      Vector3::copy (state.trans.position, sample.pos);
+      Vector3::copy (state.trans.velocity, sample.vel);
+
+      double r_mag = Vector3::vmag (sample.pos);
+      double h_vec[3];
+      Vector3::cross (sample.pos, sample.vel, h_vec);
+      double h_sq = Vector3::vmagsq (h_vec);
+      double energy = 0.5 * Vector3::vmagsq (sample.vel) - mu / r_mag;
+      double e_sq = 1.0 + 2.0 * energy * h_sq / (mu * mu);
+      double e_mag = (e_sq > 0.0) ? std::sqrt (e_sq) : 0.0;
+      double semiparam = h_sq / mu;
+
+      sample.perigee = semiparam / (1.0 + e_mag);
+      sample.apogee = (e_mag < 1.0) ?
+                      semiparam / (1.0 - e_mag) :
+                      std::numeric_limits<double>::max();
+
+      sample.active = sample.sampled;
+      sample.sampled = true;
+   }
+
+   double interval = time - prev_time;
+   bool screen = have_prev && (interval > 0.0);
+   double start_time = prev_time;
+
+   prev_time = time;
+   have_prev = true;
+   num_refined = 0;
+
+   if (! screen) {
+      return;
+   }
+
+   // Bound how far any body can have moved since the time of closest
+   // approach of a pair: the chord plus the Hermite deviation from it.
+   for (const BodySample & sample : samples) {
+      if (sample.active) {
+         double chord[3];
+         double dev0[3];
+         double dev1[3];
+         Vector3::diff (sample.pos, sample.prev_pos, chord);
+         for (unsigned int ii = 0; ii < 3; ++ii) {
+            dev0[ii] = interval * sample.prev_vel[ii] - chord[ii];
+            dev1[ii] = interval * sample.vel[ii] - chord[ii];
+         }
+         double reach = Vector3::vmag (chord) +
+                        (4.0 / 27.0) *
+                        (Vector3::vmag (dev0) + Vector3::vmag (dev1));
+         max_reach = std::max (max_reach, reach);
+      }
+   }
+
+   double grid_size =
+      std::max (cell_size, screening_distance + 2.0 * max_reach);
+   double inv_cell = 1.0 / grid_size;
+   bool have_primaries = ! primaries.empty();
+
+   // Index the active bodies. Once primaries are designated, a secondary
+   // whose apsides keep it away from every primary is not indexed.
+   cells.clear();
+   for (unsigned int ii = 0; ii < samples.size(); ++ii) {
+      const BodySample & sample = samples[ii];
+      if (! sample.active) {
+         continue;
+      }
+
+      if (have_primaries && (! sample.primary)) {
+         bool reachable = false;
+         for (unsigned int jj : primary_samples) {
+            const BodySample & other = samples[jj];
+            if (other.active &&
+                (sample.perigee - screening_distance <= other.apogee) &&
+                (other.perigee - screening_distance <= sample.apogee)) {
+               reachable = true;
+               break;
+            }
+         }
+         if (! reachable) {
+            continue;
+         }
+      }
+
+      cells.push_back (std::make_pair (
+         cell_key (cell_coord (sample.pos[0], inv_cell),
+                   cell_coord (sample.pos[1], inv_cell),
+                   cell_coord (sample.pos[2], inv_cell)),
+         ii));
+   }
+   std::sort (cells.begin(), cells.end());
+
+   // Screen each indexed body against the bodies in its neighborhood.
+   // Once primaries are designated, only their neighborhoods are searched.
+   for (const auto & cell : cells) {
+      unsigned int ii = cell.second;
+      const BodySample & first = samples[ii];
+      if (have_primaries && (! first.primary)) {
+         continue;
+      }
+      long long ix = cell_coord (first.pos[0], inv_cell);
+      long long iy = cell_coord (first.pos[1], inv_cell);
+      long long iz = cell_coord (first.pos[2], inv_cell);
+
+      for (long long dx = -1; dx <= 1; ++dx) {
+         for (long long dy = -1; dy <= 1; ++dy) {
+            for (long long dz = -1; dz <= 1; ++dz) {
+               unsigned long long key = cell_key (ix + dx, iy + dy, iz + dz);
+               auto it = std::lower_bound (
+                  cells.begin(), cells.end(), std::make_pair (key, 0u));
+
+               for (; (it != cells.end()) && (it->first == key); ++it) {
+                  unsigned int jj = it->second;
+                  const BodySample & second = samples[jj];
+
+                  // Visit each pair once: from its lower index when both
+                  // bodies are searched, otherwise from the primary.
+                  if ((jj == ii) ||
+                      ((jj < ii) && ((! have_primaries) || second.primary))) {
+                     continue;
+                  }
+                  screen_pair (first, second, start_time, interval);
+               }
+            }
+         }
+      }
+   }
+}
+
+
+/**
+ * Screen a candidate pair over the last sample interval and record the
+ * close approach, if any.
+ * \param[in] first Subject body sample
+ * \param[in] second Target body sample
+ * \param[in] start_time Time of the previous sample
+ * \param[in] interval Length of the sample interval
+ */
+void
+ConjunctionScreening::screen_pair (
+   const BodySample & first,
+   const BodySample & second,
+   double start_time,
+   double interval)
+{
+   double r0[3];
+   double r1[3];
+   double w0[3];
+   double w1[3];
+   double chord[3];
+
+   // Perigee/apogee filter: the radial shells must come within range.
+   if ((first.perigee - screening_distance > second.apogee) ||
+       (second.perigee - screening_distance > first.apogee)) {
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      r0[ii] = second.prev_pos[ii] - first.prev_pos[ii];
+      r1[ii] = second.pos[ii] - first.pos[ii];
+      w0[ii] = interval * (second.prev_vel[ii] - first.prev_vel[ii]);
+      w1[ii] = interval * (second.vel[ii] - first.vel[ii]);
+      chord[ii] = r1[ii] - r0[ii];
+   }
+
+   // Time filter: the pair must stop closing within this interval.
+   if ((Vector3::dot (r0, w0) >= 0.0) || (Vector3::dot (r1, w1) < 0.0)) {
+      return;
+   }
+
+   // Bound the interpolated separation by the closest point on the chord
+   // less the largest deviation of the interpolant from the chord.
+   double chord_sq = Vector3::vmagsq (chord);
+   double s = 0.0;
+   if (chord_sq > 0.0) {
+      s = -Vector3::dot (r0, chord) / chord_sq;
+      s = std::min (1.0, std::max (0.0, s));
+   }
+   double nearest[3];
+   double dev0[3];
+   double dev1[3];
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      nearest[ii] = r0[ii] + s * chord[ii];
+      dev0[ii] = w0[ii] - chord[ii];
+      dev1[ii] = w1[ii] - chord[ii];
+   }
+   double lower_bound =
+      Vector3::vmag (nearest) -
+      (4.0 / 27.0) * (Vector3::vmag (dev0) + Vector3::vmag (dev1));
+   if (lower_bound > screening_distance) {
+      return;
+   }
+
+   ++num_refined;
+
+   // Locate the zero of p.p' on the interpolant by safeguarded Newton
+   // iteration; p.p' is negative at s=0 and non-negative at s=1.
+   double p[3];
+   double dp[3];
+   double ddp[3];
+   double lo = 0.0;
+   double hi = 1.0;
+   for (unsigned int iter = 0; iter < 30; ++iter) {
+      hermite_eval (r0, r1, w0, w1, s, p, dp, ddp);
+      double func = Vector3::dot (p, dp);
+      double deriv = Vector3::vmagsq (dp) + Vector3::dot (p, ddp);
+
+      if (func < 0.0) {
+         lo = s;
+      }
+      else {
+         hi = s;
+      }
+
+      double s_new = (deriv > 0.0) ? s - func / deriv : 0.5 * (lo + hi);
+      if ((s_new <= lo) || (s_new >= hi)) {
+         s_new = 0.5 * (lo + hi);
+      }
+      bool converged = std::fabs (s_new - s) < 1.0e-12;
+      s = s_new;
+      if (converged) {
+         break;
+      }
+   }
+   hermite_eval (r0, r1, w0, w1, s, p, dp, ddp);
+
+   double miss_distance = Vector3::vmag (p);
+   if (miss_distance > screening_distance) {
+      return;
+   }
+
+   ConjunctionEvent event;
+   event.subject = first.body;
+   event.target = second.body;
+   event.time = start_time + s * interval;
+   event.miss_distance = miss_distance;
+   event.relative_speed = Vector3::vmag (dp) / interval;
+   events.push_back (event);
+
+   if (report_events) {
+      MessageHandler::inform (
+         __FILE__, __LINE__, ConjunctionMessages::close_approach,
+         "Close approach between '%s' and '%s' at t=%.3f s: "
+         "miss distance %.1f m, relative speed %.1f m/s.",
+         first.body->name.c_str(), second.body->name.c_str(),
+         event.time, event.miss_distance, event.relative_speed);
+   }
+}
+
+
+// Discard the recorded events.
+void
+ConjunctionScreening::clear_events ()
+{
+   events.clear();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
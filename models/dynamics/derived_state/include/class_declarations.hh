@@ -65,6 +65,9 @@ namespace jeod {
 
 class DerivedState;
 class DerivedStateMessages;
+class DerivedStateScheduler;
+class DerivedStateSharedState;
+class DerivedStateSkipStep;
 class EulerDerivedState;
 class LvlhDerivedState;
 class NedDerivedState;
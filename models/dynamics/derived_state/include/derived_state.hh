@@ -64,11 +64,13 @@ Library dependencies:
 #define JEOD_DERIVED_STATE_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "dynamics/dyn_body/include/class_declarations.hh"
 #include "dynamics/dyn_manager/include/class_declarations.hh"
 #include "environment/planet/include/class_declarations.hh"
+#include "utils/ref_frames/include/class_declarations.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -102,9 +104,38 @@ class DerivedState {
     */
    char * reference_name; //!< trick_units(--)
 
+   /**
+    * Number of update() calls per computation of the derived state, for
+    * derived states that support an update policy. The state is computed
+    * on the first call and then on every update_interval'th call. Between
+    * computations the outputs keep their values, or follow an interpolant
+    * if interpolate_outputs is set. Zero computes the state only when
+    * refresh() is called. The default is one, computing on every call.
+    */
+   unsigned int update_interval; //!< trick_units(count)
+
+   /**
+    * Interpolate the outputs between computations? The outputs then follow
+    * a cubic Hermite interpolant of the computed values, which is smooth
+    * but lags the subject by one update interval. Has no effect unless
+    * update_interval exceeds one. The default is false.
+    */
+   bool interpolate_outputs; //!< trick_units(--)
+
 
  protected:
 
+   /**
+    * An output that follows the interpolant between computations.
+    */
+   struct InterpolatedOutput {
+      double * value;     //!< The output
+      bool angle;         //!< Output is an angle, in radians
+      double latest;      //!< Most recently computed value, as computed
+      double samples[3];  //!< Last three computed values, oldest first,
+                          //!< angles unwrapped
+   };
+
    /**
     * An identifier for this derived state, constructed at initialization time
     * from the class name, the subject body name, and the reference name.
@@ -112,6 +143,38 @@ class DerivedState {
     */
    char * state_identifier; //!< trick_units(--)
 
+   /**
+    * The subject state relative to get_shared_frame(), computed once per
+    * pass by a DerivedStateScheduler and shared with the other derived
+    * states that need it. Null if this state is not scheduled.
+    */
+   const DerivedStateSharedState * shared_state; //!< trick_units(--)
+
+   /**
+    * The outputs registered with add_interpolated_output().
+    */
+   std::vector<InterpolatedOutput> interpolated_outputs; //!< trick_io(**)
+
+   /**
+    * Number of update() calls since the state was last computed.
+    */
+   unsigned int calls_since_update; //!< trick_units(count)
+
+   /**
+    * Number of valid computed values in each output's samples.
+    */
+   unsigned int num_samples; //!< trick_units(count)
+
+   /**
+    * Set once the state has been computed.
+    */
+   bool has_update; //!< trick_units(--)
+
+   /**
+    * Set while refresh() is forcing a computation.
+    */
+   bool refresh_requested; //!< trick_units(--)
+
 
  // Methods
 
@@ -147,9 +210,46 @@ class DerivedState {
    // must forward the update() call to the immediate parent class.
    virtual void update (void);
 
+   // get_shared_frame(): Frame relative to which update() needs the subject
+   // state, or null. Used by DerivedStateScheduler to share that state.
+   virtual const RefFrame * get_shared_frame (void) const;
+
+   // has_isolated_update(): Indicates whether update() reads nothing but the
+   // shared subject state and writes nothing but this object, making it
+   // safe to update concurrently with other such derived states.
+   virtual bool has_isolated_update (void) const;
+
+   // set_shared_state(): Attach the scheduler-computed subject state.
+   void set_shared_state (const DerivedStateSharedState * shared);
+
+   // refresh(): Compute the state now, regardless of the update policy.
+   void refresh (void);
+
 
  protected:
 
+   // compute_subject_relative_state: Compute the subject state relative to
+   // the frame, using the shared state when it is current.
+   void compute_subject_relative_state (
+      const RefFrame & frame,
+      RefFrameState & rel_state) const;
+
+   // compute_subject_position: Compute the subject position relative to
+   // the frame, using the shared state when it is current.
+   void compute_subject_position (
+      const RefFrame & frame,
+      double rel_pos[3]) const;
+
+   // add_interpolated_output: Register an output to be interpolated.
+   void add_interpolated_output (double & value, bool angle = false);
+
+   // begin_update: Apply the update policy at the start of update(),
+   // indicating whether the state is to be computed.
+   bool begin_update (void);
+
+   // end_update: Record the computed outputs at the end of update().
+   void end_update (void);
+
    // find_planet: Find specified Planet, failing if not found.
    Planet * find_planet (
       const DynManager & dyn_manager,
@@ -0,0 +1,302 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DerivedState
+ * @{
+ *
+ * @file models/dynamics/derived_state/include/derived_state_scheduler.hh
+ * Define the class DerivedStateScheduler, which updates a collection of
+ * derived states with shared subject states computed once per pass.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/derived_state_scheduler.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DERIVED_STATE_SCHEDULER_HH
+#define JEOD_DERIVED_STATE_SCHEDULER_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/class_declarations.hh"
+#include "dynamics/dyn_manager/include/class_declarations.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * The state of a subject body relative to some frame, computed once per
+ * scheduler pass on behalf of all of the derived states that need it.
+ */
+class DerivedStateSharedState {
+
+   JEOD_MAKE_SIM_INTERFACES(DerivedStateSharedState)
+
+
+ // Member data
+
+ public:
+
+   /**
+    * The body whose state is computed.
+    */
+   DynBody * subject; //!< trick_units(--)
+
+   /**
+    * The frame relative to which the state is computed.
+    */
+   const RefFrame * frame; //!< trick_units(--)
+
+   /**
+    * The subject's composite body state relative to the frame.
+    */
+   RefFrameState state; //!< trick_units(--)
+
+   /**
+    * Set while the state is current, i.e., for the duration of a scheduler
+    * pass. Derived states updated outside of a pass compute their own state.
+    */
+   bool current; //!< trick_units(--)
+
+
+ // Methods
+
+ public:
+
+   // Constructors
+   DerivedStateSharedState ();
+   DerivedStateSharedState (DynBody & subject_in, const RefFrame & frame_in);
+
+   // update(): Compute the subject state and mark it as current.
+   void update (void);
+
+   /**
+    * Indicate whether the state is current and pertains to the given frame.
+    * @return Usable in lieu of computing the relative state?
+    * \param[in] wrt_frame Frame of interest
+    */
+   bool is_current_for (const RefFrame & wrt_frame) const
+   {
+      return current && (frame == &wrt_frame);
+   }
+
+
+ // The copy constructor and assignment operator for this class are
+ // declared private and are not implemented.
+ private:
+
+   DerivedStateSharedState (const DerivedStateSharedState&);
+   DerivedStateSharedState & operator = (const DerivedStateSharedState&);
+
+};
+
+
+/**
+ * Updates a collection of derived states in dependency order.
+ * The derived states form a two-level DAG: the subject states relative to
+ * the frames named by DerivedState::get_shared_frame() (e.g., the vehicle
+ * state in a planet's inertial or planet-fixed frame) are the interior
+ * nodes and the derived states are the leaves. Each distinct interior node
+ * is computed once per update and fanned out to the leaves that need it.
+ * Leaves that report an isolated update are optionally updated in parallel.
+ *
+ * Usage: Add derived states with add_derived_state(), call initialize()
+ * after the derived states have been initialized, and schedule update()
+ * in lieu of the individual derived state updates.
+ *
+ * Derived states that nothing consumes during the run, e.g., states that
+ * are only logged, can be added as optional. Setting skip_optional
+ * suspends their updates, along with the shared states that only they
+ * need, for example while a real-time simulation sheds load.
+ */
+class DerivedStateScheduler {
+
+   JEOD_MAKE_SIM_INTERFACES(DerivedStateScheduler)
+
+
+ // Member data
+
+ public:
+
+   /**
+    * Number of threads, including the calling thread, used to update the
+    * derived states with isolated updates. Values less than two update
+    * everything on the calling thread. The default is one.
+    */
+   unsigned int num_threads; //!< trick_units(--)
+
+   /**
+    * Skip the updates of the optional derived states?
+    * The default is false.
+    */
+   bool skip_optional; //!< trick_units(--)
+
+
+ protected:
+
+   /**
+    * The scheduled derived states, in order of addition.
+    */
+   std::vector<DerivedState *> derived_states; //!< trick_io(**)
+
+   /**
+    * The scheduled derived states that were added as optional.
+    */
+   std::vector<DerivedState *> optional_states; //!< trick_io(**)
+
+   /**
+    * The distinct shared subject states (the interior DAG nodes).
+    * Those needed by required leaves come first.
+    */
+   std::vector<DerivedStateSharedState *> shared_states; //!< trick_io(**)
+
+   /**
+    * Leaves that must be updated on the calling thread.
+    * Required leaves come first.
+    */
+   std::vector<DerivedState *> serial_states; //!< trick_io(**)
+
+   /**
+    * Leaves that can be updated concurrently.
+    * Required leaves come first.
+    */
+   std::vector<DerivedState *> isolated_states; //!< trick_io(**)
+
+   /**
+    * Number of leading shared_states needed by required leaves.
+    */
+   unsigned int num_required_shared; //!< trick_io(**)
+
+   /**
+    * Number of leading serial_states that are required.
+    */
+   unsigned int num_required_serial; //!< trick_io(**)
+
+   /**
+    * Number of leading isolated_states that are required.
+    */
+   unsigned int num_required_isolated; //!< trick_io(**)
+
+   /**
+    * Thread pool, created at initialization time if num_threads exceeds one.
+    */
+   DerivativeThreadPool * thread_pool; //!< trick_io(**)
+
+
+ // Methods
+
+ public:
+
+   // Default constructor
+   DerivedStateScheduler ();
+
+   // Destructor
+   ~DerivedStateScheduler ();
+
+   // add_derived_state(): Add a derived state to the schedule.
+   void add_derived_state (
+      DerivedState & derived_state,
+      bool optional = false);
+
+   // initialize(): Build the update DAG from the initialized derived states.
+   void initialize (void);
+
+   // update(): Update the shared states and then all derived states.
+   void update (void);
+
+   /**
+    * Get the number of distinct shared subject states.
+    * @return Shared state count
+    */
+   unsigned int get_num_shared_states (void) const
+   {
+      return shared_states.size();
+   }
+
+
+ protected:
+
+   // clear_shared_states(): Detach and release the shared states.
+   void clear_shared_states (void);
+
+   // schedule_leaf(): Attach a derived state to the DAG.
+   void schedule_leaf (DerivedState & derived_state);
+
+
+ // The copy constructor and assignment operator for this class are
+ // declared private and are not implemented.
+ private:
+
+   DerivedStateScheduler (const DerivedStateScheduler&);
+   DerivedStateScheduler & operator = (const DerivedStateScheduler&);
+
+};
+
+} // End JEOD namespace
+
+#ifdef TRICK_VER
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#endif
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
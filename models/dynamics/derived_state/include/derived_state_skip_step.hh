@@ -0,0 +1,140 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DerivedState
+ * @{
+ *
+ * @file models/dynamics/derived_state/include/derived_state_skip_step.hh
+ * Define the class DerivedStateSkipStep, a fidelity step that suspends the
+ * optional derived states of derived state schedulers.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/derived_state_skip_step.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DERIVED_STATE_SKIP_STEP_HH
+#define JEOD_DERIVED_STATE_SKIP_STEP_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/fidelity_controller.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A fidelity step that sets DerivedStateScheduler::skip_optional on a set
+ * of schedulers, suspending the derived states that nothing consumes
+ * during the run.
+ */
+class DerivedStateSkipStep : public JeodFidelityStep {
+
+   JEOD_MAKE_SIM_INTERFACES(DerivedStateSkipStep)
+
+
+ // Methods
+
+ public:
+
+   // Default constructor
+   DerivedStateSkipStep ();
+
+   // Destructor
+   ~DerivedStateSkipStep () override;
+
+   // add_scheduler(): Add a scheduler to those affected by the step.
+   void add_scheduler (DerivedStateScheduler & scheduler);
+
+   // JeodFidelityStep interface.
+   void degrade () override;
+   void restore () override;
+
+
+ // Member data
+
+ protected:
+
+   /**
+    * The schedulers affected by the step.
+    */
+   std::vector<DerivedStateScheduler *> schedulers; //!< trick_io(**)
+
+   /**
+    * Each scheduler's skip_optional setting before the step was applied.
+    */
+   std::vector<bool> skipped; //!< trick_io(**)
+
+
+ // The copy constructor and assignment operator for this class are
+ // declared private and are not implemented.
+ private:
+
+   DerivedStateSkipStep (const DerivedStateSkipStep&);
+   DerivedStateSkipStep & operator = (const DerivedStateSkipStep&);
+
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
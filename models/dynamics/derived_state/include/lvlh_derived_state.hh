@@ -69,6 +69,7 @@ Library dependencies:
 #include "dynamics/dyn_body/include/class_declarations.hh"
 #include "dynamics/dyn_manager/include/class_declarations.hh"
 #include "utils/lvlh_frame/include/lvlh_frame.hh"
+#include "utils/lvlh_frame/include/lvlh_frame_registry.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -117,6 +118,17 @@ class LvlhDerivedState : public DerivedState {
     */
    RefFrame * planet_centered_inertial; //!< trick_units(--)
 
+   /**
+    * The registry that supplies a shared LVLH frame, if any.
+    */
+   LvlhFrameRegistry * lvlh_registry; //!< trick_units(--)
+
+   /**
+    * The LvlhFrame from which lvlh_frame is copied: lvlh_state, or the
+    * shared frame supplied by lvlh_registry.
+    */
+   LvlhFrame * lvlh_source; //!< trick_units(--)
+
 
  private:
 
@@ -144,6 +156,9 @@ class LvlhDerivedState : public DerivedState {
    // must forward the update() call to the immediate parent class.
    void update (void) override;
 
+   // set_lvlh_frame_registry(): Share the LVLH frame through a registry.
+   void set_lvlh_frame_registry (LvlhFrameRegistry & registry);
+
 
  private:
 
@@ -155,6 +155,12 @@ class NedDerivedState : public DerivedState {
    // must forward the update() call to the immediate parent class.
    void update (void) override;
 
+   // get_shared_frame(): The planet-fixed frame.
+   const RefFrame * get_shared_frame (void) const override;
+
+   // has_isolated_update(): True; update() only uses the shared state.
+   bool has_isolated_update (void) const override;
+
 
  protected:
 
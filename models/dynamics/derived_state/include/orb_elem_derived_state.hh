@@ -68,6 +68,7 @@ Library dependencies:
 // JEOD includes
 #include "dynamics/dyn_manager/include/class_declarations.hh"
 #include "dynamics/dyn_body/include/class_declarations.hh"
+#include "environment/ephemerides/ephem_interface/include/class_declarations.hh"
 #include "environment/planet/include/class_declarations.hh"
 #include "utils/orbital_elements/include/orbital_elements.hh"
 #include "utils/ref_frames/include/ref_frame_state.hh"
@@ -149,6 +150,12 @@ class OrbElemDerivedState : public DerivedState {
    // must forward the update() call to the immediate parent class.
    void update (void) override;
 
+   // get_shared_frame(): The planet inertial frame.
+   const RefFrame * get_shared_frame (void) const override;
+
+   // has_isolated_update(): True; update() only uses the shared state.
+   bool has_isolated_update (void) const override;
+
 
  protected:
 
@@ -197,6 +197,18 @@ class RelativeDerivedState : public DerivedState {
     */
    void set_subject_frame (BodyRefFrame &sf) {subject_frame = &sf; }
 
+   /**
+    * Get the subject frame, null prior to initialization.
+    * @return Subject frame
+    */
+   const BodyRefFrame * get_subject_frame () const {return subject_frame; }
+
+   /**
+    * Get the target frame, null prior to initialization.
+    * @return Target frame
+    */
+   const RefFrame * get_target_frame () const {return target_frame; }
+
    // initialize(): Initialize the RelativeDerivedState instance
    void initialize (DynBody & subject_body, DynManager & dyn_manager) override;
 
@@ -157,6 +157,9 @@ JEOD_MAKE_SIM_INTERFACES(SolarBetaDerivedState)
    // must forward the update() call to the immediate parent class.
    void update (void) override;
 
+   // get_shared_frame(): The planet inertial frame.
+   const RefFrame * get_shared_frame (void) const override;
+
  protected:
 
    /**
@@ -32,6 +32,7 @@ Library dependencies:
 
 
 // System includes
+#include <cmath>
 #include <cstddef>
 #include <typeinfo>
 
@@ -40,11 +41,14 @@ Library dependencies:
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/math/include/vector3.hh"
 #include "utils/named_item/include/named_item.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
 
 // Model includes
 #include "../include/derived_state.hh"
 #include "../include/derived_state_messages.hh"
+#include "../include/derived_state_scheduler.hh"
 
 
 //! Namespace jeod
@@ -58,7 +62,15 @@ DerivedState::DerivedState (
 :
    subject(nullptr),
    reference_name(nullptr),
-   state_identifier(nullptr)
+   update_interval(1),
+   interpolate_outputs(false),
+   state_identifier(nullptr),
+   shared_state(nullptr),
+   interpolated_outputs(),
+   calls_since_update(0),
+   num_samples(0),
+   has_update(false),
+   refresh_requested(false)
 {
    return;
 }
@@ -160,6 +172,227 @@ DerivedState::update (
 }
 
 
+/**
+ * Get the frame relative to which update() needs the subject state.
+ * The base class needs no such state.
+ * @return Shared frame, or null
+ */
+const RefFrame *
+DerivedState::get_shared_frame (
+   void)
+const
+{
+   return nullptr;
+}
+
+
+/**
+ * Indicate whether update() is isolated from all other derived states.
+ * The base class makes no such promise on behalf of its subclasses.
+ * @return Isolated update?
+ */
+bool
+DerivedState::has_isolated_update (
+   void)
+const
+{
+   return false;
+}
+
+
+/**
+ * Attach the subject state shared by a DerivedStateScheduler.
+ * \param[in] shared Shared subject state, or null to detach
+ */
+void
+DerivedState::set_shared_state (
+   const DerivedStateSharedState * shared)
+{
+   shared_state = shared;
+}
+
+
+/**
+ * Compute the state now, regardless of the update policy. A consumer of a
+ * state computed on demand (update_interval of zero) calls this before
+ * reading the state. The interpolation history is restarted, so the
+ * outputs are the computed values.
+ */
+void
+DerivedState::refresh (
+   void)
+{
+   refresh_requested = true;
+   update ();
+   refresh_requested = false;
+}
+
+
+/**
+ * Register an output to be interpolated between computations.
+ * Derived classes that support an update policy register their outputs
+ * at initialization time.
+ * \param[in,out] value The output
+ * \param[in] angle Output is an angle, in radians, that may wrap
+ */
+void
+DerivedState::add_interpolated_output (
+   double & value,
+   bool angle)
+{
+   InterpolatedOutput output;
+   output.value = &value;
+   output.angle = angle;
+   output.latest = 0.0;
+   output.samples[0] = output.samples[1] = output.samples[2] = 0.0;
+   interpolated_outputs.push_back (output);
+   num_samples = 0;
+}
+
+
+/**
+ * Apply the update policy. Derived classes that support an update policy
+ * call this at the start of update() and return without computing if it
+ * returns false; those that compute call end_update() when done.
+ * On a call that does not compute the state, the interpolated outputs are
+ * set from the interpolant if interpolation is enabled.
+ * @return Compute the state on this call?
+ */
+bool
+DerivedState::begin_update (
+   void)
+{
+   ++calls_since_update;
+
+   if (refresh_requested) {
+      num_samples = 0;
+      return true;
+   }
+   if (update_interval == 0) {
+      return false;
+   }
+   if ((! has_update) || (calls_since_update >= update_interval)) {
+      return true;
+   }
+
+   // Interpolate within the segment between the two most recent values.
+   if (interpolate_outputs && (num_samples >= 2)) {
+      double s = static_cast<double> (calls_since_update) /
+                 static_cast<double> (update_interval);
+      double s2 = s * s;
+      double s3 = s2 * s;
+      double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+      double h10 = s3 - 2.0 * s2 + s;
+      double h01 = -2.0 * s3 + 3.0 * s2;
+      double h11 = s3 - s2;
+
+      for (std::size_t ii = 0; ii < interpolated_outputs.size(); ++ii) {
+         InterpolatedOutput & output = interpolated_outputs[ii];
+         double y0 = output.samples[1];
+         double y1 = output.samples[2];
+         double m0 = (num_samples >= 3) ?
+                     0.5 * (y1 - output.samples[0]) : (y1 - y0);
+         double m1 = y1 - y0;
+         double value = h00 * y0 + h10 * m0 + h01 * y1 + h11 * m1;
+         if (output.angle) {
+            value -= 2.0 * M_PI *
+                     std::floor ((value - output.latest + M_PI) / (2.0 * M_PI));
+         }
+         *output.value = value;
+      }
+   }
+
+   return false;
+}
+
+
+/**
+ * Record the computed outputs. With interpolation enabled, the outputs are
+ * then set back to the previous computed values, the start of the segment
+ * that the interpolant follows until the next computation.
+ */
+void
+DerivedState::end_update (
+   void)
+{
+   calls_since_update = 0;
+   has_update = true;
+
+   for (std::size_t ii = 0; ii < interpolated_outputs.size(); ++ii) {
+      InterpolatedOutput & output = interpolated_outputs[ii];
+      double value = *output.value;
+      output.latest = value;
+
+      // Unwrap angles so that successive samples differ by less than pi.
+      if (output.angle && (num_samples > 0)) {
+         value -= 2.0 * M_PI *
+                  std::floor ((value - output.samples[2] + M_PI) /
+                              (2.0 * M_PI));
+      }
+      output.samples[0] = output.samples[1];
+      output.samples[1] = output.samples[2];
+      output.samples[2] = value;
+   }
+   if (num_samples < 3) {
+      ++num_samples;
+   }
+
+   if (interpolate_outputs && (update_interval > 1) && (num_samples >= 2)) {
+      for (std::size_t ii = 0; ii < interpolated_outputs.size(); ++ii) {
+         InterpolatedOutput & output = interpolated_outputs[ii];
+         double value = output.samples[1];
+         if (output.angle) {
+            value -= 2.0 * M_PI *
+                     std::floor ((value - output.latest + M_PI) / (2.0 * M_PI));
+         }
+         *output.value = value;
+      }
+   }
+}
+
+
+/**
+ * Compute the subject's composite body state relative to the given frame.
+ * The shared state is used if it is current and pertains to the frame;
+ * otherwise the state is computed directly.
+ * \param[in] frame Frame with respect to which the state is computed
+ * \param[out] rel_state Subject state relative to the frame
+ */
+void
+DerivedState::compute_subject_relative_state (
+   const RefFrame & frame,
+   RefFrameState & rel_state)
+const
+{
+   if ((shared_state != nullptr) && shared_state->is_current_for (frame)) {
+      rel_state.copy (shared_state->state);
+   }
+   else {
+      subject->composite_body.compute_relative_state (frame, rel_state);
+   }
+}
+
+
+/**
+ * Compute the subject's composite body position relative to the given frame.
+ * \param[in] frame Frame with respect to which the position is computed
+ * \param[out] rel_pos Subject position relative to the frame\n Units: M
+ */
+void
+DerivedState::compute_subject_position (
+   const RefFrame & frame,
+   double rel_pos[3])
+const
+{
+   if ((shared_state != nullptr) && shared_state->is_current_for (frame)) {
+      Vector3::copy (shared_state->state.trans.position, rel_pos);
+   }
+   else {
+      subject->composite_body.compute_position_from (frame, rel_pos);
+   }
+}
+
+
 /**
  * Find the Planet with the given name, failing if not found.
  * @return Found Planet
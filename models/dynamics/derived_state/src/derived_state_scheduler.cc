@@ -0,0 +1,366 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DerivedState
+ * @{
+ *
+ * @file models/dynamics/derived_state/src/derived_state_scheduler.cc
+ * Define methods for the DerivedStateScheduler and DerivedStateSharedState
+ * classes.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((derived_state_scheduler.cc)
+   (derived_state.cc)
+   (derived_state_messages.cc)
+   (dynamics/dyn_manager/src/derivative_thread_pool.cc)
+   (utils/message/src/message_handler.cc)
+   (utils/ref_frames/src/ref_frame.cc)
+   (utils/ref_frames/src/ref_frame_compute_relative_state.cc)
+   (utils/ref_frames/src/ref_frame_state.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_manager/include/derivative_thread_pool.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+
+// Model includes
+#include "../include/derived_state.hh"
+#include "../include/derived_state_messages.hh"
+#include "../include/derived_state_scheduler.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Updates one of a list of derived states.
+ */
+class DerivedStateUpdateTask : public DerivativeThreadTask {
+public:
+   explicit DerivedStateUpdateTask (
+      std::vector<DerivedState *> & states_in)
+   :
+      states (states_in)
+   { }
+
+   void execute (unsigned int index) override
+   {
+      states[index]->update ();
+   }
+
+private:
+   std::vector<DerivedState *> & states;
+};
+
+} // End anonymous namespace
+
+
+/**
+ * Default constructor, needed by the memory manager to restore an
+ * allocated object on restart.
+ */
+DerivedStateSharedState::DerivedStateSharedState (
+   void)
+:
+   subject(nullptr),
+   frame(nullptr),
+   state(),
+   current(false)
+{
+   return;
+}
+
+
+/**
+ * Construct a DerivedStateSharedState.
+ * \param[in] subject_in Subject body
+ * \param[in] frame_in Frame relative to which the state is computed
+ */
+DerivedStateSharedState::DerivedStateSharedState (
+   DynBody & subject_in,
+   const RefFrame & frame_in)
+:
+   subject(&subject_in),
+   frame(&frame_in),
+   state(),
+   current(false)
+{
+   return;
+}
+
+
+/**
+ * Compute the subject's composite body state relative to the frame.
+ */
+void
+DerivedStateSharedState::update (
+   void)
+{
+   subject->composite_body.compute_relative_state (*frame, state);
+   current = true;
+}
+
+
+/**
+ * Construct a DerivedStateScheduler.
+ */
+DerivedStateScheduler::DerivedStateScheduler (
+   void)
+:
+   num_threads(1),
+   skip_optional(false),
+   derived_states(),
+   optional_states(),
+   shared_states(),
+   serial_states(),
+   isolated_states(),
+   num_required_shared(0),
+   num_required_serial(0),
+   num_required_isolated(0),
+   thread_pool(nullptr)
+{
+   return;
+}
+
+
+/**
+ * Destruct a DerivedStateScheduler.
+ */
+DerivedStateScheduler::~DerivedStateScheduler (
+   void)
+{
+   // The derived states may already be gone; release without detaching.
+   for (std::vector<DerivedStateSharedState *>::iterator it =
+           shared_states.begin();
+        it != shared_states.end();
+        ++it) {
+      JEOD_DELETE_OBJECT (*it);
+   }
+
+   DerivativeThreadPool::release (thread_pool);
+}
+
+
+/**
+ * Add a derived state to the schedule.
+ * The derived state's own update should no longer be scheduled.
+ * \param[in,out] derived_state Derived state to be added
+ * \param[in] optional Can the updates be skipped per skip_optional?
+ */
+void
+DerivedStateScheduler::add_derived_state (
+   DerivedState & derived_state,
+   bool optional)
+{
+   for (std::vector<DerivedState *>::const_iterator it =
+           derived_states.begin();
+        it != derived_states.end();
+        ++it) {
+      if (*it == &derived_state) {
+         MessageHandler::error (
+            __FILE__, __LINE__, DerivedStateMessages::invalid_object,
+            "Derived state added to the scheduler more than once.\n"
+            "Addition request ignored.");
+         return;
+      }
+   }
+
+   derived_states.push_back (&derived_state);
+   if (optional) {
+      optional_states.push_back (&derived_state);
+   }
+}
+
+
+/**
+ * Build the update DAG.
+ * Each distinct (subject, frame) pair requested by the derived states
+ * becomes one shared state; each derived state becomes a serial or an
+ * isolated leaf. This must be called after the derived states have been
+ * initialized, and again if derived states are added later.
+ */
+void
+DerivedStateScheduler::initialize (
+   void)
+{
+   clear_shared_states ();
+   serial_states.clear ();
+   isolated_states.clear ();
+
+   // Schedule the required leaves first so that the optional leaves, and
+   // the shared states that only they need, form the tails of the lists.
+   for (std::vector<DerivedState *>::const_iterator it =
+           derived_states.begin();
+        it != derived_states.end();
+        ++it) {
+      if (std::find (optional_states.begin(), optional_states.end(), *it) ==
+          optional_states.end()) {
+         schedule_leaf (**it);
+      }
+   }
+   num_required_shared = shared_states.size();
+   num_required_serial = serial_states.size();
+   num_required_isolated = isolated_states.size();
+
+   for (std::vector<DerivedState *>::const_iterator it =
+           optional_states.begin();
+        it != optional_states.end();
+        ++it) {
+      schedule_leaf (**it);
+   }
+
+   if ((num_threads > 1) && (isolated_states.size() > 1)) {
+      DerivativeThreadPool::acquire (thread_pool, num_threads);
+   }
+}
+
+
+/**
+ * Attach a derived state to the DAG as a serial or an isolated leaf,
+ * creating the shared state it depends on if that does not yet exist.
+ * \param[in,out] derived_state Derived state to be scheduled
+ */
+void
+DerivedStateScheduler::schedule_leaf (
+   DerivedState & derived_state)
+{
+   if (derived_state.subject == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DerivedStateMessages::invalid_object,
+         "A derived state added to the scheduler has not been "
+         "initialized.");
+
+      // Not reached
+      return;
+   }
+
+   // Find or create the shared state the derived state depends on.
+   const RefFrame * frame = derived_state.get_shared_frame ();
+   DerivedStateSharedState * shared = nullptr;
+   if (frame != nullptr) {
+      for (std::vector<DerivedStateSharedState *>::const_iterator sit =
+              shared_states.begin();
+           (shared == nullptr) && (sit != shared_states.end());
+           ++sit) {
+         if (((*sit)->subject == derived_state.subject) &&
+             ((*sit)->frame == frame)) {
+            shared = *sit;
+         }
+      }
+      if (shared == nullptr) {
+         shared = JEOD_ALLOC_CLASS_OBJECT (
+                     DerivedStateSharedState,
+                     (*derived_state.subject, *frame));
+         shared_states.push_back (shared);
+      }
+   }
+   derived_state.set_shared_state (shared);
+
+   // Isolated leaves depend only on their shared state.
+   if ((shared != nullptr) && derived_state.has_isolated_update()) {
+      isolated_states.push_back (&derived_state);
+   }
+   else {
+      serial_states.push_back (&derived_state);
+   }
+}
+
+
+/**
+ * Update the shared states and then the derived states.
+ * The shared states are computed serially since relative state computations
+ * share the reference frame caches. The leaves follow: serial leaves on the
+ * calling thread, isolated leaves on the thread pool if one exists.
+ */
+void
+DerivedStateScheduler::update (
+   void)
+{
+   // Optional leaves and the shared states that only they need are at
+   // the tails of the lists.
+   std::size_t num_shared = skip_optional ?
+                            num_required_shared : shared_states.size();
+   std::size_t num_serial = skip_optional ?
+                            num_required_serial : serial_states.size();
+   std::size_t num_isolated = skip_optional ?
+                              num_required_isolated : isolated_states.size();
+
+   for (std::size_t ii = 0; ii < num_shared; ++ii) {
+      shared_states[ii]->update ();
+   }
+
+   for (std::size_t ii = 0; ii < num_serial; ++ii) {
+      serial_states[ii]->update ();
+   }
+
+   if ((thread_pool != nullptr) && (num_isolated > 1)) {
+      DerivedStateUpdateTask task (isolated_states);
+      thread_pool->run (num_isolated, task);
+   }
+   else {
+      for (std::size_t ii = 0; ii < num_isolated; ++ii) {
+         isolated_states[ii]->update ();
+      }
+   }
+
+   // The shared states are only valid for the duration of this pass.
+   for (std::vector<DerivedStateSharedState *>::const_iterator it =
+           shared_states.begin();
+        it != shared_states.end();
+        ++it) {
+      (*it)->current = false;
+   }
+}
+
+
+/**
+ * Detach the derived states from the shared states and release the latter.
+ */
+void
+DerivedStateScheduler::clear_shared_states (
+   void)
+{
+   for (std::vector<DerivedState *>::const_iterator it =
+           derived_states.begin();
+        it != derived_states.end();
+        ++it) {
+      (*it)->set_shared_state (nullptr);
+   }
+
+   for (std::vector<DerivedStateSharedState *>::iterator it =
+           shared_states.begin();
+        it != shared_states.end();
+        ++it) {
+      JEOD_DELETE_OBJECT (*it);
+   }
+   shared_states.clear ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,107 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DerivedState
+ * @{
+ *
+ * @file models/dynamics/derived_state/src/derived_state_skip_step.cc
+ * Define methods for the DerivedStateSkipStep class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((derived_state_skip_step.cc)
+   (derived_state_scheduler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// Model includes
+#include "../include/derived_state_scheduler.hh"
+#include "../include/derived_state_skip_step.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a DerivedStateSkipStep.
+ */
+DerivedStateSkipStep::DerivedStateSkipStep (
+   void)
+:
+   JeodFidelityStep(),
+   schedulers(),
+   skipped()
+{
+   return;
+}
+
+
+/**
+ * Destruct a DerivedStateSkipStep.
+ */
+DerivedStateSkipStep::~DerivedStateSkipStep (
+   void)
+{
+   return;
+}
+
+
+/**
+ * Add a scheduler to those affected by the step.
+ * \param[in,out] scheduler The scheduler
+ */
+void
+DerivedStateSkipStep::add_scheduler (
+   DerivedStateScheduler & scheduler)
+{
+   schedulers.push_back (&scheduler);
+   skipped.push_back (false);
+}
+
+
+/**
+ * Record the schedulers' settings and skip their optional derived states.
+ */
+void
+DerivedStateSkipStep::degrade (
+   void)
+{
+   for (std::size_t ii = 0; ii < schedulers.size(); ++ii) {
+      skipped[ii] = schedulers[ii]->skip_optional;
+      schedulers[ii]->skip_optional = true;
+   }
+}
+
+
+/**
+ * Reinstate the settings recorded by degrade().
+ */
+void
+DerivedStateSkipStep::restore (
+   void)
+{
+   for (std::size_t ii = 0; ii < schedulers.size(); ++ii) {
+      schedulers[ii]->skip_optional = skipped[ii];
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
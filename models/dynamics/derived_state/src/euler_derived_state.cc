@@ -33,6 +33,7 @@ Library dependencies:
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
 #include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
 #include "utils/orientation/include/orientation.hh"
 
 // Model includes
@@ -130,7 +131,8 @@ void
 EulerDerivedState::update (
    void)
 {
-   double T_this_parent[3][3];
+   double trans[2][3][3];
+   double angles[2][3];
 
    // Invoke the parent class update method.
    DerivedState::update(); // This really doesn't do anything!
@@ -151,14 +153,15 @@ EulerDerivedState::update (
 
    }
 
-   // Compute the Euler angles from the parent frame to the body.
-   Orientation::compute_euler_angles_from_matrix (
-      rel_state.rot.T_parent_this, sequence, ref_body_angles);
+   // Compute the Euler angles from the parent frame to the body and from
+   // the body to the parent frame as one batch.
+   Matrix3x3::copy (rel_state.rot.T_parent_this, trans[0]);
+   Matrix3x3::transpose (rel_state.rot.T_parent_this, trans[1]);
+   Orientation::compute_euler_angles_from_matrices (
+      2, trans, sequence, angles);
 
-   // Compute the Euler angles from the body to the parent frame.
-   Matrix3x3::transpose (rel_state.rot.T_parent_this, T_this_parent);
-   Orientation::compute_euler_angles_from_matrix (
-      T_this_parent, sequence, body_ref_angles);
+   Vector3::copy (angles[0], ref_body_angles);
+   Vector3::copy (angles[1], body_ref_angles);
 }
 
 } // End JEOD namespace
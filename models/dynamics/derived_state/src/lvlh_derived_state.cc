@@ -21,6 +21,7 @@ Library dependencies:
    (dynamics/mass/src/mass_point_state.cc)
    (utils/quaternion/src/quat_from_mat.cc)
    (utils/lvlh_frame/src/lvlh_frame.cc)
+   (utils/lvlh_frame/src/lvlh_frame_registry.cc)
    (utils/ref_frames/src/ref_frame_compute_relative_state.cc)
    (utils/ref_frames/src/ref_frame_set_name.cc))
 
@@ -56,6 +57,8 @@ LvlhDerivedState::LvlhDerivedState (
    lvlh_frame(),
    lvlh_state(),
    planet_centered_inertial(nullptr),
+   lvlh_registry(nullptr),
+   lvlh_source(nullptr),
    local_dm(nullptr)
 {
    ;
@@ -96,12 +99,22 @@ LvlhDerivedState::initialize (
 
    // First perform general derived state initializations.
    DerivedState::initialize (subject_body, dyn_manager);
-   lvlh_state.set_subject_frame(subject->composite_body);
-   lvlh_state.set_planet_name (reference_name);
-   lvlh_state.initialize(dyn_manager);
+
+   // Use the shared LVLH frame if a registry was supplied,
+   // and the LvlhFrame data member otherwise.
+   if (lvlh_registry != nullptr) {
+      lvlh_source = &lvlh_registry->get_frame (
+         subject->composite_body, reference_name, dyn_manager);
+   }
+   else {
+      lvlh_state.set_subject_frame(subject->composite_body);
+      lvlh_state.set_planet_name (reference_name);
+      lvlh_state.initialize(dyn_manager);
+      lvlh_source = &lvlh_state;
+   }
 
    lvlh_frame.set_name (subject_body.name.c_str(), reference_name, "lvlh");
-   (planet_centered_inertial=const_cast<RefFrame *>(lvlh_state.frame.get_parent()))->
+   (planet_centered_inertial=const_cast<RefFrame *>(lvlh_source->frame.get_parent()))->
                     add_child(lvlh_frame);
 
    // If requested, register the frame with the dynamics manager.
@@ -119,9 +132,29 @@ void
 LvlhDerivedState::update (
    void)
 {
-   lvlh_state.update();
-   lvlh_frame.state = lvlh_state.frame.state;
-   lvlh_frame.set_timestamp(lvlh_state.frame.timestamp());
+   // A shared frame is computed once per time stamp on behalf of all of
+   // its users.
+   if (lvlh_source == &lvlh_state) {
+      lvlh_state.update();
+   }
+   else {
+      lvlh_source->update_if_stale();
+   }
+   lvlh_frame.state = lvlh_source->frame.state;
+   lvlh_frame.set_timestamp(lvlh_source->frame.timestamp());
+}
+
+
+/**
+ * Obtain the LVLH frame from the supplied registry rather than computing
+ * it with the lvlh_state data member. Call before initialize().
+ * \param[in] registry LVLH frame registry
+ */
+void
+LvlhDerivedState::set_lvlh_frame_registry (
+   LvlhFrameRegistry & registry)
+{
+   lvlh_registry = &registry;
 }
 
 } // End JEOD namespace
@@ -152,8 +152,7 @@ NedDerivedState::update (
    void)
 {
    // Update the NED frame based on the vehicle's state relative to the planet.
-   subject->composite_body.compute_relative_state (
-      *pfix_ptr, pfix_rel_state);
+   compute_subject_relative_state (*pfix_ptr, pfix_rel_state);
    compute_ned_frame (pfix_rel_state.trans);
 
    // Timestamp the frame per the vehicle timestamp.
@@ -161,6 +160,32 @@ NedDerivedState::update (
 }
 
 
+/**
+ * Get the frame relative to which update() needs the subject state.
+ * @return The planet-fixed frame
+ */
+const RefFrame *
+NedDerivedState::get_shared_frame (
+   void)
+const
+{
+   return pfix_ptr;
+}
+
+
+/**
+ * Indicate whether update() is isolated from all other derived states.
+ * @return True; update() reads only the shared subject state
+ */
+bool
+NedDerivedState::has_isolated_update (
+   void)
+const
+{
+   return true;
+}
+
+
 /**
  * Update the state.
  * \param[in] rel_trans Planet relative state
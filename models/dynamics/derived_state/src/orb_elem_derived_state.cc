@@ -115,6 +115,24 @@ OrbElemDerivedState::initialize (
    // Set the planet name about which the object orbits.
    elements.set_planet_name (planet->name.c_str());
 
+   // Register the elements for interpolation between computations.
+   add_interpolated_output (elements.semi_major_axis);
+   add_interpolated_output (elements.semiparam);
+   add_interpolated_output (elements.e_mag);
+   add_interpolated_output (elements.inclination);
+   add_interpolated_output (elements.arg_periapsis, true);
+   add_interpolated_output (elements.long_asc_node, true);
+   add_interpolated_output (elements.r_mag);
+   add_interpolated_output (elements.vel_mag);
+   add_interpolated_output (elements.true_anom, true);
+   add_interpolated_output (elements.mean_anom, true);
+   add_interpolated_output (elements.mean_motion);
+   add_interpolated_output (elements.orbital_anom, true);
+   add_interpolated_output (elements.sin_v);
+   add_interpolated_output (elements.cos_v);
+   add_interpolated_output (elements.orb_energy);
+   add_interpolated_output (elements.orb_ang_momentum);
+
    return;
 }
 
@@ -129,21 +147,53 @@ OrbElemDerivedState::update (
    // Invoke the parent class update method.
    DerivedState::update(); // This really doesn't do anything!
 
+   // Skip the computation if the update policy says so.
+   if (! begin_update()) {
+      return;
+   }
+
    // Check to see if the integration state is planet centered inertial.
    if (subject->composite_body.get_parent() == inertial_ptr) {
       compute_orbital_elements (subject->composite_body.state.trans);
    }
    else {
       // If not planet centered inertial, compute it.
-      subject->composite_body.compute_relative_state (*inertial_ptr,
-                                                      rel_state);
+      compute_subject_relative_state (*inertial_ptr, rel_state);
       compute_orbital_elements (rel_state.trans);
    }
 
+   end_update ();
+
    return;
 }
 
 
+/**
+ * Get the frame relative to which update() needs the subject state.
+ * @return The planet inertial frame
+ */
+const RefFrame *
+OrbElemDerivedState::get_shared_frame (
+   void)
+const
+{
+   return inertial_ptr;
+}
+
+
+/**
+ * Indicate whether update() is isolated from all other derived states.
+ * @return True; update() reads only the shared subject state
+ */
+bool
+OrbElemDerivedState::has_isolated_update (
+   void)
+const
+{
+   return true;
+}
+
+
 /**
  * Compute the orbital elements for the current state.
  * \param[in] rel_trans Planet relative state.
@@ -110,6 +110,17 @@ PlanetaryDerivedState::initialize (
    // Initialize the planet-fixed position.
    state.initialize (planet);
 
+   // Register the position for interpolation between computations.
+   add_interpolated_output (state.ellip_coords.altitude);
+   add_interpolated_output (state.ellip_coords.latitude);
+   add_interpolated_output (state.ellip_coords.longitude, true);
+   add_interpolated_output (state.sphere_coords.altitude);
+   add_interpolated_output (state.sphere_coords.latitude);
+   add_interpolated_output (state.sphere_coords.longitude, true);
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_interpolated_output (state.cart_coords[ii]);
+   }
+
    return;
 }
 
@@ -123,10 +134,43 @@ PlanetaryDerivedState::update (
 {
    double pfix_pos[3];
 
+   // Skip the computation if the update policy says so.
+   if (! begin_update()) {
+      return;
+   }
+
    // Compute the cartesian coordinates relative to the planet fixed frame and
    // update the planet fixed position from these cartesian coordinates.
-   subject->composite_body.compute_position_from (*pfix_ptr, pfix_pos);
+   compute_subject_position (*pfix_ptr, pfix_pos);
    state.update_from_cart (pfix_pos);
+
+   end_update ();
+}
+
+
+/**
+ * Get the frame relative to which update() needs the subject state.
+ * @return The planet-fixed frame
+ */
+const RefFrame *
+PlanetaryDerivedState::get_shared_frame (
+   void)
+const
+{
+   return pfix_ptr;
+}
+
+
+/**
+ * Indicate whether update() is isolated from all other derived states.
+ * @return True; update() reads only the shared subject state
+ */
+bool
+PlanetaryDerivedState::has_isolated_update (
+   void)
+const
+{
+   return true;
 }
 
 } // End JEOD namespace
@@ -99,6 +99,9 @@ SolarBetaDerivedState::initialize (
    // Subscribe to the planet-centered and sun-centered inertial frames.
    planet->inertial.subscribe();
    sun->inertial.subscribe();
+
+   // Register the beta angle for interpolation between computations.
+   add_interpolated_output (solar_beta);
 }
 
 
@@ -115,12 +118,16 @@ SolarBetaDerivedState::update (
       return;
    }
 
+   // Skip the computation if the update policy says so.
+   if (! begin_update()) {
+      return;
+   }
+
    // Find the position of the sun with respect ot the planet.
    sun->inertial.compute_position_from(planet->inertial, sun_wrt_planet);
 
    // Compute the relative state of the vehicle with respect to the planet.
-   subject->composite_body.compute_relative_state(planet->inertial,
-                                                  veh_wrt_planet);
+   compute_subject_relative_state (planet->inertial, veh_wrt_planet);
 
    // Store the relative translational state.
    RefFrameTrans* trans_state = &veh_wrt_planet.trans;
@@ -161,6 +168,21 @@ SolarBetaDerivedState::update (
 
    solar_beta = dot_product / (sqrt(h_mag_sq * s_mag_sq));
    solar_beta = asin(solar_beta);
+
+   end_update ();
+}
+
+
+/**
+ * Get the frame relative to which update() needs the subject state.
+ * @return The planet inertial frame, or null if permanently disabled
+ */
+const RefFrame *
+SolarBetaDerivedState::get_shared_frame (
+   void)
+const
+{
+   return (sun != nullptr) ? &(planet->inertial) : nullptr;
 }
 
 
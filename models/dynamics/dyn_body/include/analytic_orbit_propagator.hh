@@ -0,0 +1,208 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file
+ * Define the class AnalyticOrbitPropagator, which advances a DynBody's
+ * translational state analytically rather than by numerical integration.
+ */
+
+/*
+Purpose: ()
+Assumptions and limitations:
+  ((Keplerian motion plus the first-order secular effects of J2 only.)
+   (The J2 pole is the +z axis of the body's integration frame.))
+Library dependencies: ((../src/analytic_orbit_propagator.cc))
+*/
+
+
+#ifndef JEOD_ANALYTIC_ORBIT_PROPAGATOR_HH
+#define JEOD_ANALYTIC_ORBIT_PROPAGATOR_HH
+
+
+#include "utils/orbital_elements/include/orbital_elements.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+
+/**
+ * Advances a root DynBody's translational state from a set of osculating
+ * orbital elements captured at initialization. The mean anomaly, the
+ * longitude of the ascending node and the argument of periapsis advance at
+ * constant (Keplerian plus J2 secular) rates; each update converts the
+ * advanced elements back to a cartesian state and sets the body's composite
+ * body state with respect to its integration frame. The body's frames remain
+ * ordinary reference frames, so derived states, relative states and
+ * interactions see an analytically propagated body exactly as they see a
+ * numerically integrated one.
+ *
+ * Initialization turns off the body's translational dynamics, which means the
+ * integrator and the gravity and force collection used for integration do no
+ * translational work for the body. This is intended for catalog or far-field
+ * objects whose coarse positions are all that is needed.
+ */
+class AnalyticOrbitPropagator
+{
+   JEOD_MAKE_SIM_INTERFACES(AnalyticOrbitPropagator)
+
+public:
+
+   // Member data
+
+   /**
+    * Gravitational parameter of the central body.
+    */
+   double mu; //!< trick_units(m3/s2)
+
+   /**
+    * Unnormalized second zonal harmonic of the central body.
+    * Zero (the default) yields pure Keplerian motion.
+    */
+   double j2; //!< trick_units(--)
+
+   /**
+    * Reference (equatorial) radius that accompanies j2.
+    */
+   double r_eq; //!< trick_units(m)
+
+   /**
+    * The most recently propagated osculating elements.
+    */
+   OrbitalElements elements; //!< trick_units(--)
+
+
+   // Member functions
+
+   AnalyticOrbitPropagator ();
+
+   ~AnalyticOrbitPropagator ();
+
+   void initialize (DynBody & body, double time);
+
+   void update (double time);
+
+   /**
+    * Get the body driven by this propagator.
+    * @return Propagated body, null prior to initialization
+    */
+   DynBody * get_body ()
+   {
+      return body;
+   }
+
+   /**
+    * Get the time at which the elements were captured.
+    * @return Element epoch, in the caller's time scale
+    */
+   double get_epoch () const
+   {
+      return epoch;
+   }
+
+
+protected:
+
+   /**
+    * The body whose translational state is propagated.
+    */
+   DynBody * body; //!< trick_units(--)
+
+   /**
+    * Time at which the epoch elements were captured.
+    */
+   double epoch; //!< trick_units(s)
+
+   /**
+    * Mean anomaly at epoch.
+    */
+   double mean_anom_epoch; //!< trick_units(rad)
+
+   /**
+    * Longitude of the ascending node at epoch.
+    */
+   double long_asc_node_epoch; //!< trick_units(rad)
+
+   /**
+    * Argument of periapsis at epoch.
+    */
+   double arg_periapsis_epoch; //!< trick_units(rad)
+
+   /**
+    * Rate of change of the mean anomaly, including the J2 drift.
+    */
+   double mean_anom_rate; //!< trick_units(rad/s)
+
+   /**
+    * Rate of change of the longitude of the ascending node.
+    */
+   double long_asc_node_rate; //!< trick_units(rad/s)
+
+   /**
+    * Rate of change of the argument of periapsis.
+    */
+   double arg_periapsis_rate; //!< trick_units(rad/s)
+
+
+private:
+
+   void compute_secular_rates ();
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   AnalyticOrbitPropagator (const AnalyticOrbitPropagator &);
+   AnalyticOrbitPropagator & operator= (const AnalyticOrbitPropagator &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,217 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/body_collect_plan.hh
+ * Define the BodyCollectPlan class.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The plan is rebuilt when a body is attached to or detached from the tree
+    or when the size of a collect vector changes. Changes to the contents of
+    a collect vector that leave its size unchanged are not detected.))
+
+Library dependencies:
+  ((../src/body_collect_plan.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_BODY_COLLECT_PLAN_HH
+#define JEOD_BODY_COLLECT_PLAN_HH
+
+// System includes
+#include <vector>
+
+// Model includes
+#include "body_force_collect.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+
+/**
+ * A precompiled description of the force and torque collection for a tree of
+ * DynBody objects. The bodies are listed children before parents, and the
+ * collected forces and torques of each body are stored as contiguous spans of
+ * vector and activity flag pointers, so that collection needs neither a walk
+ * of the tree nor a walk of the collect vectors.
+ */
+class BodyCollectPlan {
+
+ public:
+
+   /**
+    * The collect vectors of a body, in span order.
+    */
+   enum Collection {
+      EffectorForce  = 0, ///< collect_effector_forc
+      EnvironForce   = 1, ///< collect_environ_forc
+      NoXmitForce    = 2, ///< collect_no_xmit_forc
+      EffectorTorque = 3, ///< collect_effector_torq
+      EnvironTorque  = 4, ///< collect_environ_torq
+      NoXmitTorque   = 5, ///< collect_no_xmit_torq
+      NumCollections = 6  ///< Number of collect vectors
+   };
+
+   /**
+    * A collected force or torque.
+    */
+   struct Entry {
+      /**
+       * The force or torque vector.
+       */
+      const double * vec; //!< trick_io(**)
+
+      /**
+       * The activity flag; always_active for items without one.
+       */
+      const bool * active; //!< trick_io(**)
+   };
+
+   /**
+    * A body in the plan.
+    */
+   struct Node {
+      /**
+       * The body.
+       */
+      DynBody * body; //!< trick_io(**)
+
+      /**
+       * Is the body collected by the plan? Bodies whose collection has been
+       * specialized by a derived class are instead collected by a call to
+       * their collect_forces_and_torques method.
+       */
+      bool flat; //!< trick_io(**)
+
+      /**
+       * Entries of collection k are begin[k] to begin[k+1]-1.
+       */
+      unsigned int begin[NumCollections+1]; //!< trick_io(**)
+
+      /**
+       * Sizes of the body's collect vectors when the plan was built.
+       */
+      unsigned int sizes[NumCollections]; //!< trick_io(**)
+   };
+
+
+ // Member data
+
+ public:
+
+   /**
+    * Activity flag used for collected items that cannot be deactivated.
+    */
+   static const bool always_active; //!< trick_io(**)
+
+   /**
+    * Is the plan valid? Cleared on attach and detach.
+    */
+   bool valid; //!< trick_io(**)
+
+   /**
+    * The bodies, children before parents; the owner of the plan is last.
+    */
+   std::vector<Node> nodes; //!< trick_io(**)
+
+   /**
+    * The collected items of all flat bodies.
+    */
+   std::vector<Entry> entries; //!< trick_io(**)
+
+
+ // Member functions
+
+ public:
+
+   // Constructor
+   BodyCollectPlan ();
+
+   // Mark the plan as needing to be rebuilt.
+   void invalidate ()
+   {
+      valid = false;
+   }
+
+   // Empty the plan in preparation for rebuilding it.
+   void clear ();
+
+   // Append a body to the plan.
+   void add_node (
+      DynBody & body,
+      bool flat,
+      const BodyForceCollect & collect);
+
+   // Do a node's collect vectors still have the sizes recorded in the plan?
+   bool sizes_match (
+      const Node & node,
+      const BodyForceCollect & collect) const;
+
+   // Sum the active items of one of a node's collections.
+   void accumulate (
+      const Node & node,
+      Collection collection,
+      double cumulation[3]) const;
+
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
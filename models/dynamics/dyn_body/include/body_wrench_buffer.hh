@@ -0,0 +1,278 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/body_wrench_buffer.hh
+ * Define the BodyWrenchBuffer class.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Pushed forces are represented in the structural frame of the body and act
+    through the center of mass of that body. Pushed torques are about the
+    center of mass.)
+   (Each slot is written by at most one thread at a time.)
+   (The sum is independent of the thread count only if slots are numbered
+    by task rather than by thread.)
+   (A buffer is emptied each time the body collects its forces and torques,
+    so producers must push on every derivative pass.))
+
+Library dependencies:
+  ((../src/body_wrench_buffer.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_BODY_WRENCH_BUFFER_HH
+#define JEOD_BODY_WRENCH_BUFFER_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "body_force_collect.hh"
+#include "wrench.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Receives forces and torques that producers push directly onto a DynBody,
+ * as an alternative to registering CollectForce and CollectTorque objects
+ * that the body later pulls.
+ *
+ * The buffer holds one set of sums per slot. A producer that runs as a
+ * parallel task pushes into the slot numbered by that task (for a
+ * DerivativeThreadTask, the item index), so no two threads write the same
+ * memory. The slots are reduced with a DeterministicSum pairwise tree when
+ * the body collects its forces and torques. The tree depends only on the
+ * slot count, so the result does not depend on how many threads ran the
+ * tasks.
+ */
+class BodyWrenchBuffer {
+
+ public:
+
+   /**
+    * The force and torque categories, matching the collect vectors.
+    */
+   enum Category {
+      Effector      = 0, ///< Transmitted to parent; like collect_effector_*
+      Environ       = 1, ///< Transmitted to parent; like collect_environ_*
+      NoXmit        = 2, ///< Not transmitted; like collect_no_xmit_*
+      NumCategories = 3  ///< Number of categories
+   };
+
+   // Constructor and destructor.
+   BodyWrenchBuffer ();
+   ~BodyWrenchBuffer ();
+
+   // Set the number of slots and empty the buffer.
+   void set_num_slots (unsigned int nslots);
+
+   /**
+    * Get the number of slots.
+    * @return Slot count.
+    */
+   unsigned int get_num_slots () const
+   {
+      return num_slots;
+   }
+
+   /**
+    * Push a force acting through the center of mass.
+    * \param[in] category Force category
+    * \param[in] force Force, structural referenced\n Units: N
+    * \param[in] slot Slot owned by the calling task
+    */
+   void add_force (
+      Category category,
+      const double force[3],
+      unsigned int slot = 0)
+   {
+      Vector3::incr (force, slot_force (slot, category));
+   }
+
+   /**
+    * Push a torque about the center of mass.
+    * \param[in] category Torque category
+    * \param[in] torque Torque, structural referenced\n Units: N*M
+    * \param[in] slot Slot owned by the calling task
+    */
+   void add_torque (
+      Category category,
+      const double torque[3],
+      unsigned int slot = 0)
+   {
+      Vector3::incr (torque, slot_torque (slot, category));
+   }
+
+   /**
+    * Push a force applied at a point, along with the torque it induces
+    * about the center of mass.
+    * \param[in] category Force category
+    * \param[in] force Force, structural referenced\n Units: N
+    * \param[in] point Point of application, structural\n Units: M
+    * \param[in] cm Center of mass, structural\n Units: M
+    * \param[in] slot Slot owned by the calling task
+    */
+   void add_force_at_point (
+      Category category,
+      const double force[3],
+      const double point[3],
+      const double cm[3],
+      unsigned int slot = 0)
+   {
+      double cm_to_point[3];
+      Vector3::diff (point, cm, cm_to_point);
+      Vector3::incr (force, slot_force (slot, category));
+      Vector3::cross_incr (cm_to_point, force, slot_torque (slot, category));
+   }
+
+   /**
+    * Push a wrench. Inactive wrenches are ignored.
+    * \param[in] category Wrench category
+    * \param[in] wrench Wrench, structural referenced
+    * \param[in] cm Center of mass, structural\n Units: M
+    * \param[in] slot Slot owned by the calling task
+    */
+   void add_wrench (
+      Category category,
+      const Wrench & wrench,
+      const double cm[3],
+      unsigned int slot = 0)
+   {
+      if (wrench.is_active()) {
+         add_force_at_point (category, wrench.get_force(), wrench.get_point(),
+                             cm, slot);
+         Vector3::incr (wrench.get_torque(), slot_torque (slot, category));
+      }
+   }
+
+   // Add the pushed forces and torques to a body's accumulators and empty
+   // the buffer.
+   void reduce (
+      bool forces,
+      bool torques,
+      BodyForceCollect & collect);
+
+   // Empty the buffer.
+   void clear ();
+
+
+ private:
+
+   /**
+    * Doubles per slot: a force and a torque per category, padded to a
+    * multiple of a 64 byte cache line so that slots do not share lines.
+    */
+   static const unsigned int slot_stride = 24;
+
+   /**
+    * Get the force sum of a slot.
+    * \param[in] slot Slot
+    * \param[in] category Category
+    * @return Force sum.
+    */
+   double * slot_force (
+      unsigned int slot,
+      Category category)
+   {
+      return &sums[slot*slot_stride + 6*category];
+   }
+
+   /**
+    * Get the torque sum of a slot.
+    * \param[in] slot Slot
+    * \param[in] category Category
+    * @return Torque sum.
+    */
+   double * slot_torque (
+      unsigned int slot,
+      Category category)
+   {
+      return &sums[slot*slot_stride + 6*category + 3];
+   }
+
+
+   /**
+    * Number of slots.
+    */
+   unsigned int num_slots; //!< trick_units(--)
+
+   /**
+    * The per-slot sums, slot_stride doubles per slot.
+    */
+   std::vector<double> sums; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   BodyWrenchBuffer (const BodyWrenchBuffer &);
+
+   /**
+    * Not implemented.
+    */
+   BodyWrenchBuffer & operator= (const BodyWrenchBuffer &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
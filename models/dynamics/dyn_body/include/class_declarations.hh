@@ -69,6 +69,7 @@ Assumptions and limitations:
 //! Namespace jeod
 namespace jeod {
 
+class AnalyticOrbitPropagator;
 class BodyForceCollect;
 class BodyRefFrame;
 class CInterfaceForce;
@@ -76,9 +77,14 @@ class CInterfaceTorque;
 class CollectForce;
 class CollectTorque;
 class DynBody;
+class DynBodyBranchDispersion;
+class DynBodyCost;
+class DynBodyDistanceEvent;
 class Force;
 class FrameDerivs;
 class Torque;
+class VariationalEquations;
+class VariationalPartials;
 
 } // End JEOD namespace
 
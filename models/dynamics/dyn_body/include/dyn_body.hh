@@ -67,7 +67,10 @@ Library dependencies:
 
 // Model includes
 #include "body_ref_frame.hh"
+#include "body_collect_plan.hh"
 #include "body_force_collect.hh"
+#include "body_wrench_buffer.hh"
+#include "dyn_body_cost.hh"
 #include "frame_derivs.hh"
 #include "dyn_body_generic_rigid_attach.hh"
 
@@ -77,8 +80,10 @@ Library dependencies:
 #include "utils/container/include/simple_checkpointable.hh"
 #include "utils/integration/include/generalized_second_order_ode_technique.hh"
 #include "utils/integration/include/restartable_state_integrator.hh"
+#include "utils/integration/include/second_order_dense_output.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 #include "utils/ref_frames/include/ref_frame_interface.hh"
+#include "utils/ref_frames/include/ref_frame_state_batch.hh"
 
 // ER7 utilities includes
 #include "er7_utils/integration/core/include/integrable_object.hh"
@@ -209,6 +214,26 @@ public:
     */
    virtual void collect_forces_and_torques ();
 
+   /**
+    * Select the derivative and integration kernels that match the body's
+    * current translational_dynamics and rotational_dynamics settings.
+    * Called at initialization; the kernels are reselected automatically
+    * should those settings change later.
+    */
+   void select_dynamics_kernels ();
+
+   /**
+    * Push a wrench onto this body's wrench buffer. The wrench is reseated to
+    * the body's center of mass. Inactive wrenches are ignored.
+    * @param[in] category  Effector, environmental, or non-transmitted.
+    * @param[in] wrench    Wrench, structural referenced.
+    * @param[in] slot      Buffer slot owned by the calling task.
+    */
+   void push_wrench (
+      BodyWrenchBuffer::Category category,
+      const Wrench & wrench,
+      unsigned int slot = 0);
+
    /**
     * Create the integrator (integrators) needed to propagate the translational
     * and rotational state of a DynBody.
@@ -234,6 +259,62 @@ public:
       double dyn_dt,
       unsigned int target_stage) override;
 
+   /**
+    * Integrate all but the translational state by the specified dynamic time
+    * interval, and propagate the integrated state. This is used by an
+    * integration group that integrates the translational states of its
+    * bodies as a batch.
+    * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
+    * @param[in]     target_stage  The stage of the integration process
+    *                              that the integrator should try to attain.
+    * @return The status (time advance, pass/fail status) of the integration.
+    */
+   er7_utils::IntegratorResult integrate_non_translational (
+      double dyn_dt,
+      unsigned int target_stage);
+
+   /**
+    * Get the arrays that trans_integ integrates.
+    * @param[out] accel     Translational acceleration.
+    * @param[out] velocity  Integrated velocity.
+    * @param[out] position  Integrated position.
+    * @return True if the translational state is currently integrated,
+    *         false if translational dynamics are off or the body is
+    *         attached to a frame.
+    */
+   virtual bool get_trans_integ_state (
+      double const * & accel,
+      double * & velocity,
+      double * & position);
+
+
+   // Dense output
+
+   // Record the translational state at the start of an integration step.
+   void begin_trans_dense_output (
+      double dyn_time,
+      bool use_natural_interpolant);
+
+   // Record the translational state at the end of an integration step.
+   void end_trans_dense_output (
+      double dyn_time);
+
+   // Discard the recorded translational dense output.
+   void reset_trans_dense_output (void);
+
+   // Interpolate the translational state within the most recent step.
+   bool interpolate_trans_state (
+      double dyn_time,
+      double * velocity,
+      double * position) const;
+
+   // Get the translational integrator's error estimate for the most recent
+   // step.
+   double get_trans_step_error (void) const;
+
+   // Get the step size asked for by the body's Sundman time transformation.
+   double get_sundman_step (void) const;
+
 
    // Frame switch
 
@@ -274,6 +355,12 @@ public:
    // Reset the integrators.
    void reset_integrators (void) override;
 
+   // Carry the integrator history across a small state discontinuity.
+   virtual bool rebase_integrators (void);
+
+   // Register the body's mutable dynamic state with a state snapshot.
+   virtual void add_snapshot_regions (StateSnapshot & snapshot);
+
    /**
     * Find the BodyRefFrame named by the provided identifier. The name of a
     * BodyRefFrame must be prefixed by the body name. The provided identifier
@@ -601,6 +688,26 @@ public:
       const double T_pframe_cstr[3][3],
       RefFrame & parent );
 
+   // Freeze this body in place with respect to a reference frame
+   virtual bool freeze (
+      const char * parent_ref_frame_name );
+
+   // Freeze this body in place with respect to a reference frame
+   virtual bool freeze (
+      RefFrame & parent );
+
+   // Release a frozen body, returning it to integration
+   virtual bool wake ( void );
+
+   /**
+    * Indicates whether this body is frozen.
+    * @return True if the body is frozen with respect to a frame.
+    */
+   bool is_frozen () const
+   {
+      return frozen && frame_attach.isAttached();
+   }
+
    /**
     * Detach parent and child DynBodies, 'this' and the argument body, such
     * that the detachment happens at the parent body level. Returns true if
@@ -761,6 +868,41 @@ public:
     */
    bool autoupdate_vehicle_points; //!< trick_units(--)
 
+   /**
+    * Limit vehicle point updates to active points?
+    * When set, compute_vehicle_point_states skips vehicle points whose frames
+    * are inactive, i.e., that nobody has activated or subscribed to.
+    * Leave this clear if vehicle point states are read without subscribing
+    * to the points.
+    */
+   bool update_active_vehicle_points_only; //!< trick_units(--)
+
+   /**
+    * Preserve the translational integrator history across integration frame
+    * switches? When set, a switch rebases the history of an integrator that
+    * supports it (see RebasableIntegrator), such as an operational
+    * Gauss-Jackson integrator, rather than resetting the integration group.
+    * The integrators are reset as usual otherwise.
+    */
+   bool preserve_integ_history; //!< trick_units(--)
+
+   /**
+    * Scale factor c of the body's Sundman time transformation, which asks
+    * for a step dt = c*r^alpha, where r is the body's distance from the
+    * origin of its integration frame and alpha is sundman_exponent.
+    * The units are s/m^alpha. Zero, the default, disables the
+    * transformation. The multirate scheduler (see DynManager::multirate)
+    * realizes the step by sub-dividing the integration group's cycle.
+    */
+   double sundman_step_scale; //!< trick_units(--)
+
+   /**
+    * Exponent alpha of the Sundman time transformation. One is the
+    * classical transformation; 3/2 (the default) keeps the step a fixed
+    * fraction of the local orbital time scale sqrt(r^3/mu).
+    */
+   double sundman_exponent; //!< trick_units(--)
+
    /**
     * Gravitational interactions.
     * This data member specifies how the vehicle interacts gravitationally
@@ -769,6 +911,12 @@ public:
     */
    GravityInteraction grav_interaction; //!< trick_units(--)
 
+   /**
+    * Wall-clock time spent on this body, by category. Accumulated only when
+    * cost tracking is enabled, and only for root bodies.
+    */
+   DynBodyCost cost; //!< trick_units(--)
+
    /**
     * Translational/rotational accelerations.
     */
@@ -780,6 +928,12 @@ public:
     */
    BodyForceCollect collect; //!< trick_units(--)
 
+   /**
+    * Forces and torques pushed directly onto the body by producers, added to
+    * the collected forces and torques each time they are collected.
+    */
+   BodyWrenchBuffer wrench_buffer; //!< trick_io(**)
+
 
 protected:
 
@@ -830,6 +984,48 @@ protected:
    virtual er7_utils::IntegratorResult rot_integ (
       double dyn_dt, unsigned int target_stage);
 
+   /**
+    * Integrate the state, optionally skipping the translational state,
+    * and propagate the integrated state.
+    * @param[in]     dyn_dt               Dynamic time step.
+    * @param[in]     target_stage         The stage of the integration process
+    *                                     that the integrator should attain.
+    * @param[in]     include_translation  Integrate the translational state?
+    * @return The status (time advance, pass/fail status) of the integration.
+    */
+   er7_utils::IntegratorResult integrate_state (
+      double dyn_dt,
+      unsigned int target_stage,
+      bool include_translation);
+
+   /**
+    * Integrate the state of a body that is not attached to a frame, with the
+    * translational and rotational dynamics settings fixed at compile time.
+    * @tparam        translation          Translational dynamics on?
+    * @tparam        rotation             Rotational dynamics on?
+    * @param[in]     dyn_dt               Dynamic time step.
+    * @param[in]     target_stage         The stage of the integration process
+    *                                     that the integrator should attain.
+    * @param[in]     include_translation  Integrate the translational state?
+    * @param[in,out] status               Merged integration status.
+    */
+   template <bool translation, bool rotation>
+   void integrate_free_state (
+      double dyn_dt,
+      unsigned int target_stage,
+      bool include_translation,
+      er7_utils::IntegratorResult & status);
+
+   /**
+    * Compute a root body's total forces and torques and the resulting
+    * accelerations, with the translational and rotational dynamics settings
+    * fixed at compile time.
+    * @tparam translation  Translational dynamics on?
+    * @tparam rotation     Rotational dynamics on?
+    */
+   template <bool translation, bool rotation>
+   void compute_root_derivatives ();
+
    // State update methods
 
    /**
@@ -1041,6 +1237,54 @@ protected:
     */
    virtual void detach_mass_internal (MassBody & child);
 
+   /**
+    * Mark the force and torque collection plans of this body and of all of
+    * its ancestors as needing to be rebuilt.
+    */
+   void invalidate_collect_plans ();
+
+
+   // Force and torque collection methods
+
+   /**
+    * Is the force and torque collection plan up to date?
+    *
+    * @return True if the plan can be used as is
+    */
+   bool collect_plan_is_current () const;
+
+   /**
+    * Rebuild the force and torque collection plan for the tree rooted at
+    * this body.
+    */
+   void build_collect_plan ();
+
+   /**
+    * Append this body's subtree to a force and torque collection plan,
+    * children before parents.
+    *
+    * @param[in,out] plan Plan to which the subtree is appended
+    */
+   virtual void append_collect_nodes (BodyCollectPlan & plan);
+
+   /**
+    * Transmit the forces and torques collected by this child body to its
+    * parent, and compute vehicle point derivatives if requested.
+    */
+   void transmit_forces_and_torques ();
+
+   /**
+    * Get the location of this body's composite center of mass with respect
+    * to the parent body's structural origin, in parent structural
+    * coordinates. This is maintained by the mass tree.
+    *
+    * @return Composite center of mass wrt parent structure\n Units: M
+    */
+   const double * get_composite_position_wrt_pstr () const
+   {
+      return mass.composite_wrt_pstr.position;
+   }
+
 
    // State propagation methods
 
@@ -1169,6 +1413,14 @@ protected:
     */
    DynBodyGenericFrameAttachment frame_attach;
 
+   /**
+    * Is the body frozen? A frozen body is a root body attached to a frame
+    * (see frame_attach) that its integration group additionally leaves
+    * out of gravitation and force and torque collection. Its state is
+    * composed from the frame's state.
+    */
+   bool frozen; //!< trick_units(--)
+
    /**
     * The subset of the dynamic bodies attached to this dynamic body
     */
@@ -1185,6 +1437,39 @@ protected:
     */
    std::list<BodyRefFrame*> vehicle_points;
 
+   /**
+    * The vehicle points whose relative states are in vehicle_point_offsets,
+    * in batch order.
+    */
+   std::vector<BodyRefFrame*> batched_vehicle_points; //!< trick_io(**)
+
+   /**
+    * Scratch list of the vehicle points selected for update.
+    */
+   std::vector<BodyRefFrame*> selected_vehicle_points; //!< trick_io(**)
+
+   /**
+    * Offsets and orientations of the batched vehicle points with respect
+    * to the structural frame, in structure-of-arrays form.
+    */
+   RefFrameStateBatch vehicle_point_offsets; //!< trick_io(**)
+
+   /**
+    * Vehicle point states computed from vehicle_point_offsets.
+    */
+   RefFrameStateBatch vehicle_point_states; //!< trick_io(**)
+
+   /**
+    * Cleared when vehicle points are added or removed, forcing
+    * vehicle_point_offsets to be rebuilt.
+    */
+   bool vehicle_point_batch_valid; //!< trick_io(**)
+
+   /**
+    * Force and torque collection plan for the tree rooted at this body.
+    */
+   BodyCollectPlan collect_plan; //!< trick_io(**)
+
    /**
     * Enum value indicating which of position, velocity, attitude, and rate
     * have been initialized.
@@ -1247,9 +1532,61 @@ protected:
     */
    RestartableSO3SecondOrderODEIntegrator rot_integrator; //!< trick_units(--)
 
+   /**
+    * Translational state recorded at the ends of the most recent integration
+    * step, for dense output. The recorded state is that of the frame
+    * identified by get_trans_integ_state.
+    */
+   SecondOrderDenseOutput trans_dense_output; //!< trick_io(**)
+
+   /**
+    * Use the translational integrator's natural interpolant, if it has one,
+    * for the recorded step? Cleared when the translational state is
+    * integrated by some other integrator (e.g., as part of a batch).
+    */
+   bool trans_dense_natural; //!< trick_units(--)
+
 
 private:
 
+   /**
+    * A root body derivative kernel.
+    */
+   typedef void (DynBody::*RootDerivativeKernel) ();
+
+   /**
+    * An unattached body integration kernel.
+    */
+   typedef void (DynBody::*FreeIntegrationKernel) (
+      double, unsigned int, bool, er7_utils::IntegratorResult &);
+
+   /**
+    * Encode the translational and rotational dynamics settings.
+    * @return Settings code, in the range 0 to 3.
+    */
+   unsigned int get_dynamics_mode () const
+   {
+      return (translational_dynamics ? 1U : 0U) |
+             (rotational_dynamics ? 2U : 0U);
+   }
+
+   /**
+    * Settings code for which the kernels were selected, or a code outside
+    * the range of get_dynamics_mode if none have been.
+    */
+   unsigned int dynamics_kernel_mode; //!< trick_io(**)
+
+   /**
+    * Root body derivative kernel for dynamics_kernel_mode.
+    */
+   RootDerivativeKernel root_derivative_kernel; //!< trick_io(**)
+
+   /**
+    * Unattached body integration kernel for dynamics_kernel_mode.
+    */
+   FreeIntegrationKernel free_integration_kernel; //!< trick_io(**)
+
+
    // Make the copy constructor and assignment operator private
    // (and unimplemented) to avoid erroneous copies
 
@@ -0,0 +1,166 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/dyn_body_branch_dispersion.hh
+ * Define the class DynBodyBranchDispersion, which disperses the state and
+ * mass of a DynBody in a branched Monte Carlo run.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/dyn_body_branch_dispersion.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DYN_BODY_BRANCH_DISPERSION_HH
+#define JEOD_DYN_BODY_BRANCH_DISPERSION_HH
+
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/branch_driver.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+
+
+/**
+ * A DynBodyBranchDispersion offsets the composite body position and velocity
+ * of a DynBody and scales its core mass properties, by run-specific amounts,
+ * when a JeodBranchDriver forks the run from an initialized simulation.
+ * Runs are added in order; a run without an entry is left undispersed.
+ */
+class DynBodyBranchDispersion : public JeodBranchDispersion {
+JEOD_MAKE_SIM_INTERFACES(DynBodyBranchDispersion)
+
+public:
+
+   // Constructor and destructor.
+   DynBodyBranchDispersion (void);
+   ~DynBodyBranchDispersion (void) override;
+
+   /**
+    * Set the body to be dispersed.
+    * @param dyn_body Body to be dispersed.
+    */
+   void set_body (DynBody & dyn_body)
+   { body = &dyn_body; }
+
+   // Add the dispersion for the next run.
+   void add_run (
+      const double delta_position[3],
+      const double delta_velocity[3],
+      double mass_scale);
+
+   // Apply the dispersion for the specified run.
+   void apply_dispersion (unsigned int run_index) override;
+
+
+private:
+
+   /**
+    * The dispersion for one run.
+    */
+   struct RunDispersion {
+      /**
+       * Offset added to the composite body position wrt the integration frame.
+       */
+      double delta_position[3]; //!< trick_units(m)
+
+      /**
+       * Offset added to the composite body velocity wrt the integration frame.
+       */
+      double delta_velocity[3]; //!< trick_units(m/s)
+
+      /**
+       * Factor applied to the core mass and inertia.
+       */
+      double mass_scale; //!< trick_units(--)
+   };
+
+
+   // Member data
+
+   /**
+    * The body to be dispersed.
+    */
+   DynBody * body; //!< trick_units(--)
+
+   /**
+    * Dispersions, indexed by run.
+    */
+   std::vector<RunDispersion> runs; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   DynBodyBranchDispersion (const DynBodyBranchDispersion &);
+
+   /**
+    * Not implemented.
+    */
+   DynBodyBranchDispersion & operator= (const DynBodyBranchDispersion &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
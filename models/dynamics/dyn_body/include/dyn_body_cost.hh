@@ -0,0 +1,146 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/dyn_body_cost.hh
+ * Define the DynBodyCost class.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Times are wall-clock times and include any contention with other
+    threads.)
+   (Batched gravity and batched translational integration are charged
+    equally to the bodies in the batch.))
+
+Library dependencies:
+  ((../src/dyn_body_cost.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_DYN_BODY_COST_HH
+#define JEOD_DYN_BODY_COST_HH
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Accumulates the wall-clock time spent on a root DynBody, by category,
+ * for use in balancing bodies across threads or processes.
+ * The time spent on a child body is charged to its root body.
+ */
+class DynBodyCost {
+
+ public:
+
+   /**
+    * Cost categories.
+    */
+   enum Category {
+      Gravity     = 0, ///< Gravitational acceleration
+      Forces      = 1, ///< Force and torque collection
+      Integration = 2, ///< State integration
+      Propagation = 3, ///< Propagation of integrated state to other frames
+      NumCategories = 4 ///< Number of categories
+   };
+
+
+ // Member data
+
+ public:
+
+   /**
+    * Accumulate costs? Set via DynManager::set_body_cost_tracking.
+    */
+   bool active; //!< trick_units(--)
+
+   /**
+    * Accumulated wall-clock time, by category.
+    */
+   double time[NumCategories]; //!< trick_units(s)
+
+
+ // Member functions
+
+ public:
+
+   // Constructor
+   DynBodyCost ();
+
+   // Start timing.
+   double begin () const;
+
+   // Charge the time since begin() to a category.
+   void end (Category category, double start);
+
+   // Charge a time to a category.
+   void add (Category category, double elapsed);
+
+   // Zero the accumulated times.
+   void reset ();
+
+   // Total accumulated time.
+   double total_time () const;
+
+   // Current wall-clock time.
+   static double wall_time ();
+
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
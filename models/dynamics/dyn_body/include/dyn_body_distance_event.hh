@@ -0,0 +1,142 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/dyn_body_distance_event.hh
+ * Define the class DynBodyDistanceEvent, an IntegrationEvent that occurs when
+ * a DynBody crosses a sphere about the origin of its integration frame.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/dyn_body_distance_event.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DYN_BODY_DISTANCE_EVENT_HH
+#define JEOD_DYN_BODY_DISTANCE_EVENT_HH
+
+
+// JEOD includes
+#include "utils/integration/include/integration_event.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+
+
+/**
+ * A DynBodyDistanceEvent occurs when a root DynBody crosses a sphere about
+ * the origin of its integration frame, such as a reference altitude over a
+ * spherical planet or the radius at which a DynBodyFrameSwitch would act.
+ * The guard is the distance less the threshold, so a Rising event is an
+ * exit from the sphere and a Falling event is an entry.
+ */
+class DynBodyDistanceEvent : public IntegrationEvent {
+JEOD_MAKE_SIM_INTERFACES(DynBodyDistanceEvent)
+
+public:
+
+   // Constructor and destructor.
+   DynBodyDistanceEvent (void);
+   ~DynBodyDistanceEvent (void) override;
+
+   /**
+    * Set the body whose distance is monitored.
+    * @param dyn_body The body; must be integrated by the group that
+    *                 checks the event.
+    */
+   void set_body (DynBody & dyn_body)
+   { body = &dyn_body; }
+
+   // IntegrationEvent methods.
+   bool evaluate_guard (
+      const JeodIntegrationGroup & group,
+      double dyn_time,
+      double & value) override;
+
+
+   // Member data
+
+   /**
+    * Radius of the sphere.
+    */
+   double threshold; //!< trick_units(m)
+
+
+private:
+
+   /**
+    * The body whose distance is monitored.
+    */
+   DynBody * body; //!< trick_units(--)
+
+
+   /**
+    * Not implemented.
+    */
+   DynBodyDistanceEvent (const DynBodyDistanceEvent &);
+
+   /**
+    * Not implemented.
+    */
+   DynBodyDistanceEvent & operator= (const DynBodyDistanceEvent &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
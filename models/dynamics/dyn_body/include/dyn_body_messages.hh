@@ -117,6 +117,12 @@ class DynBodyMessages {
     */
    static char const * invalid_technique; //!< trick_units(--)
 
+   /**
+    * Issued when a request cannot be honored as made, such as one that is
+    * out of range or made at the wrong time.
+    */
+   static char const * invalid_request; //!< trick_units(--)
+
    /**
     * Issued when a MassBody is expected to be a DynBody but that is not
     * the case.
@@ -282,6 +282,18 @@ protected:
         double dyn_dt,
         unsigned int target_stage) override;
 
+    /**
+     * Get the arrays that StructureIntegratedDynBody::trans_integ integrates.
+     * @param[out] accel     Structure frame translational acceleration.
+     * @param[out] velocity  Structure frame velocity.
+     * @param[out] position  Structure frame position.
+     * @return True if the translational state is currently integrated.
+     */
+    bool get_trans_integ_state (
+        double const * & accel,
+        double * & velocity,
+        double * & position) override;
+
     /**
      * Integrate the rotational state of a StructureIntegratedDynBody.
      * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
@@ -293,10 +305,22 @@ protected:
         double dyn_dt,
         unsigned int target_stage) override;
 
+    /**
+     * Append this body's subtree to a force and torque collection plan,
+     * children before parents. Child bodies that are exactly
+     * StructureIntegratedDynBody objects are collected by the plan.
+     * @param[in,out] plan Plan to which the subtree is appended
+     */
+    void append_collect_nodes (BodyCollectPlan & plan) override;
+
     /**
      * Collect the local forces and torques that directly act on the vehicle.
+     * @param[in] plan The collection plan of the root of the collection.
+     * @param[in] node This body's node in the plan.
      */
-    void collect_local_forces_and_torques ();
+    void collect_local_forces_and_torques (
+        const BodyCollectPlan & plan,
+        const BodyCollectPlan::Node & node);
 
     /**
      * Propagate forces and torques up the kinematic chain.
@@ -0,0 +1,236 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/variational_equations.hh
+ * Define the class VariationalEquations, which integrates the state
+ * transition matrix of a DynBody alongside the body's state.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/variational_equations.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_VARIATIONAL_EQUATIONS_HH
+#define JEOD_VARIATIONAL_EQUATIONS_HH
+
+
+// ER7 utilities includes
+#include "er7_utils/integration/core/include/integrable_object.hh"
+#include "er7_utils/integration/core/include/integrator_result.hh"
+
+// JEOD includes
+#include "utils/container/include/pointer_vector.hh"
+#include "utils/integration/include/restartable_state_integrator.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+class VariationalPartials;
+
+
+/**
+ * A VariationalEquations integrates the variational equations of a root
+ * DynBody's translational state: the 6x6 state transition matrix
+ * Phi = d(r,v)/d(r0,v0) and, optionally, the sensitivities of (r,v) to
+ * model parameters. The state is that of the composite body wrt the
+ * integration frame. The equations,
+ *   dPhi/dt = A Phi,  dS/dt = A S + B,
+ *   A = [0 I; G + da/dr  da/dv],  B = [0; da/dp],
+ * are integrated by the body's integration group as an integrable object
+ * associated with the body, using the integration technique of the group.
+ * G is the body's gravity gradient; VariationalPartials objects add the
+ * partials of other accelerations and define the parameters.
+ *
+ * The partials are evaluated at the start of each integration stage, after
+ * the derivative jobs have run, so the object sees the same state the body's
+ * integrator sees. Gravity gradient computation is enabled on each of the
+ * body's gravity controls when the object is initialized.
+ */
+class VariationalEquations : public er7_utils::IntegrableObject {
+JEOD_MAKE_SIM_INTERFACES(VariationalEquations)
+
+public:
+
+   /**
+    * The maximum number of model parameters.
+    */
+   static const unsigned int max_parameters = 6;
+
+   // Constructor and destructor.
+   VariationalEquations (void);
+   ~VariationalEquations (void) override;
+
+   // Add a source of acceleration partials and parameters.
+   void add_partials (VariationalPartials & source);
+
+   // Associate with a body and start integrating.
+   void initialize (DynBody & dyn_body);
+
+   // Restart the matrices from identity and zero.
+   void reset_matrices (void);
+
+   // Get the state transition matrix.
+   void get_stm (double stm[6][6]) const;
+
+   // Get the sensitivity to a parameter.
+   void get_sensitivity (unsigned int param_index, double sens[6]) const;
+
+   /**
+    * Get the number of model parameters.
+    * @return Number of parameters.
+    */
+   unsigned int get_num_parameters (void) const
+   {
+      return num_parameters;
+   }
+
+
+   // IntegrableObject methods
+
+   // Create the integrator.
+   void create_integrators (
+      const er7_utils::IntegratorConstructor & generator,
+      er7_utils::IntegrationControls & controls,
+      const er7_utils::TimeInterface & time_if) override;
+
+   // Destroy the integrator.
+   void destroy_integrators (void) override;
+
+   // Reset the integrator.
+   void reset_integrators (void) override;
+
+   // Integrate the variational equations.
+   er7_utils::IntegratorResult integrate (
+      double dyn_dt, unsigned int target_stage) override;
+
+
+   // Member data
+
+   /**
+    * Partial of the total acceleration wrt position, integration frame,
+    * as of the most recent integration stage.
+    */
+   double dadr[3][3]; //!< trick_units(1/s2)
+
+   /**
+    * Partial of the total acceleration wrt velocity, integration frame,
+    * as of the most recent integration stage.
+    */
+   double dadv[3][3]; //!< trick_units(1/s)
+
+
+private:
+
+   // Compute the time derivatives of the integrated columns.
+   void compute_derivatives (void);
+
+   /**
+    * The body whose state transition matrix is integrated.
+    */
+   DynBody * body; //!< trick_units(--)
+
+   /**
+    * Sources of acceleration partials.
+    */
+   JeodPointerVector<VariationalPartials>::type partials; //!< trick_io(**)
+
+   /**
+    * Number of model parameters, summed over the sources.
+    */
+   unsigned int num_parameters; //!< trick_units(--)
+
+   /**
+    * Integrated state: the columns of Phi followed by those of S. Column k
+    * is d(r,v)/d(x_k), where x_k is the k-th element of (r0,v0) for k < 6
+    * and the (k-6)-th parameter otherwise. Only the first 6+num_parameters
+    * columns are integrated.
+    */
+   double columns[6 + max_parameters][6]; //!< trick_units(--)
+
+   /**
+    * Time derivatives of the integrated columns.
+    */
+   double columns_dot[6 + max_parameters][6]; //!< trick_units(--)
+
+   /**
+    * Partial of the total acceleration wrt each parameter.
+    */
+   double dadp[max_parameters][3]; //!< trick_units(--)
+
+   /**
+    * Integrates the columns.
+    */
+   RestartableVectorFirstOrderODEIntegrator integrator; //!< trick_units(--)
+
+
+   /**
+    * Not implemented.
+    */
+   VariationalEquations (const VariationalEquations &);
+
+   /**
+    * Not implemented.
+    */
+   VariationalEquations & operator= (const VariationalEquations &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,277 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/include/variational_partials.hh
+ * Define the class VariationalPartials and its drag and radiation pressure
+ * implementations, which supply the partials of non-gravitational
+ * accelerations to VariationalEquations.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/variational_partials.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_VARIATIONAL_PARTIALS_HH
+#define JEOD_VARIATIONAL_PARTIALS_HH
+
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+
+
+/**
+ * A VariationalPartials supplies the partials of one acceleration acting on
+ * a DynBody with respect to the body's translational state, expressed in
+ * the body's integration frame, and, optionally, with respect to some
+ * number of model parameters.
+ */
+class VariationalPartials {
+JEOD_MAKE_SIM_INTERFACES(VariationalPartials)
+
+public:
+
+   // Destructor.
+   virtual ~VariationalPartials (void);
+
+   /**
+    * Get the number of model parameters whose sensitivities this object
+    * supplies.
+    * @return Number of parameters.
+    */
+   virtual unsigned int get_num_parameters (void) const = 0;
+
+   /**
+    * Add the partials of the acceleration to the supplied matrices.
+    * @param[in] body The body
+    * @param[in,out] dadr Partial of acceleration wrt position\n Units: 1/s2
+    * @param[in,out] dadv Partial of acceleration wrt velocity\n Units: 1/s
+    * @param[out] dadp Partial of acceleration wrt each of this object's
+    *                  parameters, get_num_parameters() of them
+    */
+   virtual void add_partials (
+      const DynBody & body,
+      double dadr[3][3],
+      double dadv[3][3],
+      double dadp[][3]) = 0;
+
+
+protected:
+
+   // Constructor.
+   VariationalPartials (void);
+
+   // Add the partial of an acceleration that scales as a power of |u|.
+   static void add_power_law_partial (
+      const double accel[3],
+      const double u[3],
+      double exponent,
+      double dadu[3][3]);
+
+   // Compute the acceleration that results from a structural frame force.
+   static bool compute_accel (
+      const DynBody & body,
+      const double * force_struct,
+      double accel[3]);
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   VariationalPartials (const VariationalPartials &);
+
+   /**
+    * Not implemented.
+    */
+   VariationalPartials & operator= (const VariationalPartials &);
+};
+
+
+/**
+ * Partials of an aerodynamic drag acceleration. The drag is taken to scale
+ * with the dynamic pressure and to turn with the velocity relative to an
+ * atmosphere that rotates with the central body at the origin of the
+ * integration frame; the density is taken to fall off exponentially with
+ * distance from that origin. The single optional parameter is a scale
+ * factor on the drag, with a nominal value of one.
+ */
+class DragVariationalPartials : public VariationalPartials {
+JEOD_MAKE_SIM_INTERFACES(DragVariationalPartials)
+
+public:
+
+   // Constructor and destructor.
+   DragVariationalPartials (void);
+   ~DragVariationalPartials (void) override;
+
+   // VariationalPartials methods.
+   unsigned int get_num_parameters (void) const override;
+   void add_partials (
+      const DynBody & body,
+      double dadr[3][3],
+      double dadv[3][3],
+      double dadp[][3]) override;
+
+
+   // Member data
+
+   /**
+    * Drag force, expressed in the body's structural frame, such as
+    * AerodynamicDrag::aero_force. Nothing is added while this is null.
+    */
+   const double * force; //!< trick_units(--)
+
+   /**
+    * Angular velocity of the atmosphere, expressed in the integration frame.
+    */
+   double atmosphere_rate[3]; //!< trick_units(rad/s)
+
+   /**
+    * Density scale height. Zero, the default, omits the partial due to the
+    * density gradient.
+    */
+   double scale_height; //!< trick_units(m)
+
+   /**
+    * Supply the sensitivity to the drag scale factor?
+    */
+   bool estimate_scale_factor; //!< trick_units(--)
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   DragVariationalPartials (const DragVariationalPartials &);
+
+   /**
+    * Not implemented.
+    */
+   DragVariationalPartials & operator= (const DragVariationalPartials &);
+};
+
+
+/**
+ * Partials of a radiation pressure acceleration. The acceleration is taken
+ * to fall off with the square of the distance from the radiation source and
+ * to turn with the direction from the source. The single optional parameter
+ * is a scale factor on the acceleration (e.g., on the reflectivity), with a
+ * nominal value of one.
+ */
+class RadiationVariationalPartials : public VariationalPartials {
+JEOD_MAKE_SIM_INTERFACES(RadiationVariationalPartials)
+
+public:
+
+   // Constructor and destructor.
+   RadiationVariationalPartials (void);
+   ~RadiationVariationalPartials (void) override;
+
+   // VariationalPartials methods.
+   unsigned int get_num_parameters (void) const override;
+   void add_partials (
+      const DynBody & body,
+      double dadr[3][3],
+      double dadv[3][3],
+      double dadp[][3]) override;
+
+
+   // Member data
+
+   /**
+    * Radiation pressure force, expressed in the body's structural frame,
+    * such as RadiationPressure::force. Nothing is added while this is null.
+    */
+   const double * force; //!< trick_units(--)
+
+   /**
+    * Position of the radiation source wrt the integration frame. The
+    * partial wrt position is omitted while this is null.
+    */
+   const double * source_position; //!< trick_units(--)
+
+   /**
+    * Supply the sensitivity to the radiation pressure scale factor?
+    */
+   bool estimate_scale_factor; //!< trick_units(--)
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   RadiationVariationalPartials (const RadiationVariationalPartials &);
+
+   /**
+    * Not implemented.
+    */
+   RadiationVariationalPartials & operator= (
+      const RadiationVariationalPartials &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
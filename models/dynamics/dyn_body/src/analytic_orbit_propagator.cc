@@ -0,0 +1,235 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file
+ * Define member functions for the class AnalyticOrbitPropagator.
+ */
+
+/*
+Purpose: ()
+Reference:
+  (((Vallado, D. A.)
+    (Fundamentals of Astrodynamics and Applications, 3rd ed.)
+    (Section 9.6: Secular effects of J2)))
+Library dependencies:
+  ((analytic_orbit_propagator.cc)
+   (dyn_body.cc)
+   (dyn_body_messages.cc)
+   (dyn_body_set_state.cc)
+   (utils/orbital_elements/src/orbital_elements.cc))
+*/
+
+
+// System includes
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame_items.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/analytic_orbit_propagator.hh"
+#include "../include/dyn_body.hh"
+#include "../include/dyn_body_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Tolerance on eccentricity and inclination below which OrbitalElements
+// treats an orbit as circular or equatorial.
+static const double element_tolerance = 1.0e-13;
+
+
+// Constructor
+AnalyticOrbitPropagator::AnalyticOrbitPropagator ()
+:
+   mu(0.0),
+   j2(0.0),
+   r_eq(0.0),
+   elements(),
+   body(nullptr),
+   epoch(0.0),
+   mean_anom_epoch(0.0),
+   long_asc_node_epoch(0.0),
+   arg_periapsis_epoch(0.0),
+   mean_anom_rate(0.0),
+   long_asc_node_rate(0.0),
+   arg_periapsis_rate(0.0)
+{
+   return;
+}
+
+
+// Destructor
+AnalyticOrbitPropagator::~AnalyticOrbitPropagator ()
+{
+   return;
+}
+
+
+/**
+ * Capture the body's current translational state as the epoch elements and
+ * hand the body's translational state over to this propagator.
+ * \param[in,out] new_body Root body to be propagated
+ * \param[in] time Current time; update() must use the same time scale
+ */
+void
+AnalyticOrbitPropagator::initialize (
+   DynBody & new_body,
+   double time)
+{
+   if (! new_body.is_root_body()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_body,
+         "Body '%s' is attached to another body; only root bodies "
+         "can be propagated analytically.",
+         new_body.name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   if (mu <= 0.0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_body,
+         "The gravitational parameter used to propagate body '%s' "
+         "must be positive.",
+         new_body.name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   body = &new_body;
+   epoch = time;
+
+   elements.from_cartesian (mu,
+                            body->composite_body.state.trans.position,
+                            body->composite_body.state.trans.velocity);
+
+   mean_anom_epoch = elements.mean_anom;
+   long_asc_node_epoch = elements.long_asc_node;
+   arg_periapsis_epoch = elements.arg_periapsis;
+
+   compute_secular_rates ();
+
+   // The integrator no longer owns the translational state.
+   body->translational_dynamics = false;
+}
+
+
+/**
+ * Compute the secular rates of the angular elements. The rates are
+ * expressed in the element conventions used by OrbitalElements, which fold
+ * the undefined node and periapsis angles of circular and equatorial orbits
+ * into the remaining angles.
+ */
+void
+AnalyticOrbitPropagator::compute_secular_rates ()
+{
+   double node_rate = 0.0;
+   double periapsis_rate = 0.0;
+   double anomaly_drift = 0.0;
+   double e_mag = elements.e_mag;
+   double inclination = elements.inclination;
+   bool circular = (e_mag < element_tolerance);
+   bool prograde_equatorial = (inclination < element_tolerance);
+   bool retrograde_equatorial = ((M_PI - element_tolerance) < inclination);
+
+   // The J2 secular rates apply to closed orbits only.
+   if ((j2 != 0.0) && (r_eq > 0.0) && (elements.semi_major_axis > 0.0) &&
+       (e_mag < 1.0)) {
+      double p_ratio = r_eq / elements.semiparam;
+      double factor = 0.75 * elements.mean_motion * j2 * p_ratio * p_ratio;
+      double cos_i = std::cos (inclination);
+      double sin2_i = 1.0 - cos_i * cos_i;
+
+      node_rate = -2.0 * factor * cos_i;
+      periapsis_rate = factor * (4.0 - 5.0 * sin2_i);
+      anomaly_drift =
+         factor * std::sqrt (1.0 - e_mag * e_mag) * (2.0 - 3.0 * sin2_i);
+   }
+
+   mean_anom_rate = elements.mean_motion + anomaly_drift;
+   long_asc_node_rate = node_rate;
+   arg_periapsis_rate = periapsis_rate;
+
+   // Equatorial orbits carry no node: the node regression moves periapsis,
+   // measured along the direction of motion.
+   if (prograde_equatorial) {
+      arg_periapsis_rate += node_rate;
+      long_asc_node_rate = 0.0;
+   }
+   else if (retrograde_equatorial) {
+      arg_periapsis_rate -= node_rate;
+      long_asc_node_rate = 0.0;
+   }
+
+   // Circular orbits carry no periapsis: its motion moves the anomaly.
+   if (circular) {
+      mean_anom_rate += arg_periapsis_rate;
+      arg_periapsis_rate = 0.0;
+   }
+}
+
+
+/**
+ * Advance the elements to the specified time and set the body's composite
+ * body position and velocity with respect to its integration frame.
+ * \param[in] time Current time, in the scale passed to initialize()
+ */
+void
+AnalyticOrbitPropagator::update (
+   double time)
+{
+   RefFrameState state;
+
+   if (body == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_body,
+         "The analytic orbit propagator was not initialized.");
+
+      // Not reached
+      return;
+   }
+
+   double dt = time - epoch;
+
+   elements.mean_anom = mean_anom_epoch + mean_anom_rate * dt;
+   elements.long_asc_node = long_asc_node_epoch + long_asc_node_rate * dt;
+   elements.arg_periapsis = arg_periapsis_epoch + arg_periapsis_rate * dt;
+
+   // Keep closed-orbit angles small so the anomaly solution stays accurate.
+   if (elements.e_mag < 1.0 - 1.0e-2) {
+      elements.mean_anom = std::fmod (elements.mean_anom, 2.0 * M_PI);
+      if (elements.mean_anom < 0.0) {
+         elements.mean_anom += 2.0 * M_PI;
+      }
+      elements.long_asc_node =
+         std::fmod (elements.long_asc_node, 2.0 * M_PI);
+      elements.arg_periapsis =
+         std::fmod (elements.arg_periapsis, 2.0 * M_PI);
+   }
+
+   elements.mean_anom_to_nu ();
+   elements.to_cartesian (mu, state.trans.position, state.trans.velocity);
+
+   body->set_state (RefFrameItems::Pos_Vel, state, body->composite_body);
+   body->propagate_state ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,234 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/body_collect_plan.cc
+ * Define member functions for the BodyCollectPlan class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((body_collect_plan.cc)
+   (force.cc)
+   (torque.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/body_collect_plan.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Append the collected forces to the plan's entries. Items without a force
+ * vector are never active and are left out.
+ * \param[in] vec Collected forces
+ * \param[in,out] entries Plan entries
+ */
+void
+append_entries (
+   const JeodPointerVector<CollectForce>::type & vec,
+   std::vector<BodyCollectPlan::Entry> & entries)
+{
+   unsigned int nitems = vec.size();
+
+   for (unsigned int ii = 0; ii < nitems; ++ii) {
+      if (vec[ii]->force != nullptr) {
+         BodyCollectPlan::Entry entry;
+         entry.vec = vec[ii]->force;
+         entry.active = (vec[ii]->active != nullptr) ?
+                        vec[ii]->active : &BodyCollectPlan::always_active;
+         entries.push_back (entry);
+      }
+   }
+}
+
+
+/**
+ * Append the collected torques to the plan's entries. Items without a torque
+ * vector are never active and are left out.
+ * \param[in] vec Collected torques
+ * \param[in,out] entries Plan entries
+ */
+void
+append_entries (
+   const JeodPointerVector<CollectTorque>::type & vec,
+   std::vector<BodyCollectPlan::Entry> & entries)
+{
+   unsigned int nitems = vec.size();
+
+   for (unsigned int ii = 0; ii < nitems; ++ii) {
+      if (vec[ii]->torque != nullptr) {
+         BodyCollectPlan::Entry entry;
+         entry.vec = vec[ii]->torque;
+         entry.active = (vec[ii]->active != nullptr) ?
+                        vec[ii]->active : &BodyCollectPlan::always_active;
+         entries.push_back (entry);
+      }
+   }
+}
+
+}
+
+
+const bool BodyCollectPlan::always_active = true;
+
+
+/**
+ * BodyCollectPlan default constructor.
+ */
+BodyCollectPlan::BodyCollectPlan (
+   void)
+:
+   valid(false),
+   nodes(),
+   entries()
+{
+   return;
+}
+
+
+/**
+ * Empty the plan in preparation for rebuilding it.
+ */
+void
+BodyCollectPlan::clear (
+   void)
+{
+   nodes.clear();
+   entries.clear();
+   valid = false;
+}
+
+
+/**
+ * Append a body to the plan. The collect vectors of a flat body are copied
+ * into the plan's entries; those of a body that is not flat are only sized.
+ * \param[in] body Body to be added
+ * \param[in] flat Is the body collected by the plan?
+ * \param[in] collect The body's force and torque collection
+ */
+void
+BodyCollectPlan::add_node (
+   DynBody & body,
+   bool flat,
+   const BodyForceCollect & collect)
+{
+   Node node;
+
+   node.body = &body;
+   node.flat = flat;
+
+   node.sizes[EffectorForce]  = collect.collect_effector_forc.size();
+   node.sizes[EnvironForce]   = collect.collect_environ_forc.size();
+   node.sizes[NoXmitForce]    = collect.collect_no_xmit_forc.size();
+   node.sizes[EffectorTorque] = collect.collect_effector_torq.size();
+   node.sizes[EnvironTorque]  = collect.collect_environ_torq.size();
+   node.sizes[NoXmitTorque]   = collect.collect_no_xmit_torq.size();
+
+   node.begin[EffectorForce] = entries.size();
+   if (flat) {
+      append_entries (collect.collect_effector_forc, entries);
+   }
+   node.begin[EnvironForce] = entries.size();
+   if (flat) {
+      append_entries (collect.collect_environ_forc, entries);
+   }
+   node.begin[NoXmitForce] = entries.size();
+   if (flat) {
+      append_entries (collect.collect_no_xmit_forc, entries);
+   }
+   node.begin[EffectorTorque] = entries.size();
+   if (flat) {
+      append_entries (collect.collect_effector_torq, entries);
+   }
+   node.begin[EnvironTorque] = entries.size();
+   if (flat) {
+      append_entries (collect.collect_environ_torq, entries);
+   }
+   node.begin[NoXmitTorque] = entries.size();
+   if (flat) {
+      append_entries (collect.collect_no_xmit_torq, entries);
+   }
+   node.begin[NumCollections] = entries.size();
+
+   nodes.push_back (node);
+}
+
+
+/**
+ * Do a node's collect vectors still have the sizes recorded in the plan?
+ * @return True if the sizes match
+ * \param[in] node Plan node
+ * \param[in] collect The node body's force and torque collection
+ */
+bool
+BodyCollectPlan::sizes_match (
+   const Node & node,
+   const BodyForceCollect & collect)
+const
+{
+   return (node.sizes[EffectorForce]  == collect.collect_effector_forc.size()) &&
+          (node.sizes[EnvironForce]   == collect.collect_environ_forc.size()) &&
+          (node.sizes[NoXmitForce]    == collect.collect_no_xmit_forc.size()) &&
+          (node.sizes[EffectorTorque] == collect.collect_effector_torq.size()) &&
+          (node.sizes[EnvironTorque]  == collect.collect_environ_torq.size()) &&
+          (node.sizes[NoXmitTorque]   == collect.collect_no_xmit_torq.size());
+}
+
+
+/**
+ * Sum the active items of one of a node's collections. Inactive items
+ * contribute zero through a select rather than being branched around.
+ * \param[in] node Plan node
+ * \param[in] collection Which collection
+ * \param[out] cumulation Accumulated vector
+ */
+void
+BodyCollectPlan::accumulate (
+   const Node & node,
+   Collection collection,
+   double cumulation[3])
+const
+{
+   const Entry * first = entries.data() + node.begin[collection];
+   const Entry * last = entries.data() + node.begin[collection+1];
+
+   Vector3::initialize (cumulation);
+   for (const Entry * entry = first; entry != last; ++entry) {
+      const double * vec = entry->vec;
+      bool on = *(entry->active);
+      cumulation[0] += on ? vec[0] : 0.0;
+      cumulation[1] += on ? vec[1] : 0.0;
+      cumulation[2] += on ? vec[2] : 0.0;
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
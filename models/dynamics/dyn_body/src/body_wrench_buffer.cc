@@ -0,0 +1,132 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/body_wrench_buffer.cc
+ * Define member functions for the BodyWrenchBuffer class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((body_wrench_buffer.cc)
+   (utils/math/src/deterministic_sum.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+
+// JEOD includes
+#include "utils/math/include/deterministic_sum.hh"
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/body_wrench_buffer.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * BodyWrenchBuffer default constructor. The buffer has a single slot.
+ */
+BodyWrenchBuffer::BodyWrenchBuffer (
+   void)
+:
+   num_slots(1),
+   sums(slot_stride, 0.0)
+{
+   return;
+}
+
+
+/**
+ * BodyWrenchBuffer destructor.
+ */
+BodyWrenchBuffer::~BodyWrenchBuffer (
+   void)
+{
+   return;
+}
+
+
+/**
+ * Set the number of slots, typically the number of tasks that push onto
+ * the body, and empty the buffer. A count of zero is treated as one.
+ * \param[in] nslots Slot count
+ */
+void
+BodyWrenchBuffer::set_num_slots (
+   unsigned int nslots)
+{
+   num_slots = std::max (nslots, 1U);
+   sums.assign (num_slots * slot_stride, 0.0);
+}
+
+
+/**
+ * Add the pushed forces and torques to a body's accumulators and empty the
+ * buffer. The slots are first summed with a fixed pairwise tree, so the
+ * totals depend only on the per-slot sums and the slot count. The buffer is
+ * emptied even if neither forces nor torques are wanted.
+ * \param[in] forces Add the forces?
+ * \param[in] torques Add the torques?
+ * \param[in,out] collect The body's force and torque collection
+ */
+void
+BodyWrenchBuffer::reduce (
+   bool forces,
+   bool torques,
+   BodyForceCollect & collect)
+{
+   double * const forc[NumCategories] = {
+      collect.effector_forc, collect.environ_forc, collect.no_xmit_forc};
+   double * const torq[NumCategories] = {
+      collect.effector_torq, collect.environ_torq, collect.no_xmit_torq};
+
+   // Reduce into slot 0; the other slots are cleared below.
+   DeterministicSum::pairwise_reduce (num_slots, 6 * NumCategories,
+                                      slot_stride, sums.data());
+
+   for (unsigned int cat = 0; cat < NumCategories; ++cat) {
+      Category category = static_cast<Category>(cat);
+      if (forces) {
+         Vector3::incr (slot_force (0, category), forc[cat]);
+      }
+      if (torques) {
+         Vector3::incr (slot_torque (0, category), torq[cat]);
+      }
+   }
+
+   clear ();
+}
+
+
+/**
+ * Empty the buffer.
+ */
+void
+BodyWrenchBuffer::clear (
+   void)
+{
+   std::fill (sums.begin(), sums.end(), 0.0);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -19,14 +19,18 @@ Library dependencies:
   ((dyn_body.cc)
    (dyn_body_attach.cc)
    (dyn_body_collect.cc)
+   (dyn_body_cost.cc)
    (dyn_body_detach.cc)
    (dyn_body_find_body_frame.cc)
+   (dyn_body_freeze.cc)
    (dyn_body_integration.cc)
    (dyn_body_initialize_model.cc)
    (dyn_body_propagate_state.cc)
    (dyn_body_set_state.cc)
    (dyn_body_vehicle_point.cc)
    (aux_classes.cc)
+   (body_collect_plan.cc)
+   (body_wrench_buffer.cc)
    (force.cc)
    (torque.cc)
    (dynamics/dyn_manager/src/dynamics_integration_group.cc)
@@ -72,11 +76,23 @@ DynBody::DynBody ()
    three_dof(false),
    rotation_integration(GeneralizedSecondOrderODETechnique::LieGroup),
    autoupdate_vehicle_points(true),
+   update_active_vehicle_points_only(false),
+   preserve_integ_history(false),
+   sundman_step_scale(0.0),
+   sundman_exponent(1.5),
    grav_interaction(),
+   cost(),
    dyn_manager(mass.dyn_manager),
    time_manager(nullptr),
    dyn_parent(nullptr),
+   frozen(false),
    dyn_children(),
+   batched_vehicle_points(),
+   selected_vehicle_points(),
+   vehicle_point_offsets(),
+   vehicle_point_states(),
+   vehicle_point_batch_valid(false),
+   collect_plan(),
    initialized_states(RefFrameItems::No_Items),
    position_source(nullptr),
    velocity_source(nullptr),
@@ -85,7 +101,12 @@ DynBody::DynBody ()
    integrated_frame(nullptr),
    associated_integrable_objects(),
    trans_integrator(),
-   rot_integrator()
+   rot_integrator(),
+   trans_dense_output(),
+   trans_dense_natural(false),
+   dynamics_kernel_mode(~0U),
+   root_derivative_kernel(nullptr),
+   free_integration_kernel(nullptr)
 {
    // Register the checkpointable items.
    JEOD_REGISTER_CLASS (DynBody);
@@ -96,6 +117,9 @@ DynBody::DynBody ()
    // This class integrates the composite body frame.
    integrated_frame = &composite_body;
 
+   // Dense output covers the three element translational state.
+   trans_dense_output.configure (3);
+
    // We want the inverse inertia tensor (MassBody member) calculated.
    mass.compute_inverse_inertia = true;
 
@@ -816,6 +816,7 @@ void DynBody::add_mass_body_frames( MassBody &subbody )
             integ_frame->add_child(*pt_frame);
         }
         vehicle_points.push_back(pt_frame);
+        vehicle_point_batch_valid = false;
         dyn_manager->add_ref_frame(*pt_frame);
     }
 
@@ -857,6 +858,7 @@ DynBody::attach_establish_links (
    // used when the state is propagated through the tree; the tree identifies
    // MassBodies, not all of whic
    dyn_parent->dyn_children.push_back (this);
+   dyn_parent->invalidate_collect_plans ();
 
    // Make this body's integration frame the same as the parent's.
    if (integ_frame != dyn_parent->integ_frame) {
@@ -927,6 +929,7 @@ DynBody::attach_update_properties (
    {
       mass.attach_update_properties (
          offset_pstr_cstr_pstr, T_pstr_cstr, child.mass);
+      mass.get_root_body_internal()->update_mass_properties ();
 
       root_body->set_state_source_internal (RefFrameItems::Pos_Vel_Att_Rate,
                                             root_body->structure);
@@ -1086,6 +1089,10 @@ DynBody::process_dynamic_attachment (
    mass.attach_update_properties (
       offset_pstr_cstr_pstr, T_pstr_cstr, child_body.mass);
 
+   // The momentum bookkeeping below needs the combined properties now, even
+   // if a mass update transaction is open.
+   mass.get_root_body_internal()->update_mass_properties ();
+
 
    // Store the CM of the new root body
    // (i.e. the combined-body body-frame origin w.r.t., and
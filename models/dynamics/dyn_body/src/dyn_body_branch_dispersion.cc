@@ -0,0 +1,142 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/dyn_body_branch_dispersion.cc
+ * Define DynBodyBranchDispersion methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((dyn_body_branch_dispersion.cc)
+   (dyn_body_set_state.cc)
+   (dyn_body_messages.cc)
+   (dynamics/mass/src/mass.cc)
+   (utils/sim_interface/src/branch_driver.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cstddef>
+
+// Jeod includes
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame_items.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/dyn_body.hh"
+#include "../include/dyn_body_branch_dispersion.hh"
+#include "../include/dyn_body_messages.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a DynBodyBranchDispersion.
+ */
+DynBodyBranchDispersion::DynBodyBranchDispersion (
+   void)
+:
+   JeodBranchDispersion(),
+   body(nullptr),
+   runs()
+{
+   ; // Empty
+}
+
+
+/**
+ * Destruct a DynBodyBranchDispersion.
+ */
+DynBodyBranchDispersion::~DynBodyBranchDispersion (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Add the dispersion for the next run.
+ * \param[in] delta_position Position offset wrt the integration frame\n
+ *            Units: M
+ * \param[in] delta_velocity Velocity offset wrt the integration frame\n
+ *            Units: M/s
+ * \param[in] mass_scale Factor applied to the core mass and inertia
+ */
+void
+DynBodyBranchDispersion::add_run (
+   const double delta_position[3],
+   const double delta_velocity[3],
+   double mass_scale)
+{
+   RunDispersion run;
+   Vector3::copy (delta_position, run.delta_position);
+   Vector3::copy (delta_velocity, run.delta_velocity);
+   run.mass_scale = mass_scale;
+   runs.push_back (run);
+}
+
+
+/**
+ * Apply the dispersion for the specified run: scale the core mass properties,
+ * then offset the composite body state and propagate it through the tree.
+ * \param[in] run_index Zero-based run index
+ */
+void
+DynBodyBranchDispersion::apply_dispersion (
+   unsigned int run_index)
+{
+   if (body == nullptr) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynBodyMessages::invalid_body,
+         "No body has been set for the branch dispersion.");
+      return;
+   }
+
+   if (run_index >= runs.size()) {
+      return;
+   }
+
+   const RunDispersion & run = runs[run_index];
+
+   // Scale the core mass properties. The center of mass does not move.
+   if (run.mass_scale != 1.0) {
+      MassProperties & core = body->mass.core_properties;
+      core.mass *= run.mass_scale;
+      Matrix3x3::scale (run.mass_scale, core.inertia);
+      body->mass.set_update_flag ();
+      body->mass.update_mass_properties ();
+   }
+
+   // Offset the translational state and propagate it.
+   RefFrameState state = body->composite_body.state;
+   Vector3::incr (run.delta_position, state.trans.position);
+   Vector3::incr (run.delta_velocity, state.trans.velocity);
+   body->set_state (RefFrameItems::Pos_Vel, state, body->composite_body);
+
+   // The integrators must not use history from before the dispersion.
+   body->reset_integrators ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -25,6 +25,8 @@ Assumptions and limitations:
 
 Library dependencies:
   ((dyn_body_collect.cc)
+   (body_collect_plan.cc)
+   (body_wrench_buffer.cc)
    (dyn_body.cc)
    (dynamics/mass/src/mass_point_state.cc)
    (utils/ref_frames/src/ref_frame.cc))
@@ -36,6 +38,7 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <typeinfo>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/base_dyn_manager.hh"
@@ -49,61 +52,32 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
-/**
- * Accumulate forces acting on a vehicle.
- *
- * \param[in] vec Forces
- * \param[out] cumulation Accumulated force
- **/
-static inline void
-accumulate_forces (
-   const JeodPointerVector<CollectForce>::type & vec,
-   double * cumulation)
-{
-   unsigned int nitems = vec.size();
-
-   Vector3::initialize (cumulation);
-   for (unsigned int ii = 0; ii < nitems; ii++) {
-      if (vec[ii]->is_active()) {
-         Vector3::incr (vec[ii]->force, cumulation);
-      }
-   }
-}
-
+namespace {
 
 /**
- * Accumulate torques acting on a vehicle.
+ * Accumulate the forces and torques that act directly on a flat body of a
+ * collection plan.
  *
- * \param[in] vec Torques
- * \param[out] cumulation Accumulated torque
+ * \param[in] plan Collection plan
+ * \param[in] node The body's node in the plan
  **/
-static inline void
-accumulate_torques (
-   const JeodPointerVector<CollectTorque>::type & vec,
-   double * cumulation)
-{
-   unsigned int nitems = vec.size();
-
-   Vector3::initialize (cumulation);
-   for (unsigned int ii = 0; ii < nitems; ii++) {
-      if (vec[ii]->is_active()) {
-         Vector3::incr (vec[ii]->torque, cumulation);
-      }
-   }
-}
-
-
-// Collect forces and torques acting on the vehicle.
 void
-DynBody::collect_forces_and_torques ()
+collect_local_forces_and_torques (
+   const BodyCollectPlan & plan,
+   const BodyCollectPlan::Node & node)
 {
+   DynBody & body = *(node.body);
+   BodyForceCollect & collect = body.collect;
 
    // Translational dynamics on: Accumulate the external forces on this DynBody.
-   if (translational_dynamics) {
-
-      accumulate_forces (collect.collect_effector_forc, collect.effector_forc);
-      accumulate_forces (collect.collect_environ_forc, collect.environ_forc);
-      accumulate_forces (collect.collect_no_xmit_forc, collect.no_xmit_forc);
+   if (body.translational_dynamics) {
+
+      plan.accumulate (node, BodyCollectPlan::EffectorForce,
+                       collect.effector_forc);
+      plan.accumulate (node, BodyCollectPlan::EnvironForce,
+                       collect.environ_forc);
+      plan.accumulate (node, BodyCollectPlan::NoXmitForce,
+                       collect.no_xmit_forc);
    }
 
    // Translational dynamics off: Zero-out force accumulators.
@@ -116,11 +90,14 @@ DynBody::collect_forces_and_torques ()
 
 
    // Rotational dynamics on: Accumulate the external torques on this DynBody.
-   if (rotational_dynamics) {
-
-      accumulate_torques (collect.collect_effector_torq, collect.effector_torq);
-      accumulate_torques (collect.collect_environ_torq, collect.environ_torq);
-      accumulate_torques (collect.collect_no_xmit_torq, collect.no_xmit_torq);
+   if (body.rotational_dynamics) {
+
+      plan.accumulate (node, BodyCollectPlan::EffectorTorque,
+                       collect.effector_torq);
+      plan.accumulate (node, BodyCollectPlan::EnvironTorque,
+                       collect.environ_torq);
+      plan.accumulate (node, BodyCollectPlan::NoXmitTorque,
+                       collect.no_xmit_torq);
    }
 
    // Rotational dynamics off: Zero-out torque accumulators.
@@ -131,191 +108,324 @@ DynBody::collect_forces_and_torques ()
       Vector3::initialize (collect.no_xmit_torq);
    }
 
+   // Add the forces and torques pushed onto this DynBody.
+   body.wrench_buffer.reduce (body.translational_dynamics,
+                              body.rotational_dynamics,
+                              collect);
+}
+
+}
+
+
+// Push a wrench onto the wrench buffer.
+void
+DynBody::push_wrench (
+   BodyWrenchBuffer::Category category,
+   const Wrench & wrench,
+   unsigned int slot)
+{
+   wrench_buffer.add_wrench (category, wrench,
+                             mass.composite_properties.position, slot);
+}
 
-   // Collect forces and torques on attached bodies and add them to the
-   // force and torque collections for this body.
+
+// Mark the collection plans of this body and its ancestors as stale.
+void
+DynBody::invalidate_collect_plans ()
+{
+   for (DynBody * body = this; body != nullptr; body = body->dyn_parent) {
+      body->collect_plan.invalidate ();
+   }
+}
+
+
+// Is the force and torque collection plan up to date?
+bool
+DynBody::collect_plan_is_current ()
+const
+{
+   if (! collect_plan.valid) {
+      return false;
+   }
+
+   unsigned int nnodes = collect_plan.nodes.size();
+   for (unsigned int ii = 0; ii < nnodes; ++ii) {
+      const BodyCollectPlan::Node & node = collect_plan.nodes[ii];
+      if (! collect_plan.sizes_match (node, node.body->collect)) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+
+// Rebuild the force and torque collection plan.
+void
+DynBody::build_collect_plan ()
+{
+   collect_plan.clear ();
+   append_collect_nodes (collect_plan);
+   collect_plan.valid = true;
+}
+
+
+// Append this body's subtree to a collection plan.
+void
+DynBody::append_collect_nodes (
+   BodyCollectPlan & plan)
+{
    for (std::list<DynBody *>::iterator it = dyn_children.begin();
         it != dyn_children.end();
         ++it) {
       DynBody * child = *it;
-      child->collect_forces_and_torques ();
+
+      // Children whose collection has been specialized by a derived class
+      // are collected by calling their collect_forces_and_torques method,
+      // which handles their own subtrees.
+      if (typeid (*child) == typeid (DynBody)) {
+         child->append_collect_nodes (plan);
+      }
+      else {
+         plan.add_node (*child, false, child->collect);
+      }
+   }
+
+   plan.add_node (*this, true, collect);
+}
+
+
+// Collect forces and torques acting on the vehicle.
+void
+DynBody::collect_forces_and_torques ()
+{
+   if (! collect_plan_is_current ()) {
+      build_collect_plan ();
+   }
+
+   unsigned int nnodes = collect_plan.nodes.size();
+
+   // Accumulate the forces and torques acting directly on each body in the
+   // tree rooted at this body.
+   for (unsigned int ii = 0; ii < nnodes; ++ii) {
+      const BodyCollectPlan::Node & node = collect_plan.nodes[ii];
+      if (node.flat) {
+         collect_local_forces_and_torques (collect_plan, node);
+      }
+   }
+
+   // Transmit the child bodies' forces and torques to their parents,
+   // children before parents. This body is the last node.
+   for (unsigned int ii = 0; ii + 1 < nnodes; ++ii) {
+      const BodyCollectPlan::Node & node = collect_plan.nodes[ii];
+      if (node.flat) {
+         node.body->transmit_forces_and_torques ();
+      }
+      else {
+         node.body->collect_forces_and_torques ();
+      }
    }
 
 
    // At this point forces and torques have been accumulated with the body
-   // and the method will have been recursively invoked on all child bodies.
+   // and with all child bodies.
    // The remaining actions depend on whether this body is a child body
    // or a root body.
 
    // Child body: Propagate forces, torques to the parent body.
    if (dyn_parent != nullptr) {
-      double effector_forc_pstr[3];
-      double environ_forc_pstr[3];
-
-      // Translational dynamics is on:
-      // Transmit forces to the parent (but in the parent's structural frame).
-      if (translational_dynamics) {
-
-         // Transform transmittable forces to parent structural.
-         // The inherited (Mass) structure_point object provides the
-         // transformation from parent structural to child structural.
-         // The transpose is needed to transform from child to parent.
-         Vector3::transform_transpose (
-            mass.structure_point.T_parent_this, collect.effector_forc,
-            effector_forc_pstr);
-         Vector3::transform_transpose (
-            mass.structure_point.T_parent_this, collect.environ_forc,
-            environ_forc_pstr);
-
-         // Transmit these forces to the parent dyn body.
-         Vector3::incr (effector_forc_pstr,
-                        dyn_parent->collect.effector_forc);
-         Vector3::incr (environ_forc_pstr,
-                        dyn_parent->collect.environ_forc);
-      }
+      transmit_forces_and_torques ();
+   }
 
-      // Translational dynamics is off:
-      // Zero out the transmitted forces as these become torques in the parent.
-      else {
-         Vector3::initialize (effector_forc_pstr);
-         Vector3::initialize (environ_forc_pstr);
+   // Root body: Compute total forces and torques and resultant accelerations.
+   else {
+      if (dynamics_kernel_mode != get_dynamics_mode ()) {
+         select_dynamics_kernels ();
       }
+      (this->*root_derivative_kernel) ();
+   }
 
-      // Rotational dynamics is on:
-      // Transmit torques to the parent (but in the parent's structural frame).
-      if (rotational_dynamics) {
-         double effector_torq_pstr[3];
-         double environ_torq_pstr[3];
-         double pcm_to_ccm[3];
-
-         // Transform transmittable torques to parent structural.
-         Vector3::transform_transpose (
-            mass.structure_point.T_parent_this, collect.effector_torq,
-            effector_torq_pstr);
-         Vector3::transform_transpose (
-            mass.structure_point.T_parent_this, collect.environ_torq,
-            environ_torq_pstr);
-
-         // Compute the parent cm to child cm offset in parent structural.
-         Vector3::diff (mass.composite_wrt_pstr.position,
-                        dyn_parent->mass.composite_properties.position,
-                        pcm_to_ccm);
-
-         // Compute the torque contributions of the child forces.
-         Vector3::cross_incr (pcm_to_ccm, effector_forc_pstr,
-                              effector_torq_pstr);
-         Vector3::cross_incr (pcm_to_ccm, environ_forc_pstr,
-                              environ_torq_pstr);
-
-         // Transmit the torques to the parent dyn body.
-         Vector3::incr (effector_torq_pstr,
-                        dyn_parent->collect.effector_torq);
-         Vector3::incr (environ_torq_pstr,
-                        dyn_parent->collect.environ_torq);
-      }
+   return;
+}
 
-      // There is nothing to do here if rotational dynamics is off.
-      else {
-      }
 
-      //If requested, compute child body pt derivatives
-      if (compute_point_derivative) {
-         compute_vehicle_point_derivatives (composite_body,
-                                            derivs);
-      }
+// Compute a root body's total forces and torques and the resulting
+// accelerations. The dynamics settings are template parameters so that each
+// instantiation is free of the settings tests.
+template <bool translation, bool rotation>
+void
+DynBody::compute_root_derivatives ()
+{
+   // Translational dynamics is on:
+   // Compute total force on the body, structural and inertial referenced,
+   // and from this, compute translational accelerations.
+   // Note: The gravitational acceleration must have already been computed.
+   if (translation) {
+
+      // Compute the total force, structural referenced.
+      Vector3::sum (collect.effector_forc,
+                    collect.environ_forc,
+                    collect.no_xmit_forc,
+                    collect.extern_forc_struct);
+
+      // Transform the total external force to inertial.
+      // The structure member provides the transformation from inertial to
+      // structural. The transpose is needed to transform to inertial.
+      Vector3::transform_transpose (structure.state.rot.T_parent_this,
+                                    collect.extern_forc_struct,
+                                    collect.extern_forc_inrtl);
+
+      // Compute the translational acceleration.
+      Vector3::scale (collect.extern_forc_inrtl, mass.composite_properties.inverse_mass,
+                      derivs.non_grav_accel);
+      Vector3::sum (derivs.non_grav_accel,
+                    grav_interaction.grav_accel,
+                    derivs.trans_accel);
    }
 
-   // Root body: Compute total forces and torques and resultant accelerations.
+   // Translational dynamics is off:
+   // Zero out the collected forces and the translational accelerations.
    else {
 
-      // Translational dynamics is on:
-      // Compute total force on the body, structural and inertial referenced,
-      // and from this, compute translational accelerations.
-      // Note: The gravitational acceleration must have already been computed.
-      if (translational_dynamics) {
-
-         // Compute the total force, structural referenced.
-         Vector3::sum (collect.effector_forc,
-                       collect.environ_forc,
-                       collect.no_xmit_forc,
-                       collect.extern_forc_struct);
-
-         // Transform the total external force to inertial.
-         // The structure member provides the transformation from inertial to
-         // structural. The transpose is needed to transform to inertial.
-         Vector3::transform_transpose (structure.state.rot.T_parent_this,
-                                       collect.extern_forc_struct,
-                                       collect.extern_forc_inrtl);
-
-         // Compute the translational acceleration.
-         Vector3::scale (collect.extern_forc_inrtl, mass.composite_properties.inverse_mass,
-                         derivs.non_grav_accel);
-         Vector3::sum (derivs.non_grav_accel,
-                       grav_interaction.grav_accel,
-                       derivs.trans_accel);
-      }
+      Vector3::initialize (collect.extern_forc_struct);
+      Vector3::initialize (collect.extern_forc_inrtl);
+      Vector3::initialize (derivs.non_grav_accel);
+      Vector3::initialize (derivs.trans_accel);
+   }
 
-      // Translational dynamics is off:
-      // Zero out the collected forces and the translational accelerations.
-      else {
+   // Rotational dynamics is on:
+   if (rotation) {
+      double ang_mom[3];     // kg*M^2/s    Angular momentum, body referenced
+      double torque_body[3]; // kg*M^2/s^2  Total torque, body referenced
+
+      // Compute the total torque, structural referenced.
+      Vector3::sum (collect.effector_torq,
+                    collect.environ_torq,
+                    collect.no_xmit_torq,
+                    collect.extern_torq_struct);
+
+      // Transform the structural reference torque to body.
+      // The inherited (Mass) composite_properties member provides the
+      // transformation from structure to body.
+      Vector3::transform (mass.composite_properties.T_parent_this,
+                          collect.extern_torq_struct,
+                          collect.extern_torq_body);
+
+      // Compute the inertial torque, w x L, where w is the body-referenced
+      // angular velocity and L is the body-referenced angular momentum.
+      Vector3::transform (mass.composite_properties.inertia,
+                          composite_body.state.rot.ang_vel_this,
+                          ang_mom);
+      Vector3::cross (composite_body.state.rot.ang_vel_this, ang_mom,
+                      collect.inertial_torq);
+
+      // Subtract from the external torque to form the body-frame
+      // apparent torque.
+      Vector3::diff (collect.extern_torq_body, collect.inertial_torq,
+                     torque_body);
+
+      // Solve the rotational EOM for body accelerations.
+      Vector3::transform (mass.composite_properties.inverse_inertia, torque_body, derivs.rot_accel);
+
+      // Truncate small rotational accelerations to avoid numerical problems.
+      Vector3::zero_small (1e-20, derivs.rot_accel);
+   }
 
-         Vector3::initialize (collect.extern_forc_struct);
-         Vector3::initialize (collect.extern_forc_inrtl);
-         Vector3::initialize (derivs.non_grav_accel);
-         Vector3::initialize (derivs.trans_accel);
-      }
+   // Rotational dynamics is off:
+   // Zero out the collected torques and the rotational acceleration.
+   else {
 
-      // Rotational dynamics is on:
-      if (rotational_dynamics) {
-         double ang_mom[3];     // kg*M^2/s    Angular momentum, body referenced
-         double torque_body[3]; // kg*M^2/s^2  Total torque, body referenced
-
-         // Compute the total torque, structural referenced.
-         Vector3::sum (collect.effector_torq,
-                       collect.environ_torq,
-                       collect.no_xmit_torq,
-                       collect.extern_torq_struct);
-
-         // Transform the structural reference torque to body.
-         // The inherited (Mass) composite_properties member provides the
-         // transformation from structure to body.
-         Vector3::transform (mass.composite_properties.T_parent_this,
-                             collect.extern_torq_struct,
-                             collect.extern_torq_body);
-
-         // Compute the inertial torque, w x L, where w is the body-referenced
-         // angular velocity and L is the body-referenced angular momentum.
-         Vector3::transform (mass.composite_properties.inertia,
-                             composite_body.state.rot.ang_vel_this,
-                             ang_mom);
-         Vector3::cross (composite_body.state.rot.ang_vel_this, ang_mom,
-                         collect.inertial_torq);
-
-         // Subtract from the external torque to form the body-frame
-         // apparent torque.
-         Vector3::diff (collect.extern_torq_body, collect.inertial_torq,
-                        torque_body);
-
-         // Solve the rotational EOM for body accelerations.
-         Vector3::transform (mass.composite_properties.inverse_inertia, torque_body, derivs.rot_accel);
-
-         // Truncate small rotational accelerations to avoid numerical problems.
-         Vector3::zero_small (1e-20, derivs.rot_accel);
-      }
+      Vector3::initialize (collect.extern_torq_struct);
+      Vector3::initialize (collect.extern_torq_body);
+      Vector3::initialize (collect.inertial_torq);
+      Vector3::initialize (derivs.rot_accel);
+   }
+}
 
-      // Rotational dynamics is off:
-      // Zero out the collected torques and the rotational acceleration.
-      else {
+template void DynBody::compute_root_derivatives<false, false> ();
+template void DynBody::compute_root_derivatives<true, false> ();
+template void DynBody::compute_root_derivatives<false, true> ();
+template void DynBody::compute_root_derivatives<true, true> ();
 
-         Vector3::initialize (collect.extern_torq_struct);
-         Vector3::initialize (collect.extern_torq_body);
-         Vector3::initialize (collect.inertial_torq);
-         Vector3::initialize (derivs.rot_accel);
-      }
 
+// Transmit a child body's forces and torques to its parent.
+void
+DynBody::transmit_forces_and_torques ()
+{
+   double effector_forc_pstr[3];
+   double environ_forc_pstr[3];
+
+   // Translational dynamics is on:
+   // Transmit forces to the parent (but in the parent's structural frame).
+   if (translational_dynamics) {
+
+      // Transform transmittable forces to parent structural.
+      // The inherited (Mass) structure_point object provides the
+      // transformation from parent structural to child structural.
+      // The transpose is needed to transform from child to parent.
+      Vector3::transform_transpose (
+         mass.structure_point.T_parent_this, collect.effector_forc,
+         effector_forc_pstr);
+      Vector3::transform_transpose (
+         mass.structure_point.T_parent_this, collect.environ_forc,
+         environ_forc_pstr);
+
+      // Transmit these forces to the parent dyn body.
+      Vector3::incr (effector_forc_pstr,
+                     dyn_parent->collect.effector_forc);
+      Vector3::incr (environ_forc_pstr,
+                     dyn_parent->collect.environ_forc);
    }
 
-   return;
+   // Translational dynamics is off:
+   // Zero out the transmitted forces as these become torques in the parent.
+   else {
+      Vector3::initialize (effector_forc_pstr);
+      Vector3::initialize (environ_forc_pstr);
+   }
+
+   // Rotational dynamics is on:
+   // Transmit torques to the parent (but in the parent's structural frame).
+   if (rotational_dynamics) {
+      double effector_torq_pstr[3];
+      double environ_torq_pstr[3];
+      double pcm_to_ccm[3];
+
+      // Transform transmittable torques to parent structural.
+      Vector3::transform_transpose (
+         mass.structure_point.T_parent_this, collect.effector_torq,
+         effector_torq_pstr);
+      Vector3::transform_transpose (
+         mass.structure_point.T_parent_this, collect.environ_torq,
+         environ_torq_pstr);
+
+      // Compute the parent cm to child cm offset in parent structural.
+      Vector3::diff (mass.composite_wrt_pstr.position,
+                     dyn_parent->mass.composite_properties.position,
+                     pcm_to_ccm);
+
+      // Compute the torque contributions of the child forces.
+      Vector3::cross_incr (pcm_to_ccm, effector_forc_pstr,
+                           effector_torq_pstr);
+      Vector3::cross_incr (pcm_to_ccm, environ_forc_pstr,
+                           environ_torq_pstr);
+
+      // Transmit the torques to the parent dyn body.
+      Vector3::incr (effector_torq_pstr,
+                     dyn_parent->collect.effector_torq);
+      Vector3::incr (environ_torq_pstr,
+                     dyn_parent->collect.environ_torq);
+   }
+
+   // There is nothing to do here if rotational dynamics is off.
+   else {
+   }
+
+   //If requested, compute child body pt derivatives
+   if (compute_point_derivative) {
+      compute_vehicle_point_derivatives (composite_body,
+                                         derivs);
+   }
 }
 
 } // End JEOD namespace
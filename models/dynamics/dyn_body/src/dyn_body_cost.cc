@@ -0,0 +1,136 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/dyn_body_cost.cc
+ * Define member functions for the DynBodyCost class.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((dyn_body_cost.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
+
+
+
+*******************************************************************************/
+
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_profiler.hh"
+
+// Model includes
+#include "../include/dyn_body_cost.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * DynBodyCost constructor.
+ */
+DynBodyCost::DynBodyCost ()
+:
+   active(false)
+{
+   reset ();
+}
+
+
+/**
+ * Start timing.
+ * @return Current wall-clock time if active, zero otherwise.
+ */
+double
+DynBodyCost::begin ()
+const
+{
+   return active ? wall_time () : 0.0;
+}
+
+
+/**
+ * Charge the time elapsed since begin() to a category.
+ * @param[in] category  Cost category.
+ * @param[in] start     Value returned by begin().
+ */
+void
+DynBodyCost::end (
+   Category category,
+   double start)
+{
+   if (active) {
+      time[category] += wall_time () - start;
+   }
+}
+
+
+/**
+ * Charge a time to a category.
+ * @param[in] category  Cost category.
+ * @param[in] elapsed   Wall-clock time, in seconds.
+ */
+void
+DynBodyCost::add (
+   Category category,
+   double elapsed)
+{
+   if (active) {
+      time[category] += elapsed;
+   }
+}
+
+
+/**
+ * Zero the accumulated times.
+ */
+void
+DynBodyCost::reset ()
+{
+   for (unsigned int ii = 0; ii < NumCategories; ++ii) {
+      time[ii] = 0.0;
+   }
+}
+
+
+/**
+ * Total accumulated time.
+ * @return Sum over all categories, in seconds.
+ */
+double
+DynBodyCost::total_time ()
+const
+{
+   double total = 0.0;
+   for (unsigned int ii = 0; ii < NumCategories; ++ii) {
+      total += time[ii];
+   }
+   return total;
+}
+
+
+/**
+ * Current wall-clock time.
+ * @return Monotonic wall-clock time, in seconds.
+ */
+double
+DynBodyCost::wall_time ()
+{
+   return 1e-9 * static_cast<double>(JeodProfiler::now ());
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -105,6 +105,7 @@ DynBody::detach (
     {
         if (*it == detacher) {
             parent->dyn_children.erase(it);
+            parent->invalidate_collect_plans();
             break;
         }
     }
@@ -141,6 +142,7 @@ DynBody::detach ( void )
     if(frame_attach.isAttached())
     {
         frame_attach.clear_attachment();
+        frozen = false;
     }
     else if(    dyn_parent != nullptr
         && dyn_parent != this    )
@@ -254,6 +256,7 @@ void DynBody::detach_mass_body_frames( MassBody &subbody )
                             vehicle_points.end(),
                             pt_frame );
         vehicle_points.erase(veh_pt);
+        vehicle_point_batch_valid = false;
         dyn_manager->remove_ref_frame(*pt_frame);
         JEOD_DELETE_OBJECT( pt_frame );
     }
@@ -290,6 +293,7 @@ DynBody::detach_mass_internal (   // Return: -- Void
    // Update mass properties.
    child.detach_sever_links(this->mass);
    mass.detach_update_properties (child);
+   mass.get_root_body_internal()->update_mass_properties ();
 
    // Reset the dynamic state from the root body's core state.
    root_body->set_state_source_internal (RefFrameItems::Pos_Vel_Att_Rate,
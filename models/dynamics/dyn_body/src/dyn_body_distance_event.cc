@@ -0,0 +1,100 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/dyn_body_distance_event.cc
+ * Define DynBodyDistanceEvent methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((dyn_body_distance_event.cc)
+   (dyn_body.cc)
+   (utils/integration/src/integration_event.cc)
+   (utils/integration/src/jeod_integration_group.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cstddef>
+
+// Jeod includes
+#include "utils/integration/include/jeod_integration_group.hh"
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/dyn_body.hh"
+#include "../include/dyn_body_distance_event.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a DynBodyDistanceEvent.
+ */
+DynBodyDistanceEvent::DynBodyDistanceEvent (
+   void)
+:
+   IntegrationEvent(),
+   threshold(0.0),
+   body(nullptr)
+{
+   JEOD_REGISTER_CLASS (DynBodyDistanceEvent);
+}
+
+
+/**
+ * Destruct a DynBodyDistanceEvent.
+ */
+DynBodyDistanceEvent::~DynBodyDistanceEvent (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Evaluate the distance of the body's integrated frame from the origin of
+ * its integration frame, less the threshold.
+ * @return True if the body's state could be interpolated
+ * \param[in] group The group that integrates the body
+ * \param[in] dyn_time Dynamic time\n Units: s
+ * \param[out] value Distance less threshold\n Units: M
+ */
+bool
+DynBodyDistanceEvent::evaluate_guard (
+   const JeodIntegrationGroup & group,
+   double dyn_time,
+   double & value)
+{
+   double velocity[3];
+   double position[3];
+
+   if ((body == nullptr) ||
+       (! group.interpolate_state (*body, dyn_time, velocity, position))) {
+      return false;
+   }
+
+   value = Vector3::vmag (position) - threshold;
+   return true;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
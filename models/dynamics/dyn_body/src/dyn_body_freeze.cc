@@ -0,0 +1,141 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/dyn_body_freeze.cc
+ * Define DynBody methods that freeze and wake a body.
+ */
+
+/*******************************************************************************
+
+Purpose:
+   ()
+
+Library dependencies:
+  ((dyn_body_freeze.cc)
+   (dyn_body.cc)
+   (dyn_body_attach.cc)
+   (dynamics/dyn_manager/src/dyn_manager.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+
+// Model includes
+#include "../include/dyn_body.hh"
+#include "../include/dyn_body_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Freeze this body in place with respect to the named reference frame.
+ * See DynBody::freeze(RefFrame &).
+ * @return Success indicator: true=success, false=body not frozen.
+ * \param[in] parent_ref_frame_name Name of the frame to freeze to.
+ */
+bool
+DynBody::freeze (
+   const char * parent_ref_frame_name)
+{
+   RefFrame * parent_ref_frame =
+      dyn_manager->find_ref_frame (parent_ref_frame_name);
+
+   if (parent_ref_frame == nullptr) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, DynBodyMessages::invalid_attachment,
+         "Unable to find RefFrame '%s'.\n"
+         "DynBody '%s' was not frozen.\n",
+         parent_ref_frame_name, name.c_str());
+      return false;
+   }
+
+   return freeze (*parent_ref_frame);
+}
+
+
+/**
+ * Freeze this body in place with respect to a reference frame, e.g., a
+ * planet-fixed frame for a landed vehicle or another vehicle's structural
+ * frame for a docked but unattached payload. The body is kinematically
+ * attached to the frame at its current relative state. While frozen, the
+ * body's state is composed from the frame's state each integration stage,
+ * and the body's integration group neither computes its gravitational
+ * acceleration nor collects its forces and torques.
+ * \par Assumptions and Limitations
+ *  - Only a root body can be frozen. A frozen body's children are carried
+ *    along with it.
+ * @return Success indicator: true=success, false=body not frozen.
+ * \param[in] parent The frame to freeze to.
+ */
+bool
+DynBody::freeze (
+   RefFrame & parent)
+{
+   if (dyn_parent != nullptr) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, DynBodyMessages::invalid_attachment,
+         "DynBody '%s' is attached to '%s'; only a root body can be frozen.\n"
+         "DynBody '%s' was not frozen.\n",
+         name.c_str(), dyn_parent->name.c_str(), name.c_str());
+      return false;
+   }
+
+   attach_to_frame (parent);
+   frozen = true;
+
+   // The recorded step no longer describes the body's motion.
+   trans_dense_output.reset ();
+
+   return true;
+}
+
+
+/**
+ * Release a frozen body. The body keeps the state it last had as a frozen
+ * body, including the velocity it inherits from the frame, and its state
+ * is integrated from there on. The body's integrators are reset as their
+ * history predates the freeze.
+ * @return Success indicator: true=success, false=body was not frozen.
+ */
+bool
+DynBody::wake (
+   void)
+{
+   if (! is_frozen()) {
+      MessageHandler::inform (
+         __FILE__, __LINE__, DynBodyMessages::invalid_request,
+         "DynBody '%s' is not frozen. No action taken.\n",
+         name.c_str());
+      return false;
+   }
+
+   frame_attach.clear_attachment ();
+   frozen = false;
+   reset_integrators ();
+
+   return true;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
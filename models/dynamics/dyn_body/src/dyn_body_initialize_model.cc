@@ -120,6 +120,9 @@ DynBody::initialize_model (
    // Note that this links each of the three primary frames as children of
    // the integration frame.
    set_integ_frame (integ_frame_name);
+
+   // Select the derivative and integration kernels for the dynamics settings.
+   select_dynamics_kernels ();
 }
 
 } // End JEOD namespace
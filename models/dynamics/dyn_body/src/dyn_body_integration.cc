@@ -22,7 +22,8 @@ Library dependencies:
    (environment/gravity/src/gravity_interaction.cc)
    (utils/ref_frames/src/ref_frame.cc)
    (utils/integration/src/jeod_integration_time.cc)
-   (utils/integration/src/generalized_second_order_ode_technique.cc))
+   (utils/integration/src/generalized_second_order_ode_technique.cc)
+   (utils/integration/src/second_order_dense_output.cc))
 
 
 
@@ -30,6 +31,7 @@ Library dependencies:
 
 
 // System includes
+#include <cmath>
 #include <cstddef>
 
 // ER7 utilities includes
@@ -46,6 +48,8 @@ Library dependencies:
 #include "utils/named_item/include/named_item.hh"
 #include "utils/integration/include/jeod_integration_time.hh"
 #include "utils/integration/include/generalized_second_order_ode_technique.hh"
+#include "utils/integration/include/dense_output_interpolator.hh"
+#include "utils/integration/include/step_error_estimator.hh"
 
 // Model includes
 #include "../include/dyn_body.hh"
@@ -79,7 +83,7 @@ DynBody::set_integ_frame (                // Return: -- Void
    // Body has an existing integration frame:
    // Free resources (unsubscribe), re-link the primary frames and the
    // registered vehicle points to the new integration frame, and
-   // reset the integrators.
+   // reset the integrators (or rebase them, if so configured).
    // NOTE WELL: This uses the low-level reset_parent(). It does not
    // update state.
    else {
@@ -95,7 +99,9 @@ DynBody::set_integ_frame (                // Return: -- Void
          point->reset_parent (new_integ_frame);
       }
 
-      get_dynamics_integration_group()->reset_integrators();
+      if (! (preserve_integ_history && rebase_integrators())) {
+         get_dynamics_integration_group()->reset_integrators();
+      }
    }
 
 
@@ -301,6 +307,50 @@ DynBody::reset_integrators (
    if (rotational_dynamics) {
       rot_integrator.reset_integrator();
    }
+   trans_dense_output.reset ();
+}
+
+
+/**
+ * Ask the translational integrator to carry its history across a small
+ * discontinuity in the translational state, such as that caused by a switch
+ * between integration frames or by an impulsive maneuver, rather than
+ * restarting from scratch. The history is re-expressed in terms of the state
+ * and acceleration at the start of the next integration step.
+ * The rotational state is not affected by switches between integration
+ * frames and its integrator is left as is.
+ * @return True if the integrator will rebase its history (or if this body's
+ *         state is integrated by its root body); false if the integrators
+ *         need to be reset instead.
+ */
+bool
+DynBody::rebase_integrators (
+   void)
+{
+   // A child body's state is integrated by the root body.
+   if (! is_root_body()) {
+      return true;
+   }
+
+   // Nothing to rebase if translation is not integrated.
+   if (! translational_dynamics) {
+      return true;
+   }
+
+   // The batched translational integrator is shared by several bodies.
+   DynamicsIntegrationGroup * group = get_dynamics_integration_group();
+   if ((group != nullptr) && group->batch_translation) {
+      return false;
+   }
+
+   if (! trans_integrator.rebase_integrator()) {
+      return false;
+   }
+
+   // The recorded step no longer describes the current state.
+   trans_dense_output.reset ();
+
+   return true;
 }
 
 
@@ -317,23 +367,190 @@ DynBody::integrate (
    double dyn_dt,
    unsigned int target_stage)
 {
-   er7_utils::IntegratorResult status (false);
+   return integrate_state (dyn_dt, target_stage, true);
+}
 
-   if(!frame_attach.isAttached()) {
 
-      // Integrate the translational state if enabled to do so.
-      if (translational_dynamics) {
-         integ_results_merger.merge_integrator_result (
-            trans_integ (dyn_dt, target_stage),
-            status);
-      }
+/**
+ * Integrate the rotational state and propagate the integrated state to
+ * derived states. The caller is responsible for the translational state.
+ * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
+ * @param[in]     target_stage  The stage of the integration process
+ *                              that the integrator should try to attain.
+ * @return The status (time advance, pass/fail status) of the integration.
+ */
+er7_utils::IntegratorResult
+DynBody::integrate_non_translational (
+   double dyn_dt,
+   unsigned int target_stage)
+{
+   return integrate_state (dyn_dt, target_stage, false);
+}
+
+
+/**
+ * Get the arrays that DynBody::trans_integ integrates.
+ * @param[out] accel     Translational acceleration.
+ * @param[out] velocity  Integrated velocity.
+ * @param[out] position  Integrated position.
+ * @return True if the translational state is currently integrated.
+ */
+bool
+DynBody::get_trans_integ_state (
+   double const * & accel,
+   double * & velocity,
+   double * & position)
+{
+   accel = derivs.trans_accel;
+   velocity = composite_body.state.trans.velocity;
+   position = composite_body.state.trans.position;
+   return translational_dynamics && (! frame_attach.isAttached());
+}
+
+
+/**
+ * Record the translational state at the start of an integration step.
+ * The translational acceleration must be current.
+ * @param[in] dyn_time                 Dynamic time, in seconds.
+ * @param[in] use_natural_interpolant  Is the state integrated by this body's
+ *                                     translational integrator?
+ */
+void
+DynBody::begin_trans_dense_output (
+   double dyn_time,
+   bool use_natural_interpolant)
+{
+   double const * accel;
+   double * velocity;
+   double * position;
+
+   if (get_trans_integ_state (accel, velocity, position)) {
+      trans_dense_output.begin_step (dyn_time, accel, velocity, position);
+      trans_dense_natural = use_natural_interpolant;
+   }
+   else {
+      trans_dense_output.reset ();
+   }
+}
+
+
+/**
+ * Record the translational state at the end of an integration step.
+ * @param[in] dyn_time  Dynamic time, in seconds.
+ */
+void
+DynBody::end_trans_dense_output (
+   double dyn_time)
+{
+   double const * accel;
+   double * velocity;
+   double * position;
+
+   if (get_trans_integ_state (accel, velocity, position)) {
+      trans_dense_output.end_step (dyn_time, velocity, position);
+   }
+   else {
+      trans_dense_output.reset ();
+   }
+}
+
+
+/**
+ * Discard the recorded translational dense output.
+ */
+void
+DynBody::reset_trans_dense_output (
+   void)
+{
+   trans_dense_output.reset ();
+}
+
+
+/**
+ * Interpolate the translational state within the most recent step.
+ * @param[in]  dyn_time  Dynamic time, in seconds.
+ * @param[out] velocity  Interpolated velocity.
+ * @param[out] position  Interpolated position.
+ * @return True if dyn_time is within the recorded step.
+ */
+bool
+DynBody::interpolate_trans_state (
+   double dyn_time,
+   double * velocity,
+   double * position)
+const
+{
+   const DenseOutputInterpolator * interpolator = nullptr;
+   if (trans_dense_natural) {
+      interpolator = dynamic_cast<const DenseOutputInterpolator *> (
+                        trans_integrator.get_integrator());
+   }
+   return trans_dense_output.interpolate (
+             dyn_time, interpolator, velocity, position);
+}
+
+
+/**
+ * Get the translational integrator's error estimate for the most recent step.
+ * @return Error estimate normalized so that one means at tolerance,
+ *         or zero if the integrator does not provide one.
+ */
+double
+DynBody::get_trans_step_error (
+   void)
+const
+{
+   const StepErrorEstimator * estimator =
+      dynamic_cast<const StepErrorEstimator *> (
+         trans_integrator.get_integrator());
+   return (estimator != nullptr) ? estimator->get_step_error() : 0.0;
+}
+
+
+/**
+ * Get the step size asked for by the body's Sundman time transformation,
+ * c*r^alpha evaluated at the body's current distance from the origin of its
+ * integration frame.
+ * @return Step size, in seconds, or zero if the transformation is disabled
+ *         or the translational state is not integrated.
+ */
+double
+DynBody::get_sundman_step (
+   void)
+const
+{
+   if ((sundman_step_scale <= 0.0) || (! translational_dynamics)) {
+      return 0.0;
+   }
+
+   double radius = Vector3::vmag (composite_body.state.trans.position);
+   return sundman_step_scale * std::pow (radius, sundman_exponent);
+}
+
+
+/**
+ * Integrate the state and propagate the integrated state to derived states.
+ * @param[in]     dyn_dt               Dynamic time step.
+ * @param[in]     target_stage         The stage of the integration process
+ *                                     that the integrator should attain.
+ * @param[in]     include_translation  Integrate the translational state?
+ * @return The status (time advance, pass/fail status) of the integration.
+ */
+er7_utils::IntegratorResult
+DynBody::integrate_state (
+   double dyn_dt,
+   unsigned int target_stage,
+   bool include_translation)
+{
+   er7_utils::IntegratorResult status (false);
+   double start = cost.begin ();
 
-      // Integrate the rotational state if enabled to do so.
-      if (rotational_dynamics) {
-         integ_results_merger.merge_integrator_result (
-            rot_integ (dyn_dt, target_stage),
-            status);
+   if(!frame_attach.isAttached()) {
+      if (dynamics_kernel_mode != get_dynamics_mode ()) {
+         select_dynamics_kernels ();
       }
+      (this->*free_integration_kernel) (
+         dyn_dt, target_stage, include_translation, status);
    }
    else
    {
@@ -350,13 +567,83 @@ DynBody::integrate (
    // Mark the state as updated.
    initialized_states.set (RefFrameItems::Pos_Vel_Att_Rate);
 
+   cost.end (DynBodyCost::Integration, start);
+
    // Propagate the integrated state to other state descriptions.
+   start = cost.begin ();
    propagate_state ();
+   cost.end (DynBodyCost::Propagation, start);
 
    return status;
 }
 
 
+/**
+ * Integrate the state of a body that is not attached to a frame. The dynamics
+ * settings are template parameters so that each instantiation is free of the
+ * settings tests.
+ * @param[in]     dyn_dt               Dynamic time step.
+ * @param[in]     target_stage         The stage of the integration process
+ *                                     that the integrator should attain.
+ * @param[in]     include_translation  Integrate the translational state?
+ * @param[in,out] status               Merged integration status.
+ */
+template <bool translation, bool rotation>
+void
+DynBody::integrate_free_state (
+   double dyn_dt,
+   unsigned int target_stage,
+   bool include_translation,
+   er7_utils::IntegratorResult & status)
+{
+   // Integrate the translational state if enabled to do so.
+   if (translation && include_translation) {
+      integ_results_merger.merge_integrator_result (
+         trans_integ (dyn_dt, target_stage),
+         status);
+   }
+
+   // Integrate the rotational state if enabled to do so.
+   if (rotation) {
+      integ_results_merger.merge_integrator_result (
+         rot_integ (dyn_dt, target_stage),
+         status);
+   }
+}
+
+
+/**
+ * Select the derivative and integration kernels that match the body's
+ * translational and rotational dynamics settings. Selecting once replaces
+ * the per-call settings tests with a single comparison of the settings code.
+ */
+void
+DynBody::select_dynamics_kernels (
+   void)
+{
+   dynamics_kernel_mode = get_dynamics_mode ();
+
+   switch (dynamics_kernel_mode) {
+   case 0:
+      root_derivative_kernel = &DynBody::compute_root_derivatives<false, false>;
+      free_integration_kernel = &DynBody::integrate_free_state<false, false>;
+      break;
+   case 1:
+      root_derivative_kernel = &DynBody::compute_root_derivatives<true, false>;
+      free_integration_kernel = &DynBody::integrate_free_state<true, false>;
+      break;
+   case 2:
+      root_derivative_kernel = &DynBody::compute_root_derivatives<false, true>;
+      free_integration_kernel = &DynBody::integrate_free_state<false, true>;
+      break;
+   default:
+      root_derivative_kernel = &DynBody::compute_root_derivatives<true, true>;
+      free_integration_kernel = &DynBody::integrate_free_state<true, true>;
+      break;
+   }
+}
+
+
 /**
  * Integrate the translational state of a DynBody.
  * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
@@ -398,16 +685,11 @@ DynBody::rot_integ (
          derivs.rot_accel,
          rot_state.ang_vel_this, rot_state.Q_parent_this);
 
-   // Normalize the integrated quaternion.
-   rot_state.Q_parent_this.normalize_integ ();
-
-   // Compute the corresponding transformation matrix.
-   rot_state.Q_parent_this.left_quat_to_transformation (
-      rot_state.T_parent_this);
-
-   // Compute the quaternion derivative.
-   rot_state.Q_parent_this.compute_left_quat_deriv (
-      rot_state.ang_vel_this, derivs.Qdot_parent_this);
+   // Normalize the integrated quaternion and compute the corresponding
+   // transformation matrix and quaternion derivative.
+   rot_state.Q_parent_this.normalize_integ_transform_deriv (
+      rot_state.ang_vel_this, rot_state.T_parent_this,
+      derivs.Qdot_parent_this);
 
    // Compute the angular velocity magnitude and unit vector.
    rot_state.ang_vel_mag = Vector3::vmag (rot_state.ang_vel_this);
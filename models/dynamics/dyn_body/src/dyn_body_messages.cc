@@ -59,6 +59,9 @@ char const * DynBodyMessages::invalid_attachment =
 char const * DynBodyMessages::invalid_technique =
     PATH "invalid_technique";
 
+char const * DynBodyMessages::invalid_request =
+    PATH "invalid_request";
+
 char const * DynBodyMessages::not_dyn_body =
     PATH "not_dyn_body";
 
@@ -21,7 +21,8 @@ Library dependencies:
    (dyn_body_messages.cc)
    (dynamics/mass/src/mass_point_state.cc)
    (environment/time/src/time_manager.cc)
-   (utils/ref_frames/src/ref_frame.cc))
+   (utils/ref_frames/src/ref_frame.cc)
+   (utils/ref_frames/src/ref_frame_state_batch.cc))
 
 
 
@@ -785,34 +786,122 @@ DynBody::propagate_state_from_composite ()
 
 
 // Propagate structure frame state to vehicle points.
+// The points' offsets from the structural frame are kept in structure-of-
+// arrays form and composed with the structural state in one batch; the
+// results are then copied to the vehicle point frames.
+// Note: Vehicle points are body-fixed. The offsets are captured when the
+// set of points changes, not on every call.
 void
 DynBody::compute_vehicle_point_states (
    RefFrameItems::Items set_items)
 {
+   RefFrameItems items(set_items);
 
-   // Have the full state: Compute vehicle point states from structure via
-   // compute_derived_state_forward.
-   if (set_items == RefFrameItems::Pos_Vel_Att_Rate) {
-      for (std::list<BodyRefFrame *>::iterator it = vehicle_points.begin();
-           it != vehicle_points.end();
-           ++it) {
-         BodyRefFrame * point = *it;
-         compute_derived_state_forward (
-            structure, *(point->mass_point), *point);
+   // Select the points to be updated.
+   selected_vehicle_points.clear ();
+   for (auto* point : vehicle_points) {
+      if ((! update_active_vehicle_points_only) || point->is_active()) {
+         selected_vehicle_points.push_back (point);
       }
    }
 
-   // Have the partial state: Compute vehicle point states from structure via
-   // compute_state_elements_forward.
-   else {
-      for (std::list<BodyRefFrame *>::iterator it = vehicle_points.begin();
-           it != vehicle_points.end();
-           ++it) {
-         BodyRefFrame * point = *it;
-         RefFrameItems items(set_items);
-         compute_state_elements_forward (
-            structure, *(point->mass_point), items, *point);
+   if (selected_vehicle_points.empty()) {
+      return;
+   }
+
+   // Rebuild the batched offsets if the points or the selection changed.
+   if ((! vehicle_point_batch_valid) ||
+       (selected_vehicle_points != batched_vehicle_points)) {
+      RefFrameState rel_state;
+
+      batched_vehicle_points = selected_vehicle_points;
+      vehicle_point_offsets.resize (batched_vehicle_points.size());
+      for (unsigned int ii = 0; ii < batched_vehicle_points.size(); ++ii) {
+         const MassPoint & point = *(batched_vehicle_points[ii]->mass_point);
+         Vector3::copy (point.position, rel_state.trans.position);
+         rel_state.rot.Q_parent_this = point.Q_parent_this;
+         Matrix3x3::copy (point.T_parent_this, rel_state.rot.T_parent_this);
+         vehicle_point_offsets.set_state (ii, rel_state);
       }
+      vehicle_point_batch_valid = true;
+   }
+
+   // Compose the offsets with the structural state.
+   vehicle_point_states.compose_fixed (
+      vehicle_point_offsets, structure.state, set_items);
+
+   // Copy the propagated items to the vehicle point frames.
+   const double * pos[3];
+   const double * vel[3];
+   const double * q_vec[3];
+   const double * omega[3];
+   const double * omega_unit[3];
+   const double * trans[9];
+   const double * q_scalar =
+      vehicle_point_states.component (RefFrameStateBatch::QuatScalar);
+   const double * omega_mag =
+      vehicle_point_states.component (RefFrameStateBatch::AngVelMag);
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      pos[jj] = vehicle_point_states.component (
+                   RefFrameStateBatch::Position + jj);
+      vel[jj] = vehicle_point_states.component (
+                   RefFrameStateBatch::Velocity + jj);
+      q_vec[jj] = vehicle_point_states.component (
+                     RefFrameStateBatch::QuatVector + jj);
+      omega[jj] = vehicle_point_states.component (
+                     RefFrameStateBatch::AngVel + jj);
+      omega_unit[jj] = vehicle_point_states.component (
+                          RefFrameStateBatch::AngVelUnit + jj);
+   }
+   for (unsigned int jj = 0; jj < 9; ++jj) {
+      trans[jj] = vehicle_point_states.component (
+                     RefFrameStateBatch::Transform + jj);
+   }
+
+   bool set_pos = items.contains (RefFrameItems::Pos);
+   bool set_vel = items.contains (RefFrameItems::Vel);
+   bool set_att = items.contains (RefFrameItems::Att);
+   bool set_rate = items.contains (RefFrameItems::Rate);
+
+   for (unsigned int ii = 0; ii < batched_vehicle_points.size(); ++ii) {
+      BodyRefFrame & point = *(batched_vehicle_points[ii]);
+      RefFrameState & state = point.state;
+
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         if (set_pos) {
+            state.trans.position[jj] = pos[jj][ii];
+         }
+         if (set_vel) {
+            state.trans.velocity[jj] = vel[jj][ii];
+         }
+         if (set_att) {
+            state.rot.Q_parent_this.vector[jj] = q_vec[jj][ii];
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               state.rot.T_parent_this[jj][kk] = trans[3*jj+kk][ii];
+            }
+         }
+         if (set_rate) {
+            state.rot.ang_vel_this[jj] = omega[jj][ii];
+            state.rot.ang_vel_unit[jj] = omega_unit[jj][ii];
+         }
+      }
+      if (set_att) {
+         state.rot.Q_parent_this.scalar = q_scalar[ii];
+      }
+      if (set_rate) {
+         state.rot.ang_vel_mag = omega_mag[ii];
+      }
+
+      // Denote that the propagated items have been set.
+      if (set_items == RefFrameItems::Pos_Vel_Att_Rate) {
+         point.initialized_items.set (RefFrameItems::Pos_Vel_Att_Rate);
+      }
+      else {
+         point.initialized_items.add (items.get ());
+      }
+
+      // Time stamp the point per the structural frame's timestamp.
+      point.set_timestamp (structure.timestamp ());
    }
 }
 
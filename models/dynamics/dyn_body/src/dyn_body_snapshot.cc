@@ -0,0 +1,99 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/dyn_body_snapshot.cc
+ * Define DynBody::add_snapshot_regions.
+ */
+
+/*******************************************************************************
+
+Purpose:
+   ()
+
+Library dependencies:
+  ((dyn_body_snapshot.cc)
+   (dyn_body.cc)
+   (dyn_body_integration.cc)
+   (dynamics/dyn_manager/src/dynamics_integration_group.cc)
+   (utils/memory/src/state_snapshot.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
+#include "utils/memory/include/state_snapshot.hh"
+
+// Model includes
+#include "../include/dyn_body.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Register this body's mutable dynamic state with a state snapshot: its
+ * derivatives and the history of its state integrators. The body's frame
+ * states are registered by the dynamics manager along with the other
+ * reference frames, and its mass properties along with the other mass
+ * bodies.
+ *
+ * An integrator that cannot register its history (see SnapshotIntegrator)
+ * is reset when the snapshot is restored, as is the dense output, whose
+ * recorded step no longer describes the body's motion. The translational
+ * history of a body in a batched integration group is registered by the
+ * group.
+ *
+ * \par Assumptions and Limitations
+ *  - Attachments, detachments and integration frame switches made after
+ *    the snapshot is registered are not undone by a restore.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+DynBody::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   snapshot.add_item (derivs);
+
+   // Only a root body's integrators are used.
+   bool reset_trans = false;
+   bool reset_rot = false;
+   if (is_root_body()) {
+      DynamicsIntegrationGroup * group = get_dynamics_integration_group();
+      bool batched = (group != nullptr) && group->batch_translation;
+
+      if (translational_dynamics && (! batched)) {
+         reset_trans = ! trans_integrator.add_snapshot_regions (snapshot);
+      }
+      if (rotational_dynamics) {
+         reset_rot = ! rot_integrator.add_snapshot_regions (snapshot);
+      }
+   }
+
+   snapshot.add_restore_action ([this, reset_trans, reset_rot] () {
+      if (reset_trans) {
+         trans_integrator.reset_integrator ();
+      }
+      if (reset_rot) {
+         rot_integrator.reset_integrator ();
+      }
+      trans_dense_output.reset ();
+   });
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -90,6 +90,7 @@ DynBody::add_mass_point (
 
    // Add the vehicle point to the body's list of such.
    vehicle_points.push_back (point_frame);
+   vehicle_point_batch_valid = false;
 
    // Register the frame with the dynamics manager.
    dyn_manager->add_ref_frame (*point_frame);
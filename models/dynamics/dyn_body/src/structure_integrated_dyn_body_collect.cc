@@ -25,70 +25,55 @@ Library dependencies:
 #include "utils/math/include/vector3.hh"
 
 #include <cstddef>
+#include <typeinfo>
 
 
 //! Namespace jeod 
 namespace jeod {
 
-/**
- * Accumulate forces acting on a vehicle.
- *
- * \param[in] vec Forces
- * \param[out] cumulation Accumulated force
- **/
-static inline void
-accumulate_forces (
-   const JeodPointerVector<CollectForce>::type & vec,
-   double * cumulation)
-{
-   Vector3::initialize (cumulation);
-   for (auto elem : vec)
-   {
-      if (elem->is_active()) {
-         Vector3::incr (elem->force, cumulation);
-      }
-   }
-}
-
-
-/**
- * Accumulate torques acting on a vehicle.
- *
- * \param[in] vec Torques
- * \param[out] cumulation Accumulated torque
- **/
-static inline void
-accumulate_torques (
-   const JeodPointerVector<CollectTorque>::type & vec,
-   double * cumulation)
-{
-   Vector3::initialize (cumulation);
-   for (auto elem : vec)
-   {
-      if (elem->is_active()) {
-         Vector3::incr (elem->torque, cumulation);
-      }
-   }
-}
-
-
 // Collect forces and torques acting on the vehicle.
 void
 StructureIntegratedDynBody::collect_forces_and_torques ()
 {
 
-    // Collect forces and torques that directly act on this body.
-    collect_local_forces_and_torques();
+    // The plan lists this body's subtree children before parents; it is
+    // rebuilt only when the tree or the collect vectors change.
+    if (! collect_plan_is_current ())
+    {
+        build_collect_plan ();
+    }
 
-    // Collect forces and torques on attached bodies and add them to the
-    // force and torque collections for this body.
-    for (auto child : dyn_children)
+    unsigned int nnodes = collect_plan.nodes.size();
+
+    // Collect forces and torques that directly act on each body in the tree.
+    for (unsigned int ii = 0; ii < nnodes; ++ii)
     {
-        child->collect_forces_and_torques ();
+        const BodyCollectPlan::Node & node = collect_plan.nodes[ii];
+        if (node.flat)
+        {
+            static_cast<StructureIntegratedDynBody*>(node.body)->
+                collect_local_forces_and_torques (collect_plan, node);
+        }
+    }
+
+    // Propagate the attached bodies' forces and torques to their parents,
+    // children before parents. This body is the last node.
+    for (unsigned int ii = 0; ii + 1 < nnodes; ++ii)
+    {
+        const BodyCollectPlan::Node & node = collect_plan.nodes[ii];
+        if (node.flat)
+        {
+            static_cast<StructureIntegratedDynBody*>(node.body)->
+                PropagateForcesAndTorques ();
+        }
+        else
+        {
+            node.body->collect_forces_and_torques ();
+        }
     }
 
    // At this point forces and torques have been accumulated with the body
-   // and the method will have been recursively invoked on all child bodies.
+   // and with all child bodies.
    // The remaining actions depend on whether this body is a child body
    // or a root body.
 
@@ -175,9 +160,35 @@ StructureIntegratedDynBody::collect_forces_and_torques ()
 }
 
 
+// Append this body's subtree to a collection plan.
+void
+StructureIntegratedDynBody::append_collect_nodes (
+    BodyCollectPlan & plan)
+{
+    for (auto child : dyn_children)
+    {
+        // Only exact StructureIntegratedDynBody children are known to
+        // collect as this class does; others collect themselves.
+        if (typeid (*child) == typeid (StructureIntegratedDynBody))
+        {
+            static_cast<StructureIntegratedDynBody*>(child)->
+                append_collect_nodes (plan);
+        }
+        else
+        {
+            plan.add_node (*child, false, child->collect);
+        }
+    }
+
+    plan.add_node (*this, true, collect);
+}
+
+
 // Collect the local forces and torques acting on the vehicle.
 void
-StructureIntegratedDynBody::collect_local_forces_and_torques ()
+StructureIntegratedDynBody::collect_local_forces_and_torques (
+    const BodyCollectPlan & plan,
+    const BodyCollectPlan::Node & node)
 {
 
     // Translational and rotational dynamics on:
@@ -193,12 +204,12 @@ StructureIntegratedDynBody::collect_local_forces_and_torques ()
 
     // Translational dynamics on: Accumulate the external forces on this body.
     if (translational_dynamics) {
-        accumulate_forces (
-            collect.collect_effector_forc, collect.effector_forc);
-        accumulate_forces (
-            collect.collect_environ_forc, collect.environ_forc);
-        accumulate_forces (
-            collect.collect_no_xmit_forc, collect.no_xmit_forc);
+        plan.accumulate (
+            node, BodyCollectPlan::EffectorForce, collect.effector_forc);
+        plan.accumulate (
+            node, BodyCollectPlan::EnvironForce, collect.environ_forc);
+        plan.accumulate (
+            node, BodyCollectPlan::NoXmitForce, collect.no_xmit_forc);
     }
 
     // Translational dynamics off: Zero-out force accumulators.
@@ -213,12 +224,12 @@ StructureIntegratedDynBody::collect_local_forces_and_torques ()
     // Rotational dynamics on: Accumulate the external torques on this body.
     if (rotational_dynamics)
     {
-        accumulate_torques (
-            collect.collect_effector_torq, collect.effector_torq);
-        accumulate_torques (
-            collect.collect_environ_torq, collect.environ_torq);
-        accumulate_torques (
-            collect.collect_no_xmit_torq, collect.no_xmit_torq);
+        plan.accumulate (
+            node, BodyCollectPlan::EffectorTorque, collect.effector_torq);
+        plan.accumulate (
+            node, BodyCollectPlan::EnvironTorque, collect.environ_torq);
+        plan.accumulate (
+            node, BodyCollectPlan::NoXmitTorque, collect.no_xmit_torq);
     }
 
     // Rotational dynamics off: Zero-out torque accumulators.
@@ -228,6 +239,9 @@ StructureIntegratedDynBody::collect_local_forces_and_torques ()
         Vector3::initialize (collect.environ_torq);
         Vector3::initialize (collect.no_xmit_torq);
     }
+
+    // Add the forces and torques pushed onto this body.
+    wrench_buffer.reduce (translational_dynamics, rotational_dynamics, collect);
 }
 
 
@@ -287,9 +301,6 @@ StructureIntegratedDynBody::PropagateForcesAndTorques ()
         double effector_torque_parent_structure[3];
         double environ_torque_parent_structure[3];
         double parent_co_m_to_child_co_m[3];
-        // Reconstruct composite relative state
-        RefFrameState composite_wrt_pstr;
-        composite_body.compute_relative_state(dyn_parent->structure, composite_wrt_pstr );
         // Transform transmittable torques to parent structural.
         Vector3::transform_transpose (
             mass.structure_point.T_parent_this, collect.effector_torq,
@@ -299,7 +310,10 @@ StructureIntegratedDynBody::PropagateForcesAndTorques ()
             environ_torque_parent_structure);
 
         // Compute the parent cm to child cm offset in parent structural.
-        Vector3::diff (composite_wrt_pstr.trans.position,
+        // The mass tree maintains the child composite center of mass with
+        // respect to the parent structure across attach, detach and mass
+        // updates, so it need not be recomputed from the frame states.
+        Vector3::diff (get_composite_position_wrt_pstr (),
                        dyn_parent->mass.composite_properties.position,
                        parent_co_m_to_child_co_m);
 
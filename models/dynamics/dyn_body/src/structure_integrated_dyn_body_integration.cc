@@ -47,6 +47,21 @@ StructureIntegratedDynBody::trans_integ (
 }
 
 
+// Get the arrays that StructureIntegratedDynBody::trans_integ integrates.
+bool
+StructureIntegratedDynBody::get_trans_integ_state (
+   double const * & accel,
+   double * & velocity,
+   double * & position)
+{
+    bool integrated = DynBody::get_trans_integ_state (accel, velocity, position);
+    accel = struct_derivs.trans_accel;
+    velocity = structure.state.trans.velocity;
+    position = structure.state.trans.position;
+    return integrated;
+}
+
+
 // Integrate the rotational state of a StructureIntegratedDynBody.
 er7_utils::IntegratorResult
 StructureIntegratedDynBody::rot_integ (
@@ -62,16 +77,11 @@ StructureIntegratedDynBody::rot_integ (
             struct_derivs.rot_accel,
             rot_state.ang_vel_this, rot_state.Q_parent_this);
 
-    // Normalize the integrated quaternion.
-    rot_state.Q_parent_this.normalize_integ ();
-
-    // Compute the corresponding transformation matrix.
-    rot_state.Q_parent_this.left_quat_to_transformation (
-       rot_state.T_parent_this);
-
-    // Compute the quaternion derivative.
-    rot_state.Q_parent_this.compute_left_quat_deriv (
-       rot_state.ang_vel_this, derivs.Qdot_parent_this);
+    // Normalize the integrated quaternion and compute the corresponding
+    // transformation matrix and quaternion derivative.
+    rot_state.Q_parent_this.normalize_integ_transform_deriv (
+       rot_state.ang_vel_this, rot_state.T_parent_this,
+       derivs.Qdot_parent_this);
 
     // Compute the angular velocity magnitude and unit vector.
     rot_state.ang_vel_mag = Vector3::vmag (rot_state.ang_vel_this);
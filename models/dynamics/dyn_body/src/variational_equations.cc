@@ -0,0 +1,337 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/variational_equations.cc
+ * Define VariationalEquations methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((variational_equations.cc)
+   (variational_partials.cc)
+   (dyn_body.cc)
+   (dyn_body_messages.cc)
+   (dynamics/dyn_manager/src/dynamics_integration_group.cc)
+   (environment/gravity/src/gravity_controls.cc)
+   (environment/gravity/src/gravity_interaction.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cstddef>
+
+// Jeod includes
+#include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
+#include "environment/gravity/include/gravity_controls.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/dyn_body.hh"
+#include "../include/dyn_body_messages.hh"
+#include "../include/variational_equations.hh"
+#include "../include/variational_partials.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a VariationalEquations.
+ */
+VariationalEquations::VariationalEquations (
+   void)
+:
+   er7_utils::IntegrableObject(),
+   body(nullptr),
+   partials(),
+   num_parameters(0),
+   integrator()
+{
+   JEOD_REGISTER_CLASS (VariationalEquations);
+   JEOD_REGISTER_INCOMPLETE_CLASS (VariationalPartials);
+   JEOD_REGISTER_CHECKPOINTABLE (this, partials);
+   JEOD_REGISTER_CHECKPOINTABLE (this, integrator);
+
+   Matrix3x3::initialize (dadr);
+   Matrix3x3::initialize (dadv);
+   reset_matrices ();
+}
+
+
+/**
+ * Destruct a VariationalEquations.
+ */
+VariationalEquations::~VariationalEquations (
+   void)
+{
+   JEOD_DEREGISTER_CHECKPOINTABLE (this, integrator);
+   JEOD_DEREGISTER_CHECKPOINTABLE (this, partials);
+   destroy_integrators ();
+}
+
+
+/**
+ * Add a source of acceleration partials. The source's parameters follow
+ * those of the sources added before it. Sources must be added before the
+ * integrator is created.
+ * \param[in] source The source
+ */
+void
+VariationalEquations::add_partials (
+   VariationalPartials & source)
+{
+   if (integrator.has_integrator()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_request,
+         "Partials cannot be added to VariationalEquations after its "
+         "integrator has been created.");
+
+      // Not reached
+      return;
+   }
+
+   unsigned int source_parameters = source.get_num_parameters();
+   if (num_parameters + source_parameters > max_parameters) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_request,
+         "VariationalEquations supports at most %u parameters; "
+         "%u were requested.",
+         max_parameters, num_parameters + source_parameters);
+
+      // Not reached
+      return;
+   }
+
+   partials.push_back (&source);
+   num_parameters += source_parameters;
+}
+
+
+/**
+ * Associate the object with a root body, enable the body's gravity gradient
+ * computations, and add the object to the body's integration group.
+ * \param[in] dyn_body The body
+ */
+void
+VariationalEquations::initialize (
+   DynBody & dyn_body)
+{
+   if (! dyn_body.is_root_body()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_body,
+         "DynBody '%s' is not a root body; its state is not integrated.",
+         dyn_body.name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   body = &dyn_body;
+
+   for (unsigned int ii = 0;
+        ii < dyn_body.grav_interaction.grav_controls.size();
+        ++ii) {
+      dyn_body.grav_interaction.grav_controls[ii]->gradient = true;
+   }
+
+   reset_matrices ();
+
+   // Bodies added to a group later bring their integrable objects along.
+   dyn_body.add_integrable_object (*this);
+   DynamicsIntegrationGroup * group = dyn_body.get_dynamics_integration_group();
+   if (group != nullptr) {
+      group->add_integrable_object (*this);
+   }
+}
+
+
+/**
+ * Set the state transition matrix to identity and the sensitivities to
+ * zero, making the current time the initial time. Call reset_integrators
+ * as well if the body's integrators are not being reset.
+ */
+void
+VariationalEquations::reset_matrices (
+   void)
+{
+   for (unsigned int kk = 0; kk < 6 + max_parameters; ++kk) {
+      for (unsigned int ii = 0; ii < 6; ++ii) {
+         columns[kk][ii] = (kk == ii) ? 1.0 : 0.0;
+         columns_dot[kk][ii] = 0.0;
+      }
+   }
+   for (unsigned int kk = 0; kk < max_parameters; ++kk) {
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         dadp[kk][ii] = 0.0;
+      }
+   }
+}
+
+
+/**
+ * Get the state transition matrix, stm[i][j] = d(r,v)_i/d(r0,v0)_j.
+ * \param[out] stm State transition matrix
+ */
+void
+VariationalEquations::get_stm (
+   double stm[6][6])
+const
+{
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      for (unsigned int jj = 0; jj < 6; ++jj) {
+         stm[ii][jj] = columns[jj][ii];
+      }
+   }
+}
+
+
+/**
+ * Get the sensitivity of the state to a parameter, d(r,v)/dp.
+ * \param[in] param_index Parameter index
+ * \param[out] sens Sensitivity
+ */
+void
+VariationalEquations::get_sensitivity (
+   unsigned int param_index,
+   double sens[6])
+const
+{
+   if (param_index >= num_parameters) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_request,
+         "Parameter index %u is out of range; there are %u parameters.",
+         param_index, num_parameters);
+
+      // Not reached
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      sens[ii] = columns[6 + param_index][ii];
+   }
+}
+
+
+/**
+ * Create the first order integrator for the integrated columns.
+ * @param generator  Integrator constructor that creates the integrator.
+ * @param controls   Integration controls that mediates the integrations.
+ * @param time_if    Unused.
+ */
+void
+VariationalEquations::create_integrators (
+   const er7_utils::IntegratorConstructor & generator,
+   er7_utils::IntegrationControls & controls,
+   const er7_utils::TimeInterface & time_if JEOD_UNUSED)
+{
+   if (body == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynBodyMessages::invalid_body,
+         "VariationalEquations must be initialized with a DynBody before "
+         "it is integrated.");
+
+      // Not reached
+      return;
+   }
+
+   integrator.create_integrator (6 * (6 + num_parameters), generator, controls);
+}
+
+
+/**
+ * Destroy the integrator.
+ */
+void
+VariationalEquations::destroy_integrators (
+   void)
+{
+   integrator.destroy_integrator ();
+}
+
+
+/**
+ * Reset the integrator.
+ */
+void
+VariationalEquations::reset_integrators (
+   void)
+{
+   if (integrator.has_integrator()) {
+      integrator.reset_integrator ();
+   }
+}
+
+
+/**
+ * Integrate the variational equations.
+ * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
+ * @param[in]     target_stage  The stage of the integration process
+ *                              that the integrator should try to attain.
+ * @return The status (time advance, pass/fail status) of the integration.
+ */
+er7_utils::IntegratorResult
+VariationalEquations::integrate (
+   double dyn_dt,
+   unsigned int target_stage)
+{
+   compute_derivatives ();
+
+   return integrator.integrate (
+      dyn_dt, target_stage, &columns_dot[0][0], &columns[0][0]);
+}
+
+
+/**
+ * Compute the time derivatives of the integrated columns from the body's
+ * gravity gradient and the partials supplied by the sources.
+ */
+void
+VariationalEquations::compute_derivatives (
+   void)
+{
+   Matrix3x3::copy (body->grav_interaction.grav_grad, dadr);
+   Matrix3x3::initialize (dadv);
+
+   unsigned int param_offset = 0;
+   for (unsigned int ii = 0; ii < partials.size(); ++ii) {
+      VariationalPartials * source = partials[ii];
+      source->add_partials (*body, dadr, dadv, &dadp[param_offset]);
+      param_offset += source->get_num_parameters();
+   }
+
+   for (unsigned int kk = 0; kk < 6 + num_parameters; ++kk) {
+      const double * col = columns[kk];
+      double * col_dot = columns_dot[kk];
+
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         double accel = (kk >= 6) ? dadp[kk - 6][ii] : 0.0;
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            accel += dadr[ii][jj] * col[jj] + dadv[ii][jj] * col[3 + jj];
+         }
+         col_dot[ii] = col[3 + ii];
+         col_dot[3 + ii] = accel;
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,309 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynBody
+ * @{
+ *
+ * @file models/dynamics/dyn_body/src/variational_partials.cc
+ * Define VariationalPartials, DragVariationalPartials, and
+ * RadiationVariationalPartials methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((variational_partials.cc)
+   (dyn_body.cc)
+   (dynamics/mass/src/mass.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cstddef>
+
+// Jeod includes
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/dyn_body.hh"
+#include "../include/variational_partials.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a VariationalPartials.
+ */
+VariationalPartials::VariationalPartials (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Destruct a VariationalPartials.
+ */
+VariationalPartials::~VariationalPartials (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Add the partial of an acceleration whose magnitude is proportional to
+ * |u|^exponent and whose direction turns with u,
+ *   da/du = exponent a uhat^T/|u| + (a.uhat)/|u| (I - uhat uhat^T).
+ * Nothing is added if u is zero.
+ * \param[in] accel Acceleration
+ * \param[in] u The vector the acceleration depends on
+ * \param[in] exponent Power of |u|
+ * \param[in,out] dadu Partial of acceleration wrt u
+ */
+void
+VariationalPartials::add_power_law_partial (
+   const double accel[3],
+   const double u[3],
+   double exponent,
+   double dadu[3][3])
+{
+   double umag = Vector3::vmag (u);
+   if (umag <= 0.0) {
+      return;
+   }
+
+   double uhat[3];
+   Vector3::scale (u, 1.0 / umag, uhat);
+   double a_along = Vector3::dot (accel, uhat) / umag;
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      dadu[ii][ii] += a_along;
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         dadu[ii][jj] += (exponent * accel[ii] / umag - a_along * uhat[ii]) *
+                         uhat[jj];
+      }
+   }
+}
+
+
+/**
+ * Compute the acceleration of a body's composite center of mass, expressed
+ * in the integration frame, that results from a force expressed in the
+ * body's structural frame.
+ * @return True if the acceleration could be computed
+ * \param[in] body The body
+ * \param[in] force_struct Force, structural frame; may be null\n Units: N
+ * \param[out] accel Acceleration, integration frame\n Units: M/s2
+ */
+bool
+VariationalPartials::compute_accel (
+   const DynBody & body,
+   const double * force_struct,
+   double accel[3])
+{
+   double mass = body.mass.composite_properties.mass;
+
+   if ((force_struct == nullptr) || (mass <= 0.0)) {
+      return false;
+   }
+
+   Vector3::transform_transpose (
+      body.structure.state.rot.T_parent_this, force_struct, accel);
+   Vector3::scale (1.0 / mass, accel);
+
+   return true;
+}
+
+
+/**
+ * Construct a DragVariationalPartials.
+ */
+DragVariationalPartials::DragVariationalPartials (
+   void)
+:
+   VariationalPartials(),
+   force(nullptr),
+   scale_height(0.0),
+   estimate_scale_factor(false)
+{
+   Vector3::initialize (atmosphere_rate);
+}
+
+
+/**
+ * Destruct a DragVariationalPartials.
+ */
+DragVariationalPartials::~DragVariationalPartials (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Get the number of parameters.
+ * @return One if the scale factor is estimated, zero otherwise.
+ */
+unsigned int
+DragVariationalPartials::get_num_parameters (
+   void)
+const
+{
+   return estimate_scale_factor ? 1 : 0;
+}
+
+
+/**
+ * Add the partials of the drag acceleration.
+ * \param[in] body The body
+ * \param[in,out] dadr Partial of acceleration wrt position\n Units: 1/s2
+ * \param[in,out] dadv Partial of acceleration wrt velocity\n Units: 1/s
+ * \param[out] dadp Partial of acceleration wrt the scale factor\n Units: M/s2
+ */
+void
+DragVariationalPartials::add_partials (
+   const DynBody & body,
+   double dadr[3][3],
+   double dadv[3][3],
+   double dadp[][3])
+{
+   double accel[3];
+
+   if (! compute_accel (body, force, accel)) {
+      Vector3::initialize (accel);
+   }
+
+   // The sensitivity to a scale factor is the acceleration itself.
+   if (estimate_scale_factor) {
+      Vector3::copy (accel, dadp[0]);
+   }
+
+   if (Vector3::vmagsq (accel) <= 0.0) {
+      return;
+   }
+
+   const double * position = body.composite_body.state.trans.position;
+   const double * velocity = body.composite_body.state.trans.velocity;
+
+   // Velocity relative to the atmosphere.
+   double rel_vel[3];
+   Vector3::cross (atmosphere_rate, position, rel_vel);
+   Vector3::diff (velocity, rel_vel, rel_vel);
+
+   double dadvrel[3][3];
+   Matrix3x3::initialize (dadvrel);
+   add_power_law_partial (accel, rel_vel, 2.0, dadvrel);
+   Matrix3x3::incr (dadvrel, dadv);
+
+   // The relative velocity depends on position through the atmosphere's
+   // rotation: d(v_rel)/dr = -[omega x].
+   double omega_cross[3][3];
+   double dadr_wind[3][3];
+   Matrix3x3::cross_matrix (atmosphere_rate, omega_cross);
+   Matrix3x3::product (dadvrel, omega_cross, dadr_wind);
+   Matrix3x3::decr (dadr_wind, dadr);
+
+   // Exponential density: d(rho)/dr = -rho/H rhat.
+   double rmag = Vector3::vmag (position);
+   if ((scale_height > 0.0) && (rmag > 0.0)) {
+      double scale = -1.0 / (scale_height * rmag);
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            dadr[ii][jj] += scale * accel[ii] * position[jj];
+         }
+      }
+   }
+}
+
+
+/**
+ * Construct a RadiationVariationalPartials.
+ */
+RadiationVariationalPartials::RadiationVariationalPartials (
+   void)
+:
+   VariationalPartials(),
+   force(nullptr),
+   source_position(nullptr),
+   estimate_scale_factor(false)
+{
+   ; // Empty
+}
+
+
+/**
+ * Destruct a RadiationVariationalPartials.
+ */
+RadiationVariationalPartials::~RadiationVariationalPartials (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Get the number of parameters.
+ * @return One if the scale factor is estimated, zero otherwise.
+ */
+unsigned int
+RadiationVariationalPartials::get_num_parameters (
+   void)
+const
+{
+   return estimate_scale_factor ? 1 : 0;
+}
+
+
+/**
+ * Add the partials of the radiation pressure acceleration. The acceleration
+ * does not depend on velocity.
+ * \param[in] body The body
+ * \param[in,out] dadr Partial of acceleration wrt position\n Units: 1/s2
+ * \param[in,out] dadv Unused
+ * \param[out] dadp Partial of acceleration wrt the scale factor\n Units: M/s2
+ */
+void
+RadiationVariationalPartials::add_partials (
+   const DynBody & body,
+   double dadr[3][3],
+   double dadv[3][3] JEOD_UNUSED,
+   double dadp[][3])
+{
+   double accel[3];
+
+   if (! compute_accel (body, force, accel)) {
+      Vector3::initialize (accel);
+   }
+
+   if (estimate_scale_factor) {
+      Vector3::copy (accel, dadp[0]);
+   }
+
+   if (source_position == nullptr) {
+      return;
+   }
+
+   double rel_pos[3];
+   Vector3::diff (body.composite_body.state.trans.position, source_position,
+                  rel_pos);
+   add_power_law_partial (accel, rel_pos, -2.0, dadr);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
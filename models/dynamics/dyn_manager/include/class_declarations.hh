@@ -63,9 +63,17 @@ Purpose:
 //! Namespace jeod
 namespace jeod {
 
+class DerivativeThreadPool;
+class DerivativeThreadTask;
+class DistributedPartition;
+class DistributedTransport;
 class DynManagerInit;
 class DynManager;
 class DynamicsIntegrationGroup;
+class EnergyMonitor;
+class EnergyMonitorEntry;
+class MpiTransport;
+class SingleRankTransport;
 
 } // End JEOD namespace
 
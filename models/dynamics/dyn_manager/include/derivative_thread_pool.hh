@@ -0,0 +1,223 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/include/derivative_thread_pool.hh
+ * Define the class DerivativeThreadPool, a small fixed-size pool of worker
+ * threads used to evaluate per-body derivative phases in parallel.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/derivative_thread_pool.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_DERIVATIVE_THREAD_POOL_HH
+#define JEOD_DERIVATIVE_THREAD_POOL_HH
+
+// System includes
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A unit of work that can be executed for each of a range of indices.
+ * Executing index i must only modify data owned by item i. Contributions
+ * that several items make to one sum belong in per-item partials, combined
+ * after the run with DeterministicSum (or pushed into the BodyWrenchBuffer
+ * slot numbered by the item), so the sum does not depend on the thread
+ * count.
+ */
+class DerivativeThreadTask {
+public:
+
+   /**
+    * Destructor.
+    */
+   virtual ~DerivativeThreadTask () {}
+
+   /**
+    * Perform the work for one item.
+    * @param[in] index  Item index.
+    */
+   virtual void execute (unsigned int index) = 0;
+};
+
+
+/**
+ * A DerivativeThreadPool runs a DerivativeThreadTask over a range of indices
+ * on a fixed set of worker threads plus the calling thread.
+ * The indices are partitioned statically into contiguous, equally sized
+ * blocks, one per thread, so the assignment of items to threads depends only
+ * on the item count and the thread count. Because each item writes only its
+ * own data, the results are independent of the thread count.
+ */
+class DerivativeThreadPool {
+JEOD_MAKE_SIM_INTERFACES(DerivativeThreadPool)
+
+public:
+
+   // Constructor and destructor.
+   explicit DerivativeThreadPool (unsigned int nthreads);
+   ~DerivativeThreadPool ();
+
+   // Make pool a pool of nthreads threads, creating or replacing it as
+   // needed. The pool holds threads, which are not checkpointable state,
+   // so it is owned outside of the JEOD memory manager.
+   static DerivativeThreadPool * acquire (
+      DerivativeThreadPool *& pool,
+      unsigned int nthreads);
+
+   // Destroy a pool obtained from acquire, if any.
+   static void release (DerivativeThreadPool *& pool);
+
+   /**
+    * Get the number of threads, including the calling thread.
+    * @return Thread count.
+    */
+   unsigned int get_num_threads () const
+   {
+      return num_threads;
+   }
+
+   // Execute the task for indices 0 to nitems-1 and wait for completion.
+   void run (unsigned int nitems, DerivativeThreadTask & task);
+
+
+private:
+
+   // Worker thread main loop.
+   void worker_loop (unsigned int thread_index);
+
+   // Execute the calling thread's or a worker's block of the current task.
+   void run_block (unsigned int thread_index);
+
+
+   /**
+    * Number of threads, including the calling thread.
+    */
+   unsigned int num_threads; //!< trick_io(**)
+
+   /**
+    * The worker threads.
+    */
+   std::vector<std::thread> workers; //!< trick_io(**)
+
+   /**
+    * Guards the members below.
+    */
+   std::mutex mutex; //!< trick_io(**)
+
+   /**
+    * Signals the workers that a new task (or shutdown) is available.
+    */
+   std::condition_variable start_cond; //!< trick_io(**)
+
+   /**
+    * Signals the caller that all workers have finished the task.
+    */
+   std::condition_variable done_cond; //!< trick_io(**)
+
+   /**
+    * Task being executed.
+    */
+   DerivativeThreadTask * task; //!< trick_io(**)
+
+   /**
+    * Number of items in the task being executed.
+    */
+   unsigned int num_items; //!< trick_io(**)
+
+   /**
+    * Incremented for each task, so workers can tell a new task from a
+    * spurious wakeup.
+    */
+   unsigned long generation; //!< trick_io(**)
+
+   /**
+    * Number of workers still executing the current task.
+    */
+   unsigned int pending; //!< trick_io(**)
+
+   /**
+    * Set to tell the workers to exit.
+    */
+   bool shutdown; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   DerivativeThreadPool (const DerivativeThreadPool &);
+
+   /**
+    * Not implemented.
+    */
+   DerivativeThreadPool & operator= (const DerivativeThreadPool &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,288 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/include/distributed_partition.hh
+ * Define the class DistributedPartition, which partitions the root DynBody
+ * objects of a simulation across the ranks of a distributed simulation.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Every rank runs the same simulation, registering the same DynBody objects
+    in the same order. The environment models are replicated on each rank.)
+   (Only the translational and rotational states are exchanged; mass
+    properties are assumed to evolve identically on all ranks.))
+
+Library dependencies:
+  ((../src/distributed_partition.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DISTRIBUTED_PARTITION_HH
+#define JEOD_DISTRIBUTED_PARTITION_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "integration_cycle_observer.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DistributedTransport;
+class DynBody;
+class DynManager;
+class DynamicsIntegrationGroup;
+
+
+/**
+ * A DistributedPartition runs a simulation as several ranks, each of which
+ * integrates a subset of the simulation's root DynBody objects, i.e., of
+ * its independent vehicles. Every rank runs the same simulation; bodies a
+ * rank does not own are removed from their integration groups on that rank,
+ * so they cost neither gravity, force collection, nor integration.
+ *
+ * At the end of each integration cycle the ranks exchange the states of the
+ * shared bodies, i.e., the bodies that other ranks need, such as the
+ * subjects of relative states or contact. The states of the other bodies a
+ * rank does not own are not updated on that rank; the simulation can test
+ * is_local to skip models that act on them.
+ *
+ * Bodies are assigned to ranks so as to balance the per-body cost that the
+ * DynManager accounts (see DynManager::set_body_cost_tracking). Every
+ * rebalance_interval cycles the ranks compare their loads and, if the
+ * imbalance exceeds imbalance_tolerance, reassign the bodies and migrate
+ * the states of the bodies that change ranks.
+ */
+class DistributedPartition : public IntegrationCycleObserver {
+JEOD_MAKE_SIM_INTERFACES(DistributedPartition)
+
+public:
+
+   /**
+    * Number of integration cycles between load balance checks;
+    * zero disables load balancing.
+    */
+   unsigned int rebalance_interval; //!< trick_units(count)
+
+   /**
+    * The bodies are reassigned when the most heavily loaded rank's load
+    * exceeds the mean load by more than this fraction.
+    */
+   double imbalance_tolerance; //!< trick_units(--)
+
+
+   // Constructor and destructor.
+   DistributedPartition ();
+   ~DistributedPartition () override;
+
+   // Share a body's state with all ranks.
+   void add_shared_body (DynBody & body);
+
+   // Partition the bodies and register with the dynamics manager.
+   void initialize (DynManager & manager, DistributedTransport & transport);
+
+   // Is the body integrated by this rank?
+   bool is_local (const DynBody & body) const;
+
+   // Get the rank that integrates a body.
+   int get_owner (const DynBody & body) const;
+
+   // Get the number of root bodies this rank integrates.
+   unsigned int get_num_local_bodies () const;
+
+   // Exchange the states of the shared bodies.
+   void exchange ();
+
+   // Reassign the bodies if the load is imbalanced.
+   bool rebalance ();
+
+   // Exchange states, and periodically rebalance, after each cycle.
+   void integration_cycle_complete (
+      DynamicsIntegrationGroup & integ_group) override;
+
+   // Deregister from the dynamics manager.
+   void shutdown ();
+
+
+private:
+
+   /**
+    * A root body and the bodies attached to it.
+    */
+   struct Body {
+      /**
+       * The root body.
+       */
+      DynBody * root;
+
+      /**
+       * The root body and its descendants.
+       */
+      std::vector<DynBody *> tree;
+
+      /**
+       * The integration group of each body in the tree, on the owning rank.
+       */
+      std::vector<DynamicsIntegrationGroup *> groups;
+
+      /**
+       * The rank that integrates the body.
+       */
+      unsigned int owner;
+
+      /**
+       * Is the body's state exchanged each cycle?
+       */
+      bool shared;
+   };
+
+
+   // Find the entry for a body's root.
+   int find_body (const DynBody & body) const;
+
+   // Assign bodies to ranks, most expensive first, to the least loaded rank.
+   void assign (
+      const std::vector<double> & costs,
+      std::vector<unsigned int> & owners) const;
+
+   // Make this rank integrate a body, or stop it from doing so.
+   void set_local (Body & body, bool local);
+
+   // Build the exchange order and counts from the ownership.
+   void build_exchange_order ();
+
+   // Pack a body's state.
+   static void pack_state (const DynBody & body, double * buffer);
+
+   // Unpack a received state into a body and propagate it.
+   static void unpack_state (const double * buffer, DynBody & body);
+
+
+   /**
+    * Number of values in a packed state.
+    */
+   static const unsigned int state_size = 13;
+
+   /**
+    * The dynamics manager.
+    */
+   DynManager * dyn_manager; //!< trick_io(**)
+
+   /**
+    * The transport.
+    */
+   DistributedTransport * transport; //!< trick_io(**)
+
+   /**
+    * The root bodies, in registration order.
+    */
+   std::vector<Body> bodies; //!< trick_io(**)
+
+   /**
+    * Bodies shared before initialization.
+    */
+   std::vector<DynBody *> shared_requests; //!< trick_io(**)
+
+   /**
+    * Indices of the shared bodies, ordered by owner and then by index.
+    */
+   std::vector<unsigned int> exchange_order; //!< trick_io(**)
+
+   /**
+    * Number of values each rank sends in an exchange.
+    */
+   std::vector<unsigned int> exchange_counts; //!< trick_io(**)
+
+   /**
+    * Send buffer.
+    */
+   std::vector<double> send_buffer; //!< trick_io(**)
+
+   /**
+    * Receive buffer.
+    */
+   std::vector<double> recv_buffer; //!< trick_io(**)
+
+   /**
+    * Number of integration cycles since the last load balance check.
+    */
+   unsigned int cycles_since_rebalance; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   DistributedPartition (const DistributedPartition &);
+
+   /**
+    * Not implemented.
+    */
+   DistributedPartition & operator= (const DistributedPartition &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
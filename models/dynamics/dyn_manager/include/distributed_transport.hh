@@ -0,0 +1,204 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/include/distributed_transport.hh
+ * Define the interface class DistributedTransport and the class
+ * SingleRankTransport.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ()
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DISTRIBUTED_TRANSPORT_HH
+#define JEOD_DISTRIBUTED_TRANSPORT_HH
+
+// System includes
+#include <algorithm>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A DistributedTransport connects the ranks, i.e., the processes, of a
+ * distributed simulation. Every rank runs the same simulation; the calls
+ * to all_gather are collective and must be made in the same order on all
+ * ranks.
+ */
+class DistributedTransport {
+JEOD_MAKE_SIM_INTERFACES(DistributedTransport)
+
+public:
+
+   /**
+    * Destructor.
+    */
+   virtual ~DistributedTransport () {}
+
+   /**
+    * Get this process's rank.
+    * @return Rank, 0 to get_num_ranks()-1
+    */
+   virtual unsigned int get_rank () const = 0;
+
+   /**
+    * Get the number of ranks.
+    * @return Number of ranks
+    */
+   virtual unsigned int get_num_ranks () const = 0;
+
+   /**
+    * Gather every rank's values, concatenated in rank order, on all ranks.
+    * \param[in] send Values sent by this rank
+    * \param[in] send_count Number of values sent by this rank
+    * \param[out] recv Gathered values
+    * \param[in] recv_counts Number of values sent by each rank
+    */
+   virtual void all_gather (
+      const double * send,
+      unsigned int send_count,
+      double * recv,
+      const unsigned int * recv_counts) = 0;
+
+
+protected:
+
+   /**
+    * Constructor.
+    */
+   DistributedTransport () {}
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   DistributedTransport (const DistributedTransport &);
+
+   /**
+    * Not implemented.
+    */
+   DistributedTransport & operator= (const DistributedTransport &);
+};
+
+
+/**
+ * The transport of a simulation that runs as a single rank.
+ */
+class SingleRankTransport : public DistributedTransport {
+JEOD_MAKE_SIM_INTERFACES(SingleRankTransport)
+
+public:
+
+   /**
+    * Constructor.
+    */
+   SingleRankTransport () {}
+
+   /**
+    * Destructor.
+    */
+   ~SingleRankTransport () override {}
+
+   /**
+    * Get this process's rank.
+    * @return Zero
+    */
+   unsigned int get_rank () const override
+   {
+      return 0;
+   }
+
+   /**
+    * Get the number of ranks.
+    * @return One
+    */
+   unsigned int get_num_ranks () const override
+   {
+      return 1;
+   }
+
+   /**
+    * Copy this rank's values.
+    * \param[in] send Values
+    * \param[in] send_count Number of values
+    * \param[out] recv Copy of the values
+    * \param[in] recv_counts Unused
+    */
+   void all_gather (
+      const double * send,
+      unsigned int send_count,
+      double * recv,
+      const unsigned int * recv_counts JEOD_UNUSED) override
+   {
+      std::copy (send, send + send_count, recv);
+   }
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -70,7 +70,9 @@ Library dependencies:
 // JEOD includes
 #include "environment/ephemerides/ephem_manager/include/ephem_manager.hh"
 #include "environment/planet/include/planet.hh"
+#include "utils/container/include/position_index.hh"
 #include "utils/integration/include/jeod_integration_group.hh"
+#include "utils/named_item/include/name_table.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -83,11 +85,13 @@ Library dependencies:
 namespace jeod {
 
 class BodyAction;
+class DynBodyFrameSwitch;
 class DynamicsIntegrationGroup;
 class DynBody;
 class JeodIntegratorInterface;
 class MassBody;
 class GravityManager;
+class IntegrationCycleObserver;
 class Planet;
 class TimeManager;
 class SinglePointEphemeris;
@@ -176,12 +180,16 @@ public:
    // Check if a mass body has been registered with the dynamics manager.
    bool is_mass_body_registered (const MassBody * mass_body) const override;
 
+   // Remove a mass body from the list of such.
+   void remove_mass_body (MassBody & mass_body);
+
 
    // Add a dynamic body to the list of such.
    void add_dyn_body (DynBody & dyn_body) override;
 
    // Find a dynamic body.
    DynBody * find_dyn_body (const char * name) const override;
+   DynBody * find_dyn_body (NameHandle handle) const;
 
    /**
     * Return a copy of the list of registered dynamic bodies.
@@ -195,6 +203,26 @@ public:
    // Check if a dynamic body has been registered with the dynamics manager.
    bool is_dyn_body_registered (const DynBody * dyn_body) const override;
 
+   // Bring a dynamic body created during the run into the simulation.
+   void start_dyn_body (
+      DynBody & dyn_body,
+      DynamicsIntegrationGroup * integ_group = nullptr);
+
+   // Remove a dynamic body from the simulation.
+   void remove_dyn_body (DynBody & dyn_body);
+
+   // Remove a dynamic body from the simulation and delete it.
+   void destroy_dyn_body (DynBody & dyn_body);
+
+   // Turn per-body cost accounting on or off.
+   void set_body_cost_tracking (bool track);
+
+   // Zero the accumulated per-body costs.
+   void reset_body_costs (void);
+
+   // Root bodies, most expensive first.
+   std::vector<DynBody*> get_dyn_bodies_by_cost (void) const;
+
 
    // Add an integration group to the list of such.
    void add_integ_group (DynamicsIntegrationGroup & integ_group) override;
@@ -210,9 +238,15 @@ public:
    // remove a body action from the queue based on its name.
    void remove_body_action( char * action_name_in);
 
+   // Remove a body action from the queue.
+   void remove_body_action (BodyAction & body_action);
+
    // Perform body actions that are ready to be applied.
    void perform_actions (void);
 
+   // Move time-triggered actions whose time has come to the action queue.
+   void activate_timed_actions (double time);
+
 
    // Initialize the integration groups.
    void initialize_integ_groups (void);
@@ -250,6 +284,10 @@ public:
    {
      integ_group.reset_integrators();
    }
+
+   // Register the dynamic state of the simulation with a state snapshot.
+   void add_snapshot_regions (StateSnapshot & snapshot) override;
+
    /**
     * Propagate all vehicles and propagate time.
     * @param to_sim_time Simulation time seconds of end of integration interval.
@@ -261,6 +299,34 @@ public:
    }
 
 
+   // Multirate scheduling
+
+   // Select the number of sub-steps for an integration group's next cycle.
+   unsigned int schedule_substeps (
+      DynamicsIntegrationGroup & integ_group,
+      double cycle_dt);
+
+   // Interpolate a body's translational state from the dense output of
+   // whichever integration group integrates it.
+   bool interpolate_trans_state (
+      const DynBody & dyn_body,
+      double dyn_time,
+      double * velocity,
+      double * position) const;
+
+
+   // Integration cycle observers
+
+   // Register an observer of the end of each integration cycle.
+   void add_cycle_observer (IntegrationCycleObserver & observer);
+
+   // Deregister an integration cycle observer.
+   void remove_cycle_observer (IntegrationCycleObserver & observer);
+
+   // Tell the observers that an integration loop completed a cycle.
+   void end_integration_cycle (DynamicsIntegrationGroup & integ_group);
+
+
    // Get the time at which the manager was last updated.
    double timestamp (void) const override;
 
@@ -287,6 +353,21 @@ public:
     */
    bool gravity_off; //!< trick_units(--)
 
+   /**
+    * Enable the multirate scheduler? When set, each integration group
+    * integrated by its own integration loop is sub-stepped per the group's
+    * max_step_hint, the Sundman steps of its bodies, and error_hint (see
+    * schedule_substeps). When clear, every group takes one step per
+    * integration cycle.
+    */
+   bool multirate; //!< trick_units(--)
+
+   /**
+    * The multirate scheduler halves a group's sub-step count when the group
+    * reports an error_hint below this value.
+    */
+   double multirate_coarsen_threshold; //!< trick_units(--)
+
    /**
     * The ephemeris mode in which the dynamics manager operates.
     */
@@ -307,6 +388,12 @@ protected:
       DynManagerInit & init,
       TimeManager & time_mngr);
 
+   // Rebuild the name index from the list of dynamic bodies.
+   void rebuild_dyn_body_index (void) const;
+
+   // Rebuild the name index from the list of mass bodies.
+   void rebuild_mass_body_index (void) const;
+
    // initialize_dyn_bodies support methods
    void perform_mass_body_initializations (MassBody * body = nullptr);
    void perform_mass_attach_initializations (void);
@@ -366,8 +453,64 @@ protected:
     */
    std::list<BodyAction*> body_actions;
 
+   /**
+    * Time-triggered body actions that have not yet reached their activation
+    * time, kept as a heap whose front is the earliest action to activate.
+    */
+   std::vector<BodyAction*> timed_body_actions;
+
+   /**
+    * Active frame-switch actions gathered by perform_actions so that their
+    * switch conditions can be evaluated together.
+    */
+   std::vector<DynBodyFrameSwitch*> pending_frame_switches; //!< trick_io(**)
+
+   /**
+    * Number of time-triggered actions received, used to order actions that
+    * share an activation time and priority.
+    */
+   unsigned int timed_action_count; //!< trick_units(--)
+
+   /**
+    * Accumulate per-body costs? Applied to bodies as they are added.
+    */
+   bool track_body_costs; //!< trick_units(--)
+
+   /**
+    * Observers of the end of each integration cycle.
+    */
+   std::vector<IntegrationCycleObserver*> cycle_observers; //!< trick_io(**)
+
+   /**
+    * Index from interned body name to position in dyn_bodies.
+    * This is a cache; it is rebuilt whenever it is found to be out of date.
+    */
+   mutable NameIndex dyn_body_index; //!< trick_io(**)
+
+   /**
+    * Positions of the bodies in dyn_bodies, for constant-time membership
+    * tests and removal.
+    */
+   PositionIndex<DynBody> dyn_body_positions; //!< trick_io(**)
+
+   /**
+    * Index from interned body name to position in mass_bodies.
+    * This is a cache; it is rebuilt whenever it is found to be out of date.
+    */
+   mutable NameIndex mass_body_index; //!< trick_io(**)
+
+   /**
+    * Positions of the bodies in mass_bodies.
+    */
+   PositionIndex<MassBody> mass_body_positions; //!< trick_io(**)
+
 
 private:
+
+   // Heap ordering for time-triggered actions.
+   static bool activates_after (
+      const BodyAction * lhs, const BodyAction * rhs);
+
    // Make the copy constructor and assignment operator private
    // (and unimplemented) to avoid erroneous copies
 
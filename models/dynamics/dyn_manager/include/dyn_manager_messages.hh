@@ -130,6 +130,11 @@ class DynManagerMessages {
     */
    static char const * internal_error; //!< trick_units(--)
 
+   /**
+    * Error issued when a distributed transport cannot exchange data.
+    */
+   static char const * transport_error; //!< trick_units(--)
+
 
  // Member functions
  // This class is not instantiable.
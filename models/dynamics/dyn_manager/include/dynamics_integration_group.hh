@@ -63,18 +63,30 @@ Library dependencies:
 #define JEOD_DYNAMICS_INTEGRATION_GROUP_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/container/include/position_index.hh"
+#include "utils/memory/include/class_declarations.hh"
 #include "utils/integration/include/jeod_integration_group.hh"
 
+/**
+ * Namespace er7_utils contains the state integration models used by JEOD.
+ */
+namespace er7_utils {
+   class SecondOrderODEIntegrator;
+}
+
 //! Namespace jeod
 namespace jeod {
 
 // Forward declarations
+class DerivativeThreadPool;
 class DynBody;
 class DynManager;
+class GravityControls;
 class GravityManager;
 class JeodIntegrationTime;
 class JeodIntegratorInterface;
@@ -176,6 +188,13 @@ public:
       DynManager & dyn_manager,
       GravityManager & gravity_manager);
 
+   // Bring the environment the gravitation step reads up to date.
+   void update_environment (DynManager & dyn_manager);
+
+   // Compute the gravitational acceleration for each body in the group
+   // against an environment that is already up to date.
+   void body_gravitation (GravityManager & gravity_manager);
+
    // Collect derivatives for each root DynBody object.
    virtual void collect_derivatives (void);
 
@@ -196,8 +215,24 @@ public:
    virtual void add_dyn_body (DynBody & body);
 
    // Delete a DynBody from the set of bodies that comprise the group.
+   // The last body in the set takes the deleted body's place.
    virtual void delete_dyn_body (DynBody & body);
 
+   // Register the group's own integration state, i.e., the batched
+   // translational integrator, with a state snapshot.
+   virtual void add_snapshot_regions (StateSnapshot & snapshot);
+
+   // Interpolate the translational state of a DynBody in the group
+   // within the most recent integration step.
+   bool interpolate_state (
+      const er7_utils::IntegrableObject & object,
+      double dyn_time,
+      double * velocity,
+      double * position) const override;
+
+   // Get the smallest Sundman step asked for by the group's root bodies.
+   double get_sundman_step (void) const;
+
 
    // Member data
 
@@ -206,6 +241,93 @@ public:
     */
    bool deriv_ephem_update; //!< trick_units(--)
 
+   /**
+    * Integrate the translational states of the group's root bodies as one
+    * system? When set, the positions, velocities and accelerations are
+    * packed into structure-of-arrays buffers and propagated by a single
+    * state integrator, which amortizes the per-body integrator overhead.
+    * Rotational states are still integrated body by body.
+    * Note that adaptive integrators then apply one error estimate to the
+    * whole batch.
+    */
+   bool batch_translation; //!< trick_units(--)
+
+   /**
+    * Number of threads used to collect the root bodies' forces and torques
+    * (and, if parallel_gravitation is set, their gravitational accelerations).
+    * Zero or one selects serial evaluation. Bodies are statically partitioned
+    * into contiguous blocks and each body's derivatives are computed by one
+    * thread only, so the results do not depend on the thread count.
+    * Force and torque effectors must not share mutable state across bodies.
+    */
+   unsigned int derivative_threads; //!< trick_units(--)
+
+   /**
+    * Compute gravitation in parallel when derivative_threads exceeds one?
+    * The first root body is always processed serially, which primes state
+    * shared across bodies. This is safe only when the gravity manager shares
+    * frame offsets (GravityManager::share_frame_offsets) and the spherical
+    * harmonics body deltas are cached, so that the remaining bodies only read
+    * that shared state. If the gravity manager does not share frame offsets,
+    * a warning is issued and this flag is cleared.
+    */
+   bool parallel_gravitation; //!< trick_units(--)
+
+   /**
+    * Evaluate batchable gravity controls (see GravityControls::batchable)
+    * as one multi-point batch per source, integration frame, and settings
+    * rather than body by body? Root bodies that integrate together, such
+    * as the DynBody of a PropagatedPlanet alongside vehicles, then share the
+    * per-source setup. Other controls are evaluated body by body. The sum
+    * over sources may differ from the default by round-off. Ignored when
+    * gravitation is evaluated in parallel.
+    * For an ensemble of near-identical vehicles, set this and
+    * batch_translation and set lane_batch on the vehicles' spherical
+    * harmonics gravity controls: the non-spherical field is then evaluated
+    * for several vehicles at once in SIMD lanes.
+    */
+   bool batch_gravitation; //!< trick_units(--)
+
+   /**
+    * Multirate rate hint: the largest step the group's bodies should take.
+    * Zero means no limit. The multirate scheduler divides each integration
+    * cycle into enough sub-steps to honor this limit.
+    */
+   double max_step_hint; //!< trick_units(s)
+
+   /**
+    * Multirate error hint: the most recent local error estimate for the
+    * group, normalized so that one means at tolerance, or zero if none.
+    * Set by a model that monitors the group's accuracy; the multirate
+    * scheduler consumes (and clears) the value at the start of each cycle.
+    */
+   double error_hint; //!< trick_units(--)
+
+   /**
+    * Raise error_hint to the largest step error estimate reported by the
+    * root bodies' translational integrators (see StepErrorEstimator), such
+    * as Gauss-Jackson with a step_error_tolerance. Ignored for batched
+    * translation.
+    */
+   bool integrator_error_hint; //!< trick_units(--)
+
+   /**
+    * Upper limit on the number of sub-steps per integration cycle.
+    */
+   unsigned int max_substeps; //!< trick_units(--)
+
+   /**
+    * Number of sub-steps per integration cycle, as most recently selected
+    * by the multirate scheduler. Always a power of two.
+    */
+   unsigned int substeps; //!< trick_units(--)
+
+   /**
+    * Floor on the sub-step count from the rate hint and the bodies' Sundman
+    * steps, as most recently computed by the multirate scheduler.
+    */
+   unsigned int floor_substeps; //!< trick_units(--)
+
 
 protected:
 
@@ -219,6 +341,52 @@ protected:
    // internal state to indicate that they have no history data.
    void reset_body_integrators (void) override;
 
+   // Integrate the group's translational states as a batch, then the
+   // remaining state of each body.
+   er7_utils::IntegratorResult integrate_bodies_batched (
+      double cycle_dyndt,
+      unsigned int target_stage);
+
+   // Rebuild the translational batch when its membership has changed.
+   void update_translation_batch (void);
+
+   // Release the translational batch integrator and buffers.
+   void release_translation_batch (void);
+
+   // Record the root bodies' states at the start of an integration step.
+   void begin_dense_output_step (void);
+
+   // Record the root bodies' states at the end of an integration step.
+   void end_dense_output_step (
+      double cycle_dyndt,
+      const er7_utils::IntegratorResult & status);
+
+   // Rebuild the list of root bodies and return the thread pool,
+   // or null if derivatives are to be evaluated serially.
+   DerivativeThreadPool * prepare_parallel_derivatives (void);
+
+   // Compute the root bodies' gravitation with batchable controls
+   // evaluated in batches.
+   void batched_gravitation (GravityManager & gravity_manager);
+
+
+   // Member types
+
+   /**
+    * A batchable gravity control and the root body it belongs to.
+    */
+   struct GravityBatchEntry {
+      /**
+       * The control.
+       */
+      GravityControls * control; //!< trick_io(**)
+
+      /**
+       * Index of the body in root_bodies.
+       */
+      unsigned int body_index; //!< trick_io(**)
+   };
+
 
    // Member data
 
@@ -227,6 +395,12 @@ protected:
     */
    JeodPointerVector<DynBody>::type dyn_bodies; //!< trick_io(**)
 
+   /**
+    * Positions of the bodies in dyn_bodies, for constant-time addition and
+    * removal.
+    */
+   PositionIndex<DynBody> dyn_body_positions; //!< trick_io(**)
+
    /**
     * This flag is always true for JEOD integration groups.
     * Setting this flag to false results in bypassing the call in
@@ -237,6 +411,61 @@ protected:
     */
    bool bodies_integrated_separately; //!< trick_units(--)
 
+   /**
+    * Root bodies whose translational state is in the batch, in batch order.
+    */
+   std::vector<DynBody *> trans_batch_bodies; //!< trick_io(**)
+
+   /**
+    * Scratch list used to detect batch membership changes.
+    */
+   std::vector<DynBody *> trans_batch_candidates; //!< trick_io(**)
+
+   /**
+    * Number of bodies the batch buffers and integrator are sized for.
+    */
+   unsigned int trans_batch_capacity; //!< trick_io(**)
+
+   /**
+    * Batched positions, stored by axis: element k*N+i is axis k of body i.
+    */
+   double * trans_batch_position; //!< trick_io(**)
+
+   /**
+    * Batched velocities, in the same layout as trans_batch_position.
+    */
+   double * trans_batch_velocity; //!< trick_io(**)
+
+   /**
+    * Batched accelerations, in the same layout as trans_batch_position.
+    */
+   double * trans_batch_accel; //!< trick_io(**)
+
+   /**
+    * State integrator for the batched translational state.
+    */
+   er7_utils::SecondOrderODEIntegrator * trans_batch_integrator; //!< trick_io(**)
+
+   /**
+    * Root bodies in group order, used by the parallel derivative phases.
+    */
+   std::vector<DynBody *> root_bodies; //!< trick_io(**)
+
+   /**
+    * Worker threads for the parallel derivative phases, created on first use.
+    */
+   DerivativeThreadPool * thread_pool; //!< trick_io(**)
+
+   /**
+    * Batchable gravity controls of the root bodies, grouped into batches.
+    */
+   std::vector<GravityBatchEntry> grav_batch_entries; //!< trick_io(**)
+
+   /**
+    * Positions and results of the gravity batch being evaluated.
+    */
+   std::vector<double> grav_batch_data; //!< trick_io(**)
+
 
 private:
 
@@ -0,0 +1,368 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/include/energy_monitor.hh
+ * Define the classes EnergyMonitorEntry and EnergyMonitor, which track the
+ * specific orbital energy and Jacobi constant of a set of bodies.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Only the named planet's gravity is included, as the static field of its
+    spherical harmonics source or as a point mass.)
+   (The Jacobi constant is conserved only if the planet rotates uniformly
+    and its field is static; the energy only if the field is also
+    axisymmetric.)
+   (In background mode the source's recursion tables must not be rebuilt,
+    nor its coefficients changed, while a sample is being evaluated.))
+
+Library dependencies:
+  ((../src/energy_monitor.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_ENERGY_MONITOR_HH
+#define JEOD_ENERGY_MONITOR_HH
+
+// System includes
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+class Planet;
+class SphericalHarmonicsGravitySource;
+
+
+/**
+ * The conservation diagnostics of one monitored body.
+ */
+class EnergyMonitorEntry {
+
+   JEOD_MAKE_SIM_INTERFACES(EnergyMonitorEntry)
+
+public:
+
+   /**
+    * The monitored body.
+    */
+   DynBody * body; //!< trick_units(--)
+
+   /**
+    * Time of the sample from which the values were computed, in the time
+    * scale passed to EnergyMonitor::update().
+    */
+   double time; //!< trick_units(s)
+
+   /**
+    * Specific orbital energy with respect to the planet's inertial frame.
+    */
+   double energy; //!< trick_units(m2/s2)
+
+   /**
+    * Jacobi constant (specific energy in the planet-fixed frame, including
+    * the centrifugal potential).
+    */
+   double jacobi_constant; //!< trick_units(m2/s2)
+
+   /**
+    * Energy at the first sample.
+    */
+   double initial_energy; //!< trick_units(m2/s2)
+
+   /**
+    * Jacobi constant at the first sample.
+    */
+   double initial_jacobi; //!< trick_units(m2/s2)
+
+   /**
+    * Change in energy since the first sample.
+    */
+   double energy_change; //!< trick_units(m2/s2)
+
+   /**
+    * Change in the Jacobi constant since the first sample.
+    */
+   double jacobi_change; //!< trick_units(m2/s2)
+
+   /**
+    * Set once the first sample has been evaluated.
+    */
+   bool valid; //!< trick_units(--)
+
+   EnergyMonitorEntry ()
+   :
+      body(nullptr),
+      time(0.0),
+      energy(0.0),
+      jacobi_constant(0.0),
+      initial_energy(0.0),
+      initial_jacobi(0.0),
+      energy_change(0.0),
+      jacobi_change(0.0),
+      valid(false)
+   { }
+};
+
+
+/**
+ * Monitors energy and Jacobi constant conservation for a set of bodies.
+ * Each update() samples the bodies' states relative to a planet, a cheap
+ * operation on the calling thread, and evaluates the planet's potential at
+ * the sampled positions with the potential-only spherical harmonics kernel.
+ * In background mode the potentials are evaluated on a worker thread and
+ * published by the next update(), so the values lag by one update; an
+ * update that finds the worker still busy skips its sample rather than
+ * wait. Schedule update() at whatever low rate the diagnostics need.
+ */
+class EnergyMonitor {
+
+   JEOD_MAKE_SIM_INTERFACES(EnergyMonitor)
+
+public:
+
+   // Member data
+
+   /**
+    * Name of the planet whose gravity field is evaluated.
+    */
+   std::string planet_name; //!< trick_units(--)
+
+   /**
+    * Degree of the field evaluation. Zero selects the degree and order of
+    * the planet's spherical harmonics source.
+    */
+   unsigned int degree; //!< trick_units(--)
+
+   /**
+    * Order of the field evaluation.
+    */
+   unsigned int order; //!< trick_units(--)
+
+   /**
+    * Evaluate the potentials on a worker thread? The default is true.
+    */
+   bool background; //!< trick_units(--)
+
+
+   // Member functions
+
+   EnergyMonitor ();
+
+   ~EnergyMonitor ();
+
+   // Add a body to be monitored.
+   void add_body (DynBody & body);
+
+   // Find the planet and its gravity source.
+   void initialize (DynManager & manager);
+
+   // Publish the last evaluated sample and take a new one.
+   void update (double time);
+
+   // Wait for the pending sample, if any, and publish it.
+   void flush ();
+
+   /**
+    * Get the number of monitored bodies.
+    * @return Body count
+    */
+   unsigned int get_num_entries () const
+   {
+      return static_cast<unsigned int> (entries.size());
+   }
+
+   /**
+    * Get a monitored body's diagnostics.
+    * @return Entry
+    * \param[in] index Entry index, less than get_num_entries()
+    */
+   const EnergyMonitorEntry & get_entry (unsigned int index) const
+   {
+      return entries[index];
+   }
+
+   /**
+    * Get the number of samples skipped because the worker was busy.
+    * @return Skipped sample count
+    */
+   unsigned int get_num_skipped () const
+   {
+      return num_skipped;
+   }
+
+
+protected:
+
+   /**
+    * A body's state as needed for the diagnostics.
+    */
+   struct Sample {
+      double posn_pf[3];       //!< Position, planet-fixed coords
+      double vel_inrtl_sq;     //!< Squared speed wrt planet inertial
+      double vel_pfix_sq;      //!< Squared speed wrt planet-fixed
+      double rot_vel_sq;       //!< Squared speed of the frame point
+      double potential;        //!< Potential, once evaluated
+   };
+
+   // Sample the bodies' states.
+   void capture (double time);
+
+   // Evaluate the potentials of the captured samples.
+   void evaluate ();
+
+   // Form the diagnostics from the evaluated samples.
+   void publish ();
+
+   // Worker thread main loop.
+   void worker_loop ();
+
+   /**
+    * The diagnostics, one per monitored body.
+    */
+   std::vector<EnergyMonitorEntry> entries; //!< trick_io(**)
+
+   /**
+    * The samples being or last evaluated, one per monitored body.
+    */
+   std::vector<Sample> samples; //!< trick_io(**)
+
+   /**
+    * Scratch storage for the potential kernel.
+    */
+   std::vector<double> work; //!< trick_io(**)
+
+   /**
+    * The planet.
+    */
+   Planet * planet; //!< trick_units(--)
+
+   /**
+    * The planet's spherical harmonics gravity source, or null to treat the
+    * planet as a point mass.
+    */
+   const SphericalHarmonicsGravitySource * source; //!< trick_units(--)
+
+   /**
+    * Gravitational parameter of the planet.
+    */
+   double mu; //!< trick_units(m3/s2)
+
+   /**
+    * Time of the samples.
+    */
+   double sample_time; //!< trick_units(s)
+
+   /**
+    * Number of samples skipped because the worker was busy.
+    */
+   unsigned int num_skipped; //!< trick_units(count)
+
+   /**
+    * The worker thread, started by the first background update.
+    */
+   std::thread worker; //!< trick_io(**)
+
+   /**
+    * Guards the flags below.
+    */
+   std::mutex mutex; //!< trick_io(**)
+
+   /**
+    * Signals the worker that a sample (or shutdown) is available, and the
+    * caller that a sample has been evaluated.
+    */
+   std::condition_variable cond; //!< trick_io(**)
+
+   /**
+    * Set while the samples await or undergo evaluation.
+    */
+   bool pending; //!< trick_io(**)
+
+   /**
+    * Set when evaluated samples await publication.
+    */
+   bool evaluated; //!< trick_io(**)
+
+   /**
+    * Set to tell the worker to exit.
+    */
+   bool shutdown; //!< trick_io(**)
+
+
+private:
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   EnergyMonitor (const EnergyMonitor &);
+   EnergyMonitor & operator= (const EnergyMonitor &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
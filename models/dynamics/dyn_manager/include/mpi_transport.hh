@@ -0,0 +1,159 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/include/mpi_transport.hh
+ * Define the class MpiTransport.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/mpi_transport.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_MPI_TRANSPORT_HH
+#define JEOD_MPI_TRANSPORT_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "distributed_transport.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A DistributedTransport over MPI_COMM_WORLD.
+ * MPI support is compiled in when JEOD_HAVE_MPI is defined (the JEOD_MPI
+ * build option); without it, initialize fails.
+ */
+class MpiTransport : public DistributedTransport {
+JEOD_MAKE_SIM_INTERFACES(MpiTransport)
+
+public:
+
+   // Constructor and destructor.
+   MpiTransport ();
+   ~MpiTransport () override;
+
+   // Initialize MPI if the simulation has not done so.
+   void initialize ();
+
+   // Get this process's rank.
+   unsigned int get_rank () const override;
+
+   // Get the number of ranks.
+   unsigned int get_num_ranks () const override;
+
+   // Gather every rank's values on all ranks.
+   void all_gather (
+      const double * send,
+      unsigned int send_count,
+      double * recv,
+      const unsigned int * recv_counts) override;
+
+
+private:
+
+   /**
+    * This process's rank.
+    */
+   unsigned int rank; //!< trick_io(**)
+
+   /**
+    * Number of ranks.
+    */
+   unsigned int num_ranks; //!< trick_io(**)
+
+   /**
+    * Did initialize initialize MPI? If so, the destructor finalizes it.
+    */
+   bool owns_mpi; //!< trick_io(**)
+
+   /**
+    * all_gather receive counts, as MPI wants them.
+    */
+   std::vector<int> counts; //!< trick_io(**)
+
+   /**
+    * all_gather receive displacements.
+    */
+   std::vector<int> displacements; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   MpiTransport (const MpiTransport &);
+
+   /**
+    * Not implemented.
+    */
+   MpiTransport & operator= (const MpiTransport &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
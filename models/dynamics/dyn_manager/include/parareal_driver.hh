@@ -0,0 +1,277 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/include/parareal_driver.hh
+ * Define the classes PararealPropagator and PararealDriver, which propagate
+ * a state over a long interval by parallel-in-time (Parareal) iteration.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Lions, J.-L., Maday, Y., and Turinici, G.)
+    (A "parareal" in time discretization of PDE's)
+    (Comptes Rendus de l'Academie des Sciences, Series I, 332)
+    (2001)))
+
+Assumptions and limitations:
+  ((The propagators propagate a self-contained state vector; the driver does
+    not propagate the simulation's DynBody states.)
+   (Each fine propagator is used by one slice only and may run concurrently
+    with the other fine propagators.))
+
+Library dependencies:
+  ((../src/parareal_driver.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_PARAREAL_DRIVER_HH
+#define JEOD_PARAREAL_DRIVER_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DerivativeThreadPool;
+
+
+/**
+ * Propagates a state vector from one time to another. The Parareal driver
+ * uses a cheap, approximate coarse propagator and an accurate fine
+ * propagator per time slice.
+ */
+class PararealPropagator {
+JEOD_MAKE_SIM_INTERFACES(PararealPropagator)
+
+public:
+
+   /**
+    * Destructor.
+    */
+   virtual ~PararealPropagator () {}
+
+   /**
+    * Propagate a state.
+    * @param[in]  start_time  Start time, in seconds.
+    * @param[in]  end_time    End time, in seconds.
+    * @param[in]  state_in    State at the start time.
+    * @param[out] state_out   State at the end time.
+    * @return True on success.
+    */
+   virtual bool propagate (
+      double start_time,
+      double end_time,
+      const double * state_in,
+      double * state_out) = 0;
+};
+
+
+/**
+ * Propagates a state over an interval divided into equal time slices, one
+ * per fine propagator, by Parareal iteration. A serial coarse sweep provides
+ * the slices' initial states; each iteration then propagates the slices
+ * with the fine propagators in parallel and corrects the slice states with
+ * a serial coarse sweep,
+ *   U(i+1) = G(U(i)) + F(U_old(i)) - G(U_old(i)),
+ * until the slice states stop changing. After k iterations the first k
+ * slices are exact (equal to serial fine propagation), so the iteration
+ * always converges within one iteration per slice; the speedup comes from
+ * converging in far fewer.
+ */
+class PararealDriver {
+JEOD_MAKE_SIM_INTERFACES(PararealDriver)
+
+public:
+
+   // Member data
+
+   /**
+    * Convergence tolerance: the iteration stops when no slice state element
+    * changes by more than this times the largest slice state element.
+    */
+   double tolerance; //!< trick_units(--)
+
+   /**
+    * Maximum number of Parareal iterations; zero means one per slice.
+    */
+   unsigned int max_iterations; //!< trick_units(--)
+
+   /**
+    * Number of threads used for the fine propagations, including the
+    * calling thread. Zero or one propagates the slices serially.
+    */
+   unsigned int num_threads; //!< trick_units(--)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   PararealDriver ();
+   ~PararealDriver ();
+
+   // Set the coarse propagator.
+   void set_coarse_propagator (PararealPropagator & propagator);
+
+   // Add a fine propagator, which adds a time slice.
+   void add_fine_propagator (PararealPropagator & propagator);
+
+   // Propagate a state over an interval.
+   bool propagate (
+      unsigned int state_size,
+      double start_time,
+      double end_time,
+      const double * initial_state,
+      double * final_state);
+
+   // Get the state at the start of a slice from the most recent propagation.
+   const double * get_slice_state (unsigned int slice) const;
+
+   /**
+    * Get the number of iterations used by the most recent propagation.
+    * @return Iteration count.
+    */
+   unsigned int get_iterations () const
+   {
+      return iterations;
+   }
+
+   // Propagate a slice with its fine propagator (called by worker threads).
+   void propagate_fine_slice (unsigned int slice);
+
+
+private:
+
+   // Create, resize, or release the thread pool per num_threads.
+   DerivativeThreadPool * prepare_thread_pool ();
+
+
+   // Member data
+
+   /**
+    * The coarse propagator.
+    */
+   PararealPropagator * coarse; //!< trick_units(--)
+
+   /**
+    * The fine propagators, one per slice.
+    */
+   std::vector<PararealPropagator *> fine; //!< trick_io(**)
+
+   /**
+    * Thread pool for the fine propagations.
+    */
+   DerivativeThreadPool * thread_pool; //!< trick_io(**)
+
+   /**
+    * State size of the most recent propagation.
+    */
+   unsigned int size; //!< trick_units(--)
+
+   /**
+    * Number of iterations used by the most recent propagation.
+    */
+   unsigned int iterations; //!< trick_units(--)
+
+   /**
+    * First slice not yet known to be exact; slices before it are skipped.
+    */
+   unsigned int first_open; //!< trick_io(**)
+
+   /**
+    * Slice boundary times.
+    */
+   std::vector<double> times; //!< trick_io(**)
+
+   /**
+    * Slice start states plus the final state, one block of size per slice.
+    */
+   std::vector<double> states; //!< trick_io(**)
+
+   /**
+    * Coarse and fine propagations of each slice's start state.
+    */
+   std::vector<double> coarse_out; //!< trick_io(**)
+   std::vector<double> fine_out; //!< trick_io(**)
+
+   /**
+    * Fine propagation status per slice.
+    */
+   std::vector<char> fine_ok; //!< trick_io(**)
+
+   /**
+    * Scratch state.
+    */
+   std::vector<double> scratch; //!< trick_io(**)
+
+
+   // Make the copy constructor and assignment operator private
+   // (and unimplemented) to avoid erroneous copies
+   PararealDriver (const PararealDriver &);
+   PararealDriver & operator= (const PararealDriver &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,213 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/src/derivative_thread_pool.cc
+ * Define DerivativeThreadPool methods.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((derivative_thread_pool.cc))
+
+
+******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// Model includes
+#include "../include/derivative_thread_pool.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * DerivativeThreadPool constructor.
+ * Starts nthreads-1 worker threads; the calling thread is the remaining one.
+ * @param[in] nthreads  Total number of threads; zero is treated as one.
+ */
+DerivativeThreadPool::DerivativeThreadPool (
+   unsigned int nthreads)
+:
+   num_threads ((nthreads > 0) ? nthreads : 1),
+   workers (),
+   mutex (),
+   start_cond (),
+   done_cond (),
+   task (nullptr),
+   num_items (0),
+   generation (0),
+   pending (0),
+   shutdown (false)
+{
+   workers.reserve (num_threads - 1);
+   for (unsigned int ii = 1; ii < num_threads; ++ii) {
+      workers.push_back (
+         std::thread (&DerivativeThreadPool::worker_loop, this, ii));
+   }
+}
+
+
+/**
+ * DerivativeThreadPool destructor. Stops and joins the workers.
+ */
+DerivativeThreadPool::~DerivativeThreadPool ()
+{
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      shutdown = true;
+   }
+   start_cond.notify_all ();
+
+   for (std::vector<std::thread>::iterator it = workers.begin();
+        it != workers.end();
+        ++it) {
+      it->join ();
+   }
+}
+
+
+/**
+ * Make a pool of nthreads threads available, creating the pool or replacing
+ * a pool of a different size. Owners hold the pool by pointer and destroy it
+ * with release.
+ * @return The pool.
+ * @param[in,out] pool      Owner's pool pointer, possibly null.
+ * @param[in]     nthreads  Total number of threads.
+ */
+DerivativeThreadPool *
+DerivativeThreadPool::acquire (
+   DerivativeThreadPool *& pool,
+   unsigned int nthreads)
+{
+   unsigned int wanted = (nthreads > 0) ? nthreads : 1;
+
+   if ((pool != nullptr) && (pool->get_num_threads() != wanted)) {
+      release (pool);
+   }
+   if (pool == nullptr) {
+      pool = new DerivativeThreadPool (wanted);
+   }
+   return pool;
+}
+
+
+/**
+ * Destroy a pool obtained from acquire and null the owner's pointer.
+ * @param[in,out] pool  Owner's pool pointer, possibly null.
+ */
+void
+DerivativeThreadPool::release (
+   DerivativeThreadPool *& pool)
+{
+   delete pool;
+   pool = nullptr;
+}
+
+
+/**
+ * Execute the task for indices 0 to nitems-1 and wait for completion.
+ * @param[in]     nitems  Number of items.
+ * @param[in,out] new_task  Task to be executed.
+ */
+void
+DerivativeThreadPool::run (
+   unsigned int nitems,
+   DerivativeThreadTask & new_task)
+{
+   // Serial execution: no workers, or too few items to share.
+   if (workers.empty() || (nitems < 2)) {
+      for (unsigned int ii = 0; ii < nitems; ++ii) {
+         new_task.execute (ii);
+      }
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      task = &new_task;
+      num_items = nitems;
+      pending = workers.size();
+      ++generation;
+   }
+   start_cond.notify_all ();
+
+   // The calling thread executes block zero.
+   run_block (0);
+
+   std::unique_lock<std::mutex> lock (mutex);
+   while (pending > 0) {
+      done_cond.wait (lock);
+   }
+   task = nullptr;
+}
+
+
+/**
+ * Execute one thread's block of the current task.
+ * Thread t processes items [t*n/T, (t+1)*n/T).
+ * @param[in] thread_index  Thread index, zero for the calling thread.
+ */
+void
+DerivativeThreadPool::run_block (
+   unsigned int thread_index)
+{
+   unsigned long nitems = num_items;
+   unsigned int begin = (thread_index * nitems) / num_threads;
+   unsigned int end = ((thread_index + 1) * nitems) / num_threads;
+
+   for (unsigned int ii = begin; ii < end; ++ii) {
+      task->execute (ii);
+   }
+}
+
+
+/**
+ * Worker thread main loop.
+ * @param[in] thread_index  Thread index, 1 to num_threads-1.
+ */
+void
+DerivativeThreadPool::worker_loop (
+   unsigned int thread_index)
+{
+   unsigned long seen_generation = 0;
+
+   for (;;) {
+      {
+         std::unique_lock<std::mutex> lock (mutex);
+         while ((! shutdown) && (generation == seen_generation)) {
+            start_cond.wait (lock);
+         }
+         if (shutdown) {
+            return;
+         }
+         seen_generation = generation;
+      }
+
+      run_block (thread_index);
+
+      {
+         std::lock_guard<std::mutex> lock (mutex);
+         --pending;
+      }
+      done_cond.notify_one ();
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
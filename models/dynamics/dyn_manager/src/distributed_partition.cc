@@ -0,0 +1,663 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/src/distributed_partition.cc
+ * Define member functions for the class DistributedPartition.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((distributed_partition.cc)
+   (dyn_manager_messages.cc)
+   (integ_group_primitives.cc)
+   (dynamics_integration_group.cc)
+   (dynamics/dyn_body/src/dyn_body_set_state.cc)
+   (dynamics/dyn_body/src/dyn_body_propagate_state.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame_items.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/distributed_partition.hh"
+#include "../include/distributed_transport.hh"
+#include "../include/dyn_manager.hh"
+#include "../include/dyn_manager_messages.hh"
+#include "../include/dynamics_integration_group.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Orders body indices by decreasing cost, and by index among equal costs,
+ * so that every rank computes the same assignment.
+ */
+class CostOrder {
+public:
+
+   /**
+    * Constructor.
+    * \param[in] costs_in Per-body costs
+    */
+   explicit CostOrder (const std::vector<double> & costs_in)
+   :
+      costs(costs_in)
+   { }
+
+   /**
+    * Does body lhs precede body rhs?
+    * @return True if lhs precedes rhs
+    * \param[in] lhs Body index
+    * \param[in] rhs Body index
+    */
+   bool operator() (unsigned int lhs, unsigned int rhs) const
+   {
+      if (costs[lhs] != costs[rhs]) {
+         return costs[lhs] > costs[rhs];
+      }
+      return lhs < rhs;
+   }
+
+private:
+
+   /**
+    * Per-body costs.
+    */
+   const std::vector<double> & costs;
+};
+
+} // End anonymous namespace
+
+
+const unsigned int DistributedPartition::state_size;
+
+
+/**
+ * DistributedPartition default constructor.
+ */
+DistributedPartition::DistributedPartition ()
+:
+   IntegrationCycleObserver(),
+   rebalance_interval(0),
+   imbalance_tolerance(0.1),
+   dyn_manager(nullptr),
+   transport(nullptr),
+   bodies(),
+   shared_requests(),
+   exchange_order(),
+   exchange_counts(),
+   send_buffer(),
+   recv_buffer(),
+   cycles_since_rebalance(0)
+{
+   ; // Empty
+}
+
+
+/**
+ * DistributedPartition destructor.
+ */
+DistributedPartition::~DistributedPartition ()
+{
+   shutdown ();
+}
+
+
+/**
+ * Share a body's state with all ranks. Sharing an attached body shares the
+ * root body to which it is attached.
+ * \param[in] body Body whose state other ranks need
+ */
+void
+DistributedPartition::add_shared_body (
+   DynBody & body)
+{
+   if (dyn_manager == nullptr) {
+      shared_requests.push_back (&body);
+      return;
+   }
+
+   int index = find_body (body);
+   if (index < 0) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "DynBody '%s' is not registered with the dynamics manager.",
+         body.name.c_str());
+      return;
+   }
+
+   if (! bodies[index].shared) {
+      bodies[index].shared = true;
+      build_exchange_order ();
+   }
+}
+
+
+/**
+ * Partition the root bodies registered with the dynamics manager across the
+ * ranks and register with the dynamics manager. Bodies are attached to one
+ * another and assigned to integration groups before this is called.
+ * \param[in,out] manager The dynamics manager
+ * \param[in,out] transport_in Transport connecting the ranks
+ */
+void
+DistributedPartition::initialize (
+   DynManager & manager,
+   DistributedTransport & transport_in)
+{
+   if (dyn_manager != nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "The distributed partition has already been initialized.");
+      return;
+   }
+
+   dyn_manager = &manager;
+   transport = &transport_in;
+
+   // Group the bodies into trees, one per root body.
+   std::vector<DynBody *> all_bodies = manager.get_dyn_bodies();
+   for (std::vector<DynBody *>::const_iterator it = all_bodies.begin();
+        it != all_bodies.end();
+        ++it) {
+      if ((*it)->is_root_body()) {
+         Body body;
+         body.root = *it;
+         body.owner = 0;
+         body.shared = false;
+         bodies.push_back (body);
+      }
+   }
+   for (std::vector<DynBody *>::const_iterator it = all_bodies.begin();
+        it != all_bodies.end();
+        ++it) {
+      int index = find_body (**it);
+      if (index >= 0) {
+         bodies[index].tree.push_back (*it);
+         bodies[index].groups.push_back (
+            (*it)->get_dynamics_integration_group());
+      }
+   }
+
+   // All ranks must be partitioning the same bodies.
+   unsigned int num_ranks = transport->get_num_ranks();
+   double num_bodies = bodies.size();
+   std::vector<double> rank_num_bodies (num_ranks);
+   std::vector<unsigned int> ones (num_ranks, 1);
+   transport->all_gather (&num_bodies, 1, rank_num_bodies.data(), ones.data());
+   for (unsigned int ii = 0; ii < num_ranks; ++ii) {
+      if (rank_num_bodies[ii] != num_bodies) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+            "Rank %u has %g root bodies; rank %u has %g.",
+            ii, rank_num_bodies[ii], transport->get_rank(), num_bodies);
+         return;
+      }
+   }
+
+   // Initially, all bodies are assumed to cost the same.
+   std::vector<double> costs (bodies.size(), 1.0);
+   std::vector<unsigned int> owners;
+   assign (costs, owners);
+   for (unsigned int ii = 0; ii < bodies.size(); ++ii) {
+      bodies[ii].owner = owners[ii];
+      if (owners[ii] != transport->get_rank()) {
+         set_local (bodies[ii], false);
+      }
+   }
+
+   for (std::vector<DynBody *>::const_iterator it = shared_requests.begin();
+        it != shared_requests.end();
+        ++it) {
+      int index = find_body (**it);
+      if (index >= 0) {
+         bodies[index].shared = true;
+      }
+      else {
+         MessageHandler::error (
+            __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+            "DynBody '%s' is not registered with the dynamics manager.",
+            (*it)->name.c_str());
+      }
+   }
+   shared_requests.clear ();
+   build_exchange_order ();
+
+   if (rebalance_interval > 0) {
+      manager.set_body_cost_tracking (true);
+      manager.reset_body_costs ();
+   }
+   cycles_since_rebalance = 0;
+
+   manager.add_cycle_observer (*this);
+}
+
+
+/**
+ * Find the entry for a body's root body.
+ * @return Index of the entry, or -1 if there is none
+ * \param[in] body Body
+ */
+int
+DistributedPartition::find_body (
+   const DynBody & body)
+const
+{
+   const DynBody * root = body.get_root_body();
+
+   for (unsigned int ii = 0; ii < bodies.size(); ++ii) {
+      if (bodies[ii].root == root) {
+         return ii;
+      }
+   }
+
+   return -1;
+}
+
+
+/**
+ * Is the body integrated by this rank? Bodies that are not partitioned are
+ * considered local.
+ * @return True if this rank integrates the body
+ * \param[in] body Body
+ */
+bool
+DistributedPartition::is_local (
+   const DynBody & body)
+const
+{
+   int index = find_body (body);
+   return (index < 0) || (transport == nullptr) ||
+          (bodies[index].owner == transport->get_rank());
+}
+
+
+/**
+ * Get the rank that integrates a body.
+ * @return Rank, or -1 if the body is not partitioned
+ * \param[in] body Body
+ */
+int
+DistributedPartition::get_owner (
+   const DynBody & body)
+const
+{
+   int index = find_body (body);
+   return (index < 0) ? -1 : static_cast<int>(bodies[index].owner);
+}
+
+
+/**
+ * Get the number of root bodies this rank integrates.
+ * @return Number of local root bodies
+ */
+unsigned int
+DistributedPartition::get_num_local_bodies ()
+const
+{
+   unsigned int count = 0;
+
+   if (transport != nullptr) {
+      for (unsigned int ii = 0; ii < bodies.size(); ++ii) {
+         if (bodies[ii].owner == transport->get_rank()) {
+            ++count;
+         }
+      }
+   }
+
+   return count;
+}
+
+
+/**
+ * Assign the bodies to ranks: each body, most expensive first, goes to the
+ * rank with the least load so far.
+ * \param[in] costs Per-body costs
+ * \param[out] owners Per-body ranks
+ */
+void
+DistributedPartition::assign (
+   const std::vector<double> & costs,
+   std::vector<unsigned int> & owners)
+const
+{
+   unsigned int num_ranks = transport->get_num_ranks();
+   std::vector<unsigned int> order (costs.size());
+   std::vector<double> loads (num_ranks, 0.0);
+
+   for (unsigned int ii = 0; ii < order.size(); ++ii) {
+      order[ii] = ii;
+   }
+   std::sort (order.begin(), order.end(), CostOrder (costs));
+
+   owners.assign (costs.size(), 0);
+   for (unsigned int ii = 0; ii < order.size(); ++ii) {
+      unsigned int target = 0;
+      for (unsigned int rank = 1; rank < num_ranks; ++rank) {
+         if (loads[rank] < loads[target]) {
+            target = rank;
+         }
+      }
+      owners[order[ii]] = target;
+      loads[target] += costs[order[ii]];
+   }
+}
+
+
+/**
+ * Make this rank integrate a body, or stop it from doing so, by adding the
+ * body's tree to or removing it from its integration groups.
+ * \param[in,out] body Body
+ * \param[in] local Should this rank integrate the body?
+ */
+void
+DistributedPartition::set_local (
+   Body & body,
+   bool local)
+{
+   for (unsigned int ii = 0; ii < body.tree.size(); ++ii) {
+      DynamicsIntegrationGroup * group = body.groups[ii];
+      if (group == nullptr) {
+         continue;
+      }
+      if (local) {
+         group->add_dyn_body (*body.tree[ii]);
+      }
+      else {
+         group->delete_dyn_body (*body.tree[ii]);
+      }
+   }
+
+   if (local) {
+      body.root->reset_integrators ();
+   }
+}
+
+
+/**
+ * Build the exchange order, the shared bodies ordered by owner and then by
+ * index, and the number of values each rank sends.
+ */
+void
+DistributedPartition::build_exchange_order ()
+{
+   unsigned int num_ranks = transport->get_num_ranks();
+
+   exchange_order.clear ();
+   exchange_counts.assign (num_ranks, 0);
+   for (unsigned int rank = 0; rank < num_ranks; ++rank) {
+      for (unsigned int ii = 0; ii < bodies.size(); ++ii) {
+         if (bodies[ii].shared && (bodies[ii].owner == rank)) {
+            exchange_order.push_back (ii);
+            exchange_counts[rank] += state_size;
+         }
+      }
+   }
+
+   send_buffer.resize (exchange_counts[transport->get_rank()]);
+   recv_buffer.resize (exchange_order.size() * state_size);
+}
+
+
+/**
+ * Pack a root body's composite body state.
+ * \param[in] body Root body
+ * \param[out] buffer Packed state, state_size values
+ */
+void
+DistributedPartition::pack_state (
+   const DynBody & body,
+   double * buffer)
+{
+   const RefFrameState & state = body.composite_body.state;
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      buffer[ii]    = state.trans.position[ii];
+      buffer[ii+3]  = state.trans.velocity[ii];
+      buffer[ii+7]  = state.rot.Q_parent_this.vector[ii];
+      buffer[ii+10] = state.rot.ang_vel_this[ii];
+   }
+   buffer[6] = state.rot.Q_parent_this.scalar;
+}
+
+
+/**
+ * Set a root body's composite body state from a packed state and propagate
+ * it to the body's frames and attached bodies.
+ * \param[in] buffer Packed state, state_size values
+ * \param[in,out] body Root body
+ */
+void
+DistributedPartition::unpack_state (
+   const double * buffer,
+   DynBody & body)
+{
+   RefFrameState state;
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      state.trans.position[ii]          = buffer[ii];
+      state.trans.velocity[ii]          = buffer[ii+3];
+      state.rot.Q_parent_this.vector[ii] = buffer[ii+7];
+      state.rot.ang_vel_this[ii]        = buffer[ii+10];
+   }
+   state.rot.Q_parent_this.scalar = buffer[6];
+
+   body.set_state (RefFrameItems::Pos_Vel_Att_Rate, state, body.composite_body);
+   body.propagate_state ();
+}
+
+
+/**
+ * Exchange the states of the shared bodies: each rank sends the states of
+ * the shared bodies it owns and updates those it does not.
+ */
+void
+DistributedPartition::exchange ()
+{
+   if (dyn_manager == nullptr) {
+      return;
+   }
+
+   unsigned int rank = transport->get_rank();
+   double * send = send_buffer.data();
+   for (unsigned int ii = 0; ii < exchange_order.size(); ++ii) {
+      const Body & body = bodies[exchange_order[ii]];
+      if (body.owner == rank) {
+         pack_state (*body.root, send);
+         send += state_size;
+      }
+   }
+
+   transport->all_gather (send_buffer.data(), send_buffer.size(),
+                          recv_buffer.data(), exchange_counts.data());
+
+   const double * recv = recv_buffer.data();
+   for (unsigned int ii = 0; ii < exchange_order.size(); ++ii) {
+      Body & body = bodies[exchange_order[ii]];
+      if (body.owner != rank) {
+         unpack_state (recv, *body.root);
+      }
+      recv += state_size;
+   }
+}
+
+
+/**
+ * Gather the accounted per-body costs and, if the load is imbalanced by
+ * more than imbalance_tolerance and a reassignment would reduce the
+ * imbalance, reassign the bodies and migrate the states of the bodies that
+ * change ranks. The cost accounts are reset in either case.
+ * @return True if bodies were reassigned
+ */
+bool
+DistributedPartition::rebalance ()
+{
+   if (dyn_manager == nullptr) {
+      return false;
+   }
+
+   unsigned int rank = transport->get_rank();
+   unsigned int num_ranks = transport->get_num_ranks();
+   unsigned int num_bodies = bodies.size();
+
+   // Gather the costs, each rank sending those of the bodies it owns.
+   std::vector<unsigned int> owned_order;
+   std::vector<unsigned int> counts (num_ranks, 0);
+   for (unsigned int owner = 0; owner < num_ranks; ++owner) {
+      for (unsigned int ii = 0; ii < num_bodies; ++ii) {
+         if (bodies[ii].owner == owner) {
+            owned_order.push_back (ii);
+            ++counts[owner];
+         }
+      }
+   }
+
+   std::vector<double> send;
+   for (unsigned int ii = 0; ii < num_bodies; ++ii) {
+      if (bodies[ii].owner == rank) {
+         send.push_back (bodies[ii].root->cost.total_time());
+      }
+   }
+   std::vector<double> gathered (num_bodies);
+   transport->all_gather (send.data(), send.size(),
+                          gathered.data(), counts.data());
+
+   std::vector<double> costs (num_bodies);
+   std::vector<double> loads (num_ranks, 0.0);
+   double total = 0.0;
+   for (unsigned int ii = 0; ii < num_bodies; ++ii) {
+      unsigned int index = owned_order[ii];
+      costs[index] = gathered[ii];
+      loads[bodies[index].owner] += gathered[ii];
+      total += gathered[ii];
+   }
+   dyn_manager->reset_body_costs ();
+
+   double max_load = *std::max_element (loads.begin(), loads.end());
+   if ((total <= 0.0) ||
+       (max_load <= (1.0 + imbalance_tolerance) * total / num_ranks)) {
+      return false;
+   }
+
+   std::vector<unsigned int> owners;
+   assign (costs, owners);
+   std::vector<double> new_loads (num_ranks, 0.0);
+   for (unsigned int ii = 0; ii < num_bodies; ++ii) {
+      new_loads[owners[ii]] += costs[ii];
+   }
+   double new_max_load = *std::max_element (new_loads.begin(), new_loads.end());
+   if (new_max_load * (1.0 + imbalance_tolerance) >= max_load) {
+      return false;
+   }
+
+   // Migrate: the old owners send the states of the bodies that move.
+   std::vector<unsigned int> moved;
+   counts.assign (num_ranks, 0);
+   for (unsigned int owner = 0; owner < num_ranks; ++owner) {
+      for (unsigned int ii = 0; ii < num_bodies; ++ii) {
+         if ((bodies[ii].owner == owner) && (owners[ii] != owner)) {
+            moved.push_back (ii);
+            counts[owner] += state_size;
+         }
+      }
+   }
+
+   send.assign (counts[rank], 0.0);
+   double * packed = send.data();
+   for (unsigned int ii = 0; ii < moved.size(); ++ii) {
+      if (bodies[moved[ii]].owner == rank) {
+         pack_state (*bodies[moved[ii]].root, packed);
+         packed += state_size;
+      }
+   }
+   gathered.resize (moved.size() * state_size);
+   transport->all_gather (send.data(), send.size(),
+                          gathered.data(), counts.data());
+
+   for (unsigned int ii = 0; ii < moved.size(); ++ii) {
+      Body & body = bodies[moved[ii]];
+      bool was_local = (body.owner == rank);
+      body.owner = owners[moved[ii]];
+      if (was_local) {
+         set_local (body, false);
+      }
+      else {
+         unpack_state (&gathered[ii * state_size], *body.root);
+         if (body.owner == rank) {
+            set_local (body, true);
+         }
+      }
+   }
+
+   build_exchange_order ();
+
+   return true;
+}
+
+
+/**
+ * Exchange the shared states after an integration cycle and, every
+ * rebalance_interval cycles, rebalance the load.
+ * \param[in] integ_group The group whose cycle is complete (unused)
+ */
+void
+DistributedPartition::integration_cycle_complete (
+   DynamicsIntegrationGroup & integ_group JEOD_UNUSED)
+{
+   exchange ();
+
+   if (rebalance_interval > 0) {
+      ++cycles_since_rebalance;
+      if (cycles_since_rebalance >= rebalance_interval) {
+         cycles_since_rebalance = 0;
+         rebalance ();
+      }
+   }
+}
+
+
+/**
+ * Deregister from the dynamics manager. The bodies keep their current
+ * assignment.
+ */
+void
+DistributedPartition::shutdown ()
+{
+   if (dyn_manager != nullptr) {
+      dyn_manager->remove_cycle_observer (*this);
+      dyn_manager = nullptr;
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -25,8 +25,10 @@ Library dependencies:
   ((dyn_bodies_primitives.cc)
    (dyn_manager.cc)
    (dyn_manager_messages.cc)
+   (dynamics/body_action/src/body_action.cc)
    (dynamics/dyn_body/src/dyn_body.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/message/src/message_handler.cc)
+   (utils/named_item/src/name_table.cc))
 
 
 *******************************************************************************/
@@ -35,9 +37,13 @@ Library dependencies:
 // System includes
 #include <algorithm>
 #include <cstddef>
+#include <list>
+#include <vector>
 
 // JEOD includes
+#include "dynamics/body_action/include/body_action.hh"
 #include "dynamics/dyn_body/include/dyn_body.hh"
+#include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
 
 // Model includes
@@ -48,6 +54,25 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Order bodies by decreasing accumulated cost.
+ * @return True if lhs has accumulated more cost than rhs.
+ * @param[in] lhs  Body
+ * @param[in] rhs  Body
+ */
+bool
+costs_more (
+   const DynBody * lhs,
+   const DynBody * rhs)
+{
+   return lhs->cost.total_time() > rhs->cost.total_time();
+}
+
+} // End anonymous namespace
+
+
 /**
  * Find the dynamic body with the given name.
  * @param body_name  Dynamic body name
@@ -58,26 +83,68 @@ DynManager::find_dyn_body (
    const char * body_name)
 const
 {
-   DynBody * found_body = nullptr;
-
    // Ensure the passed name has a minimally valid value.
    if (! validate_name (__FILE__, __LINE__, body_name, "Argument", "name")) {
       return nullptr;
    }
 
-   // Find the body by name.
-   // Future FIXME, C++11: Replace with std::find_if using a lambda expression.
-   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
-        it != dyn_bodies.end();
-        ++it) {
-      DynBody * body = *it;
-      if (body->name.ends_with(0, body_name)) {
-         found_body = body;
-         break;
-      }
+   // Find the body by its interned name. Registered bodies' names are
+   // interned, so a name that has not been interned names no body unless
+   // the index is stale.
+   NameHandle handle = NameTable::find (body_name);
+   if ((! handle.is_valid()) && (dyn_body_index.size() != dyn_bodies.size())) {
+      rebuild_dyn_body_index ();
+      handle = NameTable::find (body_name);
    }
 
-   return found_body;
+   return handle.is_valid() ? find_dyn_body (handle) : nullptr;
+}
+
+
+/**
+ * Find the dynamic body with the given interned name.
+ * @param handle  Handle of the dynamic body name
+ * @return Pointer to found DynBody; NULL if not found.
+ */
+DynBody *
+DynManager::find_dyn_body (
+   NameHandle handle)
+const
+{
+   // The index is stale if bodies were added behind its back,
+   // e.g., when dyn_bodies was restored from a checkpoint.
+   if (dyn_body_index.size() != dyn_bodies.size()) {
+      rebuild_dyn_body_index ();
+   }
+
+   unsigned int found = dyn_body_index.find (handle);
+
+   // Guard against a stale index, e.g., a renamed body, by verifying the hit.
+   if ((found != NameIndex::npos) &&
+       ((found >= dyn_bodies.size()) ||
+        (! dyn_bodies[found]->name.ends_with (0, NameTable::get_name (handle))))) {
+      rebuild_dyn_body_index ();
+      found = dyn_body_index.find (handle);
+   }
+
+   return (found != NameIndex::npos) ? dyn_bodies[found] : nullptr;
+}
+
+
+/**
+ * Rebuild the name index from the list of dynamic bodies.
+ */
+void
+DynManager::rebuild_dyn_body_index (
+   void)
+const
+{
+   dyn_body_index.clear ();
+
+   // Keep the first entry for a name, which is what a linear search would find.
+   for (unsigned int ii = 0; ii < dyn_bodies.size(); ++ii) {
+      dyn_body_index.add (NameTable::intern (dyn_bodies[ii]->name.c_str()), ii);
+   }
 }
 
 
@@ -91,8 +158,8 @@ DynManager::is_dyn_body_registered (
    const DynBody * dyn_body)
 const
 {
-   return std::find (dyn_bodies.begin(), dyn_bodies.end(), dyn_body) !=
-          dyn_bodies.end();
+   return dyn_body_positions.find (dyn_bodies, dyn_body) !=
+          dyn_body_positions.npos;
 }
 
 
@@ -149,7 +216,229 @@ DynManager::add_dyn_body (
    add_mass_body (dyn_body.mass);
 
    // Add the body to the list of dynamic body registry.
-   dyn_bodies.push_back (&dyn_body);
+   dyn_body_positions.push_back (dyn_bodies, &dyn_body);
+   dyn_body.cost.active = track_body_costs;
+   if (dyn_body_index.size() + 1 == dyn_bodies.size()) {
+      dyn_body_index.add (NameTable::intern (dyn_body.name.c_str()),
+                          dyn_bodies.size() - 1);
+   }
+}
+
+
+/**
+ * Bring a dynamic body created during the run into the simulation. The body
+ * must have been registered, which DynBody::initialize_model does. Queued
+ * mass and state initializations of the body are performed and the body is
+ * added to the specified integration group.
+ * \par Assumptions and Limitations
+ *  - The dynamics manager has been initialized.
+ *  - The body is an isolated body.
+ * @param dyn_body     Dynamic body to be started.
+ * @param integ_group  Integration group that is to integrate the body;
+ *                     null denotes the default group.
+ */
+void
+DynManager::start_dyn_body (
+   DynBody & dyn_body,
+   DynamicsIntegrationGroup * integ_group)
+{
+   if (! initialized) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Dynamic body '%s' cannot be started before the dynamics manager "
+         "is initialized.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   if (! is_dyn_body_registered (&dyn_body)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Dynamic body '%s' is not registered.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   if (integ_group == nullptr) {
+      integ_group = default_integ_group;
+   }
+
+   initialize_dyn_body (dyn_body);
+
+   if (dyn_body.get_integration_group() == nullptr) {
+      integ_group->add_dyn_body (dyn_body);
+   }
+}
+
+
+/**
+ * Remove a dynamic body from the simulation: from the integration group
+ * that integrates it, from the dynamic and mass body registries, and from
+ * the queue of body actions, which loses the actions whose subject is the
+ * body. Each step takes constant time apart from the pass over the action
+ * queue. The body is not deleted; its reference frames stay registered
+ * until it is destroyed.
+ * \par Assumptions and Limitations
+ *  - The body is not attached to a parent body and has no child bodies.
+ *  - A body that was added to an integration loop must also be removed
+ *    from the loop.
+ * @param dyn_body  Dynamic body to be removed.
+ */
+void
+DynManager::remove_dyn_body (
+   DynBody & dyn_body)
+{
+   if (! is_dyn_body_registered (&dyn_body)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Dynamic body '%s' is not registered.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   if (dyn_body.get_parent_body() != nullptr) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Dynamic body '%s' is attached to a parent body and cannot be "
+         "removed.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   // Remove the body from its integration group.
+   DynamicsIntegrationGroup * integ_group =
+      dyn_body.get_dynamics_integration_group ();
+   if (integ_group != nullptr) {
+      integ_group->delete_dyn_body (dyn_body);
+   }
+
+   // Remove the actions that would act on the body.
+   std::vector<BodyAction *> subject_actions;
+   for (std::list<BodyAction *>::const_iterator it = body_actions.begin();
+        it != body_actions.end();
+        ++it) {
+      if ((*it)->is_same_subject_body (dyn_body.mass)) {
+         subject_actions.push_back (*it);
+      }
+   }
+   for (std::vector<BodyAction *>::const_iterator it =
+           timed_body_actions.begin();
+        it != timed_body_actions.end();
+        ++it) {
+      if ((*it)->is_same_subject_body (dyn_body.mass)) {
+         subject_actions.push_back (*it);
+      }
+   }
+   for (std::vector<BodyAction *>::const_iterator it =
+           subject_actions.begin();
+        it != subject_actions.end();
+        ++it) {
+      remove_body_action (**it);
+   }
+
+   // Remove the body from the registries. The last body takes its place.
+   NameHandle handle = NameTable::find (dyn_body.name.c_str());
+   unsigned int position = dyn_body_index.find (handle);
+   if ((position != NameIndex::npos) &&
+       (position < dyn_bodies.size()) &&
+       (dyn_bodies[position] == &dyn_body)) {
+      DynBody * last = dyn_bodies.back();
+      dyn_body_index.remove (handle);
+      if (last != &dyn_body) {
+         dyn_body_index.set (NameTable::find (last->name.c_str()), position);
+      }
+   }
+   else {
+      dyn_body_index.clear ();
+   }
+   dyn_body_positions.swap_remove (dyn_bodies, &dyn_body);
+
+   remove_mass_body (dyn_body.mass);
+}
+
+
+/**
+ * Remove a dynamic body from the simulation (see remove_dyn_body) and
+ * delete it if it was allocated by JEOD_ALLOC.
+ * @param dyn_body  Dynamic body to be destroyed.
+ */
+void
+DynManager::destroy_dyn_body (
+   DynBody & dyn_body)
+{
+   if (! is_dyn_body_registered (&dyn_body)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Dynamic body '%s' is not registered.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   remove_dyn_body (dyn_body);
+
+   DynBody * body = &dyn_body;
+   if ((! is_dyn_body_registered (body)) && JEOD_IS_ALLOCATED (body)) {
+      JEOD_DELETE_OBJECT (body);
+   }
+}
+
+
+/**
+ * Turn per-body cost accounting on or off for all registered bodies and for
+ * bodies registered later. The accumulated costs are retained.
+ * @param[in] track  Accumulate costs?
+ */
+void
+DynManager::set_body_cost_tracking (
+   bool track)
+{
+   track_body_costs = track;
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      (*it)->cost.active = track;
+   }
+}
+
+
+/**
+ * Zero the accumulated per-body costs.
+ */
+void
+DynManager::reset_body_costs (
+   void)
+{
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      (*it)->cost.reset ();
+   }
+}
+
+
+/**
+ * Get the root bodies in order of decreasing accumulated cost, for use by
+ * tools that distribute bodies across threads or processes. The cost of a
+ * child body is included in that of its root.
+ * @return Root bodies, most expensive first.
+ */
+std::vector<DynBody*>
+DynManager::get_dyn_bodies_by_cost (
+   void)
+const
+{
+   std::vector<DynBody *> roots;
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      if ((*it)->is_root_body()) {
+         roots.push_back (*it);
+      }
+   }
+
+   std::stable_sort (roots.begin(), roots.end(), costs_more);
+
+   return roots;
 }
 
 } // End JEOD namespace
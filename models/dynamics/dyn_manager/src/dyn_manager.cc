@@ -23,6 +23,7 @@ Library dependencies:
    (initialize_simulation.cc)
    (integ_group_primitives.cc)
    (mass_bodies_primitives.cc)
+   (multirate_scheduling.cc)
    (perform_actions.cc)
    (dyn_manager_messages.cc)
    (dynamics_integration_group.cc)
@@ -30,6 +31,7 @@ Library dependencies:
    (dynamics/dyn_body/src/dyn_body.cc)
    (dynamics/body_action/src/body_action.cc)
    (environment/ephemerides/ephem_interface/src/simple_ephemerides.cc)
+   (utils/memory/src/state_snapshot.cc)
    (utils/message/src/message_handler.cc))
 
 
@@ -38,7 +40,9 @@ Library dependencies:
 
 
 // System includes
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 // JEOD includes
 #include "dynamics/body_action/include/body_action.hh"
@@ -50,6 +54,7 @@ Library dependencies:
 #include "utils/integration/include/jeod_integration_group.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
 
 // Model includes
 #include "../include/dyn_manager.hh"
@@ -68,6 +73,8 @@ DynManager::DynManager (
 :
    deriv_ephem_update (false),
    gravity_off (false),
+   multirate (false),
+   multirate_coarsen_threshold (0.01),
    mode (DynManagerInit::EphemerisMode_Ephemerides),
    sim_integrator (nullptr),
    initialized (false),
@@ -77,7 +84,16 @@ DynManager::DynManager (
    default_integ_group(nullptr),
    simple_ephemeris (nullptr),
    integ_groups (),
-   body_actions ()
+   body_actions (),
+   timed_body_actions (),
+   pending_frame_switches (),
+   timed_action_count (0),
+   track_body_costs (false),
+   cycle_observers (),
+   dyn_body_index (),
+   dyn_body_positions (),
+   mass_body_index (),
+   mass_body_positions ()
 {
    // Register types.
    JEOD_REGISTER_CLASS (EmptySpaceEphemeris);
@@ -221,16 +237,12 @@ DynManager::add_body_action (
    }
 
    // 2. The action must not yet be in the list of actions.
-   for (std::list<BodyAction *>::iterator it = body_actions.begin();
-        it != body_actions.end();
-        ++it) {
-      if (*it == body_action) {
-         MessageHandler::error (
-            __FILE__, __LINE__, DynManagerMessages::duplicate_entry,
-            "Duplicate entry passed to add_body_action()\n"
-            "Addition request ignored.");
-         return;
-      }
+   if (body_action->queued) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::duplicate_entry,
+         "Duplicate entry passed to add_body_action()\n"
+         "Addition request ignored.");
+      return;
    }
 
 
@@ -241,8 +253,21 @@ DynManager::add_body_action (
       body_action->initialize (*this);
    }
 
+   body_action->queued = true;
+
+   // Hold time-triggered actions in the timed heap until their time comes.
+   if (body_action->time_triggered) {
+      body_action->active = false;
+      body_action->activation_sequence = timed_action_count++;
+      timed_body_actions.push_back (body_action);
+      std::push_heap (timed_body_actions.begin(), timed_body_actions.end(),
+                      activates_after);
+   }
+
    // Add the action to the list of such.
-   body_actions.push_back (body_action);
+   else {
+      body_actions.push_back (body_action);
+   }
 }
 
 /**
@@ -266,10 +291,85 @@ DynManager::remove_body_action (
     }
     if (strcmp(action_name_in, action->action_name.c_str()) == 0) {
       action->shutdown(); // frees the memory allocated to action_identifier
+      action->queued = false;
       body_actions.erase(it); // remove from list.
       return;
     }
   }
+  for (std::vector<BodyAction *>::iterator it = timed_body_actions.begin();
+       it != timed_body_actions.end();
+       ++it) {
+    BodyAction * action = *it;
+    if (action->action_name.empty()) {
+      continue;
+    }
+    if (strcmp(action_name_in, action->action_name.c_str()) == 0) {
+      action->shutdown();
+      action->queued = false;
+      timed_body_actions.erase(it);
+      std::make_heap (timed_body_actions.begin(), timed_body_actions.end(),
+                      activates_after);
+      return;
+    }
+  }
+}
+
+
+/**
+ * Remove a body action from the queue, or from the time-triggered actions
+ * if it has not yet been activated.
+ * \param[in,out] body_action Action to remove
+ */
+void
+DynManager::remove_body_action (
+   BodyAction & body_action)
+{
+   if (! body_action.queued) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Body action '%s' is not held by the dynamics manager.\n"
+         "Removal request ignored.",
+         body_action.action_name.c_str());
+      return;
+   }
+
+   std::vector<BodyAction *>::iterator timed_it =
+      std::find (timed_body_actions.begin(), timed_body_actions.end(),
+                 &body_action);
+   if (timed_it != timed_body_actions.end()) {
+      timed_body_actions.erase (timed_it);
+      std::make_heap (timed_body_actions.begin(), timed_body_actions.end(),
+                      activates_after);
+   }
+   else {
+      body_actions.remove (&body_action);
+   }
+
+   body_action.shutdown ();
+   body_action.queued = false;
+}
+
+
+/**
+ * Heap ordering predicate for the time-triggered actions.
+ * The heap front is the action with the earliest activation time, then the
+ * lowest priority value, then the earliest arrival.
+ * \param[in] lhs First action
+ * \param[in] rhs Second action
+ * @return True if lhs is to be activated after rhs
+ */
+bool
+DynManager::activates_after (
+   const BodyAction * lhs,
+   const BodyAction * rhs)
+{
+   if (lhs->activation_time != rhs->activation_time) {
+      return lhs->activation_time > rhs->activation_time;
+   }
+   if (lhs->activation_priority != rhs->activation_priority) {
+      return lhs->activation_priority > rhs->activation_priority;
+   }
+   return lhs->activation_sequence > rhs->activation_sequence;
 }
 
 
@@ -295,6 +395,49 @@ DynManager::reset_integrators ()
    // are no groups to reset.
 }
 
+
+/**
+ * Register the dynamic state of the simulation with a state snapshot: the
+ * reference frame states and ephemeris state, the mass properties of each
+ * mass body, the derivatives and integrator histories of each dynamic body,
+ * and the integration groups' own state. Together with the time manager's
+ * registration (TimeManager::add_snapshot_regions), this lets a what-if
+ * propagation be rolled back by restoring the snapshot.
+ *
+ * \par Assumptions and Limitations
+ *  - The snapshot is registered after the simulation is initialized, and
+ *    is saved and restored between integration steps.
+ *  - Adding, removing, attaching or detaching bodies, switching integration
+ *    frames, or recreating integrators changes what needs to be registered;
+ *    the snapshot must then be cleared and registered again.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+DynManager::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   EphemeridesManager::add_snapshot_regions (snapshot);
+
+   for (MassBody * mass_body : mass_bodies) {
+      mass_body->add_snapshot_regions (snapshot);
+   }
+
+   for (DynBody * dyn_body : dyn_bodies) {
+      dyn_body->add_snapshot_regions (snapshot);
+   }
+
+   if (! integ_groups.empty()) {
+      for (DynamicsIntegrationGroup * integ_group : integ_groups) {
+         if (integ_group != nullptr) {
+            integ_group->add_snapshot_regions (snapshot);
+         }
+      }
+   }
+   else if (default_integ_group != nullptr) {
+      default_integ_group->add_snapshot_regions (snapshot);
+   }
+}
+
 } // End JEOD namespace
 
 /**
@@ -49,6 +49,7 @@ MAKE_DYNMANAGER_MESSAGE_CODE (invalid_type);
 MAKE_DYNMANAGER_MESSAGE_CODE (inconsistent_setup);
 MAKE_DYNMANAGER_MESSAGE_CODE (singleton_error);
 MAKE_DYNMANAGER_MESSAGE_CODE (internal_error);
+MAKE_DYNMANAGER_MESSAGE_CODE (transport_error);
 
 #undef MAKE_DYNMANAGER_MESSAGE_CODE
 
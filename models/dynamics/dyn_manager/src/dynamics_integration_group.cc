@@ -16,31 +16,48 @@ Purpose:
 
 Library dependencies:
   ((dynamics_integration_group.cc)
+   (derivative_thread_pool.cc)
    (dyn_manager.cc)
    (dyn_manager_messages.cc)
    (dynamics/dyn_body/src/dyn_body.cc)
    (environment/gravity/src/gravity_manager.cc)
    (environment/time/src/time_manager.cc)
    (utils/integration/src/jeod_integration_group.cc)
+   (utils/memory/src/state_snapshot.cc)
    (utils/message/src/message_handler.cc)
-   (utils/named_item/src/named_item.cc))
+   (utils/named_item/src/named_item.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 ******************************************************************************/
 
 
 // System includes
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+
+// ER7 utilities includes
+#include "er7_utils/integration/core/include/integrator_constructor.hh"
+#include "er7_utils/integration/core/include/second_order_ode_integrator.hh"
 
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
+#include "environment/gravity/include/gravity_controls.hh"
 #include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/gravity_point_batch.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
 #include "utils/integration/include/jeod_integration_time.hh"
+#include "utils/integration/include/snapshot_integrator.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
 #include "utils/named_item/include/named_item.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
+#include "../include/derivative_thread_pool.hh"
 #include "../include/dyn_manager.hh"
 #include "../include/dyn_manager_messages.hh"
 #include "../include/dynamics_integration_group.hh"
@@ -56,8 +73,30 @@ DynamicsIntegrationGroup::DynamicsIntegrationGroup ()
 :
    JeodIntegrationGroup (),
    deriv_ephem_update (false),
+   batch_translation (false),
+   derivative_threads (0),
+   parallel_gravitation (false),
+   batch_gravitation (false),
+   max_step_hint (0.0),
+   error_hint (0.0),
+   integrator_error_hint (false),
+   max_substeps (64),
+   substeps (1),
+   floor_substeps (1),
    dyn_bodies (),
-   bodies_integrated_separately (true)
+   dyn_body_positions (),
+   bodies_integrated_separately (true),
+   trans_batch_bodies (),
+   trans_batch_candidates (),
+   trans_batch_capacity (0),
+   trans_batch_position (nullptr),
+   trans_batch_velocity (nullptr),
+   trans_batch_accel (nullptr),
+   trans_batch_integrator (nullptr),
+   root_bodies (),
+   thread_pool (nullptr),
+   grav_batch_entries (),
+   grav_batch_data ()
 {
    register_base_contents();
 }
@@ -79,8 +118,30 @@ DynamicsIntegrationGroup::DynamicsIntegrationGroup (
 :
    JeodIntegrationGroup (owner, integ_cotr, integ_inter, time_mngr),
    deriv_ephem_update (false),
+   batch_translation (false),
+   derivative_threads (0),
+   parallel_gravitation (false),
+   batch_gravitation (false),
+   max_step_hint (0.0),
+   error_hint (0.0),
+   integrator_error_hint (false),
+   max_substeps (64),
+   substeps (1),
+   floor_substeps (1),
    dyn_bodies (),
-   bodies_integrated_separately (true)
+   dyn_body_positions (),
+   bodies_integrated_separately (true),
+   trans_batch_bodies (),
+   trans_batch_candidates (),
+   trans_batch_capacity (0),
+   trans_batch_position (nullptr),
+   trans_batch_velocity (nullptr),
+   trans_batch_accel (nullptr),
+   trans_batch_integrator (nullptr),
+   root_bodies (),
+   thread_pool (nullptr),
+   grav_batch_entries (),
+   grav_batch_data ()
 {
    register_base_contents();
 }
@@ -102,6 +163,8 @@ DynamicsIntegrationGroup::register_base_contents ()
  */
 DynamicsIntegrationGroup::~DynamicsIntegrationGroup ()
 {
+   release_translation_batch ();
+   DerivativeThreadPool::release (thread_pool);
    JEOD_DEREGISTER_CHECKPOINTABLE (this, dyn_bodies);
 }
 
@@ -191,21 +254,9 @@ void
 DynamicsIntegrationGroup::add_dyn_body (
    DynBody & dyn_body)
 {
-   bool found = false;
-
-   // Check if the body is already in our list of bodies.
-   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
-        it != dyn_bodies.end();
-        ++it) {
-      DynBody * body = *it;
-      if (body == &dyn_body) {
-         found = true;
-         break;
-      }
-   }
-
    // Don't add the body if it is already here.
-   if (found) {
+   if (dyn_body_positions.find (dyn_bodies, &dyn_body) !=
+       dyn_body_positions.npos) {
       MessageHandler::error (
          __FILE__, __LINE__, DynManagerMessages::duplicate_entry,
          "DynBody '%s' is already registered with this integration group.",
@@ -214,7 +265,7 @@ DynamicsIntegrationGroup::add_dyn_body (
    }
 
    // Not a duplicate. Add the body to the list.
-   dyn_bodies.push_back (&dyn_body);
+   dyn_body_positions.push_back (dyn_bodies, &dyn_body);
 
    // Let the body know it was assigned to this group.
    dyn_body.set_integration_group (*this);
@@ -250,27 +301,32 @@ void
 DynamicsIntegrationGroup::delete_dyn_body (
    DynBody & dyn_body)
 {
-   std::vector<DynBody *>::iterator it;
-
-   // Find the body in our list of bodies.
-   for (it = dyn_bodies.begin(); it != dyn_bodies.end(); ++it) {
-      DynBody * body = *it;
-      if (body == &dyn_body) {
-         break;
-      }
-   }
-
    // Don't delete the body if it isn't ours.
-   if (it == dyn_bodies.end()) {
+   if (! dyn_body_positions.swap_remove (dyn_bodies, &dyn_body)) {
       MessageHandler::error (
          __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
          "DynBody '%s' is not registered with this integration group.",
          dyn_body.name.c_str());
       return;
    }
+   trans_batch_bodies.clear ();
 
-   // It's one of ours. Delete the body from the list.
-   dyn_bodies.erase (it);
+   // Remove the integrable objects associated with the body,
+   // which add_dyn_body added.
+   if ((integ_controls != nullptr) && bodies_integrated_separately) {
+      JeodPointerVector<er7_utils::IntegrableObject>::type associated_objects =
+         dyn_body.get_integrable_objects();
+
+      for (std::vector<er7_utils::IntegrableObject *>::const_iterator it =
+              associated_objects.begin();
+           it != associated_objects.end();
+           ++it) {
+         if (integrable_object_positions.find (integrable_objects, *it) !=
+             integrable_object_positions.npos) {
+            remove_integrable_object (**it);
+         }
+      }
+   }
 
    // Let the body know it has been removed from this group.
    dyn_body.clear_integration_group ();
@@ -292,6 +348,129 @@ DynamicsIntegrationGroup::prepare_for_integ_loop (
 }
 
 
+namespace {
+
+/**
+ * Computes the gravitational acceleration of one root body.
+ */
+class GravitationTask : public DerivativeThreadTask {
+public:
+   GravitationTask (
+      GravityManager & gravity_manager_in,
+      std::vector<DynBody *> & bodies_in,
+      unsigned int offset_in)
+   :
+      gravity_manager (gravity_manager_in),
+      bodies (bodies_in),
+      offset (offset_in)
+   { }
+
+   void execute (unsigned int index) override
+   {
+      DynBody * body = bodies[index + offset];
+      double start = body->cost.begin ();
+      gravity_manager.gravitation (body->composite_body, body->grav_interaction);
+      body->cost.end (DynBodyCost::Gravity, start);
+   }
+
+private:
+   GravityManager & gravity_manager;
+   std::vector<DynBody *> & bodies;
+   unsigned int offset;
+};
+
+
+/**
+ * Collects the forces and torques acting on one root body.
+ */
+class CollectForcesTask : public DerivativeThreadTask {
+public:
+   explicit CollectForcesTask (
+      std::vector<DynBody *> & bodies_in)
+   :
+      bodies (bodies_in)
+   { }
+
+   void execute (unsigned int index) override
+   {
+      DynBody * body = bodies[index];
+      double start = body->cost.begin ();
+      body->collect_forces_and_torques ();
+      body->cost.end (DynBodyCost::Forces, start);
+   }
+
+private:
+   std::vector<DynBody *> & bodies;
+};
+
+
+/**
+ * Order gravity batch entries so that entries that can be evaluated in one
+ * batch are adjacent: same source, integration frame, and settings.
+ */
+class GravityBatchOrder {
+public:
+   explicit GravityBatchOrder (
+      const std::vector<DynBody *> & bodies_in)
+   :
+      bodies (bodies_in)
+   { }
+
+   template <typename EntryT>
+   bool operator() (const EntryT & a, const EntryT & b) const
+   {
+      if (a.control->body != b.control->body) {
+         return std::less<GravitySource *>() (a.control->body, b.control->body);
+      }
+      unsigned int a_frame = bodies[a.body_index]->grav_interaction.integ_frame_index;
+      unsigned int b_frame = bodies[b.body_index]->grav_interaction.integ_frame_index;
+      if (a_frame != b_frame) {
+         return a_frame < b_frame;
+      }
+      return a.control->batch_signature() < b.control->batch_signature();
+   }
+
+   template <typename EntryT>
+   bool same_batch (const EntryT & a, const EntryT & b) const
+   {
+      return (! (*this) (a, b)) && (! (*this) (b, a));
+   }
+
+private:
+   const std::vector<DynBody *> & bodies;
+};
+
+} // End anonymous namespace
+
+
+/**
+ * Rebuild the list of root bodies and return the thread pool to be used
+ * by the parallel derivative phases, creating or resizing it as needed.
+ * @return Thread pool, or null if derivatives are to be evaluated serially.
+ */
+DerivativeThreadPool *
+DynamicsIntegrationGroup::prepare_parallel_derivatives ()
+{
+   if (derivative_threads < 2) {
+      return nullptr;
+   }
+
+   root_bodies.clear ();
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      if ((*it)->is_root_body() && (! (*it)->is_frozen())) {
+         root_bodies.push_back (*it);
+      }
+   }
+   if (root_bodies.size() < 2) {
+      return nullptr;
+   }
+
+   return DerivativeThreadPool::acquire (thread_pool, derivative_threads);
+}
+
+
 /**
  * Compute the gravitational acceleration of each root dynamic body.
  * @param dyn_manager    Dynamics manager.
@@ -301,6 +480,27 @@ void
 DynamicsIntegrationGroup::gravitation (
    DynManager & dyn_manager,
    GravityManager & gravity_manager)
+{
+   JEOD_PROFILE_GROUP (this);
+   JEOD_PROFILE_SCOPE ("gravity", "DynamicsIntegrationGroup::gravitation");
+
+   update_environment (dyn_manager);
+   body_gravitation (gravity_manager);
+}
+
+
+/**
+ * Bring the environment read by the gravitation step up to date: update the
+ * ephemerides if this is to be done at the derivative rate or if the
+ * reference frame tree is out of whack, and perform any deferred ephemeris
+ * update. Once this is done, the environment is not modified by
+ * body_gravitation, so groups that share the environment can evaluate
+ * their bodies' gravitation concurrently.
+ * @param dyn_manager    Dynamics manager.
+ */
+void
+DynamicsIntegrationGroup::update_environment (
+   DynManager & dyn_manager)
 {
    // Update ephemerides if this is to be done at the derivative rate
    // or if the reference frame tree is out of whack.
@@ -308,20 +508,187 @@ DynamicsIntegrationGroup::gravitation (
       dyn_manager.update_ephemerides ();
    }
 
+   // The gravity models read the planet frame states directly.
+   dyn_manager.refresh_ephemerides ();
+}
+
+
+/**
+ * Compute the gravitational acceleration of each root dynamic body,
+ * assuming update_environment has been called at the current time.
+ * @param gravity_manager  Gravity Manager.
+ */
+void
+DynamicsIntegrationGroup::body_gravitation (
+   GravityManager & gravity_manager)
+{
+   // Parallel evaluation needs the frame offsets to be shared; otherwise
+   // the gravity controls would update per-source offsets concurrently.
+   if (parallel_gravitation && (! gravity_manager.share_frame_offsets)) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "parallel_gravitation requires the gravity manager's "
+         "share_frame_offsets.\n"
+         "Gravitation will be evaluated serially.\n");
+      parallel_gravitation = false;
+   }
+
+   // Parallel evaluation: The first root body is processed serially so that
+   // state shared across bodies (frame offsets, cached body deltas) is
+   // brought up to date before the remaining bodies are processed.
+   DerivativeThreadPool * pool =
+      parallel_gravitation ? prepare_parallel_derivatives () : nullptr;
+   if (pool != nullptr) {
+      GravitationTask first (gravity_manager, root_bodies, 0);
+      first.execute (0);
+
+      GravitationTask rest (gravity_manager, root_bodies, 1);
+      pool->run (root_bodies.size() - 1, rest);
+      return;
+   }
+
+   // Batched evaluation.
+   if (batch_gravitation) {
+      batched_gravitation (gravity_manager);
+      return;
+   }
+
    // Compute gravitational effects on each root body.
    for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
         it != dyn_bodies.end();
         ++it) {
       DynBody * body = *it;
 
-      // Only process root bodies.
+      // Only process root bodies that are not frozen.
       // The gravitational acceleration is not needed for child bodies.
-      if (body->is_root_body()) {
+      if (body->is_root_body() && (! body->is_frozen())) {
 
          // Ask the Gravity Manager to compute the acceleration.
+         double start = body->cost.begin ();
          gravity_manager.gravitation (
             body->composite_body,
             body->grav_interaction);
+         body->cost.end (DynBodyCost::Gravity, start);
+      }
+   }
+}
+
+
+/**
+ * Compute the gravitational acceleration of each root dynamic body, with
+ * batchable controls evaluated as multi-point batches. Non-batchable
+ * controls are evaluated body by body as GravityManager::gravitation does.
+ * Each control's grav_accel, grav_grad, and grav_pot are set as in the
+ * body-by-body evaluation.
+ * @param gravity_manager  Gravity Manager.
+ */
+void
+DynamicsIntegrationGroup::batched_gravitation (
+   GravityManager & gravity_manager)
+{
+   // Zero each root body's totals, evaluate its non-batchable controls, and
+   // set aside the batchable ones.
+   root_bodies.clear ();
+   grav_batch_entries.clear ();
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      DynBody * body = *it;
+      if ((! body->is_root_body()) || body->is_frozen()) {
+         continue;
+      }
+      unsigned int body_index = root_bodies.size();
+      root_bodies.push_back (body);
+
+      GravityInteraction & grav = body->grav_interaction;
+      Vector3::initialize (grav.grav_accel);
+      Matrix3x3::initialize (grav.grav_grad);
+      grav.grav_pot = 0.0;
+      double start = body->cost.begin ();
+
+      grav.update_dispatch ();
+      const std::vector<GravityInteraction::DispatchEntry> & entries =
+         grav.get_dispatch_entries();
+      for (unsigned int ii = 0; ii < entries.size(); ++ii) {
+         GravityControls & control = *(entries[ii].control);
+         if (entries[ii].batchable) {
+            GravityBatchEntry entry = {&control, body_index};
+            grav_batch_entries.push_back (entry);
+            continue;
+         }
+         control.gravitation (body->composite_body,
+                              grav.integ_frame_index,
+                              control.grav_accel,
+                              control.grav_grad,
+                              control.grav_pot);
+         Vector3::incr (control.grav_accel, grav.grav_accel);
+         Matrix3x3::incr (control.grav_grad, grav.grav_grad);
+         grav.grav_pot += control.grav_pot;
+      }
+      body->cost.end (DynBodyCost::Gravity, start);
+   }
+
+   // Evaluate each run of equivalent controls as one batch.
+   GravityBatchOrder order (root_bodies);
+   std::sort (grav_batch_entries.begin(), grav_batch_entries.end(), order);
+
+   unsigned int nentries = grav_batch_entries.size();
+   unsigned int end;
+   for (unsigned int begin = 0; begin < nentries; begin = end) {
+      end = begin + 1;
+      while ((end < nentries) &&
+             order.same_batch (grav_batch_entries[begin],
+                               grav_batch_entries[end])) {
+         ++end;
+      }
+      unsigned int npoints = end - begin;
+
+      // Layout: three position arrays, three acceleration arrays,
+      // potentials, and gradients.
+      if (grav_batch_data.size() < 16 * npoints) {
+         grav_batch_data.resize (16 * npoints);
+      }
+      double * data = grav_batch_data.data();
+      GravityPointBatch batch;
+      batch.npoints = npoints;
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         batch.posn[kk] = data + kk * npoints;
+         batch.accel[kk] = data + (3 + kk) * npoints;
+      }
+      batch.pot = data + 6 * npoints;
+      batch.grad = reinterpret_cast<double (*)[3][3]> (data + 7 * npoints);
+
+      for (unsigned int ip = 0; ip < npoints; ++ip) {
+         const DynBody * body =
+            root_bodies[grav_batch_entries[begin + ip].body_index];
+         const double * position = body->composite_body.state.trans.position;
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            data[kk * npoints + ip] = position[kk];
+         }
+      }
+
+      const GravityBatchEntry & first = grav_batch_entries[begin];
+      double start = DynBodyCost::wall_time ();
+      gravity_manager.gravitation (
+         *first.control,
+         root_bodies[first.body_index]->grav_interaction.integ_frame_index,
+         batch);
+      double share = (DynBodyCost::wall_time () - start) / npoints;
+
+      for (unsigned int ip = 0; ip < npoints; ++ip) {
+         const GravityBatchEntry & entry = grav_batch_entries[begin + ip];
+         GravityControls & control = *entry.control;
+         DynBody * body = root_bodies[entry.body_index];
+         GravityInteraction & grav = body->grav_interaction;
+         body->cost.add (DynBodyCost::Gravity, share);
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            control.grav_accel[kk] = batch.accel[kk][ip];
+         }
+         Matrix3x3::copy (batch.grad[ip], control.grav_grad);
+         control.grav_pot = batch.pot[ip];
+         Vector3::incr (control.grav_accel, grav.grav_accel);
+         Matrix3x3::incr (control.grav_grad, grav.grav_grad);
+         grav.grav_pot += control.grav_pot;
       }
    }
 }
@@ -333,19 +700,34 @@ DynamicsIntegrationGroup::gravitation (
 void
 DynamicsIntegrationGroup::collect_derivatives ()
 {
+   JEOD_PROFILE_GROUP (this);
+   JEOD_PROFILE_SCOPE (
+      "integration", "DynamicsIntegrationGroup::collect_derivatives");
+
+   // Parallel evaluation: Each root body (and its children) is handled by
+   // exactly one thread, so no cross-thread reduction is involved.
+   DerivativeThreadPool * pool = prepare_parallel_derivatives ();
+   if (pool != nullptr) {
+      CollectForcesTask task (root_bodies);
+      pool->run (root_bodies.size(), task);
+      return;
+   }
+
    // Collect forces and torques on each root body.
    for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
         it != dyn_bodies.end();
         ++it) {
       DynBody * body = *it;
 
-      // Only process root bodies.
+      // Only process root bodies that are not frozen.
       // The forces and torques on non-root bodies are collected
       // within the root body collection.
-      if (body->is_root_body()) {
+      if (body->is_root_body() && (! body->is_frozen())) {
 
          // Collect the forces and torques acting on the body as a whole.
+         double start = body->cost.begin ();
          body->collect_forces_and_torques ();
+         body->cost.end (DynBodyCost::Forces, start);
       }
    }
 }
@@ -365,11 +747,54 @@ DynamicsIntegrationGroup::reset_body_integrators ()
       body->reset_integrators ();
    }
 
+   // Reset the batched translational state integrator.
+   if (trans_batch_integrator != nullptr) {
+      trans_batch_integrator->reset_integrator ();
+   }
+
    // Reset the non-body integrators.
    JeodIntegrationGroup::reset_body_integrators ();
 }
 
 
+/**
+ * Register the group's own integration state with a state snapshot: the
+ * batched translational state and its integrator's history, if the group
+ * integrates translation as a batch. A batch integrator that cannot register
+ * its history is reset on restore. The group's dense output is invalidated
+ * on restore as the recorded step no longer describes the bodies' motion.
+ * The bodies register their own state (see DynBody::add_snapshot_regions).
+ * \param[in,out] snapshot The snapshot
+ */
+void
+DynamicsIntegrationGroup::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   bool reset_batch = false;
+   if (trans_batch_integrator != nullptr) {
+      snapshot.add_array (trans_batch_position, 3*trans_batch_capacity);
+      snapshot.add_array (trans_batch_velocity, 3*trans_batch_capacity);
+      snapshot.add_array (trans_batch_accel, 3*trans_batch_capacity);
+
+      SnapshotIntegrator * snapshot_integrator =
+         dynamic_cast<SnapshotIntegrator *> (trans_batch_integrator);
+      if (snapshot_integrator != nullptr) {
+         snapshot_integrator->add_snapshot_regions (snapshot);
+      }
+      else {
+         reset_batch = true;
+      }
+   }
+
+   snapshot.add_restore_action ([this, reset_batch] () {
+      if (reset_batch && (trans_batch_integrator != nullptr)) {
+         trans_batch_integrator->reset_integrator ();
+      }
+      dense_output_valid = false;
+   });
+}
+
+
 /**
  * Integrate the states of the DynBody objects that comprise the group.
  * @param[in]     cycle_dyndt   Dynamic time step, in dynamic time seconds.
@@ -382,8 +807,26 @@ DynamicsIntegrationGroup::integrate_bodies (
    double cycle_dyndt,
    unsigned int target_stage)
 {
+   JEOD_PROFILE_GROUP (this);
+   JEOD_PROFILE_SCOPE (
+      "integration", "DynamicsIntegrationGroup::integrate_bodies");
+
    er7_utils::IntegratorResult status (false);
 
+   // Record the state at the start of the step for dense output.
+   if (dense_output && (target_stage == 1)) {
+      begin_dense_output_step ();
+   }
+
+   // Batched mode has its own implementation.
+   if (batch_translation && bodies_integrated_separately) {
+      status = integrate_bodies_batched (cycle_dyndt, target_stage);
+      if (dense_output) {
+         end_dense_output_step (cycle_dyndt, status);
+      }
+      return status;
+   }
+
    // This method requires that bodies_integrated_separately be set.
    if (! bodies_integrated_separately) {
 
@@ -410,18 +853,301 @@ DynamicsIntegrationGroup::integrate_bodies (
       // Only process root bodies.
       // The state of a non-root body is updated by virtue of the
       // propagate_state() method of that body's root body.
+      // A frozen body's state is composed from the frame it is frozen to.
       if (body->is_root_body()) {
 
          // Integrate the body's state and merge the integration status.
          integ_merger.merge_integrator_result (
             body->integrate (cycle_dyndt, target_stage),
             status);
+
+         // Feed the translational integrator's error estimate, if any,
+         // to the multirate scheduler.
+         if (integrator_error_hint && (! body->is_frozen())) {
+            double step_error = body->get_trans_step_error ();
+            if (step_error > error_hint) {
+               error_hint = step_error;
+            }
+         }
       }
    }
 
+   // Record the state at the end of the step for dense output.
+   if (dense_output) {
+      end_dense_output_step (cycle_dyndt, status);
+   }
+
    return status;
 }
 
+
+/**
+ * Integrate the translational states of the root bodies in the group as a
+ * single system, and then integrate the remaining state of each body.
+ * @param[in]     cycle_dyndt   Dynamic time step, in dynamic time seconds.
+ * @param[in]     target_stage  The stage of the integration process
+ *                              that the integrator should try to attain.
+ * @return The status (time advance, pass/fail status) of the integration.
+ */
+er7_utils::IntegratorResult
+DynamicsIntegrationGroup::integrate_bodies_batched (
+   double cycle_dyndt,
+   unsigned int target_stage)
+{
+   er7_utils::IntegratorResult status (false);
+
+   // Integrate non-DynBody objects that are to be integrated as a part
+   // of this integration group.
+   if (! integrable_objects.empty()) {
+      status = integrate_container (
+                 cycle_dyndt, target_stage, integrable_objects);
+   }
+
+   // Make the batch match the set of bodies with integrated translation.
+   update_translation_batch ();
+
+   // Gather the translational states, integrate them, and scatter them back.
+   unsigned int nbodies = trans_batch_bodies.size();
+   if (nbodies > 0) {
+      double const * accel;
+      double * velocity;
+      double * position;
+
+      for (unsigned int ibody = 0; ibody < nbodies; ++ibody) {
+         trans_batch_bodies[ibody]->get_trans_integ_state (
+            accel, velocity, position);
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            trans_batch_position[kk*nbodies + ibody] = position[kk];
+            trans_batch_velocity[kk*nbodies + ibody] = velocity[kk];
+            trans_batch_accel[kk*nbodies + ibody]    = accel[kk];
+         }
+      }
+
+      double start = DynBodyCost::wall_time ();
+      integ_merger.merge_integrator_result (
+         trans_batch_integrator->integrate (
+            cycle_dyndt, target_stage, trans_batch_accel,
+            trans_batch_velocity, trans_batch_position),
+         status);
+      double share = (DynBodyCost::wall_time () - start) / nbodies;
+
+      for (unsigned int ibody = 0; ibody < nbodies; ++ibody) {
+         trans_batch_bodies[ibody]->get_trans_integ_state (
+            accel, velocity, position);
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            position[kk] = trans_batch_position[kk*nbodies + ibody];
+            velocity[kk] = trans_batch_velocity[kk*nbodies + ibody];
+         }
+         trans_batch_bodies[ibody]->cost.add (DynBodyCost::Integration, share);
+      }
+   }
+
+   // Integrate the remaining state of each root body and propagate.
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      DynBody * body = *it;
+      if (body->is_root_body()) {
+         integ_merger.merge_integrator_result (
+            body->integrate_non_translational (cycle_dyndt, target_stage),
+            status);
+      }
+   }
+
+   return status;
+}
+
+
+/**
+ * Rebuild the translational batch if the set of root bodies whose
+ * translational state is integrated has changed. The batch integrator is
+ * recreated when the batch grows or shrinks and is reset when its
+ * membership otherwise changes, as its history no longer applies.
+ */
+void
+DynamicsIntegrationGroup::update_translation_batch ()
+{
+   double const * accel;
+   double * velocity;
+   double * position;
+
+   trans_batch_candidates.clear ();
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      DynBody * body = *it;
+      if (body->is_root_body() &&
+          body->get_trans_integ_state (accel, velocity, position)) {
+         trans_batch_candidates.push_back (body);
+      }
+   }
+
+   if (trans_batch_candidates == trans_batch_bodies) {
+      return;
+   }
+
+   trans_batch_bodies.swap (trans_batch_candidates);
+   unsigned int nbodies = trans_batch_bodies.size();
+
+   if (nbodies != trans_batch_capacity) {
+      release_translation_batch ();
+      if (nbodies > 0) {
+         trans_batch_position = JEOD_ALLOC_PRIM_ARRAY (3*nbodies, double);
+         trans_batch_velocity = JEOD_ALLOC_PRIM_ARRAY (3*nbodies, double);
+         trans_batch_accel    = JEOD_ALLOC_PRIM_ARRAY (3*nbodies, double);
+         trans_batch_integrator =
+            integ_constructor->create_second_order_ode_integrator (
+               3*nbodies, *integ_controls);
+      }
+      trans_batch_capacity = nbodies;
+   }
+   else if (trans_batch_integrator != nullptr) {
+      trans_batch_integrator->reset_integrator ();
+   }
+}
+
+
+/**
+ * Record the root bodies' translational states at the start of an
+ * integration step. The derivatives must be current.
+ */
+void
+DynamicsIntegrationGroup::begin_dense_output_step ()
+{
+   // Batched states are not integrated by the bodies' own integrators,
+   // so those integrators' natural interpolants do not apply.
+   bool natural = ! batch_translation;
+
+   dense_output_start = jeod_time_manager->get_timestamp_time();
+   dense_output_valid = false;
+
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      DynBody * body = *it;
+      if (body->is_root_body()) {
+         body->begin_trans_dense_output (dense_output_start, natural);
+      }
+   }
+}
+
+
+/**
+ * Record the root bodies' translational states at the end of an
+ * integration step and check the group's events against the step.
+ * Nothing is recorded until the integration cycle has completed.
+ * @param[in]  cycle_dyndt  Dynamic time step, in dynamic time seconds.
+ * @param[in]  status       Merged status of the integration.
+ */
+void
+DynamicsIntegrationGroup::end_dense_output_step (
+   double cycle_dyndt,
+   const er7_utils::IntegratorResult & status)
+{
+   if (! status.get_passed()) {
+      return;
+   }
+
+   dense_output_end =
+      dense_output_start + status.get_time_scale() * cycle_dyndt;
+   dense_output_valid = true;
+
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      DynBody * body = *it;
+      if (body->is_root_body()) {
+         body->end_trans_dense_output (dense_output_end);
+      }
+   }
+
+   // The step is recorded; look for events within it.
+   detect_events ();
+}
+
+
+/**
+ * Interpolate the translational state of a DynBody in the group within
+ * the most recent integration step. The state is that of the body's
+ * integrated frame, expressed in the body's integration frame.
+ * @param[in]  object    The DynBody whose state is wanted.
+ * @param[in]  dyn_time  Dynamic time, in seconds.
+ * @param[out] velocity  Interpolated velocity.
+ * @param[out] position  Interpolated position.
+ * @return True if the object is a root DynBody in this group, dense output
+ *         is enabled, and dyn_time lies within the most recent step.
+ *         Non-root bodies have no recorded step.
+ */
+bool
+DynamicsIntegrationGroup::interpolate_state (
+   const er7_utils::IntegrableObject & object,
+   double dyn_time,
+   double * velocity,
+   double * position)
+const
+{
+   const DynBody * body = dynamic_cast<const DynBody *> (&object);
+
+   if ((! dense_output) || (! dense_output_valid) ||
+       (body == nullptr) ||
+       (std::find (dyn_bodies.begin(), dyn_bodies.end(), body) ==
+        dyn_bodies.end())) {
+      return false;
+   }
+
+   return body->interpolate_trans_state (dyn_time, velocity, position);
+}
+
+
+/**
+ * Get the smallest step asked for by the Sundman time transformations of
+ * the root bodies in the group (see DynBody::sundman_step_scale).
+ * @return Step size, in seconds, or zero if no root body asks for one.
+ */
+double
+DynamicsIntegrationGroup::get_sundman_step (
+   void)
+const
+{
+   double min_step = 0.0;
+
+   for (std::vector<DynBody *>::const_iterator it = dyn_bodies.begin();
+        it != dyn_bodies.end();
+        ++it) {
+      DynBody * body = *it;
+      if (body->is_root_body()) {
+         double step = body->get_sundman_step ();
+         if ((step > 0.0) && ((min_step <= 0.0) || (step < min_step))) {
+            min_step = step;
+         }
+      }
+   }
+
+   return min_step;
+}
+
+
+/**
+ * Release the translational batch integrator and buffers.
+ */
+void
+DynamicsIntegrationGroup::release_translation_batch ()
+{
+   if (trans_batch_integrator != nullptr) {
+      er7_utils::Er7UtilsDeletable::delete_instance (trans_batch_integrator);
+      trans_batch_integrator = nullptr;
+   }
+   if (trans_batch_position != nullptr) {
+      JEOD_DELETE_ARRAY (trans_batch_position);
+      JEOD_DELETE_ARRAY (trans_batch_velocity);
+      JEOD_DELETE_ARRAY (trans_batch_accel);
+      trans_batch_position = nullptr;
+      trans_batch_velocity = nullptr;
+      trans_batch_accel = nullptr;
+   }
+   trans_batch_capacity = 0;
+}
+
 } // End JEOD namespace
 
 /**
@@ -0,0 +1,339 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/src/energy_monitor.cc
+ * Define member functions for the class EnergyMonitor.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((energy_monitor.cc)
+   (dyn_manager.cc)
+   (dyn_manager_messages.cc)
+   (dynamics/dyn_body/src/dyn_body.cc)
+   (environment/gravity/src/spherical_harmonics_calc_potential.cc)
+   (environment/planet/src/planet.cc)
+   (utils/message/src/message_handler.cc)
+   (utils/ref_frames/src/ref_frame_compute_relative_state.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/planet/include/planet.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/dyn_manager.hh"
+#include "../include/dyn_manager_messages.hh"
+#include "../include/energy_monitor.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * EnergyMonitor default constructor.
+ */
+EnergyMonitor::EnergyMonitor ()
+:
+   planet_name(),
+   degree(0),
+   order(0),
+   background(true),
+   entries(),
+   samples(),
+   work(),
+   planet(nullptr),
+   source(nullptr),
+   mu(0.0),
+   sample_time(0.0),
+   num_skipped(0),
+   worker(),
+   mutex(),
+   cond(),
+   pending(false),
+   evaluated(false),
+   shutdown(false)
+{
+   ; // Empty
+}
+
+
+/**
+ * EnergyMonitor destructor. Stops and joins the worker thread.
+ */
+EnergyMonitor::~EnergyMonitor ()
+{
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      shutdown = true;
+   }
+   cond.notify_all ();
+
+   if (worker.joinable()) {
+      worker.join ();
+   }
+}
+
+
+/**
+ * Add a body to be monitored.
+ * \param[in] body The body
+ */
+void
+EnergyMonitor::add_body (
+   DynBody & body)
+{
+   flush ();
+
+   EnergyMonitorEntry entry;
+   entry.body = &body;
+   entries.push_back (entry);
+   samples.resize (entries.size());
+}
+
+
+/**
+ * Find the planet and its gravity source. A planet whose gravity source is
+ * not a spherical harmonics source is treated as a point mass.
+ * \param[in] manager Dynamics manager
+ */
+void
+EnergyMonitor::initialize (
+   DynManager & manager)
+{
+   planet = manager.find_planet (planet_name.c_str());
+   if (planet == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynManagerMessages::invalid_name,
+         "EnergyMonitor: Could not find planet named '%s'.",
+         planet_name.c_str());
+
+      // Not reached
+      return;
+   }
+   if (planet->grav_source == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "EnergyMonitor: Planet '%s' has no gravity source.",
+         planet_name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   mu = planet->grav_source->mu;
+   SphericalHarmonicsGravitySource * harmonics =
+      dynamic_cast<SphericalHarmonicsGravitySource *> (planet->grav_source);
+   if (harmonics != nullptr) {
+      if (degree == 0) {
+         degree = harmonics->degree;
+         order = harmonics->order;
+      }
+      // Build the tables now, on the calling thread.
+      harmonics->require_degree (degree);
+   }
+   source = harmonics;
+
+   planet->inertial.subscribe ();
+   planet->pfix.subscribe ();
+}
+
+
+/**
+ * Publish the most recently evaluated sample, then sample the bodies and
+ * evaluate the potentials, in the background if so configured. A
+ * background update that finds the previous sample still being evaluated
+ * does nothing but count the skip.
+ * \param[in] time Current time\n Units: s
+ */
+void
+EnergyMonitor::update (
+   double time)
+{
+   if (planet == nullptr) {
+      return;
+   }
+
+   if (! background) {
+      flush ();
+      capture (time);
+      evaluate ();
+      publish ();
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      if (pending) {
+         ++num_skipped;
+         return;
+      }
+      if (evaluated) {
+         publish ();
+         evaluated = false;
+      }
+   }
+
+   // The worker is idle, so the samples may be written without the lock.
+   capture (time);
+
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      if (! worker.joinable()) {
+         worker = std::thread (&EnergyMonitor::worker_loop, this);
+      }
+      pending = true;
+   }
+   cond.notify_all ();
+}
+
+
+/**
+ * Wait for the sample being evaluated in the background, if any, and
+ * publish it.
+ */
+void
+EnergyMonitor::flush ()
+{
+   std::unique_lock<std::mutex> lock (mutex);
+   while (pending) {
+      cond.wait (lock);
+   }
+   if (evaluated) {
+      publish ();
+      evaluated = false;
+   }
+}
+
+
+/**
+ * Sample each body's state relative to the planet's inertial and
+ * planet-fixed frames.
+ * \param[in] time Sample time\n Units: s
+ */
+void
+EnergyMonitor::capture (
+   double time)
+{
+   const double * omega = planet->pfix.state.rot.ang_vel_this;
+   RefFrameState rel_state;
+
+   sample_time = time;
+   for (std::size_t ii = 0; ii < entries.size(); ++ii) {
+      Sample & sample = samples[ii];
+      const BodyRefFrame & frame = entries[ii].body->composite_body;
+
+      frame.compute_relative_state (planet->inertial, rel_state);
+      sample.vel_inrtl_sq = Vector3::vmagsq (rel_state.trans.velocity);
+
+      frame.compute_relative_state (planet->pfix, rel_state);
+      Vector3::copy (rel_state.trans.position, sample.posn_pf);
+      sample.vel_pfix_sq = Vector3::vmagsq (rel_state.trans.velocity);
+
+      double rot_vel[3];
+      Vector3::cross (omega, sample.posn_pf, rot_vel);
+      sample.rot_vel_sq = Vector3::vmagsq (rot_vel);
+   }
+}
+
+
+/**
+ * Evaluate the potential at each sampled position.
+ */
+void
+EnergyMonitor::evaluate ()
+{
+   for (std::size_t ii = 0; ii < samples.size(); ++ii) {
+      Sample & sample = samples[ii];
+      if (source != nullptr) {
+         sample.potential =
+            source->calc_potential (sample.posn_pf, degree, order, work);
+      }
+      else {
+         sample.potential = mu / Vector3::vmag (sample.posn_pf);
+      }
+   }
+}
+
+
+/**
+ * Form each body's energy and Jacobi constant from the evaluated samples.
+ */
+void
+EnergyMonitor::publish ()
+{
+   for (std::size_t ii = 0; ii < entries.size(); ++ii) {
+      const Sample & sample = samples[ii];
+      EnergyMonitorEntry & entry = entries[ii];
+
+      entry.time = sample_time;
+      entry.energy = 0.5 * sample.vel_inrtl_sq - sample.potential;
+      entry.jacobi_constant =
+         0.5 * (sample.vel_pfix_sq - sample.rot_vel_sq) - sample.potential;
+
+      if (! entry.valid) {
+         entry.initial_energy = entry.energy;
+         entry.initial_jacobi = entry.jacobi_constant;
+         entry.valid = true;
+      }
+      entry.energy_change = entry.energy - entry.initial_energy;
+      entry.jacobi_change = entry.jacobi_constant - entry.initial_jacobi;
+   }
+}
+
+
+/**
+ * Worker thread main loop.
+ */
+void
+EnergyMonitor::worker_loop ()
+{
+   for (;;) {
+      {
+         std::unique_lock<std::mutex> lock (mutex);
+         while ((! shutdown) && (! pending)) {
+            cond.wait (lock);
+         }
+         if (shutdown) {
+            return;
+         }
+      }
+
+      evaluate ();
+
+      {
+         std::lock_guard<std::mutex> lock (mutex);
+         pending = false;
+         evaluated = true;
+      }
+      cond.notify_all ();
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -19,7 +19,8 @@ Library dependencies:
    (dynamics/dyn_body/src/dyn_body.cc)
    (dynamics/mass/src/mass_point_state.cc)
    (environment/gravity/src/gravity_manager.cc)
-   (utils/ref_frames/src/ref_frame.cc))
+   (utils/ref_frames/src/ref_frame.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 
@@ -32,6 +33,7 @@ Library dependencies:
 #include "dynamics/dyn_body/include/dyn_body.hh"
 #include "environment/gravity/include/gravity_manager.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/dyn_manager.hh"
@@ -51,6 +53,9 @@ void
 DynManager::initialize_gravity_controls (
    void)
 {
+   JEOD_PROFILE_SCOPE (
+      "dyn_manager", "DynManager::initialize_gravity_controls");
+
    // Sanity check:
    // The loop that follows will drop core if there is no Gravity Manager.
    // That this method was called is highly suspect.
@@ -125,6 +130,8 @@ void
 DynManager::gravitation (
    void)
 {
+   JEOD_PROFILE_SCOPE ("gravity", "DynManager::gravitation");
+
    // Sanity check:
    // The loop that follows will drop core if there is no Gravity Manager.
    // A message will already have been issued if the model is initialized,
@@ -24,7 +24,8 @@ Library dependencies:
    (dynamics/dyn_body/src/dyn_body.cc)
    (dynamics/mass/src/mass_point_state.cc)
    (utils/message/src/message_handler.cc)
-   (utils/ref_frames/src/ref_frame.cc))
+   (utils/ref_frames/src/ref_frame.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 *******************************************************************************/
@@ -41,6 +42,7 @@ Library dependencies:
 #include "dynamics/dyn_body/include/dyn_body.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/ref_frames/include/ref_frame_items.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 /* Model includes */
 #include "../include/dyn_manager.hh"
@@ -57,6 +59,7 @@ void
 DynManager::initialize_dyn_bodies (
    void)
 {
+   JEOD_PROFILE_SCOPE ("dyn_manager", "DynManager::initialize_dyn_bodies");
 
    // Initialize mass body mass properties and
    // perform initialization-time attachments.
@@ -95,6 +98,15 @@ DynManager::initialize_dyn_bodies (
          action->initialize (*this);
       }
    }
+
+   // Initialize the time-triggered actions, none of which has been touched
+   // by the preceding initialization-time processing.
+   for (std::vector<BodyAction *>::const_iterator it =
+           timed_body_actions.begin();
+        it != timed_body_actions.end();
+        ++it) {
+      (*it)->initialize (*this);
+   }
 }
 
 
@@ -130,6 +142,8 @@ void
 DynManager::perform_mass_body_initializations (
    MassBody * body)
 {
+   JEOD_PROFILE_SCOPE (
+      "body_action", "DynManager::perform_mass_body_initializations");
 
    // Initialize and then apply body actions that derive from MassBodyInit.
    // Note that the increment is in (and must be in) the loop body as
@@ -156,6 +170,7 @@ DynManager::perform_mass_body_initializations (
             action->apply (*this);
 
             // ... and delete it from the queue.
+            action->queued = false;
             body_actions.erase (it++);
          }
 
@@ -190,6 +205,8 @@ void
 DynManager::perform_mass_attach_initializations (
    void)
 {
+   JEOD_PROFILE_SCOPE (
+      "body_action", "DynManager::perform_mass_attach_initializations");
 
    // Initialize and then apply body actions that derive from MassBodyAttach.
    // Note that the increment is in (and must be in) the loop body as
@@ -214,6 +231,7 @@ DynManager::perform_mass_attach_initializations (
             action->apply (*this);
 
             // ... and delete it from the queue.
+            action->queued = false;
             body_actions.erase (it++);
          }
 
@@ -243,6 +261,9 @@ void
 DynManager::perform_dyn_body_initializations (
    DynBody * body)
 {
+   JEOD_PROFILE_SCOPE (
+      "body_action", "DynManager::perform_dyn_body_initializations");
+
    // Initialize the queued actions that derive from DynBodyInit.
 
    for (std::list<BodyAction *>::iterator it = body_actions.begin();
@@ -299,6 +320,7 @@ DynManager::perform_dyn_body_initializations (
 
                 // ... and delete it from the queue.
                 // Note that a side effect (via it++) is to advance the iterator.
+                action->queued = false;
                 body_actions.erase (it++);
 
                 // Update the ephemerides if the above did something weird.
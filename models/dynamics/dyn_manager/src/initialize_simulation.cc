@@ -19,7 +19,8 @@ Library dependencies:
   ((initialize_simulation.cc)
    (initialize_dyn_bodies.cc)
    (dynamics/dyn_body/src/dyn_body.cc)
-   (environment/gravity/src/gravity_manager.cc))
+   (environment/gravity/src/gravity_manager.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 ******************************************************************************/
@@ -32,6 +33,7 @@ Library dependencies:
 #include "dynamics/dyn_body/include/dyn_body.hh"
 #include "environment/gravity/include/gravity_manager.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/dyn_manager.hh"
@@ -94,9 +96,15 @@ DynManager::initialize_simulation (
    // Initialize the dynamic bodies.
    initialize_dyn_bodies ();
 
+   // Flatten the completed tree, which now includes the vehicle frames.
+   update_tree_index ();
+
    // Indicate that initialization has been completed.
    initialized = true;
 
+   // Report the initialization profile, if one is being collected.
+   JeodProfiler::report_initialization ();
+
    return;
 }
 
@@ -108,6 +116,8 @@ void
 DynManager::initialize_integ_groups (
    void)
 {
+   JEOD_PROFILE_SCOPE ("dyn_manager", "DynManager::initialize_integ_groups");
+
    // Initialize the integration groups.
    // Monolithic mode (no external groups registered):
    // Initialize the default group.
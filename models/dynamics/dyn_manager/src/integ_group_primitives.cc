@@ -8,7 +8,8 @@
  *
  * @file models/dynamics/dyn_manager/src/integ_group_primitives.cc
  * Define the DynManager member functions that search through and add elements
- * to the collection of DynamicsIntegrationGroup pointers.
+ * to the collection of DynamicsIntegrationGroup pointers, and those that
+ * manage the observers of the groups' integration cycles.
  */
 
 /*******************************************************************************
@@ -41,6 +42,7 @@ Library dependencies:
 // Model includes
 #include "../include/dyn_manager.hh"
 #include "../include/dyn_manager_messages.hh"
+#include "../include/integration_cycle_observer.hh"
 
 
 //! Namespace jeod
@@ -93,6 +95,59 @@ DynManager::add_integ_group (
    integ_groups.push_back (&integ_group);
 }
 
+
+/**
+ * Register an observer to be told at the end of each integration cycle.
+ * @param observer  Observer to be added.
+ */
+void
+DynManager::add_cycle_observer (
+   IntegrationCycleObserver & observer)
+{
+   if (std::find (cycle_observers.begin(), cycle_observers.end(), &observer) !=
+       cycle_observers.end()) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::duplicate_entry,
+         "Duplicate entry passed to add_cycle_observer()\n"
+         "Addition request ignored.");
+      return;
+   }
+
+   cycle_observers.push_back (&observer);
+}
+
+
+/**
+ * Deregister an integration cycle observer.
+ * @param observer  Observer to be removed.
+ */
+void
+DynManager::remove_cycle_observer (
+   IntegrationCycleObserver & observer)
+{
+   std::vector<IntegrationCycleObserver*>::iterator it =
+      std::find (cycle_observers.begin(), cycle_observers.end(), &observer);
+
+   if (it != cycle_observers.end()) {
+      cycle_observers.erase (it);
+   }
+}
+
+
+/**
+ * Tell the observers that an integration loop completed an integration
+ * cycle. Called by the integration loops.
+ * @param integ_group  The group whose cycle is complete.
+ */
+void
+DynManager::end_integration_cycle (
+   DynamicsIntegrationGroup & integ_group)
+{
+   for (unsigned int ii = 0; ii < cycle_observers.size(); ++ii) {
+      cycle_observers[ii]->integration_cycle_complete (integ_group);
+   }
+}
+
 } // End JEOD namespace
 
 /**
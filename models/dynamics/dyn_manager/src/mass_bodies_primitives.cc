@@ -20,7 +20,8 @@ Library dependencies:
    (dyn_manager.cc)
    (dyn_manager_messages.cc)
    (dynamics/mass/src/mass.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/message/src/message_handler.cc)
+   (utils/named_item/src/name_table.cc))
 
 
 *******************************************************************************/
@@ -33,6 +34,7 @@ Library dependencies:
 // JEOD includes
 #include "dynamics/mass/include/mass.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/named_item/include/name_table.hh"
 
 /* Model includes */
 #include "../include/dyn_manager.hh"
@@ -52,26 +54,51 @@ DynManager::find_mass_body (
    const char * body_name)
 const
 {
-   MassBody * found_body = nullptr;
-
    // Ensure the passed name has a minimally valid value.
    if (! validate_name (__FILE__, __LINE__, body_name, "Argument", "name")) {
       return nullptr;
    }
 
-   // Find the body by name.
-   // Future FIXME, C++11: Replace with std::find_if using a lambda expression.
-   for (std::vector<MassBody *>::const_iterator it = mass_bodies.begin();
-        it != mass_bodies.end();
-        ++it) {
-      MassBody * body = *it;
-      if (body->name.ends_with(0, body_name)) {
-         found_body = body;
-         break;
-      }
+   // Find the body by its interned name, as find_dyn_body does.
+   // The index is stale if bodies were added behind its back.
+   if (mass_body_index.size() != mass_bodies.size()) {
+      rebuild_mass_body_index ();
+   }
+
+   NameHandle handle = NameTable::find (body_name);
+   if (! handle.is_valid()) {
+      return nullptr;
    }
 
-   return found_body;
+   unsigned int found = mass_body_index.find (handle);
+
+   // Guard against a stale index, e.g., a renamed body, by verifying the hit.
+   if ((found != NameIndex::npos) &&
+       ((found >= mass_bodies.size()) ||
+        (! mass_bodies[found]->name.ends_with (0, body_name)))) {
+      rebuild_mass_body_index ();
+      found = mass_body_index.find (handle);
+   }
+
+   return (found != NameIndex::npos) ? mass_bodies[found] : nullptr;
+}
+
+
+/**
+ * Rebuild the name index from the list of mass bodies.
+ */
+void
+DynManager::rebuild_mass_body_index (
+   void)
+const
+{
+   mass_body_index.clear ();
+
+   // Keep the first entry for a name, which is what a linear search would find.
+   for (unsigned int ii = 0; ii < mass_bodies.size(); ++ii) {
+      mass_body_index.add (
+         NameTable::intern (mass_bodies[ii]->name.c_str()), ii);
+   }
 }
 
 
@@ -85,8 +112,8 @@ DynManager::is_mass_body_registered (
    const MassBody * mass_body)
 const
 {
-   return std::find (mass_bodies.begin(), mass_bodies.end(), mass_body) !=
-          mass_bodies.end();
+   return mass_body_positions.find (mass_bodies, mass_body) !=
+          mass_body_positions.npos;
 }
 
 
@@ -125,7 +152,46 @@ DynManager::add_mass_body (
    }
 
    // All tests passed: Add the body to the mass body registry.
-   mass_bodies.push_back (&mass_body);
+   mass_body_positions.push_back (mass_bodies, &mass_body);
+   if (mass_body_index.size() + 1 == mass_bodies.size()) {
+      mass_body_index.add (NameTable::intern (mass_body.name.c_str()),
+                           mass_bodies.size() - 1);
+   }
+}
+
+
+/**
+ * Remove a mass body from the mass body registry. The last body in the
+ * registry takes the removed body's place.
+ * @param mass_body  Mass body to be removed from the registry.
+ */
+void
+DynManager::remove_mass_body (
+   MassBody & mass_body)
+{
+   unsigned int position = mass_body_positions.find (mass_bodies, &mass_body);
+   if (position == mass_body_positions.npos) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Mass body '%s' is not registered.",
+         mass_body.name.c_str());
+      return;
+   }
+
+   // Keep the name index current if it is; otherwise let it be rebuilt.
+   NameHandle handle = NameTable::find (mass_body.name.c_str());
+   if (mass_body_index.find (handle) == position) {
+      MassBody * last = mass_bodies.back();
+      mass_body_index.remove (handle);
+      if (last != &mass_body) {
+         mass_body_index.set (NameTable::find (last->name.c_str()), position);
+      }
+   }
+   else {
+      mass_body_index.clear ();
+   }
+
+   mass_body_positions.swap_remove (mass_bodies, &mass_body);
 }
 
 
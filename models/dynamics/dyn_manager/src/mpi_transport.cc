@@ -0,0 +1,181 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/src/mpi_transport.cc
+ * Define member functions for the class MpiTransport.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((mpi_transport.cc)
+   (dyn_manager_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#ifdef JEOD_HAVE_MPI
+#include <mpi.h>
+#endif
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/dyn_manager_messages.hh"
+#include "../include/mpi_transport.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * MpiTransport default constructor.
+ */
+MpiTransport::MpiTransport ()
+:
+   DistributedTransport(),
+   rank(0),
+   num_ranks(1),
+   owns_mpi(false),
+   counts(),
+   displacements()
+{
+   ; // Empty
+}
+
+
+/**
+ * MpiTransport destructor.
+ */
+MpiTransport::~MpiTransport ()
+{
+#ifdef JEOD_HAVE_MPI
+   int finalized = 0;
+   MPI_Finalized (&finalized);
+   if (owns_mpi && (! finalized)) {
+      MPI_Finalize ();
+   }
+#endif
+}
+
+
+/**
+ * Initialize MPI, unless the simulation already has, and get the rank and
+ * the number of ranks.
+ */
+void
+MpiTransport::initialize ()
+{
+#ifdef JEOD_HAVE_MPI
+   int initialized = 0;
+   MPI_Initialized (&initialized);
+   if (! initialized) {
+      MPI_Init (nullptr, nullptr);
+      owns_mpi = true;
+   }
+
+   int mpi_rank = 0;
+   int mpi_size = 1;
+   MPI_Comm_rank (MPI_COMM_WORLD, &mpi_rank);
+   MPI_Comm_size (MPI_COMM_WORLD, &mpi_size);
+   rank = mpi_rank;
+   num_ranks = mpi_size;
+
+   counts.resize (num_ranks);
+   displacements.resize (num_ranks);
+
+#else
+   MessageHandler::fail (
+      __FILE__, __LINE__, DynManagerMessages::transport_error,
+      "JEOD was built without MPI support; rebuild with JEOD_MPI.");
+#endif
+}
+
+
+/**
+ * Get this process's rank.
+ * @return Rank in MPI_COMM_WORLD
+ */
+unsigned int
+MpiTransport::get_rank ()
+const
+{
+   return rank;
+}
+
+
+/**
+ * Get the number of ranks.
+ * @return Size of MPI_COMM_WORLD
+ */
+unsigned int
+MpiTransport::get_num_ranks ()
+const
+{
+   return num_ranks;
+}
+
+
+/**
+ * Gather every rank's values, concatenated in rank order, on all ranks.
+ * \param[in] send Values sent by this rank
+ * \param[in] send_count Number of values sent by this rank
+ * \param[out] recv Gathered values
+ * \param[in] recv_counts Number of values sent by each rank
+ */
+void
+MpiTransport::all_gather (
+   const double * send,
+   unsigned int send_count,
+   double * recv,
+   const unsigned int * recv_counts)
+{
+#ifdef JEOD_HAVE_MPI
+   int offset = 0;
+   for (unsigned int ii = 0; ii < num_ranks; ++ii) {
+      counts[ii] = recv_counts[ii];
+      displacements[ii] = offset;
+      offset += counts[ii];
+   }
+
+   int status = MPI_Allgatherv (
+      const_cast<double *>(send), send_count, MPI_DOUBLE,
+      recv, counts.data(), displacements.data(), MPI_DOUBLE,
+      MPI_COMM_WORLD);
+   if (status != MPI_SUCCESS) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, DynManagerMessages::transport_error,
+         "MPI_Allgatherv failed with status %d.", status);
+   }
+
+#else
+   (void) send;
+   (void) send_count;
+   (void) recv;
+   (void) recv_counts;
+   MessageHandler::fail (
+      __FILE__, __LINE__, DynManagerMessages::transport_error,
+      "JEOD was built without MPI support; rebuild with JEOD_MPI.");
+#endif
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
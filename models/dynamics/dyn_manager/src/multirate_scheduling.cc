@@ -0,0 +1,165 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/src/multirate_scheduling.cc
+ * Define the DynManager member functions that schedule multirate integration.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Sub-stepping applies to integration groups driven by their own
+    integration loop.))
+
+Library dependencies:
+  ((multirate_scheduling.cc)
+   (dyn_manager.cc)
+   (dynamics_integration_group.cc))
+
+
+
+******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+
+// Model includes
+#include "../include/dyn_manager.hh"
+#include "../include/dynamics_integration_group.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Select the number of sub-steps an integration group is to take over its
+ * next integration cycle.
+ *
+ * The count is a power of two so that the sub-step boundaries of groups with
+ * commensurate cycles coincide, which keeps the slow groups' dense output
+ * aligned with the fast groups' sub-steps. The rate hint and the Sundman
+ * steps of the group's bodies set a floor on the count; an error hint above
+ * one doubles the count and an error hint below multirate_coarsen_threshold
+ * halves it, subject to that floor and to the group's max_substeps. A count
+ * that sits on the floor follows the floor down when the floor drops, as it
+ * does when a body with a Sundman step recedes after a close approach. A change in the count changes the group's step size,
+ * which the group's integrators treat as a reset (a Gauss-Jackson integrator
+ * with a step_error_tolerance instead resamples its history when the step
+ * is halved, or doubled after settling).
+ *
+ * @param[in,out] integ_group  Integration group about to be integrated.
+ * @param[in]     cycle_dt     The group's integration cycle, in seconds.
+ * @return Number of sub-steps, one if the scheduler is disabled.
+ */
+unsigned int
+DynManager::schedule_substeps (
+   DynamicsIntegrationGroup & integ_group,
+   double cycle_dt)
+{
+   if (! multirate) {
+      return 1;
+   }
+
+   unsigned int limit = (integ_group.max_substeps > 0) ?
+                        integ_group.max_substeps : 1;
+
+   // Floor from the rate hint and the bodies' Sundman steps.
+   double max_step = integ_group.max_step_hint;
+   double sundman_step = integ_group.get_sundman_step ();
+   if ((sundman_step > 0.0) &&
+       ((max_step <= 0.0) || (sundman_step < max_step))) {
+      max_step = sundman_step;
+   }
+   unsigned int min_count = 1;
+   if (max_step > 0.0) {
+      while ((min_count < limit) && (cycle_dt > min_count * max_step)) {
+         min_count *= 2;
+      }
+   }
+
+   // Adjustment from the error hint, starting from the new floor if the
+   // previous count sat on a previous, higher floor.
+   unsigned int count = (integ_group.substeps > 0) ? integ_group.substeps : 1;
+   if ((count == integ_group.floor_substeps) && (min_count < count)) {
+      count = min_count;
+   }
+   integ_group.floor_substeps = min_count;
+   if (integ_group.error_hint > 1.0) {
+      count *= 2;
+   }
+   else if ((integ_group.error_hint > 0.0) &&
+            (integ_group.error_hint < multirate_coarsen_threshold) &&
+            (count > 1)) {
+      count /= 2;
+   }
+   integ_group.error_hint = 0.0;
+
+   if (count < min_count) {
+      count = min_count;
+   }
+   while (count > limit) {
+      count /= 2;
+   }
+   if (count == 0) {
+      count = 1;
+   }
+
+   integ_group.substeps = count;
+   return count;
+}
+
+
+/**
+ * Interpolate a body's translational state from the dense output of the
+ * integration group that integrates it. This is the coupling mechanism for
+ * multirate simulations: a model in a fast group can obtain the state of a
+ * body in a slow group at a fast sub-step time within the slow group's most
+ * recent step. The slow group must have dense_output enabled.
+ * @param[in]  dyn_body  Body whose state is wanted.
+ * @param[in]  dyn_time  Dynamic time, in seconds.
+ * @param[out] velocity  Interpolated velocity.
+ * @param[out] position  Interpolated position.
+ * @return True if some group could interpolate the body's state.
+ */
+bool
+DynManager::interpolate_trans_state (
+   const DynBody & dyn_body,
+   double dyn_time,
+   double * velocity,
+   double * position)
+const
+{
+   for (std::vector<DynamicsIntegrationGroup*>::const_iterator it =
+           integ_groups.begin();
+        it != integ_groups.end();
+        ++it) {
+      if ((*it)->interpolate_state (dyn_body, dyn_time, velocity, position)) {
+         return true;
+      }
+   }
+   if ((default_integ_group != nullptr) &&
+       default_integ_group->interpolate_state (
+          dyn_body, dyn_time, velocity, position)) {
+      return true;
+   }
+   return false;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
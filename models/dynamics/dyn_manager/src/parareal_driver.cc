@@ -0,0 +1,340 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup DynManager
+ * @{
+ *
+ * @file models/dynamics/dyn_manager/src/parareal_driver.cc
+ * Define member functions for the class PararealDriver.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((parareal_driver.cc)
+   (derivative_thread_pool.cc)
+   (dyn_manager_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/derivative_thread_pool.hh"
+#include "../include/dyn_manager_messages.hh"
+#include "../include/parareal_driver.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Propagates the open slices with their fine propagators.
+ */
+class FineSliceTask : public DerivativeThreadTask {
+public:
+
+   /**
+    * Constructor.
+    * @param[in] driver_in  Driver whose slices are propagated.
+    * @param[in] first_in   First slice to propagate.
+    */
+   FineSliceTask (PararealDriver & driver_in, unsigned int first_in)
+   :
+      driver (driver_in),
+      first (first_in)
+   {}
+
+   /**
+    * Propagate one slice.
+    * @param[in] index  Index relative to the first slice.
+    */
+   void execute (unsigned int index) override
+   {
+      driver.propagate_fine_slice (first + index);
+   }
+
+private:
+
+   /**
+    * Driver whose slices are propagated.
+    */
+   PararealDriver & driver;
+
+   /**
+    * First slice to propagate.
+    */
+   unsigned int first;
+};
+
+}
+
+
+/**
+ * PararealDriver default constructor.
+ */
+PararealDriver::PararealDriver ()
+:
+   tolerance (1e-12),
+   max_iterations (0),
+   num_threads (0),
+   coarse (nullptr),
+   fine (),
+   thread_pool (nullptr),
+   size (0),
+   iterations (0),
+   first_open (0),
+   times (),
+   states (),
+   coarse_out (),
+   fine_out (),
+   fine_ok (),
+   scratch ()
+{
+   return;
+}
+
+
+/**
+ * PararealDriver destructor.
+ */
+PararealDriver::~PararealDriver ()
+{
+   DerivativeThreadPool::release (thread_pool);
+}
+
+
+/**
+ * Set the coarse propagator.
+ * @param[in] propagator  Coarse propagator.
+ */
+void
+PararealDriver::set_coarse_propagator (
+   PararealPropagator & propagator)
+{
+   coarse = &propagator;
+}
+
+
+/**
+ * Add a fine propagator. Each fine propagator propagates one time slice.
+ * @param[in] propagator  Fine propagator.
+ */
+void
+PararealDriver::add_fine_propagator (
+   PararealPropagator & propagator)
+{
+   if (std::find (fine.begin(), fine.end(), &propagator) != fine.end()) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::duplicate_entry,
+         "A fine propagator may be used by only one slice.\n");
+      return;
+   }
+   fine.push_back (&propagator);
+}
+
+
+/**
+ * Get the state at the start of a slice from the most recent propagation.
+ * Slice index nslices gives the final state.
+ * @param[in] slice  Slice index.
+ * @return Slice start state, or null if the index is out of range.
+ */
+const double *
+PararealDriver::get_slice_state (
+   unsigned int slice)
+const
+{
+   if ((size == 0) || (slice > fine.size()) ||
+       ((slice + 1) * size > states.size())) {
+      return nullptr;
+   }
+   return &states[slice * size];
+}
+
+
+/**
+ * Create, resize, or release the thread pool per num_threads.
+ * @return Thread pool, or null if the slices are propagated serially.
+ */
+DerivativeThreadPool *
+PararealDriver::prepare_thread_pool ()
+{
+   if (num_threads < 2) {
+      DerivativeThreadPool::release (thread_pool);
+      return nullptr;
+   }
+   return DerivativeThreadPool::acquire (thread_pool, num_threads);
+}
+
+
+/**
+ * Propagate a slice's start state with the slice's fine propagator.
+ * Each call touches only the slice's own data.
+ * @param[in] slice  Slice index.
+ */
+void
+PararealDriver::propagate_fine_slice (
+   unsigned int slice)
+{
+   fine_ok[slice] =
+      fine[slice]->propagate (
+         times[slice], times[slice+1],
+         &states[slice * size], &fine_out[slice * size]) ? 1 : 0;
+}
+
+
+/**
+ * Propagate a state over an interval by Parareal iteration.
+ * @param[in]  state_size     Number of elements in the state.
+ * @param[in]  start_time     Start time, in seconds.
+ * @param[in]  end_time       End time, in seconds.
+ * @param[in]  initial_state  State at the start time.
+ * @param[out] final_state    State at the end time.
+ * @return True if the iteration converged and every propagation succeeded.
+ */
+bool
+PararealDriver::propagate (
+   unsigned int state_size,
+   double start_time,
+   double end_time,
+   const double * initial_state,
+   double * final_state)
+{
+   unsigned int nslices = fine.size();
+
+   if ((coarse == nullptr) || (nslices == 0) || (state_size == 0)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "The Parareal driver needs a coarse propagator, at least one "
+         "fine propagator, and a non-empty state.\n");
+      return false;
+   }
+
+   size = state_size;
+   times.resize (nslices + 1);
+   states.resize ((nslices + 1) * size);
+   coarse_out.resize (nslices * size);
+   fine_out.resize (nslices * size);
+   fine_ok.assign (nslices, 0);
+   scratch.resize (size);
+
+   for (unsigned int ii = 0; ii <= nslices; ++ii) {
+      times[ii] = start_time + (end_time - start_time) * ii / nslices;
+   }
+   times[nslices] = end_time;
+
+   // Initial coarse sweep.
+   std::copy (initial_state, initial_state + size, states.begin());
+   for (unsigned int ii = 0; ii < nslices; ++ii) {
+      if (! coarse->propagate (times[ii], times[ii+1],
+                               &states[ii * size], &coarse_out[ii * size])) {
+         return false;
+      }
+      std::copy (&coarse_out[ii * size], &coarse_out[ii * size] + size,
+                 &states[(ii+1) * size]);
+   }
+
+   unsigned int limit =
+      ((max_iterations > 0) && (max_iterations < nslices)) ?
+      max_iterations : nslices;
+   DerivativeThreadPool * pool = prepare_thread_pool ();
+   bool converged = false;
+
+   first_open = 0;
+   for (iterations = 1; iterations <= limit; ++iterations) {
+
+      // Fine propagation of the open slices, in parallel.
+      FineSliceTask task (*this, first_open);
+      if (pool != nullptr) {
+         pool->run (nslices - first_open, task);
+      }
+      else {
+         for (unsigned int ii = 0; ii < nslices - first_open; ++ii) {
+            task.execute (ii);
+         }
+      }
+      for (unsigned int ii = first_open; ii < nslices; ++ii) {
+         if (fine_ok[ii] == 0) {
+            MessageHandler::error (
+               __FILE__, __LINE__, DynManagerMessages::internal_error,
+               "Fine propagation of Parareal slice %u failed.\n", ii);
+            return false;
+         }
+      }
+
+      // Serial correction sweep. The first open slice's start state is
+      // exact, so its fine result is the exact state at its end.
+      double max_change = 0.0;
+      double max_state = 0.0;
+      for (unsigned int ii = first_open; ii < nslices; ++ii) {
+         double * next = &states[(ii+1) * size];
+         const double * fine_ii = &fine_out[ii * size];
+         double * coarse_ii = &coarse_out[ii * size];
+
+         if (ii == first_open) {
+            for (unsigned int jj = 0; jj < size; ++jj) {
+               max_change = std::max (max_change,
+                                      std::fabs (fine_ii[jj] - next[jj]));
+               next[jj] = fine_ii[jj];
+            }
+            continue;
+         }
+
+         if (! coarse->propagate (times[ii], times[ii+1],
+                                  &states[ii * size], &scratch[0])) {
+            return false;
+         }
+         for (unsigned int jj = 0; jj < size; ++jj) {
+            double updated = scratch[jj] + fine_ii[jj] - coarse_ii[jj];
+            max_change = std::max (max_change,
+                                   std::fabs (updated - next[jj]));
+            max_state = std::max (max_state, std::fabs (updated));
+            next[jj] = updated;
+            coarse_ii[jj] = scratch[jj];
+         }
+      }
+      ++first_open;
+
+      if ((first_open >= nslices) || (max_change <= tolerance * max_state)) {
+         converged = true;
+         break;
+      }
+   }
+
+   if (! converged) {
+      iterations = limit;
+      MessageHandler::warn (
+         __FILE__, __LINE__, DynManagerMessages::inconsistent_setup,
+         "Parareal iteration did not converge in %u iterations.\n", limit);
+   }
+
+   std::copy (&states[nslices * size], &states[nslices * size] + size,
+              final_state);
+
+   return converged;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -16,6 +16,7 @@ Purpose:
 
 Library dependencies:
   ((perform_actions.cc)
+   (dynamics/body_action/src/dyn_body_frame_switch.cc)
    (dynamics/mass/src/mass_point_state.cc))
 
 
@@ -23,11 +24,13 @@ Library dependencies:
 
 
 // System includes
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 
 // JEOD includes
 #include "dynamics/body_action/include/body_action.hh"
+#include "dynamics/body_action/include/dyn_body_frame_switch.hh"
 
 // Model includes
 #include "../include/dyn_manager.hh"
@@ -37,6 +40,30 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+/**
+ * Move the time-triggered actions whose activation time has been reached
+ * to the action queue, activating them on the way.
+ * Each activation costs O(log n) in the number of held actions; actions
+ * that are not yet due are not visited.
+ * \param[in] time Current dynamics manager time\n Units: s
+ */
+void
+DynManager::activate_timed_actions (
+   double time)
+{
+   while ((! timed_body_actions.empty()) &&
+          (timed_body_actions.front()->activation_time <= time)) {
+      std::pop_heap (timed_body_actions.begin(), timed_body_actions.end(),
+                     activates_after);
+      BodyAction * action = timed_body_actions.back();
+      timed_body_actions.pop_back();
+
+      action->active = true;
+      body_actions.push_back (action);
+   }
+}
+
+
 /**
  * Perform dynamic body actions that are ready to be applied.
  */
@@ -45,6 +72,28 @@ DynManager::perform_actions (
    void)
 {
 
+   // Enqueue the time-triggered actions that are now due.
+   if (! timed_body_actions.empty()) {
+      activate_timed_actions (timestamp());
+   }
+
+   // Evaluate the switch conditions of the active frame switches together;
+   // each switch's is_ready call below returns the verdict reached here.
+   pending_frame_switches.clear();
+   for (BodyAction * action : body_actions) {
+      if (action->active) {
+         DynBodyFrameSwitch * frame_switch =
+            dynamic_cast<DynBodyFrameSwitch *> (action);
+         if (frame_switch != nullptr) {
+            pending_frame_switches.push_back (frame_switch);
+         }
+      }
+   }
+   if (! pending_frame_switches.empty()) {
+      DynBodyFrameSwitch::evaluate_switches (pending_frame_switches.size(),
+                                             pending_frame_switches.data());
+   }
+
    // Walk over all of the queued actions, performing any actions that are
    // ready to be performed.
    for (std::list<BodyAction *>::iterator it = body_actions.begin();
@@ -54,8 +103,10 @@ DynManager::perform_actions (
 
       // Action is ready:
       // Apply the action and delete it from the queue.
-      if (action->is_ready()) {
+      // Inactive actions are never ready; skip the virtual query for them.
+      if (action->active && action->is_ready()) {
          action->apply (*this);
+         action->queued = false;
          body_actions.erase (it++);
       }
 
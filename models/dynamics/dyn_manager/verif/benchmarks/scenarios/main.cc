@@ -0,0 +1,959 @@
+/*
+ * End-to-end scenario benchmark.
+ *
+ * Runs a set of representative simulations without Trick, each driven by a
+ * JeodStandaloneIntegrationLoop with an RK4 integrator, and writes steps per
+ * second and the time spent in each model to stdout as JSON:
+ *
+ *   leo_ggm05c_drag    One LEO vehicle, GGM05C 70x70 gravity, MET
+ *                      atmosphere and ballistic drag.
+ *   lunar_grail150     One low lunar orbiter, GRAIL150 150x150 gravity.
+ *   constellation_500  500 vehicles in a 20-plane Walker constellation,
+ *                      GGM05C 8x8 gravity.
+ *   docking_contact    Two vehicles closing at 5 cm/s with a ring of
+ *                      32 point-contact pads on each docking face.
+ *   multibody_slosh    A thrusting four-body stack whose stages carry
+ *                      20 pendulum slosh constraints.
+ *
+ * Planet orientation is a uniform rotation about the pole, updated once per
+ * cycle, so that no Earth orientation or ephemeris files are needed. All
+ * random inputs (constellation phasing, docking misalignment) come from a
+ * fixed seed, so repeated runs integrate the same trajectories.
+ *
+ * Model times: gravity, forces, integration and propagation are the per-body
+ * costs accumulated by the dynamics manager; environment, contact and
+ * constraints are timed here around the model calls. Constraint solution
+ * happens during force collection and so is also part of the forces time.
+ * Builds with JEOD_PROFILING set additionally write each scenario's
+ * JeodProfiler summary to <scenario>_profile.json.
+ *
+ * Options:
+ *   -MinTime <s>  Minimum measured wall time per scenario (default 2 s)
+ *   -Verbose      Also write a human-readable table to stderr
+ */
+
+// Local definitions
+#define BENCH_SEED 80
+#define MIN_STEPS 10
+
+// System includes
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/body_action/include/body_attach_matrix.hh"
+#include "dynamics/body_action/include/dyn_body_init_rot_state.hh"
+#include "dynamics/body_action/include/dyn_body_init_trans_state.hh"
+#include "dynamics/body_action/include/mass_body_init.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_body/include/dyn_body_cost.hh"
+#include "dynamics/dyn_body/include/force.hh"
+#include "dynamics/dyn_body/include/structure_integrated_dyn_body.hh"
+#include "dynamics/dyn_body/include/torque.hh"
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "dynamics/dyn_manager/include/dyn_manager_init.hh"
+#include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
+#include "environment/atmosphere/MET/include/MET_atmosphere.hh"
+#include "environment/atmosphere/MET/include/MET_atmosphere_state.hh"
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/gravity/data/include/earth_GGM05C.hh"
+#include "environment/gravity/data/include/moon_GRAIL150.hh"
+#include "environment/planet/include/planet.hh"
+#include "environment/planet/data/include/earth.hh"
+#include "environment/planet/data/include/moon.hh"
+#include "environment/time/include/time_manager.hh"
+#include "environment/time/include/time_manager_init.hh"
+#include "experimental/constraints/include/base_pendulum_model.hh"
+#include "experimental/constraints/include/dyn_body_constraints_solver.hh"
+#include "experimental/constraints/include/dyn_body_pendulum_constraint.hh"
+#include "experimental/math/include/gauss_jordan_solver.hh"
+#include "interactions/aerodynamics/include/aero_drag.hh"
+#include "interactions/contact/include/contact.hh"
+#include "interactions/contact/include/contact_params.hh"
+#include "interactions/contact/include/contact_surface.hh"
+#include "interactions/contact/include/contact_surface_factory.hh"
+#include "interactions/contact/include/spring_pair_interaction.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
+#include "utils/ref_frames/include/ref_frame_interface.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
+#include "utils/sim_interface/include/standalone_dynbody_integ_loop.hh"
+#include "utils/surface_model/include/flat_plate_circular.hh"
+#include "utils/surface_model/include/surface_model.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "test_harness/include/cmdline_parser.hh"
+
+#include "er7_utils/integration/core/include/integrator_constructor_factory.hh"
+
+using namespace jeod;
+
+namespace {
+
+/**
+ * Uniform rotation of a planet about its pole, standing in for an RNP model.
+ */
+class BenchRotation : public RefFrameOwner {
+public:
+   Planet * planet;
+   double rate;
+
+   BenchRotation () : planet(nullptr), rate(0.0) {}
+
+   void update (double sim_time)
+   {
+      RefFrameRot & rot = planet->pfix.state.rot;
+      double angle = rate * sim_time;
+      double cos_a = std::cos (angle);
+      double sin_a = std::sin (angle);
+
+      rot.T_parent_this[0][0] =  cos_a;
+      rot.T_parent_this[0][1] =  sin_a;
+      rot.T_parent_this[0][2] =  0.0;
+      rot.T_parent_this[1][0] = -sin_a;
+      rot.T_parent_this[1][1] =  cos_a;
+      rot.T_parent_this[1][2] =  0.0;
+      rot.T_parent_this[2][0] =  0.0;
+      rot.T_parent_this[2][1] =  0.0;
+      rot.T_parent_this[2][2] =  1.0;
+      rot.ang_vel_this[0] = 0.0;
+      rot.ang_vel_this[1] = 0.0;
+      rot.ang_vel_this[2] = rate;
+      rot.compute_quaternion ();
+      rot.compute_ang_vel_unit ();
+      planet->pfix.set_timestamp (sim_time);
+   }
+};
+
+
+/**
+ * A vehicle and the body actions and gravity controls that set it up.
+ */
+struct BenchVehicle {
+   DynBody * body;
+   MassBodyInit mass_init;
+   DynBodyInitTransState trans_init;
+   DynBodyInitRotState rot_init;
+   SphericalHarmonicsGravityControls grav_controls;
+
+   explicit BenchVehicle (DynBody * body_in) : body(body_in) {}
+
+   ~BenchVehicle () { delete body; }
+};
+
+
+/**
+ * One benchmark scenario: a planet, its gravity field, and the vehicles
+ * integrated by a standalone integration loop. Scenarios add their own
+ * vehicles and models, and their own derivative-time model calls.
+ */
+class Scenario {
+public:
+   const char * name;
+   double cycle;
+   double planet_rate;
+
+   TimeManager time_manager;
+   TimeManagerInit time_init;
+   DynManager dyn_manager;
+   DynManagerInit dyn_init;
+   GravityManager grav_manager;
+   Planet planet;
+   SphericalHarmonicsGravitySource grav_source;
+   BenchRotation rotation;
+
+   er7_utils::IntegratorConstructor * integ_cotr;
+   DynamicsIntegrationGroup integ_group_factory;
+   JeodStandaloneIntegrationLoop * loop;
+
+   std::vector<BenchVehicle *> vehicles;
+
+   double environment_time;
+   double contact_time;
+   double constraint_time;
+
+   Scenario (const char * name_in, double cycle_in)
+   :
+      name(name_in),
+      cycle(cycle_in),
+      planet_rate(0.0),
+      integ_cotr(nullptr),
+      loop(nullptr),
+      environment_time(0.0),
+      contact_time(0.0),
+      constraint_time(0.0)
+   { }
+
+   virtual ~Scenario ()
+   {
+      delete loop;
+      for (BenchVehicle * vehicle : vehicles) {
+         delete vehicle;
+      }
+      delete integ_cotr;
+   }
+
+   template <typename PlanetData, typename GravityData>
+   void setup (double rate);
+
+   BenchVehicle & add_vehicle (
+      DynBody * body, const char * body_name, double mass,
+      const double position[3], const double velocity[3],
+      unsigned int degree);
+
+   void add_circular_orbit (
+      BenchVehicle & vehicle, double radius, double raan, double incl,
+      double arg_lat);
+
+   void run (double min_time, bool first, bool verbose);
+
+   // Scenario-specific models, added before the simulation is initialized.
+   virtual void add_models () = 0;
+
+   // Scenario-specific initialization after the simulation is initialized.
+   virtual void start () {}
+
+   // Scenario-specific models evaluated on each derivative pass, after
+   // gravitation and before forces are collected.
+   virtual void derivatives () {}
+
+   static void derivative_hook (void * scenario)
+   {
+      static_cast<Scenario *>(scenario)->derivatives ();
+   }
+};
+
+
+/**
+ * Set up time, the dynamics manager, the planet and its gravity field,
+ * the integration loop and the scenario's models, and initialize the
+ * simulation.
+ */
+template <typename PlanetData, typename GravityData>
+void
+Scenario::setup (
+   double rate)
+{
+   PlanetData planet_init;
+   GravityData gravity_init;
+
+   time_manager.initialize (&time_init);
+
+   planet_init.initialize (&planet);
+   gravity_init.initialize (&grav_source);
+
+   dyn_init.mode = DynManagerInit::EphemerisMode_SinglePlanet;
+   dyn_init.central_point_name = JEOD_STRDUP (planet.name.c_str());
+   dyn_init.jeod_integ_opt = er7_utils::Integration::RungeKutta4;
+   dyn_manager.initialize_model (dyn_init, time_manager);
+
+   grav_source.initialize_body ();
+   planet.register_model (grav_source, dyn_manager);
+   planet.initialize ();
+   grav_manager.add_grav_source (grav_source);
+   grav_manager.initialize_model (dyn_manager);
+
+   planet_rate = rate;
+   rotation.planet = &planet;
+   rotation.rate = rate;
+   planet.pfix.set_owner (&rotation);
+   rotation.update (0.0);
+
+   integ_cotr = er7_utils::IntegratorConstructorFactory::create (
+                   er7_utils::Integration::RungeKutta4);
+   loop = new JeodStandaloneIntegrationLoop (
+                 cycle, time_manager, dyn_manager, grav_manager,
+                 integ_cotr, integ_group_factory);
+   loop->set_derivative_function (derivative_hook, this);
+
+   std::srand (BENCH_SEED);
+   add_models ();
+
+   loop->initialize_integ_loop ();
+   dyn_manager.initialize_simulation ();
+   dyn_manager.set_body_cost_tracking (true);
+
+   start ();
+}
+
+
+/**
+ * Create a vehicle with a diagonal inertia, queue its initialization and
+ * register it with the dynamics manager and the integration loop.
+ * A degree of zero selects spherical gravity.
+ */
+BenchVehicle &
+Scenario::add_vehicle (
+   DynBody * body,
+   const char * body_name,
+   double mass,
+   const double position[3],
+   const double velocity[3],
+   unsigned int degree)
+{
+   BenchVehicle * vehicle = new BenchVehicle (body);
+   vehicles.push_back (vehicle);
+
+   body->set_name (body_name);
+   body->integ_frame_name = JEOD_STRDUP (planet.inertial.get_name());
+   body->translational_dynamics = true;
+   body->rotational_dynamics = true;
+
+   vehicle->mass_init.action_name = std::string (body_name) + ".mass";
+   vehicle->mass_init.set_subject_body (*body);
+   vehicle->mass_init.properties.mass = mass;
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         vehicle->mass_init.properties.inertia[ii][jj] =
+            (ii == jj) ? mass : 0.0;
+      }
+   }
+
+   vehicle->trans_init.action_name = std::string (body_name) + ".trans";
+   vehicle->trans_init.set_subject_body (*body);
+   vehicle->trans_init.reference_ref_frame_name = planet.inertial.get_name();
+   vehicle->trans_init.body_frame_id = "composite_body";
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      vehicle->trans_init.position[ii] = position[ii];
+      vehicle->trans_init.velocity[ii] = velocity[ii];
+   }
+
+   vehicle->rot_init.action_name = std::string (body_name) + ".rot";
+   vehicle->rot_init.set_subject_body (*body);
+   vehicle->rot_init.reference_ref_frame_name = planet.inertial.get_name();
+   vehicle->rot_init.body_frame_id = "composite_body";
+   vehicle->rot_init.orientation.data_source = Orientation::InputMatrix;
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         vehicle->rot_init.orientation.trans[ii][jj] = (ii == jj) ? 1.0 : 0.0;
+      }
+      vehicle->rot_init.ang_velocity[ii] = 0.0;
+   }
+
+   vehicle->grav_controls.source_name = grav_source.name;
+   vehicle->grav_controls.active = true;
+   vehicle->grav_controls.spherical = (degree == 0);
+   vehicle->grav_controls.degree = degree;
+   vehicle->grav_controls.order = degree;
+
+   body->initialize_model (dyn_manager);
+   body->add_control (&vehicle->grav_controls);
+   dyn_manager.add_body_action (&vehicle->mass_init);
+   dyn_manager.add_body_action (&vehicle->trans_init);
+   dyn_manager.add_body_action (&vehicle->rot_init);
+   loop->add_dyn_body (*body);
+
+   return *vehicle;
+}
+
+
+/**
+ * Place a vehicle on a circular orbit.
+ */
+void
+Scenario::add_circular_orbit (
+   BenchVehicle & vehicle,
+   double radius,
+   double raan,
+   double incl,
+   double arg_lat)
+{
+   double speed = std::sqrt (grav_source.mu / radius);
+   double cos_o = std::cos (raan);
+   double sin_o = std::sin (raan);
+   double cos_i = std::cos (incl);
+   double sin_i = std::sin (incl);
+   double cos_u = std::cos (arg_lat);
+   double sin_u = std::sin (arg_lat);
+
+   double * pos = vehicle.trans_init.position;
+   double * vel = vehicle.trans_init.velocity;
+
+   pos[0] = radius * (cos_o * cos_u - sin_o * sin_u * cos_i);
+   pos[1] = radius * (sin_o * cos_u + cos_o * sin_u * cos_i);
+   pos[2] = radius * (sin_u * sin_i);
+   vel[0] = speed * (-cos_o * sin_u - sin_o * cos_u * cos_i);
+   vel[1] = speed * (-sin_o * sin_u + cos_o * cos_u * cos_i);
+   vel[2] = speed * (cos_u * sin_i);
+}
+
+
+/**
+ * Integrate until at least min_time of wall time has elapsed and write
+ * the scenario's JSON record.
+ */
+void
+Scenario::run (
+   double min_time,
+   bool first,
+   bool verbose)
+{
+   // One untimed cycle creates the integrators and warms the caches.
+   rotation.update (loop->get_sim_time ());
+   loop->integrate_cycle ();
+
+   dyn_manager.reset_body_costs ();
+   environment_time = 0.0;
+   contact_time = 0.0;
+   constraint_time = 0.0;
+#if JEOD_PROFILING
+   JeodProfiler::reset ();
+#endif
+
+   unsigned long steps = 0;
+   double start = DynBodyCost::wall_time ();
+   double elapsed = 0.0;
+   double start_sim_time = loop->get_sim_time ();
+   while ((steps < MIN_STEPS) || (elapsed < min_time)) {
+      rotation.update (loop->get_sim_time ());
+      loop->integrate_cycle ();
+      ++steps;
+      elapsed = DynBodyCost::wall_time () - start;
+   }
+   double sim_time = loop->get_sim_time () - start_sim_time;
+
+   double model_time[DynBodyCost::NumCategories] = {0.0, 0.0, 0.0, 0.0};
+   double checksum = 0.0;
+   for (BenchVehicle * vehicle : vehicles) {
+      for (unsigned int ii = 0; ii < DynBodyCost::NumCategories; ++ii) {
+         model_time[ii] += vehicle->body->cost.time[ii];
+      }
+      checksum += vehicle->body->composite_body.state.trans.position[0] +
+                  vehicle->body->composite_body.state.trans.position[1] +
+                  vehicle->body->composite_body.state.trans.position[2];
+   }
+   double other_time = elapsed - environment_time - contact_time;
+   for (unsigned int ii = 0; ii < DynBodyCost::NumCategories; ++ii) {
+      other_time -= model_time[ii];
+   }
+
+   std::vector<DynBody *> by_cost = dyn_manager.get_dyn_bodies_by_cost ();
+
+   std::printf ("%s\n    {\"scenario\": \"%s\", \"bodies\": %u, "
+                "\"cycle\": %g, \"steps\": %lu, \"wall_time\": %.6f, "
+                "\"steps_per_second\": %.3f, \"sim_rate\": %.3f,\n"
+                "     \"model_time\": {\"gravity\": %.6f, "
+                "\"forces\": %.6f, \"integration\": %.6f, "
+                "\"propagation\": %.6f, \"environment\": %.6f, "
+                "\"contact\": %.6f, \"constraints\": %.6f, "
+                "\"other\": %.6f},\n",
+                first ? "" : ",", name,
+                static_cast<unsigned int> (vehicles.size ()),
+                cycle, steps, elapsed, steps / elapsed, sim_time / elapsed,
+                model_time[DynBodyCost::Gravity],
+                model_time[DynBodyCost::Forces],
+                model_time[DynBodyCost::Integration],
+                model_time[DynBodyCost::Propagation],
+                environment_time, contact_time, constraint_time, other_time);
+   if (by_cost.empty ()) {
+      std::printf ("     \"costliest_body\": null, ");
+   }
+   else {
+      std::printf ("     \"costliest_body\": {\"name\": \"%s\", "
+                   "\"time\": %.6f}, ",
+                   by_cost.front ()->name.c_str (),
+                   by_cost.front ()->cost.total_time ());
+   }
+   std::printf ("\"checksum\": %.17g}", checksum);
+
+#if JEOD_PROFILING
+   JeodProfiler::write_summary_json (std::string (name) + "_profile.json");
+#endif
+
+   if (verbose) {
+      std::fprintf (stderr,
+                    "%-18s %4u bodies %8lu steps %10.1f steps/s  "
+                    "grav %7.3f  forces %7.3f  integ %7.3f  env %7.3f  "
+                    "contact %7.3f  constr %7.3f s\n",
+                    name, static_cast<unsigned int> (vehicles.size ()),
+                    steps, steps / elapsed,
+                    model_time[DynBodyCost::Gravity],
+                    model_time[DynBodyCost::Forces],
+                    model_time[DynBodyCost::Integration],
+                    environment_time, contact_time, constraint_time);
+   }
+}
+
+
+/**
+ * LEO vehicle with GGM05C 70x70 gravity and MET atmosphere drag.
+ */
+class LeoDragScenario : public Scenario {
+public:
+   METAtmosphere atmosphere;
+   PlanetFixedPosition pfix_position;
+   METAtmosphereState * atmos_state;
+   AerodynamicDrag drag;
+   BenchVehicle * vehicle;
+
+   LeoDragScenario ()
+   :
+      Scenario ("leo_ggm05c_drag", 1.0),
+      atmos_state(nullptr),
+      vehicle(nullptr)
+   { }
+
+   ~LeoDragScenario () override { delete atmos_state; }
+
+   void add_models () override
+   {
+      double zero[3] = {0.0, 0.0, 0.0};
+      vehicle = &add_vehicle (new DynBody, "leo", 20000.0, zero, zero, 70);
+      add_circular_orbit (*vehicle, planet.r_eq + 400.0e3,
+                          0.3, 51.6 * M_PI / 180.0, 0.0);
+
+      pfix_position.initialize (&planet);
+      atmos_state = new METAtmosphereState (atmosphere, pfix_position);
+
+      drag.active = true;
+      drag.ballistic_drag.option = DefaultAero::DRAG_OPT_CD;
+      drag.ballistic_drag.Cd = 2.2;
+      drag.ballistic_drag.area = 20.0;
+
+      vehicle->body->collect.collect_environ_forc.push_back (
+         CollectForce::create (drag.aero_force));
+      vehicle->body->collect.collect_environ_torq.push_back (
+         CollectTorque::create (drag.aero_torque));
+   }
+
+   void derivatives () override
+   {
+      double start = DynBodyCost::wall_time ();
+      DynBody & body = *vehicle->body;
+      double pfix_pos[3];
+
+      Vector3::transform (planet.pfix.state.rot.T_parent_this,
+                          body.composite_body.state.trans.position, pfix_pos);
+      pfix_position.update_from_cart (pfix_pos);
+      atmos_state->update_state ();
+      drag.aero_drag (body.composite_body.state.trans.velocity, atmos_state,
+                      body.structure.state.rot.T_parent_this,
+                      body.mass.composite_properties.mass,
+                      body.mass.composite_properties.position);
+
+      environment_time += DynBodyCost::wall_time () - start;
+   }
+};
+
+
+/**
+ * Low lunar orbiter with GRAIL150 150x150 gravity.
+ */
+class LunarScenario : public Scenario {
+public:
+   LunarScenario () : Scenario ("lunar_grail150", 1.0) {}
+
+   void add_models () override
+   {
+      double zero[3] = {0.0, 0.0, 0.0};
+      BenchVehicle & vehicle =
+         add_vehicle (new DynBody, "orbiter", 2000.0, zero, zero, 150);
+      add_circular_orbit (vehicle, planet.r_eq + 50.0e3,
+                          0.0, 89.0 * M_PI / 180.0, 0.0);
+   }
+};
+
+
+/**
+ * 500-vehicle Walker constellation with GGM05C 8x8 gravity.
+ */
+class ConstellationScenario : public Scenario {
+public:
+   ConstellationScenario () : Scenario ("constellation_500", 10.0) {}
+
+   void add_models () override
+   {
+      const unsigned int num_planes = 20;
+      const unsigned int per_plane = 25;
+      double zero[3] = {0.0, 0.0, 0.0};
+      char body_name[32];
+
+      for (unsigned int plane = 0; plane < num_planes; ++plane) {
+         for (unsigned int slot = 0; slot < per_plane; ++slot) {
+            std::snprintf (body_name, sizeof(body_name),
+                           "sat_%02u_%02u", plane, slot);
+            BenchVehicle & vehicle =
+               add_vehicle (new DynBody, body_name, 300.0, zero, zero, 8);
+
+            double jitter = 1.0e-3 * (2.0 * std::rand () / RAND_MAX - 1.0);
+            add_circular_orbit (
+               vehicle, planet.r_eq + 550.0e3,
+               2.0 * M_PI * plane / num_planes,
+               53.0 * M_PI / 180.0,
+               2.0 * M_PI * (slot + static_cast<double>(plane) / num_planes) /
+                  per_plane + jitter);
+         }
+      }
+   }
+};
+
+
+/**
+ * Two vehicles closing on each other with rings of point-contact pads on
+ * their docking faces. Every pad pair is a contact candidate.
+ */
+class DockingScenario : public Scenario {
+public:
+   static const unsigned int num_pads = 32;
+
+   ContactParams pad_params;
+   SpringPairInteraction pad_interaction;
+   ContactSurfaceFactory surface_factory;
+   Contact contact;
+
+   SurfaceModel surface_model[2];
+   ContactSurface contact_surface[2];
+   FlatPlateCircular * pads[2][num_pads];
+   BenchVehicle * vehicle[2];
+
+   DockingScenario ()
+   :
+      Scenario ("docking_contact", 0.01)
+   {
+      for (unsigned int side = 0; side < 2; ++side) {
+         vehicle[side] = nullptr;
+         for (unsigned int ii = 0; ii < num_pads; ++ii) {
+            pads[side][ii] = nullptr;
+         }
+      }
+   }
+
+   ~DockingScenario () override
+   {
+      for (unsigned int side = 0; side < 2; ++side) {
+         for (unsigned int ii = 0; ii < num_pads; ++ii) {
+            delete pads[side][ii];
+         }
+      }
+   }
+
+   void add_models () override
+   {
+      static const char * side_names[2] = {"target", "chaser"};
+      const double ring_radius = 0.8;
+      const double pad_radius = 0.05;
+      const double face_offset = 0.5;
+      const double closing_speed = 0.05;
+
+      // The target is on a circular orbit; the chaser trails it along the
+      // orbit normal, its pads 1 cm from the target's, closing at 5 cm/s.
+      double zero[3] = {0.0, 0.0, 0.0};
+      vehicle[0] = &add_vehicle (new DynBody, side_names[0], 10000.0,
+                                 zero, zero, 0);
+      add_circular_orbit (*vehicle[0], planet.r_eq + 400.0e3, 0.0, 0.0, 0.0);
+
+      vehicle[1] = &add_vehicle (new DynBody, side_names[1], 8000.0,
+                                 zero, zero, 0);
+      double separation = 2.0 * face_offset + 2.0 * pad_radius + 0.01;
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         vehicle[1]->trans_init.position[ii] =
+            vehicle[0]->trans_init.position[ii];
+         vehicle[1]->trans_init.velocity[ii] =
+            vehicle[0]->trans_init.velocity[ii];
+      }
+      vehicle[1]->trans_init.position[2] -= separation;
+      vehicle[1]->trans_init.velocity[2] += closing_speed;
+      vehicle[1]->trans_init.position[0] +=
+         2.0e-3 * (2.0 * std::rand () / RAND_MAX - 1.0);
+      vehicle[1]->trans_init.position[1] +=
+         2.0e-3 * (2.0 * std::rand () / RAND_MAX - 1.0);
+
+      pad_params.set_name ("docking_pad");
+      pad_interaction.params_1 = JEOD_STRDUP ("docking_pad");
+      pad_interaction.params_2 = JEOD_STRDUP ("docking_pad");
+      pad_interaction.spring_k = 5.0e4;
+      pad_interaction.damping_b = 2.0e3;
+      pad_interaction.mu = 0.1;
+      surface_factory.add_facet_params (&pad_params);
+
+      // Target pads face -z, chaser pads face +z.
+      for (unsigned int side = 0; side < 2; ++side) {
+         double face_sign = (side == 0) ? -1.0 : 1.0;
+         char pad_name[32];
+
+         surface_model[side].struct_body_name =
+            JEOD_STRDUP (side_names[side]);
+
+         for (unsigned int ii = 0; ii < num_pads; ++ii) {
+            FlatPlateCircular * pad = new FlatPlateCircular;
+            double angle = 2.0 * M_PI * ii / num_pads;
+
+            std::snprintf (pad_name, sizeof(pad_name),
+                           "%s_pad_%02u", side_names[side], ii);
+            pad->name = pad_name;
+            pad->param_name = JEOD_STRDUP ("docking_pad");
+            pad->mass_body_name = JEOD_STRDUP (side_names[side]);
+            pad->radius = pad_radius;
+            pad->position[0] = ring_radius * std::cos (angle);
+            pad->position[1] = ring_radius * std::sin (angle);
+            pad->position[2] = face_sign * face_offset;
+            pad->normal[0] = 0.0;
+            pad->normal[1] = 0.0;
+            pad->normal[2] = face_sign;
+
+            pads[side][ii] = pad;
+            surface_model[side].add_facet (pad);
+         }
+
+         surface_model[side].initialize_mass_connections (dyn_manager);
+         surface_factory.create_surface (&surface_model[side],
+                                         &contact_surface[side]);
+         contact.register_contact (contact_surface[side].contact_facets,
+                                   contact_surface[side].facets_size);
+
+         vehicle[side]->body->collect.collect_environ_forc.push_back (
+            CollectForce::create (contact_surface[side].contact_force));
+         vehicle[side]->body->collect.collect_environ_torq.push_back (
+            CollectTorque::create (contact_surface[side].contact_torque));
+      }
+
+      contact.register_interaction (&pad_interaction);
+   }
+
+   void start () override
+   {
+      contact.initialize_contact (&dyn_manager);
+   }
+
+   void derivatives () override
+   {
+      double start = DynBodyCost::wall_time ();
+
+      contact.check_contact ();
+      contact_surface[0].collect_forces_torques ();
+      contact_surface[1].collect_forces_torques ();
+
+      contact_time += DynBodyCost::wall_time () - start;
+   }
+};
+
+
+/**
+ * Pendulum slosh model with fixed properties.
+ */
+class BenchPendulum : public BasePendulumModel {
+public:
+   void update_pendulum_model () override {}
+   void get_hinge_point (double hinge_point[3]) const override
+   {
+      hinge_point[0] = hinge_point[1] = hinge_point[2] = 0.0;
+   }
+   double get_pendulum_mass () const override { return 50.0; }
+   double get_pendulum_length () const override { return 0.4; }
+   double compute_damping_factor (double) override { return 0.2; }
+};
+
+
+/**
+ * A pendulum slosh model and the constraint that applies it.
+ */
+struct BenchSlosh {
+   BenchPendulum model;
+   DynBodyPendulumConstraint constraint;
+
+   BenchSlosh () : model(), constraint(&model) {}
+};
+
+
+/**
+ * A StructureIntegratedDynBody whose root solves its constraints as part
+ * of force collection, which is where a Trick simulation schedules the
+ * constraint solution.
+ */
+class BenchStage : public StructureIntegratedDynBody {
+public:
+   double * constraint_time;
+
+   BenchStage () : constraint_time(nullptr) {}
+
+   void collect_forces_and_torques () override
+   {
+      StructureIntegratedDynBody::collect_forces_and_torques ();
+      if (dyn_parent == nullptr) {
+         double start = DynBodyCost::wall_time ();
+         solve_constraints ();
+         *constraint_time += DynBodyCost::wall_time () - start;
+      }
+   }
+};
+
+
+/**
+ * Thrusting stack of four bodies attached along the thrust axis, each
+ * carrying pendulum slosh constraints that are solved together at the root.
+ */
+class SloshScenario : public Scenario {
+public:
+   static const unsigned int num_stages = 4;
+
+   GaussJordanSolver linear_solver[num_stages];
+   DynBodyConstraintsSolver * constraints_solver[num_stages];
+   BodyAttachMatrix attach[num_stages];
+   std::vector<BenchSlosh *> sloshes;
+   double thrust[3];
+
+   SloshScenario ()
+   :
+      Scenario ("multibody_slosh", 0.01)
+   {
+      for (unsigned int ii = 0; ii < num_stages; ++ii) {
+         constraints_solver[ii] = nullptr;
+      }
+      thrust[0] = 2.0e4;
+      thrust[1] = 0.0;
+      thrust[2] = 0.0;
+   }
+
+   ~SloshScenario () override
+   {
+      for (BenchSlosh * slosh : sloshes) {
+         delete slosh;
+      }
+      for (unsigned int ii = 0; ii < num_stages; ++ii) {
+         delete constraints_solver[ii];
+      }
+   }
+
+   void add_models () override
+   {
+      // Pendulums hang along -x of the structure, away from the thrust:
+      // constraint-frame z is structural -x.
+      const double T_struct_constraint[3][3] = {
+         { 0.0, 1.0,  0.0},
+         { 0.0, 0.0, -1.0},
+         {-1.0, 0.0,  0.0}};
+
+      double zero[3] = {0.0, 0.0, 0.0};
+      char body_name[32];
+      BenchStage * root = nullptr;
+
+      for (unsigned int stage = 0; stage < num_stages; ++stage) {
+         BenchStage * body = new BenchStage;
+         body->constraint_time = &constraint_time;
+         std::snprintf (body_name, sizeof(body_name), "stage_%u", stage);
+
+         BenchVehicle & vehicle =
+            add_vehicle (body, body_name, (stage == 0) ? 5000.0 : 1000.0,
+                         zero, zero, 0);
+         constraints_solver[stage] =
+            new DynBodyConstraintsSolver (linear_solver[stage], *body);
+
+         // Root stage: eight tanks; other stages: four.
+         unsigned int num_tanks = (stage == 0) ? 8 : 4;
+         for (unsigned int tank = 0; tank < num_tanks; ++tank) {
+            BenchSlosh * slosh = new BenchSlosh;
+            double angle = 2.0 * M_PI * tank / num_tanks;
+            double hinge[3] = {0.5, 0.6 * std::cos (angle),
+                               0.6 * std::sin (angle)};
+            slosh->constraint.set_struct_to_constraint_frame (
+               T_struct_constraint, hinge);
+            body->add_constraint (&slosh->constraint);
+            sloshes.push_back (slosh);
+         }
+
+         if (stage == 0) {
+            root = body;
+            add_circular_orbit (vehicle, planet.r_eq + 400.0e3,
+                                0.0, 0.0, 0.0);
+            body->collect.collect_effector_forc.push_back (
+               CollectForce::create (thrust));
+         }
+         else {
+            // Stages are stacked 2 m apart behind the root stage and
+            // attached when the simulation is initialized.
+            attach[stage].action_name = std::string (body_name) + ".attach";
+            attach[stage].set_subject_body (*body);
+            attach[stage].dyn_parent = root;
+            attach[stage].offset_pstr_cstr_pstr[0] = -2.0 * stage;
+            attach[stage].offset_pstr_cstr_pstr[1] = 0.0;
+            attach[stage].offset_pstr_cstr_pstr[2] = 0.0;
+            attach[stage].pstr_cstr.data_source = Orientation::InputMatrix;
+            for (unsigned int ii = 0; ii < 3; ++ii) {
+               for (unsigned int jj = 0; jj < 3; ++jj) {
+                  attach[stage].pstr_cstr.trans[ii][jj] =
+                     (ii == jj) ? 1.0 : 0.0;
+               }
+            }
+            dyn_manager.add_body_action (&attach[stage]);
+         }
+      }
+   }
+
+   void start () override
+   {
+      // Start each pendulum hanging at rest.
+      for (BenchSlosh * slosh : sloshes) {
+         slosh->constraint.deactivate ();
+         slosh->constraint.activate ();
+      }
+   }
+};
+
+}
+
+
+int
+main (
+   int argc,
+   char * argv[])
+{
+   TestSimInterface test_sim_interface;
+   CmdlineParser cmdline_parser;
+   double min_time = 2.0;
+   bool verbose = false;
+
+   cmdline_parser.add_double ("MinTime", 0, &min_time);
+   cmdline_parser.add_switch ("Verbose", &verbose);
+   cmdline_parser.parse (argc, argv);
+
+   std::printf ("{\n  \"benchmark\": \"scenarios\",\n"
+                "  \"seed\": %d,\n  \"min_time\": %g,\n"
+                "  \"profiling\": %s,\n  \"results\": [",
+                BENCH_SEED, min_time, JEOD_PROFILING ? "true" : "false");
+
+   // Each scenario is a complete simulation, set up and torn down in turn.
+   {
+      LeoDragScenario scenario;
+      scenario.setup<Planet_earth_default_data,
+                     SphericalHarmonicsGravitySource_earth_GGM05C_default_data>
+         (7.292115e-5);
+      scenario.run (min_time, true, verbose);
+   }
+   {
+      LunarScenario scenario;
+      scenario.setup<Planet_moon_default_data,
+                     SphericalHarmonicsGravitySource_moon_GRAIL150_default_data>
+         (2.6617e-6);
+      scenario.run (min_time, false, verbose);
+   }
+   {
+      ConstellationScenario scenario;
+      scenario.setup<Planet_earth_default_data,
+                     SphericalHarmonicsGravitySource_earth_GGM05C_default_data>
+         (7.292115e-5);
+      scenario.run (min_time, false, verbose);
+   }
+   {
+      DockingScenario scenario;
+      scenario.setup<Planet_earth_default_data,
+                     SphericalHarmonicsGravitySource_earth_GGM05C_default_data>
+         (7.292115e-5);
+      scenario.run (min_time, false, verbose);
+   }
+   {
+      SloshScenario scenario;
+      scenario.setup<Planet_earth_default_data,
+                     SphericalHarmonicsGravitySource_earth_GGM05C_default_data>
+         (7.292115e-5);
+      scenario.run (min_time, false, verbose);
+   }
+
+   std::printf ("\n  ]\n}\n");
+
+   return 0;
+}
@@ -0,0 +1,871 @@
+/*
+ * Fast-path accuracy and speed validation.
+ *
+ * Runs each approximate fast path side by side with the exact computation it
+ * replaces and reports how far the results diverge over time and the speedup
+ * obtained. The cases are:
+ *
+ *   gravity_grid          LEO vehicle, GGM05C 20x20 gravity: series versus
+ *                         SphericalHarmonicsGravityGrid interpolation.
+ *   adaptive_degree       Eccentric orbit (500 x 20000 km), GGM05C 70x70
+ *                         gravity: fixed versus altitude-adaptive degree.
+ *   met_density_table     LEO vehicle at 350 km with MET atmosphere drag:
+ *                         full Jacchia profile versus the density table.
+ *   nutation_interpolated IAU 1980 nutation over one day: the series at
+ *                         every update versus cubic interpolation between
+ *                         series nodes five minutes apart.
+ *   orb_elem_interpolated Orbital elements derived state: computed every
+ *                         step versus every tenth step with interpolated
+ *                         outputs.
+ *
+ * The trajectory cases integrate two complete simulations, identical but for
+ * the fast path, in lockstep with an RK4 integrator; divergence is that of
+ * the vehicle's inertial position and velocity and speedup is the ratio of
+ * the simulations' wall times. The nutation case compares the nutation
+ * matrices; its divergence is that of a LEO state (radius 6778 km, speed
+ * 7.67 km/s) rotated by each. The orbital elements case compares the
+ * Cartesian states rebuilt from each set of elements; since interpolated
+ * outputs lag by one update interval, the fast elements are compared with
+ * the exact elements from that many steps earlier.
+ *
+ * Planet orientation is a uniform rotation about the pole, so no Earth
+ * orientation or ephemeris files are needed.
+ *
+ * A case passes when its fast path was actually used and its largest
+ * position and velocity divergences are within the case's thresholds,
+ * scaled by -ThresholdScale. With -MinSpeedup, a case must also be at
+ * least that much faster. Results are written to stdout as JSON; the exit
+ * status is the number of failed cases, so release qualification can gate
+ * on it.
+ *
+ * Options:
+ *   -Duration <s>         Override the simulated duration of every case
+ *   -ThresholdScale <x>   Multiply every divergence threshold (default 1)
+ *   -MinSpeedup <x>       Required speedup per case (default 0: not gated)
+ *   -Verbose              Also write a human-readable table to stderr
+ */
+
+// Local definitions
+#define HISTORY_POINTS 12
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/body_action/include/dyn_body_init_rot_state.hh"
+#include "dynamics/body_action/include/dyn_body_init_trans_state.hh"
+#include "dynamics/body_action/include/mass_body_init.hh"
+#include "dynamics/derived_state/include/orb_elem_derived_state.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_body/include/dyn_body_cost.hh"
+#include "dynamics/dyn_body/include/force.hh"
+#include "dynamics/dyn_body/include/torque.hh"
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "dynamics/dyn_manager/include/dyn_manager_init.hh"
+#include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
+#include "environment/atmosphere/MET/include/MET_atmosphere.hh"
+#include "environment/atmosphere/MET/include/MET_atmosphere_state.hh"
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/gravity/data/include/earth_GGM05C.hh"
+#include "environment/planet/include/planet.hh"
+#include "environment/planet/data/include/earth.hh"
+#include "environment/RNP/RNPJ2000/include/nutation_j2000.hh"
+#include "environment/RNP/RNPJ2000/include/nutation_j2000_init.hh"
+#include "environment/RNP/RNPJ2000/data/include/nutation_j2000.hh"
+#include "environment/time/include/time_manager.hh"
+#include "environment/time/include/time_manager_init.hh"
+#include "interactions/aerodynamics/include/aero_drag.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/orbital_elements/include/orbital_elements.hh"
+#include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
+#include "utils/ref_frames/include/ref_frame_interface.hh"
+#include "utils/sim_interface/include/standalone_dynbody_integ_loop.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "test_harness/include/cmdline_parser.hh"
+
+#include "er7_utils/integration/core/include/integrator_constructor_factory.hh"
+
+using namespace jeod;
+
+namespace {
+
+const double earth_rate = 7.292115e-5;
+
+
+/**
+ * Uniform rotation of a planet about its pole, standing in for an RNP model.
+ */
+class UniformRotation : public RefFrameOwner {
+public:
+   Planet * planet;
+   double rate;
+
+   UniformRotation () : planet(nullptr), rate(0.0) {}
+
+   void update (double sim_time)
+   {
+      RefFrameRot & rot = planet->pfix.state.rot;
+      double angle = rate * sim_time;
+      double cos_a = std::cos (angle);
+      double sin_a = std::sin (angle);
+
+      rot.T_parent_this[0][0] =  cos_a;
+      rot.T_parent_this[0][1] =  sin_a;
+      rot.T_parent_this[0][2] =  0.0;
+      rot.T_parent_this[1][0] = -sin_a;
+      rot.T_parent_this[1][1] =  cos_a;
+      rot.T_parent_this[1][2] =  0.0;
+      rot.T_parent_this[2][0] =  0.0;
+      rot.T_parent_this[2][1] =  0.0;
+      rot.T_parent_this[2][2] =  1.0;
+      rot.ang_vel_this[0] = 0.0;
+      rot.ang_vel_this[1] = 0.0;
+      rot.ang_vel_this[2] = rate;
+      rot.compute_quaternion ();
+      rot.compute_ang_vel_unit ();
+      planet->pfix.set_timestamp (sim_time);
+   }
+};
+
+
+/**
+ * Options and thresholds common to all cases.
+ */
+struct Options {
+   double duration;
+   double threshold_scale;
+   double min_speedup;
+   bool verbose;
+};
+
+
+/**
+ * Divergence of a fast path from its exact counterpart and the speedup.
+ */
+class CaseResult {
+public:
+   const char * name;
+   double duration;
+   double pos_tol;
+   double vel_tol;
+   bool engaged;
+
+   double max_pos;
+   double max_vel;
+   double max_pos_time;
+   double exact_time;
+   double fast_time;
+
+   std::vector<double> history_time;
+   std::vector<double> history_pos;
+   std::vector<double> history_vel;
+
+   CaseResult (const char * name_in, double duration_in,
+               double pos_tol_in, double vel_tol_in)
+   :
+      name(name_in),
+      duration(duration_in),
+      pos_tol(pos_tol_in),
+      vel_tol(vel_tol_in),
+      engaged(true),
+      max_pos(0.0),
+      max_vel(0.0),
+      max_pos_time(0.0),
+      exact_time(0.0),
+      fast_time(0.0)
+   { }
+
+   /**
+    * Record the divergence between two states at the given time.
+    */
+   void sample (double time,
+                const double exact_pos[3], const double exact_vel[3],
+                const double fast_pos[3], const double fast_vel[3])
+   {
+      double diff[3];
+      double dpos = Vector3::vmag (Vector3::diff (fast_pos, exact_pos, diff));
+      double dvel = Vector3::vmag (Vector3::diff (fast_vel, exact_vel, diff));
+
+      if (dpos > max_pos) {
+         max_pos = dpos;
+         max_pos_time = time;
+      }
+      max_vel = std::max (max_vel, dvel);
+
+      // Keep HISTORY_POINTS evenly spaced samples for the report.
+      double spacing = duration / HISTORY_POINTS;
+      if (time >= spacing * (history_time.size() + 1) - 1.0e-9) {
+         history_time.push_back (time);
+         history_pos.push_back (dpos);
+         history_vel.push_back (dvel);
+      }
+   }
+
+   double speedup () const
+   {
+      return (fast_time > 0.0) ? exact_time / fast_time : 0.0;
+   }
+
+   bool passed (const Options & options) const
+   {
+      return engaged &&
+             (max_pos <= pos_tol * options.threshold_scale) &&
+             (max_vel <= vel_tol * options.threshold_scale) &&
+             (speedup () >= options.min_speedup);
+   }
+
+   void report (const Options & options, bool first) const
+   {
+      std::printf ("%s\n    {\"case\": \"%s\", \"duration\": %g, "
+                   "\"engaged\": %s, \"passed\": %s,\n"
+                   "     \"max_position_divergence\": %.6e, "
+                   "\"max_position_time\": %g, "
+                   "\"max_velocity_divergence\": %.6e,\n"
+                   "     \"position_threshold\": %.6e, "
+                   "\"velocity_threshold\": %.6e,\n"
+                   "     \"exact_wall_time\": %.6f, \"fast_wall_time\": %.6f, "
+                   "\"speedup\": %.3f,\n"
+                   "     \"history\": [",
+                   first ? "" : ",", name, duration,
+                   engaged ? "true" : "false",
+                   passed (options) ? "true" : "false",
+                   max_pos, max_pos_time, max_vel,
+                   pos_tol * options.threshold_scale,
+                   vel_tol * options.threshold_scale,
+                   exact_time, fast_time, speedup ());
+      for (std::size_t ii = 0; ii < history_time.size(); ++ii) {
+         std::printf ("%s[%g, %.6e, %.6e]", (ii == 0) ? "" : ", ",
+                      history_time[ii], history_pos[ii], history_vel[ii]);
+      }
+      std::printf ("]}");
+
+      if (options.verbose) {
+         std::fprintf (stderr,
+                       "%-22s %-4s  dpos %10.3e m (tol %9.2e)  "
+                       "dvel %10.3e m/s (tol %9.2e)  speedup %6.2f%s\n",
+                       name, passed (options) ? "PASS" : "FAIL",
+                       max_pos, pos_tol * options.threshold_scale,
+                       max_vel, vel_tol * options.threshold_scale,
+                       speedup (), engaged ? "" : "  (fast path not used)");
+      }
+   }
+};
+
+
+/**
+ * A simulation with one vehicle about the Earth, integrated by a standalone
+ * integration loop. The exact and fast simulations of a trajectory case are
+ * two instances of the same class that differ only in the fast flag.
+ */
+class Scenario {
+public:
+   bool fast;
+   double cycle;
+
+   TimeManager time_manager;
+   TimeManagerInit time_init;
+   DynManager dyn_manager;
+   DynManagerInit dyn_init;
+   GravityManager grav_manager;
+   Planet planet;
+   SphericalHarmonicsGravitySource grav_source;
+   UniformRotation rotation;
+
+   er7_utils::IntegratorConstructor * integ_cotr;
+   DynamicsIntegrationGroup integ_group_factory;
+   JeodStandaloneIntegrationLoop * loop;
+
+   DynBody body;
+   MassBodyInit mass_init;
+   DynBodyInitTransState trans_init;
+   DynBodyInitRotState rot_init;
+   SphericalHarmonicsGravityControls grav_controls;
+
+   double wall_time;
+
+   Scenario (bool fast_in, double cycle_in)
+   :
+      fast(fast_in),
+      cycle(cycle_in),
+      integ_cotr(nullptr),
+      loop(nullptr),
+      wall_time(0.0)
+   { }
+
+   virtual ~Scenario ()
+   {
+      delete loop;
+      delete integ_cotr;
+   }
+
+   void setup ();
+
+   void set_orbit (double perigee_radius, double apogee_radius,
+                   double raan, double incl, double arg_perigee);
+
+   /**
+    * Integrate one cycle and accumulate the wall time it took.
+    */
+   void step ()
+   {
+      double start = DynBodyCost::wall_time ();
+      rotation.update (loop->get_sim_time ());
+      loop->integrate_cycle ();
+      after_step ();
+      wall_time += DynBodyCost::wall_time () - start;
+   }
+
+   const double * position () const
+   {
+      return body.composite_body.state.trans.position;
+   }
+
+   const double * velocity () const
+   {
+      return body.composite_body.state.trans.velocity;
+   }
+
+   // Configure the vehicle, its gravity control and any other models.
+   virtual void add_models () = 0;
+
+   // Whether the fast path was used; checked after the run.
+   virtual bool fast_path_engaged () const { return true; }
+
+   // Models evaluated on each derivative pass, after gravitation and before
+   // forces are collected.
+   virtual void derivatives () {}
+
+   // Models evaluated once per cycle, after integration.
+   virtual void after_step () {}
+
+   static void derivative_hook (void * scenario)
+   {
+      static_cast<Scenario *>(scenario)->derivatives ();
+   }
+};
+
+
+/**
+ * Set up time, the dynamics manager, the Earth and its GGM05C field, the
+ * integration loop and the vehicle, and initialize the simulation.
+ */
+void
+Scenario::setup ()
+{
+   Planet_earth_default_data planet_init;
+   SphericalHarmonicsGravitySource_earth_GGM05C_default_data gravity_init;
+
+   time_manager.initialize (&time_init);
+
+   planet_init.initialize (&planet);
+   gravity_init.initialize (&grav_source);
+
+   dyn_init.mode = DynManagerInit::EphemerisMode_SinglePlanet;
+   dyn_init.central_point_name = JEOD_STRDUP (planet.name.c_str());
+   dyn_init.jeod_integ_opt = er7_utils::Integration::RungeKutta4;
+   dyn_manager.initialize_model (dyn_init, time_manager);
+
+   grav_source.initialize_body ();
+   planet.register_model (grav_source, dyn_manager);
+   planet.initialize ();
+   grav_manager.add_grav_source (grav_source);
+   grav_manager.initialize_model (dyn_manager);
+
+   rotation.planet = &planet;
+   rotation.rate = earth_rate;
+   planet.pfix.set_owner (&rotation);
+   rotation.update (0.0);
+
+   integ_cotr = er7_utils::IntegratorConstructorFactory::create (
+                   er7_utils::Integration::RungeKutta4);
+   loop = new JeodStandaloneIntegrationLoop (
+                 cycle, time_manager, dyn_manager, grav_manager,
+                 integ_cotr, integ_group_factory);
+   loop->set_derivative_function (derivative_hook, this);
+
+   body.set_name ("vehicle");
+   body.integ_frame_name = JEOD_STRDUP (planet.inertial.get_name());
+   body.translational_dynamics = true;
+   body.rotational_dynamics = true;
+
+   mass_init.action_name = "vehicle.mass";
+   mass_init.set_subject_body (body);
+   mass_init.properties.mass = 1000.0;
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         mass_init.properties.inertia[ii][jj] = (ii == jj) ? 1000.0 : 0.0;
+      }
+   }
+
+   trans_init.action_name = "vehicle.trans";
+   trans_init.set_subject_body (body);
+   trans_init.reference_ref_frame_name = planet.inertial.get_name();
+   trans_init.body_frame_id = "composite_body";
+
+   rot_init.action_name = "vehicle.rot";
+   rot_init.set_subject_body (body);
+   rot_init.reference_ref_frame_name = planet.inertial.get_name();
+   rot_init.body_frame_id = "composite_body";
+   rot_init.orientation.data_source = Orientation::InputMatrix;
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         rot_init.orientation.trans[ii][jj] = (ii == jj) ? 1.0 : 0.0;
+      }
+      rot_init.ang_velocity[ii] = 0.0;
+   }
+
+   grav_controls.source_name = grav_source.name;
+   grav_controls.active = true;
+   grav_controls.spherical = false;
+
+   add_models ();
+
+   body.initialize_model (dyn_manager);
+   body.add_control (&grav_controls);
+   dyn_manager.add_body_action (&mass_init);
+   dyn_manager.add_body_action (&trans_init);
+   dyn_manager.add_body_action (&rot_init);
+   loop->add_dyn_body (body);
+
+   loop->initialize_integ_loop ();
+   dyn_manager.initialize_simulation ();
+}
+
+
+/**
+ * Start the vehicle at perigee of the given orbit.
+ */
+void
+Scenario::set_orbit (
+   double perigee_radius,
+   double apogee_radius,
+   double raan,
+   double incl,
+   double arg_perigee)
+{
+   double sma = 0.5 * (perigee_radius + apogee_radius);
+   double speed =
+      std::sqrt (grav_source.mu * (2.0 / perigee_radius - 1.0 / sma));
+   double cos_o = std::cos (raan);
+   double sin_o = std::sin (raan);
+   double cos_i = std::cos (incl);
+   double sin_i = std::sin (incl);
+   double cos_u = std::cos (arg_perigee);
+   double sin_u = std::sin (arg_perigee);
+
+   double * pos = trans_init.position;
+   double * vel = trans_init.velocity;
+
+   pos[0] = perigee_radius * (cos_o * cos_u - sin_o * sin_u * cos_i);
+   pos[1] = perigee_radius * (sin_o * cos_u + cos_o * sin_u * cos_i);
+   pos[2] = perigee_radius * (sin_u * sin_i);
+   vel[0] = speed * (-cos_o * sin_u - sin_o * cos_u * cos_i);
+   vel[1] = speed * (-sin_o * sin_u + cos_o * cos_u * cos_i);
+   vel[2] = speed * (cos_u * sin_i);
+}
+
+
+/**
+ * Spherical harmonics series versus the interpolation grid.
+ */
+class GravityGridScenario : public Scenario {
+public:
+   explicit GravityGridScenario (bool fast_in) : Scenario (fast_in, 1.0) {}
+
+   void add_models () override
+   {
+      grav_controls.degree = 20;
+      grav_controls.order = 20;
+      set_orbit (planet.r_eq + 400.0e3, planet.r_eq + 400.0e3,
+                 0.3, 51.6 * M_PI / 180.0, 0.0);
+
+      if (fast) {
+         SphericalHarmonicsGravityGrid & grid = grav_controls.grid;
+         grav_controls.use_grid = true;
+         grid.num_radial = 8;
+         grid.num_colatitude = 361;
+         grid.num_longitude = 720;
+         grid.radius_min = planet.r_eq + 300.0e3;
+         grid.radius_max = planet.r_eq + 500.0e3;
+         grid.error_budget = 1.0e-7;
+      }
+   }
+
+   bool fast_path_engaged () const override
+   {
+      return (! fast) || grav_controls.grid.valid;
+   }
+};
+
+
+/**
+ * Fixed degree versus altitude-adaptive degree.
+ */
+class AdaptiveDegreeScenario : public Scenario {
+public:
+   unsigned int min_degree;
+
+   explicit AdaptiveDegreeScenario (bool fast_in)
+   :
+      Scenario (fast_in, 5.0),
+      min_degree(70)
+   { }
+
+   void add_models () override
+   {
+      grav_controls.degree = 70;
+      grav_controls.order = 70;
+      grav_controls.adaptive_degree = fast;
+      set_orbit (planet.r_eq + 500.0e3, planet.r_eq + 20000.0e3,
+                 0.3, 63.4 * M_PI / 180.0, 0.5);
+   }
+
+   void after_step () override
+   {
+      if (fast) {
+         min_degree = std::min (min_degree, grav_controls.effective_degree);
+      }
+   }
+
+   bool fast_path_engaged () const override
+   {
+      return (! fast) || (min_degree < 70);
+   }
+};
+
+
+/**
+ * Full MET Jacchia profile versus the tabulated profile.
+ */
+class DensityTableScenario : public Scenario {
+public:
+   METAtmosphere atmosphere;
+   PlanetFixedPosition pfix_position;
+   METAtmosphereState * atmos_state;
+   AerodynamicDrag drag;
+
+   explicit DensityTableScenario (bool fast_in)
+   :
+      Scenario (fast_in, 1.0),
+      atmos_state(nullptr)
+   { }
+
+   ~DensityTableScenario () override { delete atmos_state; }
+
+   void add_models () override
+   {
+      grav_controls.degree = 8;
+      grav_controls.order = 8;
+      set_orbit (planet.r_eq + 350.0e3, planet.r_eq + 350.0e3,
+                 0.3, 51.6 * M_PI / 180.0, 0.0);
+
+      atmosphere.use_density_table = fast;
+      pfix_position.initialize (&planet);
+      atmos_state = new METAtmosphereState (atmosphere, pfix_position);
+
+      drag.active = true;
+      drag.ballistic_drag.option = DefaultAero::DRAG_OPT_CD;
+      drag.ballistic_drag.Cd = 2.2;
+      drag.ballistic_drag.area = 10.0;
+
+      body.collect.collect_environ_forc.push_back (
+         CollectForce::create (drag.aero_force));
+      body.collect.collect_environ_torq.push_back (
+         CollectTorque::create (drag.aero_torque));
+   }
+
+   void derivatives () override
+   {
+      double pfix_pos[3];
+
+      Vector3::transform (planet.pfix.state.rot.T_parent_this,
+                          body.composite_body.state.trans.position, pfix_pos);
+      pfix_position.update_from_cart (pfix_pos);
+      atmos_state->update_state ();
+      drag.aero_drag (body.composite_body.state.trans.velocity, atmos_state,
+                      body.structure.state.rot.T_parent_this,
+                      body.mass.composite_properties.mass,
+                      body.mass.composite_properties.position);
+   }
+};
+
+
+/**
+ * Integrate the exact and fast versions of a trajectory case in lockstep
+ * and compare the vehicle states after every cycle.
+ */
+template <typename ScenarioType>
+CaseResult
+run_trajectory_case (
+   const char * name,
+   double duration,
+   double pos_tol,
+   double vel_tol)
+{
+   CaseResult result (name, duration, pos_tol, vel_tol);
+   ScenarioType exact (false);
+   ScenarioType fast (true);
+
+   exact.setup ();
+   fast.setup ();
+
+   double start_time = exact.loop->get_sim_time ();
+   double time = 0.0;
+   while (time < duration - 0.5 * exact.cycle) {
+      exact.step ();
+      fast.step ();
+      time = exact.loop->get_sim_time () - start_time;
+      result.sample (time, exact.position(), exact.velocity(),
+                     fast.position(), fast.velocity());
+   }
+
+   result.engaged = fast.fast_path_engaged ();
+   result.exact_time = exact.wall_time;
+   result.fast_time = fast.wall_time;
+
+   return result;
+}
+
+
+/**
+ * Nutation evaluated at every update versus interpolated between nodes.
+ */
+CaseResult
+run_nutation_case (
+   double duration,
+   double pos_tol,
+   double vel_tol)
+{
+   const double step = 1.0;
+   const double interval = 300.0;
+   const double radius = 6778.0e3;
+   const double speed = 7.67e3;
+   // 2020-01-01 TT, in Julian centuries since J2000.
+   const double epoch = 7305.0 / 36525.0;
+
+   CaseResult result ("nutation_interpolated", duration, pos_tol, vel_tol);
+   NutationJ2000Init nutation_init;
+   NutationJ2000Init_nutation_j2000_default_data nutation_data;
+   NutationJ2000 exact;
+   NutationJ2000 fast;
+
+   nutation_data.initialize (&nutation_init);
+   exact.initialize (&nutation_init);
+   fast.interpolation_interval = interval;
+   fast.initialize (&nutation_init);
+
+   for (double time = step; time <= duration + 0.5 * step; time += step) {
+      double century = epoch + time / (86400.0 * 36525.0);
+      double start;
+
+      start = DynBodyCost::wall_time ();
+      exact.update_time (century);
+      exact.update_rotation ();
+      result.exact_time += DynBodyCost::wall_time () - start;
+
+      start = DynBodyCost::wall_time ();
+      fast.update_time (century);
+      fast.update_rotation ();
+      result.fast_time += DynBodyCost::wall_time () - start;
+
+      // Rotate a radial position and an along-track velocity by each matrix.
+      double exact_pos[3], exact_vel[3], fast_pos[3], fast_vel[3];
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         exact_pos[ii] = radius * exact.rotation[0][ii];
+         exact_vel[ii] = speed * exact.rotation[1][ii];
+         fast_pos[ii] = radius * fast.rotation[0][ii];
+         fast_vel[ii] = speed * fast.rotation[1][ii];
+      }
+      result.sample (time, exact_pos, exact_vel, fast_pos, fast_vel);
+   }
+
+   return result;
+}
+
+
+/**
+ * Rebuild the Cartesian state from a derived state's elements. The sine and
+ * cosine of the true anomaly are recomputed from the anomaly, since
+ * interpolated values of the two need not be consistent.
+ */
+void
+elements_to_cartesian (
+   const OrbitalElements & source,
+   double mu,
+   double pos[3],
+   double vel[3])
+{
+   OrbitalElements elements;
+   elements.semiparam = source.semiparam;
+   elements.e_mag = source.e_mag;
+   elements.inclination = source.inclination;
+   elements.arg_periapsis = source.arg_periapsis;
+   elements.long_asc_node = source.long_asc_node;
+   elements.true_anom = source.true_anom;
+   elements.sin_v = std::sin (source.true_anom);
+   elements.cos_v = std::cos (source.true_anom);
+   elements.to_cartesian (mu, pos, vel);
+}
+
+
+/**
+ * Orbital elements computed every step versus interpolated.
+ */
+class OrbElemScenario : public Scenario {
+public:
+   static const unsigned int interval = 10;
+
+   OrbElemDerivedState exact_elements;
+   OrbElemDerivedState fast_elements;
+   double exact_time;
+   double fast_time;
+
+   OrbElemScenario ()
+   :
+      Scenario (false, 1.0),
+      exact_time(0.0),
+      fast_time(0.0)
+   { }
+
+   void add_models () override
+   {
+      grav_controls.degree = 8;
+      grav_controls.order = 8;
+      set_orbit (planet.r_eq + 400.0e3, planet.r_eq + 1200.0e3,
+                 0.3, 51.6 * M_PI / 180.0, 0.0);
+
+      exact_elements.set_reference_name (planet.name.c_str());
+      fast_elements.set_reference_name (planet.name.c_str());
+      fast_elements.update_interval = interval;
+      fast_elements.interpolate_outputs = true;
+   }
+
+   void initialize_elements ()
+   {
+      exact_elements.initialize (body, dyn_manager);
+      fast_elements.initialize (body, dyn_manager);
+   }
+
+   void after_step () override
+   {
+      double start = DynBodyCost::wall_time ();
+      exact_elements.update ();
+      double middle = DynBodyCost::wall_time ();
+      fast_elements.update ();
+      fast_time += DynBodyCost::wall_time () - middle;
+      exact_time += middle - start;
+   }
+};
+
+
+CaseResult
+run_orb_elem_case (
+   double duration,
+   double pos_tol,
+   double vel_tol)
+{
+   CaseResult result ("orb_elem_interpolated", duration, pos_tol, vel_tol);
+   OrbElemScenario scenario;
+   scenario.setup ();
+   scenario.initialize_elements ();
+
+   const unsigned int lag = OrbElemScenario::interval;
+   double mu = scenario.grav_source.mu;
+   std::deque<std::vector<double> > exact_history;
+
+   double start_time = scenario.loop->get_sim_time ();
+   double time = 0.0;
+   while (time < duration - 0.5 * scenario.cycle) {
+      scenario.step ();
+      time = scenario.loop->get_sim_time () - start_time;
+
+      std::vector<double> exact_state (6);
+      elements_to_cartesian (scenario.exact_elements.elements, mu,
+                             &exact_state[0], &exact_state[3]);
+      exact_history.push_back (exact_state);
+      if (exact_history.size() <= 2 * lag) {
+         continue;
+      }
+      exact_history.pop_front ();
+
+      // The interpolated elements describe the state lag steps ago.
+      double fast_pos[3], fast_vel[3];
+      elements_to_cartesian (scenario.fast_elements.elements, mu,
+                             fast_pos, fast_vel);
+      const std::vector<double> & lagged =
+         exact_history[exact_history.size() - 1 - lag];
+      result.sample (time, &lagged[0], &lagged[3], fast_pos, fast_vel);
+   }
+
+   result.exact_time = scenario.exact_time;
+   result.fast_time = scenario.fast_time;
+
+   return result;
+}
+
+}
+
+
+int
+main (
+   int argc,
+   char * argv[])
+{
+   TestSimInterface test_sim_interface;
+   CmdlineParser cmdline_parser;
+   Options options;
+   options.duration = 0.0;
+   options.threshold_scale = 1.0;
+   options.min_speedup = 0.0;
+   options.verbose = false;
+
+   cmdline_parser.add_double ("Duration", 0, &options.duration);
+   cmdline_parser.add_double ("ThresholdScale", 0, &options.threshold_scale);
+   cmdline_parser.add_double ("MinSpeedup", 0, &options.min_speedup);
+   cmdline_parser.add_switch ("Verbose", &options.verbose);
+   cmdline_parser.parse (argc, argv);
+
+   // Case duration: the default unless overridden.
+   auto duration = [&options] (double default_duration) {
+      return (options.duration > 0.0) ? options.duration : default_duration;
+   };
+
+   std::printf ("{\n  \"validation\": \"fast_paths\",\n"
+                "  \"threshold_scale\": %g,\n  \"min_speedup\": %g,\n"
+                "  \"results\": [",
+                options.threshold_scale, options.min_speedup);
+
+   // Thresholds bound the divergence over the default durations: one and
+   // a half LEO orbits, one eccentric orbit, one day of nutation.
+   std::vector<CaseResult> results;
+   results.push_back (run_trajectory_case<GravityGridScenario> (
+      "gravity_grid", duration (8400.0), 1.0, 1.0e-3));
+   results.push_back (run_trajectory_case<AdaptiveDegreeScenario> (
+      "adaptive_degree", duration (21600.0), 1.0, 1.0e-3));
+   results.push_back (run_trajectory_case<DensityTableScenario> (
+      "met_density_table", duration (8400.0), 1.0, 1.0e-3));
+   results.push_back (run_nutation_case (
+      duration (86400.0), 0.01, 1.0e-5));
+   results.push_back (run_orb_elem_case (
+      duration (8400.0), 1.0, 1.0e-3));
+
+   int num_failed = 0;
+   for (std::size_t ii = 0; ii < results.size(); ++ii) {
+      results[ii].report (options, ii == 0);
+      if (! results[ii].passed (options)) {
+         ++num_failed;
+      }
+   }
+
+   std::printf ("\n  ],\n  \"failed\": %d\n}\n", num_failed);
+
+   return num_failed;
+}
@@ -0,0 +1,377 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup GroundAccess
+ * @{
+ *
+ * @file models/dynamics/ground_access/include/ground_access.hh
+ * Define the classes AccessWindow and GroundAccess, which track when
+ * vehicles are visible from ground sites.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Sites are fixed on the planet's reference ellipsoid, specified by
+    geodetic latitude, longitude, and altitude.)
+   (A vehicle is visible from a site when its elevation above the site's
+    local horizontal plane is at least the site's minimum elevation.)
+   (Motion between samples is the cubic Hermite interpolant of the sampled
+    planet-fixed positions and velocities.)
+   (The sample interval must be short compared to the pass durations; at
+    most one rise or set per vehicle/site pair is found per interval.))
+
+Library dependencies:
+  ((../src/ground_access.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_GROUND_ACCESS_HH
+#define JEOD_GROUND_ACCESS_HH
+
+// System includes
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+class DynManager;
+class Planet;
+class RefFrame;
+
+
+/**
+ * An interval during which a vehicle is visible from a ground site.
+ */
+class AccessWindow {
+
+   JEOD_MAKE_SIM_INTERFACES(AccessWindow)
+
+public:
+
+   /**
+    * The visible vehicle.
+    */
+   DynBody * vehicle; //!< trick_units(--)
+
+   /**
+    * Index of the ground site, in the order the sites were added.
+    */
+   unsigned int site; //!< trick_units(count)
+
+   /**
+    * Time at which the vehicle rose above the site's mask, in the time
+    * scale passed to update(). For a vehicle visible at the first sample,
+    * the time of that sample.
+    */
+   double rise_time; //!< trick_units(s)
+
+   /**
+    * Time at which the vehicle set below the site's mask; valid once the
+    * window is closed.
+    */
+   double set_time; //!< trick_units(s)
+
+   /**
+    * True while the vehicle remains visible.
+    */
+   bool open; //!< trick_units(--)
+
+   AccessWindow ()
+   :
+      vehicle(nullptr),
+      site(0),
+      rise_time(0.0),
+      set_time(0.0),
+      open(false)
+   { }
+};
+
+
+/**
+ * Tracks the visibility of vehicles from ground sites.
+ * The sites are stored in planet-fixed coordinates as structure of arrays,
+ * with their positions, local vertical unit vectors, and the sines of their
+ * elevation masks. At each update each vehicle is transformed into the
+ * planet-fixed frame once; the elevation margins of that vehicle with
+ * respect to all sites are then evaluated in a single call-free loop.
+ * A margin that changes sign over the last sample interval marks a rise or
+ * set, whose time is located on the cubic Hermite interpolant of the
+ * vehicle's planet-fixed state. The first-order time to the next crossing
+ * is also available, for use in scheduling events or sizing steps.
+ */
+class GroundAccess {
+
+   JEOD_MAKE_SIM_INTERFACES(GroundAccess)
+
+public:
+
+   // Member data
+
+   /**
+    * Name of the planet on which the sites are located.
+    */
+   std::string planet_name; //!< trick_units(--)
+
+   /**
+    * Send an informational message for each rise and set.
+    */
+   bool report_events; //!< trick_units(--)
+
+
+   // Member functions
+
+   GroundAccess ();
+
+   ~GroundAccess ();
+
+   // Add a ground site.
+   void add_site (
+      const std::string & name,
+      double latitude, double longitude, double altitude,
+      double min_elevation);
+
+   // Add a vehicle to be tracked.
+   void add_vehicle (DynBody & vehicle);
+
+   // Find the planet and compute the planet-fixed site data.
+   void initialize (DynManager & manager);
+
+   // Sample the vehicles and find the rises and sets since the previous
+   // sample.
+   void update (double time);
+
+   // Discard the closed access windows.
+   void clear_closed_windows ();
+
+   /**
+    * Get the number of sites.
+    * @return Site count
+    */
+   unsigned int get_num_sites () const
+   {
+      return static_cast<unsigned int> (site_names.size());
+   }
+
+   /**
+    * Get the name of a site.
+    * @return Site name
+    * \param[in] index Site index, less than get_num_sites()
+    */
+   const std::string & get_site_name (unsigned int index) const
+   {
+      return site_names[index];
+   }
+
+   /**
+    * Get the number of recorded access windows.
+    * @return Window count
+    */
+   unsigned int get_num_windows () const
+   {
+      return static_cast<unsigned int> (windows.size());
+   }
+
+   /**
+    * Get a recorded access window.
+    * @return Window
+    * \param[in] index Window index, less than get_num_windows()
+    */
+   const AccessWindow & get_window (unsigned int index) const
+   {
+      return windows[index];
+   }
+
+   /**
+    * Get the predicted time of the next rise or set, extrapolating each
+    * elevation margin to first order from the last sample.
+    * @return Predicted time, or the largest double if no margin is closing
+    */
+   double get_next_crossing_time () const
+   {
+      return next_crossing_time;
+   }
+
+   // Indicate whether a vehicle is visible from a site.
+   bool is_visible (unsigned int vehicle, unsigned int site) const;
+
+
+protected:
+
+   /**
+    * A tracked vehicle and its two most recent planet-fixed samples.
+    */
+   struct VehicleSample {
+      DynBody * body;        //!< The tracked vehicle
+      double pos[3];         //!< Current position
+      double vel[3];         //!< Current velocity
+      double prev_pos[3];    //!< Position at the previous sample
+      double prev_vel[3];    //!< Velocity at the previous sample
+   };
+
+   // Compute the elevation margins and their rates for one vehicle.
+   void compute_margins (
+      const double pos[3], const double vel[3],
+      double * margin, double * margin_rate) const;
+
+   // Locate a rise or set on the interpolated vehicle trajectory.
+   double locate_crossing (
+      const VehicleSample & sample, unsigned int site,
+      double prev_margin, double margin, double interval) const;
+
+   // Find the rises and sets over the interval ending at time.
+   void process_sample (double time);
+
+   /**
+    * Site names.
+    */
+   std::vector<std::string> site_names; //!< trick_io(**)
+
+   /**
+    * Site geodetic coordinates and elevation masks, as added:
+    * latitude, longitude, altitude, minimum elevation.
+    */
+   std::vector<double> site_inputs; //!< trick_io(**)
+
+   /**
+    * Site planet-fixed positions, one array per component.
+    */
+   std::vector<double> site_pos[3]; //!< trick_io(**)
+
+   /**
+    * Site local vertical unit vectors, one array per component.
+    */
+   std::vector<double> site_up[3]; //!< trick_io(**)
+
+   /**
+    * Sines of the site elevation masks.
+    */
+   std::vector<double> site_sin_mask; //!< trick_io(**)
+
+   /**
+    * Vehicles added by add_vehicle().
+    */
+   std::vector<DynBody *> vehicles; //!< trick_io(**)
+
+   /**
+    * Tracked vehicle samples.
+    */
+   std::vector<VehicleSample> samples; //!< trick_io(**)
+
+   /**
+    * Elevation margins, vehicle-major: d.up - |d| sin(mask), where d is the
+    * site-to-vehicle vector. Non-negative when visible.
+    */
+   std::vector<double> margins; //!< trick_io(**)
+
+   /**
+    * Elevation margins at the previous sample.
+    */
+   std::vector<double> prev_margins; //!< trick_io(**)
+
+   /**
+    * Time derivatives of the elevation margins.
+    */
+   std::vector<double> margin_rates; //!< trick_io(**)
+
+   /**
+    * Index in windows of the open window of each vehicle/site pair,
+    * or -1 if the vehicle is not visible from the site.
+    */
+   std::vector<int> open_windows; //!< trick_io(**)
+
+   /**
+    * Recorded access windows.
+    */
+   std::vector<AccessWindow> windows; //!< trick_io(**)
+
+   /**
+    * The planet on which the sites are located.
+    */
+   Planet * planet; //!< trick_units(--)
+
+   /**
+    * Time of the previous sample.
+    */
+   double prev_time; //!< trick_units(s)
+
+   /**
+    * Predicted time of the next rise or set.
+    */
+   double next_crossing_time; //!< trick_units(s)
+
+   /**
+    * Set once a sample has been taken.
+    */
+   bool have_prev; //!< trick_units(--)
+
+
+private:
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   GroundAccess (const GroundAccess &);
+   GroundAccess & operator= (const GroundAccess &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
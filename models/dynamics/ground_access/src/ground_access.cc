@@ -0,0 +1,559 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup GroundAccess
+ * @{
+ *
+ * @file models/dynamics/ground_access/src/ground_access.cc
+ * Define member functions for the class GroundAccess.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  ((TBS))
+
+Library dependencies:
+  ((ground_access.cc)
+   (ground_access_messages.cc)
+   (dynamics/dyn_body/src/dyn_body.cc)
+   (dynamics/dyn_manager/src/dyn_manager.cc)
+   (utils/ref_frames/src/ref_frame.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "environment/planet/include/planet.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/ground_access.hh"
+#include "../include/ground_access_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+// Maximum number of regula falsi iterations used to locate a crossing.
+const unsigned int max_crossing_iterations = 60;
+
+// Normalized time tolerance on a located crossing.
+const double crossing_tolerance = 1.0e-12;
+
+
+/**
+ * Evaluate the cubic Hermite interpolant of a trajectory.
+ * \param[in] r0,r1 Positions at the interval ends
+ * \param[in] w0,w1 Velocities at the interval ends, times the interval length
+ * \param[in] s Normalized time, 0 to 1
+ * \param[out] p Interpolated position
+ */
+void
+hermite_position (
+   const double r0[3],
+   const double r1[3],
+   const double w0[3],
+   const double w1[3],
+   double s,
+   double p[3])
+{
+   double s2 = s * s;
+   double s3 = s2 * s;
+
+   double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+   double h10 = s3 - 2.0 * s2 + s;
+   double h01 = -2.0 * s3 + 3.0 * s2;
+   double h11 = s3 - s2;
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      p[ii] = h00 * r0[ii] + h10 * w0[ii] + h01 * r1[ii] + h11 * w1[ii];
+   }
+}
+
+} // End anonymous namespace
+
+
+// Constructor
+GroundAccess::GroundAccess ()
+:
+   planet_name(),
+   report_events(false),
+   site_names(),
+   site_inputs(),
+   site_sin_mask(),
+   vehicles(),
+   samples(),
+   margins(),
+   prev_margins(),
+   margin_rates(),
+   open_windows(),
+   windows(),
+   planet(nullptr),
+   prev_time(0.0),
+   next_crossing_time(std::numeric_limits<double>::max()),
+   have_prev(false)
+{
+   return;
+}
+
+
+// Destructor
+GroundAccess::~GroundAccess ()
+{
+   return;
+}
+
+
+/**
+ * Add a ground site. Sites must be added before initialization.
+ * \param[in] name Site name
+ * \param[in] latitude Geodetic latitude\n Units: r
+ * \param[in] longitude Longitude\n Units: r
+ * \param[in] altitude Altitude above the reference ellipsoid\n Units: M
+ * \param[in] min_elevation Minimum elevation for visibility\n Units: r
+ */
+void
+GroundAccess::add_site (
+   const std::string & name,
+   double latitude,
+   double longitude,
+   double altitude,
+   double min_elevation)
+{
+   if ((std::fabs (latitude) > M_PI_2) ||
+       (std::fabs (min_elevation) >= M_PI_2)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GroundAccessMessages::invalid_entry,
+         "Site '%s' has a latitude or minimum elevation out of range.",
+         name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   site_names.push_back (name);
+   site_inputs.push_back (latitude);
+   site_inputs.push_back (longitude);
+   site_inputs.push_back (altitude);
+   site_inputs.push_back (min_elevation);
+}
+
+
+/**
+ * Add a vehicle to be tracked. If no vehicles are added, all of the
+ * dynamics manager's bodies are tracked.
+ * \param[in] vehicle Vehicle
+ */
+void
+GroundAccess::add_vehicle (
+   DynBody & vehicle)
+{
+   if (std::find (vehicles.begin(), vehicles.end(), &vehicle) ==
+       vehicles.end()) {
+      vehicles.push_back (&vehicle);
+   }
+}
+
+
+/**
+ * Find the planet, compute the planet-fixed site data, and collect the
+ * vehicles to be tracked.
+ * \param[in] manager Dynamics manager
+ */
+void
+GroundAccess::initialize (
+   DynManager & manager)
+{
+   planet = manager.find_planet (planet_name.c_str());
+
+   if (planet == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GroundAccessMessages::entry_not_found,
+         "Could not find a planet named '%s'.",
+         planet_name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   // Convert the geodetic site coordinates to planet-fixed positions.
+   unsigned int num_sites = get_num_sites();
+   double a_eq = planet->r_eq;
+   double e_sq = planet->e_ellip_sq;
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      site_pos[ii].resize (num_sites);
+      site_up[ii].resize (num_sites);
+   }
+   site_sin_mask.resize (num_sites);
+
+   for (unsigned int isite = 0; isite < num_sites; ++isite) {
+      const double * inputs = &site_inputs[4 * isite];
+      double sin_lat = std::sin (inputs[0]);
+      double cos_lat = std::cos (inputs[0]);
+      double sin_lon = std::sin (inputs[1]);
+      double cos_lon = std::cos (inputs[1]);
+      double altitude = inputs[2];
+      double n_radius = a_eq / std::sqrt (1.0 - e_sq * sin_lat * sin_lat);
+
+      site_pos[0][isite] = (n_radius + altitude) * cos_lat * cos_lon;
+      site_pos[1][isite] = (n_radius + altitude) * cos_lat * sin_lon;
+      site_pos[2][isite] = (n_radius * (1.0 - e_sq) + altitude) * sin_lat;
+
+      site_up[0][isite] = cos_lat * cos_lon;
+      site_up[1][isite] = cos_lat * sin_lon;
+      site_up[2][isite] = sin_lat;
+
+      site_sin_mask[isite] = std::sin (inputs[3]);
+   }
+
+   // Collect the vehicles.
+   std::vector<DynBody *> bodies = manager.get_dyn_bodies();
+
+   for (DynBody * vehicle : vehicles) {
+      if (std::find (bodies.begin(), bodies.end(), vehicle) == bodies.end()) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, GroundAccessMessages::entry_not_found,
+            "Vehicle '%s' is not registered with the dynamics manager.",
+            vehicle->name.c_str());
+
+         // Not reached
+         return;
+      }
+   }
+
+   const std::vector<DynBody *> & tracked =
+      vehicles.empty() ? bodies : vehicles;
+
+   samples.clear();
+   samples.reserve (tracked.size());
+   for (DynBody * vehicle : tracked) {
+      VehicleSample sample;
+      sample.body = vehicle;
+      Vector3::initialize (sample.pos);
+      Vector3::initialize (sample.vel);
+      Vector3::initialize (sample.prev_pos);
+      Vector3::initialize (sample.prev_vel);
+      samples.push_back (sample);
+   }
+
+   std::size_t num_pairs = samples.size() * num_sites;
+   margins.assign (num_pairs, 0.0);
+   prev_margins.assign (num_pairs, 0.0);
+   margin_rates.assign (num_pairs, 0.0);
+   open_windows.assign (num_pairs, -1);
+   windows.clear();
+
+   next_crossing_time = std::numeric_limits<double>::max();
+   have_prev = false;
+}
+
+
+/**
+ * Sample the vehicles and find the rises and sets since the previous sample.
+ * \param[in] time Current time; windows are recorded in this time scale
+ */
+void
+GroundAccess::update (
+   double time)
+{
+   RefFrameState state;
+   unsigned int num_sites = get_num_sites();
+
+   // The current margins become the previous margins.
+   margins.swap (prev_margins);
+
+   // Sample each vehicle once in the planet-fixed frame, then evaluate its
+   // margins with respect to every site.
+   for (unsigned int iveh = 0; iveh < samples.size(); ++iveh) {
+      VehicleSample & sample = samples[iveh];
+
+      Vector3::copy (sample.pos, sample.prev_pos);
+      Vector3::copy (sample.vel, sample.prev_vel);
+
+      sample.body->composite_body.compute_relative_state (planet->pfix, state);
+      Vector3::copy (state.trans.position, sample.pos);
+      Vector3::copy (state.trans.velocity, sample.vel);
+
+      std::size_t offset = static_cast<std::size_t> (iveh) * num_sites;
+      compute_margins (sample.pos, sample.vel,
+                       &margins[offset], &margin_rates[offset]);
+   }
+
+   process_sample (time);
+}
+
+
+/**
+ * Compute the elevation margins of a vehicle with respect to all sites,
+ * and the time derivatives of those margins.
+ * \param[in] pos Vehicle planet-fixed position\n Units: M
+ * \param[in] vel Vehicle planet-fixed velocity\n Units: M/s
+ * \param[out] margin Elevation margins, one per site\n Units: M
+ * \param[out] margin_rate Margin time derivatives, one per site\n Units: M/s
+ */
+void
+GroundAccess::compute_margins (
+   const double pos[3],
+   const double vel[3],
+   double * margin,
+   double * margin_rate) const
+{
+   unsigned int num_sites = get_num_sites();
+   const double * sx = site_pos[0].data();
+   const double * sy = site_pos[1].data();
+   const double * sz = site_pos[2].data();
+   const double * ux = site_up[0].data();
+   const double * uy = site_up[1].data();
+   const double * uz = site_up[2].data();
+   const double * sin_mask = site_sin_mask.data();
+   double rx = pos[0];
+   double ry = pos[1];
+   double rz = pos[2];
+   double vx = vel[0];
+   double vy = vel[1];
+   double vz = vel[2];
+
+   for (unsigned int ii = 0; ii < num_sites; ++ii) {
+      double dx = rx - sx[ii];
+      double dy = ry - sy[ii];
+      double dz = rz - sz[ii];
+      double range = std::sqrt (dx * dx + dy * dy + dz * dz);
+      double range_rate = (dx * vx + dy * vy + dz * vz) / range;
+
+      margin[ii] = (dx * ux[ii] + dy * uy[ii] + dz * uz[ii]) -
+                   range * sin_mask[ii];
+      margin_rate[ii] = (vx * ux[ii] + vy * uy[ii] + vz * uz[ii]) -
+                        range_rate * sin_mask[ii];
+   }
+}
+
+
+/**
+ * Locate the time at which a vehicle's elevation margin with respect to a
+ * site crosses zero, using Illinois regula falsi on the margin of the
+ * vehicle's interpolated position.
+ * @return Normalized time of the crossing, 0 to 1
+ * \param[in] sample Vehicle samples bracketing the crossing
+ * \param[in] site Site index
+ * \param[in] prev_margin Margin at the start of the interval\n Units: M
+ * \param[in] margin Margin at the end of the interval\n Units: M
+ * \param[in] interval Sample interval\n Units: s
+ */
+double
+GroundAccess::locate_crossing (
+   const VehicleSample & sample,
+   unsigned int site,
+   double prev_margin,
+   double margin,
+   double interval) const
+{
+   double w0[3];
+   double w1[3];
+   Vector3::scale (sample.prev_vel, interval, w0);
+   Vector3::scale (sample.vel, interval, w1);
+
+   double site_posn[3] = {site_pos[0][site], site_pos[1][site],
+                          site_pos[2][site]};
+   double up[3] = {site_up[0][site], site_up[1][site], site_up[2][site]};
+   double sin_mask = site_sin_mask[site];
+
+   double s_lo = 0.0;
+   double s_hi = 1.0;
+   double f_lo = prev_margin;
+   double f_hi = margin;
+   double s_new = 1.0;
+   int last_side = 0;
+
+   for (unsigned int iter = 0; iter < max_crossing_iterations; ++iter) {
+      s_new = (s_lo * f_hi - s_hi * f_lo) / (f_hi - f_lo);
+
+      double posn[3];
+      double rel[3];
+      hermite_position (sample.prev_pos, sample.pos, w0, w1, s_new, posn);
+      Vector3::diff (posn, site_posn, rel);
+      double f_new = Vector3::dot (rel, up) - Vector3::vmag (rel) * sin_mask;
+
+      if (f_new == 0.0) {
+         break;
+      }
+
+      // Keep the bracket; halve the retained end's value when the same end
+      // is retained twice in a row.
+      if ((f_new < 0.0) == (f_lo < 0.0)) {
+         s_lo = s_new;
+         f_lo = f_new;
+         if (last_side == -1) {
+            f_hi *= 0.5;
+         }
+         last_side = -1;
+      }
+      else {
+         s_hi = s_new;
+         f_hi = f_new;
+         if (last_side == 1) {
+            f_lo *= 0.5;
+         }
+         last_side = 1;
+      }
+
+      if (s_hi - s_lo < crossing_tolerance) {
+         break;
+      }
+   }
+
+   return s_new;
+}
+
+
+/**
+ * Open and close access windows according to the margins just computed,
+ * and predict the time of the next crossing.
+ * \param[in] time Current time\n Units: s
+ */
+void
+GroundAccess::process_sample (
+   double time)
+{
+   unsigned int num_sites = get_num_sites();
+   double interval = time - prev_time;
+   bool interpolate = have_prev && (interval > 0.0);
+   double start_time = prev_time;
+
+   prev_time = time;
+   have_prev = true;
+   next_crossing_time = std::numeric_limits<double>::max();
+
+   for (unsigned int iveh = 0; iveh < samples.size(); ++iveh) {
+      const VehicleSample & sample = samples[iveh];
+      std::size_t offset = static_cast<std::size_t> (iveh) * num_sites;
+
+      for (unsigned int isite = 0; isite < num_sites; ++isite) {
+         std::size_t ipair = offset + isite;
+         double margin = margins[ipair];
+         double prev_margin = prev_margins[ipair];
+         double margin_rate = margin_rates[ipair];
+         bool visible = (margin >= 0.0);
+         bool was_visible = (open_windows[ipair] >= 0);
+
+         // First-order prediction of the next crossing.
+         if (margin * margin_rate < 0.0) {
+            next_crossing_time =
+               std::min (next_crossing_time, time - margin / margin_rate);
+         }
+
+         if (visible == was_visible) {
+            continue;
+         }
+
+         double event_time = time;
+         if (interpolate && ((prev_margin >= 0.0) != visible)) {
+            event_time = start_time +
+                         interval * locate_crossing (
+                                       sample, isite, prev_margin, margin,
+                                       interval);
+         }
+
+         if (visible) {
+            AccessWindow window;
+            window.vehicle = sample.body;
+            window.site = isite;
+            window.rise_time = event_time;
+            window.set_time = event_time;
+            window.open = true;
+            open_windows[ipair] = static_cast<int> (windows.size());
+            windows.push_back (window);
+         }
+         else {
+            AccessWindow & window = windows[open_windows[ipair]];
+            window.set_time = event_time;
+            window.open = false;
+            open_windows[ipair] = -1;
+         }
+
+         if (report_events) {
+            MessageHandler::inform (
+               __FILE__, __LINE__, GroundAccessMessages::access_event,
+               "Vehicle '%s' %s site '%s' at t=%.3f s.",
+               sample.body->name.c_str(),
+               visible ? "rose above" : "set below",
+               site_names[isite].c_str(), event_time);
+         }
+      }
+   }
+}
+
+
+/**
+ * Indicate whether a vehicle is visible from a site as of the last sample.
+ * @return True if visible
+ * \param[in] vehicle Index of the vehicle in tracking order
+ * \param[in] site Site index
+ */
+bool
+GroundAccess::is_visible (
+   unsigned int vehicle,
+   unsigned int site) const
+{
+   std::size_t ipair =
+      static_cast<std::size_t> (vehicle) * get_num_sites() + site;
+   return (ipair < open_windows.size()) && (open_windows[ipair] >= 0);
+}
+
+
+/**
+ * Discard the closed access windows, retaining the open ones.
+ */
+void
+GroundAccess::clear_closed_windows ()
+{
+   std::vector<int> remap (windows.size(), -1);
+   std::vector<AccessWindow> retained;
+
+   for (unsigned int ii = 0; ii < windows.size(); ++ii) {
+      if (windows[ii].open) {
+         remap[ii] = static_cast<int> (retained.size());
+         retained.push_back (windows[ii]);
+      }
+   }
+
+   for (int & index : open_windows) {
+      if (index >= 0) {
+         index = remap[index];
+      }
+   }
+
+   windows.swap (retained);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
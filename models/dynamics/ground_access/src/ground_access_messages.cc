@@ -0,0 +1,60 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup GroundAccess
+ * @{
+ *
+ * @file models/dynamics/ground_access/src/ground_access_messages.cc
+ * Implement the class GroundAccessMessages.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  ((TBS))
+
+Library dependencies:
+  ((ground_access_messages.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "../include/ground_access_messages.hh"
+
+#define PATH "dynamics/ground_access/"
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Static member data
+
+char const * GroundAccessMessages::entry_not_found =
+   PATH "entry_not_found";
+
+char const * GroundAccessMessages::invalid_entry =
+   PATH "invalid_entry";
+
+char const * GroundAccessMessages::access_event =
+   PATH "access_event";
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -64,10 +64,12 @@ namespace jeod {
 
 class MassBody;
 class MassBodyLinks;
+class MassMoments;
 class MassPoint;
 class MassPointInit;
 class MassProperties;
 class MassPropertiesInit;
+class MassTank;
 
 } // End JEOD namespace
 
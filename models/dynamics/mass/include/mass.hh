@@ -59,7 +59,8 @@ ASSUMPTIONS AND LIMITATIONS:
    (Tree attachment Structure))
 
 LIBRARY DEPENDENCIES:
-  ((../src/mass.cc))
+  ((../src/mass.cc)
+   (../src/mass_moments.cc))
 
 
 
@@ -75,12 +76,14 @@ LIBRARY DEPENDENCIES:
 // Model includes
 #include "class_declarations.hh"
 #include "mass_properties.hh"
+#include "mass_moments.hh"
 #include "mass_point.hh"
 #include "mass_body_links.hh"
 #include "mass_point_init.hh"
 
 // JEOD includes
 #include "dynamics/dyn_body/include/class_declarations.hh"
+#include "utils/memory/include/class_declarations.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 #include "utils/container/include/pointer_list.hh"
 
@@ -226,6 +229,14 @@ public:
    void set_update_flag (void);
    virtual void update_mass_properties (void);
 
+   // Defer composite property updates until the matching commit.
+   void begin_mass_update (void);
+   void commit_mass_update (void);
+
+   // Snapshot methods
+
+   void add_snapshot_regions (StateSnapshot & snapshot);
+
    // Print methods
 
    void print_body (FILE * file_ptr, int levels) const;
@@ -339,6 +350,8 @@ protected:
 
    void calc_composite_cm (void);
    void calc_composite_inertia (void);
+   void calc_parent_contribution (const MassBody & parent);
+   void update_root_mass_properties (void);
 
 
    // Member data
@@ -371,6 +384,38 @@ protected:
     */
    bool needs_update; //!< trick_units(--)
 
+   /**
+    * Number of open begin_mass_update calls on this body. While positive,
+    * attachments, detachments, and reattachments at or below this body
+    * flag the mass tree for update but do not recompute it.
+    */
+   unsigned int mass_update_depth; //!< trick_units(--)
+
+   /**
+    * Sum of the attached children's contributions (see parent_contribution)
+    * about this body's structural origin.
+    */
+   MassMoments child_moments; //!< trick_units(--)
+
+   /**
+    * When clear, child_moments must be rebuilt from all children rather than
+    * updated from the children marked for update.
+    */
+   bool child_moments_valid; //!< trick_units(--)
+
+   /**
+    * This body's composite mass moments about the parent body's structural
+    * origin. The first moment is expressed in the parent's structural frame
+    * and the second moment in the parent's body frame.
+    */
+   MassMoments parent_contribution; //!< trick_units(--)
+
+   /**
+    * Indicates that parent_contribution is included in the parent body's
+    * child_moments.
+    */
+   bool contributes_to_parent; //!< trick_units(--)
+
    /**
     * List of points associated with this mass body. @n
     * NOTE WELL: The MassBody manages the memory associated with the contents
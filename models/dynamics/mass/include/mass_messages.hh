@@ -117,6 +117,11 @@ class MassBodyMessages {
     */
    static char const * invalid_enum; //!< trick_units(--)
 
+   /**
+    * Issued when a MassTank is misconfigured or used before initialization.
+    */
+   static char const * invalid_tank; //!< trick_units(--)
+
    /**
     * Issued when an I/O error occurs.
     */
@@ -0,0 +1,133 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Mass
+ * @{
+ *
+ * @file models/dynamics/mass/include/mass_moments.hh
+ * Define the class MassMoments.
+ */
+
+/********************************* TRICK HEADER *******************************
+
+Purpose:
+  ()
+
+Library Dependencies:
+ ((../src/mass_moments.cc))
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_MASS_MOMENTS_HH
+#define JEOD_MASS_MOMENTS_HH
+
+
+// Model includes
+#include "class_declarations.hh"
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Zeroth, first, and second mass moments of a set of masses about a common
+ * reference point.
+ * Unlike mass properties taken about a center of mass, moments about a fixed
+ * point are additive: the moments of a union of masses are the sums of the
+ * moments of its parts. A MassBody keeps the sum of its children's moments
+ * about its structural origin so that a change to one child is folded into
+ * the parent by subtracting that child's old moments and adding its new ones.
+ */
+class MassMoments {
+
+   JEOD_MAKE_SIM_INTERFACES(MassMoments)
+
+ // Member data
+ public:
+
+   /**
+    * Total mass.
+    */
+   double mass; //!< trick_units(kg)
+
+   /**
+    * Mass times center of mass location with respect to the reference point.
+    */
+   double first_moment[3]; //!< trick_units(kg*m)
+
+   /**
+    * Inertia tensor about the reference point.
+    */
+   double second_moment[3][3]; //!< trick_units(kg*m2)
+
+
+ // Member functions
+ public:
+
+   // Constructor.
+   MassMoments (void);
+
+   // Set all moments to zero.
+   void initialize (void);
+
+   // Add the moments of another set of masses to these moments.
+   void incr (const MassMoments & addend);
+
+   // Remove the moments of another set of masses from these moments.
+   void decr (const MassMoments & subtrahend);
+
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
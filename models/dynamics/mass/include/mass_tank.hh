@@ -0,0 +1,213 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Mass
+ * @{
+ *
+ * @file models/dynamics/mass/include/mass_tank.hh
+ * Define the class MassTank, a MassBody whose core mass properties vary
+ * with the fill level of the propellant it contains.
+ */
+
+/********************************* TRICK HEADER *******************************
+
+Purpose:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((Rigid Bodies)
+   (Propellant settled against the tank base as a solid cylinder))
+
+LIBRARY DEPENDENCIES:
+  ((../src/mass_tank.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_MASS_TANK_HH
+#define JEOD_MASS_TANK_HH
+
+// Model includes
+#include "class_declarations.hh"
+#include "mass.hh"
+#include "mass_moments.hh"
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A MassBody that contains propellant in a cylindrical tank.
+ * The core mass properties set by initialize_mass describe the empty tank.
+ * The propellant is modeled as a solid cylinder of the tank's radius that
+ * fills the tank from its base up to a height proportional to the fill
+ * fraction. Changing the fill level recomputes the core properties from the
+ * dry and propellant moments directly, without re-initializing the body,
+ * and lets the composite update fold the change into the mass tree.
+ *
+ * \par Assumptions and Limitations
+ *  - Rigid Bodies
+ *  - The propellant is settled against the tank base.
+ */
+class MassTank : public MassBody {
+
+   JEOD_MAKE_SIM_INTERFACES(MassTank)
+
+ // Member data
+ public:
+
+   /**
+    * Mass of the propellant in a full tank.
+    */
+   double propellant_capacity; //!< trick_units(kg)
+
+   /**
+    * Inside radius of the tank.
+    */
+   double tank_radius; //!< trick_units(m)
+
+   /**
+    * Inside length of the tank, base to top.
+    */
+   double tank_length; //!< trick_units(m)
+
+   /**
+    * Center of the tank base, in structural coordinates.
+    */
+   double tank_base[3]; //!< trick_units(m)
+
+   /**
+    * Unit vector from the tank base toward its top, in structural coordinates.
+    */
+   double tank_axis[3]; //!< trick_units(--)
+
+
+ protected:
+
+   /**
+    * Fraction of propellant_capacity currently in the tank, between 0 and 1.
+    */
+   double fill_fraction; //!< trick_units(--)
+
+   /**
+    * Moments of the empty tank about the structural origin. The first moment
+    * is in structural coordinates, the second in core body coordinates.
+    */
+   MassMoments dry_moments; //!< trick_units(--)
+
+   /**
+    * Set once initialize_tank has captured the dry moments.
+    */
+   bool tank_initialized; //!< trick_units(--)
+
+
+ // Member functions
+ public:
+
+   // Constructor and destructor.
+   MassTank (void);
+   ~MassTank (void) override;
+
+   // Capture the dry properties and apply the initial fill fraction.
+   void initialize_tank (double initial_fill_fraction);
+
+   // Change the amount of propellant.
+   void set_fill_fraction (double fraction);
+   void set_propellant_mass (double propellant_mass);
+   void consume_propellant (double consumed_mass);
+
+   /**
+    * Return the fraction of propellant_capacity in the tank.
+    * @return Fill fraction\n Units: --
+    */
+   double get_fill_fraction (void) const
+   {
+      return fill_fraction;
+   }
+
+   /**
+    * Return the propellant mass in the tank.
+    * @return Propellant mass\n Units: kg
+    */
+   double get_propellant_mass (void) const
+   {
+      return fill_fraction * propellant_capacity;
+   }
+
+
+ protected:
+
+   // Recompute the core properties for the current fill fraction.
+   void apply_fill (void);
+
+
+ private:
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+
+   /**
+    * Not implemented.
+    */
+   MassTank (const MassTank &);
+
+   /**
+    * Not implemented.
+    */
+   MassTank & operator = (const MassTank &);
+
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
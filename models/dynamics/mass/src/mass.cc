@@ -84,7 +84,12 @@ MassBody::MassBody ()
    dyn_manager(nullptr),
    mass_properties_initialized(false),
    links(*this),
-   needs_update(false)
+   needs_update(false),
+   mass_update_depth(0),
+   child_moments(),
+   child_moments_valid(false),
+   parent_contribution(),
+   contributes_to_parent(false)
 
 {
    JEOD_REGISTER_CLASS(MassBody);
@@ -123,7 +128,12 @@ MassBody::MassBody ( DynBody& owner )
    dyn_manager(nullptr),
    mass_properties_initialized(false),
    links(*this),
-   needs_update(false)
+   needs_update(false),
+   mass_update_depth(0),
+   child_moments(),
+   child_moments_valid(false),
+   parent_contribution(),
+   contributes_to_parent(false)
 {
    JEOD_REGISTER_CLASS(MassBody);
    JEOD_REGISTER_CLASS(MassPoint);
@@ -221,6 +231,10 @@ MassBody::initialize_mass (
    // Initialize the core mass properties.
    properties.initialize_mass_properties (core_properties);
 
+   // The children's second moments are expressed in this body's body frame,
+   // which the new core properties may have reoriented.
+   child_moments_valid = false;
+
    mass_properties_initialized = true;
 
    // The core and composite frames have the same alignment wrt structure.
@@ -339,6 +353,71 @@ MassBody::set_update_flag (
 }
 
 
+/**
+ * Update the composite mass properties of the tree containing this body
+ * unless a mass update transaction is open on this body or one of its
+ * ancestors, in which case the update is left to the commit.
+ */
+void
+MassBody::update_root_mass_properties (
+   void)
+{
+   for (auto* link : TreeLinksAscendRange<MassBodyLinks>(links)) {
+      if (link->container().mass_update_depth > 0) {
+         return;
+      }
+   }
+
+   get_root_body_internal()->update_mass_properties ();
+}
+
+
+/**
+ * Open a mass update transaction on this body.
+ * Until the matching commit_mass_update, attachments, detachments, and
+ * reattachments at or below this body only flag the affected bodies; the
+ * composite properties of the tree are recomputed once, at the commit.
+ * Bodies whose core properties are changed directly (e.g., propellant
+ * depletion) should be flagged with set_update_flag within the transaction.
+ * Transactions nest.
+ *
+ * \par Assumptions and Limitations
+ *  - Composite properties are stale until the outermost commit. DynBody
+ *    attachments and detachments that conserve momentum or reset the state
+ *    still update the tree immediately.
+ */
+void
+MassBody::begin_mass_update (
+   void)
+{
+   ++mass_update_depth;
+}
+
+
+/**
+ * Close a mass update transaction opened by begin_mass_update.
+ * Closing the outermost transaction updates the composite properties of
+ * the tree containing this body.
+ */
+void
+MassBody::commit_mass_update (
+   void)
+{
+   if (mass_update_depth == 0) {
+      MessageHandler::error (
+         __FILE__, __LINE__, MassBodyMessages::internal_error,
+         "MassBody '%s' has no mass update in progress.",
+         name.c_str());
+      return;
+   }
+
+   --mass_update_depth;
+   if (mass_update_depth == 0) {
+      update_root_mass_properties ();
+   }
+}
+
+
 /**
  * Return the number of mass points for this body.
  * @return Mass point
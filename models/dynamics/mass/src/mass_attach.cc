@@ -567,7 +567,7 @@ MassBody::attach_update_properties (
    // Update this body's mass properties.
    // Note that this sets child.composite_wrt_pbdy.position.
    set_update_flag ();
-   get_root_body_internal()->update_mass_properties ();
+   update_root_mass_properties ();
 
    return;
 }
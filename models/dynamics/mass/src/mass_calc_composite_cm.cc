@@ -27,7 +27,6 @@ Library Dependency:
 
 // JEOD includes
 #include "utils/math/include/vector3.hh"
-#include "utils/ref_frames/include/tree_links_iterator.hh"
 
 // Model includes
 #include "../include/mass.hh"
@@ -43,6 +42,7 @@ namespace jeod {
  * \par Assumptions and Limitations
  *  - Rigid bodies
  *  - Must calculate from bottom to top of tree for meaningful results
+ *  - child_moments is current
  */
 void
 MassBody::calc_composite_cm (
@@ -55,23 +55,17 @@ MassBody::calc_composite_cm (
    // For composite bodies, the mass is the sum of the component masses and
    // the center of mass is given by M*CM = sum (m*cm), summed over the
    // component masses. The component masses comprise the core mass of this body
-   // alone plus the composite masses of each attached child body.
+   // alone plus the composite masses of each attached child body. The latter
+   // are maintained as a running sum in child_moments.
 
    // Initialize the mass and mass*center of mass to the core values.
    mass = core_properties.mass;
    Vector3::scale (core_properties.position, core_properties.mass,
                    mass_times_com);
 
-   // Add each child body's contribution to the accumulators.
-   for (auto* child_link : TreeLinksChildrenRange<MassBodyLinks>(links)) {
-      const MassBody* child = &(child_link->container());
-
-      // Accumulate the mass and mass * center of mass for this child body.
-      mass += child->composite_properties.mass;
-      Vector3::scale_incr (
-         child->composite_wrt_pstr.position, child->composite_properties.mass,
-         mass_times_com);
-   }
+   // Add the children's contribution to the accumulators.
+   mass += child_moments.mass;
+   Vector3::incr (child_moments.first_moment, mass_times_com);
 
    // Compute the composite center of mass.
    if (mass > 0.0) {
@@ -26,7 +26,8 @@ LIBRARY DEPENDENCY:
 // System includes
 
 // JEOD includes
-#include "utils/ref_frames/include/tree_links_iterator.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
 
 // Model includes
 #include "../include/mass.hh"
@@ -42,13 +43,15 @@ namespace jeod {
  *  - Rigid Bodies
  *  - Tree attachment structure
  *  - Must calculate from bottom to top of tree for meaningful results
+ *  - child_moments is current
  */
 void
 MassBody::calc_composite_inertia (
    void)
 {
-   double offset_inertia[3][3];       // kg*M2 Inertia due to child body mass
-   double transform_inertia[3][3];    // kg*M2 Inertia due to child body inertia
+   double offset_inertia[3][3];  // kg*M2 Inertia due to a point mass
+   double r_str[3];              // M     Offset in structural coordinates
+   double r_bdy[3];              // M     Offset in body coordinates
 
 
    // For composite bodies, the composite inertia tensor is the sum of all
@@ -71,25 +74,23 @@ MassBody::calc_composite_inertia (
    Matrix3x3::add (offset_inertia, core_properties.inertia,
                    composite_properties.inertia);
 
-   // Add each child body's contribution to the composite inertia.
-   for (auto* child_link : TreeLinksChildrenRange<MassBodyLinks>(links)) {
-      const MassBody* child = &(child_link->container());
-
-      // Compute the inertia due to the core center of mass being offset from
-      // the composite center of mass.
-      compute_point_mass_inertia (child->composite_properties.mass,
-                                  child->composite_wrt_pbdy.position,
-                                  offset_inertia);
-
-      // Transform the child composite inertia to this body's body frame.
-      Matrix3x3::transpose_transform_matrix (
-         child->composite_wrt_pbdy.T_parent_this,
-         child->composite_properties.inertia,
-         transform_inertia);
-
-      // Add the child contributions to the composite inertia.
+   // Add the children's contribution. child_moments holds their inertia about
+   // this body's structural origin; shift it to the children's combined CoM
+   // and from there to the composite CoM per the parallel axis theorem.
+   Matrix3x3::incr (child_moments.second_moment,
+                    composite_properties.inertia);
+
+   if (child_moments.mass > 0.0) {
+      Vector3::scale (child_moments.first_moment, 1.0 / child_moments.mass,
+                      r_str);
+      Vector3::transform (composite_properties.T_parent_this, r_str, r_bdy);
+      compute_point_mass_inertia (child_moments.mass, r_bdy, offset_inertia);
+      Matrix3x3::decr (offset_inertia, composite_properties.inertia);
+
+      Vector3::decr (composite_properties.position, r_str);
+      Vector3::transform (composite_properties.T_parent_this, r_str, r_bdy);
+      compute_point_mass_inertia (child_moments.mass, r_bdy, offset_inertia);
       Matrix3x3::incr (offset_inertia, composite_properties.inertia);
-      Matrix3x3::incr (transform_inertia, composite_properties.inertia);
    }
 }
 
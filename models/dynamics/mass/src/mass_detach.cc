@@ -335,9 +335,22 @@ MassBody::detach_update_properties (
    MassBody & child)
 {
 
+   // Remove the child's contribution from this body's children's moments.
+   // Start from zero when the last child leaves so that roundoff from
+   // repeated updates does not linger.
+   if (child.contributes_to_parent) {
+      if (links.has_children()) {
+         child_moments.decr (child.parent_contribution);
+      }
+      else {
+         child_moments.initialize ();
+      }
+      child.contributes_to_parent = false;
+   }
+
    // Update the mass properties from the root down to this body.
    set_update_flag ();
-   get_root_body_internal()->update_mass_properties ();
+   update_root_mass_properties ();
 
    // Re-initialize the child's auxiliarly attachment info.
    child.structure_point.initialize_mass_point ();
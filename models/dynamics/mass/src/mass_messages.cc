@@ -59,6 +59,9 @@ char const * MassBodyMessages::invalid_name =
 char const * MassBodyMessages::invalid_enum =
     PATH "invalid_enum";
 
+char const * MassBodyMessages::invalid_tank =
+    PATH "invalid_tank";
+
 char const * MassBodyMessages::io_error =
     PATH "io_error";
 
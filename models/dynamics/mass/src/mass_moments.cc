@@ -0,0 +1,104 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Mass
+ * @{
+ *
+ * @file models/dynamics/mass/src/mass_moments.cc
+ * Define methods for the MassMoments class.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Reference:
+    (((TBS)))
+
+  Assumptions and limitations:
+    ((N/A))
+
+  Class:
+    (N/A)
+
+  LIBRARY DEPENDENCY:
+    ((mass_moments.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/math/include/matrix3x3.hh"
+
+// Model includes
+#include "../include/mass_moments.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default constructor; constructs a MassMoments object with zero moments.
+ */
+MassMoments::MassMoments (
+   void)
+{
+   initialize ();
+}
+
+
+/**
+ * Set all moments to zero.
+ */
+void
+MassMoments::initialize (
+   void)
+{
+   mass = 0.0;
+   Vector3::initialize (first_moment);
+   Matrix3x3::initialize (second_moment);
+}
+
+
+/**
+ * Add the moments of another set of masses to these moments.
+ * Both sets of moments must be about the same point in the same frame.
+ * \param[in] addend Moments to add
+ */
+void
+MassMoments::incr (
+   const MassMoments & addend)
+{
+   mass += addend.mass;
+   Vector3::incr (addend.first_moment, first_moment);
+   Matrix3x3::incr (addend.second_moment, second_moment);
+}
+
+
+/**
+ * Remove the moments of another set of masses from these moments.
+ * Both sets of moments must be about the same point in the same frame.
+ * \param[in] subtrahend Moments to remove
+ */
+void
+MassMoments::decr (
+   const MassMoments & subtrahend)
+{
+   mass -= subtrahend.mass;
+   Vector3::decr (subtrahend.first_moment, first_moment);
+   Matrix3x3::decr (subtrahend.second_moment, second_moment);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -98,10 +98,11 @@ MassBody::reattach (
       composite_wrt_pbdy.Q_parent_this);
    composite_wrt_pbdy.compute_transformation ();
 
-   // Update the parent's mass properties.
+   // Update the parent's mass properties. This body is flagged as well
+   // because its contribution to the parent has moved.
    // Note that this sets composite_wrt_pbdy.position.
-   parent->set_update_flag ();
-   parent->get_root_body_internal()->update_mass_properties ();
+   set_update_flag ();
+   update_root_mass_properties ();
 
    return;
 }
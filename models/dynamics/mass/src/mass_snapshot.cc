@@ -0,0 +1,110 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Mass
+ * @{
+ *
+ * @file models/dynamics/mass/src/mass_snapshot.cc
+ * Define MassBody::add_snapshot_regions.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((mass_snapshot.cc)
+   (mass.cc)
+   (utils/memory/src/state_snapshot.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "utils/memory/include/state_snapshot.hh"
+
+// Model includes
+#include "../include/mass.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Register the state of a mass point with a snapshot. The state is
+ * registered member by member as a mass point is a polymorphic object.
+ * \param[in] point The mass point
+ * \param[in,out] snapshot The snapshot
+ */
+void
+add_point_regions (
+   MassPointState & point,
+   StateSnapshot & snapshot)
+{
+   snapshot.add_item (point.position);
+   snapshot.add_item (point.Q_parent_this);
+   snapshot.add_item (point.T_parent_this);
+}
+
+
+/**
+ * Register mass properties with a snapshot.
+ * \param[in] properties The mass properties
+ * \param[in,out] snapshot The snapshot
+ */
+void
+add_properties_regions (
+   MassProperties & properties,
+   StateSnapshot & snapshot)
+{
+   add_point_regions (properties, snapshot);
+   snapshot.add_item (properties.mass);
+   snapshot.add_item (properties.inertia);
+   snapshot.add_item (properties.inverse_mass);
+   snapshot.add_item (properties.inverse_inertia);
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Register this body's mass properties, and the cached contributions and
+ * offsets derived from them, with a state snapshot so that mass changes
+ * made during a what-if propagation (e.g., propellant use) are rolled back.
+ * The attachment structure is not registered: attaching or detaching bodies
+ * requires the snapshot to be rebuilt.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+MassBody::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   add_properties_regions (core_properties, snapshot);
+   add_properties_regions (composite_properties, snapshot);
+   add_point_regions (structure_point, snapshot);
+   add_point_regions (core_wrt_composite, snapshot);
+   add_point_regions (composite_wrt_pstr, snapshot);
+   add_point_regions (composite_wrt_pbdy, snapshot);
+   snapshot.add_item (child_moments);
+   snapshot.add_item (child_moments_valid);
+   snapshot.add_item (parent_contribution);
+   snapshot.add_item (contributes_to_parent);
+   snapshot.add_item (needs_update);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
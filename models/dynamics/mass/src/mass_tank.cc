@@ -0,0 +1,275 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Mass
+ * @{
+ *
+ * @file models/dynamics/mass/src/mass_tank.cc
+ * Define methods for the MassTank class.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Reference:
+    (((TBS)))
+
+  Assumptions and limitations:
+    ((Propellant settled against the tank base as a solid cylinder))
+
+  Class:
+    (N/A)
+
+  LIBRARY DEPENDENCY:
+    ((mass_tank.cc)
+     (mass.cc)
+     (mass_moments.cc)
+     (mass_point_mass_inertia.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/mass_tank.hh"
+#include "../include/mass_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default constructor; constructs an empty MassTank object.
+ */
+MassTank::MassTank (
+   void)
+:
+   MassBody(),
+   propellant_capacity(0.0),
+   tank_radius(0.0),
+   tank_length(0.0),
+   fill_fraction(0.0),
+   dry_moments(),
+   tank_initialized(false)
+{
+   JEOD_REGISTER_CLASS(MassTank);
+
+   Vector3::initialize (tank_base);
+   Vector3::unit (2, tank_axis);
+}
+
+
+/**
+ * Destroy a MassTank object.
+ */
+MassTank::~MassTank (
+   void)
+{
+}
+
+
+/**
+ * Capture the dry mass properties and apply the initial fill fraction.
+ *
+ * \par Assumptions and Limitations
+ *  - initialize_mass has been called with the properties of the empty tank.
+ * \param[in] initial_fill_fraction Initial fraction of capacity\n Units: --
+ */
+void
+MassTank::initialize_tank (
+   double initial_fill_fraction)
+{
+   double r_cm_bdy[3];          // M     Dry CoM in core body coordinates
+   double offset_inertia[3][3]; // kg*M2 Inertia due to dry mass
+
+   if (! mass_properties_initialized) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MassBodyMessages::invalid_tank,
+         "MassTank '%s': initialize_mass must precede initialize_tank.",
+         name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   if ((propellant_capacity < 0.0) ||
+       (tank_radius < 0.0) || (tank_length < 0.0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MassBodyMessages::invalid_tank,
+         "MassTank '%s': the capacity and dimensions must be non-negative.",
+         name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   Vector3::normalize (tank_axis);
+
+   // Move the dry properties to the structural origin.
+   dry_moments.mass = core_properties.mass;
+   Vector3::scale (core_properties.position, core_properties.mass,
+                   dry_moments.first_moment);
+   Vector3::transform (core_properties.T_parent_this,
+                       core_properties.position, r_cm_bdy);
+   compute_point_mass_inertia (core_properties.mass, r_cm_bdy,
+                               offset_inertia);
+   Matrix3x3::add (core_properties.inertia, offset_inertia,
+                   dry_moments.second_moment);
+
+   tank_initialized = true;
+
+   set_fill_fraction (initial_fill_fraction);
+}
+
+
+/**
+ * Set the fraction of propellant_capacity in the tank and update the
+ * mass properties of the tree containing the tank.
+ * \param[in] fraction Fill fraction, limited to [0,1]\n Units: --
+ */
+void
+MassTank::set_fill_fraction (
+   double fraction)
+{
+   if (! tank_initialized) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MassBodyMessages::invalid_tank,
+         "MassTank '%s' has not been initialized.",
+         name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   if (fraction < 0.0) {
+      fraction = 0.0;
+   }
+   else if (fraction > 1.0) {
+      fraction = 1.0;
+   }
+   fill_fraction = fraction;
+
+   apply_fill ();
+
+   set_update_flag ();
+   update_root_mass_properties ();
+}
+
+
+/**
+ * Set the propellant mass in the tank.
+ * \param[in] propellant_mass Propellant mass\n Units: kg
+ */
+void
+MassTank::set_propellant_mass (
+   double propellant_mass)
+{
+   if (propellant_capacity > 0.0) {
+      set_fill_fraction (propellant_mass / propellant_capacity);
+   }
+   else {
+      set_fill_fraction (0.0);
+   }
+}
+
+
+/**
+ * Remove propellant from the tank. The tank does not go below empty.
+ * \param[in] consumed_mass Propellant mass removed\n Units: kg
+ */
+void
+MassTank::consume_propellant (
+   double consumed_mass)
+{
+   set_propellant_mass (get_propellant_mass() - consumed_mass);
+}
+
+
+/**
+ * Recompute the core mass properties as the sum of the dry tank and the
+ * propellant column for the current fill fraction.
+ */
+void
+MassTank::apply_fill (
+   void)
+{
+   MassMoments total;           // --    Dry plus propellant moments
+   double prop_mass;            // kg    Propellant mass
+   double height;               // M     Height of the propellant column
+   double r_str[3];             // M     Propellant CoM, structural coords
+   double r_bdy[3];             // M     Propellant CoM, body coords
+   double axis_bdy[3];          // --    Tank axis, body coords
+   double offset_inertia[3][3]; // kg*M2 Inertia due to a point mass
+   double radial;               // kg*M2 Moment about a transverse axis
+   double axial;                // kg*M2 Moment about the tank axis
+
+   prop_mass = fill_fraction * propellant_capacity;
+   height = fill_fraction * tank_length;
+
+   total = dry_moments;
+
+   if (prop_mass > 0.0) {
+
+      // The propellant CoM is midway up the column.
+      Vector3::copy (tank_base, r_str);
+      Vector3::scale_incr (tank_axis, 0.5 * height, r_str);
+
+      total.mass += prop_mass;
+      Vector3::scale_incr (r_str, prop_mass, total.first_moment);
+
+      // Inertia of a solid cylinder about its CoM:
+      //   I = radial * (E - a a^T) + axial * a a^T
+      radial = prop_mass *
+               (3.0 * tank_radius * tank_radius + height * height) / 12.0;
+      axial = 0.5 * prop_mass * tank_radius * tank_radius;
+      Vector3::transform (core_properties.T_parent_this, tank_axis, axis_bdy);
+      for (int ii = 0; ii < 3; ++ii) {
+         for (int jj = 0; jj < 3; ++jj) {
+            total.second_moment[ii][jj] +=
+               (axial - radial) * axis_bdy[ii] * axis_bdy[jj];
+         }
+         total.second_moment[ii][ii] += radial;
+      }
+
+      // Shift the propellant inertia to the structural origin.
+      Vector3::transform (core_properties.T_parent_this, r_str, r_bdy);
+      compute_point_mass_inertia (prop_mass, r_bdy, offset_inertia);
+      Matrix3x3::incr (offset_inertia, total.second_moment);
+   }
+
+   // Shift the total back to the new core CoM.
+   core_properties.mass = total.mass;
+   if (total.mass > 0.0) {
+      core_properties.inverse_mass = 1.0 / total.mass;
+      Vector3::scale (total.first_moment, core_properties.inverse_mass,
+                      core_properties.position);
+      Vector3::transform (core_properties.T_parent_this,
+                          core_properties.position, r_bdy);
+      compute_point_mass_inertia (total.mass, r_bdy, offset_inertia);
+      Matrix3x3::subtract (total.second_moment, offset_inertia,
+                           core_properties.inertia);
+   }
+   else {
+      core_properties.inverse_mass = 0.0;
+      Vector3::initialize (core_properties.position);
+      Matrix3x3::initialize (core_properties.inertia);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -77,12 +77,35 @@ MassBody::update_mass_properties (
    // Calculate the composite properties for a composite body.
    else {
 
-      // First update all of the attached bodies' mass properties, if needed.
+      // Rebuild the children's moments from scratch if they are stale.
+      if (! child_moments_valid) {
+         child_moments.initialize ();
+         for (auto* link : TreeLinksChildrenRange<MassBodyLinks>(links)) {
+            link->container().contributes_to_parent = false;
+         }
+         child_moments_valid = true;
+      }
+
+      // Update the attached bodies' mass properties, if needed, and replace
+      // the contributions of those that changed. Children that did not change
+      // contribute the moments already summed into child_moments, so the cost
+      // of the sums is proportional to the number of changed bodies.
       for (auto* link : TreeLinksChildrenRange<MassBodyLinks>(links)) {
          MassBody* child = &(link->container());
+         bool changed = child->needs_update || (! child->contributes_to_parent);
+
          if (child->needs_update) {
             child->update_mass_properties ();
          }
+
+         if (changed) {
+            if (child->contributes_to_parent) {
+               child_moments.decr (child->parent_contribution);
+            }
+            child->calc_parent_contribution (*this);
+            child_moments.incr (child->parent_contribution);
+            child->contributes_to_parent = true;
+         }
       }
 
 
@@ -148,6 +171,43 @@ MassBody::update_mass_properties (
    return;
 }
 
+
+/**
+ * Compute this body's composite mass moments about the parent body's
+ * structural origin. The parent uses these to form its composite properties.
+ *
+ * \par Assumptions and Limitations
+ *  - This body's composite properties and composite_wrt_pstr.position are
+ *    current.
+ * \param[in] parent The body to which this body is attached.
+ */
+void
+MassBody::calc_parent_contribution (
+   const MassBody & parent)
+{
+   double r_cm_pbdy[3];            // M     Composite CoM in parent body axes
+   double offset_inertia[3][3];    // kg*M2 Inertia due to composite mass
+   double transform_inertia[3][3]; // kg*M2 Composite inertia in parent axes
+
+   parent_contribution.mass = composite_properties.mass;
+
+   Vector3::scale (composite_wrt_pstr.position, composite_properties.mass,
+                   parent_contribution.first_moment);
+
+   // Shift the composite inertia from this body's CoM to the parent's
+   // structural origin and express it in the parent's body frame.
+   Vector3::transform (parent.composite_properties.T_parent_this,
+                       composite_wrt_pstr.position, r_cm_pbdy);
+   compute_point_mass_inertia (composite_properties.mass, r_cm_pbdy,
+                               offset_inertia);
+   Matrix3x3::transpose_transform_matrix (
+      composite_wrt_pbdy.T_parent_this,
+      composite_properties.inertia,
+      transform_inertia);
+   Matrix3x3::add (offset_inertia, transform_inertia,
+                   parent_contribution.second_moment);
+}
+
 } // End JEOD namespace
 
 /**
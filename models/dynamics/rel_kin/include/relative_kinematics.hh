@@ -71,10 +71,15 @@ Library dependencies:
 
 
 // System includes
+#include <map>
+#include <utility>
+#include <vector>
 
 // JEOD includes
 #include "dynamics/derived_state/include/class_declarations.hh"
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/ref_frames/include/class_declarations.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 
@@ -97,6 +102,15 @@ class RelativeKinematics {
     */
    unsigned int num_rel_states; //!< trick_units(--)
 
+   /**
+    * Share each frame's state relative to a common ancestor among the
+    * relative states that update_all computes, rather than walking the tree
+    * once per relative state? The shared path agrees with the per-relstate
+    * update to rounding level only.
+    * Default value: false.
+    */
+   bool share_ancestor_states; //!< trick_units(--)
+
    /**
     * List of relative states to be computed and maintained by this model. Note
     * that this list is not restricted to be relative states associated with
@@ -105,6 +119,22 @@ class RelativeKinematics {
    JeodPointerVector<RelativeDerivedState>::type relative_states;  //!< trick_io(**)
 
 
+ protected:
+
+   /**
+    * Index into ancestor_states of each (frame, common ancestor) pair
+    * encountered by the current update_all pass.
+    */
+   std::map<std::pair<const RefFrame *, const RefFrame *>, unsigned int>
+      ancestor_index; //!< trick_io(**)
+
+   /**
+    * State of each frame in ancestor_index relative to its ancestor.
+    * Retained across passes to avoid reallocation.
+    */
+   std::vector<RefFrameState> ancestor_states; //!< trick_io(**)
+
+
  // Member functions
 
  // Make the copy constructor and assignment operator private
@@ -138,6 +168,13 @@ class RelativeKinematics {
    // Update all of the RelativeDerivedStates maintained by this model
    void update_all (void);
 
+
+ protected:
+
+   // Get the state of a frame relative to an ancestor, computed once per pass
+   const RefFrameState & state_wrt_ancestor (
+      const RefFrame & frame, const RefFrame & ancestor);
+
 };
 
 } // End JEOD namespace
@@ -26,7 +26,10 @@ Library dependencies:
    (rel_kin_messages.cc)
    (dynamics/derived_state/src/relative_derived_state.cc)
    (utils/message/src/message_handler.cc)
-   (utils/named_item/src/named_item.cc))
+   (utils/named_item/src/named_item.cc)
+   (utils/ref_frames/src/ref_frame.cc)
+   (utils/ref_frames/src/ref_frame_compute_relative_state.cc)
+   (utils/ref_frames/src/ref_frame_state.cc))
 
 
 *******************************************************************************/
@@ -38,9 +41,11 @@ Library dependencies:
 
 // JEOD includes
 #include "dynamics/derived_state/include/relative_derived_state.hh"
+#include "dynamics/dyn_body/include/body_ref_frame.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/named_item/include/named_item.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
 
 // Model includes
 #include "../include/relative_kinematics.hh"
@@ -56,7 +61,10 @@ namespace jeod {
 RelativeKinematics::RelativeKinematics (
    void)
 :
-   num_rel_states(0)
+   num_rel_states(0),
+   share_ancestor_states(false),
+   ancestor_index(),
+   ancestor_states()
 {
    JEOD_REGISTER_CLASS (RelativeKinematics);
    JEOD_REGISTER_CLASS (RelativeDerivedState);
@@ -217,22 +225,105 @@ RelativeKinematics::update_single (
  * Update all relative states maintained by this model.
  * relstates that have been deactivated from RelKin will
  * not be update.
+ *
+ * If share_ancestor_states is set, rather than walking the tree once per
+ * relstate, each frame's state relative to the last common node of the frame
+ * pair is computed once per pass and shared by all of the relstates that
+ * involve that frame and node. The pairwise states then follow from one
+ * state subtraction each.
  */
 void
 RelativeKinematics::update_all (
    void)
 {
-   unsigned int n_relstates = num_rel_states;
+   if (! share_ancestor_states) {
+      unsigned int n_relstates = num_rel_states;
+      for (unsigned int ii = 0; ii < n_relstates; ++ii) {
+         if (relative_states[ii]->active == true) {
+            relative_states[ii]->update ();
+         }
+      }
+      return;
+   }
+
+   ancestor_index.clear ();
 
+   unsigned int n_relstates = num_rel_states;
    for (unsigned int ii = 0; ii < n_relstates; ++ii) {
-       if (relative_states[ii]->active == true) {
-          relative_states[ii]->update ();
-       }
+      RelativeDerivedState * relstate = relative_states[ii];
+      if (relstate->active != true) {
+         continue;
+      }
+
+      // Identify the frame whose state is computed and the frame with
+      // respect to which it is computed.
+      const RefFrame * frame = nullptr;
+      const RefFrame * wrt_frame = nullptr;
+      if (relstate->direction_sense ==
+          RelativeDerivedState::ComputeSubjectStateinTarget) {
+         frame = relstate->get_subject_frame();
+         wrt_frame = relstate->get_target_frame();
+      }
+      else if (relstate->direction_sense ==
+               RelativeDerivedState::ComputeTargetStateinSubject) {
+         frame = relstate->get_target_frame();
+         wrt_frame = relstate->get_subject_frame();
+      }
+
+      const RefFrame * ancestor = nullptr;
+      if ((frame != nullptr) && (wrt_frame != nullptr)) {
+         ancestor = frame->find_last_common_node (*wrt_frame);
+      }
+
+      // The relstate handles errors and the cases where one frame is an
+      // ancestor of the other, which need no shared states.
+      if ((ancestor == nullptr) ||
+          (ancestor == frame) ||
+          (ancestor == wrt_frame)) {
+         relstate->update ();
+         continue;
+      }
+
+      // General case: S_wrt:frame = -S_anc:wrt + S_anc:frame.
+      const RefFrameState & wrt_state =
+         state_wrt_ancestor (*wrt_frame, *ancestor);
+      relstate->rel_state.copy (state_wrt_ancestor (*frame, *ancestor));
+      relstate->rel_state.decr_left (wrt_state);
    }
 
    return;
 }
 
+
+/**
+ * Get the state of a frame relative to one of its ancestors, computing it
+ * on the first request in an update_all pass.
+ * @return Frame state relative to the ancestor
+ * \param[in] frame Frame whose state is needed
+ * \param[in] ancestor Ancestor of the frame
+ */
+const RefFrameState &
+RelativeKinematics::state_wrt_ancestor (
+   const RefFrame & frame,
+   const RefFrame & ancestor)
+{
+   std::pair<const RefFrame *, const RefFrame *> key (&frame, &ancestor);
+   std::map<std::pair<const RefFrame *, const RefFrame *>,
+            unsigned int>::const_iterator found = ancestor_index.find (key);
+   if (found != ancestor_index.end()) {
+      return ancestor_states[found->second];
+   }
+
+   unsigned int index = ancestor_index.size();
+   if (ancestor_states.size() <= index) {
+      ancestor_states.resize (index + 1);
+   }
+   frame.compute_relative_state (ancestor, ancestor_states[index]);
+   ancestor_index.insert (std::make_pair (key, index));
+
+   return ancestor_states[index];
+}
+
 } // End JEOD namespace
 
 /**
@@ -0,0 +1,126 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Uncertainty
+ * @{
+ *
+ * @file models/dynamics/uncertainty/include/uncertainty_messages.hh
+ * Define the class UncertaintyMessages, the class that specifies the
+ * message IDs used in the uncertainty propagation model.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((This is a complete catalog of all the messages sent by this model.)
+   (This is not an exhaustive list of all the things that can go awry.))
+
+Library dependencies:
+  ((../src/uncertainty_messages.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_UNCERTAINTY_MESSAGES_HH
+#define JEOD_UNCERTAINTY_MESSAGES_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Specifies the message IDs used in the uncertainty propagation model.
+ */
+class UncertaintyMessages {
+
+
+ JEOD_MAKE_SIM_INTERFACES(UncertaintyMessages)
+
+
+ // Static member data
+ public:
+
+   /**
+    * Issued when a propagation parameter or request is invalid.
+    */
+   static char const * invalid_entry; //!< trick_units(--)
+
+   /**
+    * Issued when a covariance matrix is not positive definite.
+    */
+   static char const * not_positive_definite; //!< trick_units(--)
+
+   /**
+    * Issued when an estimate cannot be formed at the requested time.
+    */
+   static char const * time_not_available; //!< trick_units(--)
+
+ // Member functions
+ // This class is not instantiable.
+ // The constructors and assignment operator for this class are declared
+ // private and are not implemented.
+ private:
+   UncertaintyMessages (void);
+   UncertaintyMessages (const UncertaintyMessages &);
+   UncertaintyMessages & operator= (const UncertaintyMessages &);
+
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
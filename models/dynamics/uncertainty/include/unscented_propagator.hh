@@ -0,0 +1,298 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Uncertainty
+ * @{
+ *
+ * @file models/dynamics/uncertainty/include/unscented_propagator.hh
+ * Define the classes UncertaintyEstimate and UnscentedPropagator, which
+ * propagate a translational state covariance with the unscented transform.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Julier, S. J. and Uhlmann, J. K.)
+    (Unscented Filtering and Nonlinear Estimation)
+    (Proceedings of the IEEE, 92(3), 2004))
+   ((Wan, E. A. and van der Merwe, R.)
+    (The Unscented Kalman Filter for Nonlinear Estimation)
+    (IEEE Adaptive Systems for Signal Processing, Communications, and
+     Control Symposium, 2000)))
+
+Assumptions and limitations:
+  ((The uncertain state is the six element translational state of the
+    composite body with respect to the integration frame.)
+   (The sigma point bodies are root bodies that share an integration frame
+    and are subject to the same environment and effectors as the nominal.)
+   (Attitude and mass are not perturbed.))
+
+Library dependencies:
+  ((../src/unscented_propagator.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_UNSCENTED_PROPAGATOR_HH
+#define JEOD_UNSCENTED_PROPAGATOR_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+
+
+/**
+ * A mean and covariance reconstructed from the sigma points.
+ */
+class UncertaintyEstimate {
+
+   JEOD_MAKE_SIM_INTERFACES(UncertaintyEstimate)
+
+public:
+
+   /**
+    * Dynamic time of the estimate.
+    */
+   double time; //!< trick_units(s)
+
+   /**
+    * Mean state: position followed by velocity, wrt the integration frame.
+    */
+   double mean[6]; //!< trick_units(--)
+
+   /**
+    * State covariance, ordered as the mean.
+    */
+   double covariance[6][6]; //!< trick_units(--)
+
+   UncertaintyEstimate ();
+};
+
+
+/**
+ * Propagates the translational state covariance of a body with the
+ * unscented transform. The 2n+1 (n=6) sigma points are carried by ordinary
+ * DynBody objects supplied by the simulation, one per point. Placing those
+ * bodies in one DynamicsIntegrationGroup with batched translation and
+ * gravitation lets the group integrate the whole ensemble lane-parallel in
+ * a single simulation, in place of a simulation per sample.
+ *
+ * generate_sigma_points() spreads the bodies about the mean along the
+ * columns of the scaled Cholesky factor of the covariance. Each update()
+ * reconstructs the weighted mean and covariance from the bodies' states;
+ * estimates at requested output times that fall within the last step are
+ * formed from the bodies' dense output.
+ */
+class UnscentedPropagator {
+
+   JEOD_MAKE_SIM_INTERFACES(UnscentedPropagator)
+
+public:
+
+   /**
+    * Number of elements in the uncertain state.
+    */
+   static const unsigned int state_size = 6;
+
+   /**
+    * Number of sigma points.
+    */
+   static const unsigned int num_sigma_points = 2 * state_size + 1;
+
+
+   // Member data
+
+   /**
+    * Spread of the sigma points about the mean; small positive.
+    */
+   double alpha; //!< trick_units(--)
+
+   /**
+    * Prior knowledge of the distribution; 2 is optimal for a Gaussian.
+    */
+   double beta; //!< trick_units(--)
+
+   /**
+    * Secondary scaling parameter.
+    */
+   double kappa; //!< trick_units(--)
+
+   /**
+    * Mean state from which the sigma points are generated: position
+    * followed by velocity, wrt the integration frame.
+    */
+   double initial_mean[6]; //!< trick_units(--)
+
+   /**
+    * Covariance from which the sigma points are generated.
+    */
+   double initial_covariance[6][6]; //!< trick_units(--)
+
+   /**
+    * Current estimate, formed at each update.
+    */
+   UncertaintyEstimate current; //!< trick_units(--)
+
+
+   // Member functions
+
+   UnscentedPropagator ();
+
+   ~UnscentedPropagator ();
+
+   // Add a body that carries a sigma point.
+   void add_sigma_body (DynBody & body);
+
+   // Take the initial mean from a body's current state.
+   void set_mean_from_body (const DynBody & body);
+
+   // Set the initial covariance from standard deviations.
+   void set_diagonal_covariance (
+      const double position_sigma[3], const double velocity_sigma[3]);
+
+   // Set the sigma point body states and reset their integrators.
+   void generate_sigma_points ();
+
+   // Request an estimate at a dynamic time.
+   void add_output_time (double time);
+
+   // Form the current estimate and any requested estimates now available.
+   void update (double time);
+
+   // Discard the recorded estimates.
+   void clear_estimates ();
+
+   /**
+    * Get the number of recorded estimates.
+    * @return Estimate count
+    */
+   unsigned int get_num_estimates () const
+   {
+      return static_cast<unsigned int> (estimates.size());
+   }
+
+   /**
+    * Get a recorded estimate.
+    * @return Estimate
+    * \param[in] index Estimate index, less than get_num_estimates()
+    */
+   const UncertaintyEstimate & get_estimate (unsigned int index) const
+   {
+      return estimates[index];
+   }
+
+
+protected:
+
+   // Compute the mean and covariance weights.
+   void compute_weights ();
+
+   // Form an estimate from sigma point states.
+   void reconstruct (
+      const double (* points)[6], UncertaintyEstimate & estimate) const;
+
+   /**
+    * Bodies that carry the sigma points, mean first.
+    */
+   std::vector<DynBody *> bodies; //!< trick_io(**)
+
+   /**
+    * Requested output times not yet reached, in increasing order.
+    */
+   std::vector<double> output_times; //!< trick_io(**)
+
+   /**
+    * Recorded estimates at the requested output times.
+    */
+   std::vector<UncertaintyEstimate> estimates; //!< trick_io(**)
+
+   /**
+    * Mean weight of the central sigma point.
+    */
+   double mean_weight_0; //!< trick_units(--)
+
+   /**
+    * Covariance weight of the central sigma point.
+    */
+   double cov_weight_0; //!< trick_units(--)
+
+   /**
+    * Mean and covariance weight of the other sigma points.
+    */
+   double weight_i; //!< trick_units(--)
+
+   /**
+    * Set once the sigma points have been generated.
+    */
+   bool generated; //!< trick_units(--)
+
+
+private:
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   UnscentedPropagator (const UnscentedPropagator &);
+   UnscentedPropagator & operator= (const UnscentedPropagator &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,60 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Uncertainty
+ * @{
+ *
+ * @file models/dynamics/uncertainty/src/uncertainty_messages.cc
+ * Implement the class UncertaintyMessages.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  ((TBS))
+
+Library dependencies:
+  ((uncertainty_messages.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "../include/uncertainty_messages.hh"
+
+#define PATH "dynamics/uncertainty/"
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Static member data
+
+char const * UncertaintyMessages::invalid_entry =
+   PATH "invalid_entry";
+
+char const * UncertaintyMessages::not_positive_definite =
+   PATH "not_positive_definite";
+
+char const * UncertaintyMessages::time_not_available =
+   PATH "time_not_available";
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,422 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Dynamics
+ * @{
+ * @addtogroup Uncertainty
+ * @{
+ *
+ * @file models/dynamics/uncertainty/src/unscented_propagator.cc
+ * Define member functions for the classes UncertaintyEstimate and
+ * UnscentedPropagator.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  ((TBS))
+
+Library dependencies:
+  ((unscented_propagator.cc)
+   (uncertainty_messages.cc)
+   (dynamics/dyn_body/src/dyn_body.cc)
+   (dynamics/dyn_body/src/dyn_body_integration.cc)
+   (dynamics/dyn_body/src/dyn_body_set_state.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/uncertainty_messages.hh"
+#include "../include/unscented_propagator.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * UncertaintyEstimate default constructor.
+ */
+UncertaintyEstimate::UncertaintyEstimate ()
+:
+   time(0.0)
+{
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      mean[ii] = 0.0;
+      for (unsigned int jj = 0; jj < 6; ++jj) {
+         covariance[ii][jj] = 0.0;
+      }
+   }
+}
+
+
+/**
+ * UnscentedPropagator default constructor.
+ */
+UnscentedPropagator::UnscentedPropagator ()
+:
+   alpha(1e-3),
+   beta(2.0),
+   kappa(0.0),
+   current(),
+   bodies(),
+   output_times(),
+   estimates(),
+   mean_weight_0(0.0),
+   cov_weight_0(0.0),
+   weight_i(0.0),
+   generated(false)
+{
+   for (unsigned int ii = 0; ii < state_size; ++ii) {
+      initial_mean[ii] = 0.0;
+      for (unsigned int jj = 0; jj < state_size; ++jj) {
+         initial_covariance[ii][jj] = 0.0;
+      }
+   }
+}
+
+
+/**
+ * UnscentedPropagator destructor.
+ */
+UnscentedPropagator::~UnscentedPropagator ()
+{
+   ; // Empty
+}
+
+
+/**
+ * Add a body that carries a sigma point. The first body added carries the
+ * mean; num_sigma_points bodies must be added in all.
+ * \param[in] body Sigma point body; a root body not already added
+ */
+void
+UnscentedPropagator::add_sigma_body (
+   DynBody & body)
+{
+   if (! body.is_root_body()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, UncertaintyMessages::invalid_entry,
+         "DynBody '%s' is not a root body and cannot carry a sigma point.",
+         body.name.c_str());
+
+      // Not reached
+      return;
+   }
+
+   if ((std::find (bodies.begin(), bodies.end(), &body) != bodies.end()) ||
+       (bodies.size() >= num_sigma_points)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, UncertaintyMessages::invalid_entry,
+         "DynBody '%s' is already a sigma point body, or all %u sigma "
+         "point bodies have been added.",
+         body.name.c_str(), num_sigma_points);
+
+      // Not reached
+      return;
+   }
+
+   bodies.push_back (&body);
+}
+
+
+/**
+ * Take the initial mean from a body's current composite body state.
+ * \param[in] body Nominal body
+ */
+void
+UnscentedPropagator::set_mean_from_body (
+   const DynBody & body)
+{
+   Vector3::copy (body.composite_body.state.trans.position, initial_mean);
+   Vector3::copy (body.composite_body.state.trans.velocity, initial_mean + 3);
+}
+
+
+/**
+ * Set the initial covariance to a diagonal matrix.
+ * \param[in] position_sigma Position standard deviations\n Units: M
+ * \param[in] velocity_sigma Velocity standard deviations\n Units: M/s
+ */
+void
+UnscentedPropagator::set_diagonal_covariance (
+   const double position_sigma[3],
+   const double velocity_sigma[3])
+{
+   for (unsigned int ii = 0; ii < state_size; ++ii) {
+      for (unsigned int jj = 0; jj < state_size; ++jj) {
+         initial_covariance[ii][jj] = 0.0;
+      }
+   }
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      initial_covariance[ii][ii] = position_sigma[ii] * position_sigma[ii];
+      initial_covariance[ii+3][ii+3] = velocity_sigma[ii] * velocity_sigma[ii];
+   }
+}
+
+
+/**
+ * Place the sigma point bodies about the initial mean along the columns of
+ * the Cholesky factor of (n+lambda) times the initial covariance, and reset
+ * their integrators. Body 0 takes the mean, bodies 1 to n the positive and
+ * bodies n+1 to 2n the negative excursions. Any requested estimates and
+ * recorded estimates are kept.
+ */
+void
+UnscentedPropagator::generate_sigma_points ()
+{
+   if (bodies.size() != num_sigma_points) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, UncertaintyMessages::invalid_entry,
+         "%u sigma point bodies are required; %u were added.",
+         num_sigma_points, static_cast<unsigned int> (bodies.size()));
+
+      // Not reached
+      return;
+   }
+
+   compute_weights ();
+   double scale = 0.5 / weight_i;
+
+   // Cholesky factorization of the scaled covariance, lower triangle.
+   double chol[6][6] = {{0.0}};
+   for (unsigned int jj = 0; jj < state_size; ++jj) {
+      double diag = scale * initial_covariance[jj][jj];
+      for (unsigned int kk = 0; kk < jj; ++kk) {
+         diag -= chol[jj][kk] * chol[jj][kk];
+      }
+      if (! (diag > 0.0)) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, UncertaintyMessages::not_positive_definite,
+            "The initial covariance is not positive definite "
+            "(pivot %u is %g).",
+            jj, diag);
+
+         // Not reached
+         return;
+      }
+      chol[jj][jj] = std::sqrt (diag);
+
+      for (unsigned int ii = jj + 1; ii < state_size; ++ii) {
+         double sum = scale * 0.5 * (initial_covariance[ii][jj] +
+                                     initial_covariance[jj][ii]);
+         for (unsigned int kk = 0; kk < jj; ++kk) {
+            sum -= chol[ii][kk] * chol[jj][kk];
+         }
+         chol[ii][jj] = sum / chol[jj][jj];
+      }
+   }
+
+   for (unsigned int ip = 0; ip < num_sigma_points; ++ip) {
+      double point[6];
+      for (unsigned int ii = 0; ii < state_size; ++ii) {
+         point[ii] = initial_mean[ii];
+      }
+      if (ip > 0) {
+         unsigned int col = (ip - 1) % state_size;
+         double sign = (ip <= state_size) ? 1.0 : -1.0;
+         for (unsigned int ii = col; ii < state_size; ++ii) {
+            point[ii] += sign * chol[ii][col];
+         }
+      }
+
+      DynBody & body = *bodies[ip];
+      body.set_position (point, body.composite_body);
+      body.set_velocity (point + 3, body.composite_body);
+      body.update_integrated_state ();
+      body.propagate_state ();
+      body.reset_integrators ();
+   }
+
+   generated = true;
+}
+
+
+/**
+ * Request an estimate at a dynamic time. The estimate is recorded by the
+ * first update at or after that time.
+ * \param[in] time Dynamic time\n Units: s
+ */
+void
+UnscentedPropagator::add_output_time (
+   double time)
+{
+   if (generated && (time < current.time)) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, UncertaintyMessages::invalid_entry,
+         "Output time %.17g precedes the current estimate time %.17g "
+         "and was ignored.",
+         time, current.time);
+      return;
+   }
+
+   output_times.insert (
+      std::upper_bound (output_times.begin(), output_times.end(), time),
+      time);
+}
+
+
+/**
+ * Form the current estimate from the sigma point bodies' states, then
+ * record an estimate at each requested output time reached. A requested
+ * time within the step just taken is served from the bodies' dense output
+ * when every body has it; otherwise it is served only if it coincides with
+ * the current time, and is otherwise dropped with a warning.
+ * \param[in] time Current dynamic time\n Units: s
+ */
+void
+UnscentedPropagator::update (
+   double time)
+{
+   if (! generated) {
+      return;
+   }
+
+   double points[num_sigma_points][6];
+   for (unsigned int ip = 0; ip < num_sigma_points; ++ip) {
+      const RefFrameTrans & trans = bodies[ip]->composite_body.state.trans;
+      Vector3::copy (trans.position, points[ip]);
+      Vector3::copy (trans.velocity, points[ip] + 3);
+   }
+   reconstruct (points, current);
+   current.time = time;
+
+   double tolerance = 1e-9 * std::max (1.0, std::fabs (time));
+   std::size_t nreached = 0;
+   while ((nreached < output_times.size()) &&
+          (output_times[nreached] <= time + tolerance)) {
+      double output_time = output_times[nreached];
+      ++nreached;
+
+      if (std::fabs (output_time - time) <= tolerance) {
+         estimates.push_back (current);
+         estimates.back().time = output_time;
+         continue;
+      }
+
+      bool interpolated = true;
+      for (unsigned int ip = 0; interpolated && (ip < num_sigma_points); ++ip) {
+         interpolated = bodies[ip]->interpolate_trans_state (
+                           output_time, points[ip] + 3, points[ip]);
+      }
+      if (! interpolated) {
+         MessageHandler::warn (
+            __FILE__, __LINE__, UncertaintyMessages::time_not_available,
+            "No dense output covers output time %.17g; "
+            "the estimate was not recorded.",
+            output_time);
+         continue;
+      }
+
+      estimates.push_back (UncertaintyEstimate());
+      reconstruct (points, estimates.back());
+      estimates.back().time = output_time;
+   }
+   output_times.erase (output_times.begin(), output_times.begin() + nreached);
+}
+
+
+/**
+ * Discard the recorded estimates.
+ */
+void
+UnscentedPropagator::clear_estimates ()
+{
+   estimates.clear ();
+}
+
+
+/**
+ * Compute the unscented transform weights from alpha, beta, and kappa.
+ */
+void
+UnscentedPropagator::compute_weights ()
+{
+   double dn = static_cast<double> (state_size);
+   double lambda = alpha * alpha * (dn + kappa) - dn;
+
+   if (! (dn + lambda > 0.0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, UncertaintyMessages::invalid_entry,
+         "alpha=%g and kappa=%g give a non-positive sigma point scale.",
+         alpha, kappa);
+
+      // Not reached
+      return;
+   }
+
+   mean_weight_0 = lambda / (dn + lambda);
+   cov_weight_0 = mean_weight_0 + (1.0 - alpha * alpha + beta);
+   weight_i = 0.5 / (dn + lambda);
+}
+
+
+/**
+ * Form the weighted mean and covariance of a set of sigma point states.
+ * The deviations are taken from the central point before weighting, which
+ * keeps the sums well conditioned when alpha is small.
+ * \param[in] points Sigma point states
+ * \param[out] estimate Mean and covariance; the time is not set
+ */
+void
+UnscentedPropagator::reconstruct (
+   const double (* points)[6],
+   UncertaintyEstimate & estimate)
+const
+{
+   double dev[num_sigma_points][6];
+   double mean_dev[6];
+
+   for (unsigned int ii = 0; ii < state_size; ++ii) {
+      mean_dev[ii] = 0.0;
+      for (unsigned int ip = 0; ip < num_sigma_points; ++ip) {
+         dev[ip][ii] = points[ip][ii] - points[0][ii];
+         mean_dev[ii] += ((ip == 0) ? mean_weight_0 : weight_i) * dev[ip][ii];
+      }
+      estimate.mean[ii] = points[0][ii] + mean_dev[ii];
+   }
+
+   for (unsigned int ip = 0; ip < num_sigma_points; ++ip) {
+      for (unsigned int ii = 0; ii < state_size; ++ii) {
+         dev[ip][ii] -= mean_dev[ii];
+      }
+   }
+
+   for (unsigned int ii = 0; ii < state_size; ++ii) {
+      for (unsigned int jj = 0; jj <= ii; ++jj) {
+         double sum = cov_weight_0 * dev[0][ii] * dev[0][jj];
+         for (unsigned int ip = 1; ip < num_sigma_points; ++ip) {
+            sum += weight_i * dev[ip][ii] * dev[ip][jj];
+         }
+         estimate.covariance[ii][jj] = sum;
+         estimate.covariance[jj][ii] = sum;
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
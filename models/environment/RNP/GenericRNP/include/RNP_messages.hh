@@ -115,6 +115,12 @@ public:
     */
    static char const * polar_motion_table_warning;   //!< trick_units(--)
 
+   /**
+    * Indicates that an interpolated quantity departed from the value it
+    * approximates by more than the allowed tolerance.
+    */
+   static char const * interpolation_warning;   //!< trick_units(--)
+
 private:
 
    // Class is not instantiable, operator = and copy constructor are
@@ -84,6 +84,7 @@ Library dependencies:
 // System includes
 
 // JEOD includes
+#include "utils/quaternion/include/quat.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -158,8 +159,68 @@ public: //public member variables
     */
    double NP_matrix[3][3]; //!< trick_units(--)
 
+   /**
+    * Dynamic time between refreshes of the nutation, precession, and
+    * NP_matrix in a full fidelity RNP updated through update_rnp(double).
+    * The axial rotation and polar motion are still recomputed at every
+    * update. Zero (the default) refreshes NP at every update.
+    */
+   double np_update_interval; //!< trick_units(s)
+
+   /**
+    * Interpolate NP between refreshes rather than holding it. When set, a
+    * full fidelity RNP updated through update_rnp(double) evaluates NP at
+    * knots np_update_interval apart (or closer, per the tolerance) and
+    * interpolates the NP quaternion between them with SLERP. Requires a
+    * model that sets np_time_scale.
+    */
+   bool interpolate_np; //!< trick_units(--)
+
+   /**
+    * Largest acceptable NP interpolation error. When positive, NP is also
+    * evaluated at the midpoint between knots and the knot spacing is halved
+    * until the interpolation error there is within tolerance. Zero (the
+    * default) disables the check.
+    */
+   double np_interpolation_tolerance; //!< trick_units(rad)
+
+   /**
+    * NP interpolation error measured at the midpoint of the current knot
+    * interval, if checked.
+    * @note Users should not set this data member in the input file.
+    */
+   double np_interpolation_error; //!< trick_units(rad)
+
 protected: // private member variables
 
+   /**
+    * Dynamic time at which NP_matrix was last refreshed
+    */
+   double np_update_time; //!< trick_units(s)
+
+   /**
+    * True once NP_matrix has been refreshed at np_update_time
+    */
+   bool np_updated; //!< trick_units(--)
+
+   /**
+    * Rate of the nutation and precession model time with respect to dynamic
+    * time, in model time units per second. Set by models that support NP
+    * interpolation; zero (the default) means interpolation is unavailable.
+    */
+   double np_time_scale; //!< trick_units(--)
+
+   /**
+    * Dynamic time between the NP interpolation knots.
+    */
+   double np_knot_interval; //!< trick_units(s)
+
+   /**
+    * NP as left quaternions at np_update_time and at np_update_time plus
+    * np_knot_interval.
+    */
+   Quaternion np_knot_quat[2]; //!< trick_units(--)
+
    /**
     * A transformation matrix used for intermediate math steps
     */
@@ -177,6 +238,12 @@ public: // public member functions
    // of the planet found in the given dyn manager.
    void update_rnp ();
 
+   // Same as update_rnp, but with the nutation, precession, and NP matrix
+   // refreshed only when np_update_interval has elapsed (in either
+   // direction) since the last refresh, or NP interpolated between knots
+   // if interpolate_np is set. The dynamic time is that of the update.
+   void update_rnp (double dyn_time);
+
    // Invokes the calculation for the axial rotation model (the largest
    // contributor to rotation, the axial Z-rotation that causes days)
    // and then multiples out the RNP with the most recent calculations done
@@ -199,6 +266,17 @@ public: // public member functions
 
 private: // private member functions
 
+   // Update the models, refreshing nutation and precession if requested,
+   // and propagate the result.
+   void update_rnp_models (bool refresh_np);
+
+   // Evaluate NP at the given knot times and check the interpolation.
+   void build_np_knots (double dyn_time);
+
+   // Evaluate NP at the given model times.
+   void compute_np (
+      double nutation_time, double precession_time, Quaternion & np_quat);
+
    // operator = and copy constructor locked from use by being private
 
    /**
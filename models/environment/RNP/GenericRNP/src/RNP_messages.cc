@@ -55,6 +55,9 @@ char const * RNPMessages::setup_error =
 char const * RNPMessages::polar_motion_table_warning =
    PATH "polar_motion_table_warning";
 
+char const * RNPMessages::interpolation_warning =
+   PATH "interpolation_warning";
+
 } // End JEOD namespace
 
 /**
@@ -42,20 +42,28 @@ Library dependencies:
    (environment/planet/src/planet.cc)
    (utils/ref_frames/src/ref_frame_state.cc)
    (utils/message/src/message_handler.cc)
-   (utils/quaternion/src/quat_from_mat.cc))
+   (utils/quaternion/src/quat.cc)
+   (utils/quaternion/src/quat_from_mat.cc)
+   (utils/quaternion/src/quat_norm.cc)
+   (utils/quaternion/src/quat_to_mat.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
  
 
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
 #include "environment/planet/include/planet.hh"
 #include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/planet_rnp.hh"
@@ -66,6 +74,96 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Largest number of times the knot spacing is halved to meet the NP
+ * interpolation tolerance.
+ */
+const unsigned int max_knot_halvings = 10;
+
+
+/**
+ * Interpolate between two unit quaternions along the shortest great arc.
+ * Unlike Quaternion::compute_slerp, the arc angle is found from both its
+ * sine and cosine, which keeps the interpolation accurate for the very
+ * small arcs NP sweeps between knots.
+ * \param[in] q0 Quaternion at fraction 0
+ * \param[in] q1 Quaternion at fraction 1
+ * \param[in] frac Interpolation fraction
+ * \param[out] result Interpolated quaternion
+ */
+void
+slerp (
+   const Quaternion & q0,
+   const Quaternion & q1,
+   double frac,
+   Quaternion & result)
+{
+   double sign = 1.0;
+   double cos_arc = q0.scalar * q1.scalar + Vector3::dot (q0.vector, q1.vector);
+   if (cos_arc < 0.0) {
+      sign = -1.0;
+      cos_arc = -cos_arc;
+   }
+
+   // The vector part of conj(q0)*q1 has magnitude sin(arc).
+   double cross[3];
+   double rel_vec[3];
+   Vector3::cross (q1.vector, q0.vector, cross);
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      rel_vec[ii] = q0.scalar * q1.vector[ii] - q1.scalar * q0.vector[ii]
+                  + cross[ii];
+   }
+   double sin_arc = Vector3::vmag (rel_vec);
+
+   double w0;
+   double w1;
+   if (sin_arc < 1.0e-12) {
+      w0 = 1.0 - frac;
+      w1 = frac;
+   }
+   else {
+      double arc = std::atan2 (sin_arc, cos_arc);
+      w0 = std::sin ((1.0 - frac) * arc) / sin_arc;
+      w1 = std::sin (frac * arc) / sin_arc;
+   }
+   w1 *= sign;
+
+   result.scalar = w0 * q0.scalar + w1 * q1.scalar;
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      result.vector[ii] = w0 * q0.vector[ii] + w1 * q1.vector[ii];
+   }
+   result.normalize ();
+}
+
+
+/**
+ * Rotation angle between two unit quaternions.
+ * @return Angle\n Units: rad
+ * \param[in] q0 First quaternion
+ * \param[in] q1 Second quaternion
+ */
+double
+rotation_angle (
+   const Quaternion & q0,
+   const Quaternion & q1)
+{
+   double cos_arc = std::fabs (
+      q0.scalar * q1.scalar + Vector3::dot (q0.vector, q1.vector));
+   double cross[3];
+   double rel_vec[3];
+   Vector3::cross (q1.vector, q0.vector, cross);
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      rel_vec[ii] = q0.scalar * q1.vector[ii] - q1.scalar * q0.vector[ii]
+                  + cross[ii];
+   }
+   return 2.0 * std::atan2 (Vector3::vmag (rel_vec), cos_arc);
+}
+
+}
+
+
 /**
  * Default constructor; constructs a PlanetRNP object.
  */
@@ -77,7 +175,15 @@ PlanetRNP::PlanetRNP (
    polar_motion(nullptr),
    rotation(nullptr),
    rnp_type(FullRNP),
-   enable_polar(true)
+   enable_polar(true),
+   np_update_interval(0.0),
+   interpolate_np(false),
+   np_interpolation_tolerance(0.0),
+   np_interpolation_error(0.0),
+   np_update_time(0.0),
+   np_updated(false),
+   np_time_scale(0.0),
+   np_knot_interval(0.0)
 {
    Matrix3x3::initialize (NP_matrix);
 }
@@ -102,11 +208,64 @@ void
 PlanetRNP::update_rnp (
    void)
 {
+   update_rnp_models (true);
+
+   return;
+}
+
+void
+PlanetRNP::update_rnp (
+   double dyn_time)
+{
+   // NP changes slowly compared with the axial rotation, so it need only be
+   // refreshed on its own, coarser schedule. Time jumps in either direction
+   // (e.g., checkpoint restarts) force a refresh.
+   bool refresh_np = (! np_updated) ||
+                     (np_update_interval <= 0.0) ||
+                     (std::fabs (dyn_time - np_update_time) >=
+                      np_update_interval);
+
+   // Interpolated NP: Build new knots when the time leaves the current knot
+   // interval, and interpolate within it. The models are left evaluated at
+   // the time the knots were built, as they are when NP is held.
+   if (interpolate_np && (rnp_type == FullRNP) &&
+       (np_update_interval > 0.0) && (np_time_scale > 0.0) &&
+       (nutation != nullptr) && (precession != nullptr)) {
+      double frac = np_updated ?
+                    (dyn_time - np_update_time) / np_knot_interval : -1.0;
+      if ((frac < 0.0) || (frac > 1.0)) {
+         build_np_knots (dyn_time);
+      }
+      else {
+         Quaternion np_quat;
+         slerp (np_knot_quat[0], np_knot_quat[1], frac, np_quat);
+         np_quat.left_quat_to_transformation (NP_matrix);
+      }
+      update_rnp_models (false);
+
+      return;
+   }
+
+   if (refresh_np && (rnp_type == FullRNP)) {
+      np_update_time = dyn_time;
+      np_updated     = true;
+   }
+
+   update_rnp_models (refresh_np);
+
+   return;
+}
+
+void
+PlanetRNP::update_rnp_models (
+   bool refresh_np)
+{
+   JEOD_PROFILE_SCOPE ("rnp", "PlanetRNP::update_rnp_models");
 
 
    // Update the nutation and precession, checking both that they are
    // required and that they exist
-   if (rnp_type == FullRNP) {
+   if ((rnp_type == FullRNP) && refresh_np) {
       if (nutation == nullptr) {
          MessageHandler::fail (
             __FILE__, __LINE__, RNPMessages::fidelity_error,
@@ -166,6 +325,90 @@ PlanetRNP::update_rnp (
    return;
 }
 
+/**
+ * Evaluate NP at the knots of a new interpolation interval starting at the
+ * given dynamic time, leaving the nutation and precession models and
+ * NP_matrix evaluated at that time. If a tolerance is set, NP is also
+ * evaluated at the midpoint and the knot spacing is halved until the
+ * interpolation error there is within the tolerance; the spacing is
+ * allowed to grow back toward np_update_interval when the error is well
+ * within it.
+ * \param[in] dyn_time Dynamic time of the first knot\n Units: s
+ */
+void
+PlanetRNP::build_np_knots (
+   double dyn_time)
+{
+   double nutation_time = nutation->current_time;
+   double precession_time = precession->current_time;
+
+   if ((np_knot_interval <= 0.0) ||
+       (np_knot_interval > np_update_interval) ||
+       (np_interpolation_tolerance <= 0.0)) {
+      np_knot_interval = np_update_interval;
+   }
+   else if (np_interpolation_error < 0.25 * np_interpolation_tolerance) {
+      np_knot_interval = std::min (2.0 * np_knot_interval, np_update_interval);
+   }
+
+   np_interpolation_error = 0.0;
+   for (unsigned int halvings = 0; ; ++halvings) {
+      double delta = np_knot_interval * np_time_scale;
+      compute_np (nutation_time + delta, precession_time + delta,
+                  np_knot_quat[1]);
+
+      if (np_interpolation_tolerance <= 0.0) {
+         break;
+      }
+
+      Quaternion mid_quat;
+      Quaternion interp_quat;
+      compute_np (nutation_time + 0.5 * delta, precession_time + 0.5 * delta,
+                  mid_quat);
+      compute_np (nutation_time, precession_time, np_knot_quat[0]);
+      slerp (np_knot_quat[0], np_knot_quat[1], 0.5, interp_quat);
+      np_interpolation_error = rotation_angle (mid_quat, interp_quat);
+
+      if ((np_interpolation_error <= np_interpolation_tolerance) ||
+          (halvings == max_knot_halvings)) {
+         break;
+      }
+      np_knot_interval *= 0.5;
+   }
+
+   // Finish with the models at the first knot.
+   compute_np (nutation_time, precession_time, np_knot_quat[0]);
+
+   np_update_time = dyn_time;
+   np_updated     = true;
+}
+
+
+/**
+ * Evaluate the nutation and precession models and NP_matrix at the given
+ * model times.
+ * \param[in] nutation_time Nutation model time
+ * \param[in] precession_time Precession model time
+ * \param[out] np_quat NP as a left quaternion
+ */
+void
+PlanetRNP::compute_np (
+   double nutation_time,
+   double precession_time,
+   Quaternion & np_quat)
+{
+   nutation->update_time (nutation_time);
+   nutation->update_rotation();
+   precession->update_time (precession_time);
+   precession->update_rotation();
+   Matrix3x3::product_transpose_transpose (
+      nutation->rotation,
+      precession->rotation,
+      NP_matrix);
+   np_quat.left_quat_from_transformation (NP_matrix);
+}
+
+
 /**
  * Same as update_rnp, but only the axial_rotation will be updated
  */
@@ -189,8 +189,90 @@ public: // public data members
     */
    double equa_of_equi; //!< trick_units(--)
 
+   /**
+    * Evaluate the series with the angle-addition kernel, which builds the
+    * trigonometric functions of each term from tables of multiples of the
+    * fundamental arguments rather than calling sin and cos per term.
+    * Ignored if the multipliers are not small integers.
+    */
+   bool use_recurrence_kernel; //!< trick_units(--)
+
+   /**
+    * Spacing of the nodes at which the series is evaluated when
+    * interpolating. Zero (the default) evaluates the series at every
+    * update; typical values are one to ten minutes.
+    */
+   double interpolation_interval; //!< trick_units(s)
+
+   /**
+    * Largest allowed difference between an interpolated nutation angle
+    * and the full series before a warning is issued.
+    */
+   double interpolation_tolerance; //!< trick_units(rad)
+
+   /**
+    * Largest difference between an interpolated nutation angle and the
+    * full series seen so far. The check is made at the midpoint of each
+    * newly entered interpolation interval.
+    */
+   double interpolation_error; //!< trick_units(rad)
+
 private: // private data members
 
+   /**
+    * Number of fundamental arguments in each term
+    */
+   static const unsigned int num_args = 5;
+
+   /**
+    * Largest absolute multiplier of a fundamental argument; zero if the
+    * multipliers are not all small integers.
+    */
+   unsigned int max_multiplier; //!< trick_io(**)
+
+   /**
+    * Per term, per argument, indices into the multiple angle tables
+    */
+   unsigned int* multiple_index; //!< trick_io(**)
+
+   /**
+    * Cosines of the multiples -max_multiplier to max_multiplier of each
+    * fundamental argument
+    */
+   double* multiple_cos; //!< trick_io(**)
+
+   /**
+    * Sines of the multiples -max_multiplier to max_multiplier of each
+    * fundamental argument
+    */
+   double* multiple_sin; //!< trick_io(**)
+
+   /**
+    * Interpolation interval, in Julian centuries, the nodes were built for
+    */
+   double node_spacing; //!< trick_io(**)
+
+   /**
+    * Index of the node at the start of the current interpolation interval
+    */
+   double node_base; //!< trick_io(**)
+
+   /**
+    * Unscaled series sums for the longitude at nodes base-1 to base+2
+    */
+   double node_long[4]; //!< trick_io(**)
+
+   /**
+    * Unscaled series sums for the obliquity at nodes base-1 to base+2
+    */
+   double node_obliq[4]; //!< trick_io(**)
+
+   /**
+    * Whether the interpolation tolerance warning has been issued
+    */
+   bool interpolation_warned; //!< trick_io(**)
+
+
 public: // public member functions
 
    NutationJ2000 ();
@@ -210,6 +292,27 @@ public: // public member functions
 
 private: // private member functions
 
+   // Compute the fundamental arguments, in degrees, at the given time.
+   static void fundamental_arguments (double time, double args[5]);
+
+   // Sum the unscaled nutation series at the given time.
+   void evaluate_series (
+      double time, double & long_sum, double & obliq_sum);
+
+   // Sum the series with one sin and cos per term.
+   void sum_series_direct (
+      double time, const double args[5],
+      double & long_sum, double & obliq_sum);
+
+   // Sum the series with angle-addition recurrences.
+   void sum_series_recurrence (
+      double time, const double args[5],
+      double & long_sum, double & obliq_sum);
+
+   // Interpolate the unscaled series sums between cached nodes.
+   void interpolate_series (
+      double time, double & long_sum, double & obliq_sum);
+
    // lock away the copy constructor and operator = by making them private
 
    NutationJ2000& operator = (const NutationJ2000& rhs);
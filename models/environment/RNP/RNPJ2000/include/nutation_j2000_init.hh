@@ -76,6 +76,7 @@ Library dependencies:
 #define NUTATION_J2000_INIT_HH
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "environment/RNP/GenericRNP/include/planet_rotation_init.hh"
@@ -145,6 +146,13 @@ public: // public data members
     */
    double* obliq_t_coeffs; //!< trick_units(--)
 
+   /**
+    * Data module (see DataModuleLoader) that supplies the coefficients in
+    * place of the compiled-in default data, e.g. "nutation_j2000". Ignored
+    * when the coefficients have already been provided.
+    */
+   std::string data_module; //!< trick_units(--)
+
 public: // public member functions
 
    NutationJ2000Init ();
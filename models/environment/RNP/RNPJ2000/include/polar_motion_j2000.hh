@@ -65,7 +65,8 @@ Assumptions and limitations:
     orthonormal.))
 
 Library dependencies:
-  ((../src/polar_motion_j2000.cc))
+  ((../src/polar_motion_j2000.cc)
+   (environment/time/src/eop_table_file.cc))
 
  
 
@@ -77,6 +78,7 @@ Library dependencies:
 
 // JEOD includes
 #include "environment/RNP/GenericRNP/include/planet_rotation.hh"
+#include "environment/time/include/eop_table_file.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 
@@ -130,6 +132,16 @@ public: // public data members
 
 private: // private data members
 
+   /**
+    * Interval of the tables found by the last lookup
+    */
+   unsigned int table_cursor; //!< trick_io(**)
+
+   /**
+    * Mapping of the initializer's data_file, if any
+    */
+   EOPTableFile table_file; //!< trick_io(**)
+
 public: // public member functions
 
    PolarMotionJ2000 ();
@@ -75,6 +75,7 @@ Library dependencies:
 
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "environment/RNP/GenericRNP/include/planet_rotation_init.hh"
@@ -124,6 +125,17 @@ public: // public data members
     * Size - 1 of xp_tbl, yp_tbl and polar_mjd (last index)
     */
    unsigned int last_table_index; //!< trick_units(count)
+   /**
+    * Binary table file (see EOPTableFile) to map in place of the tables
+    * above. Empty (the default) uses the tables.
+    */
+   std::string data_file; //!< trick_units(--)
+   /**
+    * Data module (see DataModuleLoader) that supplies the tables in place
+    * of the compiled-in default data, e.g. "xpyp_daily". Ignored when
+    * data_file is set or when the tables have already been provided.
+    */
+   std::string data_module; //!< trick_units(--)
 
 public: // public member functions
 
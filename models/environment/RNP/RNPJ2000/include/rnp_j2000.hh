@@ -78,6 +78,7 @@ Library dependencies:
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
 #include "environment/RNP/GenericRNP/include/planet_rnp.hh"
+#include "utils/integration/include/timestamp_cache.hh"
 
 // Model includes
 #include "nutation_j2000.hh"
@@ -188,34 +189,17 @@ private: // private member functions
    TimeDyn* time_dyn_ptr; //!< trick_units(--)
 
    /**
-    * The last update time, when updated through update_rnp,
-    * for the RNP, referencing TimeDyn.seconds .
-    * If the time from time_dyn_ptr is the same as this update time, then
-    * the RNP will not be updated. This is to prevent unnecessary
-    * updating.
+    * Time of the last full update, through update_rnp, referencing
+    * TimeDyn.seconds. The RNP is not updated again at the same time.
     */
-   double last_updated_time_full; //!< trick_units(s)
+   TimestampCache full_update_cache; //!< trick_units(--)
 
    /**
-    * Indicates that last_updated_time_full has never been populated, and
-    * that the update must be done regardless of given time.
+    * Time of the last rotational update, through update_rnp or
+    * update_axial_rotation, referencing TimeDyn.seconds. The R component
+    * of the RNP is not updated again at the same time.
     */
-   bool never_updated_full; //!< trick_units(--)
-
-   /**
-    * The last update time, when updated through update_axial_rotation,
-    * referencing TimeDyn.seconds .
-    * If the time from time_dyn_ptr is the same as this update time, then
-    * the R component of RNP will not be updated. This is to prevent
-    * unnecessary updating.
-    */
-   double last_updated_time_rotational; //!< trick_units(s)
-
-   /**
-    * Indicates that last_updated_time_rotational has never been
-    * populated, and that the update must be done regardless of given time.
-    */
-   bool never_updated_rotational; //!< trick_units(--)
+   TimestampCache rotational_update_cache; //!< trick_units(--)
 
    // operator = and copy constructor locked from use because they are private
    RNPJ2000& operator = (const RNPJ2000& rhs);
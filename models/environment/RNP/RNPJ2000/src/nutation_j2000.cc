@@ -36,13 +36,15 @@ Library dependencies:
    (environment/RNP/GenericRNP/src/planet_rotation.cc)
    (environment/RNP/GenericRNP/src/planet_rotation_init.cc)
    (utils/sim_interface/src/memory_interface.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/data_module_loader.cc))
 
  
 
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cstddef>
 #include <cmath>
 
@@ -51,6 +53,7 @@ Library dependencies:
 #include "utils/math/include/matrix3x3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/data_module_loader.hh"
 
 // Model includes
 #include "../include/nutation_j2000.hh"
@@ -84,8 +87,24 @@ NutationJ2000::NutationJ2000 (
    D(0.0),
    omega(0.0),
    epsilon_bar(0.0),
-   equa_of_equi(0.0)
+   equa_of_equi(0.0),
+   use_recurrence_kernel(false),
+   interpolation_interval(0.0),
+   interpolation_tolerance(1.0e-9),
+   interpolation_error(0.0),
+   max_multiplier(0),
+   multiple_index(nullptr),
+   multiple_cos(nullptr),
+   multiple_sin(nullptr),
+   node_spacing(0.0),
+   node_base(0.0),
+   interpolation_warned(false)
 {
+   for (unsigned int ii = 0; ii < 4; ++ii) {
+      node_long[ii]  = 0.0;
+      node_obliq[ii] = 0.0;
+   }
+
 
    // empty for now
 }
@@ -134,6 +153,263 @@ NutationJ2000::~NutationJ2000 (
       obliq_t_coeffs = nullptr;
    }
 
+   if (multiple_index != nullptr && JEOD_IS_ALLOCATED(multiple_index)) {
+      JEOD_DELETE_ARRAY (multiple_index);
+      multiple_index = nullptr;
+   }
+   if (multiple_cos != nullptr && JEOD_IS_ALLOCATED(multiple_cos)) {
+      JEOD_DELETE_ARRAY (multiple_cos);
+      multiple_cos = nullptr;
+   }
+   if (multiple_sin != nullptr && JEOD_IS_ALLOCATED(multiple_sin)) {
+      JEOD_DELETE_ARRAY (multiple_sin);
+      multiple_sin = nullptr;
+   }
+
+}
+
+/**
+ * Compute the fundamental arguments of the nutation series
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[out] args L, M, F, D, and omega, in degrees
+ */
+void
+NutationJ2000::fundamental_arguments (
+   double time,
+   double args[5])
+{
+   // time2 is the square of the time, time3 is the cube
+   double time2 = time * time;
+   double time3 = time2 * time;
+
+   args[0] = 134.9629813888889 +
+             477198.8673980555 * time +
+             0.008697222222222223 * time2 +
+             0.00001777777777777778 * time3;
+
+   args[1] = 357.5277233333333 +
+             35999.05034 * time -
+             0.00016027777777777778 * time2 -
+             0.000003333333333333333 * time3;
+
+   args[2] = 93.27191027777778 +
+             483202.0175380555 * time -
+             0.0036825 * time2 +
+             0.000003055555555555555 * time3;
+
+   args[3] = 297.8503630555556 +
+             445267.11148 * time -
+             0.001914166666666667 * time2 +
+             0.0000052777777777777778 * time3;
+
+   args[4] = 125.0445222222222 -
+             1934.136260833333 * time +
+             0.00207083333333333 * time2 +
+             0.000002222222222222222 * time3;
+}
+
+/**
+ * Sum the nutation series, one sin and cos per term
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[in] args Fundamental arguments at time, degrees
+ * \param[out] long_sum Nutation in longitude, 10^-4 arcseconds
+ * \param[out] obliq_sum Nutation in obliquity, 10^-4 arcseconds
+ */
+void
+NutationJ2000::sum_series_direct (
+   double time,
+   const double args[5],
+   double & long_sum,
+   double & obliq_sum)
+{
+   long_sum = 0.0;
+   obliq_sum = 0.0;
+   for (unsigned int i = 0; i < num_coeffs; ++i) {
+
+      double api = L_coeffs[i] * args[0] +
+                   M_coeffs[i] * args[1] +
+                   F_coeffs[i] * args[2] +
+                   D_coeffs[i] * args[3] +
+                   omega_coeffs[i] * args[4];
+      api *= DEGTORAD;
+
+      long_sum +=
+         ((long_coeffs[i] + long_t_coeffs[i] * time)) *
+         sin (api);
+
+      obliq_sum +=
+         ((obliq_coeffs[i] + obliq_t_coeffs[i] * time)) *
+         cos (api);
+
+   } // for(unsigned int i = 0)
+}
+
+/**
+ * Sum the nutation series using angle-addition recurrences. The sines and
+ * cosines of the multiples of each fundamental argument are tabulated once
+ * per call, after which each term needs only the products of its five
+ * table entries. The term loop has no branches or library calls so that it
+ * can be vectorized.
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[in] args Fundamental arguments at time, degrees
+ * \param[out] long_sum Nutation in longitude, 10^-4 arcseconds
+ * \param[out] obliq_sum Nutation in obliquity, 10^-4 arcseconds
+ */
+void
+NutationJ2000::sum_series_recurrence (
+   double time,
+   const double args[5],
+   double & long_sum,
+   double & obliq_sum)
+{
+   unsigned int kmax  = max_multiplier;
+   unsigned int width = 2 * kmax + 1;
+
+   // Tabulate cos(k*a) and sin(k*a) for k = -kmax to kmax.
+   for (unsigned int jj = 0; jj < num_args; ++jj) {
+      double angle = std::fmod (args[jj], 360.0) * DEGTORAD;
+      double c1 = cos (angle);
+      double s1 = sin (angle);
+      double * cos_row = multiple_cos + jj * width + kmax;
+      double * sin_row = multiple_sin + jj * width + kmax;
+
+      cos_row[0] = 1.0;
+      sin_row[0] = 0.0;
+      for (unsigned int kk = 1; kk <= kmax; ++kk) {
+         cos_row[kk] = cos_row[kk-1] * c1 - sin_row[kk-1] * s1;
+         sin_row[kk] = sin_row[kk-1] * c1 + cos_row[kk-1] * s1;
+         cos_row[-static_cast<int>(kk)] =  cos_row[kk];
+         sin_row[-static_cast<int>(kk)] = -sin_row[kk];
+      }
+   }
+
+   double lsum = 0.0;
+   double osum = 0.0;
+   for (unsigned int i = 0; i < num_coeffs; ++i) {
+      const unsigned int * idx = multiple_index + i * num_args;
+      double c = multiple_cos[idx[0]];
+      double s = multiple_sin[idx[0]];
+      for (unsigned int jj = 1; jj < num_args; ++jj) {
+         double cj = multiple_cos[idx[jj]];
+         double sj = multiple_sin[idx[jj]];
+         double ct = c * cj - s * sj;
+         s = s * cj + c * sj;
+         c = ct;
+      }
+      lsum += (long_coeffs[i] + long_t_coeffs[i] * time) * s;
+      osum += (obliq_coeffs[i] + obliq_t_coeffs[i] * time) * c;
+   }
+
+   long_sum = lsum;
+   obliq_sum = osum;
+}
+
+/**
+ * Sum the nutation series at the given time with the selected kernel
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[out] long_sum Nutation in longitude, 10^-4 arcseconds
+ * \param[out] obliq_sum Nutation in obliquity, 10^-4 arcseconds
+ */
+void
+NutationJ2000::evaluate_series (
+   double time,
+   double & long_sum,
+   double & obliq_sum)
+{
+   double args[5];
+   fundamental_arguments (time, args);
+
+   if (use_recurrence_kernel && (max_multiplier > 0)) {
+      sum_series_recurrence (time, args, long_sum, obliq_sum);
+   }
+   else {
+      sum_series_direct (time, args, long_sum, obliq_sum);
+   }
+}
+
+/**
+ * Interpolate the nutation series sums with a cubic through the four
+ * nodes bracketing the current interval. Nodes are evaluated only when
+ * time moves into a new interval; moving to an adjacent interval costs one
+ * new node. Each new interval is checked at its midpoint against the full
+ * series and the worst difference recorded in interpolation_error.
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[out] long_sum Nutation in longitude, 10^-4 arcseconds
+ * \param[out] obliq_sum Nutation in obliquity, 10^-4 arcseconds
+ */
+void
+NutationJ2000::interpolate_series (
+   double time,
+   double & long_sum,
+   double & obliq_sum)
+{
+   double spacing = interpolation_interval / (86400.0 * 36525.0);
+   double base    = std::floor (time / spacing);
+   bool new_interval = true;
+
+   if ((spacing == node_spacing) && (base == node_base)) {
+      new_interval = false;
+   }
+   else if ((spacing == node_spacing) && (base == node_base + 1.0)) {
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         node_long[ii]  = node_long[ii+1];
+         node_obliq[ii] = node_obliq[ii+1];
+      }
+      evaluate_series ((base + 2.0) * spacing, node_long[3], node_obliq[3]);
+   }
+   else if ((spacing == node_spacing) && (base == node_base - 1.0)) {
+      for (unsigned int ii = 3; ii > 0; --ii) {
+         node_long[ii]  = node_long[ii-1];
+         node_obliq[ii] = node_obliq[ii-1];
+      }
+      evaluate_series ((base - 1.0) * spacing, node_long[0], node_obliq[0]);
+   }
+   else {
+      for (unsigned int ii = 0; ii < 4; ++ii) {
+         evaluate_series ((base - 1.0 + ii) * spacing,
+                          node_long[ii], node_obliq[ii]);
+      }
+   }
+   node_spacing = spacing;
+   node_base    = base;
+
+   // Cubic Lagrange weights for nodes at -1, 0, 1, 2; u is in [0, 1).
+   double weights[4];
+   double check_long = 0.0;
+   double check_obliq = 0.0;
+   for (unsigned int pass = new_interval ? 0 : 1; pass < 2; ++pass) {
+      double u = (pass == 0) ? 0.5 : (time / spacing - base);
+      weights[0] = -u * (u - 1.0) * (u - 2.0) / 6.0;
+      weights[1] = (u + 1.0) * (u - 1.0) * (u - 2.0) / 2.0;
+      weights[2] = -(u + 1.0) * u * (u - 2.0) / 2.0;
+      weights[3] = (u + 1.0) * u * (u - 1.0) / 6.0;
+
+      long_sum = 0.0;
+      obliq_sum = 0.0;
+      for (unsigned int ii = 0; ii < 4; ++ii) {
+         long_sum  += weights[ii] * node_long[ii];
+         obliq_sum += weights[ii] * node_obliq[ii];
+      }
+
+      if (pass == 0) {
+         evaluate_series ((base + 0.5) * spacing, check_long, check_obliq);
+         double scale = DEGTORAD / (10000.0 * 3600.0);
+         double error = std::max (std::fabs (long_sum - check_long),
+                                  std::fabs (obliq_sum - check_obliq)) * scale;
+         if (error > interpolation_error) {
+            interpolation_error = error;
+         }
+         if ((error > interpolation_tolerance) && (! interpolation_warned)) {
+            MessageHandler::warn (
+               __FILE__, __LINE__, RNPMessages::interpolation_warning,
+               "Interpolated nutation differs from the full series by "
+               "%g rad, more than the tolerance of %g rad; consider a "
+               "smaller interpolation_interval",
+               error, interpolation_tolerance);
+            interpolation_warned = true;
+         }
+      }
+   }
 }
 
 /**
@@ -157,53 +433,25 @@ NutationJ2000::update_rotation (
    time3 = time2 * time;
 
    // the fundamental arguments are in degrees
-
-   L = 134.9629813888889 +
-       477198.8673980555 * time +
-       0.008697222222222223 * time2 +
-       0.00001777777777777778 * time3;
-
-   M = 357.5277233333333 +
-       35999.05034 * time -
-       0.00016027777777777778 * time2 -
-       0.000003333333333333333 * time3;
-
-   F = 93.27191027777778 +
-       483202.0175380555 * time -
-       0.0036825 * time2 +
-       0.000003055555555555555 * time3;
-
-   D = 297.8503630555556 +
-       445267.11148 * time -
-       0.001914166666666667 * time2 +
-       0.0000052777777777777778 * time3;
-
-   omega = 125.0445222222222 -
-           1934.136260833333 * time +
-           0.00207083333333333 * time2 +
-           0.000002222222222222222 * time3;
-
-
-   nutation_in_longitude = 0.0;
-   nutation_in_obliquity = 0.0;
-   for (unsigned int i = 0; i < num_coeffs; ++i) {
-
-      double api = L_coeffs[i] * L +
-                   M_coeffs[i] * M +
-                   F_coeffs[i] * F +
-                   D_coeffs[i] * D +
-                   omega_coeffs[i] * omega;
-      api *= DEGTORAD;
-
-      nutation_in_longitude +=
-         ((long_coeffs[i] + long_t_coeffs[i] * time)) *
-         sin (api);
-
-      nutation_in_obliquity +=
-         ((obliq_coeffs[i] + obliq_t_coeffs[i] * time)) *
-         cos (api);
-
-   } // for(unsigned int i = 0)
+   double args[5];
+   fundamental_arguments (time, args);
+   L     = args[0];
+   M     = args[1];
+   F     = args[2];
+   D     = args[3];
+   omega = args[4];
+
+   if (interpolation_interval > 0.0) {
+      interpolate_series (time, nutation_in_longitude, nutation_in_obliquity);
+   }
+   else if (use_recurrence_kernel && (max_multiplier > 0)) {
+      sum_series_recurrence (
+         time, args, nutation_in_longitude, nutation_in_obliquity);
+   }
+   else {
+      sum_series_direct (
+         time, args, nutation_in_longitude, nutation_in_obliquity);
+   }
 
    // note that the numbers here have been converted from arcseconds to degrees
 
@@ -280,6 +528,11 @@ NutationJ2000::initialize (
       return;
    }
 
+   if ((! nut_init->data_module.empty()) && (nut_init->L_coeffs == nullptr)) {
+      DataModuleLoader::initialize (
+         nut_init->data_module, "NutationJ2000Init", nut_init);
+   }
+
    num_coeffs = nut_init->num_coeffs;
 
    L_coeffs     = JEOD_ALLOC_PRIM_ARRAY (num_coeffs, double);
@@ -308,6 +561,43 @@ NutationJ2000::initialize (
 
    }
 
+   // The recurrence kernel needs the argument multipliers to be small
+   // integers, as they are in the IAU 1980 series.
+   const double * multipliers[num_args] =
+      {L_coeffs, M_coeffs, F_coeffs, D_coeffs, omega_coeffs};
+   unsigned int kmax = 0;
+   bool integral = (num_coeffs > 0);
+   for (unsigned int ii = 0; integral && (ii < num_coeffs); ++ii) {
+      for (unsigned int jj = 0; jj < num_args; ++jj) {
+         double value = multipliers[jj][ii];
+         if ((value != std::floor (value)) || (std::fabs (value) > 64.0)) {
+            integral = false;
+            break;
+         }
+         kmax = std::max (kmax, static_cast<unsigned int> (std::fabs (value)));
+      }
+   }
+
+   if (integral) {
+      unsigned int width = 2 * kmax + 1;
+      max_multiplier = kmax;
+      multiple_index = JEOD_ALLOC_PRIM_ARRAY (num_coeffs * num_args,
+                                              unsigned int);
+      multiple_cos   = JEOD_ALLOC_PRIM_ARRAY (num_args * width, double);
+      multiple_sin   = JEOD_ALLOC_PRIM_ARRAY (num_args * width, double);
+      for (unsigned int ii = 0; ii < num_coeffs; ++ii) {
+         for (unsigned int jj = 0; jj < num_args; ++jj) {
+            multiple_index[ii * num_args + jj] =
+               jj * width + static_cast<unsigned int> (
+                  static_cast<int> (multipliers[jj][ii]) +
+                  static_cast<int> (kmax));
+         }
+      }
+   }
+   else {
+      max_multiplier = 0;
+   }
+
 
    return;
 }
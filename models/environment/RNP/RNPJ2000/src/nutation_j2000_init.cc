@@ -65,7 +65,8 @@ NutationJ2000Init::NutationJ2000Init (
    long_coeffs(nullptr),
    long_t_coeffs(nullptr),
    obliq_coeffs(nullptr),
-   obliq_t_coeffs(nullptr)
+   obliq_t_coeffs(nullptr),
+   data_module()
 {
 // empty for now
 }
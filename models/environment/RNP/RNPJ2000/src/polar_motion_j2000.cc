@@ -35,8 +35,10 @@ Library dependencies:
    (environment/RNP/GenericRNP/src/RNP_messages.cc)
    (environment/RNP/GenericRNP/src/planet_rotation.cc)
    (environment/RNP/GenericRNP/src/planet_rotation_init.cc)
+   (environment/time/src/eop_table_file.cc)
    (utils/sim_interface/src/memory_interface.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/data_module_loader.cc))
 
  
 *******************************************************************************/
@@ -46,8 +48,10 @@ Library dependencies:
 
 // JEOD includes
 #include "environment/RNP/GenericRNP/include/RNP_messages.hh"
+#include "utils/math/include/sorted_table.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/data_module_loader.hh"
 
 // Model includes
 #include "../include/polar_motion_j2000.hh"
@@ -70,7 +74,8 @@ PolarMotionJ2000::PolarMotionJ2000 (
    polar_mjd(nullptr),
    override_table(false),
    last_table_index(0),
-   warn_table(false)
+   warn_table(false),
+   table_cursor(0)
 {
 // empty for now
 }
@@ -145,12 +150,10 @@ PolarMotionJ2000::update_rotation (
 
       else { // need to interpolate xp and yp out of the tables
          warn_table = false;
-         for (unsigned int i = 0; i < last_table_index; ++i) {
-            if (time < polar_mjd[i + 1]) {
-               index_in_table = i;
-               break;
-            } // if(time < polar_mjd)
-         } // for(unsigned int i = 0)
+         index_in_table = SortedTable::find_interval (
+                             polar_mjd, last_table_index + 1, time,
+                             table_cursor);
+         table_cursor = index_in_table;
 
          xp = xp_tbl[index_in_table] +
               (xp_tbl[index_in_table + 1] - xp_tbl[index_in_table]) *
@@ -221,11 +224,31 @@ PolarMotionJ2000::initialize (
       return;
    }
 
+   if ((! pm_init->data_module.empty()) && (pm_init->polar_mjd == nullptr) &&
+       pm_init->data_file.empty()) {
+      DataModuleLoader::initialize (
+         pm_init->data_module, "PolarMotionJ2000Init", pm_init);
+   }
+
    override_table   = pm_init->override_table;
    last_table_index = pm_init->last_table_index;
    xp               = pm_init->xp;
    yp               = pm_init->yp;
 
+   // Use the tables in place in a mapped file; pages are read only as the
+   // lookups reach them.
+   if (! pm_init->data_file.empty()) {
+      table_file.open (pm_init->data_file, "polar_motion");
+      if (table_file.is_open()) {
+         polar_mjd = const_cast<double *> (table_file.column ("mjd"));
+         xp_tbl    = const_cast<double *> (table_file.column ("xp"));
+         yp_tbl    = const_cast<double *> (table_file.column ("yp"));
+         last_table_index = table_file.num_rows() - 1;
+         table_cursor     = 0;
+      }
+      return;
+   }
+
    // need to allocate last table index + 1, which will
    // be the size
    xp_tbl    = JEOD_ALLOC_PRIM_ARRAY (last_table_index + 1, double);
@@ -60,7 +60,9 @@ PolarMotionJ2000Init::PolarMotionJ2000Init (
    yp_tbl(nullptr),
    polar_mjd(nullptr),
    override_table(false),
-   last_table_index(0)
+   last_table_index(0),
+   data_file(),
+   data_module()
 {
 // empty for now
 }
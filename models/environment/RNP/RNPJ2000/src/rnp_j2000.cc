@@ -39,7 +39,9 @@ Library dependencies:
    (environment/RNP/GenericRNP/src/planet_rnp.cc)
    (environment/time/src/time_tt.cc)
    (environment/time/src/time_ut1.cc)
-   (environment/time/src/time_gmst.cc))
+   (environment/time/src/time_gmst.cc)
+   (utils/integration/src/timestamp_cache.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
  
 
@@ -57,7 +59,7 @@ Library dependencies:
 #include "environment/planet/include/planet.hh"
 #include "utils/math/include/matrix3x3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
-#include "utils/math/include/numerical.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "environment/RNP/GenericRNP/include/RNP_messages.hh"
@@ -75,10 +77,8 @@ RNPJ2000::RNPJ2000 (
    internal_name("RNPJ2000"),
    gmst_ptr(nullptr),
    time_dyn_ptr(nullptr),
-   last_updated_time_full(0.0),
-   never_updated_full(true),
-   last_updated_time_rotational(0.0),
-   never_updated_rotational(true)
+   full_update_cache(),
+   rotational_update_cache()
 {
 
    // Assign pointer for polymorphic functionality.
@@ -87,6 +87,9 @@ RNPJ2000::RNPJ2000 (
    polar_motion = &this->PMJ2000;
    rotation     = &this->RJ2000;
 
+   // Nutation and precession are evaluated in Julian centuries of TT.
+   np_time_scale = 1.0 / (86400.0 * 36525.0);
+
 }
 
 /**
@@ -159,6 +162,7 @@ RNPJ2000::update_rnp (
    TimeGMST& time_gmst,
    const TimeUT1& time_ut1)
 {
+   JEOD_PROFILE_SCOPE ("rnp", "RNPJ2000::update_rnp");
 
    // check if active and get out if not
    if(!active) {
@@ -180,18 +184,14 @@ RNPJ2000::update_rnp (
    // check if it even needs to be updated. If it has been previously
    // updated, and if the time has not been changed, then we don't
    // need to update.
-   if(!never_updated_full &&
-       Numerical::compare_exact(last_updated_time_full,time_dyn_ptr->seconds)) {
+   if(!full_update_cache.needs_update (time_dyn_ptr->seconds)) {
        return;
    }
 
-   // If we are this far, then we are updating! and can set our update flags
+   // If we are this far, then we are updating!
 
    // This is the full RNP update, so it will ALSO get the rotational update.
-   // so set all flags to be correct.
-   never_updated_full = false;
-   never_updated_rotational = false;
-   last_updated_time_full = last_updated_time_rotational = time_dyn_ptr->seconds;
+   rotational_update_cache.stamp (time_dyn_ptr->seconds);
 
    double time = 0.0;
 
@@ -228,7 +228,7 @@ RNPJ2000::update_rnp (
    // update the timestamp of the controlled reference frame.
    planet->pfix.set_timestamp(time_dyn_ptr->seconds);
 
-   PlanetRNP::update_rnp();
+   PlanetRNP::update_rnp(time_dyn_ptr->seconds);
 
    return;
 }
@@ -273,16 +273,11 @@ RNPJ2000::update_axial_rotation (
    // check if it even needs to be updated. If it has been previously
    // updated, and if the time has not been changed, then we don't
    // need to update.
-   if(!never_updated_rotational &&
-       Numerical::compare_exact(last_updated_time_rotational,time_dyn_ptr->seconds)) {
+   if(!rotational_update_cache.needs_update (time_dyn_ptr->seconds)) {
        return;
    }
 
-   // If we are this far, then we are updating! and can set our update flags
-
-   // This is the rotational only update, so only set the rotational parts
-   never_updated_rotational = false;
-   last_updated_time_rotational = time_dyn_ptr->seconds;
+   // If we are this far, then we are updating!
 
    double time = 0.0;
 
@@ -306,7 +301,7 @@ RNPJ2000::update_axial_rotation (
 }
 
 double RNPJ2000::timestamp() const {
-   return last_updated_time_rotational;
+   return rotational_update_cache.get_timestamp();
 }
 
 const char* RNPJ2000::get_name() const {
@@ -365,6 +360,12 @@ void RNPJ2000::get_dyn_time_ptr( // RETURN: -- none.
       return;
    }
 
+   // Recompute after any change in the nature of time.
+   full_update_cache.subscribe (
+      gmst.time_manager->get_jeod_integration_time());
+   rotational_update_cache.subscribe (
+      gmst.time_manager->get_jeod_integration_time());
+
    return;
 
 }
@@ -159,10 +159,45 @@ public:
     */
    double * int_to_double; //!< trick_units(--)
 
+   /**
+    * Evaluate the series with the angle-addition kernel, which builds the
+    * trigonometric functions of each term from the multiples of the mean
+    * anomaly rather than calling sin and cos per term. Ignored unless
+    * compute_recurrence_terms found the multipliers to be small integers.
+    */
+   bool use_recurrence_kernel; //!< trick_units(--)
+
 
    // Private data members
 private:
 
+   /**
+    * Number of terms in the nutation series, including the constant term
+    */
+   static const unsigned int num_terms = 10;
+
+   /**
+    * Largest multiplier of the mean anomaly; zero if the multipliers are not
+    * all small integers.
+    */
+   unsigned int max_multiplier; //!< trick_io(**)
+
+   /**
+    * Per term, the multiple of the mean anomaly in its argument
+    */
+   unsigned int term_multiple[num_terms]; //!< trick_io(**)
+
+   /**
+    * Per term, the cosine of the constant phase (zero or q_angle_j2000)
+    * in its argument
+    */
+   double term_cos_phase[num_terms]; //!< trick_io(**)
+
+   /**
+    * Per term, the sine of the constant phase in its argument
+    */
+   double term_sin_phase[num_terms]; //!< trick_io(**)
+
 
    // Public member functions
 public:
@@ -175,9 +210,19 @@ public:
    // Julian days since standard epoch J2000, per Konopliv references.
    void update_rotation () override;
 
+   // Tabulate the multipliers and the constant trigonometric functions used
+   // by the recurrence kernel, so they don't have to be found repeatedly.
+   void compute_recurrence_terms ();
+
 
    // Private member functions
 private:
+   // Sum the series with one sin and cos per term.
+   void sum_series_direct (double time);
+
+   // Sum the series with angle-addition recurrences.
+   void sum_series_recurrence (double time);
+
    // Lock away the copy constructor and operator = by making them private.
    NutationMars& operator = (const NutationMars& rhs);
    NutationMars (const NutationMars& rhs);
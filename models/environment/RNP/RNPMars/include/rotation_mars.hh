@@ -135,6 +135,24 @@ public:
 // Private data members
 private:
 
+   /**
+    * Nutation in longitude for which nutation_correction was computed
+    */
+   double cached_psi_nut; //!< trick_io(**)
+
+   /**
+    * Obliquity angle for which nutation_correction was computed
+    */
+   double cached_obliquity; //!< trick_io(**)
+
+   /**
+    * Nutation correction to the rotation angle, Psi_nut * cos(obliquity).
+    * It depends only on the nutation, which changes slowly and may be
+    * refreshed less often than the rotation, so it is recomputed only when
+    * the nutation changes.
+    */
+   double nutation_correction; //!< trick_io(**)
+
 
 // Public member functions
 public:
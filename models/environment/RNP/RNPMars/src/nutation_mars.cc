@@ -42,6 +42,7 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cstddef>
 #include <cmath>
 
@@ -74,8 +75,15 @@ NutationMars::NutationMars (
    q_angle_j2000(0.0),
    I_m_orig(nullptr),
    psi_m_orig(nullptr),
-   int_to_double(nullptr)
+   int_to_double(nullptr),
+   use_recurrence_kernel(false),
+   max_multiplier(0)
 {
+   for (unsigned int ii = 0; ii < num_terms; ++ii) {
+      term_multiple[ii]  = 0;
+      term_cos_phase[ii] = 1.0;
+      term_sin_phase[ii] = 0.0;
+   }
 }
 
 
@@ -119,6 +127,50 @@ NutationMars::update_rotation (
    // Psi_nut = sum[m=1..9]{Psi_m * sin(alpha_m*time + theta_m)}
    // I_nut = I_oo + sum[m=1..9]{I_m * cos(alpha_m*time + theta_m)}
 
+   if (use_recurrence_kernel && (max_multiplier > 0)) {
+      sum_series_recurrence (time);
+   }
+   else {
+      sum_series_direct (time);
+   }
+
+
+   // Next, calculate the current obliquity angle, from pg 39 of Konopliv 2006:
+   // I(t) = I_o + I_dot*time + I_nut
+   obliquity_angle = I_at_j2000 + I_dot * time + nutation_in_obliquity;
+
+   // Take trigs of the obliquity angle to build its rotation matrix
+   double cos_I = cos (obliquity_angle);
+   double sin_I = sin (obliquity_angle);
+
+   // Populate the rotation matrix as follows:
+   // celestial frame = rot_x(-I) * mars frame
+   Matrix3x3::initialize (rotation);
+
+   rotation[0][0] = 1.0;
+   rotation[0][1] = 0.0;
+   rotation[0][2] = 0.0;
+
+   rotation[1][0] = 0.0;
+   rotation[1][1] = cos_I;
+   rotation[1][2] = -sin_I;
+
+   rotation[2][0] = 0.0;
+   rotation[2][1] = sin_I;
+   rotation[2][2] = cos_I;
+
+   return;
+}
+
+
+/**
+ * Sum the nutation series, one sin and cos per term
+ * \param[in] time Time since J2000, per update_rotation
+ */
+void
+NutationMars::sum_series_direct (
+   double time)
+{
    // Set up nutation parameters for zeroth step of summation
    nutation_in_longitude = 0.0;
    nutation_in_obliquity = I_m_orig[0];
@@ -143,31 +195,86 @@ NutationMars::update_rotation (
       nutation_in_longitude += psi_m_orig[ii] * sin(alpha_m * time + theta_m);
       nutation_in_obliquity += I_m_orig[ii] * cos(alpha_m * time + theta_m);
    }
+}
 
 
-   // Next, calculate the current obliquity angle, from pg 39 of Konopliv 2006:
-   // I(t) = I_o + I_dot*time + I_nut
-   obliquity_angle = I_at_j2000 + I_dot * time + nutation_in_obliquity;
+/**
+ * Sum the nutation series using angle-addition recurrences. Every argument
+ * is a multiple of the mean anomaly, possibly plus the constant angle q, so
+ * one sin and cos of the mean anomaly yields all of the terms.
+ * \param[in] time Time since J2000, per update_rotation
+ */
+void
+NutationMars::sum_series_recurrence (
+   double time)
+{
+   double multiple_cos[num_terms];
+   double multiple_sin[num_terms];
+
+   // Tabulate cos(k*M) and sin(k*M) for k = 0 to max_multiplier.
+   double mean_anomaly = mean_motion * time + mean_anomaly_j2000;
+   double c1 = cos (mean_anomaly);
+   double s1 = sin (mean_anomaly);
+   multiple_cos[0] = 1.0;
+   multiple_sin[0] = 0.0;
+   for (unsigned int kk = 1; kk <= max_multiplier; ++kk) {
+      multiple_cos[kk] = multiple_cos[kk-1] * c1 - multiple_sin[kk-1] * s1;
+      multiple_sin[kk] = multiple_sin[kk-1] * c1 + multiple_cos[kk-1] * s1;
+   }
 
-   // Take trigs of the obliquity angle to build its rotation matrix
-   double cos_I = cos (obliquity_angle);
-   double sin_I = sin (obliquity_angle);
+   double long_sum = 0.0;
+   double obliq_sum = I_m_orig[0];
+   for (unsigned int ii = 1; ii < num_terms; ++ii) {
+      double cm = multiple_cos[term_multiple[ii]];
+      double sm = multiple_sin[term_multiple[ii]];
+      double c = cm * term_cos_phase[ii] - sm * term_sin_phase[ii];
+      double s = sm * term_cos_phase[ii] + cm * term_sin_phase[ii];
 
-   // Populate the rotation matrix as follows:
-   // celestial frame = rot_x(-I) * mars frame
-   Matrix3x3::initialize (rotation);
+      long_sum  += psi_m_orig[ii] * s;
+      obliq_sum += I_m_orig[ii] * c;
+   }
 
-   rotation[0][0] = 1.0;
-   rotation[0][1] = 0.0;
-   rotation[0][2] = 0.0;
+   nutation_in_longitude = long_sum;
+   nutation_in_obliquity = obliq_sum;
+}
 
-   rotation[1][0] = 0.0;
-   rotation[1][1] = cos_I;
-   rotation[1][2] = -sin_I;
 
-   rotation[2][0] = 0.0;
-   rotation[2][1] = sin_I;
-   rotation[2][2] = cos_I;
+/**
+ * Tabulate the mean anomaly multiple and the constant phase of each term
+ * for the recurrence kernel. The kernel is disabled unless the multipliers
+ * are small non-negative integers, as they are in the Konopliv series.
+ */
+void
+NutationMars::compute_recurrence_terms (
+   void)
+{
+   max_multiplier = 0;
+
+   if ((int_to_double == nullptr) ||
+       (I_m_orig == nullptr) ||
+       (psi_m_orig == nullptr)) {
+      return;
+   }
+
+   double cos_q = cos (q_angle_j2000);
+   double sin_q = sin (q_angle_j2000);
+   unsigned int kmax = 0;
+
+   for (unsigned int ii = 1; ii < num_terms; ++ii) {
+      double multiple = (ii <= 3) ? int_to_double[ii] :
+                                    int_to_double[ii] - 3.0;
+      if ((multiple != std::floor (multiple)) ||
+          (multiple < 0.0) ||
+          (multiple >= static_cast<double> (num_terms))) {
+         return;
+      }
+      term_multiple[ii]  = static_cast<unsigned int> (multiple);
+      term_cos_phase[ii] = (ii <= 3) ? 1.0 : cos_q;
+      term_sin_phase[ii] = (ii <= 3) ? 0.0 : sin_q;
+      kmax = std::max (kmax, term_multiple[ii]);
+   }
+
+   max_multiplier = kmax;
 
    return;
 }
@@ -38,7 +38,9 @@ Library dependencies:
 (environment/RNP/GenericRNP/src/planet_rnp.cc)
 (environment/RNP/GenericRNP/src/RNP_messages.cc)
 (environment/time/src/time_tt.cc)
-(utils/message/src/message_handler.cc))
+(utils/integration/src/timestamp_cache.cc)
+(utils/message/src/message_handler.cc)
+(utils/sim_interface/src/jeod_profiler.cc))
 
  
 *******************************************************************************/
@@ -54,6 +56,7 @@ Library dependencies:
 #include "environment/RNP/GenericRNP/include/RNP_messages.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/rnp_mars.hh"
@@ -71,10 +74,8 @@ RNPMars::RNPMars (
    internal_name("RNPMars"),
    tt_ptr(nullptr),
    time_dyn_ptr(nullptr),
-   last_updated_time_full(0.0),
-   never_updated_full(true),
-   last_updated_time_rotational(0.0),
-   never_updated_rotational(true)
+   full_update_cache(),
+   rotational_update_cache()
 {
 
    // Disable polar motion to reverse default inherited setting; "Pathfinder"
@@ -89,6 +90,9 @@ RNPMars::RNPMars (
    rotation     = &this->RMars;
    polar_motion = nullptr;
 
+   // Nutation and precession are evaluated in seconds of TT.
+   np_time_scale = 1.0;
+
 }
 
 
@@ -125,6 +129,7 @@ RNPMars::initialize (
       RMars.nutation = &NMars;
       PMars.nutation = &NMars;
       PMars.compute_fixed_matrices();
+      NMars.compute_recurrence_terms();
    }
 
    // Call parent-class initializer
@@ -142,6 +147,7 @@ void
 RNPMars::update_rnp (
    TimeTT& time_tt)
 {
+   JEOD_PROFILE_SCOPE ("rnp", "RNPMars::update_rnp");
 
    // Do nothing if model inactive
    if(!active) {
@@ -160,15 +166,12 @@ RNPMars::update_rnp (
 
    // Check if RNP needs update; if it has been previously updated and the
    // timestamp still matches, then it doesn't
-   if(!never_updated_full &&
-         Numerical::compare_exact(last_updated_time_full, time_dyn_ptr->seconds)) {
+   if(!full_update_cache.needs_update (time_dyn_ptr->seconds)) {
       return;
    }
 
    // Proceed with full RNP update, including rotational portion
-   never_updated_full = false;
-   never_updated_rotational = false;
-   last_updated_time_full = last_updated_time_rotational = time_dyn_ptr->seconds;
+   rotational_update_cache.stamp (time_dyn_ptr->seconds);
 
    double time = 0.0;
    time = time_tt.seconds;
@@ -191,7 +194,7 @@ RNPMars::update_rnp (
    planet->pfix.set_timestamp(time_dyn_ptr->seconds);
 
    // Pass the function call to the parent object
-   PlanetRNP::update_rnp();
+   PlanetRNP::update_rnp(time_dyn_ptr->seconds);
 
    return;
 }
@@ -218,14 +221,11 @@ RNPMars::update_axial_rotation (
 
    // Check if RNP needs update; if it has been previously updated and the
    // timestamp still matches, then it doesn't
-   if(!never_updated_rotational &&
-         Numerical::compare_exact(last_updated_time_rotational, time_dyn_ptr->seconds)) {
+   if(!rotational_update_cache.needs_update (time_dyn_ptr->seconds)) {
       return;
    }
 
    // Proceed with rotational RNP update only
-   never_updated_rotational = false;
-   last_updated_time_rotational = time_dyn_ptr->seconds;
 
    double time = 0.0;
    time = time_tt.seconds;
@@ -257,7 +257,7 @@ RNPMars::update_axial_rotation (
  */
 double
 RNPMars::timestamp() const {
-   return last_updated_time_rotational;
+   return rotational_update_cache.get_timestamp();
 }
 
 
@@ -320,6 +320,12 @@ RNPMars::get_dyn_time_ptr(
       return;
    }
 
+   // Recompute after any change in the nature of time
+   full_update_cache.subscribe (
+      time_tt.time_manager->get_jeod_integration_time());
+   rotational_update_cache.subscribe (
+      time_tt.time_manager->get_jeod_integration_time());
+
    return;
 }
 
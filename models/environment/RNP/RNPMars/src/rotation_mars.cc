@@ -65,7 +65,10 @@ RotationMars::RotationMars (
    nutation(nullptr),
    use_full_rnp(true),
    phi_at_j2000(0.0),
-   phi_spin(0.0)
+   phi_spin(0.0),
+   cached_psi_nut(0.0),
+   cached_obliquity(0.0),
+   nutation_correction(0.0)
 {
    // Nothing else to do
 }
@@ -109,10 +112,18 @@ RotationMars::update_rotation (
       double psi_nut = 0.0;
       psi_nut = nutation->nutation_in_longitude;
 
+      // The nutation correction changes only when the nutation is updated.
+      if ((psi_nut != cached_psi_nut) ||
+          (nutation->obliquity_angle != cached_obliquity)) {
+         cached_psi_nut      = psi_nut;
+         cached_obliquity    = nutation->obliquity_angle;
+         nutation_correction = psi_nut * cos(nutation->obliquity_angle);
+      }
+
       // Set up the relevant rotation equation from pg. 41 of Konopliv 2006:
       // Phi(t) = Phi_o + Phi_dot*time - Psi_nut * cos(obliquity angle)
       phi_spin = phi_at_j2000 + planet_rotational_velocity * current_time
-                              - psi_nut * cos(nutation->obliquity_angle);
+                              - nutation_correction;
 
       if (phi_spin < 0.0) {
          phi_spin += 2.0 * M_PI;
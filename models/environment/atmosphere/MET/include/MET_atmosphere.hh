@@ -63,6 +63,7 @@ LIBRARY DEPENDENCIES:
 #define JEOD_MET_ATMOSPHERE_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
@@ -71,11 +72,15 @@ LIBRARY DEPENDENCIES:
 
 // Model includes
 #include "environment/atmosphere/base_atmos/include/atmosphere.hh"
+#include "environment/atmosphere/base_atmos/include/space_weather.hh"
 #include "MET_atmosphere_state_vars.hh"
 
 //! Namespace jeod
 namespace jeod {
 
+// Forward Declaration
+class METAtmosphereOffload;
+
 /*****************************************************************************
 METAtmosphereChemical
 Purpose:(The chemical composition of the MET Atmosphere.)
@@ -160,6 +165,9 @@ private:
                                   reference to the current altitude in km.*/
 
    void generate_base_temperature();
+
+   friend class METAtmosphereOffload;
+
    // operator = and copy constructor locked from use by being private
    METAtmosphereThermal& operator = (const METAtmosphereThermal& rhs);
    METAtmosphereThermal (const METAtmosphereThermal& rhs);
@@ -197,6 +205,34 @@ public: // public member variables
    METAtmosphereChemical species;  /*!< trick_units(--)
       The chemical composition of the atmosphere. */
 
+   bool use_density_table; /*!< trick_units(--)
+      When true, the density, molecular weight and species number densities
+      are interpolated from a table of the Jacchia profile, tabulated against
+      exospheric temperature and altitude, instead of being integrated on
+      every call.  The seasonal-latitude and Helium corrections are applied
+      to the interpolated values as usual.  Conditions outside the table
+      fall back to the full computation.  Default: false. */
+
+   double table_exo_temp_min;  /*!< trick_units(K)
+      Lowest exospheric temperature in the density table. */
+   double table_exo_temp_max;  /*!< trick_units(K)
+      Highest exospheric temperature in the density table. */
+   double table_exo_temp_step; /*!< trick_units(K)
+      Exospheric temperature spacing of the density table. */
+   double table_altitude_max;  /*!< trick_units(km)
+      Highest altitude in the density table; the table starts at 90 km. */
+   double table_altitude_step; /*!< trick_units(km)
+      Altitude spacing of the density table.  Should divide the distances
+      from 90 km to 105, 125 and 500 km so that the breaks in the profile
+      fall on table nodes. */
+
+   METAtmosphereOffload * offload; /*!< trick_units(--)
+      Optional accelerator backend for batched updates.  When set and
+      use_density_table is true, batches of at least
+      offload->min_batch_size positions are evaluated by it; positions it
+      cannot evaluate fall back to the host computation.  The atmosphere
+      does not own the object.  Default: NULL. */
+
 private: // private member variables
 
    double altitude_km;   /*!< trick_units(km) Copy of vehicle altitude */
@@ -227,6 +263,40 @@ private: // private member variables
 
    double solar_hour_angle;        /*!< trick_units(rad) solar hour angle */
 
+   double solar_right_ascension;   /*!< trick_units(rad)
+      right ascension of the Sun */
+
+   double greenwich_mean_position; /*!< trick_units(degree)
+      Greenwich mean position, used with the longitude to obtain the solar
+      hour angle */
+
+   double solar_activity_variation; /*!< trick_units(K)
+      solar-activity term of the exospheric temperature */
+
+   double geomagnetic_variation;   /*!< trick_units(K)
+      geomagnetic term of the exospheric temperature */
+
+   double semiannual_variation;    /*!< trick_units(K)
+      semiannual term of the exospheric temperature */
+
+   bool conditions_valid; /*!< trick_units(--)
+      Whether the global conditions have been computed. */
+
+   double conditions_tjt;  /*!< trick_units(day)
+      Value of trunc_julian_time for which the global conditions (solar
+      angles and the position-independent exospheric temperature terms)
+      were computed.  These are recomputed only when the time or one of the
+      solar and geomagnetic indices changes. */
+
+   double conditions_F10;        /*!< trick_units(--)
+      Value of F10 for which the global conditions were computed. */
+   double conditions_F10B;       /*!< trick_units(--)
+      Value of F10B for which the global conditions were computed. */
+   double conditions_geo_index;  /*!< trick_units(--)
+      Value of geo_index for which the global conditions were computed. */
+   AtmosMETGeoIndexType conditions_geo_index_type; /*!< trick_units(--)
+      Value of geo_index_type for which the global conditions were computed.*/
+
    METAtmosphereStateVars state; /*!< trick_units(--)
       A scratch set of state variables, used for populating state
       variables internally before being copied onto the real state. */
@@ -234,6 +304,26 @@ private: // private member variables
    METAtmosphereThermal thermal; /*!< trick_units(--)
       Thermal aspect of the model */
 
+   bool table_built; /*!< trick_units(--)
+      Whether the density table has been built. */
+
+   unsigned int table_num_temps; /*!< trick_units(count)
+      Number of exospheric temperatures in the density table. */
+
+   unsigned int table_num_alts; /*!< trick_units(count)
+      Number of altitudes in the density table. */
+
+   static const unsigned int num_table_values = 8; /*!< trick_units(count)
+      Values tabulated at each node: log density, molecular weight, and the
+      log number density of each of the six species.*/
+
+   std::vector<double> table_values; /*!< trick_io(**)
+      Tabulated values, indexed by temperature, then altitude, then value. */
+
+   std::vector<double> table_slopes; /*!< trick_io(**)
+      Altitude derivatives of the tabulated values at each node, limited so
+      that the interpolation is monotone between nodes. */
+
 
    // Physical Constants.
    const double R_gas_constant;     /*!< trick_units(J/(mol*K)) R */
@@ -301,6 +391,12 @@ public: // public member functions
                                     AtmosphereState * state) override;
    void update_atmosphere         ( const PlanetFixedPosition * pfix_pos,
                                     METAtmosphereStateVars    * state);
+   void update_atmosphere ( unsigned int num_positions,
+                            const PlanetFixedPosition * const * pfix_pos,
+                            METAtmosphereStateVars * const * states);
+   void update_atmosphere ( unsigned int num_positions,
+                            const PlanetFixedPosition * const * pfix_pos,
+                            AtmosphereState * const * states) override;
 
    // TODO Turner 10/2017
    //       This is not a sensible way of obtaining time.  A better strategy
@@ -310,13 +406,25 @@ public: // public member functions
    void update_time (const TimeUTC & time_utc) {
       trunc_julian_time = time_utc.trunc_julian_time;}
 
+   void update_space_weather (const SpaceWeather & space_weather);
+
+   // Build the density table ahead of its first use.
+   void prepare_density_table ();
+
 
 private: // private member functions
    void update_atmosphere ( const PlanetFixedPosition * pfix_pos);
    void modify_densities();
+   void update_global_conditions();
    void compute_solar_angles();
+   void compute_solar_hour_angle();
+   void compute_global_temperature_terms();
    void compute_exospheric_temperature();
    void jacchia();
+   void build_density_table();
+   bool interpolate_density_table();
+   bool load_offload_result( unsigned int index,
+                             const PlanetFixedPosition * pfix_pos);
    void compute_seasonal_latitude_variation();
    void compute_seasonal_lat_variation_He();
    void atmos_MET_FAIR5();
@@ -324,6 +432,8 @@ private: // private member functions
    double apply_gauss_quadrature( int altitude_index_start,
                                   double ceiling);
 
+   friend class METAtmosphereOffload;
+
    // operator = and copy constructor locked from use by being private
    METAtmosphere& operator = (const METAtmosphere& rhs);
    METAtmosphere (const METAtmosphere& rhs);
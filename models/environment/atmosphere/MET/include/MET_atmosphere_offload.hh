@@ -0,0 +1,194 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/MET/include/MET_atmosphere_offload.hh
+ * Evaluate the tabulated MET atmosphere at a batch of positions on an
+ * accelerator
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   (Evaluates the MET atmosphere density table, the temperature profile and
+    the density corrections for a batch of positions in one offloaded
+    kernel.)
+ASSUMPTIONS AND LIMITATIONS:
+   ((Only METAtmosphere objects with use_density_table set are offloaded.)
+    (Positions outside the density table, or with an invalid latitude, are
+     flagged and evaluated on the host by the full computation.)
+    (The density table is copied to the device once, when first used.))
+LIBRARY DEPENDENCIES:
+   (../src/MET_atmosphere_offload.cc)
+
+*******************************************************************************/
+
+#ifndef JEOD_MET_ATMOSPHERE_OFFLOAD_HH
+#define JEOD_MET_ATMOSPHERE_OFFLOAD_HH
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/offload/include/offload_buffer.hh"
+#include "utils/offload/include/offload_device.hh"
+#include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+// Forward Declaration
+class METAtmosphere;
+
+/*****************************************************************************
+METAtmosphereOffload
+Purpose:(Accelerator backend for batched METAtmosphere updates.)
+*****************************************************************************/
+/**
+ * Evaluates a METAtmosphere at every position of a batch in one offloaded
+ * kernel, one position per device thread.  Attach one to
+ * METAtmosphere::offload to have batched updates of at least
+ * min_batch_size positions evaluated on the device.  The density table
+ * stays resident on the device; each call copies only the positions in and
+ * the states out, through a page-locked staging buffer.
+ */
+class METAtmosphereOffload {
+
+   JEOD_MAKE_SIM_INTERFACES(METAtmosphereOffload)
+
+public:
+
+   /**
+    * Number of values computed for each position.
+    */
+   static const unsigned int num_outputs = 13; /*!< trick_io(**) */
+
+   /**
+    * Index of each computed value in the output arrays.
+    */
+   enum OutputIndex {
+      Valid = 0,       ///< Nonzero if the position was evaluated
+      ExoTemp,         ///< Exospheric temperature
+      Temperature,     ///< Temperature
+      Density,         ///< Mass density
+      MolWeight,       ///< Mean molecular weight
+      Pressure,        ///< Pressure
+      Log10Density,    ///< Log10 of the mass density
+      NumDensity       ///< First of the six species number densities
+   };
+
+   unsigned int min_batch_size; /*!< trick_units(--)
+      Smallest batch evaluated on the device. */
+
+   bool allow_host_execution; /*!< trick_units(--)
+      Run the kernel on the host when no device is present, rather than
+      leaving the batch to the host model.  Intended for verifying the
+      kernel on machines without an accelerator. */
+
+   OffloadDevice device; /*!< trick_units(--)
+      The device that the kernel runs on. */
+
+   // default constructor
+   METAtmosphereOffload ();
+
+   // destructor
+   ~METAtmosphereOffload ();
+
+   // Should a batch of the given size be evaluated by this object?
+   bool use_for (unsigned int num_positions) const;
+
+   // Evaluate the atmosphere at each position.
+   bool evaluate ( METAtmosphere & atmos,
+                   unsigned int num_positions,
+                   const PlanetFixedPosition * const * pfix_pos);
+
+   // Get one of the values computed for a position by the last evaluation.
+   double get_output (unsigned int index, OutputIndex value) const;
+
+   // Discard the device table; it is copied again on the next call.
+   void invalidate ();
+
+   // Free all device and staging memory.
+   void release ();
+
+private:
+
+   OffloadBuffer staging; /*!< trick_io(**)
+      Staging buffer: the altitudes, latitudes and longitudes, then the
+      num_outputs output arrays, each one array of num_positions. */
+
+   unsigned int num_positions; /*!< trick_io(**)
+      Number of positions in the current batch. */
+
+   const METAtmosphere * table_atmos; /*!< trick_io(**)
+      Atmosphere whose density table is on the device. */
+
+   std::size_t table_size; /*!< trick_io(**)
+      Number of doubles in each of the device table arrays. */
+
+   double * dev_table; /*!< trick_io(**)
+      Device copy of the density table values followed by its slopes. */
+
+   double * dev_io; /*!< trick_io(**)
+      Device copy of the staging buffer. */
+
+   std::size_t dev_io_positions; /*!< trick_io(**)
+      Number of positions dev_io holds. */
+
+   // Copy the atmosphere's density table to the device.
+   void upload_table (const METAtmosphere & atmos);
+
+   // operator = and copy constructor locked from use by being private
+   METAtmosphereOffload& operator = (const METAtmosphereOffload& rhs);
+   METAtmosphereOffload (const METAtmosphereOffload& rhs);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -112,6 +112,11 @@ public: // public member functions
                        const PlanetFixedPosition * pfix_pos);
    void update_state () override;
 
+   // Updates a group of states, e.g. one per vehicle.  States sharing an
+   // METAtmosphere share its position-independent computations.
+   static void update_states ( unsigned int num_states,
+                               METAtmosphereState * const * states);
+
 private:
    // unimplemented operator = for METAtmosphereState
    METAtmosphereState& operator = (const METAtmosphereState& rhs);
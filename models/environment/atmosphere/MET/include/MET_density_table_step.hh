@@ -0,0 +1,124 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/MET/include/MET_density_table_step.hh
+ * A fidelity step that switches MET atmospheres to the tabulated density
+ * profile
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   (Switches a set of MET atmospheres to the tabulated Jacchia density
+    profile for a real-time fidelity controller.)
+ASSUMPTIONS AND LIMITATIONS:
+   ((The density tables are built when the atmospheres are added, so
+     switching to them does not cost a frame.))
+LIBRARY DEPENDENCIES:
+   (../src/MET_density_table_step.cc)
+
+*******************************************************************************/
+
+#ifndef JEOD_MET_DENSITY_TABLE_STEP_HH
+#define JEOD_MET_DENSITY_TABLE_STEP_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/fidelity_controller.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/*
+METDensityTableStep
+*/
+
+class METDensityTableStep : public JeodFidelityStep {
+
+   JEOD_MAKE_SIM_INTERFACES(METDensityTableStep)
+
+public:
+
+   // default constructor
+   METDensityTableStep ();
+
+   // destructor
+   ~METDensityTableStep () override;
+
+   // Add an atmosphere to those affected by the step.
+   void add_atmosphere (METAtmosphere & atmosphere);
+
+   // JeodFidelityStep interface.
+   void degrade () override;
+   void restore () override;
+
+
+private:
+
+   std::vector<METAtmosphere *> atmospheres; /*!< trick_io(**)
+      The atmospheres affected by the step. */
+
+   std::vector<bool> table_was_used; /*!< trick_io(**)
+      Each atmosphere's use_density_table setting before the step was
+      applied. */
+
+   // Not implemented
+   METDensityTableStep (const METDensityTableStep &);
+   METDensityTableStep & operator = (const METDensityTableStep &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -66,6 +66,8 @@ class AtmosphereState;
 class METAtmosphereChemical;
 class METAtmosphereThermal;
 class METAtmosphere;
+class METDensityTableStep;
+class METAtmosphereOffload;
 class METAtmosphereState;
 class METAtmosphereStateVars;
 
@@ -26,7 +26,8 @@ ASSUMPTIONS AND LIMITATIONS:
    ((Too many to enumerate here.))
 
 LIBRARY DEPENDENCY:
-  ((environment/atmosphere/base_atmos/src/atmosphere_messages.cc)
+  ((MET_atmosphere_offload.cc)
+   (environment/atmosphere/base_atmos/src/atmosphere_messages.cc)
    (utils/message/src/message_handler.cc))
 
 
@@ -45,6 +46,7 @@ LIBRARY DEPENDENCY:
 
 // Model includes
 #include "../include/MET_atmosphere.hh"
+#include "../include/MET_atmosphere_offload.hh"
 #include "environment/atmosphere/base_atmos/include/atmosphere_messages.hh"
 
 
@@ -123,6 +125,13 @@ METAtmosphere::METAtmosphere ()
    geo_index(0.0),
    F10(0.0),
    F10B(0.0),
+   use_density_table(false),
+   table_exo_temp_min(500.0),
+   table_exo_temp_max(2500.0),
+   table_exo_temp_step(25.0),
+   table_altitude_max(1000.0),
+   table_altitude_step(2.5),
+   offload(nullptr),
    altitude_km(0.0),
    latitude(0.0),
    longitude(0.0),
@@ -137,8 +146,22 @@ METAtmosphere::METAtmosphere ()
    year(2000),
    solar_declination_angle(0.0),
    solar_hour_angle(0.0),
+   solar_right_ascension(0.0),
+   greenwich_mean_position(0.0),
+   solar_activity_variation(0.0),
+   geomagnetic_variation(0.0),
+   semiannual_variation(0.0),
+   conditions_valid(false),
+   conditions_tjt(0.0),
+   conditions_F10(0.0),
+   conditions_F10B(0.0),
+   conditions_geo_index(0.0),
+   conditions_geo_index_type(ATMOS_MET_GI_AP),
    state(),
    thermal( state.exo_temp, altitude_km),
+   table_built(false),
+   table_num_temps(0),
+   table_num_alts(0),
    R_gas_constant(8.31432),// Note: This is not an accurate value for R
                            //       But it is the value used by Jacchia
                            //       See Jacchia(1971), p9, eq 5.
@@ -336,6 +359,130 @@ METAtmosphere::update_atmosphere (
    *ext_state = state;
 }
 
+//****************************************************************************
+// update_atmosphere:
+/**
+ * Computes the METAtmosphere at several positions at the current time,
+ * e.g. for a group of vehicles sharing this atmosphere.  The
+ * position-independent conditions are computed once for the group.  Large
+ * batches are evaluated by the offload backend, if one is attached.
+ * \param[in] num_positions Number of positions and states.
+ * \param[in] pfix_pos Geodetic altitude, latitude and longitude of each
+ *            position.
+ * \param[out] ext_states Where the state results for each position will be
+ *            sent.
+ */
+//****************************************************************************
+void
+METAtmosphere::update_atmosphere (
+   unsigned int                      num_positions,
+   const PlanetFixedPosition * const * pfix_pos,
+   METAtmosphereStateVars    * const * ext_states)
+{
+   if ((pfix_pos == nullptr) || (ext_states == nullptr)) {
+     MessageHandler::error(
+       __FILE__,__LINE__, AtmosphereMessages::framework_error,
+       "Position or state array is NULL.  Cannot populate states.\n");
+     return;
+   }
+   bool offloaded = (offload != nullptr) && use_density_table &&
+                    offload->use_for( num_positions) &&
+                    offload->evaluate( *this, num_positions, pfix_pos);
+   for (unsigned int ii = 0; ii < num_positions; ++ii) {
+      if (offloaded && (ext_states[ii] != nullptr) &&
+          load_offload_result( ii, pfix_pos[ii])) {
+         *ext_states[ii] = state;
+      }
+      else {
+         update_atmosphere( pfix_pos[ii], ext_states[ii]);
+      }
+   }
+}
+
+//****************************************************************************
+// update_atmosphere:
+/**
+ * Computes the METAtmosphere at several positions at the current time, for
+ * generic atmosphere states.  States that are METAtmosphereStateVars
+ * receive the full MET state; others receive the AtmosphereState portion.
+ * Large batches are evaluated by the offload backend, if one is attached.
+ * \param[in] num_positions Number of positions and states.
+ * \param[in] pfix_pos Geodetic altitude, latitude and longitude of each
+ *            position.
+ * \param[out] ext_states Where the state results for each position will be
+ *            sent.
+ */
+//****************************************************************************
+void
+METAtmosphere::update_atmosphere (
+   unsigned int                      num_positions,
+   const PlanetFixedPosition * const * pfix_pos,
+   AtmosphereState           * const * ext_states)
+{
+   if ((pfix_pos == nullptr) || (ext_states == nullptr)) {
+     MessageHandler::error(
+       __FILE__,__LINE__, AtmosphereMessages::framework_error,
+       "Position or state array is NULL.  Cannot populate states.\n");
+     return;
+   }
+   bool offloaded = (offload != nullptr) && use_density_table &&
+                    offload->use_for( num_positions) &&
+                    offload->evaluate( *this, num_positions, pfix_pos);
+   for (unsigned int ii = 0; ii < num_positions; ++ii) {
+      METAtmosphereStateVars * met_state =
+         dynamic_cast<METAtmosphereStateVars *> (ext_states[ii]);
+      if (offloaded && (ext_states[ii] != nullptr) &&
+          load_offload_result( ii, pfix_pos[ii])) {
+         // See comments above regarding data slicing.
+         if (met_state != nullptr) {
+            *met_state = state;
+         }
+         else {
+            *ext_states[ii] = state;
+         }
+      }
+      else if (met_state != nullptr) {
+         update_atmosphere( pfix_pos[ii], met_state);
+      }
+      else {
+         update_atmosphere( pfix_pos[ii], ext_states[ii]);
+      }
+   }
+}
+
+//****************************************************************************
+// update_space_weather:
+/**
+ * Copies the solar flux and geomagnetic indices from a SpaceWeather object.
+ * The geomagnetic index copied is a_p or K_p according to geo_index_type.
+ * \param[in] space_weather Current space weather.
+ */
+//****************************************************************************
+void
+METAtmosphere::update_space_weather (
+   const SpaceWeather & space_weather)
+{
+   F10  = space_weather.F10;
+   F10B = space_weather.F10B;
+   geo_index = (geo_index_type == ATMOS_MET_GI_KP) ? space_weather.kp :
+                                                     space_weather.ap;
+}
+
+//****************************************************************************
+// prepare_density_table:
+/**
+ * Builds the density table if it has not been built, so that a later
+ * switch to use_density_table does not pay for the build.
+ */
+//****************************************************************************
+void
+METAtmosphere::prepare_density_table ()
+{
+   if (!table_built) {
+      build_density_table();
+   }
+}
+
 //****************************************************************************
 // update_atmosphere:
 /**
@@ -358,12 +505,15 @@ METAtmosphere::update_atmosphere(
    latitude    =  pfix_pos->ellip_coords.latitude;
    longitude   =  pfix_pos->ellip_coords.longitude;
 
-   // Compute the solar data.
-   compute_solar_angles();
-   // Compute exospheric temperature.
+   // Compute the time-dependent data, if not already done for this time.
+   update_global_conditions();
+   // Compute the solar hour angle and exospheric temperature at the position.
+   compute_solar_hour_angle();
    compute_exospheric_temperature();
-   // Call the main Jacchia atmosphere routine.
-   jacchia();
+   // Call the main Jacchia atmosphere routine, or look its results up.
+   if (!use_density_table || !interpolate_density_table()) {
+      jacchia();
+   }
    // Apply density modifications:
    modify_densities();
 
@@ -383,6 +533,51 @@ METAtmosphere::update_atmosphere(
                       R_gas_constant * state.temperature;
 }
 
+/*****************************************************************************
+load_offload_result
+Purpose:(
+    Loads the scratch state with the result computed by the offload backend
+    for one position of a batch, in place of update_atmosphere.)
+RETURN:
+   (bool -- false if the backend did not evaluate the position, in which
+            case nothing is loaded.)
+*****************************************************************************/
+bool
+METAtmosphere::load_offload_result(
+   unsigned int                index,
+   const PlanetFixedPosition * pfix_pos)
+{
+   typedef METAtmosphereOffload Out;
+
+   if (offload->get_output (index, Out::Valid) == 0.0) {
+      return false;
+   }
+
+   altitude_km =  pfix_pos->ellip_coords.altitude / 1000.0;
+   latitude    =  pfix_pos->ellip_coords.latitude;
+   longitude   =  pfix_pos->ellip_coords.longitude;
+
+   state.exo_temp    = offload->get_output (index, Out::ExoTemp);
+   state.temperature = offload->get_output (index, Out::Temperature);
+   state.density     = offload->get_output (index, Out::Density);
+   state.mol_weight  = offload->get_output (index, Out::MolWeight);
+   state.pressure    = offload->get_output (index, Out::Pressure);
+   state.log10_dens  = offload->get_output (index, Out::Log10Density);
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      species.num_density[ii] = offload->get_output (
+         index, static_cast<Out::OutputIndex> (Out::NumDensity + ii));
+   }
+   thermal.T_out = state.temperature;
+   state.N2  = species.num_density[0];
+   state.Ox2 = species.num_density[1];
+   state.Ox  = species.num_density[2];
+   state.A   = species.num_density[3];
+   state.He  = species.num_density[4];
+   state.Hyd = species.num_density[5];
+
+   return true;
+}
+
 /*****************************************************************************
 modify_densities
 Purpose:(
@@ -406,12 +601,47 @@ METAtmosphere::modify_densities()
    }
 }
 
+/*****************************************************************************
+update_global_conditions
+
+PURPOSE:
+   (Computes the solar angles and the exospheric temperature terms that do not
+    depend on position.  These depend only on the time, F10, F10B, and the
+    geomagnetic index, so they are recomputed only when one of those changes
+    and are shared by all positions evaluated at the same time.)
+*****************************************************************************/
+void
+METAtmosphere::update_global_conditions()
+{
+   if (conditions_valid &&
+       (trunc_julian_time == conditions_tjt) &&
+       (F10 == conditions_F10) &&
+       (F10B == conditions_F10B) &&
+       (geo_index == conditions_geo_index) &&
+       (geo_index_type == conditions_geo_index_type)) {
+      return;
+   }
+
+   compute_solar_angles();
+   compute_global_temperature_terms();
+
+   conditions_valid          = true;
+   conditions_tjt            = trunc_julian_time;
+   conditions_F10            = F10;
+   conditions_F10B           = F10B;
+   conditions_geo_index      = geo_index;
+   conditions_geo_index_type = geo_index_type;
+}
+
+
 /*****************************************************************************
 Function: compute_solar_angles, formerly atmos_MET_TME
 
 PURPOSE:
    (Subroutine 'atmos_MET_TME' performs the calculations of the solar
-    declination angle and solar hour angle.)
+    declination angle and the time-dependent parts of the solar hour angle.
+    The solar hour angle itself is completed for each position by
+    compute_solar_hour_angle.)
 
 REFERENCE:
    (((Jacchia, L.G.) (New Static Models of the Thermosphere and
@@ -544,7 +774,7 @@ METAtmosphere::compute_solar_angles()
    // If the ratio is out-of-bounds, assign to pi/2.
    // The RA has to be put into the same quadrant as the celestial longitude,
    // so for now generate RA in the first quadrant.
-   double solar_right_ascension = M_PI_2;
+   solar_right_ascension = M_PI_2;
    if ( std::abs(scratch1) < std::abs(scratch2)) {
       solar_right_ascension = std::abs( asin( scratch1 / scratch2));
    }
@@ -574,13 +804,26 @@ METAtmosphere::compute_solar_angles()
    const double A2 = 36000.76892;
    const double A3 = 0.00038708;
    const double A4 = 0.250684477;
-   double greenwich_mean_position =
+   greenwich_mean_position =
         std::fmod (( A1 +
                     (A2 * century_frac) +
                     (A3 * century_frac * century_frac) +
                     (A4 * minutes_of_day)),
                    360.0);
+}
+
 
+/*****************************************************************************
+compute_solar_hour_angle
+
+PURPOSE:
+   (Completes the solar hour angle, range (-pi, pi], at the current longitude
+    from the Greenwich mean position and solar right ascension computed by
+    compute_solar_angles.)
+*****************************************************************************/
+void
+METAtmosphere::compute_solar_hour_angle()
+{
    // previous algorithm's application of constraints on right ascension
    // point (RAP) was unnecessary because it is local, and constraint gets
    // applied in the computation of solar-hour-angle anyway.
@@ -603,7 +846,9 @@ PURPOSE:
    (Calculates the exospheric temperature
     according to L. Jacchia, Smithsonian Astrophysical Observatory 313,
     1970.  Subroutine 'atmos_MET_TME' performs the calculations of the solar
-    declination angle and solar hour angle.)
+    declination angle and solar hour angle.  Only the diurnal variation is
+    computed here; the position-independent terms are computed by
+    compute_global_temperature_terms.)
 
 REFERENCE:
    (((Jacchia, L.G.) (New Static Models of the Thermosphere and
@@ -635,20 +880,7 @@ METAtmosphere::compute_exospheric_temperature()
    }
 
   //****************************************************************************
-  // PART A - compute the solar-activity variation
-  //****************************************************************************
-   // Ci are solar activity variables
-   //  TODO 1970/71 inconsistency
-   //       1970:
-   const double C1 = 383.0, C2 = 3.32, C3 = 1.80;
-   //       1971:
-   //const double C1 = 379.0, C2 = 3.24, C3 = 1.30;
-
-   //       See equation 14.
-   double solar_activity_variation = C1 + C2 * F10B + C3 * (F10 - F10B);
-
-  //****************************************************************************
-  // PART B - compute the diurnal variation see Jacchia(1971) p 28
+  // compute the diurnal variation see Jacchia(1971) p 28
   //****************************************************************************a
    // angles beta  = - 37 degrees
    //        gamma =   43 degrees
@@ -683,11 +915,47 @@ METAtmosphere::compute_exospheric_temperature()
 
    // A simpler way of writing equation 17:
    double diurnal_variation = 1.0 + RE * (A1 + A3 * (A2 - A1));
+
+   // Exospheric temperature (method output), see equation 14.
+   state.exo_temp = solar_activity_variation * diurnal_variation +
+                    geomagnetic_variation    + semiannual_variation;
+}
+
+
+/*****************************************************************************
+compute_global_temperature_terms
+
+PURPOSE:
+   (Calculates the terms of the exospheric temperature that do not depend on
+    position: the solar-activity, geomagnetic and semiannual variations.
+    See compute_exospheric_temperature for the complete expression.)
+
+REFERENCE:
+   (((Jacchia, L.G.) (New Static Models of the Thermosphere and
+      Exosphere with Empirical Temperature Profiles) (Smithsonian
+      Astrophysical Observatory Special Report No. 313) (--) (1970) (--)))
+*****************************************************************************/
+void
+METAtmosphere::compute_global_temperature_terms()
+{
+  //****************************************************************************
+  // PART A - compute the solar-activity variation
+  //****************************************************************************
+   // Ci are solar activity variables
+   //  TODO 1970/71 inconsistency
+   //       1970:
+   const double C1 = 383.0, C2 = 3.32, C3 = 1.80;
+   //       1971:
+   //const double C1 = 379.0, C2 = 3.24, C3 = 1.30;
+
+   //       See equation 14.
+   solar_activity_variation = C1 + C2 * F10B + C3 * (F10 - F10B);
+
   //****************************************************************************
-  // PART C - compute the geomagnetic variation
+  // PART B - compute the geomagnetic variation
   //****************************************************************************
    const double D1 = 28.0, D2 = 0.03, D3 = 1.0, D4 = 100.0, D5 = -0.08;
-   double geomagnetic_variation = 0.0;
+   geomagnetic_variation = 0.0;
    //  TODO 1970/71 inconsistency
    //       1970: as implemented here
    //       1971: completely new formulations.  Not implemented at all.
@@ -700,7 +968,7 @@ METAtmosphere::compute_exospheric_temperature()
    }
 
   //****************************************************************************
-  // PART D - compute the semiannual variation.  See eqn(23)
+  // PART C - compute the semiannual variation.  See eqn(23)
   //  TODO 1970/71 inconsistency
   //       1970: as implemented here
   //       1971: completely new formulations.  Not implemented at all.
@@ -730,11 +998,7 @@ METAtmosphere::compute_exospheric_temperature()
    double sav_a = E2 + E3 * (std::sin (2*M_PI * tau1 + E4));
    double sav_b = std::sin (4*M_PI * tau1 + E5);
    // equation 23:
-   double semiannual_variation = E1 + F10B * sav_a * sav_b;
-
-   // Exospheric temperature (method output)
-   state.exo_temp = solar_activity_variation * diurnal_variation +
-                    geomagnetic_variation    + semiannual_variation;
+   semiannual_variation = E1 + F10B * sav_a * sav_b;
 }
 
 
@@ -951,6 +1215,234 @@ METAtmosphere::jacchia()
    }
 }
 
+/*****************************************************************************
+build_density_table
+
+PURPOSE:
+   (Tabulates the output of the Jacchia profile (the jacchia method) over a
+    grid of exospheric temperature and altitude, together with limited
+    altitude derivatives for monotone cubic interpolation.)
+
+ASSUMPTIONS AND LIMITATIONS:
+   ((The jacchia output depends only on the exospheric temperature and the
+     altitude.)
+    (Densities are tabulated as natural logarithms.))
+*****************************************************************************/
+void
+METAtmosphere::build_density_table()
+{
+   table_built = true;
+   table_values.clear();
+   table_slopes.clear();
+   table_num_temps = 0;
+   table_num_alts  = 0;
+
+   if ((table_exo_temp_step <= 0.0) ||
+       (table_exo_temp_max <= table_exo_temp_min) ||
+       (table_altitude_step <= 0.0) ||
+       (table_altitude_max <= gauss_altitudes[0])) {
+      MessageHandler::error(
+        __FILE__,__LINE__, AtmosphereMessages::initialization_error,
+        "The MET density table limits are invalid.\n"
+        "The full computation will be used instead.\n");
+      return;
+   }
+
+   table_num_temps = static_cast<unsigned int> (
+      std::ceil ((table_exo_temp_max - table_exo_temp_min) /
+                 table_exo_temp_step)) + 1;
+   table_num_alts  = static_cast<unsigned int> (
+      std::ceil ((table_altitude_max - gauss_altitudes[0]) /
+                 table_altitude_step)) + 1;
+   table_values.resize (table_num_temps * table_num_alts * num_table_values);
+   table_slopes.resize (table_values.size());
+
+   // The thermal model reads the exospheric temperature and altitude by
+   // reference; save the current values so they can be restored.
+   double saved_exo_temp = state.exo_temp;
+   double saved_altitude = altitude_km;
+
+   for (unsigned int it = 0; it < table_num_temps; ++it) {
+      state.exo_temp = table_exo_temp_min + it * table_exo_temp_step;
+      for (unsigned int ia = 0; ia < table_num_alts; ++ia) {
+         altitude_km = gauss_altitudes[0] + ia * table_altitude_step;
+         // Hydrogen is only computed above 500 km, and is a placeholder at
+         // and below.  Tabulate the 500 km node from above so that the
+         // Hydrogen interpolation starts from the computed profile.
+         if (std::abs (altitude_km - gauss_altitudes[6]) <
+             1E-6 * table_altitude_step) {
+            altitude_km = std::nextafter (gauss_altitudes[6], 2.0 * gauss_altitudes[6]);
+         }
+         jacchia();
+         double * node = &table_values[(it * table_num_alts + ia) *
+                                       num_table_values];
+         node[0] = std::log (state.density);
+         node[1] = state.mol_weight;
+         for (unsigned int ii = 0; ii < 6; ++ii) {
+            node[ii+2] = std::log (species.num_density[ii]);
+         }
+      }
+
+      // Node derivatives are the harmonic mean of the adjacent secant
+      // slopes, or zero at a local extremum (Fritsch-Butland); this keeps
+      // the interpolant monotone wherever the data are.
+      for (unsigned int iv = 0; iv < num_table_values; ++iv) {
+         for (unsigned int ia = 0; ia < table_num_alts; ++ia) {
+            unsigned int index = (it * table_num_alts + ia) * num_table_values +
+                                 iv;
+            double d_lo = 0.0;
+            double d_hi = 0.0;
+            if (ia > 0) {
+               d_lo = (table_values[index] -
+                       table_values[index - num_table_values]) /
+                      table_altitude_step;
+            }
+            if (ia + 1 < table_num_alts) {
+               d_hi = (table_values[index + num_table_values] -
+                       table_values[index]) / table_altitude_step;
+            }
+            // Below 500 km the Hydrogen values are placeholders and must not
+            // feed into the derivative at 500 km.
+            if ((iv == num_table_values - 1) &&
+                (gauss_altitudes[0] + ia * table_altitude_step <
+                 gauss_altitudes[6] + 0.5 * table_altitude_step)) {
+               table_slopes[index] = d_hi;
+            }
+            else if (ia == 0) {
+               table_slopes[index] = d_hi;
+            }
+            else if (ia + 1 == table_num_alts) {
+               table_slopes[index] = d_lo;
+            }
+            else if (d_lo * d_hi <= 0.0) {
+               table_slopes[index] = 0.0;
+            }
+            else {
+               table_slopes[index] = 2.0 * d_lo * d_hi / (d_lo + d_hi);
+            }
+         }
+      }
+   }
+
+   state.exo_temp = saved_exo_temp;
+   altitude_km    = saved_altitude;
+}
+
+
+/*****************************************************************************
+interpolate_density_table
+
+PURPOSE:
+   (Replaces the jacchia method with an interpolation of the density table.
+    The profile is interpolated with monotone cubic Hermite polynomials in
+    altitude and in exospheric temperature.  The temperature at altitude is
+    computed directly.)
+
+RETURN:
+   (bool -- false if the current conditions are outside the table, in which
+            case nothing is computed.)
+*****************************************************************************/
+bool
+METAtmosphere::interpolate_density_table()
+{
+   if (!table_built) {
+      build_density_table();
+   }
+   if (table_num_temps < 2 || table_num_alts < 2) {
+      return false;
+   }
+
+   double temp_pos = (state.exo_temp - table_exo_temp_min) / table_exo_temp_step;
+   double alt_pos  = (altitude_km - gauss_altitudes[0]) / table_altitude_step;
+   if ((temp_pos < 0.0) || (temp_pos > table_num_temps - 1) ||
+       (alt_pos  < 0.0) || (alt_pos  > table_num_alts  - 1)) {
+      return false;
+   }
+
+   unsigned int it = std::min (static_cast<unsigned int> (temp_pos),
+                               table_num_temps - 2);
+   unsigned int ia = std::min (static_cast<unsigned int> (alt_pos),
+                               table_num_alts - 2);
+   double ft = temp_pos - it;
+   double t  = alt_pos - ia;
+
+   // Cubic Hermite basis functions.  In altitude the node derivatives are
+   // tabulated; the derivative terms are scaled by the node spacing.
+   double t2  = t * t;
+   double t3  = t2 * t;
+   double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+   double h10 = (t3 - 2.0 * t2 + t) * table_altitude_step;
+   double h01 = -2.0 * t3 + 3.0 * t2;
+   double h11 = (t3 - t2) * table_altitude_step;
+
+   // In temperature, the four rows around the current temperature are
+   // interpolated in altitude and the results are interpolated with the
+   // same limited cubic, using derivatives formed from those rows.
+   double ft2  = ft * ft;
+   double ft3  = ft2 * ft;
+   double g00 = 2.0 * ft3 - 3.0 * ft2 + 1.0;
+   double g10 = ft3 - 2.0 * ft2 + ft;
+   double g01 = -2.0 * ft3 + 3.0 * ft2;
+   double g11 = ft3 - ft2;
+   unsigned int row_first = (it > 0) ? it - 1 : it;
+   unsigned int row_last  = std::min (it + 2, table_num_temps - 1);
+
+   double values[num_table_values];
+   for (unsigned int iv = 0; iv < num_table_values; ++iv) {
+      double row_value[4];
+      for (unsigned int row = row_first; row <= row_last; ++row) {
+         unsigned int lo = (row * table_num_alts + ia) * num_table_values + iv;
+         unsigned int hi = lo + num_table_values;
+         row_value[row + 1 - it] = h00 * table_values[lo] +
+                                   h10 * table_slopes[lo] +
+                                   h01 * table_values[hi] +
+                                   h11 * table_slopes[hi];
+      }
+      double d_mid = row_value[2] - row_value[1];
+      double m_lo  = d_mid;
+      double m_hi  = d_mid;
+      if (row_first < it) {
+         double d_lo = row_value[1] - row_value[0];
+         m_lo = (d_lo * d_mid <= 0.0) ? 0.0 : 2.0 * d_lo * d_mid / (d_lo + d_mid);
+      }
+      if (row_last > it + 1) {
+         double d_hi = row_value[3] - row_value[2];
+         m_hi = (d_hi * d_mid <= 0.0) ? 0.0 : 2.0 * d_hi * d_mid / (d_hi + d_mid);
+      }
+      values[iv] = g00 * row_value[1] + g10 * m_lo +
+                   g01 * row_value[2] + g11 * m_hi;
+   }
+
+   thermal.update();
+   state.temperature = thermal.T_out;
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      species.num_density[ii] = std::exp (values[ii+2]);
+   }
+   if (altitude_km <= gauss_altitudes[6]) {
+      species.num_density[5] = 1.0;
+   }
+
+   // Above the barometric ceiling, the total density and mean molecular
+   // weight follow from the species number densities (see jacchia, part D).
+   if (altitude_km > barometric_equation_ceiling) {
+      double weighted_num_density = 0.0;
+      double total_num_density = 0.0;
+      for (unsigned int ii = 0; ii < 6; ++ii) {
+         weighted_num_density += species.mol_weight[ii] * species.num_density[ii];
+         total_num_density += species.num_density[ii];
+      }
+      state.mol_weight = weighted_num_density / total_num_density;
+      state.density = weighted_num_density / (1000.0 * Avogadro);
+   }
+   else {
+      state.density    = std::exp (values[0]);
+      state.mol_weight = values[1];
+   }
+
+   return true;
+}
+
+
 /*****************************************************************************
 
 Function: compute_seasonal_latitude_variation
@@ -0,0 +1,561 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/MET/src/MET_atmosphere_offload.cc
+ * Implementation of the offloaded MET atmosphere kernel
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   (Evaluates the MET atmosphere density table, the temperature profile and
+    the density corrections for a batch of positions in one offloaded
+    kernel.)
+REFERENCE:
+   (((Jacchia, L.G.) (New Static Models of the Thermosphere and
+       Exosphere with Empirical Temperature Profiles) (Smithsonian
+       Astrophysical Observatory Special Report No. 313) (--) (1970) (--))
+     ((Jacchia, L.G.) (Revised Static Models of the Termosphere
+       and Exosphere with Emperical Temperature Profiles)
+       (Smithsonian Astrophysical Observatory Report No. 332) (--)
+       (1971) (--)))
+
+ASSUMPTIONS AND LIMITATIONS:
+   ((Each step repeats the arithmetic of the corresponding METAtmosphere
+     method, so results agree with the host model to within the device's
+     math library.))
+
+LIBRARY DEPENDENCY:
+  ((MET_atmosphere.cc)
+   (utils/offload/src/offload_buffer.cc)
+   (utils/offload/src/offload_device.cc))
+
+
+*****************************************************************************/
+
+// System includes
+#include <algorithm> // std::min
+#include <cstddef>
+#define _USE_MATH_DEFINES_ // for M_PI and the likes
+#include <cmath>           // for M_PI and math functions
+
+// JEOD includes
+
+// Model includes
+#include "../include/MET_atmosphere.hh"
+#include "../include/MET_atmosphere_offload.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Position-independent inputs of the kernel, copied from the atmosphere.
+ */
+struct KernelConditions {
+   double greenwich_mean_position;
+   double deg_to_rad;
+   double two_pi;
+   double solar_right_ascension;
+   double solar_declination_angle;
+   double solar_activity_variation;
+   double geomagnetic_variation;
+   double semiannual_variation;
+   double fraction_of_year;
+   double table_exo_temp_min;
+   double table_exo_temp_step;
+   double table_altitude_min;
+   double table_altitude_step;
+   double altitude_hydrogen;
+   double barometric_equation_ceiling;
+   double base_fairing_height;
+   double fairing_k;
+   double Avogadro;
+   double R_gas_constant;
+   double k_1;
+   double k_3;
+   double k_4;
+   double T_90;
+   double mol_weight[METAtmosphereChemical::num_species];
+   unsigned int table_num_temps;
+   unsigned int table_num_alts;
+};
+
+}
+
+
+JEOD_OFFLOAD_PRAGMA(omp declare target)
+
+/**
+ * Helium seasonal-latitude correction; see
+ * METAtmosphere::compute_seasonal_lat_variation_He.
+ * \param[in] cond Kernel conditions
+ * \param[in] latitude Latitude\n Units: rad
+ * \param[in,out] density Mass density\n Units: kg/m3
+ * \param[in,out] He_num_density Helium number density
+ */
+static void
+met_seasonal_lat_variation_He (
+   const KernelConditions & cond,
+   double latitude,
+   double & density,
+   double & He_num_density)
+{
+   double A  = std::abs (0.65 * (cond.solar_declination_angle / 0.4091));
+   double B  = 0.5 * latitude;
+   if (cond.solar_declination_angle < 0.0) {
+      B = -B;
+   }
+   double sin_x                = std::sin (M_PI_4 - B);
+   double sin_x_3              = sin_x * sin_x * sin_x;
+   double delta_log_He_density = A * (sin_x_3 - 0.35355);
+
+   double delta_He_num_density = He_num_density *
+                                  (std::pow (10.0, delta_log_He_density) - 1.0);
+   He_num_density += delta_He_num_density;
+   density += 6.646E-27 * delta_He_num_density;
+}
+
+
+/**
+ * Evaluate the tabulated MET atmosphere at one position: the solar hour
+ * angle, the exospheric temperature, the table interpolation, the
+ * temperature profile and the density corrections of
+ * METAtmosphere::update_atmosphere.
+ * \param[in] cond Kernel conditions
+ * \param[in] table_values Density table values
+ * \param[in] table_slopes Density table altitude derivatives
+ * \param[in] altitude_km Altitude\n Units: km
+ * \param[in] latitude Latitude\n Units: rad
+ * \param[in] longitude Longitude\n Units: rad
+ * \param[out] out First output; outputs are stride apart
+ * \param[in] stride Distance between outputs
+ */
+static void
+met_point (
+   const KernelConditions & cond,
+   const double * table_values,
+   const double * table_slopes,
+   double altitude_km,
+   double latitude,
+   double longitude,
+   double * out,
+   std::size_t stride)
+{
+   typedef METAtmosphereOffload Out;
+   const unsigned int num_table_values = 8;
+
+   out[Out::Valid * stride] = 0.0;
+
+   // Solar hour angle; see compute_solar_hour_angle.
+   double right_ascension_point =
+      cond.greenwich_mean_position * cond.deg_to_rad + longitude;
+   double solar_hour_angle = right_ascension_point - cond.solar_right_ascension;
+   while (solar_hour_angle > M_PI) {
+     solar_hour_angle -= cond.two_pi;
+   }
+   while (solar_hour_angle < -M_PI) {
+     solar_hour_angle += cond.two_pi;
+   }
+
+   // Exospheric temperature; see compute_exospheric_temperature.
+   const double beta = -0.6457718, gamma = 0.7504916, p = 0.1047198;
+   double RE = 0.31;
+   double theta = 0.5 * std::abs (latitude + cond.solar_declination_angle);
+   double   eta = 0.5 * std::abs (latitude - cond.solar_declination_angle);
+   double   tau = solar_hour_angle + beta + p *
+                  std::sin (solar_hour_angle + gamma);
+   if (tau > M_PI) {
+      tau -= cond.two_pi;
+   }
+   else if (tau < -M_PI) {
+      tau += cond.two_pi;
+   }
+   double sin_theta = std::sin (theta);
+   double cos_eta   = std::cos (eta);
+   double cos_tau_2 = std::cos (tau / 2.0);
+   double A1 = sin_theta * sin_theta * sqrt (sin_theta);
+   double A2 = cos_eta * cos_eta * sqrt (cos_eta);
+   double A3 = cos_tau_2 * cos_tau_2 * cos_tau_2;
+   double diurnal_variation = 1.0 + RE * (A1 + A3 * (A2 - A1));
+   double exo_temp = cond.solar_activity_variation * diurnal_variation +
+                     cond.geomagnetic_variation    + cond.semiannual_variation;
+
+   // Table lookup; see interpolate_density_table.
+   double temp_pos = (exo_temp - cond.table_exo_temp_min) /
+                     cond.table_exo_temp_step;
+   double alt_pos  = (altitude_km - cond.table_altitude_min) /
+                     cond.table_altitude_step;
+   if ((temp_pos < 0.0) || (temp_pos > cond.table_num_temps - 1) ||
+       (alt_pos  < 0.0) || (alt_pos  > cond.table_num_alts  - 1)) {
+      return;
+   }
+
+   unsigned int it = std::min (static_cast<unsigned int> (temp_pos),
+                               cond.table_num_temps - 2);
+   unsigned int ia = std::min (static_cast<unsigned int> (alt_pos),
+                               cond.table_num_alts - 2);
+   double ft = temp_pos - it;
+   double t  = alt_pos - ia;
+
+   double t2  = t * t;
+   double t3  = t2 * t;
+   double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+   double h10 = (t3 - 2.0 * t2 + t) * cond.table_altitude_step;
+   double h01 = -2.0 * t3 + 3.0 * t2;
+   double h11 = (t3 - t2) * cond.table_altitude_step;
+
+   double ft2  = ft * ft;
+   double ft3  = ft2 * ft;
+   double g00 = 2.0 * ft3 - 3.0 * ft2 + 1.0;
+   double g10 = ft3 - 2.0 * ft2 + ft;
+   double g01 = -2.0 * ft3 + 3.0 * ft2;
+   double g11 = ft3 - ft2;
+   unsigned int row_first = (it > 0) ? it - 1 : it;
+   unsigned int row_last  = std::min (it + 2, cond.table_num_temps - 1);
+
+   double values[num_table_values];
+   for (unsigned int iv = 0; iv < num_table_values; ++iv) {
+      double row_value[4];
+      for (unsigned int row = row_first; row <= row_last; ++row) {
+         unsigned int lo = (row * cond.table_num_alts + ia) * num_table_values +
+                           iv;
+         unsigned int hi = lo + num_table_values;
+         row_value[row + 1 - it] = h00 * table_values[lo] +
+                                   h10 * table_slopes[lo] +
+                                   h01 * table_values[hi] +
+                                   h11 * table_slopes[hi];
+      }
+      double d_mid = row_value[2] - row_value[1];
+      double m_lo  = d_mid;
+      double m_hi  = d_mid;
+      if (row_first < it) {
+         double d_lo = row_value[1] - row_value[0];
+         m_lo = (d_lo * d_mid <= 0.0) ? 0.0 : 2.0 * d_lo * d_mid / (d_lo + d_mid);
+      }
+      if (row_last > it + 1) {
+         double d_hi = row_value[3] - row_value[2];
+         m_hi = (d_hi * d_mid <= 0.0) ? 0.0 : 2.0 * d_hi * d_mid / (d_hi + d_mid);
+      }
+      values[iv] = g00 * row_value[1] + g10 * m_lo +
+                   g01 * row_value[2] + g11 * m_hi;
+   }
+
+   // Temperature at altitude; see METAtmosphereThermal.
+   double T_125 = 444.3807 + (0.02385 * exo_temp) -
+                  (392.8292 * exp (-0.0021357 * exo_temp));
+   double temperature;
+   double dz   = altitude_km - 125.0;
+   double dz_2 = dz * dz;
+   double dT   = T_125 - cond.T_90;
+   if (dz <= 0.0) {
+      double dz_3 = dz   * dz_2;
+      double dz_4 = dz_2 * dz_2;
+      temperature = T_125 + dT * ((cond.k_1 * dz) +
+                                  (cond.k_3 * dz_3) +
+                                  (cond.k_4 * dz_4));
+   }
+   else {
+      double dz_2_5 = dz_2 * sqrt (dz);
+      double coeff_A = 2 * (exo_temp - T_125) / M_PI;
+      temperature = T_125 + coeff_A *
+                  std::atan2 (cond.k_1 * dT * dz * (1.0 + (4.5E-6 * dz_2_5)),
+                              coeff_A);
+   }
+
+   double num_density[METAtmosphereChemical::num_species];
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      num_density[ii] = std::exp (values[ii+2]);
+   }
+   if (altitude_km <= cond.altitude_hydrogen) {
+      num_density[5] = 1.0;
+   }
+
+   double density;
+   double mol_weight;
+   if (altitude_km > cond.barometric_equation_ceiling) {
+      double weighted_num_density = 0.0;
+      double total_num_density = 0.0;
+      for (unsigned int ii = 0; ii < 6; ++ii) {
+         weighted_num_density += cond.mol_weight[ii] * num_density[ii];
+         total_num_density += num_density[ii];
+      }
+      mol_weight = weighted_num_density / total_num_density;
+      density = weighted_num_density / (1000.0 * cond.Avogadro);
+   }
+   else {
+      density    = std::exp (values[0]);
+      mol_weight = values[1];
+   }
+
+   // Density corrections; see modify_densities.
+   if (altitude_km <= 170.0) {
+      double Z       = altitude_km - 90.0;
+      double exp_arg = -0.0013 * Z * Z;
+      double P       = std::sin (2 * M_PI* cond.fraction_of_year + 1.72);
+      double sin_lat = std::sin (latitude);
+      double s_lat_2  = sin_lat * sin_lat;
+      double S       = 0.014 * Z * exp (exp_arg);
+      double d_log_rho  = S * P * s_lat_2;
+      if (latitude < 0.0) {
+         d_log_rho *= -1.0;
+      }
+      density *= std::pow( 10.0, d_log_rho);
+   }
+   else if (altitude_km >= 500.0) {
+      met_seasonal_lat_variation_He (cond, latitude, density, num_density[4]);
+   }
+   else if (altitude_km > cond.base_fairing_height) {
+      double He_num_density_pre_slvh = num_density[4];
+      double mass_density_pre_slvh = density;
+      met_seasonal_lat_variation_He (cond, latitude, density, num_density[4]);
+      double A = std::cos( cond.fairing_k *
+                           (altitude_km - cond.base_fairing_height));
+      double CZI = A * A;
+      density *= std::pow( (mass_density_pre_slvh / density), CZI);
+      num_density[4] *= std::pow( (He_num_density_pre_slvh / num_density[4]),
+                                  CZI);
+   }
+
+   out[Out::Valid * stride]        = 1.0;
+   out[Out::ExoTemp * stride]      = exo_temp;
+   out[Out::Temperature * stride]  = temperature;
+   out[Out::Density * stride]      = density;
+   out[Out::MolWeight * stride]    = mol_weight;
+   out[Out::Pressure * stride]     = (density * 1000.0 / mol_weight) *
+                                     cond.R_gas_constant * temperature;
+   out[Out::Log10Density * stride] = log10( density);
+   for (unsigned int ii = 0; ii < 6; ++ii) {
+      out[(Out::NumDensity + ii) * stride] = num_density[ii];
+   }
+}
+
+JEOD_OFFLOAD_PRAGMA(omp end declare target)
+
+
+//****************************************************************************
+METAtmosphereOffload::METAtmosphereOffload ()
+   :
+   min_batch_size(64),
+   allow_host_execution(false),
+   device(),
+   staging(),
+   num_positions(0),
+   table_atmos(nullptr),
+   table_size(0),
+   dev_table(nullptr),
+   dev_io(nullptr),
+   dev_io_positions(0)
+{ }
+
+//****************************************************************************
+METAtmosphereOffload::~METAtmosphereOffload ()
+{
+   release();
+}
+
+//****************************************************************************
+// use_for:
+/**
+ * Should a batch of the given size be evaluated by this object?
+ * \param[in] num_positions_in Batch size
+ * \return True if the batch is large enough and a device (or host
+ *         execution) is available
+ */
+//****************************************************************************
+bool
+METAtmosphereOffload::use_for (
+   unsigned int num_positions_in) const
+{
+   return (num_positions_in > 0) && (num_positions_in >= min_batch_size) &&
+          (allow_host_execution || device.is_available());
+}
+
+//****************************************************************************
+// upload_table:
+/**
+ * Copies the atmosphere's density table values and slopes to the device.
+ * \param[in] atmos Atmosphere whose table is copied
+ */
+//****************************************************************************
+void
+METAtmosphereOffload::upload_table (
+   const METAtmosphere & atmos)
+{
+   invalidate();
+
+   table_size = atmos.table_values.size();
+   dev_table = static_cast<double *> (
+                  device.allocate (2 * table_size * sizeof(double)));
+   device.copy_to_device (dev_table, atmos.table_values.data(),
+                          table_size * sizeof(double));
+   device.copy_to_device (dev_table + table_size, atmos.table_slopes.data(),
+                          table_size * sizeof(double));
+   table_atmos = &atmos;
+}
+
+//****************************************************************************
+// evaluate:
+/**
+ * Evaluates the atmosphere's density table, temperature profile and
+ * density corrections at each position, after bringing the atmosphere's
+ * global conditions up to date.  Read the results with get_output;
+ * positions whose Valid output is zero must be evaluated on the host.
+ * \param[in,out] atmos Atmosphere to evaluate; use_density_table must be set
+ * \param[in] num_positions_in Number of positions
+ * \param[in] pfix_pos Geodetic altitude, latitude and longitude of each
+ *            position
+ * \return False if the atmosphere has no usable density table, in which
+ *         case nothing is computed
+ */
+//****************************************************************************
+bool
+METAtmosphereOffload::evaluate (
+   METAtmosphere & atmos,
+   unsigned int num_positions_in,
+   const PlanetFixedPosition * const * pfix_pos)
+{
+   if (!atmos.table_built) {
+      atmos.build_density_table();
+   }
+   if ((atmos.table_num_temps < 2) || (atmos.table_num_alts < 2)) {
+      return false;
+   }
+   atmos.update_global_conditions();
+
+   if ((table_atmos != &atmos) || (table_size != atmos.table_values.size())) {
+      upload_table (atmos);
+   }
+
+   KernelConditions cond;
+   cond.greenwich_mean_position     = atmos.greenwich_mean_position;
+   cond.deg_to_rad                  = atmos.deg_to_rad;
+   cond.two_pi                      = atmos.two_pi;
+   cond.solar_right_ascension       = atmos.solar_right_ascension;
+   cond.solar_declination_angle     = atmos.solar_declination_angle;
+   cond.solar_activity_variation    = atmos.solar_activity_variation;
+   cond.geomagnetic_variation       = atmos.geomagnetic_variation;
+   cond.semiannual_variation        = atmos.semiannual_variation;
+   cond.fraction_of_year            = atmos.fraction_of_year;
+   cond.table_exo_temp_min          = atmos.table_exo_temp_min;
+   cond.table_exo_temp_step         = atmos.table_exo_temp_step;
+   cond.table_altitude_min          = METAtmosphere::gauss_altitudes[0];
+   cond.table_altitude_step         = atmos.table_altitude_step;
+   cond.altitude_hydrogen           = METAtmosphere::gauss_altitudes[6];
+   cond.barometric_equation_ceiling = atmos.barometric_equation_ceiling;
+   cond.base_fairing_height         = atmos.base_fairing_height;
+   cond.fairing_k                   = atmos.fairing_k;
+   cond.Avogadro                    = atmos.Avogadro;
+   cond.R_gas_constant              = atmos.R_gas_constant;
+   cond.k_1                         = atmos.thermal.k_1;
+   cond.k_3                         = atmos.thermal.k_3;
+   cond.k_4                         = atmos.thermal.k_4;
+   cond.T_90                        = atmos.thermal.T_90;
+   for (unsigned int ii = 0; ii < METAtmosphereChemical::num_species; ++ii) {
+      cond.mol_weight[ii] = atmos.species.mol_weight[ii];
+   }
+   cond.table_num_temps             = atmos.table_num_temps;
+   cond.table_num_alts              = atmos.table_num_alts;
+
+   // Stage the positions.  Missing positions and latitudes beyond pi are
+   // left to the host, which reports them.
+   num_positions = num_positions_in;
+   const std::size_t num = num_positions_in;
+   staging.reserve ((3 + num_outputs) * num);
+   double * inputs = staging.data();
+   for (std::size_t ii = 0; ii < num; ++ii) {
+      const PlanetFixedPosition * pos = pfix_pos[ii];
+      if ((pos == nullptr) || (std::abs (pos->ellip_coords.latitude) > M_PI)) {
+         inputs[ii]         = -1.0;
+         inputs[num + ii]   = 0.0;
+         inputs[2*num + ii] = 0.0;
+      }
+      else {
+         inputs[ii]         = pos->ellip_coords.altitude / 1000.0;
+         inputs[num + ii]   = pos->ellip_coords.latitude;
+         inputs[2*num + ii] = pos->ellip_coords.longitude;
+      }
+   }
+
+   if (dev_io_positions < num) {
+      device.release (dev_io);
+      dev_io = static_cast<double *> (
+                  device.allocate ((3 + num_outputs) * num * sizeof(double)));
+      dev_io_positions = num;
+   }
+
+   const double * table_values = dev_table;
+   const double * table_slopes = dev_table + table_size;
+   double * io = dev_io;
+
+   device.copy_to_device (io, inputs, 3 * num * sizeof(double));
+
+   JEOD_OFFLOAD_PRAGMA(
+      omp target teams distribute parallel for
+      device(device.get_device_number ())
+      is_device_ptr(table_values, table_slopes, io)
+      map(to: cond))
+   for (std::size_t ii = 0; ii < num; ++ii) {
+      met_point (cond, table_values, table_slopes,
+                 io[ii], io[num + ii], io[2*num + ii],
+                 io + 3*num + ii, num);
+   }
+
+   device.copy_from_device (inputs + 3 * num, io + 3 * num,
+                            num_outputs * num * sizeof(double));
+
+   return true;
+}
+
+//****************************************************************************
+// get_output:
+/**
+ * Gets one of the values computed for a position by the last evaluation.
+ * \param[in] index Position index
+ * \param[in] value Value to get
+ * \return The value
+ */
+//****************************************************************************
+double
+METAtmosphereOffload::get_output (
+   unsigned int index,
+   OutputIndex value) const
+{
+   const std::size_t num = num_positions;
+   return staging.data()[(3 + value) * num + index];
+}
+
+//****************************************************************************
+void
+METAtmosphereOffload::invalidate ()
+{
+   device.release (dev_table);
+   dev_table = nullptr;
+   table_atmos = nullptr;
+   table_size = 0;
+}
+
+//****************************************************************************
+void
+METAtmosphereOffload::release ()
+{
+   invalidate();
+   device.release (dev_io);
+   dev_io = nullptr;
+   dev_io_positions = 0;
+   staging.release();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -101,6 +101,34 @@ METAtmosphereState::update_state ()
    }
 }
 
+/**
+ * Updates each of a group of METAtmosphereState objects, each from the
+ * METAtmosphere and position with which it was constructed.  The
+ * METAtmosphere computes the conditions that depend only on time and the
+ * solar and geomagnetic indices once per time, so for states that share an
+ * atmosphere only the position-dependent part is computed per state.
+ * \param[in] num_states Number of states in the array.
+ * \param[in,out] states The states to be updated.
+ */
+
+void
+METAtmosphereState::update_states (
+   unsigned int                 num_states,
+   METAtmosphereState * const * states)
+{
+   if (states == nullptr) {
+      MessageHandler::error(
+        __FILE__,__LINE__, AtmosphereMessages::framework_error,
+        "state array is NULL.  Cannot update states.\n");
+      return;
+   }
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      if (states[ii] != nullptr) {
+         states[ii]->update_state();
+      }
+   }
+}
+
 } // End JEOD namespace
 
 /**
@@ -0,0 +1,106 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/MET/src/MET_density_table_step.cc
+ * Implementation of the MET density table fidelity step
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   (Switches a set of MET atmospheres to the tabulated Jacchia density
+    profile for a real-time fidelity controller.)
+
+LIBRARY DEPENDENCY:
+  ((MET_density_table_step.cc)
+   (MET_atmosphere.cc))
+
+
+*****************************************************************************/
+
+// System includes
+#include <cstddef>
+
+// Model includes
+#include "../include/MET_atmosphere.hh"
+#include "../include/MET_density_table_step.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+//****************************************************************************
+// Constructor
+//****************************************************************************
+METDensityTableStep::METDensityTableStep ()
+:
+   JeodFidelityStep(),
+   atmospheres(),
+   table_was_used()
+{
+}
+
+//****************************************************************************
+// Destructor
+//****************************************************************************
+METDensityTableStep::~METDensityTableStep ()
+{
+}
+
+//****************************************************************************
+// add_atmosphere:
+/**
+ * Adds an atmosphere to those affected by the step and builds its density
+ * table. The atmosphere's table settings must be final.
+ * \param[in,out] atmosphere The atmosphere.
+ */
+//****************************************************************************
+void
+METDensityTableStep::add_atmosphere (
+   METAtmosphere & atmosphere)
+{
+   atmosphere.prepare_density_table();
+   atmospheres.push_back (&atmosphere);
+   table_was_used.push_back (false);
+}
+
+//****************************************************************************
+// degrade:
+/**
+ * Records the atmospheres' settings and switches them to the table.
+ */
+//****************************************************************************
+void
+METDensityTableStep::degrade ()
+{
+   for (std::size_t ii = 0; ii < atmospheres.size(); ++ii) {
+      table_was_used[ii] = atmospheres[ii]->use_density_table;
+      atmospheres[ii]->use_density_table = true;
+   }
+}
+
+//****************************************************************************
+// restore:
+/**
+ * Reinstates the settings recorded by degrade.
+ */
+//****************************************************************************
+void
+METDensityTableStep::restore ()
+{
+   for (std::size_t ii = 0; ii < atmospheres.size(); ++ii) {
+      atmospheres[ii]->use_density_table = table_was_used[ii];
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -102,6 +102,23 @@ class Atmosphere {
    virtual void update_atmosphere( const PlanetFixedPosition * position,
                                    AtmosphereState           * state)    = 0;
 
+   /**
+    * Updates the atmosphere states at several positions, e.g. one per
+    * vehicle.  The default evaluates the positions one at a time; models
+    * override this to share work across the batch.
+    * \param[in] num_positions Number of positions and states
+    * \param[in] positions planet fixed positions
+    * \param[out] states The AtmosphereStates
+    */
+   virtual void update_atmosphere( unsigned int                      num_positions,
+                                   const PlanetFixedPosition * const * positions,
+                                   AtmosphereState           * const * states)
+   {
+      for (unsigned int ii = 0; ii < num_positions; ++ii) {
+         update_atmosphere (positions[ii], states[ii]);
+      }
+   }
+
   private:
    // operator = and copy constructor locked from use by being private
    Atmosphere& operator = (const Atmosphere& rhs);
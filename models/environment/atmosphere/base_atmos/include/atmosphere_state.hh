@@ -124,11 +124,31 @@ class AtmosphereState {
    void update_state (Atmosphere * atmos_model_, PlanetFixedPosition * pfix_pos_);
    virtual void update_state ();
 
+   /* Updates a group of atmosphere states, batching states that share a
+      model into calls to that model's batched update_atmosphere. */
+   static void update_states (unsigned int num_states,
+                              AtmosphereState * const * states);
+
+   /* As above, also updating the wind portion of each state from the
+      wind model in the same batches. */
+   static void update_states (unsigned int num_states,
+                              AtmosphereState * const * states,
+                              WindVelocity * wind_vel);
+
    /* Updates this particular atmosphere state from a particular wind model. */
 
    void update_wind (
       WindVelocity * wind_vel, double inrtl_pos[3], double altitude);
 
+  protected: // protected member functions
+
+   /* Updates one batch of states that share an atmosphere model. */
+   static void update_batch (Atmosphere * atmos_model,
+                             unsigned int num_states,
+                             const PlanetFixedPosition * const * positions,
+                             AtmosphereState * const * states,
+                             WindVelocity * wind_vel);
+
 };
 
 } // End JEOD namespace
@@ -0,0 +1,148 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/base_atmos/include/space_weather.hh
+ * Solar and geomagnetic activity indices for atmosphere models
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   (Provides the solar flux and geomagnetic indices used by atmosphere models,
+    either as fixed values or from a daily table, looked up once per time.)
+Library dependencies:
+   ((../src/space_weather.cc))
+
+*******************************************************************************/
+
+#ifndef JEOD_SPACE_WEATHER_HH
+#define JEOD_SPACE_WEATHER_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Solar and geomagnetic activity indices shared by the atmosphere models.
+ * Without table records, the current values are the user-set values.
+ * With records, update selects the record in effect at the given time; the
+ * lookup is done only when the time changes, so any number of models and
+ * vehicles can read the same SpaceWeather object each step.
+ */
+class SpaceWeather {
+
+   JEOD_MAKE_SIM_INTERFACES(SpaceWeather)
+
+public:
+
+   double F10;     /*!< trick_units(--)
+      Daily solar radio noise flux (F10.7), in solar flux units. */
+   double F10B;    /*!< trick_units(--)
+      Centered 81-day average of F10.7, in solar flux units. */
+   double ap;      /*!< trick_units(--)
+      Daily planetary geomagnetic index a_p. */
+   double kp;      /*!< trick_units(--)
+      Daily planetary geomagnetic index K_p. */
+
+   // Constructor
+   SpaceWeather ();
+
+   // Destructor
+   virtual ~SpaceWeather ();
+
+   // Add a daily record, in increasing order of time
+   void add_record (double trunc_julian_time,
+                    double F10_in,
+                    double F10B_in,
+                    double ap_in,
+                    double kp_in);
+
+   // Set the current values from the records in effect at a time
+   void update (double trunc_julian_time);
+
+   /**
+    * Number of daily records.
+    * @return Record count
+    */
+   unsigned int num_records () const
+   {
+      return static_cast<unsigned int> (record_time.size());
+   }
+
+private:
+
+   std::vector<double> record_time; /*!< trick_io(**)
+      Truncated Julian time at the start of each record. */
+   std::vector<double> record_F10;  /*!< trick_io(**) F10.7 of each record. */
+   std::vector<double> record_F10B; /*!< trick_io(**) F10B of each record. */
+   std::vector<double> record_ap;   /*!< trick_io(**) a_p of each record. */
+   std::vector<double> record_kp;   /*!< trick_io(**) K_p of each record. */
+
+   unsigned int cursor; /*!< trick_units(--)
+      Index of the record selected by the last lookup. */
+
+   bool updated; /*!< trick_units(--)
+      Whether update has selected a record since the records changed. */
+
+   double last_update_time; /*!< trick_units(day)
+      Time of the last lookup. */
+
+   // operator = and copy constructor locked from use by being private
+   SpaceWeather (const SpaceWeather& rhs);
+   SpaceWeather& operator = (const SpaceWeather& rhs);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -72,6 +72,11 @@ namespace jeod {
 
 /**
  * A generic wind velocity implementation.
+ *
+ * The wind is that of an atmosphere co-rotating with the planet, scaled by
+ * an altitude-dependent factor. Models of gridded or time-varying wind
+ * fields derive from this class and override both update_wind methods; the
+ * batched form is the one used by AtmosphereState::update_states.
  */
 class WindVelocity {
 
@@ -88,6 +93,12 @@ public:
    virtual void update_wind (
       double inertial_pos[3], double altitude, double wind_inertial[3]);
 
+   virtual void update_wind (
+      unsigned int num_positions,
+      double const * const position[3],
+      double const * altitude,
+      double * const wind[3]);
+
    unsigned int get_num_layers();
 
    void set_omega_scale_table(double altitude, double factor);
@@ -125,6 +136,9 @@ public:
    OmegaTableEntry* get_omega_scale_table();
 
 protected:
+
+   double get_omega_scale (double altitude);
+
    /**
     * Number of altitude layers.
     */
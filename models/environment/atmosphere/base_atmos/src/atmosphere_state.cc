@@ -22,16 +22,28 @@ PURPOSE:
 
 // JEOD includes
 
+#include "environment/planet/include/planet.hh"
 #include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
 
 // Model includes
 #include "../include/atmosphere_state.hh"
 #include "../include/wind_velocity.hh"
+#include "../include/atmosphere_messages.hh"
 
 
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Maximum number of states passed to a model in one batched call.
+ */
+const unsigned int State_batch_size = 64;
+
+} // End anonymous namespace
+
 /*****************************************************************************
 Constructors
 *****************************************************************************/
@@ -150,6 +162,135 @@ AtmosphereState::update_state ()
    }
 }
 
+/**
+ * Updates each of a group of atmosphere states from the model and position
+ * with which it was constructed.  Consecutive active states that share a
+ * model are passed to that model's batched update_atmosphere, so that the
+ * model can share work across them.
+ * \param[in] num_states Number of states in the array.
+ * \param[in,out] states The states to be updated.
+ */
+void
+AtmosphereState::update_states (
+   unsigned int              num_states,
+   AtmosphereState * const * states)
+{
+   update_states (num_states, states, nullptr);
+}
+
+
+/**
+ * Updates each of a group of atmosphere states as above, and when a wind
+ * model is supplied also updates the wind portion of the states.  The winds
+ * are evaluated in the same batches as the atmosphere, from the planet-fixed
+ * positions and elliptical altitudes, and are then rotated into the planet's
+ * inertial frame.
+ * \param[in] num_states Number of states in the array.
+ * \param[in,out] states The states to be updated.
+ * \param[in] wind_vel Wind velocity model; may be null.
+ */
+void
+AtmosphereState::update_states (
+   unsigned int              num_states,
+   AtmosphereState * const * states,
+   WindVelocity            * wind_vel)
+{
+   if (states == nullptr) {
+      MessageHandler::error(
+        __FILE__,__LINE__, AtmosphereMessages::framework_error,
+        "state array is NULL.  Cannot update states.\n");
+      return;
+   }
+
+   const PlanetFixedPosition * batch_pos[State_batch_size];
+   AtmosphereState * batch_states[State_batch_size];
+   Atmosphere * batch_model = nullptr;
+   unsigned int batch_count = 0;
+
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      AtmosphereState * state = states[ii];
+      if ((state == nullptr) || (! state->active) || (state->atmos == nullptr)) {
+         continue;
+      }
+      if ((batch_count > 0) &&
+          ((state->atmos != batch_model) ||
+           (batch_count == State_batch_size))) {
+         update_batch (
+            batch_model, batch_count, batch_pos, batch_states, wind_vel);
+         batch_count = 0;
+      }
+      batch_model = state->atmos;
+      batch_pos[batch_count]    = state->pfix_pos;
+      batch_states[batch_count] = state;
+      ++batch_count;
+   }
+
+   if (batch_count > 0) {
+      update_batch (batch_model, batch_count, batch_pos, batch_states, wind_vel);
+   }
+}
+
+
+/**
+ * Updates one batch of states that share an atmosphere model, followed by
+ * the winds at the same positions if a wind model is supplied.
+ * \param[in] atmos_model The atmosphere model shared by the states.
+ * \param[in] num_states Number of states, at most State_batch_size.
+ * \param[in] positions Planet-fixed positions of the states.
+ * \param[in,out] states The states to be updated.
+ * \param[in] wind_vel Wind velocity model; may be null.
+ */
+void
+AtmosphereState::update_batch (
+   Atmosphere                      * atmos_model,
+   unsigned int                      num_states,
+   const PlanetFixedPosition * const * positions,
+   AtmosphereState           * const * states,
+   WindVelocity                    * wind_vel)
+{
+   atmos_model->update_atmosphere (num_states, positions, states);
+
+   if ((wind_vel == nullptr) || (! wind_vel->active)) {
+      return;
+   }
+
+   double pos_x[State_batch_size];
+   double pos_y[State_batch_size];
+   double pos_z[State_batch_size];
+   double altitude[State_batch_size];
+   double wind_x[State_batch_size];
+   double wind_y[State_batch_size];
+   double wind_z[State_batch_size];
+   double const * const pos[3] = {pos_x, pos_y, pos_z};
+   double * const wind_pfix[3] = {wind_x, wind_y, wind_z};
+
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      pos_x[ii]    = positions[ii]->cart_coords[0];
+      pos_y[ii]    = positions[ii]->cart_coords[1];
+      pos_z[ii]    = positions[ii]->cart_coords[2];
+      altitude[ii] = positions[ii]->ellip_coords.altitude;
+   }
+
+   wind_vel->update_wind (num_states, pos, altitude, wind_pfix);
+
+   // The wind model may have deactivated itself on an error.
+   if (! wind_vel->active) {
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      double wind[3] = {wind_x[ii], wind_y[ii], wind_z[ii]};
+      const Planet * planet = positions[ii]->planet;
+      if (planet != nullptr) {
+         Vector3::transform_transpose (
+            planet->pfix.state.rot.T_parent_this, wind, states[ii]->wind);
+      }
+      else {
+         Vector3::copy (wind, states[ii]->wind);
+      }
+   }
+}
+
 
 /**
  * Updates the wind portion of the invoking atmosphere state,
@@ -0,0 +1,129 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/base_atmos/src/space_weather.cc
+ * Solar and geomagnetic activity indices for atmosphere models
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   ()
+Library dependencies:
+   ((space_weather.cc)
+    (atmosphere_messages.cc)
+    (utils/message/src/message_handler.cc))
+
+*******************************************************************************/
+
+#include "../include/space_weather.hh"
+#include "../include/atmosphere_messages.hh"
+#include "utils/math/include/sorted_table.hh"
+#include "utils/message/include/message_handler.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default Constructor
+ */
+
+SpaceWeather::SpaceWeather (
+   void)
+   :
+   F10(0.0),
+   F10B(0.0),
+   ap(0.0),
+   kp(0.0),
+   cursor(0),
+   updated(false),
+   last_update_time(0.0)
+{ }
+
+/**
+ * Destructor
+ */
+
+SpaceWeather::~SpaceWeather (
+   void)
+{ }
+
+/**
+ * Append a daily record.  Records must be added in increasing order of time;
+ * out-of-order records are rejected.
+ * \param[in] trunc_julian_time Start of the record\n Units: day
+ * \param[in] F10_in Daily F10.7
+ * \param[in] F10B_in 81-day average F10.7
+ * \param[in] ap_in Daily a_p
+ * \param[in] kp_in Daily K_p
+ */
+
+void
+SpaceWeather::add_record (
+   double trunc_julian_time,
+   double F10_in,
+   double F10B_in,
+   double ap_in,
+   double kp_in)
+{
+   if ((! record_time.empty()) && (trunc_julian_time <= record_time.back())) {
+      MessageHandler::error (
+         __FILE__, __LINE__, AtmosphereMessages::initialization_error,
+         "Space weather records must be added in increasing order of time.\n"
+         "The record at %f is ignored.\n", trunc_julian_time);
+      return;
+   }
+
+   record_time.push_back (trunc_julian_time);
+   record_F10.push_back (F10_in);
+   record_F10B.push_back (F10B_in);
+   record_ap.push_back (ap_in);
+   record_kp.push_back (kp_in);
+   updated = false;
+}
+
+/**
+ * Set the current indices to the record in effect at the given time, i.e.
+ * the last record starting at or before that time.  Times before the first
+ * record use the first record.  Does nothing if there are no records, or if
+ * the time is the same as at the previous call.
+ * \param[in] trunc_julian_time Current time\n Units: day
+ */
+
+void
+SpaceWeather::update (
+   double trunc_julian_time)
+{
+   if (record_time.empty() ||
+       (updated && (trunc_julian_time == last_update_time))) {
+      return;
+   }
+
+   unsigned int index = 0;
+   unsigned int size = num_records();
+   if (size > 1) {
+      cursor = SortedTable::find_interval (
+                  record_time.data(), size, trunc_julian_time, cursor);
+      index = (trunc_julian_time >= record_time[size-1]) ? size - 1 : cursor;
+   }
+
+   F10  = record_F10[index];
+   F10B = record_F10B[index];
+   ap   = record_ap[index];
+   kp   = record_kp[index];
+
+   updated          = true;
+   last_update_time = trunc_julian_time;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
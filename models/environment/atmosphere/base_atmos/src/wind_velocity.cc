@@ -94,6 +94,69 @@ WindVelocity::update_wind (
       return;
    }
 
+   // Scale omega by the proper scaling factor.
+   double omega_scaled = omega * get_omega_scale (altitude);
+
+   // Cross product of the omega vector and the target position vector
+   wind_inertial[0] = -omega_scaled * inertial_pos[1];
+   wind_inertial[1] =  omega_scaled * inertial_pos[0];
+   wind_inertial[2] =  0.0;
+}
+
+/**
+ * Updates the wind velocity at several positions, e.g. one per vehicle.
+ * The co-rotating wind is unchanged by rotations about the planet's polar
+ * axis, so the positions may be expressed in the planet inertial frame or
+ * in the planet-fixed frame; the winds are expressed in that same frame.
+ * \param[in] num_positions Number of positions
+ * \param[in] position Position components, one array per axis\n Units: M
+ * \param[in] altitude Altitudes of the positions\n Units: M
+ * \param[out] wind Wind components, one array per axis\n Units: M/s
+ */
+void
+WindVelocity::update_wind (
+   unsigned int num_positions,
+   double const * const position[3],
+   double const * altitude,
+   double * const wind[3])
+{
+   if (!active) {
+      return;
+   }
+
+   if (omega_scale_table == nullptr ||
+       position          == nullptr ||
+       altitude          == nullptr ||
+       wind              == nullptr) {
+      MessageHandler::error(
+         __FILE__,__LINE__, AtmosphereMessages::framework_error,
+         "One of the required pointers is NULL.\n"
+         "Wind cannot be computed.\n"
+         "Deactivating model to prevent this message repeating.\n");
+      active = false;
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < num_positions; ++ii) {
+      double omega_scaled = omega * get_omega_scale (altitude[ii]);
+
+      wind[0][ii] = -omega_scaled * position[1][ii];
+      wind[1][ii] =  omega_scaled * position[0][ii];
+      wind[2][ii] =  0.0;
+   }
+}
+
+
+/**
+ * Look up the factor by which omega is scaled at the given altitude,
+ * interpolating within the omega scale table.
+ * @return Scale factor\n Units: --
+ * \param[in] altitude Altitude\n Units: M
+ */
+double
+WindVelocity::get_omega_scale (
+   double altitude)
+{
    /* Value by which omega is scaled depending on alt. */
    double omega_scale = 0;
 
@@ -185,13 +248,7 @@ WindVelocity::update_wind (
       }
    }
 
-   // Scale omega by the proper scaling factor.
-   double omega_scaled = omega * omega_scale;
-
-   // Cross product of the omega vector and the target position vector
-   wind_inertial[0] = -omega_scaled * inertial_pos[1];
-   wind_inertial[1] =  omega_scaled * inertial_pos[0];
-   wind_inertial[2] =  0.0;
+   return omega_scale;
 }
 
 unsigned int WindVelocity::get_num_layers()
@@ -66,6 +66,8 @@ LIBRARY DEPENDENCY:
 #ifndef JEOD_EARTH_LIGHTING_HH
 #define JEOD_EARTH_LIGHTING_HH
 
+// System includes
+#include <vector>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/class_declarations.hh"
@@ -194,6 +196,13 @@ public:
 
    void calc_lighting (const double pos_veh[3]);
 
+   void calc_lighting (
+      unsigned int num_obs,
+      const double pos_obs[][3],
+      double * sun_lighting,
+      double * moon_lighting,
+      double * albedo_lighting);
+
    /**
     * flag for if the model is active or not
     */
@@ -265,6 +274,30 @@ protected:
     */
    double pos_sun[3]; //!< trick_units(m)
 
+   /**
+    * Scratch storage for the many-point calc_lighting
+    */
+   std::vector<double> batch_work; //!< trick_io(**)
+
+   void update_ephemeris (void);
+
+   void evaluate_observer (
+      const double pos_veh[3],
+      LightingBody & sun_obs,
+      LightingBody & moon_obs,
+      LightingBody & earth_obs,
+      LightingParams & sun_light,
+      LightingParams & moon_light,
+      LightingParams & albedo_light);
+
+   void evaluate_geometry (
+      const double pos_veh[3],
+      LightingBody & sun_obs,
+      LightingBody & moon_obs,
+      LightingBody & earth_obs,
+      LightingParams & sun_light,
+      LightingParams & moon_light);
+
 private:
 
    // copy constructor and operator = locked from use
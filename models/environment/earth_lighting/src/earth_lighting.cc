@@ -30,6 +30,7 @@ CLASS:
 LIBRARY DEPENDENCY:
     ((earth_lighting.cc)
      (earth_lighting_messages.cc)
+     (utils/math/src/occultation.cc)
      (utils/message/src/message_handler.cc))
 
 
@@ -43,6 +44,7 @@ LIBRARY DEPENDENCY:
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
 #include "environment/planet/include/planet.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/math/include/occultation.hh"
 #include "utils/math/include/vector3.hh"
 
 // Model includes
@@ -50,9 +52,6 @@ LIBRARY DEPENDENCY:
 #include "../include/earth_lighting_messages.hh"
 
 
-#define EPSILON 1.0e-12
-
-
 //! Namespace jeod
 namespace jeod {
 
@@ -154,7 +153,8 @@ EarthLighting::EarthLighting (
    sun(nullptr),
    earth_frame(nullptr),
    moon_frame(nullptr),
-   sun_frame(nullptr)
+   sun_frame(nullptr),
+   batch_work()
 {
    Vector3::initialize (pos_moon);
    Vector3::initialize (pos_sun);
@@ -270,8 +270,7 @@ PURPOSE:
 
 
 ASSUMPTIONS AND LIMITATIONS:
-    ((EPSILON comparison in if test help protect against a numerical
-      singularity for d_centers = 0.0 ))
+    ((See Occultation::circle_overlap_area))
 
 ******************************************************************************/
 int
@@ -282,195 +281,275 @@ EarthLighting::circle_intersect (
    double* area)
 {
 
-   double d_c2;
-   double r_t2;
-   double r_b2;
-   double diff_r2;
-   double top_ang;
-   double cos_top_ang;
-   double top_area;
-   double bottom_ang;
-   double cos_bottom_ang;
-   double bottom_area;
-
-   /***************************************************/
-   /* Quick check to see if circles are intersecting. */
-   /***************************************************/
+   *area = Occultation::circle_overlap_area (r_bottom, r_top, d_centers);
+
+   /* Return the intersection flag. */
    if (d_centers > r_bottom + r_top) {
+      return(0);
+   }
+   return(1);
 
-      /* Compute the area of intersection. */
-      *area = 0.0;
+}
 
-      /* Return negative intersection flag. */
-      return(0);
+/**
+ * Calculate earth lighting effects at the given position
+ * \param[in] pos_veh The position of the point of interest in the earth inertial frame\n Units: M
+ */
 
+void
+EarthLighting::calc_lighting (
+   const double pos_veh[3])
+{
+
+   if (active == false) {
+      return;
    }
 
-   /*************************************************************/
-   /* Check to see if one circle completely contains the other. */
-   /*************************************************************/
-   if (r_bottom > r_top) {
+   // Get the necessary relative positions
+   update_ephemeris ();
+
+   evaluate_observer (pos_veh,
+                      sun_body, moon_body, earth_body,
+                      sun_earth, moon_earth, earth_albedo);
 
-      /* Check to see if top circle is completely inside bottom circle. */
-      if (d_centers < (r_bottom - r_top) + EPSILON) {
+   return;
 
-         /* Area of intersection is entire top circle. */
-         *area = M_PI * r_top * r_top;
+}
 
-         /* Return positive intersection flag. */
-         return(1);
 
-      }
+/**
+ * Calculate earth lighting effects at many points of interest at once.
+ * The Sun and Moon positions are retrieved once for the whole set. The
+ * viewing geometry is then computed point by point, after which the Earth's
+ * occultation of the Sun and of the Moon is evaluated for all points with
+ * the batched Occultation kernel.
+ * The per-point results are identical to those that calc_lighting would
+ * produce for that point alone. The sun_body, moon_body, earth_body,
+ * sun_earth, moon_earth and earth_albedo members are not modified.
+ * \param[in] num_obs Number of points of interest
+ * \param[in] pos_obs The positions of the points of interest in the
+ *            earth inertial frame\n Units: M
+ * \param[out] sun_lighting Sun lighting fraction per point, or NULL
+ * \param[out] moon_lighting Moon lighting fraction per point, or NULL
+ * \param[out] albedo_lighting Earth albedo lighting per point, or NULL
+ */
+
+void
+EarthLighting::calc_lighting (
+   unsigned int num_obs,
+   const double pos_obs[][3],
+   double * sun_lighting,
+   double * moon_lighting,
+   double * albedo_lighting)
+{
 
+   if ((active == false) || (num_obs == 0)) {
+      return;
    }
-   else {
 
-      /* Check to see if top circle completely covers bottom circle. */
-      if (d_centers < (r_top - r_bottom) + EPSILON) {
+   // Get the necessary relative positions, once for all points.
+   update_ephemeris ();
+
+   // Scratch copies of the observer-dependent state, seeded with the
+   // observer-independent radii.
+   LightingBody obs_sun;
+   LightingBody obs_moon;
+   LightingBody obs_earth;
+   LightingParams obs_sun_earth;
+   LightingParams obs_moon_earth;
+
+   obs_sun.radius       = sun_body.radius;
+   obs_moon.radius      = moon_body.radius;
+   obs_earth.radius     = earth_body.radius;
+
+   // Per-point geometry: apparent half angles and observation angles,
+   // followed by the occluded fractions of the Sun and Moon.
+   batch_work.resize (7 * static_cast<std::size_t> (num_obs));
+   double * sun_half   = &batch_work[0];
+   double * moon_half  = sun_half + num_obs;
+   double * earth_half = moon_half + num_obs;
+   double * sun_ang    = earth_half + num_obs;
+   double * moon_ang   = sun_ang + num_obs;
+   double * sun_occ    = moon_ang + num_obs;
+   double * moon_occ   = sun_occ + num_obs;
+
+   for (unsigned int iobs = 0; iobs < num_obs; ++iobs) {
+      evaluate_geometry (pos_obs[iobs],
+                         obs_sun, obs_moon, obs_earth,
+                         obs_sun_earth, obs_moon_earth);
+      sun_half[iobs]   = obs_sun.half_angle;
+      moon_half[iobs]  = obs_moon.half_angle;
+      earth_half[iobs] = obs_earth.half_angle;
+      sun_ang[iobs]    = obs_sun_earth.obs_angle;
+      moon_ang[iobs]   = obs_moon_earth.obs_angle;
+   }
 
-         /* Area of intersection is entire bottom circle. */
-         *area = M_PI * r_bottom * r_bottom;
+   /* Determine how much the earth occludes the sun and the moon. */
+   /* Note: these represent arc-lengths on a unit sphere. */
+   Occultation::occluded_fraction (
+      num_obs, sun_half, earth_half, sun_ang, sun_occ);
+   Occultation::occluded_fraction (
+      num_obs, moon_half, earth_half, moon_ang, moon_occ);
 
-         /* Return positive intersection flag. */
-         return(1);
+   for (unsigned int iobs = 0; iobs < num_obs; ++iobs) {
+      double sun_light = sun_earth.phase * (1.0 - sun_occ[iobs]);
 
+      if (sun_lighting != NULL) {
+         sun_lighting[iobs] = sun_light;
+      }
+      if (moon_lighting != NULL) {
+         moon_lighting[iobs] = moon_earth.phase * (1.0 - moon_occ[iobs]);
+      }
+      if (albedo_lighting != NULL) {
+         albedo_lighting[iobs] = fabs (sun_ang[iobs] / M_PI) * sun_light;
       }
-
    }
 
-   /*********************************************************************/
-   /* Compute the area of intersection of the two overlappping circles. */
-   /*********************************************************************/
-
-   /* Compute working variables. */
-   d_c2    = d_centers * d_centers;
-   r_t2    = r_top * r_top;
-   r_b2    = r_bottom * r_bottom;
-   diff_r2 = r_b2 - r_t2;
-
-   /* Compute the bottom intersection angle (law of cosines). */
-   cos_bottom_ang = (d_c2 + diff_r2) / (2.0 * d_centers * r_bottom);
-   bottom_ang     = acos (cos_bottom_ang);
+   return;
 
-   /* Compute the top intersection angles (law of cosines). */
-   cos_top_ang = (d_c2 - diff_r2) / (2.0 * d_centers * r_top);
-   top_ang     = acos (cos_top_ang);
+}
 
-   /* Compute the area of intersection. */
-   top_area    = r_t2 * (top_ang    - (sin (top_ang) * cos_top_ang));
-   bottom_area = r_b2 * (bottom_ang - (sin (bottom_ang) * cos_bottom_ang));
-   *area       = top_area + bottom_area;
 
-   /* Return a positive for intersection. */
-   return(1);
+/**
+ * Retrieve the Sun and Moon positions with respect to Earth inertial.
+ */
 
+void
+EarthLighting::update_ephemeris (
+   void)
+{
+   sun_frame->compute_position_from (*earth_frame, pos_sun);
+   moon_frame->compute_position_from (*earth_frame, pos_moon);
 }
 
+
 /**
- * Calculate earth lighting effects at the given position
+ * Evaluate the lighting geometry for a single point of interest, using the
+ * Sun and Moon positions cached by update_ephemeris.
  * \param[in] pos_veh The position of the point of interest in the earth inertial frame\n Units: M
+ * \param[in,out] sun_obs Sun geometry; radius is an input
+ * \param[in,out] moon_obs Moon geometry; radius is an input
+ * \param[in,out] earth_obs Earth geometry; radius is an input
+ * \param[in,out] sun_light Sun lighting; phase is an input
+ * \param[in,out] moon_light Moon lighting; phase is an input
+ * \param[out] albedo_light Earth albedo lighting
  */
 
 void
-EarthLighting::calc_lighting (
-   const double pos_veh[3])
+EarthLighting::evaluate_observer (
+   const double pos_veh[3],
+   LightingBody & sun_obs,
+   LightingBody & moon_obs,
+   LightingBody & earth_obs,
+   LightingParams & sun_light,
+   LightingParams & moon_light,
+   LightingParams & albedo_light)
 {
+   evaluate_geometry (pos_veh,
+                      sun_obs, moon_obs, earth_obs,
+                      sun_light, moon_light);
 
-   if (active == false) {
-      return;
-   }
+   /* Determine how much the earth occludes the sun. */
+   /* Note: these represent arc-lengths on a unit sphere. */
+   sun_light.occlusion = Occultation::occluded_fraction (
+                            sun_obs.half_angle,
+                            earth_obs.half_angle,
+                            sun_light.obs_angle);
 
-   int iinc;
+   /* Compute the sun lighting from the eclipse area. */
+   sun_light.visible  = 1.0 - sun_light.occlusion;
+   sun_light.lighting = sun_light.phase * sun_light.visible;
+
+   /* Determine how much the earth occludes the moon. */
+   /* Note: these represent arc-lengths on a unit sphere. */
+   moon_light.occlusion = Occultation::occluded_fraction (
+                             moon_obs.half_angle,
+                             earth_obs.half_angle,
+                             moon_light.obs_angle);
+
+   /* Compute the moon lighting from the eclipse area. */
+   moon_light.visible = 1.0 - moon_light.occlusion;
+
+   /* Apply further scaling by apparent lunar phase. */
+   moon_light.lighting = moon_light.phase * moon_light.visible;
+
+   /* Crude approximation for Earth albedo. */
+   albedo_light.lighting  = fabs (sun_light.obs_angle / M_PI);
+   albedo_light.lighting *= sun_light.lighting;
+
+   return;
+
+}
 
-   double eclipse_area;
+
+/**
+ * Compute the apparent positions, distances and half angles of the Sun,
+ * Moon and Earth seen from a point of interest, and the observation angles
+ * between the Earth and the light sources.
+ * \param[in] pos_veh The position of the point of interest in the earth inertial frame\n Units: M
+ * \param[in,out] sun_obs Sun geometry; radius is an input
+ * \param[in,out] moon_obs Moon geometry; radius is an input
+ * \param[in,out] earth_obs Earth geometry; radius is an input
+ * \param[out] sun_light Sun observation angle
+ * \param[out] moon_light Moon observation angle
+ */
+
+void
+EarthLighting::evaluate_geometry (
+   const double pos_veh[3],
+   LightingBody & sun_obs,
+   LightingBody & moon_obs,
+   LightingBody & earth_obs,
+   LightingParams & sun_light,
+   LightingParams & moon_light)
+{
+   int iinc;
 
    double cross_prod[3];
    double cross_mag;
    double cos_obs_ang;
    double sin_obs_ang;
 
-   // Get the necessary relative positions
-   sun_frame->compute_position_from (*earth_frame, pos_sun);
-   moon_frame->compute_position_from (*earth_frame, pos_moon);
-
    /* Compute the relative positions of the celestial bodies. */
    for (iinc = 0; iinc < 3; iinc++) {
-      moon_body.position[ iinc ]  = pos_moon[ iinc ] - pos_veh[ iinc ];
-      sun_body.position[ iinc ]   = pos_sun[ iinc ] - pos_veh[ iinc ];
-      earth_body.position[ iinc ] = -pos_veh[ iinc ];
+      moon_obs.position[ iinc ]  = pos_moon[ iinc ] - pos_veh[ iinc ];
+      sun_obs.position[ iinc ]   = pos_sun[ iinc ] - pos_veh[ iinc ];
+      earth_obs.position[ iinc ] = -pos_veh[ iinc ];
    }
 
    /* Compute the distance to the celestial bodies. */
-   moon_body.distance  = Vector3::vmag (moon_body.position);
-   sun_body.distance   = Vector3::vmag (sun_body.position);
-   earth_body.distance = Vector3::vmag (earth_body.position);
+   moon_obs.distance  = Vector3::vmag (moon_obs.position);
+   sun_obs.distance   = Vector3::vmag (sun_obs.position);
+   earth_obs.distance = Vector3::vmag (earth_obs.position);
 
    /* Compute the apparent half angles of the celestial bodies. */
-   moon_body.half_angle = asin (moon_body.radius / moon_body.distance);
-   sun_body.half_angle  = asin (sun_body.radius / sun_body.distance);
-   if (earth_body.distance >= earth_body.radius) {
-      earth_body.half_angle = asin (earth_body.radius / earth_body.distance);
+   moon_obs.half_angle = asin (moon_obs.radius / moon_obs.distance);
+   sun_obs.half_angle  = asin (sun_obs.radius / sun_obs.distance);
+   if (earth_obs.distance >= earth_obs.radius) {
+      earth_obs.half_angle = asin (earth_obs.radius / earth_obs.distance);
    }
    else {
-      earth_body.half_angle = M_PI_2;
+      earth_obs.half_angle = M_PI_2;
    }
 
    /**********************************************************************/
    /* Compute the observation angle between the earth and light sources. */
    /**********************************************************************/
    /* Moon */
-//   cos_obs_ang =    V_DOT( moon_body.position, earth_body.position )
-//                  / ( moon_body.distance* earth_body.distance );
-   cos_obs_ang = Vector3::dot (moon_body.position, earth_body.position) /
-                 (moon_body.distance * earth_body.distance);
-   // V_CROSS( cross_prod, moon_body.position, earth_body.position );
-   Vector3::cross (moon_body.position, earth_body.position, cross_prod);
+   cos_obs_ang = Vector3::dot (moon_obs.position, earth_obs.position) /
+                 (moon_obs.distance * earth_obs.distance);
+   Vector3::cross (moon_obs.position, earth_obs.position, cross_prod);
    cross_mag            = Vector3::vmag (cross_prod);
-   sin_obs_ang          = cross_mag / (moon_body.distance * earth_body.distance);
-   moon_earth.obs_angle = atan2 (sin_obs_ang, cos_obs_ang);
+   sin_obs_ang          = cross_mag / (moon_obs.distance * earth_obs.distance);
+   moon_light.obs_angle = atan2 (sin_obs_ang, cos_obs_ang);
 
    /* Sun */
-//   cos_obs_ang =   V_DOT( sun_body.position, earth_body.position )
-//                 / ( sun_body.distance* earth_body.distance );
-   cos_obs_ang = Vector3::dot (sun_body.position, earth_body.position) /
-                 (sun_body.distance * earth_body.distance);
-//    V_CROSS( cross_prod, sun_body.position, earth_body.position );
-   Vector3::cross (sun_body.position, earth_body.position, cross_prod);
+   cos_obs_ang = Vector3::dot (sun_obs.position, earth_obs.position) /
+                 (sun_obs.distance * earth_obs.distance);
+   Vector3::cross (sun_obs.position, earth_obs.position, cross_prod);
    cross_mag           = Vector3::vmag (cross_prod);
-   sin_obs_ang         = cross_mag / (sun_body.distance * earth_body.distance);
-   sun_earth.obs_angle = atan2 (sin_obs_ang, cos_obs_ang);
-
-   /* Determine if earth occludes the sun. */
-   /* Note: these represent arc-lengths on a unit sphere. */
-   circle_intersect (sun_body.half_angle,
-                     earth_body.half_angle,
-                     sun_earth.obs_angle,
-                     &eclipse_area);
-
-   /* Compute the sun lighting from the eclipse area. */
-   sun_earth.occlusion =
-      eclipse_area / (sun_body.half_angle * sun_body.half_angle * M_PI);
-   sun_earth.visible  = 1.0 - sun_earth.occlusion;
-   sun_earth.lighting = sun_earth.phase * sun_earth.visible;
-
-   /* Determine if earth occludes the moon. */
-   /* Note: these represent arc-lengths on a unit sphere. */
-   circle_intersect (moon_body.half_angle,
-                     earth_body.half_angle,
-                     moon_earth.obs_angle,
-                     &eclipse_area);
-
-   /* Compute the moon lighting from the eclipse area. */
-   moon_earth.occlusion =
-      eclipse_area / (moon_body.half_angle * moon_body.half_angle * M_PI);
-   moon_earth.visible = 1.0 - moon_earth.occlusion;
-
-   /* Apply further scaling by apparent lunar phase. */
-   moon_earth.lighting = moon_earth.phase * moon_earth.visible;
-
-   /* Crude approximation for Earth albedo. */
-   earth_albedo.lighting  = fabs (sun_earth.obs_angle / M_PI);
-   earth_albedo.lighting *= sun_earth.lighting;
+   sin_obs_ang         = cross_mag / (sun_obs.distance * earth_obs.distance);
+   sun_light.obs_angle = atan2 (sin_obs_ang, cos_obs_ang);
 
    return;
 
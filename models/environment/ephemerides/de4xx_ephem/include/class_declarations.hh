@@ -72,6 +72,7 @@ namespace jeod {
 
 class De4xxEphemeris;
 class De4xxEphemItem;
+class De4xxEphemUpdate;
 class De4xxFile;
 class De4xxFileCoef;
 class De4xxFileHeader;
@@ -188,6 +188,64 @@ protected:
 };
 
 
+/**
+ * Describes how ephem_update sets the state of one active ephemeris point
+ * from the ephemeris file. The records are resolved when the model is
+ * activated so that the update loop does no type or status tests.
+ * This class is only used inside the De4xxEphemeris class as the type
+ * of the protected update_records data member.
+ */
+class De4xxEphemUpdate {
+JEOD_MAKE_SIM_INTERFACES(De4xxEphemUpdate)
+
+   friend class De4xxEphemeris;
+
+public:
+
+   // Member functions
+
+   // Default constructor
+   De4xxEphemUpdate (void);
+
+   // Destructor
+   ~De4xxEphemUpdate (void);
+
+
+protected:
+
+   // Member data
+
+   /**
+    * The point whose state is set.
+    */
+   EphemerisPoint * point; //!< trick_units(--)
+
+   /**
+    * The file item that supplies the state, per De4xxBase::De4xxFileEntries.
+    */
+   unsigned int file_index; //!< trick_units(--)
+
+   /**
+    * Scale factor applied to the file item state.
+    */
+   double scale; //!< trick_units(--)
+
+
+ // Make the copy constructor and assignment operator private
+ // (and unimplemented) to avoid erroneous copies
+ private:
+   /**
+    * Not implemented.
+    */
+   De4xxEphemUpdate (const De4xxEphemUpdate &);
+
+   /**
+    * Not implemented.
+    */
+   De4xxEphemUpdate & operator= (const De4xxEphemUpdate &);
+};
+
+
 /**
  * The S_define-level class that provides planetary ephemerides.
  * The De4xxEphemeris class constructs the ephemeris reference frame tree and
@@ -222,6 +280,15 @@ public:
    // Propagate the lunar orientation
    void propagate_lunar_rnp (void);
 
+   /**
+    * Select the quaternion-based lunar orientation update.
+    * See EphemerisZXZOrientation::quaternion_update.
+    */
+   void set_lunar_quaternion_update (bool enable)
+   {
+      lunar_orientation.quaternion_update = enable;
+   }
+
    // Close the model (free resources)
    void shutdown (void);
 
@@ -244,9 +311,17 @@ public:
 
    void ephem_update (void) override;
 
+   void add_snapshot_regions (StateSnapshot & snapshot) override;
+
    // Check whether the time is represented in the ephemeris file
    bool time_is_in_range (void) const;
 
+   // Compute body states at a set of times without updating the model
+   void query_states (
+      unsigned int num_times, const double * times,
+      unsigned int num_bodies, const unsigned int * bodies,
+      double (* states)[2][3]) const;
+
    /**
     * Set ephemeris model number.
     * This number is used to specify the de file to use
@@ -360,6 +435,21 @@ protected:
     */
    De4xxEphemItem * root_item; //!< trick_units(--)
 
+   /**
+    * The root point if it is owned by this model, null otherwise.
+    */
+   EphemerisPoint * root_point; //!< trick_units(--)
+
+   /**
+    * The per-point update records, one per active translational point.
+    */
+   De4xxEphemUpdate * update_records; //!< trick_units(--)
+
+   /**
+    * Number of valid entries in update_records.
+    */
+   unsigned int nupdate_records; //!< trick_units(--)
+
    /**
     * The source of ephemeris time information
     */
@@ -398,6 +488,9 @@ private:
    // Determine which node should be the root of the ref frame tree
    void determine_root_node (void);
 
+   // Build the update records for the active points
+   void build_update_records (void);
+
 
    // Make the copy constructor and assignment operator private
    // (and unimplemented) to avoid erroneous copies
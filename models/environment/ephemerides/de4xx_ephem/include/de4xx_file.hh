@@ -65,7 +65,10 @@ Assumptions and limitations:
     IEEE-standard doubles))
 
 Library dependencies:
-  ((../src/de4xx_file.cc))
+  ((../src/de4xx_file.cc)
+   (../src/de4xx_file_binary.cc)
+   (../src/de4xx_file_shared.cc)
+   (../src/de4xx_file_query.cc))
 
 
 
@@ -88,6 +91,7 @@ Library dependencies:
 
 // Model includes
 #include "de4xx_base.hh"
+#include "de4xx_file_prefetch.hh"
 
 
 //! Namespace jeod
@@ -197,6 +201,14 @@ JEOD_MAKE_SIM_INTERFACES(De4xxFileSpec)
 
  public:
 
+   /**
+    * Identifies the form in which the ephemeris data are provided.
+    */
+   enum FileFormat {
+      SharedLibrary = 0, ///< Shared library generated from the ASCII files
+      JplBinary     = 1  ///< JPL binary ephemeris file, memory mapped
+   };
+
    // Member functions
    // Note: The copy constructor and assignment operator are deleted.
 
@@ -219,6 +231,29 @@ JEOD_MAKE_SIM_INTERFACES(De4xxFileSpec)
        return denum;
    }
 
+   // Use a JPL binary ephemeris file rather than a shared library.
+   void set_binary_file (const std::string & file_name);
+
+   // Set the directory that holds the ephemeris file.
+   void set_file_directory (const std::string & dir_name);
+
+   /**
+    * Get the ephemeris file format.
+    */
+   FileFormat get_file_format() const {
+       return file_format;
+   }
+
+   /**
+    * Enable or disable the node-wide shared-memory segment cache.
+    * When enabled, each segment of a shared library ephemeris is copied once
+    * into a POSIX shared memory object that all processes on the node using
+    * the same DE model map read-only.
+    */
+   void set_shared_segment_cache (bool enable) {
+       shared_segment_cache = enable;
+   }
+
 protected:
 
    // Member data
@@ -240,6 +275,16 @@ protected:
     */
    std::string ephem_file_name; //!< trick_units(--)
 
+   /**
+    * Ephemeris file format
+    */
+   FileFormat file_format; //!< trick_units(--)
+
+   /**
+    * Serve shared library segments from POSIX shared memory
+    */
+   bool shared_segment_cache; //!< trick_units(--)
+
    // Internally-computed items (visible for logging and checkpoint)
    /**
     * Ephemeris file path name
@@ -332,10 +377,41 @@ class De4xxFileIO {
 
 protected:
    /**
-    * The dl handle for the ephemeris shared object.
+    * The dl handle for the ephemeris shared object, or the address at which
+    * a JPL binary file is mapped.
     */
    void * file; //!< trick_units(--) trick_io(**)
 
+   /**
+    * Size of the mapped JPL binary file.
+    */
+   std::size_t map_size; //!< trick_units(--) trick_io(**)
+
+   /**
+    * Data set metadata parsed from a JPL binary file header.
+    */
+   EphemerisDataSetMeta binary_meta; //!< trick_units(--) trick_io(**)
+
+   /**
+    * Item metadata parsed from a JPL binary file header.
+    */
+   EphemerisDataItemMeta binary_items[De4xxBase::De4xx_File_MaxEntries]; //!< trick_units(--) trick_io(**)
+
+   /**
+    * The single segment of a JPL binary file.
+    */
+   EphemerisDataSegmentMeta binary_segment; //!< trick_units(--) trick_io(**)
+
+   /**
+    * Address of the mapped shared-memory copy of the current segment.
+    */
+   void * shared_segment_addr; //!< trick_units(--) trick_io(**)
+
+   /**
+    * Size of the mapped shared-memory copy of the current segment.
+    */
+   std::size_t shared_segment_size; //!< trick_units(--) trick_io(**)
+
 
  // Member functions
 
@@ -462,6 +538,12 @@ class De4xxFileItem {
     */
    double  update_time; //!< trick_units(s)
 
+   /**
+    * Index of the Chebychev polynomial slot shared by all items
+    * with the same number of sub-intervals per record
+    */
+   uint32_t cheby_slot; //!< trick_units(--)
+
    /**
     * State data (zeroth, first derivative)
     */
@@ -536,6 +618,10 @@ class De4xxFileRefTime {
 
 /**
  * Contains Chebychev polynomial coefficients and terms.
+ * The polynomials depend only on the fraction of the sub-interval, which is
+ * the same for all items with the same number of sub-intervals per record.
+ * Each such group of items has a slot that holds the polynomials evaluated
+ * at the group's most recent fraction.
  */
 class De4xxFileCoef {
 
@@ -548,17 +634,22 @@ class De4xxFileCoef {
 
 protected:
    /**
-    * No. Chebychev polynomials terms
+    * No. Chebychev polynomial slots
     */
-   JEOD_SIZE_T chebyterms; //!< trick_units(--)
+   JEOD_SIZE_T nslots; //!< trick_units(--)
 
    /**
-    * Chebychev x value
+    * No. Chebychev polynomials terms, per slot
     */
-   double chebyx; //!< trick_units(--)
+   uint32_t * chebyterms; //!< trick_units(--)
 
    /**
-    * Chebychev polynomial coeffs
+    * Chebychev x value, per slot
+    */
+   double * chebyx; //!< trick_units(--)
+
+   /**
+    * Chebychev polynomial values; slot i starts at element i*max_terms
     */
    double * chebypoly; //!< trick_units(--)
 
@@ -587,6 +678,74 @@ protected:
 };
 
 
+/**
+ * Holds the item states most recently computed by De4xxFile::update,
+ * keyed by time. Multi-stage integrators and multiple integration groups
+ * request ephemerides at a small set of recurring times; an update at one of
+ * those times restores the saved states rather than re-evaluating the series.
+ * The least recently used entry is replaced when the cache is full.
+ */
+class De4xxFileStateCache {
+
+ JEOD_MAKE_SIM_INTERFACES(De4xxFileStateCache)
+
+ friend class De4xxFile;
+
+ // Member data
+ public:
+
+   /**
+    * Number of entries; zero disables the cache. Must be set before the
+    * De4xxFile is initialized.
+    */
+   uint32_t size; //!< trick_units(count)
+
+protected:
+   /**
+    * Number of file items per entry
+    */
+   uint32_t nitems; //!< trick_units(--)
+
+   /**
+    * Use counter, incremented on each lookup
+    */
+   uint64_t clock; //!< trick_units(--)
+
+   /**
+    * Time of each entry
+    */
+   double * time; //!< trick_units(s)
+
+   /**
+    * Value of clock when each entry was last used; zero if empty
+    */
+   uint64_t * last_use; //!< trick_units(--)
+
+   /**
+    * Which items each entry holds, nitems per entry
+    */
+   bool * active; //!< trick_units(--)
+
+   /**
+    * Item states, nitems*6 per entry (zeroth, first derivative)
+    */
+   double * states; //!< trick_units(--)
+
+
+ // Member functions
+
+ // Make the copy constructor and assignment operator private
+ // (and unimplemented) to avoid erroneous copies
+ private:
+   De4xxFileStateCache (const De4xxFileStateCache &);
+   De4xxFileStateCache & operator= (const De4xxFileStateCache &);
+
+ public:
+   // Default constructor
+   De4xxFileStateCache (void);
+};
+
+
 /**
  * The FILE pointer in a De4xxFileIO cannot be restored by Trick.
  * This class provides that essential restart mechanism.
@@ -643,6 +802,12 @@ public:
    // Update the object
    void update (double time);
 
+   // Compute item states at a set of times without changing the object
+   void query_states (
+      unsigned int num_times, const double * times,
+      unsigned int num_items, const unsigned int * items,
+      double (* states)[2][3]) const;
+
    // Shut down
    void shutdown ();
 
@@ -679,6 +844,16 @@ public:
     */
    De4xxFileCoef coef; //!< trick_units(--)
 
+   /**
+    * Recently computed states
+    */
+   De4xxFileStateCache state_cache; //!< trick_units(--)
+
+   /**
+    * Background loader of upcoming records
+    */
+   De4xxFilePrefetcher prefetcher; //!< trick_units(--)
+
    /**
     * Restart handler
     */
@@ -699,6 +874,17 @@ public:
     */
    double resident_set; //!< trick_units(--)
 
+   /*
+    * Resident memory shared with other processes (file-backed and
+    * shared memory pages)
+    */
+   double shared_set; //!< trick_units(--)
+
+   /*
+    * Resident memory private to this process
+    */
+   double private_set; //!< trick_units(--)
+
    /*
     * Flag to enable/disable memory logging and output
     */
@@ -710,12 +896,32 @@ private:
 
    void open (void);
 
+   void open_binary (void);
+
    void reopen (void);
 
    void close (void);
 
+   void close_binary (void);
+
+   void map_shared_segment (void);
+
+   void unmap_shared_segment (void);
+
+   void prefetch_records (uint32_t recno, uint32_t previous_recno);
+
+   void assign_cheby_slots (void);
+
+   void allocate_state_cache (void);
+
+   bool fetch_cached_states (double time);
+
+   void save_cached_states (double time);
+
    void interpolate (double time, double fblk);
 
+   const double * query_segment (uint32_t segment) const;
+
 
    // Make the copy constructor and assignment operator private
    // (and unimplemented) to avoid erroneous copies
@@ -0,0 +1,181 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Ephemerides
+ * @{
+ * @addtogroup De4xxEphem
+ * @{
+ *
+ * @file models/environment/ephemerides/de4xx_ephem/include/de4xx_file_prefetch.hh
+ * Define the De4xxFilePrefetcher class, which brings ephemeris records
+ * into memory on a background thread.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/de4xx_file_prefetch.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DE4xx_FILE_PREFETCH_HH
+#define JEOD_DE4xx_FILE_PREFETCH_HH
+
+// System includes
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A De4xxFilePrefetcher touches the pages of a requested range of
+ * coefficients on a worker thread, so that the page faults of a memory
+ * mapped or demand-paged ephemeris are taken off the simulation thread.
+ * Only the most recent request is kept; requests never block.
+ */
+class De4xxFilePrefetcher {
+JEOD_MAKE_SIM_INTERFACES(De4xxFilePrefetcher)
+
+public:
+
+   // Constructor and destructor.
+   De4xxFilePrefetcher ();
+   ~De4xxFilePrefetcher ();
+
+   // Request that a range of coefficients be brought into memory.
+   void request (const double * begin, std::size_t count);
+
+   // Drop any pending request and wait for the worker to become idle.
+   void cancel ();
+
+
+   /**
+    * Whether requests are honored. The worker thread is started by the
+    * first request made while enabled.
+    */
+   bool enabled; //!< trick_units(--)
+
+
+private:
+
+   // Worker thread main loop.
+   void worker_loop ();
+
+   // Touch each page of a range.
+   static void touch (const double * begin, std::size_t count);
+
+
+   /**
+    * The worker thread.
+    */
+   std::thread worker; //!< trick_io(**)
+
+   /**
+    * Guards the members below.
+    */
+   std::mutex mutex; //!< trick_io(**)
+
+   /**
+    * Signals the worker that a request (or shutdown) is available.
+    */
+   std::condition_variable request_cond; //!< trick_io(**)
+
+   /**
+    * Signals cancel that the worker is idle.
+    */
+   std::condition_variable idle_cond; //!< trick_io(**)
+
+   /**
+    * Start of the pending request, null if none.
+    */
+   const double * pending_begin; //!< trick_io(**)
+
+   /**
+    * Number of coefficients in the pending request.
+    */
+   std::size_t pending_count; //!< trick_io(**)
+
+   /**
+    * Set while the worker is touching a range.
+    */
+   bool busy; //!< trick_io(**)
+
+   /**
+    * Set to tell the worker to exit.
+    */
+   bool shutdown; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   De4xxFilePrefetcher (const De4xxFilePrefetcher &);
+
+   /**
+    * Not implemented.
+    */
+   De4xxFilePrefetcher & operator= (const De4xxFilePrefetcher &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -49,12 +49,14 @@ LIBRARY DEPENDENCY:
 (environment/time/src/time_manager.cc)
 (environment/time/src/time_tt.cc)
 (utils/memory/src/memory_manager_static.cc)
+(utils/memory/src/state_snapshot.cc)
 (utils/message/src/message_handler.cc)
 (utils/named_item/src/named_item.cc)
 (utils/ref_frames/src/ref_frame.cc)
 (utils/ref_frames/src/ref_frame_manager.cc)
 (utils/ref_frames/src/ref_frame_set_name.cc)
-(utils/ref_frames/src/subscription.cc))
+(utils/ref_frames/src/subscription.cc)
+(utils/sim_interface/src/jeod_profiler.cc))
 
 
 *******************************************************************************/
@@ -65,6 +67,7 @@ LIBRARY DEPENDENCY:
 #include <cstdio>
 #include <climits>
 #include <sstream>
+#include <vector>
 
 // JEOD includes
 #include "environment/ephemerides/ephem_interface/include/ephem_messages.hh"
@@ -76,8 +79,10 @@ LIBRARY DEPENDENCY:
 #include "utils/named_item/include/named_item.hh"
 #include "utils/math/include/vector3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/math/include/numerical.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/de4xx_ephem.hh"
@@ -113,6 +118,30 @@ De4xxEphemItem::~De4xxEphemItem (
 }
 
 
+/**
+ * De4xxEphemUpdate default constructor.
+ */
+De4xxEphemUpdate::De4xxEphemUpdate (
+   void)
+:
+   point(nullptr),
+   file_index(0),
+   scale(1.0)
+{
+   ; // Empty (intialization list does all)
+}
+
+
+/**
+ * De4xxEphemUpdate destructor.
+ */
+De4xxEphemUpdate::~De4xxEphemUpdate (
+   void)
+{
+   ; // Empty
+}
+
+
 
 /**
  * De4xxEphemeris default constructor.
@@ -127,10 +156,15 @@ De4xxEphemeris::De4xxEphemeris (
    ident(nullptr),
    update_time(-99e99),
    root_item(nullptr),
+   root_point(nullptr),
+   update_records(nullptr),
+   nupdate_records(0),
    time_tt(nullptr),
    time_dyn(nullptr)
 {
    item_data = JEOD_ALLOC_CLASS_ARRAY( De4xxBase::number_jeod_items(999), De4xxEphemItem );
+   update_records = JEOD_ALLOC_CLASS_ARRAY( De4xxBase::number_trans_points(999),
+                                            De4xxEphemUpdate );
 
    // Set the mapping from De4xxEphemBodies numbers to De4xxFileBodies numbers.
    body_to_file_idx = JEOD_ALLOC_PRIM_ARRAY(
@@ -223,6 +257,7 @@ De4xxEphemeris::~De4xxEphemeris (
    JEOD_DELETE_ARRAY(body_to_file_idx);
    JEOD_DELETE_ARRAY(selected_items);
    JEOD_DELETE_ARRAY(item_data);
+   JEOD_DELETE_ARRAY(update_records);
    JEOD_DELETE_ARRAY(points);
 }
 
@@ -384,6 +419,8 @@ void
 De4xxEphemeris::initialize_file (
    void)
 {
+   JEOD_PROFILE_SCOPE ("ephemerides", "De4xxEphemeris::initialize_file");
+
    double epoch_time;                  // day Julian date
    double time_offset;                 // s   Terrestrial Time offset
    double init_time;                   // day Days from epoch
@@ -692,7 +729,7 @@ De4xxEphemeris::determine_root_node (
    if (root_index >= 0) {
       root_item = &item_data[root_index];
       if (root_item->item == root_item->enabled_item) {
-         (dynamic_cast<EphemerisPoint*>(root_item->item))->initialize_state ();
+         points[root_index].initialize_state ();
          nactive_items--;
       }
       root_item->status = De4xxEphemItem::IsRoot;
@@ -756,6 +793,9 @@ De4xxEphemeris::ephem_activate (
    // This model doesn't use the nutations.
    file.item[De4xxBase::De4xx_File_ENutation].active = false;
 
+   // Resolve the points to be updated.
+   build_update_records ();
+
    // Force an update to reflect the change in status.
    force_update = true;
 
@@ -763,6 +803,62 @@ De4xxEphemeris::ephem_activate (
 }
 
 
+/**
+ * Build the records that drive ephem_update: the root point, if owned by
+ * this model, and one record per active translational point that is set
+ * from the ephemeris file.
+ */
+void
+De4xxEphemeris::build_update_records (
+   void)
+{
+   if ((root_item != nullptr) &&
+         (root_item->item == root_item->enabled_item)) {
+      root_point = &points[root_item->index];
+   }
+   else {
+      root_point = nullptr;
+   }
+
+   nupdate_records = 0;
+
+   // Points directly represented in the file.
+   // Note: The Earth and Moon need special treatment (see below).
+   for (unsigned int ii = De4xxBase::De4xx_Ephem_Sun;
+         ii <= De4xxBase::De4xx_Ephem_EMbary;
+         ++ii) {
+      if ((ii != De4xxBase::De4xx_Ephem_Earth) &&
+            (ii != De4xxBase::De4xx_Ephem_Moon) &&
+            (item_data[ii].status == De4xxEphemItem::Active)) {
+         De4xxEphemUpdate & record = update_records[nupdate_records++];
+         record.point = &points[ii];
+         record.file_index = body_to_file_idx[ii];
+         record.scale = 1.0;
+      }
+   }
+
+   // The Earth and Moon states reflect the ref frame tree structure.
+   // The Moon state is relative to the Earth in the ephemeris file.
+   if ((item_data[De4xxBase::De4xx_Ephem_Earth].status ==
+         De4xxEphemItem::Active) &&
+         (item_data[De4xxBase::De4xx_Ephem_Moon].status ==
+          De4xxEphemItem::Active)) {
+      unsigned int moon_file_index =
+         body_to_file_idx[De4xxBase::De4xx_Ephem_Moon];
+
+      De4xxEphemUpdate & earth = update_records[nupdate_records++];
+      earth.point = &points[De4xxBase::De4xx_Ephem_Earth];
+      earth.file_index = moon_file_index;
+      earth.scale = -file.header.be_em_dist_ratio;
+
+      De4xxEphemUpdate & moon = update_records[nupdate_records++];
+      moon.point = &points[De4xxBase::De4xx_Ephem_Moon];
+      moon.file_index = moon_file_index;
+      moon.scale = file.header.bm_em_dist_ratio;
+   }
+}
+
+
 /**
  * Construct the ephemeris model portions of the reference frame tree.
  * \param[in,out] ephem_manager Ephemerides manager
@@ -777,12 +873,14 @@ De4xxEphemeris::ephem_build_tree (
       return;
    }
 
-   // Remove all owned frames from the tree.
+   // Remove the owned frames that are not to be in the tree.
+   // The root and active frames are (re)added below; adding a frame that is
+   // already in place leaves the tree untouched.
    for ( uint32_t ii = 0;
          ii < De4xxBase::number_trans_points(file.file_spec.get_model_number());
          ++ii)
    {
-      if ((item_data[ii].status != De4xxEphemItem::Deselected) &&
+      if ((item_data[ii].status == De4xxEphemItem::Inactive) &&
             (item_data[ii].item == item_data[ii].enabled_item)) {
          item_data[ii].frame->remove_from_parent ();
       }
@@ -845,10 +943,8 @@ De4xxEphemeris::ephem_update (
    force_update = false;
 
    // Update the root if it is owned by this model.
-   if ((root_item != nullptr) &&
-         (root_item->item == root_item->enabled_item)) {
-      EphemerisPoint * point = dynamic_cast<EphemerisPoint*>(root_item->item);
-      point->update (null_vec, null_vec, update_time);
+   if (root_point != nullptr) {
+      root_point->update (null_vec, null_vec, update_time);
    }
 
    if (nactive_items > 0) {
@@ -857,42 +953,13 @@ De4xxEphemeris::ephem_update (
       // FIXME: Switch to J2000
       file.update (time_tt->trunc_julian_time * 86400.0);
 
-      // Extract the requisite data directly represented in the ephemeris file
-      // from the ephemeris file object.
-      // Note: The Earth and Moon need special treatment (see below).
-      for (unsigned int ii = De4xxBase::De4xx_Ephem_Sun;
-            ii <= De4xxBase::De4xx_Ephem_EMbary;
-            ++ii) {
-
-         // Point is directly represented and is needed:
-         // Update state based on  the ephemeris file data for this object.
-         if ((ii != De4xxBase::De4xx_Ephem_Earth) &&
-               (ii != De4xxBase::De4xx_Ephem_Moon) &&
-               (item_data[ii].status == De4xxEphemItem::Active)) {
-            EphemerisPoint * point =
-               dynamic_cast<EphemerisPoint*>(item_data[ii].item);
-            De4xxFileItem & file_item = file.item[body_to_file_idx[ii]];
-            point->update (file_item.state[0], file_item.state[1], update_time);
-         }
-      }
-
-      // Compute Earth and Moon states to reflect the ref frame tree structure.
-      // The Moon state is relative to the Earth in the ephemeris file.
-      if ((item_data[De4xxBase::De4xx_Ephem_Earth].status ==
-            De4xxEphemItem::Active) &&
-            (item_data[De4xxBase::De4xx_Ephem_Moon].status ==
-             De4xxEphemItem::Active)) {
-
-         De4xxFileItem & moon_ephem =
-            file.item[body_to_file_idx[De4xxBase::De4xx_Ephem_Moon]];
-
-         points[De4xxBase::De4xx_Ephem_Earth].update_scaled (
-            moon_ephem.state[0], moon_ephem.state[1],
-            -file.header.be_em_dist_ratio, update_time);
-
-         points[De4xxBase::De4xx_Ephem_Moon].update_scaled (
-            moon_ephem.state[0], moon_ephem.state[1],
-            file.header.bm_em_dist_ratio, update_time);
+      // Set the states of the points from the ephemeris file data,
+      // per the records built at activation.
+      for (unsigned int ii = 0; ii < nupdate_records; ++ii) {
+         const De4xxEphemUpdate & record = update_records[ii];
+         const De4xxFileItem & file_item = file.item[record.file_index];
+         record.point->update_scaled (file_item.state[0], file_item.state[1],
+                                      record.scale, update_time);
       }
 
       // Lunar orientation needed:
@@ -909,6 +976,22 @@ De4xxEphemeris::ephem_update (
 }
 
 
+/**
+ * Register the model's update time with a state snapshot so that a restore
+ * does not force a needless update. The ephemeris file carries its own
+ * update time and state cache, both keyed by time; they remain valid
+ * across a restore.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+De4xxEphemeris::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   snapshot.add_item (update_time);
+   snapshot.add_item (force_update);
+}
+
+
 /**
  * Check whether the specified time is represented in the JPL ephemeris file.
  *
@@ -926,6 +1009,123 @@ const
 }
 
 
+/**
+ * Calculate the states of a set of bodies at a set of times without
+ * updating the ephemeris points, the reference frames, or the ephemeris
+ * file; see De4xxFile::query_states. This is intended for offline analysis
+ * (e.g., eclipse or look-angle tables) and may be called from any number of
+ * threads once the model is initialized.
+ *
+ * States are ICRF states relative to the solar system barycenter, whatever
+ * the structure of the reference frame tree. The Earth and Moon states are
+ * derived from the Earth-Moon barycenter and geocentric lunar states as in
+ * ephem_update.
+ * \param[in] num_times Number of times
+ * \param[in] times Terrestrial Time truncated Julian dates\n Units: day
+ * \param[in] num_bodies Number of bodies
+ * \param[in] bodies Body indices per De4xxBase::De4xxEphemBodies, from
+ *                   De4xx_Ephem_Sun to De4xx_Ephem_SSbary
+ * \param[out] states Body states, num_bodies per time: the state of body j
+ *                    at time i is states[i*num_bodies + j]\n Units: M, M/s
+ */
+void
+De4xxEphemeris::query_states (
+   unsigned int num_times,
+   const double * times,
+   unsigned int num_bodies,
+   const unsigned int * bodies,
+   double (* states)[2][3])
+const
+{
+   // Determine the file items needed and where each lands in the file states.
+   std::vector<unsigned int> file_items;
+   int file_column[De4xxBase::De4xx_File_MaxEntries];
+   for (unsigned int ii = 0; ii < De4xxBase::De4xx_File_MaxEntries; ++ii) {
+      file_column[ii] = -1;
+   }
+   for (unsigned int jj = 0; jj < num_bodies; ++jj) {
+      unsigned int body = bodies[jj];
+      if (body > De4xxBase::De4xx_Ephem_SSbary) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, EphemeridesMessages::invalid_item,
+            "Body %u is not a translational ephemeris item", body);
+
+         // Not reached
+         return;
+      }
+
+      unsigned int needed[2];
+      unsigned int num_needed = 0;
+      if ((body == De4xxBase::De4xx_Ephem_Earth) ||
+          (body == De4xxBase::De4xx_Ephem_Moon)) {
+         needed[num_needed++] = De4xxBase::De4xx_File_EMbary;
+         needed[num_needed++] = De4xxBase::De4xx_File_Moon;
+      }
+      else if (body != De4xxBase::De4xx_Ephem_SSbary) {
+         needed[num_needed++] = body_to_file_idx[body];
+      }
+      for (unsigned int kk = 0; kk < num_needed; ++kk) {
+         if (file_column[needed[kk]] < 0) {
+            file_column[needed[kk]] = static_cast<int> (file_items.size());
+            file_items.push_back (needed[kk]);
+         }
+      }
+   }
+
+   // Evaluate the file items.
+   unsigned int num_items = static_cast<unsigned int> (file_items.size());
+   std::vector<double> file_times (num_times);
+   std::vector<double> file_states (num_times * num_items * 6);
+   for (unsigned int ii = 0; ii < num_times; ++ii) {
+      file_times[ii] = times[ii] * 86400.0;
+   }
+   double (* item_states)[2][3] =
+      reinterpret_cast<double (*)[2][3]> (file_states.data());
+   if (num_items > 0) {
+      file.query_states (num_times, file_times.data(),
+                         num_items, file_items.data(), item_states);
+   }
+
+   // Assemble the body states.
+   for (unsigned int ii = 0; ii < num_times; ++ii) {
+      const double (* time_states)[2][3] = item_states + ii * num_items;
+      for (unsigned int jj = 0; jj < num_bodies; ++jj) {
+         unsigned int body = bodies[jj];
+         double (& state)[2][3] = states[ii * num_bodies + jj];
+
+         if (body == De4xxBase::De4xx_Ephem_SSbary) {
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               state[0][kk] = 0.0;
+               state[1][kk] = 0.0;
+            }
+         }
+         else if ((body == De4xxBase::De4xx_Ephem_Earth) ||
+                  (body == De4xxBase::De4xx_Ephem_Moon)) {
+            const double (& embary)[2][3] =
+               time_states[file_column[De4xxBase::De4xx_File_EMbary]];
+            const double (& moon)[2][3] =
+               time_states[file_column[De4xxBase::De4xx_File_Moon]];
+            double scale = (body == De4xxBase::De4xx_Ephem_Earth) ?
+                           -file.header.be_em_dist_ratio :
+                           file.header.bm_em_dist_ratio;
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               state[0][kk] = embary[0][kk] + scale * moon[0][kk];
+               state[1][kk] = embary[1][kk] + scale * moon[1][kk];
+            }
+         }
+         else {
+            const double (& file_state)[2][3] =
+               time_states[file_column[body_to_file_idx[body]]];
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               state[0][kk] = file_state[0][kk];
+               state[1][kk] = file_state[1][kk];
+            }
+         }
+      }
+   }
+}
+
+
 /**
  * Propagate the lunar orientation to the current time.
  */
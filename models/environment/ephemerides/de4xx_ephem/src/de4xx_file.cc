@@ -40,6 +40,10 @@ Library dependency:
    ((de4xx_file.cc)
     (de4xx_file_init.cc)
     (de4xx_file_update.cc)
+    (de4xx_file_binary.cc)
+    (de4xx_file_shared.cc)
+    (de4xx_file_prefetch.cc)
+    (de4xx_file_query.cc)
     (environment/ephemerides/ephem_interface/src/ephem_messages.cc)
     (utils/sim_interface/src/memory_interface.cc)
     (utils/message/src/message_handler.cc))
@@ -88,7 +92,9 @@ De4xxFileSpec::De4xxFileSpec (
    void)
 :
    denum(405),
-   ephem_file_dir("build/de4xx_lib")
+   ephem_file_dir("build/de4xx_lib"),
+   file_format(SharedLibrary),
+   shared_segment_cache(false)
 {
     set_model_number(405);
 }
@@ -97,8 +103,46 @@ De4xxFileSpec::De4xxFileSpec (
 void De4xxFileSpec::set_model_number(int denum_in)
 {
     denum = denum_in;
-    ephem_file_name = "libde" + std::to_string(denum) +".so";
-    pathname = ephem_file_dir + "/" + ephem_file_name;
+    if (file_format == SharedLibrary) {
+        ephem_file_name = "libde" + std::to_string(denum) +".so";
+        pathname = ephem_file_dir + "/" + ephem_file_name;
+    }
+}
+
+
+/**
+ * Use a JPL binary ephemeris file (e.g., linux_p1550p2650.440) rather than
+ * a generated shared library. The model number must still be set; it is
+ * checked against the file.
+ * \param[in] file_name File name, relative to ephem_file_dir unless absolute
+ */
+void De4xxFileSpec::set_binary_file(const std::string & file_name)
+{
+    file_format = JplBinary;
+    ephem_file_name = file_name;
+    if (!file_name.empty() && (file_name[0] == '/')) {
+        pathname = file_name;
+    }
+    else {
+        pathname = ephem_file_dir + "/" + ephem_file_name;
+    }
+}
+
+
+/**
+ * Set the directory that holds the ephemeris file, in place of the default
+ * build/de4xx_lib. An absolute binary file name is not affected.
+ * \param[in] dir_name Directory name
+ */
+void De4xxFileSpec::set_file_directory(const std::string & dir_name)
+{
+    ephem_file_dir = dir_name;
+    if (file_format == SharedLibrary) {
+        set_model_number(denum);
+    }
+    else {
+        set_binary_file(ephem_file_name);
+    }
 }
 
 
@@ -118,7 +162,13 @@ De4xxFileIO::De4xxFileIO (
    segment_recno(0),
    total_num_recs(0),
    max_terms(0),
-   file(nullptr)
+   file(nullptr),
+   map_size(0),
+   binary_meta(),
+   binary_items(),
+   binary_segment(),
+   shared_segment_addr(nullptr),
+   shared_segment_size(0)
 {
    ; // Empty
 }
@@ -169,7 +219,8 @@ De4xxFileItem::De4xxFileItem (
    item_idx(-1),
    nitems(3),
    pscale(1000.0),
-   update_time(-99e99)
+   update_time(-99e99),
+   cheby_slot(0)
 {
    // Initialize the state to garbage.
    for (unsigned int ii = 0; ii < 3; ++ii) {
@@ -195,6 +246,24 @@ De4xxFileRefTime::De4xxFileRefTime (
 }
 
 
+/**
+ * Construct a De4xxFileStateCache object.
+ */
+De4xxFileStateCache::De4xxFileStateCache (
+   void)
+:
+   size(4),
+   nitems(0),
+   clock(0),
+   time(nullptr),
+   last_use(nullptr),
+   active(nullptr),
+   states(nullptr)
+{
+   ; // Empty
+}
+
+
 /**
  * Construct a De4xxFileFileCoef object.
  */
@@ -202,8 +271,9 @@ De4xxFileCoef::De4xxFileCoef (
    void)
 :
 //   ncoef(0),
-   chebyterms(0),
-   chebyx(-99e99),
+   nslots(0),
+   chebyterms(nullptr),
+   chebyx(nullptr),
    chebypoly(nullptr),
    chebyderiv(nullptr),
    coef(nullptr)
@@ -257,6 +327,8 @@ De4xxFile::De4xxFile (
    io(),
    ref_time(),
    coef(),
+   state_cache(),
+   prefetcher(),
    restart(*this),
    update_time(-99e99)
 {
@@ -321,6 +393,12 @@ void
 De4xxFile::open ( // flawfinder: ignore
    void)
 {
+   // JPL binary files are mapped rather than loaded.
+   if (file_spec.file_format == De4xxFileSpec::JplBinary) {
+      open_binary ();
+      return;
+   }
+
    // Clear dlerror
    char * dlError;
    dlerror();
@@ -339,7 +417,7 @@ De4xxFile::open ( // flawfinder: ignore
       // Not reached
       return;
    } else  {
-       MessageHandler::debug(
+       JEOD_MESSAGE_DEBUG (
           __FILE__, __LINE__, EphemeridesMessages::debug,
           "Loading ephemeris data '%s' in '%s'",
           file_spec.ephem_file_name.c_str(),
@@ -412,7 +490,13 @@ De4xxFile::reopen (
    void)
 {
    // Close the file if it is already open.
-   if (io.file != nullptr) {
+   prefetcher.cancel ();
+   unmap_shared_segment ();
+   if ((io.file != nullptr) &&
+       (file_spec.file_format == De4xxFileSpec::JplBinary)) {
+       close_binary ();
+   }
+   else if (io.file != nullptr) {
        dlclose (io.file);
        io.file = nullptr;
    }
@@ -441,7 +525,15 @@ De4xxFile::close (
    }
 
    // Close the file.
-   rc = dlclose (io.file);
+   prefetcher.cancel ();
+   unmap_shared_segment ();
+   if (file_spec.file_format == De4xxFileSpec::JplBinary) {
+      close_binary ();
+      rc = 0;
+   }
+   else {
+      rc = dlclose (io.file);
+   }
 
    // Check for success.
    // NOTE: Failure is a warning here as the close may be the result of an
@@ -458,8 +550,16 @@ De4xxFile::close (
    io.metaData = nullptr;
 
    // Free allocated memory.
+   JEOD_DELETE_ARRAY (coef.chebyterms);
+   JEOD_DELETE_ARRAY (coef.chebyx);
    JEOD_DELETE_ARRAY (coef.chebypoly);
    JEOD_DELETE_ARRAY (coef.chebyderiv);
+   coef.nslots = 0;
+   JEOD_DELETE_ARRAY (state_cache.time);
+   JEOD_DELETE_ARRAY (state_cache.last_use);
+   JEOD_DELETE_ARRAY (state_cache.active);
+   JEOD_DELETE_ARRAY (state_cache.states);
+   state_cache.nitems = 0;
 }
 
 
@@ -529,6 +629,25 @@ void process_mem_usage(double& vm_usage, double& resident_set)
    resident_set = rss * page_size_kb;
 }
 
+void process_shared_mem_usage(double& shared_set)
+{
+   using std::ios_base;
+   using std::ifstream;
+
+   shared_set = 0.0;
+
+   // statm reports sizes in pages: size, resident, shared, ...
+   ifstream statm_stream("/proc/self/statm",ios_base::in);
+
+   unsigned long size, resident, shared;
+   if (statm_stream >> size >> resident >> shared) {
+      long page_size_kb = sysconf(_SC_PAGE_SIZE) / 1024;
+      shared_set = shared * page_size_kb;
+   }
+
+   statm_stream.close();
+}
+
 void De4xxFile::capture_mem_stats()
 {
     using std::cout;
@@ -536,7 +655,11 @@ void De4xxFile::capture_mem_stats()
 
     if( logMemoryStats ) {
         process_mem_usage(vm_usage, resident_set);
-        cout << "VM: " << vm_usage << "; RSS: " << resident_set << endl;
+        process_shared_mem_usage(shared_set);
+        private_set = resident_set - shared_set;
+        cout << "VM: " << vm_usage << "; RSS: " << resident_set
+             << " (shared: " << shared_set << "; private: " << private_set
+             << ")" << endl;
     }
 }
 
@@ -0,0 +1,384 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Ephemerides
+ * @{
+ * @addtogroup De4xxEphem
+ * @{
+ *
+ * @file models/environment/ephemerides/de4xx_ephem/src/de4xx_file_binary.cc
+ * Define the De4xxFile methods that read JPL binary ephemeris files.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((JPL planetary and lunar ephemerides, export file documentation,
+     ftp://ssd.jpl.nasa.gov/pub/eph/planets/)))
+
+Assumptions and limitations:
+  ((The file has the byte order of the host machine)
+   (Errors are fatal))
+
+Library dependency:
+  ((de4xx_file_binary.cc)
+   (de4xx_file.cc)
+   (environment/ephemerides/ephem_interface/src/ephem_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "environment/ephemerides/ephem_interface/include/ephem_messages.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/de4xx_file.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/*
+ * Layout of the first (header) record of a JPL binary ephemeris file.
+ * The record is written by a Fortran unformatted write of
+ *   TTL(3 lines of 84 characters), CNAM(1:400), SS(3), NCON, AU, EMRAT,
+ *   IPT(3,1:12), NUMDE, IPT(3,13), CNAM(401:NCON), IPT(3,14), IPT(3,15)
+ * The last two item descriptors (lunar mantle angular velocity, TT-TDB)
+ * are present in DE430 and later only.
+ */
+const std::size_t title_size = 3 * 84;
+const std::size_t name_size = 6;
+const std::size_t names_offset = title_size;
+const std::size_t ss_offset = names_offset + 400 * name_size;
+const std::size_t ncon_offset = ss_offset + 3 * sizeof(double);
+const std::size_t au_offset = ncon_offset + sizeof(int32_t);
+const std::size_t emrat_offset = au_offset + sizeof(double);
+const std::size_t ipt_offset = emrat_offset + sizeof(double);
+const std::size_t numde_offset = ipt_offset + 12 * 3 * sizeof(int32_t);
+const std::size_t lpt_offset = numde_offset + sizeof(int32_t);
+const std::size_t extra_names_offset = lpt_offset + 3 * sizeof(int32_t);
+
+/**
+ * Number of components of each file item, in De4xxFileEntries order.
+ */
+const uint32_t item_components[De4xxBase::De4xx_File_MaxEntries] =
+   {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1};
+
+/**
+ * Names of the constants JEOD needs, in De4xxEphemConsts order.
+ */
+const char * const constant_names[De4xxBase::De4xx_Const_MaxConsts] =
+   {"DENUM", "LENUM", "AU", "EMRAT", "CLIGHT",
+    "GM1", "GM2", "GMB", "GM4", "GM5", "GM6", "GM7", "GM8", "GM9", "GMS"};
+
+
+/**
+ * Copy a value out of the mapped header.
+ * @return Value at the offset
+ * \param[in] base   Start of the file
+ * \param[in] offset Byte offset of the value
+ */
+template <typename T>
+T
+read_value (
+   const char * base,
+   std::size_t offset)
+{
+   T value;
+   std::memcpy (&value, base + offset, sizeof(T));
+   return value;
+}
+
+
+/**
+ * Compare a blank-padded constant name from the header with a name.
+ * @return True if the names match
+ * \param[in] padded Six character blank-padded name
+ * \param[in] name   Null-terminated name
+ */
+bool
+constant_name_matches (
+   const char * padded,
+   const char * name)
+{
+   std::size_t len = std::strlen (name);
+   if (std::strncmp (padded, name, len) != 0) {
+      return false;
+   }
+   for (std::size_t ii = len; ii < name_size; ++ii) {
+      if (padded[ii] != ' ') {
+         return false;
+      }
+   }
+   return true;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Map a JPL binary ephemeris file and describe it in the same terms as the
+ * metadata of a generated shared library. Only the header is read here;
+ * data records are paged in by the operating system as they are touched.
+ *
+ * \par Assumptions and Limitations
+ *  - Errors are fatal
+ */
+void
+De4xxFile::open_binary (
+   void)
+{
+   const char * path = file_spec.pathname.c_str();
+
+   int fd = ::open (path, O_RDONLY); // flawfinder: ignore
+   if (fd < 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::file_error,
+         "Error opening ephemeris file '%s' for input: %s",
+         path, std::strerror(errno));
+
+      // Not reached
+      return;
+   }
+
+   struct stat file_stat;
+   if ((fstat (fd, &file_stat) != 0) ||
+       (static_cast<std::size_t>(file_stat.st_size) < extra_names_offset)) {
+      ::close (fd);
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::garbage_file,
+         "Ephemeris file '%s' is too small to be a JPL binary file", path);
+
+      // Not reached
+      return;
+   }
+
+   // Map the file read-only and shared so that processes using the same
+   // file share the page cache.
+   std::size_t file_size = file_stat.st_size;
+   void * addr = mmap (nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+   ::close (fd);
+   if (addr == MAP_FAILED) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::file_error,
+         "Error mapping ephemeris file '%s': %s", path, std::strerror(errno));
+
+      // Not reached
+      return;
+   }
+   io.file = addr;
+   io.map_size = file_size;
+
+   const char * base = static_cast<const char *> (addr);
+
+   // Sanity check: The DE number must be plausible. A file written on a
+   // machine of the other byte order fails this check.
+   int32_t numde = read_value<int32_t> (base, numde_offset);
+   if ((numde < 100) || (numde > 9999)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::garbage_file,
+         "Unable to parse ephemeris header in '%s' (found DE# = %d); "
+         "the file may have the wrong byte order",
+         path, numde);
+
+      // Not reached
+      return;
+   }
+
+   // Parse the item descriptors. The first thirteen are always present.
+   int32_t ncon = read_value<int32_t> (base, ncon_offset);
+   std::size_t extra_offset =
+      extra_names_offset + ((ncon > 400) ? (ncon - 400) * name_size : 0);
+   std::size_t descriptor_offset[De4xxBase::De4xx_File_MaxEntries];
+   for (uint32_t ii = 0; ii < 12; ++ii) {
+      descriptor_offset[ii] = ipt_offset + ii * 3 * sizeof(int32_t);
+   }
+   descriptor_offset[12] = lpt_offset;
+   descriptor_offset[13] = extra_offset;
+   descriptor_offset[14] = extra_offset + 3 * sizeof(int32_t);
+
+   uint32_t ncoeff = 2;
+   uint32_t nitems = 0;
+   for (uint32_t ii = 0; ii < De4xxBase::De4xx_File_MaxEntries; ++ii) {
+      EphemerisDataItemMeta & item_meta = io.binary_items[ii];
+      int32_t offset = read_value<int32_t> (base, descriptor_offset[ii]);
+      int32_t nterms = read_value<int32_t> (base, descriptor_offset[ii] + 4);
+      int32_t npoly = read_value<int32_t> (base, descriptor_offset[ii] + 8);
+
+      // The optional descriptors must continue the record contiguously;
+      // anything else is the padding of an older file's header record.
+      bool present =
+         (descriptor_offset[ii] + 12 <= file_size) &&
+         (offset > 0) && (nterms > 1) && (npoly > 0) &&
+         ((ii < 13) || (static_cast<uint32_t>(offset) == ncoeff + 1));
+
+      if (present) {
+         item_meta.offset = offset;
+         item_meta.nterms = nterms;
+         item_meta.npoly = npoly;
+         uint32_t end = offset - 1 + item_components[ii] * nterms * npoly;
+         ncoeff = (end > ncoeff) ? end : ncoeff;
+         nitems = ii + 1;
+      }
+      else {
+         item_meta.offset = 0;
+         item_meta.nterms = 0;
+         item_meta.npoly = 0;
+      }
+   }
+
+   // Determine the number of data records; the header and constants records
+   // precede them.
+   std::size_t record_size = ncoeff * sizeof(double);
+   if (file_size < 3 * record_size) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::garbage_file,
+         "Ephemeris file '%s' contains no data records", path);
+
+      // Not reached
+      return;
+   }
+   uint32_t num_recs = file_size / record_size - 2;
+
+   double start_epoch = read_value<double> (base, ss_offset);
+   double stop_epoch = read_value<double> (base, ss_offset + sizeof(double));
+   double delta_epoch = read_value<double> (base, ss_offset + 2 * sizeof(double));
+   double span_recs = std::floor ((stop_epoch - start_epoch) / delta_epoch + 0.5);
+   if ((delta_epoch > 0.0) && (span_recs >= 1.0) && (span_recs < num_recs)) {
+      num_recs = static_cast<uint32_t> (span_recs);
+   }
+
+   // Sanity check: The first data record must start at the start epoch.
+   const double * records =
+      reinterpret_cast<const double *> (base + 2 * record_size);
+   if (records[0] != start_epoch) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::garbage_file,
+         "Ephemeris file '%s': first record starts at %.1f rather than %.1f",
+         path, records[0], start_epoch);
+
+      // Not reached
+      return;
+   }
+
+   // Fill in the data set metadata.
+   EphemerisDataSetMeta & meta = io.binary_meta;
+   meta.number_file_items = nitems;
+   meta.start_epoch = start_epoch;
+   meta.stop_epoch = stop_epoch;
+   meta.delta_epoch = delta_epoch;
+   meta.number_segments = 1;
+   meta.ncoeff = ncoeff;
+
+   // Extract the constants JEOD needs from the constants record.
+   const char * constants = base + record_size;
+   for (uint32_t jj = 0; jj < De4xxBase::De4xx_Const_MaxConsts; ++jj) {
+      bool found = false;
+      for (int32_t ii = 0; (ii < ncon) && (! found); ++ii) {
+         std::size_t name_offset = (ii < 400) ?
+            names_offset + ii * name_size :
+            extra_names_offset + (ii - 400) * name_size;
+         if (constant_name_matches (base + name_offset, constant_names[jj])) {
+            meta.de_constants[jj] =
+               read_value<double> (constants, ii * sizeof(double));
+            found = true;
+         }
+      }
+
+      // The header proper carries the DE number, AU, and Earth/Moon ratio.
+      if (! found) {
+         switch (jj) {
+         case De4xxBase::De4xx_Const_DENUM:
+         case De4xxBase::De4xx_Const_LENUM:
+            meta.de_constants[jj] = numde;
+            break;
+         case De4xxBase::De4xx_Const_AU:
+            meta.de_constants[jj] = read_value<double> (base, au_offset);
+            break;
+         case De4xxBase::De4xx_Const_EMRAT:
+            meta.de_constants[jj] = read_value<double> (base, emrat_offset);
+            break;
+         default:
+            MessageHandler::fail (
+               __FILE__, __LINE__, EphemeridesMessages::garbage_file,
+               "Ephemeris file '%s' lacks the constant '%s'",
+               path, constant_names[jj]);
+
+            // Not reached
+            return;
+         }
+      }
+   }
+
+   // Describe the data as a single segment.
+   io.binary_segment.num_recs = num_recs;
+   io.binary_segment.start_epoch = start_epoch;
+   io.binary_segment.stop_epoch = stop_epoch;
+
+   io.metaData = &io.binary_meta;
+   io.itemData = io.binary_items;
+   io.segmentData = &io.binary_segment;
+   io.coeffs_segment_starting_addr = const_cast<double *> (records);
+
+   // Records are visited in time order but sparsely; read-ahead would only
+   // bring in records that are never used.
+   madvise (addr, file_size, MADV_RANDOM);
+
+   JEOD_MESSAGE_DEBUG (
+      __FILE__, __LINE__, EphemeridesMessages::debug,
+      "Mapped JPL binary ephemeris DE%d '%s' (%u records)",
+      numde, path, num_recs);
+}
+
+
+/**
+ * Unmap a JPL binary ephemeris file.
+ */
+void
+De4xxFile::close_binary (
+   void)
+{
+   if (io.file != nullptr) {
+      if (munmap (io.file, io.map_size) != 0) {
+         MessageHandler::warn (
+            __FILE__, __LINE__, EphemeridesMessages::file_error,
+            "Error unmapping ephemeris file: %s",
+            std::strerror(errno));
+      }
+   }
+
+   io.file = nullptr;
+   io.map_size = 0;
+   io.coeffs_segment_starting_addr = nullptr;
+   io.current_record_starting_addr = nullptr;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -84,23 +84,30 @@ De4xxFile::pre_initialize (
    // Open the ephemeris file.
    open (); // flawfinder: ignore
 
-   // Clear dlerror
-   dlerror();
-
    // Grab the first segment data segment symbol as a starting point
+   // (a mapped binary file has a single segment, located by open).
    io.recno = 0;
    io.segment_index = 0;
    io.segment_recno = 0;
-   io.coeffs_segment_starting_addr = (double *)dlsym(io.file, "segment_coeffs_0");
-   if (io.coeffs_segment_starting_addr == nullptr) {
-      char * dlError = dlerror();
-      MessageHandler::fail (
-         __FILE__, __LINE__, EphemeridesMessages::file_error,
-         "Error obtaining ephemeris file symbol 'segment_coeffs_0' from '%s' for input: %s",
-         file_spec.pathname.c_str(), dlError);
+   if (file_spec.file_format == De4xxFileSpec::SharedLibrary) {
 
-      // Not reached
-      return;
+      // Clear dlerror
+      dlerror();
+
+      io.coeffs_segment_starting_addr = (double *)dlsym(io.file, "segment_coeffs_0");
+      if (io.coeffs_segment_starting_addr == nullptr) {
+         char * dlError = dlerror();
+         MessageHandler::fail (
+            __FILE__, __LINE__, EphemeridesMessages::file_error,
+            "Error obtaining ephemeris file symbol 'segment_coeffs_0' from '%s' for input: %s",
+            file_spec.pathname.c_str(), dlError);
+
+         // Not reached
+         return;
+      }
+      if (file_spec.shared_segment_cache) {
+         map_shared_segment ();
+      }
    }
    io.current_record_starting_addr = io.coeffs_segment_starting_addr;
    coef.coef = io.coeffs_segment_starting_addr;
@@ -189,8 +196,8 @@ De4xxFile::initialize (
    pre_initialize();
 
    // Allocate buffers for reading and interpreting ephemeris file records.
-   coef.chebypoly  = JEOD_ALLOC_PRIM_ARRAY (io.max_terms, double);
-   coef.chebyderiv = JEOD_ALLOC_PRIM_ARRAY (io.max_terms, double);
+   assign_cheby_slots ();
+   allocate_state_cache ();
 
    // Grab important constants from the symbol file
    header.au            = io.metaData->de_constants[De4xxBase::De4xx_Const_AU];
@@ -267,6 +274,95 @@ De4xxFile::initialize (
    update_time = init_time - 1.0;
 }
 
+
+/**
+ * Allocate and clear the state cache.
+ */
+void
+De4xxFile::allocate_state_cache (
+   void)
+{
+   uint32_t nentries = state_cache.size;
+   uint32_t nitems = io.metaData->number_file_items;
+
+   state_cache.nitems = nitems;
+   state_cache.clock = 0;
+   if (nentries == 0) {
+      return;
+   }
+
+   state_cache.time     = JEOD_ALLOC_PRIM_ARRAY (nentries, double);
+   state_cache.last_use = JEOD_ALLOC_PRIM_ARRAY (nentries, uint64_t);
+   state_cache.active   = JEOD_ALLOC_PRIM_ARRAY (nentries * nitems, bool);
+   state_cache.states   = JEOD_ALLOC_PRIM_ARRAY (nentries * nitems * 6, double);
+
+   for (uint32_t ientry = 0; ientry < nentries; ++ientry) {
+      state_cache.time[ientry] = -99e99;
+      state_cache.last_use[ientry] = 0;
+      for (uint32_t ii = 0; ii < nitems; ++ii) {
+         state_cache.active[ientry * nitems + ii] = false;
+      }
+   }
+}
+
+
+/**
+ * Group the available items by the number of sub-intervals per record and
+ * allocate one Chebychev polynomial slot per group. Each slot holds enough
+ * terms for the item in its group with the most coefficients.
+ */
+void
+De4xxFile::assign_cheby_slots (
+   void)
+{
+   uint32_t nitems = io.metaData->number_file_items;
+   uint32_t nslots = 0;
+
+   // Assign the slots.
+   for (uint32_t ii = 0; ii < nitems; ++ii) {
+      De4xxFileItem & item_ii = item[ii];
+      if (! item_ii.avail) {
+         continue;
+      }
+      uint32_t npoly = io.itemData[item_ii.item_idx].npoly;
+
+      item_ii.cheby_slot = nslots;
+      for (uint32_t jj = 0; jj < ii; ++jj) {
+         if (item[jj].avail &&
+             (io.itemData[item[jj].item_idx].npoly == npoly)) {
+            item_ii.cheby_slot = item[jj].cheby_slot;
+            break;
+         }
+      }
+      if (item_ii.cheby_slot == nslots) {
+         ++nslots;
+      }
+   }
+   nslots = (nslots > 0) ? nslots : 1;
+
+   coef.nslots     = nslots;
+   coef.chebyterms = JEOD_ALLOC_PRIM_ARRAY (nslots, uint32_t);
+   coef.chebyx     = JEOD_ALLOC_PRIM_ARRAY (nslots, double);
+   coef.chebypoly  = JEOD_ALLOC_PRIM_ARRAY (nslots * io.max_terms, double);
+   coef.chebyderiv = JEOD_ALLOC_PRIM_ARRAY (nslots * io.max_terms, double);
+
+   for (uint32_t islot = 0; islot < nslots; ++islot) {
+      coef.chebyterms[islot] = 0;
+      coef.chebyx[islot] = -99e99;
+   }
+
+   // Size each slot for the largest item in its group.
+   for (uint32_t ii = 0; ii < nitems; ++ii) {
+      const De4xxFileItem & item_ii = item[ii];
+      if (item_ii.avail) {
+         uint32_t nterms = io.itemData[item_ii.item_idx].nterms;
+         if (coef.chebyterms[item_ii.cheby_slot] < nterms) {
+            coef.chebyterms[item_ii.cheby_slot] = nterms;
+         }
+      }
+   }
+}
+
 /**
  * Calculate the location of the L1 point as a ratio.
  * @return Ratio of body1 to L1-point distance to body1 to body2 distance
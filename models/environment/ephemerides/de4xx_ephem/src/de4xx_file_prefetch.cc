@@ -0,0 +1,180 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Ephemerides
+ * @{
+ * @addtogroup De4xxEphem
+ * @{
+ *
+ * @file models/environment/ephemerides/de4xx_ephem/src/de4xx_file_prefetch.cc
+ * Define De4xxFilePrefetcher methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependency:
+  ((de4xx_file_prefetch.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <unistd.h>
+
+// Model includes
+#include "../include/de4xx_file_prefetch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * De4xxFilePrefetcher constructor. No thread is started until needed.
+ */
+De4xxFilePrefetcher::De4xxFilePrefetcher ()
+:
+   enabled (false),
+   worker (),
+   mutex (),
+   request_cond (),
+   idle_cond (),
+   pending_begin (nullptr),
+   pending_count (0),
+   busy (false),
+   shutdown (false)
+{
+   ; // Empty
+}
+
+
+/**
+ * De4xxFilePrefetcher destructor. Stops and joins the worker.
+ */
+De4xxFilePrefetcher::~De4xxFilePrefetcher ()
+{
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      shutdown = true;
+   }
+   request_cond.notify_all ();
+
+   if (worker.joinable()) {
+      worker.join ();
+   }
+}
+
+
+/**
+ * Request that a range of coefficients be brought into memory.
+ * The request replaces any request the worker has not yet started.
+ * @param[in] begin  First coefficient of the range.
+ * @param[in] count  Number of coefficients in the range.
+ */
+void
+De4xxFilePrefetcher::request (
+   const double * begin,
+   std::size_t count)
+{
+   if ((! enabled) || (begin == nullptr) || (count == 0)) {
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      if (! worker.joinable()) {
+         worker = std::thread (&De4xxFilePrefetcher::worker_loop, this);
+      }
+      pending_begin = begin;
+      pending_count = count;
+   }
+   request_cond.notify_one ();
+}
+
+
+/**
+ * Drop any pending request and wait for the worker to finish the range it
+ * is touching. This must be called before the memory of a requested range
+ * is unmapped.
+ */
+void
+De4xxFilePrefetcher::cancel ()
+{
+   std::unique_lock<std::mutex> lock (mutex);
+   pending_begin = nullptr;
+   pending_count = 0;
+   while (busy) {
+      idle_cond.wait (lock);
+   }
+}
+
+
+/**
+ * Worker thread main loop.
+ */
+void
+De4xxFilePrefetcher::worker_loop ()
+{
+   for (;;) {
+      const double * begin;
+      std::size_t count;
+      {
+         std::unique_lock<std::mutex> lock (mutex);
+         while ((! shutdown) && (pending_begin == nullptr)) {
+            request_cond.wait (lock);
+         }
+         if (shutdown) {
+            return;
+         }
+         begin = pending_begin;
+         count = pending_count;
+         pending_begin = nullptr;
+         pending_count = 0;
+         busy = true;
+      }
+
+      touch (begin, count);
+
+      {
+         std::lock_guard<std::mutex> lock (mutex);
+         busy = false;
+      }
+      idle_cond.notify_all ();
+   }
+}
+
+
+/**
+ * Read one value from each page of a range, faulting the pages in.
+ * @param[in] begin  First coefficient of the range.
+ * @param[in] count  Number of coefficients in the range.
+ */
+void
+De4xxFilePrefetcher::touch (
+   const double * begin,
+   std::size_t count)
+{
+   static const std::size_t page_doubles = sysconf(_SC_PAGE_SIZE) / sizeof(double);
+
+   volatile double sink = 0.0;
+   for (std::size_t ii = 0; ii < count; ii += page_doubles) {
+      sink = sink + begin[ii];
+   }
+   sink = sink + begin[count - 1];
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
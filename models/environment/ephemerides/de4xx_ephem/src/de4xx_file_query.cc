@@ -0,0 +1,256 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Ephemerides
+ * @{
+ * @addtogroup De4xxEphem
+ * @{
+ *
+ * @file models/environment/ephemerides/de4xx_ephem/src/de4xx_file_query.cc
+ * Define De4xxFile::query_states.
+ */
+
+/*******************************************************************************
+
+Purpose:
+ ()
+
+Library dependency:
+ ((de4xx_file_query.cc)
+  (de4xx_file.cc)
+  (environment/ephemerides/ephem_interface/src/ephem_messages.cc)
+  (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <dlfcn.h>
+#include <sstream>
+#include <vector>
+
+// JEOD includes
+#include "environment/ephemerides/ephem_interface/include/ephem_messages.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/de4xx_file.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Calculate the states of a set of items at a set of times without changing
+ * the state of the file: the item states, the current record, the
+ * Chebychev slots, and the state cache are left as they are. Since only
+ * data that are fixed once the file is initialized are read, any number of
+ * threads can query a file concurrently with one another and with update.
+ *
+ * The times are sorted by record. The coefficients of each record are then
+ * applied to all of the times that fall in that record, item by item, so
+ * each record is visited once no matter how the times are ordered.
+ *
+ * States are expressed as by update, in meters and meters/second. Items
+ * with fewer than three components have the remaining elements zeroed.
+ *
+ * \par Assumptions and Limitations
+ *  - The file has been initialized.
+ * \param[in] num_times Number of times
+ * \param[in] times Times since reference, as passed to update\n Units: s
+ * \param[in] num_items Number of items
+ * \param[in] items Item indices, per De4xxBase::De4xxFileEntries
+ * \param[out] states Item states, num_items per time: the state of item j at
+ *                    time i is states[i*num_items + j]
+ */
+void
+De4xxFile::query_states (
+   unsigned int num_times,
+   const double * times,
+   unsigned int num_items,
+   const unsigned int * items,
+   double (* states)[2][3])
+const
+{
+   if (io.file == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::internal_error,
+         "Ephemeris file is not open");
+
+      // Not reached
+      return;
+   }
+
+   for (unsigned int jj = 0; jj < num_items; ++jj) {
+      if ((items[jj] >= io.metaData->number_file_items) ||
+          (! item[items[jj]].avail)) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, EphemeridesMessages::item_not_in_file,
+            "Body %u ephemeris not available", items[jj]);
+
+         // Not reached
+         return;
+      }
+   }
+
+   // Compute the fractional record number of each time and sort the times
+   // by record.
+   std::vector<double> fblk (num_times);
+   std::vector<unsigned int> order (num_times);
+   for (unsigned int ii = 0; ii < num_times; ++ii) {
+      if (! time_is_in_range (times[ii])) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, EphemeridesMessages::time_not_in_range,
+            "Time %g is not represented in the ephemeris file", times[ii]);
+
+         // Not reached
+         return;
+      }
+      fblk[ii] = ref_time.block_no +
+                 (times[ii] - ref_time.init_time) /
+                 (86400.0 * io.metaData->delta_epoch);
+      order[ii] = ii;
+   }
+   std::sort (order.begin(), order.end(),
+              [&fblk] (unsigned int a, unsigned int b)
+              { return fblk[a] < fblk[b]; });
+
+   std::vector<double> chebypoly (io.max_terms);
+   std::vector<double> chebyderiv (io.max_terms);
+   uint32_t segment_index = io.metaData->number_segments;
+   uint32_t segment_recno = 0;
+   const double * segment_coeffs = nullptr;
+
+   unsigned int run_begin = 0;
+   while (run_begin < num_times) {
+
+      // Find the times that fall in the same record.
+      uint32_t recno = static_cast<uint32_t> (fblk[order[run_begin]]);
+      unsigned int run_end = run_begin + 1;
+      while ((run_end < num_times) &&
+             (static_cast<uint32_t> (fblk[order[run_end]]) == recno)) {
+         ++run_end;
+      }
+
+      // Locate the record, moving to the segment that holds it if needed.
+      if ((segment_index >= io.metaData->number_segments) ||
+          (recno < segment_recno) ||
+          (recno >= segment_recno + io.segmentData[segment_index].num_recs)) {
+         segment_index = 0;
+         segment_recno = 0;
+         while ((segment_index + 1 < io.metaData->number_segments) &&
+                (recno >= segment_recno +
+                          io.segmentData[segment_index].num_recs)) {
+            segment_recno += io.segmentData[segment_index].num_recs;
+            ++segment_index;
+         }
+         segment_coeffs = query_segment (segment_index);
+      }
+      const double * record =
+         segment_coeffs + (recno - segment_recno) * io.metaData->ncoeff;
+
+      // Apply the record to each item at each of the times.
+      for (unsigned int jj = 0; jj < num_items; ++jj) {
+         const De4xxFileItem & file_item = item[items[jj]];
+         const EphemerisDataItemMeta & item_data =
+            io.itemData[file_item.item_idx];
+         std::size_t ncomp = file_item.nitems;
+         std::size_t nterms = item_data.nterms;
+         double dnpoly = static_cast<double> (item_data.npoly);
+         double pscale = file_item.pscale;
+         double vscale = 2.0 * dnpoly /
+                         (io.metaData->delta_epoch * 86400.0) * pscale;
+
+         for (unsigned int kk = run_begin; kk < run_end; ++kk) {
+            unsigned int itime = order[kk];
+
+            double fsub = (fblk[itime] - static_cast<double> (recno)) * dnpoly;
+            int subint = static_cast<int> (fsub);
+            fsub -= subint;
+
+            double chebyx = fsub + fsub - 1.0;
+            double twox = chebyx + chebyx;
+            chebypoly[0] = 1.0;
+            chebypoly[1] = chebyx;
+            chebyderiv[0] = 0.0;
+            chebyderiv[1] = 1.0;
+            for (std::size_t nn = 2; nn < nterms; ++nn) {
+               chebypoly[nn] = twox * chebypoly[nn - 1] - chebypoly[nn - 2];
+               chebyderiv[nn] = chebypoly[nn - 1] + chebypoly[nn - 1]
+                              + twox * chebyderiv[nn - 1] - chebyderiv[nn - 2];
+            }
+
+            const double * cheby_coefs =
+               record + (item_data.offset - 1) + ncomp * nterms * subint;
+            double (& state)[2][3] = states[itime * num_items + jj];
+            for (std::size_t cc = 0; cc < 3; ++cc) {
+               double pos = 0.0;
+               double vel = 0.0;
+               if (cc < ncomp) {
+                  const double * coefs = cheby_coefs + cc * nterms;
+                  for (std::size_t nn = nterms; nn-- > 0;) {
+                     pos += chebypoly[nn] * coefs[nn];
+                     vel += chebyderiv[nn] * coefs[nn];
+                  }
+               }
+               state[0][cc] = pos * pscale;
+               state[1][cc] = vel * vscale;
+            }
+         }
+      }
+
+      run_begin = run_end;
+   }
+}
+
+
+/**
+ * Locate the coefficients of a segment for query_states. The segment is
+ * looked up in the file rather than taken from the current segment, which
+ * update may be changing.
+ * @return First coefficient of the segment
+ * \param[in] segment Segment index
+ */
+const double *
+De4xxFile::query_segment (
+   uint32_t segment)
+const
+{
+   // A mapped binary file has a single segment, located by open.
+   if (file_spec.file_format != De4xxFileSpec::SharedLibrary) {
+      return io.coeffs_segment_starting_addr;
+   }
+
+   std::stringstream segment_var_name;
+   segment_var_name << "segment_coeffs_" << segment;
+
+   const double * segment_coeffs = static_cast<const double *> (
+      dlsym (io.file, segment_var_name.str().c_str()));
+   if (segment_coeffs == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, EphemeridesMessages::file_error,
+         "Error obtaining ephemeris file symbol '%s' from '%s'",
+         segment_var_name.str().c_str(), file_spec.pathname.c_str());
+
+      // Not reached
+      return nullptr;
+   }
+
+   return segment_coeffs;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
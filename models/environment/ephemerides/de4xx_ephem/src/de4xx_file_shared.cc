@@ -0,0 +1,169 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Ephemerides
+ * @{
+ * @addtogroup De4xxEphem
+ * @{
+ *
+ * @file models/environment/ephemerides/de4xx_ephem/src/de4xx_file_shared.cc
+ * Define the De4xxFile methods that serve ephemeris segments from POSIX
+ * shared memory.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Processes sharing a segment use the same DE model library)
+   (Shared memory objects persist until removed from /dev/shm))
+
+Library dependency:
+  ((de4xx_file_shared.cc)
+   (de4xx_file.cc)
+   (environment/ephemerides/ephem_interface/src/ephem_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "environment/ephemerides/ephem_interface/include/ephem_messages.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/de4xx_file.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Replace the current segment's coefficients with a read-only mapping of a
+ * node-wide POSIX shared memory copy. The first process to reach a segment
+ * creates and fills the shared memory object while holding an exclusive lock
+ * on it; later processes find it filled and simply map it. The library's own
+ * copy of the data is then never touched by those processes.
+ *
+ * \par Assumptions and Limitations
+ *  - io.coeffs_segment_starting_addr points to the library's segment data.
+ *  - Failures are not fatal: the library's data remain in use.
+ */
+void
+De4xxFile::map_shared_segment (
+   void)
+{
+   unmap_shared_segment ();
+
+   const double * source = io.coeffs_segment_starting_addr;
+   std::size_t size = static_cast<std::size_t> (
+                         io.segmentData[io.segment_index].num_recs) *
+                      io.metaData->ncoeff * sizeof(double);
+
+   // The name identifies the model, segment, and shape so that a stale object
+   // from a different build of the library is not mistaken for this one.
+   std::ostringstream name_stream;
+   name_stream << "/jeod_de" << file_spec.denum
+               << "_u" << getuid()
+               << "_s" << io.segment_index
+               << "_" << io.metaData->ncoeff
+               << "x" << io.segmentData[io.segment_index].num_recs;
+   std::string name = name_stream.str();
+
+   int fd = shm_open (name.c_str(), O_RDWR | O_CREAT, 0644);
+   if (fd < 0) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, EphemeridesMessages::file_error,
+         "Unable to open shared ephemeris segment '%s': %s",
+         name.c_str(), std::strerror(errno));
+      return;
+   }
+
+   // Fill the object if this is the first process to use it.
+   bool usable = false;
+   struct stat shm_stat;
+   if ((flock (fd, LOCK_EX) == 0) && (fstat (fd, &shm_stat) == 0)) {
+      if (shm_stat.st_size == 0) {
+         void * fill_addr = MAP_FAILED;
+         if (ftruncate (fd, size) == 0) {
+            fill_addr = mmap (nullptr, size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd, 0);
+         }
+         if (fill_addr != MAP_FAILED) {
+            std::memcpy (fill_addr, source, size);
+            munmap (fill_addr, size);
+            usable = true;
+         }
+         else {
+            // Leave the object empty for the next process to retry.
+            int rc = ftruncate (fd, 0);
+            (void) rc;
+         }
+      }
+      else {
+         usable = (static_cast<std::size_t>(shm_stat.st_size) == size);
+      }
+      flock (fd, LOCK_UN);
+   }
+
+   void * addr = MAP_FAILED;
+   if (usable) {
+      addr = mmap (nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+   }
+   ::close (fd);
+
+   if (addr == MAP_FAILED) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, EphemeridesMessages::file_error,
+         "Unable to map shared ephemeris segment '%s'; "
+         "using the private copy", name.c_str());
+      return;
+   }
+
+   io.shared_segment_addr = addr;
+   io.shared_segment_size = size;
+   io.coeffs_segment_starting_addr = static_cast<double *> (addr);
+}
+
+
+/**
+ * Unmap the shared memory copy of the current segment, if any.
+ * The shared memory object itself is left in place for other processes.
+ */
+void
+De4xxFile::unmap_shared_segment (
+   void)
+{
+   if (io.shared_segment_addr != nullptr) {
+      prefetcher.cancel ();
+      munmap (io.shared_segment_addr, io.shared_segment_size);
+      io.shared_segment_addr = nullptr;
+      io.shared_segment_size = 0;
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -20,6 +20,8 @@ Purpose:
 Library dependency:
  ((de4xx_file_update.cc)
   (de4xx_file.cc)
+  (de4xx_file_shared.cc)
+  (de4xx_file_prefetch.cc)
   (environment/ephemerides/ephem_interface/src/ephem_messages.cc)
   (utils/message/src/message_handler.cc))
 
@@ -157,6 +159,13 @@ De4xxFile::update (
    }
 
 
+    /* Reuse the states computed at this time if they are still at hand. */
+   if (fetch_cached_states (time)) {
+      update_time = time;
+      return;
+   }
+
+
     /* Compute the integral and fractional record numbers. */
    fblk  = ref_time.block_no +
            (time - ref_time.init_time) / (86400.0 * io.metaData->delta_epoch);
@@ -171,6 +180,7 @@ De4xxFile::update (
     /* Read and parse the record if needed. */
 
    if(recno != io.recno) {
+       uint32_t previous_recno = io.recno;
        uint32_t starting_segment_record = io.segment_recno;
        uint32_t update_segment_idx = std::numeric_limits<int>::max();
        if (recno > io.recno) {
@@ -238,16 +248,165 @@ De4xxFile::update (
               // Not reached
               return;
            }
+           if (file_spec.shared_segment_cache) {
+              map_shared_segment ();
+           }
        }
        io.current_record_starting_addr = &(io.coeffs_segment_starting_addr[(recno - io.segment_recno)*io.metaData->ncoeff]);
        io.recno = recno;
        coef.coef = &(io.coeffs_segment_starting_addr[(recno - io.segment_recno)*io.metaData->ncoeff]);
+
+       if (prefetcher.enabled) {
+          prefetch_records (recno, previous_recno);
+       }
    }
 
 //   capture_mem_stats();
 
     /* Interpolate position and velocity. */
    interpolate (time, fblk);
+
+   save_cached_states (time);
+}
+
+
+/**
+ * Ask the prefetcher to bring in the records the next boundary crossing is
+ * expected to reach. The direction and the number of records skipped per
+ * crossing are taken from the most recent crossing; a crossing that skips
+ * several records (a fast simulation rate) prefetches as far ahead.
+ * Only records within the current segment are prefetched.
+ * \param[in] recno Record now in use
+ * \param[in] previous_recno Record previously in use
+ */
+void
+De4xxFile::prefetch_records (
+   uint32_t recno,
+   uint32_t previous_recno)
+{
+   // Nothing is known about the direction of time before the first crossing.
+   if (previous_recno >= io.total_num_recs) {
+      return;
+   }
+
+   uint32_t segment_end =
+      io.segment_recno + io.segmentData[io.segment_index].num_recs;
+   uint32_t first;
+   uint32_t last;
+   if (recno > previous_recno) {
+      first = recno + 1;
+      last = recno + (recno - previous_recno);
+      if (last >= segment_end) {
+         last = segment_end - 1;
+      }
+   }
+   else {
+      if (recno == io.segment_recno) {
+         return;
+      }
+      last = recno - 1;
+      first = ((previous_recno - recno) > (recno - io.segment_recno)) ?
+              io.segment_recno : recno - (previous_recno - recno);
+   }
+   if (first > last) {
+      return;
+   }
+
+   prefetcher.request (
+      &(io.coeffs_segment_starting_addr[(first - io.segment_recno)*io.metaData->ncoeff]),
+      static_cast<std::size_t>(last - first + 1) * io.metaData->ncoeff);
+}
+
+
+/**
+ * Restore the item states computed at the specified time from the state
+ * cache, provided some entry for that time holds every active item.
+ * @return True if the states were restored
+ * \param[in] time Time since reference\n Units: s
+ */
+bool
+De4xxFile::fetch_cached_states (
+   double time)
+{
+   uint32_t nitems = state_cache.nitems;
+
+   for (uint32_t ientry = 0; ientry < state_cache.size; ++ientry) {
+      if ((state_cache.last_use[ientry] == 0) ||
+          (! Numerical::compare_exact (state_cache.time[ientry], time))) {
+         continue;
+      }
+
+      const bool * entry_active = state_cache.active + ientry * nitems;
+      bool complete = true;
+      for (uint32_t ii = 0; ii < nitems; ++ii) {
+         if (item[ii].active && (! entry_active[ii])) {
+            complete = false;
+            break;
+         }
+      }
+      if (! complete) {
+         continue;
+      }
+
+      const double * entry_states = state_cache.states + ientry * nitems * 6;
+      for (uint32_t ii = 0; ii < nitems; ++ii) {
+         De4xxFileItem & item_ii = item[ii];
+         if (item_ii.active) {
+            const double * item_states = entry_states + ii * 6;
+            for (uint32_t jj = 0; jj < 3; ++jj) {
+               item_ii.state[0][jj] = item_states[jj];
+               item_ii.state[1][jj] = item_states[3 + jj];
+            }
+            item_ii.update_time = time;
+         }
+      }
+
+      state_cache.last_use[ientry] = ++state_cache.clock;
+      return true;
+   }
+
+   return false;
+}
+
+
+/**
+ * Save the item states just computed at the specified time in the state
+ * cache, replacing the least recently used entry.
+ * \param[in] time Time since reference\n Units: s
+ */
+void
+De4xxFile::save_cached_states (
+   double time)
+{
+   uint32_t nitems = state_cache.nitems;
+
+   if (state_cache.size == 0) {
+      return;
+   }
+
+   uint32_t oldest = 0;
+   for (uint32_t ientry = 1; ientry < state_cache.size; ++ientry) {
+      if (state_cache.last_use[ientry] < state_cache.last_use[oldest]) {
+         oldest = ientry;
+      }
+   }
+
+   bool * entry_active = state_cache.active + oldest * nitems;
+   double * entry_states = state_cache.states + oldest * nitems * 6;
+   for (uint32_t ii = 0; ii < nitems; ++ii) {
+      const De4xxFileItem & item_ii = item[ii];
+      entry_active[ii] = item_ii.active;
+      if (item_ii.active) {
+         double * item_states = entry_states + ii * 6;
+         for (uint32_t jj = 0; jj < 3; ++jj) {
+            item_states[jj] = item_ii.state[0][jj];
+            item_states[3 + jj] = item_ii.state[1][jj];
+         }
+      }
+   }
+
+   state_cache.time[oldest] = time;
+   state_cache.last_use[oldest] = ++state_cache.clock;
 }
 
 
@@ -301,22 +460,29 @@ void De4xxFile::interpolate(double time, double fblk)
              *   T[k] = 2 x T[k-1] - T[k-2]
              *   dT[0]/dx = 0
              *   dT[1]/dx = 1
-             *   dT[k]/dx = 2 T[k-1] + 2 x dT[k-1]/dx - dT[k-2]/dx */
+             *   dT[k]/dx = 2 T[k-1] + 2 x dT[k-1]/dx - dT[k-2]/dx
+             * The values depend only on x, which is the same for all items
+             * with the same number of sub-intervals. Such items share a slot,
+             * and the first of them to be interpolated at a new x fills the
+             * slot for all of them. */
+            uint32_t slot = item_ii->cheby_slot;
+            double *chebypoly = coef.chebypoly + slot * io.max_terms;
+            double *chebyderiv = coef.chebyderiv + slot * io.max_terms;
             chebyx = fsub + fsub - 1.0;
-            if ((coef.chebyterms < nterms) || (!Numerical::compare_exact(coef.chebyx, chebyx)))
+            if (!Numerical::compare_exact(coef.chebyx[slot], chebyx))
             {
-                coef.chebyterms = nterms;
-                coef.chebyx = chebyx;
+                std::size_t slot_terms = coef.chebyterms[slot];
+                coef.chebyx[slot] = chebyx;
                 twox = chebyx + chebyx;
-                coef.chebypoly[0] = 1.0;
-                coef.chebypoly[1] = chebyx;
-                coef.chebyderiv[0] = 0.0;
-                coef.chebyderiv[1] = 1.0;
-                for (jj = 2; jj < nterms; jj++)
+                chebypoly[0] = 1.0;
+                chebypoly[1] = chebyx;
+                chebyderiv[0] = 0.0;
+                chebyderiv[1] = 1.0;
+                for (jj = 2; jj < slot_terms; jj++)
                 {
-                    coef.chebypoly[jj] = twox * coef.chebypoly[jj - 1] - coef.chebypoly[jj - 2];
-                    coef.chebyderiv[jj] = coef.chebypoly[jj - 1] + coef.chebypoly[jj - 1]
-                            + twox * coef.chebyderiv[jj - 1] - coef.chebyderiv[jj - 2];
+                    chebypoly[jj] = twox * chebypoly[jj - 1] - chebypoly[jj - 2];
+                    chebyderiv[jj] = chebypoly[jj - 1] + chebypoly[jj - 1]
+                            + twox * chebyderiv[jj - 1] - chebyderiv[jj - 2];
                 }
             }
 
@@ -336,23 +502,48 @@ void De4xxFile::interpolate(double time, double fblk)
             /* Compute the C-language offset to the coefficients for this
              * sub-interval. */
             item_offset = itemData.offset - 1 + nitems * nterms * subint;
-
-            /* Interpolate to get position, velocity for each component. */
-            for (jj = 0; jj < nitems; jj++)
+            const double *cheby_coefs = coef.coef + item_offset;
+
+            /* Interpolate to get position, velocity for all components at
+             * once. Each component's series is summed from the highest term
+             * down, smallest terms first. */
+            double pos[3] = {0.0, 0.0, 0.0};
+            double vel[3] = {0.0, 0.0, 0.0};
+            if (nitems == 3)
+            {
+                const double *coefs_x = cheby_coefs;
+                const double *coefs_y = cheby_coefs + nterms;
+                const double *coefs_z = cheby_coefs + 2 * nterms;
+                for (kk = nterms - 1; kk >= 0; kk--)
+                {
+                    double poly_k = chebypoly[kk];
+                    double deriv_k = chebyderiv[kk];
+                    pos[0] += poly_k * coefs_x[kk];
+                    pos[1] += poly_k * coefs_y[kk];
+                    pos[2] += poly_k * coefs_z[kk];
+                    vel[0] += deriv_k * coefs_x[kk];
+                    vel[1] += deriv_k * coefs_y[kk];
+                    vel[2] += deriv_k * coefs_z[kk];
+                }
+            }
+            else
             {
-                std::size_t coefs_starting_idx = item_offset + jj * nterms;
-                item_ii->state[0][jj] = 0.0;
-                item_ii->state[1][jj] = 0.0;
                 for (kk = nterms - 1; kk >= 0; kk--)
                 {
-                    item_ii->state[0][jj] += coef.chebypoly[kk] * coef.coef[coefs_starting_idx + kk];
-                    item_ii->state[1][jj] += coef.chebyderiv[kk] * coef.coef[coefs_starting_idx + kk];
+                    for (jj = 0; jj < nitems; jj++)
+                    {
+                        pos[jj] += chebypoly[kk] * cheby_coefs[jj * nterms + kk];
+                        vel[jj] += chebyderiv[kk] * cheby_coefs[jj * nterms + kk];
+                    }
                 }
+            }
 
-                /* The JPL ephemeris file expresses distance in kilometers.
-                 * Scale position, velocity to yield meters, meters/sec^2 */
-                item_ii->state[0][jj] *= pscale;
-                item_ii->state[1][jj] *= vscale;
+            /* The JPL ephemeris file expresses distance in kilometers.
+             * Scale position, velocity to yield meters, meters/sec^2 */
+            for (jj = 0; jj < nitems; jj++)
+            {
+                item_ii->state[0][jj] = pos[jj] * pscale;
+                item_ii->state[1][jj] = vel[jj] * vscale;
             }
 
             /* Timestamp the data. */
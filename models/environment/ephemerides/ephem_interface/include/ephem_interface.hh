@@ -64,6 +64,7 @@ Purpose:
 // System includes
 
 // JEOD includes
+#include "utils/memory/include/class_declarations.hh"
 #include "utils/ref_frames/include/subscription.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
@@ -152,6 +153,21 @@ public:
       void)
    = 0;
 
+
+   // Virtual methods.
+
+   /**
+    * Register the model's mutable state with a state snapshot. The frames
+    * the model updates are registered by the manager; a model only needs
+    * to register what it keeps itself. The default registers nothing.
+    * \param[in,out] snapshot The snapshot
+    */
+   virtual void add_snapshot_regions (
+      StateSnapshot & snapshot JEOD_UNUSED)
+   {
+      ; // Empty
+   }
+
    // Member data: None. This is an interface class.
 };
 
@@ -203,6 +203,12 @@ public:
     */
    virtual void disconnect_from_tree (void) = 0;
 
+   /**
+    * Disconnect the item from the reference frame tree if the item is
+    * no longer active.
+    */
+   virtual void prune_from_tree (void) = 0;
+
 
 protected:
 
@@ -113,6 +113,9 @@ public:
    // Disconnect (no-op for an orientation)
    void disconnect_from_tree () override;
 
+   // Prune (no-op for an orientation)
+   void prune_from_tree () override;
+
 
 protected:
 
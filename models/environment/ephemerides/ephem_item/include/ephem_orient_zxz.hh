@@ -120,6 +120,18 @@ public:
    virtual void propagate (double to_time);
 
 
+   // Member data
+
+   /**
+    * If set, update computes the quaternion from the half Euler angles and
+    * derives the transformation matrix and rate from it, halving the number
+    * of trigonometric evaluations, and skips updates that repeat the time
+    * and angles of the previous update. The result agrees with the default
+    * to within round-off.
+    */
+   bool quaternion_update; //!< trick_units(--)
+
+
 protected:
 
    // Member data
@@ -135,6 +147,13 @@ protected:
    double euler_rate_313[3];  //!< trick_units(rad/s)
 
 
+   // Member functions
+
+   // Update the state via the quaternion
+   void update_from_quaternion (
+      const double * angles, const double * derivs, double time);
+
+
 private:
 
    // Make the copy constructor and assignment operator private
@@ -105,6 +105,9 @@ public:
    // Disconnect the inertial frame from the ref frame tree.
    void disconnect_from_tree () override;
 
+   // Disconnect the inertial frame if the point is no longer active.
+   void prune_from_tree () override;
+
    // Note that the inertial frame's active status has changed
    void note_frame_status_change (RefFrame * frame) override;
 
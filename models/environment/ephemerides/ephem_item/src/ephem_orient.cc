@@ -182,6 +182,18 @@ EphemerisOrientation::disconnect_from_tree (
    ; // No-op
 }
 
+
+/**
+ * Prune the item from the tree; this is a no-op for an
+ * EphemerisOrientation.
+ */
+void
+EphemerisOrientation::prune_from_tree (
+   void)
+{
+   ; // No-op
+}
+
 } // End JEOD namespace
 
 /**
@@ -80,7 +80,8 @@ namespace jeod {
 EphemerisZXZOrientation::EphemerisZXZOrientation (
    void)
 :
-   EphemerisOrientation()
+   EphemerisOrientation(),
+   quaternion_update(false)
 {
    Vector3::initialize (euler_angle_313);
    Vector3::initialize (euler_rate_313);
@@ -234,6 +235,11 @@ EphemerisZXZOrientation::update (
 {
    RefFrameRot * ref_state = &(target_frame->state.rot);
 
+   if (quaternion_update) {
+      update_from_quaternion (angles, derivs, time);
+      return;
+   }
+
    double phi, theta, psi;
    double phidot, thetadot, psidot;
    double cosphi, costheta, cospsi;
@@ -324,6 +330,93 @@ EphemerisZXZOrientation::update (
    target_frame->set_timestamp (update_time);
 }
 
+
+/**
+ * Compute a JEOD rotational state given a 3-1-3 inertial-to-planet-fixed
+ * Euler sequence and its rates, starting from the quaternion. The quaternion
+ * needs only the sines and cosines of the half angles; the full-angle
+ * functions needed for the rate follow from double-angle and difference
+ * identities, and the matrix follows from the quaternion.
+ * An update that repeats the previous time and angles is skipped.
+ * \param[in] angles zxz Euler angles\n Units: r
+ * \param[in] derivs zxz Euler angle time derivatives\n Units: r/s
+ * \param[in] time Update time\n Units: s
+ */
+void
+EphemerisZXZOrientation::update_from_quaternion (
+   const double * angles,
+   const double * derivs,
+   double time)
+{
+   RefFrameRot * ref_state = &(target_frame->state.rot);
+
+   if ((time == update_time) &&
+       (angles[0] == euler_angle_313[0]) &&
+       (angles[1] == euler_angle_313[1]) &&
+       (angles[2] == euler_angle_313[2]) &&
+       (derivs[0] == euler_rate_313[0]) &&
+       (derivs[1] == euler_rate_313[1]) &&
+       (derivs[2] == euler_rate_313[2])) {
+      return;
+   }
+
+   double phi, theta, psi;
+   double phidot, thetadot, psidot;
+   double costheta, sintheta, cospsi, sinpsi;
+   double coshtheta, sinhtheta;
+   double coshphi_psi_dif, sinhphi_psi_dif;
+   double coshphi_psi_sum, sinhphi_psi_sum;
+
+
+   // Extract Euler angles and their rates from input vectors.
+   phi   = euler_angle_313[0] = angles[0];
+   theta = euler_angle_313[1] = angles[1];
+   psi   = euler_angle_313[2] = angles[2];
+   phidot   = euler_rate_313[0] = derivs[0];
+   thetadot = euler_rate_313[1] = derivs[1];
+   psidot   = euler_rate_313[2] = derivs[2];
+
+
+   // Compute sines, cosines of the half angles.
+   coshtheta = std::cos(0.5 * theta);
+   sinhtheta = std::sin(0.5 * theta);
+   coshphi_psi_dif = std::cos(0.5 * (phi - psi));
+   sinhphi_psi_dif = std::sin(0.5 * (phi - psi));
+   coshphi_psi_sum = std::cos(0.5 * (phi + psi));
+   sinhphi_psi_sum = std::sin(0.5 * (phi + psi));
+
+
+   // Construct the inertial to planet-fixed left transformation quaternion
+   // as in update.
+   ref_state->Q_parent_this.scalar    =  coshphi_psi_sum * coshtheta;
+   ref_state->Q_parent_this.vector[0] = -coshphi_psi_dif * sinhtheta;
+   ref_state->Q_parent_this.vector[1] = -sinhphi_psi_dif * sinhtheta;
+   ref_state->Q_parent_this.vector[2] = -sinhphi_psi_sum * coshtheta;
+   ref_state->compute_transformation ();
+
+
+   // Full-angle functions: theta = 2*(theta/2), psi = sum - dif.
+   costheta = coshtheta*coshtheta - sinhtheta*sinhtheta;
+   sintheta = 2.0 * sinhtheta * coshtheta;
+   cospsi = coshphi_psi_sum*coshphi_psi_dif + sinhphi_psi_sum*sinhphi_psi_dif;
+   sinpsi = sinhphi_psi_sum*coshphi_psi_dif - coshphi_psi_sum*sinhphi_psi_dif;
+
+
+   // Construct the body's rotation rate vector as in update.
+   ref_state->ang_vel_this[0] = phidot*sintheta*sinpsi + thetadot*cospsi;
+   ref_state->ang_vel_this[1] = phidot*sintheta*cospsi - thetadot*sinpsi;
+   ref_state->ang_vel_this[2] = phidot*costheta        + psidot;
+
+   ref_state->ang_vel_mag = Vector3::vmag (ref_state->ang_vel_this);
+   Vector3::scale (ref_state->ang_vel_this, 1.0 / ref_state->ang_vel_mag,
+                   ref_state->ang_vel_unit);
+
+
+   // Timestamp the reference state.
+   update_time = time;
+   target_frame->set_timestamp (update_time);
+}
+
 } // End JEOD namespace
 
 /**
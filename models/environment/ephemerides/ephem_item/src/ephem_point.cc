@@ -130,6 +130,22 @@ EphemerisPoint::disconnect_from_tree (
 }
 
 
+/**
+ * Disconnect the associated inertial frame from the tree if the point is no
+ * longer active. The frame of an inactive point is not reinserted by an
+ * incremental tree rebuild.
+ */
+void
+EphemerisPoint::prune_from_tree (
+   void)
+{
+   if ((! active) && (target_frame != nullptr) &&
+       (target_frame->get_parent() != nullptr)) {
+      target_frame->remove_from_parent();
+   }
+}
+
+
 /**
  * Zero-out the inertial frame's translational state.
  */
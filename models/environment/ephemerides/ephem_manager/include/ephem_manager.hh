@@ -69,7 +69,9 @@ Library dependencies:
 
 // JEOD includes
 #include "utils/ref_frames/include/ref_frame_manager.hh"
+#include "utils/ref_frames/include/ref_frame_state_source.hh"
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/named_item/include/name_table.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -87,10 +89,20 @@ namespace jeod {
  *   - Dynamically determine which ephemerides are needed in a simulation.
  *   - Initialize ephemeris models and keep them in sync with the rest
  *     of the simulation.
+ *
+ * When lazy_update is set, update_ephemerides only notes that the ephemeris
+ * models are out of date. The models are updated on the next reference frame
+ * relative state query or on an explicit call to refresh_ephemerides.
+ *
+ * When incremental_tree_rebuild is set, a tree rebuild after the first
+ * leaves the existing tree in place. The ephemeris models re-add their
+ * frames, which moves only those frames whose parent has changed, and the
+ * frames of items that are no longer active are pruned.
  */
 class EphemeridesManager :
    virtual public BaseEphemeridesManager,
-   public RefFrameManager {
+   public RefFrameManager,
+   public RefFrameStateSource {
 
 JEOD_MAKE_SIM_INTERFACES(EphemeridesManager)
 
@@ -130,6 +142,7 @@ public:
 
    // Find a planet.
    BasePlanet * find_base_planet (const char * name) const override;
+   BasePlanet * find_base_planet (NameHandle handle) const;
    Planet * find_planet (const char * name) const override;
 
    // Return number of registered planets.
@@ -170,6 +183,7 @@ public:
 
    // Find an integration frame.
    EphemerisRefFrame * find_integ_frame (const char * name) const override;
+   EphemerisRefFrame * find_integ_frame (NameHandle handle) const;
 
    // Check whether a reference frame is an integration frame.
    bool is_integ_frame (const RefFrame & ref_frame) const override;
@@ -190,6 +204,9 @@ public:
 
    void set_target_frame( RefFrame & ref_frame);
 
+   // Register the frame states and ephemeris model state with a snapshot.
+   void add_snapshot_regions (StateSnapshot & snapshot) override;
+
 
    // Top-level (e.g., S_define-level) methods
    // These are not inherited from BaseEphemeridesManager.
@@ -203,9 +220,48 @@ public:
    // Ask ephemeris models to update the ephemerides they control
    void update_ephemerides (void);
 
+   // Perform a deferred update of the ephemeris models, if one is pending
+   void refresh_ephemerides (void);
+
+   // Deferred update callback for RefFrame relative state queries
+   void refresh_frame_states (void) override;
+
+   /**
+    * Query whether a deferred ephemeris update is pending.
+    * @return update_pending data member.
+    */
+   bool ephemerides_update_pending ()
+   const
+   { return update_pending; }
+
+
+   // Member data
+
+   /**
+    * Defer ephemeris updates until a frame state is needed?
+    * Clear this flag (the default) for eager updates. A simulation that
+    * sets it should call refresh_ephemerides before checkpointing, and
+    * models that read ephemeris frame states directly must do so as well.
+    */
+   bool lazy_update; //!< trick_units(--)
+
+   /**
+    * Rebuild the reference frame tree incrementally once it has been built?
+    * Clear this flag (the default) to have every rebuild disconnect and
+    * reinsert all ephemeris frames. A change of the root of the tree always
+    * causes a full rebuild.
+    */
+   bool incremental_tree_rebuild; //!< trick_units(--)
+
 
 protected:
 
+   // Member functions
+
+   // Update the existing reference frame tree in place
+   bool rebuild_tree_incrementally (void);
+
+
    // Member data
    // NOTE WELL: These are protected rather than private because of simulation
    // engine limitations. Inheriting classes should treat these as private
@@ -228,6 +284,16 @@ protected:
     */
    double update_time; //!< trick_units(s)
 
+   /**
+    * Set when update_ephemerides has deferred an update in lazy mode.
+    */
+   bool update_pending; //!< trick_units(--)
+
+   /**
+    * Set once activate_ephemerides has built the complete tree.
+    */
+   bool ref_frame_tree_built; //!< trick_units(--)
+
    /**
     * The planets in a simulation, typically defined at the S_define level.
     */
@@ -251,9 +317,25 @@ protected:
     */
    JeodPointerVector<EphemerisRefFrame>::type integ_frames; //!< trick_io(**)
 
+   /**
+    * Index from interned planet name to position in planets.
+    * This is a cache; it is rebuilt whenever it is found to be out of date.
+    */
+   mutable NameIndex planet_index; //!< trick_io(**)
+
+   /**
+    * Index from interned frame name to position in integ_frames.
+    * This is a cache; it is rebuilt whenever it is found to be out of date.
+    */
+   mutable NameIndex integ_frame_name_index; //!< trick_io(**)
+
 
 private:
 
+   // Rebuild the name indices from the planet and integration frame lists.
+   void rebuild_planet_index (void) const;
+   void rebuild_integ_frame_name_index (void) const;
+
    // Make the copy constructor and assignment operator private
    // (and unimplemented) to avoid erroneous copies
 
@@ -25,7 +25,10 @@ Library dependencies:
    (environment/ephemerides/ephem_item/src/ephem_orient.cc)
    (environment/ephemerides/ephem_item/src/ephem_point.cc)
    (environment/planet/src/base_planet.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/memory/src/state_snapshot.cc)
+   (utils/message/src/message_handler.cc)
+   (utils/named_item/src/name_table.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 ******************************************************************************/
@@ -34,6 +37,7 @@ Library dependencies:
 // System includes
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 // JEOD includes
 #include "environment/ephemerides/ephem_interface/include/ephem_messages.hh"
@@ -44,7 +48,9 @@ Library dependencies:
 #include "environment/planet/include/base_planet.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
 #include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/ephem_manager.hh"
@@ -61,9 +67,16 @@ EphemeridesManager::EphemeridesManager (
 :
    BaseEphemeridesManager (),
    RefFrameManager (),
+   RefFrameStateSource (),
+   lazy_update(false),
+   incremental_tree_rebuild(false),
    single_ephem_mode(false),
    regenerate_ref_frame_tree(false),
-   update_time(0.0)
+   update_time(0.0),
+   update_pending(false),
+   ref_frame_tree_built(false),
+   planet_index(),
+   integ_frame_name_index()
 {
    JEOD_REGISTER_CLASS (EphemeridesManager);
    JEOD_REGISTER_CLASS (BasePlanet);
@@ -87,6 +100,9 @@ EphemeridesManager::~EphemeridesManager (
    JEOD_DEREGISTER_CHECKPOINTABLE (this, ephemerides);
    JEOD_DEREGISTER_CHECKPOINTABLE (this, ephem_items);
    JEOD_DEREGISTER_CHECKPOINTABLE (this, integ_frames);
+
+   // Make sure no reference frame query calls back into this object.
+   RefFrame::cancel_state_refresh (*this);
 }
 
 
@@ -145,8 +161,11 @@ EphemeridesManager::add_planet (
       return;
    }
 
-   // Add the planet to the planet list.
+   // Add the planet to the planet list and, if it is current, the index.
    planets.push_back (&planet);
+   if (planet_index.size() + 1 == planets.size()) {
+      planet_index.add (NameTable::intern (planet.name), planets.size() - 1);
+   }
 }
 
 
@@ -160,21 +179,62 @@ EphemeridesManager::find_base_planet (
    const char * name)
 const
 {
-   BasePlanet * found_planet = nullptr;
+   // Registered planets' names are interned, so a name that has not been
+   // interned names no planet unless the index is stale.
+   NameHandle handle = NameTable::find (name);
+   if ((! handle.is_valid()) && (planet_index.size() != planets.size())) {
+      rebuild_planet_index ();
+      handle = NameTable::find (name);
+   }
 
-   // Search the planet list until a match is found.
-   for (std::vector<BasePlanet *>::const_iterator it = planets.begin();
-        it != planets.end();
-        ++it) {
-      BasePlanet * planet = *it;
-      if (planet->name.compare(name) == 0 ) {
-         found_planet = planet;
-         break;
-      }
+   return handle.is_valid() ? find_base_planet (handle) : nullptr;
+}
+
+
+/**
+ * Find the planet with the given interned name.
+ * @param handle  Handle of the planet name.
+ * @return Found planet; NULL if not found.
+*/
+BasePlanet *
+EphemeridesManager::find_base_planet (
+   NameHandle handle)
+const
+{
+   // The index is stale if planets were added behind its back,
+   // e.g., when planets was restored from a checkpoint.
+   if (planet_index.size() != planets.size()) {
+      rebuild_planet_index ();
+   }
+
+   unsigned int found = planet_index.find (handle);
+
+   // Guard against a stale index by verifying the hit.
+   if ((found != NameIndex::npos) &&
+       ((found >= planets.size()) ||
+        (planets[found]->name.compare (NameTable::get_name (handle)) != 0))) {
+      rebuild_planet_index ();
+      found = planet_index.find (handle);
    }
 
-   // Return the found planet (if any).
-   return found_planet;
+   return (found != NameIndex::npos) ? planets[found] : nullptr;
+}
+
+
+/**
+ * Rebuild the name index from the list of planets.
+ */
+void
+EphemeridesManager::rebuild_planet_index (
+   void)
+const
+{
+   planet_index.clear ();
+
+   // Keep the first entry for a name, which is what a linear search would find.
+   for (unsigned int ii = 0; ii < planets.size(); ++ii) {
+      planet_index.add (NameTable::intern (planets[ii]->name), ii);
+   }
 }
 
 
@@ -468,8 +528,13 @@ EphemeridesManager::add_integ_frame (
    EphemerisRefFrame & ref_frame)
 {
 
-   // Add the frame to the list of integration frames.
+   // Add the frame to the list of integration frames and, if it is current,
+   // the index.
    integ_frames.push_back (&ref_frame);
+   if (integ_frame_name_index.size() + 1 == integ_frames.size()) {
+      integ_frame_name_index.add (NameTable::intern (ref_frame.get_name()),
+                                  integ_frames.size() - 1);
+   }
 
    // All integration frames are reference frames.
    // Note that this protects against duplicate names.
@@ -487,19 +552,65 @@ EphemeridesManager::find_integ_frame (
    const char * name)
 const
 {
-   EphemerisRefFrame * found_frame = nullptr;
+   // Integration frames' names are interned, so a name that has not been
+   // interned names no integration frame unless the index is stale.
+   NameHandle handle = NameTable::find (name);
+   if ((! handle.is_valid()) &&
+       (integ_frame_name_index.size() != integ_frames.size())) {
+      rebuild_integ_frame_name_index ();
+      handle = NameTable::find (name);
+   }
 
-   for (std::vector<EphemerisRefFrame *>::const_iterator it =
-           integ_frames.begin();
-        it != integ_frames.end();
-        ++it) {
-      EphemerisRefFrame * ref_frame = *it;
-      if (std::strcmp (name, ref_frame->get_name()) == 0) {
-         found_frame = ref_frame;
-         break;
-      }
+   return handle.is_valid() ? find_integ_frame (handle) : nullptr;
+}
+
+
+/**
+ * Find the integration frame with the given interned name.
+ * @param handle  Handle of the integration frame name
+ * @return Found integration frame
+ */
+EphemerisRefFrame *
+EphemeridesManager::find_integ_frame (
+   NameHandle handle)
+const
+{
+   // The index is stale if frames were added behind its back,
+   // e.g., when integ_frames was restored from a checkpoint.
+   if (integ_frame_name_index.size() != integ_frames.size()) {
+      rebuild_integ_frame_name_index ();
+   }
+
+   unsigned int found = integ_frame_name_index.find (handle);
+
+   // Guard against a stale index by verifying the hit.
+   if ((found != NameIndex::npos) &&
+       ((found >= integ_frames.size()) ||
+        (std::strcmp (NameTable::get_name (handle),
+                      integ_frames[found]->get_name()) != 0))) {
+      rebuild_integ_frame_name_index ();
+      found = integ_frame_name_index.find (handle);
+   }
+
+   return (found != NameIndex::npos) ? integ_frames[found] : nullptr;
+}
+
+
+/**
+ * Rebuild the name index from the list of integration frames.
+ */
+void
+EphemeridesManager::rebuild_integ_frame_name_index (
+   void)
+const
+{
+   integ_frame_name_index.clear ();
+
+   // Keep the first entry for a name, which is what a linear search would find.
+   for (unsigned int ii = 0; ii < integ_frames.size(); ++ii) {
+      integ_frame_name_index.add (
+         NameTable::intern (integ_frames[ii]->get_name()), ii);
    }
-   return found_frame;
 }
 
 
@@ -660,6 +771,8 @@ void
 EphemeridesManager::initialize_ephemerides (
    void)
 {
+   JEOD_PROFILE_SCOPE (
+      "ephemerides", "EphemeridesManager::initialize_ephemerides");
 
    // Initialize each ephemeris model.
    for (std::vector<EphemerisInterface *>::iterator it = ephemerides.begin();
@@ -681,6 +794,7 @@ void
 EphemeridesManager::update_ephemerides (
    void)
 {
+   JEOD_PROFILE_SCOPE ("ephemerides", "EphemeridesManager::update_ephemerides");
 
    // Update which ephemeris items are needed if any gross activity
    // changes have occurred.
@@ -688,6 +802,22 @@ EphemeridesManager::update_ephemerides (
       activate_ephemerides ();
    }
 
+   // Reflatten the tree if frames have been moved since the last update.
+   update_tree_index ();
+
+   // Lazy mode: Defer the update until some frame state is needed.
+   if (lazy_update) {
+      update_pending = true;
+      RefFrame::defer_state_refresh (*this);
+      return;
+   }
+
+   // Eager mode: Any previously deferred update is subsumed by this one.
+   if (update_pending) {
+      update_pending = false;
+      RefFrame::cancel_state_refresh (*this);
+   }
+
    // Update each ephemeris model.
    for (std::vector<EphemerisInterface *>::const_iterator it =
            ephemerides.begin();
@@ -699,6 +829,73 @@ EphemeridesManager::update_ephemerides (
 }
 
 
+/**
+ * Perform a deferred update of the ephemeris models, if one is pending.
+ * Each model updates only the items that are active, i.e., the subscribed
+ * branches of the reference frame tree.
+ */
+void
+EphemeridesManager::refresh_ephemerides (
+   void)
+{
+   if (! update_pending) {
+      return;
+   }
+
+   update_pending = false;
+   RefFrame::cancel_state_refresh (*this);
+
+   for (std::vector<EphemerisInterface *>::const_iterator it =
+           ephemerides.begin();
+        it != ephemerides.end();
+        ++it) {
+      EphemerisInterface * ephem = *it;
+      ephem->ephem_update ();
+   }
+}
+
+
+/**
+ * Register the reference frame states, the manager's update state, and the
+ * ephemeris models' own state with a state snapshot. A restore re-posts or
+ * withdraws the deferred update request to match the restored
+ * update_pending flag.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+EphemeridesManager::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   RefFrameManager::add_snapshot_regions (snapshot);
+
+   snapshot.add_item (update_time);
+   snapshot.add_item (update_pending);
+   for (EphemerisInterface * ephem : ephemerides) {
+      ephem->add_snapshot_regions (snapshot);
+   }
+
+   snapshot.add_restore_action ([this] () {
+      if (update_pending) {
+         RefFrame::defer_state_refresh (*this);
+      }
+      else {
+         RefFrame::cancel_state_refresh (*this);
+      }
+   });
+}
+
+
+/**
+ * Perform a deferred update on behalf of a reference frame state query.
+ */
+void
+EphemeridesManager::refresh_frame_states (
+   void)
+{
+   refresh_ephemerides ();
+}
+
+
 /**
  * Activate ephemeris items based on frame subscription status,
  * activate ephemeris models, and build the reference frame tree.
@@ -713,6 +910,13 @@ EphemeridesManager::activate_ephemerides (
       return;
    }
 
+   // Update an existing tree in place if so configured.
+   if (incremental_tree_rebuild && ref_frame_tree_built &&
+       rebuild_tree_incrementally ()) {
+      regenerate_ref_frame_tree = false;
+      update_tree_index ();
+      return;
+   }
 
    // Disconnect the registered ephemeris items from the tree.
    for (std::vector<EphemerisItem *>::const_iterator it = ephem_items.begin();
@@ -756,6 +960,65 @@ EphemeridesManager::activate_ephemerides (
    // This will be the case if the base (dependency-free) ephemeris models
    // are registered first and if the dependencies form an acyclic graph.
    regenerate_ref_frame_tree = false;
+   ref_frame_tree_built = true;
+
+   // Flatten the rebuilt tree.
+   update_tree_index ();
+}
+
+
+/**
+ * Update the existing reference frame tree in place.
+ * The ephemeris models are activated and asked to build the tree as in a
+ * full rebuild, but without first disconnecting their frames. Adding a frame
+ * that is already attached to the requested parent is a no-op, so only the
+ * frames whose place in the tree has changed are moved, and the relative
+ * state caches are invalidated only if some frame does move. The frames of
+ * items that are no longer active are then removed from the tree.
+ * @return True if the tree was updated, false if the root of the tree
+ *   changed, in which case a full rebuild is needed
+ */
+bool
+EphemeridesManager::rebuild_tree_incrementally (
+   void)
+{
+   RefFrame * old_root = root_node;
+
+   // Activate the ephemeris models in reverse order and then build the tree
+   // from the base models downward, as in activate_ephemerides.
+   for (std::vector<EphemerisInterface *>::reverse_iterator it =
+           ephemerides.rbegin();
+        it != ephemerides.rend();
+        ++it) {
+      EphemerisInterface * ephem = *it;
+      ephem->ephem_activate (*this);
+   }
+
+   for (std::vector<EphemerisInterface *>::const_iterator it =
+           ephemerides.begin();
+        it != ephemerides.end();
+        ++it) {
+      EphemerisInterface * ephem = *it;
+      ephem->ephem_build_tree (*this);
+   }
+
+   // Frames that hang off an abandoned root cannot be salvaged piecemeal.
+   if (root_node != old_root) {
+      return false;
+   }
+
+   // Remove the frames of items that have dropped out of the tree.
+   // Only the enabled item in each same-named list owns the target frame.
+   for (std::vector<EphemerisItem *>::const_iterator it = ephem_items.begin();
+        it != ephem_items.end();
+        ++it) {
+      EphemerisItem * ephem_item = (*it)->get_enabled_item ();
+      if (ephem_item != nullptr) {
+         ephem_item->prune_from_tree ();
+      }
+   }
+
+   return true;
 }
 
 } // End JEOD namespace
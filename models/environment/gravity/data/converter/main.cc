@@ -0,0 +1,180 @@
+/*
+ * Convert the compiled-in spherical harmonics gravity fields to binary
+ * coefficient files (see SphericalHarmonicsCoeffFile).
+ *
+ * Usage:
+ *   convert_coeffs <output_dir> [field ...]
+ *
+ * Each named field (all fields if none are named) is written to
+ * <output_dir>/<field>.jshc, then mapped back and compared value by value
+ * against the compiled-in data. Fields are named after their data sources,
+ * e.g. earth_GGM05C.
+ *
+ * The binary files are then used with
+ * SphericalHarmonicsGravitySource_coeff_file_default_data in place of the
+ * compiled-in initializer.
+ */
+
+// System includes
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// JEOD includes
+#include "environment/gravity/include/spherical_harmonics_coeff_file.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/gravity/data/include/earth_GEMT1.hh"
+#include "environment/gravity/data/include/earth_GGM02C.hh"
+#include "environment/gravity/data/include/earth_GGM05C.hh"
+#include "environment/gravity/data/include/earth_spherical.hh"
+#include "environment/gravity/data/include/jupiter_spherical.hh"
+#include "environment/gravity/data/include/mars_MRO110B2.hh"
+#include "environment/gravity/data/include/mars_spherical.hh"
+#include "environment/gravity/data/include/moon_GRAIL150.hh"
+#include "environment/gravity/data/include/moon_LP150Q.hh"
+#include "environment/gravity/data/include/moon_spherical.hh"
+#include "environment/gravity/data/include/sun_spherical.hh"
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace jeod;
+
+namespace {
+
+/**
+ * Create the default data initializer for a field.
+ */
+template <typename Data>
+SphericalHarmonicsGravitySource_default_data *
+make_field ()
+{
+   return new Data;
+}
+
+/**
+ * A compiled-in field and the factory for its initializer.
+ */
+struct FieldEntry {
+   const char * name;
+   SphericalHarmonicsGravitySource_default_data * (*make) ();
+};
+
+const FieldEntry fields[] = {
+   {"earth_GEMT1",
+    make_field<SphericalHarmonicsGravitySource_earth_GEMT1_default_data>},
+   {"earth_GGM02C",
+    make_field<SphericalHarmonicsGravitySource_earth_GGM02C_default_data>},
+   {"earth_GGM05C",
+    make_field<SphericalHarmonicsGravitySource_earth_GGM05C_default_data>},
+   {"earth_spherical",
+    make_field<SphericalHarmonicsGravitySource_earth_spherical_default_data>},
+   {"jupiter_spherical",
+    make_field<SphericalHarmonicsGravitySource_jupiter_spherical_default_data>},
+   {"mars_MRO110B2",
+    make_field<SphericalHarmonicsGravitySource_mars_MRO110B2_default_data>},
+   {"mars_spherical",
+    make_field<SphericalHarmonicsGravitySource_mars_spherical_default_data>},
+   {"moon_GRAIL150",
+    make_field<SphericalHarmonicsGravitySource_moon_GRAIL150_default_data>},
+   {"moon_LP150Q",
+    make_field<SphericalHarmonicsGravitySource_moon_LP150Q_default_data>},
+   {"moon_spherical",
+    make_field<SphericalHarmonicsGravitySource_moon_spherical_default_data>},
+   {"sun_spherical",
+    make_field<SphericalHarmonicsGravitySource_sun_spherical_default_data>},
+};
+
+const unsigned int num_fields = sizeof(fields) / sizeof(fields[0]);
+
+
+/**
+ * Write one field and verify the result by mapping it back.
+ * @return Number of mismatches
+ */
+unsigned int
+convert_field (
+   const FieldEntry & field,
+   const std::string & out_dir)
+{
+   std::string path = out_dir + "/" + field.name + ".jshc";
+   SphericalHarmonicsGravitySource_default_data * init = field.make ();
+   SphericalHarmonicsGravitySource compiled;
+   SphericalHarmonicsGravitySource mapped;
+   unsigned int mismatches = 0;
+
+   init->initialize (&compiled);
+   delete init;
+
+   SphericalHarmonicsCoeffFile::write_file (compiled, path);
+   mapped.map_coefficient_file (path);
+
+   if ((mapped.name != compiled.name) ||
+       (mapped.mu != compiled.mu) ||
+       (mapped.radius != compiled.radius) ||
+       (mapped.degree != compiled.degree) ||
+       (mapped.order != compiled.order) ||
+       (mapped.tide_free != compiled.tide_free) ||
+       (mapped.tide_free_delta != compiled.tide_free_delta)) {
+      ++mismatches;
+   }
+   else {
+      for (unsigned int ii = 2; ii <= compiled.degree; ++ii) {
+         unsigned int jj_max = (ii < compiled.order) ? ii : compiled.order;
+         for (unsigned int jj = 0; jj <= jj_max; ++jj) {
+            if ((mapped.Cnm[ii][jj] != compiled.Cnm[ii][jj]) ||
+                (mapped.Snm[ii][jj] != compiled.Snm[ii][jj])) {
+               ++mismatches;
+            }
+         }
+      }
+   }
+
+   std::printf ("%-18s degree %3u order %3u -> %s%s\n",
+                field.name, compiled.degree, compiled.order, path.c_str(),
+                (mismatches == 0) ? "" : "  MISMATCH");
+
+   return mismatches;
+}
+
+}
+
+
+int
+main (
+   int argc,
+   char * argv[])
+{
+   TestSimInterface test_sim_interface;
+
+   if (argc < 2) {
+      std::fprintf (stderr, "Usage: %s <output_dir> [field ...]\n", argv[0]);
+      return 1;
+   }
+
+   std::string out_dir = argv[1];
+   unsigned int failures = 0;
+
+   if (argc == 2) {
+      for (unsigned int ii = 0; ii < num_fields; ++ii) {
+         failures += convert_field (fields[ii], out_dir);
+      }
+   }
+   else {
+      for (int arg = 2; arg < argc; ++arg) {
+         const FieldEntry * entry = nullptr;
+         for (unsigned int ii = 0; ii < num_fields; ++ii) {
+            if (std::strcmp (fields[ii].name, argv[arg]) == 0) {
+               entry = &fields[ii];
+            }
+         }
+         if (entry == nullptr) {
+            std::fprintf (stderr, "Unknown field '%s'\n", argv[arg]);
+            ++failures;
+         }
+         else {
+            failures += convert_field (*entry, out_dir);
+         }
+      }
+   }
+
+   return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+/*******************************************************************************
+
+Purpose:
+  (Initialize a spherical harmonics gravity source by mapping a binary
+   coefficient file. The file supplies the name, mu, radius, tide parameters,
+   degree, order and the Cnm/Snm coefficients.)
+
+*******************************************************************************/
+
+
+// JEOD includes
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+
+// Unsupported includes
+#include "../include/coeff_file.hh"
+
+
+
+//! Namespace jeod 
+namespace jeod {
+
+void
+SphericalHarmonicsGravitySource_coeff_file_default_data::initialize (
+   SphericalHarmonicsGravitySource * SphericalHarmonicsGravitySource_ptr)
+{
+   SphericalHarmonicsGravitySource_ptr->map_coefficient_file (file_name);
+}
+
+} // End JEOD namespace
@@ -70,39 +70,29 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->tide_free_delta = 0.0;
 
    SphericalHarmonicsGravitySource_ptr->Cnm =
-      JEOD_ALLOC_PRIM_ARRAY (36 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (36 + 1, 0, double);
    SphericalHarmonicsGravitySource_ptr->Snm =
-      JEOD_ALLOC_PRIM_ARRAY (36 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (36 + 1, 0, double);
 
    /* FULLY NORMALIZED GRAVITY COEFFICIENTS (unitless) */
-   SphericalHarmonicsGravitySource_ptr->Cnm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  0] = -4.84164990600E-04;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  1] = -1.70000000000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  2] = +2.43892800000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  0] = +9.57237510000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  1] = +2.02977370000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  2] = +9.03549100000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  3] = +7.20986620000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  0] = +5.38732190000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  1] = -5.33427220000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  2] = +3.47002080000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  3] = +9.90977900000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  4] = -1.90034800000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  0] = +6.87801610000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  1] = -5.89503100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  2] = +6.55790250000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  3] = -4.48203580000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  4] = -2.94823610000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  5] = +1.77756280000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  0] = -1.48100380000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  1] = -8.13750940000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  2] = +5.16095780000E-08;
@@ -110,8 +100,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  4] = -9.27974690000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  5] = -2.65764970000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  6] = +9.05931100000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  0] = +9.05337050000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  1] = +2.77097140000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  2] = +3.17710790000E-07;
@@ -120,8 +108,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  5] = +3.47497840000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  6] = -3.57852660000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  7] = +1.59760400000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  0] = +4.59023210000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  1] = +2.88560510000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  2] = +7.03800740000E-08;
@@ -131,8 +117,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  6] = -6.64178000000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  7] = +7.04248290000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  8] = -1.18882720000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  0] = +2.83763620000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  1] = +1.48044700000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  2] = +3.11365340000E-08;
@@ -143,8 +127,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  7] = -1.18623340000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  8] = +1.84495360000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  9] = -5.55457050000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  0] = +5.72210600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  1] = +7.69655200000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  2] = -8.05212060000E-08;
@@ -156,8 +138,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  8] = +4.37468260000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  9] = +1.28179660000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][ 10] = +9.45595880000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  0] = -5.12618540000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  1] = +9.50185410000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  2] = +9.05414690000E-09;
@@ -170,8 +150,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  9] = -3.87773530000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 10] = -5.20581680000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 11] = +5.43322370000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  0] = +3.20805600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  1] = -4.92610480000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  2] = +7.64002570000E-09;
@@ -185,8 +163,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 10] = -9.12732300000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 11] = +5.41428220000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 12] = -3.52802750000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  0] = +4.22318830000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  1] = -5.40616880000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  2] = +5.34360600000E-08;
@@ -201,8 +177,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 11] = -4.01906160000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 12] = -2.80059220000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 13] = -6.15483300000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  0] = -1.97326570000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  1] = -1.87462230000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  2] = -3.48121510000E-08;
@@ -218,8 +192,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 12] = +8.96810350000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 13] = +3.15333020000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 14] = -5.05657210000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  0] = +1.87309940000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  1] = +8.28676030000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  2] = -2.16258250000E-08;
@@ -236,8 +208,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 13] = -2.81050770000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 14] = +6.17072820000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 15] = -1.80947920000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  0] = -9.37724390000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  1] = +3.17099490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  2] = -1.56436890000E-08;
@@ -255,8 +225,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 14] = -1.91225990000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 15] = -1.25320650000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 16] = -3.24114130000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  0] = +2.03967680000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  1] = -3.09381010000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  2] = -5.77999600000E-09;
@@ -275,8 +243,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 15] = +4.94351840000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 16] = -2.90683220000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 17] = -3.83106040000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  0] = +1.12912370000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  1] = -2.25302450000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  2] = +8.40826470000E-09;
@@ -296,8 +262,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 16] = +9.78795690000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 17] = +6.11416360000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 18] = -4.44924880000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  0] = -4.60839520000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  1] = -1.15942070000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  2] = +8.43691620000E-09;
@@ -318,8 +282,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 17] = +2.79458830000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 18] = +2.16466510000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 19] = +6.46384890000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  0] = +1.53149980000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  1] = +1.45119240000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  2] = +1.98772090000E-08;
@@ -341,8 +303,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 18] = +1.05771240000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 19] = -7.09803700000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 20] = +1.70849490000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  0] = +9.77545000000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  1] = -1.53941590000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  2] = +9.87387270000E-10;
@@ -365,8 +325,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 19] = -2.09514960000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 20] = -1.90411260000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 21] = +2.47748050000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  0] = -4.84401690000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  1] = +8.39456380000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  2] = -1.42924650000E-08;
@@ -390,8 +348,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 20] = -1.33152090000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 21] = -1.32244250000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 22] = -1.46230260000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  0] = -2.41260420000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  1] = +8.65710680000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  2] = -5.31329260000E-10;
@@ -416,8 +372,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 21] = +1.08195480000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 22] = -9.03355770000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 23] = +8.44574390000E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  0] = -9.55580880000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  1] = +8.11784180000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  2] = -5.85151410000E-09;
@@ -443,8 +397,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 22] = -1.73215680000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 23] = -2.14353780000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 24] = +2.34376750000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  0] = +6.88666920000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  1] = +3.71445180000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  2] = +3.72200080000E-09;
@@ -471,8 +423,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 23] = +4.57432540000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 24] = +3.60647930000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 25] = +4.94553030000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  0] = +1.83906580000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  1] = +4.97405990000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  2] = -5.28869970000E-09;
@@ -500,8 +450,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 24] = -1.37360480000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 25] = -3.98758360000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 26] = +3.42814190000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  0] = +4.12338320000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  1] = +5.22988610000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  2] = +1.02174020000E-08;
@@ -530,8 +478,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 25] = +1.18013610000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 26] = -5.00801530000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 27] = +6.89452120000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  0] = -5.85414280000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  1] = +6.52937230000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  2] = -8.42756010000E-09;
@@ -561,8 +507,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 26] = +3.44206990000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 27] = -9.92470080000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 28] = +6.76886630000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  0] = -3.90911110000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  1] = +3.46988880000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  2] = +9.46319960000E-09;
@@ -593,8 +537,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 27] = -7.47245370000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 28] = +1.03225640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 29] = +8.63659400000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  0] = -2.74880960000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  1] = -1.61707870000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  2] = -4.05152490000E-09;
@@ -626,8 +568,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 28] = -8.96581090000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 29] = +4.82266700000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 30] = -1.50752570000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  0] = +5.11539350000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  1] = +5.17818920000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  2] = +6.60083810000E-09;
@@ -660,8 +600,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 29] = -5.42145720000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 30] = -2.45271210000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 31] = -2.31888560000E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  0] = +8.18726590000E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  1] = -9.15292280000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  2] = +1.86489750000E-09;
@@ -695,8 +633,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 30] = +8.28933850000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 31] = -7.61613010000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 32] = +7.27732340000E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  0] = +2.22863650000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  1] = +1.26724930000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  2] = -1.02310500000E-09;
@@ -731,8 +667,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 31] = +1.74528970000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 32] = +2.41001590000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 33] = -2.67555230000E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  0] = -2.48030740000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  1] = -1.56082270000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  2] = +3.58171860000E-09;
@@ -768,8 +702,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 32] = -8.16643940000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 33] = +1.02342630000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 34] = -2.09267540000E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  0] = +1.27308880000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  1] = -1.90689600000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  2] = -2.55286040000E-09;
@@ -806,8 +738,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 33] = -2.88058910000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 34] = -5.16784900000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 35] = +9.37981980000E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  0] = +7.39593030000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  1] = +2.87744290000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  2] = +1.78958250000E-10;
@@ -846,34 +776,24 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 35] = +2.15238850000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 36] = +1.48368460000E-10;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  1] = +1.19000000000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  2] = -1.39983970000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  1] = +2.49594630000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  2] = -6.20419820000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  3] = +1.41316940000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  1] = -4.75118910000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  2] = +6.64030420000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  3] = -2.00621490000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  4] = +3.08459550000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  1] = -9.55434630000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  2] = -3.23405590000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  3] = -2.15136330000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  4] = +5.24087370000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  5] = -6.66028110000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  1] = +2.38900500000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  2] = -3.74995600000E-07;
@@ -881,8 +801,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  4] = -4.73306950000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  5] = -5.37747240000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  6] = -2.36334420000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  1] = +9.78177380000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  2] = +9.16082670000E-08;
@@ -891,8 +809,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  5] = +1.96518960000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  6] = +1.50917510000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  7] = +2.20012810000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  1] = +5.47222780000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  2] = +6.84493570000E-08;
@@ -902,8 +818,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  6] = +3.12832280000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  7] = +7.48625720000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  8] = +1.22332000000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  1] = +2.45251400000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  2] = -3.23882070000E-08;
@@ -914,8 +828,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  7] = -1.00551000000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  8] = -1.84944460000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  9] = +9.75888720000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  1] = -1.38110960000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  2] = -5.13355600000E-08;
@@ -927,8 +839,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  8] = -9.24807660000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  9] = -4.81859950000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][ 10] = -2.01040570000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  1] = -2.78111430000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  2] = -9.92414170000E-08;
@@ -941,8 +851,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  9] = +4.02849080000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 10] = -1.76125840000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 11] = -5.47287550000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  1] = -4.96519620000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  2] = +3.49183070000E-08;
@@ -956,8 +864,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 10] = +3.16782460000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 11] = -9.52275760000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 12] = -1.17963610000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  1] = +4.34554610000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  2] = -5.75844260000E-08;
@@ -972,8 +878,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 11] = +5.50147110000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 12] = +8.64101590000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 13] = +6.82661440000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  1] = +2.32243640000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  2] = -6.06813880000E-09;
@@ -989,8 +893,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 12] = -3.20667900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 13] = +4.46234250000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 14] = -6.37411390000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  1] = +1.42124350000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  2] = -3.64424710000E-08;
@@ -1007,8 +909,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 13] = -4.98293390000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 14] = -2.56131750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 15] = -8.08536140000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  1] = +1.73492820000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  2] = +2.45431380000E-08;
@@ -1026,8 +926,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 14] = -3.82895490000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 15] = -3.22958120000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 16] = -4.36859000000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  1] = -2.68459110000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  2] = +1.71247490000E-08;
@@ -1046,8 +944,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 15] = +5.74928710000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 16] = +1.88479330000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 17] = -2.06234450000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  1] = -4.56054690000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  2] = +1.68427810000E-08;
@@ -1067,8 +963,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 16] = +5.00243820000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 17] = +8.76634780000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 18] = -5.06465860000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  1] = +5.37643460000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  2] = -1.04744060000E-08;
@@ -1089,8 +983,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 17] = -1.08836650000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 18] = -3.11309680000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 19] = +1.04243680000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  1] = -2.12710950000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  2] = +3.22594790000E-09;
@@ -1112,8 +1004,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 18] = +1.30235240000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 19] = +8.45855720000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 20] = -1.35050930000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  1] = +4.17458540000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  2] = -2.60674520000E-09;
@@ -1136,8 +1026,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 19] = +1.58789980000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 20] = +1.85360670000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 21] = -6.85102090000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  1] = -1.47249990000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  2] = +2.09575500000E-09;
@@ -1161,8 +1049,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 20] = +1.47789300000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 21] = +7.59831610000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 22] = +4.71823740000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  1] = +1.45970120000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  2] = -1.77804010000E-09;
@@ -1187,8 +1073,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 21] = +7.64283540000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 22] = -2.14446980000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 23] = +2.02975960000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  1] = -2.91986510000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  2] = +5.20223220000E-09;
@@ -1214,8 +1098,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 22] = -1.30331600000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 23] = -9.00553280000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 24] = -1.21293820000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  1] = +4.34981070000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  2] = +5.20678080000E-09;
@@ -1242,8 +1124,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 23] = -2.46329700000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 24] = -3.85841110000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 25] = +4.01411760000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  1] = -1.72518080000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  2] = +2.52200780000E-10;
@@ -1271,8 +1151,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 24] = +1.21837320000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 25] = +8.24876280000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 26] = -4.26898200000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  1] = +6.61132110000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  2] = -2.82231920000E-09;
@@ -1301,8 +1179,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 25] = +3.14533010000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 26] = +4.00352970000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 27] = +3.45379430000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  1] = -1.00250690000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  2] = -1.15524280000E-08;
@@ -1332,8 +1208,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 26] = +1.68106100000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 27] = +1.33363420000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 28] = +1.94925850000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  1] = +2.41755640000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  2] = -4.33108410000E-09;
@@ -1364,8 +1238,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 27] = -2.15065140000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 28] = -1.96254300000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 29] = +3.16005340000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  1] = -9.08860010000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  2] = -5.36449180000E-09;
@@ -1397,8 +1269,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 28] = -5.15885330000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 29] = +1.23957410000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 30] = -4.22144380000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  1] = +2.38294290000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  2] = +8.36178170000E-10;
@@ -1431,8 +1301,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 29] = -5.95016120000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 30] = +8.42302690000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 31] = -7.36960320000E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  1] = -9.24508960000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  2] = +4.37486730000E-09;
@@ -1466,8 +1334,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 30] = +1.67128750000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 31] = -2.71251890000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 32] = +5.06771610000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  1] = +2.12580630000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  2] = +9.54795240000E-10;
@@ -1502,8 +1368,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 31] = +1.15657840000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 32] = -2.19248170000E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 33] = -3.60339580000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  1] = -9.10113130000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  2] = +5.17831910000E-09;
@@ -1539,8 +1403,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 32] = -1.16104810000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 33] = +1.38133040000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 34] = -6.03855430000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  1] = +2.01103940000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  2] = +1.02769330000E-09;
@@ -1577,8 +1439,6 @@ SphericalHarmonicsGravitySource_earth_GEMT1_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 33] = +1.66554210000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 34] = +1.23732280000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 35] = -1.44985130000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  0] = +0.00000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  1] = -5.84084900000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  2] = +1.29221840000E-09;
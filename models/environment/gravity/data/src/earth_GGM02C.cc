@@ -67,39 +67,29 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->tide_free_delta = 4.173E-09;
 
    SphericalHarmonicsGravitySource_ptr->Cnm =
-      JEOD_ALLOC_PRIM_ARRAY (200 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (200 + 1, 0, double);
    SphericalHarmonicsGravitySource_ptr->Snm =
-      JEOD_ALLOC_PRIM_ARRAY (200 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (200 + 1, 0, double);
 
    /* FULLY NORMALIZED GRAVITY COEFFICIENTS (unitless) */
-   SphericalHarmonicsGravitySource_ptr->Cnm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  0] = -4.8416938905481E-04;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  1] = -2.0458338184745E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  2] = +2.4393233001191E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  0] = +9.5718508415439E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  1] = +2.0304752656064E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  2] = +9.0480066975068E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  3] = +7.2128924247650E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  0] = +5.3999143526074E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  1] = -5.3617583789434E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  2] = +3.5051159931087E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  3] = +9.9085503541734E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  4] = -1.8846750474516E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  0] = +6.8715981001179E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  1] = -6.2904051380481E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  2] = +6.5210393080303E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  3] = -4.5187965449909E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  4] = -2.9533633996919E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  5] = +1.7479367861529E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  0] = -1.4994011973125E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  1] = -7.5903534713091E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  2] = +4.8671477410889E-08;
@@ -107,8 +97,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  4] = -8.6024306020762E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  5] = -2.6717044535375E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  6] = +9.4667858117668E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  0] = +9.0504630229132E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  1] = +2.8088898145081E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  2] = +3.3041560746535E-07;
@@ -117,8 +105,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  5] = +1.6601317328580E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  6] = -3.5880775879961E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  7] = +1.5062884219099E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  0] = +4.9481334104780E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  1] = +2.3159979727734E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  2] = +8.0015152191272E-08;
@@ -128,8 +114,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  6] = -6.5962471839471E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  7] = +6.7261439849585E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  8] = -1.2403873503204E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  0] = +2.8023188203329E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  1] = +1.4215021812885E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  2] = +2.1413308310842E-08;
@@ -140,8 +124,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  7] = -1.1797705231858E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  8] = +1.8814003080096E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  9] = -4.7556714055660E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  0] = +5.3320010526550E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  1] = +8.3764843251410E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  2] = -9.3986202660537E-08;
@@ -153,8 +135,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  8] = +4.0596116481898E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  9] = +1.2538272379586E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][ 10] = +1.0042456986404E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  0] = -5.0772496297652E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  1] = +1.5603252740856E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  2] = +2.0113610023582E-08;
@@ -167,8 +147,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  9] = -3.1069260209285E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 10] = -5.2252693035196E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 11] = +4.6240805736467E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  0] = +3.6436967894238E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  1] = -5.3587669208192E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  2] = +1.4267337095997E-08;
@@ -182,8 +160,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 10] = -6.2010070538131E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 11] = +1.1361953743426E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 12] = -2.4302921673268E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  0] = +4.1730252409766E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  1] = -5.1441555334014E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  2] = +5.5308994339435E-08;
@@ -198,8 +174,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 11] = -4.4521661534965E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 12] = -3.1306030156277E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 13] = -6.1214038268934E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  0] = -2.2675630223576E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  1] = -1.8770998216769E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  2] = -3.5920323600066E-08;
@@ -215,8 +189,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 12] = +8.4658375996511E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 13] = +3.2236680407062E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 14] = -5.1870479552529E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  0] = +2.1938322693388E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  1] = +9.4299488689337E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  2] = -2.0527948743249E-08;
@@ -233,8 +205,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 13] = -2.8363185775310E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 14] = +5.2125243568872E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 15] = -1.9031294135798E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  0] = -4.7128981423357E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  1] = +2.6184063113599E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  2] = -2.4508779052270E-08;
@@ -252,8 +222,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 14] = -1.9343214101190E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 15] = -1.4402783187545E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 16] = -3.8301066345348E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  0] = +1.9187200731431E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  1] = -2.5364589012403E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  2] = -2.0099897625433E-08;
@@ -272,8 +240,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 15] = +5.5362224128029E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 16] = -3.0509926770123E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 17] = -3.4701484099776E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  0] = +6.0976201920726E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  1] = +7.2013668056109E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  2] = +1.4726098746291E-08;
@@ -293,8 +259,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 16] = +1.0155259015096E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 17] = +3.4877988252535E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 18] = +2.9916671090789E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  0] = -3.3034085176267E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  1] = -8.9715258160027E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  2] = +3.5738649400192E-08;
@@ -315,8 +279,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 17] = +2.8807491962118E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 18] = +3.5064023220539E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 19] = -2.7065395497863E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  0] = +2.1556659702923E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  1] = +5.5666670746573E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  2] = +2.0289718338086E-08;
@@ -338,8 +300,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 18] = +1.5359985644477E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 19] = -3.0440146358946E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 20] = +3.7346984723680E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  0] = +6.2498198636155E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  1] = -1.6156729363691E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  2] = -5.6174615989625E-09;
@@ -362,8 +322,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 19] = -2.7201003392913E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 20] = -2.6932095919664E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 21] = +8.4602819921991E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  0] = -1.0778715511519E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  1] = +1.5680557903106E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  2] = -2.6489965457486E-08;
@@ -387,8 +345,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 20] = -1.6771314695387E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 21] = -2.5319741610433E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 22] = -1.0087144512495E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  0] = -2.2259334727809E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  1] = +9.1754818119132E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  2] = -1.4393196268545E-08;
@@ -413,8 +369,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 21] = +1.5705125652379E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 22] = -1.7971059686011E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 23] = +3.0502385292651E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  0] = -7.4476129651378E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  1] = -2.7294314831498E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  2] = +9.6103425374695E-10;
@@ -440,8 +394,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 22] = +3.9927440033013E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 23] = -6.2066438591588E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 24] = +1.2659219136608E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  0] = +3.2052788703917E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  1] = +6.3720379368273E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  2] = +2.2718054308041E-08;
@@ -468,8 +420,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 23] = +8.5863013475123E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 24] = +4.2345084515301E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 25] = +1.0486058377437E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  0] = +5.8930062593938E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  1] = -1.4601814501511E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  2] = -1.5845767943481E-09;
@@ -497,8 +447,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 24] = +9.0278620559756E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 25] = +3.7614390693751E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 26] = +6.5269290717448E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  0] = +3.6127576173261E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  1] = +2.8599966049198E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  2] = +6.5945040256246E-10;
@@ -527,8 +475,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 25] = +1.2094401683359E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 26] = -6.8324784409421E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 27] = +8.0555348937552E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  0] = -9.7736781072624E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  1] = -5.2779865384750E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  2] = -1.5009439675230E-08;
@@ -558,8 +504,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 26] = +1.2079619341203E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 27] = -8.0065981285775E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 28] = +6.8013154577189E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  0] = -5.2793221991510E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  1] = +4.0272786954162E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  2] = -2.3810717244875E-09;
@@ -590,8 +534,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 27] = -7.7270842331177E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 28] = +9.5418872319034E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 29] = +1.2800169933255E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  0] = +6.2512577463336E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  1] = +2.7198825696084E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  2] = -9.9613838786728E-09;
@@ -623,8 +565,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 28] = -5.8247115989455E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 29] = +3.9003142571595E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 30] = +2.5848811335304E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  0] = +6.7581252678292E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  1] = +7.1203822522680E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  2] = +6.2605627761455E-09;
@@ -657,8 +597,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 29] = -2.0157770889326E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 30] = -8.2987074712076E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 31] = -8.8487236633146E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  0] = -2.4019730060176E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  1] = -7.5969320821133E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  2] = +1.1502974412085E-08;
@@ -692,8 +630,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 30] = -6.9171966153790E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 31] = -6.0918894491375E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 32] = +3.4847133377075E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  0] = -3.6339179038865E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  1] = -1.7509288775285E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  2] = -6.0563486376408E-09;
@@ -728,8 +664,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 31] = +4.2900992226916E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 32] = +6.2420309861325E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 33] = -1.6936831699935E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  0] = -8.9418566654464E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  1] = -4.2095413057569E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  2] = +6.9435005209823E-09;
@@ -765,8 +699,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 32] = +8.9143300953310E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 33] = +1.4020088317239E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 34] = -8.7619607872885E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  0] = +7.7701554304115E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  1] = -1.2545044134397E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  2] = -1.5073065956081E-08;
@@ -803,8 +735,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 33] = +5.6526164112169E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 34] = -7.7690390365236E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 35] = -5.9517323684728E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  0] = -3.6574793015023E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  1] = +4.7298475316073E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  2] = -3.7495972886743E-09;
@@ -842,8 +772,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 34] = -8.9502978081041E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 35] = +1.9221917488393E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 36] = +4.9769217781823E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  0] = -5.7082171779052E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  1] = -6.9582022357908E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  2] = -2.1662166667123E-09;
@@ -882,8 +810,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 35] = -1.0240513678216E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 36] = -4.0042339818638E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 37] = +5.5626145250520E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  0] = -2.4380940993067E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  1] = +5.0899050690598E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  2] = +7.5027136393393E-09;
@@ -923,8 +849,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 36] = +8.7987762093006E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 37] = -3.8467386113620E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 38] = +2.8009609158301E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  0] = +1.2968383959681E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  1] = -4.4311135973065E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  2] = +3.0661970734682E-09;
@@ -965,8 +889,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 37] = +8.8372300762554E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 38] = -9.3913337241971E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 39] = -1.1219365954427E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  0] = -6.2455714246164E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  1] = +3.8025379009013E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  2] = -1.1229156642153E-09;
@@ -1008,8 +930,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 38] = +3.7206114047786E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 39] = +6.4264215061799E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 40] = -1.7561832941912E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  0] = -3.2403526368720E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  1] = -7.1437901638913E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  2] = +3.6133031979764E-09;
@@ -1052,8 +972,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 39] = -5.5204785434564E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 40] = +3.9558232971533E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 41] = +4.1379670877952E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  0] = -2.1849623032935E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  1] = -2.2694825422910E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  2] = -3.8149986950363E-09;
@@ -1097,8 +1015,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 40] = +1.4343307805071E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 41] = +4.9261929291518E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 42] = -6.4935294289024E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  0] = +6.4610632876064E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  1] = -4.8915636130526E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  2] = -9.4416965061188E-09;
@@ -1143,8 +1059,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 41] = -1.9708857527591E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 42] = -8.5723161201995E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 43] = -3.3634607000151E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  0] = +3.4602073117758E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  1] = +5.8039836293162E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  2] = -6.2475215473830E-10;
@@ -1190,8 +1104,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 42] = -7.3570936043626E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 43] = +2.1621025222555E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 44] = +2.8160535798271E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  0] = -3.2537454962300E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  1] = +3.4137338223058E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  2] = +2.0566203175773E-09;
@@ -1238,8 +1150,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 43] = +4.3287135472201E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 44] = +1.1279891638815E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 45] = -4.9833564237922E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  0] = -3.1025567764389E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  1] = +1.7617464830094E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  2] = +5.1122711331990E-09;
@@ -1287,8 +1197,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 44] = +2.8287652279442E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 45] = -9.9852747217893E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 46] = +2.7285904657957E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  0] = +9.3680970063830E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  1] = -6.9252158481003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  2] = +4.3536606368376E-09;
@@ -1337,8 +1245,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 45] = +6.2314790706792E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 46] = -6.9839808598428E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 47] = +2.6940367457366E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  0] = +3.5187596822775E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  1] = +1.4281427838228E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  2] = +4.7191510141752E-09;
@@ -1388,8 +1294,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 46] = -3.0831784449756E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 47] = +3.6819586182750E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 48] = +5.5743099078123E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  0] = +2.0393854921892E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  1] = +6.6435578408485E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  2] = -3.4993595467753E-10;
@@ -1440,8 +1344,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 47] = +3.2407787725089E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 48] = -1.5851337661518E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 49] = +2.5615547845579E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  0] = -4.8435693421767E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  1] = +3.5084193412885E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  2] = -8.0572244233984E-09;
@@ -1493,8 +1395,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 48] = +8.3678677009239E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 49] = +2.2025315109630E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 50] = +4.5223407514827E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  0] = -4.4606637195132E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  1] = +1.7609479435756E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  2] = -7.3337139316854E-09;
@@ -1547,8 +1447,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 49] = -2.2358471021732E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 50] = -2.1172231000477E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 51] = +1.0433919027411E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  0] = +1.2165256822790E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  1] = -1.7554781000479E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  2] = +3.5723542336070E-09;
@@ -1602,8 +1500,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 50] = -5.2779403256968E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 51] = -5.9823817057986E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 52] = -2.1582292266963E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  0] = +7.8606634061236E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  1] = +1.8802009916187E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  2] = +5.8028165353562E-09;
@@ -1658,8 +1554,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 51] = +1.9420103948896E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 52] = +6.2065080888156E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 53] = +1.9852352481362E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  0] = +2.2369915684861E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  1] = -1.6254460642496E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  2] = +2.3144421728259E-09;
@@ -1715,8 +1609,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 52] = +1.3150435834649E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 53] = -2.7152107723483E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 54] = -7.7936238125313E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  0] = +9.9546437312603E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  1] = -2.6871361901873E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  2] = -1.7253000165204E-09;
@@ -1773,8 +1665,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 53] = +3.4305476258205E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 54] = -5.5965992499304E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 55] = +1.6575605904439E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  0] = -4.2733393606300E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  1] = +3.4230459634424E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  2] = -3.1474056202743E-09;
@@ -1832,8 +1722,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 54] = -6.8686569815880E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 55] = -1.0830289536682E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 56] = +1.4766871860658E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  0] = -2.6976480624085E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  1] = +4.9416012247383E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  2] = -3.4900882550458E-09;
@@ -1892,8 +1780,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 55] = +2.7236657579302E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 56] = +6.4686669181514E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 57] = -2.3190352898547E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  0] = -3.4761675360210E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  1] = -1.9792119131660E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  2] = +2.1457206204016E-09;
@@ -1953,8 +1839,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 56] = -2.0748007500065E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 57] = -2.1658729517651E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 58] = -1.2248459331471E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  0] = +3.5442561864810E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  1] = -3.3381863573138E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  2] = +4.7085503954828E-09;
@@ -2015,8 +1899,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 57] = +4.4872554574228E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 58] = +1.7724385440214E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 59] = +2.0806724989469E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  0] = -8.7106682896555E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  1] = +1.8781700826436E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  2] = +3.4868109037288E-09;
@@ -2078,8 +1960,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 58] = -1.8350230633640E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 59] = -2.4946520963421E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 60] = +3.8320461939389E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  0] = +3.4766953715520E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  1] = +2.8702878814778E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  2] = -1.4344803658697E-09;
@@ -2142,8 +2022,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 59] = -4.2280451661661E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 60] = -3.5713921473941E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 61] = -2.0950675545958E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  0] = +1.3719101255313E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  1] = +8.5437603986522E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  2] = -4.1299918941221E-09;
@@ -2207,8 +2085,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 60] = +1.1391769712058E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 61] = +3.5304677809499E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 62] = -2.0628266627182E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  0] = -1.3092851361612E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  1] = -2.9519714557999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  2] = -4.1682096763211E-10;
@@ -2273,8 +2149,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 61] = -3.2597849209813E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 62] = -4.4536642825120E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 63] = -5.0826259825133E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  0] = -4.1394680231531E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  1] = +4.7203704633298E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  2] = -9.4655985887182E-10;
@@ -2340,8 +2214,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 62] = -1.3537667245789E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 63] = +3.0373719484021E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 64] = +5.4974233122725E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  0] = +6.9049816625770E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  1] = -3.1469489792977E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  2] = -9.1957385267681E-11;
@@ -2408,8 +2280,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 63] = +1.4353419001467E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 64] = +3.2735170963832E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 65] = +1.1460622755998E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  0] = -3.6891555475766E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  1] = -2.8704785177568E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  2] = +1.5075397480907E-09;
@@ -2477,8 +2347,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 64] = +1.4201755232064E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 65] = -3.9329178685746E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 66] = -3.1852647778739E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  0] = +4.7184414185701E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  1] = -3.3579641547453E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  2] = +5.8463730029220E-10;
@@ -2547,8 +2415,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 65] = -4.5203442809171E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 66] = +6.0499609894700E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 67] = -8.4445048364875E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  0] = -5.2413194043097E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  1] = +1.8939865232939E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  2] = -4.0613331402078E-09;
@@ -2618,8 +2484,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 66] = +7.1152196572441E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 67] = +3.9052829613475E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 68] = -1.4009730994481E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  0] = +6.2671930203562E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  1] = +6.3080607976932E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  2] = -2.4285971287186E-09;
@@ -2690,8 +2554,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 67] = -2.7959523008151E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 68] = -1.3622019942744E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 69] = +2.1943015226844E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  0] = -5.8076995225918E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  1] = +9.0302822271061E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  2] = +1.0398651954820E-10;
@@ -2763,8 +2625,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 68] = -3.1034404108711E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 69] = -1.7244026505044E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 70] = +3.2166999464436E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  0] = -2.6509371904088E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  1] = -1.6486692771795E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  2] = +4.8005661332208E-10;
@@ -2837,8 +2697,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 69] = -3.1415037815385E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 70] = -1.4097910759973E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 71] = -2.1024515741451E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  0] = -2.3802698210341E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  1] = +7.2098098624026E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  2] = -2.0600808113581E-10;
@@ -2912,8 +2770,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 70] = +1.4308148885780E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 71] = -1.1314542904942E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 72] = +1.1529812218114E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  0] = -3.5007644830056E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  1] = -3.3324998670337E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  2] = +2.2782438586018E-10;
@@ -2988,8 +2844,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 71] = -1.3280317675060E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 72] = +1.4426735785915E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 73] = +9.8440203566836E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  0] = +5.4099338107270E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  1] = -2.5975543684004E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  2] = +7.3646980598374E-10;
@@ -3065,8 +2919,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 72] = +1.8783412945735E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 73] = -7.1369050892039E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 74] = -2.0822683112874E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  0] = -4.5453933474969E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  1] = +1.6772902990123E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  2] = -1.3960850898931E-09;
@@ -3143,8 +2995,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 73] = -1.0943567630920E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 74] = -2.0279499817485E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 75] = +8.5135511512283E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  0] = +1.4691315135056E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  1] = +1.4517401121277E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  2] = -1.6585856302088E-09;
@@ -3222,8 +3072,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 74] = +6.4831854728348E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 75] = +4.8878506679448E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 76] = -1.9406272408993E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  0] = +2.6159621328656E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  1] = +1.8838150169072E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  2] = +1.0189085493038E-09;
@@ -3302,8 +3150,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 75] = +4.3689688522013E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 76] = +6.1227616892363E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 77] = -2.1073415808239E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  0] = +2.8820344390081E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  1] = -1.4387900172444E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  2] = -2.4640262983971E-10;
@@ -3383,8 +3229,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 76] = -1.3588020844494E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 77] = -1.9362018418272E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 78] = +3.2045718157384E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  0] = -9.9449655566228E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  1] = -8.8372988282874E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  2] = -2.8504285949502E-10;
@@ -3465,8 +3309,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 77] = -2.2572323627835E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 78] = -2.1378761678560E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 79] = -1.2661664013159E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  0] = -1.7773819383693E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  1] = -8.4484355891325E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  2] = -2.1535927389244E-09;
@@ -3548,8 +3390,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 78] = -1.3505684195224E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 79] = +1.7533972670224E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 80] = -1.4895563059180E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  0] = +8.9528896897387E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  1] = -1.1525617786488E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  2] = -1.1751626505996E-09;
@@ -3632,8 +3472,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 79] = -1.4501837626975E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 80] = +3.7613671911174E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 81] = +1.7805201663734E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  0] = -1.0030877550374E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  1] = -1.6021384618201E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  2] = +6.9055949849372E-10;
@@ -3717,8 +3555,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 80] = +3.3148553501208E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 81] = -7.4289639843524E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 82] = -3.2479460703513E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  0] = +6.1417239382204E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  1] = +7.8486221330478E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  2] = -6.4956026981353E-13;
@@ -3803,8 +3639,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 81] = +1.9520554336073E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 82] = -2.9816512895293E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 83] = +2.4421034301869E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  0] = +2.9772384252673E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  1] = +2.5237249294427E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  2] = +8.7072444172064E-10;
@@ -3890,8 +3724,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 82] = -1.3523683191767E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 83] = +3.1468443939707E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 84] = +2.6653782667131E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  0] = -1.4890901205844E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  1] = -2.5281488623409E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  2] = +2.3349098653525E-09;
@@ -3978,8 +3810,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 83] = +1.7873624785623E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 84] = +2.5314762362897E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 85] = -3.3368100471024E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  0] = -1.7053987864095E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  1] = +1.3102882567844E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  2] = -4.1504495849411E-10;
@@ -4067,8 +3897,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 84] = -5.2381913928654E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 85] = -1.8815927959027E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 86] = +9.9052717927605E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  0] = +1.7398542014390E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  1] = +6.9320517976666E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  2] = -1.0229693559722E-09;
@@ -4157,8 +3985,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 85] = -1.6117625290077E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 86] = -6.8282733354908E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 87] = +1.2982792413329E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  0] = +1.8176217424379E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  1] = -1.4340723491685E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  2] = -2.8616623947455E-09;
@@ -4248,8 +4074,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 86] = -4.4069650853461E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 87] = +7.3378513820366E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 88] = -1.1938473383432E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  0] = -6.9077318676090E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  1] = -1.0965101471647E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  2] = +7.1200932040033E-10;
@@ -4340,8 +4164,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 87] = -8.1828955572795E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 88] = -3.1789361394536E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 89] = +1.8249383468975E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  0] = -4.0669484776597E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  1] = -6.0345573973869E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  2] = -1.0213937333696E-09;
@@ -4433,8 +4255,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 88] = -1.8173834510559E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 89] = +2.7105217984227E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 90] = +9.0555910845311E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  0] = -5.2401025294200E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  1] = -5.5276166060487E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  2] = +1.6078192219638E-09;
@@ -4527,8 +4347,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 89] = +2.6321552630968E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 90] = -6.0869579292031E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 91] = -2.3796894919173E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  0] = -9.2560494130891E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  1] = -7.7380287465209E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  2] = +9.0360184297687E-10;
@@ -4622,8 +4440,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 90] = +1.9203989551986E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 91] = -2.4794432081452E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 92] = +1.7640863062085E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  0] = +5.9618770498981E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  1] = +6.3287856031501E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  2] = +1.3056793017990E-09;
@@ -4718,8 +4534,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 91] = -2.1677030454779E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 92] = -7.3996548806746E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 93] = -6.5082453417428E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  0] = +1.0087283886740E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  1] = -7.5788903500804E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  2] = -2.3984714864542E-10;
@@ -4815,8 +4629,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 92] = +1.9541719172621E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 93] = -1.4820136945507E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 94] = -2.1421727212843E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  0] = +5.0132076801865E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  1] = +1.8207726083407E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  2] = +2.7730504394335E-10;
@@ -4913,8 +4725,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 93] = +2.3033321857325E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 94] = +2.4318259446748E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 95] = +2.5801400815560E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  0] = -1.2710629243692E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  1] = +5.0514538933538E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  2] = +1.2643785949827E-09;
@@ -5012,8 +4822,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 94] = +1.0616250383270E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 95] = +1.5912170846054E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 96] = -2.2002560536867E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  0] = -5.3485585961942E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  1] = +1.1509424426762E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  2] = -1.3867036519282E-09;
@@ -5112,8 +4920,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 95] = +1.9049808550761E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 96] = -3.0429113144413E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 97] = -1.6594120821266E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  0] = -4.2536355647526E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  1] = -3.9018892512695E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  2] = +2.6988410676120E-10;
@@ -5213,8 +5019,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 96] = -3.6880870621273E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 97] = -2.0692709956771E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 98] = +1.8946942810521E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  0] = +2.2404182662522E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  1] = -1.3881979367307E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  2] = +9.4836884443428E-10;
@@ -5315,8 +5119,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 97] = -1.6080579261126E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 98] = +1.0990969597419E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 99] = +4.5308452034314E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  0] = +2.3542636077152E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  1] = -1.0890966716603E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  2] = +1.6341314888831E-09;
@@ -5418,8 +5220,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 98] = +7.4386964905098E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 99] = +4.0784905809689E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][100] = +8.8043569591782E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  0] = +1.0588837274914E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  1] = +3.2457293587386E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  2] = -2.9088613927340E-10;
@@ -5522,8 +5322,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[101][ 99] = +3.1740927179302E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][100] = -3.0469940965123E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][101] = -6.9804159452536E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  0] = -5.6589841063109E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  1] = +1.0979818937854E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  2] = +3.0113009326779E-10;
@@ -5627,8 +5425,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[102][100] = -8.1675402411481E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][101] = +4.6235651947847E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][102] = -2.4855430681695E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  0] = -3.0013332084631E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  1] = -1.1213764838010E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  2] = -1.7060445151461E-09;
@@ -5733,8 +5529,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[103][101] = -1.0446066578343E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][102] = -9.0861153889535E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][103] = -7.8883212521767E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  0] = -1.0085870205181E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  1] = -6.0992703784407E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  2] = -1.2298363429087E-09;
@@ -5840,8 +5634,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[104][102] = -1.4914685975748E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][103] = +1.3256514056786E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][104] = -2.0369143205211E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  0] = +1.8688139671101E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  1] = -9.6024144083211E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  2] = +1.4470470406536E-09;
@@ -5948,8 +5740,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[105][103] = +2.0928911115284E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][104] = +1.7178840967786E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][105] = -1.9374743756580E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  0] = +1.8696488968654E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  1] = -3.7492821985168E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  2] = +1.3730984327114E-09;
@@ -6057,8 +5847,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[106][104] = -4.7613182148206E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][105] = -3.6327645884857E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][106] = -2.3200555999456E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  0] = +5.9855244976927E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  1] = -1.2229385208449E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  2] = +3.6793557831184E-10;
@@ -6167,8 +5955,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[107][105] = -6.4192163349225E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][106] = +1.1250047302561E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][107] = -1.6068937044189E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  0] = -1.2337027768640E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  1] = +6.0519055539294E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  2] = -2.8687384967402E-09;
@@ -6278,8 +6064,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[108][106] = -2.1485546633561E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][107] = +1.6725875762183E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][108] = -3.9388123073499E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  0] = -1.7729202888117E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  1] = +2.4920261107544E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  2] = -3.0195780794825E-10;
@@ -6390,8 +6174,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[109][107] = -8.1653916797503E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][108] = -8.8323225957448E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][109] = +9.1591084091458E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  0] = -2.7501111762824E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  1] = +3.6518108641692E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  2] = -1.7618768499922E-11;
@@ -6503,8 +6285,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[110][108] = +5.9605669237182E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][109] = +1.5321301989974E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][110] = -7.3747559235071E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[111] =
-      JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  0] = -1.0082396206285E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  1] = -6.5891315170391E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  2] = +2.1261903456242E-09;
@@ -6617,8 +6397,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[111][109] = +7.2403299271437E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][110] = -1.4030885522888E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][111] = -1.6156919874236E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[112] =
-      JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  0] = +7.6155839867292E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  1] = +6.2974022202518E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  2] = +7.8860483979848E-10;
@@ -6732,8 +6510,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[112][110] = -6.9831742417558E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][111] = -1.5786844984070E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][112] = +3.4508978823287E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[113] =
-      JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  0] = +9.4273291371025E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  1] = +6.0594197106707E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  2] = +1.9165463894181E-10;
@@ -6848,8 +6624,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[113][111] = -2.4013401470348E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][112] = +1.8766702981841E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][113] = +1.6718966627387E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[114] =
-      JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  0] = +8.5243237943197E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  1] = -7.1499955900529E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  2] = -4.5421998789643E-10;
@@ -6965,8 +6739,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[114][112] = +5.2113654700751E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][113] = -1.1891449534710E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][114] = +1.2650427151983E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[115] =
-      JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  0] = +1.6601285778519E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  1] = +4.6777373182107E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  2] = -1.2571816845755E-09;
@@ -7083,8 +6855,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[115][113] = -1.0385417759098E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][114] = -5.8513761428280E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][115] = -3.8357731142516E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[116] =
-      JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  0] = +2.7534027895929E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  1] = +5.8368300868294E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  2] = -1.0652597835387E-09;
@@ -7202,8 +6972,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[116][114] = +1.5467170544415E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][115] = -3.8643421142213E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][116] = -7.2438399189317E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[117] =
-      JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  0] = +5.7192238377958E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  1] = +2.4695826400808E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  2] = -1.2892041216558E-09;
@@ -7322,8 +7090,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[117][115] = -4.9274361748655E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][116] = -1.3150160159467E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][117] = +1.7178050303852E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[118] =
-      JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  0] = -3.5860227586512E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  1] = -1.3291762093032E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  2] = +9.9108186227347E-11;
@@ -7443,8 +7209,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[118][116] = -1.6665344389474E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][117] = -6.2784881093536E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][118] = +3.7026704858743E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[119] =
-      JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  0] = -3.2411293666540E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  1] = -1.3419542260821E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  2] = +1.0999474159454E-09;
@@ -7565,8 +7329,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[119][117] = +3.3939211162570E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][118] = +2.3544157351601E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][119] = -5.9654629701827E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[120] =
-      JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  0] = -5.0297015093886E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  1] = +7.0263637676714E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  2] = +3.8803039873180E-10;
@@ -7688,8 +7450,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[120][118] = +9.9481323787307E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][119] = +3.5066719883852E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][120] = -3.7812091421296E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[121] =
-      JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  0] = +1.3750852395808E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  1] = +1.0051553951682E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  2] = -1.6266252374078E-10;
@@ -7812,8 +7572,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[121][119] = +3.8030282425587E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][120] = -1.1426763632863E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][121] = -1.9168073667942E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[122] =
-      JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  0] = +3.1469056568230E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  1] = +1.0732209032514E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  2] = -1.5781579909815E-10;
@@ -7937,8 +7695,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[122][120] = +9.0368457806189E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][121] = -3.1740388500994E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][122] = -6.5523546400448E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[123] =
-      JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  0] = +3.1282216178307E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  1] = +5.4740242900555E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  2] = -8.1624055764722E-10;
@@ -8063,8 +7819,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[123][121] = -7.4773830352017E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][122] = -9.5113924657175E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][123] = +1.0681108526056E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[124] =
-      JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  0] = +3.0431041342935E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  1] = -2.1598331927136E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  2] = -5.2316922323161E-10;
@@ -8190,8 +7944,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[124][122] = -6.9120236875020E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][123] = +2.1696812583995E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][124] = +8.1689989330088E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[125] =
-      JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  0] = +3.3972382419223E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  1] = -6.9185699210780E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  2] = -5.7447849939154E-10;
@@ -8318,8 +8070,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[125][123] = +8.0525783261441E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][124] = +5.4071829416263E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][125] = -4.4798787820655E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[126] =
-      JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  0] = +2.4641525566245E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  1] = -4.8301063221448E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  2] = -8.6226894773261E-11;
@@ -8447,8 +8197,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[126][124] = -1.0955714670529E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][125] = -1.7900037007711E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][126] = -9.3037195251695E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[127] =
-      JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  0] = +5.9537315667916E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  1] = -4.0320599229975E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  2] = +1.8839397760755E-09;
@@ -8577,8 +8325,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[127][125] = -1.1313870961277E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][126] = +5.2412425328754E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][127] = +8.3244733308689E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[128] =
-      JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  0] = -2.2520216009695E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  1] = +2.9399927128490E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  2] = +1.7676432024707E-09;
@@ -8708,8 +8454,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[128][126] = +8.2413724216288E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][127] = -4.6163981305672E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][128] = -7.9612100286768E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[129] =
-      JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  0] = -2.6060744726233E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  1] = +4.5741527922543E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  2] = -1.0709725741425E-11;
@@ -8840,8 +8584,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[129][127] = -1.1713434443528E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][128] = +7.7876711755374E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][129] = +2.2220363486505E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[130] =
-      JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  0] = -1.9476296934074E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  1] = -1.6315606715243E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  2] = -6.3088240746479E-10;
@@ -8973,8 +8715,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[130][128] = +3.1057179946385E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][129] = +2.1663209937573E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][130] = -1.5002506534582E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[131] =
-      JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  0] = -4.3728849665405E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  1] = +1.8877807968664E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  2] = -1.3664032300278E-09;
@@ -9107,8 +8847,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[131][129] = +2.0102661435883E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][130] = -1.6852686414732E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][131] = -1.1348359892112E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[132] =
-      JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  0] = -1.8799556280694E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  1] = +8.4757247612500E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  2] = -4.1886927105409E-10;
@@ -9242,8 +8980,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[132][130] = +5.8856995267035E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][131] = -1.1101149979857E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][132] = +1.0593564277062E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[133] =
-      JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  0] = +1.6208159866697E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  1] = +7.2781109219494E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  2] = +2.7550496188525E-10;
@@ -9378,8 +9114,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[133][131] = -8.7052854913586E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][132] = +9.3955452056356E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][133] = +8.7899670072339E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[134] =
-      JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  0] = +4.9693030210093E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  1] = -2.1651053871123E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  2] = +1.2315756872944E-09;
@@ -9515,8 +9249,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[134][132] = -1.8593718838502E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][133] = -3.0265059029469E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][134] = -3.8255362633722E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[135] =
-      JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  0] = +5.2722060480402E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  1] = -9.3902400630417E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  2] = -8.6140132559115E-10;
@@ -9653,8 +9385,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[135][133] = -2.0596990512671E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][134] = -9.6475830394984E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][135] = +6.0388930462807E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[136] =
-      JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  0] = -1.9612653095161E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  1] = -1.0382217219077E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  2] = -4.7734785333989E-10;
@@ -9792,8 +9522,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[136][134] = +1.6873976337759E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][135] = -2.8860941566374E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][136] = -1.5326319720553E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[137] =
-      JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  0] = -7.6601491117346E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  1] = -5.7185023562838E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  2] = -5.0401765476767E-10;
@@ -9932,8 +9660,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[137][135] = -2.4764088791687E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][136] = -1.4573592783632E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][137] = -2.2386186260720E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[138] =
-      JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  0] = -6.4539037800398E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  1] = +5.0134049053996E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  2] = +8.8345418075265E-11;
@@ -10073,8 +9799,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[138][136] = -1.4863257210317E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][137] = +1.0794052907173E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][138] = +1.7005815410984E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[139] =
-      JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  0] = +4.0834034842905E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  1] = -4.2022403749150E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  2] = -7.4145140911631E-11;
@@ -10215,8 +9939,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[139][137] = +9.8575776445362E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][138] = +5.3500930733883E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][139] = -3.3090492627024E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[140] =
-      JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  0] = +6.6882534003072E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  1] = +1.0859017621618E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  2] = +1.5378257847932E-10;
@@ -10358,8 +10080,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[140][138] = +4.1108892396400E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][139] = -1.2860628980350E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][140] = -2.0242127360575E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[141] =
-      JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  0] = +5.6384247866891E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  1] = +3.8162873956541E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  2] = +4.5673302952894E-10;
@@ -10502,8 +10222,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[141][139] = -8.2210276489957E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][140] = +6.2376532624095E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][141] = +3.1406446085468E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[142] =
-      JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  0] = +3.9529154369745E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  1] = +2.9266460607872E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  2] = -4.3607821730611E-10;
@@ -10647,8 +10365,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[142][140] = +1.5607716883122E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][141] = -3.5875758985064E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][142] = +9.1324473335810E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[143] =
-      JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  0] = -9.0714384725414E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  1] = -6.4149303576441E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  2] = -1.2440706112114E-09;
@@ -10793,8 +10509,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[143][141] = +7.6363886507364E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][142] = -7.2229857240306E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][143] = -1.3784101468346E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[144] =
-      JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  0] = -6.2361665991068E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  1] = -5.8751328801003E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  2] = -1.8442837234706E-10;
@@ -10940,8 +10654,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[144][142] = +1.3496543741103E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][143] = +2.0724999789239E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][144] = +2.6430027032830E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[145] =
-      JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  0] = +1.1898549686736E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  1] = -6.0419617101113E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  2] = +1.0777205338452E-09;
@@ -11088,8 +10800,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[145][143] = -3.4435971869181E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][144] = -8.9432744572973E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][145] = -1.8006731678018E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[146] =
-      JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  0] = +1.2125599147899E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  1] = -4.5112179549917E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  2] = +5.2004086181700E-10;
@@ -11237,8 +10947,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[146][144] = +6.2265223400710E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][145] = +4.6985579266970E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][146] = +3.7848907983516E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[147] =
-      JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  0] = -5.7659281447202E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  1] = +8.6684681766549E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  2] = +1.0895868107073E-10;
@@ -11387,8 +11095,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[147][145] = -1.1562492507056E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][146] = +9.2027910350221E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][147] = +1.6443131855272E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[148] =
-      JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  0] = -1.2777987566773E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  1] = +8.5098343205725E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  2] = -2.6712366318856E-10;
@@ -11538,8 +11244,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[148][146] = +6.8109762427755E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][147] = -7.9586425206242E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][148] = -6.7008944228273E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[149] =
-      JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  0] = -9.5918789243487E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  1] = +3.3171969735939E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  2] = +2.0095019664741E-10;
@@ -11690,8 +11394,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[149][147] = +4.0890020838728E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][148] = +3.6502472748047E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][149] = +1.1460445642031E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[150] =
-      JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  0] = +3.0290975666989E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  1] = -3.1062665668250E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  2] = -1.7547374301528E-10;
@@ -11843,8 +11545,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[150][148] = +3.1585877194883E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][149] = +2.1145881071866E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][150] = -8.7864662064096E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[151] =
-      JEOD_ALLOC_PRIM_ARRAY (152, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[151][  0] = +8.1441485852637E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][  1] = +7.8022986879293E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][  2] = -5.9239362195335E-10;
@@ -11997,8 +11697,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[151][149] = +1.0614647111085E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][150] = -9.5175430537060E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][151] = +2.7000793408945E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[152] =
-      JEOD_ALLOC_PRIM_ARRAY (153, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[152][  0] = +2.2923849586361E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][  1] = +2.1347215675000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][  2] = -8.3643292572489E-10;
@@ -12152,8 +11850,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[152][150] = -1.7679021894639E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][151] = -3.0407956515922E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][152] = +1.3171489090047E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[153] =
-      JEOD_ALLOC_PRIM_ARRAY (154, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[153][  0] = +8.6509554436059E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][  1] = +4.2764170890135E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][  2] = -5.8398259021294E-10;
@@ -12308,8 +12004,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[153][151] = -1.8601130325499E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][152] = +5.7785798118925E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][153] = -3.1962174518162E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[154] =
-      JEOD_ALLOC_PRIM_ARRAY (155, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[154][  0] = +8.3984842024249E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][  1] = -1.0461666284477E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][  2] = +4.8708118660373E-10;
@@ -12465,8 +12159,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[154][152] = +3.4055590439018E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][153] = -4.2793168213004E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][154] = -2.1581139574004E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[155] =
-      JEOD_ALLOC_PRIM_ARRAY (156, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[155][  0] = -1.4990692940429E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][  1] = -9.8342736494491E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][  2] = +4.3859995417298E-10;
@@ -12623,8 +12315,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[155][153] = -1.5606263016735E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][154] = +4.8050664781844E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][155] = -1.8904986489277E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[156] =
-      JEOD_ALLOC_PRIM_ARRAY (157, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[156][  0] = -3.2423356865655E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][  1] = -1.5297540110278E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][  2] = +4.4621327071062E-10;
@@ -12782,8 +12472,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[156][154] = +2.3978733722272E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][155] = -6.8210155786581E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][156] = +6.7867823692744E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[157] =
-      JEOD_ALLOC_PRIM_ARRAY (158, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[157][  0] = +1.8018358232856E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][  1] = +2.0567513582368E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][  2] = +7.4849927207290E-12;
@@ -12942,8 +12630,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[157][155] = -4.5379221900297E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][156] = -7.8972528956313E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][157] = +7.9443422016334E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[158] =
-      JEOD_ALLOC_PRIM_ARRAY (159, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[158][  0] = +3.4821467161512E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][  1] = +3.3740802591715E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][  2] = -1.3502873210354E-10;
@@ -13103,8 +12789,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[158][156] = -9.6856803376721E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][157] = +4.5647699679807E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][158] = -1.0623404357336E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[159] =
-      JEOD_ALLOC_PRIM_ARRAY (160, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[159][  0] = -8.5189894152578E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][  1] = -6.0391331759760E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][  2] = -3.4888280888317E-10;
@@ -13265,8 +12949,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[159][157] = +6.7264038724088E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][158] = +5.8111351416900E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][159] = -1.1217385611113E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[160] =
-      JEOD_ALLOC_PRIM_ARRAY (161, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[160][  0] = +1.2666265906123E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][  1] = +4.8869490907315E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][  2] = +7.1902003211343E-10;
@@ -13428,8 +13110,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[160][158] = +4.7208153468938E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][159] = -1.6557363490776E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][160] = +1.9220253869410E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[161] =
-      JEOD_ALLOC_PRIM_ARRAY (162, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[161][  0] = +2.4741007413470E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][  1] = +6.3451913009307E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][  2] = +2.6748691438419E-10;
@@ -13592,8 +13272,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[161][159] = +4.0304123158634E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][160] = -2.1263245529143E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][161] = +6.1754744590501E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[162] =
-      JEOD_ALLOC_PRIM_ARRAY (163, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[162][  0] = +1.0033251003687E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][  1] = -3.5760804997518E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][  2] = -1.1786940118286E-09;
@@ -13757,8 +13435,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[162][160] = -2.1052994865092E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][161] = -4.0198010410083E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][162] = -6.1707300030138E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[163] =
-      JEOD_ALLOC_PRIM_ARRAY (164, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[163][  0] = -7.2681123102545E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][  1] = -4.7686681073820E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][  2] = -3.8412555388607E-10;
@@ -13923,8 +13599,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[163][161] = -4.1644691365323E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][162] = -7.4611526900553E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][163] = +2.1174991690917E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[164] =
-      JEOD_ALLOC_PRIM_ARRAY (165, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[164][  0] = -2.0737529578549E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][  1] = -1.3054320493624E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][  2] = -1.6902275761752E-10;
@@ -14090,8 +13764,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[164][162] = +1.7547902949267E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][163] = +4.8188356888087E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][164] = -2.5647243816665E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[165] =
-      JEOD_ALLOC_PRIM_ARRAY (166, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[165][  0] = -1.9960434133060E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][  1] = -1.4181501244646E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][  2] = +5.8798174088785E-10;
@@ -14258,8 +13930,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[165][163] = +1.2194829092796E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][164] = +6.5608342321616E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][165] = +7.1544188420908E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[166] =
-      JEOD_ALLOC_PRIM_ARRAY (167, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[166][  0] = -1.5451474635329E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][  1] = -6.3953454149307E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][  2] = +5.0600550339863E-10;
@@ -14427,8 +14097,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[166][164] = -6.8264816478810E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][165] = -6.1841442368378E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][166] = +1.1599218188618E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[167] =
-      JEOD_ALLOC_PRIM_ARRAY (168, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[167][  0] = -3.8776559233790E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][  1] = +6.1361990497717E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][  2] = +9.3003570569725E-10;
@@ -14597,8 +14265,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[167][165] = -4.9576709978515E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][166] = +1.8005666034854E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][167] = -1.0365681902031E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[168] =
-      JEOD_ALLOC_PRIM_ARRAY (169, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[168][  0] = +2.0828897442906E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][  1] = +1.3365181429512E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][  2] = -2.1834272680218E-10;
@@ -14768,8 +14434,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[168][166] = +4.8887342521358E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][167] = +4.4446305583412E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][168] = -5.9261638461696E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[169] =
-      JEOD_ALLOC_PRIM_ARRAY (170, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[169][  0] = +6.0225476748938E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][  1] = +1.8807669184612E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][  2] = -5.9415294021105E-10;
@@ -14940,8 +14604,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[169][167] = -4.1141177135461E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][168] = +1.1000364878435E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][169] = -3.1471003739685E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[170] =
-      JEOD_ALLOC_PRIM_ARRAY (171, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[170][  0] = +4.9172611256758E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][  1] = -1.4961053271067E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][  2] = -2.9696837280165E-10;
@@ -15113,8 +14775,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[170][168] = +8.2087570231894E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][169] = +2.5766012860741E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][170] = -3.1605096991253E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[171] =
-      JEOD_ALLOC_PRIM_ARRAY (172, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[171][  0] = -2.4755324582612E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][  1] = +4.3452368195402E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][  2] = +5.1228272729708E-10;
@@ -15287,8 +14947,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[171][169] = +5.9900878160778E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][170] = -3.2989944065279E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][171] = -2.8495673690695E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[172] =
-      JEOD_ALLOC_PRIM_ARRAY (173, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[172][  0] = +1.6750968739442E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][  1] = +3.5695103446234E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][  2] = +6.6423934793627E-10;
@@ -15462,8 +15120,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[172][170] = -7.8694577013654E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][171] = -2.9009836756132E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][172] = -3.8429826132266E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[173] =
-      JEOD_ALLOC_PRIM_ARRAY (174, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[173][  0] = -4.0979223177185E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][  1] = -2.6287379050500E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][  2] = -5.3988507168257E-10;
@@ -15638,8 +15294,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[173][171] = -2.4296284030690E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][172] = +4.8775979800100E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][173] = -2.4614354380311E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[174] =
-      JEOD_ALLOC_PRIM_ARRAY (175, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[174][  0] = -8.8024962017630E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][  1] = -8.4736400159304E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][  2] = +8.3748532297444E-11;
@@ -15815,8 +15469,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[174][172] = +4.7048952540062E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][173] = +1.9781311747406E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][174] = +7.0427267142526E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[175] =
-      JEOD_ALLOC_PRIM_ARRAY (176, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[175][  0] = -7.6281381964986E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][  1] = -3.8614276860427E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][  2] = -5.9035833720723E-11;
@@ -15993,8 +15645,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[175][173] = +7.0959574569366E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][174] = -4.9843652979214E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][175] = +7.2901001052865E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[176] =
-      JEOD_ALLOC_PRIM_ARRAY (177, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[176][  0] = +4.5660869245129E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][  1] = -2.5289714893217E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][  2] = +4.3661634284674E-10;
@@ -16172,8 +15822,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[176][174] = +3.8164903307458E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][175] = -1.0039764013316E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][176] = -1.2390792273641E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[177] =
-      JEOD_ALLOC_PRIM_ARRAY (178, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[177][  0] = +2.4951151213971E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][  1] = +4.7379573607986E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][  2] = +4.1661877687805E-12;
@@ -16352,8 +16000,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[177][175] = -1.3928047629629E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][176] = -5.1115495642421E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][177] = -2.6022958833718E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[178] =
-      JEOD_ALLOC_PRIM_ARRAY (179, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[178][  0] = -1.3807584655394E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][  1] = +6.5992196975984E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][  2] = -2.0755967693286E-10;
@@ -16533,8 +16179,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[178][176] = -3.5828012735830E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][177] = +4.1943050270331E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][178] = -4.1664132347517E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[179] =
-      JEOD_ALLOC_PRIM_ARRAY (180, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[179][  0] = -6.0914558160102E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][  1] = +2.5328392849092E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][  2] = +7.2709977304178E-11;
@@ -16715,8 +16359,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[179][177] = +3.8342201775646E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][178] = -1.5087112589919E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][179] = -3.3345500580560E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[180] =
-      JEOD_ALLOC_PRIM_ARRAY (181, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[180][  0] = +2.9849559253781E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][  1] = +2.0117087799586E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][  2] = -2.0684425471331E-10;
@@ -16898,8 +16540,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[180][178] = -3.1449323153306E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][179] = -2.3241481144272E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][180] = -4.2313629534564E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[181] =
-      JEOD_ALLOC_PRIM_ARRAY (182, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[181][  0] = +1.1334918522085E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][  1] = -7.5230289862610E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][  2] = +2.0445033339473E-10;
@@ -17082,8 +16722,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[181][179] = -4.8698039941312E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][180] = +7.4912282795597E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][181] = -4.5082253746725E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[182] =
-      JEOD_ALLOC_PRIM_ARRAY (183, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[182][  0] = -3.4374455796772E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][  1] = -2.9743835102932E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][  2] = -9.0874082817462E-11;
@@ -17267,8 +16905,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[182][180] = +3.9926410178970E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][181] = -1.2844722028479E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][182] = -5.5755596152381E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[183] =
-      JEOD_ALLOC_PRIM_ARRAY (184, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[183][  0] = -3.4106350212911E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][  1] = +4.3693416285768E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][  2] = -4.4537478441887E-10;
@@ -17453,8 +17089,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[183][181] = -3.7226980359867E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][182] = -4.9856122905879E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][183] = +3.5137366770981E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[184] =
-      JEOD_ALLOC_PRIM_ARRAY (185, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[184][  0] = +3.1374760297946E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][  1] = +4.2924118866980E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][  2] = -4.7111251992002E-10;
@@ -17640,8 +17274,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[184][182] = +5.4983224654821E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][183] = -2.8018309500531E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][184] = +4.4970550492670E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[185] =
-      JEOD_ALLOC_PRIM_ARRAY (186, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[185][  0] = +5.1487157698441E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][  1] = -4.3949478212243E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][  2] = +6.5863911631541E-10;
@@ -17828,8 +17460,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[185][183] = +5.5097095512537E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][184] = -4.7329803790926E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][185] = -7.7160377962183E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[186] =
-      JEOD_ALLOC_PRIM_ARRAY (187, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[186][  0] = +1.2046999418271E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][  1] = +9.9835218668782E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][  2] = +9.0299211586524E-10;
@@ -18017,8 +17647,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[186][184] = -3.2817099465669E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][185] = +4.6942923763140E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][186] = +1.1415080262587E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[187] =
-      JEOD_ALLOC_PRIM_ARRAY (188, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[187][  0] = -6.1359322545656E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][  1] = +2.7760246380474E-13;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][  2] = +1.6320294786266E-10;
@@ -18207,8 +17835,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[187][185] = +3.7793322293415E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][186] = -4.0111865509649E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][187] = +1.3286710147614E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[188] =
-      JEOD_ALLOC_PRIM_ARRAY (189, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[188][  0] = -3.8036128225917E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][  1] = -1.4751707124342E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][  2] = -8.1932199705116E-10;
@@ -18398,8 +18024,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[188][186] = +2.8240373751745E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][187] = -5.5732366434555E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][188] = +1.2075873221701E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[189] =
-      JEOD_ALLOC_PRIM_ARRAY (190, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[189][  0] = -4.2725891179009E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][  1] = -2.3014918435759E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][  2] = -7.7131055607578E-10;
@@ -18590,8 +18214,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[189][187] = -5.2594466018872E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][188] = +6.8298358937933E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][189] = +4.2110728684330E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[190] =
-      JEOD_ALLOC_PRIM_ARRAY (191, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[190][  0] = +3.8841703969776E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][  1] = -5.4597249443397E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][  2] = -3.2512185587279E-11;
@@ -18783,8 +18405,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[190][188] = -8.7969314331075E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][189] = +4.0624399537235E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][190] = -1.2619268973801E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[191] =
-      JEOD_ALLOC_PRIM_ARRAY (192, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[191][  0] = +4.7040957994124E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][  1] = -2.4252120417250E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][  2] = +6.3080373652935E-10;
@@ -18977,8 +18597,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[191][189] = -1.7231928001222E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][190] = -4.7955804090459E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][191] = -5.6912086757627E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[192] =
-      JEOD_ALLOC_PRIM_ARRAY (193, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[192][  0] = +1.7247093117418E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][  1] = +1.1341563550857E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][  2] = +5.4467984423154E-10;
@@ -19172,8 +18790,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[192][190] = -7.5537269208291E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][191] = +3.5465970782592E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][192] = +6.0849755207121E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[193] =
-      JEOD_ALLOC_PRIM_ARRAY (194, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[193][  0] = -1.1147962651472E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][  1] = +1.7326037879695E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][  2] = +2.3855615931067E-10;
@@ -19368,8 +18984,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[193][191] = +1.1457351708948E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][192] = -1.2119521323931E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][193] = +1.8753309669133E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[194] =
-      JEOD_ALLOC_PRIM_ARRAY (195, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[194][  0] = -1.9980527755896E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][  1] = -2.4986903119076E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][  2] = +3.4871634516101E-10;
@@ -19565,8 +19179,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[194][192] = -1.4600939473795E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][193] = -5.2872406206421E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][194] = -1.2148907139454E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[195] =
-      JEOD_ALLOC_PRIM_ARRAY (196, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[195][  0] = +7.5208528166485E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][  1] = -1.1809294277619E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][  2] = -1.8272748975111E-10;
@@ -19763,8 +19375,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[195][193] = -2.3335754276843E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][194] = +4.4636416174354E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][195] = +7.5793531391774E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[196] =
-      JEOD_ALLOC_PRIM_ARRAY (197, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[196][  0] = -1.3443136438232E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][  1] = +1.1178696428661E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][  2] = -3.5698903629112E-10;
@@ -19962,8 +19572,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[196][194] = +1.1387637992089E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][195] = -1.7460182453323E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][196] = +2.5303249393357E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[197] =
-      JEOD_ALLOC_PRIM_ARRAY (198, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[197][  0] = +3.9582608170142E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][  1] = +2.9929417033562E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][  2] = -1.8444424196809E-10;
@@ -20162,8 +19770,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[197][195] = -3.1497185605568E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][196] = -6.5671710823963E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][197] = +1.9024594440073E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[198] =
-      JEOD_ALLOC_PRIM_ARRAY (199, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[198][  0] = +2.5658439520624E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][  1] = +2.5415706793244E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][  2] = +8.8895217012336E-11;
@@ -20363,8 +19969,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[198][196] = -6.3199638888955E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][197] = +3.2830093326530E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][198] = +1.2046627659532E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[199] =
-      JEOD_ALLOC_PRIM_ARRAY (200, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[199][  0] = -5.0971131096395E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][  1] = +4.0753970740461E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][  2] = +1.2898735972853E-10;
@@ -20565,8 +20169,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[199][197] = +2.0372645041716E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][198] = +2.6896341106034E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][199] = -4.0117250917663E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[200] =
-      JEOD_ALLOC_PRIM_ARRAY (201, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[200][  0] = -2.2715194729494E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][  1] = -3.4089102385824E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][  2] = +4.5229005791485E-11;
@@ -20769,34 +20371,24 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[200][199] = +5.8031662800312E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][200] = -6.5530268646599E-11;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  1] = +1.3968195379551E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  2] = -1.4002662003867E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  1] = +2.4817416903031E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  2] = -6.1900441427103E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  3] = +1.4143556434052E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  1] = -4.7356802287476E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  2] = +6.6243944849186E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  3] = -2.0097529442342E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  4] = +3.0882228278756E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  1] = -9.4373263356928E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  2] = -3.2334838450788E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  3] = -2.1500140801223E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  4] = +4.9817834613976E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  5] = -6.6937444851133E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  1] = +2.6516969820404E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  2] = -3.7379063632786E-07;
@@ -20804,8 +20396,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  4] = -4.7142492778928E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  5] = -5.3648870593762E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  6] = -2.3740563878695E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  1] = +9.5119644062781E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  2] = +9.2985239787248E-08;
@@ -20814,8 +20404,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  5] = +1.7933888039325E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  6] = +1.5179454735699E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  7] = +2.4116259277940E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  1] = +5.8896665124862E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  2] = +6.5278835020898E-08;
@@ -20825,8 +20413,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  6] = +3.0894479673499E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  7] = +7.4875670873080E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  8] = +1.2055330686769E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  1] = +2.1399410624745E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  2] = -3.1693757099588E-08;
@@ -20837,8 +20423,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  7] = -9.6928434857123E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  8] = -3.0006845470535E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  9] = +9.6880058387687E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  1] = -1.3109151284691E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  2] = -5.1279822748794E-08;
@@ -20850,8 +20434,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  8] = -9.1718696376024E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  9] = -3.7954367789185E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][ 10] = -2.3859595666514E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  1] = -2.7119062596280E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  2] = -9.9008467215296E-08;
@@ -20864,8 +20446,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  9] = +4.2065869634528E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 10] = -1.8423731781649E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 11] = -6.9668542043034E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  1] = -4.3163587100214E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  2] = +3.1093083556009E-08;
@@ -20879,8 +20459,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 10] = +3.0946924871442E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 11] = -6.3910578294950E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 12] = -1.1104248894541E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  1] = +3.8698568775853E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  2] = -6.2696267938467E-08;
@@ -20895,8 +20473,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 11] = -4.8336293683067E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 12] = +8.7939375722094E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 13] = +6.8148167810743E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  1] = +2.8860837145152E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  2] = -4.0536295440481E-09;
@@ -20912,8 +20488,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 12] = -3.1123757460387E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 13] = +4.5153039813900E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 14] = -4.8134421832886E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  1] = +1.0483210092551E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  2] = -3.0300593022327E-08;
@@ -20930,8 +20504,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 13] = -4.5801398908502E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 14] = -2.4421066493216E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 15] = -4.6915224964251E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  1] = +3.3337721587560E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  2] = +2.8035811194914E-08;
@@ -20949,8 +20521,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 14] = -3.8651351413281E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 15] = -3.2743335622719E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 16] = +2.9594978134257E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  1] = -3.1704849173524E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  2] = +6.8116873808976E-09;
@@ -20969,8 +20539,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 15] = +5.2412873983925E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 16] = +3.6871836352069E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 17] = -1.9872619006802E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  1] = -3.9299441080276E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  2] = +1.0836274475162E-08;
@@ -20990,8 +20558,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 16] = +6.5055473895937E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 17] = +4.3797453570415E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 18] = -1.0838554501860E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  1] = +1.1937706789497E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  2] = -2.3713962332814E-09;
@@ -21012,8 +20578,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 17] = -1.5343197460342E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 18] = -9.7094556993792E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 19] = +5.1992859608341E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  1] = +7.0286777083882E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  2] = +1.7185367697023E-08;
@@ -21035,8 +20599,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 18] = -8.8807682098034E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 19] = +1.0925740300754E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 20] = -1.2702269668759E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  1] = +2.8692279562835E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  2] = +4.1777851142307E-09;
@@ -21059,8 +20621,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 19] = +1.6552018630680E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 20] = +1.5903091520324E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 21] = -3.6538244738170E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  1] = -3.8401066588812E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  2] = -1.1662966101574E-09;
@@ -21084,8 +20644,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 20] = +1.9585060678295E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 21] = +2.3967903327442E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 22] = +2.3343531542195E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  1] = +1.6197097178613E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  2] = -4.5870169852886E-09;
@@ -21110,8 +20668,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 21] = +1.1743108289545E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 22] = +4.7239771255244E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 23] = -1.2045385690884E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  1] = -1.5332995591782E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  2] = +1.5152652480911E-08;
@@ -21137,8 +20693,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 22] = -3.9376271616977E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 23] = -8.8303544337632E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 24] = -3.6842626036624E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  1] = -9.1561367281291E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  2] = +9.3474071994883E-09;
@@ -21165,8 +20719,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 23] = -1.2638342021227E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 24] = -8.3910512608079E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 25] = +4.9424492087677E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  1] = -6.6491269777981E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  2] = +1.1502846267867E-08;
@@ -21194,8 +20746,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 24] = +1.4780433817203E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 25] = -5.7920402621042E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 26] = +2.0724508022972E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  1] = +1.5861845986091E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  2] = -6.1599924664103E-10;
@@ -21224,8 +20774,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 25] = +6.0077982343106E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 26] = -2.3858117549180E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 27] = +1.0627808251633E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  1] = +8.7174149139090E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  2] = -8.2559443278997E-09;
@@ -21255,8 +20803,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 26] = +3.8311669940753E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 27] = +1.1667818272635E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 28] = +6.6839105448691E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  1] = -1.3530852776564E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  2] = -2.4404984391404E-09;
@@ -21287,8 +20833,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 27] = -7.0538794698516E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 28] = -5.7440948394514E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 29] = -5.2096957092407E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  1] = +1.0882410419766E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  2] = -1.1731233776056E-09;
@@ -21320,8 +20864,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 28] = -8.0921278975507E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 29] = +1.9501145188463E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 30] = +8.4704104476222E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  1] = -1.8477525238299E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  2] = +5.1172013618646E-09;
@@ -21354,8 +20896,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 29] = -2.3159690271715E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 30] = -8.1220136736946E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 31] = -1.6254667955291E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  1] = +3.5808375696792E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  2] = -2.8727369195567E-09;
@@ -21389,8 +20929,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 30] = +1.3433822018006E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 31] = -2.9579980375000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 32] = +1.2486780458468E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  1] = -3.8909439833294E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  2] = +2.3231058272358E-09;
@@ -21425,8 +20963,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 31] = +8.8217525396426E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 32] = -4.6943646742960E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 33] = +8.3884779202563E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  1] = +6.5325922331824E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  2] = +7.5423546141702E-09;
@@ -21462,8 +20998,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 32] = +1.8363377966252E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 33] = +4.2891442382189E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 34] = +1.6138068603354E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  1] = -1.0082697909180E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  2] = +7.1155395258125E-09;
@@ -21500,8 +21034,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 33] = -3.2292204160569E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 34] = +2.7533692432102E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 35] = -5.0325522865226E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  1] = +6.4134288916750E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  2] = -2.8751929684905E-09;
@@ -21539,8 +21071,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 34] = +4.1565746963319E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 35] = -1.2629631140754E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 36] = -5.8215884282290E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  1] = -1.2913251567314E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  2] = -1.1629908374309E-08;
@@ -21579,8 +21109,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 35] = -8.8211889226864E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 36] = -4.4186215761782E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 37] = -4.0935919537385E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  1] = +3.1434604074782E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  2] = -1.1887302442477E-09;
@@ -21620,8 +21148,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 36] = -1.1825973214935E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 37] = +2.3106343026237E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 38] = -2.8305484073875E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  1] = +8.3092845146517E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  2] = +7.0728390905952E-09;
@@ -21662,8 +21188,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 37] = -5.0625519695511E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 38] = +7.5704843257603E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 39] = +1.9643283396913E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  1] = -1.1500939571331E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  2] = +4.4743187708946E-10;
@@ -21705,8 +21229,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 38] = +4.0995816323485E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 39] = +3.9424628559110E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 40] = +6.0097355791753E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  1] = -3.2922371949901E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  2] = +3.3495652056599E-09;
@@ -21749,8 +21271,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 39] = -2.5989563220208E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 40] = -4.7825618255889E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 41] = +5.7940577833145E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  1] = -3.8004492434453E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  2] = -2.8835990489186E-09;
@@ -21794,8 +21314,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 40] = -2.8272941521682E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 41] = -4.5228348840485E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 42] = +2.8288674442046E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  1] = +4.1938878408550E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  2] = -1.3484431302076E-09;
@@ -21840,8 +21358,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 41] = +3.1172825781930E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 42] = +3.9741680475827E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 43] = -8.1610978068320E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  1] = -2.1664810984396E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  2] = +3.4396100184805E-09;
@@ -21887,8 +21403,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 42] = -8.7603877339772E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 43] = -3.0291679935077E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 44] = -1.7122168139399E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  1] = -4.6004946368467E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  2] = -3.3054923915513E-09;
@@ -21935,8 +21449,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 43] = +1.0541914128886E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 44] = +3.1116101675530E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 45] = +5.1639186754832E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  1] = -2.2971878887428E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  2] = +3.1491585036384E-09;
@@ -21984,8 +21496,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 44] = -3.0414903260592E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 45] = +4.9457243764365E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 46] = -2.6176783821053E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  1] = -1.2898401655805E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  2] = -2.7324590764686E-09;
@@ -22034,8 +21544,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 45] = +3.4106115367957E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 46] = -4.1922507137857E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 47] = -6.1686448652700E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  1] = +3.4579831098046E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  2] = +2.8943567577063E-09;
@@ -22085,8 +21593,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 46] = +8.8213812951579E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 47] = +3.9051389546008E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 48] = -2.0930790722641E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  1] = -1.9001456928967E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  2] = +9.9013474086437E-10;
@@ -22137,8 +21643,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 47] = +1.3189684873407E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 48] = +8.8597964427555E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 49] = +2.8696104399151E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  1] = +3.0634380788527E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  2] = -1.6329440437991E-09;
@@ -22190,8 +21694,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 48] = +7.0435315848503E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 49] = -4.8059506009261E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 50] = +2.5595888025637E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  1] = +1.1607550847030E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  2] = -2.4724037663656E-09;
@@ -22244,8 +21746,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 49] = -1.9331089155588E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 50] = +5.5026234458634E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 51] = +3.0079388995787E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  1] = -4.6250714851517E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  2] = +1.0364635381749E-09;
@@ -22299,8 +21799,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 50] = -9.1277488963359E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 51] = -1.7272445554831E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 52] = -4.4436116885717E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  1] = -4.6424313733127E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  2] = -2.4317038944341E-09;
@@ -22355,8 +21853,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 51] = +2.9893346732737E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 52] = +5.6326172443236E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 53] = +3.9884736526378E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  1] = +4.1575630414780E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  2] = -3.0549248720497E-10;
@@ -22412,8 +21908,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 52] = -2.6298117907543E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 53] = +3.3643343581853E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 54] = +5.0994202377551E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  1] = +4.6384079412596E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  2] = -2.2422469785377E-09;
@@ -22470,8 +21964,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 53] = +1.4214630015456E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 54] = -6.1752465386365E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 55] = -5.6525186932833E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  1] = +3.6083571971810E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  2] = +5.3806582266011E-09;
@@ -22529,8 +22021,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 54] = -1.9553361126192E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 55] = -3.9169124463643E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 56] = -9.4172259143370E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  1] = -2.6317518778821E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  2] = +1.5408459599672E-09;
@@ -22589,8 +22079,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 55] = +8.7907170056386E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 56] = +3.3315883125113E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 57] = -3.0576406348054E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  1] = -1.2052503738588E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  2] = +5.0346238126619E-09;
@@ -22650,8 +22138,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 56] = -5.6414341392030E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 57] = +8.4830222584862E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 58] = +2.6272517499639E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  1] = -8.0697618646266E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  2] = +8.1702968726519E-10;
@@ -22712,8 +22198,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 57] = -1.9199017851153E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 58] = -2.2010166802897E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 59] = +1.5757273417993E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  1] = -1.3288440142466E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  2] = -1.9020010035225E-09;
@@ -22775,8 +22259,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 58] = +2.6018185217819E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 59] = +8.6123319290141E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 60] = +1.2131122634380E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  1] = +2.7234203850536E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  2] = -1.4370372910745E-09;
@@ -22839,8 +22321,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 59] = -2.1359027608782E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 60] = -3.6042899115535E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 61] = +4.7476063720074E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  1] = +2.8349381648814E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  2] = +6.4614787378304E-09;
@@ -22904,8 +22384,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 60] = +1.8925713423140E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 61] = +3.4096944336645E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 62] = +1.2800834770667E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  1] = +2.5845885589251E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  2] = +5.2720341680318E-10;
@@ -22970,8 +22448,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 61] = +4.1632047001462E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 62] = +1.0006076239917E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 63] = -1.6108244338203E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  1] = -2.1313478003250E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  2] = +4.1517328317239E-09;
@@ -23037,8 +22513,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 62] = -1.1190399962161E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 63] = -5.0642259231726E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 64] = -1.5113786790564E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  1] = -3.7129482938331E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  2] = -6.4564469686596E-10;
@@ -23105,8 +22579,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 63] = -2.9584695255637E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 64] = +3.5776990527260E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 65] = +1.6079122864772E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  1] = -4.8878075948259E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  2] = +8.5504155682673E-10;
@@ -23174,8 +22646,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 64] = -1.7675684937284E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 65] = +3.5879217789075E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 66] = -1.2764943612474E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  1] = +2.0454157497063E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  2] = -4.4148315664798E-09;
@@ -23244,8 +22714,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 65] = -6.1067828805416E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 66] = -5.2033754443787E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 67] = +3.0642123515384E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  1] = +1.9144065644884E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  2] = -6.6539687328164E-10;
@@ -23315,8 +22783,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 66] = -1.1923164323194E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 67] = -6.3224527874193E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 68] = +2.3498623311902E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  1] = -3.4902848288331E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  2] = +9.5534185665465E-10;
@@ -23387,8 +22853,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 67] = +3.2785967783656E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 68] = +9.5494889216092E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 69] = -1.8343081424297E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  1] = -1.9388623488093E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  2] = +2.4088430556207E-09;
@@ -23460,8 +22924,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 68] = +2.0873209267551E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 69] = -5.6965951784386E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 70] = -1.6312082147679E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  1] = +1.3833057873833E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  2] = -2.8098353438272E-09;
@@ -23534,8 +22996,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 69] = -4.3061811147555E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 70] = +9.8982078003985E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 71] = -8.4053292568993E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  1] = -1.3069777691661E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  2] = -4.3843889358949E-10;
@@ -23609,8 +23069,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 70] = -1.0339921579645E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 71] = -1.9180376915814E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 72] = +4.1724263703767E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  1] = -7.2618021384733E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  2] = +1.3477535876278E-11;
@@ -23685,8 +23143,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 71] = -2.5135860209615E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 72] = -1.3658262794587E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 73] = +1.3287560208060E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  1] = +1.3996246870215E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  2] = +1.8684061751702E-09;
@@ -23762,8 +23218,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 72] = -1.2135513702135E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 73] = +3.3359069283347E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 74] = -2.3488901731559E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  1] = -1.6856325245863E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  2] = -2.7599384391082E-09;
@@ -23840,8 +23294,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 73] = +3.2151296211651E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 74] = -2.6470706939497E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 75] = +3.4962502128165E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  1] = -7.6424581958879E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  2] = +1.9416582644571E-09;
@@ -23919,8 +23371,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 74] = -1.9281923840551E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 75] = -8.3149852552242E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 76] = +3.4904519700090E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  1] = +3.7032976719527E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  2] = +2.3019042668721E-09;
@@ -23999,8 +23449,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 75] = +1.7382816851548E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 76] = +5.9468007176931E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 77] = -4.2045858707455E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  1] = +2.0756739871352E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  2] = +7.0050449273757E-10;
@@ -24080,8 +23528,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 76] = +2.3504820370527E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 77] = -2.0231799499642E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 78] = -1.2579880071986E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  1] = +1.2329038993208E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  2] = -5.5329794872106E-10;
@@ -24162,8 +23608,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 77] = +2.6330696238802E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 78] = +5.5976166880914E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 79] = +1.3419524377493E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  1] = -9.6326851325178E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  2] = -1.0999435091873E-09;
@@ -24245,8 +23689,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 78] = +2.5335992071739E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 79] = -7.4506893931554E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 80] = -2.7749777680662E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  1] = -3.6754756993242E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  2] = +3.2145052943244E-10;
@@ -24329,8 +23771,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 79] = -1.1947208575448E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 80] = +3.5961525741921E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 81] = +3.7024992744715E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  1] = +2.9786410288432E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  2] = -2.5822501286532E-09;
@@ -24414,8 +23854,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 80] = -2.1909638842272E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 81] = +4.3595278898119E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 82] = +1.1787839138383E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  1] = -2.3346250020475E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  2] = -1.7916159484665E-09;
@@ -24500,8 +23938,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 81] = +7.7700949087422E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 82] = -1.5990872005828E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 83] = -5.1468939131513E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  1] = -2.9548444524172E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  2] = +7.8437066381038E-10;
@@ -24587,8 +24023,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 82] = -7.0127833650608E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 83] = +2.0773297745779E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 84] = +1.2662836548497E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  1] = +1.8105411668193E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  2] = +1.3941319921704E-09;
@@ -24675,8 +24109,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 83] = -1.0907744464388E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 84] = +1.6977015628392E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 85] = +1.4962531953725E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  1] = -6.4184222167282E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  2] = -2.5995837813636E-09;
@@ -24764,8 +24196,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 84] = +2.0815254367200E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 85] = +1.9251649159644E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 86] = -1.5260472835932E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  1] = -2.5353225751952E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  2] = +1.0006949035924E-09;
@@ -24854,8 +24284,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 85] = -1.5484463908802E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 86] = -3.3808274570953E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 87] = +1.8956200025976E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  1] = -1.5761047897844E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  2] = -5.8150482825318E-10;
@@ -24945,8 +24373,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 86] = +4.7891154624831E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 87] = +2.6447959363106E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 88] = -3.6408881716156E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  1] = +1.7745733219719E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  2] = -1.0308354070964E-12;
@@ -25037,8 +24463,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 87] = +8.5610752445033E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 88] = +1.2491997867936E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 89] = -6.2346209555442E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  1] = -9.8852917192594E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  2] = -2.7479022018276E-10;
@@ -25130,8 +24554,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 88] = -2.6923006218617E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 89] = -1.1918212852019E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 90] = +2.2460182122372E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  1] = -9.7280152169222E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  2] = +7.4024294198561E-10;
@@ -25224,8 +24646,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 89] = -3.5513349632198E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 90] = +6.2504108239714E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 91] = -8.3727402226708E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  1] = -2.5503553807216E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  2] = +4.5155400535331E-10;
@@ -25319,8 +24739,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 90] = -1.0917286258341E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 91] = -2.6465686330925E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 92] = -1.8920426294539E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  1] = +1.4918348001897E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  2] = -3.7722988488346E-10;
@@ -25415,8 +24833,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 91] = -7.4457029276451E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 92] = +1.4791013750001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 93] = +2.5688796980289E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  1] = +2.2948920919907E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  2] = +1.3784302467076E-10;
@@ -25512,8 +24928,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 92] = +4.4321470726275E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 93] = +1.5295928582692E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 94] = -1.8463468531675E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  1] = +6.2161794952540E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  2] = -2.4340516236073E-10;
@@ -25610,8 +25024,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 93] = +2.1045104739911E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 94] = -1.2163550688153E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 95] = -2.4523291590088E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  1] = +1.6218194262588E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  2] = -6.8801526459762E-11;
@@ -25709,8 +25121,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 94] = -2.2976828985381E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 95] = +2.6245862131109E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 96] = +1.5163042993253E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  1] = -1.1731971257116E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  2] = -1.0291574304391E-09;
@@ -25809,8 +25219,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 95] = +5.6596979477737E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 96] = -4.7101606665974E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 97] = -2.0359359226844E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  1] = -2.5236535051016E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  2] = -5.7908036412706E-10;
@@ -25910,8 +25318,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 96] = +1.7733081847934E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 97] = -2.4052352042559E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 98] = +1.1675112493268E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  1] = -6.9494549181673E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  2] = +2.6302170715769E-10;
@@ -26012,8 +25418,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 97] = +7.4380150564042E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 98] = +3.5712856921923E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 99] = +1.8889922362843E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Snm[100][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  1] = +6.9073984716007E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  2] = -4.7395546114959E-10;
@@ -26115,8 +25519,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 98] = +8.7663617030892E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 99] = +1.2701458898680E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][100] = -9.5803223493351E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Snm[101][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  1] = +1.2864386144069E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  2] = -1.1792972590345E-09;
@@ -26219,8 +25621,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[101][ 99] = -3.3319672572705E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[101][100] = -6.9882953120207E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[101][101] = -2.7053975374523E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Snm[102][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  1] = +1.0192622137699E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  2] = +1.1702346026704E-09;
@@ -26324,8 +25724,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[102][100] = -1.9724034027055E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][101] = -9.9106777046000E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[102][102] = -9.3829192637867E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Snm[103][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  1] = -6.8835313071352E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  2] = -1.2722776200682E-09;
@@ -26430,8 +25828,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[103][101] = +6.9276279789605E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][102] = +4.6366657631955E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][103] = +1.0383308480110E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Snm[104][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  1] = -1.0337602424016E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  2] = -1.2994955906235E-09;
@@ -26537,8 +25933,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[104][102] = +8.2824525606036E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[104][103] = -1.0476902448988E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][104] = +1.4613105893397E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Snm[105][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  1] = -1.5055853062925E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  2] = +1.7760484290118E-09;
@@ -26645,8 +26039,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[105][103] = +1.2825189532479E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][104] = +2.8062238816299E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][105] = -5.1017460055781E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Snm[106][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  1] = +1.9255239955797E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  2] = -4.8996840912081E-10;
@@ -26754,8 +26146,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[106][104] = +1.3124331719682E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[106][105] = +3.4872113778674E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[106][106] = -7.4818473453769E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Snm[107][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  1] = +1.1398558276252E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  2] = -7.8551505255556E-11;
@@ -26864,8 +26254,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[107][105] = -1.6884190114597E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][106] = -2.6617002021485E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][107] = -3.6100805137647E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Snm[108][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  1] = +1.0478263038458E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  2] = -1.1636455806728E-09;
@@ -26975,8 +26363,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[108][106] = +2.0770489250766E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[108][107] = +2.3485577870691E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[108][108] = -7.8719524529801E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Snm[109][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  1] = +1.5245840189139E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  2] = +2.0557109826974E-09;
@@ -27087,8 +26473,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[109][107] = +9.1931884813287E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[109][108] = +3.9686085727653E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[109][109] = -4.8161699280101E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Snm[110][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  1] = -8.3788644908095E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  2] = +1.7655668932491E-09;
@@ -27200,8 +26584,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[110][108] = -5.6823516842826E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[110][109] = -5.0737898598210E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[110][110] = +7.0605570683912E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[111] =
-      JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Snm[111][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[111][  1] = -3.4232096319275E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[111][  2] = -2.0334775275862E-10;
@@ -27314,8 +26696,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[111][109] = -1.0763804211277E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[111][110] = +8.7904390479614E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[111][111] = +5.3127402438808E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[112] =
-      JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Snm[112][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[112][  1] = -1.5011449319205E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[112][  2] = -9.3404526584585E-10;
@@ -27429,8 +26809,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[112][110] = -5.5538021289213E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[112][111] = -3.3809783955808E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[112][112] = -2.1284954175186E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[113] =
-      JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Snm[113][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[113][  1] = -5.7457765657488E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[113][  2] = -7.7600019517024E-10;
@@ -27545,8 +26923,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[113][111] = -5.1408093852663E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[113][112] = +1.1254165054398E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[113][113] = -6.8484805178158E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[114] =
-      JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Snm[114][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[114][  1] = +2.0481426534994E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][  2] = +4.8856790308766E-10;
@@ -27662,8 +27038,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[114][112] = +1.6753346118505E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][113] = +1.0198127234484E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][114] = -3.9623021618233E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[115] =
-      JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Snm[115][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[115][  1] = +7.3678087038373E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[115][  2] = +6.8579354581872E-10;
@@ -27780,8 +27154,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[115][113] = -4.4903825098832E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[115][114] = -1.5231085644313E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[115][115] = -3.4213864074747E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[116] =
-      JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Snm[116][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[116][  1] = -7.3741191141202E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[116][  2] = +2.2700938970988E-10;
@@ -27899,8 +27271,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[116][114] = -2.4142474583834E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][115] = -1.3379096798627E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][116] = -3.9383108268041E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[117] =
-      JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Snm[117][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[117][  1] = +1.7949898383970E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[117][  2] = -4.5581407587073E-11;
@@ -28019,8 +27389,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[117][115] = -1.4874891882178E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[117][116] = +1.2477662035761E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[117][117] = +1.0099980585627E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[118] =
-      JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Snm[118][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[118][  1] = +1.2001137126557E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[118][  2] = +1.4215736161023E-10;
@@ -28140,8 +27508,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[118][116] = +1.3715347624373E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[118][117] = +4.4032951668595E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[118][118] = +1.6432398260540E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[119] =
-      JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Snm[119][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[119][  1] = +7.9884637680780E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[119][  2] = -1.0365509617948E-09;
@@ -28262,8 +27628,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[119][117] = +1.2269247023228E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[119][118] = -1.0573043821323E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[119][119] = +2.4275351765705E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[120] =
-      JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Snm[120][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[120][  1] = -8.7049499334258E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[120][  2] = +3.8133908752232E-11;
@@ -28385,8 +27749,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[120][118] = +8.7176944713386E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[120][119] = -7.8882965213508E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[120][120] = -1.5911959098300E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[121] =
-      JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Snm[121][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[121][  1] = -7.6860870968180E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[121][  2] = +1.1034904755967E-10;
@@ -28509,8 +27871,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[121][119] = -4.2025212590192E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[121][120] = -2.1991994384507E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[121][121] = +1.0179145275083E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[122] =
-      JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Snm[122][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[122][  1] = +1.5022144052524E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[122][  2] = +5.5850240785302E-10;
@@ -28634,8 +27994,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[122][120] = -9.1387540836105E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[122][121] = +9.6558703446492E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[122][122] = +5.0404101798479E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[123] =
-      JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Snm[123][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[123][  1] = -8.4001988492465E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[123][  2] = +4.5150609989785E-10;
@@ -28760,8 +28118,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[123][121] = +1.2812372015411E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][122] = +1.5207729555073E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][123] = -5.8548753143210E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[124] =
-      JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Snm[124][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[124][  1] = -1.7715136364230E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[124][  2] = +1.5621612976029E-10;
@@ -28887,8 +28243,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[124][122] = +9.9409463060414E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[124][123] = -3.1099389099584E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[124][124] = +1.0984651821225E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[125] =
-      JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Snm[125][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[125][  1] = -1.4957827589580E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][  2] = +6.9096982307102E-10;
@@ -29015,8 +28369,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[125][123] = +1.2651058597443E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][124] = +1.0933414239242E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][125] = +5.4927856341270E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[126] =
-      JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Snm[126][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[126][  1] = -3.8958763989427E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[126][  2] = -7.9405591452976E-10;
@@ -29144,8 +28496,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[126][124] = +1.2669452824840E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[126][125] = -1.3546387763921E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[126][126] = +4.9850305227008E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[127] =
-      JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Snm[127][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[127][  1] = -4.9187363369999E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[127][  2] = +9.2313970027899E-10;
@@ -29274,8 +28624,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[127][125] = -2.3633519540826E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[127][126] = +8.0560628221144E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[127][127] = +9.3237140141893E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[128] =
-      JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Snm[128][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[128][  1] = +6.3499961320205E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[128][  2] = -2.1703875224503E-10;
@@ -29405,8 +28753,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[128][126] = +2.2413530006630E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[128][127] = +1.7193882898455E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[128][128] = +8.3885084999749E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[129] =
-      JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Snm[129][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[129][  1] = +7.0048735792378E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[129][  2] = +4.8649801006232E-10;
@@ -29537,8 +28883,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[129][127] = +8.4902195682391E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[129][128] = -1.7089823047648E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[129][129] = -8.7831640413493E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[130] =
-      JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Snm[130][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[130][  1] = -7.0686451030500E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[130][  2] = +9.2284531981832E-10;
@@ -29670,8 +29014,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[130][128] = -9.2435226603521E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[130][129] = -3.3122672358832E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[130][130] = +3.0960131830287E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[131] =
-      JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Snm[131][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[131][  1] = -7.0354926524405E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[131][  2] = +3.7865688893883E-10;
@@ -29804,8 +29146,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[131][129] = -7.6830249969018E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[131][130] = +4.1859441899097E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[131][131] = +2.9465667210114E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[132] =
-      JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Snm[132][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[132][  1] = -1.5730568449220E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[132][  2] = -1.5811093964860E-09;
@@ -29939,8 +29279,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[132][130] = +4.7377237032705E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[132][131] = -6.2518670073909E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[132][132] = +3.3888536678467E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[133] =
-      JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Snm[133][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[133][  1] = -2.2036893233589E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[133][  2] = -6.2288973925550E-10;
@@ -30075,8 +29413,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[133][131] = -6.3899770977788E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[133][132] = +1.2457141585570E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[133][133] = +6.0446520378683E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[134] =
-      JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Snm[134][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[134][  1] = +2.2724110621714E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[134][  2] = -5.7017747173101E-10;
@@ -30212,8 +29548,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[134][132] = +1.3974938841364E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[134][133] = -1.0486440447512E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[134][134] = -1.7368017441046E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[135] =
-      JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Snm[135][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[135][  1] = +1.9651560258901E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[135][  2] = -6.1958523083042E-10;
@@ -30350,8 +29684,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[135][133] = -1.3748765424295E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[135][134] = -1.4054881148311E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[135][135] = -3.1113317938765E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[136] =
-      JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Snm[136][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[136][  1] = +3.2806360954729E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[136][  2] = +3.6532866833593E-11;
@@ -30489,8 +29821,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[136][134] = -1.1285614554502E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[136][135] = +1.1094423903819E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[136][136] = +1.0899661663319E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[137] =
-      JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Snm[137][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[137][  1] = -1.2503858439784E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[137][  2] = +5.5098367357797E-10;
@@ -30629,8 +29959,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[137][135] = -5.2179712960572E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[137][136] = +7.2040911807360E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[137][137] = -4.8206215799608E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[138] =
-      JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Snm[138][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[138][  1] = -1.5095053491052E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[138][  2] = +3.7652767450716E-10;
@@ -30770,8 +30098,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[138][136] = -1.5453415578789E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[138][137] = -8.1104287795438E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[138][138] = -6.4150650635225E-13;
-   SphericalHarmonicsGravitySource_ptr->Snm[139] =
-      JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Snm[139][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[139][  1] = +2.4936209941172E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[139][  2] = -5.7174120098457E-10;
@@ -30912,8 +30238,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[139][137] = -4.4671338978461E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[139][138] = +3.4944543678621E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[139][139] = +6.7044882956476E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[140] =
-      JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Snm[140][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[140][  1] = +1.0567547466690E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[140][  2] = -2.7510932686427E-10;
@@ -31055,8 +30379,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[140][138] = +1.1077313687562E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[140][139] = -1.4512669844274E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[140][140] = +2.1826175389827E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[141] =
-      JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Snm[141][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[141][  1] = +2.4310357241690E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[141][  2] = +3.0097018790251E-10;
@@ -31199,8 +30521,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[141][139] = -8.2379799128711E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[141][140] = -8.7758061333789E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[141][141] = -8.9219938845475E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[142] =
-      JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Snm[142][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[142][  1] = +6.9733859459713E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[142][  2] = -5.3002867729610E-11;
@@ -31344,8 +30664,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[142][140] = +4.9455635967457E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[142][141] = +1.2974893910637E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[142][142] = +1.0363856229857E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[143] =
-      JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Snm[143][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[143][  1] = -4.1422051439107E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[143][  2] = -5.0509922227561E-10;
@@ -31490,8 +30808,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[143][141] = +3.1614039023744E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[143][142] = -1.5371176162437E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[143][143] = -1.8694986034293E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[144] =
-      JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Snm[144][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[144][  1] = -4.3360277173491E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[144][  2] = -9.8098963241625E-10;
@@ -31637,8 +30953,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[144][142] = +1.1426008403808E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[144][143] = -3.2240082476679E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[144][144] = -5.2843034235844E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[145] =
-      JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Snm[145][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[145][  1] = -1.7319975811321E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[145][  2] = +8.5688887498132E-10;
@@ -31785,8 +31099,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[145][143] = -8.9006613646015E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[145][144] = +1.4835401926827E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[145][145] = +3.2531702836447E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[146] =
-      JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Snm[146][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[146][  1] = -5.1477938884387E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[146][  2] = +1.1842741567342E-09;
@@ -31934,8 +31246,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[146][144] = -6.4196631115611E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[146][145] = -1.0133003205502E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[146][146] = -3.4116481964778E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[147] =
-      JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Snm[147][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[147][  1] = +5.6275835349788E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[147][  2] = -2.1444252668261E-10;
@@ -32084,8 +31394,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[147][145] = -2.6317776926210E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[147][146] = +8.1008398175365E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[147][147] = +5.2887764420085E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[148] =
-      JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Snm[148][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[148][  1] = -2.1797938209580E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[148][  2] = -7.9406037668586E-10;
@@ -32235,8 +31543,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[148][146] = -6.4086527694658E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[148][147] = -1.5401547334191E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[148][148] = -7.3458684528086E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[149] =
-      JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Snm[149][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[149][  1] = +6.9131897174476E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[149][  2] = -6.6582169029686E-11;
@@ -32387,8 +31693,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[149][147] = +1.2109490710140E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[149][148] = -9.1382260228965E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[149][149] = -8.1918271684466E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[150] =
-      JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Snm[150][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[150][  1] = +3.1361152639580E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[150][  2] = +1.3680700122688E-09;
@@ -32540,8 +31844,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[150][148] = -1.2934192507718E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[150][149] = +1.0150146998578E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[150][150] = +1.1605517185250E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[151] =
-      JEOD_ALLOC_PRIM_ARRAY (152, double);
    SphericalHarmonicsGravitySource_ptr->Snm[151][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[151][  1] = -3.2051864412898E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[151][  2] = -2.5894522692922E-10;
@@ -32694,8 +31996,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[151][149] = +3.8485162599567E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[151][150] = +5.4050188087878E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[151][151] = -3.2296512617936E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[152] =
-      JEOD_ALLOC_PRIM_ARRAY (153, double);
    SphericalHarmonicsGravitySource_ptr->Snm[152][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[152][  1] = -7.4846151234808E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[152][  2] = -1.1956917640239E-09;
@@ -32849,8 +32149,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[152][150] = +7.2335574581995E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[152][151] = -3.4625032481455E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[152][152] = -3.4901711635406E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[153] =
-      JEOD_ALLOC_PRIM_ARRAY (154, double);
    SphericalHarmonicsGravitySource_ptr->Snm[153][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[153][  1] = +5.8985973455828E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[153][  2] = -1.8765585154134E-10;
@@ -33005,8 +32303,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[153][151] = +2.2622499630964E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[153][152] = +3.9205709127000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[153][153] = -5.5610010282831E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[154] =
-      JEOD_ALLOC_PRIM_ARRAY (155, double);
    SphericalHarmonicsGravitySource_ptr->Snm[154][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[154][  1] = +9.5308598653894E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[154][  2] = +7.6417308528459E-10;
@@ -33162,8 +32458,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[154][152] = +9.0082049411411E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[154][153] = +6.4888281486727E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[154][154] = -1.8473890438633E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[155] =
-      JEOD_ALLOC_PRIM_ARRAY (156, double);
    SphericalHarmonicsGravitySource_ptr->Snm[155][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[155][  1] = +8.6993516624696E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[155][  2] = +5.2727712931627E-10;
@@ -33320,8 +32614,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[155][153] = -4.5787402432738E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[155][154] = -6.9861933346283E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[155][155] = +8.3030945534879E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[156] =
-      JEOD_ALLOC_PRIM_ARRAY (157, double);
    SphericalHarmonicsGravitySource_ptr->Snm[156][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[156][  1] = -8.4292398615967E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[156][  2] = -2.9631862429588E-10;
@@ -33479,8 +32771,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[156][154] = -8.4699792466687E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[156][155] = +3.2002749381799E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[156][156] = -3.6012371324273E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[157] =
-      JEOD_ALLOC_PRIM_ARRAY (158, double);
    SphericalHarmonicsGravitySource_ptr->Snm[157][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[157][  1] = -5.5764385760457E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[157][  2] = +8.5872913528135E-10;
@@ -33639,8 +32929,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[157][155] = +5.9791352401726E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[157][156] = -3.0025643860207E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[157][157] = -3.7240093015209E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[158] =
-      JEOD_ALLOC_PRIM_ARRAY (159, double);
    SphericalHarmonicsGravitySource_ptr->Snm[158][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[158][  1] = -7.0484235440870E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[158][  2] = +3.8254525933391E-10;
@@ -33800,8 +33088,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[158][156] = +1.0254714725762E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[158][157] = -2.8437333083486E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[158][158] = +2.2828363822920E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[159] =
-      JEOD_ALLOC_PRIM_ARRAY (160, double);
    SphericalHarmonicsGravitySource_ptr->Snm[159][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[159][  1] = +7.6355394370227E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[159][  2] = -1.2546969490942E-09;
@@ -33962,8 +33248,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[159][157] = -5.2661929177453E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[159][158] = +7.2669790879186E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[159][159] = +6.6086560444043E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[160] =
-      JEOD_ALLOC_PRIM_ARRAY (161, double);
    SphericalHarmonicsGravitySource_ptr->Snm[160][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[160][  1] = -2.5642593243372E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[160][  2] = -6.1717529400811E-11;
@@ -34125,8 +33409,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[160][158] = -3.0735850052941E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[160][159] = -1.3920751263760E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[160][160] = -1.3927262594553E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[161] =
-      JEOD_ALLOC_PRIM_ARRAY (162, double);
    SphericalHarmonicsGravitySource_ptr->Snm[161][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[161][  1] = -7.9402530039248E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[161][  2] = +5.7706069821851E-10;
@@ -34289,8 +33571,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[161][159] = -7.9248648076276E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[161][160] = -4.1816323266862E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[161][161] = +1.1805987083004E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[162] =
-      JEOD_ALLOC_PRIM_ARRAY (163, double);
    SphericalHarmonicsGravitySource_ptr->Snm[162][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[162][  1] = +1.1910954395233E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[162][  2] = +2.7154007302664E-10;
@@ -34454,8 +33734,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[162][160] = +7.9456052388043E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[162][161] = +3.3389152945521E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[162][162] = -7.6371416991125E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[163] =
-      JEOD_ALLOC_PRIM_ARRAY (164, double);
    SphericalHarmonicsGravitySource_ptr->Snm[163][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[163][  1] = +4.6189026652273E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[163][  2] = -3.6288656572522E-10;
@@ -34620,8 +33898,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[163][161] = +6.9673234461658E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[163][162] = +2.1839286566462E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[163][163] = -6.1983910445060E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[164] =
-      JEOD_ALLOC_PRIM_ARRAY (165, double);
    SphericalHarmonicsGravitySource_ptr->Snm[164][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[164][  1] = -3.0147908598499E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[164][  2] = +9.0724300702852E-11;
@@ -34787,8 +34063,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[164][162] = -1.9928069788811E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[164][163] = -1.0654089540061E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[164][164] = +6.6410057175219E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[165] =
-      JEOD_ALLOC_PRIM_ARRAY (166, double);
    SphericalHarmonicsGravitySource_ptr->Snm[165][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[165][  1] = +2.2748015738653E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[165][  2] = +3.5348975523849E-10;
@@ -34955,8 +34229,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[165][163] = +2.9646375033808E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[165][164] = -1.9078515603640E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[165][165] = -5.9475142574608E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[166] =
-      JEOD_ALLOC_PRIM_ARRAY (167, double);
    SphericalHarmonicsGravitySource_ptr->Snm[166][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[166][  1] = +3.8369400986834E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[166][  2] = +1.6807082488899E-10;
@@ -35124,8 +34396,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[166][164] = +2.6110303158890E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[166][165] = -8.4073764339220E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[166][166] = +1.7928878968484E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[167] =
-      JEOD_ALLOC_PRIM_ARRAY (168, double);
    SphericalHarmonicsGravitySource_ptr->Snm[167][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[167][  1] = -3.4683387630163E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[167][  2] = -3.5920432374021E-11;
@@ -35294,8 +34564,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[167][165] = -1.1187882002425E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[167][166] = -2.4738064401438E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[167][167] = +3.0898841574110E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[168] =
-      JEOD_ALLOC_PRIM_ARRAY (169, double);
    SphericalHarmonicsGravitySource_ptr->Snm[168][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[168][  1] = -5.6628649429508E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[168][  2] = -6.2423516132972E-10;
@@ -35465,8 +34733,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[168][166] = +7.9431027867746E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[168][167] = +7.5951513318925E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[168][168] = +3.8820952811016E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[169] =
-      JEOD_ALLOC_PRIM_ARRAY (170, double);
    SphericalHarmonicsGravitySource_ptr->Snm[169][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[169][  1] = +7.0368948553353E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[169][  2] = +4.6998730228494E-11;
@@ -35637,8 +34903,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[169][167] = +1.8667619879416E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[169][168] = -1.2073299747409E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[169][169] = +1.2680971345909E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[170] =
-      JEOD_ALLOC_PRIM_ARRAY (171, double);
    SphericalHarmonicsGravitySource_ptr->Snm[170][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[170][  1] = +2.1322609566402E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[170][  2] = +7.5452331653471E-10;
@@ -35810,8 +35074,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[170][168] = -8.2285752714636E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[170][169] = -4.9175023860302E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[170][170] = -1.2197750676726E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[171] =
-      JEOD_ALLOC_PRIM_ARRAY (172, double);
    SphericalHarmonicsGravitySource_ptr->Snm[171][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[171][  1] = -5.2744179756771E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[171][  2] = -3.0384963819362E-10;
@@ -35984,8 +35246,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[171][169] = +2.0204442468645E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[171][170] = +1.9502811116172E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[171][171] = -9.5886873692038E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[172] =
-      JEOD_ALLOC_PRIM_ARRAY (173, double);
    SphericalHarmonicsGravitySource_ptr->Snm[172][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[172][  1] = -1.8416055387838E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[172][  2] = -3.6537101525158E-10;
@@ -36159,8 +35419,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[172][170] = +2.1337273021776E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[172][171] = -1.7629990156429E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[172][172] = -5.9605615728648E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[173] =
-      JEOD_ALLOC_PRIM_ARRAY (174, double);
    SphericalHarmonicsGravitySource_ptr->Snm[173][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[173][  1] = -1.1074734220289E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[173][  2] = -4.5716703993454E-10;
@@ -36335,8 +35593,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[173][171] = +6.7131986880767E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[173][172] = -4.2871789451821E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[173][173] = +2.8169148362683E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[174] =
-      JEOD_ALLOC_PRIM_ARRAY (175, double);
    SphericalHarmonicsGravitySource_ptr->Snm[174][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[174][  1] = +2.2782453017746E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[174][  2] = -4.4950673680365E-10;
@@ -36512,8 +35768,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[174][172] = +5.0162611098762E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[174][173] = +3.9856204239223E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[174][174] = +1.7631363175036E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[175] =
-      JEOD_ALLOC_PRIM_ARRAY (176, double);
    SphericalHarmonicsGravitySource_ptr->Snm[175][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[175][  1] = -3.4810781382606E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[175][  2] = -3.3404445863936E-12;
@@ -36690,8 +35944,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[175][173] = -6.4601726297222E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[175][174] = +4.3474337574923E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[175][175] = +6.5030566255861E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[176] =
-      JEOD_ALLOC_PRIM_ARRAY (177, double);
    SphericalHarmonicsGravitySource_ptr->Snm[176][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[176][  1] = -2.3299666068226E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[176][  2] = +6.9863025195557E-10;
@@ -36869,8 +36121,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[176][174] = -3.3789298634234E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[176][175] = +2.5701513287263E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[176][176] = -1.8900361323715E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[177] =
-      JEOD_ALLOC_PRIM_ARRAY (178, double);
    SphericalHarmonicsGravitySource_ptr->Snm[177][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[177][  1] = -3.6117274254286E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[177][  2] = +3.9656126316816E-11;
@@ -37049,8 +36299,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[177][175] = +4.4029110648672E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[177][176] = -2.2851484311405E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[177][177] = +3.0751821120894E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[178] =
-      JEOD_ALLOC_PRIM_ARRAY (179, double);
    SphericalHarmonicsGravitySource_ptr->Snm[178][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[178][  1] = +3.0108291793901E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[178][  2] = -1.5153924902369E-10;
@@ -37230,8 +36478,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[178][176] = -1.6248590193330E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[178][177] = -5.7642449050986E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[178][178] = +8.4372358166551E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[179] =
-      JEOD_ALLOC_PRIM_ARRAY (180, double);
    SphericalHarmonicsGravitySource_ptr->Snm[179][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[179][  1] = +1.9867198287885E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[179][  2] = -3.1641595572951E-10;
@@ -37412,8 +36658,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[179][177] = +2.1565119982354E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[179][178] = +5.5664387406632E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[179][179] = +1.4159013527661E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[180] =
-      JEOD_ALLOC_PRIM_ARRAY (181, double);
    SphericalHarmonicsGravitySource_ptr->Snm[180][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[180][  1] = +4.8783915883303E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[180][  2] = +4.7250532083031E-10;
@@ -37595,8 +36839,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[180][178] = -2.2883817743954E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[180][179] = -2.1426925519285E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[180][180] = -5.9748315171467E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[181] =
-      JEOD_ALLOC_PRIM_ARRAY (182, double);
    SphericalHarmonicsGravitySource_ptr->Snm[181][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[181][  1] = -1.1242978293386E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[181][  2] = +6.0405803984352E-10;
@@ -37779,8 +37021,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[181][179] = -6.2042470746925E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[181][180] = +2.4713246400986E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[181][181] = -2.5523165659635E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[182] =
-      JEOD_ALLOC_PRIM_ARRAY (183, double);
    SphericalHarmonicsGravitySource_ptr->Snm[182][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[182][  1] = +1.6610425839529E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[182][  2] = -2.6989817636139E-10;
@@ -37964,8 +37204,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[182][180] = +3.7699896671694E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[182][181] = +2.0338396717783E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[182][182] = +2.2330934702831E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[183] =
-      JEOD_ALLOC_PRIM_ARRAY (184, double);
    SphericalHarmonicsGravitySource_ptr->Snm[183][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[183][  1] = -6.1556675157364E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[183][  2] = -4.6930341399666E-10;
@@ -38150,8 +37388,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[183][181] = +2.0774448607945E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[183][182] = -1.8538710213111E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[183][183] = -2.9238326878257E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[184] =
-      JEOD_ALLOC_PRIM_ARRAY (185, double);
    SphericalHarmonicsGravitySource_ptr->Snm[184][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[184][  1] = -1.2558165469578E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[184][  2] = -5.5010738207574E-10;
@@ -38337,8 +37573,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[184][182] = -4.8590910434229E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[184][183] = +6.1207697085206E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[184][184] = -3.6199676326175E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[185] =
-      JEOD_ALLOC_PRIM_ARRAY (186, double);
    SphericalHarmonicsGravitySource_ptr->Snm[185][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[185][  1] = +2.5742769400116E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[185][  2] = +8.0972537901608E-10;
@@ -38525,8 +37759,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[185][183] = +2.6341514009121E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[185][184] = +6.9053521583345E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[185][185] = -6.3711437595413E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[186] =
-      JEOD_ALLOC_PRIM_ARRAY (187, double);
    SphericalHarmonicsGravitySource_ptr->Snm[186][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[186][  1] = +8.9561452601252E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[186][  2] = +1.5461647448417E-10;
@@ -38714,8 +37946,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[186][184] = +2.0091226335554E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[186][185] = -4.5673291361672E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[186][186] = -6.0404831498891E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[187] =
-      JEOD_ALLOC_PRIM_ARRAY (188, double);
    SphericalHarmonicsGravitySource_ptr->Snm[187][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[187][  1] = +3.4991930104507E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[187][  2] = -7.5635284363216E-11;
@@ -38904,8 +38134,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[187][185] = -2.2084176724953E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[187][186] = -3.3567432238973E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[187][187] = +4.1152230526874E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[188] =
-      JEOD_ALLOC_PRIM_ARRAY (189, double);
    SphericalHarmonicsGravitySource_ptr->Snm[188][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[188][  1] = -4.0612329495859E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[188][  2] = -4.0275359505477E-10;
@@ -39095,8 +38323,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[188][186] = +4.1716868133981E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[188][187] = -5.7339172996233E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[188][188] = +1.5223594714002E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[189] =
-      JEOD_ALLOC_PRIM_ARRAY (190, double);
    SphericalHarmonicsGravitySource_ptr->Snm[189][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[189][  1] = -1.7475796956182E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[189][  2] = -3.3522965180079E-10;
@@ -39287,8 +38513,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[189][187] = -2.5556912299284E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[189][188] = +2.6325572070674E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[189][189] = -2.9485598102102E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[190] =
-      JEOD_ALLOC_PRIM_ARRAY (191, double);
    SphericalHarmonicsGravitySource_ptr->Snm[190][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[190][  1] = +3.4331514564000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[190][  2] = -1.7735044392262E-10;
@@ -39480,8 +38704,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[190][188] = -3.9546573579327E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[190][189] = +7.4985881787249E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[190][190] = +3.9510845182608E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[191] =
-      JEOD_ALLOC_PRIM_ARRAY (192, double);
    SphericalHarmonicsGravitySource_ptr->Snm[191][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[191][  1] = -5.1059954590418E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[191][  2] = +3.3277675203294E-10;
@@ -39674,8 +38896,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[191][189] = +7.1732182401184E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[191][190] = -3.6132086684169E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[191][191] = -5.9362641200228E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[192] =
-      JEOD_ALLOC_PRIM_ARRAY (193, double);
    SphericalHarmonicsGravitySource_ptr->Snm[192][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[192][  1] = -4.1663953905460E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[192][  2] = +4.6180209472969E-10;
@@ -39869,8 +39089,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[192][190] = -4.2948436840083E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[192][191] = -9.3570633572715E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[192][192] = -8.3417486865899E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[193] =
-      JEOD_ALLOC_PRIM_ARRAY (194, double);
    SphericalHarmonicsGravitySource_ptr->Snm[193][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[193][  1] = -1.8116651910592E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[193][  2] = +1.7972563595119E-10;
@@ -40065,8 +39283,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[193][191] = -5.8613107984315E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[193][192] = +8.3083158183465E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[193][193] = +2.4081215477947E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[194] =
-      JEOD_ALLOC_PRIM_ARRAY (195, double);
    SphericalHarmonicsGravitySource_ptr->Snm[194][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[194][  1] = +5.5383338819163E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[194][  2] = +9.3541304487200E-11;
@@ -40262,8 +39478,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[194][192] = +1.2405097712708E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[194][193] = +3.1415839117605E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[194][194] = -4.9797319475069E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[195] =
-      JEOD_ALLOC_PRIM_ARRAY (196, double);
    SphericalHarmonicsGravitySource_ptr->Snm[195][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[195][  1] = +5.5373483318029E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[195][  2] = +4.2589127571904E-10;
@@ -40460,8 +39674,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[195][193] = -2.2495940694451E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[195][194] = -5.0958395338946E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[195][195] = -6.8214671885655E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[196] =
-      JEOD_ALLOC_PRIM_ARRAY (197, double);
    SphericalHarmonicsGravitySource_ptr->Snm[196][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[196][  1] = -2.9204412317203E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[196][  2] = -2.9110978961361E-10;
@@ -40659,8 +39871,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[196][194] = +4.3382280085253E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[196][195] = -8.6635843047105E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[196][196] = +5.2956212886755E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[197] =
-      JEOD_ALLOC_PRIM_ARRAY (198, double);
    SphericalHarmonicsGravitySource_ptr->Snm[197][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[197][  1] = -3.7284391508514E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[197][  2] = +2.1183377250001E-10;
@@ -40859,8 +40069,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[197][195] = +3.7735869199373E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[197][196] = -4.6972791840288E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[197][197] = +3.4913101767407E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[198] =
-      JEOD_ALLOC_PRIM_ARRAY (199, double);
    SphericalHarmonicsGravitySource_ptr->Snm[198][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[198][  1] = -3.6919256736152E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[198][  2] = +1.8109910543126E-10;
@@ -41060,8 +40268,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[198][196] = -5.0485179448117E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[198][197] = +1.1054401150165E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[198][198] = +2.7673040717131E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[199] =
-      JEOD_ALLOC_PRIM_ARRAY (200, double);
    SphericalHarmonicsGravitySource_ptr->Snm[199][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[199][  1] = -1.8634413076012E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[199][  2] = -2.9483391360064E-10;
@@ -41262,8 +40468,6 @@ SphericalHarmonicsGravitySource_earth_GGM02C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[199][197] = -7.3289158143346E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[199][198] = +1.0608215391684E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[199][199] = -4.0254318019813E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[200] =
-      JEOD_ALLOC_PRIM_ARRAY (201, double);
    SphericalHarmonicsGravitySource_ptr->Snm[200][  0] = +0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[200][  1] = +3.9146106651735E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[200][  2] = -5.3166956136492E-14;
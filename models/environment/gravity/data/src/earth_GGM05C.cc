@@ -45,39 +45,29 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->tide_free_delta = 4.173E-9;
 
    SphericalHarmonicsGravitySource_ptr->Cnm =
-      JEOD_ALLOC_PRIM_ARRAY (360 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (360 + 1, 0, double);
    SphericalHarmonicsGravitySource_ptr->Snm =
-      JEOD_ALLOC_PRIM_ARRAY (360 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (360 + 1, 0, double);
 
    /* FULLY NORMALIZED GRAVITY COEFFICIENTS (unitless) */
-   SphericalHarmonicsGravitySource_ptr->Cnm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  0] = -4.8416945732000E-04;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  1] = -3.1034310672386E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  2] =  2.4393734159398E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  0] =  9.5716475834116E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  1] =  2.0304466371688E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  2] =  9.0476467441002E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  3] =  7.2128525517036E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  0] =  5.3998153921365E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  1] = -5.3618081337028E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  2] =  3.5049214427031E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  3] =  9.9086103111508E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  4] = -1.8849242252755E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  0] =  6.8650323458391E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  1] = -6.2914579409678E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  2] =  6.5205860316915E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  3] = -4.5183137844644E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  4] = -2.9532340917041E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  5] =  1.7481435046942E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  0] = -1.4997605610883E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  1] = -7.5943265879397E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  2] =  4.8635603179946E-08;
@@ -85,8 +75,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  4] = -8.5996937469007E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  5] = -2.6716319362048E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  6] =  9.4799107163032E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  0] =  9.0500819789642E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  1] =  2.8088622262423E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  2] =  3.3039550420017E-07;
@@ -95,8 +83,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  5] =  1.6469638664557E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  6] = -3.5879864059130E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  7] =  1.5230586682001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  0] =  4.9478326949545E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  1] =  2.3140759375679E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  2] =  8.0020451775005E-08;
@@ -106,8 +92,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  6] = -6.5971100477032E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  7] =  6.7256526485194E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  8] = -1.2403256812475E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  0] =  2.8022721711668E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  1] =  1.4214925632662E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  2] =  2.1411871093739E-08;
@@ -118,8 +102,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  7] = -1.1798115451725E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  8] =  1.8813248989960E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  9] = -4.7558362699944E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  0] =  5.3345275002101E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  1] =  8.3753701278788E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  2] = -9.3977781512067E-08;
@@ -131,8 +113,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  8] =  4.0589757557591E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  9] =  1.2538547435906E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][ 10] =  1.0042327725658E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  0] = -5.0764958681880E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  1] =  1.5614437030145E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  2] =  2.0113728808692E-08;
@@ -145,8 +125,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  9] = -3.1077219992559E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 10] = -5.2236248904979E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 11] =  4.6233558067647E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  0] =  3.6447534344010E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  1] = -5.3588420180974E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  2] =  1.4279457759057E-08;
@@ -160,8 +138,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 10] = -6.1993071678133E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 11] =  1.1364762661600E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 12] = -2.4197198709965E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  0] =  4.1730832310432E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  1] = -5.1442127891891E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  2] =  5.5309064604172E-08;
@@ -176,8 +152,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 11] = -4.4522885012192E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 12] = -3.1312205412225E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 13] = -6.1205539102216E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  0] = -2.2662515025165E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  1] = -1.8769264461628E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  2] = -3.5912985791172E-08;
@@ -193,8 +167,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 12] =  8.4593360307084E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 13] =  3.2244531127525E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 14] = -5.1869821414480E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  0] =  2.1905257035502E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  1] =  9.4317022085275E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  2] = -2.0530501117192E-08;
@@ -211,8 +183,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 13] = -2.8368610879030E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 14] =  5.1981104044920E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 15] = -1.9029108441758E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  0] = -4.7070316974682E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  1] =  2.6189063984499E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  2] = -2.4505097916532E-08;
@@ -230,8 +200,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 14] = -1.9345479833634E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 15] = -1.4417578440804E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 16] = -3.8300861594181E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  0] =  1.9185638980015E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  1] = -2.5366868817320E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  2] = -2.0101849520459E-08;
@@ -250,8 +218,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 15] =  5.5434980472171E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 16] = -3.0405375760841E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 17] = -3.4699783952905E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  0] =  6.0995322853343E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  1] =  7.2037622332582E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  2] =  1.4727028819456E-08;
@@ -271,8 +237,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 16] =  1.0161782975135E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 17] =  3.4812470396806E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 18] =  2.9943782938479E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  0] = -3.3026312765900E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  1] = -8.9769027560816E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  2] =  3.5740453445242E-08;
@@ -293,8 +257,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 17] =  2.8806340062164E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 18] =  3.5009032841798E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 19] = -2.7033059376817E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  0] =  2.1561032742428E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  1] =  5.5693933118913E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  2] =  2.0293015763474E-08;
@@ -316,8 +278,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 18] =  1.5356706426350E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 19] = -3.0291332632403E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 20] =  3.7337387259245E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  0] =  6.2514504191117E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  1] = -1.6162526886757E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  2] = -5.6140291709890E-09;
@@ -340,8 +300,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 19] = -2.7204150743397E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 20] = -2.6944313196903E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 21] =  8.4557672297471E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  0] = -1.0777609848677E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  1] =  1.5681426387950E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  2] = -2.6490575381469E-08;
@@ -365,8 +323,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 20] = -1.6770905069226E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 21] = -2.5316048493799E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 22] = -1.0086375911876E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  0] = -2.2257044344595E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  1] =  9.1726565654850E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  2] = -1.4393050954423E-08;
@@ -391,8 +347,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 21] =  1.5710404235473E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 22] = -1.7972455686176E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 23] =  3.0547500879245E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  0] = -7.4961183912251E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  1] = -2.7289740185498E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  2] =  9.5622011835159E-10;
@@ -418,8 +372,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 22] =  3.9926736546773E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 23] = -6.1940306866649E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 24] =  1.2659995286631E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  0] =  3.2079578493702E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  1] =  6.3719145459003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  2] =  2.2720081771792E-08;
@@ -446,8 +398,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 23] =  8.5825262138886E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 24] =  4.2382730052224E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 25] =  1.0490274812123E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  0] =  5.8894470041224E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  1] = -1.4222410421531E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  2] = -1.5901305650054E-09;
@@ -475,8 +425,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 24] =  9.0305825089530E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 25] =  3.7828000055826E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 26] =  6.6516720930846E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  0] =  3.6170230174683E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  1] =  2.8627678132099E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  2] =  6.6226259458976E-10;
@@ -505,8 +453,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 25] =  1.2089174714114E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 26] = -6.8303391165615E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 27] =  8.0621547987242E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  0] = -9.7753935800413E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  1] = -5.2759853807839E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  2] = -1.5011868173286E-08;
@@ -536,8 +482,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 26] =  1.2069303372624E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 27] = -8.0326151990727E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 28] =  6.8156502237002E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  0] = -5.2764069069891E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  1] =  4.0296792885639E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  2] = -2.3784553630559E-09;
@@ -568,8 +512,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 27] = -7.7315958469522E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 28] =  9.5352155977958E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 29] =  1.2805005496223E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  0] =  6.2547327594436E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  1] =  2.7283560667757E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  2] = -9.9639411304693E-09;
@@ -601,8 +543,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 28] = -5.8252152465580E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 29] =  3.9382618751758E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 30] =  2.5841699412390E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  0] =  6.7614256537702E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  1] =  7.1226901775628E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  2] =  6.2616162727253E-09;
@@ -635,8 +575,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 29] = -2.0235631081120E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 30] = -8.2430121917745E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 31] = -8.8228304431441E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  0] = -2.4026308297410E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  1] = -7.6262182560983E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  2] =  1.1503604156120E-08;
@@ -670,8 +608,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 30] = -6.9179423114214E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 31] = -6.0935289387250E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 32] =  3.4755339480094E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  0] = -3.6332275149337E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  1] = -1.7504436187758E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  2] = -6.0566014121547E-09;
@@ -706,8 +642,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 31] =  4.2560206282469E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 32] =  6.2526859436244E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 33] = -1.6850189754223E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  0] = -8.9353129080755E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  1] = -4.2188027717221E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  2] =  6.9432932348587E-09;
@@ -743,8 +677,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 32] =  8.9321399030694E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 33] =  1.4019966618159E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 34] = -8.7660637212714E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  0] =  7.7657820086056E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  1] = -1.2544018137518E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  2] = -1.5075126583879E-08;
@@ -781,8 +713,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 33] =  5.6311674015779E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 34] = -7.8435182777832E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 35] = -5.9655019355312E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  0] = -3.6546775415888E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  1] =  4.6891355206002E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  2] = -3.7473773930774E-09;
@@ -820,8 +750,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 34] = -8.9661322546547E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 35] =  1.8461482852743E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 36] =  4.9740751991203E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  0] = -5.7099666348595E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  1] = -6.9582931531637E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  2] = -2.1685472080144E-09;
@@ -860,8 +788,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 35] = -1.0213828880391E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 36] = -4.0421878264109E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 37] =  5.5731275836359E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  0] = -2.4268635430910E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  1] =  5.0909474711852E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  2] =  7.5051826128098E-09;
@@ -901,8 +827,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 36] =  8.8295007463689E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 37] = -3.8265511461621E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 38] =  2.8080999493682E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  0] =  1.2926519679161E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  1] = -4.4290676297988E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  2] =  3.0634195463336E-09;
@@ -943,8 +867,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 37] =  8.7262396552791E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 38] = -9.4291004848849E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 39] = -1.1962126988456E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  0] = -6.2187869452331E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  1] =  3.8071886737510E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  2] = -1.1202799676420E-09;
@@ -986,8 +908,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 38] =  3.7582209118985E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 39] =  6.4599965624747E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 40] = -1.7758262931466E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  0] = -3.2417578503224E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  1] = -7.1435039168310E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  2] =  3.6128611136640E-09;
@@ -1030,8 +950,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 39] = -5.5105317369646E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 40] =  3.9497405938735E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 41] =  4.1431082939202E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  0] = -2.2072342508313E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  1] = -2.2744686280023E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  2] = -3.8148638543959E-09;
@@ -1075,8 +993,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 40] =  1.4643791764487E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 41] =  5.0989369989336E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 42] = -6.4905639700093E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  0] =  6.4615296081211E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  1] = -4.8910668112801E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  2] = -9.4418036012223E-09;
@@ -1121,8 +1037,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 41] = -1.9691984152268E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 42] = -8.5541411141618E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 43] = -3.3640046117181E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  0] =  3.4292326784717E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  1] =  5.8023865659233E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  2] = -6.2464591016883E-10;
@@ -1168,8 +1082,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 42] = -7.3685400506453E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 43] =  2.1619920744277E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 44] =  2.8191355273597E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  0] = -3.2524475806596E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  1] =  3.4126469790882E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  2] =  2.0569654851754E-09;
@@ -1216,8 +1128,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 43] =  4.3320605575232E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 44] =  1.1283584635663E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 45] = -4.9721423993091E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  0] = -3.1078472562593E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  1] =  1.7614175475196E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  2] =  5.1114424342473E-09;
@@ -1265,8 +1175,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 44] =  2.8329950469189E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 45] = -9.9995125275580E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 46] =  2.9074362793399E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  0] =  9.3641466963752E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  1] = -6.9254860753982E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  2] =  4.3542253545254E-09;
@@ -1315,8 +1223,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 45] =  6.2302317277851E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 46] = -6.5417908875903E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 47] =  2.6941397487567E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  0] =  3.5155119939196E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  1] =  1.4267363815369E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  2] =  4.7176889925335E-09;
@@ -1366,8 +1272,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 46] = -3.1028438335091E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 47] =  3.6786806107886E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 48] =  5.5703599511085E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  0] =  2.0509621198863E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  1] =  6.6437884739284E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  2] = -3.4898916793652E-10;
@@ -1418,8 +1322,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 47] =  3.2431467798398E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 48] = -1.5832043177367E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 49] =  2.5489378375844E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  0] = -4.8447664754686E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  1] =  3.5078632761804E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  2] = -8.0582928342696E-09;
@@ -1471,8 +1373,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 48] =  8.5662120213056E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 49] =  2.1942513377317E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 50] =  4.5346214857984E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  0] = -4.4590870014344E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  1] =  1.7615940363085E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  2] = -7.3340051973030E-09;
@@ -1525,8 +1425,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 49] = -2.2277853665281E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 50] = -2.1295683333517E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 51] =  1.0466270724076E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  0] =  1.2129774012741E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  1] = -1.7553252618772E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  2] =  3.5706052185639E-09;
@@ -1580,8 +1478,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 50] = -5.2992738627636E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 51] = -5.9857262634757E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 52] = -2.1781580171964E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  0] =  7.8590547177372E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  1] =  1.8805149027060E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  2] =  5.8036567628085E-09;
@@ -1636,8 +1532,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 51] =  1.9223074740392E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 52] =  6.2110020675022E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 53] =  1.9944834167744E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  0] =  2.2361096153065E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  1] = -1.6264336088107E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  2] =  2.3138562280867E-09;
@@ -1693,8 +1587,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 52] =  1.3485755267146E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 53] = -2.7490933827240E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 54] = -7.7840389011173E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  0] =  9.9768720290277E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  1] = -2.6752179400384E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  2] = -1.7255768348337E-09;
@@ -1751,8 +1643,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 53] =  3.2598954785730E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 54] = -5.5892936613100E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 55] =  1.6450936503235E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  0] = -4.2742774247260E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  1] =  3.4210928797596E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  2] = -3.1465793439827E-09;
@@ -1810,8 +1700,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 54] = -6.8872269275710E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 55] = -1.0776549836705E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 56] =  1.4854070967794E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  0] = -2.6978302126453E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  1] =  4.9424295229861E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  2] = -3.4894252054875E-09;
@@ -1870,8 +1758,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 55] =  2.7786636577232E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 56] =  6.6215553811095E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 57] = -2.2980600643913E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  0] = -3.4737363420961E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  1] = -1.9819105714849E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  2] =  2.1458202272891E-09;
@@ -1931,8 +1817,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 56] = -2.2583460264675E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 57] = -2.1380180512317E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 58] = -1.3073141558720E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  0] =  3.5445062351230E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  1] = -3.3388763715299E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  2] =  4.7081665838920E-09;
@@ -1993,8 +1877,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 57] =  4.4309204835039E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 58] =  1.7622628952933E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 59] =  2.1018059472419E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  0] = -8.7217196439464E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  1] =  1.8767282616173E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  2] =  3.4882796582508E-09;
@@ -2056,8 +1938,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 58] = -1.8210022257954E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 59] = -2.4747027807425E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 60] =  3.7732604053848E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  0] =  3.4788153095552E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  1] =  2.8704165445130E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  2] = -1.4352286390198E-09;
@@ -2120,8 +2000,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 59] = -4.2501815241029E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 60] = -3.5454793503377E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 61] = -2.1460589669657E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  0] =  1.3720912748174E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  1] =  8.5364110067373E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  2] = -4.1282948385914E-09;
@@ -2185,8 +2063,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 60] =  1.2063067916069E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 61] =  3.5136353657313E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 62] = -2.0574856320466E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  0] = -1.3116664007827E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  1] = -2.9516663751392E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  2] = -4.1774570751863E-10;
@@ -2251,8 +2127,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 61] = -3.1766406701410E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 62] = -4.4621823666875E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 63] = -4.7647218403376E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  0] = -4.1392939431636E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  1] =  4.7199395583845E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  2] = -9.4707652283628E-10;
@@ -2318,8 +2192,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 62] = -1.3221271912516E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 63] =  3.0223644028953E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 64] =  5.4825441639090E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  0] =  6.8977360646031E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  1] = -3.1482450891040E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  2] = -9.2626685598390E-11;
@@ -2386,8 +2258,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 63] =  5.1966727862270E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 64] =  3.6885229230731E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 65] =  1.1364742964094E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  0] = -3.6518704807254E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  1] = -2.8608531056116E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  2] =  1.5079581624507E-09;
@@ -2455,8 +2325,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 64] =  1.4086379070657E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 65] = -3.9279732399222E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 66] = -3.2158039082924E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  0] =  4.7610115724446E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  1] = -3.3581691633636E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  2] =  5.8533082393974E-10;
@@ -2525,8 +2393,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 65] = -4.3688350084422E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 66] =  1.4135202575454E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 67] = -8.4997976151199E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  0] = -5.2300474220958E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  1] =  1.8931157316854E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  2] = -4.0612879736461E-09;
@@ -2596,8 +2462,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 66] =  7.4374625786645E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 67] =  3.9046630716931E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 68] = -1.3616086764635E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  0] =  6.1971821397995E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  1] =  6.3170119635675E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  2] = -2.4284629846293E-09;
@@ -2668,8 +2532,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 67] = -3.1400465043231E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 68] = -1.6457578915437E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 69] =  2.1957204352479E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  0] = -5.8630168175982E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  1] =  9.0394690076810E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  2] =  1.0303058179438E-10;
@@ -2741,8 +2603,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 68] = -3.1365723694629E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 69] = -1.7164785973534E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 70] =  3.3103944292097E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  0] = -2.6449987792239E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  1] = -1.6475950304749E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  2] =  4.8016165787281E-10;
@@ -2815,8 +2675,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 69] = -2.9092865402385E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 70] = -1.4229856421200E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 71] = -2.1211784954502E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  0] = -2.3728903989595E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  1] =  7.2046481334714E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  2] = -2.0380662269241E-10;
@@ -2890,8 +2748,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 70] =  1.4177812022784E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 71] = -1.1494426031836E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 72] =  1.1387633357231E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  0] = -3.5307307612836E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  1] = -3.3328323988027E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  2] =  2.2606769258419E-10;
@@ -2966,8 +2822,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 71] = -1.3007717612840E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 72] =  1.5055189911331E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 73] =  1.0102507759136E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  0] =  5.3971642167218E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  1] = -2.5958201651512E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  2] =  7.3426208810933E-10;
@@ -3043,8 +2897,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 72] =  1.8438943421303E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 73] = -7.2585768746847E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 74] = -1.2741233061782E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  0] = -4.5257661606994E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  1] =  1.6729199281945E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  2] = -1.3939800453145E-09;
@@ -3121,8 +2973,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 73] = -1.1235761140328E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 74] = -2.0171556089326E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 75] =  8.5823571990195E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  0] =  1.4616883208764E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  1] =  1.4492565793185E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  2] = -1.6603854145606E-09;
@@ -3200,8 +3050,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 74] =  4.6908637593583E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 75] =  4.8810033916179E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 76] = -1.9310500214028E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  0] =  2.6237005129044E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  1] =  1.8869925253698E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  2] =  1.0233213740855E-09;
@@ -3280,8 +3128,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 75] =  4.3012439538991E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 76] =  4.8258228520150E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 77] = -2.1622692121010E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  0] =  3.5549715432045E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  1] = -1.4429504196618E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  2] = -2.4905654311453E-10;
@@ -3361,8 +3207,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 76] = -1.3370518024395E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 77] = -1.8221980887335E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 78] =  3.2275465211227E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  0] = -9.9497529342615E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  1] = -8.8059822494234E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  2] = -2.8608674430220E-10;
@@ -3443,8 +3287,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 77] = -2.2311172665780E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 78] = -2.2017487574283E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 79] = -1.2575787724170E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  0] = -1.4067591087347E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  1] = -8.6512860341813E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  2] = -2.1497306878068E-09;
@@ -3526,8 +3368,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 78] = -1.3596758722433E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 79] =  1.4826178338311E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 80] = -1.4119847733805E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  0] =  8.9153234998120E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  1] = -1.1547860966521E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  2] = -1.1769550263254E-09;
@@ -3610,8 +3450,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 79] = -1.4911396099696E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 80] =  3.7903325034283E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 81] =  1.7847837241987E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  0] = -9.7248755417250E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  1] = -1.6081270906967E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  2] =  6.8896847105095E-10;
@@ -3695,8 +3533,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 80] =  3.1153312253929E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 81] = -6.1797796502250E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 82] = -3.3185624986321E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  0] =  6.2057975973197E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  1] =  7.9068788391837E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  2] =  6.8145056456158E-13;
@@ -3781,8 +3617,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 81] =  1.9101819326030E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 82] = -3.6060472394512E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 83] =  2.4671029840312E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  0] =  2.9826409221829E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  1] =  2.5177001187044E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  2] =  8.7227116729072E-10;
@@ -3868,8 +3702,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 82] = -1.2702261267604E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 83] =  2.0265096133498E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 84] =  2.6470511118918E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  0] = -1.4839686207707E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  1] = -2.4810477031804E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  2] =  2.3357381314560E-09;
@@ -3956,8 +3788,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 83] =  1.7035704359103E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 84] =  2.4658338196002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 85] = -3.3278370355147E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  0] = -1.7101432512946E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  1] =  1.3111731275674E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  2] = -4.1587571974975E-10;
@@ -4045,8 +3875,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 84] = -5.0884199677272E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 85] = -2.9059275975850E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 86] =  9.6162202999160E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  0] =  1.7415425771966E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  1] =  6.9189512633824E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  2] = -1.0222982504195E-09;
@@ -4135,8 +3963,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 85] = -1.5437313295829E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 86] = -7.3211946596761E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 87] =  1.2300948849892E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  0] =  1.8323727482184E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  1] = -1.4775130901884E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  2] = -2.8593689937194E-09;
@@ -4226,8 +4052,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 86] = -4.7488387507409E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 87] =  7.5312966873339E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 88] = -6.1579892830829E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  0] = -7.0627250696200E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  1] = -1.1000200669433E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  2] =  7.1175316821641E-10;
@@ -4318,8 +4142,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 87] = -6.8571075916051E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 88] = -3.1069816738980E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 89] =  1.8795075785152E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  0] = -4.0261313472328E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  1] = -5.9913327906741E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  2] = -1.0226242114918E-09;
@@ -4411,8 +4233,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 88] = -2.9174288147885E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 89] =  2.7354505901327E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 90] =  8.5392915143133E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  0] = -5.0980249451160E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  1] = -5.5207582036129E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  2] =  1.6012041840316E-09;
@@ -4505,8 +4325,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 89] =  2.6406424688452E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 90] = -8.4984560014465E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 91] = -2.1480465333133E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  0] = -9.3032899928236E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  1] = -7.7678107316734E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  2] =  9.0580606314206E-10;
@@ -4600,8 +4418,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 90] =  1.8536372194176E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 91] = -2.3376944263328E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 92] =  1.7423681238238E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  0] =  5.7405886483968E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  1] =  6.3500741778110E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  2] =  1.3004353428548E-09;
@@ -4696,8 +4512,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 91] = -2.3226588266033E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 92] = -6.4305669114113E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 93] = -6.6128572837563E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  0] =  9.5383460520443E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  1] = -8.3010990237979E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  2] = -2.3489123999338E-10;
@@ -4793,8 +4607,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 92] =  1.1122506347916E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 93] = -1.4986464333309E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 94] = -2.2018093134183E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  0] =  5.4251342293806E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  1] =  1.8195743360973E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  2] =  2.8196436379706E-10;
@@ -4891,8 +4703,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 93] =  2.2285020875597E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 94] =  2.4808220583596E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 95] =  2.6160368294599E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  0] = -1.2476591715791E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  1] =  5.0903184900741E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  2] =  1.2668007559171E-09;
@@ -4990,8 +4800,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 94] =  1.0886657857001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 95] =  1.6860548010602E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 96] = -2.2294983221998E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  0] = -5.6987384170883E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  1] =  1.1479495671222E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  2] = -1.3895000672928E-09;
@@ -5090,8 +4898,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 95] =  1.8581903856534E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 96] = -3.0310407427796E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 97] = -1.7389117213816E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  0] = -4.3811811721792E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  1] = -3.8827746723541E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  2] =  2.5661083218089E-10;
@@ -5191,8 +4997,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 96] = -3.6566370885833E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 97] = -2.0664851301377E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 98] =  1.8647361855848E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  0] =  2.2629030825632E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  1] = -1.3835253108585E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  2] =  9.5440934956999E-10;
@@ -5293,8 +5097,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 97] = -1.4483106496233E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 98] =  1.0129643181659E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 99] =  4.7282892972670E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  0] =  2.3722366608079E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  1] = -1.0962923160574E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  2] =  1.6430700736915E-09;
@@ -5396,8 +5198,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 98] =  6.9283041809385E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 99] =  5.6237566309891E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][100] =  9.8712677323494E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  0] =  1.0653861751555E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  1] =  3.4895243525966E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  2] = -3.0292743026480E-10;
@@ -5500,8 +5300,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[101][ 99] =  3.1020552309109E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][100] = -5.7620119896508E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][101] = -6.4109370789063E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  0] = -5.6402996831785E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  1] =  1.0985996613564E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  2] =  3.0458661474714E-10;
@@ -5605,8 +5403,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[102][100] = -1.3476847536390E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][101] =  4.1670206208323E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][102] = -2.6087636609261E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  0] = -3.0015614781359E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  1] = -1.1573880572404E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  2] = -1.7302693584832E-09;
@@ -5711,8 +5507,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[103][101] = -1.2106029001367E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][102] = -8.3423430794800E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][103] = -8.7617558224237E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  0] = -1.2158558501635E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  1] = -6.2788372489050E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  2] = -1.2207072780796E-09;
@@ -5818,8 +5612,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[104][102] = -1.2730068372347E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][103] =  1.4812066688662E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][104] = -2.3727161009117E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  0] =  1.8528948090017E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  1] = -9.4339793361094E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  2] =  1.4626257092409E-09;
@@ -5926,8 +5718,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[105][103] =  2.3097177032665E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][104] =  2.2304094513034E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][105] = -1.6185754830537E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  0] =  1.8826807042907E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  1] = -3.6988282692218E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  2] =  1.3856934545566E-09;
@@ -6035,8 +5825,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[106][104] = -5.6043757217016E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][105] = -3.3555249852322E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][106] = -2.0817018934188E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  0] =  7.4844467871603E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  1] = -1.2917426847408E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  2] =  3.8294204575382E-10;
@@ -6145,8 +5933,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[107][105] = -7.5266776037508E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][106] =  1.0160461850715E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][107] = -4.3617083234018E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  0] = -1.1689764417820E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  1] =  6.1942198803047E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  2] = -2.8627037185859E-09;
@@ -6256,8 +6042,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[108][106] = -1.5366628397469E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][107] =  1.6546144242195E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][108] = -1.7053787786832E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  0] = -1.7673423076896E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  1] =  2.1867220562298E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  2] = -3.4631407829054E-10;
@@ -6368,8 +6152,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[109][107] = -8.5685772722328E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][108] = -9.2107609499839E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][109] =  1.0524284951294E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  0] = -1.9521236172372E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  1] =  3.9874449536415E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  2] = -8.7477750747298E-11;
@@ -6481,8 +6263,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[110][108] =  5.6818393367476E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][109] =  1.7261445147479E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][110] = -4.8171144746654E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[111] =
-      JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  0] = -1.0473547106140E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  1] = -6.1482828573341E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  2] =  2.1806682816232E-09;
@@ -6595,8 +6375,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[111][109] =  5.0758989566403E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][110] = -1.4259094600827E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][111] = -1.5175805213875E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[112] =
-      JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  0] =  4.5153093433741E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  1] =  5.9637212566383E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  2] =  8.2484236859199E-10;
@@ -6710,8 +6488,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[112][110] = -1.2382638508171E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][111] = -1.6185947742094E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][112] =  4.5423800586429E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[113] =
-      JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  0] =  9.9657187493702E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  1] =  4.4704700488581E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  2] =  2.6250414355737E-10;
@@ -6826,8 +6602,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[113][111] = -3.2505625947554E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][112] =  2.1445981963751E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][113] =  1.6772255224246E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[114] =
-      JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  0] =  1.0584666128520E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  1] = -7.3665180545066E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  2] = -4.3118522325538E-10;
@@ -6943,8 +6717,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[114][112] =  7.7922781551183E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][113] = -4.7168908201609E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][114] =  1.1903052382863E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[115] =
-      JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  0] =  9.5583231637867E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  1] =  5.4010870856837E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  2] = -1.4345132258054E-09;
@@ -7061,8 +6833,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[115][113] =  1.3463570320157E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][114] = -6.3798908595321E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][115] = -4.5880089981171E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[116] =
-      JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  0] = -5.9686348826099E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  1] =  4.5295031779297E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  2] = -1.0971417729209E-09;
@@ -7180,8 +6950,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[116][114] =  1.7537136783145E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][115] = -2.1275467861168E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][116] = -8.5358523423336E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[117] =
-      JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  0] =  7.5274289705707E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  1] =  2.0009844703552E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  2] = -1.4869425709059E-09;
@@ -7300,8 +7068,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[117][115] = -4.8098042897933E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][116] = -1.6704099897695E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][117] =  1.3665254443829E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[118] =
-      JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  0] = -1.9597631766207E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  1] = -1.1777795478987E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  2] =  3.1792870668231E-10;
@@ -7421,8 +7187,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[118][116] = -1.6853975684238E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][117] = -9.4240233038264E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][118] =  3.8697144286708E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[119] =
-      JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  0] = -3.3418007833079E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  1] = -1.1765190315892E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  2] =  1.0963207081573E-09;
@@ -7543,8 +7307,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[119][117] =  6.1740738890435E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][118] =  2.3550497963171E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][119] = -7.2464863137803E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[120] =
-      JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  0] = -6.0625101847766E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  1] =  6.8209782084554E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  2] =  6.2672090921482E-10;
@@ -7666,8 +7428,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[120][118] =  1.2559866425162E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][119] =  5.9645171949828E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][120] = -7.6035502825486E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[121] =
-      JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  0] =  2.0205532476912E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  1] =  9.7871348614471E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  2] = -1.2806121193092E-10;
@@ -7790,8 +7550,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[121][119] =  8.9561079661734E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][120] = -1.2277855489130E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][121] =  2.2161824994319E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[122] =
-      JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  0] =  1.5443859209264E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  1] = -8.3271520403926E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  2] = -2.3398837443638E-10;
@@ -7915,8 +7673,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[122][120] = -2.1981212187446E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][121] = -5.5476372073169E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][122] = -4.8502876254256E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[123] =
-      JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  0] =  3.7903216028733E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  1] =  5.1042766899555E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  2] = -8.5783627745991E-10;
@@ -8041,8 +7797,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[123][121] = -1.1939334564058E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][122] = -9.6396970515169E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][123] =  1.1142471289417E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[124] =
-      JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  0] =  4.0884575208682E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  1] =  2.5449544511412E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  2] = -5.8895649748563E-10;
@@ -8168,8 +7922,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[124][122] = -9.3053577082436E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][123] =  2.6312282004507E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][124] =  9.5676366629371E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[125] =
-      JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  0] =  3.6060190508000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  1] = -2.6241422013728E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  2] = -2.5007098450869E-10;
@@ -8296,8 +8048,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[125][123] =  9.9219450997815E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][124] =  7.8777021984226E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][125] = -6.7470198762843E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[126] =
-      JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  0] =  1.9525811953351E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  1] = -5.4485773078937E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  2] = -2.3436334415715E-10;
@@ -8425,8 +8175,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[126][124] = -1.2623430488398E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][125] = -1.6558389491597E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][126] = -9.9578196237616E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[127] =
-      JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  0] =  1.0720567617116E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  1] = -4.1959544965429E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  2] =  1.8392001318516E-09;
@@ -8555,8 +8303,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[127][125] =  2.1382029776337E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][126] =  4.2336962774340E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][127] =  7.5089523967618E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[128] =
-      JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  0] = -1.0194059974426E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  1] =  1.3314471118508E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  2] =  1.5104402934824E-09;
@@ -8686,8 +8432,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[128][126] =  7.8330640527748E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][127] = -5.6946818190803E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][128] = -1.6824467489631E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[129] =
-      JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  0] = -4.2220060783595E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  1] =  8.2176374258918E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  2] =  2.3385152675013E-10;
@@ -8818,8 +8562,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[129][127] = -1.4413538487464E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][128] =  1.0330885057569E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][129] =  4.7718477082414E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[130] =
-      JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  0] = -4.8263935174755E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  1] = -2.5604768492925E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  2] = -7.1608811649982E-10;
@@ -8951,8 +8693,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[130][128] =  5.8771329229420E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][129] =  2.4524689729420E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][130] = -2.4445107090516E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[131] =
-      JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  0] = -5.6474725719890E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  1] =  1.9495628531113E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  2] = -1.1840252625849E-09;
@@ -9085,8 +8825,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[131][129] =  1.9277805891346E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][130] = -1.7695734079143E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][131] = -1.0943540130092E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[132] =
-      JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  0] = -3.7025487218102E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  1] =  6.7852070356524E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  2] = -5.4168823302304E-10;
@@ -9220,8 +8958,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[132][130] =  3.7914752318185E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][131] = -3.7862856782864E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][132] =  1.2716207249385E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[133] =
-      JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  0] =  1.1555030131169E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  1] =  3.1870166333464E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  2] =  5.7431124427944E-11;
@@ -9356,8 +9092,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[133][131] = -7.6286361929911E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][132] =  7.6964991677529E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][133] =  7.5236784172282E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[134] =
-      JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  0] =  5.8166336283198E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  1] = -3.2907754028900E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  2] =  1.1839017494167E-09;
@@ -9493,8 +9227,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[134][132] = -4.3449789710686E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][133] = -2.4109112310240E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][134] = -4.4194542604006E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[135] =
-      JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  0] =  1.2402668979095E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  1] = -8.3563930114998E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  2] = -7.9257554199516E-10;
@@ -9631,8 +9363,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[135][133] = -2.4309580704407E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][134] =  2.6664046580670E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][135] =  6.7872368179649E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[136] =
-      JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  0] = -1.9599640563515E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  1] = -2.7438735346392E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  2] = -2.3394589145821E-10;
@@ -9770,8 +9500,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[136][134] =  1.8161705130219E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][135] = -4.9119744941988E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][136] = -1.2008192830405E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[137] =
-      JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  0] = -7.2841312562477E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  1] = -5.9592606366023E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  2] = -6.2297037895211E-10;
@@ -9910,8 +9638,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[137][135] = -2.0515319440604E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][136] = -1.5576450005646E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][137] = -5.0363627058153E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[138] =
-      JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  0] = -2.9809587390946E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  1] =  3.1673129553568E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  2] =  7.8038531088905E-11;
@@ -10051,8 +9777,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[138][136] = -1.1452251740399E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][137] =  1.0670081928039E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][138] =  1.3377426059177E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[139] =
-      JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  0] =  4.1245146703809E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  1] = -5.4097670044447E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  2] = -3.7094530779770E-10;
@@ -10193,8 +9917,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[139][137] =  1.1901096882127E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][138] =  5.3799405949876E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][139] = -3.4268815424165E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[140] =
-      JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  0] =  3.5316271217725E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  1] =  9.5639518572261E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  2] =  1.6914957995669E-10;
@@ -10336,8 +10058,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[140][138] =  3.4158849433195E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][139] = -1.3062832425548E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][140] = -1.8689551547835E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[141] =
-      JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  0] =  9.1916961347667E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  1] =  3.3983857542778E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  2] =  8.6146053283253E-10;
@@ -10480,8 +10200,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[141][139] =  1.3981568605456E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][140] =  5.2104311362608E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][141] =  3.0919055144662E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[142] =
-      JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  0] =  3.7913817640495E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  1] =  3.9401639093340E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  2] = -2.4341267262232E-10;
@@ -10625,8 +10343,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[142][140] =  1.2606483820504E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][141] = -4.6570830512457E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][142] =  4.9844379226459E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[143] =
-      JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  0] = -1.0731877319461E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  1] = -8.5749634949480E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  2] = -1.2674160992996E-09;
@@ -10771,8 +10487,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[143][141] = -1.4385857446248E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][142] = -6.2273253828185E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][143] =  2.7814329988072E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[144] =
-      JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  0] = -9.6889465700249E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  1] = -6.0139243778058E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  2] = -7.5385829271178E-10;
@@ -10918,8 +10632,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[144][142] =  2.6573911396478E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][143] =  2.3598187525946E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][144] =  2.9578412270588E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[145] =
-      JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  0] =  1.0178817955669E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  1] = -1.1328381077771E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  2] =  1.1162790473274E-09;
@@ -11066,8 +10778,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[145][143] = -1.7935425213967E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][144] = -8.3524441972645E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][145] = -1.9068841782903E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[146] =
-      JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  0] =  1.2977296170705E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  1] = -4.2042206507429E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  2] =  4.6676063416791E-10;
@@ -11215,8 +10925,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[146][144] =  5.2037023052377E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][145] =  3.3197256138509E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][146] =  4.8487306500695E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[147] =
-      JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  0] = -5.2805026944637E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  1] = -1.7221386006131E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  2] =  6.8254222048985E-10;
@@ -11365,8 +11073,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[147][145] = -1.0258999231070E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][146] =  1.0330688368949E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][147] =  1.4010262581074E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[148] =
-      JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  0] = -1.0188835677451E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  1] =  7.8337422930059E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  2] = -2.0257050485353E-10;
@@ -11516,8 +11222,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[148][146] =  5.5398251390495E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][147] = -7.2040059164945E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][148] = -9.3770188052905E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[149] =
-      JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  0] = -1.0330506482431E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  1] =  4.0764863763797E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  2] =  3.9323351620353E-10;
@@ -11668,8 +11372,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[149][147] = -1.3732542581316E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][148] =  4.4913675239295E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][149] =  1.6092326174142E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[150] =
-      JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  0] =  1.3984656511995E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  1] = -3.8357295316013E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  2] = -5.8915241919236E-10;
@@ -11821,8 +11523,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[150][148] =  3.3904847717287E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][149] =  1.3511123663301E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][150] = -7.6573361561357E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[151] =
-      JEOD_ALLOC_PRIM_ARRAY (152, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[151][  0] =  4.4015172247318E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][  1] =  6.7770669727294E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][  2] = -5.6949426550292E-10;
@@ -11975,8 +11675,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[151][149] =  9.1657767284034E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][150] = -4.5493871962348E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[151][151] =  1.6041496979523E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[152] =
-      JEOD_ALLOC_PRIM_ARRAY (153, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[152][  0] =  2.8915105244285E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][  1] =  1.0109538480153E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][  2] = -5.3716632047269E-10;
@@ -12130,8 +11828,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[152][150] = -1.7630470023821E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][151] = -3.2521237759774E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[152][152] =  1.2748355154503E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[153] =
-      JEOD_ALLOC_PRIM_ARRAY (154, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[153][  0] =  9.8817013270763E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][  1] =  5.0413479365072E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][  2] = -4.0559025121744E-10;
@@ -12286,8 +11982,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[153][151] = -6.4702637703992E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][152] =  9.8966568969368E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[153][153] = -3.7877847294910E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[154] =
-      JEOD_ALLOC_PRIM_ARRAY (155, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[154][  0] = -2.1012942236910E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][  1] = -1.0939338603911E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][  2] =  5.5820252217491E-10;
@@ -12443,8 +12137,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[154][152] =  3.0148181471015E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][153] = -2.3595080006714E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[154][154] = -3.4670953385448E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[155] =
-      JEOD_ALLOC_PRIM_ARRAY (156, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[155][  0] = -1.0403576089463E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][  1] = -8.7436093954933E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][  2] =  5.6739035769543E-10;
@@ -12601,8 +12293,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[155][153] = -6.1888382177917E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][154] =  3.8868057999140E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[155][155] = -9.8949082503729E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[156] =
-      JEOD_ALLOC_PRIM_ARRAY (157, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[156][  0] = -6.3973593839573E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][  1] =  3.0695242013785E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][  2] =  5.4257843932006E-10;
@@ -12760,8 +12450,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[156][154] =  2.4167886475481E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][155] = -9.3113615348573E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[156][156] =  7.0685602200881E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[157] =
-      JEOD_ALLOC_PRIM_ARRAY (158, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[157][  0] =  3.9839678766116E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][  1] =  1.4976443149718E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][  2] = -7.5753175985356E-11;
@@ -12920,8 +12608,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[157][155] = -5.5177575718982E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][156] = -7.9168699519511E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[157][157] =  6.8918850276426E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[158] =
-      JEOD_ALLOC_PRIM_ARRAY (159, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[158][  0] =  5.3215280414447E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][  1] =  4.0089495967473E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][  2] =  1.2829399684781E-10;
@@ -13081,8 +12767,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[158][156] = -8.1794119483877E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][157] =  5.1322422590048E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[158][158] =  3.8274492080718E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[159] =
-      JEOD_ALLOC_PRIM_ARRAY (160, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[159][  0] = -6.5739261470051E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][  1] = -5.8656185389702E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][  2] = -2.3587505327214E-10;
@@ -13243,8 +12927,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[159][157] =  8.5706046617224E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][158] =  3.7659802138276E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[159][159] = -1.0270264991887E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[160] =
-      JEOD_ALLOC_PRIM_ARRAY (161, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[160][  0] = -2.0190461428499E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][  1] =  6.9279368239876E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][  2] =  5.3144195823310E-10;
@@ -13406,8 +13088,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[160][158] =  2.7277463022881E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][159] = -4.5511303785787E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[160][160] =  2.4704251209145E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[161] =
-      JEOD_ALLOC_PRIM_ARRAY (162, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[161][  0] =  4.0768462037893E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][  1] =  5.0075367741897E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][  2] =  1.7369996653158E-10;
@@ -13570,8 +13250,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[161][159] = -5.8678560882243E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][160] = -2.5990015640847E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[161][161] =  6.7481858500498E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[162] =
-      JEOD_ALLOC_PRIM_ARRAY (163, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[162][  0] =  1.1653849263275E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][  1] = -1.3592456761116E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][  2] = -9.7836408904813E-10;
@@ -13735,8 +13413,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[162][160] = -1.9151139956274E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][161] = -2.9364285653750E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[162][162] = -1.4268609043195E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[163] =
-      JEOD_ALLOC_PRIM_ARRAY (164, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[163][  0] = -6.9976060463612E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][  1] = -6.3224866278049E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][  2] = -2.0598635087835E-10;
@@ -13901,8 +13577,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[163][161] = -3.3682586372167E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][162] = -4.7628307808599E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[163][163] = -1.1275641078644E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[164] =
-      JEOD_ALLOC_PRIM_ARRAY (165, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[164][  0] = -1.6120437788114E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][  1] =  4.8054746931663E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][  2] = -2.6427256348006E-10;
@@ -14068,8 +13742,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[164][162] =  2.5949663832088E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][163] =  5.0888523325010E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[164][164] = -3.3186587415825E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[165] =
-      JEOD_ALLOC_PRIM_ARRAY (166, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[165][  0] = -2.3458390151423E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][  1] = -2.4319726798508E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][  2] =  3.9054639548735E-10;
@@ -14236,8 +13908,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[165][163] =  1.1757240292917E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][164] =  4.4486147171931E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[165][165] =  7.5641460955293E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[166] =
-      JEOD_ALLOC_PRIM_ARRAY (167, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[166][  0] = -4.5851647405025E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][  1] =  1.4918071230197E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][  2] =  4.3428067826703E-10;
@@ -14405,8 +14075,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[166][164] = -7.3045057939640E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][165] = -6.7206585647297E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[166][166] =  1.1081761659088E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[167] =
-      JEOD_ALLOC_PRIM_ARRAY (168, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[167][  0] = -6.4765154675784E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][  1] =  5.3426086715052E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][  2] =  7.9271440262685E-10;
@@ -14575,8 +14243,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[167][165] = -4.7885688099326E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][166] =  3.5992621212191E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[167][167] = -1.0512912069988E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[168] =
-      JEOD_ALLOC_PRIM_ARRAY (169, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[168][  0] =  9.9466899717457E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][  1] =  1.5823334629575E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][  2] = -2.4098342014082E-10;
@@ -14746,8 +14412,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[168][166] =  5.7256573800201E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][167] =  4.6050851456358E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[168][168] = -4.0036515590346E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[169] =
-      JEOD_ALLOC_PRIM_ARRAY (170, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[169][  0] =  6.9019259387603E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][  1] =  2.8949508147128E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][  2] = -4.6617842972559E-10;
@@ -14918,8 +14582,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[169][167] = -2.6736263986853E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][168] =  8.7230083784161E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[169][169] = -3.7454437999683E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[170] =
-      JEOD_ALLOC_PRIM_ARRAY (171, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[170][  0] =  5.2923438625652E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][  1] = -8.1227891297650E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][  2] = -2.3001719911319E-10;
@@ -15091,8 +14753,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[170][168] =  6.2157251470785E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][169] =  1.2256328718841E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[170][170] = -3.7439706100194E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[171] =
-      JEOD_ALLOC_PRIM_ARRAY (172, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[171][  0] = -4.2078839698160E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][  1] =  3.9386606525162E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][  2] =  2.2222179529937E-10;
@@ -15265,8 +14925,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[171][169] = -2.7689250372885E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][170] = -3.6178916742543E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[171][171] = -1.3037077398835E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[172] =
-      JEOD_ALLOC_PRIM_ARRAY (173, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[172][  0] =  8.3991253630592E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][  1] =  3.1230459834118E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][  2] =  5.2884660034582E-10;
@@ -15440,8 +15098,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[172][170] = -7.5847416861205E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][171] = -9.7603906093005E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[172][172] = -5.2370612188694E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[173] =
-      JEOD_ALLOC_PRIM_ARRAY (174, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[173][  0] = -1.7548868471845E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][  1] =  9.8584818761790E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][  2] = -4.8017929260082E-10;
@@ -15616,8 +15272,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[173][171] = -1.0707371464520E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][172] =  5.6634601725524E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[173][173] = -3.6875214631515E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[174] =
-      JEOD_ALLOC_PRIM_ARRAY (175, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[174][  0] = -4.3510057395001E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][  1] = -8.8263963706420E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][  2] = -7.7457093232961E-12;
@@ -15793,8 +15447,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[174][172] =  3.9222535716738E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][173] = -5.8219954732855E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[174][174] =  9.1700908606689E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[175] =
-      JEOD_ALLOC_PRIM_ARRAY (176, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[175][  0] = -7.8288526655013E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][  1] = -4.1529099978049E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][  2] = -1.4859952485729E-10;
@@ -15971,8 +15623,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[175][173] =  5.6909265454419E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][174] = -6.3145281667535E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[175][175] =  7.3591036090696E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[176] =
-      JEOD_ALLOC_PRIM_ARRAY (177, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[176][  0] =  3.1610613242577E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][  1] = -1.9933267955271E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][  2] =  4.4347423797530E-10;
@@ -16150,8 +15800,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[176][174] =  4.3718946703058E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][175] =  1.1677646160797E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[176][176] = -2.2227686969612E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[177] =
-      JEOD_ALLOC_PRIM_ARRAY (178, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[177][  0] =  2.6904779196049E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][  1] =  1.6779882910538E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][  2] = -5.1535686890808E-11;
@@ -16330,8 +15978,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[177][175] = -1.4395466532989E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][176] = -3.8997928887412E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[177][177] = -1.8309842421270E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[178] =
-      JEOD_ALLOC_PRIM_ARRAY (179, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[178][  0] = -5.1317415608741E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][  1] =  6.7650286401091E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][  2] = -4.8712079937703E-10;
@@ -16511,8 +16157,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[178][176] = -1.0105064516332E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][177] =  4.3823283047795E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[178][178] = -4.6607562342033E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[179] =
-      JEOD_ALLOC_PRIM_ARRAY (180, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[179][  0] = -6.3716901357720E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][  1] =  1.7223436900387E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][  2] =  1.3320660664032E-10;
@@ -16693,8 +16337,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[179][177] =  3.9770620187543E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][178] = -2.5956229006406E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[179][179] = -3.7251467313157E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[180] =
-      JEOD_ALLOC_PRIM_ARRAY (181, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[180][  0] =  1.8425542941427E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][  1] =  3.9518229440827E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][  2] = -2.0266272266092E-10;
@@ -16876,8 +16518,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[180][178] = -2.8518800696474E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][179] = -3.2119815013233E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[180][180] = -2.2424450063141E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[181] =
-      JEOD_ALLOC_PRIM_ARRAY (182, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[181][  0] = -2.7052217502494E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][  1] = -8.8585396058117E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][  2] =  9.3119737276870E-11;
@@ -17060,8 +16700,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[181][179] = -4.8367234486529E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][180] =  7.4785239562042E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[181][181] = -4.1121236798159E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[182] =
-      JEOD_ALLOC_PRIM_ARRAY (183, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[182][  0] = -4.1233491729380E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][  1] = -2.1075719557216E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][  2] = -3.5739335472493E-11;
@@ -17245,8 +16883,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[182][180] =  7.7677103534400E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][181] = -6.5708601272436E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[182][182] = -6.0159126661977E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[183] =
-      JEOD_ALLOC_PRIM_ARRAY (184, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[183][  0] = -4.3235093465985E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][  1] =  4.8360990823689E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][  2] = -3.6080890309627E-10;
@@ -17431,8 +17067,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[183][181] = -3.7933171096183E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][182] = -5.0100863633137E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[183][183] =  3.7224853238664E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[184] =
-      JEOD_ALLOC_PRIM_ARRAY (185, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[184][  0] =  3.1956556514186E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][  1] =  6.6142781892330E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][  2] = -3.7149102860007E-10;
@@ -17618,8 +17252,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[184][182] =  5.8788507101655E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][183] = -2.9890077848414E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[184][184] =  2.7326194605600E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[185] =
-      JEOD_ALLOC_PRIM_ARRAY (186, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[185][  0] =  2.7923374483985E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][  1] = -4.5201478879345E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][  2] =  4.9511643684111E-10;
@@ -17806,8 +17438,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[185][183] =  4.0298170687445E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][184] = -3.5047401752773E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[185][185] = -7.4324738068699E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[186] =
-      JEOD_ALLOC_PRIM_ARRAY (187, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[186][  0] =  1.2423364217479E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][  1] =  1.5066399977806E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][  2] =  9.2541698490451E-10;
@@ -17995,8 +17625,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[186][184] = -5.3081596096988E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][185] =  6.3520462934534E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[186][186] =  1.7466529359938E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[187] =
-      JEOD_ALLOC_PRIM_ARRAY (188, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[187][  0] = -7.1411579623574E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][  1] = -7.8645056208466E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][  2] =  9.5114138644046E-11;
@@ -18185,8 +17813,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[187][185] =  5.8218010544506E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][186] = -3.3282305836366E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[187][187] =  1.8995742541329E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[188] =
-      JEOD_ALLOC_PRIM_ARRAY (189, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[188][  0] = -3.0607023534667E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][  1] =  1.1680795312287E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][  2] = -6.9144588033557E-10;
@@ -18376,8 +18002,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[188][186] =  3.2418368251742E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][187] = -5.9930558948610E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[188][188] =  8.4034406643908E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[189] =
-      JEOD_ALLOC_PRIM_ARRAY (190, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[189][  0] = -2.3267791788680E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][  1] = -2.7071427564685E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][  2] = -7.8144523159640E-10;
@@ -18568,8 +18192,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[189][187] = -5.0301572678326E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][188] =  4.7807669617873E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[189][189] =  1.5035694533496E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[190] =
-      JEOD_ALLOC_PRIM_ARRAY (191, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[190][  0] =  4.3071628474513E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][  1] = -3.5893488002661E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][  2] =  1.8168971606514E-10;
@@ -18761,8 +18383,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[190][188] =  1.2632869943890E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][189] =  4.4979263894750E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[190][190] = -6.2879278304100E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[191] =
-      JEOD_ALLOC_PRIM_ARRAY (192, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[191][  0] =  2.2515107038196E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][  1] = -1.3345611165784E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][  2] =  4.9423594347610E-10;
@@ -18955,8 +18575,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[191][189] = -2.4489631298031E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][190] = -3.9862924797398E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[191][191] = -6.5575844726351E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[192] =
-      JEOD_ALLOC_PRIM_ARRAY (193, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[192][  0] = -1.2147433903744E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][  1] =  1.7389000160382E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][  2] =  4.9067237070726E-10;
@@ -19150,8 +18768,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[192][190] = -1.0425318413567E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][191] = -4.9304664924427E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[192][192] =  4.3014777334593E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[193] =
-      JEOD_ALLOC_PRIM_ARRAY (194, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[193][  0] = -6.2010802568110E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][  1] = -5.9515522397483E-14;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][  2] =  3.9577857679035E-10;
@@ -19346,8 +18962,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[193][191] =  1.2025694005819E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][192] = -1.3369821022867E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[193][193] =  2.2585719390185E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[194] =
-      JEOD_ALLOC_PRIM_ARRAY (195, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[194][  0] = -5.8712226495251E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][  1] = -2.1192020390793E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][  2] =  5.2567864987725E-10;
@@ -19543,8 +19157,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[194][192] = -2.9947798618808E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][193] = -4.3205022762520E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[194][194] = -6.8374500716903E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[195] =
-      JEOD_ALLOC_PRIM_ARRAY (196, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[195][  0] = -8.0616350375929E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][  1] = -3.6468964661205E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][  2] = -5.1810377515201E-11;
@@ -19741,8 +19353,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[195][193] = -1.0457091813713E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][194] =  5.9035814745371E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[195][195] =  9.5963629564122E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[196] =
-      JEOD_ALLOC_PRIM_ARRAY (197, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[196][  0] = -1.2510368491974E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][  1] =  2.9791429232103E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][  2] = -4.7366576290633E-10;
@@ -19940,8 +19550,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[196][194] =  3.6009218178799E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][195] = -1.7064604294467E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[196][196] =  1.1139838158671E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[197] =
-      JEOD_ALLOC_PRIM_ARRAY (198, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[197][  0] =  3.4575796144553E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][  1] =  2.3119719388626E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][  2] =  7.8006428565882E-12;
@@ -20140,8 +19748,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[197][195] = -6.0652396268279E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][196] = -6.9452845202573E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[197][197] =  4.9109804493397E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[198] =
-      JEOD_ALLOC_PRIM_ARRAY (199, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[198][  0] =  3.2982244094874E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][  1] =  3.6691655717374E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][  2] =  6.7030828157029E-11;
@@ -20341,8 +19947,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[198][196] = -1.8495708759109E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][197] =  2.1761488249003E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[198][198] = -2.4354249499905E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[199] =
-      JEOD_ALLOC_PRIM_ARRAY (200, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[199][  0] = -2.9036910973659E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][  1] =  2.3356331269324E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][  2] =  2.2657518410166E-10;
@@ -20543,8 +20147,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[199][197] =  1.0686933374802E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][198] =  1.3241888580143E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[199][199] = -2.3032028498377E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[200] =
-      JEOD_ALLOC_PRIM_ARRAY (201, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[200][  0] = -1.0614949193200E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][  1] = -3.5086987637891E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][  2] = -7.7757428920288E-11;
@@ -20746,8 +20348,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[200][198] = -5.4422530753386E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][199] =  7.5816625856236E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[200][200] =  5.7648121252962E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[201] =
-      JEOD_ALLOC_PRIM_ARRAY (202, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[201][  0] =  2.2439736596506E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[201][  1] = -3.7000261563378E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[201][  2] =  6.1065922217935E-10;
@@ -20950,8 +20550,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[201][199] =  4.3671119099550E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[201][200] =  5.3134764410148E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[201][201] = -4.4807035596162E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[202] =
-      JEOD_ALLOC_PRIM_ARRAY (203, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[202][  0] = -1.4068633027539E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[202][  1] = -3.3533849800787E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[202][  2] = -1.8655360389552E-10;
@@ -21155,8 +20753,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[202][200] =  3.4737978344750E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[202][201] = -5.8737363450177E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[202][202] =  1.9267517640708E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[203] =
-      JEOD_ALLOC_PRIM_ARRAY (204, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[203][  0] = -2.6722852195025E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[203][  1] =  6.7665398183693E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[203][  2] = -4.3700615225327E-10;
@@ -21361,8 +20957,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[203][201] = -9.4628897129060E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[203][202] =  1.8344611256313E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[203][203] =  2.5155962067743E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[204] =
-      JEOD_ALLOC_PRIM_ARRAY (205, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[204][  0] = -1.2523242732347E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[204][  1] =  6.0676173602333E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[204][  2] = -4.2295906464676E-10;
@@ -21568,8 +21162,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[204][202] = -3.9650653943665E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[204][203] =  5.7259269455244E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[204][204] =  5.1967906097482E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[205] =
-      JEOD_ALLOC_PRIM_ARRAY (206, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[205][  0] =  2.2462411731772E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[205][  1] = -2.5917521067980E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[205][  2] = -1.1408616948857E-10;
@@ -21776,8 +21368,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[205][203] =  3.5290420438554E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[205][204] =  1.7645950782441E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[205][205] =  1.4449351036729E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[206] =
-      JEOD_ALLOC_PRIM_ARRAY (207, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[206][  0] =  1.3771570506165E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[206][  1] = -6.7439629158006E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[206][  2] =  2.8503369052345E-10;
@@ -21985,8 +21575,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[206][204] = -5.6851984686105E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[206][205] = -6.8487016758910E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[206][206] = -2.3388013992739E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[207] =
-      JEOD_ALLOC_PRIM_ARRAY (208, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[207][  0] = -1.5356214831716E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[207][  1] =  1.4577193207451E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[207][  2] = -5.0001611598944E-11;
@@ -22195,8 +21783,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[207][205] =  1.9633825737504E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[207][206] =  5.1330822928128E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[207][207] = -4.0821399161564E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[208] =
-      JEOD_ALLOC_PRIM_ARRAY (209, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[208][  0] = -1.5005773142286E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[208][  1] = -2.5932885887552E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[208][  2] = -4.5286087196219E-10;
@@ -22406,8 +21992,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[208][206] = -3.1088808879237E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[208][207] =  1.8354600605805E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[208][208] =  6.3513217863993E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[209] =
-      JEOD_ALLOC_PRIM_ARRAY (210, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[209][  0] = -2.2193336094252E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[209][  1] = -1.6192229292164E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[209][  2] = -3.3993683426709E-10;
@@ -22618,8 +22202,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[209][207] = -3.1493968885508E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[209][208] =  4.6583983069296E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[209][209] = -2.3068373914137E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[210] =
-      JEOD_ALLOC_PRIM_ARRAY (211, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[210][  0] =  1.7858898328498E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[210][  1] = -1.2266863531748E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[210][  2] = -9.2148688256901E-11;
@@ -22831,8 +22413,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[210][208] =  7.6078498612093E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[210][209] =  2.0773500377586E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[210][210] = -1.1917217633002E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[211] =
-      JEOD_ALLOC_PRIM_ARRAY (212, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[211][  0] =  3.1555231930343E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[211][  1] =  3.7648907387170E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[211][  2] =  1.3706091816171E-10;
@@ -23045,8 +22625,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[211][209] =  2.6493810942949E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[211][210] = -6.8307329838869E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[211][211] = -1.0131378277260E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[212] =
-      JEOD_ALLOC_PRIM_ARRAY (213, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[212][  0] = -2.0887504710002E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[212][  1] =  8.2444745776403E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[212][  2] =  4.1246169551176E-10;
@@ -23260,8 +22838,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[212][210] = -3.1613310331837E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[212][211] =  2.2921654461458E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[212][212] =  5.8635279459898E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[213] =
-      JEOD_ALLOC_PRIM_ARRAY (214, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[213][  0] = -2.5685001787776E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[213][  1] = -3.3071223452540E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[213][  2] = -4.5311451554519E-11;
@@ -23476,8 +23052,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[213][211] =  2.0664343913144E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[213][212] =  4.2206111041594E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[213][213] = -5.6029868105282E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[214] =
-      JEOD_ALLOC_PRIM_ARRAY (215, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[214][  0] =  3.2063141699381E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[214][  1] = -8.7002386761410E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[214][  2] = -1.8748991290063E-10;
@@ -23693,8 +23267,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[214][212] = -6.2112984619009E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[214][213] = -1.1560363799035E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[214][214] =  5.6049936213625E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[215] =
-      JEOD_ALLOC_PRIM_ARRAY (216, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[215][  0] =  2.0458085525329E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[215][  1] = -3.6320492776815E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[215][  2] = -2.4571278147160E-10;
@@ -23911,8 +23483,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[215][213] =  2.5907125291332E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[215][214] = -1.8884182036862E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[215][215] = -6.8728052138355E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[216] =
-      JEOD_ALLOC_PRIM_ARRAY (217, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[216][  0] =  4.5433738758527E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[216][  1] =  8.2177428898851E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[216][  2] =  7.8082705564271E-11;
@@ -24130,8 +23700,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[216][214] =  3.3525997247664E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[216][215] =  1.2282346196120E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[216][216] = -2.1388601799281E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[217] =
-      JEOD_ALLOC_PRIM_ARRAY (218, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[217][  0] =  6.1890283096983E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[217][  1] =  1.4958289609201E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[217][  2] = -6.2166243232973E-12;
@@ -24350,8 +23918,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[217][215] = -1.8129292758718E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[217][216] = -3.7811812121705E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[217][217] = -9.1713630245229E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[218] =
-      JEOD_ALLOC_PRIM_ARRAY (219, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[218][  0] =  2.2178641271914E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[218][  1] =  3.9968598727090E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[218][  2] =  5.6405890555940E-11;
@@ -24571,8 +24137,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[218][216] = -4.7934907253558E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[218][217] = -1.6726196771715E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[218][218] = -2.4943497661728E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[219] =
-      JEOD_ALLOC_PRIM_ARRAY (220, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[219][  0] =  4.5167008910483E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[219][  1] =  8.8061563796612E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[219][  2] =  4.3265015569409E-10;
@@ -24793,8 +24357,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[219][217] =  4.8587786106111E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[219][218] = -1.1327774682121E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[219][219] =  1.8556143987523E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[220] =
-      JEOD_ALLOC_PRIM_ARRAY (221, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[220][  0] = -3.0373121556534E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[220][  1] = -3.9078280277597E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[220][  2] =  2.6165303782170E-10;
@@ -25016,8 +24578,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[220][218] =  3.9355853048341E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[220][219] = -4.2315310466187E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[220][220] = -3.5778019104272E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[221] =
-      JEOD_ALLOC_PRIM_ARRAY (222, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[221][  0] = -1.5994419839878E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[221][  1] = -7.7793262253035E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[221][  2] = -3.9332498085400E-11;
@@ -25240,8 +24800,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[221][219] =  9.4812584950915E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[221][220] =  9.1356371479081E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[221][221] = -1.6435828684844E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[222] =
-      JEOD_ALLOC_PRIM_ARRAY (223, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[222][  0] =  3.6183056723793E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[222][  1] =  2.4377927467376E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[222][  2] = -1.2718094999650E-10;
@@ -25465,8 +25023,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[222][220] = -6.3097273571523E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[222][221] = -6.4254465401564E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[222][222] = -1.5497119804209E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[223] =
-      JEOD_ALLOC_PRIM_ARRAY (224, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[223][  0] =  1.0174090125510E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[223][  1] =  6.7656039188879E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[223][  2] =  3.3814544369233E-11;
@@ -25691,8 +25247,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[223][221] = -6.2086911099062E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[223][222] = -3.2659258034606E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[223][223] =  2.4344525554346E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[224] =
-      JEOD_ALLOC_PRIM_ARRAY (225, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[224][  0] = -2.6984583224478E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[224][  1] = -4.1957215745470E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[224][  2] =  4.9504714564215E-11;
@@ -25918,8 +25472,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[224][222] =  1.6332147663348E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[224][223] =  2.0543490799807E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[224][224] = -2.8352860493867E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[225] =
-      JEOD_ALLOC_PRIM_ARRAY (226, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[225][  0] =  2.6944854079722E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[225][  1] =  5.0227848316339E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[225][  2] = -2.3901506148856E-10;
@@ -26146,8 +25698,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[225][223] =  6.4162727025889E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[225][224] = -2.7475656594214E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[225][225] =  3.1076076816051E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[226] =
-      JEOD_ALLOC_PRIM_ARRAY (227, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[226][  0] =  3.5575692497237E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[226][  1] = -1.8933451708777E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[226][  2] =  2.1480272576952E-10;
@@ -26375,8 +25925,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[226][224] = -5.6142786955260E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[226][225] = -3.3274945253450E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[226][226] =  2.4087441930358E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[227] =
-      JEOD_ALLOC_PRIM_ARRAY (228, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[227][  0] =  1.4272044402418E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[227][  1] = -2.1557441982381E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[227][  2] =  4.0529210483373E-10;
@@ -26605,8 +26153,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[227][225] = -8.4866319272813E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[227][226] = -2.2469464221692E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[227][227] =  1.3785525987627E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[228] =
-      JEOD_ALLOC_PRIM_ARRAY (229, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[228][  0] = -2.2550202443928E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[228][  1] =  9.6117980636815E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[228][  2] = -1.9398982258732E-10;
@@ -26836,8 +26382,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[228][226] = -4.2858284637633E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[228][227] =  8.8706271526784E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[228][228] =  6.8485180483290E-12;
-   SphericalHarmonicsGravitySource_ptr->Cnm[229] =
-      JEOD_ALLOC_PRIM_ARRAY (230, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[229][  0] = -2.7590791266037E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[229][  1] =  1.1707863642081E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[229][  2] = -6.0100558952690E-10;
@@ -27068,8 +26612,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[229][227] =  4.7199384928250E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[229][228] = -2.2233578355911E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[229][229] =  6.8683424323786E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[230] =
-      JEOD_ALLOC_PRIM_ARRAY (231, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[230][  0] = -2.2848474735562E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[230][  1] =  1.3532868430530E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[230][  2] = -1.5015939230849E-10;
@@ -27301,8 +26843,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[230][228] =  3.9946712062082E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[230][229] = -8.7207951922808E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[230][230] = -3.6990664747142E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[231] =
-      JEOD_ALLOC_PRIM_ARRAY (232, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[231][  0] = -2.4891470932920E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[231][  1] = -1.3421661827338E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[231][  2] =  3.7969483460003E-10;
@@ -27535,8 +27075,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[231][229] = -6.1850121328168E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[231][230] = -2.7188739456820E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[231][231] =  1.6053102905127E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[232] =
-      JEOD_ALLOC_PRIM_ARRAY (233, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[232][  0] = -8.3518757392310E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[232][  1] =  1.3042487390586E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[232][  2] =  1.4061832051256E-12;
@@ -27770,8 +27308,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[232][230] =  4.1532113453961E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[232][231] =  2.2055370112099E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[232][232] = -2.6461773481351E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[233] =
-      JEOD_ALLOC_PRIM_ARRAY (234, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[233][  0] = -8.5645030580368E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[233][  1] =  1.4271316778248E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[233][  2] = -6.3924903272948E-11;
@@ -28006,8 +27542,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[233][231] =  7.2767009140910E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[233][232] =  1.6079648305643E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[233][233] =  1.9103170733547E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[234] =
-      JEOD_ALLOC_PRIM_ARRAY (235, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[234][  0] =  1.2898741138300E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[234][  1] = -7.7245227334881E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[234][  2] = -3.7887087126331E-11;
@@ -28243,8 +27777,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[234][232] =  3.0283884986622E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[234][233] =  2.8654539051686E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[234][234] =  4.8817424500495E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[235] =
-      JEOD_ALLOC_PRIM_ARRAY (236, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[235][  0] =  8.7596958124569E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[235][  1] = -4.8328501315027E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[235][  2] = -1.6483477752221E-10;
@@ -28481,8 +28013,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[235][233] = -3.3127693459772E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[235][234] =  2.5586336203026E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[235][235] = -5.0664788564613E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[236] =
-      JEOD_ALLOC_PRIM_ARRAY (237, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[236][  0] =  1.9178405481893E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[236][  1] = -9.6720436840580E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[236][  2] = -1.6748760245435E-10;
@@ -28720,8 +28250,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[236][234] = -4.0792600325380E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[236][235] = -4.6769391725776E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[236][236] =  2.9085280624498E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[237] =
-      JEOD_ALLOC_PRIM_ARRAY (238, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[237][  0] =  3.9686043854970E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[237][  1] = -1.4696184158668E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[237][  2] = -3.1462058100176E-11;
@@ -28960,8 +28488,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[237][235] = -1.2554181748242E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[237][236] =  1.7919694738827E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[237][237] =  5.9348946526598E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[238] =
-      JEOD_ALLOC_PRIM_ARRAY (239, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[238][  0] = -3.5953814152002E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[238][  1] =  9.1752480284141E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[238][  2] =  1.9813611191446E-10;
@@ -29201,8 +28727,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[238][236] =  1.2738005910945E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[238][237] =  1.3136146263733E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[238][238] = -1.3332789638298E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[239] =
-      JEOD_ALLOC_PRIM_ARRAY (240, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[239][  0] = -3.1192900730490E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[239][  1] =  4.1111505806816E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[239][  2] =  1.7343006511260E-10;
@@ -29443,8 +28967,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[239][237] =  7.3028820678260E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[239][238] = -6.3075104691865E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[239][239] = -2.3912236974349E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[240] =
-      JEOD_ALLOC_PRIM_ARRAY (241, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[240][  0] =  2.9949301030957E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[240][  1] =  4.8362181630283E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[240][  2] = -4.2691839624930E-11;
@@ -29686,8 +29208,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[240][238] =  1.6642854237032E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[240][239] =  1.3072738854366E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[240][240] = -3.5961472578892E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[241] =
-      JEOD_ALLOC_PRIM_ARRAY (242, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[241][  0] =  3.3075436157634E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[241][  1] = -2.3120475484889E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[241][  2] =  1.7436824896600E-10;
@@ -29930,8 +29450,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[241][239] = -1.6564494031280E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[241][240] = -5.4828579955864E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[241][241] = -6.2091094616053E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[242] =
-      JEOD_ALLOC_PRIM_ARRAY (243, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[242][  0] =  3.8996283057976E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[242][  1] = -2.0079078898335E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[242][  2] =  1.9813200165936E-10;
@@ -30175,8 +29693,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[242][240] = -3.3966358336162E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[242][241] =  2.1340438807949E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[242][242] = -6.8951201835624E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[243] =
-      JEOD_ALLOC_PRIM_ARRAY (244, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[243][  0] = -4.6498650178975E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[243][  1] =  2.3483242257075E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[243][  2] = -2.1397987760443E-10;
@@ -30421,8 +29937,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[243][241] = -1.8265271156621E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[243][242] =  3.9635846758963E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[243][243] =  4.5639322289391E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[244] =
-      JEOD_ALLOC_PRIM_ARRAY (245, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[244][  0] =  5.2907770298247E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[244][  1] =  2.1286425410198E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[244][  2] = -2.0723318624413E-10;
@@ -30668,8 +30182,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[244][242] =  2.2045908859167E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[244][243] =  1.3908492129469E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[244][244] = -1.7837584194799E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[245] =
-      JEOD_ALLOC_PRIM_ARRAY (246, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[245][  0] =  1.2573717509361E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[245][  1] =  2.0175952319366E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[245][  2] = -8.8883979807186E-12;
@@ -30916,8 +30428,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[245][243] = -2.4936969377612E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[245][244] = -1.5799927042789E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[245][245] =  2.6426755124748E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[246] =
-      JEOD_ALLOC_PRIM_ARRAY (247, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[246][  0] = -1.3075564147162E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[246][  1] = -1.4741086530299E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[246][  2] =  6.2452394005584E-11;
@@ -31165,8 +30675,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[246][244] =  1.5449259490220E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[246][245] = -2.6646681549591E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[246][246] =  1.5612884962158E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[247] =
-      JEOD_ALLOC_PRIM_ARRAY (248, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[247][  0] = -1.2947646504356E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[247][  1] = -1.7436513450075E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[247][  2] = -5.0216494248064E-12;
@@ -31415,8 +30923,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[247][245] = -8.5963976504679E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[247][246] =  3.6396088958812E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[247][247] = -9.0367927038508E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[248] =
-      JEOD_ALLOC_PRIM_ARRAY (249, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[248][  0] =  1.4012253504357E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[248][  1] = -2.0631305216033E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[248][  2] =  1.5618253367317E-10;
@@ -31666,8 +31172,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[248][246] =  3.4854544786056E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[248][247] =  3.0346075644015E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[248][248] = -9.4333610694142E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[249] =
-      JEOD_ALLOC_PRIM_ARRAY (250, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[249][  0] =  8.1971285812594E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[249][  1] =  1.9060052803272E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[249][  2] =  1.7850181014424E-10;
@@ -31918,8 +31422,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[249][247] =  1.0791342772160E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[249][248] =  4.6786224726136E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[249][249] = -3.7419615834443E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[250] =
-      JEOD_ALLOC_PRIM_ARRAY (251, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[250][  0] = -6.7062052979678E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[250][  1] =  2.5964726131594E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[250][  2] = -9.4182720889594E-11;
@@ -32171,8 +31673,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[250][248] = -1.0569140432785E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[250][249] = -7.4674876893420E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[250][250] = -4.1609178283078E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[251] =
-      JEOD_ALLOC_PRIM_ARRAY (252, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[251][  0] = -9.0938350598744E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[251][  1] =  2.1282231869481E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[251][  2] = -2.2953938642914E-10;
@@ -32425,8 +31925,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[251][249] =  2.2376456476937E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[251][250] =  1.2325014704133E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[251][251] =  1.2349892745316E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[252] =
-      JEOD_ALLOC_PRIM_ARRAY (253, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[252][  0] = -1.4860306677660E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[252][  1] =  1.0775056234288E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[252][  2] =  6.8383526381101E-12;
@@ -32680,8 +32178,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[252][250] =  1.9892618301785E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[252][251] =  2.1649911413184E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[252][252] =  4.8306235700346E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[253] =
-      JEOD_ALLOC_PRIM_ARRAY (254, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[253][  0] = -2.5136767926973E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[253][  1] = -2.5361350636461E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[253][  2] =  1.1417248901181E-11;
@@ -32936,8 +32432,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[253][251] = -1.1139008593923E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[253][252] = -1.8080732920354E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[253][253] = -2.4659187529958E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[254] =
-      JEOD_ALLOC_PRIM_ARRAY (255, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[254][  0] =  6.3053986649244E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[254][  1] = -8.1284499037254E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[254][  2] = -1.6488671742554E-10;
@@ -33193,8 +32687,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[254][252] =  1.2938785510554E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[254][253] =  1.9988809097170E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[254][254] = -6.4123877863222E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[255] =
-      JEOD_ALLOC_PRIM_ARRAY (256, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[255][  0] =  1.4304967027919E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[255][  1] =  1.4870132716645E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[255][  2] =  3.3335679232927E-11;
@@ -33451,8 +32943,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[255][253] = -1.2103714202710E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[255][254] = -3.4898915302213E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[255][255] =  1.2512986814847E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[256] =
-      JEOD_ALLOC_PRIM_ARRAY (257, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[256][  0] =  2.5506102745472E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[256][  1] =  6.7752510074996E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[256][  2] = -4.6949172014309E-12;
@@ -33710,8 +33200,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[256][254] =  1.3689116966289E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[256][255] =  1.3750564629926E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[256][256] = -2.1583874833136E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[257] =
-      JEOD_ALLOC_PRIM_ARRAY (258, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[257][  0] =  5.2748114487232E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[257][  1] =  7.2852142407593E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[257][  2] = -6.3590646688522E-11;
@@ -33970,8 +33458,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[257][255] =  5.4916187190830E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[257][256] =  1.8539301048152E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[257][257] =  1.0866122124491E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[258] =
-      JEOD_ALLOC_PRIM_ARRAY (259, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[258][  0] = -2.8364436709453E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[258][  1] = -2.3292758129327E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[258][  2] =  1.4500498243381E-10;
@@ -34231,8 +33717,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[258][256] =  9.8265378604117E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[258][257] = -2.3183075206503E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[258][258] =  6.7313845262825E-12;
-   SphericalHarmonicsGravitySource_ptr->Cnm[259] =
-      JEOD_ALLOC_PRIM_ARRAY (260, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[259][  0] = -2.9046367378038E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[259][  1] =  1.0476682564790E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[259][  2] =  2.4910299296483E-10;
@@ -34493,8 +33977,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[259][257] =  1.0888928081554E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[259][258] =  1.7798800449110E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[259][259] = -3.6868264937775E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[260] =
-      JEOD_ALLOC_PRIM_ARRAY (261, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[260][  0] = -1.9792037911048E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[260][  1] = -1.4306831677882E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[260][  2] = -1.7505625896017E-10;
@@ -34756,8 +34238,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[260][258] = -2.9095758223525E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[260][259] = -1.2209154660156E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[260][260] =  7.9668196513783E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[261] =
-      JEOD_ALLOC_PRIM_ARRAY (262, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[261][  0] =  4.7458524871051E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[261][  1] = -1.6773858475752E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[261][  2] = -3.3161279756981E-10;
@@ -35020,8 +34500,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[261][259] =  1.9065534184929E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[261][260] = -1.3213416251951E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[261][261] =  2.9065015599930E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[262] =
-      JEOD_ALLOC_PRIM_ARRAY (263, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[262][  0] =  1.7002619538789E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[262][  1] =  9.1382149782157E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[262][  2] =  7.4453839103628E-11;
@@ -35285,8 +34763,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[262][260] = -2.2576252043200E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[262][261] = -8.6151821445968E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[262][262] = -9.0153590695401E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[263] =
-      JEOD_ALLOC_PRIM_ARRAY (264, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[263][  0] =  1.7042010078847E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[263][  1] =  1.0687997012024E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[263][  2] =  1.0447057886360E-10;
@@ -35551,8 +35027,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[263][261] = -1.9759403431365E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[263][262] =  7.6680606098291E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[263][263] =  3.1990465533889E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[264] =
-      JEOD_ALLOC_PRIM_ARRAY (265, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[264][  0] = -1.1711922859258E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[264][  1] =  4.2119710286204E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[264][  2] = -3.8023161983862E-11;
@@ -35818,8 +35292,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[264][262] =  6.8746454459782E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[264][263] = -1.8935004224870E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[264][264] =  9.1833147098661E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[265] =
-      JEOD_ALLOC_PRIM_ARRAY (266, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[265][  0] = -3.0446291791061E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[265][  1] =  3.1606417421717E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[265][  2] = -8.5156214547817E-11;
@@ -36086,8 +35558,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[265][263] = -1.4482979772097E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[265][264] = -1.0286496054004E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[265][265] = -8.8858345811849E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[266] =
-      JEOD_ALLOC_PRIM_ARRAY (267, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[266][  0] = -5.6024894110115E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[266][  1] =  8.3379545331318E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[266][  2] = -1.9858939389626E-11;
@@ -36355,8 +35825,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[266][264] =  9.1737552933492E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[266][265] =  3.1704286303391E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[266][266] =  1.7648868077422E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[267] =
-      JEOD_ALLOC_PRIM_ARRAY (268, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[267][  0] =  2.4738787139947E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[267][  1] = -1.2754089892847E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[267][  2] =  9.2796442088490E-11;
@@ -36625,8 +36093,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[267][265] = -4.2011445456821E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[267][266] =  6.0958934069636E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[267][267] =  1.2228702345363E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[268] =
-      JEOD_ALLOC_PRIM_ARRAY (269, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[268][  0] =  6.4584343869344E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[268][  1] = -1.1884110252512E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[268][  2] = -7.0247261684033E-11;
@@ -36896,8 +36362,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[268][266] = -1.5994786200369E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[268][267] =  5.1845685656921E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[268][268] = -1.5015516322648E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[269] =
-      JEOD_ALLOC_PRIM_ARRAY (270, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[269][  0] = -2.4031145657632E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[269][  1] =  2.6984949198892E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[269][  2] = -2.7559350446155E-10;
@@ -37168,8 +36632,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[269][267] = -6.7621888366577E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[269][268] = -3.7212980325289E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[269][269] = -1.9613484607478E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[270] =
-      JEOD_ALLOC_PRIM_ARRAY (271, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[270][  0] =  1.0982335382324E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[270][  1] =  2.7749331749533E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[270][  2] = -7.8263679686776E-11;
@@ -37441,8 +36903,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[270][268] =  3.8326910291682E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[270][269] =  7.2826367734264E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[270][270] =  2.2514350469252E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[271] =
-      JEOD_ALLOC_PRIM_ARRAY (272, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[271][  0] =  7.2908283552179E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[271][  1] = -1.9341573801162E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[271][  2] =  2.4015063023475E-10;
@@ -37715,8 +37175,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[271][269] = -2.1569559153829E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[271][270] =  3.1277884657961E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[271][271] = -2.0347531571481E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[272] =
-      JEOD_ALLOC_PRIM_ARRAY (273, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[272][  0] = -2.8094627006348E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[272][  1] = -3.6521142353655E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[272][  2] =  2.2959203738271E-10;
@@ -37990,8 +37448,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[272][270] =  1.5068690385453E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[272][271] = -8.3590168488021E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[272][272] =  1.0706533858149E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[273] =
-      JEOD_ALLOC_PRIM_ARRAY (274, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[273][  0] = -2.2221247953616E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[273][  1] =  3.7011098062320E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[273][  2] = -1.0059761385141E-10;
@@ -38266,8 +37722,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[273][271] =  1.9893350068367E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[273][272] = -4.7208456321033E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[273][273] = -4.8222627563463E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[274] =
-      JEOD_ALLOC_PRIM_ARRAY (275, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[274][  0] =  1.0678837044056E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[274][  1] =  1.9029783909355E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[274][  2] = -1.4470506525406E-10;
@@ -38543,8 +37997,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[274][272] = -4.2839613633487E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[274][273] =  1.8071451442879E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[274][274] =  1.7144099278593E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[275] =
-      JEOD_ALLOC_PRIM_ARRAY (276, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[275][  0] =  1.6176840889965E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[275][  1] = -1.2761181259072E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[275][  2] = -1.8984042462892E-11;
@@ -38821,8 +38273,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[275][273] =  2.9084533222526E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[275][274] =  1.6079851130154E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[275][275] =  3.2864295225652E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[276] =
-      JEOD_ALLOC_PRIM_ARRAY (277, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[276][  0] = -1.1204073664332E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[276][  1] = -2.3647149914682E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[276][  2] = -7.7830544148076E-11;
@@ -39100,8 +38550,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[276][274] =  3.0764370173484E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[276][275] = -5.8552350461028E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[276][276] = -1.4186176624981E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[277] =
-      JEOD_ALLOC_PRIM_ARRAY (278, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[277][  0] = -6.0951863420880E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[277][  1] =  1.5336147258330E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[277][  2] =  6.6617209692546E-11;
@@ -39380,8 +38828,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[277][275] = -1.0120977902189E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[277][276] = -1.3483430096784E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[277][277] = -1.0132935859104E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[278] =
-      JEOD_ALLOC_PRIM_ARRAY (279, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[278][  0] = -2.5412213971242E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[278][  1] =  3.2721816463966E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[278][  2] =  2.0047727307098E-10;
@@ -39661,8 +39107,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[278][276] =  2.6282336596873E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[278][277] =  6.8027520473707E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[278][278] = -2.4180073129580E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[279] =
-      JEOD_ALLOC_PRIM_ARRAY (280, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[279][  0] = -2.2818420934584E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[279][  1] = -9.0695962811066E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[279][  2] =  2.0027725377488E-10;
@@ -39943,8 +39387,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[279][277] = -3.2063568391071E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[279][278] = -1.2217036586518E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[279][279] = -9.3978656206333E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[280] =
-      JEOD_ALLOC_PRIM_ARRAY (281, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[280][  0] = -1.0343093802058E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[280][  1] = -2.7280826656622E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[280][  2] = -9.7234688961143E-11;
@@ -40226,8 +39668,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[280][278] =  3.7007946245247E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[280][279] = -9.2915873831693E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[280][280] =  2.3810401102024E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[281] =
-      JEOD_ALLOC_PRIM_ARRAY (282, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[281][  0] =  1.1452038464045E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[281][  1] = -4.3319107945586E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[281][  2] = -2.3775670221692E-10;
@@ -40510,8 +39950,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[281][279] = -5.1659019007339E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[281][280] = -6.6650805138396E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[281][281] = -4.5017499431318E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[282] =
-      JEOD_ALLOC_PRIM_ARRAY (283, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[282][  0] =  2.2090712356031E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[282][  1] =  1.0568107458290E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[282][  2] =  5.5570539032859E-11;
@@ -40795,8 +40233,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[282][280] = -3.6301737801054E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[282][281] =  1.2875165592310E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[282][282] =  1.6424931497975E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[283] =
-      JEOD_ALLOC_PRIM_ARRAY (284, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[283][  0] =  1.0449817928848E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[283][  1] = -1.2789897038170E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[283][  2] =  8.5063756383902E-11;
@@ -41081,8 +40517,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[283][281] =  9.1184054607710E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[283][282] = -6.5886923442557E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[283][283] = -3.5701199924629E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[284] =
-      JEOD_ALLOC_PRIM_ARRAY (285, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[284][  0] = -4.4641883739362E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[284][  1] =  9.5657326192150E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[284][  2] = -7.1737227287608E-11;
@@ -41368,8 +40802,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[284][282] =  1.5288408018837E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[284][283] =  8.9924660880821E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[284][284] = -1.3148259756658E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[285] =
-      JEOD_ALLOC_PRIM_ARRAY (286, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[285][  0] = -1.7396999974624E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[285][  1] =  2.1877864721033E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[285][  2] = -1.2451422531182E-10;
@@ -41656,8 +41088,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[285][283] = -3.9545492073534E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[285][284] = -5.8064492449058E-13;
    SphericalHarmonicsGravitySource_ptr->Cnm[285][285] =  4.1212394293281E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[286] =
-      JEOD_ALLOC_PRIM_ARRAY (287, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[286][  0] =  1.3754191257616E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[286][  1] = -1.4111752113433E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[286][  2] =  1.4317331858590E-10;
@@ -41945,8 +41375,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[286][284] =  1.6508063280414E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[286][285] =  4.9080562157963E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[286][286] = -3.9604374364060E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[287] =
-      JEOD_ALLOC_PRIM_ARRAY (288, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[287][  0] =  1.2252291528595E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[287][  1] = -1.6865518249204E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[287][  2] =  2.0542624460499E-10;
@@ -42235,8 +41663,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[287][285] = -6.4357071690508E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[287][286] =  8.2088423438309E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[287][287] =  9.4151528776316E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[288] =
-      JEOD_ALLOC_PRIM_ARRAY (289, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[288][  0] = -2.3019660575061E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[288][  1] = -9.4381952243401E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[288][  2] = -7.1423345125511E-11;
@@ -42526,8 +41952,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[288][286] = -1.4433667418493E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[288][287] = -1.9363016016881E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[288][288] =  1.2022876882791E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[289] =
-      JEOD_ALLOC_PRIM_ARRAY (290, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[289][  0] = -2.1626509781938E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[289][  1] =  1.4357567272327E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[289][  2] = -1.0375812306989E-10;
@@ -42818,8 +42242,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[289][287] =  2.1776406075577E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[289][288] = -2.4454301478059E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[289][289] =  1.0368894938074E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[290] =
-      JEOD_ALLOC_PRIM_ARRAY (291, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[290][  0] =  1.6472761094418E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[290][  1] =  1.9271330371029E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[290][  2] = -1.8054772277609E-10;
@@ -43111,8 +42533,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[290][288] =  5.2515011231054E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[290][289] = -1.6946356261737E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[290][290] = -2.0947411425242E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[291] =
-      JEOD_ALLOC_PRIM_ARRAY (292, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[291][  0] =  4.7970148071733E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[291][  1] = -2.8338874253831E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[291][  2] = -6.0240051159080E-11;
@@ -43405,8 +42825,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[291][289] = -1.6173959255553E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[291][290] = -1.3819936019197E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[291][291] =  2.5569843980518E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[292] =
-      JEOD_ALLOC_PRIM_ARRAY (293, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[292][  0] = -1.8490923597662E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[292][  1] =  1.4347002122994E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[292][  2] =  1.6279723259770E-10;
@@ -43700,8 +43118,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[292][290] =  2.6219869751217E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[292][291] = -5.0183584650403E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[292][292] =  4.0696100372350E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[293] =
-      JEOD_ALLOC_PRIM_ARRAY (294, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[293][  0] = -1.3649870025816E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[293][  1] =  3.6465075006253E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[293][  2] =  9.8962419246509E-11;
@@ -43996,8 +43412,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[293][291] = -1.9171017115224E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[293][292] =  1.7123692733776E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[293][293] = -1.1829754017345E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[294] =
-      JEOD_ALLOC_PRIM_ARRAY (295, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[294][  0] =  6.2113065391099E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[294][  1] = -5.2548870185103E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[294][  2] = -4.1849707245936E-11;
@@ -44293,8 +43707,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[294][292] =  3.4142562546167E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[294][293] = -5.4571610907566E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[294][294] =  5.3224791842331E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[295] =
-      JEOD_ALLOC_PRIM_ARRAY (296, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[295][  0] =  1.3605978514615E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[295][  1] =  1.1904237311879E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[295][  2] = -2.2559551136940E-11;
@@ -44591,8 +44003,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[295][293] =  2.2391774420683E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[295][294] =  1.6084093387077E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[295][295] = -1.7544766351674E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[296] =
-      JEOD_ALLOC_PRIM_ARRAY (297, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[296][  0] =  1.9693554645750E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[296][  1] =  2.5237074800563E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[296][  2] =  9.3492480035523E-11;
@@ -44890,8 +44300,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[296][294] = -1.7268054873947E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[296][295] =  2.3455819267406E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[296][296] =  1.2100008680335E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[297] =
-      JEOD_ALLOC_PRIM_ARRAY (298, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[297][  0] = -3.5869966500603E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[297][  1] =  3.4019615117922E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[297][  2] = -8.2444973374643E-11;
@@ -45190,8 +44598,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[297][295] = -2.8933034731146E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[297][296] =  4.5784329334470E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[297][297] =  7.5504434706152E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[298] =
-      JEOD_ALLOC_PRIM_ARRAY (299, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[298][  0] = -1.8387837520968E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[298][  1] = -7.7728499279399E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[298][  2] = -6.5541449398791E-11;
@@ -45491,8 +44897,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[298][296] =  5.7153176699411E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[298][297] =  1.1689082781892E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[298][298] = -9.4131210112369E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[299] =
-      JEOD_ALLOC_PRIM_ARRAY (300, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[299][  0] = -1.1162210898007E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[299][  1] = -9.2992351479418E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[299][  2] =  4.0188786807213E-11;
@@ -45793,8 +45197,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[299][297] =  3.6058831014572E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[299][298] = -1.5684358467873E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[299][299] = -1.4395373647421E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[300] =
-      JEOD_ALLOC_PRIM_ARRAY (301, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[300][  0] =  7.1797168288801E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[300][  1] =  1.1421039763619E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[300][  2] = -8.5814295063854E-12;
@@ -46096,8 +45498,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[300][298] =  1.7952114387551E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[300][299] = -2.1098954635786E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[300][300] = -6.7673822680532E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[301] =
-      JEOD_ALLOC_PRIM_ARRAY (302, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[301][  0] =  1.7595660257718E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[301][  1] = -2.3994867123086E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[301][  2] =  8.0421058540455E-11;
@@ -46400,8 +45800,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[301][299] =  1.0909969282798E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[301][300] = -1.0246770025826E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[301][301] =  7.5914868577131E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[302] =
-      JEOD_ALLOC_PRIM_ARRAY (303, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[302][  0] =  9.7380194971185E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[302][  1] =  1.5583872842349E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[302][  2] =  1.1392508635680E-10;
@@ -46705,8 +46103,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[302][300] = -1.4399613760963E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[302][301] = -9.5657214194057E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[302][302] =  1.2349388985575E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[303] =
-      JEOD_ALLOC_PRIM_ARRAY (304, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[303][  0] =  4.9722783859051E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[303][  1] =  1.1226150111390E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[303][  2] =  4.5381394595707E-11;
@@ -47011,8 +46407,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[303][301] =  2.1487091919279E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[303][302] =  1.9731647615116E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[303][303] =  1.0146030858247E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[304] =
-      JEOD_ALLOC_PRIM_ARRAY (305, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[304][  0] = -2.7342133937581E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[304][  1] =  1.7414750675349E-13;
    SphericalHarmonicsGravitySource_ptr->Cnm[304][  2] = -7.3832489778345E-11;
@@ -47318,8 +46712,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[304][302] = -7.7201321988353E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[304][303] = -2.3471428637372E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[304][304] =  5.4032346765377E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[305] =
-      JEOD_ALLOC_PRIM_ARRAY (306, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[305][  0] = -6.3490362132636E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[305][  1] = -2.8756782835946E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[305][  2] = -7.6656495428012E-11;
@@ -47626,8 +47018,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[305][303] = -1.0963044566633E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[305][304] =  2.2940358230468E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[305][305] = -1.0219463483637E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[306] =
-      JEOD_ALLOC_PRIM_ARRAY (307, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[306][  0] =  3.3681379228195E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[306][  1] =  1.2868975355515E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[306][  2] =  3.1213707450913E-11;
@@ -47935,8 +47325,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[306][304] =  6.5266373691338E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[306][305] = -5.6739360196444E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[306][306] =  2.7064672637742E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[307] =
-      JEOD_ALLOC_PRIM_ARRAY (308, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[307][  0] =  8.8441925538807E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[307][  1] =  8.5430347045601E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[307][  2] =  9.0739581364935E-11;
@@ -48245,8 +47633,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[307][305] =  1.1854344584466E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[307][306] = -2.0680006925962E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[307][307] = -6.0324945478491E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[308] =
-      JEOD_ALLOC_PRIM_ARRAY (309, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[308][  0] = -1.9025798258564E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[308][  1] = -2.0489267040873E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[308][  2] = -5.1468939954598E-12;
@@ -48556,8 +47942,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[308][306] = -7.9388669176220E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[308][307] =  1.4561261330385E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[308][308] = -1.0628637226566E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[309] =
-      JEOD_ALLOC_PRIM_ARRAY (310, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[309][  0] = -5.0958473587911E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[309][  1] =  5.0566711004652E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[309][  2] = -6.6387480857708E-11;
@@ -48868,8 +48252,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[309][307] =  1.6466407443451E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[309][308] = -9.9036832119221E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[309][309] = -1.3288805266548E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[310] =
-      JEOD_ALLOC_PRIM_ARRAY (311, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[310][  0] = -3.4408033397388E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[310][  1] =  2.5833991523462E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[310][  2] =  4.1452061091329E-11;
@@ -49181,8 +48563,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[310][308] =  4.7437975290964E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[310][309] = -1.7965241015253E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[310][310] = -6.6961556492525E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[311] =
-      JEOD_ALLOC_PRIM_ARRAY (312, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[311][  0] = -1.2662843761324E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[311][  1] = -4.0372750567264E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[311][  2] = -3.5438316189482E-11;
@@ -49495,8 +48875,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[311][309] = -2.2114367780373E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[311][310] =  2.2474588657870E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[311][311] =  1.6147372959292E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[312] =
-      JEOD_ALLOC_PRIM_ARRAY (313, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[312][  0] =  2.8125315815740E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[312][  1] = -1.7195239338019E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[312][  2] = -1.3705471383832E-10;
@@ -49810,8 +49188,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[312][310] = -7.8049230625476E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[312][311] = -1.9854826521203E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[312][312] = -3.7249435929511E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[313] =
-      JEOD_ALLOC_PRIM_ARRAY (314, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[313][  0] = -2.3425457203851E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[313][  1] =  4.6171598866247E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[313][  2] = -3.1975771117824E-11;
@@ -50126,8 +49502,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[313][311] =  9.1779134805381E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[313][312] = -6.3782812166400E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[313][313] =  3.7410840378773E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[314] =
-      JEOD_ALLOC_PRIM_ARRAY (315, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[314][  0] =  3.3737366621697E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[314][  1] =  1.5931265782235E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[314][  2] =  4.0959133757716E-11;
@@ -50443,8 +49817,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[314][312] =  1.7902800826889E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[314][313] =  4.6006924355355E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[314][314] = -3.9413588600022E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[315] =
-      JEOD_ALLOC_PRIM_ARRAY (316, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[315][  0] = -6.6666815275111E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[315][  1] =  9.2877934516823E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[315][  2] = -1.3066117053067E-11;
@@ -50761,8 +50133,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[315][313] =  2.3281326578346E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[315][314] = -1.8461159624309E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[315][315] =  2.0687562423161E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[316] =
-      JEOD_ALLOC_PRIM_ARRAY (317, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[316][  0] = -1.2189244035123E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[316][  1] = -5.0456845835055E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[316][  2] =  5.2640078706175E-12;
@@ -51080,8 +50450,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[316][314] = -1.7329347789827E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[316][315] = -9.0051014137432E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[316][316] =  8.7310557327499E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[317] =
-      JEOD_ALLOC_PRIM_ARRAY (318, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[317][  0] =  7.0441501955853E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[317][  1] =  7.8637678331764E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[317][  2] =  2.7333412117099E-11;
@@ -51400,8 +50768,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[317][315] = -7.6299143863627E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[317][316] =  2.6730476086422E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[317][317] = -2.1756670127101E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[318] =
-      JEOD_ALLOC_PRIM_ARRAY (319, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[318][  0] =  9.4466755886765E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[318][  1] =  1.1183185836212E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[318][  2] = -2.7879855018511E-12;
@@ -51721,8 +51087,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[318][316] =  1.9320457455019E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[318][317] = -1.2467034663661E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[318][318] = -5.1221135517544E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[319] =
-      JEOD_ALLOC_PRIM_ARRAY (320, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[319][  0] = -7.3347965278509E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[319][  1] = -1.5320628270289E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[319][  2] = -2.3594449682139E-11;
@@ -52043,8 +51407,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[319][317] = -5.9502436633162E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[319][318] =  7.8154489729856E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[319][319] = -1.1104502116346E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[320] =
-      JEOD_ALLOC_PRIM_ARRAY (321, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[320][  0] = -1.4406736249976E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[320][  1] =  8.5683598631104E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[320][  2] = -1.4191405146561E-10;
@@ -52366,8 +51728,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[320][318] =  3.7385526197189E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[320][319] =  9.9996271722094E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[320][320] = -3.6767040088889E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[321] =
-      JEOD_ALLOC_PRIM_ARRAY (322, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[321][  0] =  9.4304773177794E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[321][  1] =  7.0874913040638E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[321][  2] =  1.9971362794073E-11;
@@ -52690,8 +52050,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[321][319] =  5.3741819907898E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[321][320] = -1.2469048077054E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[321][321] =  2.9399534387278E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[322] =
-      JEOD_ALLOC_PRIM_ARRAY (323, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[322][  0] =  1.7787414845843E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[322][  1] = -7.8324597930797E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[322][  2] =  1.2769718211903E-10;
@@ -53015,8 +52373,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[322][320] = -1.0712710436152E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[322][321] =  3.2292514532517E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[322][322] = -1.4782716767919E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[323] =
-      JEOD_ALLOC_PRIM_ARRAY (324, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[323][  0] = -1.1789802724787E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[323][  1] =  7.3881667722877E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[323][  2] =  1.6782194844117E-11;
@@ -53341,8 +52697,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[323][321] = -2.1695262811870E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[323][322] = -2.6934273864159E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[323][323] = -3.3695998808907E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[324] =
-      JEOD_ALLOC_PRIM_ARRAY (325, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[324][  0] = -1.4712194826569E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[324][  1] =  1.0172966880491E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[324][  2] =  7.6672769757322E-11;
@@ -53668,8 +53022,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[324][322] = -1.2700914991101E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[324][323] = -1.0239930629820E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[324][324] =  1.6142152418765E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[325] =
-      JEOD_ALLOC_PRIM_ARRAY (326, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[325][  0] =  1.6986502801072E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[325][  1] = -2.6287308291468E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[325][  2] = -2.6981240978930E-11;
@@ -53996,8 +53348,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[325][323] = -1.2831344984183E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[325][324] = -2.1210672426784E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[325][325] =  2.4891031589816E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[326] =
-      JEOD_ALLOC_PRIM_ARRAY (327, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[326][  0] =  1.2012710862935E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[326][  1] = -1.1114042441562E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[326][  2] = -6.9437142237247E-11;
@@ -54325,8 +53675,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[326][324] = -4.9647052904053E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[326][325] = -3.8221165823537E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[326][326] = -1.2025206766546E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[327] =
-      JEOD_ALLOC_PRIM_ARRAY (328, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[327][  0] = -1.2038085289358E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[327][  1] = -9.5398432247042E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[327][  2] =  1.6941911285154E-11;
@@ -54655,8 +54003,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[327][325] =  1.1486579443128E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[327][326] = -1.1496027751739E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[327][327] =  1.5827907183981E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[328] =
-      JEOD_ALLOC_PRIM_ARRAY (329, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[328][  0] = -1.0893024754893E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[328][  1] =  6.1196436855824E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[328][  2] = -2.5194311411968E-11;
@@ -54986,8 +54332,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[328][326] =  9.5557982525876E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[328][327] = -7.9435784005259E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[328][328] = -7.9692375080649E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[329] =
-      JEOD_ALLOC_PRIM_ARRAY (330, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[329][  0] =  8.2053514069357E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[329][  1] =  1.0347769510952E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[329][  2] = -4.6187237450273E-11;
@@ -55318,8 +54662,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[329][327] =  2.1757551167868E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[329][328] = -1.5631914332131E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[329][329] = -1.1597362612969E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[330] =
-      JEOD_ALLOC_PRIM_ARRAY (331, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[330][  0] =  1.2737897196372E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[330][  1] =  2.0879594700813E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[330][  2] = -2.7779501474472E-11;
@@ -55651,8 +54993,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[330][328] = -2.0184204542660E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[330][329] =  5.0174721792789E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[330][330] =  8.0821824459989E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[331] =
-      JEOD_ALLOC_PRIM_ARRAY (332, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[331][  0] = -1.1818765254185E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[331][  1] = -6.5342150146767E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[331][  2] =  2.5230948732022E-11;
@@ -55985,8 +55325,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[331][329] =  1.1142339919170E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[331][330] =  2.1495281093176E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[331][331] = -2.8120788944249E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[332] =
-      JEOD_ALLOC_PRIM_ARRAY (333, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[332][  0] = -2.9575691125798E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[332][  1] =  2.3859296186695E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[332][  2] =  8.8564941273320E-11;
@@ -56320,8 +55658,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[332][330] =  4.8125440780064E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[332][331] =  1.2518780706734E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[332][332] = -1.0703817620989E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[333] =
-      JEOD_ALLOC_PRIM_ARRAY (334, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[333][  0] =  1.1163415590844E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[333][  1] =  1.2120078072115E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[333][  2] =  1.8019021636583E-11;
@@ -56656,8 +55992,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[333][331] =  3.0559054902072E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[333][332] = -2.2860294290263E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[333][333] =  1.3992899461953E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[334] =
-      JEOD_ALLOC_PRIM_ARRAY (335, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[334][  0] = -3.6574353565922E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[334][  1] = -5.7413457676194E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[334][  2] = -1.1873754889709E-10;
@@ -56993,8 +56327,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[334][332] = -5.7447313433386E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[334][333] =  8.5502145173528E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[334][334] = -1.4011397120462E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[335] =
-      JEOD_ALLOC_PRIM_ARRAY (336, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[335][  0] = -1.1477218556505E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[335][  1] =  5.5604967020010E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[335][  2] = -3.8728011445786E-11;
@@ -57331,8 +56663,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[335][333] = -3.6553400940517E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[335][334] = -1.6963458556043E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[335][335] =  1.1958610266679E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[336] =
-      JEOD_ALLOC_PRIM_ARRAY (337, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[336][  0] =  2.5784976022050E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[336][  1] =  5.7810581860753E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[336][  2] =  2.3430917018735E-11;
@@ -57670,8 +57000,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[336][334] = -1.2042093879248E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[336][335] =  2.6644218552690E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[336][336] =  6.3889338109644E-12;
-   SphericalHarmonicsGravitySource_ptr->Cnm[337] =
-      JEOD_ALLOC_PRIM_ARRAY (338, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[337][  0] =  1.6764299503244E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[337][  1] = -3.2708420827994E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[337][  2] = -4.4255183056257E-11;
@@ -58010,8 +57338,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[337][335] =  1.3096288066268E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[337][336] =  5.4873203681440E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[337][337] = -6.4201670867821E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[338] =
-      JEOD_ALLOC_PRIM_ARRAY (339, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[338][  0] = -3.9399138968643E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[338][  1] =  2.1631452974475E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[338][  2] =  8.5356498258515E-12;
@@ -58351,8 +57677,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[338][336] =  5.8517891479579E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[338][337] = -9.7545747694756E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[338][338] = -1.1902116451850E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[339] =
-      JEOD_ALLOC_PRIM_ARRAY (340, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[339][  0] = -1.0711661439617E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[339][  1] =  1.7204554562149E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[339][  2] =  1.2324334700238E-11;
@@ -58693,8 +58017,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[339][337] = -1.2897767555421E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[339][338] = -9.3483460982849E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[339][339] =  1.3647550152011E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[340] =
-      JEOD_ALLOC_PRIM_ARRAY (341, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[340][  0] =  4.8027595739348E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[340][  1] = -9.8525754306632E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[340][  2] = -7.6837217621915E-11;
@@ -59036,8 +58358,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[340][338] =  3.3344637255909E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[340][339] = -1.1497023637731E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[340][340] = -2.3867185998756E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[341] =
-      JEOD_ALLOC_PRIM_ARRAY (342, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[341][  0] =  8.7939416130075E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[341][  1] = -1.2110766606002E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[341][  2] = -5.6960614123144E-11;
@@ -59380,8 +58700,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[341][339] =  3.1842006878142E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[341][340] =  1.3643734803269E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[341][341] = -1.7817374404453E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[342] =
-      JEOD_ALLOC_PRIM_ARRAY (343, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[342][  0] = -3.7044540080548E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[342][  1] =  3.1265837677907E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[342][  2] =  8.5106058200065E-11;
@@ -59725,8 +59043,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[342][340] =  7.2017602973610E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[342][341] =  1.2591207131773E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[342][342] =  1.5615191033517E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[343] =
-      JEOD_ALLOC_PRIM_ARRAY (344, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[343][  0] = -5.8988110039008E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[343][  1] =  1.2149092703315E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[343][  2] =  4.8839916406124E-11;
@@ -60071,8 +59387,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[343][341] =  1.4153126142459E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[343][342] = -1.4085989899183E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[343][343] = -2.1318462520483E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[344] =
-      JEOD_ALLOC_PRIM_ARRAY (345, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[344][  0] =  6.3705907724653E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[344][  1] = -4.1862536582541E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[344][  2] = -3.1197248984689E-11;
@@ -60418,8 +59732,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[344][342] = -3.0752346743372E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[344][343] =  8.4173228171380E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[344][344] =  3.6884629058246E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[345] =
-      JEOD_ALLOC_PRIM_ARRAY (346, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[345][  0] = -4.9440110397676E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[345][  1] = -5.1455158204273E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[345][  2] =  1.5753083523022E-11;
@@ -60766,8 +60078,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[345][343] = -1.5277427425887E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[345][344] =  1.0468384516423E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[345][345] =  8.7208413656989E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[346] =
-      JEOD_ALLOC_PRIM_ARRAY (347, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[346][  0] = -7.9012738116774E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[346][  1] =  1.5076336516763E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[346][  2] =  2.9401006508600E-11;
@@ -61115,8 +60425,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[346][344] =  1.3820184620885E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[346][345] =  9.0528034665240E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[346][346] = -4.7221687737452E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[347] =
-      JEOD_ALLOC_PRIM_ARRAY (348, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[347][  0] =  1.0116606361594E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[347][  1] =  1.0859244258016E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[347][  2] =  3.2814321920746E-11;
@@ -61465,8 +60773,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[347][345] =  6.9706247662481E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[347][346] = -1.7079444016413E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[347][347] =  1.0925273234900E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[348] =
-      JEOD_ALLOC_PRIM_ARRAY (349, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[348][  0] = -3.5210814531198E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[348][  1] = -1.4286788088199E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[348][  2] = -6.7982394752132E-11;
@@ -61816,8 +61122,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[348][346] = -9.2852331982596E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[348][347] =  9.2865533416541E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[348][348] = -3.2364559742720E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[349] =
-      JEOD_ALLOC_PRIM_ARRAY (350, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[349][  0] = -7.0934845021443E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[349][  1] = -2.8065798553789E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[349][  2] = -2.6365216773982E-11;
@@ -62168,8 +61472,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[349][347] = -1.8714912186698E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[349][348] = -1.3588941091598E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[349][349] = -1.1744593469463E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[350] =
-      JEOD_ALLOC_PRIM_ARRAY (351, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[350][  0] =  4.4510315617241E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[350][  1] =  6.8458482562323E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[350][  2] =  1.2976109508970E-10;
@@ -62521,8 +61823,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[350][348] =  1.3585400993724E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[350][349] =  9.0328909151133E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[350][350] =  8.9672864416495E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[351] =
-      JEOD_ALLOC_PRIM_ARRAY (352, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[351][  0] =  1.0924151013159E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[351][  1] = -2.0735557952914E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[351][  2] =  1.0275041408918E-10;
@@ -62875,8 +62175,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[351][349] =  6.8912838268665E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[351][350] =  8.6724037423061E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[351][351] =  9.9751816345781E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[352] =
-      JEOD_ALLOC_PRIM_ARRAY (353, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[352][  0] = -2.8771351517527E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[352][  1] = -2.9079918716300E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[352][  2] =  1.9394858206636E-11;
@@ -63230,8 +62528,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[352][350] =  5.4162646665320E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[352][351] = -1.7011272864490E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[352][352] =  6.7824203570027E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[353] =
-      JEOD_ALLOC_PRIM_ARRAY (354, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[353][  0] = -9.8733716876435E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[353][  1] = -3.1912056019936E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[353][  2] = -9.9092085401313E-11;
@@ -63586,8 +62882,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[353][351] = -1.4343939705340E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[353][352] =  6.4907457604973E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[353][353] = -5.3653466338667E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[354] =
-      JEOD_ALLOC_PRIM_ARRAY (355, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[354][  0] = -4.0134389277398E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[354][  1] =  7.0526421088188E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[354][  2] = -6.2692653899698E-11;
@@ -63943,8 +63237,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[354][352] = -8.8997115001493E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[354][353] = -3.8364762558153E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[354][354] =  1.3659142876959E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[355] =
-      JEOD_ALLOC_PRIM_ARRAY (356, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[355][  0] =  1.1711555260394E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[355][  1] =  2.1473010172118E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[355][  2] =  1.2431785016353E-10;
@@ -64301,8 +63593,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[355][353] =  1.9612133443936E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[355][354] =  1.3152162705185E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[355][355] = -5.3173720085151E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[356] =
-      JEOD_ALLOC_PRIM_ARRAY (357, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[356][  0] =  8.2422185600721E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[356][  1] = -2.3522963323664E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[356][  2] =  9.8967767296912E-11;
@@ -64660,8 +63950,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[356][354] =  7.9968939050549E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[356][355] =  5.5795416023766E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[356][356] = -7.1880235160060E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[357] =
-      JEOD_ALLOC_PRIM_ARRAY (358, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[357][  0] = -3.6082780517632E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[357][  1] =  8.4857001934583E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[357][  2] = -1.9216138659527E-11;
@@ -65020,8 +64308,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[357][355] = -6.8589188194098E-13;
    SphericalHarmonicsGravitySource_ptr->Cnm[357][356] = -2.2302685410836E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[357][357] = -1.3830797143007E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[358] =
-      JEOD_ALLOC_PRIM_ARRAY (359, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[358][  0] = -4.0959009927159E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[358][  1] = -3.7541102331342E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[358][  2] = -8.6923396521077E-11;
@@ -65381,8 +64667,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[358][356] = -6.0395018729648E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[358][357] = -1.0962159516528E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[358][358] = -5.4437919733500E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[359] =
-      JEOD_ALLOC_PRIM_ARRAY (360, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[359][  0] =  4.7443816430413E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[359][  1] = -3.9183911245145E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[359][  2] = -5.9618414920027E-11;
@@ -65743,8 +65027,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[359][357] = -2.3119190087973E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[359][358] =  7.6740630094095E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[359][359] = -1.0020119126632E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[360] =
-      JEOD_ALLOC_PRIM_ARRAY (361, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[360][  0] =  4.2451366898176E-12;
    SphericalHarmonicsGravitySource_ptr->Cnm[360][  1] =  5.0136742794981E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[360][  2] =  1.5016693376473E-11;
@@ -66106,34 +65388,24 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[360][358] =  1.1363994201934E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[360][359] =  1.5316541151047E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[360][360] =  2.1399295353963E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  1] =  1.4107575094423E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  2] = -1.4002940118364E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  1] =  2.4824063468478E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  2] = -6.1900662463325E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  3] =  1.4144000651650E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  1] = -4.7357697696907E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  2] =  6.6250516574391E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  3] = -2.0095089980582E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  4] =  3.0881857855702E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  1] = -9.4342598600045E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  2] = -3.2334307981429E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  3] = -2.1494236736021E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  4] =  4.9810578844048E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  5] = -6.6935467701596E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  1] =  2.6525683249700E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  2] = -3.7376947326560E-07;
@@ -66141,8 +65413,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  4] = -4.7142652438675E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  5] = -5.3649603802896E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  6] = -2.3738360514414E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  1] =  9.5159759814302E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  2] =  9.3020287728326E-08;
@@ -66151,8 +65421,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  5] =  1.7930957773652E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  6] =  1.5179288962731E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  7] =  2.4103042687242E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  1] =  5.8905000941228E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  2] =  6.5300088951785E-08;
@@ -66162,8 +65430,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  6] =  3.0894511043496E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  7] =  7.4864353638378E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  8] =  1.2054023904735E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  1] =  2.1415689169158E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  2] = -3.1680177946272E-08;
@@ -66174,8 +65440,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  7] = -9.6920684034663E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  8] = -3.0019794719453E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  9] =  9.6876870006845E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  1] = -1.3109438169724E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  2] = -5.1264999905428E-08;
@@ -66187,8 +65451,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  8] = -9.1710645675513E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  9] = -3.7942358311393E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][ 10] = -2.3863826960514E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  1] = -2.7121105832504E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  2] = -9.8987849076262E-08;
@@ -66201,8 +65463,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  9] =  4.2064195059190E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 10] = -1.8419999688055E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 11] = -6.9671495497704E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  1] = -4.3168604684034E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  2] =  3.1099968218994E-08;
@@ -66216,8 +65476,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 10] =  3.0936809180137E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 11] = -6.3885059963508E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 12] = -1.1109999448845E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  1] =  3.8684366394066E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  2] = -6.2686328352880E-08;
@@ -66232,8 +65490,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 11] = -4.8424333300734E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 12] =  8.7939862200887E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 13] =  6.8145551770449E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  1] =  2.8860399962536E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  2] = -4.0619893112795E-09;
@@ -66249,8 +65505,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 12] = -3.1126555464885E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 13] =  4.5149224388329E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 14] = -4.8231460265165E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  1] =  1.0480606070695E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  2] = -3.0297485542396E-08;
@@ -66267,8 +65521,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 13] = -4.5762967740109E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 14] = -2.4394669587604E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 15] = -4.6967927725804E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  1] =  3.3348218189537E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  2] =  2.8024874808743E-08;
@@ -66286,8 +65538,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 14] = -3.8646471154145E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 15] = -3.2771090107583E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 16] =  2.9684454991457E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  1] = -3.1707736966961E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  2] =  6.8136527330434E-09;
@@ -66306,8 +65556,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 15] =  5.2447776036803E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 16] =  3.6072650761386E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 17] = -1.9868515993155E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  1] = -3.9289060077271E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  2] =  1.0828232060742E-08;
@@ -66327,8 +65575,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 16] =  6.5045637273600E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 17] =  4.3827696444088E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 18] = -1.0846176861210E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  1] =  1.1889030831938E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  2] = -2.3688286753299E-09;
@@ -66349,8 +65595,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 17] = -1.5340518451158E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 18] = -9.6933383051159E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 19] =  5.1986709476950E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  1] =  7.0325453549581E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  2] =  1.7184250399618E-08;
@@ -66372,8 +65616,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 18] = -8.8796412312377E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 19] =  1.0921003105454E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 20] = -1.2694254544288E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  1] =  2.8689583824560E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  2] =  4.1779156782583E-09;
@@ -66396,8 +65638,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 19] =  1.6553947890878E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 20] =  1.5920214032405E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 21] = -3.6532609386609E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  1] = -3.8370224806182E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  2] = -1.1611004805905E-09;
@@ -66421,8 +65661,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 20] =  1.9581615480043E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 21] =  2.3968873830724E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 22] =  2.3331734070785E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  1] =  1.6190923255392E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  2] = -4.5872797309044E-09;
@@ -66447,8 +65685,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 21] =  1.1742871162306E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 22] =  4.7299903331964E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 23] = -1.2048203554497E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  1] = -1.5321790404228E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  2] =  1.5158808805763E-08;
@@ -66474,8 +65710,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 22] = -3.9351246179636E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 23] = -8.8222913867378E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 24] = -3.6879251271569E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  1] = -9.1591910382917E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  2] =  9.3446424110781E-09;
@@ -66502,8 +65736,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 23] = -1.2634906183373E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 24] = -8.3961195826167E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 25] =  4.9458725444991E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  1] = -6.6488507418036E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  2] =  1.1507984103609E-08;
@@ -66531,8 +65763,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 24] =  1.4780189905534E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 25] = -5.7883431196292E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 26] =  2.0775943389869E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  1] =  1.5882033275837E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  2] = -6.1952511665068E-10;
@@ -66561,8 +65791,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 25] =  6.0089472677700E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 26] = -2.3865856631535E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 27] =  1.0640723778291E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  1] =  8.7179587366712E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  2] = -8.2532154333356E-09;
@@ -66592,8 +65820,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 26] =  3.8293816571365E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 27] =  1.2072087192128E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 28] =  6.6841724808079E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  1] = -1.3527666135184E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  2] = -2.4449609570504E-09;
@@ -66624,8 +65850,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 27] = -7.1158221302694E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 28] = -5.7416359453068E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 29] = -5.2149334921341E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  1] =  1.0846252751773E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  2] = -1.1719791180744E-09;
@@ -66657,8 +65881,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 28] = -8.0921017658691E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 29] =  1.8762517153367E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 30] =  8.4730337789802E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  1] = -1.8475305247542E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  2] =  5.1148002885335E-09;
@@ -66691,8 +65913,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 29] = -2.3221490667186E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 30] = -8.1340437664764E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 31] = -1.5812936269160E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  1] =  3.5758064730406E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  2] = -2.8729074512674E-09;
@@ -66726,8 +65946,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 30] =  1.3376464736394E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 31] = -2.9216869007198E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 32] =  1.2667697690690E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  1] = -3.8888130488053E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  2] =  2.3233054329425E-09;
@@ -66762,8 +65980,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 31] =  8.5321586938001E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 32] = -4.6959518863903E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 33] =  8.3527932456528E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  1] =  6.5288817009048E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  2] =  7.5418462984822E-09;
@@ -66799,8 +66015,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 32] =  1.8177994239326E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 33] =  4.3003088417464E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 34] =  1.6276729798722E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  1] = -1.0079952408378E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  2] =  7.1179964732901E-09;
@@ -66837,8 +66051,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 33] = -3.1888298136967E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 34] =  2.7920442418879E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 35] = -5.0515581566258E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  1] =  6.4095528360023E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  2] = -2.8764997849300E-09;
@@ -66876,8 +66088,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 34] =  4.1289769528163E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 35] = -1.2613098269986E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 36] = -5.7973642211352E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  1] = -1.2892946365190E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  2] = -1.1627931796042E-08;
@@ -66916,8 +66126,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 35] = -8.8015793707483E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 36] = -4.3928272040947E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 37] = -4.0871541082694E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  1] =  3.1432351001706E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  2] = -1.1908090125400E-09;
@@ -66957,8 +66165,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 36] = -1.2320040932904E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 37] =  2.2826617269883E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 38] = -2.8292996990468E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  1] =  8.3121800988294E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  2] =  7.0763484424313E-09;
@@ -66999,8 +66205,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 37] = -5.0689525563098E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 38] =  7.5513773336040E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 39] =  1.9615334940052E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  1] = -1.1501357239379E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  2] =  4.4550421661524E-10;
@@ -67042,8 +66246,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 38] =  4.1008609211325E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 39] =  3.9626508186719E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 40] =  6.0369006609100E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  1] = -3.2937245969555E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  2] =  3.3514174406058E-09;
@@ -67086,8 +66288,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 39] = -2.6048656372065E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 40] = -4.7799967288536E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 41] =  5.7965339389927E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  1] = -3.7811952039502E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  2] = -2.8846256440416E-09;
@@ -67131,8 +66331,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 40] = -2.8523975971580E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 41] = -4.3737807261540E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 42] =  2.8304573267809E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  1] =  4.1918837960894E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  2] = -1.3476970362532E-09;
@@ -67177,8 +66375,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 41] =  3.1181274315360E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 42] =  3.9590849613788E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 43] = -8.1635961988826E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  1] = -2.1655383214639E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  2] =  3.4391150734306E-09;
@@ -67224,8 +66420,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 42] = -8.8592974230184E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 43] = -3.0157372240613E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 44] = -1.7023859661745E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  1] = -4.6025708013626E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  2] = -3.3052476450659E-09;
@@ -67272,8 +66466,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 43] =  1.0553377908488E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 44] =  3.1140202009549E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 45] =  5.1882487146889E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  1] = -2.2746785047476E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  2] =  3.1489051263401E-09;
@@ -67321,8 +66513,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 44] = -3.0403767081506E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 45] =  4.9755283021297E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 46] = -2.6010574785898E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  1] = -1.2928421458173E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  2] = -2.7325275367772E-09;
@@ -67371,8 +66561,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 45] =  3.4070591632774E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 46] = -4.1864692854720E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 47] = -6.1751813553362E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  1] =  3.4585263018385E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  2] =  2.8939804504765E-09;
@@ -67422,8 +66610,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 46] =  8.8378308417712E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 47] =  3.8984999259505E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 48] = -2.0921851433012E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  1] = -1.9013245450600E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  2] =  9.8943536123049E-10;
@@ -67474,8 +66660,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 47] =  1.3368508175171E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 48] =  8.6177554205654E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 49] =  2.8646340836129E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  1] =  3.0606212168778E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  2] = -1.6326999253365E-09;
@@ -67527,8 +66711,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 48] =  6.9526393098677E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 49] = -4.7941411255653E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 50] =  2.5487785183391E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  1] =  1.1597614617921E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  2] = -2.4740995224218E-09;
@@ -67581,8 +66763,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 49] = -1.9372604793902E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 50] =  5.4876274510422E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 51] =  3.0154469971888E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  1] = -4.6245609130865E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  2] =  1.0362739401147E-09;
@@ -67636,8 +66816,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 50] = -8.7567788679523E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 51] = -1.7315892602078E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 52] = -4.4481743470670E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  1] = -4.6391795532282E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  2] = -2.4329042734694E-09;
@@ -67692,8 +66870,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 51] =  2.9435358687593E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 52] =  5.9397053095952E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 53] =  3.9691751484149E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  1] =  4.1587280393552E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  2] = -3.0602619441944E-10;
@@ -67749,8 +66925,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 52] = -2.6388661780983E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 53] =  3.3746655656015E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 54] =  5.0962818940980E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  1] =  4.6397910144787E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  2] = -2.2429119720090E-09;
@@ -67807,8 +66981,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 53] =  1.4681829571019E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 54] = -6.1860876068598E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 55] = -5.6588292633778E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  1] =  3.6076666153647E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  2] =  5.3807909391221E-09;
@@ -67866,8 +67038,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 54] = -1.9734879777584E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 55] = -3.9402655864977E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 56] = -9.4710827785390E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  1] = -2.6302721530827E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  2] =  1.5408294926338E-09;
@@ -67926,8 +67096,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 55] =  8.7196053749414E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 56] =  3.3572635668226E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 57] = -3.0516743775235E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  1] = -1.2057152522198E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  2] =  5.0347337141233E-09;
@@ -67987,8 +67155,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 56] = -5.5682226671231E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 57] =  8.6209116120881E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 58] =  2.6099250709891E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  1] = -8.0729688338224E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  2] =  8.1850783717013E-10;
@@ -68049,8 +67215,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 57] = -1.9404403403270E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 58] = -2.1963096926031E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 59] =  1.4414363883718E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  1] = -1.3288816389275E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  2] = -1.9019084827464E-09;
@@ -68112,8 +67276,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 58] =  2.5941460177316E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 59] =  8.4696406727188E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 60] =  2.1593103928996E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  1] =  2.7239214809291E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  2] = -1.4350814553624E-09;
@@ -68176,8 +67338,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 59] = -2.1000927577496E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 60] = -3.5832494004412E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 61] =  4.5783639754069E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  1] =  2.8353750947414E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  2] =  6.4610130070153E-09;
@@ -68241,8 +67401,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 60] =  1.9049023490625E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 61] =  3.3494003072553E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 62] =  1.2650844260845E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  1] =  2.5834214047628E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  2] =  5.2736020503369E-10;
@@ -68307,8 +67465,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 61] =  4.1515638907314E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 62] =  9.5632965820698E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 63] = -1.7061847594661E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  1] = -2.1313091786269E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  2] =  4.1505164533693E-09;
@@ -68374,8 +67530,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 62] = -1.1238293655415E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 63] = -5.0875122469899E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 64] = -1.4992603962922E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  1] = -3.7131985539585E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  2] = -6.4538890561673E-10;
@@ -68442,8 +67596,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 63] = -2.9446621384961E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 64] =  3.5670034876243E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 65] =  1.5898140923662E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  1] = -4.8540264785793E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  2] =  8.5533510866455E-10;
@@ -68511,8 +67663,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 64] = -1.8159890777873E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 65] =  3.6020827780181E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 66] = -1.2779325828837E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  1] =  2.0435774735763E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  2] = -4.4144797947818E-09;
@@ -68581,8 +67731,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 65] = -5.8801647002020E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 66] = -5.2116818656177E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 67] =  3.0503994712889E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  1] =  1.9150654793922E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  2] = -6.6652430992774E-10;
@@ -68652,8 +67800,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 66] = -1.2007416450758E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 67] = -6.6537396067407E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 68] =  2.3477375919970E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  1] = -3.4915743107283E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  2] =  9.5586817781495E-10;
@@ -68724,8 +67870,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 67] =  3.2699489302539E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 68] =  8.8106943405788E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 69] = -1.8509477387187E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  1] = -1.9374269920203E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  2] =  2.4074426728445E-09;
@@ -68797,8 +67941,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 68] =  2.0730056089887E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 69] = -9.5405727848114E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 70] = -1.6902356665009E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  1] =  1.3811614340856E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  2] = -2.8104043600671E-09;
@@ -68871,8 +68013,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 69] = -3.9959521211701E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 70] =  9.7626806049627E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 71] = -8.2849252870666E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  1] = -1.3063275360781E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  2] = -4.3579986997242E-10;
@@ -68946,8 +68086,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 70] = -1.0186581258877E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 71] = -1.9782453429608E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 72] =  4.6702233098929E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  1] = -7.2913558322369E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  2] =  1.4450835530557E-11;
@@ -69022,8 +68160,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 71] = -2.5658894593794E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 72] = -1.3492596137678E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 73] =  1.3221879154475E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  1] =  1.4025339363562E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  2] =  1.8699577484000E-09;
@@ -69099,8 +68235,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 72] = -1.3344406004119E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 73] =  3.3840057837084E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 74] = -2.3681044913547E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  1] = -1.6883643097179E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  2] = -2.7629141008078E-09;
@@ -69177,8 +68311,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 73] =  3.2651911085077E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 74] = -7.1788032157125E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 75] =  4.6135515858423E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  1] = -7.6197305431736E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  2] =  1.9427229678420E-09;
@@ -69256,8 +68388,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 74] = -1.9038228292383E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 75] = -7.6378894814953E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 76] =  3.5139768966186E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  1] =  3.7100674172420E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  2] =  2.3020163591556E-09;
@@ -69336,8 +68466,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 75] =  7.8285079431984E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 76] =  7.6734567243037E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 77] = -2.3232839095616E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  1] =  2.0717221058785E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  2] =  6.9937066267882E-10;
@@ -69417,8 +68545,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 76] =  2.2758063972702E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 77] = -2.1189358159609E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 78] = -1.3023390652708E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  1] =  1.2357998333008E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  2] = -5.5723481939874E-10;
@@ -69499,8 +68625,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 77] =  2.3989104909392E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 78] =  5.5005718140250E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 79] =  1.3189801146276E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  1] = -9.6734319709430E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  2] = -1.0969083018718E-09;
@@ -69582,8 +68706,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 78] =  2.5433185836956E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 79] = -6.7645442461669E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 80] = -2.7599277776234E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  1] = -3.6825081449453E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  2] =  3.2385886609867E-10;
@@ -69666,8 +68788,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 79] = -1.1251697091856E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 80] =  4.9671363491473E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 81] =  3.7609212213852E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  1] =  2.9789640213043E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  2] = -2.5831863157070E-09;
@@ -69751,8 +68871,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 80] = -2.1979902694584E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 81] =  5.3015266390466E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 82] =  1.1670500310302E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  1] = -2.3366720211840E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  2] = -1.7875626020084E-09;
@@ -69837,8 +68955,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 81] =  6.6267325714505E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 82] = -1.6075310729644E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 83] = -5.0966371989582E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  1] = -2.9488851965219E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  2] =  7.8503807759908E-10;
@@ -69924,8 +69040,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 82] = -6.4493092264348E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 83] =  2.0688414747540E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 84] =  1.3065092150051E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  1] =  1.8110199580659E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  2] =  1.3924552501388E-09;
@@ -70012,8 +69126,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 83] = -1.1465428116580E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 84] =  1.7395074873715E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 85] =  1.4237592712906E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  1] = -6.6596747123214E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  2] = -2.6025160147853E-09;
@@ -70101,8 +69213,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 84] =  2.0939571578929E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 85] =  1.9664812132319E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 86] = -1.5583278576258E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  1] = -2.5334132759742E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  2] =  9.9730689727978E-10;
@@ -70191,8 +69301,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 85] = -1.4346659037901E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 86] = -3.1990565190754E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 87] =  1.7950425231168E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  1] = -1.5744802481263E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  2] = -5.8132509231496E-10;
@@ -70282,8 +69390,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 86] =  1.1660331602369E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 87] =  2.6521058003922E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 88] = -4.0212692516412E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  1] =  1.7753519119304E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  2] =  1.2078476005271E-12;
@@ -70374,8 +69480,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 87] =  9.4822246587943E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 88] =  1.2660511115378E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 89] = -6.2251565745416E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  1] = -9.8604595046923E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  2] = -2.7989366870340E-10;
@@ -70467,8 +69571,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 88] = -1.4142877393783E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 89] = -1.2081569448954E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 90] =  2.1987701894065E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  1] = -9.7114040586852E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  2] =  7.4194705830970E-10;
@@ -70561,8 +69663,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 89] = -3.5775156045537E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 90] =  4.2097817321873E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 91] = -8.3886000451543E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  1] = -2.5557917805876E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  2] =  4.5783044534234E-10;
@@ -70656,8 +69756,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 90] = -9.3711713974446E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 91] = -2.9417526930503E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 92] = -1.8858789193352E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  1] =  1.4873950607282E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  2] = -3.7558756389590E-10;
@@ -70752,8 +69850,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 91] = -7.1537845542602E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 92] =  1.3618718116537E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 93] =  2.5661958145794E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  1] =  2.2970818517297E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  2] =  1.3544338516628E-10;
@@ -70849,8 +69945,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 92] =  3.7504044216764E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 93] =  1.5321754939242E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 94] = -1.7687092955327E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  1] =  6.2580434411990E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  2] = -2.5312516877776E-10;
@@ -70947,8 +70041,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 93] =  2.0143656484730E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 94] = -1.2047703815836E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 95] = -2.4952215068259E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  1] =  1.6367982930220E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  2] = -6.5142143231966E-11;
@@ -71046,8 +70138,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 94] = -2.4226916160986E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 95] =  3.0883208299958E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 96] =  1.5339454484958E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  1] = -1.1842655246494E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  2] = -1.0172330958268E-09;
@@ -71146,8 +70236,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 95] =  6.8073970977496E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 96] = -4.4514662557863E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 97] = -2.0525702362791E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  1] = -2.5278558909607E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  2] = -5.6722808222723E-10;
@@ -71247,8 +70335,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 96] =  1.7494998000393E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 97] = -2.3716309848306E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 98] =  1.3501616848197E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  1] = -7.1339159533266E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  2] =  2.6087793232291E-10;
@@ -71349,8 +70435,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 97] =  7.5621873257821E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 98] =  3.6204852079110E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 99] =  1.8842366250785E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Snm[100][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  1] =  6.9375296650282E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  2] = -4.8629843926464E-10;
@@ -71452,8 +70536,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 98] =  6.9164110515631E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 99] =  1.3401828134938E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][100] = -1.0357504545033E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Snm[101][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  1] =  1.2850485974912E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  2] = -1.2143885286771E-09;
@@ -71556,8 +70638,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[101][ 99] = -4.8377049583721E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[101][100] = -7.4948808477420E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[101][101] = -2.5593952129854E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Snm[102][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  1] =  1.0472172847951E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  2] =  1.1950000255117E-09;
@@ -71661,8 +70741,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[102][100] = -1.7322471174009E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][101] = -3.5665134397044E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[102][102] = -7.3718970603816E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Snm[103][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  1] = -7.0271452084256E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  2] = -1.2682120701216E-09;
@@ -71767,8 +70845,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[103][101] =  6.9504089210139E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][102] =  4.3960964334516E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][103] =  1.0479455679693E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Snm[104][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  1] = -1.0322118804882E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  2] = -1.3149233081729E-09;
@@ -71874,8 +70950,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[104][102] =  2.4457450358018E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[104][103] = -1.1099451783694E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][104] =  1.5671431627186E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Snm[105][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  1] = -1.5125985672800E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  2] =  1.7765649844147E-09;
@@ -71982,8 +71056,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[105][103] =  1.2410290526621E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][104] =  2.8489301352544E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][105] = -5.0521407413704E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Snm[106][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  1] =  1.6264798114319E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  2] = -4.8403572472861E-10;
@@ -72091,8 +71163,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[106][104] =  1.1316664096405E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[106][105] =  1.0407458959902E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[106][106] = -9.6703259012008E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Snm[107][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  1] =  1.2217496373831E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  2] = -6.9439349696404E-11;
@@ -72201,8 +71271,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[107][105] = -1.7133627888116E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][106] = -2.8656940624122E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][107] = -1.0127252202101E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Snm[108][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  1] =  1.0408685234386E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  2] = -1.1370999134658E-09;
@@ -72312,8 +71380,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[108][106] =  6.6159738712626E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[108][107] =  2.4852532568616E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[108][108] = -6.4398937133376E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Snm[109][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  1] =  1.5568236481087E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  2] =  2.0095793160858E-09;
@@ -72424,8 +71490,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[109][107] =  9.9055994612915E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[109][108] =  5.1383450649410E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[109][109] = -4.6423311263808E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Snm[110][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  1] = -1.1874214513692E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  2] =  1.7651288528722E-09;
@@ -72537,8 +71601,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[110][108] = -6.9399842317738E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[110][109] = -1.8518429307864E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[110][110] =  7.4068532156838E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[111] =
-      JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Snm[111][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[111][  1] = -3.8020280744344E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[111][  2] = -2.4083616141859E-10;
@@ -72651,8 +71713,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[111][109] = -1.2085410727222E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[111][110] =  1.0717585872320E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[111][111] =  1.2337934159375E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[112] =
-      JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Snm[112][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[112][  1] = -1.6070880367333E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[112][  2] = -8.0467491781379E-10;
@@ -72766,8 +71826,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[112][110] = -7.7350405186197E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[112][111] = -6.1788676775368E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[112][112] = -2.0864518015545E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[113] =
-      JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Snm[113][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[113][  1] = -6.6699011186960E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[113][  2] = -8.3878753293700E-10;
@@ -72882,8 +71940,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[113][111] = -4.3133085211168E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[113][112] =  1.2106885510340E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[113][113] =  2.7035741838128E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[114] =
-      JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Snm[114][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[114][  1] =  2.2883118069493E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][  2] =  5.5386490577827E-10;
@@ -72999,8 +72055,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[114][112] =  1.5697370646835E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][113] =  1.1662729282419E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][114] = -3.0743843629879E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[115] =
-      JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Snm[115][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[115][  1] =  6.9417453952232E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[115][  2] =  5.6141496691264E-10;
@@ -73117,8 +72171,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[115][113] = -8.9024284329146E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[115][114] = -1.7633833928505E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[115][115] = -3.6583798575553E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[116] =
-      JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Snm[116][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[116][  1] = -7.2301397115748E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[116][  2] =  1.5490828765855E-10;
@@ -73236,8 +72288,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[116][114] = -2.8978095252531E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][115] = -1.3050579033108E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][116] = -3.7967435616342E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[117] =
-      JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Snm[117][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[117][  1] = -1.8057568153997E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[117][  2] = -1.2982256926141E-10;
@@ -73356,8 +72406,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[117][115] =  1.7676155312054E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[117][116] =  1.2875633139654E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[117][117] =  1.1120162353511E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[118] =
-      JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Snm[118][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[118][  1] =  1.3518098821713E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[118][  2] =  1.0512955279467E-10;
@@ -73477,8 +72525,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[118][116] =  2.2685863021984E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[118][117] =  3.6305224791443E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[118][118] =  1.4238071210059E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[119] =
-      JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Snm[119][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[119][  1] =  8.8591073044838E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[119][  2] = -9.0915638980555E-10;
@@ -73599,8 +72645,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[119][117] =  1.5171612921124E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[119][118] = -7.4209540129470E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[119][119] =  3.3811598658010E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[120] =
-      JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Snm[120][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[120][  1] = -5.7975978721881E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[120][  2] = -5.2534355040166E-11;
@@ -73722,8 +72766,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[120][118] =  1.2972412163575E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[120][119] = -6.7669368616068E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[120][120] = -1.5119788451320E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[121] =
-      JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Snm[121][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[121][  1] = -8.0775805601779E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[121][  2] =  6.5249189237899E-10;
@@ -73846,8 +72888,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[121][119] = -2.7588268626827E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[121][120] = -2.3711986543987E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[121][121] = -1.5229253241609E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[122] =
-      JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Snm[122][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[122][  1] =  1.4419806680910E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[122][  2] =  3.1040739448674E-10;
@@ -73971,8 +73011,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[122][120] = -6.3795527064710E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[122][121] =  8.6338621455729E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[122][122] =  3.7600274943531E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[123] =
-      JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Snm[123][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[123][  1] = -2.4142216701094E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[123][  2] =  4.1992331542874E-10;
@@ -74097,8 +73135,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[123][121] =  1.3911376676095E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][122] =  1.6067502294206E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][123] = -5.6357670544809E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[124] =
-      JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Snm[124][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[124][  1] = -2.1959685043710E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[124][  2] = -3.9277656222302E-10;
@@ -74224,8 +73260,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[124][122] =  6.4424693073404E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[124][123] = -1.2328925579243E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[124][124] =  7.6839876788786E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[125] =
-      JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Snm[125][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[125][  1] = -1.3797642286154E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][  2] =  1.2131290808260E-09;
@@ -74352,8 +73386,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[125][123] =  1.4170062794715E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][124] =  9.4787463819422E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[125][125] =  3.9064803730993E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[126] =
-      JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Snm[126][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[126][  1] = -4.8768707360234E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[126][  2] = -7.5103709321911E-10;
@@ -74481,8 +73513,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[126][124] = -4.7215365299930E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[126][125] = -1.7006360138390E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[126][126] =  9.7541847745050E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[127] =
-      JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Snm[127][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[127][  1] = -3.6466380092061E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[127][  2] =  9.1345770639676E-10;
@@ -74611,8 +73641,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[127][125] = -2.6608801353116E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[127][126] =  6.7030685816816E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[127][127] =  8.8146794663984E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[128] =
-      JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Snm[128][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[128][  1] =  3.2310805229840E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[128][  2] = -3.8220370471628E-10;
@@ -74742,8 +73770,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[128][126] =  4.7680108069045E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[128][127] =  2.2868625113301E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[128][128] =  6.7520018341046E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[129] =
-      JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Snm[129][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[129][  1] =  4.3494723671722E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[129][  2] =  4.8719517122135E-10;
@@ -74874,8 +73900,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[129][127] =  9.4488121280253E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[129][128] = -1.4192714917010E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[129][129] = -1.1431163431748E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[130] =
-      JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Snm[130][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[130][  1] = -1.3685920989251E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[130][  2] =  9.7663878284552E-10;
@@ -75007,8 +74031,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[130][128] = -8.9529284404329E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[130][129] = -3.0073280064429E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[130][130] =  2.9495930713794E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[131] =
-      JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Snm[131][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[131][  1] = -5.2716662826674E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[131][  2] =  4.0679858889937E-10;
@@ -75141,8 +74163,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[131][129] = -6.4041971222650E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[131][130] =  1.8659779017250E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[131][131] =  1.8326785529014E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[132] =
-      JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Snm[132][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[132][  1] = -1.7566319638341E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[132][  2] = -1.4382387892963E-09;
@@ -75276,8 +74296,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[132][130] =  5.6689019425680E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[132][131] = -6.9785444236766E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[132][132] =  3.2403791080292E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[133] =
-      JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Snm[133][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[133][  1] = -2.6696667594174E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[133][  2] = -9.5530827046228E-10;
@@ -75412,8 +74430,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[133][131] = -1.2511911439280E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[133][132] =  1.5873182779250E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[133][133] =  6.6414480249066E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[134] =
-      JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Snm[134][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[134][  1] = -2.9883501490186E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[134][  2] = -5.1622446424807E-10;
@@ -75549,8 +74565,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[134][132] =  1.2329598694988E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[134][133] =  6.7064596267053E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[134][134] = -1.5843784826539E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[135] =
-      JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Snm[135][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[135][  1] =  2.0727479728826E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[135][  2] = -7.1471792407079E-10;
@@ -75687,8 +74701,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[135][133] = -4.2831412394587E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[135][134] = -1.3774215936885E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[135][135] = -3.5974909913376E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[136] =
-      JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Snm[136][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[136][  1] =  1.0027351871247E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[136][  2] =  1.8903739322152E-10;
@@ -75826,8 +74838,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[136][134] = -1.1937971921594E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[136][135] =  9.2309311230945E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[136][136] =  1.4028884398022E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[137] =
-      JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Snm[137][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[137][  1] = -9.7641733436648E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[137][  2] =  3.3549525700394E-10;
@@ -75966,8 +74976,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[137][135] = -1.4485239318279E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[137][136] =  6.9466996657287E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[137][137] = -5.2061355603553E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[138] =
-      JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Snm[138][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[138][  1] = -1.5829716457657E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[138][  2] =  5.3850171342644E-10;
@@ -76107,8 +75115,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[138][136] = -1.5165503813824E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[138][137] = -3.9479181119870E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[138][138] =  4.3706486291793E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[139] =
-      JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Snm[139][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[139][  1] =  5.3698033817171E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[139][  2] = -6.3519239086659E-10;
@@ -76249,8 +75255,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[139][137] = -2.8599876881624E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[139][138] =  6.7613235258159E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[139][139] =  5.5915832605004E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[140] =
-      JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Snm[140][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[140][  1] =  7.4679384935644E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[140][  2] = -3.1892663985395E-10;
@@ -76392,8 +75396,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[140][138] =  1.0267029329808E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[140][139] = -1.5158716042236E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[140][140] =  2.9172856067004E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[141] =
-      JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Snm[141][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[141][  1] =  1.4224919940086E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[141][  2] =  1.2224680248093E-10;
@@ -76536,8 +75538,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[141][139] = -9.7284523915797E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[141][140] = -1.1531504716378E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[141][141] =  1.3513848895160E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[142] =
-      JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Snm[142][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[142][  1] =  1.0205121690711E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[142][  2] =  2.0128285117763E-10;
@@ -76681,8 +75681,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[142][140] =  1.7099348317376E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[142][141] =  1.0864300222625E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[142][142] =  9.0660122958655E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[143] =
-      JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Snm[143][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[143][  1] =  2.9329254068648E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[143][  2] = -6.9613932874469E-10;
@@ -76827,8 +75825,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[143][141] =  3.1666233434663E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[143][142] = -1.5766741469345E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[143][143] = -1.7478191939517E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[144] =
-      JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Snm[144][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[144][  1] = -9.4056884348213E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[144][  2] = -8.5160788074079E-10;
@@ -76974,8 +75970,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[144][142] =  1.0630240600783E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[144][143] = -3.9231322387567E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[144][144] = -2.0605689017235E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[145] =
-      JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Snm[145][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[145][  1] = -5.7881649967288E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[145][  2] =  5.3541537425870E-10;
@@ -77122,8 +76116,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[145][143] = -7.4991417952038E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[145][144] =  1.3313664061970E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[145][145] =  3.0137161818028E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[146] =
-      JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Snm[146][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[146][  1] = -5.2580421379291E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[146][  2] =  1.3392666722855E-09;
@@ -77271,8 +76263,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[146][144] = -7.8592770107333E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[146][145] = -1.0819256416637E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[146][146] = -5.4654289486366E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[147] =
-      JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Snm[147][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[147][  1] =  5.0584870846892E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[147][  2] = -7.2251762161111E-10;
@@ -77421,8 +76411,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[147][145] = -2.8500063993680E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[147][146] =  1.1591704799854E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[147][147] =  7.2564828298899E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[148] =
-      JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Snm[148][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[148][  1] =  2.9215471343020E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[148][  2] = -8.4273073968329E-10;
@@ -77572,8 +76560,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[148][146] =  1.8138329191564E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[148][147] =  9.4419014145031E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[148][148] = -7.4933385947134E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[149] =
-      JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Snm[149][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[149][  1] =  7.8378282248479E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[149][  2] = -1.8461347466854E-10;
@@ -77724,8 +76710,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[149][147] =  1.2545965705034E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[149][148] = -1.0988074513706E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[149][149] = -8.6139541202267E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[150] =
-      JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Snm[150][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[150][  1] =  4.6241621208442E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[150][  2] =  1.4866386908759E-09;
@@ -77877,8 +76861,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[150][148] = -1.2679218945205E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[150][149] = -6.6147753307862E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[150][150] =  1.2658348765971E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[151] =
-      JEOD_ALLOC_PRIM_ARRAY (152, double);
    SphericalHarmonicsGravitySource_ptr->Snm[151][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[151][  1] = -1.8843742141240E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[151][  2] = -5.4400003163246E-10;
@@ -78031,8 +77013,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[151][149] =  4.4904441879310E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[151][150] =  8.7584575546218E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[151][151] = -5.1289351520807E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[152] =
-      JEOD_ALLOC_PRIM_ARRAY (153, double);
    SphericalHarmonicsGravitySource_ptr->Snm[152][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[152][  1] = -8.5959337155413E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[152][  2] = -1.1529431212439E-09;
@@ -78186,8 +77166,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[152][150] =  5.6392572123882E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[152][151] = -3.8126592022695E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[152][152] = -4.4517660552491E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[153] =
-      JEOD_ALLOC_PRIM_ARRAY (154, double);
    SphericalHarmonicsGravitySource_ptr->Snm[153][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[153][  1] =  4.7561327680568E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[153][  2] = -3.8096149908256E-10;
@@ -78342,8 +77320,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[153][151] =  5.5156593739221E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[153][152] =  4.6769917602725E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[153][153] = -5.5362216910350E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[154] =
-      JEOD_ALLOC_PRIM_ARRAY (155, double);
    SphericalHarmonicsGravitySource_ptr->Snm[154][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[154][  1] =  1.1653150582794E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[154][  2] =  4.3929495166076E-10;
@@ -78499,8 +77475,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[154][152] =  6.6807508448927E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[154][153] =  5.0079398827116E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[154][154] = -6.7672428602638E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[155] =
-      JEOD_ALLOC_PRIM_ARRAY (156, double);
    SphericalHarmonicsGravitySource_ptr->Snm[155][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[155][  1] =  4.6973884058712E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[155][  2] =  4.8859218398496E-10;
@@ -78657,8 +77631,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[155][153] = -7.1851529926017E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[155][154] = -8.0949101121661E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[155][155] =  7.0388524388066E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[156] =
-      JEOD_ALLOC_PRIM_ARRAY (157, double);
    SphericalHarmonicsGravitySource_ptr->Snm[156][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[156][  1] = -1.1059839672399E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[156][  2] = -3.0260630053519E-10;
@@ -78816,8 +77788,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[156][154] = -6.5597325922594E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[156][155] =  4.9126401801671E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[156][156] = -5.5743345936825E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[157] =
-      JEOD_ALLOC_PRIM_ARRAY (158, double);
    SphericalHarmonicsGravitySource_ptr->Snm[157][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[157][  1] = -5.7696624453065E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[157][  2] =  7.1503688279432E-10;
@@ -78976,8 +77946,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[157][155] =  8.7390111245055E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[157][156] = -1.3872409016301E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[157][157] = -4.4323811595679E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[158] =
-      JEOD_ALLOC_PRIM_ARRAY (159, double);
    SphericalHarmonicsGravitySource_ptr->Snm[158][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[158][  1] =  1.9560021941924E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[158][  2] =  2.3116748831795E-10;
@@ -79137,8 +78105,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[158][156] =  1.5985924548571E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[158][157] =  2.1391042591969E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[158][158] =  2.2813242532886E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[159] =
-      JEOD_ALLOC_PRIM_ARRAY (160, double);
    SphericalHarmonicsGravitySource_ptr->Snm[159][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[159][  1] =  6.6963978739116E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[159][  2] = -1.2028815745298E-09;
@@ -79299,8 +78265,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[159][157] = -4.9157521307842E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[159][158] =  6.4673212075250E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[159][159] =  8.5432106616891E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[160] =
-      JEOD_ALLOC_PRIM_ARRAY (161, double);
    SphericalHarmonicsGravitySource_ptr->Snm[160][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[160][  1] = -2.4356529575620E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[160][  2] = -2.0114381524826E-10;
@@ -79462,8 +78426,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[160][158] = -4.1591030422563E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[160][159] = -2.4154388360298E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[160][160] = -1.7585097894507E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[161] =
-      JEOD_ALLOC_PRIM_ARRAY (162, double);
    SphericalHarmonicsGravitySource_ptr->Snm[161][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[161][  1] = -1.0699292062599E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[161][  2] =  5.3186306599293E-10;
@@ -79626,8 +78588,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[161][159] = -9.6635600431598E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[161][160] = -1.7723904611632E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[161][161] =  8.2929688935436E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[162] =
-      JEOD_ALLOC_PRIM_ARRAY (163, double);
    SphericalHarmonicsGravitySource_ptr->Snm[162][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[162][  1] =  3.1521120213080E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[162][  2] =  2.8360855340277E-10;
@@ -79791,8 +78751,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[162][160] =  1.6196670411035E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[162][161] =  4.5906907157480E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[162][162] = -6.8546547566641E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[163] =
-      JEOD_ALLOC_PRIM_ARRAY (164, double);
    SphericalHarmonicsGravitySource_ptr->Snm[163][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[163][  1] =  1.5833484020357E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[163][  2] = -3.4772820054236E-10;
@@ -79957,8 +78915,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[163][161] =  6.9334632133737E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[163][162] =  2.0830335018930E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[163][163] =  5.3001105394472E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[164] =
-      JEOD_ALLOC_PRIM_ARRAY (165, double);
    SphericalHarmonicsGravitySource_ptr->Snm[164][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[164][  1] = -8.4876022297270E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[164][  2] =  6.6179962548318E-11;
@@ -80124,8 +79080,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[164][162] = -3.1252083643553E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[164][163] = -1.2672327716032E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[164][164] =  7.3516248387788E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[165] =
-      JEOD_ALLOC_PRIM_ARRAY (166, double);
    SphericalHarmonicsGravitySource_ptr->Snm[165][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[165][  1] =  2.1627542112982E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[165][  2] =  4.4505961139772E-10;
@@ -80292,8 +79246,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[165][163] =  2.7659921062673E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[165][164] = -2.1381620861135E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[165][165] = -5.5521770853556E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[166] =
-      JEOD_ALLOC_PRIM_ARRAY (167, double);
    SphericalHarmonicsGravitySource_ptr->Snm[166][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[166][  1] =  3.3759297818933E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[166][  2] =  4.4700658604823E-10;
@@ -80461,8 +79413,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[166][164] =  4.9857448627154E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[166][165] =  1.0246540741699E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[166][166] =  1.4602976119084E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[167] =
-      JEOD_ALLOC_PRIM_ARRAY (168, double);
    SphericalHarmonicsGravitySource_ptr->Snm[167][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[167][  1] = -7.1902526337486E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[167][  2] =  6.3883141742981E-11;
@@ -80631,8 +79581,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[167][165] = -7.5762160102365E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[167][166] = -9.0123893897888E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[167][167] =  6.0545987321354E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[168] =
-      JEOD_ALLOC_PRIM_ARRAY (169, double);
    SphericalHarmonicsGravitySource_ptr->Snm[168][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[168][  1] = -6.2093272906538E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[168][  2] = -6.7478413200813E-10;
@@ -80802,8 +79750,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[168][166] =  8.1965506215406E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[168][167] =  6.6653553254928E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[168][168] =  3.5648570550797E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[169] =
-      JEOD_ALLOC_PRIM_ARRAY (170, double);
    SphericalHarmonicsGravitySource_ptr->Snm[169][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[169][  1] =  7.1927527375352E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[169][  2] =  2.9767133226450E-10;
@@ -80974,8 +79920,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[169][167] =  1.7141691740230E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[169][168] = -2.5166295129038E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[169][169] =  1.3839837473780E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[170] =
-      JEOD_ALLOC_PRIM_ARRAY (171, double);
    SphericalHarmonicsGravitySource_ptr->Snm[170][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[170][  1] =  2.6795168955631E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[170][  2] =  9.6740099244323E-10;
@@ -81147,8 +80091,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[170][168] = -8.6733412067661E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[170][169] =  1.6453156292368E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[170][170] = -2.7511608759461E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[171] =
-      JEOD_ALLOC_PRIM_ARRAY (172, double);
    SphericalHarmonicsGravitySource_ptr->Snm[171][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[171][  1] = -2.6258445851200E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[171][  2] = -2.8317692234822E-10;
@@ -81321,8 +80263,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[171][169] =  2.2581407821224E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[171][170] =  3.6347870096710E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[171][171] = -9.0047257718598E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[172] =
-      JEOD_ALLOC_PRIM_ARRAY (173, double);
    SphericalHarmonicsGravitySource_ptr->Snm[172][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[172][  1] = -2.2846436772087E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[172][  2] = -3.3421959962371E-10;
@@ -81496,8 +80436,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[172][170] =  3.1516526919263E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[172][171] = -2.3405777071524E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[172][172] = -3.1036804669353E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[173] =
-      JEOD_ALLOC_PRIM_ARRAY (174, double);
    SphericalHarmonicsGravitySource_ptr->Snm[173][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[173][  1] = -2.3312198475632E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[173][  2] = -1.3735737820344E-10;
@@ -81672,8 +80610,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[173][171] =  8.1694187492242E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[173][172] = -5.6800601991299E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[173][173] =  2.3813767809708E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[174] =
-      JEOD_ALLOC_PRIM_ARRAY (175, double);
    SphericalHarmonicsGravitySource_ptr->Snm[174][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[174][  1] = -1.6597759399304E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[174][  2] = -5.6266145051155E-10;
@@ -81849,8 +80785,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[174][172] =  3.2191708871053E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[174][173] =  3.3835304140320E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[174][174] =  1.0610352612399E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[175] =
-      JEOD_ALLOC_PRIM_ARRAY (176, double);
    SphericalHarmonicsGravitySource_ptr->Snm[175][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[175][  1] =  3.8625855889758E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[175][  2] = -1.6117891924748E-10;
@@ -82027,8 +80961,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[175][173] = -8.9397885875440E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[175][174] =  4.3202029371058E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[175][175] =  1.6538304321484E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[176] =
-      JEOD_ALLOC_PRIM_ARRAY (177, double);
    SphericalHarmonicsGravitySource_ptr->Snm[176][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[176][  1] = -3.6437267596852E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[176][  2] =  8.0053908291038E-10;
@@ -82206,8 +81138,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[176][174] = -1.3102354742299E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[176][175] =  5.2935464269575E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[176][176] = -4.2823850322084E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[177] =
-      JEOD_ALLOC_PRIM_ARRAY (178, double);
    SphericalHarmonicsGravitySource_ptr->Snm[177][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[177][  1] = -2.7845542107984E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[177][  2] =  1.2273223625022E-10;
@@ -82386,8 +81316,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[177][175] =  5.3029283945073E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[177][176] = -1.9651874338497E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[177][177] =  2.1780148381370E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[178] =
-      JEOD_ALLOC_PRIM_ARRAY (179, double);
    SphericalHarmonicsGravitySource_ptr->Snm[178][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[178][  1] = -1.1066764613586E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[178][  2] = -2.8267015441875E-10;
@@ -82567,8 +81495,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[178][176] = -3.4992975588391E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[178][177] = -7.6715880698377E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[178][178] =  9.7628934028627E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[179] =
-      JEOD_ALLOC_PRIM_ARRAY (180, double);
    SphericalHarmonicsGravitySource_ptr->Snm[179][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[179][  1] =  5.6853564454641E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[179][  2] = -2.5533232790466E-10;
@@ -82749,8 +81675,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[179][177] =  2.7771364339332E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[179][178] =  4.9054408897696E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[179][179] =  2.1663788559305E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[180] =
-      JEOD_ALLOC_PRIM_ARRAY (181, double);
    SphericalHarmonicsGravitySource_ptr->Snm[180][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[180][  1] =  1.9601272439147E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[180][  2] =  5.5669297057502E-10;
@@ -82932,8 +81856,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[180][178] = -2.0815724065448E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[180][179] = -1.2622783294409E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[180][180] = -5.2336498380552E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[181] =
-      JEOD_ALLOC_PRIM_ARRAY (182, double);
    SphericalHarmonicsGravitySource_ptr->Snm[181][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[181][  1] =  6.5620647820223E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[181][  2] =  4.7345755653041E-10;
@@ -83116,8 +82038,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[181][179] = -4.5494447199817E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[181][180] =  2.6677589748579E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[181][181] = -1.7996582502211E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[182] =
-      JEOD_ALLOC_PRIM_ARRAY (183, double);
    SphericalHarmonicsGravitySource_ptr->Snm[182][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[182][  1] =  1.6117949049740E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[182][  2] = -2.9721116208180E-10;
@@ -83301,8 +82221,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[182][180] =  2.1845566641794E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[182][181] =  6.8139351001018E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[182][182] = -1.0874583581557E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[183] =
-      JEOD_ALLOC_PRIM_ARRAY (184, double);
    SphericalHarmonicsGravitySource_ptr->Snm[183][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[183][  1] = -3.9427223609948E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[183][  2] = -5.7032987316745E-10;
@@ -83487,8 +82405,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[183][181] = -1.1486828116048E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[183][182] = -2.6995004096157E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[183][183] = -2.2188698665356E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[184] =
-      JEOD_ALLOC_PRIM_ARRAY (185, double);
    SphericalHarmonicsGravitySource_ptr->Snm[184][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[184][  1] = -3.1740452710828E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[184][  2] = -4.0499328554859E-10;
@@ -83674,8 +82590,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[184][182] = -7.7514128943656E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[184][183] =  6.6992600420592E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[184][184] =  1.2821707032362E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[185] =
-      JEOD_ALLOC_PRIM_ARRAY (186, double);
    SphericalHarmonicsGravitySource_ptr->Snm[185][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[185][  1] =  4.0587353173661E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[185][  2] =  7.5627330304183E-10;
@@ -83862,8 +82776,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[185][183] =  3.1870707677468E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[185][184] =  1.3864865335362E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[185][185] = -7.2362602450115E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[186] =
-      JEOD_ALLOC_PRIM_ARRAY (187, double);
    SphericalHarmonicsGravitySource_ptr->Snm[186][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[186][  1] =  8.3294830699560E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[186][  2] =  4.1787759989322E-10;
@@ -84051,8 +82963,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[186][184] =  1.8525973531350E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[186][185] = -4.3320291524813E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[186][186] = -6.5044629955512E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[187] =
-      JEOD_ALLOC_PRIM_ARRAY (188, double);
    SphericalHarmonicsGravitySource_ptr->Snm[187][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[187][  1] =  3.3572632896776E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[187][  2] = -3.9225366305921E-10;
@@ -84241,8 +83151,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[187][185] = -1.8522288608353E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[187][186] = -1.5199745610316E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[187][187] =  4.1694947856322E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[188] =
-      JEOD_ALLOC_PRIM_ARRAY (189, double);
    SphericalHarmonicsGravitySource_ptr->Snm[188][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[188][  1] = -6.5507979177949E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[188][  2] = -4.7058625761213E-10;
@@ -84432,8 +83340,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[188][186] =  5.4737497810925E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[188][187] = -4.7225160353516E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[188][188] =  1.5940302221664E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[189] =
-      JEOD_ALLOC_PRIM_ARRAY (190, double);
    SphericalHarmonicsGravitySource_ptr->Snm[189][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[189][  1] =  8.9984101331858E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[189][  2] = -6.5073533171465E-10;
@@ -84624,8 +83530,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[189][187] = -4.2178710518410E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[189][188] =  4.6501396731051E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[189][189] = -2.8424861058864E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[190] =
-      JEOD_ALLOC_PRIM_ARRAY (191, double);
    SphericalHarmonicsGravitySource_ptr->Snm[190][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[190][  1] =  3.7210692574471E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[190][  2] =  2.0547543232458E-10;
@@ -84817,8 +83721,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[190][188] = -3.9065303419417E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[190][189] =  8.1245511906720E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[190][190] = -2.5139632662922E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[191] =
-      JEOD_ALLOC_PRIM_ARRAY (192, double);
    SphericalHarmonicsGravitySource_ptr->Snm[191][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[191][  1] = -4.1679868889152E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[191][  2] =  4.8529699785267E-11;
@@ -85011,8 +83913,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[191][189] =  8.2041373491925E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[191][190] = -3.8000754318505E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[191][191] = -1.2795435570723E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[192] =
-      JEOD_ALLOC_PRIM_ARRAY (193, double);
    SphericalHarmonicsGravitySource_ptr->Snm[192][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[192][  1] = -5.0948625503939E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[192][  2] =  5.8613934235518E-10;
@@ -85206,8 +84106,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[192][190] = -6.5077140816464E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[192][191] = -1.0533432758577E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[192][192] = -1.4839897968638E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[193] =
-      JEOD_ALLOC_PRIM_ARRAY (194, double);
    SphericalHarmonicsGravitySource_ptr->Snm[193][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[193][  1] = -2.4153593286431E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[193][  2] = -7.2553932780171E-11;
@@ -85402,8 +84300,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[193][191] =  1.2026959827363E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[193][192] =  7.7539437864315E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[193][193] =  3.2525942319349E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[194] =
-      JEOD_ALLOC_PRIM_ARRAY (195, double);
    SphericalHarmonicsGravitySource_ptr->Snm[194][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[194][  1] =  5.7054320815870E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[194][  2] =  3.4506562337280E-10;
@@ -85599,8 +84495,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[194][192] =  3.1349491469573E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[194][193] =  3.9154028290469E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[194][194] = -3.5606568123535E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[195] =
-      JEOD_ALLOC_PRIM_ARRAY (196, double);
    SphericalHarmonicsGravitySource_ptr->Snm[195][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[195][  1] =  7.6327691171064E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[195][  2] =  7.2049318825734E-11;
@@ -85797,8 +84691,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[195][193] = -1.7268199017004E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[195][194] = -3.7269997580172E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[195][195] = -2.4866864438476E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[196] =
-      JEOD_ALLOC_PRIM_ARRAY (197, double);
    SphericalHarmonicsGravitySource_ptr->Snm[196][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[196][  1] = -1.2324660828257E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[196][  2] = -3.0455234446102E-10;
@@ -85996,8 +84888,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[196][194] =  5.2284493666564E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[196][195] = -2.0052411498998E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[196][196] =  3.1675179048589E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[197] =
-      JEOD_ALLOC_PRIM_ARRAY (198, double);
    SphericalHarmonicsGravitySource_ptr->Snm[197][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[197][  1] = -2.8623232088920E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[197][  2] =  1.4858693676087E-10;
@@ -86196,8 +85086,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[197][195] =  2.3793662041376E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[197][196] = -6.3624437431259E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[197][197] =  4.0785686378793E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[198] =
-      JEOD_ALLOC_PRIM_ARRAY (199, double);
    SphericalHarmonicsGravitySource_ptr->Snm[198][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[198][  1] = -3.5001987316190E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[198][  2] =  4.2318160829422E-10;
@@ -86397,8 +85285,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[198][196] = -6.4130035486051E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[198][197] =  3.2074047271615E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[198][198] =  3.4336583204234E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[199] =
-      JEOD_ALLOC_PRIM_ARRAY (200, double);
    SphericalHarmonicsGravitySource_ptr->Snm[199][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[199][  1] = -3.3350341062310E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[199][  2] = -3.9214207218555E-10;
@@ -86599,8 +85485,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[199][197] =  5.5324350847804E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[199][198] =  3.2993432411777E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[199][199] = -3.2688044656675E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[200] =
-      JEOD_ALLOC_PRIM_ARRAY (201, double);
    SphericalHarmonicsGravitySource_ptr->Snm[200][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[200][  1] =  2.0289431004334E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[200][  2] = -1.2810556626293E-10;
@@ -86802,8 +85686,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[200][198] =  4.8992747669975E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[200][199] = -1.0157394056725E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[200][200] = -1.1624902266913E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[201] =
-      JEOD_ALLOC_PRIM_ARRAY (202, double);
    SphericalHarmonicsGravitySource_ptr->Snm[201][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[201][  1] =  1.7751105870539E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[201][  2] =  3.4720870573036E-10;
@@ -87006,8 +85888,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[201][199] = -2.8610517186948E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[201][200] = -1.8754288111130E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[201][201] = -4.3400651772469E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[202] =
-      JEOD_ALLOC_PRIM_ARRAY (203, double);
    SphericalHarmonicsGravitySource_ptr->Snm[202][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[202][  1] =  1.0234660811978E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[202][  2] = -1.7398216035084E-10;
@@ -87211,8 +86091,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[202][200] =  1.8990009629548E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[202][201] =  3.6388741750396E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[202][202] = -2.0704969844047E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[203] =
-      JEOD_ALLOC_PRIM_ARRAY (204, double);
    SphericalHarmonicsGravitySource_ptr->Snm[203][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[203][  1] = -2.2881083283056E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[203][  2] = -3.3679943528179E-11;
@@ -87417,8 +86295,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[203][201] = -5.0998836354866E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[203][202] =  1.0459690299006E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[203][203] =  2.7412092548116E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[204] =
-      JEOD_ALLOC_PRIM_ARRAY (205, double);
    SphericalHarmonicsGravitySource_ptr->Snm[204][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[204][  1] =  5.4588421115395E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[204][  2] = -2.8218363441292E-10;
@@ -87624,8 +86500,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[204][202] = -5.7924418701926E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[204][203] =  1.2947746997954E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[204][204] = -1.2688594624488E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[205] =
-      JEOD_ALLOC_PRIM_ARRAY (206, double);
    SphericalHarmonicsGravitySource_ptr->Snm[205][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[205][  1] =  3.3252817120407E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[205][  2] = -6.8999081922848E-11;
@@ -87832,8 +86706,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[205][203] =  4.1806678101847E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[205][204] =  2.2531983588808E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[205][205] =  9.5384849184450E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[206] =
-      JEOD_ALLOC_PRIM_ARRAY (207, double);
    SphericalHarmonicsGravitySource_ptr->Snm[206][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[206][  1] = -2.1468501447271E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[206][  2] = -3.3136357399393E-10;
@@ -88041,8 +86913,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[206][204] =  1.2605418703340E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[206][205] = -4.0393776667029E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[206][206] = -7.8732366371218E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[207] =
-      JEOD_ALLOC_PRIM_ARRAY (208, double);
    SphericalHarmonicsGravitySource_ptr->Snm[207][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[207][  1] = -1.4026170590156E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[207][  2] =  3.2188384685910E-10;
@@ -88251,8 +87121,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[207][205] = -9.1044149975090E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[207][206] = -3.6702132341818E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[207][207] =  1.3326138342324E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[208] =
-      JEOD_ALLOC_PRIM_ARRAY (209, double);
    SphericalHarmonicsGravitySource_ptr->Snm[208][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[208][  1] =  3.8385931442235E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[208][  2] =  4.4224464227290E-10;
@@ -88462,8 +87330,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[208][206] = -1.3701251546018E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[208][207] =  5.8516617444957E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[208][208] =  4.9073939429032E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[209] =
-      JEOD_ALLOC_PRIM_ARRAY (210, double);
    SphericalHarmonicsGravitySource_ptr->Snm[209][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[209][  1] =  1.7224112962546E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[209][  2] = -1.3132623359855E-10;
@@ -88674,8 +87540,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[209][207] =  2.9722543835045E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[209][208] = -2.7513901036285E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[209][209] =  2.4397884499920E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[210] =
-      JEOD_ALLOC_PRIM_ARRAY (211, double);
    SphericalHarmonicsGravitySource_ptr->Snm[210][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[210][  1] =  1.6289582069861E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[210][  2] = -1.3733312780330E-10;
@@ -88887,8 +87751,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[210][208] =  2.5403467722839E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[210][209] =  3.9276977480310E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[210][210] = -5.3484387436524E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[211] =
-      JEOD_ALLOC_PRIM_ARRAY (212, double);
    SphericalHarmonicsGravitySource_ptr->Snm[211][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[211][  1] = -3.2187983918125E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[211][  2] =  7.3095430548039E-11;
@@ -89101,8 +87963,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[211][209] =  4.6626267716582E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[211][210] = -3.4412252396363E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[211][211] = -5.5308260941335E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[212] =
-      JEOD_ALLOC_PRIM_ARRAY (213, double);
    SphericalHarmonicsGravitySource_ptr->Snm[212][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[212][  1] =  2.6364998132462E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[212][  2] =  2.4361720585114E-10;
@@ -89316,8 +88176,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[212][210] = -1.0653893875776E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[212][211] = -6.5226991425561E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[212][212] =  6.5663853575068E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[213] =
-      JEOD_ALLOC_PRIM_ARRAY (214, double);
    SphericalHarmonicsGravitySource_ptr->Snm[213][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[213][  1] = -9.0402209953116E-13;
    SphericalHarmonicsGravitySource_ptr->Snm[213][  2] =  1.4271264438889E-10;
@@ -89532,8 +88390,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[213][211] =  1.2489089117610E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[213][212] =  4.7300181810231E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[213][213] =  1.3473533592666E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[214] =
-      JEOD_ALLOC_PRIM_ARRAY (215, double);
    SphericalHarmonicsGravitySource_ptr->Snm[214][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[214][  1] =  1.1784106682120E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[214][  2] = -5.2309145133006E-11;
@@ -89749,8 +88605,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[214][212] =  7.2276223786971E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[214][213] =  5.6481076623640E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[214][214] = -1.2169036635149E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[215] =
-      JEOD_ALLOC_PRIM_ARRAY (216, double);
    SphericalHarmonicsGravitySource_ptr->Snm[215][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[215][  1] =  1.5228310851083E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[215][  2] =  4.5304626374518E-10;
@@ -89967,8 +88821,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[215][213] =  5.8853958431097E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[215][214] = -2.8586570312541E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[215][215] =  1.0083220358953E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[216] =
-      JEOD_ALLOC_PRIM_ARRAY (217, double);
    SphericalHarmonicsGravitySource_ptr->Snm[216][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[216][  1] =  1.4581841798705E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[216][  2] =  3.9250337169660E-10;
@@ -90186,8 +89038,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[216][214] = -3.6241535304833E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[216][215] =  5.0569019905045E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[216][216] = -2.4836458668816E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[217] =
-      JEOD_ALLOC_PRIM_ARRAY (218, double);
    SphericalHarmonicsGravitySource_ptr->Snm[217][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[217][  1] = -3.4169015356977E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[217][  2] = -2.2182436905595E-10;
@@ -90406,8 +89256,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[217][215] = -3.1883544958327E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[217][216] =  3.6380510760577E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[217][217] =  5.3900715725442E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[218] =
-      JEOD_ALLOC_PRIM_ARRAY (219, double);
    SphericalHarmonicsGravitySource_ptr->Snm[218][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[218][  1] = -3.0636866358260E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[218][  2] = -5.6871152435773E-11;
@@ -90627,8 +89475,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[218][216] = -6.2174293979992E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[218][217] =  1.3664624387065E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[218][218] =  2.7885619920489E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[219] =
-      JEOD_ALLOC_PRIM_ARRAY (220, double);
    SphericalHarmonicsGravitySource_ptr->Snm[219][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[219][  1] =  2.5736011002338E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[219][  2] =  1.4512448047191E-11;
@@ -90849,8 +89695,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[219][217] =  6.2275963349664E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[219][218] =  4.9788784658483E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[219][219] = -5.5753459388184E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[220] =
-      JEOD_ALLOC_PRIM_ARRAY (221, double);
    SphericalHarmonicsGravitySource_ptr->Snm[220][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[220][  1] =  5.0608671443220E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[220][  2] =  3.7926879019223E-11;
@@ -91072,8 +89916,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[220][218] =  2.6567031424416E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[220][219] =  1.6445839043758E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[220][220] = -4.3993473962553E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[221] =
-      JEOD_ALLOC_PRIM_ARRAY (222, double);
    SphericalHarmonicsGravitySource_ptr->Snm[221][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[221][  1] =  9.6184856815184E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[221][  2] = -1.3957359915172E-10;
@@ -91296,8 +90138,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[221][219] = -4.5248949888972E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[221][220] = -2.4607036462558E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[221][221] = -4.2580107782460E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[222] =
-      JEOD_ALLOC_PRIM_ARRAY (223, double);
    SphericalHarmonicsGravitySource_ptr->Snm[222][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[222][  1] = -6.1976804874156E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[222][  2] =  2.8686652208036E-10;
@@ -91521,8 +90361,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[222][220] = -1.7906065798171E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[222][221] =  1.3282401665478E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[222][222] = -1.3469557350193E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[223] =
-      JEOD_ALLOC_PRIM_ARRAY (224, double);
    SphericalHarmonicsGravitySource_ptr->Snm[223][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[223][  1] = -4.4505685267462E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[223][  2] =  3.7829936590599E-10;
@@ -91747,8 +90585,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[223][221] =  4.0689967066925E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[223][222] = -2.6788327357309E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[223][223] =  1.0794168263479E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[224] =
-      JEOD_ALLOC_PRIM_ARRAY (225, double);
    SphericalHarmonicsGravitySource_ptr->Snm[224][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[224][  1] =  1.6851949473703E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[224][  2] = -3.6686824382672E-10;
@@ -91974,8 +90810,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[224][222] =  9.2609934580330E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[224][223] =  2.4733807005351E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[224][224] = -1.7876905501003E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[225] =
-      JEOD_ALLOC_PRIM_ARRAY (226, double);
    SphericalHarmonicsGravitySource_ptr->Snm[225][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[225][  1] =  2.1828045701608E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[225][  2] = -1.2403051745375E-10;
@@ -92202,8 +91036,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[225][223] =  1.7134739409115E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[225][224] =  1.3083757535601E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[225][225] = -3.0636774165063E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[226] =
-      JEOD_ALLOC_PRIM_ARRAY (227, double);
    SphericalHarmonicsGravitySource_ptr->Snm[226][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[226][  1] = -4.4641962511492E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[226][  2] =  3.2696802816806E-10;
@@ -92431,8 +91263,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[226][224] = -6.8320297802436E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[226][225] = -1.6160160001313E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[226][226] =  1.4362290050757E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[227] =
-      JEOD_ALLOC_PRIM_ARRAY (228, double);
    SphericalHarmonicsGravitySource_ptr->Snm[227][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[227][  1] =  7.0363849493589E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[227][  2] =  1.8228997501944E-10;
@@ -92661,8 +91491,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[227][225] = -1.4878818803894E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[227][226] = -2.2203010775997E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[227][227] =  3.3885378010379E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[228] =
-      JEOD_ALLOC_PRIM_ARRAY (229, double);
    SphericalHarmonicsGravitySource_ptr->Snm[228][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[228][  1] = -6.7503058129587E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[228][  2] = -3.4310202317762E-10;
@@ -92892,8 +91720,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[228][226] =  6.1648512268100E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[228][227] =  1.1708142578230E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[228][228] =  6.6677377217258E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[229] =
-      JEOD_ALLOC_PRIM_ARRAY (230, double);
    SphericalHarmonicsGravitySource_ptr->Snm[229][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[229][  1] = -2.2163668552540E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[229][  2] = -2.7401431521706E-10;
@@ -93124,8 +91950,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[229][227] = -2.0762483954963E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[229][228] =  2.7733032979847E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[229][229] =  2.1391740967028E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[230] =
-      JEOD_ALLOC_PRIM_ARRAY (231, double);
    SphericalHarmonicsGravitySource_ptr->Snm[230][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[230][  1] =  1.8867564069074E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[230][  2] =  3.6807016009902E-10;
@@ -93357,8 +92181,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[230][228] = -2.1701738343632E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[230][229] = -9.9332008030140E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[230][230] = -2.0830748920971E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[231] =
-      JEOD_ALLOC_PRIM_ARRAY (232, double);
    SphericalHarmonicsGravitySource_ptr->Snm[231][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[231][  1] =  2.3120538241512E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[231][  2] =  2.8629608801931E-10;
@@ -93591,8 +92413,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[231][229] = -5.2794375163090E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[231][230] = -2.1429347902675E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[231][231] =  7.9964253526102E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[232] =
-      JEOD_ALLOC_PRIM_ARRAY (233, double);
    SphericalHarmonicsGravitySource_ptr->Snm[232][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[232][  1] = -1.8052297719940E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[232][  2] = -2.2459701774245E-10;
@@ -93826,8 +92646,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[232][230] =  2.3248998585453E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[232][231] = -2.2337412630493E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[232][232] =  1.5265513134960E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[233] =
-      JEOD_ALLOC_PRIM_ARRAY (234, double);
    SphericalHarmonicsGravitySource_ptr->Snm[233][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[233][  1] = -1.3910887409879E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[233][  2] = -1.5789867726323E-10;
@@ -94062,8 +92880,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[233][231] =  5.3023816033993E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[233][232] =  2.8362219049527E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[233][233] = -4.6734688643985E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[234] =
-      JEOD_ALLOC_PRIM_ARRAY (235, double);
    SphericalHarmonicsGravitySource_ptr->Snm[234][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[234][  1] =  1.0540289820580E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[234][  2] =  2.7792682414637E-10;
@@ -94299,8 +93115,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[234][232] =  1.1376440176083E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[234][233] = -2.5311461401447E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[234][234] = -7.1475991166591E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[235] =
-      JEOD_ALLOC_PRIM_ARRAY (236, double);
    SphericalHarmonicsGravitySource_ptr->Snm[235][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[235][  1] =  1.2380206997937E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[235][  2] = -4.4532079638687E-11;
@@ -94537,8 +93351,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[235][233] = -3.3132540722901E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[235][234] =  6.5962547001939E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[235][235] =  9.7508542746317E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[236] =
-      JEOD_ALLOC_PRIM_ARRAY (237, double);
    SphericalHarmonicsGravitySource_ptr->Snm[236][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[236][  1] =  1.3588582416994E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[236][  2] = -3.0069918464050E-10;
@@ -94776,8 +93588,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[236][234] = -5.6619690359501E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[236][235] = -1.2047632460032E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[236][236] =  1.4181785166405E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[237] =
-      JEOD_ALLOC_PRIM_ARRAY (238, double);
    SphericalHarmonicsGravitySource_ptr->Snm[237][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[237][  1] =  1.5434132911833E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[237][  2] =  1.7632677382603E-11;
@@ -95016,8 +93826,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[237][235] =  1.6722639684591E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[237][236] =  5.8657439922673E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[237][237] =  2.1040282934772E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[238] =
-      JEOD_ALLOC_PRIM_ARRAY (239, double);
    SphericalHarmonicsGravitySource_ptr->Snm[238][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[238][  1] =  9.1714757858279E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[238][  2] =  2.0591255292058E-10;
@@ -95257,8 +94065,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[238][236] =  4.7097099019161E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[238][237] =  5.4544502699921E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[238][238] =  1.8716803001490E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[239] =
-      JEOD_ALLOC_PRIM_ARRAY (240, double);
    SphericalHarmonicsGravitySource_ptr->Snm[239][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[239][  1] =  2.8137337468567E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[239][  2] =  3.9192475697939E-11;
@@ -95499,8 +94305,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[239][237] = -1.4708951207781E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[239][238] = -2.5687825493887E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[239][239] = -1.6007373102790E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[240] =
-      JEOD_ALLOC_PRIM_ARRAY (241, double);
    SphericalHarmonicsGravitySource_ptr->Snm[240][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[240][  1] = -6.7464497787818E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[240][  2] = -2.1118434079541E-10;
@@ -95742,8 +94546,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[240][238] = -5.1288665136409E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[240][239] = -1.8902144415914E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[240][240] =  1.6969832574346E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[241] =
-      JEOD_ALLOC_PRIM_ARRAY (242, double);
    SphericalHarmonicsGravitySource_ptr->Snm[241][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[241][  1] =  3.6029737660497E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[241][  2] =  6.5604967532195E-11;
@@ -95986,8 +94788,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[241][239] = -1.4355151493506E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[241][240] =  7.2892730996834E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[241][241] =  8.0298026127613E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[242] =
-      JEOD_ALLOC_PRIM_ARRAY (243, double);
    SphericalHarmonicsGravitySource_ptr->Snm[242][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[242][  1] =  4.5631525190669E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[242][  2] =  1.1241256177346E-10;
@@ -96231,8 +95031,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[242][240] =  2.9223373360913E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[242][241] =  2.5470784035951E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[242][242] = -1.4838649288090E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[243] =
-      JEOD_ALLOC_PRIM_ARRAY (244, double);
    SphericalHarmonicsGravitySource_ptr->Snm[243][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[243][  1] =  1.2227146591464E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[243][  2] = -1.9408813983333E-10;
@@ -96477,8 +95275,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[243][241] = -1.0897325624919E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[243][242] =  2.7031713226457E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[243][243] = -1.1926782323644E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[244] =
-      JEOD_ALLOC_PRIM_ARRAY (245, double);
    SphericalHarmonicsGravitySource_ptr->Snm[244][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[244][  1] = -1.3100524526153E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[244][  2] =  6.3566474031849E-11;
@@ -96724,8 +95520,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[244][242] = -3.4034400098068E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[244][243] = -5.5039215393440E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[244][244] =  2.2828075972811E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[245] =
-      JEOD_ALLOC_PRIM_ARRAY (246, double);
    SphericalHarmonicsGravitySource_ptr->Snm[245][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[245][  1] =  2.8274296197742E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[245][  2] =  1.6177667359737E-10;
@@ -96972,8 +95766,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[245][243] = -2.1557909412031E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[245][244] = -4.6137515674341E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[245][245] = -1.8938091615156E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[246] =
-      JEOD_ALLOC_PRIM_ARRAY (247, double);
    SphericalHarmonicsGravitySource_ptr->Snm[246][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[246][  1] = -1.3989791171910E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[246][  2] =  9.6101212178639E-11;
@@ -97221,8 +96013,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[246][244] = -1.4277083528761E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[246][245] = -3.3920340875784E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[246][246] =  2.8102603835770E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[247] =
-      JEOD_ALLOC_PRIM_ARRAY (248, double);
    SphericalHarmonicsGravitySource_ptr->Snm[247][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[247][  1] = -3.3086142387082E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[247][  2] =  7.7054981732259E-11;
@@ -97471,8 +96261,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[247][245] =  8.4667011598657E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[247][246] =  5.7379873008528E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[247][247] =  1.8774419372090E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[248] =
-      JEOD_ALLOC_PRIM_ARRAY (249, double);
    SphericalHarmonicsGravitySource_ptr->Snm[248][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[248][  1] = -1.7285702997519E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[248][  2] = -2.5042162162655E-11;
@@ -97722,8 +96510,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[248][246] = -7.9452045674186E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[248][247] =  8.4534797717664E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[248][248] = -1.8205391089213E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[249] =
-      JEOD_ALLOC_PRIM_ARRAY (250, double);
    SphericalHarmonicsGravitySource_ptr->Snm[249][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[249][  1] =  7.6655946885657E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[249][  2] = -7.0572520820421E-11;
@@ -97974,8 +96760,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[249][247] =  1.4965605166395E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[249][248] =  2.7689882109324E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[249][249] = -7.8703419405912E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[250] =
-      JEOD_ALLOC_PRIM_ARRAY (251, double);
    SphericalHarmonicsGravitySource_ptr->Snm[250][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[250][  1] =  1.7787245505872E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[250][  2] = -1.5068092175494E-10;
@@ -98227,8 +97011,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[250][248] = -7.4071703088072E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[250][249] =  4.1232833664151E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[250][250] = -1.0885112656355E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[251] =
-      JEOD_ALLOC_PRIM_ARRAY (252, double);
    SphericalHarmonicsGravitySource_ptr->Snm[251][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[251][  1] = -1.0143222597902E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[251][  2] =  2.2647903778511E-10;
@@ -98481,8 +97263,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[251][249] = -2.4993092354681E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[251][250] = -2.9335265719391E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[251][251] = -3.6232449142277E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[252] =
-      JEOD_ALLOC_PRIM_ARRAY (253, double);
    SphericalHarmonicsGravitySource_ptr->Snm[252][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[252][  1] =  5.5859349899904E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[252][  2] =  2.8972872537859E-10;
@@ -98736,8 +97516,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[252][250] =  1.4279176786683E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[252][251] =  6.3275937792663E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[252][252] =  1.7215066849269E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[253] =
-      JEOD_ALLOC_PRIM_ARRAY (254, double);
    SphericalHarmonicsGravitySource_ptr->Snm[253][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[253][  1] =  2.6671117818372E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[253][  2] = -4.0396780848903E-11;
@@ -98992,8 +97770,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[253][251] = -2.6728601368813E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[253][252] = -1.2047654292183E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[253][253] =  1.2211537403546E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[254] =
-      JEOD_ALLOC_PRIM_ARRAY (255, double);
    SphericalHarmonicsGravitySource_ptr->Snm[254][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[254][  1] = -1.3790890717511E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[254][  2] = -2.4776715750918E-10;
@@ -99249,8 +98025,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[254][252] =  1.7384906036479E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[254][253] = -2.8187799375375E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[254][254] = -3.6120442301996E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[255] =
-      JEOD_ALLOC_PRIM_ARRAY (256, double);
    SphericalHarmonicsGravitySource_ptr->Snm[255][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[255][  1] = -1.7339123873362E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[255][  2] = -1.8492744380297E-10;
@@ -99507,8 +98281,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[255][253] =  2.2579882488838E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[255][254] = -8.8085953368234E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[255][255] =  2.2369792582687E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[256] =
-      JEOD_ALLOC_PRIM_ARRAY (257, double);
    SphericalHarmonicsGravitySource_ptr->Snm[256][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[256][  1] =  1.1777378834063E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[256][  2] =  7.2606242403552E-11;
@@ -99766,8 +98538,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[256][254] = -1.4931084494863E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[256][255] = -2.6596344899947E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[256][256] =  2.6059948657104E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[257] =
-      JEOD_ALLOC_PRIM_ARRAY (258, double);
    SphericalHarmonicsGravitySource_ptr->Snm[257][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[257][  1] =  2.2625056158625E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[257][  2] =  6.0658683083339E-11;
@@ -100026,8 +98796,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[257][255] =  3.1460011782991E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[257][256] =  4.6838006722444E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[257][257] = -1.0355873599295E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[258] =
-      JEOD_ALLOC_PRIM_ARRAY (259, double);
    SphericalHarmonicsGravitySource_ptr->Snm[258][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[258][  1] = -7.2649353306069E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[258][  2] =  1.4313247003616E-10;
@@ -100287,8 +99055,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[258][256] = -1.7814566207142E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[258][257] = -4.9688264959662E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[258][258] =  1.9980102874943E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[259] =
-      JEOD_ALLOC_PRIM_ARRAY (260, double);
    SphericalHarmonicsGravitySource_ptr->Snm[259][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[259][  1] = -1.2813848558689E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[259][  2] = -9.4953999753194E-11;
@@ -100549,8 +99315,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[259][257] =  4.5677837095969E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[259][258] = -8.1785416020927E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[259][259] = -2.1854637732169E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[260] =
-      JEOD_ALLOC_PRIM_ARRAY (261, double);
    SphericalHarmonicsGravitySource_ptr->Snm[260][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[260][  1] =  2.3709079961585E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[260][  2] = -1.6609942434742E-10;
@@ -100812,8 +99576,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[260][258] =  3.0731220145197E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[260][259] =  1.8583700205827E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[260][260] = -2.8507538683554E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[261] =
-      JEOD_ALLOC_PRIM_ARRAY (262, double);
    SphericalHarmonicsGravitySource_ptr->Snm[261][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[261][  1] =  9.4087112202973E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[261][  2] = -1.7879534330768E-11;
@@ -101076,8 +99838,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[261][259] = -1.9209335187320E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[261][260] =  9.7705075561680E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[261][261] =  1.1556859079599E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[262] =
-      JEOD_ALLOC_PRIM_ARRAY (263, double);
    SphericalHarmonicsGravitySource_ptr->Snm[262][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[262][  1] = -2.8141386765892E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[262][  2] = -4.9411155483698E-11;
@@ -101341,8 +100101,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[262][260] =  1.4024900330054E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[262][261] =  4.5313146960878E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[262][262] = -1.4901166858865E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[263] =
-      JEOD_ALLOC_PRIM_ARRAY (264, double);
    SphericalHarmonicsGravitySource_ptr->Snm[263][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[263][  1] = -3.6667635617919E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[263][  2] =  1.7693340195736E-10;
@@ -101607,8 +100365,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[263][261] = -3.1821946231162E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[263][262] =  1.1160751235288E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[263][263] = -7.6675527310163E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[264] =
-      JEOD_ALLOC_PRIM_ARRAY (265, double);
    SphericalHarmonicsGravitySource_ptr->Snm[264][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[264][  1] =  2.7173183184134E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[264][  2] = -1.8387683668217E-11;
@@ -101874,8 +100630,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[264][262] =  9.6992534444015E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[264][263] =  1.4249231542863E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[264][264] =  1.1834790988980E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[265] =
-      JEOD_ALLOC_PRIM_ARRAY (266, double);
    SphericalHarmonicsGravitySource_ptr->Snm[265][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[265][  1] =  1.1389409472451E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[265][  2] = -2.0224858533981E-10;
@@ -102142,8 +100896,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[265][263] = -1.5358625732947E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[265][264] = -2.7860420317400E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[265][265] =  1.4930405740959E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[266] =
-      JEOD_ALLOC_PRIM_ARRAY (267, double);
    SphericalHarmonicsGravitySource_ptr->Snm[266][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[266][  1] = -1.5005892528031E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[266][  2] =  6.6591048098688E-11;
@@ -102411,8 +101163,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[266][264] = -5.8968587359203E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[266][265] = -2.8745775790296E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[266][266] =  1.4947488028748E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[267] =
-      JEOD_ALLOC_PRIM_ARRAY (268, double);
    SphericalHarmonicsGravitySource_ptr->Snm[267][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[267][  1] = -9.1610384503909E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[267][  2] =  1.7355327602995E-10;
@@ -102681,8 +101431,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[267][265] = -3.6927545717480E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[267][266] = -1.6161679637151E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[267][267] =  4.1004770755195E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[268] =
-      JEOD_ALLOC_PRIM_ARRAY (269, double);
    SphericalHarmonicsGravitySource_ptr->Snm[268][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[268][  1] =  1.5376223864643E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[268][  2] = -4.4372731773483E-11;
@@ -102952,8 +101700,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[268][266] =  6.1677904447522E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[268][267] =  4.3970498219100E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[268][268] =  8.0643924794476E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[269] =
-      JEOD_ALLOC_PRIM_ARRAY (270, double);
    SphericalHarmonicsGravitySource_ptr->Snm[269][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[269][  1] = -1.0379957652850E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[269][  2] = -2.2831673198404E-10;
@@ -103224,8 +101970,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[269][267] = -1.0376250834384E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[269][268] =  2.0580858602113E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[269][269] = -2.0432070849630E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[270] =
-      JEOD_ALLOC_PRIM_ARRAY (271, double);
    SphericalHarmonicsGravitySource_ptr->Snm[270][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[270][  1] = -1.4781208794362E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[270][  2] =  7.7174495395156E-11;
@@ -103497,8 +102241,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[270][268] =  2.9414831144446E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[270][269] = -2.8180540179216E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[270][270] = -2.0563971279310E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[271] =
-      JEOD_ALLOC_PRIM_ARRAY (272, double);
    SphericalHarmonicsGravitySource_ptr->Snm[271][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[271][  1] =  2.6451482844879E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[271][  2] =  2.4025258354995E-10;
@@ -103771,8 +102513,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[271][269] = -2.9238149163659E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[271][270] = -4.4891151873629E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[271][271] =  2.2316594014452E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[272] =
-      JEOD_ALLOC_PRIM_ARRAY (273, double);
    SphericalHarmonicsGravitySource_ptr->Snm[272][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[272][  1] =  2.0477889349065E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[272][  2] = -3.8260447560134E-11;
@@ -104046,8 +102786,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[272][270] = -3.8512118272713E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[272][271] =  5.2907172053328E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[272][272] = -1.1378921667289E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[273] =
-      JEOD_ALLOC_PRIM_ARRAY (274, double);
    SphericalHarmonicsGravitySource_ptr->Snm[273][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[273][  1] = -2.2524099219965E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[273][  2] = -1.1804445320693E-10;
@@ -104322,8 +103060,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[273][271] =  3.0389603551214E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[273][272] =  8.1105920739740E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[273][273] =  9.2534017918382E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[274] =
-      JEOD_ALLOC_PRIM_ARRAY (275, double);
    SphericalHarmonicsGravitySource_ptr->Snm[274][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[274][  1] = -3.7760483120783E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[274][  2] =  1.2260779232078E-10;
@@ -104599,8 +103335,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[274][272] = -1.2541609616445E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[274][273] = -6.9887804946502E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[274][274] = -2.5684123687472E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[275] =
-      JEOD_ALLOC_PRIM_ARRAY (276, double);
    SphericalHarmonicsGravitySource_ptr->Snm[275][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[275][  1] =  1.8890204346224E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[275][  2] =  1.3897273787887E-10;
@@ -104877,8 +103611,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[275][273] = -2.1997709368730E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[275][274] = -7.3704295548800E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[275][275] =  1.7432452696926E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[276] =
-      JEOD_ALLOC_PRIM_ARRAY (277, double);
    SphericalHarmonicsGravitySource_ptr->Snm[276][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[276][  1] =  3.2103940030975E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[276][  2] = -1.9354883863118E-10;
@@ -105156,8 +103888,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[276][274] =  3.2022953643083E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[276][275] =  6.7439978855737E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[276][276] =  4.3279701053996E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[277] =
-      JEOD_ALLOC_PRIM_ARRAY (278, double);
    SphericalHarmonicsGravitySource_ptr->Snm[277][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[277][  1] = -1.9090566268555E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[277][  2] = -2.0731394720977E-10;
@@ -105436,8 +104166,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[277][275] = -2.8347566463735E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[277][276] =  3.1454531975961E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[277][277] =  6.6731893973274E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[278] =
-      JEOD_ALLOC_PRIM_ARRAY (279, double);
    SphericalHarmonicsGravitySource_ptr->Snm[278][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[278][  1] = -1.0039516844946E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[278][  2] =  1.6021667843926E-10;
@@ -105717,8 +104445,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[278][276] =  9.0349636348587E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[278][277] =  1.7407128191422E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[278][278] =  2.5011460728491E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[279] =
-      JEOD_ALLOC_PRIM_ARRAY (280, double);
    SphericalHarmonicsGravitySource_ptr->Snm[279][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[279][  1] =  1.9397374239079E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[279][  2] =  2.1204770441782E-10;
@@ -105999,8 +104725,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[279][277] = -8.4333274243907E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[279][278] =  4.5167740523637E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[279][279] = -4.0781201156585E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[280] =
-      JEOD_ALLOC_PRIM_ARRAY (281, double);
    SphericalHarmonicsGravitySource_ptr->Snm[280][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[280][  1] =  2.2406567753232E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[280][  2] = -1.5812286660610E-10;
@@ -106282,8 +105006,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[280][278] = -1.4673675864603E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[280][279] = -1.8771788105529E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[280][280] = -7.3021578729564E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[281] =
-      JEOD_ALLOC_PRIM_ARRAY (282, double);
    SphericalHarmonicsGravitySource_ptr->Snm[281][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[281][  1] = -6.2464228113624E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[281][  2] = -1.2762295679167E-10;
@@ -106566,8 +105288,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[281][279] =  2.2379092417406E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[281][280] = -1.8070207312337E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[281][281] = -1.1630160939711E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[282] =
-      JEOD_ALLOC_PRIM_ARRAY (283, double);
    SphericalHarmonicsGravitySource_ptr->Snm[282][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[282][  1] = -1.2360274179770E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[282][  2] =  1.6530921553851E-10;
@@ -106851,8 +105571,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[282][280] = -1.1921955605544E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[282][281] =  1.1359439972387E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[282][282] = -2.0604127765274E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[283] =
-      JEOD_ALLOC_PRIM_ARRAY (284, double);
    SphericalHarmonicsGravitySource_ptr->Snm[283][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[283][  1] =  6.4140887774131E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[283][  2] =  7.9982691754671E-11;
@@ -107137,8 +105855,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[283][281] = -1.7666118019609E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[283][282] =  1.0180655482373E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[283][283] =  1.7801563635616E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[284] =
-      JEOD_ALLOC_PRIM_ARRAY (285, double);
    SphericalHarmonicsGravitySource_ptr->Snm[284][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[284][  1] = -4.7963557130663E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[284][  2] = -1.1661011040361E-10;
@@ -107424,8 +106140,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[284][282] =  1.1117346362894E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[284][283] = -3.8830921866786E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[284][284] = -1.9847502652366E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[285] =
-      JEOD_ALLOC_PRIM_ARRAY (286, double);
    SphericalHarmonicsGravitySource_ptr->Snm[285][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[285][  1] =  1.6723178328148E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[285][  2] = -6.4940554176570E-11;
@@ -107712,8 +106426,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[285][283] = -1.0147799739581E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[285][284] =  2.0155515196863E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[285][285] =  5.0038138133622E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[286] =
-      JEOD_ALLOC_PRIM_ARRAY (287, double);
    SphericalHarmonicsGravitySource_ptr->Snm[286][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[286][  1] =  1.5778712947854E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[286][  2] =  2.5484079615406E-10;
@@ -108001,8 +106713,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[286][284] = -2.7399522010330E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[286][285] =  6.6716020899615E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[286][286] =  9.0272267778939E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[287] =
-      JEOD_ALLOC_PRIM_ARRAY (288, double);
    SphericalHarmonicsGravitySource_ptr->Snm[287][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[287][  1] =  2.7381066050031E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[287][  2] =  1.2382358255251E-10;
@@ -108291,8 +107001,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[287][285] =  2.7764801278620E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[287][286] =  1.8305963029093E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[287][287] =  4.0921315444393E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[288] =
-      JEOD_ALLOC_PRIM_ARRAY (289, double);
    SphericalHarmonicsGravitySource_ptr->Snm[288][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[288][  1] = -1.5658245605238E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[288][  2] = -2.6475927319869E-10;
@@ -108582,8 +107290,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[288][286] = -1.5021924090892E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[288][287] =  1.2367875422323E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[288][288] = -2.3338580861062E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[289] =
-      JEOD_ALLOC_PRIM_ARRAY (290, double);
    SphericalHarmonicsGravitySource_ptr->Snm[289][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[289][  1] =  5.8482806450123E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[289][  2] = -5.7134911818806E-11;
@@ -108874,8 +107580,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[289][287] = -6.4453632359519E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[289][288] = -2.4201674566855E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[289][289] = -8.5959283178650E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[290] =
-      JEOD_ALLOC_PRIM_ARRAY (291, double);
    SphericalHarmonicsGravitySource_ptr->Snm[290][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[290][  1] =  2.0157909966771E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[290][  2] =  1.2334568500639E-10;
@@ -109167,8 +107871,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[290][288] =  5.6810615918028E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[290][289] = -4.3337257540103E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[290][290] =  5.8314242196399E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[291] =
-      JEOD_ALLOC_PRIM_ARRAY (292, double);
    SphericalHarmonicsGravitySource_ptr->Snm[291][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[291][  1] =  1.7364887668247E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[291][  2] = -7.5154024177612E-11;
@@ -109461,8 +108163,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[291][289] = -2.5574017037045E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[291][290] =  5.3680963509907E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[291][291] = -4.7239482978428E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[292] =
-      JEOD_ALLOC_PRIM_ARRAY (293, double);
    SphericalHarmonicsGravitySource_ptr->Snm[292][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[292][  1] = -8.9754134076201E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[292][  2] = -2.5468792047263E-11;
@@ -109756,8 +108456,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[292][290] =  2.4094094900885E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[292][291] = -6.2412926064686E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[292][292] =  2.4255991729109E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[293] =
-      JEOD_ALLOC_PRIM_ARRAY (294, double);
    SphericalHarmonicsGravitySource_ptr->Snm[293][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[293][  1] = -5.5694943217752E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[293][  2] =  2.2956412738567E-10;
@@ -110052,8 +108750,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[293][291] =  2.2538193383269E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[293][292] = -6.4447554747176E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[293][293] = -3.5954816721166E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[294] =
-      JEOD_ALLOC_PRIM_ARRAY (295, double);
    SphericalHarmonicsGravitySource_ptr->Snm[294][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[294][  1] =  4.6671308071073E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[294][  2] =  6.2272122253525E-11;
@@ -110349,8 +109045,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[294][292] = -1.7948762188217E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[294][293] = -7.2437314685263E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[294][294] = -3.3065879284562E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[295] =
-      JEOD_ALLOC_PRIM_ARRAY (296, double);
    SphericalHarmonicsGravitySource_ptr->Snm[295][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[295][  1] = -2.3919537193450E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[295][  2] = -2.9930922575377E-10;
@@ -110647,8 +109341,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[295][293] =  6.3234092045831E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[295][294] = -2.3265866161901E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[295][295] =  1.4480771924889E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[296] =
-      JEOD_ALLOC_PRIM_ARRAY (297, double);
    SphericalHarmonicsGravitySource_ptr->Snm[296][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[296][  1] =  3.0244474091151E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[296][  2] = -5.0555304303270E-11;
@@ -110946,8 +109638,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[296][294] =  4.9850662163682E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[296][295] =  1.7965429000544E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[296][296] =  7.8041210994815E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[297] =
-      JEOD_ALLOC_PRIM_ARRAY (298, double);
    SphericalHarmonicsGravitySource_ptr->Snm[297][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[297][  1] =  7.5962428626180E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[297][  2] =  1.9313374787449E-10;
@@ -111246,8 +109936,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[297][295] = -1.1461290575041E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[297][296] =  1.1421779509461E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[297][297] =  1.2619951392231E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[298] =
-      JEOD_ALLOC_PRIM_ARRAY (299, double);
    SphericalHarmonicsGravitySource_ptr->Snm[298][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[298][  1] = -1.8885500409781E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[298][  2] = -3.9790547517368E-11;
@@ -111547,8 +110235,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[298][296] =  4.9527741945924E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[298][297] =  5.7045494452732E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[298][298] = -1.9325150648492E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[299] =
-      JEOD_ALLOC_PRIM_ARRAY (300, double);
    SphericalHarmonicsGravitySource_ptr->Snm[299][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[299][  1] = -5.3470910203105E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[299][  2] = -1.3965017753800E-11;
@@ -111849,8 +110535,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[299][297] =  1.0605064460966E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[299][298] =  9.8678208069460E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[299][299] = -1.3365969954655E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[300] =
-      JEOD_ALLOC_PRIM_ARRAY (301, double);
    SphericalHarmonicsGravitySource_ptr->Snm[300][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[300][  1] = -2.6867736721739E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[300][  2] = -9.1738457817883E-12;
@@ -112152,8 +110836,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[300][298] = -2.5962610435109E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[300][299] = -3.5880406037454E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[300][300] = -9.2247180537841E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[301] =
-      JEOD_ALLOC_PRIM_ARRAY (302, double);
    SphericalHarmonicsGravitySource_ptr->Snm[301][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[301][  1] =  3.1146659616198E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[301][  2] = -1.5390285637840E-11;
@@ -112456,8 +111138,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[301][299] =  5.6931599625612E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[301][300] =  1.6263909756900E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[301][301] =  3.2658739714846E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[302] =
-      JEOD_ALLOC_PRIM_ARRAY (303, double);
    SphericalHarmonicsGravitySource_ptr->Snm[302][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[302][  1] = -4.6429494714658E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[302][  2] =  8.2915589096995E-11;
@@ -112761,8 +111441,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[302][300] = -2.5435588530795E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[302][301] = -3.3387596092425E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[302][302] = -6.9194056784527E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[303] =
-      JEOD_ALLOC_PRIM_ARRAY (304, double);
    SphericalHarmonicsGravitySource_ptr->Snm[303][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[303][  1] =  1.8250041230962E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[303][  2] =  7.6875981622828E-11;
@@ -113067,8 +111745,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[303][301] =  1.0511037668537E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[303][302] =  3.0037560216653E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[303][303] = -2.7525574646642E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[304] =
-      JEOD_ALLOC_PRIM_ARRAY (305, double);
    SphericalHarmonicsGravitySource_ptr->Snm[304][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[304][  1] =  5.3565612729571E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[304][  2] =  2.6080862067488E-11;
@@ -113374,8 +112050,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[304][302] =  1.0383797321621E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[304][303] = -1.9316120488474E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[304][304] =  9.0665515324179E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[305] =
-      JEOD_ALLOC_PRIM_ARRAY (306, double);
    SphericalHarmonicsGravitySource_ptr->Snm[305][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[305][  1] =  4.9390412455867E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[305][  2] = -6.5900207508992E-11;
@@ -113682,8 +112356,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[305][303] = -1.9118099027285E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[305][304] = -2.6764240785799E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[305][305] =  8.9126184045764E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[306] =
-      JEOD_ALLOC_PRIM_ARRAY (307, double);
    SphericalHarmonicsGravitySource_ptr->Snm[306][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[306][  1] = -1.4674554283504E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[306][  2] =  4.7596775838390E-11;
@@ -113991,8 +112663,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[306][304] = -7.9467050888729E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[306][305] =  2.6338825433230E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[306][306] =  3.2424693379076E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[307] =
-      JEOD_ALLOC_PRIM_ARRAY (308, double);
    SphericalHarmonicsGravitySource_ptr->Snm[307][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[307][  1] = -1.4166119391652E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[307][  2] =  7.7010677355994E-11;
@@ -114301,8 +112971,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[307][305] =  2.8467180280267E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[307][306] = -8.6204001769186E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[307][307] =  1.7466279496779E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[308] =
-      JEOD_ALLOC_PRIM_ARRAY (309, double);
    SphericalHarmonicsGravitySource_ptr->Snm[308][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[308][  1] =  1.3540835321658E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[308][  2] = -1.9313106121683E-11;
@@ -114612,8 +113280,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[308][306] = -2.9967737193816E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[308][307] =  9.7597170841585E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[308][308] = -2.0874031644843E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[309] =
-      JEOD_ALLOC_PRIM_ARRAY (310, double);
    SphericalHarmonicsGravitySource_ptr->Snm[309][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[309][  1] = -3.8571678122017E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[309][  2] = -1.3210757559482E-10;
@@ -114924,8 +113590,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[309][307] = -1.7782465976498E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[309][308] = -5.4054521401125E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[309][309] = -6.7355198674136E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[310] =
-      JEOD_ALLOC_PRIM_ARRAY (311, double);
    SphericalHarmonicsGravitySource_ptr->Snm[310][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[310][  1] =  7.8531417339915E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[310][  2] = -3.1507711982316E-11;
@@ -115237,8 +113901,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[310][308] =  8.2066464797557E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[310][309] = -1.1106671277006E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[310][310] =  3.0119397918725E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[311] =
-      JEOD_ALLOC_PRIM_ARRAY (312, double);
    SphericalHarmonicsGravitySource_ptr->Snm[311][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[311][  1] =  1.9943561664630E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[311][  2] =  1.3313173647746E-10;
@@ -115551,8 +114213,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[311][309] =  1.4039651583222E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[311][310] =  1.8453877499482E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[311][311] =  7.6334587202270E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[312] =
-      JEOD_ALLOC_PRIM_ARRAY (313, double);
    SphericalHarmonicsGravitySource_ptr->Snm[312][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[312][  1] = -8.3153969887177E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[312][  2] =  1.3014618237543E-11;
@@ -115866,8 +114526,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[312][310] = -1.7664956378659E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[312][311] =  2.3059523893561E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[312][312] = -1.9634213265545E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[313] =
-      JEOD_ALLOC_PRIM_ARRAY (314, double);
    SphericalHarmonicsGravitySource_ptr->Snm[313][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[313][  1] = -1.9662775251648E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[313][  2] = -5.3465522298860E-11;
@@ -116182,8 +114840,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[313][311] = -2.2731905299370E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[313][312] = -7.0566165050205E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[313][313] = -1.1225846899289E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[314] =
-      JEOD_ALLOC_PRIM_ARRAY (315, double);
    SphericalHarmonicsGravitySource_ptr->Snm[314][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[314][  1] = -2.2311979469312E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[314][  2] = -2.2699057077017E-11;
@@ -116499,8 +115155,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[314][312] = -2.5751648646949E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[314][313] =  2.9303894647410E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[314][314] =  1.2825174649145E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[315] =
-      JEOD_ALLOC_PRIM_ARRAY (316, double);
    SphericalHarmonicsGravitySource_ptr->Snm[315][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[315][  1] =  1.4954510888276E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[315][  2] =  4.0921060322580E-11;
@@ -116817,8 +115471,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[315][313] = -2.1692961794523E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[315][314] = -4.8343258905373E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[315][315] =  8.9093929717228E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[316] =
-      JEOD_ALLOC_PRIM_ARRAY (317, double);
    SphericalHarmonicsGravitySource_ptr->Snm[316][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[316][  1] =  8.4630312057174E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[316][  2] = -6.5803824007856E-11;
@@ -117136,8 +115788,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[316][314] =  1.9833273054393E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[316][315] = -1.7859917699304E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[316][316] =  1.4134213093262E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[317] =
-      JEOD_ALLOC_PRIM_ARRAY (318, double);
    SphericalHarmonicsGravitySource_ptr->Snm[317][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[317][  1] =  3.7903013602907E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[317][  2] = -3.4563350965919E-11;
@@ -117456,8 +116106,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[317][315] = -8.2681810474535E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[317][316] = -6.7914603883862E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[317][317] = -8.3910389537527E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[318] =
-      JEOD_ALLOC_PRIM_ARRAY (319, double);
    SphericalHarmonicsGravitySource_ptr->Snm[318][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[318][  1] = -6.4010126578519E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[318][  2] =  9.0417510730548E-11;
@@ -117777,8 +116425,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[318][316] =  1.0491967418463E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[318][317] =  4.6455847267550E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[318][318] = -2.6034387616210E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[319] =
-      JEOD_ALLOC_PRIM_ARRAY (320, double);
    SphericalHarmonicsGravitySource_ptr->Snm[319][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[319][  1] = -1.0632199453656E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[319][  2] = -5.8858390937183E-11;
@@ -118099,8 +116745,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[319][317] =  1.1860163476198E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[319][318] = -3.7263143141217E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[319][319] =  1.5359585094345E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[320] =
-      JEOD_ALLOC_PRIM_ARRAY (321, double);
    SphericalHarmonicsGravitySource_ptr->Snm[320][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[320][  1] =  6.4579985310141E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[320][  2] = -9.9636721271274E-11;
@@ -118422,8 +117066,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[320][318] = -2.3348788555137E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[320][319] =  2.8993587734394E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[320][320] = -1.6755637363523E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[321] =
-      JEOD_ALLOC_PRIM_ARRAY (322, double);
    SphericalHarmonicsGravitySource_ptr->Snm[321][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[321][  1] = -4.5347326112107E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[321][  2] =  4.4880936062833E-11;
@@ -118746,8 +117388,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[321][319] =  1.2615514122804E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[321][320] =  8.0002274183585E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[321][321] = -1.0190482007676E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[322] =
-      JEOD_ALLOC_PRIM_ARRAY (323, double);
    SphericalHarmonicsGravitySource_ptr->Snm[322][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[322][  1] =  1.0130813587490E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[322][  2] =  4.7314077663738E-11;
@@ -119071,8 +117711,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[322][320] =  1.0118080058607E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[322][321] =  1.0594310904609E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[322][322] = -6.7743634027826E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[323] =
-      JEOD_ALLOC_PRIM_ARRAY (324, double);
    SphericalHarmonicsGravitySource_ptr->Snm[323][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[323][  1] =  1.5346044536081E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[323][  2] = -1.5153836476135E-10;
@@ -119397,8 +118035,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[323][321] =  6.4554149321892E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[323][322] =  4.9281619799453E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[323][323] = -1.2787669143827E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[324] =
-      JEOD_ALLOC_PRIM_ARRAY (325, double);
    SphericalHarmonicsGravitySource_ptr->Snm[324][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[324][  1] = -1.9916305432092E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[324][  2] = -1.3591003675855E-10;
@@ -119724,8 +118360,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[324][322] = -1.0442875627109E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[324][323] = -1.1714199887567E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[324][324] = -1.5574196250894E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[325] =
-      JEOD_ALLOC_PRIM_ARRAY (326, double);
    SphericalHarmonicsGravitySource_ptr->Snm[325][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[325][  1] =  1.9911186143087E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[325][  2] =  1.8955719303360E-10;
@@ -120052,8 +118686,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[325][323] = -1.1640838863265E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[325][324] =  3.8694843104408E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[325][325] =  1.2096476821289E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[326] =
-      JEOD_ALLOC_PRIM_ARRAY (327, double);
    SphericalHarmonicsGravitySource_ptr->Snm[326][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[326][  1] =  2.2310861230109E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[326][  2] =  1.8282373062326E-10;
@@ -120381,8 +119013,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[326][324] = -6.6687460672138E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[326][325] =  4.8776990833912E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[326][326] =  4.4967386591317E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[327] =
-      JEOD_ALLOC_PRIM_ARRAY (328, double);
    SphericalHarmonicsGravitySource_ptr->Snm[327][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[327][  1] =  5.6760375594283E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[327][  2] = -1.9594499448187E-10;
@@ -120711,8 +119341,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[327][325] =  6.0539037015410E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[327][326] =  1.4357137782014E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[327][327] = -8.1022606014266E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[328] =
-      JEOD_ALLOC_PRIM_ARRAY (329, double);
    SphericalHarmonicsGravitySource_ptr->Snm[328][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[328][  1] = -1.6316322053352E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[328][  2] = -1.7374214984455E-10;
@@ -121042,8 +119670,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[328][326] = -2.1685639027098E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[328][327] = -2.1339637533332E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[328][328] =  1.7897625609943E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[329] =
-      JEOD_ALLOC_PRIM_ARRAY (330, double);
    SphericalHarmonicsGravitySource_ptr->Snm[329][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[329][  1] = -4.8251702588270E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[329][  2] =  1.1634716677977E-10;
@@ -121374,8 +120000,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[329][327] =  3.5073938844914E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[329][328] = -3.2238869626440E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[329][329] = -1.1013788739872E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[330] =
-      JEOD_ALLOC_PRIM_ARRAY (331, double);
    SphericalHarmonicsGravitySource_ptr->Snm[330][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[330][  1] =  2.8598404600964E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[330][  2] =  1.5378939004369E-10;
@@ -121707,8 +120331,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[330][328] =  1.6253108402555E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[330][329] =  1.1510776288859E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[330][330] = -2.2030132235578E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[331] =
-      JEOD_ALLOC_PRIM_ARRAY (332, double);
    SphericalHarmonicsGravitySource_ptr->Snm[331][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[331][  1] =  1.0531035701292E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[331][  2] = -9.8150785104667E-11;
@@ -122041,8 +120663,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[331][329] =  3.0036039053712E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[331][330] =  7.7283056745609E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[331][331] =  1.0615764578328E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[332] =
-      JEOD_ALLOC_PRIM_ARRAY (333, double);
    SphericalHarmonicsGravitySource_ptr->Snm[332][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[332][  1] = -1.2999443912915E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[332][  2] = -7.8365769731935E-11;
@@ -122376,8 +120996,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[332][330] =  1.3378497376984E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[332][331] =  1.3824223256566E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[332][332] = -9.2844423288423E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[333] =
-      JEOD_ALLOC_PRIM_ARRAY (334, double);
    SphericalHarmonicsGravitySource_ptr->Snm[333][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[333][  1] = -3.5140121212864E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[333][  2] =  1.2316892560125E-10;
@@ -122712,8 +121330,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[333][331] = -7.8990564182672E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[333][332] = -2.5028766215646E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[333][333] =  3.5874558421014E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[334] =
-      JEOD_ALLOC_PRIM_ARRAY (335, double);
    SphericalHarmonicsGravitySource_ptr->Snm[334][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[334][  1] =  3.5593483098251E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[334][  2] = -4.2624652642257E-11;
@@ -123049,8 +121665,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[334][332] = -8.2945049896697E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[334][333] =  4.4744261355625E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[334][334] =  5.9104546511163E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[335] =
-      JEOD_ALLOC_PRIM_ARRAY (336, double);
    SphericalHarmonicsGravitySource_ptr->Snm[335][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[335][  1] =  1.1714067724614E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[335][  2] = -1.2554172547121E-10;
@@ -123387,8 +122001,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[335][333] =  8.9392004884485E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[335][334] =  2.3032030101600E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[335][335] = -4.9103994413546E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[336] =
-      JEOD_ALLOC_PRIM_ARRAY (337, double);
    SphericalHarmonicsGravitySource_ptr->Snm[336][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[336][  1] = -3.7768436905974E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[336][  2] =  6.8930804223438E-11;
@@ -123726,8 +122338,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[336][334] =  1.9389342076069E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[336][335] = -5.3413072545866E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[336][336] =  5.4277190607929E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[337] =
-      JEOD_ALLOC_PRIM_ARRAY (338, double);
    SphericalHarmonicsGravitySource_ptr->Snm[337][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[337][  1] =  9.0583443413672E-13;
    SphericalHarmonicsGravitySource_ptr->Snm[337][  2] =  1.0550478794742E-10;
@@ -124066,8 +122676,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[337][335] = -1.3873108019112E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[337][336] =  7.3073452779833E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[337][337] =  1.2847251973642E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[338] =
-      JEOD_ALLOC_PRIM_ARRAY (339, double);
    SphericalHarmonicsGravitySource_ptr->Snm[338][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[338][  1] =  3.0600373273951E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[338][  2] = -1.0944429608537E-10;
@@ -124407,8 +123015,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[338][336] =  1.2631431929207E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[338][337] = -2.7076155445096E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[338][338] = -4.6255567031876E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[339] =
-      JEOD_ALLOC_PRIM_ARRAY (340, double);
    SphericalHarmonicsGravitySource_ptr->Snm[339][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[339][  1] =  3.2141946723602E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[339][  2] = -4.0650687553118E-11;
@@ -124749,8 +123355,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[339][337] = -2.2783063538726E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[339][338] =  1.2145596574599E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[339][339] = -6.0119775942844E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[340] =
-      JEOD_ALLOC_PRIM_ARRAY (341, double);
    SphericalHarmonicsGravitySource_ptr->Snm[340][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[340][  1] =  1.0680676382985E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[340][  2] =  1.3276343388146E-10;
@@ -125092,8 +123696,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[340][338] = -3.1916417114164E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[340][339] =  6.0067838619710E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[340][340] =  1.5578207690451E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[341] =
-      JEOD_ALLOC_PRIM_ARRAY (342, double);
    SphericalHarmonicsGravitySource_ptr->Snm[341][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[341][  1] =  1.4268039184306E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[341][  2] =  6.4312267964015E-12;
@@ -125436,8 +124038,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[341][339] =  2.6848853871837E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[341][340] = -5.3699376045035E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[341][341] = -5.8068394849847E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[342] =
-      JEOD_ALLOC_PRIM_ARRAY (343, double);
    SphericalHarmonicsGravitySource_ptr->Snm[342][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[342][  1] = -7.8718159871861E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[342][  2] = -1.5908916254294E-10;
@@ -125781,8 +124381,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[342][340] =  3.2523388882332E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[342][341] = -1.3330009619954E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[342][342] = -6.1995624074076E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[343] =
-      JEOD_ALLOC_PRIM_ARRAY (344, double);
    SphericalHarmonicsGravitySource_ptr->Snm[343][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[343][  1] = -7.3449367988359E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[343][  2] = -8.4635288311461E-11;
@@ -126127,8 +124725,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[343][341] = -3.4692751253656E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[343][342] = -2.1802868370506E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[343][343] = -1.8331052787959E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[344] =
-      JEOD_ALLOC_PRIM_ARRAY (345, double);
    SphericalHarmonicsGravitySource_ptr->Snm[344][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[344][  1] =  6.0011193491967E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[344][  2] =  1.3010625016114E-10;
@@ -126474,8 +125070,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[344][342] =  4.8022971981302E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[344][343] = -7.4343180242238E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[344][344] = -1.4774690664529E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[345] =
-      JEOD_ALLOC_PRIM_ARRAY (346, double);
    SphericalHarmonicsGravitySource_ptr->Snm[345][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[345][  1] =  5.8596356231820E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[345][  2] =  4.1660348430286E-11;
@@ -126822,8 +125416,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[345][343] = -4.0825941293291E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[345][344] =  1.8747684557437E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[345][345] =  1.3563282131674E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[346] =
-      JEOD_ALLOC_PRIM_ARRAY (347, double);
    SphericalHarmonicsGravitySource_ptr->Snm[346][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[346][  1] = -4.7526049838902E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[346][  2] =  1.4026877222168E-11;
@@ -127171,8 +125763,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[346][344] =  1.7070352607843E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[346][345] = -1.7147326531527E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[346][346] =  1.2819799427527E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[347] =
-      JEOD_ALLOC_PRIM_ARRAY (348, double);
    SphericalHarmonicsGravitySource_ptr->Snm[347][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[347][  1] = -9.6196356151580E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[347][  2] =  1.3138570088697E-10;
@@ -127521,8 +126111,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[347][345] = -2.5771376092339E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[347][346] = -3.9895396592821E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[347][347] = -6.2363351741575E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[348] =
-      JEOD_ALLOC_PRIM_ARRAY (349, double);
    SphericalHarmonicsGravitySource_ptr->Snm[348][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[348][  1] =  4.1530548850598E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[348][  2] = -5.7375109207338E-11;
@@ -127872,8 +126460,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[348][346] = -9.8269917209297E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[348][347] =  2.8002774919849E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[348][348] =  8.2192179973755E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[349] =
-      JEOD_ALLOC_PRIM_ARRAY (350, double);
    SphericalHarmonicsGravitySource_ptr->Snm[349][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[349][  1] =  1.0908840957632E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[349][  2] = -1.4501780166515E-10;
@@ -128224,8 +126810,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[349][347] = -1.4798149857066E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[349][348] =  2.7900890712028E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[349][349] = -7.7835418251155E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[350] =
-      JEOD_ALLOC_PRIM_ARRAY (351, double);
    SphericalHarmonicsGravitySource_ptr->Snm[350][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[350][  1] = -5.9367555710738E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[350][  2] =  3.0600636405784E-11;
@@ -128577,8 +127161,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[350][348] =  2.0586467468838E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[350][349] = -1.2505311509235E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[350][350] =  3.0231154132678E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[351] =
-      JEOD_ALLOC_PRIM_ARRAY (352, double);
    SphericalHarmonicsGravitySource_ptr->Snm[351][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[351][  1] = -2.8948310901096E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[351][  2] =  1.4687613197252E-10;
@@ -128931,8 +127513,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[351][349] =  7.1771697834825E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[351][350] =  1.6393160815632E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[351][351] = -5.0587699365094E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[352] =
-      JEOD_ALLOC_PRIM_ARRAY (353, double);
    SphericalHarmonicsGravitySource_ptr->Snm[352][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[352][  1] =  8.8906827461038E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[352][  2] = -7.9359906704486E-12;
@@ -129286,8 +127866,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[352][350] = -2.7796986049093E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[352][351] = -1.2284301232804E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[352][352] = -8.0510022479926E-12;
-   SphericalHarmonicsGravitySource_ptr->Snm[353] =
-      JEOD_ALLOC_PRIM_ARRAY (354, double);
    SphericalHarmonicsGravitySource_ptr->Snm[353][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[353][  1] = -6.6299410593747E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[353][  2] = -1.4362371136590E-10;
@@ -129642,8 +128220,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[353][351] = -1.1906931273214E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[353][352] =  2.8337127576879E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[353][353] = -4.9044066588905E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[354] =
-      JEOD_ALLOC_PRIM_ARRAY (355, double);
    SphericalHarmonicsGravitySource_ptr->Snm[354][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[354][  1] = -4.8402545256118E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[354][  2] =  7.2436781335328E-12;
@@ -129999,8 +128575,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[354][352] =  7.7236807064826E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[354][353] = -2.6862359706344E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[354][354] =  9.9209099907045E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[355] =
-      JEOD_ALLOC_PRIM_ARRAY (356, double);
    SphericalHarmonicsGravitySource_ptr->Snm[355][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[355][  1] =  6.1992665604908E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[355][  2] =  7.5899817862828E-11;
@@ -130357,8 +128931,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[355][353] =  2.2068580813028E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[355][354] = -1.0144331741584E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[355][355] =  1.9951060322860E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[356] =
-      JEOD_ALLOC_PRIM_ARRAY (357, double);
    SphericalHarmonicsGravitySource_ptr->Snm[356][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[356][  1] = -7.5773518467314E-12;
    SphericalHarmonicsGravitySource_ptr->Snm[356][  2] =  3.8704529182264E-11;
@@ -130716,8 +129288,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[356][354] =  1.3905824468788E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[356][355] = -3.3059998158665E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[356][356] = -2.2701561972002E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[357] =
-      JEOD_ALLOC_PRIM_ARRAY (358, double);
    SphericalHarmonicsGravitySource_ptr->Snm[357][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[357][  1] = -9.8883778506716E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[357][  2] = -7.7253277137501E-11;
@@ -131076,8 +129646,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[357][355] = -1.9300285723553E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[357][356] =  1.1769358218768E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[357][357] =  4.3143094617732E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[358] =
-      JEOD_ALLOC_PRIM_ARRAY (359, double);
    SphericalHarmonicsGravitySource_ptr->Snm[358][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[358][  1] =  5.3752632060997E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[358][  2] = -2.7646713018283E-11;
@@ -131437,8 +130005,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[358][356] =  1.3277908985817E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[358][357] =  5.3779729530335E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[358][358] =  3.0318721460549E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[359] =
-      JEOD_ALLOC_PRIM_ARRAY (360, double);
    SphericalHarmonicsGravitySource_ptr->Snm[359][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[359][  1] =  7.1341353980519E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[359][  2] =  1.0495825430820E-10;
@@ -131799,8 +130365,6 @@ SphericalHarmonicsGravitySource_earth_GGM05C_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[359][357] =  1.2043779746780E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[359][358] = -2.3835818869685E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[359][359] =  2.0955755186030E-11;
-   SphericalHarmonicsGravitySource_ptr->Snm[360] =
-      JEOD_ALLOC_PRIM_ARRAY (361, double);
    SphericalHarmonicsGravitySource_ptr->Snm[360][  0] =  0.0000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[360][  1] =  2.4706773467012E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[360][  2] =  2.9969554417701E-11;
@@ -60,39 +60,29 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    // C20 does not include the permanent tide
 
    SphericalHarmonicsGravitySource_ptr->Cnm =
-      JEOD_ALLOC_PRIM_ARRAY (110 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (110 + 1, 0, double);
    SphericalHarmonicsGravitySource_ptr->Snm =
-      JEOD_ALLOC_PRIM_ARRAY (110 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (110 + 1, 0, double);
 
    /* FULLY NORMALIZED GRAVITY COEFFICIENTS (unitless) */
-   SphericalHarmonicsGravitySource_ptr->Cnm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  0] = -8.750219729111999E-04;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  1] = +3.923929656546999E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  2] = -8.463591454722000E-05;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  0] = -1.189641481101000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  1] = +3.804277962386999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  2] = -1.594791937546000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  3] = +3.505407245670000E-05;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  0] = +5.128947217438000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  1] = +4.216315587579000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  2] = -9.525241716841000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  3] = +6.456858708429001E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  4] = +3.097574348815999E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  0] = -1.726706781747000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  1] = +4.837754266083001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  2] = -4.298110544756000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  3] = +3.312677273764000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  4] = -4.640374993623000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  5] = -4.449808341599000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  0] = +1.346787349235000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  1] = +1.802413580679000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  2] = +8.616576806636999E-07;
@@ -100,8 +90,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  4] = +1.008426564787000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  5] = +1.657662285489000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  6] = +2.762082681356000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  0] = +1.059712482908000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  1] = +1.374984137137000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  2] = +2.814037279304000E-06;
@@ -110,8 +98,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  5] = -1.914859101531000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  6] = -5.592505046381999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  7] = +4.407569048856999E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  0] = +1.444690009542000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  1] = -1.325387619549000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  2] = +1.810382695387000E-06;
@@ -121,8 +107,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  6] = -9.140851046548999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  7] = -4.739808274381000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  8] = -3.106078818322000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  0] = -2.875414825120000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  1] = +4.209606565471001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  2] = +1.138692140100000E-06;
@@ -133,8 +117,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  7] = -6.181247756444001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  8] = +1.208112662615000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  9] = -1.171729828978000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  0] = +7.268658731984000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  1] = +9.239956137450001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  2] = +7.073142215433002E-09;
@@ -146,8 +128,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  8] = +5.404199528255001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  9] = -1.457150664370000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][ 10] = -2.749975343666000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  0] = -2.661719220798000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  1] = -8.168978582526000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  2] = -3.135307339211000E-07;
@@ -160,8 +140,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  9] = -4.151054758149000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 10] = +3.327322787247000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 11] = -4.485423889965000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  0] = +2.603086516497000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  1] = -1.126800228693000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  2] = -9.758431888685998E-08;
@@ -175,8 +153,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 10] = +4.881145599581001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 11] = +8.652909757823998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 12] = -6.654357368697999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  0] = -4.906145120844001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  1] = -5.695875079727001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  2] = +1.920050917969000E-07;
@@ -191,8 +167,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 11] = +7.628110892928001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 12] = -1.457142357197000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 13] = +4.277537860242001E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  0] = +3.016291318083000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  1] = +7.544010027642000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  2] = +4.508410306668001E-07;
@@ -208,8 +182,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 12] = -4.486019730913999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 13] = +7.541906675263000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 14] = +4.731249352444999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  0] = +4.945376795421000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  1] = +2.351879806706000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  2] = -3.534039447767000E-07;
@@ -226,8 +198,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 13] = +1.793323733452000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 14] = +2.231397180078000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 15] = -3.397850803754001E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  0] = +6.254311264818000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  1] = -2.348100509283000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  2] = -4.826504108595000E-07;
@@ -245,8 +215,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 14] = -1.700651037464000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 15] = -8.591033699606999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 16] = +2.101960530637999E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  0] = -5.393007009249001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  1] = -3.738401787569000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  2] = -2.029216720008000E-07;
@@ -265,8 +233,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 15] = -3.659864786545001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 16] = +1.075051758869000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 17] = +5.490197316909999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  0] = -3.150118402388000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  1] = -1.812611798013000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  2] = -1.058157468101000E-07;
@@ -286,8 +252,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 16] = +4.140785273250000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 17] = +7.137599846622002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 18] = +4.689290440409001E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  0] = +7.552099095080000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  1] = +4.663261935124999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  2] = -5.248829644242000E-08;
@@ -308,8 +272,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 17] = -1.174377912588000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 18] = -7.258893496945000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 19] = -3.669424020330000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  0] = +3.005713248613000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  1] = +1.848010779434000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  2] = +7.005301488589000E-08;
@@ -331,8 +293,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 18] = +3.561629640030000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 19] = +1.762652831118000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 20] = -4.767461119640000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  0] = +1.265236658225000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  1] = -1.491173766218000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  2] = -9.384901281640001E-08;
@@ -355,8 +315,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 19] = +1.835673289381000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 20] = -1.240563300062000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 21] = +6.720936267769001E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  0] = -1.120411482154000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  1] = -4.039847360051001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  2] = +1.028653818450000E-07;
@@ -380,8 +338,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 20] = -4.391236064108000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 21] = +2.285421458818000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 22] = -1.152209105427000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  0] = +4.872201225189000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  1] = +2.459044338470000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  2] = +1.969039301503000E-07;
@@ -406,8 +362,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 21] = +4.443250931617001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 22] = +1.726197545307000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 23] = -5.550474675028000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  0] = +2.667046045590999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  1] = +1.912991822676000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  2] = +1.921581433398000E-08;
@@ -433,8 +387,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 22] = -1.063403451211000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 23] = -5.929839343422000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 24] = +2.757476679682000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  0] = -1.427281222974000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  1] = -7.838347514467997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  2] = -1.738175312973000E-07;
@@ -461,8 +413,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 23] = -5.170562110451000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 24] = +3.302174975621000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 25] = +1.398174589075000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  0] = -1.801395005430000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  1] = -1.914904155943000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  2] = -2.037887791105000E-07;
@@ -490,8 +440,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 24] = +7.338900677176999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 25] = +2.783262269724000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 26] = -1.590009234911000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  0] = -2.251181587997000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  1] = +5.739651902478999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  2] = -1.338768421420000E-09;
@@ -520,8 +468,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 25] = -9.678671648696000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 26] = -2.891032953154000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 27] = +5.037264915660000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  0] = +3.676014190607000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  1] = +1.574686311922000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  2] = +3.112047884041000E-07;
@@ -551,8 +497,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 26] = -3.811669993157001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 27] = +5.241163024238001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 28] = -1.381129276747000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  0] = +9.837062521981000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  1] = +7.246299706001000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  2] = +8.040509427027999E-08;
@@ -583,8 +527,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 27] = +4.783695384719000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 28] = -3.810234273368001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 29] = -1.556186102919000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  0] = +1.423657106750000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  1] = -1.471200615172000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  2] = -1.926948569388000E-07;
@@ -616,8 +558,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 28] = -2.241437125100000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 29] = +1.780926607528000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 30] = +8.391141630090001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  0] = +1.188784780923000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  1] = -6.516239474630002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  2] = +8.446128314377001E-08;
@@ -650,8 +590,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 29] = -7.768456752720000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 30] = +2.439458530266000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 31] = -2.013358974494000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  0] = +1.461305560777000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  1] = -6.944272083802000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  2] = +1.361464627187000E-07;
@@ -685,8 +623,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 30] = +1.642773842100000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 31] = +1.102081402904000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 32] = +8.795865434683002E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  0] = -1.015456827706000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  1] = -4.185187155155001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  2] = +5.908181287034999E-08;
@@ -721,8 +657,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 31] = -1.655561273143000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 32] = +4.193528233370000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 33] = +5.932657641940999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  0] = -1.239111152953000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  1] = +7.017781454670999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  2] = -1.071056090282000E-07;
@@ -758,8 +692,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 32] = +1.210070877585000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 33] = -3.860134260383999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 34] = +5.352185568004999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  0] = +2.725909625825000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  1] = +7.217457664139002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  2] = -4.192868077640001E-08;
@@ -796,8 +728,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 33] = -8.397910552267002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 34] = +1.421942922024000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 35] = +1.101554286204000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  0] = +1.773337428250000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  1] = -8.956527544372001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  2] = +1.122132814713000E-07;
@@ -835,8 +765,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 34] = -8.929324592960000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 35] = +1.933293703595000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 36] = -7.191205979784998E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  0] = -6.328398408667001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  1] = -1.012193328182000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  2] = +5.653889673995000E-08;
@@ -875,8 +803,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 35] = +2.144088287167000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 36] = -2.989564920943000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 37] = -8.676869016601000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  0] = -1.563654331589000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  1] = -2.321411793033000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  2] = -1.889079431330000E-08;
@@ -916,8 +842,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 36] = -1.051112342138000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 37] = +2.502410711566000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 38] = +1.357317660291000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  0] = +6.318899831805000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  1] = +1.353469664755000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  2] = -9.459261163743003E-11;
@@ -958,8 +882,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 37] = -6.126324357300002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 38] = +2.410693364198000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 39] = -1.318501349803000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  0] = +1.182308078788000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  1] = +3.613144008188000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  2] = -3.631592142623000E-08;
@@ -1001,8 +923,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 38] = +1.083219934496000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 39] = -1.355231081191000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 40] = -2.854603957790000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  0] = +8.061701239839000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  1] = -4.123580477743999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  2] = +5.629046099611001E-08;
@@ -1045,8 +965,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 39] = -4.909873862041000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 40] = +7.525121934189000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 41] = +6.904000689095000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  0] = -1.673819926419000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  1] = -2.660942234026000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  2] = -9.510558942285003E-10;
@@ -1090,8 +1008,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 40] = -4.289491596358000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 41] = +9.993519855968000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 42] = +9.433455269571002E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  0] = +3.177737494047999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  1] = +1.028829484578000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  2] = -3.670579396277001E-08;
@@ -1136,8 +1052,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 41] = +9.317626671906998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 42] = -1.376659202778000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 43] = -1.154998239085000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  0] = +7.399109470977000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  1] = +7.720483726285999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  2] = -3.614650376703999E-08;
@@ -1183,8 +1097,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 42] = +6.517056463443999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 43] = -1.968368196574000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 44] = +1.674846900607000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  0] = -2.762735344701000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  1] = -9.382837225286000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  2] = -6.826367914010000E-08;
@@ -1231,8 +1143,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 43] = +5.720875432983999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 44] = +2.603777626339000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 45] = +1.451780309712000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  0] = +7.060227276663001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  1] = -2.478633970313001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  2] = -3.381352377136000E-08;
@@ -1280,8 +1190,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 44] = -1.624739644053000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 45] = +1.331460058169000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 46] = -1.422772902249000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  0] = +2.478356999827000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  1] = +3.690946962151001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  2] = -7.592472182899001E-09;
@@ -1330,8 +1238,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 45] = -2.200586061778000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 46] = +2.230594552538000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 47] = +1.423220669064000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  0] = -7.700952714153999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  1] = -2.517652185409000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  2] = -6.323346448702000E-08;
@@ -1381,8 +1287,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 46] = -4.320395815937000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 47] = -5.675297940868001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 48] = +1.322515789747000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  0] = -1.844304345315000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  1] = -5.057282692802999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  2] = -4.840780779160999E-08;
@@ -1433,8 +1337,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 47] = -3.738495247516001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 48] = +1.216290086340000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 49] = -8.184942810594000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  0] = +6.996266150573000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  1] = -9.549595520746997E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  2] = +2.870894507165000E-08;
@@ -1486,8 +1388,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 48] = +8.399779856542999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 49] = +2.638925034776000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 50] = -8.013649422423002E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  0] = +1.644351649630000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  1] = -1.649893371537000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  2] = +6.512089921178999E-09;
@@ -1540,8 +1440,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 49] = -2.832244242762000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 50] = -7.987591755851997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 51] = +7.472710486132001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  0] = -4.103609437523000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  1] = -8.362808690409999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  2] = -2.793315179822000E-08;
@@ -1595,8 +1493,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 50] = -7.939766892960001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 51] = +1.132718489500000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 52] = -1.123376998479000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  0] = -3.593433386071001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  1] = -2.705918279319000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  2] = +6.630425512837001E-10;
@@ -1651,8 +1547,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 51] = +2.874095070965000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 52] = +1.109281779322000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 53] = -7.162357383294001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  0] = +3.331365426317000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  1] = +2.852017464569000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  2] = +4.360166604123999E-08;
@@ -1708,8 +1602,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 52] = +5.340542667217001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 53] = -5.430845316483000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 54] = +2.595552188160000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  0] = -1.537667724099000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  1] = -1.210525743568000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  2] = -1.100221585287000E-08;
@@ -1766,8 +1658,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 53] = +6.037391941108000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 54] = -4.341281775652000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 55] = -7.023553775590998E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  0] = -2.936348209694000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  1] = -8.255052909335001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  2] = -1.104963135690000E-08;
@@ -1825,8 +1715,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 54] = +6.861874156033000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 55] = +1.375363636836000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 56] = -4.041745898534999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  0] = +4.527265688618999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  1] = -3.021891110795000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  2] = +3.231579322251999E-08;
@@ -1885,8 +1773,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 55] = -1.342787124523000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 56] = -4.399139987503999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 57] = +6.640263113663001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  0] = +2.674378391870000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  1] = +1.289177412228000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  2] = +1.417286258507000E-08;
@@ -1946,8 +1832,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 56] = +1.516979381218000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 57] = -6.517999926710000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 58] = +3.226657654413001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  0] = -3.905216907499000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  1] = -3.220517451801000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  2] = -2.463303550552000E-08;
@@ -2008,8 +1892,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 57] = -2.831800627565000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 58] = +4.166358551398000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 59] = -5.218315163163000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  0] = -6.901633124320000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  1] = -2.248162260209000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  2] = -4.074366450981999E-09;
@@ -2071,8 +1953,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 58] = -4.040417101568001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 59] = +1.550949605540000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 60] = +3.104262437917000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  0] = +3.678193470457001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  1] = +3.546854192253000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  2] = +2.671235431930000E-08;
@@ -2135,8 +2015,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 59] = +4.035029096746000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 60] = -7.559392673561000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 61] = +4.149026955798000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  0] = -3.037258039690000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  1] = -3.832602455104999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  2] = +2.054322645278000E-09;
@@ -2200,8 +2078,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 60] = +3.633805066108001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 61] = +1.919465918539000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 62] = -1.476641979825000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  0] = -3.386848129595999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  1] = -1.192459775446000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  2] = -1.595061435835000E-08;
@@ -2266,8 +2142,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 61] = -5.972019904067000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 62] = +1.458332830854000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 63] = -6.071466378107000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  0] = +3.867969270322000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  1] = +7.958369740582000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  2] = +1.499729258276000E-08;
@@ -2333,8 +2207,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 62] = +6.211101559718999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 63] = -1.050738123382000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 64] = +1.073469674539000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  0] = +3.342854432109999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  1] = +2.352887037629000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  2] = +4.476944653334999E-08;
@@ -2401,8 +2273,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 63] = +4.632312298723001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 64] = +1.908307450725000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 65] = -3.584188604549000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  0] = -2.100574954833000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  1] = +4.680436534956000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  2] = +6.699871550076999E-09;
@@ -2470,8 +2340,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 64] = -4.443228840787000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 65] = +4.118793793779000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 66] = -2.217765710508000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  0] = -3.629355233838000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  1] = -1.863249874360000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  2] = -3.171427940274001E-08;
@@ -2540,8 +2408,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 65] = +2.733619589834000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 66] = -2.556735379908000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 67] = +3.658842128870999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  0] = +5.001851988755998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  1] = +1.060478632664000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  2] = +3.580297386580000E-09;
@@ -2611,8 +2477,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 66] = +4.323004361811000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 67] = -1.744159519369000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 68] = +1.917124917479000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  0] = +3.186723609602000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  1] = +1.569541532655000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  2] = +3.031615216830000E-08;
@@ -2683,8 +2547,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 67] = -8.122268457819001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 68] = -4.128624536303000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 69] = -2.289099295023000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  0] = -2.738757939257001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  1] = -2.616790111282001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  2] = -8.319701166954998E-09;
@@ -2756,8 +2618,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 68] = +3.706822434230999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 69] = -7.966681565228001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 70] = -1.051384848777000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  0] = -2.482225607927001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  1] = -1.729053001049000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  2] = -1.593514353639000E-08;
@@ -2830,8 +2690,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 69] = +4.775178329485001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 70] = +2.620386087992999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 71] = -2.539699979802000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  0] = +3.073226718084000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  1] = +2.551728505581000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  2] = +1.251863582932000E-08;
@@ -2905,8 +2763,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 70] = -4.842571175470001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 71] = +1.820054073807000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 72] = +4.453855449017000E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  0] = +7.209106587569002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  1] = +1.252827399322000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  2] = +1.773147437147000E-08;
@@ -2981,8 +2837,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 71] = -9.824239244943999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 72] = -4.884313150901000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 73] = +2.657561396675001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  0] = +2.478406110088000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  1] = -1.685112569858000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  2] = -5.250601646233999E-09;
@@ -3058,8 +2912,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 72] = +5.486536940631001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 73] = +9.175398494590997E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 74] = +9.084142048553999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  0] = +2.945756863708000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  1] = -1.601027782226000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  2] = -1.369608306132000E-08;
@@ -3136,8 +2988,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 73] = -1.936823974916000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 74] = -5.922805349822001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 75] = -1.594575459683000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  0] = -1.681265324654000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  1] = +1.355244300543000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  2] = -2.143553208805000E-08;
@@ -3215,8 +3065,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 74] = -2.792889557438000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 75] = +2.306200622028001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 76] = -6.061739711994001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  0] = -1.115375342194000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  1] = +6.442887366184000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  2] = +1.867401082038000E-09;
@@ -3295,8 +3143,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 75] = +2.023349343809000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 76] = +3.336416456631000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 77] = -1.332476394601001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  0] = +3.475834826073999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  1] = +5.452597615559000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  2] = +8.118953618879001E-09;
@@ -3376,8 +3222,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 76] = +1.151572266084000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 77] = -2.521420552299000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 78] = -3.929124795951999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  0] = -8.142133538545998E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  1] = +5.767131712413001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  2] = +9.876739195996999E-09;
@@ -3458,8 +3302,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 77] = -1.717040342417000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 78] = -1.660237162849000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 79] = +2.938495748458999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  0] = +5.666769079026000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  1] = +8.084056843792999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  2] = -2.940755833301000E-09;
@@ -3541,8 +3383,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 78] = -9.135599493575002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 79] = +6.492709316971002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 80] = +7.262814083976999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  0] = -4.467755671947000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  1] = -1.620093286737000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  2] = +1.270140241473000E-09;
@@ -3625,8 +3465,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 79] = +2.282093649107000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 80] = -2.344262725191000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 81] = -2.044897240705000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  0] = +1.010575083928000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  1] = -1.736650497902000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  2] = +1.811294738267000E-08;
@@ -3710,8 +3548,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 80] = -2.176441735141000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 81] = -1.031741286784000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 82] = +1.954405959651000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  0] = -4.498581007519000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  1] = +1.405781491905000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  2] = +1.524027608508000E-08;
@@ -3796,8 +3632,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 81] = -7.333860372204002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 82] = +2.758760672657000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 83] = +1.801513115879000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  0] = -4.494881081814000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  1] = +6.306495319582001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  2] = -3.557489652654000E-09;
@@ -3883,8 +3717,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 82] = -7.583934339231999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 83] = -1.009152870983000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 84] = -8.308934313466999E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  0] = -1.860737156277000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  1] = -9.792132165801998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  2] = +8.917887600556001E-09;
@@ -3971,8 +3803,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 83] = +1.232833477273000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 84] = -1.563964310201001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 85] = -7.208141622011000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  0] = +5.444405656599001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  1] = +8.062919638158001E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  2] = +9.583112213533997E-09;
@@ -4060,8 +3890,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 84] = +5.783487799652000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 85] = +8.900054559838001E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 86] = -1.254707001394000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  0] = +1.703692688765000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  1] = +2.288766758125001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  2] = -7.285025279253000E-09;
@@ -4150,8 +3978,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 85] = +5.405877709723001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 86] = +9.706248267705998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 87] = +2.157385189226000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  0] = -1.369864236496000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  1] = -5.613138959701001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  2] = +3.533208347700999E-09;
@@ -4241,8 +4067,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 86] = -1.141267723755000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 87] = -1.363380721615000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 88] = -6.634412944003998E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  0] = -1.129025303327000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  1] = -2.174305240994000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  2] = +1.870980080603000E-08;
@@ -4333,8 +4157,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 87] = -4.972159355762001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 88] = -1.615939898188000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 89] = -1.577501556180000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  0] = -7.085952556087001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  1] = +3.751079171043001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  2] = +1.020358821179000E-09;
@@ -4426,8 +4248,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 88] = +9.525013306743000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 89] = +1.288463443234000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 90] = -3.911382290125001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  0] = -4.740649959970000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  1] = +3.102489796926001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  2] = -8.205206028413000E-09;
@@ -4520,8 +4340,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 89] = -6.456149516116000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 90] = +1.394181960767000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 91] = +5.346745836295000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  0] = -5.166022758322000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  1] = +1.960653382427000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  2] = -1.893095124192000E-08;
@@ -4615,8 +4433,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 90] = -1.385784263699000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 91] = -8.070824059695003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 92] = +1.626678083388000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  0] = +2.063241024234000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  1] = +2.518309715508000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  2] = -7.778955370778002E-09;
@@ -4711,8 +4527,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 91] = -4.100140218120000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 92] = -3.574294750610000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 93] = +9.002025533742001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  0] = +7.647230594956000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  1] = -1.259211216189000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  2] = +6.806486070393001E-09;
@@ -4808,8 +4622,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 92] = -7.851699702396000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 93] = +1.851441252109000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 94] = -2.213378147040000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  0] = -1.158903560107000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  1] = +8.661491559298002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  2] = -9.454365190580000E-09;
@@ -4906,8 +4718,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 93] = -1.032958503931000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 94] = +2.132957147528000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 95] = +5.535415160653000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  0] = -8.517692614569999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  1] = +2.036759200490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  2] = -1.181622471002000E-08;
@@ -5005,8 +4815,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 94] = -1.052347182745000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 95] = -1.751687495254000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 96] = +3.993330143283000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  0] = -9.184445274058001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  1] = +2.681940611153999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  2] = +5.892481425006000E-09;
@@ -5105,8 +4913,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 95] = +9.878562609668997E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 96] = -6.226972589684000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 97] = -1.058137451170000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  0] = -7.182779328319999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  1] = +7.246197826282000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  2] = -1.122327361495000E-08;
@@ -5206,8 +5012,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 96] = +1.038445781726000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 97] = -1.650339569005000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 98] = -2.449825707774000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  0] = +3.288917582549999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  1] = +1.143196037296000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  2] = -6.928542707492000E-09;
@@ -5308,8 +5112,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 97] = -4.888045832108000E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 98] = -5.143590575808000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 99] = +8.195509581553003E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  0] = -8.405978419545001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  1] = +1.100946730562000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  2] = -8.998229309501002E-09;
@@ -5411,8 +5213,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 98] = +5.829962853231000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 99] = -4.529994121573001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][100] = -5.160986678560999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  0] = +3.867010210617001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  1] = +1.486707872844000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  2] = -1.115695571252000E-08;
@@ -5515,8 +5315,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[101][ 99] = +1.151023593803000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][100] = +1.037481526642000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][101] = -5.495413576830001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  0] = -6.190712997447001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  1] = +2.002053350003000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  2] = -5.397433441309001E-09;
@@ -5620,8 +5418,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[102][100] = +1.370819590361000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][101] = +1.238195374463000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][102] = -2.069180197466999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  0] = +6.594670547864999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  1] = +3.696951279651000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  2] = +3.169273849840999E-09;
@@ -5726,8 +5522,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[103][101] = -7.124121446450999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][102] = +1.174089277086000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][103] = -3.053572820651999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  0] = -3.086953057154001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  1] = +1.684690024668000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  2] = -6.902664348097999E-09;
@@ -5833,8 +5627,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[104][102] = -5.321395969460001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][103] = -1.632558223371000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][104] = -4.124443769952001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  0] = -1.309976095263000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  1] = +2.775950434107000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  2] = -4.248473473939001E-09;
@@ -5941,8 +5733,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[105][103] = +1.672204636625000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][104] = +7.580927969865999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][105] = -1.570165865387001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  0] = +2.166127131238000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  1] = +1.800046121491000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  2] = +5.129766052829999E-09;
@@ -6050,8 +5840,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[106][104] = -3.498721092946000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][105] = +2.362167895092000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][106] = +3.349653305494000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  0] = +4.624903821756000E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  1] = -3.146921799475000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  2] = -7.353601705077999E-09;
@@ -6160,8 +5948,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[107][105] = -1.670942935822000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][106] = -5.753855758538000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][107] = +1.711266527197001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  0] = +7.897761116170000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  1] = +2.112087002484000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  2] = +7.800210521058001E-09;
@@ -6271,8 +6057,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[108][106] = -2.640977489038000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][107] = -1.653688903716000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][108] = +8.189573248567000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  0] = +2.789769877050000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  1] = -9.604821493143000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  2] = -2.203603933880000E-08;
@@ -6383,8 +6167,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[109][107] = +1.682558340762000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][108] = +1.502965247921000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][109] = +1.536393722222000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  0] = -5.893842568938999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  1] = +3.342020892030000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  2] = +1.733939340487000E-08;
@@ -6497,34 +6279,24 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[110][109] = -2.981044672490000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][110] = +1.582655159392000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  1] = -4.078058352705000E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  2] = +4.893448966831000E-05;
-   SphericalHarmonicsGravitySource_ptr->Snm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  1] = +2.517723939590000E-05;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  2] = +8.361425579193002E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  3] = +2.557438692825000E-05;
-   SphericalHarmonicsGravitySource_ptr->Snm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  1] = +3.763373133749000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  2] = -8.980875252919002E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  3] = -1.932002183296000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  4] = -1.287302503160000E-05;
-   SphericalHarmonicsGravitySource_ptr->Snm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  1] = +2.123118822517000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  2] = -1.165925434385000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  3] = +2.717222477058000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  4] = -3.382102331423000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  5] = +3.779827526790000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  1] = -1.518455793064000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  2] = +1.469139271730000E-06;
@@ -6532,8 +6304,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  4] = +2.638783027213000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  5] = +1.622919232268000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  6] = +8.218361986049001E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  1] = -2.272948246138000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  2] = -6.295441017390001E-07;
@@ -6542,8 +6312,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  5] = -1.358568812459000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  6] = -1.901463606655000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  7] = -1.775580637551000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  1] = +7.505435557852000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  2] = +5.071758034228000E-07;
@@ -6553,8 +6321,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  6] = -1.790079035343000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  7] = +1.644602741992000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  8] = -2.503521256076000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  1] = -4.902300243604000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  2] = +3.822680742104001E-07;
@@ -6565,8 +6331,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  7] = +8.687897146853000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  8] = -1.461632372177000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  9] = -6.580898790623001E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  1] = +2.232369278818000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  2] = -1.115816295619000E-06;
@@ -6578,8 +6342,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  8] = +8.206831112422998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  9] = -1.463929485645000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][ 10] = +7.532015601097999E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  1] = -2.213114707868000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  2] = -9.940084615579997E-07;
@@ -6592,8 +6354,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  9] = -4.195712901761000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 10] = +1.966754019844000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 11] = -3.234815191858000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  1] = -5.125531353349999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  2] = +5.330944816138001E-07;
@@ -6607,8 +6367,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 10] = +1.378428141639000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 11] = -1.654755363823000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 12] = -8.921756201323000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  1] = +2.258557617903001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  2] = +8.537967493625999E-07;
@@ -6623,8 +6381,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 11] = -8.235850280996998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 12] = -4.304819764975000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 13] = +8.742796479069002E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  1] = +3.104431039369999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  2] = -5.236441912120999E-07;
@@ -6640,8 +6396,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 12] = -3.051225005429000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 13] = +2.068541215125000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 14] = -7.456145545657002E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  1] = +2.603720576907000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  2] = -7.842162969867999E-07;
@@ -6658,8 +6412,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 13] = +7.109520188459001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 14] = -1.363144658551000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 15] = +1.266166412197000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  1] = -5.558304850079000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  2] = -8.743319235890002E-08;
@@ -6677,8 +6429,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 14] = -9.425827157132000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 15] = +3.242787060471000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 16] = +1.205750709576000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  1] = -6.396096187072999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  2] = +1.462558310301001E-07;
@@ -6697,8 +6447,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 15] = +4.076477047857000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 16] = +5.678725514429001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 17] = +2.937943982984000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  1] = -5.823577490825000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  2] = +4.415054463252000E-08;
@@ -6718,8 +6466,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 16] = +2.238599049602000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 17] = -1.109200291557000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 18] = +3.459154360655001E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  1] = +5.087198479135001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  2] = +8.846906226409999E-08;
@@ -6740,8 +6486,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 17] = -4.377422501538001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 18] = +5.944164292408000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 19] = -8.369032049783002E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  1] = +5.542860727636998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  2] = -2.392001760224999E-07;
@@ -6763,8 +6507,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 18] = +7.280071081459000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 19] = -1.933759016257001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 20] = +6.894136977318000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  1] = -4.273332671717000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  2] = -5.594096027947999E-07;
@@ -6787,8 +6529,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 19] = -7.766266453160000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 20] = -3.147530350816000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 21] = +3.975890349212000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  1] = -1.187932933468000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  2] = +7.549624672024001E-08;
@@ -6812,8 +6552,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 20] = +5.714750690753001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 21] = +5.881464111391001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 22] = -3.268223261409999E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  1] = +7.518510067403999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  2] = +4.741266646377001E-07;
@@ -6838,8 +6576,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 21] = +6.587642748298000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 22] = -1.897072662884000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 23] = +2.287127880220000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  1] = +1.704364406838000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  2] = -1.399266598099000E-07;
@@ -6865,8 +6601,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 22] = -7.096374341725999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 23] = -1.568700706388000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 24] = +1.343946907741000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  1] = -1.663596036327000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  2] = -3.651548536256000E-07;
@@ -6893,8 +6627,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 23] = +4.282652816075000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 24] = +1.053803940151000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 25] = -2.858819541372000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  1] = -3.879495726045001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  2] = +1.462098937177000E-08;
@@ -6922,8 +6654,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 24] = +7.027019008617001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 25] = -4.168692324662001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 26] = +4.368492109051000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  1] = -4.243175345086000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  2] = +2.705074210107000E-07;
@@ -6952,8 +6682,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 25] = -5.917143769134999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 26] = +3.247056273462001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 27] = -3.458562227043999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  1] = +1.023692164035000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  2] = +2.536400474378000E-07;
@@ -6983,8 +6711,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 26] = +5.191311572232999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 27] = +4.304720537056000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 28] = -5.945304074007001E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  1] = +2.033422904444000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  2] = +3.272199340035000E-09;
@@ -7015,8 +6741,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 27] = +7.216581128599000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 28] = -2.267303649223000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 29] = +1.608209302713000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  1] = -1.808197683408000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  2] = -4.423174309045000E-08;
@@ -7048,8 +6772,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 28] = -3.411461577564000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 29] = +8.084147917208002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 30] = -7.843837759237000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  1] = -8.359906244171999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  2] = +1.358725574565000E-08;
@@ -7082,8 +6804,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 29] = +2.076214518877000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 30] = +2.074815342337999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 31] = +7.935026527960998E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  1] = -1.855308329615000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  2] = +1.842327765428000E-07;
@@ -7117,8 +6837,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 30] = -6.017177762917999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 31] = +5.520093638529000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 32] = +9.038904040439000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  1] = -9.721686985196001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  2] = +2.096030132566000E-07;
@@ -7153,8 +6871,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 31] = -2.474193860693000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 32] = -4.018043174747000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 33] = -9.570276108671000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  1] = -5.344854426677999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  2] = +4.848807619577000E-08;
@@ -7190,8 +6906,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 32] = +1.146414655673000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 33] = +2.361676283237000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 34] = +5.851887404610001E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  1] = +1.561831083483000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  2] = -6.139910483452999E-08;
@@ -7228,8 +6942,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 33] = -2.242282478897000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 34] = +3.569018703895000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 35] = +1.741251682833000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  1] = -2.687932224196000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  2] = -1.254451350617000E-07;
@@ -7267,8 +6979,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 34] = +1.422340683718000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 35] = -1.901803233504000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 36] = -2.039043115448000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  1] = -1.901208413600000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  2] = -2.486156798158000E-08;
@@ -7307,8 +7017,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 35] = +1.024728075215000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 36] = -1.887939110817000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 37] = +8.373532181887002E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  1] = -1.568604338035000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  2] = +1.196963964834000E-07;
@@ -7348,8 +7056,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 36] = -1.894722487646000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 37] = +3.290840003042001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 38] = +2.933564307571000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  1] = +1.118163207885000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  2] = +9.915795595456000E-08;
@@ -7390,8 +7096,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 37] = +8.489994062925000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 38] = -1.150572535562000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 39] = -2.346135042111000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  1] = -1.146808326964000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  2] = -8.718624230459001E-08;
@@ -7433,8 +7137,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 38] = -2.970187243852001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 39] = -2.784472430978000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 40] = +3.672744815905000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  1] = -6.183634016554000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  2] = -1.176739801068000E-07;
@@ -7477,8 +7179,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 39] = -3.053639409320000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 40] = +1.616872511575000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 41] = +1.654063321973001E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  1] = -1.543992344944000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  2] = +8.156308721901000E-08;
@@ -7522,8 +7222,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 40] = +1.419424464038000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 41] = -1.417476646709000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 42] = -9.444586847258002E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  1] = -4.760515340302001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  2] = +1.563759941534000E-07;
@@ -7568,8 +7266,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 41] = -2.253817423135000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 42] = -7.622727431222999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 43] = -1.720330752084000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  1] = +1.855609340874000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  2] = -1.041379137017000E-08;
@@ -7615,8 +7311,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 42] = -1.961581370495000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 43] = +1.046677914988000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 44] = +2.004915976535000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  1] = +6.062181389601998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  2] = -5.839093340477001E-08;
@@ -7663,8 +7357,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 43] = -9.620087932663999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 44] = -5.493553210420998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 45] = -1.092814358807000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  1] = +2.383880301134000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  2] = +4.134195351528001E-08;
@@ -7712,8 +7404,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 44] = +4.783005188136000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 45] = +2.304375023456000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 46] = -8.924560792174002E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  1] = -1.042976956198000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  2] = +6.479429774101000E-08;
@@ -7762,8 +7452,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 45] = +1.035789995051000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 46] = -6.191781002387000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 47] = +1.474924520799000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  1] = -6.279173315435000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  2] = -3.820488037062999E-08;
@@ -7813,8 +7501,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 46] = -4.329589314270000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 47] = -1.254043798047000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 48] = -1.088209869247000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  1] = +8.084087580325001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  2] = -2.086391093790000E-08;
@@ -7865,8 +7551,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 47] = +5.629272375046001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 48] = +4.182996947086000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 49] = -1.136045789767000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  1] = +2.731715643304000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  2] = +6.234839537507001E-08;
@@ -7918,8 +7602,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 48] = +3.316040432469000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 49] = -9.151290536365001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 50] = +6.732988337055000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  1] = -5.979528801361001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  2] = -1.926754132774000E-08;
@@ -7972,8 +7654,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 49] = -5.233042012740000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 50] = -3.268601980409000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 51] = +2.435769198257000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  1] = -1.213561677795000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  2] = -3.304102535206000E-08;
@@ -8027,8 +7707,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 50] = +2.525404826451001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 51] = +7.742374699325000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 52] = -7.528108737506000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  1] = +5.875034872198000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  2] = +2.631739489426001E-08;
@@ -8083,8 +7761,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 51] = +2.110383221081000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 52] = -3.920955502073999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 53] = +9.464878952463001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  1] = +4.824075711729000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  2] = +2.715774483629001E-08;
@@ -8140,8 +7816,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 52] = -2.582506506020001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 53] = -4.412659080700001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 54] = +5.243704886878000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  1] = -3.989200885770000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  2] = -3.447644085522000E-08;
@@ -8198,8 +7872,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 53] = -2.052106425035000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 54] = +7.763808070050998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 55] = -5.358496763953001E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  1] = +2.261093520277000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  2] = -2.577555511260000E-08;
@@ -8257,8 +7929,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 54] = +5.930919974386999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 55] = -4.024144985751001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 56] = +6.239893881796999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  1] = +3.774519422576000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  2] = +5.448262355511000E-08;
@@ -8317,8 +7987,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 55] = -2.912779948614000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 56] = -1.065584119540000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 57] = +6.022139293041001E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  1] = -3.482818538993000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  2] = -2.298483362725000E-08;
@@ -8378,8 +8046,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 56] = +2.078932797887000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 57] = +5.559836959294000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 58] = -6.894612908149999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  1] = -1.837557029404000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  2] = -5.760050673081000E-08;
@@ -8440,8 +8106,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 57] = -1.998845877359000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 58] = +6.935627285899000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 59] = +8.818313894183001E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  1] = +2.502994053581999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  2] = +8.381357357831000E-09;
@@ -8503,8 +8167,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 58] = +5.102786993635999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 59] = -6.257524631571001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 60] = +3.621617431502000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  1] = -2.886644883145000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  2] = +2.788570303200000E-08;
@@ -8567,8 +8229,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 59] = +1.345028560124001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 60] = +9.968091291120002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 61] = -3.316645151597999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  1] = -2.420969962791000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  2] = +1.196348850392000E-08;
@@ -8632,8 +8292,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 60] = -4.036985191936999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 61] = +5.560920012352001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 62] = -2.555785460846000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  1] = +3.330181201343000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  2] = -2.198608206674000E-08;
@@ -8698,8 +8356,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 61] = +3.530386852680000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 62] = -3.010782309985999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 63] = -1.180677215398000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  1] = +4.371871125633000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  2] = -5.971009434066998E-09;
@@ -8765,8 +8421,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 62] = +1.123519832886000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 63] = -8.544515010814002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 64] = +4.183303852458000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  1] = -1.798283310336000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  2] = -1.186780652395000E-08;
@@ -8833,8 +8487,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 63] = -4.747643998219000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 64] = +9.011268115595003E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 65] = -1.216373196792000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  1] = -4.843237097573000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  2] = -1.715370532850000E-08;
@@ -8902,8 +8554,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 64] = +2.761950471242000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 65] = -1.905803099735000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 66] = +2.844781824000000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  1] = +1.119450414592000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  2] = +2.362972452296000E-08;
@@ -8972,8 +8622,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 65] = +5.628647547092999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 66] = -4.337833795642000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 67] = +3.083336797922000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  1] = +4.008376207226000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  2] = +1.416642813175000E-08;
@@ -9043,8 +8691,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 66] = -6.402389493484000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 67] = -1.655267982385000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 68] = -2.287043100745000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  1] = -1.393077989090000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  2] = -2.831902821156000E-08;
@@ -9115,8 +8761,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 67] = -1.304984487636000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 68] = +5.990323790136001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 69] = -5.031892836152998E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  1] = -2.825401605997000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  2] = -1.680409592215000E-08;
@@ -9188,8 +8832,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 68] = +5.281269457944999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 69] = +2.682467093639001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 70] = -1.625917811665000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  1] = +2.221587078538000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  2] = +4.189932317301000E-09;
@@ -9262,8 +8904,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 69] = -5.433597803690001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 70] = +4.394470412602000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 71] = +2.171554300806000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  1] = +1.359773098831000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  2] = +2.664251725036999E-08;
@@ -9337,8 +8977,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 70] = -3.640390276405000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 71] = -2.268052441417000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 72] = +3.260310525579000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  1] = -5.122644535595001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  2] = -1.529890411220000E-08;
@@ -9413,8 +9051,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 71] = +4.786921747106002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 72] = -1.246725134274000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 73] = +7.005837194769001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  1] = +4.537250903831000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  2] = -2.622320060987000E-08;
@@ -9490,8 +9126,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 72] = +4.239040062906000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 73] = -6.169075748244000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 74] = -3.082712384424999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  1] = -3.327083552257999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  2] = +2.103132594963000E-08;
@@ -9568,8 +9202,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 73] = -4.166527075916999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 74] = +2.200621178155000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 75] = +1.681290672256000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  1] = -1.922092004384000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  2] = +1.314236799409000E-08;
@@ -9647,8 +9279,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 74] = +2.255847305152000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 75] = +2.310942430339000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 76] = -1.145436749063000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  1] = +4.397191168753000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  2] = -3.936018640866999E-09;
@@ -9727,8 +9357,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 75] = +3.699786776515000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 76] = -1.253621977405000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 77] = -1.759637445521000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  1] = +1.197928602810000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  2] = +5.986717991718001E-09;
@@ -9808,8 +9436,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 76] = -3.625043136851000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 77] = -1.585357015681000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 78] = +2.054341418059000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  1] = +9.013641812548003E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  2] = +3.664660841386000E-09;
@@ -9890,8 +9516,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 77] = -7.780605636009998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 78] = +1.236838940844000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 79] = +1.413556341736000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  1] = -1.070659720423000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  2] = -1.236467663225000E-08;
@@ -9973,8 +9597,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 78] = -2.411192661093000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 79] = -9.798254436836002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 80] = -4.453125106044001E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  1] = +1.761993586840000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  2] = +9.706666021531002E-09;
@@ -10057,8 +9679,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 79] = -4.969372697738000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 80] = +1.270532439885000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 81] = -9.428805282838000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  1] = +2.806851412698999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  2] = +3.464806891890001E-09;
@@ -10142,8 +9762,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 80] = -8.589278015365000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 81] = +1.434048598273000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 82] = +1.744303078231000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  1] = -3.996071791929000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  2] = +1.540877485649000E-08;
@@ -10228,8 +9846,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 81] = -1.103889313395000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 82] = +7.413859412904000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 83] = +2.038089107989999E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  1] = -4.983197243170000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  2] = +3.640558713080000E-09;
@@ -10315,8 +9931,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 82] = +5.344138574671000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 83] = -3.590800781084000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 84] = -1.131116194468000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  1] = +8.000096097638998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  2] = -1.529992168798000E-08;
@@ -10403,8 +10017,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 83] = +1.978722692818000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 84] = +1.249806853031000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 85] = -6.835008773025999E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  1] = +2.151044570058000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  2] = +3.925408075486001E-09;
@@ -10492,8 +10104,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 84] = -7.611445150401002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 85] = -4.341587971232000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 86] = +1.710545904931000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  1] = -7.516770693746000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  2] = -5.783858872367000E-09;
@@ -10582,8 +10192,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 85] = +3.528581218802001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 86] = +4.665093514162001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 87] = -9.695902491680001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  1] = +4.606933283570999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  2] = -1.215835310514000E-08;
@@ -10673,8 +10281,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 86] = -8.128037303119001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 87] = -1.271011947133000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 88] = -5.872129615220000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  1] = -4.355728695626001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  2] = +6.717578507346000E-09;
@@ -10765,8 +10371,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 87] = -7.135119042662000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 88] = +1.470184870124000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 89] = -4.685006117051000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  1] = -3.762171561307000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  2] = +2.340924626348000E-08;
@@ -10858,8 +10462,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 88] = -9.764614529707000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 89] = +1.452619676461000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 90] = -1.183551104288000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  1] = +3.202973068382000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  2] = -2.205364749085000E-09;
@@ -10952,8 +10554,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 89] = -1.368383800630000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 90] = -7.093192940659999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 91] = +2.667305407745000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  1] = +8.366872577929000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  2] = -1.621399270774000E-08;
@@ -11047,8 +10647,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 90] = +1.319192461943000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 91] = -1.749212221259000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 92] = -2.567738674942000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  1] = +6.861268677218001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  2] = -1.465121400970000E-09;
@@ -11143,8 +10741,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 91] = +8.827220314430001E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 92] = +2.518424650805999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 93] = -1.448105625968000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  1] = -2.759357878618000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  2] = -1.703407667058000E-09;
@@ -11240,8 +10836,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 92] = -1.006942393556000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 93] = +5.461539070159001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 94] = +4.009425930447001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  1] = -2.286109083228000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  2] = -2.077925616123000E-09;
@@ -11338,8 +10932,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 93] = +9.995016015360998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 94] = -2.316862759992000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 95] = +1.407313764187000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  1] = +8.240937418838004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  2] = -6.849711427944000E-09;
@@ -11437,8 +11029,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 94] = +3.702115477480999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 95] = -1.120166590547000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 96] = -7.124279280293000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  1] = -1.255389972053000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  2] = -1.440882393076000E-09;
@@ -11537,8 +11127,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 95] = +8.406097321493002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 96] = +1.926281151876000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 97] = -7.237988454300998E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  1] = -3.749155410803001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  2] = +2.837914742138000E-09;
@@ -11638,8 +11226,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 96] = -9.255882963991998E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 97] = -4.843469262936000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 98] = +2.715852505346000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  1] = -4.299056291016999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  2] = -3.862128939376999E-09;
@@ -11740,8 +11326,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 97] = -1.449741530980000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 98] = +1.831505233442000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 99] = -1.144315865887000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Snm[100][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  1] = -8.268477918983999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  2] = +1.063418475268000E-08;
@@ -11843,8 +11427,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 98] = +2.797108783323000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 99] = +5.789781796823999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][100] = -6.659142295245002E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Snm[101][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  1] = -3.196076533006000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  2] = +6.831064639852001E-09;
@@ -11947,8 +11529,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[101][ 99] = -5.377222964938001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][100] = +6.680736666556999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][101] = +6.382272394371000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Snm[102][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  1] = -2.409468856610999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  2] = +7.720142118184000E-09;
@@ -12052,8 +11632,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[102][100] = +9.547905372465003E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[102][101] = +5.191438727389000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][102] = +9.403311690734002E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Snm[103][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  1] = -9.848193541265004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  2] = -7.847670948767998E-10;
@@ -12158,8 +11736,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[103][101] = -6.833527476462998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[103][102] = -1.741038892636000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[103][103] = +5.191158591922999E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Snm[104][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  1] = -1.804525656731000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  2] = -8.253663831815999E-09;
@@ -12265,8 +11841,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[104][102] = +1.988149075426000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[104][103] = -4.304921558411000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][104] = +3.034801548663999E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Snm[105][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  1] = -1.181420282947000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  2] = +3.215636242911001E-09;
@@ -12373,8 +11947,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[105][103] = -6.353392883976000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][104] = +7.109745488749000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][105] = -5.573761024829000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Snm[106][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  1] = -1.694388882442000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  2] = -4.208157794295000E-09;
@@ -12482,8 +12054,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[106][104] = -7.940245011310999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[106][105] = +3.030289526059999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[106][106] = +1.448064661096000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Snm[107][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  1] = -4.058337555416000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  2] = +2.044947080726000E-09;
@@ -12592,8 +12162,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[107][105] = -1.557364166824000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[107][106] = -1.617349682823000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[107][107] = -1.237604835041000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Snm[108][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  1] = -1.371057921215000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  2] = -8.298811691785001E-09;
@@ -12703,8 +12271,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[108][106] = +1.271916563181000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[108][107] = -5.099568820075000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[108][108] = -1.043827519364000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Snm[109][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  1] = -9.064087850303000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  2] = +4.260949744603000E-09;
@@ -12815,8 +12381,6 @@ SphericalHarmonicsGravitySource_mars_MRO110B2_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[109][107] = -9.368974475716998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[109][108] = -8.487834554521001E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[109][109] = -9.361110271839001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Snm[110][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  1] = -2.500351803433000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  2] = +2.116805781316001E-09;
@@ -64,31 +64,26 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->tide_free_delta = -9.09230686577710E-05;
 
    SphericalHarmonicsGravitySource_ptr->Cnm =
-      JEOD_ALLOC_PRIM_ARRAY (150 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (150 + 1, 0, double);
    SphericalHarmonicsGravitySource_ptr->Snm =
-      JEOD_ALLOC_PRIM_ARRAY (150 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (150 + 1, 0, double);
 
    /* FULLY NORMALIZED GRAVITY COEFFICIENTS (unitless) */
-   SphericalHarmonicsGravitySource_ptr->Cnm[  2] =
-        JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[2][0] = -9.0882923650770995E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[2][1] = 8.4954064857652003E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[2][2] = 3.4670944268755999E-05;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[3]    = JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[3][0] = -3.1974039070980999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[3][1] = 2.6367948585301000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[3][2] = 1.4171538267300000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[3][3] = 1.2275202024552999E-05;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[4]    = JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[4][0] = 3.2347924522417001E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[4][1] = -6.0134612265187000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[4][2] = -7.1161737190123004E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[4][3] = -1.3499173662211000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[4][4] = -6.0069115393814999E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[5]    = JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[5][0] = -2.2378186921629999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[5][1] = -1.0116123460056000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[5][2] = 4.3995350687644004E-06;
@@ -96,7 +91,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[5][4] = 2.7542004508341999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[5][5] = 3.1107298179927999E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[6]    = JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[6][0] = 3.8184191011809003E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[6][1] = 1.5282769193243000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[6][2] = -4.3973005721118001E-06;
@@ -105,7 +99,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[6][5] = 1.4543741845814999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[6][6] = -4.6842414195666002E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[7]    = JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[7][0] = 5.5933881887178998E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[7][1] = 7.4716915273386999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[7][2] = -6.5012294054409005E-07;
@@ -115,7 +108,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[7][6] = -1.0653045588942000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[7][7] = -1.8202645695563999E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[8]    = JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[8][0] = 2.3468300594816001E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[8][1] = 4.1735904924526999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[8][2] = 3.0093221489839999E-06;
@@ -126,7 +118,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[8][7] = -1.5096535588051000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[8][8] = -2.4856047110162002E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[9]    = JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[9][0] = -3.5309168027709000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[9][1] = 1.8669553929176999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[9][2] = 1.9278233348016999E-06;
@@ -138,7 +129,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[9][8] = -1.3120131964316000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[9][9] = -9.3845174513186997E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[10]    = JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[10][0] = -1.0693030527494000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[10][1] = 8.4159368653515000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[10][2] = 3.5724806130491000E-07;
@@ -151,7 +141,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[10][9] = -4.7531502123433998E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[10][10] = 9.4791164082371004E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[11]    = JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[11][0] = -8.8520767323150003E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[11][1] = -1.9471470083334999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[11][2] = 6.9951742593095002E-07;
@@ -165,7 +154,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[11][10] = -4.6805562829235998E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[11][11] = -2.8887968254436001E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[12]    = JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[12][0] = -2.0122552596979998E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[12][1] = -7.0688618060921999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[12][2] = -1.0521437409705000E-07;
@@ -180,7 +168,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[12][11] = -9.8185728027677999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[12][12] = 3.0283408403625000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[13]    = JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[13][0] = 2.5647730792766000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[13][1] = 1.3544782980887999E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[13][2] = -3.4252302568838000E-06;
@@ -196,7 +183,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[13][12] = -5.7438390988946001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[13][13] = 2.4993801465340000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[14]    = JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[14][0] = 4.9224951590894996E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[14][1] = 5.6542808095947003E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[14][2] = 3.6441733593712999E-07;
@@ -213,7 +199,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[14][13] = -3.2143337620070001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[14][14] = -6.1346949343741005E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[15]    = JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[15][0] = -2.2808508193679999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[15][1] = -7.9752983350533001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[15][2] = -5.4012394389994001E-08;
@@ -231,7 +216,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[15][14] = 8.2347376102696999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[15][15] = 5.4829742194518000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[16]    = JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[16][0] = 5.5685004502896997E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[16][1] = 1.1558693750997000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[16][2] = 1.4552379103223000E-06;
@@ -250,7 +234,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[16][15] = -3.6478788846770998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[16][16] = -9.0536343077726999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[17]    = JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[17][0] = -1.0330343097126001E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[17][1] = 5.0201359613770003E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[17][2] = -2.9072086376565998E-07;
@@ -270,7 +253,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[17][16] = -3.1695710004603001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[17][17] = -3.8071036980418000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[18]    = JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[18][0] = -5.2032119819016000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[18][1] = 3.6041334191666999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[18][2] = -3.1662065310194002E-07;
@@ -291,7 +273,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[18][17] = 1.2300150804468001E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[18][18] = -2.0967424691321999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[19]    = JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[19][0] = 2.1565543617431999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[19][1] = -5.9124064107379000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[19][2] = 1.7300248913437000E-07;
@@ -313,7 +294,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[19][18] = 1.1238213551391000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[19][19] = 6.0203070604167002E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[20]    = JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[20][0] = 3.3556343308787001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[20][1] = -1.9705600696468001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[20][2] = 8.1279243702089002E-07;
@@ -336,7 +316,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[20][19] = -2.1724121081699001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[20][20] = -1.3526210777223999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[21]    = JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[21][0] = -5.6013281674944003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[21][1] = 3.7753673119754001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[21][2] = -1.3638411123630000E-06;
@@ -360,7 +339,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[21][20] = -4.3207572941497002E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[21][21] = -3.3409816592405997E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[22]    = JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[22][0] = -8.4137486190164995E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[22][1] = -3.0287325836043001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[22][2] = -3.6293064186741000E-07;
@@ -385,7 +363,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[22][21] = -1.6862839085220999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[22][22] = 3.5617336654838001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[23]    = JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[23][0] = -3.8544152335132000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[23][1] = 2.8358095501554001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[23][2] = 4.5727470003221999E-07;
@@ -411,7 +388,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[23][22] = -9.8597857850764990E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[23][23] = -1.0613546370655000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[24]    = JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[24][0] = 3.9855087764233002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[24][1] = 3.3903629532381001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[24][2] = 4.2138510917309000E-07;
@@ -438,7 +414,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[24][23] = -1.7691923983396000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[24][24] = 9.7084986431079007E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[25]    = JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[25][0] = -2.1575800943739000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[25][1] = -4.8562620386604003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[25][2] = -6.6136695531688002E-07;
@@ -466,7 +441,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[25][24] = 9.2250580884773996E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[25][25] = -1.3164248762498001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[26]    = JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[26][0] = 2.8385735942305001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[26][1] = 1.6393347169343999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[26][2] = 6.5852423570826995E-07;
@@ -495,7 +469,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[26][25] = 7.4465192013742005E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[26][26] = 1.0973308935675000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[27]    = JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[27][0] = -6.3549161466695000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[27][1] = 6.1631679679196000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[27][2] = -2.0498638913450001E-07;
@@ -525,7 +498,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[27][26] = -4.4890755894972002E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[27][27] = -4.2295809975534000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[28]    = JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[28][0] = 8.3886266415054000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[28][1] = 3.2880497204879003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[28][2] = -3.3794516309859002E-08;
@@ -556,7 +528,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[28][27] = -1.5961989749576001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[28][28] = 1.3386323469292000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[29]    = JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[29][0] = -6.0239002631692000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[29][1] = -1.5959953006870000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[29][2] = -2.0327192234627001E-07;
@@ -588,7 +559,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[29][28] = -1.1515580353035999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[29][29] = 1.8429307281719001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[30]    = JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[30][0] = 1.0132715175601000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[30][1] = -2.9447594370771998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[30][2] = -2.1644003142273001E-07;
@@ -621,7 +591,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[30][29] = 1.6926384455420999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[30][30] = -3.2419843850670999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[31]    = JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[31][0] = 5.4293793148551005E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[31][1] = 8.3126790816232993E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[31][2] = 2.4664617527165999E-08;
@@ -655,7 +624,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[31][30] = 1.1537892147464000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[31][31] = 1.9651469668707000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[32]    = JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[32][0] = -3.2227307645314000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[32][1] = -2.8412734267778003E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[32][2] = -6.3146382960918004E-07;
@@ -690,7 +658,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[32][31] = 3.4304170597361998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[32][32] = 1.6251545254083000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[33]    = JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[33][0] = 1.0806456517285000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[33][1] = 1.8399229600041000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[33][2] = 6.7162664001871003E-07;
@@ -726,7 +693,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[33][32] = -5.0489756343734003E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[33][33] = 1.7798109956502000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[34]    = JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[34][0] = 1.6616121858810001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[34][1] = 2.8210544288299999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[34][2] = 2.2047061792584000E-07;
@@ -763,7 +729,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[34][33] = -2.0335041999809999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[34][34] = 9.4650509129532997E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[35]    = JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[35][0] = 1.2941731895572000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[35][1] = 3.0866120008673000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[35][2] = -3.3801821736647002E-07;
@@ -801,7 +766,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[35][34] = 3.4033196009404998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[35][35] = -6.2033512926816001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[36]    = JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[36][0] = 1.6737584851756999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[36][1] = -2.8750022568950999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[36][2] = 2.3668786871113001E-07;
@@ -840,7 +804,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[36][35] = 3.1627233716139998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[36][36] = 2.1795632758412000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[37]    = JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[37][0] = 2.2406467909881999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[37][1] = 2.4181021453959000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[37][2] = -2.4912038769349999E-07;
@@ -880,7 +843,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[37][36] = -4.6452943347574002E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[37][37] = 1.9954901121945001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[38]    = JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[38][0] = 4.5775282413567001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[38][1] = 3.6879999158660997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[38][2] = 1.3275872808795000E-08;
@@ -921,7 +883,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[38][37] = -1.6634578842032999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[38][38] = -3.2036546039274001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[39]    = JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[39][0] = -3.3428335232542999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[39][1] = -1.6865992641876001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[39][2] = -1.5677761527056999E-07;
@@ -963,7 +924,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[39][38] = -2.7770514955273997E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[39][39] = 2.1652775531563000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[40]    = JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[40][0] = 3.0600034381605998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[40][1] = 5.2985477737108997E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[40][2] = -8.6635674597716996E-08;
@@ -1006,7 +966,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[40][39] = 1.0604194032287001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[40][40] = -7.7256114982501997E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[41]    = JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[41][0] = 2.8208196537487998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[41][1] = -8.0514878091194000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[41][2] = 1.1183821503289000E-07;
@@ -1050,7 +1009,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[41][40] = -9.5859459761332006E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[41][41] = 2.8140499239315001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[42]    = JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[42][0] = 1.5583531941679001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[42][1] = -2.1025829931133001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[42][2] = -2.7839084006366000E-07;
@@ -1095,7 +1053,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[42][41] = 9.0029498045960006E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[42][42] = 1.7047162815680001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[43]    = JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[43][0] = -1.2096895400089999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[43][1] = 9.9367529140493006E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[43][2] = 1.8722132517762000E-07;
@@ -1141,7 +1098,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[43][42] = 7.1689481622786995E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[43][43] = 2.1367105680172001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[44]    = JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[44][0] = 2.9538017601380000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[44][1] = 1.2151681009302999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[44][2] = -2.5693631536765999E-08;
@@ -1188,7 +1144,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[44][43] = -1.7468954568369000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[44][44] = 2.9116417600554001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[45]    = JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[45][0] = 1.1159983271965000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[45][1] = -9.9772597772462996E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[45][2] = 1.7847055549286000E-07;
@@ -1236,7 +1191,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[45][44] = 3.9777346233748998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[45][45] = -3.0863857888967002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[46]    = JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[46][0] = -3.3447638168911998E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[46][1] = -9.1952879909442005E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[46][2] = -6.6656476883736001E-08;
@@ -1285,7 +1239,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[46][45] = 2.1100605607918000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[46][46] = 3.8191471994642999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[47]    = JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[47][0] = 1.5766292951908001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[47][1] = 3.0061172292801001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[47][2] = 1.2735365683181000E-07;
@@ -1335,7 +1288,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[47][46] = 1.1652785804688999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[47][47] = 7.0867738166979004E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[48]    = JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[48][0] = 1.8382500495697001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[48][1] = 1.6473552715014001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[48][2] = -5.2393174553288003E-08;
@@ -1386,7 +1338,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[48][47] = -4.9048682249236000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[48][48] = 1.1683245739155001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[49]    = JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[49][0] = 3.2077070111392998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[49][1] = -8.9374392134695003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[49][2] = -1.1293974617401000E-07;
@@ -1438,7 +1389,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[49][48] = 6.9565201891382007E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[49][49] = -1.0884048232360001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[50]    = JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[50][0] = 6.3467687289965000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[50][1] = -4.7225638489574997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[50][2] = 8.5066493914881005E-08;
@@ -1491,7 +1441,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[50][49] = -2.4633877617503001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[50][50] = 2.8517275393627998E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[51]    = JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[51][0] = 2.3024051409347000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[51][1] = 2.5409306368905001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[51][2] = -1.8824219160832001E-07;
@@ -1545,7 +1494,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[51][50] = 2.6827255879247001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[51][51] = -1.1842729989617000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[52]    = JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[52][0] = 2.0863397594405001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[52][1] = -8.8316898052028003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[52][2] = -1.7164051526691000E-08;
@@ -1600,7 +1548,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[52][51] = -3.1657160992929001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[52][52] = 1.2875672357445001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[53]    = JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[53][0] = 3.7064710684944003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[53][1] = -1.4646208650966999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[53][2] = -2.3345465403339000E-07;
@@ -1656,7 +1603,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[53][52] = 1.0043559133477000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[53][53] = -1.1370932491296000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[54]    = JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[54][0] = -2.1563429910324001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[54][1] = -2.5733856394714999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[54][2] = 1.7752738129016999E-07;
@@ -1713,7 +1659,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[54][53] = -1.1998951389894999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[54][54] = 2.3474361735662000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[55]    = JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[55][0] = -1.1868286240334000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[55][1] = -7.2183915580188997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[55][2] = -7.0593298299200000E-08;
@@ -1771,7 +1716,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[55][54] = 1.7513974700887000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[55][55] = -1.2849727390299001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[56]    = JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[56][0] = 2.0591758381246001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[56][1] = 1.0640369952985000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[56][2] = 6.1758945336451006E-08;
@@ -1830,7 +1774,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[56][55] = -1.6979871681343999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[56][56] = 1.3607993436250999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[57]    = JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[57][0] = 2.8322472346652001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[57][1] = 9.4507932785982998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[57][2] = 1.3937536164713000E-07;
@@ -1890,7 +1833,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[57][56] = 1.0973006586466000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[57][57] = -3.8034168645092003E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[58]    = JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[58][0] = 8.5123053374282003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[58][1] = 1.3722266185850000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[58][2] = 6.2928311016062004E-08;
@@ -1951,7 +1893,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[58][57] = -1.9632989817884001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[58][58] = 7.0794017039667996E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[59]    = JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[59][0] = 8.2680866197306003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[59][1] = -2.0661954694035001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[59][2] = -9.4110769993613995E-08;
@@ -2013,7 +1954,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[59][58] = 1.8463613648658001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[59][59] = 9.3389181981680995E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[60]    = JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[60][0] = 2.0395912817631999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[60][1] = 6.7675323258555003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[60][2] = 1.6883132558140000E-07;
@@ -2076,7 +2016,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[60][59] = -1.5396663130178000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[60][60] = -1.3599544591015000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[61]    = JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[61][0] = 1.0629911806359000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[61][1] = 3.2039891671270999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[61][2] = 4.7242847888640002E-08;
@@ -2140,7 +2079,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[61][60] = -3.7678452341785001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[61][61] = 1.9720214509396001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[62]    = JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[62][0] = 8.9842730345352994E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[62][1] = 1.2501441422476001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[62][2] = -2.7380349548240000E-08;
@@ -2205,7 +2143,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[62][61] = 5.5193275352779000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[62][62] = -9.2684906716338995E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[63]    = JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[63][0] = 5.9328637546096999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[63][1] = -4.4169086162834002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[63][2] = -2.8346226475133998E-09;
@@ -2271,7 +2208,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[63][62] = -1.1015975097635000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[63][63] = -9.5967900188875004E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[64]    = JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[64][0] = 1.1568089914689000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[64][1] = 1.9390878764548001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[64][2] = 1.4276162751305999E-07;
@@ -2338,7 +2274,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[64][63] = -8.9762209234243994E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[64][64] = 1.1979927808418999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[65]    = JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[65][0] = 3.7235040903136997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[65][1] = -1.1628337599379999E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[65][2] = 2.4464633433017999E-08;
@@ -2406,7 +2341,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[65][64] = 1.8117234745758000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[65][65] = -5.7552387760252998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[66]    = JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[66][0] = 7.1007842962022003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[66][1] = 2.7499280698141999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[66][2] = -9.0222610095052004E-09;
@@ -2475,7 +2409,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[66][65] = -1.3972673832787001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[66][66] = -1.0656887598818001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[67]    = JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[67][0] = -2.5477796562723000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[67][1] = -4.8921378869526000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[67][2] = 6.6237139083450004E-08;
@@ -2545,7 +2478,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[67][66] = 8.2150580275110005E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[67][67] = -6.0560351245755000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[68]    = JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[68][0] = 7.7925391289702996E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[68][1] = 2.1874892142994001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[68][2] = -1.4633071798552000E-08;
@@ -2616,7 +2548,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[68][67] = 7.5000022736376004E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[68][68] = 9.6026954268557006E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[69]    = JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[69][0] = -1.4352886726836000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[69][1] = -3.7119145445091997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[69][2] = 1.1531230887440000E-07;
@@ -2688,7 +2619,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[69][68] = -1.5393258374012000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[69][69] = -4.7333774186333001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[70]    = JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[70][0] = -5.9659194190692005E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[70][1] = 7.6361523765023994E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[70][2] = -1.1054964979639000E-07;
@@ -2761,7 +2691,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[70][69] = 7.9810580330028995E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[70][70] = -5.3800730892733002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[71]    = JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[71][0] = 6.1678259587963002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[71][1] = -7.6827206231930998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[71][2] = 3.7455720490475002E-08;
@@ -2835,7 +2764,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[71][70] = 5.2509697857091997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[71][71] = -5.5529821825327002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[72]    = JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[72][0] = -3.2169209228002997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[72][1] = 2.4034112607961999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[72][2] = -3.9043274433237000E-08;
@@ -2910,7 +2838,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[72][71] = -1.3765133734703001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[72][72] = 5.5996569958237997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[73]    = JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[73][0] = 6.4426144902394005E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[73][1] = -4.2250095457544002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[73][2] = 5.3991432209866001E-08;
@@ -2986,7 +2913,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[73][72] = 4.8482194081135002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[73][73] = -8.9783513151174005E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[74]    = JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[74][0] = -4.4888702287017003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[74][1] = -4.4044283664642998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[74][2] = -1.1925148330817001E-07;
@@ -3063,7 +2989,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[74][73] = 4.9396212966513002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[74][74] = 5.8719014033794003E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[75]    = JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[75][0] = -5.4450804219958997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[75][1] = -4.0729656326350000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[75][2] = 7.3878054673059995E-08;
@@ -3141,7 +3066,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[75][74] = -8.3308990322596004E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[75][75] = 4.1740431668642002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[76]    = JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[76][0] = -6.3769233706015003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[76][1] = 1.1811838268072000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[76][2] = -8.0989205434333998E-08;
@@ -3220,7 +3144,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[76][75] = 4.3270499812270002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[76][76] = -2.3061121147185000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[77]    = JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[77][0] = 6.9579705450501997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[77][1] = 3.7831940361201998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[77][2] = -8.9809134537010997E-09;
@@ -3300,7 +3223,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[77][76] = -7.8655894283401993E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[77][77] = -3.5955521518770997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[78]    = JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[78][0] = 8.6610932573629994E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[78][1] = -9.1195832059357995E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[78][2] = 5.6346523379833997E-09;
@@ -3381,7 +3303,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[78][77] = 1.2340378569972000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[78][78] = 3.5973973146171003E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[79]    = JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[79][0] = -6.7675094487360999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[79][1] = -8.2265229518449993E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[79][2] = 4.9714918969122998E-08;
@@ -3463,7 +3384,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[79][78] = -2.3733131718758002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[79][79] = 1.0280524697044999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[80]    = JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[80][0] = 2.4673878354686000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[80][1] = 1.1845734214298001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[80][2] = 8.4893652714920001E-08;
@@ -3546,7 +3466,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[80][79] = 4.4515020595800002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[80][80] = -1.1057958659470000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[81]    = JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[81][0] = 3.2992352053620999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[81][1] = 1.0391072754222000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[81][2] = 3.9847062332395997E-08;
@@ -3630,7 +3549,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[81][80] = -1.7433676724148000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[81][81] = -2.1866068320550001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[82]    = JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[82][0] = 3.3205121346618999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[82][1] = -3.5584338925899998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[82][2] = -2.7380590373193999E-08;
@@ -3715,7 +3633,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[82][81] = 3.8753107887112999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[82][82] = 6.0869566170386000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[83]    = JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[83][0] = 6.1353583818400000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[83][1] = -1.0076897319263000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[83][2] = -1.2946257837432001E-07;
@@ -3801,7 +3718,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[83][82] = 7.5968779227493994E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[83][83] = 9.1201630315334001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[84]    = JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[84][0] = -6.9776010512677000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[84][1] = -3.0551567086011000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[84][2] = 2.4794548787906000E-08;
@@ -3888,7 +3804,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[84][83] = -6.4627364565974006E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[84][84] = -3.0225310650635998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[85]    = JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[85][0] = -2.7267383091843000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[85][1] = -5.0928697425336001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[85][2] = -4.1264240243920000E-08;
@@ -3976,7 +3891,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[85][84] = 6.9813740018146995E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[85][85] = -3.4913432641064998E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[86]    = JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[86][0] = 3.7180748368129002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[86][1] = -4.0453575913206999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[86][2] = -4.1237312062190999E-08;
@@ -4065,7 +3979,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[86][85] = 3.3345287151830001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[86][86] = -6.4914088832256004E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[87]    = JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[87][0] = -6.5213441990191006E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[87][1] = -7.2276472935625999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[87][2] = 6.8689904510111005E-08;
@@ -4155,7 +4068,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[87][86] = -9.7128545087399996E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[87][87] = 1.2424265665487000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[88]    = JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[88][0] = 2.4958568826705999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[88][1] = 4.6103797179828998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[88][2] = 8.0717244711723000E-08;
@@ -4246,7 +4158,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[88][87] = 3.2271468206035002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[88][88] = -8.0415045703130997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[89]    = JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[89][0] = 2.4749585143074999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[89][1] = 1.8156580139661999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[89][2] = -2.1328976145959001E-08;
@@ -4338,7 +4249,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[89][88] = -2.3448449992663999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[89][89] = -3.1226243755440997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[90]    = JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[90][0] = -5.7199373413050003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[90][1] = -7.0477240411279998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[90][2] = -9.1597965723175001E-08;
@@ -4431,7 +4341,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[90][89] = -2.6135129499573001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[90][90] = 6.4498161821681001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[91]    = JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[91][0] = -3.4395899762219998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[91][1] = 5.4399508217595001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[91][2] = 1.0120849316419000E-07;
@@ -4525,7 +4434,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[91][90] = -3.0415509343667000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[91][91] = -5.8551167342141002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[92]    = JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[92][0] = 2.8383635199380998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[92][1] = 3.1729785950440001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[92][2] = -1.5246736316149999E-09;
@@ -4620,7 +4528,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[92][91] = -1.9284481811774999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[92][92] = 2.0805634501147998E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[93]    = JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[93][0] = 2.9761941392729999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[93][1] = -1.0626463694596999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[93][2] = -1.2140516204887000E-08;
@@ -4716,7 +4623,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[93][92] = 1.8808143431956999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[93][93] = 6.6923979077637995E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[94]    = JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[94][0] = -9.8053629970432998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[94][1] = -8.7957137277980999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[94][2] = -3.4110793015386999E-08;
@@ -4813,7 +4719,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[94][93] = -3.5770117768835001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[94][94] = -3.8293662408801999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[95]    = JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[95][0] = 5.8170045881848002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[95][1] = 3.4434201469436999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[95][2] = 4.3777850052992997E-08;
@@ -4911,7 +4816,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[95][94] = 1.5543829593205000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[95][95] = -4.3289763173746998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[96]    = JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[96][0] = 2.4402891879818001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[96][1] = -2.5130505656568000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[96][2] = -3.9306654811389997E-08;
@@ -5010,7 +4914,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[96][95] = -1.4522634888669000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[96][96] = 1.9831658193047000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[97]    = JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[97][0] = -3.7705416068349000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[97][1] = -5.3068648184429001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[97][2] = -1.9699522743514001E-08;
@@ -5110,7 +5013,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[97][96] = 4.3863663636987997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[97][97] = 3.3467992712011002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[98]    = JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[98][0] = -4.6037547450279998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[98][1] = 2.5719687466116001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[98][2] = 4.5522413037984999E-08;
@@ -5211,7 +5113,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[98][97] = -5.2422659611533998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[98][98] = -1.5194263927258000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[99]    = JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[99][0] = 5.4502608114989000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[99][1] = -1.3359677512164999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[99][2] = -6.1348794836275996E-08;
@@ -5313,7 +5214,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[99][98] = 4.0167783770421001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[99][99] = -3.8947948779516999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[100]    = JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[100][0] = -1.1079821430571000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][1] = -2.6495980880325000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][2] = -2.5237430322965002E-08;
@@ -5416,7 +5316,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[100][99] = -1.1074549386399999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][100] = -6.1162195923669002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[101]    = JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[101][0] = -1.8806301763817998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][1] = 2.2231206243173999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][2] = -1.4859868596021000E-08;
@@ -5520,7 +5419,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[101][100] = 4.2573692554072999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][101] = 1.5208762373459001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[102]    = JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[102][0] = 1.2511889566928000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][1] = 4.5273174639016002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][2] = -1.2025043670562000E-09;
@@ -5625,7 +5523,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[102][101] = -3.1161269725895999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][102] = -2.4403124830709001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[103]    = JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[103][0] = -2.5238206065239001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][1] = -7.5450302940996996E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][2] = 1.0483751441521001E-08;
@@ -5731,7 +5628,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[103][102] = 1.2158402733548999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][103] = -1.1570957505089000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[104]    = JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[104][0] = 3.6039410575508000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][1] = -5.6292395912511999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][2] = -9.5594646156591996E-09;
@@ -5838,7 +5734,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[104][103] = -2.6294544376948000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][104] = -7.1743547627962004E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[105]    = JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[105][0] = -3.2564582474447003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][1] = 1.8043329437745000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][2] = 2.6876527129148001E-08;
@@ -5946,7 +5841,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[105][104] = 3.2712501093907002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][105] = -8.3093417612987999E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[106]    = JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[106][0] = 4.1030179477946002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][1] = 2.0624822959341000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][2] = -4.0719995514790003E-08;
@@ -6055,7 +5949,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[106][105] = -3.2956277067236001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][106] = 2.8962526947267999E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[107]    = JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[107][0] = 1.8781582096893999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][1] = -1.8462918554064000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][2] = 4.3442427057511001E-09;
@@ -6165,7 +6058,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[107][106] = 2.8653682435037001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][107] = -4.2507365466443002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[108]    = JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[108][0] = -1.5460710481220000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][1] = -2.2586142586774999E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][2] = 6.5570954125524999E-09;
@@ -6276,7 +6168,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[108][107] = -3.1244526149780003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][108] = -5.4628912513805005E-10;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[109]    = JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[109][0] = 1.2562228830876001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][1] = 5.2882269709134997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][2] = -3.8912800122806001E-08;
@@ -6388,7 +6279,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[109][108] = 2.0499356272328999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][109] = -1.8073175888031002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[110]    = JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[110][0] = 4.2292267091625997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][1] = 4.6702992782733998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][2] = 3.8545160015181997E-08;
@@ -6501,7 +6391,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[110][109] = 1.1700497062023000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][110] = 1.1065015618674000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[111]    = JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[111][0] = -1.2528947816413000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][1] = -6.1812961667195005E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][2] = -8.0415027383477995E-08;
@@ -6615,7 +6504,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[111][110] = -1.6424292187202999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][111] = 2.3957963062246000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[112]    = JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[112][0] = 1.3241914539958000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][1] = 4.4436880840039000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][2] = 2.7944607615240998E-08;
@@ -6730,7 +6618,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[112][111] = 2.1863572395104000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][112] = -1.5153223101300000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[113]    = JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[113][0] = 4.1739773689388997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][1] = -4.6037356024617998E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][2] = -1.1456088694576000E-08;
@@ -6846,7 +6733,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[113][112] = -1.4434047304666001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][113] = -6.7348243668125004E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[114]    = JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[114][0] = -3.3957528044742001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][1] = 7.3625491347758001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][2] = 1.8108822048134000E-08;
@@ -6963,7 +6849,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[114][113] = 1.6446886412383001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][114] = 1.3436612377659000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[115]    = JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[115][0] = 1.9706391041830001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][1] = -7.8386660306138003E-13;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][2] = -3.5101749893983998E-08;
@@ -7081,7 +6966,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[115][114] = -1.5562452973678001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][115] = -1.5652425353572000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[116]    = JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[116][0] = 1.1994421601893000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][1] = 3.6536116890464999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][2] = -5.0495333100123999E-09;
@@ -7200,7 +7084,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[116][115] = 8.6852488935142998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][116] = 1.9585778311667999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[117]    = JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[117][0] = -2.8092762591055000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][1] = -1.1680870368336000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][2] = 2.8772709732547000E-08;
@@ -7320,7 +7203,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[117][116] = -5.6136033923869001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][117] = -8.8394002707008003E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[118]    = JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[118][0] = 1.9750289399075001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][1] = 1.0290569092296000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][2] = -2.4312684224047000E-08;
@@ -7441,7 +7323,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[118][117] = 2.1217219583811000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][118] = -6.1529751654668002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[119]    = JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[119][0] = -2.1610804673177001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][1] = 2.5500140763248000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][2] = 1.7925023583401001E-08;
@@ -7563,7 +7444,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[119][118] = 2.0765845407433001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][119] = 1.7622806972361000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[120]    = JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[120][0] = 4.8991023950686999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][1] = -4.2819128965667001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][2] = 6.3443015531341003E-09;
@@ -7686,7 +7566,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[120][119] = -2.4260431038735001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][120] = -2.1024023397902000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[121]    = JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[121][0] = -6.5427402638297000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][1] = 2.8497433394360001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][2] = 5.0915629123928002E-08;
@@ -7810,7 +7689,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[121][120] = 2.5986267835248000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][121] = 1.4591585880339000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[122]    = JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[122][0] = 2.6264266108735001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][1] = 1.3204177613835000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][2] = -3.8847064349439999E-08;
@@ -7935,7 +7813,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[122][121] = -9.8358804796053999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][122] = 3.9846290148246001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[123]    = JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[123][0] = 3.3455317573411999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][1] = 1.0565189550602000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][2] = -2.8871809808645001E-08;
@@ -8061,7 +7938,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[123][122] = -2.6602443519460999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][123] = -9.6957206531265995E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[124]    = JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[124][0] = -1.4977126403929000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][1] = -6.7517617553342004E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][2] = 3.6371167778198000E-08;
@@ -8188,7 +8064,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[124][123] = 4.5970367521671997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][124] = 9.5257865148472999E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[125]    = JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[125][0] = -4.9428590107299997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][1] = 1.4940402528109001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][2] = 7.2623019411729996E-09;
@@ -8316,7 +8191,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[125][124] = -2.6919133460478001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][125] = -2.0223472235956999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[126]    = JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[126][0] = 2.7346525652130999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][1] = 2.3417283488814000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][2] = -6.7145888991159000E-09;
@@ -8445,7 +8319,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[126][125] = -3.0761349013814000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][126] = 3.1078066120923999E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[127]    = JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[127][0] = -2.2713627663944001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][1] = -6.0413249839479997E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][2] = 1.6870617788494001E-09;
@@ -8575,7 +8448,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[127][126] = 3.1252712583314999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][127] = 3.5678867674975997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[128]    = JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[128][0] = 2.7564791865461001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][1] = 2.6379666674076001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][2] = 1.7138311577668001E-08;
@@ -8706,7 +8578,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[128][127] = 1.0808043504731000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][128] = -2.8538704194522000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[129]    = JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[129][0] = 2.1031445994683000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][1] = -2.5288282398807998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][2] = -8.0274928621714999E-09;
@@ -8838,7 +8709,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[129][128] = 5.0592070283271998E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][129] = -3.7681697884976000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[130]    = JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[130][0] = 5.0134520257146997E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][1] = -3.1837734240827003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][2] = -5.7589157174823002E-09;
@@ -8971,7 +8841,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[130][129] = -7.6185943607758001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][130] = 7.2364463892624002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[131]    = JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[131][0] = -1.0638942265542000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][1] = -1.5934268659675002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][2] = 2.9901187527810999E-08;
@@ -9105,7 +8974,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[131][130] = 2.1575587094659999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][131] = 1.9131819787531001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[132]    = JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[132][0] = 3.9850897503281997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][1] = 2.3109940567874999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][2] = -9.3975489653402995E-09;
@@ -9240,7 +9108,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[132][131] = 6.8083065359285003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][132] = -1.6183205547091999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[133]    = JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[133][0] = -3.1527407597083003E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][1] = -1.1211502895254000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][2] = 6.5378827768345003E-09;
@@ -9376,7 +9243,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[133][132] = 7.5048070291591999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][133] = -1.1675120712436000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[134]    = JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[134][0] = 2.0315544925889999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][1] = -7.9880443418524002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][2] = -8.7054794383930999E-10;
@@ -9513,7 +9379,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[134][133] = 1.4761225564344001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][134] = 4.9895477933712998E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[135]    = JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[135][0] = -8.3326684548878998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][1] = 3.9694086877518999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][2] = 1.4371527965644999E-09;
@@ -9651,7 +9516,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[135][134] = -2.4947198403921000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][135] = -1.0024677944003000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[136]    = JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[136][0] = -6.4658283454448997E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][1] = -3.9817040389830997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][2] = -5.3667778073619998E-09;
@@ -9790,7 +9654,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[136][135] = 2.7467813900561001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][136] = 2.4500528155326001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[137]    = JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[137][0] = 4.3744701924094999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][1] = 8.7153130922675002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][2] = 4.3245368647967002E-08;
@@ -9930,7 +9793,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[137][136] = -2.2906372220780001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][137] = -2.6853648566105001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[138]    = JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[138][0] = -1.6275329028512999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][1] = 1.3450651394593000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][2] = 1.5963634621303999E-08;
@@ -10071,7 +9933,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[138][137] = 2.2273995183750000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][138] = -1.7922659022202000E-10;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[139]    = JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[139][0] = 3.1438573595046999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][1] = 2.1406345500725000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][2] = -9.5414826738192001E-09;
@@ -10213,7 +10074,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[139][138] = -1.1084585537238999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][139] = 3.5621155461279001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[140]    = JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[140][0] = -1.0155808719665999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][1] = -2.4024199814936001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][2] = 1.6260260551058001E-08;
@@ -10356,7 +10216,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[140][139] = 1.3891449989514000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][140] = -2.1317404245940001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[141]    = JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[141][0] = 1.2695363203073000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][1] = 1.5528887282504999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][2] = -1.3407011816049001E-08;
@@ -10500,7 +10359,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[141][140] = -2.5099245862688999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][141] = 1.7408382756635998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[142]    = JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[142][0] = -2.3048130140724999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][1] = -1.9515271780176002E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][2] = -2.2887197977247000E-08;
@@ -10645,7 +10503,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[142][141] = 6.5709312831110003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][142] = 6.5368294468984998E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[143]    = JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[143][0] = -3.4587835913451999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][1] = 1.0020840737886000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][2] = -1.0506680866072000E-08;
@@ -10791,7 +10648,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[143][142] = 9.9645313045689004E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][143] = -6.8244949481487998E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[144]    = JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[144][0] = -2.9275651612540999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][1] = 1.8300991348404001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][2] = 1.0245658180678000E-08;
@@ -10938,7 +10794,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[144][143] = -1.3485619723315001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][144] = -1.9331966924332998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[145]    = JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[145][0] = 1.1820280433267000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][1] = 3.1320414276115997E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][2] = -3.5637161579286000E-09;
@@ -11086,7 +10941,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[145][144] = -1.7731469187737000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][145] = 3.6577357516036998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[146]    = JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[146][0] = 2.0991313011583999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][1] = 9.2421371645890002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][2] = -5.6173727804702001E-09;
@@ -11235,7 +11089,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[146][145] = 1.0002398290647000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][146] = -1.3405307772109000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[147]    = JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[147][0] = 4.7498602141772003E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][1] = -9.8779828779350998E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][2] = -1.7687800455339999E-08;
@@ -11385,7 +11238,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[147][146] = 2.5203818061791001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][147] = -4.5601127744547001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[148]    = JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[148][0] = -8.9830700830506996E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][1] = -1.7028174996005000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][2] = 7.5889230502778008E-09;
@@ -11536,7 +11388,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[148][147] = -1.2874057754040001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][148] = -1.0394650365326001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[149]    = JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[149][0] = 1.8618979518706999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][1] = -2.8287219952627002E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][2] = 1.7563827151622999E-08;
@@ -11688,7 +11539,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[149][148] = 1.6211271678916001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][149] = 1.5809131901187001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Cnm[150]    = JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[150][0] = -4.8929283929914001E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][1] = -3.6444495448800999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][2] = 1.2329637701335999E-09;
@@ -11841,25 +11691,21 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[150][149] = -7.8338873595169997E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][150] = -6.5730942507331002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[2]    = JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Snm[2][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[2][1] = 9.7726994478962992E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[2][2] = -2.4064244523445002E-10;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[3]    = JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Snm[3][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[3][1] = 5.4545621847343999E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[3][2] = 4.8779443647939002E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[3][3] = -1.7743747889595000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[4]    = JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Snm[4][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[4][1] = 1.6643327702085001E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[4][2] = -6.7770230383513997E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[4][3] = -1.3444991147298001E-05;
    SphericalHarmonicsGravitySource_ptr->Snm[4][4] = 3.9266111458205004E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[5]    = JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Snm[5][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[5][1] = -4.1189034337586998E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[5][2] = 1.0571040222894000E-06;
@@ -11867,7 +11713,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[5][4] = 6.7624331748839005E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[5][5] = -2.7545431341824001E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[6]    = JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Snm[6][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[6][1] = -2.5995934726698998E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[6][2] = -2.1676869353336998E-06;
@@ -11876,7 +11721,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[6][5] = -1.0341804065343001E-05;
    SphericalHarmonicsGravitySource_ptr->Snm[6][6] = 7.2298542235022004E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[7]    = JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Snm[7][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[7][1] = -1.1974837275945000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[7][2] = 2.4111005879336999E-06;
@@ -11886,7 +11730,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[7][6] = 1.1004282428110999E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[7][7] = -1.5999965833572001E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[8]    = JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Snm[8][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[8][1] = 1.0980290732908000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[8][2] = 1.9305655599869999E-06;
@@ -11897,7 +11740,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[8][7] = 3.2688520883962001E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[8][8] = 2.1164273548015999E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[9]    = JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Snm[9][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[9][1] = 8.1043932783698996E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[9][2] = -1.3875730461354000E-06;
@@ -11909,7 +11751,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[9][8] = -2.2034244966335000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[9][9] = 2.4881863339179000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[10]    = JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Snm[10][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[10][1] = -9.5407096240833999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[10][2] = -2.6511994151809001E-07;
@@ -11922,7 +11763,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[10][9] = -5.1518479456290000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[10][10] = -1.7194222119132000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[11]    = JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Snm[11][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[11][1] = 6.1425301747281000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[11][2] = -1.9680457911693001E-06;
@@ -11936,7 +11776,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[11][10] = -1.7359553616453001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[11][11] = -1.7463369322532000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[12]    = JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Snm[12][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[12][1] = 1.6477863242794000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[12][2] = 1.5078392317330000E-06;
@@ -11951,7 +11790,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[12][11] = -3.2845284250891999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[12][12] = 1.2469267728160000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[13]    = JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Snm[13][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[13][1] = -7.6665408677694997E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[13][2] = 3.8397322747487999E-07;
@@ -11967,7 +11805,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[13][12] = -1.5223564155991001E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[13][13] = -2.6687678210223001E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[14]    = JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Snm[14][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[14][1] = -6.8210890168944003E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[14][2] = 3.5520635410242002E-07;
@@ -11984,7 +11821,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[14][13] = -1.0177998224630001E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[14][14] = 1.0711235855160001E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[15]    = JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Snm[15][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[15][1] = 3.5361483481193001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[15][2] = 7.4466032701160998E-07;
@@ -12002,7 +11838,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[15][14] = 5.6144998172873005E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[15][15] = 7.7783303916352996E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[16]    = JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Snm[16][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[16][1] = 8.2525088064412003E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[16][2] = 7.6543434593537002E-09;
@@ -12021,7 +11856,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[16][15] = -1.0158141035150999E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[16][16] = -9.1872408061842001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[17]    = JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Snm[17][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[17][1] = 7.6265740364637003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[17][2] = -8.7258082128084003E-07;
@@ -12041,7 +11875,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[17][16] = -2.5148543672767002E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[17][17] = 1.5047045648422000E-06;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[18]    = JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Snm[18][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[18][1] = 2.6844200251377001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[18][2] = -7.2612111795584002E-07;
@@ -12062,7 +11895,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[18][17] = -4.7126707884998999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[18][18] = -2.8512567089241001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[19]    = JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Snm[19][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[19][1] = 1.3131627835343999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[19][2] = -3.7178237249438998E-07;
@@ -12084,7 +11916,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[19][18] = -2.1683852344573999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[19][19] = 3.6538049545092000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[20]    = JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Snm[20][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[20][1] = -3.8257312829482002E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[20][2] = 3.4101975528436998E-09;
@@ -12107,7 +11938,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[20][19] = 3.0517797337772999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[20][20] = -3.5876500688779002E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[21]    = JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Snm[21][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[21][1] = 5.5306168647342999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[21][2] = -3.9097919569675000E-07;
@@ -12131,7 +11961,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[21][20] = 2.5440883655444998E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[21][21] = 3.2408917683987998E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[22]    = JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Snm[22][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[22][1] = 2.5147358767926002E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[22][2] = -9.0168655261905999E-08;
@@ -12156,7 +11985,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[22][21] = 7.6220695729534003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[22][22] = 6.5646474659546999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[23]    = JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Snm[23][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[23][1] = -8.3442200942673002E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[23][2] = -8.7209953860012006E-08;
@@ -12182,7 +12010,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[23][22] = -4.8887112331454998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[23][23] = 2.4946988973184000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[24]    = JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Snm[24][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[24][1] = -2.7290775126024999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[24][2] = 3.6304928473921000E-07;
@@ -12209,7 +12036,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[24][23] = -3.5688466887260000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[24][24] = -9.4456247956387002E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[25]    = JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Snm[25][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[25][1] = 5.2918566367859995E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[25][2] = 5.3921261556744000E-08;
@@ -12237,7 +12063,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[25][24] = -3.0680176076890002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[25][25] = 5.6015442598815997E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[26]    = JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Snm[26][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[26][1] = 2.2223500204846999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[26][2] = -1.9626795293254000E-07;
@@ -12266,7 +12091,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[26][25] = -3.4008380428272998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[26][26] = 4.7799902831390997E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[27]    = JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Snm[27][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[27][1] = 2.2932948422896999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[27][2] = -4.2922181979118998E-07;
@@ -12296,7 +12120,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[27][26] = -7.2059753851896004E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[27][27] = -2.7705182466855999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[28]    = JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Snm[28][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[28][1] = 7.9390966944112995E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[28][2] = 7.1048142459637003E-07;
@@ -12327,7 +12150,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[28][27] = 6.7208149541776998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[28][28] = -4.4329369536601001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[29]    = JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Snm[29][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[29][1] = -4.3834661203528998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[29][2] = -7.0046472300890999E-07;
@@ -12359,7 +12181,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[29][28] = 2.4933329644165999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[29][29] = -1.4604998682831999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[30]    = JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Snm[30][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[30][1] = -4.2892928292187004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[30][2] = -2.3228452220022001E-07;
@@ -12392,7 +12213,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[30][29] = -1.4044048694738001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[30][30] = 9.5827841760194010E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[31]    = JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Snm[31][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[31][1] = -4.1949404271393999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[31][2] = 1.2609825708930001E-07;
@@ -12426,7 +12246,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[31][30] = 1.5609266000649000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[31][31] = -1.9283272143943999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[32]    = JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Snm[32][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[32][1] = 2.1264765113961000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[32][2] = 7.1272989420657994E-08;
@@ -12461,7 +12280,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[32][31] = -2.6564017813741998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[32][32] = -5.4247891434638002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[33]    = JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Snm[33][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[33][1] = -5.4604724184200003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[33][2] = -3.3275343622261999E-07;
@@ -12497,7 +12315,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[33][32] = 3.8223473969026000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[33][33] = 6.8562688932706004E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[34]    = JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Snm[34][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[34][1] = -2.3966499346854000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[34][2] = -2.4648471402542000E-08;
@@ -12534,7 +12351,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[34][33] = 4.1762365503831000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[34][34] = -4.3776458899994001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[35]    = JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Snm[35][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[35][1] = 4.7224153826878999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[35][2] = 2.1357423595896000E-07;
@@ -12572,7 +12388,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[35][34] = -1.4786399632313001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[35][35] = 2.3467711715841999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[36]    = JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Snm[36][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[36][1] = 4.8918831129409997E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[36][2] = -1.2501867671547000E-07;
@@ -12611,7 +12426,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[36][35] = 4.5714390448056002E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[36][36] = 2.2240071779010999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[37]    = JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Snm[37][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[37][1] = 1.0540362040005999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[37][2] = -3.7797580995717999E-07;
@@ -12651,7 +12465,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[37][36] = -1.8831847049823999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[37][37] = -1.1402325748670000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[38]    = JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Snm[38][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[38][1] = 1.3512521728575999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[38][2] = 1.9563225649814001E-08;
@@ -12692,7 +12505,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[38][37] = 3.1531946181654001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[38][38] = -3.0335772936324998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[39]    = JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Snm[39][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[39][1] = -1.5329476978093000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[39][2] = -4.8377176098948999E-08;
@@ -12734,7 +12546,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[39][38] = 1.3852892118820999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[39][39] = -1.0284988392502000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[40]    = JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Snm[40][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[40][1] = 1.0770186583474000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[40][2] = 2.3149665546864000E-07;
@@ -12777,7 +12588,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[40][39] = 2.5709566938499998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[40][40] = 1.0328732769372999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[41]    = JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Snm[41][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[41][1] = 3.1143062115098003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[41][2] = -1.9216208730323999E-07;
@@ -12821,7 +12631,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[41][40] = -1.8860309277497001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[41][41] = 3.1644075895687998E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[42]    = JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Snm[42][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[42][1] = -1.3205852662140000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[42][2] = -3.1179270006891001E-07;
@@ -12866,7 +12675,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[42][41] = -1.1469725269642001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[42][42] = -1.7815661182170999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[43]    = JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Snm[43][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[43][1] = -2.3938990291601001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[43][2] = -3.2148551984340002E-07;
@@ -12912,7 +12720,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[43][42] = 2.0243318063354000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[43][43] = -7.1181638168776998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[44]    = JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Snm[44][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[44][1] = -1.1750533330908999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[44][2] = 2.1852620670063001E-07;
@@ -12959,7 +12766,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[44][43] = -3.2663461297895998E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[44][44] = -2.4173693545519999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[45]    = JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Snm[45][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[45][1] = 2.5232571103493999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[45][2] = 1.4702391604190999E-07;
@@ -13007,7 +12813,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[45][44] = 1.2450067347037999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[45][45] = 5.8147859391165000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[46]    = JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Snm[46][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[46][1] = -8.8448734873776002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[46][2] = 2.5802849983170999E-08;
@@ -13056,7 +12861,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[46][45] = -2.8329713843330002E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[46][46] = -1.3175265885507000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[47]    = JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Snm[47][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[47][1] = 5.2966114845469003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[47][2] = -1.5714142817832998E-08;
@@ -13106,7 +12910,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[47][46] = 8.5730156273182006E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[47][47] = 1.5849748732017000E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[48]    = JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Snm[48][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[48][1] = -8.1960346463829999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[48][2] = -2.8975105986277001E-08;
@@ -13157,7 +12960,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[48][47] = -1.3880530332446000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[48][48] = -8.1538547232777000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[49]    = JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Snm[49][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[49][1] = 1.8399483494042000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[49][2] = -1.1332130870561999E-07;
@@ -13209,7 +13011,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[49][48] = -8.4856744253397994E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[49][49] = -4.3682211344138003E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[50]    = JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Snm[50][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[50][1] = -1.1484347004922000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[50][2] = 3.8787415615340000E-08;
@@ -13262,7 +13063,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[50][49] = 1.6295224794695000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[50][50] = 5.7913479612164999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[51]    = JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Snm[51][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[51][1] = -5.0993821956572001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[51][2] = -2.5655203858889001E-07;
@@ -13316,7 +13116,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[51][50] = -2.1195952600907000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[51][51] = 1.7620151383571999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[52]    = JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Snm[52][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[52][1] = -3.4013074263718003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[52][2] = 2.0826008881067000E-07;
@@ -13371,7 +13170,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[52][51] = 1.3334911928079001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[52][52] = 4.0776783739540002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[53]    = JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Snm[53][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[53][1] = 2.8993778551734002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[53][2] = -2.3931526604982002E-07;
@@ -13427,7 +13225,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[53][52] = -2.2989843039643999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[53][53] = 2.8888083149651998E-10;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[54]    = JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Snm[54][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[54][1] = -1.9806077204536000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[54][2] = 7.8869800194908998E-08;
@@ -13484,7 +13281,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[54][53] = 3.1073584766454998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[54][54] = 1.8764706284105999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[55]    = JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Snm[55][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[55][1] = 1.6175655261949001E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[55][2] = 4.8925974065335004E-09;
@@ -13542,7 +13338,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[55][54] = 5.8161586514192001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[55][55] = -5.0574785520647001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[56]    = JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Snm[56][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[56][1] = -2.8435814224490999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[56][2] = 6.7175895589155998E-08;
@@ -13601,7 +13396,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[56][55] = 2.9832588482030999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[56][56] = -3.2781598210601997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[57]    = JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Snm[57][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[57][1] = 7.3712386138998003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[57][2] = -2.5948370735803999E-08;
@@ -13661,7 +13455,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[57][56] = 7.1988272705027003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[57][57] = 2.3160362122251999E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[58]    = JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Snm[58][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[58][1] = -1.7713634229331999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[58][2] = -2.3281805969991999E-07;
@@ -13722,7 +13515,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[58][57] = -1.5049619732115000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[58][58] = -3.7754800829393002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[59]    = JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Snm[59][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[59][1] = -2.4241709920635001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[59][2] = 1.1554294334655000E-07;
@@ -13784,7 +13576,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[59][58] = -6.3003720843681003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[59][59] = 7.9105586582258006E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[60]    = JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Snm[60][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[60][1] = -3.6382858915428002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[60][2] = -7.5001052773241000E-08;
@@ -13847,7 +13638,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[60][59] = -5.3851416030997002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[60][60] = -1.1059806816291000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[61]    = JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Snm[61][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[61][1] = 9.0421961525322996E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[61][2] = 1.6889377397366001E-07;
@@ -13911,7 +13701,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[61][60] = 4.8132679324729997E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[61][61] = 4.6263052307711001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[62]    = JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Snm[62][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[62][1] = 6.8886277669111994E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[62][2] = -9.3267788130330995E-09;
@@ -13976,7 +13765,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[62][61] = -6.6768922186158997E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[62][62] = 8.0524948346917006E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[63]    = JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Snm[63][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[63][1] = -1.0069802775348000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[63][2] = 1.3789022850926999E-07;
@@ -14042,7 +13830,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[63][62] = -1.5189752843398001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[63][63] = -6.6297955778670001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[64]    = JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Snm[64][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[64][1] = 2.7625760634286000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[64][2] = -4.5392884262640999E-08;
@@ -14109,7 +13896,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[64][63] = -2.4009922800907000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[64][64] = 8.2850350908819994E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[65]    = JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Snm[65][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[65][1] = -7.8047447033214998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[65][2] = 1.1037801667611000E-07;
@@ -14177,7 +13963,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[65][64] = -1.6619200438501999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[65][65] = -7.9702648146570002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[66]    = JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Snm[66][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[66][1] = 1.3388895476178999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[66][2] = -4.7358414293260997E-08;
@@ -14246,7 +14031,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[66][65] = 4.6269787495106003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[66][66] = 7.2635315378896994E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[67]    = JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Snm[67][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[67][1] = -1.0319277714087000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[67][2] = -1.3857830054124001E-07;
@@ -14316,7 +14100,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[67][66] = -5.0606124934173999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[67][67] = -2.8181006484727999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[68]    = JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Snm[68][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[68][1] = -1.3411445519213000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[68][2] = 1.7499126901130001E-08;
@@ -14387,7 +14170,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[68][67] = 5.0396610870321004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[68][68] = 5.4746584079193003E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[69]    = JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Snm[69][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[69][1] = 1.5204580448439999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[69][2] = 1.2516022626233999E-07;
@@ -14459,7 +14241,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[69][68] = -3.7300022889994998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[69][69] = 9.6609464907019004E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[70]    = JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Snm[70][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[70][1] = 1.5836737254982000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[70][2] = -1.0758306029270000E-07;
@@ -14532,7 +14313,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[70][69] = -8.5196831241143002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[70][70] = -1.0389892663361001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[71]    = JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Snm[71][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[71][1] = -4.3764918527974002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[71][2] = 4.9913459567494997E-08;
@@ -14606,7 +14386,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[71][70] = 1.7196133396998000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[71][71] = 2.4286807050797002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[72]    = JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Snm[72][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[72][1] = -1.4014753620284000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[72][2] = -1.3586512003061999E-07;
@@ -14681,7 +14460,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[72][71] = 4.2073423836111001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[72][72] = 3.7998049732530001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[73]    = JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Snm[73][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[73][1] = -9.0793877831947995E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[73][2] = 1.0553005893061000E-07;
@@ -14757,7 +14535,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[73][72] = -1.5791614407360001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[73][73] = 2.0999039258505000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[74]    = JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Snm[74][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[74][1] = -7.9118590305929008E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[74][2] = 5.7596133850344999E-08;
@@ -14834,7 +14611,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[74][73] = 2.6651552593029001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[74][74] = -3.6542809130408002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[75]    = JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Snm[75][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[75][1] = -2.7091385804092001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[75][2] = 1.2442947450803999E-07;
@@ -14912,7 +14688,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[75][74] = -9.6567256730679005E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[75][75] = 1.5339314804092999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[76]    = JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Snm[76][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[76][1] = 8.3598571072721006E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[76][2] = -4.3209197197375002E-08;
@@ -14991,7 +14766,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[76][75] = 5.6086151006026999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[76][76] = 1.0072073177002001E-07;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[77]    = JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Snm[77][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[77][1] = -2.8207493690399999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[77][2] = 6.8433978338093005E-08;
@@ -15071,7 +14845,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[77][76] = 3.5697683249539000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[77][77] = -6.7254811753853994E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[78]    = JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Snm[78][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[78][1] = -1.5270738345688000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[78][2] = -5.3655400011798998E-08;
@@ -15152,7 +14925,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[78][77] = -6.1670991015421006E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[78][78] = 3.0886115182118003E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[79]    = JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Snm[79][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[79][1] = 3.6257267069313997E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[79][2] = 7.3788643311140006E-08;
@@ -15234,7 +15006,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[79][78] = -4.7806071023550002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[79][79] = 3.4734843746029998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[80]    = JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Snm[80][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[80][1] = 2.1452229687010999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[80][2] = 4.6857082311563997E-08;
@@ -15317,7 +15088,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[80][79] = -3.6340782523865999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[80][80] = 3.8636193339564002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[81]    = JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Snm[81][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[81][1] = -9.5785138207763002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[81][2] = 2.8625560556839999E-08;
@@ -15401,7 +15171,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[81][80] = -4.8831665557957999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[81][81] = 4.4516023396559998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[82]    = JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Snm[82][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[82][1] = -5.3932067324266997E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[82][2] = 1.0107434925969000E-08;
@@ -15486,7 +15255,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[82][81] = -8.3862084330109006E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[82][82] = -4.4563453837557999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[83]    = JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Snm[83][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[83][1] = -1.1995152568723000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[83][2] = -1.4022955361674001E-08;
@@ -15572,7 +15340,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[83][82] = -4.5453931921842003E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[83][83] = 3.8652256763557000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[84]    = JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Snm[84][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[84][1] = -1.9847795407584999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[84][2] = -5.9397277784709002E-08;
@@ -15659,7 +15426,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[84][83] = -1.4351728471821999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[84][84] = 1.4288367369549999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[85]    = JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Snm[85][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[85][1] = -2.0864551565320001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[85][2] = 7.8874580302901995E-08;
@@ -15747,7 +15513,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[85][84] = -6.3234803772276002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[85][85] = -3.1131306328546002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[86]    = JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Snm[86][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[86][1] = 3.9619786801006002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[86][2] = -9.3853114159881998E-08;
@@ -15836,7 +15601,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[86][85] = 3.7185141356425999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[86][86] = 2.4979657683708001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[87]    = JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Snm[87][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[87][1] = -4.2303058695638001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[87][2] = 4.2602589954634996E-09;
@@ -15926,7 +15690,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[87][86] = -4.6962002700926998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[87][87] = -3.0792664573464998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[88]    = JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Snm[88][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[88][1] = -4.7049155831344997E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[88][2] = -5.6989450746224002E-08;
@@ -16017,7 +15780,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[88][87] = 3.5422475368971000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[88][88] = 4.1223362652534000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[89]    = JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Snm[89][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[89][1] = -1.4413367638170001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[89][2] = 6.6762847403867000E-09;
@@ -16109,7 +15871,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[89][88] = -3.8754256520550999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[89][89] = -2.9973473736180000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[90]    = JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Snm[90][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[90][1] = -4.4458289009743999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[90][2] = -4.0177579877759000E-08;
@@ -16202,7 +15963,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[90][89] = 3.2060717530410001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[90][90] = -2.8302997818721001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[91]    = JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Snm[91][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[91][1] = -5.6951817424003998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[91][2] = 2.1445321249755001E-08;
@@ -16296,7 +16056,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[91][90] = 1.3882883951825000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[91][91] = 1.5793536612482000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[92]    = JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Snm[92][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[92][1] = -3.5858018041047000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[92][2] = 2.0573085567725999E-08;
@@ -16391,7 +16150,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[92][91] = -1.1005809763094999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[92][92] = 1.2085431533312000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[93]    = JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Snm[93][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[93][1] = -4.2504799153690000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[93][2] = -8.5746739515398002E-09;
@@ -16487,7 +16245,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[93][92] = -2.7688708302528002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[93][93] = 1.7392501150787001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[94]    = JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Snm[94][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[94][1] = 1.1963406155177999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[94][2] = -1.4582048659899000E-08;
@@ -16584,7 +16341,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[94][93] = -1.4170062012565000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[94][94] = -9.6506701334022006E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[95]    = JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Snm[95][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[95][1] = -6.2585102695901997E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[95][2] = -1.2656096771868000E-08;
@@ -16682,7 +16438,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[95][94] = 2.0451075937288999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[95][95] = 2.6224123292609001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[96]    = JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Snm[96][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[96][1] = -1.8901951947524999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[96][2] = 2.1332984038722000E-08;
@@ -16781,7 +16536,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[96][95] = -3.3785363224754999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[96][96] = -3.4272885333495001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[97]    = JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Snm[97][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[97][1] = 1.2075860622114001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[97][2] = 1.8212057920217000E-08;
@@ -16881,7 +16635,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[97][96] = 5.5630029929880997E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[97][97] = 5.2187201464184998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[98]    = JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Snm[98][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[98][1] = -2.0088755758593999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[98][2] = -2.1192620143484001E-08;
@@ -16982,7 +16735,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[98][97] = -5.3338504792687996E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[98][98] = -2.1973929057406999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[99]    = JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Snm[99][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[99][1] = 3.1745244932954999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[99][2] = 3.2131838674757001E-08;
@@ -17084,7 +16836,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[99][98] = -7.6799351251639004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[99][99] = 5.0805914402760002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[100]    = JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Snm[100][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[100][1] = -3.0316685950149002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][2] = -9.9456273989603999E-09;
@@ -17187,7 +16938,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[100][99] = -6.8968687213527998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][100] = -1.7949927459858001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[101]    = JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Snm[101][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[101][1] = -1.4709233478027000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[101][2] = 1.7128107524384000E-08;
@@ -17291,7 +17041,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[101][100] = -1.0182654642695999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[101][101] = -9.9530483052486003E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[102]    = JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Snm[102][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[102][1] = 5.4695278834958000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[102][2] = 3.8024669340449001E-09;
@@ -17396,7 +17145,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[102][101] = 2.9598266094887999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[102][102] = -9.6965969421952999E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[103]    = JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Snm[103][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[103][1] = -3.1542550524070000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[103][2] = 1.0156859733144000E-08;
@@ -17502,7 +17250,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[103][102] = -4.1607271842291998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[103][103] = -2.8537119362132999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[104]    = JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Snm[104][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[104][1] = 3.4601644411470002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[104][2] = 4.1103529893049998E-08;
@@ -17609,7 +17356,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[104][103] = 4.7745707752145999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[104][104] = 5.9342113960182999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[105]    = JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Snm[105][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[105][1] = 1.3488984809104000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[105][2] = -9.9807808347716998E-09;
@@ -17717,7 +17463,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[105][104] = -2.6080374974850999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[105][105] = -3.4211403393532997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[106]    = JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Snm[106][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[106][1] = -1.0483831619019001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[106][2] = 2.4556827155578999E-08;
@@ -17826,7 +17571,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[106][105] = -1.8271048079343000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[106][106] = -4.0767250960121002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[107]    = JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Snm[107][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[107][1] = -7.2850774753210998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[107][2] = -5.3077245916894001E-09;
@@ -17936,7 +17680,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[107][106] = -2.7077288394328999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[107][107] = 2.4913248706481001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[108]    = JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Snm[108][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[108][1] = 2.1924361827566000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[108][2] = -1.7801377991855000E-08;
@@ -18047,7 +17790,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[108][107] = 1.6020095105438001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[108][108] = 1.4749066242416999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[109]    = JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Snm[109][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[109][1] = 6.6517490340307001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[109][2] = 1.2881912788740000E-08;
@@ -18159,7 +17901,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[109][108] = 2.0882938591566999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[109][109] = -3.1937251629515000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[110]    = JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Snm[110][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[110][1] = -3.2219343137499003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[110][2] = 4.3392792610853002E-09;
@@ -18272,7 +18013,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[110][109] = -5.5255932346589001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[110][110] = 1.7130113207536001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[111]    = JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Snm[111][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[111][1] = -1.0699951796410001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[111][2] = -2.0869819819283998E-08;
@@ -18386,7 +18126,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[111][110] = 4.4059625489394999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[111][111] = 1.7062365344496000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[112]    = JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Snm[112][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[112][1] = -1.8889516998497999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[112][2] = 3.0223939399509003E-08;
@@ -18501,7 +18240,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[112][111] = -5.2560666942267002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[112][112] = -2.0324416243767001E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[113]    = JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Snm[113][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[113][1] = 3.9428649844112999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[113][2] = -3.9470240241193001E-08;
@@ -18617,7 +18355,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[113][112] = 1.6282937785846001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[113][113] = -4.4993166896651001E-10;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[114]    = JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Snm[114][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[114][1] = 8.9870255730845003E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][2] = 1.9277572626431999E-08;
@@ -18734,7 +18471,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[114][113] = 2.0765482714607001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[114][114] = 2.7375247897305998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[115]    = JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Snm[115][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[115][1] = -7.1253197188682002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[115][2] = -4.0595154491962996E-09;
@@ -18852,7 +18588,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[115][114] = -2.9945953313943998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[115][115] = -2.4513182643578000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[116]    = JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Snm[116][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[116][1] = 1.4953355908139002E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[116][2] = 3.6770132548553002E-08;
@@ -18971,7 +18706,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[116][115] = 1.8441108764771001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[116][116] = -2.0218727274041998E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[117]    = JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Snm[117][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[117][1] = 2.4588999898866998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[117][2] = -3.5076221514226003E-08;
@@ -19091,7 +18825,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[117][116] = 2.7612175931064002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[117][117] = 4.6874313983575999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[118]    = JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Snm[118][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[118][1] = -1.3518591454746000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[118][2] = -4.7105919076270996E-09;
@@ -19212,7 +18945,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[118][117] = -1.3210576066154000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[118][118] = -7.6543715733072005E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[119]    = JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Snm[119][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[119][1] = -7.8374970686473994E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[119][2] = 5.4305147715533001E-09;
@@ -19334,7 +19066,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[119][118] = -1.8018190076017999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[119][119] = -4.0702874776524002E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[120]    = JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Snm[120][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[120][1] = 2.0976668190908001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[120][2] = 2.2584544890031999E-08;
@@ -19457,7 +19188,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[120][119] = 4.5430382338230003E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[120][120] = 3.2878293435875997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[121]    = JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Snm[121][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[121][1] = 1.1842816844765000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[121][2] = -4.4511083352615997E-09;
@@ -19581,7 +19311,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[121][120] = 7.5909796819405992E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[121][121] = -2.6836341042405000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[122]    = JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Snm[122][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[122][1] = -5.4298218120326001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[122][2] = -3.0563459844941998E-08;
@@ -19706,7 +19435,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[122][121] = -1.1404232955344999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[122][122] = -4.1657570631763000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[123]    = JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Snm[123][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[123][1] = 1.8007965439236998E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[123][2] = 1.2217771648191000E-08;
@@ -19832,7 +19560,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[123][122] = 3.2730543629456001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][123] = 3.3187801826600003E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[124]    = JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Snm[124][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[124][1] = 1.1342172627372001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[124][2] = -1.2021339870818001E-08;
@@ -19959,7 +19686,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[124][123] = -1.3709542271415000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[124][124] = -3.9814682160870999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[125]    = JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Snm[125][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[125][1] = -1.2765422906878000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[125][2] = -2.8580604547962001E-08;
@@ -20087,7 +19813,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[125][124] = 1.5018031130088001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[125][125] = 2.8896299920039000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[126]    = JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Snm[126][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[126][1] = -1.9518447157205000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[126][2] = 1.1985775123926001E-08;
@@ -20216,7 +19941,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[126][125] = 1.6218295294955000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[126][126] = -3.6801306043927000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[127]    = JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Snm[127][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[127][1] = -1.1517968792890000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[127][2] = 4.4197880327632997E-08;
@@ -20346,7 +20070,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[127][126] = 2.0872442237962999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[127][127] = 2.7384292360929999E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[128]    = JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Snm[128][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[128][1] = 3.3399705947791000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[128][2] = -2.4210300117547999E-08;
@@ -20477,7 +20200,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[128][127] = -2.9640789528068999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[128][128] = -2.0096915554105000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[129]    = JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Snm[129][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[129][1] = 2.2717814667935999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[129][2] = 1.0502586040949001E-08;
@@ -20609,7 +20331,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[129][128] = -5.7000988229071001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[129][129] = -1.1987527221429000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[130]    = JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Snm[130][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[130][1] = 5.4425976283895997E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[130][2] = -9.3776090066491995E-09;
@@ -20742,7 +20463,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[130][129] = 5.8661048808154003E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[130][130] = 3.1209209122371997E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[131]    = JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Snm[131][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[131][1] = -1.3378860723552000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[131][2] = -3.2652059832816997E-08;
@@ -20876,7 +20596,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[131][130] = -2.0403015917239001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[131][131] = -2.4515798035801000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[132]    = JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Snm[132][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[132][1] = -1.0859353619218000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[132][2] = -4.7316232722744002E-09;
@@ -21011,7 +20730,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[132][131] = -2.7430888070450999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[132][132] = 5.6212368002083003E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[133]    = JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Snm[133][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[133][1] = -2.3388151811885000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[133][2] = 1.1640151075705000E-08;
@@ -21147,7 +20865,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[133][132] = 2.9486453198750999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[133][133] = 1.2231818171050000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[134]    = JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Snm[134][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[134][1] = -2.0109791063388001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[134][2] = -1.5176377452921001E-08;
@@ -21284,7 +21001,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[134][133] = 3.9307100004136002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[134][134] = -1.0509056184295000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[135]    = JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Snm[135][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[135][1] = -1.9139258803517999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[135][2] = 1.9056976477902000E-08;
@@ -21422,7 +21138,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[135][134] = -3.2299112190839001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[135][135] = -2.5634620116093000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[136]    = JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Snm[136][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[136][1] = -1.2408229062058001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[136][2] = 3.3610604166971001E-08;
@@ -21561,7 +21276,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[136][135] = 6.2110874924735001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[136][136] = 6.4204795197138998E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[137]    = JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Snm[137][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[137][1] = 8.2131290659041002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[137][2] = 1.6934224480215000E-08;
@@ -21701,7 +21415,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[137][136] = 4.0047466184717004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[137][137] = -9.5228249966971000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[138]    = JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Snm[138][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[138][1] = 2.4911927063396001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[138][2] = -2.0506456605286999E-08;
@@ -21842,7 +21555,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[138][137] = 3.1080285211828998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[138][138] = -9.0174197643587003E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[139]    = JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Snm[139][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[139][1] = 3.7709897176042004E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[139][2] = 3.2598361159935001E-09;
@@ -21984,7 +21696,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[139][138] = -6.8288576420663002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[139][139] = -1.4528170431312000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[140]    = JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Snm[140][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[140][1] = 1.5112179963799001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[140][2] = -2.8492786663383999E-08;
@@ -22127,7 +21838,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[140][139] = -1.3357596233616000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[140][140] = 6.3476952253166001E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[141]    = JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Snm[141][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[141][1] = -1.0270881644650999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[141][2] = 1.0999385812457000E-08;
@@ -22271,7 +21981,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[141][140] = 1.6497591509794001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[141][141] = 1.1791817895401000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[142]    = JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Snm[142][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[142][1] = -2.3790949182870001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[142][2] = 1.8914181799499000E-09;
@@ -22416,7 +22125,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[142][141] = -1.1192065844256001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[142][142] = -2.5128681555448000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[143]    = JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Snm[143][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[143][1] = -4.1901413247809003E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[143][2] = 1.7842614695157001E-08;
@@ -22562,7 +22270,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[143][142] = 1.2351898235483000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[143][143] = 1.6001718570840000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[144]    = JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Snm[144][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[144][1] = 1.0670714384963000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[144][2] = 9.3337835722246001E-09;
@@ -22709,7 +22416,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[144][143] = -2.2264246251511001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[144][144] = 4.8037988413567004E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[145]    = JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Snm[145][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[145][1] = -6.4131638097940999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[145][2] = -1.2781954259414000E-08;
@@ -22857,7 +22563,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[145][144] = 1.2182705760535001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[145][145] = -8.8013358789408006E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[146]    = JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Snm[146][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[146][1] = -1.2542520018899999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[146][2] = -3.7879282603935997E-09;
@@ -23006,7 +22711,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[146][145] = -1.6194225563499000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[146][146] = 9.1971652246813003E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[147]    = JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Snm[147][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[147][1] = 3.7250730005791999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[147][2] = 1.1779028135180000E-08;
@@ -23156,7 +22860,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[147][146] = 1.5153474793860000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[147][147] = -2.4518403487260002E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[148]    = JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Snm[148][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[148][1] = -2.3008706930228998E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[148][2] = -9.9155063478164002E-09;
@@ -23307,7 +23010,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[148][147] = -2.3235568473010999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[148][148] = -1.2166827559697000E-08;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[149]    = JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Snm[149][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[149][1] = 1.9382808675765002E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[149][2] = -3.4505514118348000E-09;
@@ -23459,7 +23161,6 @@ SphericalHarmonicsGravitySource_moon_GRAIL150_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[149][148] = 8.0449427314062001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[149][149] = 8.5415618531844996E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[150]    = JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Snm[150][0] = 0.0000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[150][1] = -4.9032074347101000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[150][2] = -2.9747841817494001E-09;
@@ -66,39 +66,29 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->tide_free_delta = 0.0;
 
    SphericalHarmonicsGravitySource_ptr->Cnm =
-      JEOD_ALLOC_PRIM_ARRAY (150 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (150 + 1, 0, double);
    SphericalHarmonicsGravitySource_ptr->Snm =
-      JEOD_ALLOC_PRIM_ARRAY (150 + 1, double*);
+      JEOD_ALLOC_PRIM_TRIANGLE (150 + 1, 0, double);
 
    /* FULLY NORMALIZED GRAVITY COEFFICIENTS (unitless) */
-   SphericalHarmonicsGravitySource_ptr->Cnm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  0] = -9.090109494810000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  1] = -1.862736081840000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[  2][  2] = +3.463762742080000E-05;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  0] = -3.203071679590000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  1] = +2.634183586220000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  2] = +1.418533167860000E-05;
    SphericalHarmonicsGravitySource_ptr->Cnm[  3][  3] = +1.228626450440000E-05;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  0] = +3.214095450280000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  1] = -6.000619397400000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  2] = -7.093701015440000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  3] = -1.358804665940000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  4][  4] = -6.029391501930000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  0] = -2.210098763930000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  1] = -1.035608126300000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  2] = +4.381276093760000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  3] = +4.546942284370000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  4] = +2.772791043900000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  5][  5] = +3.126877268440000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  0] = +3.764790644750000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  1] = +1.534299939450000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  2] = -4.344947614360000E-06;
@@ -106,8 +96,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  4] = +3.719212812300000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  5] = +1.428350818720000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  6][  6] = -4.710224540580000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  0] = +5.613306564030000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  1] = +7.533479976340000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  2] = -6.607790461200000E-07;
@@ -116,8 +104,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  5] = -2.791930006380000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  6] = -1.034763552330000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  7][  7] = -1.784999963400000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  0] = +2.319539055200000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  1] = -3.986594931460000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  2] = +3.012381769960000E-06;
@@ -127,8 +113,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  6] = -1.537688378930000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  7] = -1.534542361100000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  8][  8] = -2.526240252780000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  0] = -3.542415821360000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  1] = +2.007566533730000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  2] = +1.969414143020000E-06;
@@ -139,8 +123,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  7] = -4.062604075100000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  8] = -1.297865287170000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[  9][  9] = -9.065288839160000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  0] = -9.330362858770000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  1] = +8.142365061440000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  2] = +2.331547122980000E-07;
@@ -152,8 +134,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  8] = -3.434261368850000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][  9] = -4.752173505190000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 10][ 10] = +9.354455955830000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  0] = -9.603531398040000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  1] = -8.236153138380000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  2] = +7.248154274590000E-07;
@@ -166,8 +146,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][  9] = -2.391411275420000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 10] = -4.699846425120000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 11][ 11] = -2.893566698500000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  0] = -1.886921625400000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  1] = -6.181406069530000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][  2] = -1.898842712250000E-07;
@@ -181,8 +159,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 10] = -3.101237396670000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 11] = -9.321679460820000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 12][ 12] = +3.098292656740000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  0] = +2.586504948770000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  1] = +1.070362892510000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][  2] = -3.496541951060000E-06;
@@ -197,8 +173,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 11] = -1.236175924960000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 12] = -6.699957764760000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 13][ 13] = +2.510096157370000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  0] = +3.263003307820000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  1] = +6.420032590450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][  2] = +5.428525323210000E-07;
@@ -214,8 +188,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 12] = -1.483489968850000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 13] = -1.697884891170000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 14][ 14] = -6.566164485740000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  0] = -9.725308529990000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  1] = -8.334583114360000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][  2] = -1.213674190840000E-07;
@@ -232,8 +204,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 13] = -4.845925874600000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 14] = +6.320235455650000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 15][ 15] = +6.135055999150001E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  0] = +3.184460401320000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  1] = -2.491223151840000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][  2] = +1.700598396650000E-06;
@@ -251,8 +221,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 14] = -4.576663590240000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 15] = -1.761693125520000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 16][ 16] = -9.628968590450000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  0] = -1.038226960540000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  1] = +8.954087022120000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][  2] = -2.175584815510000E-07;
@@ -271,8 +239,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 15] = -3.745498562030000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 16] = -4.523107620810000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 17][ 17] = -3.791369270330000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  0] = -3.729374825060000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  1] = +2.366665067370000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][  2] = -4.441053330340000E-07;
@@ -292,8 +258,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 16] = +1.160212548880000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 17] = +1.287255209750000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 18][ 18] = -1.188252500830000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  0] = +5.554462184850000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  1] = -4.177670912090000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][  2] = +2.798669251220000E-07;
@@ -314,8 +278,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 17] = -1.116168839780000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 18] = +1.120236394710000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 19][ 19] = +4.110889743330000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  0] = +6.479528616850000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  1] = -5.572866791860000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][  2] = +4.528099657880000E-07;
@@ -337,8 +299,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 18] = +5.669943123040000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 19] = -2.024590785590000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 20][ 20] = +1.177059630270000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  0] = -9.710991223150001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  1] = -3.203498933070000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][  2] = -1.421724588880000E-06;
@@ -361,8 +321,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 19] = +2.468723904560000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 20] = -5.223735218380000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 21][ 21] = -5.794667275250000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  0] = -1.223924503870000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  1] = -1.248534578850000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][  2] = -3.476541232610000E-07;
@@ -386,8 +344,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 20] = -1.052768716580000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 21] = +8.945565134380000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 22][ 22] = +5.174220621740000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  0] = -1.965893339480000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  1] = +4.508688197850000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][  2] = +3.473200197950000E-07;
@@ -412,8 +368,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 21] = +1.254442770280000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 22] = -1.199603333490000E-06;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 23][ 23] = -1.093929822230000E-06;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  0] = -2.777985763530000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  1] = +2.161279062200000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][  2] = +7.866010914190000E-07;
@@ -439,8 +393,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 22] = -3.216246324150000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 23] = +1.440260510710000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 24][ 24] = +8.827535054570001E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  0] = -1.629445534690000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  1] = +1.752468896660000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][  2] = -6.307536861630000E-07;
@@ -467,8 +419,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 23] = +9.833275312310001E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 24] = +8.795011413290000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 25][ 25] = +1.839962013280000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  0] = +9.244032430200001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  1] = +5.405368370780000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][  2] = +7.404159025160000E-07;
@@ -496,8 +446,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 24] = -4.425267859020000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 25] = -3.038781894890000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 26][ 26] = -2.103024832180000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  0] = -7.766460198450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  1] = +8.157687182200000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][  2] = -1.408506588280000E-07;
@@ -526,8 +474,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 25] = -8.276187297320000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 26] = -3.107415503690000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 27][ 27] = -3.770387335110000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  0] = +9.287714878460000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  1] = +1.025784631580000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][  2] = -2.204695410050000E-07;
@@ -557,8 +503,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 26] = +5.479426278810000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 27] = -2.795857478450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 28][ 28] = +1.898909072150000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  0] = -6.278145586870000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  1] = -1.480838086110000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][  2] = -1.637234612320000E-07;
@@ -589,8 +533,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 27] = -1.745363115000000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 28] = -6.438106114160000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 29][ 29] = +6.080518886270000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  0] = +1.696257242280000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  1] = -1.926115385890000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][  2] = -3.520962907760000E-07;
@@ -622,8 +564,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 28] = -1.455826455400000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 29] = +1.901192359380000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 30][ 30] = -1.976174441400000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  0] = +6.158111035710000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  1] = -8.091301620819999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][  2] = -1.951943884630000E-08;
@@ -656,8 +596,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 29] = +6.094419496310000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 30] = -5.574382465100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 31][ 31] = +1.251707726740000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  0] = -3.241137650820000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  1] = -3.211879942990000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][  2] = -5.838296708830000E-07;
@@ -691,8 +629,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 30] = -5.159533423280000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 31] = +4.302830443770000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 32][ 32] = +1.523065864170000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  0] = +9.959259306000001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  1] = +1.746018334450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][  2] = +6.956208427000000E-07;
@@ -727,8 +663,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 31] = -1.514547625120000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 32] = -5.955244229120000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 33][ 33] = +9.660837554960000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  0] = +7.971675602510000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  1] = +3.241250518990000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][  2] = +2.048370053750000E-07;
@@ -764,8 +698,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 32] = +6.866802188230000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 33] = -1.278997803220000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 34][ 34] = -9.896865096630000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  0] = +1.773938184010000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  1] = +1.422324384800000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][  2] = -4.144750781460000E-07;
@@ -802,8 +734,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 33] = +1.116636878030000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 34] = +3.087497926510000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 35][ 35] = +3.266107391050000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  0] = +6.127889052780000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  1] = -3.337734386790000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][  2] = +2.991672980390000E-07;
@@ -841,8 +771,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 34] = +1.959179986720000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 35] = +2.712263077680000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 36][ 36] = -2.988662866630000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  0] = +2.256937170390000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  1] = +8.921235796360000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][  2] = -2.536141792400000E-07;
@@ -881,8 +809,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 35] = +1.330913383980000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 36] = -3.384446946870000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 37][ 37] = +2.030975281140000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  0] = +4.498303324520000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  1] = -4.252141578670000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][  2] = +1.025152402830000E-07;
@@ -922,8 +848,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 36] = -2.257397067340000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 37] = -1.831692106760000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 38][ 38] = -2.883603100030000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  0] = -3.112594121030000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  1] = -5.690671898340000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][  2] = -7.518974079860000E-08;
@@ -964,8 +888,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 37] = +2.206868059870000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 38] = -1.399079169920000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 39][ 39] = +1.735325338320000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  0] = +6.525445676890000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  1] = +4.682167090700000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][  2] = -1.681322811930000E-07;
@@ -1007,8 +929,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 38] = +4.893136449880000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 39] = +4.768988561650000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 40][ 40] = +2.662821875840000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  0] = +1.732828603910000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  1] = -5.361199837250000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][  2] = +1.710091585820000E-07;
@@ -1051,8 +971,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 39] = +3.382887760780000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 40] = -2.670808051170000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 41][ 41] = +1.180003378420000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  0] = +2.152186988900000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  1] = -9.127594639350000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][  2] = -3.826109043440000E-07;
@@ -1096,8 +1014,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 40] = +6.916465628310000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 41] = +1.263284217850000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 42][ 42] = +1.731681666130000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  0] = -9.453250462310001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  1] = -1.707986834860000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][  2] = +1.405573304980000E-07;
@@ -1142,8 +1058,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 41] = -2.366883966490000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 42] = +7.817767331140000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 43][ 43] = -9.794575836249999E-10;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  0] = -8.493482759340000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  1] = +1.759474460380000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][  2] = +5.804080109210000E-08;
@@ -1189,8 +1103,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 42] = -6.675048865380000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 43] = -2.461403068450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 44][ 44] = +4.614043726570000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  0] = +1.854407833530000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  1] = +1.687692483790000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][  2] = +1.462983334350000E-07;
@@ -1237,8 +1149,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 43] = +1.405637266490000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 44] = +1.088580623980000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 45][ 45] = -6.583121383640000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  0] = -2.136002622450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  1] = -1.195430002360000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][  2] = -1.528523317140000E-07;
@@ -1286,8 +1196,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 44] = +1.981154368450000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 45] = +1.233937915460000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 46][ 46] = +8.003712969800000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  0] = +1.749076716860000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  1] = -1.280316237630000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][  2] = +4.553364114070000E-08;
@@ -1336,8 +1244,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 45] = +1.565464451310000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 46] = +1.604258819610000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 47][ 47] = -2.694030205480000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  0] = -8.406844224980001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  1] = +1.075445727800000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][  2] = -5.924999234850000E-09;
@@ -1387,8 +1293,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 46] = -2.446843282930000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 47] = -6.040273283459999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 48][ 48] = +1.321195888020000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  0] = +4.019313949770000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  1] = -4.463831621020000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][  2] = -8.376360858620001E-08;
@@ -1439,8 +1343,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 47] = +1.614860725380000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 48] = +7.465220507550001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 49][ 49] = -1.072079679020000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  0] = +1.683698274800000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  1] = -1.760704577280000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][  2] = +5.953723307430000E-08;
@@ -1492,8 +1394,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 48] = +6.874422325060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 49] = -2.725730518430000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 50][ 50] = +2.796746040710000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  0] = -1.116696552770000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  1] = -3.497701810500000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][  2] = -1.180989333120000E-07;
@@ -1546,8 +1446,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 49] = +7.483889276660000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 50] = +3.627538477250000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 51][ 51] = -1.211395639580000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  0] = +1.027887307280000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  1] = +6.578398424170000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][  2] = +7.155986206130000E-08;
@@ -1601,8 +1499,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 50] = -1.279886055380000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 51] = -2.455967535350000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 52][ 52] = +2.576740477160000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  0] = +1.013630713770000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  1] = +7.598701418850000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][  2] = -1.274686315490000E-07;
@@ -1657,8 +1553,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 51] = -4.293066137060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 52] = -1.123081851640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 53][ 53] = -1.206035978060000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  0] = -8.578950132050000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  1] = -1.032629436780000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][  2] = +1.313917579210000E-07;
@@ -1714,8 +1608,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 52] = -6.112333446550000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 53] = -6.120031070520000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 54][ 54] = +4.188167843470000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  0] = -1.756567097520000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  1] = -1.311717266390000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][  2] = -1.967944890630000E-07;
@@ -1772,8 +1664,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 53] = -3.638991601360000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 54] = +9.298185014640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 55][ 55] = -7.454961896160000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  0] = +5.807726328560000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  1] = -4.367723837990000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][  2] = -1.372381957270000E-08;
@@ -1831,8 +1721,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 54] = +4.509243903110000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 55] = -1.154994488200000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 56][ 56] = +5.925289478340000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  0] = +3.184667871100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  1] = -4.076352120390000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][  2] = +6.414799752390000E-08;
@@ -1891,8 +1779,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 55] = -1.047791787020000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 56] = +4.597817169340000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 57][ 57] = +3.366597839120000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  0] = +5.104493316060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  1] = +9.047349083829999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][  2] = +1.161481142270000E-07;
@@ -1952,8 +1838,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 56] = -3.295111220960000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 57] = -8.928954865650000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 58][ 58] = +2.718775274640000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  0] = +9.363432893670000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  1] = -1.499873017130000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][  2] = -1.018874559950000E-07;
@@ -2014,8 +1898,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 57] = -9.571876521970000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 58] = +4.777617631310000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 59][ 59] = +9.713656380970000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  0] = +4.200681438910000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  1] = +1.402318672620000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][  2] = +1.079909915840000E-07;
@@ -2077,8 +1959,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 58] = +3.489656360110000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 59] = -4.133162873810000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 60][ 60] = -1.099856607240000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  0] = +7.170759212570001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  1] = -2.297789935060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][  2] = +1.118543144890000E-07;
@@ -2141,8 +2021,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 59] = +6.137593698650001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 60] = -7.278009028190001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 61][ 61] = +1.588995235060000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  0] = +9.009976276490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  1] = +9.433253910569999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][  2] = +1.329893653780000E-08;
@@ -2206,8 +2084,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 60] = -3.768906908170000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 61] = +7.140329288970000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 62][ 62] = -5.824885499480000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  0] = -4.126490783130000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  1] = -7.718785062030000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][  2] = -3.592891223550000E-08;
@@ -2272,8 +2148,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 61] = +3.845463028790000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 62] = -2.903035600500000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 63][ 63] = -1.164590028280000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  0] = +7.588652315320000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  1] = +7.987424525320001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][  2] = +2.134405199510000E-07;
@@ -2339,8 +2213,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 62] = +1.211334002970000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 63] = -1.418489920460000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 64][ 64] = +1.257671039240000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  0] = +3.359465630170000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  1] = -5.430441627320000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][  2] = +1.885509170470000E-08;
@@ -2407,8 +2279,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 63] = +4.931128145910000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 64] = +1.819503345760000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 65][ 65] = -5.231560889670000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  0] = +9.045232201040000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  1] = +5.997136493480000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][  2] = -3.951286524390000E-08;
@@ -2476,8 +2346,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 64] = -9.657834227240000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 65] = -1.207399119340000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 66][ 66] = -1.160232969790000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  0] = -2.274295594850000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  1] = -4.417278959000000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][  2] = +9.245018262710000E-08;
@@ -2546,8 +2414,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 65] = -2.778866134070000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 66] = +9.404388639980000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 67][ 67] = -5.227688081280000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  0] = +1.092878440720000E-07;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  1] = +4.752285352140000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][  2] = -8.593296404570001E-09;
@@ -2617,8 +2483,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 66] = -4.078658924230000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 67] = +1.782545328510000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 68][ 68] = +9.286365829100000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  0] = -5.164967510580000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  1] = -5.169033508210000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][  2] = +4.881448436460000E-08;
@@ -2689,8 +2553,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 67] = +8.403156208580000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 68] = -8.947818713420000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 69][ 69] = -4.949251620280000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  0] = -3.457483887640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  1] = -4.886894128820000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][  2] = -2.262454365830000E-08;
@@ -2762,8 +2624,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 68] = -2.863290307570000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 69] = +6.556983398190000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 70][ 70] = -5.144206887800000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  0] = -4.429190436940000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  1] = -2.487057097840000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][  2] = +2.952956141530000E-08;
@@ -2836,8 +2696,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 69] = -3.234857784640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 70] = -5.184453680800000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 71][ 71] = -2.219489785300000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  0] = +4.041982370940000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  1] = +4.160281803840000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][  2] = -6.962569109499999E-08;
@@ -2911,8 +2769,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 70] = +7.077366442450001E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 71] = -4.170666897250000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 72][ 72] = +4.312602656260000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  0] = +1.777020801400000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  1] = -9.279301675560000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][  2] = +9.267547409330000E-08;
@@ -2987,8 +2843,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 71] = -4.762040101810000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 72] = -2.598320764290000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 73][ 73] = -7.080869632259999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  0] = -5.098116776930000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  1] = +2.745715859940000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][  2] = -2.719901285210000E-08;
@@ -3064,8 +2918,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 72] = -4.526616101260000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 73] = +6.545253699390000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 74][ 74] = +3.786165138640000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  0] = +2.491801363150000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  1] = +1.086427169740000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][  2] = +3.691251670710000E-09;
@@ -3142,8 +2994,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 73] = -4.200775218420000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 74] = -5.090816197120000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 75][ 75] = +5.839125763530000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  0] = +1.415026279890000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  1] = +1.812786658230000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][  2] = -5.032905314070000E-08;
@@ -3221,8 +3071,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 74] = +7.646254335400000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 75] = -4.250341550520000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 76][ 76] = -3.210933263560000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  0] = +8.555997474730000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  1] = -1.372472388830000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][  2] = +6.513830705810000E-08;
@@ -3301,8 +3149,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 75] = +2.000999445370000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 76] = +2.647704007980000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 77][ 77] = -3.564045193550000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  0] = +3.040927923030000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  1] = +1.703779779070000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][  2] = +3.370513781600000E-08;
@@ -3382,8 +3228,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 76] = +6.095526073420000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 77] = -6.649460766580000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 78][ 78] = +4.446636407990000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  0] = -1.084216021360000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  1] = -1.069927636250000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][  2] = -6.661057361580000E-09;
@@ -3464,8 +3308,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 77] = -3.093209941120000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 78] = +7.900883756339999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 79][ 79] = +8.928221150759999E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  0] = +3.851074897280000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  1] = -4.273795510800000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][  2] = +1.072092073160000E-09;
@@ -3547,8 +3389,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 78] = +3.623057239220000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 79] = +4.591989673770000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 80][ 80] = -9.665560834160001E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  0] = -3.343553179780000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  1] = +3.279167034550000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][  2] = +1.796934140420000E-08;
@@ -3631,8 +3471,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 79] = +4.215344244460000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 80] = -4.048186986050000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 81][ 81] = -2.799867580890000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  0] = -6.977287071700000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  1] = -3.581547028660000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][  2] = +3.236454537880000E-08;
@@ -3716,8 +3554,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 80] = -4.421013107800000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 81] = +8.605142119190000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 82][ 82] = +2.955461060130000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  0] = +3.274401667710000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  1] = -3.302672286690000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][  2] = -1.404378209360000E-08;
@@ -3802,8 +3638,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 81] = +1.376848073020000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 82] = +1.968095267100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 83][ 83] = +1.010837285760000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  0] = -3.174955611730000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  1] = -1.181187131060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][  2] = +1.448839959640000E-08;
@@ -3889,8 +3723,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 82] = -4.779377462800000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 83] = -2.908486043420000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 84][ 84] = -4.225296913500000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  0] = -2.096367877920000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  1] = -2.767628325060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][  2] = -1.072033890900000E-09;
@@ -3977,8 +3809,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 83] = -2.646789221090000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 84] = +7.290058536750000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 85][ 85] = +2.226789599670000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  0] = +1.007637240630000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  1] = +6.572830595520000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][  2] = -2.212735823800000E-08;
@@ -4066,8 +3896,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 84] = +7.519149031309999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 85] = -5.891098606840000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 86][ 86] = -6.335440443860000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  0] = -3.969276863480000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  1] = -3.095455323780000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][  2] = +5.033216756720000E-08;
@@ -4156,8 +3984,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 85] = +2.081911617680000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 86] = -4.031953182240000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 87][ 87] = +1.211891719980000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  0] = +1.905808742990000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  1] = -1.263782438170000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][  2] = -1.383123399180000E-08;
@@ -4247,8 +4073,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 86] = -5.474125254100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 87] = -2.401515445650000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 88][ 88] = -8.741937745440000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  0] = -1.099736840130000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  1] = +2.068415849820000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][  2] = +2.063030633230000E-08;
@@ -4339,8 +4163,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 87] = +2.259456641090000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 88] = +4.479699239170000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 89][ 89] = -4.566204590830000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  0] = -1.367302816020000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  1] = -1.127334402600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][  2] = -4.408919505960000E-08;
@@ -4432,8 +4254,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 88] = -1.947140349890000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 89] = -6.166707712860000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 90][ 90] = +2.544985839660000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  0] = -8.908447637960000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  1] = +1.614629118180000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][  2] = +4.519119572210000E-08;
@@ -4526,8 +4346,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 89] = +1.357821058990000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 90] = -5.877763743270000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 91][ 91] = -2.272782252470000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  0] = -1.576292215590000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  1] = -7.493431205930000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][  2] = -2.670791445780000E-08;
@@ -4621,8 +4439,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 90] = -1.219437960820000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 91] = -3.083139616260000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 92][ 92] = -1.345396333190000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  0] = -1.769413970940000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  1] = +2.197174305520000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][  2] = +1.596129836050000E-08;
@@ -4717,8 +4533,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 91] = -4.334115055040000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 92] = +1.426034367630000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 93][ 93] = +6.028108274420000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  0] = -4.769298904330000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  1] = -3.400899462440000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][  2] = -2.470314669080000E-08;
@@ -4814,8 +4628,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 92] = +8.622624471900000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 93] = -1.635726773950000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 94][ 94] = -2.121132901480000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  0] = +1.280245281700000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  1] = +1.174386858580000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][  2] = +1.837761324740000E-08;
@@ -4912,8 +4724,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 93] = -6.447030710540000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 94] = -2.896782648240000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 95][ 95] = -5.803908825080000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  0] = -1.880670477640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  1] = -1.026278847670000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][  2] = -2.553924636280000E-08;
@@ -5011,8 +4821,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 94] = -2.972102520880000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 95] = +2.508524264500000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 96][ 96] = +2.397862005790000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  0] = -7.613312101510000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  1] = +3.312446006110000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][  2] = -8.766416175869999E-09;
@@ -5111,8 +4919,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 95] = +5.919106798610000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 96] = -1.602022627600000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 97][ 97] = +3.469960501500000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  0] = -3.209064254370000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  1] = -8.341630107200001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][  2] = -2.047593644590000E-08;
@@ -5212,8 +5018,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 96] = +1.589053530060000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 97] = -7.583794598740000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 98][ 98] = -1.967939265260000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  0] = +1.105528757840000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  1] = +1.746624778460000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][  2] = -3.587253964950000E-08;
@@ -5314,8 +5118,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 97] = -3.784372121740000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 98] = +5.264197580600000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[ 99][ 99] = -3.279168575260000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  0] = -3.468164564010000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  1] = +1.008880552310000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][  2] = -1.890886095940000E-08;
@@ -5417,8 +5219,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 98] = -7.044033747630000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][ 99] = +2.452371926100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[100][100] = -1.561853876200000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  0] = +1.093035977870000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  1] = -1.268732240600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][  2] = -2.780597405760000E-09;
@@ -5521,8 +5321,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[101][ 99] = +1.323266161870000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][100] = +1.913898981250000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[101][101] = +2.624804172340000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  0] = -1.855223430280000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  1] = +3.157656741730000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][  2] = -3.345653824870000E-08;
@@ -5626,8 +5424,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[102][100] = -4.037836507810000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][101] = -6.217667583290000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[102][102] = -2.814364151100000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  0] = -1.769220761100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  1] = -1.249716344380000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][  2] = +6.919150618900000E-09;
@@ -5732,8 +5528,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[103][101] = +2.304844878580000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][102] = -1.144839341780000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[103][103] = -1.985803369810000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  0] = +7.173840846880000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  1] = +2.060314995570000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][  2] = -2.531728570380000E-08;
@@ -5839,8 +5633,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[104][102] = +1.864541095200000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][103] = -1.260423103690000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[104][104] = +1.055206443900000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  0] = -3.685553643000000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  1] = +5.591502358730000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][  2] = +4.131767523820000E-09;
@@ -5947,8 +5739,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[105][103] = +4.214355439270000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][104] = +3.261951315180000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[105][105] = -2.261330973120000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  0] = -2.594365807750000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  1] = -9.246845991470000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][  2] = -4.318421813040000E-08;
@@ -6056,8 +5846,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[106][104] = -3.657286104380000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][105] = -1.196199683080000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[106][106] = +5.381456815350000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  0] = -3.347157343290000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  1] = +1.711771445720000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][  2] = +1.014663357590000E-09;
@@ -6166,8 +5954,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[107][105] = +1.240711531940000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][106] = +8.156381575320001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[107][107] = +5.622969815270000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  0] = -1.420503680410000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  1] = -5.881803785130000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][  2] = -2.375768348810000E-08;
@@ -6277,8 +6063,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[108][106] = +5.951264990700000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][107] = -2.878677368900000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[108][108] = -1.080484892470000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  0] = +6.874984355100000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  1] = +1.438448246690000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][  2] = -1.678102885520000E-08;
@@ -6389,8 +6173,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[109][107] = -6.080220783730000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][108] = +1.928769323240000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[109][109] = -1.907309441180000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  0] = -1.777057125950000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  1] = -5.801768370970000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][  2] = +5.017387358330000E-09;
@@ -6502,8 +6284,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[110][108] = -5.136368921260000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][109] = +5.135108254840000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[110][110] = +2.729757226310000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[111] =
-      JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  0] = +2.177604923230000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  1] = -1.012135643820000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][  2] = -2.587542201520000E-08;
@@ -6616,8 +6396,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[111][109] = +1.847165247710000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][110] = -1.662967924960000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[111][111] = -3.012335968350000E-11;
-   SphericalHarmonicsGravitySource_ptr->Cnm[112] =
-      JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  0] = -9.185915814789999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  1] = +1.161630578810000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][  2] = -1.389250948690000E-08;
@@ -6731,8 +6509,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[112][110] = +3.268863429930000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][111] = +9.149202178989999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[112][112] = +8.406959027639999E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[113] =
-      JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  0] = -1.042728724500000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  1] = -6.762003575510000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][  2] = -8.741465823870000E-09;
@@ -6847,8 +6623,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[113][111] = -7.554187630210000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][112] = -6.115842619040000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[113][113] = -3.276269692360000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[114] =
-      JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  0] = -1.519605713900000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  1] = +6.434894635180000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][  2] = -1.174406421730000E-08;
@@ -6964,8 +6738,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[114][112] = -2.882261673490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][113] = +1.088936454560000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[114][114] = +4.175135723520000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[115] =
-      JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  0] = -6.764960493550000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  1] = -2.483033781470000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][  2] = -1.216472932540000E-08;
@@ -7082,8 +6854,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[115][113] = +5.764299059580000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][114] = -6.048557464460000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[115][115] = -3.725169350820000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[116] =
-      JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  0] = -1.825214309380000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  1] = +1.045716450360000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][  2] = -1.378451200480000E-08;
@@ -7201,8 +6971,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[116][114] = +1.635992259770000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][115] = -4.167930955860000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[116][116] = +2.932861793750000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[117] =
-      JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  0] = -1.742967968650000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  1] = -1.861231484420000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][  2] = -7.191618943350000E-09;
@@ -7321,8 +7089,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[117][115] = -2.478285316750000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][116] = -7.082710210690000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[117][117] = -8.247689882270000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[118] =
-      JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  0] = +3.690452452460000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  1] = -9.052694187680000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][  2] = -1.536066978680000E-08;
@@ -7442,8 +7208,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[118][116] = +1.635121006270000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][117] = +2.823708715440000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[118][118] = -1.425438455850000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[119] =
-      JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  0] = -9.755770291530001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  1] = +4.019295942590000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][  2] = +7.141817476680000E-10;
@@ -7564,8 +7328,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[119][117] = +1.334805400750000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][118] = +9.032649951010000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[119][119] = -4.120884855480000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[120] =
-      JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  0] = +2.474155830730000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  1] = -6.040995557200000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][  2] = -1.617918560600000E-08;
@@ -7687,8 +7449,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[120][118] = -6.651642800090000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][119] = -8.836993686330000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[120][120] = +1.239125846780000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[121] =
-      JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  0] = -2.110626369640000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  1] = +6.619139005360000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][  2] = -1.874419121740000E-09;
@@ -7811,8 +7571,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[121][119] = -1.466394813440000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][120] = +9.597357426700000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[121][121] = -1.414146068100000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[122] =
-      JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  0] = +1.619762999920000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  1] = -1.776343405040000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][  2] = -1.372709625340000E-09;
@@ -7936,8 +7694,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[122][120] = +5.252885266320000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][121] = -4.856284983300000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[122][122] = +1.418174444420000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[123] =
-      JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  0] = -8.066035514260000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  1] = +1.303908279280000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][  2] = -1.321511813280000E-08;
@@ -8062,8 +7818,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[123][121] = -1.389012806550000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][122] = -1.529067361950000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[123][123] = -3.283725673170000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[124] =
-      JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  0] = -2.674244505200000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  1] = +2.015169396800000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][  2] = -4.972414219730000E-10;
@@ -8189,8 +7943,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[124][122] = +3.103140974980000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][123] = +1.718854869370000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[124][124] = -1.789707444890000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[125] =
-      JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  0] = -3.490088221580000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  1] = -3.817044676550000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][  2] = -6.551698255010000E-09;
@@ -8317,8 +8069,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[125][123] = -1.029696443630000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][124] = +2.609746225710000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[125][125] = -1.457945018180000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[126] =
-      JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  0] = -1.058610339130000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  1] = -4.000726850460000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][  2] = +1.041775112440000E-09;
@@ -8446,8 +8196,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[126][124] = -1.911478224540000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][125] = -1.004475819490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[126][126] = -1.841980494090000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[127] =
-      JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  0] = -6.757445282110000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  1] = -4.197074319070000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][  2] = -1.957841368070000E-09;
@@ -8576,8 +8324,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[127][125] = -1.306195331600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][126] = -1.398741455970000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[127][127] = +4.983430965030000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[128] =
-      JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  0] = +9.627477569000000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  1] = -3.948738694050000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][  2] = +3.657724916520000E-09;
@@ -8707,8 +8453,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[128][126] = -6.990631241810000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][127] = +3.372115191750000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[128][128] = -4.864768464550000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[129] =
-      JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  0] = -8.234379364390000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  1] = -1.387086048110000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][  2] = -1.033831409760000E-08;
@@ -8839,8 +8583,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[129][127] = +2.507979086190000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][128] = -2.467361709860000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[129][129] = +9.078530649770001E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[130] =
-      JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  0] = -6.589066744570000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  1] = -7.736311956520000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][  2] = +5.580025973840000E-09;
@@ -8972,8 +8714,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[130][128] = -2.820923577450000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][129] = -2.507317981630000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[130][130] = +1.180355387230000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[131] =
-      JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  0] = -2.282018688880000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  1] = -8.408429748389999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][  2] = -2.600149739120000E-09;
@@ -9106,8 +8846,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[131][129] = +5.937011559260000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][130] = +2.309406622340000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[131][131] = +4.105723730010000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[132] =
-      JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  0] = +2.130467357290000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  1] = +7.119638396690000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][  2] = -1.931054602630000E-09;
@@ -9241,8 +8979,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[132][130] = -2.653815054840000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][131] = -6.261057352270000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[132][132] = -8.153545355970000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[133] =
-      JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  0] = -4.586197756520000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  1] = -1.244122932110000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][  2] = +3.175100272530000E-09;
@@ -9377,8 +9113,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[133][131] = +3.149074258760000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][132] = +2.385262042910000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[133][133] = -5.068982038060000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[134] =
-      JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  0] = +8.083551752720000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  1] = -1.260120874670000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][  2] = +1.023458519510000E-08;
@@ -9514,8 +9248,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[134][132] = -8.189853322240000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][133] = -1.968389128730000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[134][134] = -1.000820465880000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[135] =
-      JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  0] = -5.666329740570000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  1] = -1.085717858070000E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][  2] = -3.036284333470000E-10;
@@ -9652,8 +9384,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[135][133] = +2.057379061780000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][134] = +2.347954105570000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[135][135] = -1.242132707890000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[136] =
-      JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  0] = +8.641508809660000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  1] = +2.933463385740000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][  2] = +1.128418026980000E-08;
@@ -9791,8 +9521,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[136][134] = -1.937724272100000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][135] = -3.078648388630000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[136][136] = +4.743728062940000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[137] =
-      JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  0] = +7.985058687490001E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  1] = -5.446652673780000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][  2] = -3.453496901190000E-09;
@@ -9931,8 +9659,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[137][135] = -1.651688676510000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][136] = -3.530559974260000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[137][137] = -5.150983410950000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[138] =
-      JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  0] = +1.135788302780000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  1] = -3.433247747870000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][  2] = +1.456037080290000E-08;
@@ -10072,8 +9798,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[138][136] = +1.554413767450000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][137] = +6.625433949480000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[138][138] = +3.214964875920000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[139] =
-      JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  0] = -1.986562989910000E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  1] = -1.234653982610000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][  2] = +1.381356977470000E-10;
@@ -10214,8 +9938,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[139][137] = -8.419538951099999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][138] = -3.419972593620000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[139][139] = +1.613247006300000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[140] =
-      JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  0] = +1.562845629660000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  1] = -5.622411002560000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][  2] = +1.367719390590000E-08;
@@ -10357,8 +10079,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[140][138] = -8.476410186800000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][139] = -3.159763391490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[140][140] = -2.276827374920000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[141] =
-      JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  0] = +8.083954200030000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  1] = -6.803494771670000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][  2] = -4.829159431810000E-09;
@@ -10501,8 +10221,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[141][139] = +7.897761365270000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][140] = +5.311762184010000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[141][141] = +7.739017604830000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[142] =
-      JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  0] = +1.476519622760000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  1] = +1.092486616790000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][  2] = +1.320497419430000E-08;
@@ -10646,8 +10364,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[142][140] = +3.553941025790000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][141] = -7.444389715870000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[142][142] = +1.201230558980000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[143] =
-      JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  0] = +7.359007311550000E-11;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  1] = -5.613946964690000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][  2] = +1.678950813200000E-09;
@@ -10792,8 +10508,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[143][141] = +6.953502401320000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][142] = +7.450718121459999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[143][143] = +2.453758204980000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[144] =
-      JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  0] = +1.071407175870000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  1] = +3.950402709070000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][  2] = +1.946146672230000E-08;
@@ -10939,8 +10653,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[144][142] = -3.023537268730000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][143] = -7.656600653670000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[144][144] = -8.559145794110000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[145] =
-      JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  0] = +1.148577617290000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  1] = -8.380370212929999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][  2] = -1.716938803340000E-09;
@@ -11087,8 +10799,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[145][143] = +1.394171639670000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][144] = +6.834508951490000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[145][145] = +1.069432461200000E-07;
-   SphericalHarmonicsGravitySource_ptr->Cnm[146] =
-      JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  0] = +1.716139677550000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  1] = +1.947440860810000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][  2] = +1.546063123660000E-08;
@@ -11236,8 +10946,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[146][144] = +6.988130288430000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][145] = -8.975791125639999E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[146][146] = -6.687060017370000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[147] =
-      JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  0] = -2.894877228830000E-10;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  1] = -1.724382103830000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][  2] = +2.312635349700000E-09;
@@ -11386,8 +11094,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[147][145] = -4.658657267200000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][146] = +8.360664485480000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[147][147] = +3.007403550780000E-08;
-   SphericalHarmonicsGravitySource_ptr->Cnm[148] =
-      JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  0] = +1.745319412110000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  1] = -1.300182013710000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][  2] = +1.993424671820000E-08;
@@ -11537,8 +11243,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[148][146] = +7.802897873980000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][147] = -5.757216085780000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[148][148] = -7.087901788430000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[149] =
-      JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  0] = +7.895164615569999E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  1] = -1.584655975600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][  2] = +1.098055189850000E-08;
@@ -11689,8 +11393,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[149][147] = -8.579115559100000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][148] = +2.962295435600000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[149][149] = +7.786533103340000E-09;
-   SphericalHarmonicsGravitySource_ptr->Cnm[150] =
-      JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  0] = +1.841655815470000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  1] = +4.020508321150000E-09;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][  2] = +2.092819955010000E-08;
@@ -11843,34 +11545,24 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Cnm[150][149] = +1.886087921740000E-08;
    SphericalHarmonicsGravitySource_ptr->Cnm[150][150] = -9.823293349360000E-09;
 
-   SphericalHarmonicsGravitySource_ptr->Snm[  2] =
-      JEOD_ALLOC_PRIM_ARRAY (3, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  1] = -1.424538946100000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  2][  2] = +1.440635035400000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[  3] =
-      JEOD_ALLOC_PRIM_ARRAY (4, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  1] = +5.463078608820000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  2] = +4.889139117950000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  3][  3] = -1.782462707200000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  4] =
-      JEOD_ALLOC_PRIM_ARRAY (5, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  1] = +1.659556447270000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  2] = -6.785627355580000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  3] = -1.343325717370000E-05;
    SphericalHarmonicsGravitySource_ptr->Snm[  4][  4] = +3.935256944400000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  5] =
-      JEOD_ALLOC_PRIM_ARRAY (6, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  1] = -4.115857266810000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  2] = +1.095025265510000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  3] = +8.701521465910000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  4] = +3.077937122970000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  5][  5] = -2.753862006690000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  6] =
-      JEOD_ALLOC_PRIM_ARRAY (7, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  1] = -2.572372769060000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  2] = -2.179508196430000E-06;
@@ -11878,8 +11570,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  4] = -4.057616020010000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  5] = -1.028337447110000E-05;
    SphericalHarmonicsGravitySource_ptr->Snm[  6][  6] = +7.226625563380000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  7] =
-      JEOD_ALLOC_PRIM_ARRAY (8, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  1] = -1.315395632880000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  2] = +2.378643836910000E-06;
@@ -11888,8 +11578,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  5] = +1.089133556750000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  6] = +1.031729865290000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  7][  7] = -1.603119725980000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  8] =
-      JEOD_ALLOC_PRIM_ARRAY (9, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  1] = +1.117571578840000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  2] = +1.942966031460000E-06;
@@ -11899,8 +11587,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  6] = -2.176605846410000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  7] = +3.320540752430000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  8][  8] = +2.127167921610000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[  9] =
-      JEOD_ALLOC_PRIM_ARRAY (10, double);
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  1] = +9.172757465110000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  2] = -1.468536497470000E-06;
@@ -11911,8 +11597,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  7] = +9.962825478340000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  8] = -2.243879688690000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[  9][  9] = +2.466169496370000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 10] =
-      JEOD_ALLOC_PRIM_ARRAY (11, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  1] = -9.891342594320000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  2] = -2.766901181620000E-07;
@@ -11924,8 +11608,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  8] = +2.688350199180000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][  9] = -9.009582178050000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 10][ 10] = -1.697121781910000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 11] =
-      JEOD_ALLOC_PRIM_ARRAY (12, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  1] = +6.255226563510000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  2] = -1.938334114090000E-06;
@@ -11938,8 +11620,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][  9] = +4.204885644500000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 10] = -2.419464006850000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 11][ 11] = -1.762677704920000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 12] =
-      JEOD_ALLOC_PRIM_ARRAY (13, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  1] = +1.593705580140000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][  2] = +1.468961910240000E-06;
@@ -11953,8 +11633,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 10] = -1.418278014350000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 11] = -2.322870607740000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 12][ 12] = +1.260281057230000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 13] =
-      JEOD_ALLOC_PRIM_ARRAY (14, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  1] = -1.213942026570000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][  2] = +5.419133991710000E-07;
@@ -11969,8 +11647,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 11] = +5.593959591850000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 12] = -1.628732850190000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 13][ 13] = -2.695353690560000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 14] =
-      JEOD_ALLOC_PRIM_ARRAY (15, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  1] = -5.996423116080000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][  2] = +3.926407861080000E-07;
@@ -11986,8 +11662,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 12] = -6.889091792179999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 13] = -9.358902577210000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 14][ 14] = +1.135134065240000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 15] =
-      JEOD_ALLOC_PRIM_ARRAY (16, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  1] = +3.254200793570000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][  2] = +7.036562592280000E-07;
@@ -12004,8 +11678,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 13] = +5.788934108900000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 14] = +5.277676720670000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 15][ 15] = +6.577449309860000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 16] =
-      JEOD_ALLOC_PRIM_ARRAY (17, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  1] = +8.990731159870000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][  2] = +9.476066637620000E-08;
@@ -12023,8 +11695,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 14] = -3.014074242930000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 15] = -1.020144807430000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 16][ 16] = -7.462358082300000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 17] =
-      JEOD_ALLOC_PRIM_ARRAY (18, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  1] = +1.148890905810000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][  2] = -1.094291331970000E-06;
@@ -12043,8 +11713,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 15] = +2.130349367470000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 16] = -2.546843835860000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 17][ 17] = +1.304032527690000E-06;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 18] =
-      JEOD_ALLOC_PRIM_ARRAY (19, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  1] = -7.036626940240000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][  2] = -7.351719098120000E-07;
@@ -12064,8 +11732,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 16] = -1.107581830910000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 17] = -4.037107512730000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 18][ 18] = -9.777158292279999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 19] =
-      JEOD_ALLOC_PRIM_ARRAY (20, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  1] = +2.107503242090000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][  2] = -3.635800511500000E-07;
@@ -12086,8 +11752,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 17] = -9.489942370640000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 18] = -1.838220761960000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 19][ 19] = +2.225084325370000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 20] =
-      JEOD_ALLOC_PRIM_ARRAY (21, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  1] = -5.133192513590000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][  2] = -1.714125469790000E-07;
@@ -12109,8 +11773,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 18] = -7.999705959859999E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 19] = +5.446534750510000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 20][ 20] = -2.733330835330000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 21] =
-      JEOD_ALLOC_PRIM_ARRAY (22, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  1] = +4.767033120800000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][  2] = -1.162929762470000E-07;
@@ -12133,8 +11795,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 19] = +6.297215048300000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 20] = +2.300887128950000E-06;
    SphericalHarmonicsGravitySource_ptr->Snm[ 21][ 21] = +2.779353234420000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 22] =
-      JEOD_ALLOC_PRIM_ARRAY (23, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  1] = +3.584462298700000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][  2] = -8.721310613639999E-08;
@@ -12158,8 +11818,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 20] = -6.838245953200000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 21] = +2.272397119020000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 22][ 22] = +6.917290816270000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 23] =
-      JEOD_ALLOC_PRIM_ARRAY (24, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  1] = -9.083097308370000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][  2] = -5.031107182220000E-08;
@@ -12184,8 +11842,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 21] = +2.541672502670000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 22] = -4.686125387450000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 23][ 23] = +1.954421503800000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 24] =
-      JEOD_ALLOC_PRIM_ARRAY (25, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  1] = -1.400240501370000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][  2] = +5.147102917480000E-07;
@@ -12211,8 +11867,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 22] = +8.359140103140000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 23] = -5.731948675670000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 24][ 24] = -8.666064561200000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 25] =
-      JEOD_ALLOC_PRIM_ARRAY (26, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  1] = +5.588377456550000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][  2] = -2.268377549260000E-07;
@@ -12239,8 +11893,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 23] = -3.878022537960000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 24] = +3.355388060170000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 25][ 25] = +4.745133142570000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 26] =
-      JEOD_ALLOC_PRIM_ARRAY (27, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  1] = +1.402375363710000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][  2] = -1.286635817910000E-07;
@@ -12268,8 +11920,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 24] = -1.297988891870000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 25] = -4.454347499750000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 26][ 26] = +5.423007099360000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 27] =
-      JEOD_ALLOC_PRIM_ARRAY (28, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  1] = +1.086540478950000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][  2] = -4.986812540860000E-07;
@@ -12298,8 +11948,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 25] = +8.054467296640000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 26] = -3.887160221740000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 27][ 27] = -2.995476694170000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 28] =
-      JEOD_ALLOC_PRIM_ARRAY (29, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  1] = +6.391846821510000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][  2] = +5.917938831550000E-07;
@@ -12329,8 +11977,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 26] = +6.742308835370000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 27] = +5.164854531300000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 28][ 28] = -2.287529487290000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 29] =
-      JEOD_ALLOC_PRIM_ARRAY (30, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  1] = -4.447963875150000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][  2] = -4.659017228610000E-07;
@@ -12361,8 +12007,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 27] = +3.314544827060000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 28] = +2.014968596180000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 29][ 29] = -1.080343597570000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 30] =
-      JEOD_ALLOC_PRIM_ARRAY (31, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  1] = +6.291233958900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][  2] = -3.210144667380000E-07;
@@ -12394,8 +12038,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 28] = -6.257130371240000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 29] = +5.215808273550000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 30][ 30] = +9.315489638600000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 31] =
-      JEOD_ALLOC_PRIM_ARRAY (32, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  1] = -4.722112474660000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][  2] = +1.961756411030000E-07;
@@ -12428,8 +12070,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 29] = +1.737613290940000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 30] = -6.712151513370001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 31][ 31] = -1.950170083980000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 32] =
-      JEOD_ALLOC_PRIM_ARRAY (33, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  1] = +2.946687306470000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][  2] = +1.498223884210000E-07;
@@ -12463,8 +12103,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 30] = -3.350918630590000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 31] = -1.257625814990000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 32][ 32] = -2.261521264510000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 33] =
-      JEOD_ALLOC_PRIM_ARRAY (34, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  1] = -5.447890159840000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][  2] = -4.619316857450000E-07;
@@ -12499,8 +12137,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 31] = +3.012661084860000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 32] = +3.836594294640000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 33][ 33] = +6.411747573740000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 34] =
-      JEOD_ALLOC_PRIM_ARRAY (35, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  1] = -2.255139245660000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][  2] = +4.171292197320000E-08;
@@ -12536,8 +12172,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 32] = -6.990237509150000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 33] = +2.912241438330000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 34][ 34] = -3.957327102410000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 35] =
-      JEOD_ALLOC_PRIM_ARRAY (36, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  1] = +5.365077841440000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][  2] = +7.532718235830000E-08;
@@ -12574,8 +12208,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 33] = +5.014488867900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 34] = +3.599894465700000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 35][ 35] = +2.023722083630000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 36] =
-      JEOD_ALLOC_PRIM_ARRAY (37, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  1] = +3.691923783420000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][  2] = -2.303182597630000E-07;
@@ -12613,8 +12245,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 34] = -7.324450963820000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 35] = +2.791065398600000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 36][ 36] = +2.467331203570000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 37] =
-      JEOD_ALLOC_PRIM_ARRAY (38, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  1] = +7.227333062360000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][  2] = -2.349700512920000E-07;
@@ -12653,8 +12283,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 35] = +4.178342143060000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 36] = -3.781604497710000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 37][ 37] = -1.329500385840000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 38] =
-      JEOD_ALLOC_PRIM_ARRAY (39, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  1] = +1.631632255250000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][  2] = +6.142318702379999E-08;
@@ -12694,8 +12322,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 36] = +7.056724987700000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 37] = -1.137570168540000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 38][ 38] = -2.398009763560000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 39] =
-      JEOD_ALLOC_PRIM_ARRAY (40, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  1] = -1.183640839990000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][  2] = -3.405426745510000E-08;
@@ -12736,8 +12362,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 37] = -1.996910657830000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 38] = +3.057148855870000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 39][ 39] = -8.455097035340000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 40] =
-      JEOD_ALLOC_PRIM_ARRAY (41, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  1] = +1.073526893390000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][  2] = +2.053834265720000E-07;
@@ -12779,8 +12403,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 38] = +1.503992381590000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 39] = +6.829423696500001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 40][ 40] = -4.340556973660000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 41] =
-      JEOD_ALLOC_PRIM_ARRAY (42, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  1] = -3.386585488660000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][  2] = -1.678763412300000E-07;
@@ -12823,8 +12445,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 39] = -1.209858457630000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 40] = -1.982850990990000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 41][ 41] = +3.990900284840000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 42] =
-      JEOD_ALLOC_PRIM_ARRAY (43, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  1] = -9.001606535660000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][  2] = -1.912473481310000E-07;
@@ -12868,8 +12488,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 40] = +3.518300610500000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 41] = -2.110441613510000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 42][ 42] = -2.666347026420000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 43] =
-      JEOD_ALLOC_PRIM_ARRAY (44, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  1] = -1.101396368960000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][  2] = -3.871229674560000E-07;
@@ -12914,8 +12532,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 41] = +7.452127170020000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 42] = +2.009091627770000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 43][ 43] = -3.755737496770000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 44] =
-      JEOD_ALLOC_PRIM_ARRAY (45, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  1] = -1.324142864190000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][  2] = +9.906001260010001E-08;
@@ -12961,8 +12577,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 42] = -5.946623410360000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 43] = -2.458961007440000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 44][ 44] = -5.531752666000000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 45] =
-      JEOD_ALLOC_PRIM_ARRAY (46, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  1] = +2.424831303620000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][  2] = +1.414065477720000E-07;
@@ -13009,8 +12623,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 43] = -2.824884014300000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 44] = +1.088489421140000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 45][ 45] = +5.961766359880000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 46] =
-      JEOD_ALLOC_PRIM_ARRAY (47, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  1] = -9.115135371900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][  2] = -3.550685660070000E-08;
@@ -13058,8 +12670,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 44] = -1.197457975440000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 45] = -1.805307961850000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 46][ 46] = -1.279961756700000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 47] =
-      JEOD_ALLOC_PRIM_ARRAY (48, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  1] = +5.716156503630000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][  2] = -1.165732358310000E-08;
@@ -13108,8 +12718,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 45] = +1.627244569660000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 46] = +1.290180067320000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 47][ 47] = +1.729720888350000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 48] =
-      JEOD_ALLOC_PRIM_ARRAY (49, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  1] = -9.112501675010000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][  2] = +5.386694068680000E-08;
@@ -13159,8 +12767,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 46] = -2.034335269440000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 47] = +2.693228038480000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 48][ 48] = -1.229895678800000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 49] =
-      JEOD_ALLOC_PRIM_ARRAY (50, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  1] = +1.631206549100000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][  2] = -1.045782694220000E-07;
@@ -13211,8 +12817,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 47] = +1.204673559310000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 48] = -9.266258533170000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 49][ 49] = +1.407036564110000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 50] =
-      JEOD_ALLOC_PRIM_ARRAY (51, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  1] = -9.501316716860000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][  2] = +7.404076790130000E-08;
@@ -13264,8 +12868,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 48] = -2.516277217150000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 49] = +1.260367980740000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 50][ 50] = -1.092428774380000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 51] =
-      JEOD_ALLOC_PRIM_ARRAY (52, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  1] = -9.669212708920000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][  2] = -2.231288208850000E-07;
@@ -13318,8 +12920,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 49] = +1.288643533800000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 50] = -1.247217728300000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 51][ 51] = +2.275521039310000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 52] =
-      JEOD_ALLOC_PRIM_ARRAY (53, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  1] = -6.332343910960000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][  2] = +2.297176590300000E-07;
@@ -13373,8 +12973,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 50] = +9.097682630969999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 51] = +1.163409883360000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 52][ 52] = -5.906074872380000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 53] =
-      JEOD_ALLOC_PRIM_ARRAY (54, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  1] = +8.217805716180000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][  2] = -1.754216918530000E-07;
@@ -13429,8 +13027,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 51] = -8.185138620970001E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 52] = -1.203157729580000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 53][ 53] = +4.953245253970000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 54] =
-      JEOD_ALLOC_PRIM_ARRAY (55, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  1] = -1.053799851520000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][  2] = -4.532805605900000E-09;
@@ -13486,8 +13082,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 52] = +5.526051704850000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 53] = -2.027190021360000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 54][ 54] = +1.333156472750000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 55] =
-      JEOD_ALLOC_PRIM_ARRAY (56, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  1] = +1.098517287290000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][  2] = -1.370180013470000E-07;
@@ -13544,8 +13138,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 53] = +9.370562787500001E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 54] = +3.483670818660000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 55][ 55] = -1.229724161960000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 56] =
-      JEOD_ALLOC_PRIM_ARRAY (57, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  1] = -1.143869378240000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][  2] = +4.149051095940000E-08;
@@ -13603,8 +13195,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 54] = +1.024093038560000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 55] = +9.419121303939999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 56][ 56] = -6.435682777080000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 57] =
-      JEOD_ALLOC_PRIM_ARRAY (58, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  1] = +2.238104611580000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][  2] = +1.085240754110000E-07;
@@ -13663,8 +13253,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 55] = -3.615342954500000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 56] = +1.668279418940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 57][ 57] = +2.404564249450000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 58] =
-      JEOD_ALLOC_PRIM_ARRAY (59, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  1] = -1.153937758390000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][  2] = -1.180925408350000E-07;
@@ -13724,8 +13312,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 56] = -4.728717289400000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 57] = -1.340412185910000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 58][ 58] = -2.965183655140000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 59] =
-      JEOD_ALLOC_PRIM_ARRAY (60, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  1] = +1.957001214110000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][  2] = +1.074311955830000E-07;
@@ -13786,8 +13372,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 57] = -3.614887257440000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 58] = -5.544703221930000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 59][ 59] = +6.728197771449999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 60] =
-      JEOD_ALLOC_PRIM_ARRAY (61, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  1] = -7.049521999360000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][  2] = -1.363702205270000E-07;
@@ -13849,8 +13433,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 58] = +4.032250068190000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 59] = -4.367305787170000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 60][ 60] = -5.299169552260000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 61] =
-      JEOD_ALLOC_PRIM_ARRAY (62, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  1] = +2.920204984730000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][  2] = +1.240571026900000E-07;
@@ -13913,8 +13495,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 59] = +2.615599811460000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 60] = -5.942029768830000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 61][ 61] = +4.784693184250000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 62] =
-      JEOD_ALLOC_PRIM_ARRAY (63, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  1] = +6.504553092970000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][  2] = +2.178294640540000E-08;
@@ -13978,8 +13558,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 60] = +3.608273955530000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 61] = +1.360881363970000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 62][ 62] = +8.014376891100000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 63] =
-      JEOD_ALLOC_PRIM_ARRAY (64, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  1] = -2.421796249160000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][  2] = +1.132078884760000E-07;
@@ -14044,8 +13622,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 61] = +2.484183701770000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 62] = -7.376420124229999E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 63][ 63] = -7.627362006550000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 64] =
-      JEOD_ALLOC_PRIM_ARRAY (65, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  1] = +2.799966967880000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][  2] = -3.504091976130000E-08;
@@ -14111,8 +13687,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 62] = +5.708932418800000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 63] = -3.161485325860000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 64][ 64] = +1.080121339940000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 65] =
-      JEOD_ALLOC_PRIM_ARRAY (66, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  1] = -1.097417836070000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][  2] = +1.284948274920000E-07;
@@ -14179,8 +13753,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 63] = +9.321627075890000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 64] = -9.249581560190000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 65][ 65] = -1.176053405030000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 66] =
-      JEOD_ALLOC_PRIM_ARRAY (67, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  1] = +9.215717190420000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][  2] = -4.670891737100000E-08;
@@ -14248,8 +13820,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 64] = +1.080425925420000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 65] = -5.029893779150000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 66][ 66] = +1.178126849670000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 67] =
-      JEOD_ALLOC_PRIM_ARRAY (68, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  1] = -8.643879307490000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][  2] = -3.209591513600000E-08;
@@ -14318,8 +13888,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 65] = -9.748744736880000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 66] = +7.023840090100000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 67][ 67] = -7.322456142900000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 68] =
-      JEOD_ALLOC_PRIM_ARRAY (69, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  1] = +6.357534177970000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][  2] = -2.270814019660000E-08;
@@ -14389,8 +13957,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 66] = +7.233452523800000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 67] = +2.190456266720000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 68][ 68] = +4.105429977320000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 69] =
-      JEOD_ALLOC_PRIM_ARRAY (70, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  1] = -5.969515562600000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][  2] = +5.747739903220000E-08;
@@ -14461,8 +14027,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 67] = +5.080389411970000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 68] = -1.229797400620000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 69][ 69] = +7.779204509680000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 70] =
-      JEOD_ALLOC_PRIM_ARRAY (71, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  1] = +1.308499854240000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][  2] = -6.918175944070000E-08;
@@ -14534,8 +14098,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 68] = +6.863889483290000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 69] = +2.569817678910000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 70][ 70] = -1.023661050100000E-07;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 71] =
-      JEOD_ALLOC_PRIM_ARRAY (72, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  1] = -5.540816680940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][  2] = +7.487602799960000E-08;
@@ -14608,8 +14170,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 69] = -4.788128026110000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 70] = -7.287750520550000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 71][ 71] = +3.318566555390000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 72] =
-      JEOD_ALLOC_PRIM_ARRAY (73, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  1] = +3.955537046060000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][  2] = -5.265861798380000E-08;
@@ -14683,8 +14243,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 70] = -2.141909920600000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 71] = +8.546674852980000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 72][ 72] = +3.083716342700000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 73] =
-      JEOD_ALLOC_PRIM_ARRAY (74, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  1] = -2.538217577670000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][  2] = +8.177972030570000E-08;
@@ -14759,8 +14317,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 71] = +3.423852381940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 72] = -1.656960524960000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 73][ 73] = +1.949549115600000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 74] =
-      JEOD_ALLOC_PRIM_ARRAY (75, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  1] = +2.339486123010000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][  2] = -1.616674388060000E-08;
@@ -14836,8 +14392,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 72] = +1.402107854700000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 73] = +1.356077168290000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 74][ 74] = -2.741831390150000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 75] =
-      JEOD_ALLOC_PRIM_ARRAY (76, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  1] = -6.611796307130000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][  2] = +7.412120864039999E-08;
@@ -14914,8 +14468,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 73] = -2.174717339520000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 74] = -6.230111952960000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 75][ 75] = +1.014584958190000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 76] =
-      JEOD_ALLOC_PRIM_ARRAY (77, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  1] = +3.149947428960000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][  2] = -6.150616260380000E-08;
@@ -14993,8 +14545,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 74] = -2.170799092280000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 75] = +2.339570338030000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 76][ 76] = +9.551598393670000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 77] =
-      JEOD_ALLOC_PRIM_ARRAY (78, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  1] = -5.474659043950000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][  2] = +9.230073458340001E-08;
@@ -15073,8 +14623,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 75] = +9.071383604850000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 76] = +2.857203330800000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 77][ 77] = -5.566797854060000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 78] =
-      JEOD_ALLOC_PRIM_ARRAY (79, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  1] = -8.558038714489999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][  2] = -5.197425837460000E-08;
@@ -15154,8 +14702,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 76] = +5.810694352760000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 77] = -7.328706832350000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 78][ 78] = +2.306657387590000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 79] =
-      JEOD_ALLOC_PRIM_ARRAY (80, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  1] = +2.611383869220000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][  2] = +8.237977957260000E-08;
@@ -15236,8 +14782,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 77] = -1.311106167140000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 78] = -7.322721700380000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 79][ 79] = +2.744064623140000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 80] =
-      JEOD_ALLOC_PRIM_ARRAY (81, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  1] = +6.114603506750000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][  2] = +2.470616226150000E-08;
@@ -15319,8 +14863,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 78] = -7.896897780789999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 79] = +9.979130206409999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 80][ 80] = +6.088130913749999E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 81] =
-      JEOD_ALLOC_PRIM_ARRAY (82, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  1] = -2.301615689220000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][  2] = +2.970364542940000E-08;
@@ -15403,8 +14945,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 79] = -1.955172461090000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 80] = -6.465341371880000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 81][ 81] = +1.547610807600000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 82] =
-      JEOD_ALLOC_PRIM_ARRAY (83, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  1] = -2.216945773350000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][  2] = +1.154935276710000E-08;
@@ -15488,8 +15028,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 80] = +5.778691825750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 81] = +3.403503267290000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 82][ 82] = -1.838146454180000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 83] =
-      JEOD_ALLOC_PRIM_ARRAY (84, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  1] = -2.141313405160000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][  2] = +3.801582442080000E-09;
@@ -15574,8 +15112,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 81] = +5.347089438100000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 82] = -9.641416117270000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 83][ 83] = +2.723682305910000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 84] =
-      JEOD_ALLOC_PRIM_ARRAY (85, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  1] = +4.829164644280000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][  2] = -3.801109626290000E-08;
@@ -15661,8 +15197,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 82] = -2.255921407480000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 83] = -1.782495243750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 84][ 84] = +1.417724597300000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 85] =
-      JEOD_ALLOC_PRIM_ARRAY (86, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  1] = -7.463383487970000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][  2] = -1.189811436110000E-08;
@@ -15749,8 +15283,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 83] = -2.266670116210000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 84] = +1.115380561410000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 85][ 85] = -2.073678732220000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 86] =
-      JEOD_ALLOC_PRIM_ARRAY (87, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  1] = -1.774062688020000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][  2] = -5.115269091060000E-08;
@@ -15838,8 +15370,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 84] = -1.734760630560000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 85] = -3.942956685580000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[ 86][ 86] = +7.012653891270000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 87] =
-      JEOD_ALLOC_PRIM_ARRAY (88, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  1] = -4.919788863160000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][  2] = +3.577230159860000E-08;
@@ -15928,8 +15458,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 85] = -1.751735979180000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 86] = +2.480906337750000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 87][ 87] = -8.837500668900000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 88] =
-      JEOD_ALLOC_PRIM_ARRAY (89, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  1] = -2.583865118940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][  2] = -3.669115424860000E-08;
@@ -16019,8 +15547,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 86] = +1.759514391900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 87] = -7.549290686210000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 88][ 88] = +2.029498933440000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 89] =
-      JEOD_ALLOC_PRIM_ARRAY (90, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  1] = +1.467241513120000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][  2] = -1.536929108250000E-08;
@@ -16111,8 +15637,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 87] = -1.094971067220000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 88] = -2.171844560850000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 89][ 89] = -2.124639847690000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 90] =
-      JEOD_ALLOC_PRIM_ARRAY (91, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  1] = -2.928772227520000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][  2] = -1.026339497380000E-08;
@@ -16204,8 +15728,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 88] = +9.305550238430000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 89] = +1.231656281830000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 90][ 90] = -2.128989575110000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 91] =
-      JEOD_ALLOC_PRIM_ARRAY (92, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  1] = -9.677791647640000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][  2] = +1.463917482680000E-08;
@@ -16298,8 +15820,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 89] = +1.136875547100000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 90] = -5.170215315420000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 91][ 91] = -3.643456317390000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 92] =
-      JEOD_ALLOC_PRIM_ARRAY (93, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  1] = -2.942813135500000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][  2] = -6.491237439640000E-09;
@@ -16393,8 +15913,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 90] = +2.368667444300000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 91] = -4.234392772720000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 92][ 92] = +3.017757447640000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 93] =
-      JEOD_ALLOC_PRIM_ARRAY (94, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  1] = -2.351866600900000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][  2] = -4.269338213160000E-09;
@@ -16489,8 +16007,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 91] = -2.593416933750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 92] = -1.854493040540000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 93][ 93] = +1.153374387400000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 94] =
-      JEOD_ALLOC_PRIM_ARRAY (95, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  1] = -1.783436472980000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][  2] = -1.413816135430000E-08;
@@ -16586,8 +16102,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 92] = -2.517151945380000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 93] = -2.491690156180000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 94][ 94] = -1.289019408030000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 95] =
-      JEOD_ALLOC_PRIM_ARRAY (96, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  1] = -2.822632277530000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][  2] = +8.454471248690000E-09;
@@ -16684,8 +16198,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 93] = +4.637990446750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 94] = +1.670044822190000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 95][ 95] = +3.129565613550000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 96] =
-      JEOD_ALLOC_PRIM_ARRAY (97, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  1] = -1.959407873060000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][  2] = -1.916010275310000E-09;
@@ -16783,8 +16295,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 94] = +1.915571315120000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 95] = -1.359177191770000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 96][ 96] = -3.588260290340000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 97] =
-      JEOD_ALLOC_PRIM_ARRAY (98, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  1] = -1.474506586990000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][  2] = +9.361586515350001E-09;
@@ -16883,8 +16393,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 95] = +1.203953392750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 96] = +3.453156186650000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 97][ 97] = +5.096212015790000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 98] =
-      JEOD_ALLOC_PRIM_ARRAY (99, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  1] = -1.018329027970000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][  2] = -3.068561714000000E-08;
@@ -16984,8 +16492,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 96] = -1.011392608090000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 97] = +7.470754609610000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 98][ 98] = -1.768059800380000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[ 99] =
-      JEOD_ALLOC_PRIM_ARRAY (100, double);
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  1] = +1.147528350880000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][  2] = +7.468735775410001E-09;
@@ -17086,8 +16592,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 97] = +1.289859985390000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 98] = -1.055489264230000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[ 99][ 99] = +3.872817726710000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[100] =
-      JEOD_ALLOC_PRIM_ARRAY (101, double);
    SphericalHarmonicsGravitySource_ptr->Snm[100][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  1] = -2.709663698770000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[100][  2] = -2.826524684960000E-09;
@@ -17189,8 +16693,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 98] = -9.354887233150000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[100][ 99] = -1.888387288630000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[100][100] = +1.507846813410000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[101] =
-      JEOD_ALLOC_PRIM_ARRAY (102, double);
    SphericalHarmonicsGravitySource_ptr->Snm[101][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  1] = -1.346779873520000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][  2] = +3.810179713170000E-09;
@@ -17293,8 +16795,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[101][ 99] = -2.044499130380000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[101][100] = +3.088203120580000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[101][101] = -2.090906094180000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[102] =
-      JEOD_ALLOC_PRIM_ARRAY (103, double);
    SphericalHarmonicsGravitySource_ptr->Snm[102][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  1] = -8.244401719110000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][  2] = -1.432062818430000E-08;
@@ -17398,8 +16898,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[102][100] = +2.737932627840000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[102][101] = +1.087656006030000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[102][102] = -1.917393769540000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[103] =
-      JEOD_ALLOC_PRIM_ARRAY (104, double);
    SphericalHarmonicsGravitySource_ptr->Snm[103][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  1] = +8.274227580340000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[103][  2] = -9.634359831459999E-10;
@@ -17504,8 +17002,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[103][101] = +6.793367005270000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[103][102] = -1.623751870810000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[103][103] = +1.338946526190000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[104] =
-      JEOD_ALLOC_PRIM_ARRAY (105, double);
    SphericalHarmonicsGravitySource_ptr->Snm[104][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  1] = -2.391404462500000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[104][  2] = -5.815371615900000E-09;
@@ -17611,8 +17107,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[104][102] = -3.323276860260000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[104][103] = +2.272203573530000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[104][104] = +2.880873932100000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[105] =
-      JEOD_ALLOC_PRIM_ARRAY (106, double);
    SphericalHarmonicsGravitySource_ptr->Snm[105][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  1] = +8.715842477380000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[105][  2] = -4.411029313360000E-10;
@@ -17719,8 +17213,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[105][103] = -1.776180640160000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[105][104] = -1.646668429480000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[105][105] = -2.350167350530000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[106] =
-      JEOD_ALLOC_PRIM_ARRAY (107, double);
    SphericalHarmonicsGravitySource_ptr->Snm[106][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  1] = -1.051551623850000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[106][  2] = -4.176994876930000E-10;
@@ -17828,8 +17320,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[106][104] = -1.746064483480000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[106][105] = -1.376807835370000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[106][106] = -2.741711420280000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[107] =
-      JEOD_ALLOC_PRIM_ARRAY (108, double);
    SphericalHarmonicsGravitySource_ptr->Snm[107][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  1] = +1.003902821400000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[107][  2] = -5.079171410700000E-09;
@@ -17938,8 +17428,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[107][105] = +2.488550352430000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[107][106] = -3.165247033430000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[107][107] = +9.099220930410000E-10;
-   SphericalHarmonicsGravitySource_ptr->Snm[108] =
-      JEOD_ALLOC_PRIM_ARRAY (109, double);
    SphericalHarmonicsGravitySource_ptr->Snm[108][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  1] = -6.590795417090000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[108][  2] = -2.225806410850000E-08;
@@ -18049,8 +17537,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[108][106] = -1.346419057850000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[108][107] = +1.485285478580000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[108][108] = +2.604530303780000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[109] =
-      JEOD_ALLOC_PRIM_ARRAY (110, double);
    SphericalHarmonicsGravitySource_ptr->Snm[109][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  1] = +1.379693347600000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[109][  2] = +1.856993071430000E-08;
@@ -18161,8 +17647,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[109][107] = -1.820024859530000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[109][108] = +1.334178163520000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[109][109] = -2.365887546620000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[110] =
-      JEOD_ALLOC_PRIM_ARRAY (111, double);
    SphericalHarmonicsGravitySource_ptr->Snm[110][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  1] = -1.986698619610000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[110][  2] = -6.586408712710000E-09;
@@ -18274,8 +17758,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[110][108] = +1.345571727250000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[110][109] = -2.248360975110000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[110][110] = -1.224830499800000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[111] =
-      JEOD_ALLOC_PRIM_ARRAY (112, double);
    SphericalHarmonicsGravitySource_ptr->Snm[111][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[111][  1] = +2.528224370320000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[111][  2] = -1.640789715140000E-09;
@@ -18388,8 +17870,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[111][109] = +1.242791989750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[111][110] = -1.180984948610000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[111][111] = +2.720047775940000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[112] =
-      JEOD_ALLOC_PRIM_ARRAY (113, double);
    SphericalHarmonicsGravitySource_ptr->Snm[112][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[112][  1] = -1.727368256780000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[112][  2] = -1.249309352800000E-09;
@@ -18503,8 +17983,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[112][110] = -2.116139824110000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[112][111] = -6.409992510040000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[112][112] = -1.725769108280000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[113] =
-      JEOD_ALLOC_PRIM_ARRAY (114, double);
    SphericalHarmonicsGravitySource_ptr->Snm[113][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[113][  1] = +1.148417677370000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[113][  2] = -1.412455076100000E-08;
@@ -18619,8 +18097,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[113][111] = +4.222263474000000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[113][112] = +6.635934802520000E-11;
    SphericalHarmonicsGravitySource_ptr->Snm[113][113] = -8.661407215410001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[114] =
-      JEOD_ALLOC_PRIM_ARRAY (115, double);
    SphericalHarmonicsGravitySource_ptr->Snm[114][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[114][  1] = -5.262324500080000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][  2] = -1.897474922360000E-09;
@@ -18736,8 +18212,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[114][112] = +4.708525538400000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][113] = -3.880573977180000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[114][114] = +2.580713139380000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[115] =
-      JEOD_ALLOC_PRIM_ARRAY (116, double);
    SphericalHarmonicsGravitySource_ptr->Snm[115][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[115][  1] = +1.615267378480000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[115][  2] = -1.834980246670000E-10;
@@ -18854,8 +18328,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[115][113] = +1.588498766750000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[115][114] = +9.615312913570000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[115][115] = -1.147586789590000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[116] =
-      JEOD_ALLOC_PRIM_ARRAY (117, double);
    SphericalHarmonicsGravitySource_ptr->Snm[116][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[116][  1] = -1.784467188310000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][  2] = -6.825280924030000E-09;
@@ -18973,8 +18445,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[116][114] = +5.266605561100000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][115] = -1.945578478830000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[116][116] = -3.780264439460000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[117] =
-      JEOD_ALLOC_PRIM_ARRAY (118, double);
    SphericalHarmonicsGravitySource_ptr->Snm[117][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[117][  1] = +1.133161234590000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[117][  2] = -1.394487773690000E-09;
@@ -19093,8 +18563,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[117][115] = -3.481585054340000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[117][116] = +1.054473658520000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[117][117] = +5.914734149190000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[118] =
-      JEOD_ALLOC_PRIM_ARRAY (119, double);
    SphericalHarmonicsGravitySource_ptr->Snm[118][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[118][  1] = -9.779849381520000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[118][  2] = +7.986598041540000E-10;
@@ -19214,8 +18682,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[118][116] = -4.619304311830000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[118][117] = -5.027513207600000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[118][118] = -9.857813709340001E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[119] =
-      JEOD_ALLOC_PRIM_ARRAY (120, double);
    SphericalHarmonicsGravitySource_ptr->Snm[119][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[119][  1] = +8.211808238940000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[119][  2] = +1.872250705390000E-09;
@@ -19336,8 +18802,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[119][117] = +3.134243471810000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[119][118] = -7.358242547170000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[119][119] = -4.239750164700000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[120] =
-      JEOD_ALLOC_PRIM_ARRAY (121, double);
    SphericalHarmonicsGravitySource_ptr->Snm[120][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[120][  1] = +3.865901616680000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[120][  2] = -2.509074168220000E-09;
@@ -19459,8 +18923,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[120][118] = -5.807171911780000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[120][119] = +1.579769176630000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[120][120] = +3.304264236720000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[121] =
-      JEOD_ALLOC_PRIM_ARRAY (122, double);
    SphericalHarmonicsGravitySource_ptr->Snm[121][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[121][  1] = +3.776921151140000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[121][  2] = +5.118202147010000E-10;
@@ -19583,8 +19045,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[121][119] = -3.450122156900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[121][120] = -1.565208324250000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[121][121] = -2.682681887340000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[122] =
-      JEOD_ALLOC_PRIM_ARRAY (123, double);
    SphericalHarmonicsGravitySource_ptr->Snm[122][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[122][  1] = -4.094762917820000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[122][  2] = -1.145833338450000E-08;
@@ -19708,8 +19168,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[122][120] = +1.368826532740000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[122][121] = +9.087458186059999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[122][122] = +1.361352853830000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[123] =
-      JEOD_ALLOC_PRIM_ARRAY (124, double);
    SphericalHarmonicsGravitySource_ptr->Snm[123][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[123][  1] = +6.506454133690000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][  2] = +3.640981677010000E-09;
@@ -19834,8 +19292,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[123][121] = -5.432404519230000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][122] = +3.406811955860000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[123][123] = +2.412635089890000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[124] =
-      JEOD_ALLOC_PRIM_ARRAY (125, double);
    SphericalHarmonicsGravitySource_ptr->Snm[124][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[124][  1] = +3.747123202850000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[124][  2] = +6.710147812210000E-10;
@@ -19961,8 +19417,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[124][122] = -1.644011065730000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[124][123] = -4.023217605940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[124][124] = -2.920182877690000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[125] =
-      JEOD_ALLOC_PRIM_ARRAY (126, double);
    SphericalHarmonicsGravitySource_ptr->Snm[125][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[125][  1] = +5.097010697520000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][  2] = -3.260119339650000E-09;
@@ -20089,8 +19543,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[125][123] = +5.803976134290000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[125][124] = +4.359560163300000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[125][125] = +1.480146233850000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[126] =
-      JEOD_ALLOC_PRIM_ARRAY (127, double);
    SphericalHarmonicsGravitySource_ptr->Snm[126][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[126][  1] = +6.196935108530000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[126][  2] = -1.723863958320000E-09;
@@ -20218,8 +19670,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[126][124] = -9.676815252000000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[126][125] = -4.947280057650000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[126][126] = +1.063778120370000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[127] =
-      JEOD_ALLOC_PRIM_ARRAY (128, double);
    SphericalHarmonicsGravitySource_ptr->Snm[127][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[127][  1] = -4.290205836590000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[127][  2] = +1.988600411100000E-09;
@@ -20348,8 +19798,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[127][125] = +7.691464738890001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[127][126] = +6.304127575550000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[127][127] = +1.278247596700000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[128] =
-      JEOD_ALLOC_PRIM_ARRAY (129, double);
    SphericalHarmonicsGravitySource_ptr->Snm[128][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[128][  1] = +8.205660238850000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[128][  2] = -1.262937094040000E-09;
@@ -20479,8 +19927,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[128][126] = -1.216432036960000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[128][127] = -2.443856688050000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[128][128] = -1.134918665500000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[129] =
-      JEOD_ALLOC_PRIM_ARRAY (130, double);
    SphericalHarmonicsGravitySource_ptr->Snm[129][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[129][  1] = +8.843676540130000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[129][  2] = +2.817396692480000E-09;
@@ -20611,8 +20057,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[129][127] = +1.110843633470000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[129][128] = +2.195344303560000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[129][129] = -1.395989313800000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[130] =
-      JEOD_ALLOC_PRIM_ARRAY (131, double);
    SphericalHarmonicsGravitySource_ptr->Snm[130][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[130][  1] = +7.995449775810001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[130][  2] = +4.991723397570000E-09;
@@ -20744,8 +20188,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[130][128] = +2.102600953990000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[130][129] = +9.505615899260000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[130][130] = +2.579018874610000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[131] =
-      JEOD_ALLOC_PRIM_ARRAY (132, double);
    SphericalHarmonicsGravitySource_ptr->Snm[131][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[131][  1] = -5.730319866630000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[131][  2] = -8.047708372940000E-10;
@@ -20878,8 +20320,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[131][129] = -1.032406305290000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[131][130] = +1.659693557350000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[131][131] = -1.078249157000000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[132] =
-      JEOD_ALLOC_PRIM_ARRAY (133, double);
    SphericalHarmonicsGravitySource_ptr->Snm[132][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[132][  1] = +1.103196951010000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[132][  2] = +5.102899327310000E-09;
@@ -21013,8 +20453,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[132][130] = +6.218009796780000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[132][131] = -4.013877673590000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[132][132] = -2.820614163040000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[133] =
-      JEOD_ALLOC_PRIM_ARRAY (134, double);
    SphericalHarmonicsGravitySource_ptr->Snm[133][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[133][  1] = +1.755462574050000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[133][  2] = +4.295607410160000E-09;
@@ -21149,8 +20587,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[133][131] = +7.667170142159999E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[133][132] = +3.710740600270000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[133][133] = +6.042044297840000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[134] =
-      JEOD_ALLOC_PRIM_ARRAY (135, double);
    SphericalHarmonicsGravitySource_ptr->Snm[134][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[134][  1] = +1.132169762120000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[134][  2] = +3.147711786500000E-09;
@@ -21286,8 +20722,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[134][132] = +9.621356144470001E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[134][133] = -1.875269455370000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[134][134] = +1.781578973840000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[135] =
-      JEOD_ALLOC_PRIM_ARRAY (136, double);
    SphericalHarmonicsGravitySource_ptr->Snm[135][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[135][  1] = -2.697178709990000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[135][  2] = -2.560644847330000E-09;
@@ -21424,8 +20858,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[135][133] = -1.927895860370000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[135][134] = +2.845207266620000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[135][135] = -3.648462779140000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[136] =
-      JEOD_ALLOC_PRIM_ARRAY (137, double);
    SphericalHarmonicsGravitySource_ptr->Snm[136][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[136][  1] = +8.089948445050000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[136][  2] = +9.172236029859999E-09;
@@ -21563,8 +20995,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[136][134] = +3.229081788130000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[136][135] = -1.122415981150000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[136][136] = +2.034161372320000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[137] =
-      JEOD_ALLOC_PRIM_ARRAY (138, double);
    SphericalHarmonicsGravitySource_ptr->Snm[137][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[137][  1] = -4.754932002320000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[137][  2] = -4.427378775040000E-09;
@@ -21703,8 +21133,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[137][135] = +1.000819817780000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[137][136] = -3.053181607520000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[137][137] = +4.110429315740000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[138] =
-      JEOD_ALLOC_PRIM_ARRAY (139, double);
    SphericalHarmonicsGravitySource_ptr->Snm[138][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[138][  1] = +1.652430032730000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[138][  2] = +5.323310282780000E-09;
@@ -21844,8 +21272,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[138][136] = -1.020660350900000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[138][137] = +2.866901032350000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[138][138] = -2.836595294530000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[139] =
-      JEOD_ALLOC_PRIM_ARRAY (140, double);
    SphericalHarmonicsGravitySource_ptr->Snm[139][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[139][  1] = -4.718933987490000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[139][  2] = +2.712881410190000E-09;
@@ -21986,8 +21412,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[139][137] = -1.327867405810000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[139][138] = -4.031927311090000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[139][139] = -1.125883184770000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[140] =
-      JEOD_ALLOC_PRIM_ARRAY (141, double);
    SphericalHarmonicsGravitySource_ptr->Snm[140][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[140][  1] = +1.058576409070000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[140][  2] = +8.648462100590001E-09;
@@ -22129,8 +21553,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[140][138] = +4.610364990430000E-10;
    SphericalHarmonicsGravitySource_ptr->Snm[140][139] = +2.073961772720000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[140][140] = +1.901762825360000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[141] =
-      JEOD_ALLOC_PRIM_ARRAY (142, double);
    SphericalHarmonicsGravitySource_ptr->Snm[141][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[141][  1] = -3.240154008470000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[141][  2] = -2.532952716680000E-09;
@@ -22273,8 +21695,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[141][139] = -1.150996463520000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[141][140] = -1.940411884910000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[141][141] = +5.079438965840000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[142] =
-      JEOD_ALLOC_PRIM_ARRAY (143, double);
    SphericalHarmonicsGravitySource_ptr->Snm[142][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[142][  1] = +1.702874763250000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[142][  2] = +1.248764704770000E-08;
@@ -22418,8 +21838,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[142][140] = -1.467350663940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[142][141] = +4.358277659150000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[142][142] = -3.760431252720000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[143] =
-      JEOD_ALLOC_PRIM_ARRAY (144, double);
    SphericalHarmonicsGravitySource_ptr->Snm[143][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[143][  1] = -6.997200840990000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[143][  2] = -1.576359041190000E-09;
@@ -22564,8 +21982,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[143][141] = +1.478228939300000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[143][142] = -3.118166163910000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[143][143] = +3.836786068890000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[144] =
-      JEOD_ALLOC_PRIM_ARRAY (145, double);
    SphericalHarmonicsGravitySource_ptr->Snm[144][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[144][  1] = +1.083053271390000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[144][  2] = +1.142062327310000E-08;
@@ -22711,8 +22127,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[144][142] = -4.856723459620000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[144][143] = +7.333965972220000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[144][144] = +7.552401460870000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[145] =
-      JEOD_ALLOC_PRIM_ARRAY (146, double);
    SphericalHarmonicsGravitySource_ptr->Snm[145][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[145][  1] = -1.099485713940000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[145][  2] = -6.339401466370000E-09;
@@ -22859,8 +22273,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[145][143] = -1.354269417130000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[145][144] = +5.470045912840000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[145][145] = -6.197811469870000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[146] =
-      JEOD_ALLOC_PRIM_ARRAY (147, double);
    SphericalHarmonicsGravitySource_ptr->Snm[146][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[146][  1] = +1.710787935820000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[146][  2] = +1.028413062680000E-08;
@@ -23008,8 +22420,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[146][144] = +1.096524106780000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[146][145] = -1.933592492990000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[146][146] = +8.034130517970000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[147] =
-      JEOD_ALLOC_PRIM_ARRAY (148, double);
    SphericalHarmonicsGravitySource_ptr->Snm[147][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[147][  1] = -8.035883273680000E-09;
    SphericalHarmonicsGravitySource_ptr->Snm[147][  2] = -7.520608739170001E-09;
@@ -23158,8 +22568,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[147][145] = +5.787225085020000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[147][146] = +2.903287678420000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[147][147] = -6.437218024320000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[148] =
-      JEOD_ALLOC_PRIM_ARRAY (149, double);
    SphericalHarmonicsGravitySource_ptr->Snm[148][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[148][  1] = +1.466789807100000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[148][  2] = +1.576005893190000E-08;
@@ -23309,8 +22717,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[148][146] = -1.073215887940000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[148][147] = -5.827609526610000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[148][148] = +1.478991444190000E-08;
-   SphericalHarmonicsGravitySource_ptr->Snm[149] =
-      JEOD_ALLOC_PRIM_ARRAY (150, double);
    SphericalHarmonicsGravitySource_ptr->Snm[149][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[149][  1] = -1.191679014060000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[149][  2] = -2.289790950650000E-09;
@@ -23461,8 +22867,6 @@ SphericalHarmonicsGravitySource_moon_LP150Q_default_data::initialize (
    SphericalHarmonicsGravitySource_ptr->Snm[149][147] = +1.352215939330000E-07;
    SphericalHarmonicsGravitySource_ptr->Snm[149][148] = +5.832050715210000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[149][149] = +9.455320407030000E-09;
-   SphericalHarmonicsGravitySource_ptr->Snm[150] =
-      JEOD_ALLOC_PRIM_ARRAY (151, double);
    SphericalHarmonicsGravitySource_ptr->Snm[150][  0] = +0.000000000000000E+00;
    SphericalHarmonicsGravitySource_ptr->Snm[150][  1] = +1.534255100620000E-08;
    SphericalHarmonicsGravitySource_ptr->Snm[150][  2] = +6.403384269220000E-09;
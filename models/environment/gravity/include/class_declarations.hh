@@ -75,11 +75,17 @@ class GravityGradientTorque;
 class GravityIntegFrame;
 class GravityInteraction;
 class GravityManager;
+class GravityPointBatch;
+class SphericalHarmonicsCoeffFile;
+class SphericalHarmonicsDeltaCache;
 class SphericalHarmonicsDeltaCoeffs;
 class SphericalHarmonicsDeltaCoeffsInit;
 class SphericalHarmonicsDeltaControls;
 class SphericalHarmonicsGravitySource;
+class SphericalHarmonicsDegreeStep;
 class SphericalHarmonicsGravityControls;
+class SphericalHarmonicsGravityGrid;
+class SphericalHarmonicsOffload;
 class SphericalHarmonicsSolidBodyTides;
 class SphericalHarmonicsSolidBodyTidesInit;
 class SphericalHarmonicsTidalEffects;
@@ -0,0 +1,143 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/gravity_batch_force_model.hh
+ * Define the GravityBatchForceModel class, which supplies a
+ * ChebyshevPicardIntegrator with gravitational accelerations evaluated as
+ * multi-point batches.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((none)))
+
+Assumptions and limitations:
+  ((The gravity sources are evaluated at their current states for every
+    node of a segment. This suits sources that are fixed over the segment
+    in the integration frame, such as a central body at the frame origin
+    with spherical or point-mass gravity.)
+   (Relativistic corrections are not applied.))
+
+Library dependencies:
+  ((gravity_batch_force_model.cc))
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_GRAVITY_BATCH_FORCE_MODEL_HH
+#define JEOD_GRAVITY_BATCH_FORCE_MODEL_HH
+
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/integration/chebyshev_picard/include/chebyshev_picard_force_model.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Computes the gravitational acceleration of a body's active gravity
+ * controls at all nodes of a Chebyshev-Picard segment, one multi-point batch
+ * per control.
+ */
+class GravityBatchForceModel : public ChebyshevPicardForceModel {
+
+ JEOD_MAKE_SIM_INTERFACES (GravityBatchForceModel)
+
+ public:
+
+   // Constructor and destructor.
+   explicit GravityBatchForceModel (const GravityInteraction & grav_in);
+   ~GravityBatchForceModel () override;
+
+   // Sum the gravitation of the active controls at each node.
+   void compute_accelerations (
+      unsigned int npoints,
+      const double * times,
+      const double * const posn[3],
+      const double * const vel[3],
+      double * const accel[3]) override;
+
+
+ private:
+
+   /**
+    * The gravity interaction whose controls are evaluated.
+    */
+   const GravityInteraction * grav; //!< trick_units(--)
+
+   /**
+    * Per-control acceleration scratch space, one block per axis.
+    */
+   std::vector<double> control_accel; //!< trick_io(**)
+
+
+   // Make the copy constructor and assignment operator private
+   // (and unimplemented) to avoid erroneous copies
+   GravityBatchForceModel (const GravityBatchForceModel &);
+   GravityBatchForceModel & operator= (const GravityBatchForceModel &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -132,6 +132,17 @@ class GravityControls {
     */
    bool relativistic; //!< trick_units(--)
 
+   /**
+    * Treat the source as a point mass, bypassing the non-spherical model.
+    * The position of the integration frame origin relative to the source is
+    * recomputed only when the timestamp of the source's inertial frame or of
+    * the integration frame changes, so those frames must be time-stamped
+    * (as ephemeris-driven frames are). Intended for distant third bodies;
+    * combine with battin_method for the differential (Encke-style) form of
+    * the third body acceleration. Ignored if relativistic is set.
+    */
+   bool point_mass; //!< trick_units(--)
+
    /**
     * Pointer to the GravitySource object named by planet_name.
     * @note Users should not set this data member in the input file.
@@ -246,6 +257,56 @@ class GravityControls {
       double& pot);                // Out:    m2/s2 Specific potential
 
 
+   // Compute the acceleration due to the gravitional body associated with
+   // this control at each point of a batch of points expressed in the same
+   // integration frame. Relativistic corrections are not applied.
+   virtual void gravitation (
+      unsigned int integ_frame_idx,// In:     --    Integ frame index
+      GravityPointBatch & batch);  // Inout:  --    Points and results
+
+
+   // Compute the point-mass acceleration due to the gravitional body,
+   // reusing the integration frame offset while the frames are unchanged.
+   // This is not virtual; GravityManager calls it directly for controls
+   // that have point_mass set.
+   void point_mass_gravitation (
+      const double integ_pos[3],   // In:     m     Pt. of interest, integ coords
+      unsigned int integ_frame_idx,// In:     --    Integ frame index
+      double body_grav_accel[3],   // Out:    m/s2  Accel for given grav body
+      double dgdx[3][3],           // Out:    1/s2  Gradient for given grav body
+      double& pot);                // Out:    m2/s2 Specific potential
+
+
+   // Compute the spherical acceleration due to the gravitional body.
+   // This is not virtual; GravityManager calls it directly for spherical,
+   // non-relativistic controls.
+   void spherical_gravitation (
+      const RefFrame& point_of_interest,
+                                   // In:     --    Pt. of interest, as a frame
+      unsigned int integ_frame_idx,// In:     --    Integ frame index
+      double body_grav_accel[3],   // Out:    m/s2  Accel for given grav body
+      double dgdx[3][3],           // Out:    1/s2  Gradient for given grav body
+      double& pot);                // Out:    m2/s2 Specific potential
+
+
+   /**
+    * Can this control be evaluated as part of a multi-point batch?
+    * Batched evaluation uses the settings of one control for all points, so
+    * only controls whose result does not depend on per-control model state
+    * (spherical or point-mass, non-relativistic) qualify, as do non-spherical
+    * controls whose derived class permits it (see batchable_nonspherical).
+    * \return True if the control is batchable
+    */
+   bool batchable () const
+   {
+      return active && (! relativistic) &&
+             (spherical || point_mass || batchable_nonspherical());
+   }
+
+   // Identify the settings that affect a batchable control's result.
+   virtual unsigned int batch_signature () const;
+
+
    /**
     * Compares the magnitude of the two input gravity controls, returning true
     * if a->grav_accel_magsq is less than b->grav_accel_magsq, false otherwise.
@@ -263,6 +324,18 @@ class GravityControls {
 
  protected:
 
+   /**
+    * Can the non-spherical part of this control be evaluated as part of a
+    * multi-point batch? The default is no; derived classes that override
+    * the batch form of gravitation for their non-spherical model and whose
+    * batch_signature distinguishes the settings that affect it may say yes.
+    * \return True if a non-spherical control is batchable
+    */
+   virtual bool batchable_nonspherical () const
+   {
+      return false;
+   }
+
    /**
     * Nominally, compute the non-spherical contribution to gravity at a given
     * position. Derived classes whose override of this function computes the
@@ -315,6 +388,20 @@ class GravityControls {
       double dgdx[3][3],
       double&  pot);
 
+   // Does the gravity manager share integration frame offsets?
+   bool sharing_frame_offsets (  // Return: --  True if shared
+      void) const;
+
+   // Update the integration frame origin position wrt the body
+   void update_frame_offset (
+      GravityIntegFrame & grav_source_frame, // Inout: -- Grav frame
+      bool shared);                          // In:    -- Reuse if current
+
+   // Update the integration frame origin position and velocity wrt the body
+   void update_frame_state (
+      GravityIntegFrame & grav_source_frame, // Inout: -- Grav frame
+      bool shared);                          // In:    -- Reuse if current
+
 };
 
 
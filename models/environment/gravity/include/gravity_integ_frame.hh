@@ -111,11 +111,22 @@ class GravityIntegFrame {
     */
    double accel[3]; //!< trick_units(m/s2)
 
+   /**
+    * Velocity of the integration frame origin with respect to the body,
+    * valid at vel_time
+    */
+   double vel[3]; //!< trick_units(m/s)
+
    /**
     * Timestamp of last update to this class
     */
    double time; //!< trick_units(s)
 
+   /**
+    * Timestamp of last update to vel
+    */
+   double vel_time; //!< trick_units(s)
+
    GravityIntegFrame ();
    ~GravityIntegFrame ();
 };
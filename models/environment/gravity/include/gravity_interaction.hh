@@ -75,9 +75,11 @@ Library dependencies:
 #define JEOD_GRAVITY_INTERACTION_HH
 
 // System includes
+#include <utility>
+#include <vector>
 
 // JEOD includes
-#include "utils/container/include/pointer_vector.hh"
+#include "utils/container/include/pointer_inline_vector.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -99,6 +101,29 @@ class GravityInteraction {
  JEOD_MAKE_SIM_INTERFACES(GravityInteraction)
 
 
+ // Types
+ public:
+
+   /**
+    * The path by which GravityManager evaluates an active control.
+    */
+   enum DispatchKind {
+      PointMassDispatch = 0, ///< Non-relativistic point-mass control
+      SphericalDispatch = 1, ///< Non-relativistic spherical control
+      GeneralDispatch   = 2, ///< Any other control, via virtual gravitation
+      NumDispatchKinds  = 3  ///< Number of dispatch kinds
+   };
+
+   /**
+    * An active control in the dispatch table.
+    */
+   struct DispatchEntry {
+      GravityControls * control; ///< The control
+      DispatchKind kind;         ///< Evaluation path
+      bool batchable;            ///< Can join a multi-point batch
+   };
+
+
   // Member data
  public:
 
@@ -140,7 +165,7 @@ class GravityInteraction {
     * with which the DynBody interacts and specifies the nature of those
     * interactions.
     */
-   JeodPointerVector<GravityControls>::type grav_controls;  //!< trick_io(**)
+   JeodPointerInlineVector<GravityControls, 4>::type grav_controls;  //!< trick_io(**)
 
 
  // Make the copy constructor and assignment operator private
@@ -187,6 +212,51 @@ class GravityInteraction {
    // Sort the controls in increasing accel magnitude order
    virtual void sort_controls ();
 
+   // Rebuild the dispatch table if the controls have changed.
+   void update_dispatch ();
+
+   /**
+    * Get the active controls, in grav_controls order.
+    * The table is current as of the last call to update_dispatch.
+    * @return Dispatch table
+    */
+   const std::vector<DispatchEntry> & get_dispatch_entries () const
+   {
+      return dispatch_entries;
+   }
+
+   /**
+    * Get the indices in the dispatch table of the controls of one kind.
+    * @return Entry indices, in increasing order
+    * \param[in] kind Dispatch kind
+    */
+   const std::vector<unsigned int> & get_dispatch_group (
+      DispatchKind kind) const
+   {
+      return dispatch_groups[kind];
+   }
+
+
+ protected:
+
+   /**
+    * The active controls and their evaluation paths, in grav_controls
+    * order. Inactive controls are pruned.
+    */
+   std::vector<DispatchEntry> dispatch_entries; //!< trick_io(**)
+
+   /**
+    * Indices in dispatch_entries of the controls of each kind.
+    */
+   std::vector<unsigned int> dispatch_groups[NumDispatchKinds]; //!< trick_io(**)
+
+   /**
+    * Each control in grav_controls and the settings that determined its
+    * place in the table when the table was built.
+    */
+   std::vector<std::pair<const GravityControls *, unsigned int> >
+      dispatch_keys; //!< trick_io(**)
+
 };
 
 
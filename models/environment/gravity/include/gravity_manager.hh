@@ -94,7 +94,15 @@ class GravityManager {
 
  public:
 
- // No public data
+   /**
+    * Share the position (and, where needed, velocity) of each integration
+    * frame origin relative to each gravity source among all gravity
+    * controls and integrator stages at the same time. The shared offsets
+    * are recomputed when the timestamp of the source's inertial frame or
+    * of the integration frame changes, so those frames must be time-stamped
+    * (as ephemeris-driven frames are).
+    */
+   bool share_frame_offsets; //!< trick_units(--)
 
 
  private:
@@ -156,6 +164,26 @@ class GravityManager {
     */
    void gravitation (const RefFrame& point, GravityInteraction& grav);
 
+   /**
+    * Compute the gravitational attraction of the gravitational body
+    * associated with the given control at each of a batch of points.
+    * The per-source setup is performed once for the whole batch rather
+    * than once per point, which suits formations and constellations of
+    * many points about one body.
+    *
+    * \par Assumptions and Limitations
+    *   - The control must have been initialized.
+    *   - All points are expressed in the same integration frame.
+    *   - Relativistic corrections are not applied.
+    * \param[in,out] controls Gravity controls for the source and settings
+    * \param[in] integ_frame_idx Index of the points' integration frame
+    * \param[in,out] batch Points of interest and the resulting gravitation
+    */
+   void gravitation (
+      GravityControls & controls,
+      unsigned int integ_frame_idx,
+      GravityPointBatch & batch);
+
    /**
     * Get the vector of gravitational bodies.
     * \warning Do not modify the vector, or elements of it.
@@ -126,6 +126,16 @@ class GravityMessages {
     */
    static char const * null_pointer; //!< trick_units(--)
 
+   /**
+    * Issued to report the error statistics of a gravity interpolation grid.
+    */
+   static char const * interpolation_error; //!< trick_units(--)
+
+   /**
+    * Error issued when a gravity coefficient file cannot be read or written.
+    */
+   static char const * file_error; //!< trick_units(--)
+
 
  // Member functions
  // This class is not instantiable.
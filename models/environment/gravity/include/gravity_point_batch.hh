@@ -0,0 +1,145 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/gravity_point_batch.hh
+ * Define the GravityPointBatch class, the input/output description of a
+ * multi-point gravity evaluation.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((none)))
+
+Assumptions and limitations:
+  ((The GravityPointBatch does not own the arrays it points to.))
+
+Library dependencies:
+  ((none))
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_GRAVITY_POINT_BATCH_HH
+#define JEOD_GRAVITY_POINT_BATCH_HH
+
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Describes a set of points at which one gravity source is to be evaluated.
+ * Positions and accelerations are stored as structure-of-arrays:
+ * posn[k][i] is component k of the integration frame position of point i.
+ * The output arrays pot and grad are optional; set them to null when the
+ * potential or gradient is not wanted.
+ */
+class GravityPointBatch {
+
+ JEOD_MAKE_SIM_INTERFACES (GravityPointBatch)
+
+ public:
+
+   /**
+    * Number of points in the batch.
+    */
+   unsigned int npoints; //!< trick_units(count)
+
+   /**
+    * Point positions, integration frame coordinates, one array per axis.
+    */
+   const double * posn[3]; //!< trick_io(**)
+
+   /**
+    * Output accelerations, integration frame coordinates, one array per axis.
+    */
+   double * accel[3]; //!< trick_io(**)
+
+   /**
+    * Optional output specific potentials, one per point.
+    */
+   double * pot; //!< trick_io(**)
+
+   /**
+    * Optional output gravity gradients, one 3x3 matrix per point.
+    */
+   double (* grad)[3][3]; //!< trick_io(**)
+
+
+   /**
+    * Default constructor; describes an empty batch.
+    */
+   GravityPointBatch ()
+   :
+      npoints(0),
+      pot(nullptr),
+      grad(nullptr)
+   {
+      posn[0] = posn[1] = posn[2] = nullptr;
+      accel[0] = accel[1] = accel[2] = nullptr;
+   }
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,280 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_coeff_file.hh
+ * Define the class SphericalHarmonicsCoeffFile, which writes spherical
+ * harmonics gravity coefficients to a binary file and maps such a file
+ * read-only into memory for use by a SphericalHarmonicsGravitySource.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((none)))
+
+Assumptions and limitations:
+  ((Files are written in the byte order of the host that wrote them; a file
+    written with the other byte order is rejected rather than swapped.)
+   (IEEE-standard doubles)
+   (POSIX mmap is available.)
+   (The coefficient rows of a mapped source reside in read-only pages.
+    Writing to Cnm or Snm of such a source is a segmentation fault.)
+   (The mapped coefficients are not checkpointed. A source initialized from
+    a file must be initialized from the file again after a restart.))
+
+Library dependencies:
+  ((../src/spherical_harmonics_coeff_file.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPHERICAL_HARMONICS_COEFF_FILE_HH
+#define JEOD_SPHERICAL_HARMONICS_COEFF_FILE_HH
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Binary spherical harmonics coefficient file.
+ *
+ * A file consists of a Header followed, at Header::data_offset, by the
+ * lower-triangular Cnm rows for degrees 0 to degree (row n holds orders 0 to
+ * n) and then the Snm rows in the same layout. Orders beyond the model order
+ * are stored as zero.
+ */
+class SphericalHarmonicsCoeffFile {
+
+ JEOD_MAKE_SIM_INTERFACES(SphericalHarmonicsCoeffFile)
+
+ // Data types
+ public:
+
+   /**
+    * Fixed-size file header.
+    */
+   struct Header {
+
+      /**
+       * File identifier, "JEODSHC" followed by a NUL.
+       */
+      char magic[8]; //!< trick_units(--)
+
+      /**
+       * Format version; see current_version.
+       */
+      uint32_t version; //!< trick_units(--)
+
+      /**
+       * byte_order_mark as written by the host that wrote the file.
+       */
+      uint32_t byte_order; //!< trick_units(--)
+
+      /**
+       * Degree of the coefficients.
+       */
+      uint32_t degree; //!< trick_units(--)
+
+      /**
+       * Order of the coefficients.
+       */
+      uint32_t order; //!< trick_units(--)
+
+      /**
+       * Nonzero if C20 is free of the permanent tide.
+       */
+      uint32_t tide_free; //!< trick_units(--)
+
+      /**
+       * Unused; written as zero.
+       */
+      uint32_t reserved; //!< trick_units(--)
+
+      /**
+       * Gravitational parameter.
+       */
+      double mu; //!< trick_units(m3/s2)
+
+      /**
+       * Spherical harmonics distance scale.
+       */
+      double radius; //!< trick_units(m)
+
+      /**
+       * Number to be added to C20 to remove the permanent tide.
+       */
+      double tide_free_delta; //!< trick_units(--)
+
+      /**
+       * NUL-terminated name of the gravity source.
+       */
+      char name[64]; //!< trick_units(--)
+
+      /**
+       * Offset in bytes from the start of the file to the first Cnm value.
+       */
+      uint64_t data_offset; //!< trick_units(--)
+
+      /**
+       * Number of values in each of the Cnm and Snm triangles.
+       */
+      uint64_t num_terms; //!< trick_units(--)
+   };
+
+
+ // Static member data
+ public:
+
+   /**
+    * File identifier.
+    */
+   static const char file_magic[8]; //!< trick_io(**)
+
+   /**
+    * Version of the format written by write_file.
+    */
+   static const uint32_t current_version; //!< trick_io(**)
+
+   /**
+    * Value written to Header::byte_order.
+    */
+   static const uint32_t byte_order_mark; //!< trick_io(**)
+
+
+ // Member data
+ public:
+
+   /**
+    * Name of the mapped file; empty if no file is mapped.
+    */
+   std::string file_name; //!< trick_units(--)
+
+
+ protected:
+
+   /**
+    * Start of the read-only mapping.
+    */
+   void * map_addr; //!< trick_io(**)
+
+   /**
+    * Size of the mapping in bytes.
+    */
+   std::size_t map_size; //!< trick_io(**)
+
+
+ // Member functions
+ public:
+
+   // Default constructor
+   SphericalHarmonicsCoeffFile ();
+
+   // Destructor
+   ~SphericalHarmonicsCoeffFile ();
+
+   // Write the coefficients of a source to a binary file.
+   static void write_file (
+      const SphericalHarmonicsGravitySource & source,
+      const std::string & path);
+
+   // Map a binary file and point the source's Cnm and Snm rows into it.
+   void map_file (
+      const std::string & path,
+      SphericalHarmonicsGravitySource & source);
+
+   // Release the mapping.
+   void unmap (void);
+
+   /**
+    * Is a file currently mapped?
+    * @return True if a file is mapped
+    */
+   bool is_mapped (void) const
+   {
+      return map_addr != nullptr;
+   }
+
+
+ // Make the copy constructor and assignment operator private
+ // (and unimplemented) to avoid erroneous copies
+ private:
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsCoeffFile (const SphericalHarmonicsCoeffFile &);
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsCoeffFile & operator= (
+      const SphericalHarmonicsCoeffFile &);
+
+};
+
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
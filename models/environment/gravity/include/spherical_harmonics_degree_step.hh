@@ -0,0 +1,181 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_degree_step.hh
+ * Define the class SphericalHarmonicsDegreeStep, a fidelity step that
+ * lowers the degree and order of spherical harmonics gravity controls.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/spherical_harmonics_degree_step.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPHERICAL_HARMONICS_DEGREE_STEP_HH
+#define JEOD_SPHERICAL_HARMONICS_DEGREE_STEP_HH
+
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/fidelity_controller.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A fidelity step that truncates the non-spherical gravity of a set of
+ * gravity controls to a lower degree and order. The gradient degree and
+ * order are limited to the truncated degree and order. Restoring the step
+ * reinstates each control's settings as they were when the step was
+ * applied. Since the controls' recursion tables only grow, neither
+ * direction allocates.
+ */
+class SphericalHarmonicsDegreeStep : public JeodFidelityStep {
+JEOD_MAKE_SIM_INTERFACES(SphericalHarmonicsDegreeStep)
+
+public:
+
+   // Member data
+
+   /**
+    * Degree to which the controls are truncated.
+    */
+   unsigned int reduced_degree; //!< trick_units(--)
+
+   /**
+    * Order to which the controls are truncated.
+    */
+   unsigned int reduced_order; //!< trick_units(--)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   SphericalHarmonicsDegreeStep (void);
+   ~SphericalHarmonicsDegreeStep (void) override;
+
+   // Add a gravity control to those affected by the step.
+   void add_controls (SphericalHarmonicsGravityControls & controls);
+
+   // JeodFidelityStep interface.
+   void degrade (void) override;
+   void restore (void) override;
+
+
+protected:
+
+   /**
+    * A gravity control and its settings before the step was applied.
+    */
+   struct Entry {
+      /**
+       * The control.
+       */
+      SphericalHarmonicsGravityControls * controls;
+
+      /**
+       * Degree before the step was applied.
+       */
+      unsigned int degree;
+
+      /**
+       * Order before the step was applied.
+       */
+      unsigned int order;
+
+      /**
+       * Gradient degree before the step was applied.
+       */
+      unsigned int gradient_degree;
+
+      /**
+       * Gradient order before the step was applied.
+       */
+      unsigned int gradient_order;
+   };
+
+   /**
+    * The controls affected by the step.
+    */
+   std::vector<Entry> entries; //!< trick_io(**)
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsDegreeStep (const SphericalHarmonicsDegreeStep &);
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsDegreeStep & operator= (
+      const SphericalHarmonicsDegreeStep &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
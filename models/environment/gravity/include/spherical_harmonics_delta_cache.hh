@@ -0,0 +1,216 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_delta_cache.hh
+ * Define the class SphericalHarmonicsDeltaCache, a time-stamped copy of the
+ * summed delta-coefficients of a spherical harmonics gravity source.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+References:
+  (((none)))
+
+Assumptions and limitations:
+  ((The cached sums are reused only while the timestamps of the inputs to the
+    delta-coefficient models are unchanged. Models whose update depends on
+    the calling control rather than on time must not be cached.))
+
+Library dependencies:
+  ((../src/spherical_harmonics_delta_cache.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPHERICAL_HARMONICS_DELTA_CACHE_HH
+#define JEOD_SPHERICAL_HARMONICS_DELTA_CACHE_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Holds the most recent summed delta-coefficient set of a gravity source,
+ * tagged with the time of its inputs and with a key that describes the
+ * delta-controls that produced it. Every control of the source whose
+ * delta-controls have the same key reuses the set until the time changes,
+ * so the delta-coefficient models are updated and summed once per time
+ * rather than once per vehicle and integrator stage.
+ */
+class SphericalHarmonicsDeltaCache {
+
+ JEOD_MAKE_SIM_INTERFACES(SphericalHarmonicsDeltaCache)
+
+
+ // Member data
+ public:
+
+   /**
+    * Share delta-coefficient updates and sums between evaluations?
+    * This requires that the planet-fixed and tidal body frames carry
+    * timestamps, as they do when updated by the ephemeris and RNP models.
+    */
+   bool enabled; //!< trick_units(--)
+
+   /**
+    * Does the cache hold a set?
+    */
+   bool valid; //!< trick_units(--)
+
+   /**
+    * Time of the inputs that produced the cached set.
+    */
+   double time; //!< trick_units(s)
+
+   /**
+    * Summed delta C20 of the cached set.
+    */
+   double dC20; //!< trick_units(--)
+
+   /**
+    * Number of rows in the cached coefficient arrays.
+    */
+   unsigned int degree; //!< trick_units(--)
+
+   /**
+    * Number of columns in the cached coefficient arrays.
+    */
+   unsigned int order; //!< trick_units(--)
+
+   /**
+    * Cached summed real (cosine) delta-coefficients.
+    */
+   double ** delta_Cnm; //!< trick_units(--)
+
+   /**
+    * Cached summed imaginary (sine) delta-coefficients.
+    */
+   double ** delta_Snm; //!< trick_units(--)
+
+ protected:
+
+   /**
+    * Description of the delta-controls that produced the cached set.
+    */
+   std::vector<unsigned int> key; //!< trick_io(**)
+
+
+ // Make the copy constructor and assignment operator private
+ // (and unimplemented) to avoid erroneous copies
+ private:
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsDeltaCache (const SphericalHarmonicsDeltaCache &);
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsDeltaCache & operator= (
+      const SphericalHarmonicsDeltaCache &);
+
+
+ // Member functions
+ public:
+
+   // Constructor & Destructor
+   SphericalHarmonicsDeltaCache ();
+   ~SphericalHarmonicsDeltaCache ();
+
+   // Is the cached set the one for the given time and key?
+   bool matches (                              // Return: -- True on a hit
+      double input_time,                       // In:     s  Input time
+      const std::vector<unsigned int> & input_key) const; // In: -- Key
+
+   // Replace the cached set
+   void store (                                // Return: -- Void
+      double input_time,                       // In:     s  Input time
+      const std::vector<unsigned int> & input_key, // In: -- Key
+      double sum_dC20,                         // In:     -- Summed dC20
+      double ** sum_Cnm,                       // In:     -- Summed dCnm
+      double ** sum_Snm,                       // In:     -- Summed dSnm
+      unsigned int sum_degree,                 // In:     -- Rows
+      unsigned int sum_order);                 // In:     -- Columns
+
+   // Copy the cached set out
+   void retrieve (                             // Return: -- Void
+      double & sum_dC20,                       // Out:    -- Summed dC20
+      double ** sum_Cnm,                       // Out:    -- Summed dCnm
+      double ** sum_Snm) const;                // Out:    -- Summed dSnm
+
+   // Discard the cached set
+   void invalidate (void);
+
+
+ protected:
+
+   // Release the cached arrays
+   void release (void);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
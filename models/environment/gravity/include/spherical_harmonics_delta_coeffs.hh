@@ -125,6 +125,18 @@ class SphericalHarmonicsDeltaCoeffs {
     */
    double dC20; //!< trick_units(--)
 
+   /**
+    * Has the effect been updated since the cache was enabled?
+    * Used only when the source's delta_cache is enabled.
+    */
+   bool update_valid; //!< trick_units(--)
+
+   /**
+    * Value of input_time() at the last update.
+    * Used only when the source's delta_cache is enabled.
+    */
+   double update_time; //!< trick_units(s)
+
 
  // Member functions
  public:
@@ -139,6 +151,27 @@ class SphericalHarmonicsDeltaCoeffs {
 
    virtual void update (SphericalHarmonicsGravityControls & controls);
 
+   // Time of the inputs on which update depends
+   virtual double input_time (void) const;
+
+   /**
+    * Has this effect been updated for the current input_time()?
+    * @return True if an update would reproduce the current values.
+    */
+   bool is_current (void) const
+   {
+      return update_valid && (update_time == input_time());
+   }
+
+   /**
+    * Record that the effect has been updated for the current input_time().
+    */
+   void mark_current (void)
+   {
+      update_time = input_time();
+      update_valid = true;
+   }
+
 };
 
 
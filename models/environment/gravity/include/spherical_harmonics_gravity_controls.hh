@@ -70,13 +70,16 @@ Library dependencies:
 
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/memory/include/scratch_arena.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
 #include "gravity_controls.hh"
+#include "spherical_harmonics_gravity_grid.hh"
 #include "class_declarations.hh"
 
 
@@ -90,6 +93,26 @@ class SphericalHarmonicsGravityControls : public GravityControls {
 
  JEOD_MAKE_SIM_INTERFACES (SphericalHarmonicsGravityControls)
 
+ // Data types
+
+ public:
+   /**
+    * Identifies the compile-time specialization of the non-spherical
+    * kernel used by calc_nonspherical.
+    */
+   enum NonsphericalKernel {
+      AccelOnly              = 0, ///< Acceleration only
+      AccelPotential         = 1, ///< Acceleration and potential
+      AccelPotentialGradient = 2  ///< Acceleration, potential and gradient
+   };
+
+   /**
+    * Number of points evaluated together by the lane-wise batch kernel.
+    * Four doubles fill an AVX2 register and two NEON / SSE2 registers.
+    */
+   static const unsigned int batch_lanes = 4; //!< trick_io(**)
+
+
  // Member data
 
  protected:
@@ -102,6 +125,46 @@ class SphericalHarmonicsGravityControls : public GravityControls {
     */
    bool min_radius_warn; //!< trick_units(--)
 
+   /**
+    * The kernel selected by select_kernel.
+    */
+   NonsphericalKernel kernel_type; //!< trick_units(--)
+
+   /**
+    * Value of the gradient flag when the kernel was selected.
+    */
+   bool kernel_gradient; //!< trick_units(--)
+
+   /**
+    * Value of the compute_potential flag when the kernel was selected.
+    */
+   bool kernel_potential; //!< trick_units(--)
+
+   /**
+    * Description of the var_effects settings, used to look up summed
+    * delta-coefficients in the source's delta_cache.
+    */
+   std::vector<unsigned int> delta_key; //!< trick_io(**)
+
+   /**
+    * Legendre polynomials for the lane-wise batch kernel, stored with the
+    * batch_lanes points of each (n,m) term adjacent.
+    */
+   std::vector<double> lane_pnm; //!< trick_io(**)
+
+   /**
+    * Degree through which lane_pnm is allocated.
+    */
+   unsigned int lane_pnm_degree; //!< trick_io(**)
+
+   /**
+    * Scratch storage for the per-evaluation order recursions (the
+    * cos(m lambda), sin(m lambda), C-tilde and S-tilde arrays), sized
+    * for the lane-wise and extended-range kernels through this control's
+    * degree.
+    */
+   ScratchArena scratch; //!< trick_io(**)
+
  public:
    /**
     * The GravitySource pointer from the base class, recast.
@@ -114,6 +177,11 @@ class SphericalHarmonicsGravityControls : public GravityControls {
     */
    double ** Pnm; //!< trick_units(--)
 
+   /**
+    * Degree through which Pnm is allocated.
+    */
+   unsigned int pnm_degree; //!< trick_io(*o) trick_units(--)
+
 
    /**
     * Coefficient degree to be used for totaling up all active delta_coeffs.
@@ -172,6 +240,91 @@ class SphericalHarmonicsGravityControls : public GravityControls {
     */
    unsigned int gradient_order; //!< trick_units(--)
 
+   /**
+    * Use the order-blocked kernel, which evaluates several orders at once
+    * in a form the compiler can vectorize, when the gravity gradient is not
+    * needed. Results agree with the default scalar kernel to within the
+    * rounding of a reordered sum (better than 1e-13 relative).
+    */
+   bool blocked_orders; //!< trick_units(--)
+
+   /**
+    * Evaluations above this degree use the extended-range kernel, which
+    * carries the Legendre functions and the powers of cos(latitude) as
+    * scaled mantissa/exponent pairs so that neither overflows nor
+    * underflows at high degree and near the poles. The gradient kernel
+    * has no extended-range form; gradient evaluations above this degree
+    * use the standard kernel.
+    */
+   unsigned int extended_range_degree; //!< trick_units(--)
+
+   /**
+    * Compute the non-spherical contribution to the potential? When clear,
+    * the acceleration-only kernel is used (unless the gradient is needed)
+    * and the non-spherical part of the reported potential is zero.
+    */
+   bool compute_potential; //!< trick_units(--)
+
+   /**
+    * Replace the series evaluation by interpolation in the grid, which is
+    * built when the control is initialized. The series is still used for
+    * points outside the grid shells, when the gradient is needed, when
+    * delta-coefficient effects are active, or if the grid failed its check.
+    */
+   bool use_grid; //!< trick_units(--)
+
+   /**
+    * Choose the degree at each evaluation from the distance to the source.
+    * The effective degree is the smallest n for which (R/r)^n is below
+    * adaptive_tolerance, limited to the range 2 to degree.
+    */
+   bool adaptive_degree; //!< trick_units(--)
+
+   /**
+    * Truncation tolerance for the adaptive degree, relative to the
+    * point-mass term.
+    */
+   double adaptive_tolerance; //!< trick_units(--)
+
+   /**
+    * Hysteresis factor for the adaptive degree, in (0,1]. The degree is
+    * raised as soon as adaptive_tolerance requires it but is lowered only
+    * when adaptive_tolerance * adaptive_hysteresis allows it, so that a
+    * vehicle near a threshold radius does not switch back and forth.
+    */
+   double adaptive_hysteresis; //!< trick_units(--)
+
+   /**
+    * Allow the non-spherical field to be evaluated as part of a multi-point
+    * batch, e.g. for an ensemble of vehicles integrated together with
+    * DynamicsIntegrationGroup::batch_gravitation set. Points are evaluated
+    * batch_lanes at a time, with each term of the series computed for all
+    * lanes in one vectorizable loop. Controls are batched only when they
+    * share degree, order and compute_potential and use none of the gradient,
+    * the grid, the adaptive degree, or delta-coefficient effects.
+    */
+   bool lane_batch; //!< trick_units(--)
+
+   /**
+    * Optional accelerator backend for batched evaluations. When set, batches
+    * of a batchable control with at least offload->min_batch_size points
+    * are evaluated by it rather than by the lane-wise kernel. The control
+    * does not own the object.
+    */
+   SphericalHarmonicsOffload * offload; //!< trick_units(--)
+
+   /**
+    * Degree used by the most recent evaluation; equal to degree unless
+    * adaptive_degree is set.
+    * @note Users should not set this data member in the input file.
+    */
+   unsigned int effective_degree; //!< trick_units(--)
+
+   /**
+    * Interpolation grid used when use_grid is set.
+    */
+   SphericalHarmonicsGravityGrid grid; //!< trick_units(--)
+
    /**
     * List of controls for variational gravity effects like solid-body tides
     */
@@ -209,6 +362,18 @@ class SphericalHarmonicsGravityControls : public GravityControls {
       GravityManager & grav_manager) override;     // In:     -- Reference to Gravity Manager
 
 
+   using GravityControls::gravitation;
+
+   // Compute the gravitation at each point of a batch, evaluating the
+   // non-spherical field lane-wise when the control is batchable
+   void gravitation (
+      unsigned int integ_frame_idx,// In:     --    Integ frame index
+      GravityPointBatch & batch) override; // Inout: -- Points and results
+
+   // Identify the settings that affect a batchable control's result.
+   unsigned int batch_signature () const override;
+
+
    // Add a new delta-control to var_effects list
    virtual void add_deltacontrol (
       SphericalHarmonicsDeltaControls * delta_control);
@@ -265,6 +430,13 @@ class SphericalHarmonicsGravityControls : public GravityControls {
    void disable_min_radius_warnings () {min_radius_warn = true;}
 
 
+   // Compute the static non-spherical field at a planet-fixed position
+   void calc_nonspherical_static (  // Return: --  Void
+      const double posn_pf[3],      // In:     m   Point of interest, pfix
+      double accel_pf[3],           // Out:    m/s2 Acceleration, pfix
+      double & pot);                // Out:    --  Potential
+
+
  protected:
 
    // Compute non-spherical gravity acceleration, potential at a point
@@ -277,11 +449,87 @@ class SphericalHarmonicsGravityControls : public GravityControls {
       double&  pot) override;              // Out:   --   Potential
 
 
+   // Order-blocked variant of calc_nonspherical (no gradient)
+   void calc_nonspherical_blocked ( // Return: --  Void
+      const double posn[3],         // In:     m   Point of interest
+      unsigned int eval_degree,     // In:     --  Degree to be used
+      unsigned int eval_order,      // In:     --  Order to be used
+      double local_C20,             // In:     --  C20 with delta effects
+      double body_grav_accel[3],    // Out:    m/s2 Acceleration
+      double&  pot);                // Out:    --  Potential
+
+
+   // Extended-range variant of calc_nonspherical (no gradient)
+   void calc_nonspherical_extended ( // Return: --  Void
+      const double posn[3],         // In:     m   Point of interest
+      unsigned int eval_degree,     // In:     --  Degree to be used
+      unsigned int eval_order,      // In:     --  Order to be used
+      double local_C20,             // In:     --  C20 with delta effects
+      double body_grav_accel[3],    // Out:    m/s2 Acceleration
+      double&  pot);                // Out:    --  Potential
+
+
+   // Lane-wise variant of calc_nonspherical (no gradient)
+   void calc_nonspherical_lanes ( // Return: --  Void
+      const double posn[3][batch_lanes], // In: m   Points of interest
+      unsigned int eval_degree,     // In:     --  Degree to be used
+      unsigned int eval_order,      // In:     --  Order to be used
+      double local_C20,             // In:     --  C20 coefficient
+      double body_grav_accel[3][batch_lanes], // Out: m/s2 Accelerations
+      double pot[batch_lanes]);     // Out:    --  Potentials
+
+
+   // Can the non-spherical part of this control be batched?
+   bool batchable_nonspherical (  // Return: --  True if batchable
+      void) const override;
+
+
+   // Evaluate a batch on the offload backend
+   void gravitation_offload (     // Return: --  Void
+      GravityIntegFrame & grav_source_frame, // In: -- Source integ frame
+      unsigned int eval_degree,     // In:     --  Degree to be used
+      unsigned int eval_order,      // In:     --  Order to be used
+      double local_C20,             // In:     --  C20 coefficient
+      GravityPointBatch & batch);   // Inout:  --  Points and results
+
+
+   // Apply the spherical terms to a batch point's non-spherical result
+   // and store the point's results
+   void finish_batch_point (     // Return: --  Void
+      GravityIntegFrame & grav_source_frame, // In: -- Source integ frame
+      unsigned int ip,              // In:     --  Point index
+      const double integ_pos[3],    // In:     m   Integ frame position
+      const double posn[3],         // In:     m   Position wrt source
+      double accel[3],              // Inout:  m/s2 Acceleration
+      double pot,                   // In:     --  Potential
+      GravityPointBatch & batch);   // Inout:  --  Batch
+
+
+   // Size and seed lane_pnm for the current degree
+   void allocate_lane_legendre (  // Return: --  Void
+      void);
+
+
    // Check the validity of this control
    virtual void check_validity (  // Return: --  Void
       void);
 
 
+   // Select the kernel specialization that matches the current settings
+   void select_kernel (  // Return: --  Void
+      void);
+
+
+   // Size Pnm and the source's recursion tables for the current degree
+   void allocate_legendre (  // Return: --  Void
+      void);
+
+
+   // Update effective_degree for the given distance from the source
+   void select_adaptive_degree (  // Return: --  Void
+      double r_mag);              // In:     m   Distance from the source
+
+
    // Update all of the active variational gravity effects
    virtual void update_deltacoeffs (  // Return: --  Void
       void);
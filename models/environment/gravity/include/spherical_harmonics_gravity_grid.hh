@@ -0,0 +1,286 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_gravity_grid.hh
+ * Define the SphericalHarmonicsGravityGrid class, a precomputed table of the
+ * non-spherical acceleration and potential of a spherical harmonics gravity
+ * field, interpolated in place of the series evaluation.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((none)))
+
+Assumptions and limitations:
+  ((The grid tabulates the static field only; delta-coefficient effects such
+    as tides are not tabulated.)
+   (The grid is a set of radial shells uniformly spaced in planet-fixed
+    radius, colatitude and longitude.)
+   (The gravity gradient is not interpolated.))
+
+Library dependencies:
+  ((../src/spherical_harmonics_gravity_grid.cc))
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPHERICAL_HARMONICS_GRAVITY_GRID_HH
+#define JEOD_SPHERICAL_HARMONICS_GRAVITY_GRID_HH
+
+
+// System includes
+#include <cstddef>
+#include <string>
+
+// JEOD includes
+#include "utils/sim_interface/include/checkpoint_reconstructor.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A table of the non-spherical part of a spherical harmonics gravity field,
+ * evaluated once at the nodes of a grid of radial shells and interpolated with
+ * a tricubic (Lagrange four-point per axis) interpolant.
+ *
+ * The planet-fixed Cartesian acceleration components and the potential are
+ * tabulated against planet-fixed radius, colatitude and longitude. These are
+ * smooth functions of position, including across the poles, where the
+ * interpolation stencil is continued over the pole onto the opposite meridian.
+ *
+ * After the table is built, the interpolant is checked against the series at
+ * num_check_points quasi-random points in the grid volume. The error measure
+ * is the magnitude of the acceleration error divided by the point-mass
+ * acceleration mu/r^2 at the check point. A grid whose maximum error exceeds
+ * error_budget is marked unusable and the series is used instead.
+ *
+ * The table is a pure function of the grid settings and the field, so it is
+ * not written to checkpoints. It is marked reconstructible and tabulated
+ * anew on restart.
+ */
+class SphericalHarmonicsGravityGrid : public JeodCheckpointReconstructor {
+
+ JEOD_MAKE_SIM_INTERFACES (SphericalHarmonicsGravityGrid)
+
+ // Member data
+
+ public:
+
+   /**
+    * Number of radial shells; at least four.
+    */
+   unsigned int num_radial; //!< trick_units(count)
+
+   /**
+    * Number of colatitude nodes, pole to pole inclusive; at least four.
+    */
+   unsigned int num_colatitude; //!< trick_units(count)
+
+   /**
+    * Number of longitude nodes; even and at least eight.
+    */
+   unsigned int num_longitude; //!< trick_units(count)
+
+   /**
+    * Radius of the innermost shell.
+    */
+   double radius_min; //!< trick_units(m)
+
+   /**
+    * Radius of the outermost shell.
+    */
+   double radius_max; //!< trick_units(m)
+
+   /**
+    * Largest acceptable interpolation error, relative to mu/r^2.
+    */
+   double error_budget; //!< trick_units(--)
+
+   /**
+    * Number of points at which the interpolant is checked after the build.
+    */
+   unsigned int num_check_points; //!< trick_units(count)
+
+   /**
+    * Largest interpolation error found by the check, relative to mu/r^2.
+    */
+   double max_error; //!< trick_units(--)
+
+   /**
+    * Root mean square of the interpolation errors found by the check.
+    */
+   double rms_error; //!< trick_units(--)
+
+   /**
+    * Planet-fixed position of the check point with the largest error.
+    */
+   double max_error_posn[3]; //!< trick_units(m)
+
+   /**
+    * Set when the grid has been built and is within the error budget.
+    * @note Users should not set this data member in the input file.
+    */
+   bool valid; //!< trick_units(--)
+
+ protected:
+
+   /**
+    * Radial node spacing.
+    */
+   double delta_radius; //!< trick_units(m)
+
+   /**
+    * Colatitude node spacing.
+    */
+   double delta_colatitude; //!< trick_units(rad)
+
+   /**
+    * Longitude node spacing.
+    */
+   double delta_longitude; //!< trick_units(rad)
+
+   /**
+    * Tabulated planet-fixed acceleration and potential, four values per node,
+    * stored with longitude varying fastest.
+    */
+   double * node_data; //!< trick_io(**)
+
+   /**
+    * The control the table was built for, used to rebuild it on restart.
+    */
+   SphericalHarmonicsGravityControls * tabulated_controls; //!< trick_io(**)
+
+
+ // Make the copy constructor and assignment operator private
+ // (and unimplemented) to avoid erroneous copies
+ private:
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsGravityGrid (const SphericalHarmonicsGravityGrid &);
+
+   /**
+    * Not implemented.
+    */
+   SphericalHarmonicsGravityGrid & operator= (
+      const SphericalHarmonicsGravityGrid &);
+
+
+ public:
+
+   // Default constructor
+   SphericalHarmonicsGravityGrid ();
+
+   // Destructor
+   virtual ~SphericalHarmonicsGravityGrid ();
+
+
+   // Build and check the table for the given control
+   virtual void initialize (                  // Return: -- Void
+      SphericalHarmonicsGravityControls & controls); // In: -- Exact field
+
+   // Rebuild the table after a restart
+   bool reconstruct_contents (          // Return: -- True if rebuilt
+      const std::string & reference,    // In:     -- Table reference
+      void * addr,                      // In:     -- Recreated table
+      std::size_t size) override;       // In:     -- Table size, bytes
+
+
+   // Interpolate the non-spherical field at a planet-fixed position
+   void interpolate (                   // Return: -- Void
+      const double posn_pf[3],          // In:     m  Position, pfix
+      double accel_pf[3],               // Out:    m/s2 Acceleration, pfix
+      double & pot) const;              // Out:    m2/s2 Potential
+
+
+   /**
+    * Is the given radius within the tabulated shells?
+    * @return True if radius_min <= r_mag <= radius_max.
+    * \param[in] r_mag Radial distance\n Units: M
+    */
+   bool contains (double r_mag) const
+   {
+      return (r_mag >= radius_min) && (r_mag <= radius_max);
+   }
+
+
+ protected:
+
+   // Release the table
+   void release (void);
+
+   // Evaluate the field at the grid nodes
+   void tabulate (
+      SphericalHarmonicsGravityControls & controls); // In: -- Exact field
+
+   // Number of doubles in the table
+   std::size_t table_size (void) const;
+
+   // Node values, with the colatitude / longitude indices wrapped
+   const double * node (     // Return: -- Four node values
+      int ir,                // In:     -- Radial index
+      int ic,                // In:     -- Colatitude index
+      int il) const;         // In:     -- Longitude index
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -58,7 +58,8 @@ Assumptions and limitations:
   ((TBS))
 
 Library dependencies:
-  ((../src/spherical_harmonics_gravity_source.cc))
+  ((../src/spherical_harmonics_gravity_source.cc)
+   (../src/spherical_harmonics_calc_potential.cc))
 
 
 *******************************************************************************/
@@ -69,6 +70,7 @@ Library dependencies:
 
 
 // System includes
+#include <string>
 #include <vector>
 
 // JEOD includes
@@ -78,6 +80,8 @@ Library dependencies:
 // Model includes
 #include "class_declarations.hh"
 #include "gravity_source.hh"
+#include "spherical_harmonics_coeff_file.hh"
+#include "spherical_harmonics_delta_cache.hh"
 
 
 //! Namespace jeod
@@ -93,6 +97,49 @@ class SphericalHarmonicsGravitySource : public GravitySource {
 
  JEOD_MAKE_SIM_INTERFACES(SphericalHarmonicsGravitySource)
 
+ // Data types
+ public:
+
+   /**
+    * One (degree, order) entry in the packed coefficient block.
+    * The Gottlieb recursion constants for a term are stored next to the
+    * term's coefficients so that the order loop in calc_nonspherical
+    * walks a single contiguous stream rather than six separate rows.
+    */
+   struct PackedTerm {
+
+      /**
+       * Normalized real (cosine) coefficient C(n,m).
+       */
+      double Cnm; //!< trick_units(--)
+
+      /**
+       * Normalized imaginary (sine) coefficient S(n,m).
+       */
+      double Snm; //!< trick_units(--)
+
+      /**
+       * Gottlieb coefficient xi(n,m); zero for m >= n.
+       */
+      double xi; //!< trick_units(--)
+
+      /**
+       * Gottlieb coefficient eta(n,m); zero for m >= n.
+       */
+      double eta; //!< trick_units(--)
+
+      /**
+       * Gottlieb coefficient zeta(n,m).
+       */
+      double zeta; //!< trick_units(--)
+
+      /**
+       * Gottlieb coefficient upsilon(n,m).
+       */
+      double upsilon; //!< trick_units(--)
+   };
+
+
  // Member data
  public:
    /**
@@ -112,12 +159,18 @@ class SphericalHarmonicsGravitySource : public GravitySource {
    unsigned int order; //!< trick_units(--)
 
    /**
-    * Normalized real (cosine) spherical harmonic coefficients.
+    * Normalized real (cosine) spherical harmonic coefficients, allocated with
+    * JEOD_ALLOC_PRIM_TRIANGLE through degree unless the rows point into
+    * a mapped coefficient file. Rows allocated one at a time with
+    * JEOD_ALLOC_PRIM_ARRAY are also accepted.
     */
    double ** Cnm; //!< trick_units(--)
 
    /**
-    * Normalized imaginary (sine) spherical harmonic coefficients.
+    * Normalized imaginary (sine) spherical harmonic coefficients, allocated with
+    * JEOD_ALLOC_PRIM_TRIANGLE through degree unless the rows point into
+    * a mapped coefficient file. Rows allocated one at a time with
+    * JEOD_ALLOC_PRIM_ARRAY are also accepted.
     */
    double ** Snm; //!< trick_units(--)
 
@@ -168,12 +221,46 @@ class SphericalHarmonicsGravitySource : public GravitySource {
     */
    double * int_to_double; //!< trick_units(--)
 
+   /**
+    * Packed lower-triangular copy of Cnm, Snm, xi, eta, zeta and upsilon,
+    * stored degree-major: term (n,m) is at packed_terms[packed_row(n) + m].
+    * The block starts on a 64-byte boundary and extends through
+    * table_degree. It is built with the recursion tables; call
+    * pack_coefficients if Cnm or Snm are changed after that.
+    */
+   PackedTerm * packed_terms; //!< trick_io(**)
+
+   /**
+    * Build the recursion tables and packed coefficients only through the
+    * highest degree requested by the controls of this source (see
+    * require_degree) rather than through the full model degree.
+    */
+   bool lazy_tables; //!< trick_units(--)
+
+   /**
+    * Degree through which the recursion tables and packed coefficients
+    * are currently built.
+    */
+   unsigned int table_degree; //!< trick_io(*o) trick_units(--)
+
    /**
     * List of all gravity coefficient altering effects such as
     * solid-body tides
     */
    JeodPointerVector<SphericalHarmonicsDeltaCoeffs>::type delta_coeffs; //!< trick_io(**)
 
+   /**
+    * Time-stamped summed delta-coefficients, shared by all controls of this
+    * source. Set delta_cache.enabled to share the updates and sums.
+    */
+   SphericalHarmonicsDeltaCache delta_cache; //!< trick_units(--)
+
+   /**
+    * Binary coefficient file whose read-only pages hold the Cnm and Snm rows,
+    * when the source was initialized from such a file.
+    */
+   SphericalHarmonicsCoeffFile coeff_file; //!< trick_io(**)
+
 
  // Make the copy constructor and assignment operator private
  // (and unimplemented) to avoid erroneous copies
@@ -206,6 +293,13 @@ class SphericalHarmonicsGravitySource : public GravitySource {
    virtual void initialize_body (void);
 
 
+   // Initialize the coefficients from a binary coefficient file.
+   void map_coefficient_file (const std::string & path);
+
+   // Initialize the coefficients from a separately built data module.
+   void load_data_module (const std::string & module_name);
+
+
    // Find the index number for a given set of delta-coeffs;
    // Returns -1 if coeffs are not in the delta-coeffs vector.
    int find_deltacoeff (
@@ -217,6 +311,53 @@ class SphericalHarmonicsGravitySource : public GravitySource {
       BaseDynManager & dyn_manager,
       SphericalHarmonicsDeltaCoeffs & var_effect);
 
+
+   // Extend the recursion tables through the given degree if needed.
+   void require_degree (unsigned int needed_degree);
+
+
+   // (Re)build the packed coefficient block from Cnm, Snm and the
+   // Gottlieb recursion constants.
+   void pack_coefficients (void);
+
+
+   // Compute the potential of the static field at a planet-fixed position,
+   // without the acceleration or gradient.
+   double calc_potential (
+      const double posn_pf[3],
+      unsigned int eval_degree,
+      unsigned int eval_order,
+      std::vector<double> & work) const;
+
+
+   /**
+    * Index of the first (n,0) term of degree n in packed_terms.
+    * @return Offset of row n
+    * \param[in] n Degree
+    */
+   static unsigned int packed_row (unsigned int n)
+   {
+      return (n * (n + 1)) / 2;
+   }
+
+
+ protected:
+
+   // Build the recursion tables through the given degree.
+   void build_tables (unsigned int new_degree);
+
+   // Free the recursion tables.
+   void release_tables (void);
+
+   // Free a Cnm or Snm triangle, whichever way its rows were allocated.
+   void release_coeff_rows (double ** & coeffs);
+
+   /**
+    * Backing allocation for packed_terms, oversized so that packed_terms
+    * can be placed on a cache-line boundary.
+    */
+   double * packed_storage; //!< trick_io(**)
+
 };
 
 
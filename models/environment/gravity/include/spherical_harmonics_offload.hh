@@ -0,0 +1,256 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_offload.hh
+ * Define the SphericalHarmonicsOffload class, which evaluates the
+ * non-spherical field of a batch of points on an accelerator.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Gottlieb, R. G.)
+    (Fast Gravity, Gravity Partials, Normalized Gravity, Gravity Gradient
+     Torque and Magnetic Field: Derivation, Code and Data)
+    (NASA CR-188243) (February 1993)))
+
+Assumptions and limitations:
+  ((The kernel computes acceleration and potential only.)
+   (The coefficient and recursion tables are copied to the device on first
+    use and when the source or degree changes; call invalidate after
+    changing the coefficients of a source in place.)
+   (Each point accumulates its terms in the same order as the lane-wise
+    kernel, so results agree with it to within the rounding of contracted
+    multiply-adds and the device's math library.))
+
+Library dependencies:
+  ((../src/spherical_harmonics_offload.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPHERICAL_HARMONICS_OFFLOAD_HH
+#define JEOD_SPHERICAL_HARMONICS_OFFLOAD_HH
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/offload/include/offload_buffer.hh"
+#include "utils/offload/include/offload_device.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Evaluates the non-spherical field of a SphericalHarmonicsGravitySource at
+ * every point of a batch in one offloaded kernel, one point per device
+ * thread. Attach one to SphericalHarmonicsGravityControls::offload to have
+ * batches of at least min_batch_size points evaluated on the device; smaller
+ * batches, and every batch when no device is present, stay on the
+ * lane-wise host kernel.
+ *
+ * The coefficients and Gottlieb recursion constants stay resident on the
+ * device between calls. Each call copies only the positions in and the
+ * accelerations and potentials out, through a page-locked staging buffer.
+ */
+class SphericalHarmonicsOffload {
+
+ JEOD_MAKE_SIM_INTERFACES(SphericalHarmonicsOffload)
+
+ // Member data
+
+ public:
+
+   /**
+    * Smallest batch evaluated on the device. Below this the transfer and
+    * launch overhead exceeds the host evaluation time.
+    */
+   unsigned int min_batch_size; //!< trick_units(--)
+
+   /**
+    * Run the kernel on the host when no device is present, rather than
+    * leaving the batch to the lane-wise kernel. Intended for verifying the
+    * kernel on machines without an accelerator.
+    */
+   bool allow_host_execution; //!< trick_units(--)
+
+   /**
+    * The device that the kernel runs on.
+    */
+   OffloadDevice device; //!< trick_units(--)
+
+
+ private:
+
+   /**
+    * Staging buffer: the positions, then the accelerations, each one array
+    * of npoints per axis, then the potentials.
+    */
+   OffloadBuffer staging; //!< trick_io(**)
+
+   /**
+    * Number of points in the current batch.
+    */
+   unsigned int npoints; //!< trick_io(**)
+
+   /**
+    * Source whose tables are on the device.
+    */
+   const SphericalHarmonicsGravitySource * table_source; //!< trick_io(**)
+
+   /**
+    * Packed coefficient block copied to the device.
+    */
+   const void * table_terms; //!< trick_io(**)
+
+   /**
+    * Degree through which the tables are on the device.
+    */
+   unsigned int table_degree; //!< trick_io(**)
+
+   /**
+    * Device copy of the source's packed coefficient block.
+    */
+   void * dev_terms; //!< trick_io(**)
+
+   /**
+    * Device copy of the source's alpha, beta, nrdiag and int_to_double
+    * tables and of the diagonal Legendre terms P(n,n), each table_degree+2
+    * elements.
+    */
+   double * dev_recursion; //!< trick_io(**)
+
+   /**
+    * Device copy of the staging buffer.
+    */
+   double * dev_io; //!< trick_io(**)
+
+   /**
+    * Number of points dev_io holds.
+    */
+   std::size_t dev_io_points; //!< trick_io(**)
+
+   /**
+    * Per-point recursion arrays on the device.
+    */
+   double * dev_work; //!< trick_io(**)
+
+   /**
+    * Number of doubles in dev_work.
+    */
+   std::size_t dev_work_size; //!< trick_io(**)
+
+
+ public:
+
+   // Default constructor
+   SphericalHarmonicsOffload ();
+
+   // Destructor
+   ~SphericalHarmonicsOffload ();
+
+   // Should a batch of the given size be evaluated by this object?
+   bool use_for (              // Return: --  True to offload the batch
+      unsigned int num_points) const; // In: -- Batch size
+
+   // Size the staging buffer for a batch and get its position arrays.
+   double * stage_positions (  // Return: m   Positions, one array per axis
+      unsigned int num_points); // In:    --  Batch size
+
+   // Evaluate the non-spherical field at the staged positions.
+   void evaluate (             // Return: --  Void
+      const SphericalHarmonicsGravitySource & source, // In: -- Source
+      const double T_pfix[3][3],    // In:     --  Inertial to planet-fixed
+      unsigned int eval_degree,     // In:     --  Degree to be used
+      unsigned int eval_order,      // In:     --  Order to be used
+      double local_C20);            // In:     --  C20 coefficient
+
+   // Get the accelerations computed by the last evaluation.
+   const double * get_accelerations ( // Return: m/s2 One array per axis
+      void) const;
+
+   // Get the potentials computed by the last evaluation.
+   const double * get_potentials (    // Return: --  Potentials
+      void) const;
+
+   // Discard the device tables; they are copied again on the next call.
+   void invalidate (void);
+
+   // Free all device and staging memory.
+   void release (void);
+
+
+ private:
+
+   // Copy the source's tables to the device.
+   void upload_tables (        // Return: --  Void
+      const SphericalHarmonicsGravitySource & source, // In: -- Source
+      unsigned int degree);    // In:     --  Degree needed
+
+   // Not implemented.
+   SphericalHarmonicsOffload (const SphericalHarmonicsOffload &);
+   SphericalHarmonicsOffload & operator= (const SphericalHarmonicsOffload &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
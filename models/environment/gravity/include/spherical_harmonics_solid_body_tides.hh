@@ -57,7 +57,10 @@ References:
   (((none)))
 
 Assumptions and limitations:
-  ((none))
+  ((A non-zero update interval assumes the tidal forcing varies slowly
+    enough to be extrapolated linearly over one interval.)
+   (A non-zero update interval relies on the planet-fixed and tidal body
+    frames being timestamped by the dynamics manager.))
 
 Library dependencies:
   ((../src/spherical_harmonics_solid_body_tides.cc))
@@ -88,6 +91,16 @@ class BaseDynManager;
 
 /**
  * Models solid body tidal effects.
+ *
+ * By default the tide-raising body positions are evaluated on every update.
+ * Solid body tides vary on time scales of hours while the integration step
+ * is typically seconds, so a positive update_interval instead evaluates the
+ * tide only when the input time is at least that far from the most recent
+ * evaluation. In between, the delta coefficient is extrapolated along the
+ * line through the two most recent evaluations.
+ *
+ * Sharing a single evaluation per dynamic time across all of a planet's
+ * gravity controls is handled separately, by the source's delta_cache.
  */
 class SphericalHarmonicsSolidBodyTides : public SphericalHarmonicsTidalEffects {
 
@@ -97,7 +110,28 @@ class SphericalHarmonicsSolidBodyTides : public SphericalHarmonicsTidalEffects {
  // Member data
  public:
 
- // No unique to solid-body tides member data
+   /**
+    * Minimum time between evaluations of the tide-raising body positions.
+    * Zero (the default) evaluates the tide on every update.
+    */
+   double update_interval; //!< trick_units(s)
+
+ protected:
+
+   /**
+    * Number of valid entries in sample_time and sample_dC20 (0 to 2).
+    */
+   unsigned int num_samples; //!< trick_units(count)
+
+   /**
+    * Input times of the two most recent evaluations, oldest first.
+    */
+   double sample_time[2]; //!< trick_units(s)
+
+   /**
+    * The dC20 values computed at the times in sample_time.
+    */
+   double sample_dC20[2]; //!< trick_units(--)
 
 
  // Member functions
@@ -113,6 +147,10 @@ class SphericalHarmonicsSolidBodyTides : public SphericalHarmonicsTidalEffects {
 
    void update (SphericalHarmonicsGravityControls & controls) override;
 
+ protected:
+
+   double compute_dC20 (void);
+
 
 };
 
@@ -93,6 +93,12 @@ class SphericalHarmonicsSolidBodyTidesInit :
  // Member data
  public:
 
+   /**
+    * Minimum time between evaluations of the tide-raising body positions;
+    * see SphericalHarmonicsSolidBodyTides::update_interval.
+    */
+   double update_interval; //!< trick_units(s)
+
  // Member functions
  public:
 
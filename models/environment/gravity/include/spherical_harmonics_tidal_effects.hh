@@ -157,6 +157,8 @@ protected:
 
    void update (SphericalHarmonicsGravityControls & controls) override;
 
+   double input_time (void) const override;
+
 };
 
 
@@ -0,0 +1,117 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/gravity_batch_force_model.cc
+ * Define member functions for the GravityBatchForceModel class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((gravity_batch_force_model.cc)
+   (gravity_controls.cc)
+   (gravity_interaction.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// Model includes
+#include "../include/gravity_batch_force_model.hh"
+#include "../include/gravity_controls.hh"
+#include "../include/gravity_interaction.hh"
+#include "../include/gravity_point_batch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * GravityBatchForceModel constructor.
+ * \param[in] grav_in Gravity interaction whose controls are evaluated
+ */
+GravityBatchForceModel::GravityBatchForceModel (
+   const GravityInteraction & grav_in)
+:
+   grav(&grav_in),
+   control_accel()
+{
+   return;
+}
+
+
+/**
+ * GravityBatchForceModel destructor.
+ */
+GravityBatchForceModel::~GravityBatchForceModel ()
+{
+   return;
+}
+
+
+/**
+ * Sum the gravitation of the active controls at each node. The node times
+ * and velocities are not used.
+ * \param[in] npoints Number of nodes
+ * \param[in] times Node times (unused)
+ * \param[in] posn Node positions, integration frame, one array per axis
+ * \param[in] vel Node velocities (unused)
+ * \param[out] accel Node accelerations, one array per axis
+ */
+void
+GravityBatchForceModel::compute_accelerations (
+   unsigned int npoints,
+   const double * times JEOD_UNUSED,
+   const double * const posn[3],
+   const double * const vel[3] JEOD_UNUSED,
+   double * const accel[3])
+{
+   if (control_accel.size() < 3 * npoints) {
+      control_accel.resize (3 * npoints);
+   }
+
+   GravityPointBatch batch;
+   batch.npoints = npoints;
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      batch.posn[kk] = posn[kk];
+      batch.accel[kk] = control_accel.data() + kk * npoints;
+      for (unsigned int ii = 0; ii < npoints; ++ii) {
+         accel[kk][ii] = 0.0;
+      }
+   }
+
+   for (unsigned int ic = 0; ic < grav->grav_controls.size(); ++ic) {
+      GravityControls * controls = grav->grav_controls[ic];
+      if ((controls == nullptr) || (! controls->active)) {
+         continue;
+      }
+      controls->gravitation (grav->integ_frame_index, batch);
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         const double * control = batch.accel[kk];
+         double * total = accel[kk];
+         for (unsigned int ii = 0; ii < npoints; ++ii) {
+            total[ii] += control[ii];
+         }
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
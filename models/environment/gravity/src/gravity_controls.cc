@@ -47,6 +47,7 @@ Library dependencies:
 #include "../include/gravity_interaction.hh"
 #include "../include/gravity_manager.hh"
 #include "../include/gravity_messages.hh"
+#include "../include/gravity_point_batch.hh"
 
 
 //! Namespace jeod
@@ -70,6 +71,7 @@ GravityControls::GravityControls ()
    perturbing_only(false),
    battin_method(false),
    relativistic(false),
+   point_mass(false),
    body(nullptr),
    grav_manager(nullptr),
    subscribed_to_inertial(false),
@@ -182,7 +184,7 @@ GravityControls::reset_control (
 
    // Determine what the planet-fixed subscription should be;
    // need planet-fixed if the control is on and is non-spherical.
-   subscribe_to_pfix = active && !spherical;
+   subscribe_to_pfix = active && !spherical && !point_mass;
 
    // Make the planet-fixed subscription consistent with expectations.
    if (subscribe_to_pfix) {
@@ -223,12 +225,16 @@ GravityControls::gravitation (
    double posn[3];              // M    Vehicle inertial position wrt planet
    GravityIntegFrame & grav_source_frame = // --  Grav frame for this integ frame
                                          body->frames[integ_frame_idx];
-   const RefFrame & integ_frame = // --   Integration frame
-                                  *(grav_source_frame.ref_frame);
+
+   // Point-mass controls take the fast path.
+   if (point_mass) {
+      point_mass_gravitation (integ_pos, integ_frame_idx,
+                              body_grav_accel, dgdx, Pot[0]);
+      return;
+   }
 
    // Compute position of integ. frame origin wrt the planet center.
-   integ_frame.compute_position_from (
-      *(body->inertial), grav_source_frame.pos);
+   update_frame_offset (grav_source_frame, sharing_frame_offsets());
 
    // Compute position of the vehicle CoM wrt the planet center.
    Vector3::sum (grav_source_frame.pos, integ_pos, posn);
@@ -274,16 +280,27 @@ GravityControls::gravitation (
    double rel_pos[3];              // M    Vehicle inertial position wrt planet
    GravityIntegFrame & grav_source_frame = // --  Grav frame for this integ frame
                                          body->frames[integ_frame_idx];
-   const RefFrame & integ_frame = // --   Integration frame
-                                  *(grav_source_frame.ref_frame);
-   RefFrameState grav_source_state;
 
-   // Compute state of the planet center wrt integ. frame origin.
-   body->inertial->compute_relative_state (integ_frame, grav_source_state);
+   // Point-mass controls take the fast path unless relativity is wanted.
+   if (point_mass && !relativistic) {
+      point_mass_gravitation (point_of_interest.state.trans.position,
+                              integ_frame_idx, body_grav_accel, dgdx, pot);
+      return;
+   }
+
+   // As do spherical controls.
+   if (spherical && !relativistic) {
+      spherical_gravitation (point_of_interest, integ_frame_idx,
+                             body_grav_accel, dgdx, pot);
+      return;
+   }
+
+   // Compute state of integ. frame origin wrt the planet center.
+   update_frame_state (grav_source_frame, sharing_frame_offsets());
 
    // Compute position of the vehicle CoM wrt the planet center.
-   Vector3::diff (
-      point_of_interest.state.trans.position, grav_source_state.trans.position,
+   Vector3::sum (
+      point_of_interest.state.trans.position, grav_source_frame.pos,
       rel_pos);
 
    // Compute contributions from non-spherical gravity if requested.
@@ -307,8 +324,8 @@ GravityControls::gravitation (
    {
       double rel_vel[3];
       double relativistic_accel[3];
-      Vector3::diff (
-         point_of_interest.state.trans.velocity, grav_source_state.trans.velocity,
+      Vector3::sum (
+         point_of_interest.state.trans.velocity, grav_source_frame.vel,
          rel_vel);
       calc_relativistic (
          point_of_interest, rel_pos, rel_vel,
@@ -319,9 +336,6 @@ GravityControls::gravitation (
    // Compute spherical gravity contributions if needed.
    if (! perturbing_only && ! skip_spherical) {
 
-      // Compute state of integ. frame origin wrt the planet center.
-      Vector3::negate (grav_source_state.trans.position, grav_source_frame.pos);
-
       // Calculate spherical gravity, in the integration frame.
       calc_spherical (
          point_of_interest.state.trans.position, rel_pos, grav_source_frame,
@@ -330,6 +344,240 @@ GravityControls::gravitation (
 }
 
 
+/**
+ * Compute the gravitation toward a gravity body at each point in a batch.
+ * The position of the integration frame origin relative to the body is
+ * computed once and shared by all points in the batch.
+ * \param[in] integ_frame_idx Integ frame index
+ * \param[in,out] batch Points of interest and the resulting gravitation
+ */
+void
+GravityControls::gravitation (
+   unsigned int integ_frame_idx,
+   GravityPointBatch & batch)
+{
+   GravityIntegFrame & grav_source_frame = // --  Grav frame for this integ frame
+                                         body->frames[integ_frame_idx];
+
+   // Compute position of integ. frame origin wrt the planet center.
+   // Point-mass controls always reuse a current offset, as in
+   // point_mass_gravitation.
+   update_frame_offset (grav_source_frame,
+                        point_mass || sharing_frame_offsets());
+
+   for (unsigned int ii = 0; ii < batch.npoints; ++ii) {
+      double integ_pos[3];         // M    Point position, integ coords
+      double posn[3];              // M    Point inertial position wrt planet
+      double accel[3];             // M/s2 Accel at the point
+      double dgdx[3][3];           // 1/s2 Gradient at the point
+      double pot;                  // m2/s2 Potential at the point
+
+      integ_pos[0] = batch.posn[0][ii];
+      integ_pos[1] = batch.posn[1][ii];
+      integ_pos[2] = batch.posn[2][ii];
+
+      Vector3::sum (grav_source_frame.pos, integ_pos, posn);
+
+      if ((! spherical) && (! point_mass)) {
+         calc_nonspherical (integ_pos, posn, grav_source_frame,
+                            accel, dgdx, pot);
+      }
+      else {
+         Matrix3x3:: initialize (dgdx);
+         Vector3::initialize (accel);
+         pot = 0.0;
+      }
+
+      if (! perturbing_only && (point_mass || ! skip_spherical)) {
+         calc_spherical (
+            integ_pos, posn, grav_source_frame,
+            accel, dgdx, pot);
+      }
+
+      batch.accel[0][ii] = accel[0];
+      batch.accel[1][ii] = accel[1];
+      batch.accel[2][ii] = accel[2];
+      if (batch.pot != nullptr) {
+         batch.pot[ii] = pot;
+      }
+      if (batch.grad != nullptr) {
+         Matrix3x3::copy (dgdx, batch.grad[ii]);
+      }
+   }
+}
+
+
+/**
+ * Compute the gravitation at a given position toward a gravity body, treating
+ * the body as a point mass. The position of the integration frame origin with
+ * respect to the body is recomputed only when the timestamp of the body's
+ * inertial frame or of the integration frame has changed since it was last
+ * computed; the timestamp is kept in the GravityIntegFrame, which is shared
+ * by all controls of the body that use the same integration frame.
+ * \param[in] integ_pos Point of interest, integ coords\n Units: M
+ * \param[in] integ_frame_idx Integ frame index
+ * \param[out] body_grav_accel Accel for given grav body\n Units: M/s2
+ * \param[out] dgdx Gradient for given grav body\n Units: 1/s2
+ * \param[out] pot Potential\n Units: M2/s2
+ */
+void
+GravityControls::point_mass_gravitation (
+   const double integ_pos[3],
+   unsigned int integ_frame_idx,
+   double body_grav_accel[3],
+   double dgdx[3][3],
+   double& pot)
+{
+   double posn[3];              // M    Vehicle inertial position wrt planet
+   GravityIntegFrame & grav_source_frame = // --  Grav frame for this integ frame
+                                         body->frames[integ_frame_idx];
+
+   // Update the position of integ. frame origin wrt the planet center
+   // only if either frame has moved.
+   update_frame_offset (grav_source_frame, true);
+
+   // Compute position of the vehicle CoM wrt the planet center.
+   Vector3::sum (grav_source_frame.pos, integ_pos, posn);
+
+   Matrix3x3:: initialize (dgdx);
+   Vector3::initialize (body_grav_accel);
+   pot = 0.0;
+
+   if (! perturbing_only) {
+      calc_spherical (
+         integ_pos, posn, grav_source_frame,
+         body_grav_accel, dgdx, pot);
+   }
+}
+
+
+/**
+ * Compute the gravitational acceleration, gradient, and potential due to
+ * the body, ignoring its non-spherical field. Used for spherical controls
+ * without the relativistic correction.
+ * \param[in] point_of_interest Point of interest, as a frame
+ * \param[in] integ_frame_idx Integ frame index
+ * \param[out] body_grav_accel Accel for given grav body\n Units: M/s2
+ * \param[out] dgdx Gradient for given grav body\n Units: 1/s2
+ * \param[out] pot Potential\n Units: M2/s2
+ */
+void
+GravityControls::spherical_gravitation (
+   const RefFrame& point_of_interest,
+   unsigned int integ_frame_idx,
+   double body_grav_accel[3],
+   double dgdx[3][3],
+   double& pot)
+{
+   double rel_pos[3];              // M    Vehicle inertial position wrt planet
+   GravityIntegFrame & grav_source_frame = // --  Grav frame for this integ frame
+                                         body->frames[integ_frame_idx];
+
+   // Compute state of integ. frame origin wrt the planet center.
+   update_frame_state (grav_source_frame, sharing_frame_offsets());
+
+   // Compute position of the vehicle CoM wrt the planet center.
+   Vector3::sum (
+      point_of_interest.state.trans.position, grav_source_frame.pos,
+      rel_pos);
+
+   Matrix3x3:: initialize (dgdx);
+   Vector3::initialize (body_grav_accel);
+   pot = 0.0;
+
+   if (! perturbing_only && ! skip_spherical) {
+      calc_spherical (
+         point_of_interest.state.trans.position, rel_pos, grav_source_frame,
+         body_grav_accel, dgdx, pot);
+   }
+}
+
+
+/**
+ * Identify the settings that affect the result of a batchable control.
+ * Batchable controls of the same source, evaluated in the same integration
+ * frame, with equal signatures produce identical results at a given point.
+ * @return Settings signature
+ */
+unsigned int
+GravityControls::batch_signature (
+   void) const
+{
+   return (point_mass ? 1U : 0U) |
+          (perturbing_only ? 2U : 0U) |
+          (battin_method ? 4U : 0U) |
+          (gradient ? 8U : 0U) |
+          ((skip_spherical && ! point_mass) ? 16U : 0U);
+}
+
+
+/**
+ * Should the integration frame offsets be shared with other controls?
+ * @return True if the gravity manager shares frame offsets.
+ */
+bool
+GravityControls::sharing_frame_offsets (
+   void) const
+{
+   return (grav_manager != nullptr) && grav_manager->share_frame_offsets;
+}
+
+
+/**
+ * Update the position of the integration frame origin with respect to the
+ * gravity body. A shared offset is recomputed only if the timestamp of the
+ * body's inertial frame or of the integration frame has changed since it
+ * was last computed.
+ * \param[in,out] grav_source_frame Grav frame for the integ frame
+ * \param[in] shared Reuse an offset computed at the same time?
+ */
+void
+GravityControls::update_frame_offset (
+   GravityIntegFrame & grav_source_frame,
+   bool shared)
+{
+   const RefFrame & integ_frame = *(grav_source_frame.ref_frame);
+   double frame_time = std::max (body->inertial->timestamp(),
+                                 integ_frame.timestamp());
+
+   if (!shared || (frame_time != grav_source_frame.time)) {
+      integ_frame.compute_position_from (
+         *(body->inertial), grav_source_frame.pos);
+      grav_source_frame.time = frame_time;
+   }
+}
+
+
+/**
+ * Update the position and velocity of the integration frame origin with
+ * respect to the gravity body, with the same reuse rule as
+ * update_frame_offset.
+ * \param[in,out] grav_source_frame Grav frame for the integ frame
+ * \param[in] shared Reuse a state computed at the same time?
+ */
+void
+GravityControls::update_frame_state (
+   GravityIntegFrame & grav_source_frame,
+   bool shared)
+{
+   const RefFrame & integ_frame = *(grav_source_frame.ref_frame);
+   double frame_time = std::max (body->inertial->timestamp(),
+                                 integ_frame.timestamp());
+
+   if (!shared || (frame_time != grav_source_frame.vel_time)) {
+      RefFrameState grav_source_state;
+
+      // Compute state of the planet center wrt integ. frame origin.
+      body->inertial->compute_relative_state (integ_frame, grav_source_state);
+
+      Vector3::negate (grav_source_state.trans.position, grav_source_frame.pos);
+      Vector3::negate (grav_source_state.trans.velocity, grav_source_frame.vel);
+      grav_source_frame.time = frame_time;
+      grav_source_frame.vel_time = frame_time;
+   }
+}
+
+
 void
 GravityControls::calc_spherical (
    const double integ_pos[3],
@@ -48,7 +48,9 @@ GravityIntegFrame::GravityIntegFrame (
    is_third_body = false;
    Vector3::initialize (pos);
    Vector3::initialize (accel);
+   Vector3::initialize (vel);
    time = 9e99;
+   vel_time = 9e99;
 }
 
 
@@ -32,6 +32,7 @@ Library dependencies:
 // System includes
 #include <cstddef>
 #include <algorithm>
+#include <utility>
 
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
@@ -54,6 +55,38 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+// Dispatch key bits.
+const unsigned int key_active       = 0x01;
+const unsigned int key_point_mass   = 0x02;
+const unsigned int key_spherical    = 0x04;
+const unsigned int key_relativistic = 0x08;
+const unsigned int key_batchable    = 0x10;
+
+
+/**
+ * Collect the settings of a control that determine its dispatch.
+ * @return Dispatch key
+ * \param[in] control Gravity control
+ */
+unsigned int
+dispatch_key (
+   const GravityControls & control)
+{
+   if (! control.active) {
+      return 0;
+   }
+   return key_active |
+          (control.point_mass   ? key_point_mass   : 0) |
+          (control.spherical    ? key_spherical    : 0) |
+          (control.relativistic ? key_relativistic : 0) |
+          (control.batchable()  ? key_batchable    : 0);
+}
+
+} // End anonymous namespace
+
+
 /**
  * Construct a GravityInteraction instance.
  */
@@ -134,7 +167,7 @@ void
 GravityInteraction::remove_control (
    GravityControls* control)
 {
-   std::vector<GravityControls*>::iterator iter =
+   auto iter =
       std::find (grav_controls.begin(), grav_controls.end(), control);
    if (iter == grav_controls.end()) {
       MessageHandler::warn (
@@ -214,6 +247,65 @@ GravityInteraction::sort_controls (
    return;
 }
 
+
+/**
+ * Rebuild the dispatch table if any control has been added, removed,
+ * reordered, activated or deactivated, or has had a setting changed that
+ * affects how it is evaluated since the table was last built. Checking is
+ * a pass over the controls' flags; the table itself is rebuilt only on a
+ * change.
+ */
+void
+GravityInteraction::update_dispatch (
+   void)
+{
+   unsigned int n_controls = grav_controls.size();
+   bool changed = (dispatch_keys.size() != n_controls);
+
+   for (unsigned int ii = 0; (! changed) && (ii < n_controls); ++ii) {
+      const GravityControls * control = grav_controls[ii];
+      changed = (dispatch_keys[ii].first != control) ||
+                (dispatch_keys[ii].second != dispatch_key (*control));
+   }
+   if (! changed) {
+      return;
+   }
+
+   dispatch_keys.resize (n_controls);
+   dispatch_entries.clear ();
+   for (unsigned int kk = 0; kk < NumDispatchKinds; ++kk) {
+      dispatch_groups[kk].clear ();
+   }
+
+   for (unsigned int ii = 0; ii < n_controls; ++ii) {
+      GravityControls * control = grav_controls[ii];
+      unsigned int key = dispatch_key (*control);
+      dispatch_keys[ii] = std::make_pair (control, key);
+      if ((key & key_active) == 0) {
+         continue;
+      }
+
+      DispatchEntry entry;
+      entry.control = control;
+      entry.batchable = ((key & key_batchable) != 0);
+      if ((key & key_relativistic) != 0) {
+         entry.kind = GeneralDispatch;
+      }
+      else if ((key & key_point_mass) != 0) {
+         entry.kind = PointMassDispatch;
+      }
+      else if ((key & key_spherical) != 0) {
+         entry.kind = SphericalDispatch;
+      }
+      else {
+         entry.kind = GeneralDispatch;
+      }
+
+      dispatch_groups[entry.kind].push_back (dispatch_entries.size());
+      dispatch_entries.push_back (entry);
+   }
+}
+
 } // End JEOD namespace
 
 /**
@@ -19,8 +19,10 @@ Library dependencies:
   ((gravity_manager.cc)
    (gravity_source.cc)
    (gravity_controls.cc)
+   (gravity_interaction.cc)
    (gravity_messages.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 *******************************************************************************/
@@ -29,6 +31,7 @@ Library dependencies:
 #include <string>
 #include <cstring>
 #include <cstddef>
+#include <vector>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/base_dyn_manager.hh"
@@ -36,6 +39,8 @@ Library dependencies:
 #include "utils/math/include/vector3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 
 // Model includes
@@ -43,6 +48,7 @@ Library dependencies:
 #include "../include/gravity_controls.hh"
 #include "../include/gravity_interaction.hh"
 #include "../include/gravity_messages.hh"
+#include "../include/gravity_point_batch.hh"
 #include "../include/gravity_source.hh"
 
 
@@ -58,6 +64,8 @@ JEOD_DECLARE_ATTRIBUTES (GravitySource)
  */
 GravityManager::GravityManager (
    void)
+:
+   share_frame_offsets(false)
 {
    JEOD_REGISTER_CLASS (GravityManager);
    JEOD_REGISTER_INCOMPLETE_CLASS (GravitySource);
@@ -178,6 +186,7 @@ void
 GravityManager::initialize_state (
    const BaseDynManager & manager)
 {
+   JEOD_PROFILE_SCOPE ("gravity", "GravityManager::initialize_state");
 
    // Pass the initialize_state method to each gravitational body in the model.
    for (unsigned int ii = 0; ii < sources.size(); ++ii) {
@@ -213,7 +222,17 @@ GravityManager::gravitation (
       total gravitational acceleration. */
    for (unsigned int ii = 0; ii < n_controls; ++ii) {
       GravityControls & control_ii = *(grav.grav_controls[ii]);
-      if (control_ii.active) {
+      if (control_ii.active && control_ii.point_mass) {
+         control_ii.point_mass_gravitation (integ_pos,
+                                            integ_idx,
+                                            control_ii.grav_accel,
+                                            control_ii.grav_grad,
+                                            control_ii.grav_pot);
+         Vector3::incr (control_ii.grav_accel, total_grav_accel);
+         Matrix3x3::incr (control_ii.grav_grad, total_grav_grad);
+         total_grav_pot[0] += control_ii.grav_pot;
+      }
+      else if (control_ii.active) {
          control_ii.gravitation (integ_pos,
                                  integ_idx,
                                  control_ii.grav_accel,
@@ -248,27 +267,56 @@ GravityManager::gravitation (
 
    double total_grav_pot = 0.0;  // -- Total gravitational potential
 
-   unsigned int n_controls =     // --   Number of controls for the dyn body
-                             grav.grav_controls.size();
    unsigned int integ_idx =      // --   Vehicle integration frame index
                             grav.integ_frame_index;
 
+   // Bring the dispatch table up to date with the controls.
+   grav.update_dispatch ();
+   const std::vector<GravityInteraction::DispatchEntry> & entries =
+      grav.get_dispatch_entries();
+   const std::vector<unsigned int> & point_mass_group =
+      grav.get_dispatch_group (GravityInteraction::PointMassDispatch);
+   const std::vector<unsigned int> & spherical_group =
+      grav.get_dispatch_group (GravityInteraction::SphericalDispatch);
+   const std::vector<unsigned int> & general_group =
+      grav.get_dispatch_group (GravityInteraction::GeneralDispatch);
+
+
+   /* Compute the gravitational acceleration from each active control, one
+      kind at a time: point-mass and spherical controls directly, others
+      through the virtual gravitation method. */
+   for (unsigned int ii = 0; ii < point_mass_group.size(); ++ii) {
+      GravityControls & control_ii = *(entries[point_mass_group[ii]].control);
+      control_ii.point_mass_gravitation (point.state.trans.position,
+                                         integ_idx,
+                                         control_ii.grav_accel,
+                                         control_ii.grav_grad,
+                                         control_ii.grav_pot);
+   }
+   for (unsigned int ii = 0; ii < spherical_group.size(); ++ii) {
+      GravityControls & control_ii = *(entries[spherical_group[ii]].control);
+      control_ii.spherical_gravitation (point,
+                                        integ_idx,
+                                        control_ii.grav_accel,
+                                        control_ii.grav_grad,
+                                        control_ii.grav_pot);
+   }
+   for (unsigned int ii = 0; ii < general_group.size(); ++ii) {
+      GravityControls & control_ii = *(entries[general_group[ii]].control);
+      control_ii.gravitation (point,
+                              integ_idx,
+                              control_ii.grav_accel,
+                              control_ii.grav_grad,
+                              control_ii.grav_pot);
+   }
 
-   /* Compute the gravitational acceleration from each gravitational body
-      for which the vehicle has a control on the body and accumulate the
-      total gravitational acceleration, gradient, and potential. */
-   for (unsigned int ii = 0; ii < n_controls; ++ii) {
-      GravityControls & control_ii = *(grav.grav_controls[ii]);
-      if (control_ii.active) {
-         control_ii.gravitation (point,
-                                 integ_idx,
-                                 control_ii.grav_accel,
-                                 control_ii.grav_grad,
-                                 control_ii.grav_pot);
-         Vector3::incr (control_ii.grav_accel, total_grav_accel);
-         Matrix3x3::incr (control_ii.grav_grad, total_grav_grad);
-         total_grav_pot += control_ii.grav_pot;
-      }
+   /* Accumulate the totals in control order so that they do not depend on
+      the grouping. */
+   for (unsigned int ii = 0; ii < entries.size(); ++ii) {
+      const GravityControls & control_ii = *(entries[ii].control);
+      Vector3::incr (control_ii.grav_accel, total_grav_accel);
+      Matrix3x3::incr (control_ii.grav_grad, total_grav_grad);
+      total_grav_pot += control_ii.grav_pot;
    }
 
    // Save the total acceleration, gradient in the gravity interaction instance.
@@ -277,6 +325,43 @@ GravityManager::gravitation (
    grav.grav_pot = total_grav_pot;
 }
 
+
+// Compute gravitational attraction of one gravitational body at a batch of
+// points.
+void
+GravityManager::gravitation (
+   GravityControls & controls,
+   unsigned int integ_frame_idx,
+   GravityPointBatch & batch)
+{
+   if (controls.body == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::invalid_object,
+         "Gravity controls for '%s' have not been initialized.",
+         controls.source_name.c_str());
+      return;
+   }
+
+   if (controls.active) {
+      controls.gravitation (integ_frame_idx, batch);
+   }
+
+   // Inactive control: No gravitation at any point.
+   else {
+      for (unsigned int ii = 0; ii < batch.npoints; ++ii) {
+         batch.accel[0][ii] = 0.0;
+         batch.accel[1][ii] = 0.0;
+         batch.accel[2][ii] = 0.0;
+         if (batch.pot != nullptr) {
+            batch.pot[ii] = 0.0;
+         }
+         if (batch.grad != nullptr) {
+            Matrix3x3::initialize (batch.grad[ii]);
+         }
+      }
+   }
+}
+
 } // End JEOD namespace
 
 /**
@@ -51,6 +51,9 @@ char const * GravityMessages::invalid_limit   = PATH "invalid_limit";
 char const * GravityMessages::domain_error    = PATH "domain_error";
 char const * GravityMessages::null_pointer    = PATH "null_pointer";
 
+char const * GravityMessages::interpolation_error = PATH "interpolation_error";
+char const * GravityMessages::file_error      = PATH "file_error";
+
 } // End JEOD namespace
 
 /**
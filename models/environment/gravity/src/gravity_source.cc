@@ -117,7 +117,9 @@ GravitySource::initialize_state (
       // Initialize the frame data (position, acceleration, and bogus time).
       Vector3::initialize (frames[ii].pos);
       Vector3::initialize (frames[ii].accel);
+      Vector3::initialize (frames[ii].vel);
       frames[ii].time = 9e99;
+      frames[ii].vel_time = 9e99;
    }
 
    return;
@@ -28,6 +28,7 @@ Library dependencies:
 
 
 // System includes
+#include <algorithm>
 #include <cmath>
 
 // JEOD includes
@@ -44,68 +45,144 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+typedef SphericalHarmonicsGravitySource::PackedTerm PackedTerm;
+
 /**
- * Compute the gravitational acceleration at a given position toward a
- * gravitational body assuming the body has a non-spherical mass distribution.
- * \param[in] posn Point of interest, inrtl coords\n Units: M
- * \param[out] body_grav_accel Accel for given grav body\n Units: M/s2
- * \param[out] dgdx Gradient for given grav body\n Units: 1/s2
- * \param[out] Pot Potential
+ * The degree-n partial sums of Gottlieb's algorithm (pages 43-46 of
+ * Gottlieb's 1993 paper). The _grad sums and the sums l through t are used
+ * only when computing the gravity gradient.
  */
-void
-SphericalHarmonicsGravityControls::calc_nonspherical (
-        const double integ_pos[3] __attribute__ ((unused)),
-        const double posn[3],
-        const GravityIntegFrame& grav_source_frame __attribute__ ((unused)),
-        double body_grav_accel[3],
-        double dgdx[3][3],
-        double&  pot)
-{
+struct DegreeSums {
+   double Sumv_N;
+   double Sumh_N;
+   double Sumgam_N;
+   double Sumj_N;
+   double Sumk_N;
+   double Sumh_grad_N;
+   double Sumgam_grad_N;
+   double Suml_N;
+   double Summ_N;
+   double Sumn_N;
+   double Sumo_N;
+   double Sump_N;
+   double Sumq_N;
+   double Sumr_N;
+   double Sums_N;
+   double Sumt_N;
+};
 
-   // Compute position vector magnitude (distance to the attractor)
-   double r_mag = Vector3::vmag (posn);
 
-   // Check if radial distance is less than equatorial radius
-   if ((r_mag < harmonics_source->radius) && !min_radius_warn) {
-      min_radius_warn = true;
-      MessageHandler::warn (
-         __FILE__, __LINE__, GravityMessages::domain_error,
-         "Radial distance %g is less than the equatorial radius %g of %s.",
-         r_mag, harmonics_source->radius, harmonics_source->name.c_str() );
+/**
+ * Accumulate the (n,m) term, m > 0, into the degree-n partial sums.
+ * The template parameters let the compiler drop the potential sum and the
+ * gradient sums for the kernels that do not need them, so the inner loop
+ * carries no run-time tests of the gradient degree and order.
+ * @tparam Potential  Accumulate the potential sum?
+ * @tparam GradTerm   Accumulate the gradient sums for this term?
+ */
+template <bool Potential, bool GradTerm>
+inline void
+accumulate_order_term (
+   unsigned int ii,
+   unsigned int jj,
+   const PackedTerm & T_iijj,
+   const double * P_ii,
+   const double * C_tilde,
+   const double * S_tilde,
+   const double * int_to_double,
+   double dbl_iip1,
+   DegreeSums & ds)
+{
+   double dbl_jj   = int_to_double[jj];
+   double C_iijj   = T_iijj.Cnm;
+   double S_iijj   = T_iijj.Snm;
+
+   double jj_x_Piijj  = dbl_jj * P_ii[jj];
+   double B_tilde = C_iijj * C_tilde[jj] + S_iijj * S_tilde[jj];
+
+   // equation (3-9)
+   double B_tilde_m1 = C_iijj * C_tilde[jj-1] + S_iijj * S_tilde[jj-1];
+   double A_tilde_m1 = C_iijj * S_tilde[jj-1] - S_iijj * C_tilde[jj-1];
+   double Piijj_x_Btilde = P_ii[jj] * B_tilde;
+   if (Potential) {
+      ds.Sumv_N = ds.Sumv_N + Piijj_x_Btilde;
    }
 
+   if (jj < ii) {
+      double zetaiijj_x_Piijjp1 = T_iijj.zeta * P_ii[jj+1];
+      ds.Sumh_N  = ds.Sumh_N + zetaiijj_x_Piijjp1 * B_tilde;
+      if (GradTerm) {
+         ds.Sumh_grad_N = ds.Sumh_grad_N + zetaiijj_x_Piijjp1 * B_tilde;
+         ds.Sump_N      = ds.Sump_N + (dbl_jj + dbl_iip1) * zetaiijj_x_Piijjp1 * B_tilde;
+         ds.Sumq_N      = ds.Sumq_N + dbl_jj * zetaiijj_x_Piijjp1 * B_tilde_m1;
+         ds.Sumr_N      = ds.Sumr_N - dbl_jj * zetaiijj_x_Piijjp1 * A_tilde_m1;
+      }
+   }
 
-   // Store Cnm[2][...] array locally to avoid data writes to gravity body
-   double local_Cnm[3];
-   local_Cnm[0] = harmonics_source->Cnm[2][0];
-   local_Cnm[1] = harmonics_source->Cnm[2][1];
-   local_Cnm[2] = harmonics_source->Cnm[2][2];
-
-   // Compute acceleration due to non-spherical gravity
-   // (from code on pages 43-46 of Gottlieb's 1993 paper)
-
-   // Compute gravity coefficients changes from variational effects
-   double temp_C20;
-   unsigned int n_deltacoeffs = var_effects.size();
-
-   if (n_deltacoeffs > 0) {
-      // Sum up the gravity coefficients changes in this body's "delta-bin"
-      update_deltacoeffs ();
-      sum_deltacoeffs ();
-
-      temp_C20 = local_Cnm[0];
-      local_Cnm[0] += total_dC20;
-
-      // Correct permanent tide if already included in C20 coefficient
-      if (!harmonics_source->tide_free) {
-         local_Cnm[0] += harmonics_source->tide_free_delta;
+   ds.Sumj_N   = ds.Sumj_N + jj_x_Piijj * B_tilde_m1;
+   ds.Sumk_N   = ds.Sumk_N - jj_x_Piijj * A_tilde_m1;
+   ds.Sumgam_N = ds.Sumgam_N + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
+
+   if (GradTerm) {
+      double dbl_jjp1 = int_to_double[jj+1];
+      double dbl_jjm1 = int_to_double[jj-1];
+
+      ds.Sumgam_grad_N = ds.Sumgam_grad_N + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
+      ds.Suml_N        = ds.Suml_N + (dbl_jj + dbl_iip1) * (dbl_jjp1 + dbl_iip1) * Piijj_x_Btilde;
+      ds.Summ_N        = ds.Summ_N + P_ii[jj+2] * B_tilde * T_iijj.upsilon;
+      ds.Sums_N        = ds.Sums_N + (dbl_jj + dbl_iip1) * jj_x_Piijj * B_tilde_m1;
+      ds.Sumt_N        = ds.Sumt_N - (dbl_jj + dbl_iip1) * jj_x_Piijj * A_tilde_m1;
+
+      if (jj >= 2) {
+         ds.Sumn_N = ds.Sumn_N + dbl_jjm1 * jj_x_Piijj *
+                     (C_iijj * C_tilde[jj-2] + S_iijj * S_tilde[jj-2]);
+         ds.Sumo_N = ds.Sumo_N + dbl_jjm1 * jj_x_Piijj *
+                     (C_iijj * S_tilde[jj-2] - S_iijj * C_tilde[jj-2]);
       }
    }
+}
 
-   // Convert to planet-fixed.
-   double posn_pf[3];
-   Vector3::transform (harmonics_source->pfix->state.rot.T_parent_this, posn,
-      posn_pf);
+
+/**
+ * Gottlieb's non-spherical gravity algorithm, specialized at compile time
+ * on the quantities to be computed.
+ * @tparam Potential  Compute the potential?
+ * @tparam Gradient   Compute the gravity gradient?
+ * \param[in] src Spherical harmonics gravity source
+ * \param[in,out] Pnm Legendre polynomial work array
+ * \param[in,out] scratch Scratch arena for the order recursions
+ * \param[in] degree Degree to be used
+ * \param[in] order Order to be used
+ * \param[in] gradient_degree Degree to be used for the gradient
+ * \param[in] gradient_order Order to be used for the gradient
+ * \param[in] posn_pf Point of interest, pfix coords\n Units: M
+ * \param[in] r_mag Magnitude of posn_pf\n Units: M
+ * \param[in] local_C20 C20 coefficient, including delta-coefficient effects
+ * \param[out] body_grav_accel Accel for given grav body, pfix coords\n Units: M/s2
+ * \param[out] dgdx Gradient for given grav body, pfix coords\n Units: 1/s2
+ * \param[out] pot Potential
+ */
+template <bool Potential, bool Gradient>
+void
+nonspherical_kernel (
+   const SphericalHarmonicsGravitySource & src,
+   double ** Pnm,
+   ScratchArena & scratch,
+   unsigned int degree,
+   unsigned int order,
+   unsigned int gradient_degree,
+   unsigned int gradient_order,
+   const double posn_pf[3],
+   double r_mag,
+   double local_C20,
+   double body_grav_accel[3],
+   double dgdx[3][3],
+   double & pot)
+{
+   const PackedTerm * packed_terms = src.packed_terms;
+   const double * int_to_double = src.int_to_double;
 
    // Define terms (page 33 of Gottlieb 1993)
    double r_mag_inv = 1.0 / r_mag;
@@ -114,9 +191,9 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
    double Z_div_r = posn_pf[2] * r_mag_inv;
    double Epilson = Z_div_r;
 
-   double rad_div_r  = harmonics_source->radius * r_mag_inv;
+   double rad_div_r  = src.radius * r_mag_inv;
    double rad_div_r_nth = rad_div_r;
-   double mu_div_r  = harmonics_source->mu * r_mag_inv;
+   double mu_div_r  = src.mu * r_mag_inv;
    double mu_div_rsq = mu_div_r * r_mag_inv;
 
    // Compute magnitude of projection on the Earth equatorial plane
@@ -134,10 +211,14 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
    double cos_phi = rho * r_mag_inv;
    double cos_phi_nth = cos_phi;
 
+   // The order recursions below are carved from the control's scratch
+   // arena and released on return.
+   ScratchArena::Frame scratch_frame (scratch);
+
    // Set up first values to enable recursive calculation of normalized
    // coefficients with modification for underflow near poles
-   double cos_mlambda[degree + 1];
-   double sin_mlambda[degree + 1];
+   double * cos_mlambda = scratch.allocate (degree + 1);
+   double * sin_mlambda = scratch.allocate (degree + 1);
    cos_mlambda[0]    = 1.0;
    sin_mlambda[0]    = 0.0;
    if (rho_sq > 0.0) {
@@ -169,50 +250,12 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
    double Sums        = 0.0;
    double Sumt        = 0.0;
 
-   double Sumj_N;
-   double Sumk_N;
-   double Suml_N      = 0.0;
-   double Summ_N      = 0.0;
-   double Sumn_N      = 0.0;
-   double Sumo_N      = 0.0;
-   double Sump_N      = 0.0;
-   double Sumq_N      = 0.0;
-   double Sumr_N      = 0.0;
-   double Sums_N      = 0.0;
-   double Sumt_N      = 0.0;
-
-   double Sumh_grad_N = 0.0;
-   double Sumgam_grad_N = 0.0;
-
-   double C_tilde[degree + 1];
-   double S_tilde[degree + 1];
-
-   double Lambda      = 0.0;
-
-   double * P_ii;
-   double * C_ii;
-   double * S_ii;
-   double * zeta_ii;
-   double * xi_ii;
-
-   double C_iijj;
-   double S_iijj;
-
-   double jj_x_Piijj;
-   double B_tilde; 
-   double B_tilde_m1; 
-   double A_tilde_m1; 
-   double Piijj_x_Btilde;
-   double zetaiijj_x_Piijjp1;
+   DegreeSums ds = {};
 
-   double dbl_jj; 
-   double dbl_jjp1; 
-   double dbl_jjm1; 
-
-   bool ii_grad_deg_nonzero;
-   bool grad_order_nonzero;
-   bool jj_lt_grad_order;
+   double * C_tilde = scratch.allocate (degree + 1);
+   double * S_tilde = scratch.allocate (degree + 1);
 
+   double Lambda      = 0.0;
 
    // Initialize first 2 terms of normalized coefficients (bottom p 33)
    C_tilde[0] = 1.0;
@@ -225,28 +268,18 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
 
    for (unsigned int ii = 2; ii <= degree; ++ii) {
 
-      if (ii <= gradient_degree && gradient_degree > 0) {
-         ii_grad_deg_nonzero = true;
-      }
-      else {
-         ii_grad_deg_nonzero = false;
-      }
+      // Evaluated once per degree; the order loop below is split so that
+      // no gradient tests remain inside it.
+      bool ii_grad_deg_nonzero = Gradient && (ii <= gradient_degree);
 
-      // Protect against writes into harmonics body Cnm array
-      if (ii == 2) {
-         C_ii = &(local_Cnm[0]);
-      }
-      else {
-         C_ii = &(harmonics_source->Cnm[ii][0]);
-      }
+      // Row n of the packed coefficients and recursion constants
+      const PackedTerm * T_ii =
+         packed_terms + SphericalHarmonicsGravitySource::packed_row(ii);
 
-      P_ii = &(Pnm[ii][0]);
-      S_ii = &(harmonics_source->Snm[ii][0]);
-      xi_ii = &(harmonics_source->xi[ii][0]);
-      double * eta_ii = &(harmonics_source->eta[ii][0]);
-      zeta_ii = &(harmonics_source->zeta[ii][0]);
-      double * upsilon_ii = &(harmonics_source->upsilon[ii][0]);
+      // Protect against writes into harmonics body Cnm array
+      double C_ii0 = (ii == 2) ? local_C20 : T_ii[0].Cnm;
 
+      double * P_ii = &(Pnm[ii][0]);
       double * P_iim1 = &(Pnm[ii-1][0]);
       double * P_iim2 = &(Pnm[ii-2][0]);
 
@@ -258,53 +291,46 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
       }
 
       // P(n,0) term, equation (7-14)
-      P_ii[0] = harmonics_source->alpha[ii] * Epilson * P_iim1[0] - harmonics_source->beta[ii] * P_iim2[0];
+      P_ii[0] = src.alpha[ii] * Epilson * P_iim1[0] - src.beta[ii] * P_iim2[0];
 
       // P(n,n-1) term, equation (7-16)
-      P_ii[ii-1] = Epilson * harmonics_source->nrdiag[ii];
+      P_ii[ii-1] = Epilson * src.nrdiag[ii];
 
       // P(n,1) term, equation (7-12)
-      P_ii[1] = xi_ii[1] * Epilson * P_iim1[1] - eta_ii[1] * P_iim2[1];
+      P_ii[1] = T_ii[1].xi * Epilson * P_iim1[1] - T_ii[1].eta * P_iim2[1];
 
 
-      double dbl_iip1 = harmonics_source->int_to_double[ii+1];
+      double dbl_iip1 = int_to_double[ii+1];
 
-      double Sumv_N   = P_ii[0] * C_ii[0];
-      double Sumh_N   = P_ii[1] * C_ii[0] * zeta_ii[0];
-      double Sumgam_N = Sumv_N * dbl_iip1;
+      ds.Sumv_N   = P_ii[0] * C_ii0;
+      ds.Sumh_N   = P_ii[1] * C_ii0 * T_ii[0].zeta;
+      ds.Sumgam_N = ds.Sumv_N * dbl_iip1;
 
       for (unsigned int jj = 2; jj <= (ii - 2); ++jj) {
          // Equation (7-12)
-         P_ii[jj] = xi_ii[jj] * Epilson * P_iim1[jj] - eta_ii[jj] * P_iim2[jj];
+         P_ii[jj] = T_ii[jj].xi * Epilson * P_iim1[jj] - T_ii[jj].eta * P_iim2[jj];
       }
 
       if (ii_grad_deg_nonzero) {
-         Sumh_grad_N   = P_ii[1] * C_ii[0] * zeta_ii[0];
-         Sumgam_grad_N = Sumv_N * dbl_iip1;
-         Summ_N        = P_ii[2] * C_ii[0] * upsilon_ii[0];
-         Sump_N        = Sumh_grad_N * dbl_iip1;
-         Suml_N        = Sumgam_grad_N * (dbl_iip1 + 1.0);
+         ds.Sumh_grad_N   = P_ii[1] * C_ii0 * T_ii[0].zeta;
+         ds.Sumgam_grad_N = ds.Sumv_N * dbl_iip1;
+         ds.Summ_N        = P_ii[2] * C_ii0 * T_ii[0].upsilon;
+         ds.Sump_N        = ds.Sumh_grad_N * dbl_iip1;
+         ds.Suml_N        = ds.Sumgam_grad_N * (dbl_iip1 + 1.0);
       }
 
       if (order > 0) {
 
-         if (gradient_order > 0) {
-            grad_order_nonzero = true;
-         }
-         else {
-            grad_order_nonzero = false;
-         }
-
-         Sumj_N = 0.0;
-         Sumk_N = 0.0;
+         ds.Sumj_N = 0.0;
+         ds.Sumk_N = 0.0;
 
-         if (ii_grad_deg_nonzero && grad_order_nonzero) {
-            Sumn_N = 0.0;
-            Sumo_N = 0.0;
-            Sumq_N = 0.0;
-            Sumr_N = 0.0;
-            Sums_N = 0.0;
-            Sumt_N = 0.0;
+         if (ii_grad_deg_nonzero) {
+            ds.Sumn_N = 0.0;
+            ds.Sumo_N = 0.0;
+            ds.Sumq_N = 0.0;
+            ds.Sumr_N = 0.0;
+            ds.Sums_N = 0.0;
+            ds.Sumt_N = 0.0;
          }
 
          if (cos_phi_nth > GSL_SQRT_DBL_MIN) {
@@ -320,90 +346,53 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
          C_tilde[ii] = cos_phi_nth * cos_mlambda[ii];
          S_tilde[ii] = cos_phi_nth * sin_mlambda[ii];
 
-
-         for (unsigned int jj = 1; (jj <= order) && (jj <= ii); ++jj) {
-
-            if (jj <= gradient_order) {
-               jj_lt_grad_order = true;
-            }
-            else {
-               jj_lt_grad_order = false;
-            }
-
-            dbl_jj     = harmonics_source->int_to_double[jj];
-            dbl_jjp1   = harmonics_source->int_to_double[jj+1];
-            dbl_jjm1 = harmonics_source->int_to_double[jj-1];
-
-            C_iijj   = C_ii[jj];
-            S_iijj   = S_ii[jj];
-
-            jj_x_Piijj  = dbl_jj * P_ii[jj];
-            B_tilde = C_iijj * C_tilde[jj] + S_iijj * S_tilde[jj];
-
-            // equation (3-9)
-            B_tilde_m1 = C_iijj * C_tilde[jj-1] + S_iijj * S_tilde[jj-1];
-            A_tilde_m1 = C_iijj * S_tilde[jj-1] - S_iijj * C_tilde[jj-1];
-            Piijj_x_Btilde = P_ii[jj] * B_tilde;
-            Sumv_N = Sumv_N + Piijj_x_Btilde;
-
-            if (jj < ii) {
-               zetaiijj_x_Piijjp1 = zeta_ii[jj] * P_ii[jj+1];
-               Sumh_N  = Sumh_N + zetaiijj_x_Piijjp1 * B_tilde;
-               if (ii_grad_deg_nonzero && grad_order_nonzero && jj_lt_grad_order) {
-                  Sumh_grad_N = Sumh_grad_N + zetaiijj_x_Piijjp1 * B_tilde;
-                  Sump_N      = Sump_N + (dbl_jj + dbl_iip1) * zetaiijj_x_Piijjp1 * B_tilde;
-                  Sumq_N      = Sumq_N + dbl_jj * zetaiijj_x_Piijjp1 * B_tilde_m1;
-                  Sumr_N      = Sumr_N - dbl_jj * zetaiijj_x_Piijjp1 * A_tilde_m1;
-               }
-            }
-
-            Sumj_N   = Sumj_N + jj_x_Piijj * B_tilde_m1;
-            Sumk_N   = Sumk_N - jj_x_Piijj * A_tilde_m1;
-            Sumgam_N = Sumgam_N + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
-
-            if (ii_grad_deg_nonzero && grad_order_nonzero && jj_lt_grad_order) {
-               Sumgam_grad_N = Sumgam_grad_N + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
-               Suml_N        = Suml_N + (dbl_jj + dbl_iip1) * (dbl_jjp1 + dbl_iip1) * Piijj_x_Btilde;
-               Summ_N        = Summ_N + P_ii[jj+2] * B_tilde * upsilon_ii[jj];
-               Sums_N        = Sums_N + (dbl_jj + dbl_iip1) * jj_x_Piijj * B_tilde_m1;
-               Sumt_N        = Sumt_N - (dbl_jj + dbl_iip1) * jj_x_Piijj * A_tilde_m1;
-            }
-
-            if (jj >= 2) {
-               if (ii_grad_deg_nonzero && grad_order_nonzero && jj_lt_grad_order) {
-                  Sumn_N = Sumn_N + dbl_jjm1 * jj_x_Piijj *
-                           (C_iijj * C_tilde[jj-2] + S_iijj * S_tilde[jj-2]);
-                  Sumo_N = Sumo_N + dbl_jjm1 * jj_x_Piijj *
-                           (C_iijj * S_tilde[jj-2] - S_iijj * C_tilde[jj-2]);
-               }
+         unsigned int jj_max = (order < ii) ? order : ii;
+         unsigned int jj = 1;
+
+         // Orders that contribute to the gradient
+         if (ii_grad_deg_nonzero) {
+            unsigned int jj_grad_max =
+               (gradient_order < jj_max) ? gradient_order : jj_max;
+            for (; jj <= jj_grad_max; ++jj) {
+               accumulate_order_term<Potential, Gradient> (
+                  ii, jj, T_ii[jj], P_ii, C_tilde, S_tilde,
+                  int_to_double, dbl_iip1, ds);
             }
+         }
 
+         // Remaining orders
+         for (; jj <= jj_max; ++jj) {
+            accumulate_order_term<Potential, false> (
+               ii, jj, T_ii[jj], P_ii, C_tilde, S_tilde,
+               int_to_double, dbl_iip1, ds);
          } // next m
 
-         Sumj += rad_div_r_nth * Sumj_N;
-         Sumk += rad_div_r_nth * Sumk_N;
+         Sumj += rad_div_r_nth * ds.Sumj_N;
+         Sumk += rad_div_r_nth * ds.Sumk_N;
 
-         if (ii_grad_deg_nonzero && grad_order_nonzero) {
-            Sumn += rad_div_r_nth * Sumn_N;
-            Sumo += rad_div_r_nth * Sumo_N;
-            Sumq += rad_div_r_nth * Sumq_N;
-            Sumr += rad_div_r_nth * Sumr_N;
-            Sums += rad_div_r_nth * Sums_N;
-            Sumt += rad_div_r_nth * Sumt_N;
+         if (ii_grad_deg_nonzero) {
+            Sumn += rad_div_r_nth * ds.Sumn_N;
+            Sumo += rad_div_r_nth * ds.Sumo_N;
+            Sumq += rad_div_r_nth * ds.Sumq_N;
+            Sumr += rad_div_r_nth * ds.Sumr_N;
+            Sums += rad_div_r_nth * ds.Sums_N;
+            Sumt += rad_div_r_nth * ds.Sumt_N;
          }
 
       }  // end if order>0
 
-      Sumv   += rad_div_r_nth * Sumv_N;
-      Sumh   += rad_div_r_nth * Sumh_N;
-      Sumgam += rad_div_r_nth * Sumgam_N;
+      if (Potential) {
+         Sumv   += rad_div_r_nth * ds.Sumv_N;
+      }
+      Sumh   += rad_div_r_nth * ds.Sumh_N;
+      Sumgam += rad_div_r_nth * ds.Sumgam_N;
 
       if (ii_grad_deg_nonzero) {
-         Sumh_grad   += rad_div_r_nth * Sumh_grad_N;
-         Sumgam_grad += rad_div_r_nth * Sumgam_grad_N;
-         Suml        += rad_div_r_nth * Suml_N;
-         Summ        += rad_div_r_nth * Summ_N;
-         Sump        += rad_div_r_nth * Sump_N;
+         Sumh_grad   += rad_div_r_nth * ds.Sumh_grad_N;
+         Sumgam_grad += rad_div_r_nth * ds.Sumgam_grad_N;
+         Suml        += rad_div_r_nth * ds.Suml_N;
+         Summ        += rad_div_r_nth * ds.Summ_N;
+         Sump        += rad_div_r_nth * ds.Sump_N;
       }
 
    } // next n
@@ -416,20 +405,9 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
    body_grav_accel[1] = -mu_div_rsq * (Lambda * Y_div_r - Sumk);
    body_grav_accel[2] = -mu_div_rsq * (Lambda * Z_div_r - Sumh);
 
-   // Convert back to inertial (overwrites position vector)
-   Vector3::transform_transpose (harmonics_source->pfix->state.rot.T_parent_this,
-                                 body_grav_accel);
-
-   // Remove delta coefficient for tide effect
-   if (n_deltacoeffs > 0) {
-      local_Cnm[0] = temp_C20;
-   }
-
 
    // Compute gravity gradient
-   if (gradient && (gradient_degree > 0)) {
-
-      double dgdx_pf[3][3]; // Gravity gradient in planet-fixed coords
+   if (Gradient) {
 
       Lambda = Sumgam_grad + Epilson * Sumh_grad;
       double Gg = -(Summ * Epilson + Sump + Sumh_grad);
@@ -438,29 +416,279 @@ SphericalHarmonicsGravityControls::calc_nonspherical (
       double D2 =  Epilson * Sumr + Sumt;
 
       double mu_div_r3 = mu_div_rsq * r_mag_inv;
-      dgdx_pf[0][0] = mu_div_r3 * ((Ff * X_div_r - 2.0 * D1) * X_div_r - Lambda + Sumn);
-      dgdx_pf[1][1] = mu_div_r3 * ((Ff * Y_div_r - 2.0 * D2) * Y_div_r - Lambda - Sumn);
-      dgdx_pf[2][2] = mu_div_r3 * ((Ff * Z_div_r + 2.0 * Gg) * Z_div_r - Lambda + Summ);
-      dgdx_pf[0][1] = mu_div_r3 * ((Ff * Y_div_r - D2) * X_div_r - D1 * Y_div_r - Sumo);
-      dgdx_pf[1][0] = dgdx_pf[0][1];
-      dgdx_pf[0][2] = mu_div_r3 * ((Ff * X_div_r - D1) * Z_div_r + Gg * X_div_r + Sumq);
-      dgdx_pf[2][0] = dgdx_pf[0][2];
-      dgdx_pf[1][2] = mu_div_r3 * ((Ff * Y_div_r - D2) * Z_div_r + Gg * Y_div_r + Sumr);
-      dgdx_pf[2][1] = dgdx_pf[1][2];
-
-      // Transform dgdx_pf gradient matrix to inertial coordinates
-      // (use similarity transformation)
+      dgdx[0][0] = mu_div_r3 * ((Ff * X_div_r - 2.0 * D1) * X_div_r - Lambda + Sumn);
+      dgdx[1][1] = mu_div_r3 * ((Ff * Y_div_r - 2.0 * D2) * Y_div_r - Lambda - Sumn);
+      dgdx[2][2] = mu_div_r3 * ((Ff * Z_div_r + 2.0 * Gg) * Z_div_r - Lambda + Summ);
+      dgdx[0][1] = mu_div_r3 * ((Ff * Y_div_r - D2) * X_div_r - D1 * Y_div_r - Sumo);
+      dgdx[1][0] = dgdx[0][1];
+      dgdx[0][2] = mu_div_r3 * ((Ff * X_div_r - D1) * Z_div_r + Gg * X_div_r + Sumq);
+      dgdx[2][0] = dgdx[0][2];
+      dgdx[1][2] = mu_div_r3 * ((Ff * Y_div_r - D2) * Z_div_r + Gg * Y_div_r + Sumr);
+      dgdx[2][1] = dgdx[1][2];
+   }
+   else {
+      Matrix3x3:: initialize (dgdx);
+   }
+}
+
+}
+
+
+/**
+ * Choose the non-spherical kernel that computes exactly what this control
+ * needs. This is called whenever the degree / order settings are validated;
+ * calc_nonspherical also calls it if the gradient or compute_potential flag
+ * has been changed since the last selection.
+ */
+void
+SphericalHarmonicsGravityControls::select_kernel (
+   void)
+{
+   if (gradient && (gradient_degree > 0)) {
+      kernel_type = AccelPotentialGradient;
+   }
+   else if (compute_potential) {
+      kernel_type = AccelPotential;
+   }
+   else {
+      kernel_type = AccelOnly;
+   }
+   kernel_gradient = gradient;
+   kernel_potential = compute_potential;
+}
+
+
+/**
+ * Update effective_degree for the given distance. The degree-n terms of the
+ * series scale as (R/r)^n relative to the point-mass term, so the smallest
+ * degree n with (R/r)^n below the tolerance is selected, limited to the
+ * range 2 to degree. The degree is raised immediately but is lowered only if
+ * the tighter tolerance adaptive_tolerance * adaptive_hysteresis allows it.
+ * \param[in] r_mag Distance from the source\n Units: M
+ */
+void
+SphericalHarmonicsGravityControls::select_adaptive_degree (
+   double r_mag)
+{
+   unsigned int min_degree = std::min (degree, 2U);
+   double rad_div_r = harmonics_source->radius / r_mag;
+
+   // Inside the reference sphere the series does not decay.
+   if (rad_div_r >= 1.0) {
+      effective_degree = degree;
+      return;
+   }
+
+   double log_rad_div_r = std::log (rad_div_r);
+
+   double needed = std::ceil (std::log (adaptive_tolerance) / log_rad_div_r);
+   if (needed >= degree) {
+      effective_degree = degree;
+      return;
+   }
+   unsigned int needed_degree =
+      std::max (min_degree, static_cast<unsigned int> (needed));
+
+   if (needed_degree >= effective_degree) {
+      effective_degree = needed_degree;
+      return;
+   }
+
+   double relaxed = std::ceil (
+      std::log (adaptive_tolerance * adaptive_hysteresis) / log_rad_div_r);
+   if (relaxed < effective_degree) {
+      effective_degree =
+         std::max (min_degree, static_cast<unsigned int> (relaxed));
+   }
+}
+
+
+/**
+ * Compute the gravitational acceleration at a given position toward a
+ * gravitational body assuming the body has a non-spherical mass distribution.
+ * \param[in] posn Point of interest, inrtl coords\n Units: M
+ * \param[out] body_grav_accel Accel for given grav body\n Units: M/s2
+ * \param[out] dgdx Gradient for given grav body\n Units: 1/s2
+ * \param[out] Pot Potential
+ */
+void
+SphericalHarmonicsGravityControls::calc_nonspherical (
+        const double integ_pos[3] __attribute__ ((unused)),
+        const double posn[3],
+        const GravityIntegFrame& grav_source_frame __attribute__ ((unused)),
+        double body_grav_accel[3],
+        double dgdx[3][3],
+        double&  pot)
+{
+
+   // Compute position vector magnitude (distance to the attractor)
+   double r_mag = Vector3::vmag (posn);
+
+   // Check if radial distance is less than equatorial radius
+   if ((r_mag < harmonics_source->radius) && !min_radius_warn) {
+      min_radius_warn = true;
+      MessageHandler::warn (
+         __FILE__, __LINE__, GravityMessages::domain_error,
+         "Radial distance %g is less than the equatorial radius %g of %s.",
+         r_mag, harmonics_source->radius, harmonics_source->name.c_str() );
+   }
+
+
+   // Store C20 locally to avoid data writes to gravity body
+   double local_C20 = harmonics_source->packed_terms[
+                         SphericalHarmonicsGravitySource::packed_row(2)].Cnm;
+
+   // Compute acceleration due to non-spherical gravity
+   // (from code on pages 43-46 of Gottlieb's 1993 paper)
+
+   // Compute gravity coefficients changes from variational effects
+   unsigned int n_deltacoeffs = var_effects.size();
+
+   if (n_deltacoeffs > 0) {
+      // Sum up the gravity coefficients changes in this body's "delta-bin"
+      update_deltacoeffs ();
+      sum_deltacoeffs ();
+
+      local_C20 += total_dC20;
+
+      // Correct permanent tide if already included in C20 coefficient
+      if (!harmonics_source->tide_free) {
+         local_C20 += harmonics_source->tide_free_delta;
+      }
+   }
+
+   // The gradient and compute_potential flags are public and may have been
+   // changed directly rather than through the accessors.
+   if ((gradient != kernel_gradient) ||
+       (compute_potential != kernel_potential)) {
+      select_kernel ();
+   }
+
+   // Truncate the series for the distance if requested.
+   if (adaptive_degree) {
+      select_adaptive_degree (r_mag);
+   }
+   else {
+      effective_degree = degree;
+   }
+   unsigned int eval_degree = effective_degree;
+   unsigned int eval_order = std::min (order, eval_degree);
+   unsigned int eval_grad_degree = std::min (gradient_degree, eval_degree);
+   unsigned int eval_grad_order = std::min (gradient_order, eval_order);
+
+   // Interpolate in the grid where it is valid.
+   if (use_grid && grid.valid && (kernel_type != AccelPotentialGradient) &&
+       (n_deltacoeffs == 0) && grid.contains (r_mag)) {
+      double posn_pf[3];
+      Vector3::transform (harmonics_source->pfix->state.rot.T_parent_this,
+                          posn, posn_pf);
+      grid.interpolate (posn_pf, body_grav_accel, pot);
+      Vector3::transform_transpose (
+         harmonics_source->pfix->state.rot.T_parent_this, body_grav_accel);
+      if (!compute_potential) {
+         pot = 0.0;
+      }
+      Matrix3x3::initialize (dgdx);
+      return;
+   }
+
+   // High-degree evaluations need the extended-range kernel.
+   if ((eval_degree > extended_range_degree) &&
+       (kernel_type != AccelPotentialGradient)) {
+      calc_nonspherical_extended (posn, eval_degree, eval_order, local_C20,
+                                  body_grav_accel, pot);
+      if (!compute_potential) {
+         pot = 0.0;
+      }
+      Matrix3x3::initialize (dgdx);
+      return;
+   }
+
+   // Acceleration-only evaluations can use the order-blocked kernel.
+   if (blocked_orders && (kernel_type != AccelPotentialGradient)) {
+      calc_nonspherical_blocked (posn, eval_degree, eval_order, local_C20,
+                                 body_grav_accel, pot);
+      if (!compute_potential) {
+         pot = 0.0;
+      }
+      Matrix3x3::initialize (dgdx);
+      return;
+   }
+
+   // Convert to planet-fixed.
+   double posn_pf[3];
+   double dgdx_pf[3][3];
+   Vector3::transform (harmonics_source->pfix->state.rot.T_parent_this,
+                       posn, posn_pf);
+
+   switch (kernel_type) {
+   case AccelOnly:
+      nonspherical_kernel<false, false> (
+         *harmonics_source, Pnm, scratch, eval_degree, eval_order,
+         eval_grad_degree, eval_grad_order, posn_pf, r_mag, local_C20,
+         body_grav_accel, dgdx_pf, pot);
+      break;
+
+   case AccelPotential:
+      nonspherical_kernel<true, false> (
+         *harmonics_source, Pnm, scratch, eval_degree, eval_order,
+         eval_grad_degree, eval_grad_order, posn_pf, r_mag, local_C20,
+         body_grav_accel, dgdx_pf, pot);
+      break;
+
+   case AccelPotentialGradient:
+   default:
+      nonspherical_kernel<true, true> (
+         *harmonics_source, Pnm, scratch, eval_degree, eval_order,
+         eval_grad_degree, eval_grad_order, posn_pf, r_mag, local_C20,
+         body_grav_accel, dgdx_pf, pot);
+      break;
+   }
+
+   // Convert back to inertial
+   Vector3::transform_transpose (harmonics_source->pfix->state.rot.T_parent_this,
+                                 body_grav_accel);
+
+   // Transform dgdx_pf gradient matrix to inertial coordinates
+   // (use similarity transformation)
+   if (kernel_type == AccelPotentialGradient) {
       Matrix3x3::transpose_transform_matrix (
          harmonics_source->pfix->state.rot.T_parent_this,
          dgdx_pf, dgdx);
    }
    else {
-      Matrix3x3:: initialize (dgdx);
+      Matrix3x3::initialize (dgdx);
    }
 
    return;
 }
 
+
+/**
+ * Compute the non-spherical acceleration and potential of the static field
+ * (the gravity source coefficients, without delta-coefficient effects) at a
+ * planet-fixed position. This is the exact field tabulated by the gravity
+ * interpolation grid.
+ * \param[in] posn_pf Point of interest, pfix coords\n Units: M
+ * \param[out] accel_pf Acceleration, pfix coords\n Units: M/s2
+ * \param[out] pot Potential
+ */
+void
+SphericalHarmonicsGravityControls::calc_nonspherical_static (
+   const double posn_pf[3],
+   double accel_pf[3],
+   double & pot)
+{
+   double dgdx_pf[3][3];
+   double local_C20 = harmonics_source->packed_terms[
+                         SphericalHarmonicsGravitySource::packed_row(2)].Cnm;
+
+   nonspherical_kernel<true, false> (
+      *harmonics_source, Pnm, scratch, degree, order, gradient_degree,
+      gradient_order, posn_pf, Vector3::vmag (posn_pf), local_C20,
+      accel_pf, dgdx_pf, pot);
+}
+
 } // End JEOD namespace
 
 /**
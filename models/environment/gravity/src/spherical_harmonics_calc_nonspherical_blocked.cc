@@ -0,0 +1,279 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_calc_nonspherical_blocked.cc
+ * Define SphericalHarmonicsGravityControl calc_nonspherical_blocked method,
+ * an order-blocked variant of calc_nonspherical whose inner loop evaluates
+ * several orders m at once.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The blocked kernel computes acceleration and potential only. Controls
+    that request a gravity gradient always use the scalar kernel.)
+   (The order sums are accumulated in lane_width independent partial sums,
+    which changes the order of floating point additions relative to the
+    scalar kernel. The per-degree sums agree with the scalar kernel to within
+    a few units in the last place of the sum of the magnitudes of the summed
+    terms; the resulting accelerations agree to better than 1e-13 relative.))
+
+Library dependencies:
+  ((spherical_harmonics_calc_nonspherical_blocked.cc)
+   (spherical_harmonics_calc_nonspherical.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (environment/planet/src/planet.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cmath>
+
+// JEOD includes
+#include "environment/planet/include/planet.hh"
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/spherical_harmonics_gravity_controls.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Number of orders evaluated together in the blocked inner loop.
+ * Four doubles fill an AVX2 register and two NEON / SSE2 registers.
+ */
+const unsigned int lane_width = 4;
+
+}
+
+
+/**
+ * Compute the non-spherical acceleration and potential using an order-blocked
+ * inner loop. The order loop of calc_nonspherical is rewritten without
+ * branches (the terms that the scalar kernel skips are identically zero) and
+ * is split into blocks of lane_width consecutive orders with independent
+ * accumulators, a form that compilers map onto SIMD registers.
+ * \param[in] posn Point of interest, inrtl coords\n Units: M
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in] local_C20 C20 coefficient, including delta-coefficient effects
+ * \param[out] body_grav_accel Accel for given grav body\n Units: M/s2
+ * \param[out] pot Potential
+ */
+void
+SphericalHarmonicsGravityControls::calc_nonspherical_blocked (
+   const double posn[3],
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   double local_C20,
+   double body_grav_accel[3],
+   double&  pot)
+{
+   const SphericalHarmonicsGravitySource & src = *harmonics_source;
+   const double * int_to_double = src.int_to_double;
+
+   // Convert to planet-fixed.
+   double posn_pf[3];
+   Vector3::transform (src.pfix->state.rot.T_parent_this, posn, posn_pf);
+
+   // Define terms (page 33 of Gottlieb 1993)
+   double r_mag = Vector3::vmag (posn);
+   double r_mag_inv = 1.0 / r_mag;
+   double X_div_r = posn_pf[0] * r_mag_inv;
+   double Y_div_r = posn_pf[1] * r_mag_inv;
+   double Z_div_r = posn_pf[2] * r_mag_inv;
+   double Epilson = Z_div_r;
+
+   double rad_div_r  = src.radius * r_mag_inv;
+   double rad_div_r_nth = rad_div_r;
+   double mu_div_r  = src.mu * r_mag_inv;
+   double mu_div_rsq = mu_div_r * r_mag_inv;
+
+   // Compute magnitude of projection on the equatorial plane
+   double rho_sq = 0.0;
+   if ((posn_pf[0] < -GSL_SQRT_DBL_MIN) || (posn_pf[0] > GSL_SQRT_DBL_MIN)) {
+      rho_sq += posn_pf[0] * posn_pf[0];
+   }
+   if ((posn_pf[1] < -GSL_SQRT_DBL_MIN) || (posn_pf[1] > GSL_SQRT_DBL_MIN)) {
+      rho_sq += posn_pf[1] * posn_pf[1];
+   }
+
+   double rho = sqrt (rho_sq);
+   double cos_phi = rho * r_mag_inv;
+   double cos_phi_nth = cos_phi;
+
+   ScratchArena::Frame scratch_frame (scratch);
+   double * cos_mlambda = scratch.allocate (eval_degree + 1);
+   double * sin_mlambda = scratch.allocate (eval_degree + 1);
+   cos_mlambda[0]    = 1.0;
+   sin_mlambda[0]    = 0.0;
+   if (rho_sq > 0.0) {
+      cos_mlambda[1] = posn_pf[0] / rho;
+      sin_mlambda[1] = posn_pf[1] / rho;
+   }
+   else {
+      cos_mlambda[1] = 1.0;
+      sin_mlambda[1] = 0.0;
+   }
+
+   double * C_tilde = scratch.allocate (eval_degree + 1);
+   double * S_tilde = scratch.allocate (eval_degree + 1);
+   C_tilde[0] = 1.0;
+   C_tilde[1] = X_div_r; // equation (3-18)
+   S_tilde[0] = 0.0;
+   S_tilde[1] = Y_div_r; // equation (3-18)
+
+   Pnm[1][0] = sqrt (3.0) * Epilson;
+
+   double Sumv   = 0.0;
+   double Sumgam = 0.0;
+   double Sumh   = 0.0;
+   double Sumj   = 0.0;
+   double Sumk   = 0.0;
+
+   for (unsigned int ii = 2; ii <= eval_degree; ++ii) {
+
+      double * P_ii = Pnm[ii];
+      const double * P_iim1 = Pnm[ii-1];
+      const double * P_iim2 = Pnm[ii-2];
+      const double * C_ii = src.Cnm[ii];
+      const double * S_ii = src.Snm[ii];
+      const double * xi_ii = src.xi[ii];
+      const double * eta_ii = src.eta[ii];
+      const double * zeta_ii = src.zeta[ii];
+      double C_ii0 = (ii == 2) ? local_C20 : C_ii[0];
+
+      rad_div_r_nth = rad_div_r_nth * rad_div_r;
+      if (rad_div_r_nth < 1.0E-299) {
+         rad_div_r_nth = 0.0;
+      }
+
+      // Column-wise Legendre recursion; each order is independent.
+      P_ii[0] = src.alpha[ii] * Epilson * P_iim1[0] - src.beta[ii] * P_iim2[0];
+      P_ii[ii-1] = Epilson * src.nrdiag[ii];
+      P_ii[1] = xi_ii[1] * Epilson * P_iim1[1] - eta_ii[1] * P_iim2[1];
+      for (unsigned int jj = 2; jj <= (ii - 2); ++jj) {
+         P_ii[jj] = xi_ii[jj] * Epilson * P_iim1[jj] - eta_ii[jj] * P_iim2[jj];
+      }
+
+      double dbl_iip1 = int_to_double[ii+1];
+
+      double Sumv_N   = P_ii[0] * C_ii0;
+      double Sumh_N   = P_ii[1] * C_ii0 * zeta_ii[0];
+      double Sumgam_N = Sumv_N * dbl_iip1;
+
+      if (eval_order > 0) {
+
+         if (cos_phi_nth > GSL_SQRT_DBL_MIN) {
+            cos_phi_nth *= cos_phi;
+         }
+         else {
+            cos_phi_nth = 0.0;
+         }
+         cos_mlambda[ii] = cos_mlambda[1] * cos_mlambda[ii-1] - sin_mlambda[1] * sin_mlambda[ii-1];
+         sin_mlambda[ii] = sin_mlambda[1] * cos_mlambda[ii-1] + cos_mlambda[1] * sin_mlambda[ii-1];
+
+         // Equation (3-18), modified for underflow
+         C_tilde[ii] = cos_phi_nth * cos_mlambda[ii];
+         S_tilde[ii] = cos_phi_nth * sin_mlambda[ii];
+
+         // Partial sums, one per lane.
+         double accv[lane_width] = {0.0};
+         double acch[lane_width] = {0.0};
+         double accj[lane_width] = {0.0};
+         double acck[lane_width] = {0.0};
+         double accg[lane_width] = {0.0};
+
+         unsigned int jj_max = (eval_order < ii) ? eval_order : ii;
+         unsigned int jj = 1;
+
+         // Full blocks. zeta(n,n) and P(n,n+1) are zero, so the jj == ii
+         // Sumh term needs no special case.
+         for (; jj + lane_width - 1 <= jj_max; jj += lane_width) {
+            for (unsigned int ll = 0; ll < lane_width; ++ll) {
+               unsigned int mm = jj + ll;
+               double dbl_mm = int_to_double[mm];
+               double B_tilde = C_ii[mm] * C_tilde[mm] + S_ii[mm] * S_tilde[mm];
+               double B_tilde_m1 = C_ii[mm] * C_tilde[mm-1] + S_ii[mm] * S_tilde[mm-1];
+               double A_tilde_m1 = C_ii[mm] * S_tilde[mm-1] - S_ii[mm] * C_tilde[mm-1];
+               double P_x_B = P_ii[mm] * B_tilde;
+               double mm_x_P = dbl_mm * P_ii[mm];
+               accv[ll] += P_x_B;
+               acch[ll] += zeta_ii[mm] * P_ii[mm+1] * B_tilde;
+               accj[ll] += mm_x_P * B_tilde_m1;
+               acck[ll] -= mm_x_P * A_tilde_m1;
+               accg[ll] += (dbl_mm + dbl_iip1) * P_x_B;
+            }
+         }
+
+         // Remainder orders go into lane zero.
+         for (; jj <= jj_max; ++jj) {
+            double dbl_jj = int_to_double[jj];
+            double B_tilde = C_ii[jj] * C_tilde[jj] + S_ii[jj] * S_tilde[jj];
+            double B_tilde_m1 = C_ii[jj] * C_tilde[jj-1] + S_ii[jj] * S_tilde[jj-1];
+            double A_tilde_m1 = C_ii[jj] * S_tilde[jj-1] - S_ii[jj] * C_tilde[jj-1];
+            double P_x_B = P_ii[jj] * B_tilde;
+            double jj_x_P = dbl_jj * P_ii[jj];
+            accv[0] += P_x_B;
+            acch[0] += zeta_ii[jj] * P_ii[jj+1] * B_tilde;
+            accj[0] += jj_x_P * B_tilde_m1;
+            acck[0] -= jj_x_P * A_tilde_m1;
+            accg[0] += (dbl_jj + dbl_iip1) * P_x_B;
+         }
+
+         double Sumj_N = 0.0;
+         double Sumk_N = 0.0;
+         for (unsigned int ll = 0; ll < lane_width; ++ll) {
+            Sumv_N   += accv[ll];
+            Sumh_N   += acch[ll];
+            Sumgam_N += accg[ll];
+            Sumj_N   += accj[ll];
+            Sumk_N   += acck[ll];
+         }
+
+         Sumj += rad_div_r_nth * Sumj_N;
+         Sumk += rad_div_r_nth * Sumk_N;
+      }
+
+      Sumv   += rad_div_r_nth * Sumv_N;
+      Sumh   += rad_div_r_nth * Sumh_N;
+      Sumgam += rad_div_r_nth * Sumgam_N;
+
+   } // next n
+
+   pot = mu_div_r * Sumv; // gravitational potential
+   double Lambda = Sumgam + Epilson * Sumh;
+
+   // Equation (4-13)
+   body_grav_accel[0] = -mu_div_rsq * (Lambda * X_div_r - Sumj);
+   body_grav_accel[1] = -mu_div_rsq * (Lambda * Y_div_r - Sumk);
+   body_grav_accel[2] = -mu_div_rsq * (Lambda * Z_div_r - Sumh);
+
+   // Convert back to inertial
+   Vector3::transform_transpose (src.pfix->state.rot.T_parent_this,
+                                 body_grav_accel);
+
+   return;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
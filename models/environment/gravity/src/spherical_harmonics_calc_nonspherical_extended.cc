@@ -0,0 +1,464 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_calc_nonspherical_extended.cc
+ * Define SphericalHarmonicsGravityControl calc_nonspherical_extended method,
+ * an extended-range variant of calc_nonspherical for very high degree fields.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Fukushima, T.)
+    (Numerical computation of spherical harmonics of arbitrary degree and
+     order by extending exponent of floating point numbers)
+    (Journal of Geodesy, 86:271-285) (2012)))
+
+Assumptions and limitations:
+  ((The extended-range kernel computes acceleration and potential only.
+    Controls that request a gravity gradient always use the scalar kernel.)
+   (IEEE 754 / IEC 60559:1989 double precision floating point standard.))
+
+Library dependencies:
+  ((spherical_harmonics_calc_nonspherical_extended.cc)
+   (spherical_harmonics_calc_nonspherical.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (environment/planet/src/planet.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+
+// JEOD includes
+#include "environment/planet/include/planet.hh"
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/spherical_harmonics_gravity_controls.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+typedef SphericalHarmonicsGravitySource::PackedTerm PackedTerm;
+
+/*
+ * An extended-range number is a pair (x, ix) with value x * big^ix. The
+ * exponents are held as (exactly representable) doubles so that they can
+ * live in the control's scratch arena. Normalized mantissas lie in
+ * [big_sqrt_inv, big_sqrt), so the product of two mantissas is always a
+ * normal double.
+ */
+const double big          = std::ldexp (1.0, 960);  ///< Exponent radix
+const double big_inv      = std::ldexp (1.0, -960); ///< 1/big
+const double big_sqrt     = std::ldexp (1.0, 480);  ///< sqrt(big)
+const double big_sqrt_inv = std::ldexp (1.0, -480); ///< 1/sqrt(big)
+
+
+/**
+ * Bring an extended-range number back into the normalized range. One step
+ * suffices for the results of the recursions below, which change the
+ * magnitude by far less than sqrt(big) per step.
+ * \param[in,out] x  Mantissa
+ * \param[in,out] ix Exponent
+ */
+inline void
+normalize (
+   double & x,
+   double & ix)
+{
+   double w = std::fabs (x);
+   if (w >= big_sqrt) {
+      x *= big_inv;
+      ix += 1.0;
+   }
+   else if ((w < big_sqrt_inv) && (w > 0.0)) {
+      x *= big;
+      ix -= 1.0;
+   }
+}
+
+
+/**
+ * Compute the two-term linear combination f*x + g*y of extended-range
+ * numbers x and y. The exponents almost always agree, which makes the first
+ * branch the one taken.
+ * \param[in]  f  Coefficient of x
+ * \param[in]  g  Coefficient of y
+ * \param[in]  x  Mantissa of x
+ * \param[in]  ix Exponent of x
+ * \param[in]  y  Mantissa of y
+ * \param[in]  iy Exponent of y
+ * \param[out] z  Mantissa of the result
+ * \param[out] iz Exponent of the result
+ */
+inline void
+linear_sum (
+   double f,
+   double g,
+   double x,
+   double ix,
+   double y,
+   double iy,
+   double & z,
+   double & iz)
+{
+   double id = ix - iy;
+   if (id == 0.0) {
+      z = f * x + g * y;
+      iz = ix;
+   }
+   else if (id == 1.0) {
+      z = f * x + g * (y * big_inv);
+      iz = ix;
+   }
+   else if (id == -1.0) {
+      z = g * y + f * (x * big_inv);
+      iz = iy;
+   }
+   else if (id > 1.0) {
+      z = f * x;
+      iz = ix;
+   }
+   else {
+      z = g * y;
+      iz = iy;
+   }
+   normalize (z, iz);
+}
+
+
+/**
+ * Convert an extended-range number to a double. Values below the double
+ * range flush to zero. The scale factor is selected rather than branched
+ * on, as the exponents vary from order to order near the poles.
+ * @return Value x * big^ix
+ * \param[in] x  Mantissa
+ * \param[in] ix Exponent
+ */
+inline double
+to_double (
+   double x,
+   double ix)
+{
+   double scale = (ix < -1.0) ? 0.0 : big_inv;
+   scale = (ix == 0.0) ? 1.0 : scale;
+   scale = (ix == 1.0) ? big : scale;
+   scale = (ix > 1.0) ? HUGE_VAL : scale;
+   return x * scale;
+}
+
+}
+
+
+/**
+ * Compute the non-spherical acceleration and potential with the Legendre
+ * functions carried as extended-range numbers.
+ *
+ * The Gottlieb Legendre functions exclude the cos(latitude)^m factor, which
+ * calc_nonspherical carries in C-tilde and S-tilde. At high degree near the
+ * poles the former overflow while the latter underflow (and are cut off at
+ * GSL_SQRT_DBL_MIN). This variant runs the column recursion on
+ * extended-range numbers and forms the products P(n,m) cos(latitude)^(m-1)
+ * in extended range before converting them to doubles, so the order sums
+ * only ever see the bounded, properly scaled terms. Columns and rows that
+ * stay within the double range take the plain recursion and sums, which
+ * keeps the cost close to that of calc_nonspherical away from the poles.
+ * \param[in] posn Point of interest, inrtl coords\n Units: M
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in] local_C20 C20 coefficient, including delta-coefficient effects
+ * \param[out] body_grav_accel Accel for given grav body\n Units: M/s2
+ * \param[out] pot Potential
+ */
+void
+SphericalHarmonicsGravityControls::calc_nonspherical_extended (
+   const double posn[3],
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   double local_C20,
+   double body_grav_accel[3],
+   double&  pot)
+{
+   const SphericalHarmonicsGravitySource & src = *harmonics_source;
+   const double * int_to_double = src.int_to_double;
+
+   // Convert to planet-fixed.
+   double posn_pf[3];
+   Vector3::transform (src.pfix->state.rot.T_parent_this, posn, posn_pf);
+
+   // Define terms (page 33 of Gottlieb 1993)
+   double r_mag = Vector3::vmag (posn);
+   double r_mag_inv = 1.0 / r_mag;
+   double X_div_r = posn_pf[0] * r_mag_inv;
+   double Y_div_r = posn_pf[1] * r_mag_inv;
+   double Z_div_r = posn_pf[2] * r_mag_inv;
+   double Epilson = Z_div_r;
+
+   double rad_div_r  = src.radius * r_mag_inv;
+   double rad_div_r_nth = rad_div_r;
+   double mu_div_r  = src.mu * r_mag_inv;
+   double mu_div_rsq = mu_div_r * r_mag_inv;
+
+   // Compute magnitude of projection on the equatorial plane
+   double rho_sq = 0.0;
+   if ((posn_pf[0] < -GSL_SQRT_DBL_MIN) || (posn_pf[0] > GSL_SQRT_DBL_MIN)) {
+      rho_sq += posn_pf[0] * posn_pf[0];
+   }
+   if ((posn_pf[1] < -GSL_SQRT_DBL_MIN) || (posn_pf[1] > GSL_SQRT_DBL_MIN)) {
+      rho_sq += posn_pf[1] * posn_pf[1];
+   }
+
+   double rho = sqrt (rho_sq);
+   double cos_phi = rho * r_mag_inv;
+
+   ScratchArena::Frame scratch_frame (scratch);
+   double * cos_mlambda = scratch.allocate (eval_degree + 3);
+   double * sin_mlambda = scratch.allocate (eval_degree + 3);
+   cos_mlambda[0]    = 1.0;
+   sin_mlambda[0]    = 0.0;
+   if (rho_sq > 0.0) {
+      cos_mlambda[1] = posn_pf[0] / rho;
+      sin_mlambda[1] = posn_pf[1] / rho;
+   }
+   else {
+      cos_mlambda[1] = 1.0;
+      sin_mlambda[1] = 0.0;
+   }
+   for (unsigned int jj = 2; jj <= eval_order; ++jj) {
+      cos_mlambda[jj] = cos_mlambda[1] * cos_mlambda[jj-1] -
+                        sin_mlambda[1] * sin_mlambda[jj-1];
+      sin_mlambda[jj] = sin_mlambda[1] * cos_mlambda[jj-1] +
+                        cos_mlambda[1] * sin_mlambda[jj-1];
+   }
+
+   // Powers cos(latitude)^m in extended range, and equation (3-18) for
+   // the orders at which they are plain doubles.
+   double * cos_pow = scratch.allocate (eval_degree + 3);
+   double * cos_pow_exp = scratch.allocate (eval_degree + 3);
+   double * C_tilde = scratch.allocate (eval_degree + 3);
+   double * S_tilde = scratch.allocate (eval_degree + 3);
+   cos_pow[0] = 1.0;
+   cos_pow_exp[0] = 0.0;
+   for (unsigned int jj = 1; jj <= eval_order; ++jj) {
+      cos_pow[jj] = cos_pow[jj-1] * cos_phi;
+      cos_pow_exp[jj] = cos_pow_exp[jj-1];
+      normalize (cos_pow[jj], cos_pow_exp[jj]);
+   }
+   for (unsigned int jj = 0; jj <= eval_order; ++jj) {
+      C_tilde[jj] = cos_pow[jj] * cos_mlambda[jj];
+      S_tilde[jj] = cos_pow[jj] * sin_mlambda[jj];
+   }
+
+   // Exponents of rows n, n-1 and n-2 of the Legendre functions, whose
+   // mantissas are kept in Pnm. The diagonal seeds have zero exponents.
+   // Columns scaled_lo to scaled_hi of a row bound its nonzero exponents
+   // (the range is empty when scaled_lo > scaled_hi); columns outside the
+   // range take the plain double recursion.
+   double * P_exp_ii = scratch.allocate (eval_degree + 3);
+   double * P_exp_iim1 = scratch.allocate (eval_degree + 3);
+   double * P_exp_iim2 = scratch.allocate (eval_degree + 3);
+   for (unsigned int jj = 0; jj < eval_degree + 3; ++jj) {
+      P_exp_ii[jj] = 0.0;
+      P_exp_iim1[jj] = 0.0;
+      P_exp_iim2[jj] = 0.0;
+   }
+   unsigned int scaled_lo = eval_degree + 3;
+   unsigned int scaled_hi = 0;
+   unsigned int scaled_lo_iim1 = eval_degree + 3;
+   unsigned int scaled_hi_iim1 = 0;
+
+   Pnm[1][0] = sqrt (3.0) * Epilson;
+
+   double Sumv   = 0.0;
+   double Sumgam = 0.0;
+   double Sumh   = 0.0;
+   double Sumj   = 0.0;
+   double Sumk   = 0.0;
+
+   for (unsigned int ii = 2; ii <= eval_degree; ++ii) {
+
+      double * P_ii = Pnm[ii];
+      const double * P_iim1 = Pnm[ii-1];
+      const double * P_iim2 = Pnm[ii-2];
+      const PackedTerm * T_ii =
+         src.packed_terms + SphericalHarmonicsGravitySource::packed_row(ii);
+      double C_ii0 = (ii == 2) ? local_C20 : T_ii[0].Cnm;
+
+      // Rotate the exponent rows; row ii starts out as the former row ii-3.
+      double * P_exp_recycled = P_exp_iim2;
+      P_exp_iim2 = P_exp_iim1;
+      P_exp_iim1 = P_exp_ii;
+      P_exp_ii = P_exp_recycled;
+      P_exp_ii[ii-1] = 0.0;
+      P_exp_ii[ii] = 0.0;
+      P_exp_ii[ii+1] = 0.0;
+      P_exp_ii[ii+2] = 0.0;
+
+      // Row ii is scaled wherever either of the rows it is computed from is.
+      unsigned int scaled_lo_iim2 = scaled_lo_iim1;
+      unsigned int scaled_hi_iim2 = scaled_hi_iim1;
+      scaled_lo_iim1 = scaled_lo;
+      scaled_hi_iim1 = scaled_hi;
+      scaled_lo = std::min (scaled_lo_iim1, scaled_lo_iim2);
+      scaled_hi = std::min (std::max (scaled_hi_iim1, scaled_hi_iim2), ii - 2);
+      unsigned int plain_end = std::min (scaled_lo, ii - 1);
+
+      rad_div_r_nth = rad_div_r_nth * rad_div_r;
+      if (rad_div_r_nth < 1.0E-299) {
+         rad_div_r_nth = 0.0;
+      }
+
+      // Column-wise Legendre recursion; each order is independent.
+      // Order zero is bounded by sqrt(2n+1) but is carried in extended
+      // range for uniformity.
+      linear_sum (src.alpha[ii] * Epilson, -src.beta[ii],
+                  P_iim1[0], P_exp_iim1[0], P_iim2[0], P_exp_iim2[0],
+                  P_ii[0], P_exp_ii[0]);
+      P_ii[ii-1] = Epilson * src.nrdiag[ii];
+
+      bool overflow = false;
+      for (unsigned int jj = 1; jj < plain_end; ++jj) {
+         P_ii[jj] = T_ii[jj].xi * Epilson * P_iim1[jj] - T_ii[jj].eta * P_iim2[jj];
+         P_exp_ii[jj] = 0.0;
+         overflow |= (std::fabs (P_ii[jj]) >= big_sqrt);
+      }
+      for (unsigned int jj = scaled_lo; jj <= scaled_hi; ++jj) {
+         linear_sum (T_ii[jj].xi * Epilson, -T_ii[jj].eta,
+                     P_iim1[jj], P_exp_iim1[jj], P_iim2[jj], P_exp_iim2[jj],
+                     P_ii[jj], P_exp_ii[jj]);
+      }
+      unsigned int plain_begin = std::max (scaled_hi + 1, plain_end);
+      for (unsigned int jj = plain_begin; jj <= (ii - 2); ++jj) {
+         P_ii[jj] = T_ii[jj].xi * Epilson * P_iim1[jj] - T_ii[jj].eta * P_iim2[jj];
+         P_exp_ii[jj] = 0.0;
+         overflow |= (std::fabs (P_ii[jj]) >= big_sqrt);
+      }
+
+      // Columns that have just left the plain double range join the
+      // scaled range.
+      if (overflow) {
+         for (unsigned int jj = 1; jj <= (ii - 2); ++jj) {
+            if ((P_exp_ii[jj] == 0.0) && (std::fabs (P_ii[jj]) >= big_sqrt)) {
+               normalize (P_ii[jj], P_exp_ii[jj]);
+               scaled_lo = std::min (scaled_lo, jj);
+               scaled_hi = std::max (scaled_hi, jj);
+            }
+         }
+      }
+
+      double dbl_iip1 = int_to_double[ii+1];
+      double P_ii0 = to_double (P_ii[0], P_exp_ii[0]);
+      double P_ii1 = to_double (P_ii[1], P_exp_ii[1]);
+
+      double Sumv_N   = P_ii0 * C_ii0;
+      double Sumh_N   = P_ii1 * C_ii0 * T_ii[0].zeta;
+      double Sumgam_N = Sumv_N * dbl_iip1;
+
+      if (eval_order > 0) {
+
+         unsigned int jj_max = (eval_order < ii) ? eval_order : ii;
+
+         double Sumj_N = 0.0;
+         double Sumk_N = 0.0;
+
+         // Rows whose terms all have zero exponents take the plain double
+         // form of calc_nonspherical.
+         bool plain_row = (cos_pow_exp[jj_max] == 0.0) &&
+                          ((scaled_lo > scaled_hi) || (scaled_lo > jj_max + 1));
+
+         if (plain_row) {
+            for (unsigned int jj = 1; jj <= jj_max; ++jj) {
+               double dbl_jj = int_to_double[jj];
+               double C_iijj = T_ii[jj].Cnm;
+               double S_iijj = T_ii[jj].Snm;
+               double B_tilde = C_iijj * C_tilde[jj] + S_iijj * S_tilde[jj];
+               double B_tilde_m1 = C_iijj * C_tilde[jj-1] + S_iijj * S_tilde[jj-1];
+               double A_tilde_m1 = C_iijj * S_tilde[jj-1] - S_iijj * C_tilde[jj-1];
+
+               double P_x_B = P_ii[jj] * B_tilde;
+               double jj_x_P = dbl_jj * P_ii[jj];
+               Sumv_N   += P_x_B;
+               Sumh_N   += T_ii[jj].zeta * P_ii[jj+1] * B_tilde;
+               Sumj_N   += jj_x_P * B_tilde_m1;
+               Sumk_N   -= jj_x_P * A_tilde_m1;
+               Sumgam_N += (dbl_jj + dbl_iip1) * P_x_B;
+            }
+         }
+
+         else {
+            // P(n,m) cos(latitude)^(m-1), formed in extended range and
+            // converted to a double, for orders m and m+1. P(n,n+1) is zero.
+            double P_x_cos_jj = to_double (P_ii[1] * cos_pow[0],
+                                           P_exp_ii[1] + cos_pow_exp[0]);
+
+            for (unsigned int jj = 1; jj <= jj_max; ++jj) {
+               double dbl_jj = int_to_double[jj];
+               double P_x_cos_jjp1 = to_double (
+                  P_ii[jj+1] * cos_pow[jj], P_exp_ii[jj+1] + cos_pow_exp[jj]);
+
+               // B-tilde and A-tilde without their cos(latitude)^m factors.
+               double C_iijj = T_ii[jj].Cnm;
+               double S_iijj = T_ii[jj].Snm;
+               double B_m = C_iijj * cos_mlambda[jj] + S_iijj * sin_mlambda[jj];
+               double B_mm1 = C_iijj * cos_mlambda[jj-1] + S_iijj * sin_mlambda[jj-1];
+               double A_mm1 = C_iijj * sin_mlambda[jj-1] - S_iijj * cos_mlambda[jj-1];
+
+               double P_x_B = P_x_cos_jj * cos_phi * B_m;
+               double jj_x_P = dbl_jj * P_x_cos_jj;
+               Sumv_N   += P_x_B;
+               Sumh_N   += T_ii[jj].zeta * P_x_cos_jjp1 * B_m;
+               Sumj_N   += jj_x_P * B_mm1;
+               Sumk_N   -= jj_x_P * A_mm1;
+               Sumgam_N += (dbl_jj + dbl_iip1) * P_x_B;
+
+               P_x_cos_jj = P_x_cos_jjp1;
+            }
+         }
+
+         Sumj += rad_div_r_nth * Sumj_N;
+         Sumk += rad_div_r_nth * Sumk_N;
+      }
+
+      Sumv   += rad_div_r_nth * Sumv_N;
+      Sumh   += rad_div_r_nth * Sumh_N;
+      Sumgam += rad_div_r_nth * Sumgam_N;
+
+   } // next n
+
+   pot = mu_div_r * Sumv; // gravitational potential
+   double Lambda = Sumgam + Epilson * Sumh;
+
+   // Equation (4-13)
+   body_grav_accel[0] = -mu_div_rsq * (Lambda * X_div_r - Sumj);
+   body_grav_accel[1] = -mu_div_rsq * (Lambda * Y_div_r - Sumk);
+   body_grav_accel[2] = -mu_div_rsq * (Lambda * Z_div_r - Sumh);
+
+   // Convert back to inertial
+   Vector3::transform_transpose (src.pfix->state.rot.T_parent_this,
+                                 body_grav_accel);
+
+   return;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,575 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_calc_nonspherical_lanes.cc
+ * Define the SphericalHarmonicsGravityControls batch gravitation method and
+ * its lane-wise kernel, which evaluates the non-spherical field at several
+ * points at once.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The lane-wise kernel computes acceleration and potential only.)
+   (Each lane accumulates its terms in the same order as the scalar kernel,
+    so results agree with the scalar kernel to within the rounding of
+    contracted multiply-adds.))
+
+Library dependencies:
+  ((spherical_harmonics_calc_nonspherical_lanes.cc)
+   (spherical_harmonics_calc_nonspherical.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (spherical_harmonics_offload.cc)
+   (gravity_controls.cc)
+   (gravity_messages.cc)
+   (environment/planet/src/planet.cc)
+   (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+
+// JEOD includes
+#include "environment/planet/include/planet.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/gravity_integ_frame.hh"
+#include "../include/gravity_messages.hh"
+#include "../include/gravity_point_batch.hh"
+#include "../include/spherical_harmonics_gravity_controls.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+#include "../include/spherical_harmonics_offload.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+typedef SphericalHarmonicsGravitySource::PackedTerm PackedTerm;
+
+/**
+ * Largest degree and order that batch_signature can distinguish.
+ */
+const unsigned int max_batch_degree = 0xfffU;
+
+}
+
+
+/**
+ * Can the non-spherical part of this control be evaluated as part of a
+ * multi-point batch? The lane-wise kernel uses the control's degree and
+ * order for every point, so settings that vary the evaluation from point to
+ * point or from control to control rule it out.
+ * @return True if the non-spherical field can be batched
+ */
+bool
+SphericalHarmonicsGravityControls::batchable_nonspherical (
+   void) const
+{
+   return lane_batch && (harmonics_source != nullptr) &&
+          (! gradient) && (! use_grid) && (! adaptive_degree) &&
+          var_effects.empty() && (degree <= max_batch_degree) &&
+          (degree <= extended_range_degree);
+}
+
+
+/**
+ * Identify the settings that affect the result of a batchable control.
+ * Non-spherical controls also distinguish degree, order and whether the
+ * non-spherical potential is computed.
+ * @return Settings signature
+ */
+unsigned int
+SphericalHarmonicsGravityControls::batch_signature (
+   void) const
+{
+   unsigned int signature = GravityControls::batch_signature ();
+   if ((! spherical) && (! point_mass) && batchable_nonspherical()) {
+      signature |= 32U |
+                   (compute_potential ? 64U : 0U) |
+                   (degree << 7) |
+                   (std::min (order, degree) << 19);
+   }
+   return signature;
+}
+
+
+/**
+ * Compute the gravitation toward the source at each point in a batch.
+ * Batchable non-spherical controls evaluate the non-spherical field
+ * batch_lanes points at a time, or on the offload backend when one is
+ * attached and the batch is large enough; other controls use the base
+ * class method.
+ * \param[in] integ_frame_idx Integ frame index
+ * \param[in,out] batch Points of interest and the resulting gravitation
+ */
+void
+SphericalHarmonicsGravityControls::gravitation (
+   unsigned int integ_frame_idx,
+   GravityPointBatch & batch)
+{
+   if (spherical || point_mass || (! batchable_nonspherical())) {
+      GravityControls::gravitation (integ_frame_idx, batch);
+      return;
+   }
+
+   GravityIntegFrame & grav_source_frame = body->frames[integ_frame_idx];
+   update_frame_offset (grav_source_frame, sharing_frame_offsets());
+
+   if ((gradient != kernel_gradient) ||
+       (compute_potential != kernel_potential)) {
+      select_kernel ();
+   }
+   if ((lane_pnm_degree < degree) || lane_pnm.empty()) {
+      allocate_lane_legendre ();
+   }
+
+   double local_C20 = harmonics_source->packed_terms[
+                         SphericalHarmonicsGravitySource::packed_row(2)].Cnm;
+   unsigned int eval_degree = degree;
+   unsigned int eval_order = std::min (order, eval_degree);
+   effective_degree = degree;
+
+   if ((offload != nullptr) && offload->use_for (batch.npoints)) {
+      gravitation_offload (grav_source_frame, eval_degree, eval_order,
+                           local_C20, batch);
+      return;
+   }
+
+   for (unsigned int first = 0; first < batch.npoints; first += batch_lanes) {
+      unsigned int nlanes = batch.npoints - first;
+      if (nlanes > batch_lanes) {
+         nlanes = batch_lanes;
+      }
+      double integ_pos[3][batch_lanes];
+      double posn[3][batch_lanes];
+      double accel[3][batch_lanes];
+      double pot[batch_lanes];
+
+      // Unused lanes repeat the last point.
+      for (unsigned int ll = 0; ll < batch_lanes; ++ll) {
+         unsigned int ip = first + std::min (ll, nlanes - 1);
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            integ_pos[kk][ll] = batch.posn[kk][ip];
+            posn[kk][ll] = grav_source_frame.pos[kk] + integ_pos[kk][ll];
+         }
+      }
+
+      calc_nonspherical_lanes (posn, eval_degree, eval_order, local_C20,
+                               accel, pot);
+
+      for (unsigned int ll = 0; ll < nlanes; ++ll) {
+         double point_integ_pos[3];
+         double point_posn[3];
+         double point_accel[3];
+         double point_pot = compute_potential ? pot[ll] : 0.0;
+
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            point_integ_pos[kk] = integ_pos[kk][ll];
+            point_posn[kk] = posn[kk][ll];
+            point_accel[kk] = accel[kk][ll];
+         }
+
+         finish_batch_point (grav_source_frame, first + ll, point_integ_pos,
+                             point_posn, point_accel, point_pot, batch);
+      }
+   }
+}
+
+
+/**
+ * Evaluate a batch on the offload backend.
+ * \param[in] grav_source_frame Source integ frame
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in] local_C20 C20 coefficient
+ * \param[in,out] batch Points of interest and the resulting gravitation
+ */
+void
+SphericalHarmonicsGravityControls::gravitation_offload (
+   GravityIntegFrame & grav_source_frame,
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   double local_C20,
+   GravityPointBatch & batch)
+{
+   const unsigned int npoints = batch.npoints;
+   double * staged = offload->stage_positions (npoints);
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      for (unsigned int ip = 0; ip < npoints; ++ip) {
+         staged[kk * npoints + ip] =
+            grav_source_frame.pos[kk] + batch.posn[kk][ip];
+      }
+   }
+
+   offload->evaluate (*harmonics_source,
+                      harmonics_source->pfix->state.rot.T_parent_this,
+                      eval_degree, eval_order, local_C20);
+
+   const double * accel = offload->get_accelerations ();
+   const double * pot = offload->get_potentials ();
+
+   for (unsigned int ip = 0; ip < npoints; ++ip) {
+      double point_integ_pos[3];
+      double point_posn[3];
+      double point_accel[3];
+      double point_pot = compute_potential ? pot[ip] : 0.0;
+
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         point_integ_pos[kk] = batch.posn[kk][ip];
+         point_posn[kk] = grav_source_frame.pos[kk] + point_integ_pos[kk];
+         point_accel[kk] = accel[kk * npoints + ip];
+      }
+
+      finish_batch_point (grav_source_frame, ip, point_integ_pos,
+                          point_posn, point_accel, point_pot, batch);
+   }
+}
+
+
+/**
+ * Complete one point of a batch: warn once if the point is inside the
+ * source's radius, add the spherical terms to the non-spherical result, and
+ * store the point's acceleration, potential and (zero) gradient.
+ * \param[in] grav_source_frame Source integ frame
+ * \param[in] ip Point index
+ * \param[in] integ_pos Point position, integ frame coords\n Units: M
+ * \param[in] posn Point position relative to the source\n Units: M
+ * \param[in,out] accel Acceleration\n Units: M/s2
+ * \param[in] pot Non-spherical potential
+ * \param[in,out] batch Batch whose outputs receive the point's results
+ */
+void
+SphericalHarmonicsGravityControls::finish_batch_point (
+   GravityIntegFrame & grav_source_frame,
+   unsigned int ip,
+   const double integ_pos[3],
+   const double posn[3],
+   double accel[3],
+   double pot,
+   GravityPointBatch & batch)
+{
+   double dgdx[3][3];
+   Matrix3x3::initialize (dgdx);
+
+   if ((! min_radius_warn) &&
+       (Vector3::vmag (posn) < harmonics_source->radius)) {
+      min_radius_warn = true;
+      MessageHandler::warn (
+         __FILE__, __LINE__, GravityMessages::domain_error,
+         "Radial distance %g is less than the equatorial radius %g "
+         "of %s.",
+         Vector3::vmag (posn), harmonics_source->radius,
+         harmonics_source->name.c_str() );
+   }
+
+   if (! perturbing_only && ! skip_spherical) {
+      calc_spherical (integ_pos, posn, grav_source_frame, accel, dgdx, pot);
+   }
+
+   batch.accel[0][ip] = accel[0];
+   batch.accel[1][ip] = accel[1];
+   batch.accel[2][ip] = accel[2];
+   if (batch.pot != nullptr) {
+      batch.pot[ip] = pot;
+   }
+   if (batch.grad != nullptr) {
+      Matrix3x3::copy (dgdx, batch.grad[ip]);
+   }
+}
+
+
+/**
+ * Size lane_pnm through this control's degree and seed the terms that do
+ * not depend on position: P(0,0), P(1,1), the diagonal P(n,n), and the zero
+ * terms P(n,n+1) and P(n,n+2), each replicated across the lanes.
+ */
+void
+SphericalHarmonicsGravityControls::allocate_lane_legendre (
+   void)
+{
+   if ((Pnm == nullptr) || (pnm_degree < degree)) {
+      allocate_legendre ();
+   }
+
+   lane_pnm_degree = pnm_degree;
+   unsigned int row_size = (lane_pnm_degree + 3) * batch_lanes;
+   lane_pnm.assign ((lane_pnm_degree + 1) * row_size, 0.0);
+
+   for (unsigned int ii = 0; ii <= lane_pnm_degree; ++ii) {
+      double * P_ii = lane_pnm.data() + ii * row_size;
+      for (unsigned int jj = ii; jj <= ii + 2; ++jj) {
+         for (unsigned int ll = 0; ll < batch_lanes; ++ll) {
+            P_ii[jj * batch_lanes + ll] = Pnm[ii][jj];
+         }
+      }
+   }
+}
+
+
+/**
+ * Compute the non-spherical acceleration and potential at batch_lanes points
+ * at once. This is calc_nonspherical's acceleration-and-potential kernel with
+ * every per-point quantity widened to one value per lane; each step of the
+ * degree and order recursions is a short loop over the lanes with no
+ * branches, a form that compilers map onto SIMD registers.
+ * \param[in] posn Points of interest, inrtl coords, one array per axis\n
+ *            Units: M
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in] local_C20 C20 coefficient
+ * \param[out] body_grav_accel Accels for given grav body, one array per axis\n
+ *             Units: M/s2
+ * \param[out] pot Potentials
+ */
+void
+SphericalHarmonicsGravityControls::calc_nonspherical_lanes (
+   const double posn[3][batch_lanes],
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   double local_C20,
+   double body_grav_accel[3][batch_lanes],
+   double pot[batch_lanes])
+{
+   const unsigned int LL = batch_lanes;
+   const SphericalHarmonicsGravitySource & src = *harmonics_source;
+   const PackedTerm * packed_terms = src.packed_terms;
+   const double * int_to_double = src.int_to_double;
+   const double (& T_pfix)[3][3] = src.pfix->state.rot.T_parent_this;
+   const unsigned int row_size = (lane_pnm_degree + 3) * LL;
+
+   double X_div_r[LL];
+   double Y_div_r[LL];
+   double Epilson[LL];
+   double r_mag_inv[LL];
+   double rad_div_r[LL];
+   double rad_div_r_nth[LL];
+   double mu_div_r[LL];
+   double mu_div_rsq[LL];
+   double cos_phi[LL];
+   double cos_phi_nth[LL];
+
+   // Rows 0 and 1 start the recursions even when eval_degree is 0.
+   // The recursions are carved from the control's scratch arena.
+   const unsigned int nrows = std::max (eval_degree, 1U) + 1;
+   ScratchArena::Frame scratch_frame (scratch);
+   double (* cos_mlambda)[LL] =
+      reinterpret_cast<double (*)[LL]> (scratch.allocate (nrows * LL));
+   double (* sin_mlambda)[LL] =
+      reinterpret_cast<double (*)[LL]> (scratch.allocate (nrows * LL));
+   double (* C_tilde)[LL] =
+      reinterpret_cast<double (*)[LL]> (scratch.allocate (nrows * LL));
+   double (* S_tilde)[LL] =
+      reinterpret_cast<double (*)[LL]> (scratch.allocate (nrows * LL));
+
+   double Sumv[LL];
+   double Sumgam[LL];
+   double Sumh[LL];
+   double Sumj[LL];
+   double Sumk[LL];
+
+   double * P_1 = lane_pnm.data() + row_size;
+
+   // Define terms (page 33 of Gottlieb 1993), converting to planet-fixed.
+   for (unsigned int ll = 0; ll < LL; ++ll) {
+      double posn_pf[3];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         posn_pf[kk] = T_pfix[kk][0] * posn[0][ll] +
+                       T_pfix[kk][1] * posn[1][ll] +
+                       T_pfix[kk][2] * posn[2][ll];
+      }
+
+      double r_mag = std::sqrt (posn[0][ll] * posn[0][ll] +
+                                posn[1][ll] * posn[1][ll] +
+                                posn[2][ll] * posn[2][ll]);
+      r_mag_inv[ll] = 1.0 / r_mag;
+      X_div_r[ll] = posn_pf[0] * r_mag_inv[ll];
+      Y_div_r[ll] = posn_pf[1] * r_mag_inv[ll];
+      Epilson[ll] = posn_pf[2] * r_mag_inv[ll];
+
+      rad_div_r[ll] = src.radius * r_mag_inv[ll];
+      rad_div_r_nth[ll] = rad_div_r[ll];
+      mu_div_r[ll] = src.mu * r_mag_inv[ll];
+      mu_div_rsq[ll] = mu_div_r[ll] * r_mag_inv[ll];
+
+      // Magnitude of projection on the equatorial plane
+      double x_sq = (std::fabs (posn_pf[0]) > GSL_SQRT_DBL_MIN) ?
+                    posn_pf[0] * posn_pf[0] : 0.0;
+      double y_sq = (std::fabs (posn_pf[1]) > GSL_SQRT_DBL_MIN) ?
+                    posn_pf[1] * posn_pf[1] : 0.0;
+      double rho_sq = 0.0 + x_sq + y_sq;
+      double rho = std::sqrt (rho_sq);
+      cos_phi[ll] = rho * r_mag_inv[ll];
+      cos_phi_nth[ll] = cos_phi[ll];
+
+      cos_mlambda[0][ll] = 1.0;
+      sin_mlambda[0][ll] = 0.0;
+      cos_mlambda[1][ll] = (rho_sq > 0.0) ? posn_pf[0] / rho : 1.0;
+      sin_mlambda[1][ll] = (rho_sq > 0.0) ? posn_pf[1] / rho : 0.0;
+
+      C_tilde[0][ll] = 1.0;
+      C_tilde[1][ll] = X_div_r[ll]; // equation (3-18)
+      S_tilde[0][ll] = 0.0;
+      S_tilde[1][ll] = Y_div_r[ll]; // equation (3-18)
+
+      P_1[ll] = std::sqrt (3.0) * Epilson[ll];
+
+      Sumv[ll] = 0.0;
+      Sumgam[ll] = 0.0;
+      Sumh[ll] = 0.0;
+      Sumj[ll] = 0.0;
+      Sumk[ll] = 0.0;
+   }
+
+   for (unsigned int ii = 2; ii <= eval_degree; ++ii) {
+
+      const PackedTerm * T_ii =
+         packed_terms + SphericalHarmonicsGravitySource::packed_row(ii);
+      double C_ii0 = (ii == 2) ? local_C20 : T_ii[0].Cnm;
+      double * P_ii = lane_pnm.data() + ii * row_size;
+      const double * P_iim1 = P_ii - row_size;
+      const double * P_iim2 = P_iim1 - row_size;
+      double alpha_ii = src.alpha[ii];
+      double beta_ii = src.beta[ii];
+      double nrdiag_ii = src.nrdiag[ii];
+      double dbl_iip1 = int_to_double[ii+1];
+
+      double Sumv_N[LL];
+      double Sumh_N[LL];
+      double Sumgam_N[LL];
+      double Sumj_N[LL];
+      double Sumk_N[LL];
+
+      for (unsigned int ll = 0; ll < LL; ++ll) {
+         double rr = rad_div_r_nth[ll] * rad_div_r[ll];
+         rad_div_r_nth[ll] = (rr < 1.0E-299) ? 0.0 : rr;
+
+         // P(n,0), P(n,n-1) and P(n,1) terms, equations (7-14), (7-16), (7-12)
+         P_ii[ll] = alpha_ii * Epilson[ll] * P_iim1[ll] -
+                    beta_ii * P_iim2[ll];
+         P_ii[(ii-1)*LL + ll] = Epilson[ll] * nrdiag_ii;
+         P_ii[LL + ll] = T_ii[1].xi * Epilson[ll] * P_iim1[LL + ll] -
+                         T_ii[1].eta * P_iim2[LL + ll];
+      }
+
+      for (unsigned int jj = 2; jj <= (ii - 2); ++jj) {
+         double xi_iijj = T_ii[jj].xi;
+         double eta_iijj = T_ii[jj].eta;
+         for (unsigned int ll = 0; ll < LL; ++ll) {
+            // Equation (7-12)
+            P_ii[jj*LL + ll] = xi_iijj * Epilson[ll] * P_iim1[jj*LL + ll] -
+                               eta_iijj * P_iim2[jj*LL + ll];
+         }
+      }
+
+      for (unsigned int ll = 0; ll < LL; ++ll) {
+         Sumv_N[ll] = P_ii[ll] * C_ii0;
+         Sumh_N[ll] = P_ii[LL + ll] * C_ii0 * T_ii[0].zeta;
+         Sumgam_N[ll] = Sumv_N[ll] * dbl_iip1;
+      }
+
+      if (eval_order > 0) {
+
+         for (unsigned int ll = 0; ll < LL; ++ll) {
+            cos_phi_nth[ll] = (cos_phi_nth[ll] > GSL_SQRT_DBL_MIN) ?
+                              cos_phi_nth[ll] * cos_phi[ll] : 0.0;
+            cos_mlambda[ii][ll] =
+               cos_mlambda[1][ll] * cos_mlambda[ii-1][ll] -
+               sin_mlambda[1][ll] * sin_mlambda[ii-1][ll];
+            sin_mlambda[ii][ll] =
+               sin_mlambda[1][ll] * cos_mlambda[ii-1][ll] +
+               cos_mlambda[1][ll] * sin_mlambda[ii-1][ll];
+
+            // Equation (3-18), modified for underflow
+            C_tilde[ii][ll] = cos_phi_nth[ll] * cos_mlambda[ii][ll];
+            S_tilde[ii][ll] = cos_phi_nth[ll] * sin_mlambda[ii][ll];
+
+            Sumj_N[ll] = 0.0;
+            Sumk_N[ll] = 0.0;
+         }
+
+         unsigned int jj_max = (eval_order < ii) ? eval_order : ii;
+
+         for (unsigned int jj = 1; jj <= jj_max; ++jj) {
+            const PackedTerm & T_iijj = T_ii[jj];
+            double C_iijj = T_iijj.Cnm;
+            double S_iijj = T_iijj.Snm;
+            double dbl_jj = int_to_double[jj];
+            double zeta_iijj = (jj < ii) ? T_iijj.zeta : 0.0;
+            const double * P_iijj = P_ii + jj * LL;
+            const double * P_iijjp1 = P_iijj + LL;
+
+            for (unsigned int ll = 0; ll < LL; ++ll) {
+               double B_tilde = C_iijj * C_tilde[jj][ll] +
+                                S_iijj * S_tilde[jj][ll];
+               // equation (3-9)
+               double B_tilde_m1 = C_iijj * C_tilde[jj-1][ll] +
+                                   S_iijj * S_tilde[jj-1][ll];
+               double A_tilde_m1 = C_iijj * S_tilde[jj-1][ll] -
+                                   S_iijj * C_tilde[jj-1][ll];
+               double P_x_B = P_iijj[ll] * B_tilde;
+               double jj_x_P = dbl_jj * P_iijj[ll];
+
+               Sumv_N[ll]   = Sumv_N[ll] + P_x_B;
+               Sumh_N[ll]   = Sumh_N[ll] + zeta_iijj * P_iijjp1[ll] * B_tilde;
+               Sumj_N[ll]   = Sumj_N[ll] + jj_x_P * B_tilde_m1;
+               Sumk_N[ll]   = Sumk_N[ll] - jj_x_P * A_tilde_m1;
+               Sumgam_N[ll] = Sumgam_N[ll] + (dbl_jj + dbl_iip1) * P_x_B;
+            }
+         } // next m
+
+         for (unsigned int ll = 0; ll < LL; ++ll) {
+            Sumj[ll] += rad_div_r_nth[ll] * Sumj_N[ll];
+            Sumk[ll] += rad_div_r_nth[ll] * Sumk_N[ll];
+         }
+      }
+
+      for (unsigned int ll = 0; ll < LL; ++ll) {
+         Sumv[ll]   += rad_div_r_nth[ll] * Sumv_N[ll];
+         Sumh[ll]   += rad_div_r_nth[ll] * Sumh_N[ll];
+         Sumgam[ll] += rad_div_r_nth[ll] * Sumgam_N[ll];
+      }
+
+   } // next n
+
+   for (unsigned int ll = 0; ll < LL; ++ll) {
+      pot[ll] = mu_div_r[ll] * Sumv[ll]; // gravitational potential
+      double Lambda = Sumgam[ll] + Epilson[ll] * Sumh[ll];
+
+      // Equation (4-13)
+      double accel_pf[3];
+      accel_pf[0] = -mu_div_rsq[ll] * (Lambda * X_div_r[ll] - Sumj[ll]);
+      accel_pf[1] = -mu_div_rsq[ll] * (Lambda * Y_div_r[ll] - Sumk[ll]);
+      accel_pf[2] = -mu_div_rsq[ll] * (Lambda * Epilson[ll] - Sumh[ll]);
+
+      // Convert back to inertial
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         body_grav_accel[kk][ll] = T_pfix[0][kk] * accel_pf[0] +
+                                   T_pfix[1][kk] * accel_pf[1] +
+                                   T_pfix[2][kk] * accel_pf[2];
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,202 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_calc_potential.cc
+ * Define SphericalHarmonicsGravitySource::calc_potential, which computes
+ * the gravitational potential alone.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Gottlieb, R. G.)
+    (Fast Gravity, Gravity Partials, Normalized Gravity, Gravity Gradient
+     Torque and Magnetic Field: Derivation, Code and Data)
+    (NASA CR-188243, 1993)))
+
+Library dependencies:
+  ((spherical_harmonics_calc_potential.cc)
+   (spherical_harmonics_gravity_source.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/spherical_harmonics_gravity_source.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Compute the gravitational potential, including the central term, of the
+ * static field (the source coefficients, without delta-coefficient effects)
+ * at a planet-fixed position. This is the potential sum of Gottlieb's
+ * algorithm alone: the Legendre recursion runs only over the orders that
+ * are summed, and none of the acceleration or gradient sums are formed.
+ * Only the two previous rows of Legendre functions are kept.
+ *
+ * The source is not modified; scratch storage is taken from the caller's
+ * work vector, so the method can be called from any thread provided the
+ * recursion tables are not being rebuilt.
+ * \par Assumptions and Limitations
+ *  - The recursion tables extend through eval_degree (see require_degree).
+ * @return Potential (positive convention)\n Units: M2/s2
+ * \param[in] posn_pf Point of interest, pfix coords\n Units: M
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in,out] work Scratch storage, resized as needed
+ */
+double
+SphericalHarmonicsGravitySource::calc_potential (
+   const double posn_pf[3],
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   std::vector<double> & work)
+const
+{
+   unsigned int max_degree = std::min (eval_degree, table_degree);
+   unsigned int max_order = std::min (eval_order, max_degree);
+   unsigned int row_size = max_degree + 3;
+
+   double r_mag = Vector3::vmag (posn_pf);
+   double r_mag_inv = 1.0 / r_mag;
+   double mu_div_r = mu * r_mag_inv;
+   if (max_degree < 2) {
+      return mu_div_r;
+   }
+
+   // Work layout: three rolling Legendre rows, then the C_tilde, S_tilde,
+   // cos(m lambda), and sin(m lambda) recursions.
+   std::size_t needed = 3 * row_size + 4 * (max_degree + 1);
+   if (work.size() < needed) {
+      work.resize (needed);
+   }
+   double * rows[3] = {work.data(), work.data() + row_size,
+                       work.data() + 2 * row_size};
+   double * C_tilde = work.data() + 3 * row_size;
+   double * S_tilde = C_tilde + (max_degree + 1);
+   double * cos_mlambda = S_tilde + (max_degree + 1);
+   double * sin_mlambda = cos_mlambda + (max_degree + 1);
+
+   double Epilson = posn_pf[2] * r_mag_inv;
+   double rad_div_r = radius * r_mag_inv;
+   double rad_div_r_nth = rad_div_r;
+
+   double rho_sq = 0.0;
+   if ((posn_pf[0] < -GSL_SQRT_DBL_MIN) || (posn_pf[0] > GSL_SQRT_DBL_MIN)) {
+      rho_sq += posn_pf[0] * posn_pf[0];
+   }
+   if ((posn_pf[1] < -GSL_SQRT_DBL_MIN) || (posn_pf[1] > GSL_SQRT_DBL_MIN)) {
+      rho_sq += posn_pf[1] * posn_pf[1];
+   }
+   double rho = std::sqrt (rho_sq);
+   double cos_phi = rho * r_mag_inv;
+   double cos_phi_nth = cos_phi;
+
+   cos_mlambda[0] = 1.0;
+   sin_mlambda[0] = 0.0;
+   if (rho_sq > 0.0) {
+      cos_mlambda[1] = posn_pf[0] / rho;
+      sin_mlambda[1] = posn_pf[1] / rho;
+   }
+   else {
+      cos_mlambda[1] = 1.0;
+      sin_mlambda[1] = 0.0;
+   }
+   C_tilde[0] = 1.0;
+   C_tilde[1] = posn_pf[0] * r_mag_inv;
+   S_tilde[0] = 0.0;
+   S_tilde[1] = posn_pf[1] * r_mag_inv;
+
+   // Rows 0 and 1 of the normalized Legendre functions.
+   double * P_iim2 = rows[0];
+   double * P_iim1 = rows[1];
+   double * P_ii = rows[2];
+   P_iim2[0] = 1.0;
+   P_iim2[1] = 0.0;
+   P_iim1[0] = std::sqrt (3.0) * Epilson;
+   P_iim1[1] = std::sqrt (3.0);
+   double P_diag = P_iim1[1];
+
+   double Sumv = 0.0;
+
+   for (unsigned int ii = 2; ii <= max_degree; ++ii) {
+      const PackedTerm * T_ii = packed_terms + packed_row (ii);
+
+      rad_div_r_nth = rad_div_r_nth * rad_div_r;
+      if (rad_div_r_nth < 1.0E-299) {
+         rad_div_r_nth = 0.0;
+      }
+
+      // Legendre functions of degree ii, equations (7-12) to (7-16).
+      unsigned int jj_max = std::min (max_order, ii);
+      P_ii[0] = alpha[ii] * Epilson * P_iim1[0] - beta[ii] * P_iim2[0];
+      P_ii[ii-1] = Epilson * nrdiag[ii];
+      P_ii[1] = T_ii[1].xi * Epilson * P_iim1[1] - T_ii[1].eta * P_iim2[1];
+      for (unsigned int jj = 2; jj <= (ii - 2); ++jj) {
+         P_ii[jj] = T_ii[jj].xi * Epilson * P_iim1[jj] -
+                    T_ii[jj].eta * P_iim2[jj];
+      }
+      P_diag = std::sqrt ((2.0 * int_to_double[ii] + 1.0) /
+                          (2.0 * int_to_double[ii])) * P_diag;
+      P_ii[ii] = P_diag;
+
+      double Sumv_N = P_ii[0] * T_ii[0].Cnm;
+
+      if (max_order > 0) {
+         if (cos_phi_nth > GSL_SQRT_DBL_MIN) {
+            cos_phi_nth *= cos_phi;
+         }
+         else {
+            cos_phi_nth = 0.0;
+         }
+         cos_mlambda[ii] = cos_mlambda[1] * cos_mlambda[ii-1] -
+                           sin_mlambda[1] * sin_mlambda[ii-1];
+         sin_mlambda[ii] = sin_mlambda[1] * cos_mlambda[ii-1] +
+                           cos_mlambda[1] * sin_mlambda[ii-1];
+         C_tilde[ii] = cos_phi_nth * cos_mlambda[ii];
+         S_tilde[ii] = cos_phi_nth * sin_mlambda[ii];
+
+         for (unsigned int jj = 1; jj <= jj_max; ++jj) {
+            Sumv_N += P_ii[jj] *
+                      (T_ii[jj].Cnm * C_tilde[jj] + T_ii[jj].Snm * S_tilde[jj]);
+         }
+      }
+
+      Sumv += rad_div_r_nth * Sumv_N;
+
+      // Roll the rows.
+      double * oldest = P_iim2;
+      P_iim2 = P_iim1;
+      P_iim1 = P_ii;
+      P_ii = oldest;
+   }
+
+   return mu_div_r * (1.0 + Sumv);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,322 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_coeff_file.cc
+ * Define member functions for the SphericalHarmonicsCoeffFile class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((none)))
+
+Assumptions and limitations:
+  ((none))
+
+Library dependencies:
+  ((spherical_harmonics_coeff_file.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (gravity_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/gravity_messages.hh"
+#include "../include/spherical_harmonics_coeff_file.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Alignment of the coefficient data within the file, in bytes.
+ */
+const std::size_t data_alignment = 64;
+
+/**
+ * Offset of the coefficient data, the header size rounded up to the
+ * data alignment.
+ */
+const std::size_t data_start =
+   ((sizeof(SphericalHarmonicsCoeffFile::Header) + data_alignment - 1)
+    / data_alignment) * data_alignment;
+
+}
+
+
+const char SphericalHarmonicsCoeffFile::file_magic[8] =
+   {'J', 'E', 'O', 'D', 'S', 'H', 'C', '\0'};
+const uint32_t SphericalHarmonicsCoeffFile::current_version = 1;
+const uint32_t SphericalHarmonicsCoeffFile::byte_order_mark = 0x01020304;
+
+
+/**
+ * SphericalHarmonicsCoeffFile constructor.
+ */
+SphericalHarmonicsCoeffFile::SphericalHarmonicsCoeffFile (
+   void)
+:
+   file_name(),
+   map_addr(nullptr),
+   map_size(0)
+{
+   return;
+}
+
+
+/**
+ * SphericalHarmonicsCoeffFile destructor.
+ */
+SphericalHarmonicsCoeffFile::~SphericalHarmonicsCoeffFile (
+   void)
+{
+   unmap ();
+   return;
+}
+
+
+/**
+ * Write the coefficients of a source to a binary coefficient file.
+ * The source need not have been initialized; only its name, mu, radius,
+ * tide parameters, degree, order, Cnm and Snm are used.
+ * \param[in] source Source with coefficients
+ * \param[in] path   File to be written
+ */
+void
+SphericalHarmonicsCoeffFile::write_file (
+   const SphericalHarmonicsGravitySource & source,
+   const std::string & path)
+{
+   if ((source.degree > 0) &&
+       ((source.Cnm == nullptr) || (source.Snm == nullptr))) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::null_pointer,
+         "Gravity source '%s' has no coefficients to write.",
+         source.name.c_str());
+      return;
+   }
+
+   Header header;
+   std::memset (&header, 0, sizeof(header));
+   std::memcpy (header.magic, file_magic, sizeof(header.magic));
+   header.version = current_version;
+   header.byte_order = byte_order_mark;
+   header.degree = source.degree;
+   header.order = source.order;
+   header.tide_free = source.tide_free ? 1 : 0;
+   header.mu = source.mu;
+   header.radius = source.radius;
+   header.tide_free_delta = source.tide_free_delta;
+   std::strncpy (header.name, source.name.c_str(), sizeof(header.name) - 1);
+   header.data_offset = data_start;
+   header.num_terms = SphericalHarmonicsGravitySource::packed_row (
+                         source.degree + 1);
+
+   std::FILE * fp = std::fopen (path.c_str(), "wb"); // flawfinder: ignore
+   if (fp == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::file_error,
+         "Unable to open gravity coefficient file '%s' for writing.",
+         path.c_str());
+      return;
+   }
+
+   char pad[data_alignment];
+   std::memset (pad, 0, sizeof(pad));
+   bool ok = (std::fwrite (&header, sizeof(header), 1, fp) == 1) &&
+             (std::fwrite (pad, data_start - sizeof(header), 1, fp) == 1);
+
+   // Cnm triangle, then Snm triangle. Degrees 0 and 1 and orders beyond the
+   // model order are not populated by the data sources and are written as 0.
+   for (unsigned int pass = 0; ok && (pass < 2); ++pass) {
+      double ** coeffs = (pass == 0) ? source.Cnm : source.Snm;
+      for (unsigned int ii = 0; ok && (ii <= source.degree); ++ii) {
+         for (unsigned int jj = 0; ok && (jj <= ii); ++jj) {
+            double value = 0.0;
+            if ((ii >= 2) && (jj <= source.order)) {
+               value = coeffs[ii][jj];
+            }
+            ok = (std::fwrite (&value, sizeof(value), 1, fp) == 1);
+         }
+      }
+   }
+
+   if ((std::fclose (fp) != 0) || (!ok)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::file_error,
+         "Error writing gravity coefficient file '%s'.",
+         path.c_str());
+   }
+
+   return;
+}
+
+
+/**
+ * Map a binary coefficient file read-only and set up the source from it.
+ * The source's name, mu, radius, tide parameters, degree and order are set
+ * from the file header, and Cnm[n] and Snm[n] are pointed at row n of the
+ * mapped triangles. This replaces the source's default data initializer and
+ * must be called before initialize_body.
+ * \param[in]     path   File to be mapped
+ * \param[in,out] source Source to be initialized
+ */
+void
+SphericalHarmonicsCoeffFile::map_file (
+   const std::string & path,
+   SphericalHarmonicsGravitySource & source)
+{
+   if (is_mapped() || (source.Cnm != nullptr) || (source.Snm != nullptr)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::duplicate_entry,
+         "Gravity source '%s' already has coefficients; "
+         "cannot map '%s'.",
+         source.name.c_str(), path.c_str());
+      return;
+   }
+
+   int fd = open (path.c_str(), O_RDONLY); // flawfinder: ignore
+   if (fd < 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::file_error,
+         "Unable to open gravity coefficient file '%s'.",
+         path.c_str());
+      return;
+   }
+
+   struct stat file_stat;
+   if ((fstat (fd, &file_stat) != 0) ||
+       (static_cast<std::size_t>(file_stat.st_size) < data_start)) {
+      close (fd);
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::file_error,
+         "Gravity coefficient file '%s' is too short.",
+         path.c_str());
+      return;
+   }
+
+   std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+   void * addr = mmap (nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+   close (fd);
+   if (addr == MAP_FAILED) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::file_error,
+         "Unable to map gravity coefficient file '%s'.",
+         path.c_str());
+      return;
+   }
+
+   // Validate the header before trusting any of its sizes.
+   const Header & header = *static_cast<const Header *>(addr);
+   const char * reason = nullptr;
+   if (std::memcmp (header.magic, file_magic, sizeof(file_magic)) != 0) {
+      reason = "not a JEOD gravity coefficient file";
+   }
+   else if (header.byte_order != byte_order_mark) {
+      reason = "written with a different byte order";
+   }
+   else if (header.version != current_version) {
+      reason = "unsupported format version";
+   }
+   else if ((header.order > header.degree) ||
+            (header.num_terms != SphericalHarmonicsGravitySource::packed_row (
+                                    header.degree + 1)) ||
+            (header.data_offset % sizeof(double) != 0) ||
+            (header.data_offset < sizeof(Header)) ||
+            (header.data_offset + 2 * header.num_terms * sizeof(double) >
+             size)) {
+      reason = "inconsistent sizes";
+   }
+   if (reason != nullptr) {
+      munmap (addr, size);
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityMessages::file_error,
+         "Gravity coefficient file '%s': %s.",
+         path.c_str(), reason);
+      return;
+   }
+
+   map_addr = addr;
+   map_size = size;
+   file_name = path;
+
+   char name[sizeof(header.name) + 1];
+   std::memcpy (name, header.name, sizeof(header.name));
+   name[sizeof(header.name)] = '\0';
+
+   source.name = name;
+   source.mu = header.mu;
+   source.radius = header.radius;
+   source.degree = header.degree;
+   source.order = header.order;
+   source.tide_free = (header.tide_free != 0);
+   source.tide_free_delta = header.tide_free_delta;
+
+   // The row pointer arrays are ordinary allocations; the rows themselves
+   // are the read-only mapped pages.
+   double * cnm_data = reinterpret_cast<double *> (
+                          static_cast<char *>(addr) + header.data_offset);
+   double * snm_data = cnm_data + header.num_terms;
+
+   source.Cnm = JEOD_ALLOC_PRIM_ARRAY (source.degree + 1, double *);
+   source.Snm = JEOD_ALLOC_PRIM_ARRAY (source.degree + 1, double *);
+   for (unsigned int ii = 0; ii <= source.degree; ++ii) {
+      source.Cnm[ii] = cnm_data + SphericalHarmonicsGravitySource::packed_row (ii);
+      source.Snm[ii] = snm_data + SphericalHarmonicsGravitySource::packed_row (ii);
+   }
+
+   return;
+}
+
+
+/**
+ * Release the mapping. The source whose rows point into it must no longer
+ * use them.
+ */
+void
+SphericalHarmonicsCoeffFile::unmap (
+   void)
+{
+   if (map_addr != nullptr) {
+      munmap (map_addr, map_size);
+      map_addr = nullptr;
+      map_size = 0;
+      file_name.clear();
+   }
+
+   return;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,127 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_degree_step.cc
+ * Define the member functions of the class SphericalHarmonicsDegreeStep.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((spherical_harmonics_degree_step.cc)
+   (spherical_harmonics_gravity_controls.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+
+// Model includes
+#include "../include/spherical_harmonics_degree_step.hh"
+#include "../include/spherical_harmonics_gravity_controls.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * SphericalHarmonicsDegreeStep default constructor.
+ */
+SphericalHarmonicsDegreeStep::SphericalHarmonicsDegreeStep (
+   void)
+:
+   JeodFidelityStep(),
+   reduced_degree(8),
+   reduced_order(8),
+   entries()
+{
+   ; // Empty
+}
+
+
+/**
+ * SphericalHarmonicsDegreeStep destructor.
+ */
+SphericalHarmonicsDegreeStep::~SphericalHarmonicsDegreeStep (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Add a gravity control to those affected by the step.
+ * \param[in,out] controls The control
+ */
+void
+SphericalHarmonicsDegreeStep::add_controls (
+   SphericalHarmonicsGravityControls & controls)
+{
+   Entry entry = {&controls, 0, 0, 0, 0};
+   entries.push_back (entry);
+}
+
+
+/**
+ * Record the controls' settings and truncate them. The gradient settings
+ * are lowered first as they may not exceed the degree and order.
+ */
+void
+SphericalHarmonicsDegreeStep::degrade (
+   void)
+{
+   for (std::vector<Entry>::iterator it = entries.begin();
+        it != entries.end();
+        ++it) {
+      SphericalHarmonicsGravityControls & controls = *(it->controls);
+
+      controls.get_degree_order (it->degree, it->order);
+      controls.get_grad_degree_order (it->gradient_degree, it->gradient_order);
+
+      unsigned int new_degree = std::min (it->degree, reduced_degree);
+      unsigned int new_order = std::min (
+         std::min (it->order, reduced_order), new_degree);
+
+      controls.set_grad_degree_order (
+         std::min (it->gradient_degree, new_degree),
+         std::min (it->gradient_order, new_order));
+      controls.set_degree_order (new_degree, new_order);
+   }
+}
+
+
+/**
+ * Reinstate the settings recorded by degrade().
+ */
+void
+SphericalHarmonicsDegreeStep::restore (
+   void)
+{
+   for (std::vector<Entry>::iterator it = entries.begin();
+        it != entries.end();
+        ++it) {
+      SphericalHarmonicsGravityControls & controls = *(it->controls);
+
+      controls.set_degree_order (it->degree, it->order);
+      controls.set_grad_degree_order (it->gradient_degree, it->gradient_order);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
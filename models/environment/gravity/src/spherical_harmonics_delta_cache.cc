@@ -0,0 +1,184 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_delta_cache.cc
+ * Define member functions for the SphericalHarmonicsDeltaCache class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((none)))
+
+Assumptions and limitations:
+  ((none))
+
+Library dependencies:
+  ((spherical_harmonics_delta_cache.cc))
+
+
+*******************************************************************************/
+
+
+#include <cstddef>
+
+#include "utils/memory/include/jeod_alloc.hh"
+
+#include "../include/spherical_harmonics_delta_cache.hh"
+
+
+
+namespace jeod {
+
+/**
+ * SphericalHarmonicsDeltaCache constructor.
+ */
+SphericalHarmonicsDeltaCache::SphericalHarmonicsDeltaCache (
+   void)
+:
+   enabled(false),
+   valid(false),
+   time(0.0),
+   dC20(0.0),
+   degree(0),
+   order(0),
+   delta_Cnm(nullptr),
+   delta_Snm(nullptr)
+{
+   return;
+}
+
+
+/**
+ * SphericalHarmonicsDeltaCache destructor.
+ */
+SphericalHarmonicsDeltaCache::~SphericalHarmonicsDeltaCache (
+   void)
+{
+   release ();
+}
+
+
+/**
+ * Release the cached arrays.
+ */
+void
+SphericalHarmonicsDeltaCache::release (
+   void)
+{
+   JEOD_DELETE_PRIM_ROWS (delta_Cnm);
+   JEOD_DELETE_PRIM_ROWS (delta_Snm);
+   degree = 0;
+   order = 0;
+   valid = false;
+}
+
+
+/**
+ * Discard the cached set; the next evaluation recomputes it.
+ */
+void
+SphericalHarmonicsDeltaCache::invalidate (
+   void)
+{
+   valid = false;
+}
+
+
+/**
+ * Determine whether the cached set was produced at the given time by
+ * delta-controls described by the given key.
+ * @return True if the cached set can be reused.
+ * \param[in] input_time Time of the delta-coefficient model inputs\n Units: s
+ * \param[in] input_key Description of the delta-controls
+ */
+bool
+SphericalHarmonicsDeltaCache::matches (
+   double input_time,
+   const std::vector<unsigned int> & input_key) const
+{
+   return enabled && valid && (input_time == time) && (input_key == key);
+}
+
+
+/**
+ * Replace the cached set.
+ * \param[in] input_time Time of the delta-coefficient model inputs\n Units: s
+ * \param[in] input_key Description of the delta-controls
+ * \param[in] sum_dC20 Summed delta C20
+ * \param[in] sum_Cnm Summed real delta-coefficients, sum_degree x sum_order
+ * \param[in] sum_Snm Summed imaginary delta-coefficients
+ * \param[in] sum_degree Number of rows in sum_Cnm and sum_Snm
+ * \param[in] sum_order Number of columns in sum_Cnm and sum_Snm
+ */
+void
+SphericalHarmonicsDeltaCache::store (
+   double input_time,
+   const std::vector<unsigned int> & input_key,
+   double sum_dC20,
+   double ** sum_Cnm,
+   double ** sum_Snm,
+   unsigned int sum_degree,
+   unsigned int sum_order)
+{
+   if ((sum_degree != degree) || (sum_order != order)) {
+      release ();
+      if ((sum_degree > 0) && (sum_order > 0)) {
+         delta_Cnm = JEOD_ALLOC_PRIM_MATRIX (sum_degree, sum_order, double);
+         delta_Snm = JEOD_ALLOC_PRIM_MATRIX (sum_degree, sum_order, double);
+         degree = sum_degree;
+         order = sum_order;
+      }
+   }
+
+   for (unsigned int ii = 0; ii < degree; ++ii) {
+      for (unsigned int jj = 0; jj < order; ++jj) {
+         delta_Cnm[ii][jj] = sum_Cnm[ii][jj];
+         delta_Snm[ii][jj] = sum_Snm[ii][jj];
+      }
+   }
+
+   dC20 = sum_dC20;
+   time = input_time;
+   key = input_key;
+   valid = true;
+}
+
+
+/**
+ * Copy the cached set out. The receiving arrays must have the dimensions of
+ * the arrays the set was stored from, which matches guarantees.
+ * \param[out] sum_dC20 Summed delta C20
+ * \param[out] sum_Cnm Summed real delta-coefficients
+ * \param[out] sum_Snm Summed imaginary delta-coefficients
+ */
+void
+SphericalHarmonicsDeltaCache::retrieve (
+   double & sum_dC20,
+   double ** sum_Cnm,
+   double ** sum_Snm) const
+{
+   for (unsigned int ii = 0; ii < degree; ++ii) {
+      for (unsigned int jj = 0; jj < order; ++jj) {
+         sum_Cnm[ii][jj] = delta_Cnm[ii][jj];
+         sum_Snm[ii][jj] = delta_Snm[ii][jj];
+      }
+   }
+   sum_dC20 = dC20;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
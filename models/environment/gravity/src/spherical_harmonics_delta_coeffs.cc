@@ -25,7 +25,8 @@ Library dependencies:
   ((spherical_harmonics_delta_coeffs.cc)
    (spherical_harmonics_delta_coeffs_init.cc)
    (spherical_harmonics_delta_controls.cc)
-   (spherical_harmonics_gravity_source.cc))
+   (spherical_harmonics_gravity_source.cc)
+   (utils/ref_frames/src/ref_frame.cc))
 
 
 *******************************************************************************/
@@ -36,6 +37,7 @@ Library dependencies:
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/base_dyn_manager.hh"
+#include "environment/ephemerides/ephem_interface/include/ephem_ref_frame.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 
 // Model includes
@@ -60,7 +62,9 @@ SphericalHarmonicsDeltaCoeffs::SphericalHarmonicsDeltaCoeffs (
    delta_Snm(nullptr),
    degree(0),
    order(0),
-   dC20(0.0)
+   dC20(0.0),
+   update_valid(false),
+   update_time(0.0)
 {
    return;
 }
@@ -72,14 +76,8 @@ SphericalHarmonicsDeltaCoeffs::SphericalHarmonicsDeltaCoeffs (
 SphericalHarmonicsDeltaCoeffs::~SphericalHarmonicsDeltaCoeffs (
    void)
 {
-   if (delta_Cnm != nullptr) {
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         JEOD_DELETE_ARRAY (delta_Cnm[ii]);
-         JEOD_DELETE_ARRAY (delta_Snm[ii]);
-      }
-      JEOD_DELETE_ARRAY (delta_Cnm);
-      JEOD_DELETE_ARRAY (delta_Snm);
-   }
+   JEOD_DELETE_PRIM_ROWS (delta_Cnm);
+   JEOD_DELETE_PRIM_ROWS (delta_Snm);
 }
 
 
@@ -97,15 +95,11 @@ SphericalHarmonicsDeltaCoeffs::initialize (
    this->degree = var_init.degree;
    this->order  = var_init.order;
 
-   // Allocate and load up delta_Cnm and delta_Snm
-   if (degree > 0) {
-      delta_Cnm = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-      delta_Snm = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         delta_Cnm[ii] = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-         delta_Snm[ii] = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-      }
+   // Allocate and load up delta_Cnm and delta_Snm. These are summed into
+   // the controls' degree x order arrays, so they have that shape as well.
+   if ((degree > 0) && (order > 0)) {
+      delta_Cnm = JEOD_ALLOC_PRIM_MATRIX (degree, order, double);
+      delta_Snm = JEOD_ALLOC_PRIM_MATRIX (degree, order, double);
 
       for (unsigned int ii = 0; ii < degree; ++ii) {
          for (unsigned int jj = 0; jj < order; ++jj) {
@@ -130,6 +124,23 @@ SphericalHarmonicsDeltaCoeffs::update (
    return;  // Pure virtual; no unique behavior of its own
 }
 
+
+/**
+ * Return the time of the inputs on which update depends. The default is
+ * the timestamp of the source's planet-fixed frame; models that depend on
+ * other frames should extend this.
+ * @return Input time\n Units: s
+ */
+double
+SphericalHarmonicsDeltaCoeffs::input_time (
+   void) const
+{
+   if ((grav_source == nullptr) || (grav_source->pfix == nullptr)) {
+      return 0.0;
+   }
+   return grav_source->pfix->timestamp();
+}
+
 } // End JEOD namespace
 
 /**
@@ -18,12 +18,17 @@ Purpose:
 Library dependencies:
   ((spherical_harmonics_gravity_controls.cc)
    (spherical_harmonics_calc_nonspherical.cc)
+   (spherical_harmonics_calc_nonspherical_blocked.cc)
+   (spherical_harmonics_calc_nonspherical_extended.cc)
+   (spherical_harmonics_calc_nonspherical_lanes.cc)
+   (spherical_harmonics_gravity_grid.cc)
    (gravity_controls.cc)
    (spherical_harmonics_delta_coeffs.cc)
    (spherical_harmonics_delta_controls.cc)
    (spherical_harmonics_gravity_source.cc)
    (gravity_manager.cc)
    (gravity_messages.cc)
+   (utils/memory/src/scratch_arena.cc)
    (utils/message/src/message_handler.cc))
 
 
@@ -31,6 +36,7 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 
@@ -57,8 +63,15 @@ SphericalHarmonicsGravityControls::SphericalHarmonicsGravityControls (
    void)
 :
    min_radius_warn(false),
+   kernel_type(AccelPotential),
+   kernel_gradient(false),
+   kernel_potential(true),
+   lane_pnm(),
+   lane_pnm_degree(0),
+   scratch(),
    harmonics_source(nullptr),
    Pnm(nullptr),
+   pnm_degree(0),
    delta_degree(0),
    delta_order(0),
    delta_Cnm(nullptr),
@@ -68,7 +81,17 @@ SphericalHarmonicsGravityControls::SphericalHarmonicsGravityControls (
    degree(0),
    order(0),
    gradient_degree(0),
-   gradient_order(0)
+   gradient_order(0),
+   blocked_orders(false),
+   extended_range_degree(700),
+   compute_potential(true),
+   use_grid(false),
+   adaptive_degree(false),
+   adaptive_tolerance(1.0e-12),
+   adaptive_hysteresis(0.1),
+   lane_batch(false),
+   offload(nullptr),
+   effective_degree(0)
 {
    JEOD_REGISTER_CLASS (SphericalHarmonicsGravityControls);
    JEOD_REGISTER_CLASS (SphericalHarmonicsDeltaControls);
@@ -90,24 +113,9 @@ SphericalHarmonicsGravityControls::~SphericalHarmonicsGravityControls (
    var_effects.clear();
    JEOD_DEREGISTER_CHECKPOINTABLE (this, var_effects);
 
-   // Array Pnm was allocated to degree/order specified in harmonics body,
-   // which is the size of the entire spherical harmonics model, not to the
-   // to-be-used degree/order specified in this control.
-   if (Pnm != nullptr) {
-      for (unsigned int ii = 0; ii <= harmonics_source->degree; ++ii) {
-         JEOD_DELETE_ARRAY (Pnm[ii]);
-      }
-      JEOD_DELETE_ARRAY (Pnm);
-   }
-
-   if (delta_Cnm != nullptr) {
-      for (unsigned int ii = 0; ii <= delta_degree; ++ii) {
-         JEOD_DELETE_ARRAY (delta_Cnm[ii]);
-         JEOD_DELETE_ARRAY (delta_Snm[ii]);
-      }
-      JEOD_DELETE_ARRAY (delta_Cnm);
-      JEOD_DELETE_ARRAY (delta_Snm);
-   }
+   JEOD_DELETE_PRIM_ROWS (Pnm);
+   JEOD_DELETE_PRIM_ROWS (delta_Cnm);
+   JEOD_DELETE_PRIM_ROWS (delta_Snm);
 
    return;
 }
@@ -133,48 +141,89 @@ SphericalHarmonicsGravityControls::initialize_control (
 
    // If degree > 0 in the gravity body then create and fill Gottlieb
    // LeGendre polynomial array.  Otherwise only spherical gravity available.
-   unsigned int alloc_degree = harmonics_source->degree;
-
-   if (alloc_degree > 0) {
-      Pnm = JEOD_ALLOC_PRIM_ARRAY (alloc_degree + 1, double *);
-      double * int_to_double = JEOD_ALLOC_PRIM_ARRAY (alloc_degree + 2, double);
+   if (harmonics_source->degree > 0) {
+      allocate_legendre ();
 
-      for (unsigned int ii = 0; ii <= alloc_degree; ++ii) {
-         int_to_double[ii] = static_cast<double> (ii);
-         Pnm[ii] = JEOD_ALLOC_PRIM_ARRAY (ii + 3, double);
+      // Tabulate the field if interpolation was requested.
+      if (use_grid) {
+         grid.initialize (*this);
       }
+   }
+
+  return;
+}
 
-      int_to_double[alloc_degree + 1] = static_cast<double> (alloc_degree + 1);
 
+/**
+ * Allocate and seed the Legendre polynomial array through this control's
+ * degree, and have the source build its recursion tables that far.
+ * Both only grow: a control whose degree is lowered keeps its arrays.
+ */
+void
+SphericalHarmonicsGravityControls::allocate_legendre (
+   void)
+{
+   // Row 1 is used to start the recursion even when degree is 0.
+   unsigned int alloc_degree = (degree > 1) ? degree : 1;
+   if (alloc_degree > harmonics_source->degree) {
+      alloc_degree = harmonics_source->degree;
+   }
 
-      // In the code below, the equation numbers and page numbers refer to
-      // the Gottlieb 1993 paper.
+   harmonics_source->require_degree (alloc_degree);
 
-      // Bottom of page 47 and page 48, and see equation (7-8)
-      Pnm[0][0] = 1.0;
-      Pnm[0][1] = 0.0;
-      Pnm[0][2] = 0.0;
-      Pnm[1][1] = sqrt (3.0);
-      Pnm[1][2] = 0.0;
-      Pnm[1][3] = 0.0;
+   // The order recursions need four arrays of alloc_degree+1 rows; the
+   // lane-wise kernel needs batch_lanes elements per row. The
+   // extended-range kernel needs nine arrays of alloc_degree+3 elements.
+   scratch.reserve (
+      std::max (
+         4 * ScratchArena::padded_size ((alloc_degree + 1) * batch_lanes),
+         9 * ScratchArena::padded_size (alloc_degree + 3)));
 
-      // Pages 46-47
-      for (unsigned int ii = 2; ii <= alloc_degree; ++ii) {
+   if ((Pnm != nullptr) && (alloc_degree <= pnm_degree)) {
+      return;
+   }
 
-         // P(n,n) term, equation (7-8)
-         Pnm[ii][ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
-                      / (2.0 * int_to_double[ii])) * Pnm[ii - 1][ii - 1];
+   JEOD_DELETE_PRIM_ROWS (Pnm);
 
-         // P(n,n+1) and P(n,n+2) terms, table 1 (p. 14)
-         Pnm[ii][ii + 1] = 0.0;
-         Pnm[ii][ii + 2] = 0.0;
-      }
+   // Row ii of Pnm holds ii+3 elements: orders 0 to ii plus two zero terms.
+   pnm_degree = alloc_degree;
+   Pnm = JEOD_ALLOC_PRIM_TRIANGLE (alloc_degree + 1, 2, double);
+   double * int_to_double = JEOD_ALLOC_PRIM_ARRAY (alloc_degree + 2, double);
 
-      // Clean up local variable int_to_double (needed to init Pnm above)
-      JEOD_DELETE_ARRAY (int_to_double);
+   for (unsigned int ii = 0; ii <= alloc_degree; ++ii) {
+      int_to_double[ii] = static_cast<double> (ii);
    }
 
-  return;
+   int_to_double[alloc_degree + 1] = static_cast<double> (alloc_degree + 1);
+
+
+   // In the code below, the equation numbers and page numbers refer to
+   // the Gottlieb 1993 paper.
+
+   // Bottom of page 47 and page 48, and see equation (7-8)
+   Pnm[0][0] = 1.0;
+   Pnm[0][1] = 0.0;
+   Pnm[0][2] = 0.0;
+   Pnm[1][1] = sqrt (3.0);
+   Pnm[1][2] = 0.0;
+   Pnm[1][3] = 0.0;
+
+   // Pages 46-47
+   for (unsigned int ii = 2; ii <= alloc_degree; ++ii) {
+
+      // P(n,n) term, equation (7-8)
+      Pnm[ii][ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
+                   / (2.0 * int_to_double[ii])) * Pnm[ii - 1][ii - 1];
+
+      // P(n,n+1) and P(n,n+2) terms, table 1 (p. 14)
+      Pnm[ii][ii + 1] = 0.0;
+      Pnm[ii][ii + 2] = 0.0;
+   }
+
+   // Clean up local variable int_to_double (needed to init Pnm above)
+   JEOD_DELETE_ARRAY (int_to_double);
+
+   return;
 }
 
 
@@ -197,25 +246,14 @@ SphericalHarmonicsGravityControls::add_deltacontrol (
    if ((temp_deltacoeff->degree > delta_degree) ||
        (temp_deltacoeff->order > delta_order)) {
 
-      unsigned int new_degree = temp_deltacoeff->degree;
-      unsigned int new_order = temp_deltacoeff->order;
+      unsigned int new_degree = std::max (temp_deltacoeff->degree, delta_degree);
+      unsigned int new_order = std::max (temp_deltacoeff->order, delta_order);
 
-      if (delta_Cnm != nullptr) {
-         for (unsigned int ii = 0; ii < delta_degree; ++ii) {
-            JEOD_DELETE_ARRAY (delta_Cnm[ii]);
-            JEOD_DELETE_ARRAY (delta_Snm[ii]);
-         }
-         JEOD_DELETE_ARRAY (delta_Cnm);
-         JEOD_DELETE_ARRAY (delta_Snm);
-      }
+      JEOD_DELETE_PRIM_ROWS (delta_Cnm);
+      JEOD_DELETE_PRIM_ROWS (delta_Snm);
 
-      delta_Cnm = JEOD_ALLOC_PRIM_ARRAY (new_degree, double *);
-      delta_Snm = JEOD_ALLOC_PRIM_ARRAY (new_degree, double *);
-
-      for (unsigned int ii = 0; ii < new_degree; ++ii) {
-         delta_Cnm[ii] = JEOD_ALLOC_PRIM_ARRAY (new_order, double);
-         delta_Snm[ii] = JEOD_ALLOC_PRIM_ARRAY (new_order, double);
-      }
+      delta_Cnm = JEOD_ALLOC_PRIM_MATRIX (new_degree, new_order, double);
+      delta_Snm = JEOD_ALLOC_PRIM_MATRIX (new_degree, new_order, double);
    }
 
    // Update top-level max degree & order and array size if needed
@@ -522,6 +560,31 @@ SphericalHarmonicsGravityControls::check_validity (
       }
    }
 
+   // Grow the Legendre and recursion tables if the degree was raised after
+   // initialization.
+   if (Pnm != nullptr) {
+      allocate_legendre ();
+   }
+
+   // Choose the kernel that computes exactly what the settings require.
+   select_kernel ();
+
+   // Restart the adaptive degree from the full degree.
+   effective_degree = degree;
+
+   if (adaptive_degree &&
+       ((adaptive_tolerance <= 0.0) || (adaptive_tolerance >= 1.0) ||
+        (adaptive_hysteresis <= 0.0) || (adaptive_hysteresis > 1.0))) {
+      MessageHandler::error (
+         __FILE__, __LINE__, GravityMessages::invalid_limit,
+         "Adaptive degree tolerance (%g) and hysteresis (%g) for %s must be "
+         "in (0,1) and (0,1].\n"
+         "Disabling the adaptive degree.",
+         adaptive_tolerance, adaptive_hysteresis,
+         harmonics_source->name.c_str());
+      adaptive_degree = false;
+   }
+
    return;
 }
 
@@ -536,10 +599,22 @@ SphericalHarmonicsGravityControls::update_deltacoeffs (
 {
    // Iterate over the list of delta-controls, telling each to update itself
    unsigned int n_deltacoeffs = harmonics_source->delta_coeffs.size();
+   bool shared = harmonics_source->delta_cache.enabled;
 
    for (unsigned int ii = 0; ii < n_deltacoeffs; ++ii) {
       if (var_effects[ii]->active) {
-         harmonics_source->delta_coeffs[ii]->update (*this);
+         SphericalHarmonicsDeltaCoeffs * effect =
+            harmonics_source->delta_coeffs[ii];
+
+         // With the shared cache, an effect that has already been updated
+         // for its current inputs (by this or any other control) is skipped.
+         if (shared && effect->is_current()) {
+            continue;
+         }
+         effect->update (*this);
+         if (shared) {
+            effect->mark_current ();
+         }
       }
    }
 
@@ -560,6 +635,32 @@ SphericalHarmonicsGravityControls::sum_deltacoeffs (
    unsigned int n_deltacoeffs = harmonics_source->delta_coeffs.size();
    SphericalHarmonicsDeltaControls * temp_delta_control;
    SphericalHarmonicsDeltaCoeffs * temp_deltacoeff;
+   SphericalHarmonicsDeltaCache & cache = harmonics_source->delta_cache;
+   double input_time = 0.0;
+
+   // Reuse the shared sum if it was made at the same time from the same
+   // delta-control settings.
+   if (cache.enabled) {
+      delta_key.clear();
+      delta_key.push_back (delta_degree);
+      delta_key.push_back (delta_order);
+      for (unsigned int ii = 0; ii < n_deltacoeffs; ++ii) {
+         temp_delta_control = var_effects[ii];
+         delta_key.push_back (temp_delta_control->active ? 1 : 0);
+         delta_key.push_back (temp_delta_control->first_order_only ? 1 : 0);
+         delta_key.push_back (temp_delta_control->degree);
+         delta_key.push_back (temp_delta_control->order);
+         if (temp_delta_control->active &&
+             (temp_delta_control->grav_effect->update_time > input_time)) {
+            input_time = temp_delta_control->grav_effect->update_time;
+         }
+      }
+
+      if (cache.matches (input_time, delta_key)) {
+         cache.retrieve (total_dC20, delta_Cnm, delta_Snm);
+         return;
+      }
+   }
 
    // Zero out Cnm, Snm elements and top-level dC20 term
    total_dC20 = 0.0;
@@ -592,6 +693,11 @@ SphericalHarmonicsGravityControls::sum_deltacoeffs (
       }
    }
 
+   if (cache.enabled) {
+      cache.store (input_time, delta_key, total_dC20, delta_Cnm, delta_Snm,
+                   delta_degree, delta_order);
+   }
+
    return;
 }
 
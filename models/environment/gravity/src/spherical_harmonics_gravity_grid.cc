@@ -0,0 +1,450 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_gravity_grid.cc
+ * Define member functions for the SphericalHarmonicsGravityGrid class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((spherical_harmonics_gravity_grid.cc)
+   (spherical_harmonics_gravity_controls.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (gravity_messages.cc)
+   (utils/memory/src/memory_manager_static.cc)
+   (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/checkpoint_reconstructor.cc)
+   (utils/sim_interface/src/simulation_interface.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/memory_manager.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/simulation_interface.hh"
+
+// Model includes
+#include "../include/spherical_harmonics_gravity_grid.hh"
+#include "../include/spherical_harmonics_gravity_controls.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+#include "../include/gravity_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Number of values tabulated per node: three acceleration components and
+ * the potential.
+ */
+const unsigned int node_size = 4;
+
+
+/**
+ * Van der Corput radical inverse of index in the given base, used to place
+ * the check points.
+ * @return Value in [0,1).
+ * \param[in] index Sequence index
+ * \param[in] base Prime base
+ */
+double
+radical_inverse (
+   unsigned int index,
+   unsigned int base)
+{
+   double inv_base = 1.0 / base;
+   double scale = inv_base;
+   double result = 0.0;
+   while (index > 0) {
+      result += (index % base) * scale;
+      index /= base;
+      scale *= inv_base;
+   }
+   return result;
+}
+
+
+/**
+ * Locate a coordinate in a uniform grid and compute the four-point Lagrange
+ * weights of the stencil base-1 .. base+2.
+ * \param[in] u Coordinate in units of the node spacing
+ * \param[in] lo Smallest allowed base index
+ * \param[in] hi Largest allowed base index
+ * \param[out] base Stencil base index
+ * \param[out] weight Weights of the four stencil nodes
+ */
+void
+lagrange_weights (
+   double u,
+   int lo,
+   int hi,
+   int & base,
+   double weight[4])
+{
+   base = static_cast<int> (std::floor (u));
+   if (base < lo) {
+      base = lo;
+   }
+   else if (base > hi) {
+      base = hi;
+   }
+   double t = u - base;
+   double tp1 = t + 1.0;
+   double tm1 = t - 1.0;
+   double tm2 = t - 2.0;
+   weight[0] = -t * tm1 * tm2 / 6.0;
+   weight[1] = tp1 * tm1 * tm2 / 2.0;
+   weight[2] = -tp1 * t * tm2 / 2.0;
+   weight[3] = tp1 * t * tm1 / 6.0;
+}
+
+}
+
+
+/**
+ * SphericalHarmonicsGravityGrid default constructor.
+ */
+SphericalHarmonicsGravityGrid::SphericalHarmonicsGravityGrid ()
+:
+   num_radial(0),
+   num_colatitude(0),
+   num_longitude(0),
+   radius_min(0.0),
+   radius_max(0.0),
+   error_budget(1.0e-9),
+   num_check_points(1000),
+   max_error(0.0),
+   rms_error(0.0),
+   valid(false),
+   delta_radius(0.0),
+   delta_colatitude(0.0),
+   delta_longitude(0.0),
+   node_data(nullptr),
+   tabulated_controls(nullptr)
+{
+   Vector3::initialize (max_error_posn);
+}
+
+
+/**
+ * SphericalHarmonicsGravityGrid destructor.
+ */
+SphericalHarmonicsGravityGrid::~SphericalHarmonicsGravityGrid ()
+{
+   release ();
+}
+
+
+/**
+ * Release the table.
+ */
+void
+SphericalHarmonicsGravityGrid::release (
+   void)
+{
+   if (node_data != nullptr) {
+      JEOD_DELETE_ARRAY (node_data);
+      node_data = nullptr;
+   }
+   tabulated_controls = nullptr;
+   valid = false;
+}
+
+
+/**
+ * Number of doubles in the table.
+ * @return Table size
+ */
+std::size_t
+SphericalHarmonicsGravityGrid::table_size (
+   void)
+const
+{
+   return static_cast<std::size_t> (node_size) *
+          num_radial * num_colatitude * num_longitude;
+}
+
+
+/**
+ * Tabulate the static non-spherical field of the given control at the grid
+ * nodes and check the interpolant against the series.
+ * \param[in] controls Control whose degree and order define the field
+ */
+void
+SphericalHarmonicsGravityGrid::initialize (
+   SphericalHarmonicsGravityControls & controls)
+{
+   const SphericalHarmonicsGravitySource & src = *controls.harmonics_source;
+
+   release ();
+
+   if ((num_radial < 4) || (num_colatitude < 4) ||
+       (num_longitude < 8) || ((num_longitude % 2) != 0)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, GravityMessages::invalid_limit,
+         "Gravity grid for %s needs at least 4 radial shells, 4 colatitudes "
+         "and an even number (at least 8) of longitudes; %u x %u x %u given.",
+         src.name.c_str(), num_radial, num_colatitude, num_longitude);
+      return;
+   }
+
+   if (!((radius_min > 0.0) && (radius_max > radius_min))) {
+      MessageHandler::error (
+         __FILE__, __LINE__, GravityMessages::invalid_limit,
+         "Gravity grid for %s has an invalid radial range [%g, %g].",
+         src.name.c_str(), radius_min, radius_max);
+      return;
+   }
+
+   delta_radius = (radius_max - radius_min) / (num_radial - 1);
+   delta_colatitude = M_PI / (num_colatitude - 1);
+   delta_longitude = 2.0 * M_PI / num_longitude;
+
+   node_data = JEOD_ALLOC_PRIM_ARRAY (table_size(), double);
+   tabulate (controls);
+
+   // The table need not be checkpointed when it can be rebuilt; that takes
+   // a name for the control that is the same from run to run.
+   const JeodMemoryTypeDescriptor * controls_type =
+      JeodMemoryManager::get_type_descriptor (typeid(controls));
+   std::string controls_name;
+   if (controls_type != nullptr) {
+      controls_name = JeodSimulationInterface::get_name_at_address (
+                         &controls, controls_type);
+   }
+   if ((! controls_name.empty()) && (controls_name != "NULL")) {
+      JEOD_SET_RECONSTRUCTIBLE (
+         node_data, "gravity_grid:" + controls_name, *this);
+   }
+
+   // Check the interpolant at quasi-random points in the grid volume.
+   double sum_sq = 0.0;
+   max_error = 0.0;
+   for (unsigned int ii = 1; ii <= num_check_points; ++ii) {
+      double r_mag = radius_min +
+                     radical_inverse (ii, 2) * (radius_max - radius_min);
+      double cos_colat = 1.0 - 2.0 * radical_inverse (ii, 3);
+      double sin_colat = std::sqrt (1.0 - cos_colat * cos_colat);
+      double lon = -M_PI + 2.0 * M_PI * radical_inverse (ii, 5);
+      double posn_pf[3];
+      posn_pf[0] = r_mag * sin_colat * std::cos (lon);
+      posn_pf[1] = r_mag * sin_colat * std::sin (lon);
+      posn_pf[2] = r_mag * cos_colat;
+
+      double exact[3];
+      double exact_pot;
+      double interp[3];
+      double interp_pot;
+      double diff[3];
+      controls.calc_nonspherical_static (posn_pf, exact, exact_pot);
+      interpolate (posn_pf, interp, interp_pot);
+      Vector3::diff (interp, exact, diff);
+
+      double error = Vector3::vmag (diff) * r_mag * r_mag / src.mu;
+      sum_sq += error * error;
+      if (error > max_error) {
+         max_error = error;
+         Vector3::copy (posn_pf, max_error_posn);
+      }
+   }
+   rms_error = (num_check_points > 0) ?
+               std::sqrt (sum_sq / num_check_points) : 0.0;
+
+   valid = (max_error <= error_budget);
+
+   if (valid) {
+      MessageHandler::inform (
+         __FILE__, __LINE__, GravityMessages::interpolation_error,
+         "Gravity grid for %s: %u x %u x %u nodes, %u check points, "
+         "max error %g, rms error %g (budget %g).",
+         src.name.c_str(), num_radial, num_colatitude, num_longitude,
+         num_check_points, max_error, rms_error, error_budget);
+   }
+   else {
+      MessageHandler::warn (
+         __FILE__, __LINE__, GravityMessages::interpolation_error,
+         "Gravity grid for %s exceeds its error budget: max error %g "
+         "(rms %g, budget %g) at planet-fixed position (%g, %g, %g). "
+         "The grid will not be used.",
+         src.name.c_str(), max_error, rms_error, error_budget,
+         max_error_posn[0], max_error_posn[1], max_error_posn[2]);
+   }
+}
+
+
+/**
+ * Evaluate the static non-spherical field of the given control at the grid
+ * nodes, filling the table.
+ * \param[in] controls Control whose degree and order define the field
+ */
+void
+SphericalHarmonicsGravityGrid::tabulate (
+   SphericalHarmonicsGravityControls & controls)
+{
+   tabulated_controls = &controls;
+
+   double * entry = node_data;
+   for (unsigned int ir = 0; ir < num_radial; ++ir) {
+      double r_mag = radius_min + ir * delta_radius;
+      for (unsigned int ic = 0; ic < num_colatitude; ++ic) {
+         double colat = ic * delta_colatitude;
+         double sin_colat = std::sin (colat);
+         double cos_colat = std::cos (colat);
+         for (unsigned int il = 0; il < num_longitude; ++il) {
+            double lon = -M_PI + il * delta_longitude;
+            double posn_pf[3];
+            posn_pf[0] = r_mag * sin_colat * std::cos (lon);
+            posn_pf[1] = r_mag * sin_colat * std::sin (lon);
+            posn_pf[2] = r_mag * cos_colat;
+            controls.calc_nonspherical_static (posn_pf, entry, entry[3]);
+            entry += node_size;
+         }
+      }
+   }
+}
+
+
+/**
+ * Rebuild the table in the allocation recreated by a restart. The grid
+ * settings and the node spacing are restored with the rest of the object;
+ * only the table itself was left out of the checkpoint.
+ * @return True if the table was rebuilt
+ * \param[in] reference Table reference (unused)
+ * \param[in] addr Recreated table
+ * \param[in] size Size of the recreated table, in bytes
+ */
+bool
+SphericalHarmonicsGravityGrid::reconstruct_contents (
+   const std::string & reference JEOD_UNUSED,
+   void * addr,
+   std::size_t size)
+{
+   if ((tabulated_controls == nullptr) ||
+       (size != table_size() * sizeof(double))) {
+      return false;
+   }
+
+   node_data = static_cast<double *> (addr);
+   tabulate (*tabulated_controls);
+
+   return true;
+}
+
+
+/**
+ * Return the tabulated values at a node. The colatitude index may extend
+ * past either pole, in which case the node on the opposite meridian is used;
+ * the longitude index is periodic.
+ * @return Pointer to the four node values.
+ * \param[in] ir Radial index
+ * \param[in] ic Colatitude index
+ * \param[in] il Longitude index
+ */
+const double *
+SphericalHarmonicsGravityGrid::node (
+   int ir,
+   int ic,
+   int il) const
+{
+   int nc = static_cast<int> (num_colatitude);
+   int nl = static_cast<int> (num_longitude);
+
+   if (ic < 0) {
+      ic = -ic;
+      il += nl / 2;
+   }
+   else if (ic > nc - 1) {
+      ic = 2 * (nc - 1) - ic;
+      il += nl / 2;
+   }
+   il %= nl;
+   if (il < 0) {
+      il += nl;
+   }
+
+   return node_data + node_size * ((ir * nc + ic) * nl + il);
+}
+
+
+/**
+ * Interpolate the non-spherical field at a planet-fixed position.
+ * The position must be within the tabulated shells (see contains).
+ * \param[in] posn_pf Position, planet-fixed coords\n Units: M
+ * \param[out] accel_pf Acceleration, planet-fixed coords\n Units: M/s2
+ * \param[out] pot Potential\n Units: M2/s2
+ */
+void
+SphericalHarmonicsGravityGrid::interpolate (
+   const double posn_pf[3],
+   double accel_pf[3],
+   double & pot) const
+{
+   double rho = std::sqrt (posn_pf[0] * posn_pf[0] + posn_pf[1] * posn_pf[1]);
+   double r_mag = std::sqrt (rho * rho + posn_pf[2] * posn_pf[2]);
+   double colat = std::atan2 (rho, posn_pf[2]);
+   double lon = std::atan2 (posn_pf[1], posn_pf[0]);
+
+   int base_r;
+   int base_c;
+   int base_l;
+   double w_r[4];
+   double w_c[4];
+   double w_l[4];
+
+   // Radial stencils stay inside the shells; the others wrap.
+   lagrange_weights ((r_mag - radius_min) / delta_radius,
+                     1, static_cast<int> (num_radial) - 3, base_r, w_r);
+   lagrange_weights (colat / delta_colatitude,
+                     0, static_cast<int> (num_colatitude) - 2, base_c, w_c);
+   lagrange_weights ((lon + M_PI) / delta_longitude,
+                     0, static_cast<int> (num_longitude) - 1, base_l, w_l);
+
+   double sum[node_size] = {0.0, 0.0, 0.0, 0.0};
+   for (int ir = 0; ir < 4; ++ir) {
+      for (int ic = 0; ic < 4; ++ic) {
+         double w_rc = w_r[ir] * w_c[ic];
+         for (int il = 0; il < 4; ++il) {
+            const double * values =
+               node (base_r + ir - 1, base_c + ic - 1, base_l + il - 1);
+            double w = w_rc * w_l[il];
+            sum[0] += w * values[0];
+            sum[1] += w * values[1];
+            sum[2] += w * values[2];
+            sum[3] += w * values[3];
+         }
+      }
+   }
+
+   accel_pf[0] = sum[0];
+   accel_pf[1] = sum[1];
+   accel_pf[2] = sum[2];
+   pot = sum[3];
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
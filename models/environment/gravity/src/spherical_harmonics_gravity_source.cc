@@ -20,10 +20,14 @@ Library dependencies:
    (gravity_source.cc)
    (spherical_harmonics_delta_coeffs.cc)
    (spherical_harmonics_delta_coeffs_init.cc)
+   (spherical_harmonics_delta_cache.cc)
+   (spherical_harmonics_coeff_file.cc)
    (gravity_manager.cc)
    (gravity_messages.cc)
    (environment/ephemerides/ephem_interface/src/ephem_ref_frame.cc)
-   (utils/message/src/message_handler.cc))
+   (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/data_module_loader.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
 
 *******************************************************************************/
@@ -32,6 +36,7 @@ Library dependencies:
 // System includes
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <typeinfo>
 
@@ -41,6 +46,8 @@ Library dependencies:
 #include "utils/math/include/numerical.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/data_module_loader.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/spherical_harmonics_delta_coeffs.hh"
@@ -75,7 +82,11 @@ SphericalHarmonicsGravitySource::SphericalHarmonicsGravitySource (
    zeta(nullptr),
    upsilon(nullptr),
    nrdiag(nullptr),
-   int_to_double(nullptr)
+   int_to_double(nullptr),
+   packed_terms(nullptr),
+   lazy_tables(true),
+   table_degree(0),
+   packed_storage(nullptr)
 {
    JEOD_REGISTER_CLASS (SphericalHarmonicsGravitySource);
    JEOD_REGISTER_CLASS (SphericalHarmonicsDeltaCoeffs);
@@ -92,165 +103,346 @@ SphericalHarmonicsGravitySource::~SphericalHarmonicsGravitySource (
 {
 
    JEOD_DEREGISTER_CHECKPOINTABLE (this, delta_coeffs);
-   if (xi != nullptr) {
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         JEOD_DELETE_ARRAY (xi[ii]);
-         JEOD_DELETE_ARRAY (eta[ii]);
-         JEOD_DELETE_ARRAY (zeta[ii]);
-         JEOD_DELETE_ARRAY (upsilon[ii]);
+
+   release_tables ();
+
+   // Rows that point into a mapped coefficient file are not allocations.
+   if (coeff_file.is_mapped()) {
+      if (JEOD_IS_ALLOCATED (Snm)) {
+         JEOD_DELETE_ARRAY (Snm);
+         JEOD_DELETE_ARRAY (Cnm);
       }
-      JEOD_DELETE_ARRAY (a_by_rad);
-      JEOD_DELETE_ARRAY (alpha);
-      JEOD_DELETE_ARRAY (beta);
-      JEOD_DELETE_ARRAY (xi);
-      JEOD_DELETE_ARRAY (eta);
-      JEOD_DELETE_ARRAY (zeta);
-      JEOD_DELETE_ARRAY (upsilon);
-      JEOD_DELETE_ARRAY (nrdiag);
-      JEOD_DELETE_ARRAY (int_to_double);
+   }
+   else {
+      release_coeff_rows (Snm);
+      release_coeff_rows (Cnm);
+   }
+
+   return;
+}
+
+
+/**
+ * Release a coefficient triangle. The data files allocate the triangle with
+ * JEOD_ALLOC_PRIM_TRIANGLE, but a user-written data file may instead
+ * allocate each row separately, possibly leaving some rows null. Only a
+ * triangle whose rows lie back to back in one allocation is freed as such;
+ * otherwise each allocated row is freed in turn.
+ * \param[in,out] coeffs Coefficient triangle, null on return
+ */
+void
+SphericalHarmonicsGravitySource::release_coeff_rows (
+   double ** & coeffs)
+{
+   if (! JEOD_IS_ALLOCATED (coeffs)) {
+      return;
    }
 
-   if (JEOD_IS_ALLOCATED (Snm)) {
+   if (jeod_alloc_rows_are_linked (coeffs, degree+1, 1, 1) &&
+       JEOD_IS_ALLOCATED (coeffs[0])) {
+      JEOD_DELETE_PRIM_ROWS (coeffs);
+   }
+   else {
       for (unsigned int ii = 0; ii <= degree; ++ii) {
-         JEOD_DELETE_ARRAY (Snm[ii]);
-         JEOD_DELETE_ARRAY (Cnm[ii]);
+         if (JEOD_IS_ALLOCATED (coeffs[ii])) {
+            JEOD_DELETE_ARRAY (coeffs[ii]);
+         }
       }
-      JEOD_DELETE_ARRAY (Snm);
-      JEOD_DELETE_ARRAY (Cnm);
+      JEOD_DELETE_ARRAY (coeffs);
    }
+}
+
 
+/**
+ * Initialize the name, mu, radius, degree, order and coefficients from a
+ * binary coefficient file, mapping the file read-only. Use this in place of
+ * a compiled-in default data initializer, before initialize_body.
+ * \param[in] path Binary coefficient file
+ */
+void
+SphericalHarmonicsGravitySource::map_coefficient_file (
+   const std::string & path)
+{
+   coeff_file.map_file (path, *this);
+   return;
+}
+
+
+/**
+ * Initialize the name, mu, radius, degree, order and coefficients from a
+ * data module built from one of the gravity default data sets (e.g.,
+ * "earth_GGM05C"). Like map_coefficient_file, use this in place of a
+ * compiled-in default data initializer, before initialize_body.
+ * \param[in] module_name Data module name or path
+ */
+void
+SphericalHarmonicsGravitySource::load_data_module (
+   const std::string & module_name)
+{
+   DataModuleLoader::initialize (
+      module_name, "SphericalHarmonicsGravitySource", this);
    return;
 }
 
 
 /**
  * Initialize Gottlieb gravity coefficients.
+ * Unless lazy_tables is cleared, the recursion tables are not built here but
+ * by require_degree, to the degree that the controls of this source use.
  */
 void
 SphericalHarmonicsGravitySource::initialize_body (
    void)
 {
-
-   // If degree > 0 then create and fill Gottlieb coefficient arrays.
+   // If degree > 0 then the Gottlieb coefficient arrays can be built.
    // Otherwise, only spherical gravity can be used.
-   if (degree > 0) {
-      double num1;
-      double den1;
-      double num2;
-      double den2;
-      double ** Pnm;
-
-      Pnm  = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-
-      a_by_rad      = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double);
-      alpha         = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double);
-      beta          = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double);
-      xi            = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-      eta           = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-      zeta          = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-      upsilon       = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-      nrdiag        = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double);
-      int_to_double = JEOD_ALLOC_PRIM_ARRAY (degree + 2, double);
+   if ((degree > 0) && (!lazy_tables)) {
+      build_tables (degree);
+   }
+
+   return;
+}
 
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         Pnm[ii]           = JEOD_ALLOC_PRIM_ARRAY (ii + 3, double);
-         xi[ii]            = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-         eta[ii]           = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-         zeta[ii]          = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-         upsilon[ii]       = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-         int_to_double[ii] = static_cast<double> (ii);
-      }
 
-      int_to_double[degree + 1] = static_cast<double> (degree + 1);
-
-
-      // In the code below, the equation numbers and page numbers refer to
-      // the Gottlieb 1993 paper.
-
-      // Bottom of page 47 and page 48, and see equation (7-8)
-      Pnm[0][0] = 1.0;
-      Pnm[0][1] = 0.0;
-      Pnm[0][2] = 0.0;
-      Pnm[1][1] = sqrt (3.0);
-      Pnm[1][2] = 0.0;
-      Pnm[1][3] = 0.0;
-
-      // Pages 46-47
-      for (unsigned int ii = 2; ii <= degree; ++ii) {
-         for (unsigned int jj = 0; jj <= (ii - 1); ++jj) {
-            // Equation (7-10)
-            num1 = (2.0 * int_to_double[ii] - 1.0)
-                      * (2.0 * int_to_double[ii] + 1.0);
-            den1 = (int_to_double[ii] + int_to_double[jj])
-                      * (int_to_double[ii] - int_to_double[jj]);
-            xi[ii][jj] = sqrt (num1 / den1);
-
-            // Equation (7-10)
-            num2 = (2.0 * int_to_double[ii] + 1.0)
-                      * (int_to_double[ii] + int_to_double[jj] - 1.0)
-                      * (int_to_double[ii] - int_to_double[jj] - 1.0);
-            den2 = (int_to_double[ii] + int_to_double[jj])
-                      * (int_to_double[ii] - int_to_double[jj])
-                      * (2.0 * int_to_double[ii] - 3.0);
-            if (std::fpclassify(num2) == FP_ZERO) {
-               eta[ii][jj] = 0.0;
-            }
-            else {
-               eta[ii][jj] = sqrt (num2 / den2);
-            }
+/**
+ * Ensure that the recursion tables and packed coefficients extend through
+ * the given degree (at most the model degree), rebuilding them if they do
+ * not. Called by SphericalHarmonicsGravityControls whenever a control's
+ * degree is set.
+ * \param[in] needed_degree Highest degree that will be evaluated
+ */
+void
+SphericalHarmonicsGravitySource::require_degree (
+   unsigned int needed_degree)
+{
+   if (needed_degree > degree) {
+      needed_degree = degree;
+   }
+
+   // Row 1 is used to start the Legendre recursion.
+   if (needed_degree < 1) {
+      needed_degree = 1;
+   }
+
+   if ((degree > 0) && ((xi == nullptr) || (needed_degree > table_degree))) {
+      build_tables (needed_degree);
+   }
+
+   return;
+}
+
+
+/**
+ * Free the recursion tables and packed coefficient block.
+ */
+void
+SphericalHarmonicsGravitySource::release_tables (
+   void)
+{
+   if (packed_storage != nullptr) {
+      JEOD_DELETE_ARRAY (packed_storage);
+      packed_terms = nullptr;
+   }
+
+   if (xi != nullptr) {
+      JEOD_DELETE_ARRAY (a_by_rad);
+      JEOD_DELETE_ARRAY (alpha);
+      JEOD_DELETE_ARRAY (beta);
+      JEOD_DELETE_PRIM_ROWS (xi);
+      JEOD_DELETE_PRIM_ROWS (eta);
+      JEOD_DELETE_PRIM_ROWS (zeta);
+      JEOD_DELETE_PRIM_ROWS (upsilon);
+      JEOD_DELETE_ARRAY (nrdiag);
+      JEOD_DELETE_ARRAY (int_to_double);
+   }
+
+   table_degree = 0;
+
+   return;
+}
+
+
+/**
+ * Build the Gottlieb recursion tables and the packed coefficient block
+ * through degree new_degree, replacing any existing tables.
+ * \param[in] new_degree Table degree, between 1 and degree
+ */
+void
+SphericalHarmonicsGravitySource::build_tables (
+   unsigned int new_degree)
+{
+   JEOD_PROFILE_SCOPE (
+      "gravity", "SphericalHarmonicsGravitySource::build_tables");
+
+   double num1;
+   double den1;
+   double num2;
+   double den2;
+   double ** Pnm;
+
+   release_tables ();
+   table_degree = new_degree;
+
+   Pnm  = JEOD_ALLOC_PRIM_TRIANGLE (table_degree + 1, 2, double);
+
+   a_by_rad      = JEOD_ALLOC_PRIM_ARRAY (table_degree + 1, double);
+   alpha         = JEOD_ALLOC_PRIM_ARRAY (table_degree + 1, double);
+   beta          = JEOD_ALLOC_PRIM_ARRAY (table_degree + 1, double);
+   xi            = JEOD_ALLOC_PRIM_TRIANGLE (table_degree + 1, 0, double);
+   eta           = JEOD_ALLOC_PRIM_TRIANGLE (table_degree + 1, 0, double);
+   zeta          = JEOD_ALLOC_PRIM_TRIANGLE (table_degree + 1, 0, double);
+   upsilon       = JEOD_ALLOC_PRIM_TRIANGLE (table_degree + 1, 0, double);
+   nrdiag        = JEOD_ALLOC_PRIM_ARRAY (table_degree + 1, double);
+   int_to_double = JEOD_ALLOC_PRIM_ARRAY (table_degree + 2, double);
+
+   for (unsigned int ii = 0; ii <= table_degree; ++ii) {
+      int_to_double[ii] = static_cast<double> (ii);
+   }
+
+   int_to_double[table_degree + 1] = static_cast<double> (table_degree + 1);
+
+
+   // In the code below, the equation numbers and page numbers refer to
+   // the Gottlieb 1993 paper.
+
+   // Bottom of page 47 and page 48, and see equation (7-8)
+   Pnm[0][0] = 1.0;
+   Pnm[0][1] = 0.0;
+   Pnm[0][2] = 0.0;
+   Pnm[1][1] = sqrt (3.0);
+   Pnm[1][2] = 0.0;
+   Pnm[1][3] = 0.0;
+
+   // Pages 46-47
+   for (unsigned int ii = 2; ii <= table_degree; ++ii) {
+      for (unsigned int jj = 0; jj <= (ii - 1); ++jj) {
+         // Equation (7-10)
+         num1 = (2.0 * int_to_double[ii] - 1.0)
+                   * (2.0 * int_to_double[ii] + 1.0);
+         den1 = (int_to_double[ii] + int_to_double[jj])
+                   * (int_to_double[ii] - int_to_double[jj]);
+         xi[ii][jj] = sqrt (num1 / den1);
+
+         // Equation (7-10)
+         num2 = (2.0 * int_to_double[ii] + 1.0)
+                   * (int_to_double[ii] + int_to_double[jj] - 1.0)
+                   * (int_to_double[ii] - int_to_double[jj] - 1.0);
+         den2 = (int_to_double[ii] + int_to_double[jj])
+                   * (int_to_double[ii] - int_to_double[jj])
+                   * (2.0 * int_to_double[ii] - 3.0);
+         if (std::fpclassify(num2) == FP_ZERO) {
+            eta[ii][jj] = 0.0;
          }
+         else {
+            eta[ii][jj] = sqrt (num2 / den2);
+         }
+      }
 
-         for (unsigned int jj = 0; jj <= ii; ++jj) {
-            if (ii == jj) {
-               zeta[ii][jj] = 0.0;
-               upsilon[ii][jj] = 0.0;
-            }
-            else if (jj == 0) {
-               // Equation (7-19)
-               zeta[ii][0] = sqrt (int_to_double[ii]
-                      * (int_to_double[ii] + 1.0) / 2.0);
-               // Equation (7-22)
-               upsilon[ii][0] = sqrt (int_to_double[ii]
-                      * (int_to_double[ii] - 1.0) * (int_to_double[ii] + 1.0)
-                      * (int_to_double[ii] + 2.0) / 2.0);
-            }
-            else {
-               // Equation (7-19)
-               zeta[ii][jj] = sqrt ((int_to_double[ii] - int_to_double[jj])
-                      * (int_to_double[ii] + int_to_double[jj] + 1.0));
-               // Equation (7-22)
-               upsilon[ii][jj] = sqrt ((int_to_double[ii] - int_to_double[jj])
-                      * (int_to_double[ii] + int_to_double[jj] + 1.0)
-                      * (int_to_double[ii] - int_to_double[jj] - 1.0)
-                      * (int_to_double[ii] + int_to_double[jj] + 2.0));
-            }
+      for (unsigned int jj = 0; jj <= ii; ++jj) {
+         if (ii == jj) {
+            zeta[ii][jj] = 0.0;
+            upsilon[ii][jj] = 0.0;
          }
+         else if (jj == 0) {
+            // Equation (7-19)
+            zeta[ii][0] = sqrt (int_to_double[ii]
+                   * (int_to_double[ii] + 1.0) / 2.0);
+            // Equation (7-22)
+            upsilon[ii][0] = sqrt (int_to_double[ii]
+                   * (int_to_double[ii] - 1.0) * (int_to_double[ii] + 1.0)
+                   * (int_to_double[ii] + 2.0) / 2.0);
+         }
+         else {
+            // Equation (7-19)
+            zeta[ii][jj] = sqrt ((int_to_double[ii] - int_to_double[jj])
+                   * (int_to_double[ii] + int_to_double[jj] + 1.0));
+            // Equation (7-22)
+            upsilon[ii][jj] = sqrt ((int_to_double[ii] - int_to_double[jj])
+                   * (int_to_double[ii] + int_to_double[jj] + 1.0)
+                   * (int_to_double[ii] - int_to_double[jj] - 1.0)
+                   * (int_to_double[ii] + int_to_double[jj] + 2.0));
+         }
+      }
 
-         // P(n,n) term, equation (7-8)
-         Pnm[ii][ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
-                      / (2.0 * int_to_double[ii])) * Pnm[ii - 1][ii - 1];
+      // P(n,n) term, equation (7-8)
+      Pnm[ii][ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
+                   / (2.0 * int_to_double[ii])) * Pnm[ii - 1][ii - 1];
 
-         // P(n,n+1) and P(n,n+2) terms, table 1 (p. 14)
-         Pnm[ii][ii + 1] = 0.0;
-         Pnm[ii][ii + 2] = 0.0;
+      // P(n,n+1) and P(n,n+2) terms, table 1 (p. 14)
+      Pnm[ii][ii + 1] = 0.0;
+      Pnm[ii][ii + 2] = 0.0;
 
-         // Equation (7-15) and (7-16)
-         nrdiag[ii] = sqrt (2.0 * int_to_double[ii] + 1.0) * Pnm[ii - 1][ii - 1];
+      // Equation (7-15) and (7-16)
+      nrdiag[ii] = sqrt (2.0 * int_to_double[ii] + 1.0) * Pnm[ii - 1][ii - 1];
 
-         // Equation (7-13)
-         alpha[ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
-                      * (2.0 * int_to_double[ii] - 1.0)) / int_to_double[ii];
-         beta[ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
-                      / (2.0 * int_to_double[ii] - 3.0))
-                      * (int_to_double[ii] - 1.0) / int_to_double[ii];
-      }
+      // Equation (7-13)
+      alpha[ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
+                   * (2.0 * int_to_double[ii] - 1.0)) / int_to_double[ii];
+      beta[ii] = sqrt ((2.0 * int_to_double[ii] + 1.0)
+                   / (2.0 * int_to_double[ii] - 3.0))
+                   * (int_to_double[ii] - 1.0) / int_to_double[ii];
+   }
 
 
-      // Clean up local variable Pnm (needed to init nrdiag above)
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         JEOD_DELETE_ARRAY (Pnm[ii]);
+   // Clean up local variable Pnm (needed to init nrdiag above)
+   JEOD_DELETE_PRIM_ROWS (Pnm);
+
+   // Build the contiguous copy used by calc_nonspherical.
+   pack_coefficients ();
+
+   return;
+}
+
+
+/**
+ * Build the packed, cache-aligned coefficient block.
+ * Coefficients of degree 0 and 1 and orders beyond the model order are
+ * stored as zero; the recursion constants xi and eta are stored as zero
+ * on the diagonal, where Gottlieb's recursion does not use them.
+ */
+void
+SphericalHarmonicsGravitySource::pack_coefficients (
+   void)
+{
+   // Cache line size in bytes, and in doubles.
+   static const std::size_t line_size = 64;
+   static const std::size_t line_doubles = line_size / sizeof(double);
+   static const std::size_t term_doubles = sizeof(PackedTerm) / sizeof(double);
+
+   if (packed_storage != nullptr) {
+      JEOD_DELETE_ARRAY (packed_storage);
+      packed_terms = nullptr;
+   }
+
+   if ((table_degree < 2) || (xi == nullptr)) {
+      return;
+   }
+
+   // Allocate enough doubles to hold the triangle plus slack for alignment.
+   std::size_t nterms = packed_row (table_degree + 1);
+   packed_storage = JEOD_ALLOC_PRIM_ARRAY (
+                       nterms * term_doubles + line_doubles - 1, double);
+
+   std::uintptr_t addr = reinterpret_cast<std::uintptr_t> (packed_storage);
+   std::size_t skip = ((line_size - (addr % line_size)) % line_size)
+                    / sizeof(double);
+   packed_terms = reinterpret_cast<PackedTerm *> (packed_storage + skip);
+
+   for (unsigned int ii = 0; ii <= table_degree; ++ii) {
+      PackedTerm * row = packed_terms + packed_row (ii);
+
+      for (unsigned int jj = 0; jj <= ii; ++jj) {
+         PackedTerm & term = row[jj];
+         bool have_coeff = (ii >= 2) && (jj <= order);
+         bool off_diag = (ii >= 2) && (jj < ii);
+
+         term.Cnm = have_coeff ? Cnm[ii][jj] : 0.0;
+         term.Snm = have_coeff ? Snm[ii][jj] : 0.0;
+         term.xi = off_diag ? xi[ii][jj] : 0.0;
+         term.eta = off_diag ? eta[ii][jj] : 0.0;
+         term.zeta = (ii >= 2) ? zeta[ii][jj] : 0.0;
+         term.upsilon = (ii >= 2) ? upsilon[ii][jj] : 0.0;
       }
-      JEOD_DELETE_ARRAY (Pnm);
    }
 
    return;
@@ -318,6 +510,9 @@ SphericalHarmonicsGravitySource::add_deltacoeff (
    // Send the init structure to the delta-coeff for it to set itself up with
    var_effect.initialize (var_init, dyn_manager);
 
+   // Sums computed without the new effect are no longer valid.
+   delta_cache.invalidate ();
+
    return;
 }
 
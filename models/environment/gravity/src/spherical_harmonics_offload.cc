@@ -0,0 +1,549 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_offload.cc
+ * Define the SphericalHarmonicsOffload methods and the offloaded
+ * non-spherical kernel.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((spherical_harmonics_offload.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (utils/offload/src/offload_buffer.cc)
+   (utils/offload/src/offload_device.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// JEOD includes
+#include "utils/math/include/numerical_inline.hh"
+
+// Model includes
+#include "../include/spherical_harmonics_gravity_source.hh"
+#include "../include/spherical_harmonics_offload.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+typedef SphericalHarmonicsGravitySource::PackedTerm PackedTerm;
+
+/**
+ * Recursion tables, in the order they are stored in dev_recursion.
+ */
+enum RecursionTable {
+   AlphaTable = 0,
+   BetaTable,
+   NrdiagTable,
+   IntToDoubleTable,
+   DiagTable,
+   NumRecursionTables
+};
+
+}
+
+
+JEOD_OFFLOAD_PRAGMA(omp declare target)
+
+/**
+ * Compute the non-spherical acceleration and potential at one point. This
+ * is calc_nonspherical_lanes with a single lane. The Legendre recursion
+ * keeps only the three rows it reads, and the per-point arrays are
+ * interleaved with those of the other points of the batch so that adjacent
+ * device threads access adjacent memory.
+ * \param[in] terms Packed coefficients
+ * \param[in] recursion Recursion tables, table_size elements each
+ * \param[in] table_size Size of each recursion table
+ * \param[in] T_pfix Inertial to planet-fixed transformation, row-major
+ * \param[in] radius Source distance scale\n Units: M
+ * \param[in] mu Source gravitational parameter\n Units: M3/s2
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in] local_C20 C20 coefficient
+ * \param[in] posn Point of interest, inrtl coords\n Units: M
+ * \param[in,out] work This point's first work element
+ * \param[in] stride Distance between this point's work elements
+ * \param[out] accel Acceleration, inrtl coords\n Units: M/s2
+ * \param[out] pot Potential
+ */
+static void
+nonspherical_point (
+   const PackedTerm * terms,
+   const double * recursion,
+   unsigned int table_size,
+   const double * T_pfix,
+   double radius,
+   double mu,
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   double local_C20,
+   const double posn[3],
+   double * work,
+   std::size_t stride,
+   double accel[3],
+   double & pot)
+{
+   const double * alpha = recursion + AlphaTable * table_size;
+   const double * beta = recursion + BetaTable * table_size;
+   const double * nrdiag = recursion + NrdiagTable * table_size;
+   const double * int_to_double = recursion + IntToDoubleTable * table_size;
+   const double * diag = recursion + DiagTable * table_size;
+
+   // Three Legendre rows of eval_degree+3 terms, then C_tilde and S_tilde.
+   const unsigned int max_degree = (eval_degree > 1) ? eval_degree : 1;
+   const std::size_t row_size = (max_degree + 3) * stride;
+   double * P_rows[3] = {work, work + row_size, work + 2 * row_size};
+   double * C_tilde = work + 3 * row_size;
+   double * S_tilde = C_tilde + (max_degree + 1) * stride;
+
+   // Define terms (page 33 of Gottlieb 1993), converting to planet-fixed.
+   double posn_pf[3];
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      posn_pf[kk] = T_pfix[3*kk + 0] * posn[0] +
+                    T_pfix[3*kk + 1] * posn[1] +
+                    T_pfix[3*kk + 2] * posn[2];
+   }
+
+   double r_mag = std::sqrt (posn[0] * posn[0] +
+                             posn[1] * posn[1] +
+                             posn[2] * posn[2]);
+   double r_mag_inv = 1.0 / r_mag;
+   double X_div_r = posn_pf[0] * r_mag_inv;
+   double Y_div_r = posn_pf[1] * r_mag_inv;
+   double Epilson = posn_pf[2] * r_mag_inv;
+
+   double rad_div_r = radius * r_mag_inv;
+   double rad_div_r_nth = rad_div_r;
+   double mu_div_r = mu * r_mag_inv;
+   double mu_div_rsq = mu_div_r * r_mag_inv;
+
+   // Magnitude of projection on the equatorial plane
+   double x_sq = (std::fabs (posn_pf[0]) > GSL_SQRT_DBL_MIN) ?
+                 posn_pf[0] * posn_pf[0] : 0.0;
+   double y_sq = (std::fabs (posn_pf[1]) > GSL_SQRT_DBL_MIN) ?
+                 posn_pf[1] * posn_pf[1] : 0.0;
+   double rho_sq = 0.0 + x_sq + y_sq;
+   double rho = std::sqrt (rho_sq);
+   double cos_phi = rho * r_mag_inv;
+   double cos_phi_nth = cos_phi;
+
+   double cos_lambda = (rho_sq > 0.0) ? posn_pf[0] / rho : 1.0;
+   double sin_lambda = (rho_sq > 0.0) ? posn_pf[1] / rho : 0.0;
+   double cos_mlambda = cos_lambda;
+   double sin_mlambda = sin_lambda;
+
+   C_tilde[0] = 1.0;
+   C_tilde[stride] = X_div_r; // equation (3-18)
+   S_tilde[0] = 0.0;
+   S_tilde[stride] = Y_div_r; // equation (3-18)
+
+   // P(0,m) and P(1,m), including the zero terms P(n,n+1) and P(n,n+2)
+   double * P_0 = P_rows[0];
+   double * P_1 = P_rows[1];
+   P_0[0] = diag[0];
+   P_0[stride] = 0.0;
+   P_0[2*stride] = 0.0;
+   P_1[0] = std::sqrt (3.0) * Epilson;
+   P_1[stride] = diag[1];
+   P_1[2*stride] = 0.0;
+   P_1[3*stride] = 0.0;
+
+   double Sumv = 0.0;
+   double Sumgam = 0.0;
+   double Sumh = 0.0;
+   double Sumj = 0.0;
+   double Sumk = 0.0;
+
+   for (unsigned int ii = 2; ii <= eval_degree; ++ii) {
+
+      const PackedTerm * T_ii =
+         terms + SphericalHarmonicsGravitySource::packed_row(ii);
+      double C_ii0 = (ii == 2) ? local_C20 : T_ii[0].Cnm;
+      double * P_ii = P_rows[ii % 3];
+      const double * P_iim1 = P_rows[(ii - 1) % 3];
+      const double * P_iim2 = P_rows[(ii - 2) % 3];
+      double dbl_iip1 = int_to_double[ii+1];
+
+      P_ii[ii*stride] = diag[ii];
+      P_ii[(ii+1)*stride] = 0.0;
+      P_ii[(ii+2)*stride] = 0.0;
+
+      double rr = rad_div_r_nth * rad_div_r;
+      rad_div_r_nth = (rr < 1.0E-299) ? 0.0 : rr;
+
+      // P(n,0), P(n,n-1) and P(n,1) terms, equations (7-14), (7-16), (7-12)
+      P_ii[0] = alpha[ii] * Epilson * P_iim1[0] - beta[ii] * P_iim2[0];
+      P_ii[(ii-1)*stride] = Epilson * nrdiag[ii];
+      P_ii[stride] = T_ii[1].xi * Epilson * P_iim1[stride] -
+                     T_ii[1].eta * P_iim2[stride];
+
+      for (unsigned int jj = 2; jj <= (ii - 2); ++jj) {
+         // Equation (7-12)
+         P_ii[jj*stride] = T_ii[jj].xi * Epilson * P_iim1[jj*stride] -
+                           T_ii[jj].eta * P_iim2[jj*stride];
+      }
+
+      double Sumv_N = P_ii[0] * C_ii0;
+      double Sumh_N = P_ii[stride] * C_ii0 * T_ii[0].zeta;
+      double Sumgam_N = Sumv_N * dbl_iip1;
+
+      if (eval_order > 0) {
+
+         cos_phi_nth = (cos_phi_nth > GSL_SQRT_DBL_MIN) ?
+                       cos_phi_nth * cos_phi : 0.0;
+         double cos_prev = cos_mlambda;
+         double sin_prev = sin_mlambda;
+         cos_mlambda = cos_lambda * cos_prev - sin_lambda * sin_prev;
+         sin_mlambda = sin_lambda * cos_prev + cos_lambda * sin_prev;
+
+         // Equation (3-18), modified for underflow
+         C_tilde[ii*stride] = cos_phi_nth * cos_mlambda;
+         S_tilde[ii*stride] = cos_phi_nth * sin_mlambda;
+
+         double Sumj_N = 0.0;
+         double Sumk_N = 0.0;
+
+         unsigned int jj_max = (eval_order < ii) ? eval_order : ii;
+
+         for (unsigned int jj = 1; jj <= jj_max; ++jj) {
+            const PackedTerm & T_iijj = T_ii[jj];
+            double C_iijj = T_iijj.Cnm;
+            double S_iijj = T_iijj.Snm;
+            double dbl_jj = int_to_double[jj];
+            double zeta_iijj = (jj < ii) ? T_iijj.zeta : 0.0;
+            double P_iijj = P_ii[jj*stride];
+            double P_iijjp1 = P_ii[(jj+1)*stride];
+
+            double B_tilde = C_iijj * C_tilde[jj*stride] +
+                             S_iijj * S_tilde[jj*stride];
+            // equation (3-9)
+            double B_tilde_m1 = C_iijj * C_tilde[(jj-1)*stride] +
+                                S_iijj * S_tilde[(jj-1)*stride];
+            double A_tilde_m1 = C_iijj * S_tilde[(jj-1)*stride] -
+                                S_iijj * C_tilde[(jj-1)*stride];
+            double P_x_B = P_iijj * B_tilde;
+            double jj_x_P = dbl_jj * P_iijj;
+
+            Sumv_N   = Sumv_N + P_x_B;
+            Sumh_N   = Sumh_N + zeta_iijj * P_iijjp1 * B_tilde;
+            Sumj_N   = Sumj_N + jj_x_P * B_tilde_m1;
+            Sumk_N   = Sumk_N - jj_x_P * A_tilde_m1;
+            Sumgam_N = Sumgam_N + (dbl_jj + dbl_iip1) * P_x_B;
+         } // next m
+
+         Sumj += rad_div_r_nth * Sumj_N;
+         Sumk += rad_div_r_nth * Sumk_N;
+      }
+
+      Sumv   += rad_div_r_nth * Sumv_N;
+      Sumh   += rad_div_r_nth * Sumh_N;
+      Sumgam += rad_div_r_nth * Sumgam_N;
+
+   } // next n
+
+   pot = mu_div_r * Sumv; // gravitational potential
+   double Lambda = Sumgam + Epilson * Sumh;
+
+   // Equation (4-13)
+   double accel_pf[3];
+   accel_pf[0] = -mu_div_rsq * (Lambda * X_div_r - Sumj);
+   accel_pf[1] = -mu_div_rsq * (Lambda * Y_div_r - Sumk);
+   accel_pf[2] = -mu_div_rsq * (Lambda * Epilson - Sumh);
+
+   // Convert back to inertial
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      accel[kk] = T_pfix[kk] * accel_pf[0] +
+                  T_pfix[3 + kk] * accel_pf[1] +
+                  T_pfix[6 + kk] * accel_pf[2];
+   }
+}
+
+JEOD_OFFLOAD_PRAGMA(omp end declare target)
+
+
+/**
+ * SphericalHarmonicsOffload default constructor.
+ */
+SphericalHarmonicsOffload::SphericalHarmonicsOffload (
+   void)
+:
+   min_batch_size(256),
+   allow_host_execution(false),
+   device(),
+   staging(),
+   npoints(0),
+   table_source(nullptr),
+   table_terms(nullptr),
+   table_degree(0),
+   dev_terms(nullptr),
+   dev_recursion(nullptr),
+   dev_io(nullptr),
+   dev_io_points(0),
+   dev_work(nullptr),
+   dev_work_size(0)
+{ }
+
+
+/**
+ * SphericalHarmonicsOffload destructor.
+ */
+SphericalHarmonicsOffload::~SphericalHarmonicsOffload (
+   void)
+{
+   release ();
+}
+
+
+/**
+ * Should a batch of the given size be evaluated by this object?
+ * @return True if the batch is large enough and a device (or host
+ *         execution) is available
+ * \param[in] num_points Batch size
+ */
+bool
+SphericalHarmonicsOffload::use_for (
+   unsigned int num_points) const
+{
+   return (num_points > 0) && (num_points >= min_batch_size) &&
+          (allow_host_execution || device.is_available());
+}
+
+
+/**
+ * Size the staging buffer for a batch of num_points points.
+ * @return Position arrays to be filled, num_points elements per axis:
+ *         the positions relative to the source, inrtl coords\n Units: M
+ * \param[in] num_points Batch size
+ */
+double *
+SphericalHarmonicsOffload::stage_positions (
+   unsigned int num_points)
+{
+   npoints = num_points;
+   staging.reserve (7 * static_cast<std::size_t> (num_points));
+   return staging.data();
+}
+
+
+/**
+ * Copy the source's coefficients and recursion tables through the given
+ * degree to the device, along with the diagonal Legendre terms P(n,n).
+ * \param[in] source Gravity source
+ * \param[in] degree Degree through which the tables are needed
+ */
+void
+SphericalHarmonicsOffload::upload_tables (
+   const SphericalHarmonicsGravitySource & source,
+   unsigned int degree)
+{
+   invalidate ();
+
+   std::size_t num_terms = SphericalHarmonicsGravitySource::packed_row (
+                              degree + 1);
+   dev_terms = device.allocate (num_terms * sizeof(PackedTerm));
+   device.copy_to_device (dev_terms, source.packed_terms,
+                          num_terms * sizeof(PackedTerm));
+
+   // P(n,n) as built by SphericalHarmonicsGravityControls::allocate_legendre.
+   std::size_t table_size = degree + 2;
+   std::vector<double> tables (NumRecursionTables * table_size, 0.0);
+   double * diag = tables.data() + DiagTable * table_size;
+   diag[0] = 1.0;
+   diag[1] = std::sqrt (3.0);
+   for (unsigned int ii = 2; ii <= degree; ++ii) {
+      double dbl_ii = static_cast<double> (ii);
+      diag[ii] = std::sqrt ((2.0 * dbl_ii + 1.0) / (2.0 * dbl_ii)) * diag[ii - 1];
+   }
+   std::copy (source.alpha, source.alpha + degree + 1,
+              tables.begin() + AlphaTable * table_size);
+   std::copy (source.beta, source.beta + degree + 1,
+              tables.begin() + BetaTable * table_size);
+   std::copy (source.nrdiag, source.nrdiag + degree + 1,
+              tables.begin() + NrdiagTable * table_size);
+   std::copy (source.int_to_double, source.int_to_double + degree + 2,
+              tables.begin() + IntToDoubleTable * table_size);
+
+   dev_recursion = static_cast<double *> (
+                      device.allocate (tables.size() * sizeof(double)));
+   device.copy_to_device (dev_recursion, tables.data(),
+                          tables.size() * sizeof(double));
+
+   table_source = &source;
+   table_terms = source.packed_terms;
+   table_degree = degree;
+}
+
+
+/**
+ * Evaluate the non-spherical field at the positions staged with
+ * stage_positions; read the results with get_accelerations and
+ * get_potentials.
+ * \param[in] source Gravity source; its tables must extend through
+ *            eval_degree
+ * \param[in] T_pfix Inertial to planet-fixed transformation
+ * \param[in] eval_degree Degree to be used
+ * \param[in] eval_order Order to be used
+ * \param[in] local_C20 C20 coefficient
+ */
+void
+SphericalHarmonicsOffload::evaluate (
+   const SphericalHarmonicsGravitySource & source,
+   const double T_pfix[3][3],
+   unsigned int eval_degree,
+   unsigned int eval_order,
+   double local_C20)
+{
+   const unsigned int max_degree = std::max (eval_degree, 1U);
+   if ((table_source != &source) ||
+       (table_terms != source.packed_terms) ||
+       (table_degree < max_degree)) {
+      upload_tables (source, std::max (source.table_degree, max_degree));
+   }
+
+   const std::size_t num_points = npoints;
+   if (dev_io_points < num_points) {
+      device.release (dev_io);
+      dev_io = static_cast<double *> (
+                  device.allocate (7 * num_points * sizeof(double)));
+      dev_io_points = num_points;
+   }
+
+   // Per point: three Legendre rows and the C_tilde and S_tilde arrays.
+   std::size_t work_size =
+      (3 * (max_degree + 3) + 2 * (max_degree + 1)) * num_points;
+   if (dev_work_size < work_size) {
+      device.release (dev_work);
+      dev_work = static_cast<double *> (
+                    device.allocate (work_size * sizeof(double)));
+      dev_work_size = work_size;
+   }
+
+   double T[9];
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         T[3*ii + jj] = T_pfix[ii][jj];
+      }
+   }
+
+   const PackedTerm * terms = static_cast<const PackedTerm *> (dev_terms);
+   const double * recursion = dev_recursion;
+   double * io = dev_io;
+   double * work = dev_work;
+   const unsigned int table_size = table_degree + 2;
+   const double radius = source.radius;
+   const double mu = source.mu;
+
+   device.copy_to_device (io, staging.data(), 3 * num_points * sizeof(double));
+
+   JEOD_OFFLOAD_PRAGMA(
+      omp target teams distribute parallel for
+      device(device.get_device_number ())
+      is_device_ptr(terms, recursion, io, work)
+      map(to: T[0:9]))
+   for (std::size_t ip = 0; ip < num_points; ++ip) {
+      double posn[3] = {io[ip], io[num_points + ip], io[2*num_points + ip]};
+      double accel[3];
+      double pot;
+
+      nonspherical_point (
+         terms, recursion, table_size, T, radius, mu,
+         eval_degree, eval_order, local_C20,
+         posn, work + ip, num_points, accel, pot);
+
+      io[3*num_points + ip] = accel[0];
+      io[4*num_points + ip] = accel[1];
+      io[5*num_points + ip] = accel[2];
+      io[6*num_points + ip] = pot;
+   }
+
+   device.copy_from_device (staging.data() + 3 * num_points,
+                            io + 3 * num_points,
+                            4 * num_points * sizeof(double));
+}
+
+
+/**
+ * Get the accelerations computed by the last evaluation.
+ * @return Accelerations, inrtl coords, one array of npoints per axis\n
+ *         Units: M/s2
+ */
+const double *
+SphericalHarmonicsOffload::get_accelerations (
+   void) const
+{
+   return staging.data() + 3 * static_cast<std::size_t> (npoints);
+}
+
+
+/**
+ * Get the potentials computed by the last evaluation.
+ * @return Potentials, npoints elements
+ */
+const double *
+SphericalHarmonicsOffload::get_potentials (
+   void) const
+{
+   return staging.data() + 6 * static_cast<std::size_t> (npoints);
+}
+
+
+/**
+ * Discard the device copies of the coefficient and recursion tables.
+ */
+void
+SphericalHarmonicsOffload::invalidate (
+   void)
+{
+   device.release (dev_terms);
+   device.release (dev_recursion);
+   dev_terms = nullptr;
+   dev_recursion = nullptr;
+   table_source = nullptr;
+   table_terms = nullptr;
+   table_degree = 0;
+}
+
+
+/**
+ * Free the device tables, the device work arrays and the staging buffer.
+ */
+void
+SphericalHarmonicsOffload::release (
+   void)
+{
+   invalidate ();
+   device.release (dev_io);
+   device.release (dev_work);
+   dev_io = nullptr;
+   dev_io_points = 0;
+   dev_work = nullptr;
+   dev_work_size = 0;
+   staging.release ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -24,6 +24,7 @@ Assumptions and limitations:
 Library dependencies:
   ((spherical_harmonics_solid_body_tides.cc)
    (spherical_harmonics_delta_coeffs_init.cc)
+   (spherical_harmonics_solid_body_tides_init.cc)
    (spherical_harmonics_gravity_source.cc)
    (spherical_harmonics_gravity_controls.cc)
    (environment/planet/src/planet.cc)
@@ -44,6 +45,7 @@ Library dependencies:
 // Model includes
 #include "../include/spherical_harmonics_solid_body_tides.hh"
 #include "../include/spherical_harmonics_delta_coeffs_init.hh"
+#include "../include/spherical_harmonics_solid_body_tides_init.hh"
 #include "../include/spherical_harmonics_gravity_controls.hh"
 #include "../include/spherical_harmonics_gravity_source.hh"
 
@@ -57,6 +59,11 @@ namespace jeod {
  */
 SphericalHarmonicsSolidBodyTides::SphericalHarmonicsSolidBodyTides (
    void)
+:
+   update_interval(0.0),
+   num_samples(0),
+   sample_time(),
+   sample_dC20()
 {
    ; // Nothing to do
 }
@@ -87,21 +94,81 @@ SphericalHarmonicsSolidBodyTides::initialize (
    // Pass initialization up the chain
    SphericalHarmonicsTidalEffects::initialize (var_init, dyn_manager);
 
+   // The update interval is optional; a plain tidal effects init object
+   // leaves it at zero, i.e. evaluate on every update.
+   SphericalHarmonicsSolidBodyTidesInit * solid_init =
+      dynamic_cast<SphericalHarmonicsSolidBodyTidesInit*> (&var_init);
+   if (solid_init != nullptr) {
+      update_interval = solid_init->update_interval;
+   }
+
+   // Discard any samples from a previous initialization.
+   num_samples = 0;
+
 }
 
 
 /**
  * Update the solid-body tidal delta-coefficients.
+ * With a positive update interval the tide is evaluated only when the input
+ * time is at least one interval away from the most recent evaluation, and is
+ * extrapolated along the line through the last two evaluations otherwise.
  * \param[in] controls Gravity controls for planet
  */
 void
 SphericalHarmonicsSolidBodyTides::update (
    SphericalHarmonicsGravityControls & controls JEOD_UNUSED)
 
+{
+   if (update_interval <= 0.0) {
+      dC20 = compute_dC20 ();
+      return;
+   }
+
+   double now = input_time ();
+
+   // Still within an interval of the latest evaluation: extrapolate.
+   if ((num_samples > 0) &&
+       (std::fabs (now - sample_time[num_samples-1]) < update_interval)) {
+      if (num_samples == 1) {
+         dC20 = sample_dC20[0];
+      }
+      else {
+         double rate = (sample_dC20[1] - sample_dC20[0]) /
+                       (sample_time[1] - sample_time[0]);
+         dC20 = sample_dC20[1] + rate * (now - sample_time[1]);
+      }
+      return;
+   }
+
+   // Evaluate the tide and keep the two most recent evaluations.
+   // The samples are at least update_interval apart, so the rate above
+   // never divides by zero.
+   dC20 = compute_dC20 ();
+   if (num_samples == 2) {
+      sample_time[0] = sample_time[1];
+      sample_dC20[0] = sample_dC20[1];
+      num_samples = 1;
+   }
+   sample_time[num_samples] = now;
+   sample_dC20[num_samples] = dC20;
+   ++num_samples;
+
+   return;
+}
+
+
+/**
+ * Evaluate the solid-body tidal delta-coefficient from the current positions
+ * of the tide-raising bodies.
+ * @return Tidal change in C20\n Units: --
+ */
+double
+SphericalHarmonicsSolidBodyTides::compute_dC20 (
+   void)
 {
    double pfix_position[3];
    double F = 0.0;
-   double deltaC20;
 
    for (unsigned int ii = 0; ii < num_tidal_bodies; ++ii) {
       tidal_bodies_inertial[ii]->compute_position_from (*pfix,
@@ -118,10 +185,7 @@ SphericalHarmonicsSolidBodyTides::update (
            (1.5 * sin (phi) * sin (phi) - 0.5);
    }
 
-   deltaC20 = k2 / 5.0 * F;
-   dC20 = deltaC20;
-
-   return;
+   return k2 / 5.0 * F;
 }
 
 } // End JEOD namespace
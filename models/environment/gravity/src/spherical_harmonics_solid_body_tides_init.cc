@@ -46,6 +46,8 @@ namespace jeod {
  */
 SphericalHarmonicsSolidBodyTidesInit::SphericalHarmonicsSolidBodyTidesInit (
    void)
+:
+   update_interval(0.0)
 {
    ;  // Nothing to do
 }
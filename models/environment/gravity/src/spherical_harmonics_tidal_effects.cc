@@ -97,13 +97,7 @@ SphericalHarmonicsTidalEffects::~SphericalHarmonicsTidalEffects (
       tidal_bodies_inertial = nullptr;
    }
 
-   if (Knm != nullptr) {
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         JEOD_DELETE_ARRAY (Knm[ii]);
-      }
-      JEOD_DELETE_ARRAY (Knm);
-      Knm = nullptr;
-   }
+   JEOD_DELETE_PRIM_ROWS (Knm);
 }
 
 
@@ -197,13 +191,9 @@ SphericalHarmonicsTidalEffects::initialize (
    SphericalHarmonicsDeltaCoeffs::initialize (gen_var_init, dyn_manager);
 
 
-   // Allocate and load up Knm
-   if (degree > 0) {
-      Knm = JEOD_ALLOC_PRIM_ARRAY (degree + 1, double *);
-
-      for (unsigned int ii = 0; ii <= degree; ++ii) {
-         Knm[ii] = JEOD_ALLOC_PRIM_ARRAY (ii + 1, double);
-      }
+   // Allocate and load up Knm, shaped like the base class delta arrays
+   if ((degree > 0) && (order > 0)) {
+      Knm = JEOD_ALLOC_PRIM_MATRIX (degree, order, double);
 
       for (unsigned int ii = 0; ii < degree; ++ii) {
          for (unsigned int jj = 0; jj < order; ++jj) {
@@ -232,6 +222,33 @@ SphericalHarmonicsTidalEffects::update (
 
 }
 
+
+/**
+ * Return the time of the inputs on which the tidal update depends: the
+ * latest of the planet-fixed frame and tidal body inertial frame timestamps.
+ * @return Input time\n Units: s
+ */
+double
+SphericalHarmonicsTidalEffects::input_time (
+   void) const
+{
+   double latest = SphericalHarmonicsDeltaCoeffs::input_time ();
+
+   if ((pfix != nullptr) && (pfix->timestamp() > latest)) {
+      latest = pfix->timestamp();
+   }
+   if (tidal_bodies_inertial != nullptr) {
+      for (unsigned int ii = 0; ii < num_tidal_bodies; ++ii) {
+         double body_time = tidal_bodies_inertial[ii]->timestamp();
+         if (body_time > latest) {
+            latest = body_time;
+         }
+      }
+   }
+
+   return latest;
+}
+
 } // End JEOD namespace
 
 /**
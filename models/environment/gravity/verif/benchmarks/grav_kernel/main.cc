@@ -0,0 +1,346 @@
+/*
+ * Micro-benchmark of the spherical harmonics gravity evaluation.
+ *
+ * Sweeps field, degree/order, gravity gradient on/off and delta-coefficient
+ * (tide) effects on/off, and writes the time per evaluation to stdout as
+ * JSON. Where Linux perf events are available, cache misses per evaluation
+ * are reported as well; otherwise that entry is null.
+ *
+ * The tide case uses a synthetic first-order delta-coefficient model whose
+ * dC20 changes on every update. It exercises the SphericalHarmonicsGravity-
+ * Controls delta-coefficient path without the ephemeris and dynamics
+ * manager that the solid body tide model requires.
+ *
+ * Options:
+ *   -MinTime <s>  Minimum measured time per case (default 0.2 s)
+ *   -Verbose      Also write a human-readable table to stderr
+ */
+
+// Local definitions
+#define NUM_POINTS 512
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// JEOD includes
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_delta_coeffs.hh"
+#include "environment/gravity/include/spherical_harmonics_delta_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/planet/include/planet.hh"
+#include "environment/planet/data/include/earth.hh"
+#include "environment/planet/data/include/mars.hh"
+#include "environment/planet/data/include/moon.hh"
+#include "environment/gravity/data/include/earth_GGM05C.hh"
+#include "environment/gravity/data/include/mars_MRO110B2.hh"
+#include "environment/gravity/data/include/moon_GRAIL150.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "test_harness/include/cmdline_parser.hh"
+
+using namespace jeod;
+
+namespace {
+
+/**
+ * Synthetic first-order delta-coefficient model: a dC20 that changes on
+ * every update, standing in for solid body tides.
+ */
+class BenchTide : public SphericalHarmonicsDeltaCoeffs {
+public:
+   double phase;
+
+   BenchTide () : phase(0.0) {}
+
+   void update (SphericalHarmonicsGravityControls &) override
+   {
+      phase += 1.0e-3;
+      dC20 = 1.0e-9 * std::sin (phase);
+   }
+};
+
+
+/**
+ * Hardware cache-miss counter for the calling thread.
+ * available() is false where perf events cannot be opened.
+ */
+class CacheMissCounter {
+public:
+   int fd;
+
+   CacheMissCounter () : fd(-1)
+   {
+#ifdef __linux__
+      struct perf_event_attr attr;
+      std::memset (&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fd = static_cast<int> (syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+   }
+
+   ~CacheMissCounter ()
+   {
+#ifdef __linux__
+      if (fd >= 0) {
+         close (fd);
+      }
+#endif
+   }
+
+   bool available () const { return fd >= 0; }
+
+   void start ()
+   {
+#ifdef __linux__
+      if (fd >= 0) {
+         ioctl (fd, PERF_EVENT_IOC_RESET, 0);
+         ioctl (fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+#endif
+   }
+
+   long long stop ()
+   {
+      long long count = 0;
+#ifdef __linux__
+      if (fd >= 0) {
+         ioctl (fd, PERF_EVENT_IOC_DISABLE, 0);
+         if (read (fd, &count, sizeof(count)) != sizeof(count)) {
+            count = 0;
+         }
+      }
+#endif
+      return count;
+   }
+};
+
+
+/**
+ * One gravity field under test.
+ */
+struct BenchField {
+   const char * name;
+   Planet planet;
+   SphericalHarmonicsGravitySource source;
+   GravityManager manager;
+   BenchTide tide;
+   std::vector<EphemerisRefFrame *> frames;
+};
+
+
+/**
+ * Initialize a field from its planet and gravity default data.
+ */
+template <typename PlanetData, typename GravityData>
+void
+init_field (
+   BenchField & field,
+   const char * name)
+{
+   PlanetData planet_init;
+   GravityData gravity_init;
+
+   field.name = name;
+   field.source.tide_free = true;
+   planet_init.initialize (&field.planet);
+   gravity_init.initialize (&field.source);
+   field.source.initialize_body ();
+
+   field.planet.grav_source = &field.source;
+   field.source.inertial = &field.planet.inertial;
+   field.source.pfix = &field.planet.pfix;
+   field.planet.initialize ();
+   field.manager.add_grav_source (field.source);
+   field.frames.push_back (&field.planet.inertial);
+   field.source.initialize_state (field.frames, field.manager);
+
+   // Register the synthetic tide directly; it needs no initialization.
+   field.tide.grav_source = &field.source;
+   field.source.delta_coeffs.push_back (&field.tide);
+}
+
+
+/**
+ * Time one configuration and write its JSON record.
+ */
+void
+run_case (
+   BenchField & field,
+   unsigned int degree,
+   bool gradient,
+   bool tides,
+   const double points[NUM_POINTS][3],
+   double min_time,
+   CacheMissCounter & counter,
+   bool first,
+   bool verbose)
+{
+   SphericalHarmonicsGravityControls controls;
+   SphericalHarmonicsDeltaControls tide_controls;
+
+   controls.active = true;
+   controls.source_name = field.source.name;
+   controls.degree = degree;
+   controls.order = degree;
+   controls.gradient = gradient;
+   controls.gradient_degree = gradient ? degree : 0;
+   controls.gradient_order = gradient ? degree : 0;
+
+   tide_controls.grav_effect = &field.tide;
+   tide_controls.grav_source = &field.source;
+   tide_controls.active = tides;
+   tide_controls.first_order_only = true;
+   controls.add_deltacontrol (&tide_controls);
+
+   controls.initialize_control (field.manager);
+
+   double accel[3];
+   double grad[3][3];
+   double pot[1];
+   double checksum = 0.0;
+
+   // Warm up, then double the repetitions until the run is long enough.
+   for (unsigned int ii = 0; ii < NUM_POINTS; ++ii) {
+      controls.gravitation (points[ii], 0, accel, grad, pot);
+   }
+
+   unsigned long long reps = 1;
+   double elapsed = 0.0;
+   long long misses = 0;
+   for (;;) {
+      counter.start ();
+      auto t0 = std::chrono::steady_clock::now ();
+      for (unsigned long long rr = 0; rr < reps; ++rr) {
+         for (unsigned int ii = 0; ii < NUM_POINTS; ++ii) {
+            controls.gravitation (points[ii], 0, accel, grad, pot);
+            checksum += accel[0];
+         }
+      }
+      auto t1 = std::chrono::steady_clock::now ();
+      misses = counter.stop ();
+      elapsed = std::chrono::duration<double> (t1 - t0).count ();
+      if (elapsed >= min_time) {
+         break;
+      }
+      reps *= 2;
+   }
+
+   double evaluations = static_cast<double> (reps) * NUM_POINTS;
+   double ns_per_eval = 1.0e9 * elapsed / evaluations;
+
+   std::printf ("%s\n    {\"field\": \"%s\", \"degree\": %u, \"order\": %u, "
+                "\"gradient\": %s, \"tides\": %s, \"evaluations\": %.0f, "
+                "\"ns_per_eval\": %.2f, ",
+                first ? "" : ",", field.name, degree, degree,
+                gradient ? "true" : "false", tides ? "true" : "false",
+                evaluations, ns_per_eval);
+   if (counter.available ()) {
+      std::printf ("\"cache_misses_per_eval\": %.3f, ", misses / evaluations);
+   }
+   else {
+      std::printf ("\"cache_misses_per_eval\": null, ");
+   }
+   std::printf ("\"checksum\": %.17g}", checksum);
+
+   if (verbose) {
+      std::fprintf (stderr, "%-14s %4u %-5s %-5s %12.1f ns\n",
+                    field.name, degree, gradient ? "grad" : "-",
+                    tides ? "tides" : "-", ns_per_eval);
+   }
+}
+
+}
+
+
+int
+main (
+   int argc,
+   char * argv[])
+{
+   TestSimInterface test_sim_interface;
+   CmdlineParser cmdline_parser;
+   double min_time = 0.2;
+   bool verbose = false;
+
+   cmdline_parser.add_double ("MinTime", 0, &min_time);
+   cmdline_parser.add_switch ("Verbose", &verbose);
+   cmdline_parser.parse (argc, argv);
+
+   BenchField * fields[3];
+   fields[0] = new BenchField;
+   fields[1] = new BenchField;
+   fields[2] = new BenchField;
+   init_field<Planet_earth_default_data,
+              SphericalHarmonicsGravitySource_earth_GGM05C_default_data> (
+      *fields[0], "earth_GGM05C");
+   init_field<Planet_moon_default_data,
+              SphericalHarmonicsGravitySource_moon_GRAIL150_default_data> (
+      *fields[1], "moon_GRAIL150");
+   init_field<Planet_mars_default_data,
+              SphericalHarmonicsGravitySource_mars_MRO110B2_default_data> (
+      *fields[2], "mars_MRO110B2");
+
+   const unsigned int degrees[] = {8, 36, 70, 150, 360};
+   CacheMissCounter counter;
+   bool first = true;
+
+   std::printf ("{\n  \"benchmark\": \"grav_kernel\",\n"
+                "  \"points_per_pass\": %d,\n  \"min_time\": %g,\n"
+                "  \"cache_counters\": %s,\n  \"results\": [",
+                NUM_POINTS, min_time, counter.available () ? "true" : "false");
+
+   for (BenchField * field : fields) {
+
+      // Points between 1.02 and 3 reference radii, spread over the sphere.
+      double points[NUM_POINTS][3];
+      std::srand (1);
+      for (unsigned int ii = 0; ii < NUM_POINTS; ++ii) {
+         double r = field->source.radius *
+                    (1.02 + 1.98 * std::rand () / RAND_MAX);
+         double z = 2.0 * std::rand () / RAND_MAX - 1.0;
+         double lon = 2.0 * M_PI * std::rand () / RAND_MAX;
+         double rho = r * std::sqrt (1.0 - z * z);
+         points[ii][0] = rho * std::cos (lon);
+         points[ii][1] = rho * std::sin (lon);
+         points[ii][2] = r * z;
+      }
+
+      for (unsigned int degree : degrees) {
+         if (degree > field->source.degree) {
+            continue;
+         }
+         for (int gradient = 0; gradient < 2; ++gradient) {
+            for (int tides = 0; tides < 2; ++tides) {
+               run_case (*field, degree, gradient != 0, tides != 0, points,
+                         min_time, counter, first, verbose);
+               first = false;
+            }
+         }
+      }
+   }
+
+   std::printf ("\n  ]\n}\n");
+
+   for (BenchField * field : fields) {
+      delete field;
+   }
+
+   return 0;
+}
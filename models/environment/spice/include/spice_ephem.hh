@@ -52,7 +52,8 @@ Purpose:
   ()
 
 Library dependencies:
-  ((../src/spice_ephem.cc))
+  ((../src/spice_ephem.cc)
+   (../src/spice_ephem_fit.cc))
 
 
 
@@ -64,6 +65,7 @@ Library dependencies:
 
 // System includes
 #include <string>
+#include <vector>
 
 // JEOD includes
 #include "environment/ephemerides/ephem_interface/include/ephem_interface.hh"
@@ -77,8 +79,10 @@ Library dependencies:
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
+#include "spice_ephem_fit.hh"
 #include "spice_ephem_orient.hh"
 #include "spice_ephem_point.hh"
+#include "spice_service.hh"
 
 
 //! Namespace jeod
@@ -148,6 +152,24 @@ public:
     */
    std::string metakernel_filename; //!< trick_units(--)
 
+   /**
+    * Length of the window over which each translational state is fit by a
+    * Chebyshev series and served from that series rather than from SPICE.
+    * Zero or negative values disable fitting: SPICE is called every update.
+    */
+   double fit_interval; //!< trick_units(s)
+
+   /**
+    * Maximum position error of a fit, checked against SPICE between the fit
+    * nodes. A window that fails the check is halved and refit.
+    */
+   double fit_tolerance; //!< trick_units(m)
+
+   /**
+    * Number of Chebyshev terms in each fit, at most SpiceEphemFit::MaxTerms.
+    */
+   unsigned int fit_terms; //!< trick_units(--)
+
 
 protected:
 
@@ -227,6 +249,12 @@ private:
     */
    EphemeridesManager * ephem_mngr_local; //!< trick_units(--)
 
+   /**
+    * Chebyshev fits of the states of the loaded spk objects,
+    * parallel to loaded_spk.
+    */
+   std::vector<SpiceEphemFit> spk_fits; //!< trick_io(**)
+
 
    // Member functions
 
@@ -287,6 +315,21 @@ private:
    // Update purely translational ephemerides
    void update_trans ();
 
+   // Obtain the state of a loaded spk object from SPICE
+   bool get_spice_state (
+      unsigned int index, double tdb, double state[6], bool required = true);
+
+   // Obtain a batch of states from SPICE
+   bool get_spice_states (
+      SpiceService::StateRequest * requests, unsigned int count,
+      bool required);
+
+   // Obtain the state of a loaded spk object from its fit
+   void get_fitted_state (unsigned int index, double tdb, double state[6]);
+
+   // Fit the state of a loaded spk object over a window containing a time
+   void refit (unsigned int index, double tdb);
+
    // Update rotational state of body-fixed frames
    void update_rot ();
 
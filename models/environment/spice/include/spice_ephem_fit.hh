@@ -0,0 +1,161 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Spice
+ * @{
+ *
+ * @file models/environment/spice/include/spice_ephem_fit.hh
+ * Define class SpiceEphemFit, a local Chebyshev fit to a SPICE state.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/spice_ephem_fit.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPICE_EPHEM_FIT_HH
+#define JEOD_SPICE_EPHEM_FIT_HH
+
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A SpiceEphemFit holds Chebyshev series fit to the six components of a
+ * SPICE state over a time window. The series interpolate the state at the
+ * Chebyshev nodes of the window, which are supplied by the caller.
+ */
+class SpiceEphemFit {
+JEOD_MAKE_SIM_INTERFACES(SpiceEphemFit)
+
+public:
+
+   /**
+    * The maximum number of Chebyshev terms in a fit.
+    */
+   static const unsigned int MaxTerms = 24;
+
+   // Member functions
+
+   // Constructor.
+   SpiceEphemFit ();
+
+   // Compute the times at which the fitted function is to be sampled.
+   static void node_times (
+      unsigned int nterms, double start, double span, double * times);
+
+   // Fit the series to the state sampled at the node times.
+   void fit (
+      unsigned int nterms, double start, double span,
+      const double samples[][6]);
+
+   // Evaluate the series.
+   void evaluate (double time, double state[6]) const;
+
+   // Mark the fit as covering no time.
+   void invalidate (void);
+
+   /**
+    * Check whether a time is in the window of the most recent fit attempt.
+    * @return True if the time is in the window
+    * \param[in] time Time\n Units: s
+    */
+   bool covers (double time) const
+   {
+      return (time >= start) && (time <= start + span);
+   }
+
+
+   // Member data
+
+   /**
+    * Start of the fit window.
+    */
+   double start; //!< trick_units(s)
+
+   /**
+    * Length of the fit window.
+    */
+   double span; //!< trick_units(s)
+
+   /**
+    * Number of terms in each series.
+    */
+   unsigned int nterms; //!< trick_units(--)
+
+   /**
+    * Whether the series may be evaluated. A window that could not be fit
+    * to the required accuracy covers time but is not valid.
+    */
+   bool valid; //!< trick_units(--)
+
+   /**
+    * Chebyshev coefficients of each state component.
+    */
+   double coeffs[6][MaxTerms]; //!< trick_units(--)
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
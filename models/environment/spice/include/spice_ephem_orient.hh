@@ -98,12 +98,23 @@ public:
    // Update the rotational state of the target frame.
    void update (double time_tdb, double time_dyn);
 
+   // Update the rotational state of the target frame from a SPICE matrix.
+   void update (const double trans6x6[6][6], double time_dyn);
+
    // Confirm that the target frame exists in the loaded kernels.
    void validate (double time_tdb);
 
    // Populate the SPICE 6 x 6 matrix via sxform_c().
    void get_spice_transformation (double time_tdb, double trans6x6[6][6]);
 
+   /**
+    * Getter for the name of the SPICE frame.
+    * @return Name of the SPICE frame
+    */
+   const char * get_spice_frame_name () const {
+      return spice_frame_name.c_str();
+   }
+
    /**
     * Setter for the name of the SPICE frame.
     * \param new_name  Name of the SPICE frame
@@ -0,0 +1,222 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Spice
+ * @{
+ *
+ * @file models/environment/spice/include/spice_service.hh
+ * Define class SpiceService, which serializes CSPICE calls on a dedicated
+ * thread.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((CSPICE is neither reentrant nor thread-safe. All CSPICE calls made by
+    JEOD go through the SpiceService.))
+
+Library dependencies:
+  ((../src/spice_service.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_SPICE_SERVICE_HH
+#define JEOD_SPICE_SERVICE_HH
+
+
+// System includes
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A SpiceService makes every CSPICE call on one dedicated thread. CSPICE
+ * keeps its kernel pool, its error state, and its caches in global data, so
+ * calls from different threads would race. Callers on any thread submit a
+ * task, or a batch of state or transformation requests, and wait for the
+ * service thread to carry it out; tasks are run one at a time in the order
+ * submitted. Since CSPICE is process-wide, so is the service: there is one
+ * instance, obtained with instance().
+ *
+ * SPICE errors are reported back to the submitting thread rather than
+ * through the MessageHandler, so that the caller can decide whether they
+ * are fatal. The SPICE error action must be set to "return"; see
+ * SpiceEphemeris::mute_spice_errors.
+ */
+class SpiceService {
+JEOD_MAKE_SIM_INTERFACES(SpiceService)
+
+public:
+
+   /**
+    * A request for the state of a target relative to an observer, in the
+    * J2000 frame without aberration corrections (spkez_c).
+    */
+   struct StateRequest {
+      int target;       ///< SPICE ID of the target
+      int observer;     ///< SPICE ID of the observer
+      double tdb;       ///< Ephemeris time, TDB seconds past J2000
+      double state[6];  ///< Position and velocity, km and km/s
+      bool found;       ///< Whether SPICE provided the state
+   };
+
+   /**
+    * A request for the transformation from J2000 to a frame and its
+    * derivative (sxform_c).
+    */
+   struct TransformRequest {
+      const char * frame;       ///< SPICE name of the frame
+      double tdb;               ///< Ephemeris time, TDB seconds past J2000
+      double transform[6][6];   ///< State transformation matrix
+      bool found;               ///< Whether SPICE provided the matrix
+   };
+
+
+   // Member functions
+
+   // The process-wide service.
+   static SpiceService & instance ();
+
+   // Run a task on the service thread and wait for it to complete.
+   void call (const std::function<void ()> & task);
+
+   // Obtain a batch of states.
+   bool get_states (
+      StateRequest * requests, unsigned int count,
+      std::string * error = nullptr);
+
+   // Obtain a batch of transformations.
+   bool get_transforms (
+      TransformRequest * requests, unsigned int count,
+      std::string * error = nullptr);
+
+   // Obtain and clear the pending SPICE error; call on the service thread.
+   static bool take_spice_error (std::string * error);
+
+
+private:
+
+   /**
+    * A task submitted to the service thread.
+    */
+   struct Task {
+      const std::function<void ()> * function;   ///< The task
+      bool done;                                 ///< Set when run
+   };
+
+   // Constructor and destructor; see instance().
+   SpiceService ();
+   ~SpiceService ();
+
+   // Service thread main loop.
+   void worker_loop ();
+
+
+   /**
+    * The service thread, started by the first call.
+    */
+   std::thread worker; //!< trick_io(**)
+
+   /**
+    * Guards the members below.
+    */
+   std::mutex mutex; //!< trick_io(**)
+
+   /**
+    * Signals the service thread that a task (or shutdown) is available.
+    */
+   std::condition_variable request_cond; //!< trick_io(**)
+
+   /**
+    * Signals submitters that a task has been run.
+    */
+   std::condition_variable done_cond; //!< trick_io(**)
+
+   /**
+    * Tasks waiting to be run, oldest first.
+    */
+   std::deque<Task *> pending; //!< trick_io(**)
+
+   /**
+    * Set to tell the service thread to exit.
+    */
+   bool shutdown; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   SpiceService (const SpiceService &);
+
+   /**
+    * Not implemented.
+    */
+   SpiceService & operator= (const SpiceService &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -19,7 +19,8 @@ Assumptions and limitations:
 ((The JPL SPICE system uses TDB time.))
 
 Library Dependencies:
-((environment/ephemerides/ephem_interface/src/ephem_messages.cc)
+((spice_service.cc)
+ (environment/ephemerides/ephem_interface/src/ephem_messages.cc)
  (environment/time/src/time_manager.cc)
  (utils/named_item/src/named_item.cc)
  (utils/memory/src/memory_manager_static.cc)
@@ -35,6 +36,7 @@ Library Dependencies:
 #include <set>
 #include <fstream>
 #include <algorithm>
+#include <cmath>
 
 // Include SPICE library header for access to its functions.
 #include "SpiceUsr.h"
@@ -48,12 +50,12 @@ Library Dependencies:
 
 // Model includes.
 #include "../include/spice_ephem.hh"
+#include "../include/spice_service.hh"
 
 
 // Set sizes of SPICE character strings and upper bound on total number of IDs.
 const static int MAX_PATH_LENGTH = 129;
 const static int MAX_NAME_LENGTH = 33;
-const static int MAX_MSG_LENGTH = 1841;
 const static int MAX_IDS = 1000;
 
 
@@ -66,6 +68,9 @@ namespace jeod {
 SpiceEphemeris::SpiceEphemeris (
    void)
 :
+   fit_interval(0.0),
+   fit_tolerance(1.0),
+   fit_terms(12),
    inactive(false),
    force_update(false),
    ident("SPICE"),
@@ -230,7 +235,10 @@ void
 SpiceEphemeris::simple_restore (
    void)
 {
-   return; // Nothing yet.
+   // Fits are not checkpointed; refit on demand.
+   spk_fits.clear();
+
+   return;
 }
 
 
@@ -274,19 +282,19 @@ SpiceEphemeris::load_spice_files (
 {
 
    // Call SPICE kernel file loader routine.
-   furnsh_c (metakernel_filename.c_str());
+   std::string err_msg;
+   bool failed = false;
+   SpiceService::instance().call ([&] () {
+      furnsh_c (metakernel_filename.c_str());
+      failed = SpiceService::take_spice_error (&err_msg);
+   });
 
    // Check whether SPICE returned an error message.
-   if (failed_c()) {
-
-      // Error message returned; obtain it from SPICE.
-      char err_msg[MAX_MSG_LENGTH];
-      getmsg_c ("long", MAX_MSG_LENGTH, err_msg);
-
+   if (failed) {
       MessageHandler::fail (
          __FILE__, __LINE__, EphemeridesMessages::file_error,
          "While loading metakernels, furnsh_c reports the following error: %s\n",
-         err_msg);
+         err_msg.c_str());
 
 
       // Not reached.
@@ -304,9 +312,49 @@ void
 SpiceEphemeris::process_spk (
    void)
 {
-   // Get 'count', the number of SPICE spk kernels.
+   // Get 'count', the number of SPICE spk kernels, and the IDs of the
+   // objects they contain.
    int count = 0;
-   ktotal_c ( "spk", &count);
+   std::list<int> spk_object_ids;
+   SpiceService::instance().call ([&] () {
+      ktotal_c ( "spk", &count);
+      if (count == 0) {
+         return;
+      }
+
+      // Declare 'found_ids', a so-called cell -- a SPICE-defined variable
+      // type -- of integers which will contain an unsorted, cumulative list
+      // of all SPICE IDs loaded. The IDs will then be extracted and sorted
+      // for use by JEOD.
+      SPICEINT_CELL (found_ids, MAX_IDS);
+
+      // Walk the list of all loaded SPICE files and from it populate
+      // spk_object_ids, a sorted array of loaded spk IDs.
+      int file_handle;
+      int found;
+      char file_name[MAX_PATH_LENGTH];
+      char file_type[MAX_NAME_LENGTH];
+      char loaded_from[MAX_PATH_LENGTH];
+
+      for (int which = 0; which < count; which++) {
+
+         // Get the next spk file in the set of loaded ones.
+         kdata_c (which, "spk",
+            MAX_PATH_LENGTH, MAX_NAME_LENGTH, MAX_PATH_LENGTH,
+            file_name, file_type, loaded_from, &file_handle, &found);
+
+         // Accumulate the list of all available ephemeris objects across all
+         // spk files; spkobj_c() automatically appends to found_ids if it
+         // already contains data.
+         spkobj_c (file_name, &found_ids);
+      }
+
+      // Extract the loaded IDs into a sortable list.
+      int num_spk_objs_loaded = card_c (&found_ids);
+      for (int ii = 0; ii < num_spk_objs_loaded; ++ii) {
+         spk_object_ids.push_back (SPICE_CELL_ELEM_I (&found_ids, ii));
+      }
+   });
 
    // If list of files to load was empty, notify user and exit.
    if (count == 0) {
@@ -318,41 +366,10 @@ SpiceEphemeris::process_spk (
       return;
    }
 
-   // Declare 'found_ids', a so-called cell -- a SPICE-defined variable type --
-   // of integers which will contain an unsorted, cumulative list of all SPICE
-   // IDs loaded. The IDs will then be extracted and sorted for use by JEOD.
-   SPICEINT_CELL (found_ids, MAX_IDS);
-
-   // Walk the list of all loaded SPICE files and from it populate
-   // spk_object_ids, a sorted array of loaded spk IDs.
-   std::list<int> spk_object_ids;
-   unsigned int num_spk_objs_loaded = 0; // Will contain num of loaded objects
-   int file_handle;
-   int found;
-   char file_name[MAX_PATH_LENGTH];
-   char file_type[MAX_NAME_LENGTH];
-   char loaded_from[MAX_PATH_LENGTH];
-
-   for (int which = 0; which < count; which++) {
-
-      // Get the next spk file in the set of loaded ones.
-      kdata_c (which, "spk",
-         MAX_PATH_LENGTH, MAX_NAME_LENGTH, MAX_PATH_LENGTH,
-         file_name, file_type, loaded_from, &file_handle, &found);
-
-      // Accumulate the list of all available ephemeris objects across all
-      // spk files; spkobj_c() automatically appends to found_ids if it
-      // already contains data.
-      spkobj_c (file_name, &found_ids);
-   }
-
-   // Check how many objects were loaded from the kernels.
-   num_spk_objs_loaded = card_c (&found_ids);
-
-   // Extract the loaded IDs into a sortable list.
-   for (unsigned int ii = 0; ii < num_spk_objs_loaded; ++ii) {
-      SpiceInt which_id = SPICE_CELL_ELEM_I (&found_ids, ii);
-      spk_object_ids.push_back(which_id);
+   for (std::list<int>::const_iterator it = spk_object_ids.begin();
+        it != spk_object_ids.end();
+        ++it) {
+      int which_id = *it;
 
       // Print extracted ID if debugging messages requested.
       MessageHandler::debug (
@@ -381,7 +398,9 @@ SpiceEphemeris::process_spk (
       // Have SPICE convert the name to a standard SPICE ID number.
       int obj_id = 0; // The ID found, if one is found.
       int bool_found = 0; // Flag indicating success or failure of the search.
-      bodn2c_c (search_name.c_str(), &obj_id, &bool_found);
+      SpiceService::instance().call ([&] () {
+         bodn2c_c (search_name.c_str(), &obj_id, &bool_found);
+      });
 
       // Check whether SPICE recognized the specified object.
       if (!bool_found) {
@@ -488,7 +507,9 @@ SpiceEphemeris::create_new_ephem_point (
    int found_id = 0; // ID number for the found object.
    int found_spicebool = 0; // Flag indicating search success or failure.
 
-   bodn2c_c (spice_name.c_str(), &found_id, &found_spicebool);
+   SpiceService::instance().call ([&] () {
+      bodn2c_c (spice_name.c_str(), &found_id, &found_spicebool);
+   });
 
    if (found_spicebool == 0) {
       MessageHandler::fail (
@@ -655,7 +676,9 @@ SpiceEphemeris::name_barycenter_frames (
       char spice_name[MAX_NAME_LENGTH];
       std::string jeod_name;
 
-      bodc2n_c (ii, MAX_NAME_LENGTH, spice_name, &found);
+      SpiceService::instance().call ([&] () {
+         bodc2n_c (ii, MAX_NAME_LENGTH, spice_name, &found);
+      });
       jeod_name = spice_2_jeod( spice_name) + "Bary.inertial";
       barycenter_frames[ii].set_name (jeod_name.c_str());
    }
@@ -681,7 +704,9 @@ SpiceEphemeris::add_barycenter (
 
    // Use SPICE to convert the given ID to a SPICE name.
    int found = 0;
-   bodc2n_c (id, MAX_NAME_LENGTH, spice_name, &found);
+   SpiceService::instance().call ([&] () {
+      bodc2n_c (id, MAX_NAME_LENGTH, spice_name, &found);
+   });
 
    // Create the new barycenter and add it to the array of such.
    loaded_spk.push_back (create_new_ephem_point (jeod_name,
@@ -1027,7 +1052,31 @@ SpiceEphemeris::update_trans (
       root_item->update (null_vec, null_vec, update_time);
    }
 
+   // (Re)size the fits if fitting is enabled.
+   bool use_fits = (fit_interval > 0.0);
+   if (use_fits && (spk_fits.size() != loaded_spk.size())) {
+      spk_fits.assign (loaded_spk.size(), SpiceEphemFit());
+   }
+
+   // Without fits, obtain the states of all nodes but the root from SPICE
+   // in one batch.
+   std::vector<SpiceService::StateRequest> requests;
+   if (! use_fits) {
+      requests.reserve (loaded_spk.size());
+      for (unsigned int ii = 0; ii < loaded_spk.size(); ++ii) {
+         if (loaded_spk[ii] != root_item) {
+            SpiceService::StateRequest request;
+            request.target = loaded_spk[ii]->get_spice_id();
+            request.observer = loaded_spk[ii]->get_parent_id();
+            request.tdb = *tdb_seconds;
+            requests.push_back (request);
+         }
+      }
+      get_spice_states (requests.data(), requests.size(), true);
+   }
+
    // Perform updates of nodes with respect to their parents.
+   unsigned int next_request = 0;
    for (unsigned int ii = 0; ii < loaded_spk.size(); ++ii) {
 
       // Skip root
@@ -1035,42 +1084,219 @@ SpiceEphemeris::update_trans (
          continue;
       }
 
-      // Call to SPICE update function.
-      double state[6], position[3], velocity[3], light_time;
-      spkez_c (loaded_spk[ii]->get_spice_id(),
-               *tdb_seconds,
-               "J2000", "NONE",
-               loaded_spk[ii]->get_parent_id(),
-               state,
-               &light_time);
+      double fitted_state[6], position[3], velocity[3];
+      const double * state = fitted_state;
+      if (use_fits) {
+         get_fitted_state (ii, *tdb_seconds, fitted_state);
+      }
+      else {
+         state = requests[next_request++].state;
+      }
+
+      // Store off state for reference frame update.
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         position[jj] = state[jj];
+         velocity[jj] = state[3+jj];
+      }
+
+      // Tell ephemeris item to update its target frame. Note that the scale
+      // factor is to convert the output from SPICE into meters.
+      loaded_spk[ii]->update_scaled(position, velocity, 1000.0, update_time);
+   }
+
+   return;
+}
+
+
+/**
+ * Obtain the state of a loaded spk object relative to its parent from SPICE.
+ * A SPICE error is fatal if the state is required; otherwise the error is
+ * reset and reported to the caller.
+ * @return True if SPICE provided the state
+ * \param[in] index Index of the object in loaded_spk
+ * \param[in] tdb Ephemeris time\n Units: s
+ * \param[out] state Position and velocity\n Units: km, km/s
+ * \param[in] required Whether a SPICE error is fatal
+ */
+bool
+SpiceEphemeris::get_spice_state (
+   unsigned int index,
+   double tdb,
+   double state[6],
+   bool required)
+{
+   SpiceService::StateRequest request;
+   request.target = loaded_spk[index]->get_spice_id();
+   request.observer = loaded_spk[index]->get_parent_id();
+   request.tdb = tdb;
+
+   bool found = get_spice_states (&request, 1, required);
+   for (unsigned int jj = 0; jj < 6; ++jj) {
+      state[jj] = request.state[jj];
+   }
 
-      // Check whether SPICE returned an error message.
-      if (failed_c()) {
+   return found;
+}
 
-         // Error message returned; obtain it from SPICE.
-         char err_msg[MAX_MSG_LENGTH];
-         getmsg_c ("long", MAX_MSG_LENGTH, err_msg);
 
+/**
+ * Obtain a batch of states from SPICE through the SPICE service.
+ * A SPICE error is fatal if the states are required; otherwise the error is
+ * reset and reported to the caller.
+ * @return True if SPICE provided every state
+ * \param[in,out] requests The state requests
+ * \param[in] count Number of requests
+ * \param[in] required Whether a SPICE error is fatal
+ */
+bool
+SpiceEphemeris::get_spice_states (
+   SpiceService::StateRequest * requests,
+   unsigned int count,
+   bool required)
+{
+   std::string err_msg;
+   if (SpiceService::instance().get_states (requests, count, &err_msg)) {
+      return true;
+   }
+
+   // A fit sample outside the kernel coverage is not an error.
+   if (! required) {
+      return false;
+   }
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if (! requests[ii].found) {
+         SpiceEphemPoint * point = find_spice_id (requests[ii].target);
          MessageHandler::fail (
             __FILE__, __LINE__, EphemeridesMessages::item_not_in_file,
             "Regarding ref frame %s, spkez_c reports the following error: %s\n",
-            loaded_spk[ii]->get_target_frame()->get_name(), err_msg);
+            (point != nullptr) ? point->get_target_frame()->get_name() : "",
+            err_msg.c_str());
 
          // Not reached
-         return;
+         return false;
       }
+   }
 
-      // Store off state for reference frame update.
-      for (unsigned int jj = 0; jj < 3; ++jj) {
-         position[jj] = state[jj];
-         velocity[jj] = state[3+jj];
+   return false;
+}
+
+
+/**
+ * Obtain the state of a loaded spk object relative to its parent from its
+ * Chebyshev fit, refitting if the time is outside the fit window. Windows
+ * that could not be fit to the required accuracy are served from SPICE.
+ * \param[in] index Index of the object in loaded_spk
+ * \param[in] tdb Ephemeris time\n Units: s
+ * \param[out] state Position and velocity\n Units: km, km/s
+ */
+void
+SpiceEphemeris::get_fitted_state (
+   unsigned int index,
+   double tdb,
+   double state[6])
+{
+   SpiceEphemFit & fit = spk_fits[index];
+
+   if (! fit.covers (tdb)) {
+      refit (index, tdb);
+   }
+
+   if (fit.valid) {
+      fit.evaluate (tdb, state);
+   }
+   else {
+      get_spice_state (index, tdb, state);
+   }
+
+   return;
+}
+
+
+/**
+ * Fit the state of a loaded spk object over a window containing a time.
+ * The window extends fit_interval from the time in the direction in which
+ * time is moving. The fit is checked against SPICE midway between the fit
+ * nodes; a fit that misses fit_tolerance, or a window that extends past the
+ * kernel coverage, is retried over half the window, up to a limited number
+ * of times. If no fit succeeds, the last window
+ * attempted is marked as not valid.
+ * \param[in] index Index of the object in loaded_spk
+ * \param[in] tdb Ephemeris time\n Units: s
+ */
+void
+SpiceEphemeris::refit (
+   unsigned int index,
+   double tdb)
+{
+   static const unsigned int max_halvings = 6;
+
+   SpiceEphemFit & fit = spk_fits[index];
+   bool backward = (fit.span > 0.0) && (tdb < fit.start);
+   unsigned int nterms = fit_terms;
+   if (nterms > SpiceEphemFit::MaxTerms) {
+      nterms = SpiceEphemFit::MaxTerms;
+   }
+   else if (nterms < 2) {
+      nterms = 2;
+   }
+
+   double times[SpiceEphemFit::MaxTerms];
+   double samples[SpiceEphemFit::MaxTerms][6];
+   SpiceService::StateRequest requests[SpiceEphemFit::MaxTerms];
+   double span = fit_interval;
+   double tolerance_km = fit_tolerance / 1000.0;
+
+   for (unsigned int kk = 0; kk < nterms; ++kk) {
+      requests[kk].target = loaded_spk[index]->get_spice_id();
+      requests[kk].observer = loaded_spk[index]->get_parent_id();
+   }
+
+   for (unsigned int attempt = 0; attempt <= max_halvings; ++attempt) {
+      double start = backward ? tdb - span : tdb;
+
+      // Sample the state at the nodes in one batch.
+      SpiceEphemFit::node_times (nterms, start, span, times);
+      for (unsigned int kk = 0; kk < nterms; ++kk) {
+         requests[kk].tdb = times[kk];
+      }
+      bool accurate = get_spice_states (requests, nterms, false);
+      for (unsigned int kk = 0; kk < nterms; ++kk) {
+         for (unsigned int jj = 0; jj < 6; ++jj) {
+            samples[kk][jj] = requests[kk].state[jj];
+         }
       }
+      fit.fit (nterms, start, span, samples);
 
-      // Tell ephemeris item to update its target frame. Note that the scale
-      // factor is to convert the output from SPICE into meters.
-      loaded_spk[ii]->update_scaled(position, velocity, 1000.0, update_time);
+      // Check the position error where it is largest, between the nodes,
+      // again sampling in one batch.
+      if (accurate) {
+         for (unsigned int kk = 0; kk + 1 < nterms; ++kk) {
+            requests[kk].tdb = 0.5 * (times[kk] + times[kk+1]);
+         }
+         accurate = get_spice_states (requests, nterms - 1, false);
+      }
+      for (unsigned int kk = 0; accurate && (kk + 1 < nterms); ++kk) {
+         double fit_state[6];
+         fit.evaluate (requests[kk].tdb, fit_state);
+         double err_sq = 0.0;
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            double diff = fit_state[jj] - requests[kk].state[jj];
+            err_sq += diff * diff;
+         }
+         accurate = (std::sqrt (err_sq) <= tolerance_km);
+      }
+
+      if (accurate) {
+         return;
+      }
+
+      span *= 0.5;
    }
 
+   // No fit met the tolerance; serve the last window from SPICE.
+   fit.valid = false;
+
    return;
 }
 
@@ -1083,8 +1309,30 @@ SpiceEphemeris::update_rot (
    void)
 {
 
-   for (unsigned int ii = 0; ii < planetary_orientations.size(); ++ii) {
-      planetary_orientations[ii]->update (*tdb_seconds, *dyn_seconds);
+   unsigned int count = planetary_orientations.size();
+   if (count == 0) {
+      return;
+   }
+
+   // Obtain the transformations of all frames from SPICE in one batch.
+   std::vector<SpiceService::TransformRequest> requests (count);
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      requests[ii].frame = planetary_orientations[ii]->get_spice_frame_name();
+      requests[ii].tdb = *tdb_seconds;
+   }
+   SpiceService::instance().get_transforms (requests.data(), count);
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if (! requests[ii].found) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, EphemeridesMessages::item_not_in_file,
+            "The reference frame %s was not in the loaded kernels.",
+            requests[ii].frame);
+
+         // Not reached
+         return;
+      }
+      planetary_orientations[ii]->update (requests[ii].transform, *dyn_seconds);
    }
 
    return;
@@ -1101,20 +1349,22 @@ SpiceEphemeris::mute_spice_errors (
 
    // Set the default SPICE action upon encountering an error to be to
    // return the error but not abort.
-   char new_value [MAX_NAME_LENGTH];
-   strcpy (new_value, "return");
-   erract_c ("set", MAX_NAME_LENGTH, new_value);
-
-   // Set the default SPICE error report target to NULL rather than the
-   // screen. The SPICE-internal message will then be fed exclusively to
-   // the JEOD MessageHandler.
-   strcpy (new_value, "null");
-   errdev_c ("set", MAX_NAME_LENGTH, new_value);
-
-   // Set the default SPICE error report length to be middle-sized. These
-   // will then be fed to the JEOD MessageHandler.
-   strcpy (new_value, "explain");
-   errprt_c ("set", MAX_NAME_LENGTH, new_value);
+   SpiceService::instance().call ([] () {
+      char new_value [MAX_NAME_LENGTH];
+      strcpy (new_value, "return");
+      erract_c ("set", MAX_NAME_LENGTH, new_value);
+
+      // Set the default SPICE error report target to NULL rather than the
+      // screen. The SPICE-internal message will then be fed exclusively to
+      // the JEOD MessageHandler.
+      strcpy (new_value, "null");
+      errdev_c ("set", MAX_NAME_LENGTH, new_value);
+
+      // Set the default SPICE error report length to be middle-sized. These
+      // will then be fed to the JEOD MessageHandler.
+      strcpy (new_value, "explain");
+      errprt_c ("set", MAX_NAME_LENGTH, new_value);
+   });
 
    return;
 }
@@ -0,0 +1,156 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Spice
+ * @{
+ *
+ * @file models/environment/spice/src/spice_ephem_fit.cc
+ * Define the methods for the SPICE state fit class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library Dependencies:
+  ((spice_ephem_fit.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cmath>
+
+// Model includes
+#include "../include/spice_ephem_fit.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * SpiceEphemFit default constructor.
+ */
+SpiceEphemFit::SpiceEphemFit (
+   void)
+:
+   start(0.0),
+   span(-1.0),
+   nterms(0),
+   valid(false),
+   coeffs()
+{
+   ; // Empty
+}
+
+
+/**
+ * Compute the Chebyshev nodes of a window, in increasing time order.
+ * \param[in] nterms Number of nodes
+ * \param[in] start Start of the window\n Units: s
+ * \param[in] span Length of the window\n Units: s
+ * \param[out] times Node times\n Units: s
+ */
+void
+SpiceEphemFit::node_times (
+   unsigned int nterms,
+   double start,
+   double span,
+   double * times)
+{
+   for (unsigned int kk = 0; kk < nterms; ++kk) {
+      double x = -std::cos (M_PI * (kk + 0.5) / nterms);
+      times[kk] = start + 0.5 * span * (x + 1.0);
+   }
+}
+
+
+/**
+ * Fit the series to a state sampled at the node times of the window.
+ * \param[in] nterms_in Number of terms, at most MaxTerms
+ * \param[in] start_in Start of the window\n Units: s
+ * \param[in] span_in Length of the window\n Units: s
+ * \param[in] samples State at each node time
+ */
+void
+SpiceEphemFit::fit (
+   unsigned int nterms_in,
+   double start_in,
+   double span_in,
+   const double samples[][6])
+{
+   nterms = (nterms_in > MaxTerms) ? MaxTerms : nterms_in;
+   start = start_in;
+   span = span_in;
+
+   // With x_k = -cos(pi (k+1/2)/n), T_j(x_k) = (-1)^j cos(pi j (k+1/2)/n).
+   for (unsigned int jj = 0; jj < nterms; ++jj) {
+      double sign = (jj % 2 == 0) ? 1.0 : -1.0;
+      double scale = ((jj == 0) ? 1.0 : 2.0) / nterms;
+      for (unsigned int cc = 0; cc < 6; ++cc) {
+         coeffs[cc][jj] = 0.0;
+      }
+      for (unsigned int kk = 0; kk < nterms; ++kk) {
+         double tjk = sign * std::cos (M_PI * jj * (kk + 0.5) / nterms);
+         for (unsigned int cc = 0; cc < 6; ++cc) {
+            coeffs[cc][jj] += samples[kk][cc] * tjk;
+         }
+      }
+      for (unsigned int cc = 0; cc < 6; ++cc) {
+         coeffs[cc][jj] *= scale;
+      }
+   }
+
+   valid = true;
+}
+
+
+/**
+ * Evaluate the series by Clenshaw recurrence.
+ * \param[in] time Time within the window\n Units: s
+ * \param[out] state Interpolated state
+ */
+void
+SpiceEphemFit::evaluate (
+   double time,
+   double state[6])
+const
+{
+   double x = 2.0 * (time - start) / span - 1.0;
+   double twox = 2.0 * x;
+
+   for (unsigned int cc = 0; cc < 6; ++cc) {
+      double b1 = 0.0;
+      double b2 = 0.0;
+      for (unsigned int jj = nterms - 1; jj > 0; --jj) {
+         double b0 = twox * b1 - b2 + coeffs[cc][jj];
+         b2 = b1;
+         b1 = b0;
+      }
+      state[cc] = x * b1 - b2 + coeffs[cc][0];
+   }
+}
+
+
+/**
+ * Mark the fit as covering no time.
+ */
+void
+SpiceEphemFit::invalidate (
+   void)
+{
+   span = -1.0;
+   valid = false;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
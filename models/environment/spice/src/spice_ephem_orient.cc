@@ -16,7 +16,8 @@ Purpose:
   ()
 
 Library Dependencies:
-  ((environment/ephemerides/ephem_item/src/ephem_orient.cc))
+  ((spice_service.cc)
+   (environment/ephemerides/ephem_item/src/ephem_orient.cc))
 
 
 *******************************************************************************/
@@ -24,9 +25,6 @@ Library Dependencies:
 
 // System includes
 
-// SPICE includes
-#include "SpiceUsr.h"
-
 // JEOD includes
 #include "environment/ephemerides/ephem_interface/include/ephem_messages.hh"
 #include "utils/math/include/vector3.hh"
@@ -34,6 +32,7 @@ Library Dependencies:
 
 // Model includes
 #include "../include/spice_ephem_orient.hh"
+#include "../include/spice_service.hh"
 
 
 //! Namespace jeod
@@ -79,6 +78,23 @@ SpiceEphemOrientation::update (
    double trans6x6[6][6];
    get_spice_transformation (time_tdb, trans6x6);
 
+   update (trans6x6, time_dyn);
+
+   return;
+}
+
+
+/**
+ * Update the rotational state of the target frame from a transformation
+ * obtained from SPICE.
+ * \param[in] trans6x6 Spice matrix
+ * \param[in] time_dyn dyn time for timestamp\n Units: s
+ */
+void
+SpiceEphemOrientation::update (
+   const double trans6x6[6][6],
+   double time_dyn)
+{
 
    // Extract the upper left and lower left 3 x 3 submatrices of the 6 x 6
    // matrix returned by get_spice_transformation(). In this case, these are
@@ -152,11 +168,13 @@ SpiceEphemOrientation::get_spice_transformation (
    // is the 3 x 3 transformation matrix from parent to child, and
    // dR/dt is its time derivative. Note that only the upper left (R) and lower
    // left (dR/dt) submatrices will be needed to perform the target frame state
-   // update.
-   sxform_c ("J2000", spice_frame_name.c_str(), time_tdb, trans6x6);
+   // update. The call is made on the SPICE service thread.
+   SpiceService::TransformRequest request;
+   request.frame = spice_frame_name.c_str();
+   request.tdb = time_tdb;
 
    // Check for successful call of sxform_c()
-   if (failed_c()) {
+   if (! SpiceService::instance().get_transforms (&request, 1)) {
       MessageHandler::fail (
       __FILE__, __LINE__, EphemeridesMessages::item_not_in_file,
       "The reference frame %s was not in the loaded kernels.",
@@ -167,6 +185,12 @@ SpiceEphemOrientation::get_spice_transformation (
       return;
    }
 
+   for (unsigned ii = 0; ii < 6; ++ii) {
+      for (unsigned jj = 0; jj < 6; ++jj) {
+         trans6x6[ii][jj] = request.transform[ii][jj];
+      }
+   }
+
    return;
 }
 
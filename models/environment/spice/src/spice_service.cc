@@ -0,0 +1,253 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Spice
+ * @{
+ *
+ * @file models/environment/spice/src/spice_service.cc
+ * Define the methods for the SPICE service class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library Dependencies:
+  ((spice_service.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <string>
+
+// Include SPICE library header for access to its functions.
+#include "SpiceUsr.h"
+
+// Model includes
+#include "../include/spice_service.hh"
+
+
+// Size of the SPICE long error message.
+const static int MAX_MSG_LENGTH = 1841;
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Get the process-wide SPICE service.
+ * @return The service
+ */
+SpiceService &
+SpiceService::instance (
+   void)
+{
+   static SpiceService service;
+   return service;
+}
+
+
+/**
+ * SpiceService constructor. No thread is started until needed.
+ */
+SpiceService::SpiceService (
+   void)
+:
+   worker (),
+   mutex (),
+   request_cond (),
+   done_cond (),
+   pending (),
+   shutdown (false)
+{
+   ; // Empty
+}
+
+
+/**
+ * SpiceService destructor. Stops and joins the service thread.
+ */
+SpiceService::~SpiceService (
+   void)
+{
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      shutdown = true;
+   }
+   request_cond.notify_all ();
+
+   if (worker.joinable()) {
+      worker.join ();
+   }
+}
+
+
+/**
+ * Run a task on the service thread and wait for it to complete. A task
+ * submitted from the service thread itself (a task that submits another)
+ * is run directly. The task must not throw and should not call the
+ * MessageHandler; it should make its CSPICE calls, collect any SPICE error
+ * with take_spice_error, and leave the reporting to the caller.
+ * \param[in] task The task
+ */
+void
+SpiceService::call (
+   const std::function<void ()> & task)
+{
+   Task entry = {&task, false};
+
+   std::unique_lock<std::mutex> lock (mutex);
+   if (worker.get_id() == std::this_thread::get_id()) {
+      lock.unlock ();
+      task ();
+      return;
+   }
+   if (! worker.joinable()) {
+      worker = std::thread (&SpiceService::worker_loop, this);
+   }
+   pending.push_back (&entry);
+   request_cond.notify_one ();
+
+   while (! entry.done) {
+      done_cond.wait (lock);
+   }
+}
+
+
+/**
+ * Obtain the states of a batch of targets with one trip to the service
+ * thread. A state SPICE cannot provide is marked as not found and the
+ * SPICE error is cleared; the remaining requests are still served.
+ * @return True if every state was found
+ * \param[in,out] requests The requests
+ * \param[in] count Number of requests
+ * \param[out] error If not null, the SPICE message for the first request
+ *                   not found
+ */
+bool
+SpiceService::get_states (
+   StateRequest * requests,
+   unsigned int count,
+   std::string * error)
+{
+   bool all_found = true;
+
+   call ([&] () {
+      for (unsigned int ii = 0; ii < count; ++ii) {
+         StateRequest & request = requests[ii];
+         double light_time;
+
+         spkez_c (request.target, request.tdb, "J2000", "NONE",
+                  request.observer, request.state, &light_time);
+         request.found = ! take_spice_error (all_found ? error : nullptr);
+         all_found = all_found && request.found;
+      }
+   });
+
+   return all_found;
+}
+
+
+/**
+ * Obtain the transformations to a batch of frames with one trip to the
+ * service thread. A transformation SPICE cannot provide is marked as not
+ * found and the SPICE error is cleared; the remaining requests are still
+ * served.
+ * @return True if every transformation was found
+ * \param[in,out] requests The requests
+ * \param[in] count Number of requests
+ * \param[out] error If not null, the SPICE message for the first request
+ *                   not found
+ */
+bool
+SpiceService::get_transforms (
+   TransformRequest * requests,
+   unsigned int count,
+   std::string * error)
+{
+   bool all_found = true;
+
+   call ([&] () {
+      for (unsigned int ii = 0; ii < count; ++ii) {
+         TransformRequest & request = requests[ii];
+
+         sxform_c ("J2000", request.frame, request.tdb, request.transform);
+         request.found = ! take_spice_error (all_found ? error : nullptr);
+         all_found = all_found && request.found;
+      }
+   });
+
+   return all_found;
+}
+
+
+/**
+ * Check whether the most recent CSPICE calls signaled an error and, if so,
+ * obtain the error message and reset the SPICE error status so that later
+ * calls are not affected. Must be called on the service thread, i.e., from
+ * within a task.
+ * @return True if SPICE signaled an error
+ * \param[out] error If not null, the long error message
+ */
+bool
+SpiceService::take_spice_error (
+   std::string * error)
+{
+   if (! failed_c()) {
+      return false;
+   }
+
+   if (error != nullptr) {
+      char err_msg[MAX_MSG_LENGTH];
+      getmsg_c ("long", MAX_MSG_LENGTH, err_msg);
+      *error = err_msg;
+   }
+   reset_c ();
+
+   return true;
+}
+
+
+/**
+ * Service thread main loop.
+ */
+void
+SpiceService::worker_loop (
+   void)
+{
+   for (;;) {
+      Task * entry;
+      {
+         std::unique_lock<std::mutex> lock (mutex);
+         while ((! shutdown) && pending.empty()) {
+            request_cond.wait (lock);
+         }
+         if (pending.empty()) {
+            return;
+         }
+         entry = pending.front();
+         pending.pop_front();
+      }
+
+      (*entry->function) ();
+
+      {
+         std::lock_guard<std::mutex> lock (mutex);
+         entry->done = true;
+      }
+      done_cond.notify_all ();
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
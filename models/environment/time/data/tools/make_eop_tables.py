@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Converts IERS Earth orientation and leap second files into the binary
+table files read by EOPTableFile, so that TimeConverter_TAI_UT1,
+TimeConverter_TAI_UTC, and PolarMotionJ2000 can be updated without a
+rebuild.
+
+Inputs:
+  EOP C04 series (e.g. eopc04_14_IAU2000.62-now.txt or eopc04.1962-now),
+  one line per day with the date, MJD, x, y (arcsec) and UT1-UTC (s).
+  Leap_Second.dat, one line per leap second with the MJD and TAI-UTC (s).
+
+Outputs (each optional):
+  --tai-ut1  table "tai_to_ut1": when (TJT, days), value (UT1-TAI, s)
+  --tai-utc  table "tai_to_utc": when (TJT, days), value (TAI-UTC, s)
+  --polar    table "polar_motion": mjd (days), xp, yp (rad)
+
+Usage:
+  make_eop_tables.py --eop eopc04.1962-now --leap Leap_Second.dat \\
+     --tai-ut1 tai_to_ut1.tbl --tai-utc tai_to_utc.tbl --polar xpyp.tbl
+"""
+
+import argparse
+import bisect
+import struct
+import sys
+
+
+FORMAT_VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+NAME_LENGTH = 16
+ARCSECONDS_TO_RADIANS = 4.84813681109536e-06
+
+# Truncated Julian time is MJD - 40000.
+TJT_OFFSET = 40000.0
+
+
+def write_table (path, kind, columns):
+   """Write a table file; columns is a list of (name, values)."""
+   num_rows = len (columns[0][1])
+   with open (path, "wb") as out:
+      out.write (struct.pack ("=8sIIIIQ16s16x", b"JEODTBL", BYTE_ORDER_MARK,
+                              FORMAT_VERSION, len (columns), 0, num_rows,
+                              kind.encode ()))
+      for name, _ in columns:
+         out.write (struct.pack ("=16s", name.encode ()))
+      for _, values in columns:
+         out.write (struct.pack ("={0}d".format (num_rows), *values))
+
+
+def is_number (text):
+   try:
+      float (text)
+      return True
+   except ValueError:
+      return False
+
+
+def read_leap_seconds (path):
+   """Return sorted lists of leap second MJDs and TAI-UTC values."""
+   mjds = []
+   values = []
+   with open (path) as inp:
+      for line in inp:
+         fields = line.split ()
+         if not fields or fields[0].startswith ("#") or \
+            not all (is_number (field) for field in fields[:5]):
+            continue
+         mjds.append (float (fields[0]))
+         values.append (float (fields[4]))
+   return mjds, values
+
+
+def read_eop (path):
+   """Return lists of MJD, x, y (arcsec), and UT1-UTC (s) per day."""
+   mjds = []
+   xps = []
+   yps = []
+   dut1s = []
+   with open (path) as inp:
+      for line in inp:
+         fields = line.split ()
+         if len (fields) < 7 or \
+            not all (is_number (field) for field in fields[:8]):
+            continue
+         # The 2014 series has no hour column; the 2020 series does.
+         mjd_col = 3 if float (fields[3]) > 30000.0 else 4
+         mjds.append (float (fields[mjd_col]))
+         xps.append (float (fields[mjd_col + 1]))
+         yps.append (float (fields[mjd_col + 2]))
+         dut1s.append (float (fields[mjd_col + 3]))
+   return mjds, xps, yps, dut1s
+
+
+def main ():
+   parser = argparse.ArgumentParser (
+      description="Convert IERS data to JEOD binary table files.")
+   parser.add_argument ("--eop", help="IERS EOP C04 file")
+   parser.add_argument ("--leap", help="IERS Leap_Second.dat file")
+   parser.add_argument ("--tai-ut1", help="Output TAI to UT1 table")
+   parser.add_argument ("--tai-utc", help="Output TAI to UTC table")
+   parser.add_argument ("--polar", help="Output polar motion table")
+   args = parser.parse_args ()
+
+   if (args.tai_ut1 or args.tai_utc) and not args.leap:
+      sys.exit ("The TAI to UT1 and TAI to UTC tables need --leap")
+   if (args.tai_ut1 or args.polar) and not args.eop:
+      sys.exit ("The TAI to UT1 and polar motion tables need --eop")
+
+   if args.leap:
+      leap_mjds, leap_values = read_leap_seconds (args.leap)
+      if len (leap_mjds) < 2:
+         sys.exit ("No leap seconds found in " + args.leap)
+   if args.eop:
+      mjds, xps, yps, dut1s = read_eop (args.eop)
+      if len (mjds) < 2:
+         sys.exit ("No Earth orientation data found in " + args.eop)
+
+   if args.tai_utc:
+      write_table (args.tai_utc, "tai_to_utc",
+                   [("when", [mjd - TJT_OFFSET for mjd in leap_mjds]),
+                    ("value", leap_values)])
+
+   if args.tai_ut1:
+      # Dates before the first leap second use the first TAI-UTC value,
+      # as the compiled-in table does.
+      values = []
+      for mjd, dut1 in zip (mjds, dut1s):
+         index = max (bisect.bisect_right (leap_mjds, mjd) - 1, 0)
+         values.append (dut1 - leap_values[index])
+      write_table (args.tai_ut1, "tai_to_ut1",
+                   [("when", [mjd - TJT_OFFSET for mjd in mjds]),
+                    ("value", values)])
+
+   if args.polar:
+      write_table (args.polar, "polar_motion",
+                   [("mjd", mjds),
+                    ("xp", [ARCSECONDS_TO_RADIANS * xp for xp in xps]),
+                    ("yp", [ARCSECONDS_TO_RADIANS * yp for yp in yps])])
+
+
+if __name__ == "__main__":
+   main ()
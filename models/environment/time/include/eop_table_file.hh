@@ -0,0 +1,181 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Time
+ * @{
+ *
+ * @file models/environment/time/include/eop_table_file.hh
+ * Define class EOPTableFile, a read-only memory mapping of a binary Earth
+ * orientation parameter, leap second, or polar motion table.
+ */
+
+/******************************************************************************
+Purpose:
+  ()
+
+Reference:
+  (((None)))
+
+Assumptions and limitations:
+  ((Files are written in the byte order of the host that reads them)
+   (Columns are stored as doubles, one column after another))
+
+
+
+Library dependencies:
+  ((../src/eop_table_file.cc))
+*******************************************************************************/
+
+#ifndef JEOD_EOP_TABLE_FILE_HH
+#define JEOD_EOP_TABLE_FILE_HH
+
+// System includes
+#include <cstddef>
+#include <string>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A binary table of named columns, memory mapped read-only so that only
+ * the pages actually looked up are read from disk.
+ *
+ * The file layout is
+ *  - a 64 byte header: the magic string "JEODTBL", a 32 bit byte order
+ *    mark (0x01020304), the 32 bit format version, the 32 bit column
+ *    count, the 64 bit row count, and a 16 character table kind;
+ *  - one 16 character name per column;
+ *  - the column data, num_rows doubles per column.
+ *
+ * Files are produced from IERS data by
+ * models/environment/time/data/tools/make_eop_tables.py.
+ */
+class EOPTableFile {
+
+   JEOD_MAKE_SIM_INTERFACES(EOPTableFile)
+
+public:
+
+   /**
+    * The format version this class reads.
+    */
+   static const unsigned int format_version = 1;
+
+   EOPTableFile ();
+
+   ~EOPTableFile ();
+
+   // Map the named file, which must hold a table of the given kind.
+   void open (const std::string & file_name, const char * kind);
+
+   // Unmap the file.
+   void close ();
+
+   /**
+    * Whether a file is mapped.
+    * @return True if open succeeded
+    */
+   bool is_open () const
+   {
+      return (map_addr != nullptr);
+   }
+
+   /**
+    * Number of rows in the table.
+    * @return Row count
+    */
+   unsigned int num_rows () const
+   {
+      return rows;
+   }
+
+   // The named column; fails if there is no such column.
+   const double * column (const char * name) const;
+
+   // Ask the system to read ahead the rows around the given one.
+   void prefetch (
+      const double * column_data, unsigned int row, unsigned int count) const;
+
+private:
+
+   /**
+    * Name of the mapped file
+    */
+   std::string file_name; //!< trick_io(**)
+
+   /**
+    * Start of the mapping
+    */
+   void * map_addr; //!< trick_io(**)
+
+   /**
+    * Length of the mapping
+    */
+   std::size_t map_size; //!< trick_io(**)
+
+   /**
+    * Number of columns
+    */
+   unsigned int columns; //!< trick_io(**)
+
+   /**
+    * Number of rows
+    */
+   unsigned int rows; //!< trick_io(**)
+
+   // The mapping is owned by a single object.
+   EOPTableFile (const EOPTableFile &);
+   EOPTableFile & operator = (const EOPTableFile &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -131,6 +131,13 @@ public:
     */
    std::string update_from_name;      //!< trick_units(--)
 
+   /**
+    * Whether this time-type is read by the simulation. Time-types that are
+    * neither referenced nor the update source of a referenced time-type
+    * are left out of the TimeManager update plan and are not updated.
+    */
+   bool referenced;      //!< trick_units(--)
+
    /**
     * Pointer to the TimeManager
     */
@@ -211,6 +218,14 @@ public:
     return index;
   }
 
+  /**
+   * Getter for the clock resolution
+   */
+  double get_clock_resolution() const
+  {
+    return clock_resolution;
+  }
+
   /**
    * Force reset the initialization status
    */
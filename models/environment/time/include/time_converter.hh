@@ -176,6 +176,9 @@ public:
   // used at time reversals to verify the ends of the lookup table
    virtual void verify_table_lookup_ends (void);
 
+  // whether the converted time is a function of the source time alone
+   virtual bool output_depends_only_on_input (void) const;
+
    /**
     * Return the offset from the parent time object to this object.
     * @return a_to_b_offset member.
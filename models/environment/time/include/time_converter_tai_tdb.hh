@@ -147,6 +147,12 @@ public:
   // convert_b_to_a: Apply the converter in the reverse direction
    void convert_b_to_a (void) override;
 
+  // The converted time depends only on the source time
+   bool output_depends_only_on_input (void) const override
+   {
+      return true;
+   }
+
  // The copy constructor and assignment operator for this class are
  // declared private and are not implemented.
 private:
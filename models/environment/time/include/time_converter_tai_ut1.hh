@@ -60,18 +60,21 @@ Assumptions and limitations:
 
 
 Library dependencies:
-  ((../src/time_converter_tai_ut1.cc))
+  ((../src/time_converter_tai_ut1.cc)
+   (../src/eop_table_file.cc))
 *******************************************************************************/
 
 #ifndef JEOD_TIME_CONVERTER_TAI_UT1_HH
 #define JEOD_TIME_CONVERTER_TAI_UT1_HH
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
+#include "eop_table_file.hh"
 #include "time_converter.hh"
 
 
@@ -131,6 +134,18 @@ public:
     * Vector of corresponding times
     */
   double * when_vec;      //!< trick_units(day)
+   /**
+    * Binary table file (see EOPTableFile) to map in place of the
+    * compiled-in table. When set, when_vec and val_vec point into the
+    * read-only mapping. Empty (the default) uses the default data.
+    */
+  std::string data_file;  //!< trick_units(--)
+   /**
+    * Data module (see DataModuleLoader) that supplies the table in place of
+    * the compiled-in default data, e.g. "tai_to_ut1". Ignored when data_file is
+    * set or when a table has already been provided.
+    */
+  std::string data_module;  //!< trick_units(--)
 
 private:
    /**
@@ -176,6 +191,12 @@ public:
   // convert_b_to_a: Apply the converter in the reverse direction
    void convert_b_to_a (void) override;
 
+  // The converted time depends only on the source time
+   bool output_depends_only_on_input (void) const override
+   {
+      return true;
+   }
+
  private:
   // initialize_tai_to_ut1 tables:
    void initialize_tai_to_ut1 (void);
@@ -183,6 +204,17 @@ public:
   // used at time reversals to verify the ends of the lookup table
    void verify_table_lookup_ends (void) override;
 
+  // move to the table entries bracketing a TAI time after a jump
+   void seek (double tai_time);
+
+  // map data_file and point the table at it
+   void load_data_file (void);
+
+   /**
+    * Mapping of data_file.
+    */
+  EOPTableFile table_file; //!< trick_io(**)
+
  // The copy constructor and assignment operator for this class are
  // declared private and are not implemented.
    TimeConverter_TAI_UT1 (const TimeConverter_TAI_UT1&);
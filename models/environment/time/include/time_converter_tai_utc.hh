@@ -60,13 +60,16 @@ Assumptions and limitations:
 
 
 Library dependencies:
-  ((../src/time_converter_tai_utc.cc))
+  ((../src/time_converter_tai_utc.cc)
+   (../src/eop_table_file.cc))
 ******************************************************************************/
 
 #ifndef JEOD_TIME_CONVERTER_TAI_UTC_HH
 #define JEOD_TIME_CONVERTER_TAI_UTC_HH
 
 // System includes
+#include <string>
+#include <vector>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
@@ -130,6 +133,18 @@ public:
     * to changes in leap_value
     */
   double * when_vec;    //!< trick_units(day)
+   /**
+    * Binary table file (see EOPTableFile) to load in place of the
+    * compiled-in leap second table. Empty (the default) uses the default
+    * data.
+    */
+  std::string data_file;  //!< trick_units(--)
+   /**
+    * Data module (see DataModuleLoader) that supplies the table in place of
+    * the compiled-in default data, e.g. "tai_to_utc". Ignored when data_file is
+    * set or when a table has already been provided.
+    */
+  std::string data_module;  //!< trick_units(--)
 private:
    /**
     * The next (future) UTC time of a leap second instance
@@ -145,6 +160,30 @@ private:
     * not covered by the leap-second tables
     */
   bool off_table_end;    //!< trick_units(--)
+   /**
+    * Flag to indicate that data_file has been loaded
+    */
+  bool data_file_loaded;    //!< trick_io(**)
+
+   /**
+    * TAI times, as Truncated Julian times, at which the entries of the leap
+    * second tables take effect; used to convert arbitrary TAI times to UTC.
+    */
+  std::vector<double> tai_when;  //!< trick_io(**)
+
+   /**
+    * Interval of tai_when found by the most recent arbitrary-time lookup.
+    */
+  unsigned int query_index;  //!< trick_io(**)
+
+   /**
+    * UTC Truncated Julian day of the most recent arbitrary-time calendar
+    * conversion, and its calendar date.
+    */
+  int query_julian_day;  //!< trick_io(**)
+  int query_year;        //!< trick_io(**)
+  int query_month;       //!< trick_io(**)
+  int query_day;         //!< trick_io(**)
 
 // Member functions:
 public:
@@ -164,10 +203,31 @@ public:
   // convert_b_to_a: Apply the converter in the reverse direction
    void convert_b_to_a (void) override;
 
+  // The converted time depends only on the source time
+   bool output_depends_only_on_input (void) const override
+   {
+      return true;
+   }
+
+  // utc_at_tai: Convert an arbitrary TAI time to UTC
+   double utc_at_tai (double tai_tjt);
+
+  // utc_calendar_at_tai: Convert an arbitrary TAI time to a UTC calendar
+  // date and time
+   void utc_calendar_at_tai (double tai_tjt,
+                             int & year, int & month, int & day,
+                             int & hour, int & minute, double & second);
+
  private:
   // initialize_leap_second: Initialize the leap second table
    void initialize_leap_second (void);
 
+  // load_data_file: Replace the leap second table with data_file's
+   void load_data_file (void);
+
+  // build_tai_epochs: Express the leap second table epochs as TAI times
+   void build_tai_epochs (void);
+
   // used at time reversals to verify the ends of the lookup table
    void verify_table_lookup_ends (void) override;
 
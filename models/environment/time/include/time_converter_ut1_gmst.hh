@@ -115,6 +115,12 @@ public:
   // convert_a_to_b: Apply the converter in the forward direction
    void convert_a_to_b (void) override;
 
+  // The converted time depends only on the source time
+   bool output_depends_only_on_input (void) const override
+   {
+      return true;
+   }
+
  // The copy constructor and assignment operator for this class are
  // declared private and are not implemented.
  private:
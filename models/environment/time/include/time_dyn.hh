@@ -68,6 +68,7 @@ Library dependencies:
 // System includes
 
 // JEOD includes
+#include "utils/memory/include/class_declarations.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -115,6 +116,7 @@ public:
   // Destructor
    ~TimeDyn () override;
    bool update_offset (void);
+   void add_snapshot_regions (StateSnapshot & snapshot);
 
 private:
    void initialize_initializer_time (TimeManagerInit * tm_init) override;
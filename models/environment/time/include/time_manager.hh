@@ -74,6 +74,7 @@ Library dependencies:
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
 #include "utils/integration/include/jeod_integration_time.hh"
+#include "utils/named_item/include/name_table.hh"
 
 // Model includes
 #include "time_dyn.hh"
@@ -135,6 +136,31 @@ private:
     */
   std::vector<TimeConverter*> converter_vector;
 
+   /**
+    * One entry of the compiled update plan.
+    */
+  struct UpdateStep {
+     JeodBaseTime * time;        //!< Time-type updated by this step
+     TimeConverter * converter;  //!< Converter called, or null to call update
+     JeodBaseTime * source;      //!< Time-type the converter reads
+     int direction;              //!< +1 for convert_a_to_b, -1 for b_to_a
+     bool skip_if_unchanged;     //!< Skip when the source has not changed
+     bool executed;              //!< Whether the step has run
+     double source_seconds;      //!< Source seconds when the step last ran
+  };
+
+   /**
+    * Dependency-ordered update steps for the referenced time-types,
+    * built by TimeManagerInit. Empty until the manager is initialized.
+    */
+  std::vector<UpdateStep> update_plan; //!< trick_io(**)
+
+   /**
+    * Index from interned time-type name to position in time_vector.
+    * This is a cache; it is rebuilt whenever it is found to be out of date.
+    */
+  mutable NameIndex time_index; //!< trick_io(**)
+
 // Member functions:
 public:
   //Constructor
@@ -145,6 +171,7 @@ public:
    void initialize (TimeManagerInit * time_manager_init);
 
    int time_lookup ( const std::string& name ) const;
+   int time_lookup ( NameHandle handle ) const;
 
    bool get_time_change_flag () const;
    JeodBaseTime * get_time_ptr (const std::string& name) const;
@@ -156,6 +183,8 @@ public:
    virtual void update (double time);
    void verify_table_lookup_ends (void);
 
+   void add_snapshot_regions (StateSnapshot & snapshot);
+
    void register_time (JeodBaseTime & time_ref);
    void register_time_named (JeodBaseTime & time_ref, const std::string& name);
 
@@ -184,6 +213,15 @@ private:
    // Implement the pure virtual update_time inherited from JeodIntegrationTime.
    void update_time (double time) override;
 
+   // Run the update plan, or update every time-type if there is none.
+   void update_times (void);
+
+   // Rebuild the name index from the list of time-types.
+   void rebuild_time_index (void) const;
+
+   // Find a time-type by comparing names, reporting duplicates.
+   int scan_time_vector ( const std::string& name ) const;
+
 
  // The copy constructor and assignment operator for this class are
  // declared private and are not implemented.
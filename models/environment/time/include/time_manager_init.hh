@@ -190,6 +190,8 @@ private:
 
    void create_update_tree (void);
 
+   void create_update_plan (void);
+
  // The copy constructor and assignment operator for this class are
  // declared private and are not implemented.
  private:
@@ -106,6 +106,12 @@ public:
     */
    int prev_julian_day;      //!< trick_units(day)
 
+   /**
+    * The value of trunc_julian_time at which the calendar values were last
+    * calculated. The calculation is skipped while the time is unchanged.
+    */
+   double tjt_at_calendar_update; //!< trick_units(day)
+
    /**
     * The value of "seconds" at the start of the year in which the last
     * seconds_of_year calculation was made.  Used for
@@ -206,6 +212,9 @@ public:
    double julian_date_at_epoch (void);
 
    double seconds_of_year (void);
+
+   static void calendar_date (int julian_day,
+                              int & year, int & month, int & day);
 protected:
 
 
@@ -142,6 +142,12 @@ public:
     */
   double last_clock_update; //!< trick_units(s)
 
+   /**
+    * Whether the clock values reflect the current value of seconds.
+    * Cleared when the time changes; the clock is recomputed on request.
+    */
+  bool clock_is_current; //!< trick_units(--)
+
    /**
     * Format for expressing the epoch of this type (calendar, julian, etc)
     */
@@ -212,6 +218,7 @@ public:
                              TimeManagerInit * tm_init) override;
    void initialize_from_parent (TimeManagerInit * tm_init) override;
    void set_time_by_clock (void);
+   void clock_update (double simtime);
    void set_time_by_seconds (const double new_seconds) override;
    void set_time_by_days (const double new_days) override;
    void set_epoch_initializing_value (const double simtime,
@@ -0,0 +1,255 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Time
+ * @{
+ *
+ * @file models/environment/time/src/eop_table_file.cc
+ * Define the methods of class EOPTableFile.
+ */
+
+/******************************************************************************
+PURPOSE:
+  ()
+
+REFERENCE:
+  (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((POSIX mmap))
+
+LIBRARY DEPENDENCY:
+  ((eop_table_file.cc)
+   (time_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+ 
+******************************************************************************/
+
+// System includes
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/eop_table_file.hh"
+#include "../include/time_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Fixed part of the table file header.
+ */
+struct EOPTableHeader {
+   char magic[8];
+   std::uint32_t byte_order;
+   std::uint32_t version;
+   std::uint32_t num_columns;
+   std::uint32_t reserved;
+   std::uint64_t num_rows;
+   char kind[16];
+   char padding[16];
+};
+
+const std::size_t name_length = 16;
+
+}
+
+
+/**
+ * Construct an EOPTableFile with no file mapped.
+ */
+EOPTableFile::EOPTableFile (
+   void)
+:
+   file_name(),
+   map_addr(nullptr),
+   map_size(0),
+   columns(0),
+   rows(0)
+{ }
+
+
+/**
+ * Destruct an EOPTableFile, unmapping the file.
+ */
+EOPTableFile::~EOPTableFile (
+   void)
+{
+   close ();
+}
+
+
+/**
+ * Map a table file read-only and validate its header.
+ * Pages are read on demand; lookups by binary search touch only a
+ * logarithmic number of pages plus those around the simulation epoch.
+ * \param[in] name Name of the file
+ * \param[in] kind Expected table kind, e.g. "tai_to_ut1"
+ */
+void
+EOPTableFile::open (
+   const std::string & name,
+   const char * kind)
+{
+   close ();
+
+   int fd = ::open (name.c_str(), O_RDONLY);
+   struct stat file_stat;
+   if ((fd < 0) || (fstat (fd, &file_stat) != 0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, TimeMessages::invalid_data_error,
+         "Unable to open the table file '%s': %s",
+         name.c_str(), std::strerror(errno));
+      if (fd >= 0) {
+         ::close (fd);
+      }
+      return;
+   }
+
+   std::size_t size = static_cast<std::size_t> (file_stat.st_size);
+   void * addr = MAP_FAILED;
+   if (size >= sizeof(EOPTableHeader)) {
+      addr = mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+   }
+   ::close (fd);
+
+   if (addr == MAP_FAILED) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, TimeMessages::invalid_data_error,
+         "Unable to map the table file '%s'", name.c_str());
+      return;
+   }
+   madvise (addr, size, MADV_RANDOM);
+
+   const EOPTableHeader * header = static_cast<const EOPTableHeader *> (addr);
+   const char * error = nullptr;
+   if (std::strncmp (header->magic, "JEODTBL", sizeof(header->magic)) != 0) {
+      error = "is not a JEOD table file";
+   }
+   else if (header->byte_order != 0x01020304U) {
+      error = "was written with a different byte order";
+   }
+   else if (header->version != format_version) {
+      error = "has an unsupported format version";
+   }
+   else if (std::strncmp (header->kind, kind, sizeof(header->kind)) != 0) {
+      error = "holds a different kind of table";
+   }
+   else if ((header->num_rows < 2) || (header->num_rows > 0x7fffffffU) ||
+            (size < sizeof(EOPTableHeader) +
+                    header->num_columns * name_length +
+                    header->num_columns * header->num_rows * sizeof(double))) {
+      error = "is truncated or has an invalid size";
+   }
+
+   if (error != nullptr) {
+      munmap (addr, size);
+      MessageHandler::fail (
+         __FILE__, __LINE__, TimeMessages::invalid_data_error,
+         "The table file '%s' %s (expected a version %u '%s' table)",
+         name.c_str(), error, format_version, kind);
+      return;
+   }
+
+   file_name = name;
+   map_addr  = addr;
+   map_size  = size;
+   columns   = header->num_columns;
+   rows      = static_cast<unsigned int> (header->num_rows);
+}
+
+
+/**
+ * Unmap the table file, if one is mapped.
+ * Pointers previously obtained from column become invalid.
+ */
+void
+EOPTableFile::close (
+   void)
+{
+   if (map_addr != nullptr) {
+      munmap (map_addr, map_size);
+      map_addr = nullptr;
+      map_size = 0;
+      columns  = 0;
+      rows     = 0;
+   }
+}
+
+
+/**
+ * Find a column by name.
+ * @return Start of the column's num_rows values
+ * \param[in] name Column name
+ */
+const double *
+EOPTableFile::column (
+   const char * name) const
+{
+   if (map_addr != nullptr) {
+      const char * base  = static_cast<const char *> (map_addr);
+      const char * names = base + sizeof(EOPTableHeader);
+      const char * data  = names + columns * name_length;
+      for (unsigned int ii = 0; ii < columns; ++ii) {
+         if (std::strncmp (names + ii * name_length, name, name_length) == 0) {
+            return reinterpret_cast<const double *> (data) +
+                   static_cast<std::size_t> (ii) * rows;
+         }
+      }
+   }
+
+   MessageHandler::fail (
+      __FILE__, __LINE__, TimeMessages::invalid_data_error,
+      "The table file '%s' has no column named '%s'",
+      file_name.c_str(), name);
+   return nullptr;
+}
+
+
+/**
+ * Advise the system that rows of a column will be needed soon.
+ * \param[in] column_data Column returned by column
+ * \param[in] row First row
+ * \param[in] count Number of rows
+ */
+void
+EOPTableFile::prefetch (
+   const double * column_data,
+   unsigned int row,
+   unsigned int count) const
+{
+   if ((map_addr == nullptr) || (column_data == nullptr) || (row >= rows)) {
+      return;
+   }
+   if (count > rows - row) {
+      count = rows - row;
+   }
+
+   std::uintptr_t page  = static_cast<std::uintptr_t> (sysconf (_SC_PAGESIZE));
+   std::uintptr_t begin = reinterpret_cast<std::uintptr_t> (column_data + row);
+   std::uintptr_t end   = begin + count * sizeof(double);
+   begin &= ~(page - 1);
+   madvise (reinterpret_cast<void *> (begin), end - begin, MADV_WILLNEED);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
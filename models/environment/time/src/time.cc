@@ -74,6 +74,7 @@ JeodBaseTime::JeodBaseTime (
    seconds                    = 0.0;
    time_manager               = nullptr;
    update_converter_ptr       = nullptr;
+   referenced                 = true;
 
    return;
 }
@@ -207,6 +207,20 @@ TimeConverter::verify_table_lookup_ends (
    return;
 }
 
+/**
+ * Indicate whether the converted time is determined by the source time
+ * alone, so that the TimeManager may skip the conversion when the source
+ * has not changed. Converters whose result depends on other state (e.g.,
+ * holds or user-set epochs) must keep this default.
+ * @return False; converters that qualify override this to return true
+ */
+bool
+TimeConverter::output_depends_only_on_input (
+   void) const
+{
+   return false;
+}
+
 /**
  * Destroy a TimeConverter
  */
@@ -28,21 +28,26 @@ LIBRARY DEPENDENCY:
    (time_ut1.cc)
    (time_converter.cc)
    (time_messages.cc)
+   (eop_table_file.cc)
    (utils/sim_interface/src/memory_interface.cc)
    (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/data_module_loader.cc)
    (utils/named_item/src/named_item.cc))
 
  
 ******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 
 // JEOD includes
+#include "utils/math/include/sorted_table.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/named_item/include/named_item.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/data_module_loader.hh"
 
 // Model includes
 #include "../include/time_converter_tai_ut1.hh"
@@ -73,6 +78,8 @@ TimeConverter_TAI_UT1::TimeConverter_TAI_UT1 (
    index                   = -1;
    val_vec                 = nullptr;
    when_vec                = nullptr;
+   data_file               = "";
+   data_module             = "";
    prev_when               = 0.0;
    prev_value              = 0.0;
    next_when               = 0.0;
@@ -153,6 +160,14 @@ TimeConverter_TAI_UT1::initialize_tai_to_ut1 (
       return;
    }
 
+   if (! data_file.empty()) {
+      load_data_file ();
+   }
+   else if ((! data_module.empty()) && (when_vec == nullptr)) {
+      DataModuleLoader::initialize (
+         data_module, "TimeConverter_TAI_UT1", this);
+   }
+
    if ((when_vec == nullptr) || (val_vec == nullptr)) {
       MessageHandler::fail (
          __FILE__, __LINE__, TimeMessages::invalid_data_error, "\n"
@@ -232,9 +247,8 @@ TimeConverter_TAI_UT1::initialize_tai_to_ut1 (
       /* Find the last entry that comes before the current time (trunc_julian_time)
          Highest value that can be reached is index = last_index - 1
          because tai_time < when_vec[last_index] by earlier test. */
-      for (index = 0; tai_time >= when_vec[index + 1]; ++index) {
-         ;
-      }
+      index = SortedTable::find_interval (
+                 when_vec, last_index + 1, tai_time);
       prev_when     = when_vec[index];
       prev_value    = val_vec[index];
       next_when     = when_vec[index + 1];
@@ -248,6 +262,77 @@ TimeConverter_TAI_UT1::initialize_tai_to_ut1 (
 }
 
 
+/**
+ * Map the binary table named by data_file and use it in place of the
+ * default data. Only the rows around the initial time are read ahead;
+ * other pages are read when the lookups reach them.
+ */
+void
+TimeConverter_TAI_UT1::load_data_file (
+   void)
+{
+   if (table_file.is_open()) {
+      return;
+   }
+
+   table_file.open (data_file, "tai_to_ut1");
+   if (! table_file.is_open()) {
+      return;
+   }
+
+   if ((when_vec != nullptr) && (JEOD_IS_ALLOCATED (when_vec))) {
+      JEOD_DELETE_ARRAY (when_vec);
+   }
+   if ((val_vec != nullptr) && (JEOD_IS_ALLOCATED (val_vec))) {
+      JEOD_DELETE_ARRAY (val_vec);
+   }
+
+   // The mapping is read-only; the table must not be modified.
+   when_vec   = const_cast<double *> (table_file.column ("when"));
+   val_vec    = const_cast<double *> (table_file.column ("value"));
+   last_index = static_cast<int> (table_file.num_rows()) - 1;
+
+   // Read ahead about a year of daily entries around the initial time.
+   unsigned int row = SortedTable::find_interval (
+                         when_vec, last_index + 1, tai_ptr->trunc_julian_time);
+   unsigned int first = (row > 183) ? row - 183 : 0;
+   table_file.prefetch (when_vec, first, 366);
+   table_file.prefetch (val_vec, first, 366);
+}
+
+
+/**
+ * Move the table cursor to the entries bracketing a TAI time if that time
+ * is not within or adjacent to the current pair of entries.
+ * Times outside the table are left to the caller's scans, which report
+ * running off the table.
+ * \param[in] tai_time TAI truncated Julian time, days
+ */
+void
+TimeConverter_TAI_UT1::seek (
+   double tai_time)
+{
+   if ((index >= last_index) ||
+       (tai_time < when_vec[0]) || (tai_time >= when_vec[last_index])) {
+      return;
+   }
+   if ((index > 0) && (index + 2 <= last_index) &&
+       (tai_time >= when_vec[index - 1]) &&
+       (tai_time <= when_vec[index + 2])) {
+      return;
+   }
+
+   index = SortedTable::find_interval (
+              when_vec, last_index + 1, tai_time,
+              static_cast<unsigned int> (std::max (index, 0)));
+   prev_when  = when_vec[index];
+   prev_value = val_vec[index];
+   next_when  = when_vec[index + 1];
+   next_value = val_vec[index + 1];
+   gradient   = (next_value - prev_value) / (next_when - prev_when);
+}
+
+
 /**
  * Convert from TimeTAI to TimeUT1.
  *
@@ -275,6 +360,11 @@ TimeConverter_TAI_UT1::convert_a_to_b (
    } // else
      // for conventional (forward-time) simulations:
 
+   // Jumps beyond the adjacent entries (e.g., restarts from a checkpoint)
+   // are located by search; the scans below then only handle the ends of
+   // the table.
+   seek (tai_time);
+
    /* "while" is used because updates need not be done regularly, may have to
       catch up with accumulation of points. */
    while (tai_time > next_when) {
@@ -369,6 +459,11 @@ TimeConverter_TAI_UT1::convert_b_to_a (
    } // else
      // for conventional (forward-time) simulations:
 
+   // Seek using the TAI time implied by the current offset. The offset
+   // changes by well under a table interval across a jump, so the scans
+   // below correct any error in the estimate.
+   seek (ut1_time - a_to_b_offset);
+
    /* "while" is used because updates need not be done regularly, may have to
        catch up with accumulation of points. */
    while (ut1_time > next_when + (next_value / 86400.0)) {
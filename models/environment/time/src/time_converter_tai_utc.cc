@@ -28,8 +28,10 @@ LIBRARY DEPENDENCY:
    (time_utc.cc)
    (time_converter.cc)
    (time_messages.cc)
+   (eop_table_file.cc)
    (utils/sim_interface/src/memory_interface.cc)
    (utils/message/src/message_handler.cc)
+   (utils/sim_interface/src/data_module_loader.cc)
    (utils/named_item/src/named_item.cc))
 
  
@@ -40,11 +42,14 @@ LIBRARY DEPENDENCY:
 #include <cstddef>
 
 // JEOD includes
+#include "utils/math/include/sorted_table.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/named_item/include/named_item.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/data_module_loader.hh"
 
 // Model includes
+#include "../include/eop_table_file.hh"
 #include "../include/time_converter_tai_utc.hh"
 #include "../include/time_tai.hh"
 #include "../include/time_utc.hh"
@@ -74,9 +79,17 @@ TimeConverter_TAI_UTC::TimeConverter_TAI_UTC (
    index                 = -1;
    val_vec               = nullptr;
    when_vec              = nullptr;
+   data_file             = "";
+   data_module           = "";
    next_when             = 0.0;
    prev_when             = 0.0;
    off_table_end         = false;
+   data_file_loaded      = false;
+   query_index           = 0;
+   query_julian_day      = -1000000000;
+   query_year            = 0;
+   query_month           = 0;
+   query_day             = 0;
 }
 
 
@@ -158,6 +171,14 @@ TimeConverter_TAI_UTC::initialize_leap_second (
       return;
    }
 
+   if ((! data_file.empty()) && (! data_file_loaded)) {
+      load_data_file ();
+   }
+   else if ((! data_module.empty()) && (when_vec == nullptr)) {
+      DataModuleLoader::initialize (
+         data_module, "TimeConverter_TAI_UTC", this);
+   }
+
    if ((when_vec == nullptr) || (val_vec == nullptr)) {
       MessageHandler::fail (
          __FILE__, __LINE__, TimeMessages::invalid_setup_error, "\n"
@@ -167,6 +188,8 @@ TimeConverter_TAI_UTC::initialize_leap_second (
       return;
    }
 
+   build_tai_epochs ();
+
    double trunc_julian_time = utc_ptr->trunc_julian_time; /* --
                                       local value of UTC time in TJT format */
    off_table_end = false;
@@ -240,11 +263,8 @@ TimeConverter_TAI_UTC::initialize_leap_second (
       /* Find the last entry that comes before the current time (trunc_julian_time)
          Highest value that can be reached is index = last_index -1
          because trunc_julian_time < leap_when(last_leap_index) by earlier test. */
-      for (index = 0;
-           trunc_julian_time >= when_vec[index + 1];
-           ++index) {
-         ;
-      }
+      index = SortedTable::find_interval (
+                 when_vec, last_index + 1, trunc_julian_time);
       prev_when = when_vec[index];
       next_when = when_vec[index + 1];
       /* and take the number of leap seconds recorded in the previous entry (i.e.
@@ -256,6 +276,157 @@ TimeConverter_TAI_UTC::initialize_leap_second (
 }
 
 
+/**
+ * Replace the leap second table with the contents of the binary table
+ * named by data_file. The table is small, so it is copied and the file
+ * unmapped.
+ */
+void
+TimeConverter_TAI_UTC::load_data_file (
+   void)
+{
+   EOPTableFile table_file;
+   table_file.open (data_file, "tai_to_utc");
+   if (! table_file.is_open()) {
+      return;
+   }
+
+   const double * when_data  = table_file.column ("when");
+   const double * value_data = table_file.column ("value");
+   if ((when_data == nullptr) || (value_data == nullptr)) {
+      return;
+   }
+
+   if ((when_vec != nullptr) && (JEOD_IS_ALLOCATED (when_vec))) {
+      JEOD_DELETE_ARRAY (when_vec);
+   }
+   if ((val_vec != nullptr) && (JEOD_IS_ALLOCATED (val_vec))) {
+      JEOD_DELETE_ARRAY (val_vec);
+   }
+
+   unsigned int size = table_file.num_rows();
+   last_index = static_cast<int> (size) - 1;
+   when_vec   = JEOD_ALLOC_PRIM_ARRAY (size, double);
+   val_vec    = JEOD_ALLOC_PRIM_ARRAY (size, int);
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      when_vec[ii] = when_data[ii];
+      val_vec[ii]  = static_cast<int> (std::floor (value_data[ii] + 0.5));
+   }
+
+   data_file_loaded = true;
+}
+
+
+/**
+ * Express the epochs of the leap second table, which are UTC times, as the
+ * TAI times at which each entry takes effect. The table is sorted in UTC
+ * and TAI-UTC never decreases, so the TAI epochs are sorted as well.
+ */
+void
+TimeConverter_TAI_UTC::build_tai_epochs (
+   void)
+{
+   tai_when.resize (last_index + 1);
+   for (int ii = 0; ii <= last_index; ++ii) {
+      tai_when[ii] = when_vec[ii] + val_vec[ii] / 86400.0;
+   }
+   query_index = 0;
+}
+
+
+/**
+ * Convert an arbitrary TAI time to UTC without disturbing the converter,
+ * e.g., to time-tag log entries. The lookup starts from the interval found
+ * by the previous call, so the nearly monotone times seen in logging cost
+ * a comparison or two rather than a search.
+ *
+ * \par Assumptions and Limitations
+ *  - The converter has been initialized.
+ *  - Times outside the table use the offset of the nearest table entry.
+ * @return UTC time, as a Truncated Julian time\n Units: day
+ * \param[in] tai_tjt TAI time, as a Truncated Julian time\n Units: day
+ */
+double
+TimeConverter_TAI_UTC::utc_at_tai (
+   double tai_tjt)
+{
+   if (override_data_table) {
+      return tai_tjt - leap_sec_override_val / 86400.0;
+   }
+   if (tai_when.empty()) {
+      return tai_tjt + a_to_b_offset;
+   }
+
+   unsigned int size = static_cast<unsigned int> (tai_when.size());
+   query_index = SortedTable::find_interval (
+                    tai_when.data(), size, tai_tjt, query_index);
+
+   // find_interval does not report the interval past the last entry.
+   unsigned int entry = query_index;
+   if ((entry + 1 < size) && (tai_tjt >= tai_when[entry + 1])) {
+      ++entry;
+   }
+
+   return tai_tjt - val_vec[entry] / 86400.0;
+}
+
+
+/**
+ * Convert an arbitrary TAI time to a UTC calendar date and 24-hour clock
+ * time. The date of the most recent conversion is retained, so converting
+ * another time on the same UTC day only splits off the clock time.
+ *
+ * \par Assumptions and Limitations
+ *  - As for utc_at_tai and TimeStandard::calendar_date.
+ *  - A time within a leap second is reported as the first second of the
+ *    next day.
+ * \param[in] tai_tjt TAI time, as a Truncated Julian time\n Units: day
+ * \param[out] year Year number (AD)
+ * \param[out] month Month number (January=1)
+ * \param[out] day Day of month
+ * \param[out] hour Hour of day
+ * \param[out] minute Minute of hour
+ * \param[out] second Second of minute\n Units: s
+ */
+void
+TimeConverter_TAI_UTC::utc_calendar_at_tai (
+   double tai_tjt,
+   int & year,
+   int & month,
+   int & day,
+   int & hour,
+   int & minute,
+   double & second)
+{
+   double utc_tjt = utc_at_tai (tai_tjt);
+   double resolution = (utc_ptr != nullptr) ?
+                       utc_ptr->get_clock_resolution() : 0.0;
+
+   int julian_day = static_cast<int> (std::floor (utc_tjt));
+   double day_minutes = 1440.0 * (utc_tjt - julian_day);
+   int minute_of_day = static_cast<int> (day_minutes);
+   second = 60.0 * (day_minutes - minute_of_day);
+   if (second > 60.0 - resolution) {
+      second = 0.0;
+      if (++minute_of_day >= 1440) {
+         minute_of_day -= 1440;
+         ++julian_day;
+      }
+   }
+   hour   = minute_of_day / 60;
+   minute = minute_of_day - 60 * hour;
+
+   if (julian_day != query_julian_day) {
+      query_julian_day = julian_day;
+      TimeStandard::calendar_date (julian_day,
+                                   query_year, query_month, query_day);
+   }
+   year  = query_year;
+   month = query_month;
+   day   = query_day;
+}
+
+
 /**
  * Convert from TimeTAI to TimeUTC.
  *
@@ -278,15 +449,7 @@ TimeConverter_TAI_UTC::convert_a_to_b (
          // to catch up with accumulation of points. */
          while (utc_ptr->trunc_julian_time >= next_when) {
             index++;
-        /*  assign these here.  It is redundant if the loop runs more than once,
-            but assigning after the loop would be redundant if the loop was not
-            entered at all.  The latter case is more likely, so assigning here
-            is more efficient. */
             a_to_b_offset = -val_vec[index] / 86400.0;
-            utc_ptr->set_time_by_trunc_julian (tai_ptr->trunc_julian_time  +
-                                               a_to_b_offset);
-            // utc_ptr->trunc_julian_time = tai_ptr->trunc_julian_time + a_to_b_offset;
-
             prev_when = next_when;
 
             if (index < last_index) {
@@ -312,8 +475,6 @@ TimeConverter_TAI_UTC::convert_a_to_b (
 
             if (index >= 0) {
                a_to_b_offset = -val_vec[index] / 86400.0;
-               utc_ptr->set_time_by_trunc_julian (tai_ptr->trunc_julian_time  +
-                                                  a_to_b_offset);
                prev_when = when_vec[index];
             }
             else { // run out of table!
@@ -325,17 +486,13 @@ TimeConverter_TAI_UTC::convert_a_to_b (
                " \n");
                off_table_end = true;
                a_to_b_offset = 0;
-               utc_ptr->set_time_by_trunc_julian (tai_ptr->trunc_julian_time  +
-                                                  a_to_b_offset);
                break;
             }
          }
       }
    }
-   /* if no update to leap seconds was needed, do not need to change
-      trunc_julian_time from that calculated earlier.
-      if an update was needed, it has already been recalculated.
-      Either way, do not need to do it again here.  Done. */
+   /* The loops above only step the table cursor; the UTC time is set once
+      with the final offset. */
    utc_ptr->set_time_by_trunc_julian (tai_ptr->trunc_julian_time  +
                                       a_to_b_offset);
 
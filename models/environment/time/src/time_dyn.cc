@@ -26,6 +26,7 @@ LIBRARY DEPENDENCY:
    (time_manager.cc)
    (time_messages.cc)
    (utils/sim_interface/src/memory_interface.cc)
+   (utils/memory/src/state_snapshot.cc)
    (utils/message/src/message_handler.cc)
    (utils/named_item/src/named_item.cc))
 
@@ -39,6 +40,7 @@ LIBRARY DEPENDENCY:
 #include "utils/message/include/message_handler.hh"
 #include "utils/named_item/include/named_item.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
 #include "utils/math/include/numerical.hh"
 
 // Model includes
@@ -143,6 +145,23 @@ TimeDyn::update_offset (
 }
 
 
+/**
+ * Register dynamic time, including its scale and offset with respect to
+ * simulation time, with a state snapshot.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+TimeDyn::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   snapshot.add_item (seconds);
+   snapshot.add_item (days);
+   snapshot.add_item (scale_factor);
+   snapshot.add_item (ref_scale);
+   snapshot.add_item (offset);
+}
+
+
 /**
  * Destroy a Time_Dyn
  */
@@ -30,8 +30,11 @@ LIBRARY DEPENDENCY:
    (time_standard.cc)
    (utils/integration/src/jeod_integration_time.cc)
    (utils/sim_interface/src/memory_interface.cc)
+   (utils/memory/src/state_snapshot.cc)
    (utils/message/src/message_handler.cc)
-   (utils/named_item/src/named_item.cc))
+   (utils/named_item/src/name_table.cc)
+   (utils/named_item/src/named_item.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
  
 ******************************************************************************/
@@ -44,8 +47,11 @@ LIBRARY DEPENDENCY:
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
+#include "utils/named_item/include/name_table.hh"
 #include "utils/named_item/include/named_item.hh"
 #include "utils/math/include/numerical.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/time.hh"
@@ -67,7 +73,8 @@ TimeManager::TimeManager (
 :
    simtime(-1.0), // Forces update at initialization
    num_types(0),
-   time_change_flag(false)
+   time_change_flag(false),
+   time_index()
 {
 
    // Register types and objects for checkpoint/restart.
@@ -342,7 +349,7 @@ TimeManager::time_standards_exist (
 
 
 /**
- * Uses a string comparison to find where in the TimeManager record a
+ * Uses the interned name index to find where in the TimeManager record a
  * time type of a particular name is located.  Returns the integer
  * corresponding to the time type's index in the TimeManager.
  *
@@ -353,6 +360,80 @@ TimeManager::time_standards_exist (
  * \param[in] name name of time-type
  */
 int TimeManager::time_lookup ( const std::string& name ) const
+{
+   // Sanity check:
+   // Test for a NULL or empty input name.
+   if ( name.empty() )
+   {
+       return -2; // -2 corresponds to search name  error
+   }
+
+   // Registered time-types' names are interned when the index is built,
+   // so a name that has not been interned names no time-type unless the
+   // index is stale.
+   NameHandle handle = NameTable::find (name);
+   if (! handle.is_valid()) {
+      rebuild_time_index ();
+      handle = NameTable::find (name);
+   }
+
+   return handle.is_valid() ? time_lookup (handle) : -1;
+}
+
+
+/**
+ * Find where in the TimeManager record a time type with a particular
+ * interned name is located.
+ * @return index value of time-type, or -1 if not found
+ * \param[in] handle handle of the name of time-type
+ */
+int TimeManager::time_lookup ( NameHandle handle ) const
+{
+   if (time_index.size() != time_vector.size()) {
+      rebuild_time_index ();
+   }
+
+   // Duplicate names leave the index short; the scan reports them.
+   if (time_index.size() != time_vector.size()) {
+      const char * name = NameTable::get_name (handle);
+      return (name != nullptr) ? scan_time_vector (name) : -1;
+   }
+
+   // Time-types can be renamed after registration, so a miss or a stale
+   // hit is retried with a fresh index.
+   unsigned int found = time_index.find (handle);
+   if ((found == NameIndex::npos) ||
+       (! time_vector[found]->name.ends_with (0, NameTable::get_name (handle)))) {
+      rebuild_time_index ();
+      found = time_index.find (handle);
+   }
+
+   return (found != NameIndex::npos) ? static_cast<int> (found) : -1;
+}
+
+
+/**
+ * Rebuild the name index from the list of time-types.
+ */
+void
+TimeManager::rebuild_time_index (
+   void)
+const
+{
+   time_index.clear ();
+   for (unsigned int ii = 0; ii < time_vector.size(); ++ii) {
+      time_index.add (NameTable::intern (time_vector[ii]->name.c_str()), ii);
+   }
+}
+
+
+/**
+ * Find a time type by comparing its name with each registered time type's
+ * name. This detects duplicate names, which the name index cannot.
+ * @return index value of time-type, -1 if not found, -3 if duplicated
+ * \param[in] name name of time-type
+ */
+int TimeManager::scan_time_vector ( const std::string& name ) const
 {
    int index = -1; // -1 corresponds to unfound
 
@@ -419,16 +500,12 @@ void
 TimeManager::update (
    double current_simtime)
 {
+   JEOD_PROFILE_SCOPE ("time", "TimeManager::update");
 
    if (!Numerical::compare_exact(current_simtime,simtime)) {
       simtime = current_simtime;
 
-      // update all times that are to be updated with the manager
-      //   These are ordered in some update hierarchy, such that if x updates
-      //   from y, y appears in the ordered_update_list array first.
-      for (int ii = 0; ii < num_types; ++ii) {
-         time_vector[ ii ]->update();
-      }
+      update_times ();
 
    }
 
@@ -465,16 +542,55 @@ TimeManager::update_time (
    if (!Numerical::compare_exact(current_simtime,simtime)) {
       simtime = current_simtime;
 
-      // update all times that are to be updated with the manager
-      //   These are ordered in some update hierarchy, such that if x updates
-      //   from y, y appears in the ordered_update_list array first.
+      update_times ();
+
+   }
+
+   return;
+}
+
+
+/**
+ * Update the time-types in dependency order. With an update plan, only
+ * the referenced time-types and their sources are updated, converters are
+ * called directly, and conversions that depend only on a source that has
+ * not changed are skipped.
+ */
+void
+TimeManager::update_times (
+   void)
+{
+   // update all times that are to be updated with the manager
+   //   These are ordered in some update hierarchy, such that if x updates
+   //   from y, y appears in the ordered_update_list array first.
+   if (update_plan.empty()) {
       for (int ii = 0; ii < num_types; ++ii) {
          time_vector[ ii ]->update();
       }
-
+      return;
    }
 
-   return;
+   for (auto & step : update_plan) {
+      if (step.converter == nullptr) {
+         step.time->update();
+         continue;
+      }
+
+      if (step.skip_if_unchanged && step.executed &&
+          Numerical::compare_exact (step.source->seconds,
+                                    step.source_seconds)) {
+         continue;
+      }
+      step.source_seconds = step.source->seconds;
+      step.executed       = true;
+
+      if (step.direction == 1) {
+         step.converter->convert_a_to_b();
+      }
+      else {
+         step.converter->convert_b_to_a();
+      }
+   }
 }
 
 
@@ -499,6 +615,28 @@ TimeManager::verify_table_lookup_ends (
 }
 
 
+/**
+ * Register the simulation time and dynamic time with a state snapshot.
+ * The other time-types derive from dynamic time; a restore recomputes them,
+ * after letting the table-lookup converters reposition themselves as time
+ * has in effect run backwards.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+TimeManager::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   snapshot.add_item (simtime);
+   dyn_time.add_snapshot_regions (snapshot);
+   snapshot.add_item (time_change_flag);
+
+   snapshot.add_restore_action ([this] () {
+      verify_table_lookup_ends ();
+      update_times ();
+   });
+}
+
+
 /**
  * Destroy a TimeManager
  */
@@ -31,7 +31,8 @@ LIBRARY DEPENDENCY:
    (time_standard.cc)
    (utils/sim_interface/src/memory_interface.cc)
    (utils/message/src/message_handler.cc)
-   (utils/named_item/src/named_item.cc))
+   (utils/named_item/src/named_item.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
  
 ******************************************************************************/
@@ -42,6 +43,7 @@ LIBRARY DEPENDENCY:
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/named_item/include/named_item.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/time.hh"
@@ -64,6 +66,8 @@ void
 TimeManager::initialize (
    TimeManagerInit * time_manager_init)
 {
+   JEOD_PROFILE_SCOPE ("time", "TimeManager::initialize");
+
    JEOD_REGISTER_INCOMPLETE_CLASS (JeodBaseTime);
 
    register_time (dyn_time);
@@ -40,6 +40,7 @@ LIBRARY DEPENDENCY:
 #include <cstddef>
 #include <typeinfo>
 #include <algorithm>
+#include <vector>
 
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
@@ -49,6 +50,7 @@ LIBRARY DEPENDENCY:
 #include "../include/time_manager_init.hh"
 #include "../include/time_manager.hh"
 //#include "../include/time_standard.hh"
+#include "../include/time_met.hh"
 #include "../include/time_ude.hh"
 #include "../include/time_converter_tai_utc.hh"
 #include "../include/time_converter_tai_ut1.hh"
@@ -123,6 +125,10 @@ TimeManagerInit::initialize_manager (
    //   which.
    create_update_tree();
 
+   //  Flatten the update tree into the list of converter calls the
+   //  TimeManager makes at run-time, pruned to the referenced time-types.
+   create_update_plan();
+
    return;
 }
 
@@ -627,6 +633,70 @@ TimeManagerInit::create_update_tree (
    return;
 }
 
+/**
+ * Build the TimeManager's update plan from the ordered update list.
+ * A time-type is kept if it is referenced or is the update source
+ * (directly or indirectly) of a referenced time-type. The dynamic time,
+ * and time-types with their own update logic, are updated through their
+ * update methods; the others through their converters.
+ */
+void
+TimeManagerInit::create_update_plan (
+   void)
+{
+   int num_types = time_manager->num_types;
+   std::vector<bool> needed (num_types, false);
+
+   // Parents precede their children in time_vector, so a reverse sweep
+   // sees every child before its parent.
+   for (int ii = num_types - 1; ii >= 0; --ii) {
+      JeodBaseTime * time_ptr = time_manager->time_vector[ii];
+      if (time_ptr->referenced) {
+         needed[ii] = true;
+      }
+      if (! needed[ii]) {
+         continue;
+      }
+      JeodBaseTime * parent_ptr = time_ptr->links.parent();
+      if (parent_ptr != nullptr) {
+         for (int jj = 0; jj < ii; ++jj) {
+            if (time_manager->time_vector[jj] == parent_ptr) {
+               needed[jj] = true;
+               break;
+            }
+         }
+      }
+   }
+
+   time_manager->update_plan.clear();
+   for (int ii = 0; ii < num_types; ++ii) {
+      if (! needed[ii]) {
+         continue;
+      }
+      JeodBaseTime * time_ptr = time_manager->time_vector[ii];
+      TimeManager::UpdateStep step;
+      step.time              = time_ptr;
+      step.converter         = nullptr;
+      step.source            = time_ptr->links.parent();
+      step.direction         = time_ptr->update_converter_direction;
+      step.skip_if_unchanged = false;
+      step.executed          = false;
+      step.source_seconds    = 0.0;
+
+      bool own_update = (time_ptr == &time_manager->dyn_time) ||
+                        (dynamic_cast<TimeMET *> (time_ptr) != nullptr);
+      if ((! own_update) && (step.source != nullptr) &&
+          (time_ptr->update_converter_ptr != nullptr) &&
+          ((step.direction == 1) || (step.direction == -1))) {
+         step.converter = time_ptr->update_converter_ptr;
+         step.skip_if_unchanged =
+            step.converter->output_depends_only_on_input();
+      }
+      time_manager->update_plan.push_back (step);
+   }
+}
+
+
 /**
  * Reorganizes the update list according to initialization status
  */
@@ -65,6 +65,8 @@ TimeStandard::TimeStandard (
                                      //   update at initialization
    prev_julian_day(-1000000000),     // ridiculous value, forces full calendar
                                      //    calculation at first call.
+   tjt_at_calendar_update(-1.0e9),   // ridiculous value, forces calendar
+                                     //    calculation at first call.
    seconds_at_year_start(0.0),
    year_of_last_soy(-1000000),       // ridiculous value, forces seconds_of_year
                                      //into full calculation first time through.
@@ -329,41 +331,65 @@ TimeStandard::calculate_calendar_values (
    /* convert the integral part into day, month,year format if day has changed */
    if (julian_day != prev_julian_day) {
       prev_julian_day = julian_day;
-      // determine the number of whole 400-year periods since March 1, 1600, and
-      // the number of days  since the "most recent" 400-year boundary
-      julian_day += 134493; /* 134493 is the offset from March 1, 1600 to the
-                              start of Truncated Julian Time */
-      int n_400 = julian_day / 146097; // There are 146097 days in 400 years. (number of whole 400-year periods)
-      if (julian_day < 0) {
-         n_400 -= 1;
-      }
-      int r_400 = julian_day - 146097 * n_400 + 1; /* -- number of years remaing after 400-year period */
+      calendar_date (julian_day,
+                     calendar_year, calendar_month, calendar_day);
+   }
 
-      /* determine number of whole 100-year periods since the "most recent" 400-year
-         boundary, and number of days since the "most recent" 100-year boundary */
-      int n_100 = static_cast<int> (r_400 / 36524.3); /* -- number of whole 100-year periods */
-      int r_100 = r_400 - 36524 * n_100 - 1; /* -- number of years remaing after 100-year period */
+   return;
+}
 
-      /* ditto for 4-year periods */
-      int n_4 = r_100 / 1461; /* -- number of whole 4-year periods */
-      int r_4 = r_100 - 1461 * n_4 + 1; /* -- number of years remaing after 4-year period */
 
-      /* and for 1-year periods, omitting remaining-days calculation */
-      int n_1 = static_cast<int> (r_4 / 365.3); /*  -- number of whole years */
 
-      /*  Modified r_4 for months calculation */
-      int r_4a = r_4 + 30 + 2 * n_1; /* -- modified value of r_4 */
+/**
+ * Calculate the Gregorian calendar date of a Truncated Julian day.
+ *
+ * \par Assumptions and Limitations
+ *  - Coverage is from March 1, 1600 onward.
+ * \param[in] julian_day Integral Truncated Julian day\n Units: day
+ * \param[out] year Year number (AD)
+ * \param[out] month Month number (January=1)
+ * \param[out] day Day of month
+ */
+void
+TimeStandard::calendar_date (
+   int julian_day,
+   int & year,
+   int & month,
+   int & day)
+{
+   // determine the number of whole 400-year periods since March 1, 1600, and
+   // the number of days  since the "most recent" 400-year boundary
+   julian_day += 134493; /* 134493 is the offset from March 1, 1600 to the
+                           start of Truncated Julian Time */
+   int n_400 = julian_day / 146097; // There are 146097 days in 400 years. (number of whole 400-year periods)
+   if (julian_day < 0) {
+      n_400 -= 1;
+   }
+   int r_400 = julian_day - 146097 * n_400 + 1; /* -- number of years remaing after 400-year period */
+
+   /* determine number of whole 100-year periods since the "most recent" 400-year
+      boundary, and number of days since the "most recent" 100-year boundary */
+   int n_100 = static_cast<int> (r_400 / 36524.3); /* -- number of whole 100-year periods */
+   int r_100 = r_400 - 36524 * n_100 - 1; /* -- number of years remaing after 100-year period */
+
+   /* ditto for 4-year periods */
+   int n_4 = r_100 / 1461; /* -- number of whole 4-year periods */
+   int r_4 = r_100 - 1461 * n_4 + 1; /* -- number of years remaing after 4-year period */
 
-      /* m = (Number of whole months +1) since the most recent 4-year period
-             (March=1, April=2, ... , February=12) */
-      int m = static_cast<int> (r_4a / 30.585);
+   /* and for 1-year periods, omitting remaining-days calculation */
+   int n_1 = static_cast<int> (r_4 / 365.3); /*  -- number of whole years */
+
+   /*  Modified r_4 for months calculation */
+   int r_4a = r_4 + 30 + 2 * n_1; /* -- modified value of r_4 */
+
+   /* m = (Number of whole months +1) since the most recent 4-year period
+          (March=1, April=2, ... , February=12) */
+   int m = static_cast<int> (r_4a / 30.585);
 
 /* Determine day of month, month number (Jan=1, etc.), and year number (AD) */
-      calendar_day   = r_4a - static_cast<int> (30.585 * m);
-      calendar_month = m + 2 - 12 * ((m + 1) / 12);
-      calendar_year  = 1600 + 400 * n_400 + 100 * n_100 + 4 * n_4 +
-                       ((m + 1) / 12);
-   }
+   day   = r_4a - static_cast<int> (30.585 * m);
+   month = m + 2 - 12 * ((m + 1) / 12);
+   year  = 1600 + 400 * n_400 + 100 * n_100 + 4 * n_4 + ((m + 1) / 12);
 
    return;
 }
@@ -392,7 +418,11 @@ TimeStandard::calendar_update (
          time_manager->update (simtime);
       }
       last_calendar_update = simtime;
-      calculate_calendar_values();
+      // Time-types that have not moved keep their calendar values.
+      if (!Numerical::compare_exact(trunc_julian_time,tjt_at_calendar_update)) {
+         tjt_at_calendar_update = trunc_julian_time;
+         calculate_calendar_values();
+      }
    }
 
    return;
@@ -699,7 +729,10 @@ TimeStandard::seconds_of_year (
    void)
 {
    if (!Numerical::compare_exact(last_calendar_update,time_manager->simtime)) {
-      calculate_calendar_values();
+      if (!Numerical::compare_exact(trunc_julian_time,tjt_at_calendar_update)) {
+         tjt_at_calendar_update = trunc_julian_time;
+         calculate_calendar_values();
+      }
       last_calendar_update = time_manager->simtime;
    }
 
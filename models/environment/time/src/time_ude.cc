@@ -41,6 +41,7 @@ LIBRARY DEPENDENCY:
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/math/include/numerical.hh"
 
 // Model includes
 #include "../include/time_ude.hh"
@@ -76,7 +77,8 @@ TimeUDE::TimeUDE (
   clock_hour        (0),
   clock_minute      (0),
   clock_second      (0.0),
-  last_clock_update (0.0),
+  last_clock_update (-100000.0),
+  clock_is_current  (false),
 
   epoch_format                (TimeEnum::undefined),
   initial_value_format        (TimeEnum::undefined),
@@ -1196,7 +1198,7 @@ TimeUDE::set_initial_times (
 }
 
 /**
- * Given a seconds value, sets days and clock values
+ * Given a days value, sets seconds and marks the clock values as stale
  * \param[in] new_days new value for days\n Units: day
  */
 void
@@ -1204,13 +1206,13 @@ TimeUDE::set_time_by_days (
    const double new_days)
 {
    JeodBaseTime::set_time_by_days (new_days);
-   clock_update();
+   clock_is_current = false;
 
    return;
 }
 
 /**
- * Given a seconds value, sets days and clock values
+ * Given a seconds value, sets days and marks the clock values as stale
  * \param[in] new_seconds new value for seconds\n Units: s
  */
 void
@@ -1219,7 +1221,7 @@ TimeUDE::set_time_by_seconds (
 {
 
    JeodBaseTime::set_time_by_seconds (new_seconds);
-   clock_update();
+   clock_is_current = false;
 
    return;
 
@@ -1239,6 +1241,7 @@ TimeUDE::set_time_by_clock (
    seconds = clock_day * 86400 + clock_hour * 3600 +
              clock_minute * 60 + clock_second;
    days = seconds / 86400;
+   clock_is_current = true;
 
    return;
 }
@@ -1301,6 +1304,38 @@ TimeUDE::clock_update (
          }
       }
    }
+   clock_is_current = true;
+
+   return;
+}
+
+
+/**
+ * Brings the clock representation up to date. The clock values are not
+ * maintained as the time is updated; they are computed here, and only if
+ * the time has changed since they were last computed.
+ *
+ * \par Assumptions and Limitations
+ *  - Derived times must have a parent; this should be defined by the
+ *     user, or if not, already determined when the update_tree was built.
+ * \param[in] simtime Simulation elapsed time, on the simulation clock\n Units: s
+ */
+void
+TimeUDE::clock_update (
+   double simtime)
+{
+   // only process if it has not been done previously at this time
+   if (!Numerical::compare_exact(simtime,last_clock_update)) {
+      // if the time needs updating, do that first.
+      if (!Numerical::compare_exact(simtime,time_manager->simtime)) {
+         time_manager->update (simtime);
+      }
+      last_clock_update = simtime;
+      if (!clock_is_current) {
+         clock_update();
+      }
+   }
+
    return;
 }
 
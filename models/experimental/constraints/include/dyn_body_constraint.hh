@@ -72,6 +72,7 @@ Library dependencies: ((../src/dyn_body_constraint.cc))
 namespace jeod {
 
 class ConstraintComponent;
+class ForceConstraintComponent;
 class DynBody;
 class DynBodyConstraintsSolver;
 class VehicleProperties;
@@ -211,6 +212,22 @@ public:
      */
     virtual ConstraintComponent* get_component(unsigned index) = 0;
 
+    /**
+     * Get the indexed component as a force component whose coupling to
+     * the other constraints passes only through the rigid-body response of
+     * the vehicle, as is the case for a pendulum. When every active
+     * component is such a force component, the solver solves the
+     * constraints equation in closed form.
+     * @param index Index of the component constraint to be retrieved.
+     *   This is not bounds-checked.
+     * @return The indexed component, or null if it is not such a component.
+     */
+    virtual const ForceConstraintComponent* get_force_component (
+        unsigned index JEOD_UNUSED) const
+    {
+        return nullptr;
+    }
+
     /**
      * Const version of get_component().
      */
@@ -141,6 +141,17 @@ public:
      */
     ConstraintsVectorT collect_constraints; //!< trick_io(**)
 
+    /**
+     * Solve the constraints equation in closed form when every active
+     * constraint component is a force component that couples to the others
+     * only through the rigid-body response of the vehicle, as pendulums do.
+     * The equation is then the identity plus a matrix of rank six or less,
+     * which is solved through a six by six system without forming the
+     * equation's matrix. Off by default, in which case the equation is
+     * formed and passed to the linear system solver.
+     */
+    bool closed_form_force_solve; //!< trick_units(--)
+
 
     // Member functions
 
@@ -325,6 +336,12 @@ private:
      */
     IndexPairVectorT constraint_indices; //!< trick_io(**)
 
+    /**
+     * The rigid-body factors of each row for the closed form solve: the mass,
+     * the direction, and the moment about the vehicle center of mass.
+     */
+    DoubleVectorT force_factors; //!< trick_io(**)
+
     /**
      * The sum of the individual constraint's effector wrenches.
      */
@@ -483,6 +500,42 @@ private:
         const VehicleProperties& vehicle_properties,
         VehicleNonGravState& non_grav_state);
 
+    /**
+     * Size the linear system solver, the solution vector, and the index
+     * vector for the case in which every registered constraint is active,
+     * so that solving never allocates memory during a step.
+     */
+    void reserve_workspace ();
+
+    /**
+     * Set up the active constraints and the begin, end row indices of each.
+     * @param vehicle_properties  Properites of the vehicle
+     * @param non_grav_state  Non-gravitational state in structural coordinates.
+     * @param constraint_indices  Active constraints start and end indices.
+     * @return The total number of rows.
+     */
+    unsigned setup_constraints (
+        const VehicleProperties& vehicle_properties,
+        const VehicleNonGravState& non_grav_state,
+        IndexPairVectorT& constraint_indices);
+    /**
+     * Check whether every component of the active constraints is a force
+     * component suited to the closed form solve.
+     */
+    bool has_only_force_components () const;
+    /**
+     * Solve the constraints equation in closed form, for constraints whose
+     * components are all force components.
+     * @param vehicle_properties  Properites of the vehicle
+     * @param non_grav_state  Non-gravitational state in structural coordinates.
+     * @param n_constraints  The number of active constraints.
+     * @param constraint_indices  Active constraints start and end indices.
+     */
+    void solve_force_constraints (
+        const VehicleProperties& vehicle_properties,
+        const VehicleNonGravState& non_grav_state,
+        unsigned n_constraints,
+        IndexPairVectorT& constraint_indices);
     /**
      * Build the system of linear equations A*x = b, where each row
      * corresponds to a specific constraint.
@@ -158,6 +158,19 @@ public:
         return &pendulum_component;
     }
 
+    /**
+     * Get the pendulum component as a force component.
+     * @param index Index of the component constraint to be retrieved.
+     *   This is not bounds-checked.
+     * @return The pendulum component.
+     */
+    const ForceConstraintComponent* get_force_component (
+        unsigned index) const override
+    {
+        assert (index == 0);
+        return &pendulum_component;
+    }
+
     /**
      * Update information about the relation between this constraint
      * and the root DynBody.
@@ -0,0 +1,383 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup Constraints
+ * @{
+ *
+ * @file
+ * Defines classes SloshPendulum and DynBodySloshConstraint.
+ */
+
+/*
+Purpose: ()
+Library dependencies: ((../src/dyn_body_slosh_constraint.cc))
+*/
+
+
+#ifndef JEOD_DYN_BODY_SLOSH_CONSTRAINT_HH
+#define JEOD_DYN_BODY_SLOSH_CONSTRAINT_HH
+
+
+#include "dyn_body_constraint.hh"
+
+#include "constrained_point_mass.hh"
+#include "pendulum_constraint_component.hh"
+
+#include "utils/container/include/pointer_vector.hh"
+#include "utils/container/include/primitive_vector.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+#include <cassert>
+
+
+//! Namespace jeod
+namespace jeod {
+
+class BasePendulumModel;
+
+
+/**
+ * One pendulum of a DynBodySloshConstraint: the pendulum bob as a
+ * constrained point mass and as a constraint component.
+ */
+class SloshPendulum
+{
+    JEOD_MAKE_SIM_INTERFACES(SloshPendulum)
+
+public:
+
+    /**
+     * Default constructor.
+     * @param constraint_frame_in  The frame of the owning constraint.
+     * @param pendulum_model  The object that models the pendulum parameters.
+     *   The default null pointers should only be used for simulation
+     *   checkpoint/restart.
+     */
+    SloshPendulum (
+        ConstraintFrame* constraint_frame_in = nullptr,
+        BasePendulumModel* pendulum_model = nullptr)
+    :
+        constrained_mass(constraint_frame_in),
+        pendulum_component(
+            constraint_frame_in, &constrained_mass, pendulum_model)
+    { }
+
+    /**
+     * Destructor.
+     */
+    ~SloshPendulum() = default;
+
+    /**
+     * The pendulum as a constrained mass.
+     */
+    ConstrainedPointMass constrained_mass;
+
+    /**
+     * The pendulum as a constraint component.
+     */
+    PendulumConstraintComponent pendulum_component;
+
+private:
+    // The copy constructor and copy assignment operator are not implemented
+    // to avoid erroneous copies.
+    SloshPendulum (const SloshPendulum&);
+    SloshPendulum& operator= (const SloshPendulum&);
+};
+
+
+/**
+ * Models all of the slosh pendulums of a tank, or of a vehicle, as one
+ * constrained object whose components are the pendulum tensions. The
+ * pendulums share the constraint frame, in which each model expresses its
+ * hinge point.
+ *
+ * The pendulums interact only through the rigid-body response of the
+ * vehicle, so the block of the constraints equation that pertains to them
+ * is the identity plus M*Q*W*Q^T, where M holds the pendulum masses, the
+ * rows of Q are each pendulum's direction and moment about the vehicle
+ * center of mass, and W holds the vehicle's inverse mass and inverse
+ * inertia. The block is formed from those factors without per-element
+ * virtual calls, and when the pendulums are the only active constraints
+ * the solver solves the equation in closed form from the same factors.
+ */
+class DynBodySloshConstraint : public DynBodyConstraint
+{
+    JEOD_MAKE_SIM_INTERFACES(DynBodySloshConstraint)
+
+public:
+
+    /**
+     * Vector of pointers to SloshPendulum objects.
+     */
+    typedef JeodPointerVector<SloshPendulum>::type PendulumVectorT;
+
+    /**
+     * Vector of doubles.
+     */
+    typedef JeodPrimitiveVector<double>::type DoubleVectorT;
+
+    /**
+     * Default constructor.
+     */
+    DynBodySloshConstraint ();
+
+    /**
+     * Destructor.
+     */
+    ~DynBodySloshConstraint() override;
+
+    /**
+     * Add a pendulum modeled by the supplied model.
+     * Pendulums must be added before the constraint is added to a solver.
+     * @param pendulum_model  The object that models the pendulum parameters.
+     */
+    void add_pendulum (BasePendulumModel* pendulum_model);
+
+    /**
+     * Get the number of pendulums.
+     * @return Pendulum count.
+     */
+    unsigned get_num_pendulums () const
+    {
+        return pendulums.size();
+    }
+
+    /**
+     * Activate the constraint.
+     */
+    void activate () override;
+
+    /**
+     * Deactivate the constraint.
+     */
+    void deactivate () override;
+
+    /**
+     * Get the known wrench for this constrained object.
+     * In this case, there is none.
+     * @return A null wrench.
+     */
+    const Wrench& get_effector_wrench () const override
+    {
+        return null_wrench;
+    }
+
+    /**
+     * Get the wrench this constrained object exerts on the vehicle.
+     * @return The sum of the pendulum tension wrenches.
+     * @note This function is called after the constraint values have been set.
+     */
+    const Wrench& get_constraint_wrench () const override
+    {
+        return constraint_wrench;
+    }
+
+    /**
+     * Get the residual nonlinear wrench for this constrained object.
+     * @return The sum of the pendulum damping wrenches.
+     * @note This function is called after calls to compute_constraint_response.
+     */
+    const Wrench& get_nonlinear_response_wrench () const override
+    {
+        return damping_wrench;
+    }
+
+    /**
+     * Get the indexed pendulum component.
+     * @param index Index of the pendulum.
+     *   This is not bounds-checked.
+     * @return The indexed pendulum component.
+     */
+    ConstraintComponent* get_component(unsigned index) override
+    {
+        assert (index < pendulums.size());
+        return &pendulums[index]->pendulum_component;
+    }
+
+    /**
+     * Get the indexed pendulum component as a force component.
+     * @param index Index of the pendulum.
+     *   This is not bounds-checked.
+     * @return The indexed pendulum component.
+     */
+    const ForceConstraintComponent* get_force_component (
+        unsigned index) const override
+    {
+        assert (index < pendulums.size());
+        return &pendulums[index]->pendulum_component;
+    }
+
+    /**
+     * Update information about the relation between this constraint
+     * and the root DynBody.
+     * @param vehicle_properties  Various vehicle properties.
+     */
+    void update_attachment (
+        const VehicleProperties& vehicle_properties) override;
+
+    /**
+     * Prepare this object for solving a constraint problem.
+     * @param vehicle_properties  Various vehicle properties.
+     * @param non_grav_state  The non-gravitational response of the
+     *   root body to non-constraint forces and torques, including
+     *   the pre-constraint wrenches.
+     */
+    void setup_constraint(
+        const VehicleProperties& vehicle_properties,
+        const VehicleNonGravState& non_grav_state) override;
+
+    using DynBodyConstraint::set_self_coeff;
+
+    /**
+     * Set the pendulums block of the constraints equation from the
+     * pendulum factors.
+     * @param vehicle_properties  Various vehicle properties.
+     * @param a_slice  A view into the overall A matrix of the constraint
+     *   equation for this constraint with respect to itself.
+     */
+    void set_self_coeff(
+        const VehicleProperties& vehicle_properties,
+        MatrixView<double>& a_slice) const override;
+
+    /**
+     * Set the pendulum tensions and the resulting constraint wrench.
+     * @param solution_slice  The solution to the matrix constraint equation
+     *   for this constrained object, one tension per pendulum.
+     */
+    void set_constraint_values (
+        const VectorView<double, double>& solution_slice) override;
+
+    /**
+     * Compute the pendulums' responses to the overall behavior of the vehicle
+     * and the resulting damping wrench.
+     * @param vehicle_properties  Various vehicle properties.
+     * @param non_grav_state  The non-gravitational response of the
+     *   root body to external forces and torques, including the constraints.
+     */
+    void compute_constraint_response (
+        const VehicleProperties& vehicle_properties,
+        const VehicleNonGravState& non_grav_state) override;
+
+    /**
+     * Determine whether the integrators need to be reset, which occurs
+     * on transition between modes of any of the pendulums.
+     * This should be called as a scheduled job at the dynamics rate.
+     */
+    bool check_for_reset ();
+
+    /**
+     * Trigger that all pendulums should be set to their quiescent vertical
+     * states.
+     */
+    void reset_quiescent ();
+
+    /**
+     * Set the points at which the transitions from Cartesian to angular
+     * and angular to Cartesian representations occur, for all pendulums.
+     */
+    void set_transition_points (
+        double new_cos_sq_theta_angular,
+        double new_cos_sq_theta_cartesian);
+
+    /**
+     * Getter for the indexed pendulum's bob position.
+     * @param index Index of the pendulum.
+     *   This is not bounds-checked.
+     */
+    const double* get_bob_position (unsigned index) const
+    {
+        assert (index < pendulums.size());
+        return pendulums[index]->pendulum_component.get_bob_position();
+    }
+
+protected:
+
+    /**
+     * The pendulums, allocated by add_pendulum.
+     */
+    PendulumVectorT pendulums; //!< trick_io(**)
+
+    /**
+     * Number of factors stored per pendulum.
+     */
+    static const unsigned factor_stride = 10; //!< trick_io(**)
+
+    /**
+     * The factors of each pendulum, set by setup_constraint: the mass, the
+     * direction, the moment about the vehicle center of mass, and the
+     * vehicle's rotational response to a unit tension.
+     */
+    DoubleVectorT factors; //!< trick_io(**)
+
+    /**
+     * A wrench that is always zero.
+     */
+    Wrench null_wrench; //!< trick_units(--)
+
+    /**
+     * The sum of the pendulum tension wrenches.
+     */
+    Wrench constraint_wrench; //!< trick_units(--)
+
+    /**
+     * The sum of the pendulum damping wrenches.
+     */
+    Wrench damping_wrench; //!< trick_units(--)
+
+private:
+    // The copy constructor and copy assignment operator are not implemented
+    // to avoid erroneous copies.
+    DynBodySloshConstraint (const DynBodySloshConstraint&);
+    DynBodySloshConstraint& operator= (const DynBodySloshConstraint&);
+};
+
+
+} // End JEOD namespace
+
+
+#endif
+
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -167,6 +167,22 @@ public:
         SolverTypes::Vector3T response) const override;
 #endif
 
+    /**
+     * Get the factors through which this component couples to the other
+     * force components of the vehicle. Its row of the constraints equation
+     * is mass * (direction . a + moment . alpha), where a and alpha are the
+     * vehicle's translational and rotational acceleration responses.
+     * @param direction  Filled with the constraint direction, in root
+     *   structural coordinates.
+     * @param moment  Filled with the cross product of the constraint position
+     *   relative to the vehicle center of mass and the direction.
+     * @return  The constrained mass.
+     * @note Valid after setup_constraint().
+     */
+    double get_rigid_body_factors (
+        double direction[3],
+        double moment[3]) const;
+
     /**
      * Set this constrained object's scalar constraint value.
      * @param constraint_value  The solution to the matrix constraint equation
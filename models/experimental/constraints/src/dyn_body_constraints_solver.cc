@@ -13,15 +13,18 @@
 /*
 Purpose: ()
 Library dependencies: (
-  (dyn_body_constraint.cc))
+  (dyn_body_constraint.cc)
+  (force_constraint_component.cc))
 */
 
 
 #include "../include/dyn_body_constraints_solver.hh"
+#include "../include/force_constraint_component.hh"
 
 #include "dynamics/dyn_body/include/dyn_body.hh"
 #include "dynamics/dyn_body/include/structure_integrated_dyn_body.hh"
 #include "dynamics/dyn_body/include/wrench.hh"
+#include "utils/math/include/vector3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "experimental/message/include/fail_simulation.hh"
 
@@ -166,6 +169,7 @@ DynBodyConstraintsSolver::DynBodyConstraintsSolver(
     LinearSystemSolver* solver_in,
     DynBody* dyn_body_in)
 :
+    closed_form_force_solve(false),
     dyn_body(dyn_body_in),
     solver(solver_in),
     x_vector(),
@@ -275,6 +279,8 @@ DynBodyConstraintsSolver::add_child_constraint (
         activate_constraint (constraint);
     }
 
+    reserve_workspace ();
+
     // Add this constraint to the parent (and up the chain).
     if (parent != nullptr)
     {
@@ -509,6 +515,28 @@ DynBodyConstraintsSolver::add_attached_constraints (
         new_active_constraints.begin(), new_active_constraints.end());
 
     // rebuild_active_constraint_indices();
+
+    reserve_workspace ();
+}
+
+
+// Size the solver workspace for all registered constraints.
+void
+DynBodyConstraintsSolver::reserve_workspace ()
+{
+    unsigned max_dims = 0u;
+    for (auto constraint : all_constraints)
+    {
+        max_dims += constraint->n_dimensions;
+    }
+
+    if (solver != nullptr)
+    {
+        solver->set_max_dimensions (max_dims);
+    }
+    x_vector.reserve (max_dims);
+    force_factors.reserve (7*max_dims);
+    constraint_indices.reserve (all_constraints.size());
 }
 
 
@@ -577,14 +605,23 @@ DynBodyConstraintsSolver::solve (
             effector_wrench, vehicle_properties, non_grav_state);
     }
 
-    // Build the constraints system of equations.
+    // Build and solve the constraints system of equations, in closed form
+    // if the constraints allow it, and broadcast the solution.
     constraint_indices.clear();
     constraint_indices.reserve(n_constraints);
-    build_system_of_equations (
-        vehicle_properties, non_grav_state, n_constraints, constraint_indices);
-
-    // Solve the constraints system of equations and broadcast the solution.
-    solver->solve (x_vector);
+    if (closed_form_force_solve && has_only_force_components())
+    {
+        solve_force_constraints (
+            vehicle_properties, non_grav_state,
+            n_constraints, constraint_indices);
+    }
+    else
+    {
+        build_system_of_equations (
+            vehicle_properties, non_grav_state,
+            n_constraints, constraint_indices);
+        solver->solve (x_vector);
+    }
     send_solution (n_constraints, constraint_indices);
 
     // Accumulate the constraint wrenches and update the
@@ -617,15 +654,11 @@ DynBodyConstraintsSolver::solve (
 }
 
 
-// Construct A and b in the system of equations A*x=b, where
-//  - A is the matrix of partial derivatives, dx_i/dx_j,
-//  - x is the vector of constraint values (not referenced here), and
-//  - b is the vector of right hand side values.
-void
-DynBodyConstraintsSolver::build_system_of_equations (
+// Set up the active constraints and build the mapping to row indices.
+unsigned
+DynBodyConstraintsSolver::setup_constraints (
     const VehicleProperties& vehicle_properties,
     const VehicleNonGravState& non_grav_state,
-    unsigned n_constraints,
     IndexPairVectorT& constraint_indices)
 {
     // Tell each constraint to set its internal state in preparation
@@ -648,8 +681,202 @@ DynBodyConstraintsSolver::build_system_of_equations (
         prev_end = new_end;
     }
 
-    // Set the overall dimensionality of the problem.
-    unsigned n_dims = constraint_indices.back().second;
+    return prev_end;
+}
+
+
+// Check whether every active constraint component is a force component.
+bool
+DynBodyConstraintsSolver::has_only_force_components () const
+{
+    for (auto constraint : active_constraints)
+    {
+        for (unsigned ii = 0; ii < constraint->n_dimensions; ++ii)
+        {
+            if (constraint->get_force_component(ii) == nullptr)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+// Solve the system of equations A*x=b for force components in closed form.
+// Each row i has a mass m_i and a column q_i = [d_i; tau_i] formed from the
+// constraint direction d_i and its moment tau_i about the center of mass.
+// The matrix is A = I + M*Q^T*W*Q, with M = diag(m_i), Q the 6xn matrix of
+// columns q_i, and W = diag(1/m_vehicle*I, J), J being the inverse inertia
+// in structural coordinates. By the Woodbury identity,
+//   x = b - M*Q^T*z, where (I + W*Q*M*Q^T)*z = W*Q*b,
+// so only a 6x6 system need be solved. That system is similar to the
+// symmetric positive definite matrix I + W^(1/2)*Q*M*Q^T*W^(1/2), whose
+// eigenvalues are at least one, so it is never singular.
+void
+DynBodyConstraintsSolver::solve_force_constraints (
+    const VehicleProperties& vehicle_properties,
+    const VehicleNonGravState& non_grav_state,
+    unsigned n_constraints,
+    IndexPairVectorT& constraint_indices)
+{
+    static const unsigned stride = 7;
+
+    unsigned n_dims = setup_constraints (
+        vehicle_properties, non_grav_state, constraint_indices);
+    x_vector.resize(n_dims);
+    force_factors.resize(stride*n_dims);
+
+    // Collect the right hand side and the rigid-body factors of each row.
+    for (unsigned ii = 0; ii < n_constraints; ++ii)
+    {
+        auto& constraint_ii = *active_constraints[ii];
+        auto& range_ii = constraint_indices[ii];
+        if (range_ii.second == range_ii.first)
+        {
+            continue;
+        }
+
+        constraint_ii.set_r_h_s (
+            SubVectorView<std::vector<double>, double>(x_vector, range_ii));
+
+        for (unsigned kk = range_ii.first; kk < range_ii.second; ++kk)
+        {
+            double* factor = &force_factors[stride*kk];
+            factor[0] = constraint_ii.get_force_component(kk - range_ii.first)
+                            ->get_rigid_body_factors (factor+1, factor+4);
+        }
+    }
+
+    // Accumulate K = Q*M*Q^T and h = Q*b.
+    double kmat[6][6] = {{0.0}};
+    double hvec[6] = {0.0};
+    for (unsigned kk = 0; kk < n_dims; ++kk)
+    {
+        const double* factor = &force_factors[stride*kk];
+        const double* qvec = factor+1;
+        for (unsigned rr = 0; rr < 6; ++rr)
+        {
+            double mq = factor[0] * qvec[rr];
+            for (unsigned cc = 0; cc < 6; ++cc)
+            {
+                kmat[rr][cc] += mq * qvec[cc];
+            }
+            hvec[rr] += x_vector[kk] * qvec[rr];
+        }
+    }
+
+    // Form J = T^T*Iinv*T, with T the structure to body transform.
+    const auto& tmat = vehicle_properties.get_structure_to_body_transform();
+    const auto& iinv = vehicle_properties.get_inverse_inertia();
+    double inv_mass = vehicle_properties.get_inverse_mass();
+    double jmat[3][3];
+    for (unsigned cc = 0; cc < 3; ++cc)
+    {
+        double t_col[3];
+        double it_col[3];
+        double j_col[3];
+        for (unsigned rr = 0; rr < 3; ++rr)
+        {
+            t_col[rr] = tmat[rr][cc];
+        }
+        Vector3::transform (iinv, t_col, it_col);
+        Vector3::transform_transpose (tmat, it_col, j_col);
+        for (unsigned rr = 0; rr < 3; ++rr)
+        {
+            jmat[rr][cc] = j_col[rr];
+        }
+    }
+
+    // Form the augmented 6x6 system [I + W*K | W*h].
+    double smat[6][7];
+    for (unsigned rr = 0; rr < 6; ++rr)
+    {
+        for (unsigned cc = 0; cc < 7; ++cc)
+        {
+            double sum = 0.0;
+            if (rr < 3)
+            {
+                sum = inv_mass * ((cc < 6) ? kmat[rr][cc] : hvec[rr]);
+            }
+            else
+            {
+                for (unsigned ll = 0; ll < 3; ++ll)
+                {
+                    sum += jmat[rr-3][ll] *
+                           ((cc < 6) ? kmat[3+ll][cc] : hvec[3+ll]);
+                }
+            }
+            smat[rr][cc] = sum + ((rr == cc) ? 1.0 : 0.0);
+        }
+    }
+
+    // Solve by Gaussian elimination with partial pivoting.
+    for (unsigned pp = 0; pp < 6; ++pp)
+    {
+        unsigned pivot = pp;
+        for (unsigned rr = pp+1; rr < 6; ++rr)
+        {
+            if (std::fabs(smat[rr][pp]) > std::fabs(smat[pivot][pp]))
+            {
+                pivot = rr;
+            }
+        }
+        if (pivot != pp)
+        {
+            for (unsigned cc = pp; cc < 7; ++cc)
+            {
+                std::swap (smat[pp][cc], smat[pivot][cc]);
+            }
+        }
+        for (unsigned rr = pp+1; rr < 6; ++rr)
+        {
+            double scale = smat[rr][pp] / smat[pp][pp];
+            for (unsigned cc = pp; cc < 7; ++cc)
+            {
+                smat[rr][cc] -= scale * smat[pp][cc];
+            }
+        }
+    }
+    double zvec[6];
+    for (unsigned rr = 6; rr-- > 0;)
+    {
+        double sum = smat[rr][6];
+        for (unsigned cc = rr+1; cc < 6; ++cc)
+        {
+            sum -= smat[rr][cc] * zvec[cc];
+        }
+        zvec[rr] = sum / smat[rr][rr];
+    }
+
+    // Recover the solution, x_i = b_i - m_i * q_i.z, in place.
+    for (unsigned kk = 0; kk < n_dims; ++kk)
+    {
+        const double* factor = &force_factors[stride*kk];
+        double qz = 0.0;
+        for (unsigned rr = 0; rr < 6; ++rr)
+        {
+            qz += factor[1+rr] * zvec[rr];
+        }
+        x_vector[kk] -= factor[0] * qz;
+    }
+}
+
+
+// Construct A and b in the system of equations A*x=b, where
+//  - A is the matrix of partial derivatives, dx_i/dx_j,
+//  - x is the vector of constraint values (not referenced here), and
+//  - b is the vector of right hand side values.
+void
+DynBodyConstraintsSolver::build_system_of_equations (
+    const VehicleProperties& vehicle_properties,
+    const VehicleNonGravState& non_grav_state,
+    unsigned n_constraints,
+    IndexPairVectorT& constraint_indices)
+{
+    // Set up the constraints and set the overall dimensionality.
+    unsigned n_dims = setup_constraints (
+        vehicle_properties, non_grav_state, constraint_indices);
     solver->set_n_dimensions(n_dims);
     x_vector.resize(n_dims);
 
@@ -674,7 +901,7 @@ DynBodyConstraintsSolver::build_system_of_equations (
             solver->make_a_matrix_view(range_ii, range_ii));
 
         // Set the elements of the A matrix for this constraint vs others.
-        for (unsigned jj = 0; jj < n_dims; ++jj)
+        for (unsigned jj = 0; jj < n_constraints; ++jj)
         {
             if (jj == ii)
             {
@@ -0,0 +1,255 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup Constraints
+ * @{
+ *
+ * @file
+ * Defines DynBodySloshConstraint member functions.
+ */
+
+/*
+Purpose: ()
+*/
+
+
+#include "../include/dyn_body_slosh_constraint.hh"
+
+#include "../include/dyn_body_constraints_solver.hh"
+
+#include "dynamics/dyn_body/include/vehicle_non_grav_state.hh"
+#include "dynamics/dyn_body/include/vehicle_properties.hh"
+#include "experimental/math/include/matrix_view.hh"
+#include "experimental/math/include/vector_view.hh"
+#include "experimental/message/include/fail_simulation.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+DynBodySloshConstraint::DynBodySloshConstraint()
+:
+    DynBodyConstraint(),
+    pendulums(),
+    factors(),
+    null_wrench(true),
+    constraint_wrench(),
+    damping_wrench()
+{
+    JEOD_REGISTER_CLASS(SloshPendulum);
+    JEOD_REGISTER_CHECKPOINTABLE (this, pendulums);
+    JEOD_REGISTER_CHECKPOINTABLE (this, factors);
+}
+
+
+// Remove the constraint from its solver while the pendulums still exist,
+// then release the pendulums.
+DynBodySloshConstraint::~DynBodySloshConstraint()
+{
+    if (solver != nullptr)
+    {
+        solver->remove_constraint (this);
+    }
+
+    for (auto pendulum : pendulums)
+    {
+        JEOD_DELETE_OBJECT (pendulum);
+    }
+    pendulums.clear();
+
+    JEOD_DEREGISTER_CHECKPOINTABLE (this, pendulums);
+    JEOD_DEREGISTER_CHECKPOINTABLE (this, factors);
+}
+
+
+void
+DynBodySloshConstraint::add_pendulum (
+    BasePendulumModel* pendulum_model)
+{
+    if (solver != nullptr)
+    {
+        FAIL_SIMULATION ("DynBodySloshConstraint::add_pendulum called "
+                         "after the constraint was added to a solver.");
+    }
+
+    pendulums.push_back (
+        JEOD_ALLOC_CLASS_OBJECT (
+            SloshPendulum, (&constraint_frame, pendulum_model)));
+    n_dimensions = pendulums.size();
+}
+
+
+void
+DynBodySloshConstraint::activate ()
+{
+    if (inactive)
+    {
+        DynBodyConstraint::activate ();
+        for (auto pendulum : pendulums)
+        {
+            pendulum->pendulum_component.activate ();
+        }
+    }
+}
+
+
+void
+DynBodySloshConstraint::deactivate ()
+{
+    if (!inactive)
+    {
+        DynBodyConstraint::deactivate ();
+        for (auto pendulum : pendulums)
+        {
+            pendulum->pendulum_component.deactivate ();
+        }
+    }
+}
+
+
+void
+DynBodySloshConstraint::update_attachment (
+    const VehicleProperties& vehicle_properties)
+{
+    DynBodyConstraint::update_attachment (vehicle_properties);
+    for (auto pendulum : pendulums)
+    {
+        pendulum->constrained_mass.update_attachment (vehicle_properties);
+        pendulum->pendulum_component.update_attachment (vehicle_properties);
+    }
+}
+
+
+void
+DynBodySloshConstraint::setup_constraint(
+    const VehicleProperties& vehicle_properties,
+    const VehicleNonGravState& non_grav_state)
+{
+    factors.resize (factor_stride * pendulums.size());
+
+    unsigned index = 0;
+    for (auto pendulum : pendulums)
+    {
+        double* factor = &factors[factor_stride * index++];
+        PendulumConstraintComponent& component = pendulum->pendulum_component;
+
+        pendulum->constrained_mass.setup_constraint (
+            vehicle_properties, non_grav_state);
+        component.setup_constraint (vehicle_properties, non_grav_state);
+
+        factor[0] = component.get_rigid_body_factors (factor+1, factor+4);
+        component.get_rotational_response (vehicle_properties, factor+7);
+    }
+}
+
+
+// A_ij = delta_ij + m_i * (d_i . d_j / M + tau_i . alpha_j), where d is a
+// pendulum direction, tau its moment about the vehicle center of mass, and
+// alpha the vehicle's rotational response to a unit tension.
+void
+DynBodySloshConstraint::set_self_coeff (
+    const VehicleProperties& vehicle_properties,
+    MatrixView<double>& a_slice) const
+{
+    double inverse_mass = vehicle_properties.get_inverse_mass();
+    unsigned n_pendulums = pendulums.size();
+
+    for (unsigned ii = 0; ii < n_pendulums; ++ii)
+    {
+        const double* factor_ii = &factors[factor_stride * ii];
+        for (unsigned jj = 0; jj < n_pendulums; ++jj)
+        {
+            const double* factor_jj = &factors[factor_stride * jj];
+            a_slice(ii, jj) =
+                factor_ii[0] * (
+                    Vector3::dot (factor_ii+1, factor_jj+1) * inverse_mass
+                    + Vector3::dot (factor_ii+4, factor_jj+7));
+        }
+        a_slice(ii, ii) += 1.0;
+    }
+}
+
+
+void
+DynBodySloshConstraint::set_constraint_values (
+    const VectorView<double, double>& solution_slice)
+{
+    DynBodyConstraint::set_constraint_values (solution_slice);
+
+    constraint_wrench.reset_force_and_torque ();
+    constraint_wrench.reset_point ();
+    for (auto pendulum : pendulums)
+    {
+        constraint_wrench +=
+            pendulum->pendulum_component.get_constraint_wrench();
+    }
+}
+
+
+void
+DynBodySloshConstraint::compute_constraint_response (
+    const VehicleProperties& vehicle_properties,
+    const VehicleNonGravState& non_grav_state)
+{
+    damping_wrench.reset_force_and_torque ();
+    damping_wrench.reset_point ();
+    for (auto pendulum : pendulums)
+    {
+        pendulum->pendulum_component.compute_constraint_response (
+            vehicle_properties, non_grav_state);
+        damping_wrench +=
+            pendulum->pendulum_component.get_nonlinear_response_wrench();
+    }
+}
+
+
+// Every pendulum is checked, as the check also records the pending mode.
+bool
+DynBodySloshConstraint::check_for_reset ()
+{
+    bool need_reset = false;
+    for (auto pendulum : pendulums)
+    {
+        if (pendulum->pendulum_component.check_for_reset())
+        {
+            need_reset = true;
+        }
+    }
+    return need_reset;
+}
+
+
+void
+DynBodySloshConstraint::reset_quiescent ()
+{
+    for (auto pendulum : pendulums)
+    {
+        pendulum->pendulum_component.reset_quiescent ();
+    }
+}
+
+
+void
+DynBodySloshConstraint::set_transition_points (
+    double new_cos_sq_theta_angular,
+    double new_cos_sq_theta_cartesian)
+{
+    for (auto pendulum : pendulums)
+    {
+        pendulum->pendulum_component.set_transition_points (
+            new_cos_sq_theta_angular, new_cos_sq_theta_cartesian);
+    }
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
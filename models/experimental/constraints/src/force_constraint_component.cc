@@ -103,6 +103,22 @@ ForceConstraintComponent::get_translational_response (
 }
 
 
+// Factor this component's row of the constraints equation.
+double
+ForceConstraintComponent::get_rigid_body_factors (
+    double direction[3],
+    double moment[3]) const
+{
+    Vector3::copy (constraint_direction_root, direction);
+    Vector3::cross (
+        constrained_mass->constraint_position_com,
+        constraint_direction_root,
+        moment);
+
+    return constrained_mass->mass;
+}
+
+
 void
 ForceConstraintComponent::set_constraint_value (
     double constraint_value)
@@ -0,0 +1,165 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Defines the class GaussSeidelSolver.
+ */
+
+/*
+Purpose: ()
+Library dependencies: ((../src/gauss_seidel_solver.cc))
+*/
+
+
+#ifndef JEOD_GAUSS_SEIDEL_SOLVER_HH
+#define JEOD_GAUSS_SEIDEL_SOLVER_HH
+
+
+#include "gauss_jordan_solver.hh"
+
+#include "utils/container/include/primitive_vector.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Solves a linear system of equations iteratively with successive
+ * over-relaxation (Gauss-Seidel when the relaxation factor is one).
+ *
+ * The iteration is warm started from the contents of x on entry whenever x
+ * already has the dimensionality of the problem. DynBodyConstraintsSolver
+ * keeps its solution vector from one call to the next, so while the set of
+ * constraints is unchanged each solve starts from the previous solution,
+ * which is typically a few iterations away from the new one.
+ *
+ * The iteration stops when the largest change in an element of x falls
+ * below tolerance relative to the largest element of x. If that does not
+ * happen within max_iterations sweeps, or a diagonal element of A is zero,
+ * the solver falls back to Gauss-Jordan elimination.
+ */
+class GaussSeidelSolver : public GaussJordanSolver
+{
+    JEOD_MAKE_SIM_INTERFACES(GaussSeidelSolver)
+
+public:
+
+    /**
+     * Vector of doubles.
+     */
+    typedef LinearSystemSolver::DoubleVectorT DoubleVectorT;
+
+
+    // Member data
+
+    /**
+     * Maximum number of sweeps before falling back to Gauss-Jordan.
+     */
+    unsigned max_iterations; //!< trick_units(--)
+
+    /**
+     * Convergence threshold on the change in x, relative to the magnitude
+     * of x.
+     */
+    double tolerance; //!< trick_units(--)
+
+    /**
+     * Relaxation factor, between zero and two.
+     */
+    double relaxation; //!< trick_units(--)
+
+    /**
+     * Number of sweeps taken by the last call to solve, or zero if that call
+     * fell back to Gauss-Jordan elimination.
+     */
+    unsigned last_iterations; //!< trick_units(--)
+
+
+    // Member functions
+
+    /**
+     * Default constructor.
+     */
+    GaussSeidelSolver ()
+    :
+        max_iterations(50),
+        tolerance(1e-12),
+        relaxation(1.0),
+        last_iterations(0)
+    {
+        JEOD_REGISTER_CLASS(GaussSeidelSolver);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~GaussSeidelSolver () override
+    {
+    }
+
+    /**
+     * Solve for x in A*x = b.
+     */
+    unsigned solve(DoubleVectorT& x) override;
+
+private:
+    // The copy constructor and copy assignment operator are not implemented
+    // to avoid erroneous copies.
+    GaussSeidelSolver (const GaussSeidelSolver&);
+    GaussSeidelSolver& operator= (const GaussSeidelSolver&);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -81,6 +81,12 @@ namespace jeod {
  *  - Populates the A matrix and b vector, and
  *  - Requests the object to solve for x.
  *
+ * A solver object owns all of the working storage used by `solve`, and that
+ * storage only ever grows. A user that keeps the solver across calls and
+ * sizes it up front with `set_max_dimensions` therefore incurs no heap
+ * allocations when solving, no matter how the dimensionality varies within
+ * that maximum.
+ *
  * Users must not assume that `solve` leaves the populated A matrix and b vector
  * untouched. To the contrary, an instantiable solver might well modify these
  * elements in the process of solving the matrix equation. It is up to the user
@@ -118,6 +124,13 @@ public:
      * Default constructor.
      */
     LinearSystemSolver ()
+    :
+        a_matrix(),
+        b_vector(),
+        max_dims(0),
+        n_dimensions(0),
+        n_rows(0),
+        n_cols(0)
     {
         JEOD_REGISTER_NONEXPORTED_CLASS(LinearSystemSolver);
         // FIXME: Make TwoDArray checkpointable.
@@ -0,0 +1,196 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Defines the class LowRankUpdateSolver.
+ */
+
+/*
+Purpose: ()
+Library dependencies: ((../src/low_rank_update_solver.cc))
+*/
+
+
+#ifndef JEOD_LOW_RANK_UPDATE_SOLVER_HH
+#define JEOD_LOW_RANK_UPDATE_SOLVER_HH
+
+
+#include "gauss_jordan_solver.hh"
+#include "two_d_array.hh"
+
+#include "utils/container/include/primitive_vector.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Solves a linear system of equations A*x = b in which A is the identity
+ * plus a matrix E of low rank. This is the form of the constraints equation
+ * built by DynBodyConstraintsSolver: every constraint acts on the same
+ * rigid composite body, so the coupling between constraints passes through
+ * that body's six degrees of freedom and E has rank six or less, no matter
+ * how many constraints there are.
+ *
+ * The solver factors E as U*V^T with a cross approximation that uses
+ * complete pivoting, stopping once the largest remaining element of E is
+ * below rank_tolerance relative to the largest element of A. It then solves
+ * the system with the Woodbury identity,
+ *   x = b - U * (I + V^T*U)^-1 * V^T*b,
+ * at a cost proportional to rank*N^2 rather than N^3. If E does not reach
+ * the tolerance within max_rank terms, or the small system is singular, the
+ * solver falls back to Gauss-Jordan elimination.
+ */
+class LowRankUpdateSolver : public GaussJordanSolver
+{
+    JEOD_MAKE_SIM_INTERFACES(LowRankUpdateSolver)
+
+public:
+
+    /**
+     * Vector of doubles.
+     */
+    typedef LinearSystemSolver::DoubleVectorT DoubleVectorT;
+
+
+    // Member data
+
+    /**
+     * Largest rank of E handled without falling back to Gauss-Jordan.
+     */
+    unsigned max_rank; //!< trick_units(--)
+
+    /**
+     * Truncation threshold for the factorization of E, relative to the
+     * largest magnitude element of A.
+     */
+    double rank_tolerance; //!< trick_units(--)
+
+    /**
+     * Rank of E found by the last call to solve, or zero if that call fell
+     * back to Gauss-Jordan elimination.
+     */
+    unsigned last_rank; //!< trick_units(--)
+
+
+    // Member functions
+
+    /**
+     * Default constructor.
+     */
+    LowRankUpdateSolver ()
+    :
+        max_rank(12),
+        rank_tolerance(1e-14),
+        last_rank(0)
+    {
+        JEOD_REGISTER_CLASS(LowRankUpdateSolver);
+        JEOD_REGISTER_CHECKPOINTABLE (this, u_factor);
+        JEOD_REGISTER_CHECKPOINTABLE (this, v_factor);
+        JEOD_REGISTER_CHECKPOINTABLE (this, work);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~LowRankUpdateSolver () override
+    {
+        JEOD_DEREGISTER_CHECKPOINTABLE (this, u_factor);
+        JEOD_DEREGISTER_CHECKPOINTABLE (this, v_factor);
+        JEOD_DEREGISTER_CHECKPOINTABLE (this, work);
+    }
+
+    /**
+     * Set the maximum dimensionality of the problem.
+     */
+    void set_max_dimensions (unsigned max_dims_in) override
+    {
+        GaussJordanSolver::set_max_dimensions(max_dims_in);
+        u_factor.reserve(max_dims*max_rank);
+        v_factor.reserve(max_dims*max_rank);
+        work.reserve(max_rank*(max_rank+1u));
+    }
+
+    /**
+     * Solve for x in A*x = b.
+     */
+    unsigned solve(DoubleVectorT& x) override;
+
+protected:
+
+    /**
+     * Columns of U, stored one column after another.
+     */
+    DoubleVectorT u_factor; //!< trick_io(**)
+
+    /**
+     * Columns of V, stored one column after another.
+     */
+    DoubleVectorT v_factor; //!< trick_io(**)
+
+    /**
+     * Scratch storage for the rank-sized system and the projections of b.
+     */
+    DoubleVectorT work; //!< trick_io(**)
+
+private:
+    // The copy constructor and copy assignment operator are not implemented
+    // to avoid erroneous copies.
+    LowRankUpdateSolver (const LowRankUpdateSolver&);
+    LowRankUpdateSolver& operator= (const LowRankUpdateSolver&);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,131 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Defines the class RowOperations.
+ */
+
+/*
+Purpose: ()
+*/
+
+
+#ifndef JEOD_ROW_OPERATIONS_HH
+#define JEOD_ROW_OPERATIONS_HH
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Elementary operations on contiguous runs of doubles, such as the rows of a
+ * row major TwoDArray. The solvers obtain raw row pointers once per row and
+ * hand them to these kernels. The simple unit stride loops over distinct
+ * rows are what lets the compiler vectorize the elimination steps;
+ * the same loops written in terms of TwoDArray::operator() recompute the
+ * index on every element and do not vectorize.
+ */
+class RowOperations
+{
+public:
+
+    /**
+     * Subtract a multiple of one row from another, dst -= scale*src.
+     * The rows must not overlap.
+     * @param src    Row to be subtracted.
+     * @param scale  Multiplier applied to src.
+     * @param count  Number of elements.
+     * @param dst    Row to be updated.
+     */
+    static void subtract_scaled (
+        const double* src, double scale, unsigned count, double* dst)
+    {
+        for (unsigned kk = 0; kk < count; ++kk)
+        {
+            dst[kk] -= scale * src[kk];
+        }
+    }
+
+    /**
+     * Scale a row in place, data *= scale.
+     * @param scale  Multiplier.
+     * @param count  Number of elements.
+     * @param data   Row to be scaled.
+     */
+    static void scale (double scale, unsigned count, double* data)
+    {
+        for (unsigned kk = 0; kk < count; ++kk)
+        {
+            data[kk] *= scale;
+        }
+    }
+
+    /**
+     * Compute the dot product of two rows.
+     * @param row_a  First row.
+     * @param row_b  Second row.
+     * @param count  Number of elements.
+     * @return Sum of the elementwise products.
+     */
+    static double dot (const double* row_a, const double* row_b, unsigned count)
+    {
+        double sum = 0.0;
+        for (unsigned kk = 0; kk < count; ++kk)
+        {
+            sum += row_a[kk] * row_b[kk];
+        }
+        return sum;
+    }
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -16,6 +16,7 @@ Purpose: ()
 
 
 #include "../include/gauss_jordan_solver.hh"
+#include "../include/row_operations.hh"
 
 
 //! Namespace jeod 
@@ -48,6 +49,7 @@ unsigned GaussJordanSolver::solve(DoubleVectorT& x)
         // Find the row containing the largest absolute value in column ii.
         // Note that column ii is zero in logical rows 0 to ii-1.
         unsigned i_pivot = avail_rows[ii];
+        unsigned i_avail = ii;
         double col_max = std::fabs(augmented_matrix(i_pivot,ii));
         for (unsigned jj = ii+1; jj < n_dimensions; ++jj)
         {
@@ -56,6 +58,7 @@ unsigned GaussJordanSolver::solve(DoubleVectorT& x)
             if (value_j > col_max)
             {
                 i_pivot = j_pivot;
+                i_avail = jj;
                 col_max = value_j;
             }
         }
@@ -71,16 +74,17 @@ unsigned GaussJordanSolver::solve(DoubleVectorT& x)
         }
 
         // i_pivot is the pivot row.
-        std::swap(avail_rows[ii], avail_rows[i_pivot]);
+        std::swap(avail_rows[ii], avail_rows[i_avail]);
         pivot_row[ii] = i_pivot;
 
         // Divide the pivot row by the pivot value.
-        double row_scale = 1.0 / augmented_matrix(i_pivot,ii);
-        augmented_matrix(i_pivot, ii) = 1.0;
-        for (unsigned kk = ii+1; kk <= n_dimensions; ++kk)
-        {
-            augmented_matrix(i_pivot, kk) *= row_scale;
-        }
+        // Columns 0 to ii of the remaining rows are already reduced, so the
+        // row operations only need to cover columns ii+1 to n_dimensions.
+        unsigned n_tail = n_dimensions - ii;
+        double* pivot_data = &augmented_matrix(i_pivot, 0);
+        double row_scale = 1.0 / pivot_data[ii];
+        pivot_data[ii] = 1.0;
+        RowOperations::scale (row_scale, n_tail, pivot_data + ii + 1);
 
         // Remove the pivot row from the other rows.
         for (unsigned jj = 0; jj < n_dimensions; ++jj)
@@ -90,13 +94,15 @@ unsigned GaussJordanSolver::solve(DoubleVectorT& x)
             {
                 continue;
             }
-            row_scale = augmented_matrix(j_pivot, ii);
-            augmented_matrix(j_pivot, ii) = 0.0;
-            for (unsigned kk = ii+1; kk <= n_dimensions; ++kk)
+            double* row_data = &augmented_matrix(j_pivot, 0);
+            row_scale = row_data[ii];
+            if (row_scale == 0.0)
             {
-                augmented_matrix(j_pivot, kk) -=
-                    row_scale * augmented_matrix(i_pivot, kk);
+                continue;
             }
+            row_data[ii] = 0.0;
+            RowOperations::subtract_scaled (
+                pivot_data + ii + 1, row_scale, n_tail, row_data + ii + 1);
         }
 
         last_row = ii;
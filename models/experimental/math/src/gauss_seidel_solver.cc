@@ -0,0 +1,82 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Implement class GaussSeidelSolver.
+ */
+
+/*
+Purpose: ()
+*/
+
+
+#include "../include/gauss_seidel_solver.hh"
+#include "../include/row_operations.hh"
+
+#include <cmath>
+
+
+//! Namespace jeod
+namespace jeod {
+
+unsigned GaussSeidelSolver::solve(DoubleVectorT& x)
+{
+    unsigned n_dims = n_dimensions;
+    last_iterations = 0;
+
+    for (unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        if (a_matrix(ii,ii) == 0.0)
+        {
+            return GaussJordanSolver::solve(x);
+        }
+    }
+
+    // Warm start from the caller's x if it is the right size.
+    if (x.size() != n_dims)
+    {
+        x.assign(n_dims, 0.0);
+    }
+
+    for (unsigned iter = 1; iter <= max_iterations; ++iter)
+    {
+        double x_max = 0.0;
+        double dx_max = 0.0;
+        for (unsigned ii = 0; ii < n_dims; ++ii)
+        {
+            const double* row_data = &a_matrix(ii,0);
+            double residual =
+                b_vector[ii] - RowOperations::dot (row_data, &x[0], n_dims);
+            double delta = relaxation * residual / row_data[ii];
+            x[ii] += delta;
+            dx_max = std::fmax(dx_max, std::fabs(delta));
+            x_max = std::fmax(x_max, std::fabs(x[ii]));
+        }
+
+        if (! std::isfinite(dx_max))
+        {
+            break;
+        }
+        if (dx_max <= tolerance * x_max)
+        {
+            last_iterations = iter;
+            return n_dims;
+        }
+    }
+
+    return GaussJordanSolver::solve(x);
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,205 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Implement class LowRankUpdateSolver.
+ */
+
+/*
+Purpose: ()
+*/
+
+
+#include "../include/low_rank_update_solver.hh"
+#include "../include/row_operations.hh"
+
+#include <cmath>
+#include <utility>
+
+
+//! Namespace jeod
+namespace jeod {
+
+unsigned LowRankUpdateSolver::solve(DoubleVectorT& x)
+{
+    unsigned n_dims = n_dimensions;
+    last_rank = 0;
+
+    if (n_dims == 0)
+    {
+        x.resize(0);
+        return 0;
+    }
+
+    // Copy E = A - I into the augmented matrix, which serves as the residual
+    // of the cross approximation. Gauss-Jordan rebuilds it from A if needed.
+    double scale = 0.0;
+    for (unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        for (unsigned jj = 0; jj < n_dims; ++jj)
+        {
+            double a_ij = a_matrix(ii,jj);
+            scale = std::fmax(scale, std::fabs(a_ij));
+            augmented_matrix(ii,jj) = (ii == jj) ? a_ij - 1.0 : a_ij;
+        }
+    }
+    double threshold = rank_tolerance * scale;
+
+    u_factor.resize(n_dims*max_rank);
+    v_factor.resize(n_dims*max_rank);
+
+    // Peel off rank one terms, pivoting on the largest remaining element.
+    unsigned rank = 0;
+    bool converged = false;
+    for (;;)
+    {
+        unsigned p_row = 0;
+        unsigned q_col = 0;
+        double res_max = 0.0;
+        for (unsigned ii = 0; ii < n_dims; ++ii)
+        {
+            for (unsigned jj = 0; jj < n_dims; ++jj)
+            {
+                double value = std::fabs(augmented_matrix(ii,jj));
+                if (value > res_max)
+                {
+                    res_max = value;
+                    p_row = ii;
+                    q_col = jj;
+                }
+            }
+        }
+
+        if (res_max <= threshold)
+        {
+            converged = true;
+            break;
+        }
+        if (rank == max_rank)
+        {
+            break;
+        }
+
+        double* u_col = &u_factor[rank*n_dims];
+        double* v_col = &v_factor[rank*n_dims];
+        double inv_pivot = 1.0 / augmented_matrix(p_row,q_col);
+        for (unsigned ii = 0; ii < n_dims; ++ii)
+        {
+            u_col[ii] = augmented_matrix(ii,q_col);
+            v_col[ii] = augmented_matrix(p_row,ii) * inv_pivot;
+        }
+        for (unsigned ii = 0; ii < n_dims; ++ii)
+        {
+            double u_i = u_col[ii];
+            if (u_i != 0.0)
+            {
+                RowOperations::subtract_scaled (
+                    v_col, u_i, n_dims, &augmented_matrix(ii,0));
+            }
+        }
+        ++rank;
+    }
+
+    if (! converged)
+    {
+        return GaussJordanSolver::solve(x);
+    }
+
+    x.resize(n_dims);
+    for (unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        x[ii] = b_vector[ii];
+    }
+    if (rank == 0)
+    {
+        return n_dims;
+    }
+
+    // Form the rank-sized system (I + V^T*U) y = V^T*b, stored row major
+    // and augmented with its right hand side.
+    unsigned n_cols_s = rank + 1;
+    work.resize(rank*n_cols_s);
+    for (unsigned kk = 0; kk < rank; ++kk)
+    {
+        const double* v_col = &v_factor[kk*n_dims];
+        for (unsigned ll = 0; ll < rank; ++ll)
+        {
+            const double* u_col = &u_factor[ll*n_dims];
+            work[kk*n_cols_s + ll] = ((kk == ll) ? 1.0 : 0.0) +
+                                     RowOperations::dot (v_col, u_col, n_dims);
+        }
+        work[kk*n_cols_s + rank] =
+            RowOperations::dot (v_col, &b_vector[0], n_dims);
+    }
+
+    // Gaussian elimination with partial pivoting on the small system.
+    double s_max = 0.0;
+    for (unsigned kk = 0; kk < rank*n_cols_s; ++kk)
+    {
+        s_max = std::fmax(s_max, std::fabs(work[kk]));
+    }
+    for (unsigned kk = 0; kk < rank; ++kk)
+    {
+        unsigned i_pivot = kk;
+        for (unsigned ll = kk+1; ll < rank; ++ll)
+        {
+            if (std::fabs(work[ll*n_cols_s + kk]) >
+                std::fabs(work[i_pivot*n_cols_s + kk]))
+            {
+                i_pivot = ll;
+            }
+        }
+        if (std::fabs(work[i_pivot*n_cols_s + kk]) <= 1e-14*s_max)
+        {
+            return GaussJordanSolver::solve(x);
+        }
+        if (i_pivot != kk)
+        {
+            for (unsigned ll = kk; ll < n_cols_s; ++ll)
+            {
+                std::swap(work[kk*n_cols_s + ll], work[i_pivot*n_cols_s + ll]);
+            }
+        }
+        for (unsigned ll = kk+1; ll < rank; ++ll)
+        {
+            double factor = work[ll*n_cols_s + kk] / work[kk*n_cols_s + kk];
+            for (unsigned mm = kk; mm < n_cols_s; ++mm)
+            {
+                work[ll*n_cols_s + mm] -= factor * work[kk*n_cols_s + mm];
+            }
+        }
+    }
+    for (unsigned kk = rank; kk-- > 0;)
+    {
+        double sum = work[kk*n_cols_s + rank];
+        for (unsigned ll = kk+1; ll < rank; ++ll)
+        {
+            sum -= work[kk*n_cols_s + ll] * work[ll*n_cols_s + rank];
+        }
+        work[kk*n_cols_s + rank] = sum / work[kk*n_cols_s + kk];
+    }
+
+    // x = b - U*y
+    for (unsigned ll = 0; ll < rank; ++ll)
+    {
+        RowOperations::subtract_scaled (
+            &u_factor[ll*n_dims], work[ll*n_cols_s + rank], n_dims, &x[0]);
+    }
+
+    last_rank = rank;
+    return n_dims;
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,186 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/include/aero_coef_table.hh
+ * Body-frame table of aerodynamic force and torque coefficients, indexed by
+ * the direction of the relative wind
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((The table is rebuilt when the aero surface articulates only if the
+      surface is registered as an articulation observer of its SurfaceModel)
+     (Every facet is a flat plate with fixed drag coefficients, so that the
+      facet forces scale with the dynamic pressure alone))
+
+Library dependencies:
+    ((../src/aero_coef_table.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_AERO_COEF_TABLE_HH
+#define JEOD_AERO_COEF_TABLE_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+class AeroFacet;
+class AeroSurface;
+
+
+/**
+ * Tabulates the aerodynamic force and torque of a rigid AeroSurface over the
+ * sphere of relative wind directions. The directions are the nodes of a
+ * cubed-sphere grid: each face of the unit cube is divided into
+ * grid_size x grid_size cells in gnomonic coordinates. Each node holds the
+ * total force per unit dynamic pressure and the total torque about the
+ * structural origin per unit dynamic pressure, summed over the facets.
+ * Lookups interpolate bilinearly within the cube face the direction falls
+ * on, so the cost is independent of the number of facets.
+ */
+class AeroCoefTable {
+
+   JEOD_MAKE_SIM_INTERFACES(AeroCoefTable)
+
+public:
+
+   /**
+    * Number of grid cells along each edge of a cube face
+    */
+   unsigned int grid_size; //!< trick_units(count)
+
+   // constructor
+   AeroCoefTable ();
+
+   // destructor
+   ~AeroCoefTable ();
+
+   // Tabulate the force and torque coefficients of the surface
+   void build (AeroSurface & surface);
+
+   // Is the table built for the given surface?
+   bool is_built_for (const AeroSurface & surface) const;
+
+   // Force the table to be rebuilt on its next use
+   void invalidate ();
+
+   // Interpolate the force and torque for a relative wind direction
+   void evaluate (
+      const double rel_vel_hat[3],
+      double dynamic_pressure,
+      const double center_grav[3],
+      double force[3],
+      double torque[3]) const;
+
+private:
+
+   // Number of values stored per node: force and torque coefficients
+   static const unsigned int num_node_values = 6;
+
+   // Map a direction onto a cube face and the face's gnomonic coordinates
+   static unsigned int find_face (
+      const double direction[3],
+      double & u_coord,
+      double & v_coord);
+
+   /**
+    * The facet array the table was built from
+    */
+   AeroFacet ** built_facets; //!< trick_units(--)
+
+   /**
+    * Number of facets the table was built for
+    */
+   unsigned int num_facets; //!< trick_units(count)
+
+   /**
+    * Grid size the table was built with
+    */
+   unsigned int built_grid_size; //!< trick_units(count)
+
+   /**
+    * Surface geometry revision the table was built for
+    */
+   unsigned int built_revision; //!< trick_units(count)
+
+   /**
+    * Has the table been built?
+    */
+   bool built; //!< trick_units(--)
+
+   /**
+    * Node values, ordered by face, v index, u index, then the three force
+    * coefficients (m2) and the three torque coefficients (m3)
+    */
+   std::vector<double> node_values; //!< trick_io(**)
+
+   // Operator = and copy constructor locked from use by being made private
+   AeroCoefTable & operator = (const AeroCoefTable & rhs);
+   AeroCoefTable (const AeroCoefTable & rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -73,7 +73,9 @@ Library dependencies:
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
+#include "aero_coef_table.hh"
 #include "default_aero.hh"
+#include "flat_plate_aero_batch.hh"
 
 //! Namespace jeod
 namespace jeod {
@@ -196,6 +198,28 @@ public:
     */
    DefaultAero ballistic_drag; //!< trick_units(--)
 
+   /**
+    * Evaluate the flat plates of the aero surface in one batched pass
+    * rather than facet by facet. The results are identical.
+    */
+   bool batch_flat_plates; //!< trick_units(--)
+
+   /**
+    * Look the surface drag up in a precomputed table indexed by the
+    * relative wind direction instead of integrating over the facets.
+    * Only valid for rigid surfaces of fixed-coefficient flat plates; the
+    * individual facet forces are not updated in this mode.
+    */
+   bool use_coef_table; //!< trick_units(--)
+
+   /**
+    * Force and torque coefficient table used when use_coef_table is set.
+    * Call coef_table.invalidate() after changing the surface; the table is
+    * rebuilt automatically after the surface articulates if the AeroSurface
+    * is an articulation observer of its SurfaceModel.
+    */
+   AeroCoefTable coef_table; //!< trick_units(--)
+
 
 
    AerodynamicDrag ();
@@ -214,6 +238,11 @@ public:
    void clear_aero_surface();
 
 private:
+   /**
+    * Packed flat plate data for the current aero surface
+    */
+   FlatPlateAeroBatch flat_plate_batch; //!< trick_io(**)
+
     // The DefaultAero object is not copyable, therefore this object is not copyable.
     AerodynamicDrag (const AerodynamicDrag &);
     AerodynamicDrag & operator =(const AerodynamicDrag &);
@@ -67,6 +67,7 @@ Library dependencies:
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
+#include "utils/surface_model/include/articulation_observer.hh"
 #include "utils/surface_model/include/interaction_surface.hh"
 
 // Model includes
@@ -82,7 +83,7 @@ class InteractionFacetFactory;
 /**
  * The aerodynamic specific interaction surface, for use with the surface model.
  */
-class AeroSurface : public InteractionSurface {
+class AeroSurface : public InteractionSurface, public ArticulationObserver {
 
    JEOD_MAKE_SIM_INTERFACES(AeroSurface)
 
@@ -106,6 +107,14 @@ public:
     */
    unsigned int facets_size; //!< trick_units(count)
 
+   /**
+    * Incremented whenever facets of the surface articulate, so that data
+    * derived from the facet geometry can tell that it is out of date.
+    * Register the surface as an articulation observer of the SurfaceModel
+    * it was created from for this to be kept.
+    */
+   unsigned int geometry_revision; //!< trick_units(count)
+
    // Allocates the aero_facets array from the given size
    void allocate_array (unsigned int size) override;
 
@@ -119,6 +128,20 @@ public:
       FacetParams* params,
       unsigned int index) override;
 
+   // Allocates the facets at the given indices, all of which use the
+   // given factory, in one block if the factory supports it
+   void allocate_interaction_facets (
+      Facet** facets,
+      InteractionFacetFactory* factory,
+      FacetParams** params,
+      const unsigned int* indices,
+      unsigned int count) override;
+
+   // Note that facets of the surface have moved.
+   void facets_articulated (
+      const SurfaceModel & surface,
+      const std::vector<unsigned int> & changed_facets) override;
+
 
 protected:
 
@@ -71,6 +71,7 @@ Library dependencies:
 #include "utils/surface_model/include/interaction_surface_factory.hh"
 
 // Model includes
+#include "cylinder_aero_factory.hh"
 #include "flat_plate_aero_factory.hh"
 #include "flat_plate_thermal_aero_factory.hh"
 
@@ -115,6 +116,11 @@ protected:
     */
   FlatPlateThermalAeroFactory flat_plate_thermal_aero_factory;   //!< trick_units(--)
 
+   /**
+    * A factory that can create a cylinder aero facet from a cylinder.
+    */
+  CylinderAeroFactory cylinder_aero_factory;   //!< trick_units(--)
+
 private:
 
    // operator = and copy constructor locked from use because they
@@ -71,6 +71,7 @@
 namespace jeod {
 
 class AeroDragEnum;
+class AeroCoefTable;
 class AeroDragParameters;
 class AerodynamicDrag;
 class AeroFacet;
@@ -78,7 +79,10 @@ class AeroParams;
 class AeroSurface;
 class AeroSurfaceFactory;
 class AerodynamicsMessages;
+class CylinderAeroFacet;
+class CylinderAeroFactory;
 class DefaultAero;
+class FlatPlateAeroBatch;
 class FlatPlateAeroFacet;
 class FlatPlateAeroFactory;
 class FlatPlateAeroParams;
@@ -0,0 +1,149 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/include/cylinder_aero_facet.hh
+ * The aerodynamic specific implementation of a cylinder
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+      ((Only the lateral surface of the cylinder is modeled; model the end
+        caps, if exposed, as circular flat plates))
+
+Library dependencies:
+    ((../src/cylinder_aero_facet.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_CYLINDER_AERO_FACET_HH
+#define JEOD_CYLINDER_AERO_FACET_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "flat_plate_aero_facet.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * The aerodynamic specific version of a cylinder. The drag on the lateral
+ * surface is integrated over the windward half of the surface in closed
+ * form for the specular, diffuse and mixed methods, and by quadrature
+ * around the circumference for the calculated coefficients. The drag
+ * parameters are those of a flat plate; the inherited normal is the
+ * cylinder axis and the inherited center of pressure is the center of the
+ * cylinder. As with the flat plate, force_n holds the drag normal to the
+ * surface, which sums to a force along the cross-flow direction, and
+ * force_t the remainder: the diffuse drag, along the relative velocity, or
+ * the tangential drag when the coefficients are calculated.
+ */
+class CylinderAeroFacet : public FlatPlateAeroFacet {
+
+   JEOD_MAKE_SIM_INTERFACES(CylinderAeroFacet)
+
+public:
+
+   // constructor
+   CylinderAeroFacet ();
+
+   // destructor
+   ~CylinderAeroFacet () override;
+
+   // The cylinder specific implementation of aerodrag_force
+   void aerodrag_force (
+      const double velocity_mag,
+      const double rel_vel_hat[3],
+      AeroDragParameters* aero_drag_param_ptr,
+      double center_grav[3]) override;
+
+   /**
+    * Radius of the cylinder
+    */
+   double radius; //!< trick_units(m)
+
+   /**
+    * Length of the cylinder
+    */
+   double length; //!< trick_units(m)
+
+protected:
+
+   // Integrate the drag with calculated coefficients around the windward
+   // half of the circumference.
+   void integrate_calculated_drag (
+      double s,
+      double temp_ratio,
+      double force_base,
+      double sin_cross,
+      const double rel_vel_hat[3],
+      const double cross_hat[3],
+      double torque_center[3]);
+
+private:
+
+   // Operator = and copy constructor locked from use by being made private
+   CylinderAeroFacet& operator = (const CylinderAeroFacet& rhs);
+   CylinderAeroFacet (const CylinderAeroFacet& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,150 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/include/flat_plate_aero_batch.hh
+ * Facet-batched evaluation of flat plate aerodynamic drag
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((Facets using the Calc_coef method, and facets that are not flat plates,
+      are evaluated through their own aerodrag_force))
+
+Library dependencies:
+    ((../src/flat_plate_aero_batch.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_FLAT_PLATE_AERO_BATCH_HH
+#define JEOD_FLAT_PLATE_AERO_BATCH_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+class AeroDragParameters;
+class AeroFacet;
+class AeroSurface;
+class FlatPlateAeroFacet;
+
+
+/**
+ * Evaluates the drag on all facets of an AeroSurface in one pass. Flat plates
+ * using the Specular, Diffuse or Mixed methods are evaluated inline, with the
+ * speed-ratio terms of calculated coefficients computed once per pass rather
+ * than once per plate; the results are identical to those of
+ * FlatPlateAeroFacet::aerodrag_force. All other facets are evaluated through
+ * their own aerodrag_force.
+ */
+class FlatPlateAeroBatch {
+
+   JEOD_MAKE_SIM_INTERFACES(FlatPlateAeroBatch)
+
+public:
+
+   // constructor
+   FlatPlateAeroBatch ();
+
+   // destructor
+   ~FlatPlateAeroBatch ();
+
+   // Compute the drag on every facet of the surface and sum the results
+   void aerodrag_force (
+      AeroSurface & surface,
+      const double rel_vel_mag,
+      const double rel_vel_hat[3],
+      AeroDragParameters * aero_drag_param_ptr,
+      double center_grav[3],
+      double force[3],
+      double torque[3]);
+
+private:
+
+   // Identify the flat plate facets of the surface
+   void build (AeroSurface & surface);
+
+   /**
+    * The facet array the plate list was built from
+    */
+   AeroFacet ** built_facets; //!< trick_units(--)
+
+   /**
+    * Number of facets the plate list was built for
+    */
+   unsigned int num_facets; //!< trick_units(count)
+
+   /**
+    * The facets of the surface as flat plates; null for facets that are not
+    * flat plates
+    */
+   std::vector<FlatPlateAeroFacet *> plates; //!< trick_io(**)
+
+   // Operator = and copy constructor locked from use by being made private
+   FlatPlateAeroBatch & operator = (const FlatPlateAeroBatch & rhs);
+   FlatPlateAeroBatch (const FlatPlateAeroBatch & rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -168,6 +168,26 @@ public:
    double area; //!< trick_units(m2)
 protected:
 
+   // The speed ratio of the free-molecular coefficient calculations.
+   static double speed_ratio (
+      const double rel_vel_mag,
+      const AeroDragParameters & aero_drag_param);
+
+   // The drag coefficient of a fully specular plate.
+   static double specular_drag_coef (const double s);
+
+   // The drag coefficient of a fully diffuse plate.
+   static double diffuse_drag_coef (const double s, const double temp_ratio);
+
+   // The normal and tangential drag coefficients at an angle of attack.
+   static void calculated_drag_coefs (
+      const double s,
+      const double sin_alpha,
+      const double epsilon,
+      const double temp_ratio,
+      double & coef_norm,
+      double & coef_tang);
+
 private:
 
    // Operator = and copy constructor locked from use by being made private
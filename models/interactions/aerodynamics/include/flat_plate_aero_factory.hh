@@ -76,6 +76,9 @@ namespace jeod {
 class Facet;
 class InteractionFacet;
 class FacetParams;
+class FlatPlate;
+class FlatPlateAeroFacet;
+class FlatPlateAeroParams;
 
 /**
  * Creates a FlatPlateAeroFacet from a FlatPlate.
@@ -94,12 +97,31 @@ public:
 
    InteractionFacet* create_facet (Facet* facet, FacetParams* params) override;
 
+   InteractionFacet* create_facets (
+      Facet** facets,
+      FacetParams** params,
+      unsigned int count,
+      InteractionFacet** inter_facets) override;
+
    // 'true' if this factory is meant to be used on the type of facet
    // sent in through the 'facet' pointer. 'false' otherwise
    bool is_correct_factory (Facet* facet) override;
 
 protected:
 
+   // Cast the facet and parameters to the types this factory requires.
+   static bool cast_inputs (
+      Facet* facet,
+      FacetParams* params,
+      FlatPlate*& flat_plate,
+      FlatPlateAeroParams*& aero_params);
+
+   // Fill out an interaction facet from its facet and parameters.
+   static void define_facet (
+      FlatPlate& flat_plate,
+      FlatPlateAeroParams& aero_params,
+      FlatPlateAeroFacet& inter_facet);
+
 private:
 
    // operator = and copy constructor locked from use because they
@@ -0,0 +1,289 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/src/aero_coef_table.cc
+ * Body-frame table of aerodynamic force and torque coefficients, indexed by
+ * the direction of the relative wind
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+Library dependencies:
+    ((aero_coef_table.cc)
+     (aero_surface.cc)
+     (flat_plate_aero_facet.cc)
+     (aerodynamics_messages.cc)
+     (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/aero_coef_table.hh"
+#include "../include/aero_drag.hh"
+#include "../include/aero_surface.hh"
+#include "../include/flat_plate_aero_facet.hh"
+#include "../include/aerodynamics_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default Constructor
+ */
+
+AeroCoefTable::AeroCoefTable (
+   void)
+: // Return: -- void
+   grid_size(32),
+   built_facets(nullptr),
+   num_facets(0),
+   built_grid_size(0),
+   built_revision(0),
+   built(false)
+{
+   return;
+}
+
+/**
+ * Destructor
+ */
+
+AeroCoefTable::~AeroCoefTable (
+   void)
+{
+   // empty for now
+}
+
+/**
+ * Tabulate the force and torque coefficients of the surface at every node
+ * of the cubed-sphere grid. Each facet is evaluated with unit dynamic
+ * pressure and the center of gravity at the structural origin.
+ * \param[in,out] surface The AeroSurface to tabulate
+ */
+
+void
+AeroCoefTable::build (
+   AeroSurface & surface)
+{
+   if (grid_size == 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, AerodynamicsMessages::initialization_error,
+         "The grid_size of an AeroCoefTable must be positive.");
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < surface.facets_size; ++ii) {
+      FlatPlateAeroFacet * plate =
+         dynamic_cast<FlatPlateAeroFacet *> (surface.aero_facets[ii]);
+      if ((plate == nullptr) ||
+          plate->calculate_drag_coef ||
+          (plate->coef_method == AeroDragEnum::Calc_coef)) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, AerodynamicsMessages::initialization_error,
+            "Aero facet %u cannot be tabulated. Only flat plates and "
+            "cylinders with fixed drag coefficients produce forces that "
+            "scale with the dynamic pressure alone.", ii);
+         return;
+      }
+   }
+
+   AeroDragParameters unit_param;
+   unit_param.dynamic_pressure = 1.0;
+   unit_param.gas_const        = 0.0;
+   unit_param.temp_free_stream = 0.0;
+
+   double origin[3];
+   Vector3::initialize (origin);
+
+   unsigned int num_nodes = grid_size + 1;
+   node_values.assign (6 * num_nodes * num_nodes * num_node_values, 0.0);
+
+   double * node = node_values.data();
+   for (unsigned int face = 0; face < 6; ++face) {
+      unsigned int axis = face / 2;
+      double sign = (face % 2 == 0) ? 1.0 : -1.0;
+
+      for (unsigned int jj = 0; jj < num_nodes; ++jj) {
+         double v_coord = -1.0 + (2.0 * jj) / grid_size;
+
+         for (unsigned int ii = 0; ii < num_nodes; ++ii) {
+            double u_coord = -1.0 + (2.0 * ii) / grid_size;
+            double direction[3];
+
+            direction[axis]           = sign;
+            direction[(axis + 1) % 3] = u_coord;
+            direction[(axis + 2) % 3] = v_coord;
+            Vector3::normalize (direction);
+
+            for (unsigned int kk = 0; kk < surface.facets_size; ++kk) {
+               AeroFacet * facet = surface.aero_facets[kk];
+               Vector3::initialize (facet->force);
+               Vector3::initialize (facet->torque);
+               facet->aerodrag_force (1.0, direction, &unit_param, origin);
+               Vector3::incr (facet->force, node);
+               Vector3::incr (facet->torque, node + 3);
+            }
+
+            node += num_node_values;
+         }
+      }
+   }
+
+   // The facets hold the results for the last node; clear them so they are
+   // not mistaken for the current drag.
+   for (unsigned int kk = 0; kk < surface.facets_size; ++kk) {
+      Vector3::initialize (surface.aero_facets[kk]->force);
+      Vector3::initialize (surface.aero_facets[kk]->torque);
+   }
+
+   built_facets    = surface.aero_facets;
+   num_facets      = surface.facets_size;
+   built_grid_size = grid_size;
+   built_revision  = surface.geometry_revision;
+   built           = true;
+}
+
+/**
+ * Report whether the table is built for the given surface and the current
+ * grid size.
+ * \param[in] surface The AeroSurface in use
+ * \return True if the table can be used for the surface
+ */
+
+bool
+AeroCoefTable::is_built_for (
+   const AeroSurface & surface) const
+{
+   return built &&
+          (surface.aero_facets == built_facets) &&
+          (surface.facets_size == num_facets) &&
+          (surface.geometry_revision == built_revision) &&
+          (grid_size == built_grid_size);
+}
+
+/**
+ * Mark the table as out of date, for example after the facet drag
+ * coefficients or geometry have been changed.
+ */
+
+void
+AeroCoefTable::invalidate (
+   void)
+{
+   built = false;
+}
+
+/**
+ * Find the cube face a direction passes through, and the gnomonic
+ * coordinates of the direction on that face.
+ * \param[in] direction The direction to locate
+ * \param[out] u_coord First face coordinate, in [-1, 1]
+ * \param[out] v_coord Second face coordinate, in [-1, 1]
+ * \return The face index: twice the face axis, plus one for the negative face
+ */
+
+unsigned int
+AeroCoefTable::find_face (
+   const double direction[3],
+   double & u_coord,
+   double & v_coord)
+{
+   unsigned int axis = 0;
+   if (std::fabs (direction[1]) > std::fabs (direction[axis])) {
+      axis = 1;
+   }
+   if (std::fabs (direction[2]) > std::fabs (direction[axis])) {
+      axis = 2;
+   }
+
+   double inv_major = 1.0 / std::fabs (direction[axis]);
+   u_coord = direction[(axis + 1) % 3] * inv_major;
+   v_coord = direction[(axis + 2) % 3] * inv_major;
+
+   return 2 * axis + ((direction[axis] < 0.0) ? 1 : 0);
+}
+
+/**
+ * Interpolate the aerodynamic force and torque for a relative wind
+ * direction.
+ * \param[in] rel_vel_hat The unit vector of the total relative velocity, in the structural frame
+ * \param[in] dynamic_pressure The dynamic pressure\n Units: N/m2
+ * \param[in] center_grav The center of gravity of the vehicle, in the structural frame\n Units: M
+ * \param[out] force Total aerodynamic force, in the structural frame\n Units: N
+ * \param[out] torque Total aerodynamic torque about the center of gravity\n Units: N*m
+ */
+
+void
+AeroCoefTable::evaluate (
+   const double rel_vel_hat[3],
+   double dynamic_pressure,
+   const double center_grav[3],
+   double force[3],
+   double torque[3]) const
+{
+   double u_coord;
+   double v_coord;
+   unsigned int face = find_face (rel_vel_hat, u_coord, v_coord);
+
+   double u_scaled = 0.5 * (u_coord + 1.0) * grid_size;
+   double v_scaled = 0.5 * (v_coord + 1.0) * grid_size;
+   unsigned int i0 = static_cast<unsigned int> (u_scaled);
+   unsigned int j0 = static_cast<unsigned int> (v_scaled);
+   if (i0 >= grid_size) {
+      i0 = grid_size - 1;
+   }
+   if (j0 >= grid_size) {
+      j0 = grid_size - 1;
+   }
+   double u_frac = u_scaled - i0;
+   double v_frac = v_scaled - j0;
+
+   unsigned int num_nodes = grid_size + 1;
+   const double * node00 = node_values.data() +
+      ((face * num_nodes + j0) * num_nodes + i0) * num_node_values;
+   const double * node10 = node00 + num_node_values;
+   const double * node01 = node00 + num_nodes * num_node_values;
+   const double * node11 = node01 + num_node_values;
+
+   double w00 = (1.0 - u_frac) * (1.0 - v_frac);
+   double w10 = u_frac * (1.0 - v_frac);
+   double w01 = (1.0 - u_frac) * v_frac;
+   double w11 = u_frac * v_frac;
+
+   double coefs[num_node_values];
+   for (unsigned int kk = 0; kk < num_node_values; ++kk) {
+      coefs[kk] = w00 * node00[kk] + w10 * node10[kk] +
+                  w01 * node01[kk] + w11 * node11[kk];
+   }
+
+   // The tabulated torque is about the structural origin; shift it to the
+   // center of gravity.
+   Vector3::scale (coefs, dynamic_pressure, force);
+   Vector3::scale (coefs + 3, dynamic_pressure, torque);
+   Vector3::cross_decr (center_grav, force, torque);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
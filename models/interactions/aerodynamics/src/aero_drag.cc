@@ -36,8 +36,11 @@ ASSUMPTIONS AND LIMITATIONS:
 LIBRARY DEPENDENCY:
     ((aerodynamics_messages.cc)
      (aero_surface.cc)
+     (aero_coef_table.cc)
      (default_aero.cc)
-     (utils/message/src/message_handler.cc))
+     (flat_plate_aero_batch.cc)
+     (utils/message/src/message_handler.cc)
+     (utils/sim_interface/src/jeod_profiler.cc))
 
 
 */
@@ -50,6 +53,7 @@ LIBRARY DEPENDENCY:
 #include "utils/math/include/vector3.hh"
 #include "environment/atmosphere/base_atmos/include/atmosphere.hh"
 #include "environment/atmosphere/base_atmos/include/atmosphere_state.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/aero_drag.hh"
@@ -73,7 +77,9 @@ AerodynamicDrag::AerodynamicDrag (
    density(0.0),
    param(),
    use_default_behavior(true),
-   aero_surface_ptr(nullptr)
+   aero_surface_ptr(nullptr),
+   batch_flat_plates(true),
+   use_coef_table(false)
 {
    Vector3::initialize (aero_force);
    Vector3::initialize (aero_torque);
@@ -107,6 +113,8 @@ AerodynamicDrag::aero_drag (
    double mass,
    double center_grav[3])
 {
+   JEOD_PROFILE_SCOPE ("aerodynamics", "AerodynamicDrag::aero_drag");
+
    unsigned int i_p;    // -- plate index value
    double relative_vel_cm[3];  /* M/s
       velocity of vehicle center of mass relative to ambient atmosphere in
@@ -168,10 +176,27 @@ AerodynamicDrag::aero_drag (
       return;
    }
 
+   if (use_coef_table) {
+      if (! coef_table.is_built_for (*aero_surface_ptr)) {
+         coef_table.build (*aero_surface_ptr);
+      }
+      coef_table.evaluate (rel_vel_struct_hat, param.dynamic_pressure,
+                           center_grav, aero_force, aero_torque);
+      return;
+   }
+
    for  (i_p = 0; i_p < aero_surface_ptr->facets_size; ++i_p) {
       Vector3::initialize (aero_surface_ptr->aero_facets[i_p]->force);
       Vector3::initialize (aero_surface_ptr->aero_facets[i_p]->torque);
    }
+
+   if (batch_flat_plates) {
+      flat_plate_batch.aerodrag_force (*aero_surface_ptr, rel_vel_mag,
+                                       rel_vel_struct_hat, &param,
+                                       center_grav, aero_force, aero_torque);
+      return;
+   }
+
    // Compute the aerodynamic forces on each plate.
    for  (i_p = 0; i_p < aero_surface_ptr->facets_size; ++i_p) {
 
@@ -35,6 +35,7 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <vector>
 
 // JEOD includes
 #include "utils/memory/include/jeod_alloc.hh"
@@ -59,7 +60,8 @@ AeroSurface::AeroSurface (
    void)
 : // Return: -- void
    aero_facets(nullptr),
-   facets_size(0)
+   facets_size(0),
+   geometry_revision(0)
 {
    JEOD_REGISTER_CLASS(AeroSurface);
    JEOD_REGISTER_INCOMPLETE_CLASS(AeroFacet);
@@ -75,8 +77,10 @@ AeroSurface::~AeroSurface (
 
    if (aero_facets != nullptr) {
 
+      // Facets created in a block are released by InteractionSurface
       for (unsigned int ii = 0; ii < facets_size; ++ii) {
-         if (aero_facets[ii] != nullptr) {
+         if ((aero_facets[ii] != nullptr) &&
+             (! is_block_facet (aero_facets[ii]))) {
             JEOD_DELETE_OBJECT (aero_facets[ii]);
          }
       }
@@ -216,6 +220,88 @@ AeroSurface::allocate_interaction_facet (
 }
 
 
+/**
+ * Allocates the interaction facets for several facets that share the
+ * factory. If the factory supports it, the facets are created in one block;
+ * otherwise each is allocated with allocate_interaction_facet.
+ * \param[in] facets The basic facets used to create the interaction facets
+ * \param[in] factory The factory used to create the interaction facets
+ * \param[in] params The aero params used to create each interaction facet
+ * \param[in] indices Where each new interaction facet will be placed in the aero_facets array
+ * \param[in] count Number of facets\n Units: cnt
+ */
+
+void
+AeroSurface::allocate_interaction_facets (
+   Facet** facets,
+   InteractionFacetFactory* factory,
+   FacetParams** params,
+   const unsigned int* indices,
+   unsigned int count)
+{
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if (facets_size <= indices[ii]) {
+
+         MessageHandler::fail (
+            __FILE__, __LINE__, AerodynamicsMessages::initialization_error,
+            "AeroSurface::allocate_interaction_facets was asked to allocate "
+            "from the Facet at array index %d. This is out of bounds "
+            "of the array of facets, which is %d long",
+            indices[ii], facets_size);
+
+         return;
+      }
+   }
+
+   std::vector<InteractionFacet*> created (count, nullptr);
+
+   if (! create_facet_block (facets, factory, params, count, created.data())) {
+      InteractionSurface::allocate_interaction_facets (
+         facets, factory, params, indices, count);
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      AeroFacet* temp_aero_facet = dynamic_cast<AeroFacet*> (created[ii]);
+
+      // The block is owned by the surface, so nothing is released here
+      if (temp_aero_facet == nullptr) {
+
+         MessageHandler::fail (
+            __FILE__, __LINE__, AerodynamicsMessages::initialization_error,
+            "The InteractionFacet created from the Facet found at array "
+            "index %d was not of a type that inherits from AeroFacet. "
+            "This is required",
+            indices[ii]);
+
+         return;
+      }
+
+      aero_facets[indices[ii]] = temp_aero_facet;
+   }
+
+   return;
+
+}
+
+
+/**
+ * Note that facets of the surface articulated. Facets are indexed as in
+ * the SurfaceModel the surface was created from.
+ * \param[in] surface The surface model that articulated
+ * \param[in] changed_facets Indices of the facets that moved
+ */
+
+void
+AeroSurface::facets_articulated (
+   const SurfaceModel & surface JEOD_UNUSED,
+   const std::vector<unsigned int> & changed_facets)
+{
+   if ((! changed_facets.empty()) && (changed_facets.front() < facets_size)) {
+      ++geometry_revision;
+   }
+}
+
 } // End JEOD namespace
 
 /**
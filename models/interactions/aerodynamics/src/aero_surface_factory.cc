@@ -18,6 +18,7 @@ Library dependencies:
     ((aero_surface_factory.cc)
      (aero_params.cc)
      (aerodynamics_messages.cc)
+     (cylinder_aero_factory.cc)
      (flat_plate_aero_factory.cc)
      (flat_plate_thermal_aero_factory.cc)
      (utils/surface_model/src/interaction_surface_factory.cc)
@@ -52,6 +53,7 @@ AeroSurfaceFactory::AeroSurfaceFactory (
    // factories list
    factories.push_back (&flat_plate_aero_factory);
    factories.push_back (&flat_plate_thermal_aero_factory);
+   factories.push_back (&cylinder_aero_factory);
 }
 
 /**
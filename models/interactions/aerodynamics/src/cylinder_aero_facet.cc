@@ -0,0 +1,363 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/src/cylinder_aero_facet.cc
+ * Cylinder facets for use with aero environment interaction models
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+Library dependencies:
+    ((cylinder_aero_facet.cc)
+     (flat_plate_aero_facet.cc)
+     (aerodynamics_messages.cc)
+     (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/surface_model/include/facet.hh"
+
+// Model includes
+#include "../include/cylinder_aero_facet.hh"
+#include "../include/aerodynamics_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Number of Gauss-Legendre nodes used to integrate around the windward half
+ * of the circumference.
+ */
+const unsigned int num_arc_nodes = 16;
+
+/**
+ * Gauss-Legendre nodes and weights over the windward half of the
+ * circumference, expressed as angles from the cross-flow direction.
+ */
+struct ArcQuadrature {
+
+   double cos_psi[num_arc_nodes]; //!< Cosine of each node angle
+   double sin_psi[num_arc_nodes]; //!< Sine of each node angle
+   double weight[num_arc_nodes];  //!< Weight of each node, in radians
+
+   ArcQuadrature ()
+   {
+      for (unsigned int kk = 0; kk < num_arc_nodes; ++kk) {
+         double x = std::cos (M_PI * (kk + 0.75) / (num_arc_nodes + 0.5));
+         double dp = 1.0;
+
+         // Newton iterations on the Legendre polynomial of degree n.
+         for (unsigned int iter = 0; iter < 100; ++iter) {
+            double p0 = 1.0;
+            double p1 = x;
+            for (unsigned int nn = 2; nn <= num_arc_nodes; ++nn) {
+               double p2 = ((2.0 * nn - 1.0) * x * p1 - (nn - 1.0) * p0) / nn;
+               p0 = p1;
+               p1 = p2;
+            }
+            dp = num_arc_nodes * (x * p1 - p0) / (x * x - 1.0);
+            double dx = p1 / dp;
+            x -= dx;
+            if (std::fabs (dx) < 1e-15) {
+               break;
+            }
+         }
+
+         double psi = M_PI_2 * x;
+         cos_psi[kk] = std::cos (psi);
+         sin_psi[kk] = std::sin (psi);
+         weight[kk]  = M_PI_2 * 2.0 / ((1.0 - x * x) * dp * dp);
+      }
+   }
+};
+
+/**
+ * Get the quadrature, built on first use.
+ * @return The quadrature
+ */
+const ArcQuadrature &
+arc_quadrature (
+   void)
+{
+   static const ArcQuadrature quadrature;
+   return quadrature;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Default Constructor
+ */
+
+CylinderAeroFacet::CylinderAeroFacet (
+   void)
+: // Return: -- void
+   radius(0.0),
+   length(0.0)
+{
+   return;
+}
+
+/**
+ * Destructor
+ */
+
+CylinderAeroFacet::~CylinderAeroFacet (
+   void)
+{
+   // empty for now
+
+}
+
+/**
+ * The CylinderAeroFacet specific implementation of aerodynamic drag force.
+ * With a the axis, v the relative velocity direction, w the sine of the
+ * angle between the two, and e the cross-flow direction (the component of
+ * v normal to the axis, normalized), a surface element at angle psi from e
+ * sees the flow at an angle of attack whose sine is w cos(psi). Integrating
+ * the flat plate drag over the windward half of the lateral surface gives
+ * - specular: -q Cs (4/3) r L w^2 e, with no torque about the center;
+ * - diffuse: -q Cd 2 r L w v, with a torque about the center of
+ *   -q Cd (pi/2) r^2 L w (e x v).
+ * The mixed drag blends the two by epsilon, as for the flat plate.
+ * \param[in] rel_vel_mag The magnitude of the relative velocity\n Units: M/s
+ * \param[in] rel_vel_struct_hat The unit vector of the total relative velocity, in the structural frame
+ * \param[in] aero_drag_param_ptr The aerodynamic drag parameters used for drag calculation
+ * \param[in] center_grav The center of gravity of the vehicle, in the structural frame\n Units: M
+ */
+
+void
+CylinderAeroFacet::aerodrag_force (
+   const double rel_vel_mag,
+   const double rel_vel_struct_hat[3],
+   AeroDragParameters* aero_drag_param_ptr,
+   double center_grav[3])
+{
+   double cross_hat[3];     // Cross-flow direction
+   double torque_center[3]; // Torque about the center of the cylinder
+
+   // The base facet's temperature can be updated from dynamically, so copy
+   // that over.
+
+   temperature = base_facet->temperature;
+
+   Vector3::initialize (force);
+   Vector3::initialize (torque);
+   force_n = 0.0;
+   force_t = 0.0;
+
+   // The component of the relative velocity normal to the axis. Flow along
+   // the axis does not reach the lateral surface.
+   Vector3::scale (normal,
+                   Vector3::dot (normal, rel_vel_struct_hat), cross_hat);
+   Vector3::diff (rel_vel_struct_hat, cross_hat, cross_hat);
+   double sin_cross = Vector3::vmag (cross_hat);
+   if (sin_cross <= 0.0) {
+      return;
+   }
+   Vector3::scale (1.0 / sin_cross, cross_hat);
+
+   // consistency check
+   if ((calculate_drag_coef == false) &&
+       (coef_method == AeroDragEnum::Calc_coef)) {
+      MessageHandler::warn (
+         __FILE__, __LINE__,
+         AerodynamicsMessages::runtime_warns,
+         "Must have calculate_drag_coef set to 'true' if \n"
+         "using the calc_coef method of obtaining the drag coefficient.\n"
+         "Resetting the value of calculate_drag_coef.\n");
+      calculate_drag_coef = true;
+   }
+
+   double s = 0.0;
+   if (calculate_drag_coef == true) {
+      s = speed_ratio (rel_vel_mag, *aero_drag_param_ptr);
+
+      switch (coef_method) {
+      case AeroDragEnum::Calc_coef:
+         break;
+      case AeroDragEnum::Specular:
+         drag_coef_spec = specular_drag_coef (s);
+         break;
+      case AeroDragEnum::Diffuse:
+         drag_coef_diff = diffuse_drag_coef (
+            s, temperature / aero_drag_param_ptr->temp_free_stream);
+         break;
+      case AeroDragEnum::Mixed:
+         drag_coef_spec = specular_drag_coef (s);
+         drag_coef_diff = diffuse_drag_coef (
+            s, temperature / aero_drag_param_ptr->temp_free_stream);
+         break;
+      default:
+         MessageHandler::fail (
+            __FILE__, __LINE__, AerodynamicsMessages::runtime_error,
+            "The choice for calculating the coefficients of drag in the "
+            "cylinder model for aerodynamics was invalid. Please supply "
+            "a valid choice.\n");
+      }
+   }
+
+   // force_base is negative because the force is opposite in direction to
+   // all the vectors we know.
+   double force_base = -aero_drag_param_ptr->dynamic_pressure * radius * length;
+   double spec_fraction = 0.0;
+   double diff_fraction = 0.0;
+
+   Vector3::initialize (torque_center);
+
+   switch (coef_method) {
+
+   case AeroDragEnum::Calc_coef:
+   {
+      double local_temp_reflect = (1 - epsilon) * temperature +
+                     epsilon * aero_drag_param_ptr->temp_free_stream;
+      integrate_calculated_drag (
+         s, local_temp_reflect / aero_drag_param_ptr->temp_free_stream,
+         force_base, sin_cross, rel_vel_struct_hat, cross_hat, torque_center);
+      break;
+   }
+
+   case AeroDragEnum::Specular:
+      spec_fraction = 1.0;
+      break;
+
+   case AeroDragEnum::Diffuse:
+      diff_fraction = 1.0;
+      break;
+
+   case AeroDragEnum::Mixed:
+      spec_fraction = epsilon;
+      diff_fraction = 1.0 - epsilon;
+      break;
+
+   default:
+      MessageHandler::fail (
+         __FILE__, __LINE__, AerodynamicsMessages::runtime_error,
+         "The choice for calculating the aerodynamic drag in the "
+         "cylinder model for aerodynamics was invalid. Please supply "
+         "a valid choice.\n");
+   }
+
+   if (coef_method != AeroDragEnum::Calc_coef) {
+      double vec_force_n[3];
+      double vec_force_t[3];
+
+      force_n = spec_fraction * force_base * drag_coef_spec *
+                (4.0 / 3.0) * sin_cross * sin_cross;
+      force_t = diff_fraction * force_base * drag_coef_diff *
+                2.0 * sin_cross;
+
+      Vector3::scale (cross_hat, force_n, vec_force_n);
+      Vector3::scale (rel_vel_struct_hat, force_t, vec_force_t);
+      Vector3::sum (vec_force_t, vec_force_n, force);
+
+      Vector3::cross (cross_hat, rel_vel_struct_hat, torque_center);
+      Vector3::scale (force_t * radius * M_PI_4, torque_center);
+   }
+
+   double cpres[3];
+
+   Vector3::diff (center_pressure, center_grav, cpres);
+   Vector3::copy (torque_center, torque);
+   Vector3::cross_incr (cpres, force, torque);
+   return;
+
+}
+
+/**
+ * Integrate the drag with calculated coefficients over the windward half of
+ * the lateral surface. Each surface element is treated as a flat plate.
+ * \param[in] s The speed ratio
+ * \param[in] temp_ratio Ratio of the reflected to the incident temperature
+ * \param[in] force_base Dynamic pressure times radius times length, negated\n Units: N
+ * \param[in] sin_cross Sine of the angle between the axis and the flow
+ * \param[in] rel_vel_hat The unit vector of the relative velocity
+ * \param[in] cross_hat The cross-flow direction
+ * \param[out] torque_center Torque about the center of the cylinder\n Units: N*m
+ */
+
+void
+CylinderAeroFacet::integrate_calculated_drag (
+   double s,
+   double temp_ratio,
+   double force_base,
+   double sin_cross,
+   const double rel_vel_hat[3],
+   const double cross_hat[3],
+   double torque_center[3])
+{
+   const ArcQuadrature & arc = arc_quadrature ();
+   double side_hat[3];
+   double pressure[3];
+   double shear[3];
+
+   Vector3::cross (normal, cross_hat, side_hat);
+   Vector3::initialize (pressure);
+   Vector3::initialize (shear);
+
+   for (unsigned int kk = 0; kk < num_arc_nodes; ++kk) {
+      double surf_normal[3];
+      double elem_pressure[3];
+      double elem_shear[3];
+      double elem_force[3];
+      double coef_norm;
+      double coef_tang;
+
+      Vector3::scale (cross_hat, arc.cos_psi[kk], surf_normal);
+      Vector3::scale_incr (side_hat, arc.sin_psi[kk], surf_normal);
+
+      double sin_alpha = sin_cross * arc.cos_psi[kk];
+      double elem_base = force_base * arc.weight[kk];
+      calculated_drag_coefs (s, sin_alpha, epsilon, temp_ratio,
+                             coef_norm, coef_tang);
+
+      Vector3::scale (surf_normal, elem_base * coef_norm, elem_pressure);
+
+      Vector3::initialize (elem_shear);
+      double cos_alpha = sqrt (1 - (sin_alpha * sin_alpha));
+      if (cos_alpha > 0.0) {
+         Vector3::scale (surf_normal, sin_alpha, elem_shear);
+         Vector3::diff (rel_vel_hat, elem_shear, elem_shear);
+         Vector3::scale (elem_base * coef_tang / cos_alpha, elem_shear);
+      }
+
+      Vector3::incr (elem_pressure, pressure);
+      Vector3::incr (elem_shear, shear);
+
+      // Pressure acts along the surface normal, so only the shear has a
+      // moment about the center.
+      Vector3::cross (surf_normal, elem_shear, elem_force);
+      Vector3::scale_incr (elem_force, radius, torque_center);
+   }
+
+   Vector3::sum (pressure, shear, force);
+   force_n = Vector3::dot (pressure, cross_hat);
+   force_t = -Vector3::vmag (shear);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
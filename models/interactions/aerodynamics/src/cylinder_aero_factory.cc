@@ -0,0 +1,237 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/src/cylinder_aero_factory.cc
+ * Creates a cylinder aero facet from a basic cylinder facet
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+   ()
+
+Library dependencies:
+   ((cylinder_aero_factory.cc)
+    (aerodynamics_messages.cc)
+    (cylinder_aero_facet.cc)
+    (flat_plate_aero_factory.cc)
+    (flat_plate_aero_params.cc)
+    (utils/message/src/message_handler.cc)
+    (utils/surface_model/src/cylinder.cc)
+    (utils/surface_model/src/cylinder_thermal.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cmath>
+#include <cstddef>
+#include <typeinfo>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/surface_model/include/cylinder.hh"
+#include "utils/surface_model/include/cylinder_thermal.hh"
+#include "utils/surface_model/include/facet.hh"
+#include "utils/surface_model/include/interaction_facet.hh"
+
+// Model includes
+#include "../include/cylinder_aero_factory.hh"
+#include "../include/cylinder_aero_facet.hh"
+#include "../include/flat_plate_aero_params.hh"
+#include "../include/aerodynamics_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Cast a facet that has passed FlatPlateAeroFactory::cast_inputs to a
+ * Cylinder, sending a failure message if it is not one
+ * @return The facet as a Cylinder, or NULL
+ * \param[in] facet The facet
+ */
+Cylinder *
+cast_cylinder (
+   Facet* facet)
+{
+   Cylinder* cylinder = dynamic_cast<Cylinder*> (facet);
+
+   if (cylinder == nullptr) {
+
+      MessageHandler::fail (
+         __FILE__, __LINE__,
+         AerodynamicsMessages::initialization_error,
+         "the Facet supplied to "
+         "CylinderAeroFactory::create_facet was not of type "
+         "Cylinder, as is required");
+   }
+
+   return cylinder;
+}
+
+/**
+ * Fill out the cylinder specific parts of a CylinderAeroFacet. The area is
+ * that of the lateral surface.
+ * \param[in] cylinder The Cylinder
+ * \param[out] inter_facet The CylinderAeroFacet
+ */
+void
+define_cylinder (
+   const Cylinder& cylinder,
+   CylinderAeroFacet& inter_facet)
+{
+   inter_facet.radius = cylinder.radius;
+   inter_facet.length = cylinder.length;
+   inter_facet.area   = 2.0 * M_PI * cylinder.radius * cylinder.length;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Default Constructor
+ */
+
+CylinderAeroFactory::CylinderAeroFactory (
+   void)
+{
+   JEOD_REGISTER_CLASS(CylinderAeroFactory);
+   JEOD_REGISTER_CLASS(CylinderAeroFacet);
+}
+
+/**
+ * Destructor
+ */
+
+CylinderAeroFactory::~CylinderAeroFactory (
+   void)
+{
+
+   // empty for now
+
+}
+
+/**
+ * Create a CylinderAeroFacet from a cylinder facet and a
+ * FlatPlateAeroParams object
+ * @return The new CylinderAeroFacet. Note that this is allocated and YOU are responsible for destroying it at the end!
+ * \param[in] facet The Cylinder. This MUST be a cylinder or the algorithm will send a failure message
+ * \param[in] params FlatPlateAeroParams. This MUST be of the type FlatPlateAeroParams, or the algorithm will send a failure message
+ */
+
+InteractionFacet*
+CylinderAeroFactory::create_facet (
+   Facet* facet,
+   FacetParams* params)
+{
+
+   FlatPlateAeroParams* aero_params = nullptr;
+   FlatPlate* flat_plate            = nullptr;
+
+   if (! cast_inputs (facet, params, flat_plate, aero_params)) {
+      return nullptr;
+   }
+
+   Cylinder* cylinder = cast_cylinder (facet);
+   if (cylinder == nullptr) {
+      return nullptr;
+   }
+
+   // Create the interaction facet
+   CylinderAeroFacet* inter_facet =
+      JEOD_ALLOC_CLASS_OBJECT (CylinderAeroFacet, ());
+
+   define_facet (*flat_plate, *aero_params, *inter_facet);
+   define_cylinder (*cylinder, *inter_facet);
+
+   return inter_facet;
+
+}
+
+/**
+ * Create CylinderAeroFacets from cylinder facets and FlatPlateAeroParams
+ * objects, all in one block
+ * @return The first facet of the block, which is the allocated array, or
+ * NULL if a facet or its parameters are not of the required types
+ * \param[in] facets The Cylinders
+ * \param[in] params The FlatPlateAeroParams for each facet
+ * \param[in] count Number of facets\n Units: cnt
+ * \param[out] inter_facets The CylinderAeroFacet created for each facet
+ */
+
+InteractionFacet*
+CylinderAeroFactory::create_facets (
+   Facet** facets,
+   FacetParams** params,
+   unsigned int count,
+   InteractionFacet** inter_facets)
+{
+
+   FlatPlateAeroParams* aero_params = nullptr;
+   FlatPlate* flat_plate            = nullptr;
+
+   // Check every facet before anything is allocated.
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if ((! cast_inputs (facets[ii], params[ii], flat_plate, aero_params)) ||
+          (cast_cylinder (facets[ii]) == nullptr)) {
+         return nullptr;
+      }
+   }
+
+   if (count == 0) {
+      return nullptr;
+   }
+
+   CylinderAeroFacet* block =
+      JEOD_ALLOC_CLASS_ARRAY (count, CylinderAeroFacet);
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      cast_inputs (facets[ii], params[ii], flat_plate, aero_params);
+      define_facet (*flat_plate, *aero_params, block[ii]);
+      define_cylinder (*cast_cylinder (facets[ii]), block[ii]);
+      inter_facets[ii] = &block[ii];
+   }
+
+   return block;
+
+}
+
+/**
+ * CylinderAeroFactory specific implementation of this function.
+ * If the Facet is of type Cylinder or CylinderThermal, returns true.
+ * False otherwise
+ * @return true if facet is a Cylinder or a CylinderThermal, false otherwise
+ * \param[in] facet The facet to check
+ */
+
+bool
+CylinderAeroFactory::is_correct_factory (
+   Facet* facet)
+{
+
+   if ((typeid(*facet) == typeid(Cylinder)) ||
+       (typeid(*facet) == typeid(CylinderThermal))) {
+      return true;
+   }
+   else {
+      return false;
+   }
+
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,248 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/src/flat_plate_aero_batch.cc
+ * Facet-batched evaluation of flat plate aerodynamic drag
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+Library dependencies:
+    ((flat_plate_aero_batch.cc)
+     (flat_plate_aero_facet.cc)
+     (aero_surface.cc)
+     (aerodynamics_messages.cc)
+     (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <cstddef>
+#include <typeinfo>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/surface_model/include/facet.hh"
+
+// Model includes
+#include "../include/flat_plate_aero_batch.hh"
+#include "../include/flat_plate_aero_facet.hh"
+#include "../include/aero_surface.hh"
+#include "../include/aerodynamics_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default Constructor
+ */
+
+FlatPlateAeroBatch::FlatPlateAeroBatch (
+   void)
+: // Return: -- void
+   built_facets(nullptr),
+   num_facets(0)
+{
+   return;
+}
+
+/**
+ * Destructor
+ */
+
+FlatPlateAeroBatch::~FlatPlateAeroBatch (
+   void)
+{
+   // empty for now
+}
+
+/**
+ * Identify the flat plate facets of the surface. Only the facet types are
+ * cached; plate geometry, temperatures and coefficients are read on every
+ * call since articulation and the thermal model may change them.
+ * \param[in] surface The AeroSurface being evaluated
+ */
+
+void
+FlatPlateAeroBatch::build (
+   AeroSurface & surface)
+{
+   built_facets = surface.aero_facets;
+   num_facets   = surface.facets_size;
+
+   plates.assign (num_facets, nullptr);
+   for (unsigned int ii = 0; ii < num_facets; ++ii) {
+      // Facets derived from the flat plate, such as cylinders, have their
+      // own drag calculation.
+      AeroFacet * facet = surface.aero_facets[ii];
+      if (typeid(*facet) == typeid(FlatPlateAeroFacet)) {
+         plates[ii] = static_cast<FlatPlateAeroFacet *> (facet);
+      }
+   }
+}
+
+/**
+ * Compute the aerodynamic drag on every facet of the surface and sum the
+ * facet forces and torques. On return each facet holds the same results
+ * it would hold after its own aerodrag_force call.
+ * \param[in,out] surface The AeroSurface being evaluated
+ * \param[in] rel_vel_mag The magnitude of the relative velocity\n Units: M/s
+ * \param[in] rel_vel_hat The unit vector of the total relative velocity, in the structural frame
+ * \param[in] aero_drag_param_ptr The aerodynamic drag parameters used for drag calculation
+ * \param[in] center_grav The center of gravity of the vehicle, in the structural frame\n Units: M
+ * \param[out] force Total aerodynamic force, in the structural frame\n Units: N
+ * \param[out] torque Total aerodynamic torque, in the structural frame\n Units: N*m
+ */
+
+void
+FlatPlateAeroBatch::aerodrag_force (
+   AeroSurface & surface,
+   const double rel_vel_mag,
+   const double rel_vel_hat[3],
+   AeroDragParameters * aero_drag_param_ptr,
+   double center_grav[3],
+   double force[3],
+   double torque[3])
+{
+   if ((surface.aero_facets != built_facets) ||
+       (surface.facets_size != num_facets)) {
+      build (surface);
+   }
+
+   // Quantities shared by every plate whose coefficients are calculated.
+   // s is the ratio of the vehicle speed to the most probable molecular
+   // speed; the specular coefficient depends on s alone and the diffuse
+   // coefficient on s and the plate temperature.
+   bool   shared_terms_computed = false;
+   double s            = 0.0;
+   double s_2          = 0.0;
+   double coef_spec_s  = 0.0;
+   double coef_diff_s  = 0.0;
+
+   const double force_base_per_area = -aero_drag_param_ptr->dynamic_pressure;
+   const double vel_x = rel_vel_hat[0];
+   const double vel_y = rel_vel_hat[1];
+   const double vel_z = rel_vel_hat[2];
+
+   Vector3::initialize (force);
+   Vector3::initialize (torque);
+
+   for (unsigned int ii = 0; ii < num_facets; ++ii) {
+      FlatPlateAeroFacet * plate = plates[ii];
+
+      if ((plate == nullptr) ||
+          ((plate->coef_method != AeroDragEnum::Specular) &&
+           (plate->coef_method != AeroDragEnum::Diffuse) &&
+           (plate->coef_method != AeroDragEnum::Mixed))) {
+         AeroFacet * facet = surface.aero_facets[ii];
+         facet->aerodrag_force (rel_vel_mag, rel_vel_hat,
+                                aero_drag_param_ptr, center_grav);
+         Vector3::incr (facet->force, force);
+         Vector3::incr (facet->torque, torque);
+         continue;
+      }
+
+      plate->temperature = plate->base_facet->temperature;
+
+      const double * normal = plate->normal;
+      double sin_alpha = normal[0] * vel_x + normal[1] * vel_y +
+                         normal[2] * vel_z;
+
+      // Leeward plates carry no drag.
+      if (sin_alpha <= 0.0) {
+         Vector3::initialize (plate->force);
+         Vector3::initialize (plate->torque);
+         plate->force_n = 0.0;
+         plate->force_t = 0.0;
+         continue;
+      }
+
+      if (plate->calculate_drag_coef) {
+         if (! shared_terms_computed) {
+            if (std::fpclassify(aero_drag_param_ptr->gas_const) == FP_ZERO ||
+                std::fpclassify(aero_drag_param_ptr->temp_free_stream) ==
+                FP_ZERO) {
+               MessageHandler::fail (
+                  __FILE__, __LINE__, AerodynamicsMessages::runtime_error,
+                  "Either the gas_const or temp_free_stream field(s) of "
+                  "aero_drag_param_ptr was not initialized.  "
+                  "Please initialize both of these values.");
+            }
+            s = rel_vel_mag / sqrt (2.0 * aero_drag_param_ptr->gas_const *
+                                    aero_drag_param_ptr->temp_free_stream);
+            s_2 = s * s;
+            double exp_ssa2 = exp (-s_2);
+            coef_spec_s  = ((2.0 * M_2_SQRTPI) * s * exp_ssa2 +
+                            (2.0 + 4.0 * s_2)) / (s_2);
+            coef_diff_s  = (M_2_SQRTPI)*s * exp_ssa2;
+            shared_terms_computed = true;
+         }
+         if (plate->coef_method != AeroDragEnum::Diffuse) {
+            plate->drag_coef_spec = coef_spec_s;
+         }
+         if (plate->coef_method != AeroDragEnum::Specular) {
+            double temp_ratio = plate->temperature /
+                                aero_drag_param_ptr->temp_free_stream;
+            plate->drag_coef_diff = (coef_diff_s +
+                                     sqrt (temp_ratio) * (2.0 / M_2_SQRTPI) * s +
+                                     (1.0 + 2.0 * s_2)) / (s * s);
+         }
+      }
+
+      double force_base = force_base_per_area * plate->area;
+      double * plate_force = plate->force;
+
+      switch (plate->coef_method) {
+      case AeroDragEnum::Specular:
+         plate->force_n = force_base * plate->drag_coef_spec *
+                          sin_alpha * sin_alpha;
+         Vector3::scale (normal, plate->force_n, plate_force);
+         break;
+
+      case AeroDragEnum::Diffuse:
+         plate->force_t = force_base * plate->drag_coef_diff * sin_alpha;
+         Vector3::scale (rel_vel_hat, plate->force_t, plate_force);
+         break;
+
+      default:
+      {
+         double force_n = plate->epsilon * force_base *
+                          plate->drag_coef_spec * sin_alpha * sin_alpha;
+         double force_t = (1.0 - plate->epsilon) * force_base *
+                          plate->drag_coef_diff * sin_alpha;
+         plate->force_n = force_n;
+         plate->force_t = force_t;
+         plate_force[0] = vel_x * force_t + normal[0] * force_n;
+         plate_force[1] = vel_y * force_t + normal[1] * force_n;
+         plate_force[2] = vel_z * force_t + normal[2] * force_n;
+         break;
+      }
+      }
+
+      double lever[3];
+      Vector3::diff (plate->center_pressure, center_grav, lever);
+      Vector3::cross (lever, plate_force, plate->torque);
+
+      Vector3::incr (plate_force, force);
+      Vector3::incr (plate->torque, torque);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
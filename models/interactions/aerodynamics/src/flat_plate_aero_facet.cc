@@ -138,54 +138,25 @@ FlatPlateAeroFacet::aerodrag_force (
 
    if (calculate_drag_coef == true) {
 
-      if (std::fpclassify(aero_drag_param_ptr->gas_const) == FP_ZERO ||
-          std::fpclassify(aero_drag_param_ptr->temp_free_stream) == FP_ZERO) {
-         MessageHandler::fail (
-            __FILE__, __LINE__, AerodynamicsMessages::runtime_error,
-            "Either the gas_const or temp_free_stream field(s) of "
-            "aero_drag_param_ptr was not initialized.  "
-            "Please initialize both of these values.");
-      }
-
       /* --
       dimensionless parameter equal to the square root of the ratio of the
        vehicle velocity to the mean free-molecular thermal speed (not
        velocity, not relative speed) */
-      double s = rel_vel_mag / sqrt (2.0 * aero_drag_param_ptr->gas_const *
-                              aero_drag_param_ptr->temp_free_stream);
+      double s = speed_ratio (rel_vel_mag, *aero_drag_param_ptr);
 
-      double s_2; // s^2 (see definition of s)
-      double exp_ssa2; // e^(-s_sa2) 
       double temp_ratio; // ratio of the temperature of the reflected molecules to that of the incident molecules
       switch (coef_method) {
 
       case AeroDragEnum::Calc_coef:
       {
-         /* Calculate variables used in coef calcs */
-         // This is an implementation of the coefficient calculations found
-         // in the documentation
-         double one_p_epsilon =  1 + epsilon; /* epsilon is the fraction of incident molecules that "bounce"; this is 1+epsilon */
-         double one_m_epsilon =  1 - epsilon; /* 1-epsilon (see one_p_epsilon)  */
-         s_2           = s * s;
-         double s_sinalpha    = s * sin_alpha;
-         double s_sa2         = s_sinalpha * s_sinalpha;
-         exp_ssa2      = exp (-s_sa2);
-
-         double erf_ssa = erf (s_sinalpha);
-
          // temperature of the reflected molecules
-         double local_temp_reflect = (one_m_epsilon) * temperature +
+         double local_temp_reflect = (1 - epsilon) * temperature +
                         epsilon * aero_drag_param_ptr->temp_free_stream;
-         // ratio of the temperature of the reflected molecules to that of the incident molecules
          temp_ratio = local_temp_reflect / aero_drag_param_ptr->temp_free_stream;
 
-
-         drag_coef_norm = (
-            (M_2_SQRTPI * one_p_epsilon) * s_sinalpha * exp_ssa2 +
-            one_m_epsilon * sqrt (temp_ratio) *
-            (2.0 / M_2_SQRTPI) * s_sinalpha +
-            one_p_epsilon * (1.0 + 2.0 * s_sa2) * erf_ssa) /
-                          (s_2);
+         double coef_tang;
+         calculated_drag_coefs (s, sin_alpha, epsilon, temp_ratio,
+                                drag_coef_norm, coef_tang);
 
          // if plate is full-on (alpha = 90 degrees), there is no tangential drag
          if (!Numerical::compare_exact(sin_alpha,1)) {
@@ -195,57 +166,28 @@ FlatPlateAeroFacet::aerodrag_force (
             double cos_a_inv = 1 / cos_alpha;
             Vector3::scale (cos_a_inv, tangent);
 
-            drag_coef_tang = fabs (
-               (2.0 * one_m_epsilon / (2.0 / M_2_SQRTPI)) * s *
-               cos_alpha * (exp (-s_sinalpha * s_sinalpha) +
-                            (2.0 / M_2_SQRTPI) * s_sinalpha *
-                            erf (s_sinalpha))) / (s * s);
-            // Note that fabs was added to the equation because direction is
-            // accounted for later
+            drag_coef_tang = coef_tang;
          }
          break;
       }
       case AeroDragEnum::Specular:
       {
          // assumes all molecules "bounce" from the plate
-
-         // Calculate the drag coef
-         // assumes angle of attack = 90 degrees for unknown reason, therefore
-         // s_sinalpha = s
-         // assumes epsilon = 1; so 1+epsilon =2; 1-epsilon = 0; 2*(1+epsilon)=4
-         s_2            = s * s;
-         exp_ssa2       = exp (-s_2);
-         drag_coef_spec = ((2.0 * M_2_SQRTPI) * s * exp_ssa2 +
-                           (2.0 + 4.0 * s_2)) / (s_2);
+         drag_coef_spec = specular_drag_coef (s);
          break;
       }
       case AeroDragEnum::Diffuse:
       {
-         // Calculate the drag coef
-         // assumes angle of attack = 90 degrees for unknown reason, therefore
-         // s_sinalpha = s
-         // assumes epsilon = 0; so 1+epsilon = 1-epsilon = 1; 2*(1+epsilon) = 4
-         s_2      = s * s;
-         exp_ssa2 = exp (-s_2);
-
          /* Assume the temperature of reflected molecules */
          temp_ratio = temperature / aero_drag_param_ptr->temp_free_stream;
-
-         drag_coef_diff = ((M_2_SQRTPI)*s * exp_ssa2 +
-                           sqrt (temp_ratio) * (2.0 / M_2_SQRTPI) * s +
-                           (1.0 + 2.0 * s_2)) / (s * s);
+         drag_coef_diff = diffuse_drag_coef (s, temp_ratio);
          break;
       }
       case AeroDragEnum::Mixed:
       {
-         s_2            = s * s;
-         exp_ssa2       = exp (-s_2);
-         drag_coef_spec = ((2.0 * M_2_SQRTPI) * s * exp_ssa2 +
-                           (2.0 + 4.0 * s_2)) / (s_2);
+         drag_coef_spec = specular_drag_coef (s);
          temp_ratio     = temperature / aero_drag_param_ptr->temp_free_stream;
-         drag_coef_diff = ((M_2_SQRTPI)*s * exp_ssa2 +
-                           sqrt (temp_ratio) * (2.0 / M_2_SQRTPI) * s +
-                           (1.0 + 2.0 * s_2)) / (s * s);
+         drag_coef_diff = diffuse_drag_coef (s, temp_ratio);
          break;
       }
       default:
@@ -356,6 +298,122 @@ FlatPlateAeroFacet::aerodrag_force (
 
 }
 
+/**
+ * Compute the speed ratio used by the free-molecular drag coefficients,
+ * sending a failure message if the gas parameters were not set.
+ * @return The ratio of the relative speed to the most probable molecular
+ * speed of the free stream
+ * \param[in] rel_vel_mag The magnitude of the relative velocity\n Units: M/s
+ * \param[in] aero_drag_param The aerodynamic drag parameters
+ */
+
+double
+FlatPlateAeroFacet::speed_ratio (
+   const double rel_vel_mag,
+   const AeroDragParameters & aero_drag_param)
+{
+   if (std::fpclassify(aero_drag_param.gas_const) == FP_ZERO ||
+       std::fpclassify(aero_drag_param.temp_free_stream) == FP_ZERO) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, AerodynamicsMessages::runtime_error,
+         "Either the gas_const or temp_free_stream field(s) of "
+         "aero_drag_param_ptr was not initialized.  "
+         "Please initialize both of these values.");
+   }
+
+   return rel_vel_mag / sqrt (2.0 * aero_drag_param.gas_const *
+                              aero_drag_param.temp_free_stream);
+}
+
+/**
+ * Compute the drag coefficient of a plate from which all molecules
+ * "bounce". The coefficient assumes an angle of attack of 90 degrees;
+ * the angle is accounted for when the force is computed.
+ * @return The specular drag coefficient
+ * \param[in] s The speed ratio
+ */
+
+double
+FlatPlateAeroFacet::specular_drag_coef (
+   const double s)
+{
+   // s_sinalpha = s; epsilon = 1, so 1+epsilon = 2, 1-epsilon = 0
+   double s_2      = s * s;
+   double exp_ssa2 = exp (-s_2);
+
+   return ((2.0 * M_2_SQRTPI) * s * exp_ssa2 +
+           (2.0 + 4.0 * s_2)) / (s_2);
+}
+
+/**
+ * Compute the drag coefficient of a plate to which all molecules
+ * "stick". The coefficient assumes an angle of attack of 90 degrees;
+ * the angle is accounted for when the force is computed.
+ * @return The diffuse drag coefficient
+ * \param[in] s The speed ratio
+ * \param[in] temp_ratio Ratio of the reflected to the incident temperature
+ */
+
+double
+FlatPlateAeroFacet::diffuse_drag_coef (
+   const double s,
+   const double temp_ratio)
+{
+   // s_sinalpha = s; epsilon = 0, so 1+epsilon = 1-epsilon = 1
+   double s_2      = s * s;
+   double exp_ssa2 = exp (-s_2);
+
+   return ((M_2_SQRTPI)*s * exp_ssa2 +
+           sqrt (temp_ratio) * (2.0 / M_2_SQRTPI) * s +
+           (1.0 + 2.0 * s_2)) / (s * s);
+}
+
+/**
+ * Compute the normal and tangential drag coefficients of a plate at a
+ * given angle of attack. This is an implementation of the coefficient
+ * calculations found in the documentation.
+ * \param[in] s The speed ratio
+ * \param[in] sin_alpha Sine of the angle of attack
+ * \param[in] epsilon Fraction of molecules that "bounce"
+ * \param[in] temp_ratio Ratio of the reflected to the incident temperature
+ * \param[out] coef_norm Coefficient of the drag normal to the plate
+ * \param[out] coef_tang Coefficient of the drag tangential to the plate
+ */
+
+void
+FlatPlateAeroFacet::calculated_drag_coefs (
+   const double s,
+   const double sin_alpha,
+   const double epsilon,
+   const double temp_ratio,
+   double & coef_norm,
+   double & coef_tang)
+{
+   double one_p_epsilon = 1 + epsilon; /* epsilon is the fraction of incident molecules that "bounce"; this is 1+epsilon */
+   double one_m_epsilon = 1 - epsilon; /* 1-epsilon (see one_p_epsilon)  */
+   double s_2           = s * s;
+   double s_sinalpha    = s * sin_alpha;
+   double s_sa2         = s_sinalpha * s_sinalpha;
+   double exp_ssa2      = exp (-s_sa2);
+   double erf_ssa       = erf (s_sinalpha);
+   double cos_alpha     = sqrt (1 - (sin_alpha * sin_alpha));
+
+   coef_norm = (
+      (M_2_SQRTPI * one_p_epsilon) * s_sinalpha * exp_ssa2 +
+      one_m_epsilon * sqrt (temp_ratio) *
+      (2.0 / M_2_SQRTPI) * s_sinalpha +
+      one_p_epsilon * (1.0 + 2.0 * s_sa2) * erf_ssa) /
+                    (s_2);
+
+   // Note that fabs was added to the equation because direction is
+   // accounted for later
+   coef_tang = fabs (
+      (2.0 * one_m_epsilon / (2.0 / M_2_SQRTPI)) * s *
+      cos_alpha * (exp_ssa2 +
+                   (2.0 / M_2_SQRTPI) * s_sinalpha *
+                   erf_ssa)) / (s * s);
+}
+
 } // End JEOD namespace
 
 /**
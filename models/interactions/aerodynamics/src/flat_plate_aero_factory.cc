@@ -24,6 +24,7 @@ Library dependencies:
     (utils/surface_model/src/facet.cc)
     (utils/surface_model/src/facet_params.cc)
     (utils/surface_model/src/flat_plate.cc)
+    (utils/surface_model/src/flat_plate_circular.cc)
     (utils/surface_model/src/interaction_facet_factory.cc))
 
 
@@ -31,6 +32,7 @@ Library dependencies:
 
 
 // System includes
+#include <cmath>
 #include <cstddef>
 #include <typeinfo>
 
@@ -38,6 +40,7 @@ Library dependencies:
 #include "utils/math/include/vector3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/surface_model/include/flat_plate.hh"
+#include "utils/surface_model/include/flat_plate_circular.hh"
 #include "utils/surface_model/include/facet.hh"
 #include "utils/surface_model/include/interaction_facet.hh"
 
@@ -91,6 +94,84 @@ FlatPlateAeroFactory::create_facet (
    FlatPlateAeroParams* aero_params = nullptr;
    FlatPlate* flat_plate            = nullptr;
 
+   if (! cast_inputs (facet, params, flat_plate, aero_params)) {
+      return nullptr;
+   }
+
+   // Create the interaction facet
+   FlatPlateAeroFacet* inter_facet =
+      JEOD_ALLOC_CLASS_OBJECT (FlatPlateAeroFacet, ());
+
+   define_facet (*flat_plate, *aero_params, *inter_facet);
+
+   return inter_facet;
+
+}
+
+/**
+ * Create FlatPlateAeroFacets from flat plate facets and FlatPlateAeroParams
+ * objects, all in one block
+ * @return The first facet of the block, which is the allocated array, or
+ * NULL if a facet or its parameters are not of the required types
+ * \param[in] facets The FlatPlates
+ * \param[in] params The FlatPlateAeroParams for each facet
+ * \param[in] count Number of facets\n Units: cnt
+ * \param[out] inter_facets The FlatPlateAeroFacet created for each facet
+ */
+
+InteractionFacet*
+FlatPlateAeroFactory::create_facets (
+   Facet** facets,
+   FacetParams** params,
+   unsigned int count,
+   InteractionFacet** inter_facets)
+{
+
+   FlatPlateAeroParams* aero_params = nullptr;
+   FlatPlate* flat_plate            = nullptr;
+
+   // Check every facet before anything is allocated.
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if (! cast_inputs (facets[ii], params[ii], flat_plate, aero_params)) {
+         return nullptr;
+      }
+   }
+
+   if (count == 0) {
+      return nullptr;
+   }
+
+   FlatPlateAeroFacet* block =
+      JEOD_ALLOC_CLASS_ARRAY (count, FlatPlateAeroFacet);
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      cast_inputs (facets[ii], params[ii], flat_plate, aero_params);
+      define_facet (*flat_plate, *aero_params, block[ii]);
+      inter_facets[ii] = &block[ii];
+   }
+
+   return block;
+
+}
+
+/**
+ * Cast a facet and its parameters to the types this factory requires,
+ * sending a failure message if they are not of those types
+ * @return True if both were of the required types
+ * \param[in] facet The facet, which must be a FlatPlate
+ * \param[in] params The parameters, which must be FlatPlateAeroParams
+ * \param[out] flat_plate The facet as a FlatPlate
+ * \param[out] aero_params The parameters as FlatPlateAeroParams
+ */
+
+bool
+FlatPlateAeroFactory::cast_inputs (
+   Facet* facet,
+   FacetParams* params,
+   FlatPlate*& flat_plate,
+   FlatPlateAeroParams*& aero_params)
+{
+
    aero_params = dynamic_cast<FlatPlateAeroParams*> (params);
    flat_plate  = dynamic_cast<FlatPlate*> (facet);
 
@@ -106,7 +187,7 @@ FlatPlateAeroFactory::create_facet (
          "FlatPlateAeroFactory::create_facet, named (%s), "
          "was not of type "
          "FlatPlateAeroParams.", params->name.c_str());
-      return nullptr;
+      return false;
    }
    if (flat_plate == nullptr) {
 
@@ -116,41 +197,60 @@ FlatPlateAeroFactory::create_facet (
          "the Facet supplied to "
          "FlatPlateAeroFactory::create_facet was not of type "
          "FlatPlate, as is required");
-      return nullptr;
+      return false;
    }
 
-   // Create the interaction facet
-   FlatPlateAeroFacet* inter_facet =
-      JEOD_ALLOC_CLASS_OBJECT (FlatPlateAeroFacet, ());
-
-
-   // Fill it out from the parameters and from the facet itself
-   inter_facet->base_facet = facet;
+   return true;
 
-   inter_facet->coef_method         = aero_params->coef_method;  
-   inter_facet->calculate_drag_coef = aero_params->calculate_drag_coef;
-   inter_facet->epsilon             = aero_params->epsilon;
-   inter_facet->temp_reflect        = aero_params->temp_reflect;
-   inter_facet->drag_coef_norm      = aero_params->drag_coef_norm; 
-   inter_facet->drag_coef_tang      = aero_params->drag_coef_tang; 
-   inter_facet->drag_coef_spec      = aero_params->drag_coef_spec;
-   inter_facet->drag_coef_diff      = aero_params->drag_coef_diff;
-
-   inter_facet->temperature = facet->temperature;
+}
 
-   inter_facet->normal = flat_plate->normal;  
-   inter_facet->center_pressure = flat_plate->position;
+/**
+ * Fill out a FlatPlateAeroFacet from its flat plate and parameters
+ * \param[in] flat_plate The FlatPlate
+ * \param[in] aero_params The FlatPlateAeroParams
+ * \param[out] inter_facet The FlatPlateAeroFacet
+ */
 
-   inter_facet->area = flat_plate->area;
+void
+FlatPlateAeroFactory::define_facet (
+   FlatPlate& flat_plate,
+   FlatPlateAeroParams& aero_params,
+   FlatPlateAeroFacet& inter_facet)
+{
 
-   return inter_facet;
+   // Fill it out from the parameters and from the facet itself
+   inter_facet.base_facet = &flat_plate;
+
+   inter_facet.coef_method         = aero_params.coef_method;
+   inter_facet.calculate_drag_coef = aero_params.calculate_drag_coef;
+   inter_facet.epsilon             = aero_params.epsilon;
+   inter_facet.temp_reflect        = aero_params.temp_reflect;
+   inter_facet.drag_coef_norm      = aero_params.drag_coef_norm;
+   inter_facet.drag_coef_tang      = aero_params.drag_coef_tang;
+   inter_facet.drag_coef_spec      = aero_params.drag_coef_spec;
+   inter_facet.drag_coef_diff      = aero_params.drag_coef_diff;
+
+   inter_facet.temperature = flat_plate.temperature;
+
+   inter_facet.normal = flat_plate.normal;
+   inter_facet.center_pressure = flat_plate.position;
+
+   // A circular plate's area follows from its radius.
+   FlatPlateCircular* circular = dynamic_cast<FlatPlateCircular*> (&flat_plate);
+   if ((circular != nullptr) && (circular->radius > 0.0)) {
+      inter_facet.area = M_PI * circular->radius * circular->radius;
+   }
+   else {
+      inter_facet.area = flat_plate.area;
+   }
 
 }
 
 /**
  * FlatPlateAeroFactory specific implementation of this function.
- * If the Facet is of type FlatPlate, returns true. False otherwise
- * @return true if facet is a FlatPlate, false otherwise
+ * If the Facet is of type FlatPlate or FlatPlateCircular, returns true.
+ * False otherwise
+ * @return true if facet is a FlatPlate or a FlatPlateCircular, false otherwise
  * \param[in] facet The facet to check
  */
 
@@ -159,7 +259,8 @@ FlatPlateAeroFactory::is_correct_factory (
    Facet* facet)
 {
 
-   if (typeid(*facet) == typeid(FlatPlate)) {
+   if ((typeid(*facet) == typeid(FlatPlate)) ||
+       (typeid(*facet) == typeid(FlatPlateCircular))) {
       return true;
    }
    else {
@@ -70,8 +70,13 @@
 namespace jeod {
 
 class Contact;
+class ContactBatch;
+class ContactBroadPhase;
 class ContactFacet;
+class ContactForceBlock;
+class ContactNarrowPhase;
 class ContactPair;
+class ContactRelStateCache;
 class ContactSurface;
 class ContactSurfaceFactory;
 class ContactMessages;
@@ -69,6 +69,8 @@
 
 // System includes
 #include <list>
+#include <map>
+#include <utility>
 
 /* JEOD includes */
 #include "dynamics/dyn_manager/include/class_declarations.hh"
@@ -77,8 +79,12 @@
 
 // Model includes
 #include "class_declarations.hh"
+#include "contact_batch.hh"
+#include "contact_broad_phase.hh"
 #include "contact_facet.hh"
+#include "contact_narrow_phase.hh"
 #include "contact_pair.hh"
+#include "contact_rel_state_cache.hh"
 #include "pair_interaction.hh"
 
 //! Namespace jeod
@@ -103,6 +109,76 @@ public:
     */
    double contact_limit_factor; //!< trick_units(--)
 
+   /**
+    * toggles the sweep-and-prune broad phase that culls pairs whose facet
+    * bounding spheres are apart before the range test, true=on false=off.
+    * Culled pairs do not update their relative state.
+    */
+   bool broad_phase_culling; //!< trick_units(--)
+
+   /**
+    * toggles sharing of one relative state computation among all pairs whose
+    * facets sit on the same two frames, true=on false=off. The shared states
+    * agree with the per-pair tree walk to rounding level only, so this is
+    * off by default.
+    */
+   bool share_relative_states; //!< trick_units(--)
+
+   /**
+    * number of threads used to evaluate the in-range pairs. Pairs that share
+    * a facet are always evaluated by the same thread, in list order, so the
+    * forces do not depend on this setting. Values below 2 evaluate serially.
+    */
+   unsigned int narrow_phase_threads; //!< trick_units(count)
+
+   /**
+    * toggles batched evaluation of the contacts found by the in-range pairs
+    * when they are evaluated serially, true=on false=off. The contacts that
+    * share an interaction are passed to its batch kernel together; the
+    * forces are still applied in pair list order.
+    */
+   bool batch_interactions; //!< trick_units(--)
+
+   /**
+    * toggles prediction of the time to impact of the in-range pairs and
+    * the resulting integration step hint, true=on false=off. A pair is only
+    * predicted once it is in range, so contact_limit_factor must leave a
+    * gap that the fastest closing pair cannot cross in one integration
+    * cycle.
+    */
+   bool continuous_detection; //!< trick_units(--)
+
+   /**
+    * fraction of the predicted time to impact used as the step hint.
+    */
+   double impact_step_fraction; //!< trick_units(--)
+
+   /**
+    * step hint used while facet bounding spheres touch, and the smallest
+    * hint ever produced. Zero leaves the step unconstrained in contact.
+    */
+   double contact_step; //!< trick_units(s)
+
+   /**
+    * integration group whose max_step_hint is set from max_step_hint on
+    * every check; the multirate scheduler then subdivides only the cycles
+    * that approach or are in contact. Optional.
+    */
+   DynamicsIntegrationGroup * step_hint_group; //!< trick_units(--)
+
+   /**
+    * smallest predicted time to impact over the in-range pairs at the last
+    * check, zero if some pair's facet bounding spheres touch, or negative
+    * if no in-range pair is closing.
+    */
+   double time_to_impact; //!< trick_units(s)
+
+   /**
+    * largest integration step recommended by the last check, zero if
+    * unconstrained.
+    */
+   double max_step_hint; //!< trick_units(s)
+
    // constructor
    Contact ();
 
@@ -150,6 +226,11 @@ public:
     */
    void check_contact ();
 
+   /*
+    Derive the integration step hint from the predicted time to impact.
+    */
+   void update_step_hint ();
+
 protected:
    /**
     * Pointer to the dyn_manager so relstates and be successfully initialized.
@@ -167,6 +248,33 @@ protected:
     */
    JeodPointerList<PairInteraction>::type pair_interactions; //!< trick_io(**)
 
+   /**
+    * interaction resolved for each pair of contact params looked up so far,
+    * null if none matches. Cleared when an interaction is registered.
+    */
+   std::map<std::pair<const ContactParams *, const ContactParams *>,
+            PairInteraction *> interaction_table; //!< trick_io(**)
+
+   /**
+    * broad phase used to cull contact pairs before the range test.
+    */
+   ContactBroadPhase broad_phase; //!< trick_units(--)
+
+   /**
+    * per-check cache of the relative states between facet frames.
+    */
+   ContactRelStateCache rel_state_cache; //!< trick_units(--)
+
+   /**
+    * narrow phase used to evaluate the in-range pairs on several threads.
+    */
+   ContactNarrowPhase narrow_phase; //!< trick_units(--)
+
+   /**
+    * batch that collects the contacts of the serially evaluated pairs.
+    */
+   ContactBatch batch; //!< trick_units(--)
+
 
 private:
    /* Operator = and copy constructor hidden from use by being private */
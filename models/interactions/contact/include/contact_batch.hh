@@ -0,0 +1,239 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/include/contact_batch.hh
+ * Batched evaluation of the contact forces of a contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((The facets and relative states of the added contacts are not changed
+       between add and evaluate other than by the pairs that are added.))
+
+ Library dependencies:
+    ((../src/contact_batch.cc))
+
+
+
+*****************************************************************************/
+
+#ifndef CONTACT_BATCH_HH
+#define CONTACT_BATCH_HH
+
+// System includes
+#include <vector>
+
+/* JEOD includes */
+#include "dynamics/derived_state/include/class_declarations.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Packed contact geometry and forces of the contacts that share one pair
+ * interaction, one array per vector component, as passed to
+ * PairInteraction::calculate_batch_forces. All vectors are expressed in the
+ * subject facet frame.
+ */
+class ContactForceBlock {
+
+   JEOD_MAKE_SIM_INTERFACES(ContactForceBlock)
+
+public:
+
+   /**
+    * Number of contacts in the block.
+    */
+   unsigned int count; //!< trick_units(count)
+
+   /**
+    * Components of the vectors that characterise the interpenetration.
+    * The kernel may zero small components in place.
+    */
+   double * penetration[3]; //!< trick_io(**)
+
+   /**
+    * Components of the relative velocities of the targets.
+    */
+   const double * rel_velocity[3]; //!< trick_io(**)
+
+   /**
+    * Components of the forces on the subjects, set by the kernel.
+    */
+   double * force[3]; //!< trick_io(**)
+};
+
+
+/**
+ * Collects the contacts found by the in-range pairs of one contact check and
+ * evaluates their forces together. The contacts that share a pair
+ * interaction are packed into one ContactForceBlock and passed to the
+ * interaction's batch kernel; contacts whose interaction has no batch kernel
+ * are evaluated with calculate_forces. The resulting forces are then applied
+ * to the facets in the order the contacts were added, with each facet's
+ * contact point restored first, so every facet sees the contributions the
+ * unbatched pairs would give it, in the same order.
+ */
+class ContactBatch {
+
+   JEOD_MAKE_SIM_INTERFACES(ContactBatch)
+
+public:
+
+   // constructor
+   ContactBatch ();
+
+   // destructor
+   ~ContactBatch ();
+
+   // Discard the contacts added since the last evaluation.
+   void clear ();
+
+   // Add a contact found by a pair.
+   void add (
+      PairInteraction * interaction,
+      ContactFacet * subject,
+      ContactFacet * target,
+      RelativeDerivedState * rel_state,
+      const double * penetration_vector,
+      const double * rel_velocity);
+
+   // Evaluate and apply the forces of the added contacts, then clear.
+   void evaluate ();
+
+   /**
+    * Number of contacts added since the last evaluation.
+    * @return Contact count
+    */
+   unsigned int size () const
+   {
+      return static_cast<unsigned int> (entries.size());
+   }
+
+protected:
+
+   /**
+    * A contact found by a pair.
+    */
+   struct Entry {
+      PairInteraction * interaction;  //!< trick_io(**)
+      ContactFacet * subject;         //!< trick_io(**)
+      ContactFacet * target;          //!< trick_io(**)
+      RelativeDerivedState * rel_state; //!< trick_io(**)
+      double subject_point[3];        //!< trick_io(**)
+      double target_point[3];         //!< trick_io(**)
+      double penetration[3];          //!< trick_io(**)
+      double rel_velocity[3];         //!< trick_io(**)
+      double force[3];                //!< trick_io(**)
+      bool has_force;                 //!< trick_io(**)
+   };
+
+   // Restore the contact point saved for a facet.
+   static void restore_point (ContactFacet * facet, const double point[3]);
+
+   /**
+    * Contacts added since the last evaluation, in pair list order.
+    */
+   std::vector<Entry> entries; //!< trick_io(**)
+
+   /**
+    * Distinct interactions of the added contacts, in order of first use.
+    */
+   std::vector<PairInteraction *> interactions; //!< trick_io(**)
+
+   /**
+    * Index in interactions of each entry's interaction.
+    */
+   std::vector<unsigned int> entry_group; //!< trick_io(**)
+
+   /**
+    * Offset of each interaction's entries in grouped, plus a final end
+    * offset.
+    */
+   std::vector<unsigned int> group_start; //!< trick_io(**)
+
+   /**
+    * Next free slot of each interaction in grouped while grouping.
+    */
+   std::vector<unsigned int> group_fill; //!< trick_io(**)
+
+   /**
+    * Entry indices ordered by interaction.
+    */
+   std::vector<unsigned int> grouped; //!< trick_io(**)
+
+   /**
+    * Packed component arrays of one interaction's contacts: nine arrays of
+    * the block size, for the penetration, velocity, and force components.
+    */
+   std::vector<double> packed; //!< trick_io(**)
+
+private:
+   /* Operator = and copy constructor hidden from use by being private */
+
+   ContactBatch& operator = (const ContactBatch& rhs);
+   ContactBatch (const ContactBatch& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
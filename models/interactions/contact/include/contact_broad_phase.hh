@@ -0,0 +1,241 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/include/contact_broad_phase.hh
+ * Broad-phase culling of contact pairs for use with contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((Each facet is bounded by a sphere of radius max_dimension times the
+       contact limit factor, centered on the facet vehicle point.)
+      (Pairs whose interaction distance is zero or exceeds the sum of the
+       facet sphere radii are never culled.))
+
+ Library dependencies:
+    ((../src/contact_broad_phase.cc))
+
+
+
+*****************************************************************************/
+
+#ifndef CONTACT_BROAD_PHASE_HH
+#define CONTACT_BROAD_PHASE_HH
+
+// System includes
+#include <cstddef>
+#include <vector>
+
+/* JEOD includes */
+#include "utils/container/include/pointer_list.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+class RefFrame;
+
+/**
+ * Sweep-and-prune broad phase for the contact pairs of a Contact object.
+ * Each update locates every registered facet in the root frame of the
+ * facet tree and sweeps the facet bounding spheres along the coordinate
+ * axis of largest spread. Only pairs whose spheres overlap are flagged as
+ * candidates for the narrow-phase range test.
+ */
+class ContactBroadPhase {
+
+   JEOD_MAKE_SIM_INTERFACES(ContactBroadPhase)
+
+public:
+
+   // constructor
+   ContactBroadPhase ();
+
+   // destructor
+   ~ContactBroadPhase ();
+
+   // Index the facets and pairs of a contact pair list.
+   void build (
+      const JeodPointerList<ContactPair>::type & pairs,
+      double contact_limit_factor);
+
+   // Determine whether the broad phase was built for a contact pair list.
+   bool is_built_for (
+      const JeodPointerList<ContactPair>::type & pairs,
+      double contact_limit_factor) const;
+
+   // Force a rebuild on next use.
+   void invalidate ();
+
+   // Flag the candidate pairs for the current facet positions.
+   void update ();
+
+   /**
+    * Indicate whether a pair is a candidate for the range test.
+    * @return True if the pair may be in range
+    * \param[in] pair_index Position of the pair in the contact pair list
+    */
+   bool is_candidate (std::size_t pair_index) const
+   {
+      return candidate[pair_index] != 0;
+   }
+
+   /**
+    * Number of candidate pairs flagged by the last update.
+    * @return Candidate count
+    */
+   unsigned int get_num_candidates () const
+   {
+      return num_candidates;
+   }
+
+protected:
+
+   /**
+    * Number of pairs in the contact pair list that was indexed.
+    */
+   std::size_t num_pairs; //!< trick_units(count)
+
+   /**
+    * Contact limit factor used to size the facet spheres.
+    */
+   double limit_factor; //!< trick_units(--)
+
+   /**
+    * Number of candidate pairs flagged by the last update.
+    */
+   unsigned int num_candidates; //!< trick_units(count)
+
+   /**
+    * Coordinate axis used by the last sweep, or -1 before the first sweep.
+    */
+   int sweep_axis; //!< trick_units(--)
+
+   /**
+    * Set once the broad phase has been built.
+    */
+   bool built; //!< trick_units(--)
+
+   /**
+    * Facets referenced by the complete pairs.
+    */
+   std::vector<ContactFacet *> facets; //!< trick_io(**)
+
+   /**
+    * Bounding sphere radius of each facet.
+    */
+   std::vector<double> radius; //!< trick_io(**)
+
+   /**
+    * Position of each facet in the root frame, three entries per facet.
+    */
+   std::vector<double> center; //!< trick_io(**)
+
+   /**
+    * Facet indices ordered by the lower sphere bound along the sweep axis.
+    */
+   std::vector<unsigned int> sweep_order; //!< trick_io(**)
+
+   /**
+    * Facets whose spheres overlap the current sweep position.
+    */
+   std::vector<unsigned int> open_facets; //!< trick_io(**)
+
+   /**
+    * Sorted keys (lower and upper facet index) of the cullable pairs.
+    */
+   std::vector<unsigned long long> pair_keys; //!< trick_io(**)
+
+   /**
+    * Pair list position corresponding to each key.
+    */
+   std::vector<std::size_t> pair_index; //!< trick_io(**)
+
+   /**
+    * Pair list positions of the pairs that are never culled.
+    */
+   std::vector<std::size_t> always_checked; //!< trick_io(**)
+
+   /**
+    * Candidate flag of each pair in the contact pair list.
+    */
+   std::vector<unsigned char> candidate; //!< trick_io(**)
+
+   /**
+    * Pairs of the indexed list, in list order. Used to detect a list that
+    * has been replaced, e.g. on restart, without changing size.
+    */
+   std::vector<const ContactPair *> pair_snapshot; //!< trick_io(**)
+
+   /**
+    * Frame in which facet positions are compared.
+    */
+   const RefFrame * root_frame; //!< trick_units(--)
+
+private:
+   /* Operator = and copy constructor hidden from use by being private */
+
+   ContactBroadPhase& operator = (const ContactBroadPhase& rhs);
+   ContactBroadPhase (const ContactBroadPhase& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
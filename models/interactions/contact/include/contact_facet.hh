@@ -152,6 +152,18 @@ public:
       double *tmp_force) // In: N force from one contact interaction.
    = 0;
 
+   /**
+    Access the point about which calculate_torque applies a force, if the
+    facet keeps one. A ContactBatch saves it when an evaluation is deferred
+    and restores it before the force is applied.
+    @return Contact point in the facet frame, or null
+    */
+   virtual double * get_contact_point (
+      void)
+   {
+      return nullptr;
+   }
+
    /**
     Overloaded functions that create a ContactPair and pass the address
     of it to the Contact class for addition to the list of pairs.
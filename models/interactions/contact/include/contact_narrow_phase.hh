@@ -0,0 +1,212 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/include/contact_narrow_phase.hh
+ * Parallel evaluation of the in-range pairs of a contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((ContactPair::in_contact modifies only the two facets of the pair and
+       the pair's interaction.)
+      (Interactions that do not report themselves as thread safe are
+       evaluated by one thread.))
+
+ Library dependencies:
+    ((../src/contact_narrow_phase.cc))
+
+
+
+*****************************************************************************/
+
+#ifndef CONTACT_NARROW_PHASE_HH
+#define CONTACT_NARROW_PHASE_HH
+
+// System includes
+#include <map>
+#include <vector>
+
+/* JEOD includes */
+#include "dynamics/dyn_manager/include/class_declarations.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Narrow phase for the contact pairs of a Contact object.
+ * The pairs that pass the range test are partitioned into independent
+ * groups: two pairs belong to the same group if they share a facet, or
+ * share an interaction that is not thread safe. Facet contact points and
+ * force and torque accumulators are therefore touched by one group only.
+ * The groups are evaluated in parallel, each group in contact pair list
+ * order, so every facet sees exactly the sequence of contributions that the
+ * serial loop would give it and the results do not depend on the thread
+ * count.
+ */
+class ContactNarrowPhase {
+
+   JEOD_MAKE_SIM_INTERFACES(ContactNarrowPhase)
+
+public:
+
+   // constructor
+   ContactNarrowPhase ();
+
+   // destructor
+   ~ContactNarrowPhase ();
+
+   // Empty the list of pairs to be evaluated.
+   void clear ();
+
+   /**
+    * Append an in-range pair to the pairs to be evaluated.
+    * Pairs must be added in contact pair list order.
+    * \param[in] pair Contact pair that passed the range test
+    */
+   void add_pair (ContactPair * pair)
+   {
+      pairs.push_back (pair);
+   }
+
+   // Evaluate the added pairs.
+   void evaluate (unsigned int num_threads);
+
+   /**
+    * Number of independent groups formed by the last evaluation.
+    * @return Group count
+    */
+   unsigned int get_num_groups () const
+   {
+      return num_groups;
+   }
+
+protected:
+
+   // Partition the added pairs into independent groups.
+   void form_groups ();
+
+   // Find the representative of a union-find node.
+   unsigned int find_root (unsigned int node);
+
+   // Obtain the union-find node for an object touched by a pair.
+   unsigned int node_for (const void * object);
+
+   /**
+    * Number of independent groups formed by the last evaluation.
+    */
+   unsigned int num_groups; //!< trick_units(count)
+
+   /**
+    * Thread pool, created on first parallel use.
+    */
+   DerivativeThreadPool * thread_pool; //!< trick_io(**)
+
+   /**
+    * In-range pairs, in contact pair list order.
+    */
+   std::vector<ContactPair *> pairs; //!< trick_io(**)
+
+   /**
+    * Pairs ordered by group, each group in contact pair list order.
+    */
+   std::vector<ContactPair *> grouped_pairs; //!< trick_io(**)
+
+   /**
+    * Offset of each group in grouped_pairs, plus a final end offset.
+    */
+   std::vector<unsigned int> group_start; //!< trick_io(**)
+
+   /**
+    * Next free slot of each group in grouped_pairs while grouping.
+    */
+   std::vector<unsigned int> group_fill; //!< trick_io(**)
+
+   /**
+    * Group index of each pair in pairs.
+    */
+   std::vector<unsigned int> pair_group; //!< trick_io(**)
+
+   /**
+    * Union-find parent of each node.
+    */
+   std::vector<unsigned int> parent; //!< trick_io(**)
+
+   /**
+    * Group index of each union-find root, or the node count if unassigned.
+    */
+   std::vector<unsigned int> root_group; //!< trick_io(**)
+
+   /**
+    * Union-find node of each facet and shared interaction.
+    */
+   std::map<const void *, unsigned int> node_index; //!< trick_io(**)
+
+
+private:
+   /* Operator = and copy constructor hidden from use by being private */
+
+   ContactNarrowPhase& operator = (const ContactNarrowPhase& rhs);
+   ContactNarrowPhase (const ContactNarrowPhase& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -104,6 +104,12 @@ public:
    // test whether the pair is in range for interaction
    bool in_range();
 
+   // test range using a relative state shared with other pairs.
+   bool in_range(ContactRelStateCache & cache);
+
+   // predict the time at which the facet bounding spheres will touch.
+   double predict_time_to_impact();
+
    // check to make sure the pair is valid for contact.
    bool is_active();
 
@@ -146,7 +152,30 @@ public:
    // check the pair and make sure they are on different mass trees.
    virtual bool check_tree();
 
+   /**
+    * Set the batch that collects the pair's contacts, or null to have the
+    * interaction evaluate them as they are found.
+    * \param[in] contact_batch Batch to add contacts to
+    */
+   void set_batch (ContactBatch * contact_batch)
+   {
+      batch = contact_batch;
+   }
+
 protected:
+   // compose the relative state from a cached frame pair state.
+   void update_rel_state (ContactRelStateCache & cache);
+
+   // compare the current relative state against the interaction distance.
+   bool within_interaction_distance ();
+
+   // pass a contact found by in_contact to the interaction.
+   void evaluate_interaction (
+      ContactFacet * subject_facet,
+      ContactFacet * target_facet,
+      double * penetration_vector,
+      double * rel_velocity);
+
    /**
     * Current relative state between the subject and the target in the subject frame.
     */
@@ -162,6 +191,11 @@ protected:
     */
    ContactFacet * target;  //!< trick_units(--)
 
+   /**
+    * batch that collects the contacts found by in_contact, or null.
+    */
+   ContactBatch * batch; //!< trick_units(--)
+
 private:
 
    /* Operator = and copy constructor hidden from use by being private */
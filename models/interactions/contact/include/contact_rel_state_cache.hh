@@ -0,0 +1,164 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/include/contact_rel_state_cache.hh
+ * Per-step cache of relative states between the frames that carry contact
+ * facets, for use with contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((Cached states are valid only within the step in which they were
+       computed.))
+
+ Library dependencies:
+    ((../src/contact_rel_state_cache.cc))
+
+
+
+*****************************************************************************/
+
+#ifndef CONTACT_REL_STATE_CACHE_HH
+#define CONTACT_REL_STATE_CACHE_HH
+
+// System includes
+#include <map>
+#include <utility>
+#include <vector>
+
+/* JEOD includes */
+#include "utils/ref_frames/include/class_declarations.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Caches, for one contact check, the relative state of each pair of frames
+ * that carry contact facet vehicle points (normally the vehicle structural
+ * frames). Every contact pair between the same two frames then shares one
+ * frame-tree computation and only composes the constant vehicle point
+ * offsets onto it.
+ */
+class ContactRelStateCache {
+
+   JEOD_MAKE_SIM_INTERFACES(ContactRelStateCache)
+
+public:
+
+   // constructor
+   ContactRelStateCache ();
+
+   // destructor
+   ~ContactRelStateCache ();
+
+   // Invalidate the states cached by the previous contact check.
+   void begin_step ();
+
+   // Get the state of a target frame with respect to a subject frame.
+   const RefFrameState & get_state (
+      const RefFrame & subject_frame,
+      const RefFrame & target_frame);
+
+   /**
+    * Number of frame-tree computations made since begin_step.
+    * @return Computation count
+    */
+   unsigned int get_num_computed () const
+   {
+      return num_computed;
+   }
+
+protected:
+
+   /**
+    * Identifies the current contact check.
+    */
+   unsigned long step_count; //!< trick_units(--)
+
+   /**
+    * Number of frame-tree computations made since begin_step.
+    */
+   unsigned int num_computed; //!< trick_units(count)
+
+   /**
+    * Entry index of each subject, target frame pair seen so far.
+    */
+   std::map<std::pair<const RefFrame *, const RefFrame *>, unsigned int>
+      entry_index; //!< trick_io(**)
+
+   /**
+    * Cached relative state of each entry.
+    */
+   std::vector<RefFrameState> states; //!< trick_io(**)
+
+   /**
+    * Contact check in which each entry was last computed.
+    */
+   std::vector<unsigned long> computed_step; //!< trick_io(**)
+
+private:
+   /* Operator = and copy constructor hidden from use by being private */
+
+   ContactRelStateCache& operator = (const ContactRelStateCache& rhs);
+   ContactRelStateCache (const ContactRelStateCache& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
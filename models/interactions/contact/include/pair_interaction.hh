@@ -111,6 +111,18 @@ public:
    // check a pair of contact params for a match to stored ones.
    bool is_correct_interaction(ContactParams *subject_params, ContactParams *target_params);
 
+   /**
+    * Indicate whether calculate_forces may be called concurrently for
+    * pairs that have no facet in common. The default is false, which makes
+    * the parallel narrow phase evaluate all pairs using this interaction on
+    * one thread.
+    * @return True if concurrent calls are safe
+    */
+   virtual bool is_thread_safe () const
+   {
+      return false;
+   }
+
       /**
     * Pure virtual function that is defined to calculate forces on facets in
     * contact.
@@ -128,6 +140,26 @@ public:
       double* rel_velocity)
    = 0;
 
+   /**
+    * Calculate the forces of a block of contacts that use this interaction,
+    * without applying them to the facets. The default has no batch kernel
+    * and leaves the contacts to calculate_forces.
+    * \param[in,out] block Packed contacts; the forces are set on return
+    * @return True if the forces were calculated
+    */
+   virtual bool calculate_batch_forces (
+      ContactForceBlock & block JEOD_UNUSED)
+   {
+      return false;
+   }
+
+   // apply a force on the subject, and its reaction, to a pair of facets.
+   static void apply_forces (
+      ContactFacet * subject,
+      ContactFacet * target,
+      const RelativeDerivedState * rel_state,
+      const double * force);
+
 
 
 private:
@@ -122,6 +122,15 @@ public:
    // calculate the torque acting on the facet in the vehicle structural frame.
    void calculate_torque(double *tmp_force) override;
 
+   /**
+    * Access the contact point used by calculate_torque.
+    * @return Contact point in the facet frame
+    */
+   double * get_contact_point () override
+   {
+      return contact_point;
+   }
+
 private:
    // Operator = and copy constructor locked from use by being made private
    PointContactFacet& operator = (const PointContactFacet & rhs);
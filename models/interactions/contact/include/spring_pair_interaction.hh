@@ -67,6 +67,10 @@ Library dependencies:
 #ifndef SPRING_PAIR_INTERACTION_HH
 #define SPRING_PAIR_INTERACTION_HH
 
+// System includes
+#include <mutex>
+#include <vector>
+
 /* JEOD includes */
 #include "utils/sim_interface/include/jeod_class.hh"
 
@@ -114,9 +118,57 @@ public:
       double* penetration_vector,
       double* rel_velocity) override;
 
+   /* batched force calculation function */
+   bool calculate_batch_forces (ContactForceBlock & block) override;
+
+   // replace the linear spring with a tabulated force-penetration curve.
+   void set_force_curve (
+      double depth_step,
+      const double * forces,
+      unsigned int num_forces);
+
+   // revert to the linear spring.
+   void clear_force_curve ();
+
+   /**
+    * Spring contact modifies only the facets passed to it; the shared
+    * friction_mag diagnostic is written under a lock.
+    * @return True
+    */
+   bool is_thread_safe () const override
+   {
+      return true;
+   }
+
 
 
 protected:
+   // spring force magnitude at a penetration depth.
+   double spring_force (double depth) const;
+
+   /**
+    * Spacing of the depths of the tabulated force-penetration curve.
+    * Zero while no curve is set.
+    */
+   double curve_step; //!< trick_units(m)
+
+   /**
+    * Tabulated spring force at the depths k*curve_step, k = 0, 1, ...
+    * The curve is extended linearly beyond the last depth.
+    */
+   std::vector<double> force_curve; //!< trick_io(**)
+
+   /**
+    * Reciprocal of curve_step.
+    */
+   double curve_scale; //!< trick_units(1/m)
+
+   /**
+    * Serializes updates of friction_mag when pairs are evaluated in
+    * parallel. friction_mag then holds the value from one of the contacts
+    * evaluated in the step rather than from the last pair in list order.
+    */
+   std::mutex friction_mutex; //!< trick_io(**)
 
 private:
 
@@ -23,14 +23,21 @@
 
  Library dependencies:
     ((contact.cc)
-     (contact_pair.cc))
+     (contact_batch.cc)
+     (contact_broad_phase.cc)
+     (contact_narrow_phase.cc)
+     (contact_pair.cc)
+     (contact_rel_state_cache.cc)
+     (utils/sim_interface/src/jeod_profiler.cc))
 
  
 *****************************************************************************/
 
 /* JEOD includes */
+#include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
 #include "dynamics/mass/include/mass.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 #include "utils/surface_model/include/facet.hh"
 
 /* Model includes */
@@ -50,7 +57,17 @@ Contact::Contact (
    void)
    : // Return: -- None
    active (true),
-   contact_limit_factor(0.0)
+   contact_limit_factor(0.0),
+   broad_phase_culling(true),
+   share_relative_states(false),
+   narrow_phase_threads(1),
+   batch_interactions(true),
+   continuous_detection(false),
+   impact_step_fraction(0.5),
+   contact_step(0.0),
+   step_hint_group(nullptr),
+   time_to_impact(-1.0),
+   max_step_hint(0.0)
 {
    JEOD_REGISTER_CLASS(Contact);
    JEOD_REGISTER_CLASS(ContactPair);
@@ -88,23 +105,117 @@ Contact::~Contact (
 
 /**
  * iterate through contact pairs list then call the
- * appropriate contact resolution functions
+ * appropriate contact resolution functions. When broad phase culling is on,
+ * only pairs whose facet bounding spheres overlap reach the range test; the
+ * list order, and hence the order in which forces accumulate, is unchanged.
+ * When relative state sharing is on, pairs between the same two frames share
+ * one frame-tree computation per check. With more than one narrow phase
+ * thread, the range tests still run serially and the in-range pairs are then
+ * evaluated in parallel groups that have no facet in common. Otherwise, with
+ * batching on, the contacts the pairs find are collected and their forces
+ * evaluated together once all pairs have been tested. With continuous
+ * detection on, the time to impact of each in-range pair is predicted and
+ * turned into an integration step hint.
  */
 void
 Contact::check_contact (
    void)
 {
+   JEOD_PROFILE_SCOPE ("contact", "Contact::check_contact");
 
    if (active) {
       std::list<ContactPair *>::iterator cp;
+      std::size_t pair_index = 0;
 
-      for (cp = contact_pairs.begin (); cp != contact_pairs.end (); ++cp) {
-         if ((*cp)->is_complete() && (*cp)->is_active() && (*cp)->in_range()) {
-            (*cp)->in_contact();
+      if (broad_phase_culling) {
+         if (!broad_phase.is_built_for (contact_pairs, contact_limit_factor)) {
+            broad_phase.build (contact_pairs, contact_limit_factor);
          }
+         broad_phase.update ();
+      }
+
+      if (share_relative_states) {
+         rel_state_cache.begin_step ();
+      }
+
+      bool deferred = (narrow_phase_threads > 1);
+      if (deferred) {
+         narrow_phase.clear ();
+      }
+
+      ContactBatch * pair_batch =
+         ((!deferred) && batch_interactions) ? &batch : nullptr;
+      batch.clear ();
+
+      if (continuous_detection) {
+         time_to_impact = -1.0;
+      }
+
+      for (cp = contact_pairs.begin (); cp != contact_pairs.end ();
+           ++cp, ++pair_index) {
+         if ((*cp)->is_complete() &&
+             ((!broad_phase_culling) || broad_phase.is_candidate (pair_index)) &&
+             (*cp)->is_active() &&
+             (share_relative_states ? (*cp)->in_range (rel_state_cache) :
+                                      (*cp)->in_range())) {
+            if (continuous_detection) {
+               double pair_time = (*cp)->predict_time_to_impact();
+               if ((pair_time >= 0.0) &&
+                   ((time_to_impact < 0.0) || (pair_time < time_to_impact))) {
+                  time_to_impact = pair_time;
+               }
+            }
+            (*cp)->set_batch (pair_batch);
+            if (deferred) {
+               narrow_phase.add_pair (*cp);
+            }
+            else {
+               (*cp)->in_contact();
+            }
+         }
+      }
+
+      if (deferred) {
+         narrow_phase.evaluate (narrow_phase_threads);
+      }
+      else if (pair_batch != nullptr) {
+         batch.evaluate ();
+      }
+
+      if (continuous_detection) {
+         update_step_hint ();
+      }
+   }
+
+   return;
+}
+
+/**
+ * Derive the integration step hint from the predicted time to impact. The
+ * step is limited to impact_step_fraction of the time to impact, so that
+ * repeated predictions converge on the impact instead of stepping over it,
+ * but never below contact_step, which also applies while in contact. When
+ * no in-range pair is closing the step is unconstrained. The hint is
+ * copied to step_hint_group if one is set.
+ */
+void
+Contact::update_step_hint (
+   void)
+{
+   if (time_to_impact < 0.0) {
+      max_step_hint = 0.0;
+   }
+   else {
+      max_step_hint = impact_step_fraction * time_to_impact;
+      if ((contact_step > 0.0) && (max_step_hint < contact_step)) {
+         max_step_hint = contact_step;
       }
    }
 
+   if (step_hint_group != nullptr) {
+      step_hint_group->max_step_hint = max_step_hint;
+   }
+
    return;
 }
 
@@ -264,12 +375,16 @@ Contact::register_interaction (
    PairInteraction * interaction)
 {
    pair_interactions.push_back (interaction);
+   interaction_table.clear ();
 
    return;
 }
 
 /**
- * find a PairInteraction baced on a set of ContactParams.
+ * find a PairInteraction baced on a set of ContactParams. The result for
+ * each pair of params is kept in the interaction table, so the registered
+ * interactions are searched once per pair of params rather than once per
+ * pair of facets.
  * @return pointer to a PairInteraction
  * \param[in] params_1 ContactParams from a ContactFacet
  * \param[in] params_2 ContactParams from a ContactFacet
@@ -279,15 +394,28 @@ Contact::find_interaction (
    ContactParams * params_1,
    ContactParams * params_2)
 {
+   std::pair<const ContactParams *, const ContactParams *> key (params_1,
+                                                                params_2);
+   auto entry = interaction_table.find (key);
+   if (entry != interaction_table.end()) {
+      return entry->second;
+   }
+
+   PairInteraction * found = nullptr;
    std::list<PairInteraction *>::iterator pint;
 
    for (pint = pair_interactions.begin (); pint != pair_interactions.end (); ++pint) {
       if ((*pint)->is_correct_interaction(params_1, params_2)) {
-         return (*pint);
+         found = *pint;
+         break;
       }
    }
 
-   return nullptr;
+   // The match does not depend on the order of the params.
+   interaction_table[key] = found;
+   interaction_table[std::make_pair (params_2, params_1)] = found;
+
+   return found;
 }
 
 } // End JEOD namespace
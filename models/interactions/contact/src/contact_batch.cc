@@ -0,0 +1,258 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/src/contact_batch.cc
+ * Batched evaluation of the contact forces of a contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((N/A))
+
+ Library dependencies:
+    ((contact_batch.cc)
+     (contact_facet.cc)
+     (pair_interaction.cc))
+
+
+*****************************************************************************/
+
+/* System includes */
+#include <cstddef>
+
+/* JEOD includes */
+#include "utils/math/include/vector3.hh"
+
+/* Model includes */
+#include "../include/contact_batch.hh"
+#include "../include/contact_facet.hh"
+#include "../include/pair_interaction.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default Constructor
+ */
+ContactBatch::ContactBatch (
+   void)
+:
+   entries (),
+   interactions (),
+   entry_group (),
+   group_start (),
+   group_fill (),
+   grouped (),
+   packed ()
+{
+   ; // Empty
+}
+
+
+/**
+ * Destructor
+ */
+ContactBatch::~ContactBatch (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Discard the contacts added since the last evaluation.
+ */
+void
+ContactBatch::clear (
+   void)
+{
+   entries.clear ();
+}
+
+
+/**
+ * Add a contact found by a pair. The contact points of the facets are
+ * saved so that a later pair with a facet in common may overwrite them.
+ * \param[in] interaction Interaction of the pair
+ * \param[in,out] subject subject of the relative state
+ * \param[in,out] target target of the relative state, or null
+ * \param[in] rel_state relative state between subject and target in subject frame
+ * \param[in] penetration_vector vector that characterises the interpenetration of the subject and the target
+ * \param[in] rel_velocity relative velocity of the subject and the target in the subject frame
+ */
+void
+ContactBatch::add (
+   PairInteraction * interaction,
+   ContactFacet * subject,
+   ContactFacet * target,
+   RelativeDerivedState * rel_state,
+   const double * penetration_vector,
+   const double * rel_velocity)
+{
+   Entry entry;
+   const double * point;
+
+   entry.interaction = interaction;
+   entry.subject = subject;
+   entry.target = target;
+   entry.rel_state = rel_state;
+   entry.has_force = false;
+
+   point = subject->get_contact_point ();
+   if (point != nullptr) {
+      Vector3::copy (point, entry.subject_point);
+   }
+   point = (target != nullptr) ? target->get_contact_point () : nullptr;
+   if (point != nullptr) {
+      Vector3::copy (point, entry.target_point);
+   }
+   Vector3::copy (penetration_vector, entry.penetration);
+   Vector3::copy (rel_velocity, entry.rel_velocity);
+
+   entries.push_back (entry);
+}
+
+
+/**
+ * Evaluate the forces of the added contacts and apply them to the facets.
+ * Each interaction's contacts are packed into one block for its batch
+ * kernel. The forces are then applied in the order the contacts were
+ * added; contacts whose interaction has no kernel are evaluated with
+ * calculate_forces at that point. The batch is cleared on return.
+ */
+void
+ContactBatch::evaluate (
+   void)
+{
+   std::size_t num_entries = entries.size();
+
+   if (num_entries == 0) {
+      return;
+   }
+
+   // Order the entries by interaction, each group in entry order. There are
+   // few interactions, so they are found by a linear search.
+   interactions.clear ();
+   group_start.clear ();
+   entry_group.resize (num_entries);
+   for (std::size_t ii = 0; ii < num_entries; ++ii) {
+      unsigned int group = 0;
+      while ((group < interactions.size()) &&
+             (interactions[group] != entries[ii].interaction)) {
+         ++group;
+      }
+      if (group == interactions.size()) {
+         interactions.push_back (entries[ii].interaction);
+         group_start.push_back (0);
+      }
+      ++group_start[group];
+      entry_group[ii] = group;
+   }
+
+   // Convert the group sizes to offsets, plus a final end offset.
+   unsigned int offset = 0;
+   for (std::size_t group = 0; group < group_start.size(); ++group) {
+      unsigned int count = group_start[group];
+      group_start[group] = offset;
+      offset += count;
+   }
+   group_start.push_back (offset);
+
+   group_fill.assign (group_start.begin(), group_start.end() - 1);
+   grouped.resize (num_entries);
+   for (std::size_t ii = 0; ii < num_entries; ++ii) {
+      grouped[group_fill[entry_group[ii]]++] = static_cast<unsigned int> (ii);
+   }
+
+   // Pack each group and pass it to its interaction's kernel.
+   for (std::size_t group = 0; group < interactions.size(); ++group) {
+      unsigned int count = group_start[group+1] - group_start[group];
+      const unsigned int * members = &grouped[group_start[group]];
+
+      packed.resize (9 * static_cast<std::size_t>(count));
+      ContactForceBlock block;
+      block.count = count;
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         block.penetration[kk] = &packed[kk * count];
+         block.rel_velocity[kk] = &packed[(3 + kk) * count];
+         block.force[kk] = &packed[(6 + kk) * count];
+      }
+
+      for (unsigned int ii = 0; ii < count; ++ii) {
+         const Entry & entry = entries[members[ii]];
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            block.penetration[kk][ii] = entry.penetration[kk];
+            packed[(3 + kk) * count + ii] = entry.rel_velocity[kk];
+         }
+      }
+
+      if (interactions[group]->calculate_batch_forces (block)) {
+         for (unsigned int ii = 0; ii < count; ++ii) {
+            Entry & entry = entries[members[ii]];
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               entry.force[kk] = block.force[kk][ii];
+            }
+            entry.has_force = true;
+         }
+      }
+   }
+
+   // Apply the forces in the order the contacts were found.
+   for (std::size_t ii = 0; ii < num_entries; ++ii) {
+      Entry & entry = entries[ii];
+
+      restore_point (entry.subject, entry.subject_point);
+      if (entry.target != nullptr) {
+         restore_point (entry.target, entry.target_point);
+      }
+
+      if (entry.has_force) {
+         PairInteraction::apply_forces (
+            entry.subject, entry.target, entry.rel_state, entry.force);
+      }
+      else {
+         entry.interaction->calculate_forces (
+            entry.subject, entry.target, entry.rel_state,
+            entry.penetration, entry.rel_velocity);
+      }
+   }
+
+   entries.clear ();
+}
+
+
+/**
+ * Restore the contact point saved for a facet, if the facet keeps one.
+ * \param[in,out] facet The facet
+ * \param[in] point Saved contact point
+ */
+void
+ContactBatch::restore_point (
+   ContactFacet * facet,
+   const double point[3])
+{
+   double * contact_point = facet->get_contact_point ();
+   if (contact_point != nullptr) {
+      Vector3::copy (point, contact_point);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,331 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/src/contact_broad_phase.cc
+ * Broad-phase culling of contact pairs for use with contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((N/A))
+
+ Library dependencies:
+    ((contact_broad_phase.cc)
+     (contact_pair.cc))
+
+
+*****************************************************************************/
+
+/* System includes */
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+/* JEOD includes */
+#include "utils/ref_frames/include/ref_frame.hh"
+
+/* Model includes */
+#include "../include/contact_broad_phase.hh"
+#include "../include/contact_facet.hh"
+#include "../include/contact_pair.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default Constructor
+ */
+ContactBroadPhase::ContactBroadPhase (
+   void)
+   : // Return: -- None
+   num_pairs (0),
+   limit_factor (0.0),
+   num_candidates (0),
+   sweep_axis (-1),
+   built (false),
+   root_frame (nullptr)
+{
+}
+
+
+/**
+ * Destructor
+ */
+ContactBroadPhase::~ContactBroadPhase (
+   void)
+{
+}
+
+
+/**
+ * Index the facets of the complete pairs in a contact pair list and
+ * determine which pairs can be culled.
+ * \param[in] pairs Contact pair list
+ * \param[in] contact_limit_factor Multiple of the facet max dimension used
+ *            as the facet sphere radius
+ */
+void
+ContactBroadPhase::build (
+   const JeodPointerList<ContactPair>::type & pairs,
+   double contact_limit_factor)
+{
+   std::map<const ContactFacet *, unsigned int> facet_index;
+   std::vector<std::pair<unsigned long long, std::size_t> > keyed_pairs;
+   JeodPointerList<ContactPair>::type::const_iterator cp;
+   std::size_t idx;
+
+   num_pairs    = pairs.size();
+   limit_factor = contact_limit_factor;
+   pair_snapshot.assign (pairs.begin(), pairs.end());
+   facets.clear();
+   radius.clear();
+   always_checked.clear();
+   root_frame = nullptr;
+
+   for (cp = pairs.begin(), idx = 0; cp != pairs.end(); ++cp, ++idx) {
+      ContactPair * pair = *cp;
+      if (!pair->is_complete()) {
+         continue;
+      }
+
+      ContactFacet * ends[2] = {pair->get_subject(), pair->get_target()};
+      if ((ends[0]->vehicle_point == nullptr) ||
+          (ends[1]->vehicle_point == nullptr)) {
+         always_checked.push_back (idx);
+         continue;
+      }
+
+      unsigned int end_index[2];
+      for (unsigned int ii = 0; ii < 2; ++ii) {
+         std::map<const ContactFacet *, unsigned int>::iterator found =
+            facet_index.find (ends[ii]);
+         if (found == facet_index.end()) {
+            end_index[ii] = static_cast<unsigned int> (facets.size());
+            facet_index[ends[ii]] = end_index[ii];
+            facets.push_back (ends[ii]);
+            // Inflated so that the default interaction distance,
+            // (max_1 + max_2) * factor, never exceeds the radius sum.
+            radius.push_back (ends[ii]->max_dimension * contact_limit_factor *
+                              (1.0 + 1.0e-12));
+         }
+         else {
+            end_index[ii] = found->second;
+         }
+      }
+
+      // The sphere test bounds the range test only when the interaction
+      // distance is finite and no larger than the sum of the sphere radii.
+      double radius_sum = radius[end_index[0]] + radius[end_index[1]];
+      if ((std::fpclassify (pair->interaction_distance) == FP_ZERO) ||
+          (pair->interaction_distance > radius_sum)) {
+         always_checked.push_back (idx);
+         continue;
+      }
+
+      unsigned long long lower = std::min (end_index[0], end_index[1]);
+      unsigned long long upper = std::max (end_index[0], end_index[1]);
+      keyed_pairs.push_back (std::make_pair ((lower << 32) | upper, idx));
+   }
+
+   std::sort (keyed_pairs.begin(), keyed_pairs.end());
+   pair_keys.resize (keyed_pairs.size());
+   pair_index.resize (keyed_pairs.size());
+   for (std::size_t ii = 0; ii < keyed_pairs.size(); ++ii) {
+      pair_keys[ii]  = keyed_pairs[ii].first;
+      pair_index[ii] = keyed_pairs[ii].second;
+   }
+
+   if (!facets.empty()) {
+      root_frame = facets[0]->vehicle_point->get_root();
+   }
+
+   center.assign (3 * facets.size(), 0.0);
+   sweep_order.clear();
+   open_facets.clear();
+   candidate.assign (num_pairs, 0);
+   sweep_axis     = -1;
+   num_candidates = 0;
+   built          = true;
+
+   return;
+}
+
+
+/**
+ * Determine whether the broad phase was built for a contact pair list.
+ * The list is compared pair by pair so that a list rebuilt with the same
+ * size, as on restart, is detected.
+ * @return True if no rebuild is needed
+ * \param[in] pairs Contact pair list
+ * \param[in] contact_limit_factor Contact limit factor in use
+ */
+bool
+ContactBroadPhase::is_built_for (
+   const JeodPointerList<ContactPair>::type & pairs,
+   double contact_limit_factor)
+const
+{
+   if ((!built) ||
+       (pairs.size() != num_pairs) ||
+       (contact_limit_factor != limit_factor)) {
+      return false;
+   }
+
+   JeodPointerList<ContactPair>::type::const_iterator cp;
+   std::size_t idx;
+   for (cp = pairs.begin(), idx = 0; cp != pairs.end(); ++cp, ++idx) {
+      if (*cp != pair_snapshot[idx]) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+
+/**
+ * Force the broad phase to be rebuilt before its next use, e.g. after pair
+ * interaction distances or facet dimensions have been changed.
+ */
+void
+ContactBroadPhase::invalidate (
+   void)
+{
+   built = false;
+   return;
+}
+
+
+/**
+ * Locate the facets and flag the pairs whose bounding spheres overlap.
+ */
+void
+ContactBroadPhase::update (
+   void)
+{
+   unsigned int num_facets = static_cast<unsigned int> (facets.size());
+
+   std::fill (candidate.begin(), candidate.end(), 0);
+   for (std::size_t ii = 0; ii < always_checked.size(); ++ii) {
+      candidate[always_checked[ii]] = 1;
+   }
+   num_candidates = static_cast<unsigned int> (always_checked.size());
+
+   if (num_facets == 0) {
+      return;
+   }
+
+   // Locate the facets in the root frame and pick the axis of largest spread.
+   double sum[3]    = {0.0, 0.0, 0.0};
+   double sum_sq[3] = {0.0, 0.0, 0.0};
+   double max_coord = 0.0;
+   for (unsigned int ii = 0; ii < num_facets; ++ii) {
+      double * pos = &center[3 * ii];
+      facets[ii]->vehicle_point->compute_position_from (*root_frame, pos);
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         sum[jj]    += pos[jj];
+         sum_sq[jj] += pos[jj] * pos[jj];
+         max_coord   = std::max (max_coord, std::fabs (pos[jj]));
+      }
+   }
+
+   int axis = 0;
+   double best_spread = -1.0;
+   for (int jj = 0; jj < 3; ++jj) {
+      double spread = sum_sq[jj] - sum[jj] * sum[jj] / num_facets;
+      if (spread > best_spread) {
+         best_spread = spread;
+         axis        = jj;
+      }
+   }
+
+   // Pad the spheres for the rounding difference between root frame
+   // positions and the relative states used by the range test.
+   double pad = 1.0e-9 * (1.0 + max_coord);
+
+   // Order the facets by lower bound. The previous order is nearly sorted
+   // when the axis is unchanged, which insertion sort exploits.
+   if ((axis != sweep_axis) || (sweep_order.size() != num_facets)) {
+      sweep_order.resize (num_facets);
+      for (unsigned int ii = 0; ii < num_facets; ++ii) {
+         sweep_order[ii] = ii;
+      }
+      sweep_axis = axis;
+   }
+   for (unsigned int ii = 1; ii < num_facets; ++ii) {
+      unsigned int moving = sweep_order[ii];
+      double moving_low = center[3 * moving + axis] - radius[moving];
+      unsigned int jj = ii;
+      while ((jj > 0) &&
+             (center[3 * sweep_order[jj - 1] + axis] -
+              radius[sweep_order[jj - 1]] > moving_low)) {
+         sweep_order[jj] = sweep_order[jj - 1];
+         --jj;
+      }
+      sweep_order[jj] = moving;
+   }
+
+   // Sweep, testing each facet against the spheres still open.
+   open_facets.clear();
+   for (unsigned int ii = 0; ii < num_facets; ++ii) {
+      unsigned int cur = sweep_order[ii];
+      const double * cur_pos = &center[3 * cur];
+      double cur_low = cur_pos[axis] - radius[cur] - pad;
+
+      std::size_t kept = 0;
+      for (std::size_t kk = 0; kk < open_facets.size(); ++kk) {
+         unsigned int other = open_facets[kk];
+         const double * other_pos = &center[3 * other];
+         if (other_pos[axis] + radius[other] + pad < cur_low) {
+            continue;
+         }
+         open_facets[kept++] = other;
+
+         double dx = cur_pos[0] - other_pos[0];
+         double dy = cur_pos[1] - other_pos[1];
+         double dz = cur_pos[2] - other_pos[2];
+         double reach = radius[cur] + radius[other] + 2.0 * pad;
+         if (dx * dx + dy * dy + dz * dz > reach * reach) {
+            continue;
+         }
+
+         unsigned long long key =
+            (static_cast<unsigned long long> (std::min (cur, other)) << 32) |
+            std::max (cur, other);
+         std::vector<unsigned long long>::const_iterator match =
+            std::lower_bound (pair_keys.begin(), pair_keys.end(), key);
+         for (; (match != pair_keys.end()) && (*match == key); ++match) {
+            std::size_t pos = pair_index[match - pair_keys.begin()];
+            if (candidate[pos] == 0) {
+               candidate[pos] = 1;
+               ++num_candidates;
+            }
+         }
+      }
+      open_facets.resize (kept);
+      open_facets.push_back (cur);
+   }
+
+   return;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,265 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/src/contact_narrow_phase.cc
+ * Parallel narrow-phase evaluation of contact pairs for use with contact
+ * interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((N/A))
+
+ Library dependencies:
+    ((contact_narrow_phase.cc)
+     (contact_pair.cc)
+     (pair_interaction.cc)
+     (dynamics/dyn_manager/src/derivative_thread_pool.cc))
+
+
+*****************************************************************************/
+
+/* System includes */
+#include <cstddef>
+
+/* JEOD includes */
+#include "dynamics/dyn_manager/include/derivative_thread_pool.hh"
+
+/* Model includes */
+#include "../include/contact_narrow_phase.hh"
+#include "../include/contact_pair.hh"
+#include "../include/pair_interaction.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Evaluates the pairs of one group, in order.
+ */
+class ContactGroupTask : public DerivativeThreadTask {
+public:
+
+   /**
+    * Constructor.
+    * @param[in] pairs_in  Pairs ordered by group.
+    * @param[in] start_in  Offset of each group, plus a final end offset.
+    */
+   ContactGroupTask (
+      const std::vector<ContactPair *> & pairs_in,
+      const std::vector<unsigned int> & start_in)
+   :
+      pairs (pairs_in),
+      start (start_in)
+   {}
+
+   /**
+    * Evaluate the pairs of a group.
+    * @param[in] index  Group index.
+    */
+   void execute (unsigned int index) override
+   {
+      for (unsigned int ii = start[index]; ii < start[index+1]; ++ii) {
+         pairs[ii]->in_contact ();
+      }
+   }
+
+private:
+   const std::vector<ContactPair *> & pairs;
+   const std::vector<unsigned int> & start;
+};
+
+} // End anonymous namespace
+
+
+/**
+ * Default Constructor
+ */
+ContactNarrowPhase::ContactNarrowPhase (
+   void)
+   : // Return: -- None
+   num_groups (0),
+   thread_pool (nullptr)
+{
+}
+
+
+/**
+ * Destructor
+ */
+ContactNarrowPhase::~ContactNarrowPhase (
+   void)
+{
+   DerivativeThreadPool::release (thread_pool);
+}
+
+
+/**
+ * Empty the list of pairs to be evaluated.
+ */
+void
+ContactNarrowPhase::clear (
+   void)
+{
+   pairs.clear ();
+
+   return;
+}
+
+
+/**
+ * Evaluate the added pairs, calling in_contact on each of them. With fewer
+ * than two threads, or fewer than two independent groups, the pairs are
+ * evaluated serially in list order.
+ * \param[in] num_threads Number of threads, including the calling thread
+ */
+void
+ContactNarrowPhase::evaluate (
+   unsigned int num_threads)
+{
+   if (num_threads < 2) {
+      num_groups = 0;
+      for (std::size_t ii = 0; ii < pairs.size (); ++ii) {
+         pairs[ii]->in_contact ();
+      }
+      return;
+   }
+
+   form_groups ();
+
+   if (num_groups < 2) {
+      for (std::size_t ii = 0; ii < pairs.size (); ++ii) {
+         pairs[ii]->in_contact ();
+      }
+      return;
+   }
+
+   ContactGroupTask task (grouped_pairs, group_start);
+   DerivativeThreadPool::acquire (thread_pool, num_threads)->run (
+      num_groups, task);
+
+   return;
+}
+
+
+/**
+ * Partition the added pairs into independent groups with a union-find over
+ * the objects each pair modifies. Groups are numbered in order of their
+ * first pair, and the pairs within a group keep their list order.
+ */
+void
+ContactNarrowPhase::form_groups (
+   void)
+{
+   unsigned int npairs = pairs.size ();
+
+   node_index.clear ();
+   parent.clear ();
+
+   for (unsigned int ii = 0; ii < npairs; ++ii) {
+      ContactPair * pair = pairs[ii];
+      unsigned int a = find_root (node_for (pair->get_subject ()));
+      unsigned int b = find_root (node_for (pair->get_target ()));
+      if (a != b) {
+         parent[b] = a;
+      }
+      if ((pair->interaction != nullptr) &&
+          (! pair->interaction->is_thread_safe ())) {
+         a = find_root (a);
+         b = find_root (node_for (pair->interaction));
+         if (a != b) {
+            parent[b] = a;
+         }
+      }
+   }
+
+   // Number the groups in order of first appearance.
+   unsigned int nnodes = parent.size ();
+   root_group.assign (nnodes, nnodes);
+   pair_group.resize (npairs);
+   group_start.assign (1, 0);
+   num_groups = 0;
+
+   for (unsigned int ii = 0; ii < npairs; ++ii) {
+      unsigned int root = find_root (node_index[pairs[ii]->get_subject ()]);
+      if (root_group[root] == nnodes) {
+         root_group[root] = num_groups++;
+         group_start.push_back (0);
+      }
+      pair_group[ii] = root_group[root];
+      ++group_start[pair_group[ii] + 1];
+   }
+
+   // Counting sort of the pairs by group; stable, so list order is kept.
+   for (unsigned int ig = 0; ig < num_groups; ++ig) {
+      group_start[ig + 1] += group_start[ig];
+   }
+   grouped_pairs.resize (npairs);
+   group_fill.assign (group_start.begin (), group_start.end () - 1);
+   for (unsigned int ii = 0; ii < npairs; ++ii) {
+      grouped_pairs[group_fill[pair_group[ii]]++] = pairs[ii];
+   }
+
+   return;
+}
+
+
+/**
+ * Find the representative of a union-find node, halving the path.
+ * @return Root node
+ * \param[in] node Node index
+ */
+unsigned int
+ContactNarrowPhase::find_root (
+   unsigned int node)
+{
+   while (parent[node] != node) {
+      parent[node] = parent[parent[node]];
+      node = parent[node];
+   }
+   return node;
+}
+
+
+/**
+ * Obtain the union-find node for an object modified by a pair, creating a
+ * singleton node the first time the object is seen.
+ * @return Node index
+ * \param[in] object Facet or interaction
+ */
+unsigned int
+ContactNarrowPhase::node_for (
+   const void * object)
+{
+   std::map<const void *, unsigned int>::iterator it =
+      node_index.find (object);
+   if (it != node_index.end ()) {
+      return it->second;
+   }
+
+   unsigned int node = parent.size ();
+   parent.push_back (node);
+   node_index[object] = node;
+   return node;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -22,7 +22,10 @@
  ((N/A))
 
  Library dependencies:
- ((contact_pair.cc))
+ ((contact_pair.cc)
+  (contact_batch.cc)
+  (contact_rel_state_cache.cc)
+  (pair_interaction.cc))
 
  
 
@@ -36,7 +39,10 @@
 #include "dynamics/mass/include/mass.hh"
 
 /* Model includes */
+#include "../include/contact_batch.hh"
 #include "../include/contact_pair.hh"
+#include "../include/contact_rel_state_cache.hh"
+#include "../include/pair_interaction.hh"
 
 //! Namespace jeod
 namespace jeod {
@@ -50,7 +56,8 @@ ContactPair::ContactPair (
 interaction (nullptr),
 interaction_distance(0.0),
 subject (nullptr),
-target (nullptr)
+target (nullptr),
+batch (nullptr)
 {
 
 }
@@ -74,12 +81,105 @@ ContactPair::in_range (
    void)
 {
    rel_state.update();
+   return within_interaction_distance();
+}
+
+/**
+ * test whether the pair is in range for interaction, deriving the relative
+ * state from the state of the subject and target vehicle point parent frames
+ * held in a cache shared by all pairs.
+ * @return bool
+ * \param[in,out] cache relative states of the vehicle point parent frames
+ */
+bool
+ContactPair::in_range (
+   ContactRelStateCache & cache)
+{
+   update_rel_state (cache);
+   return within_interaction_distance();
+}
+
+/**
+ * Compute the relative state of the target vehicle point with respect to
+ * the subject vehicle point by composing the vehicle point states onto the
+ * cached relative state of their parent frames. Falls back to a full
+ * relative state update when the pair is not set up that way.
+ * \param[in,out] cache relative states of the vehicle point parent frames
+ */
+void
+ContactPair::update_rel_state (
+   ContactRelStateCache & cache)
+{
+   const BodyRefFrame * subject_point = subject->vehicle_point;
+   const BodyRefFrame * target_point = target->vehicle_point;
+
+   if ((rel_state.direction_sense !=
+        RelativeDerivedState::ComputeTargetStateinSubject) ||
+       (subject_point == nullptr) || (target_point == nullptr) ||
+       (subject_point->get_parent() == nullptr) ||
+       (target_point->get_parent() == nullptr)) {
+      rel_state.update();
+      return;
+   }
+
+   // S_subj:targ = S_subj:subj_parent^-1 * S_subj_parent:targ_parent *
+   //               S_targ_parent:targ
+   RefFrameState & state = rel_state.rel_state;
+   state.copy (cache.get_state (*subject_point->get_parent(),
+                                *target_point->get_parent()));
+   state.incr_right (target_point->state);
+   state.decr_left (subject_point->state);
+
+   return;
+}
+
+/**
+ * Compare the current relative state against the interaction distance.
+ * @return bool
+ */
+bool
+ContactPair::within_interaction_distance (
+   void)
+{
    if (std::fpclassify(interaction_distance) == FP_ZERO || interaction_distance >= Vector3::vmag(rel_state.rel_state.trans.position)) {
       return true;
    }
    return false;
 }
 
+/**
+ * Predict the time at which the bounding spheres of the two facets will
+ * touch by conservative advancement: the sphere gap divided by the rate at
+ * which the vehicle points are closing. The spheres are centered on the
+ * vehicle points with radii of the facet maximum dimensions, so facet
+ * rotation does not shorten the prediction. The relative state must be
+ * current, as it is after in_range.
+ * @return Predicted time to impact, zero if the spheres already touch, or
+ *         negative if the facets are not closing.\n Units: s
+ */
+double
+ContactPair::predict_time_to_impact (
+   void)
+{
+   const double * position = rel_state.rel_state.trans.position;
+   double distance = Vector3::vmag(position);
+   double gap = distance - (subject->max_dimension + target->max_dimension);
+
+   if (gap <= 0.0) {
+      return 0.0;
+   }
+
+   // Closing speed; rotation of the subject frame does not change the
+   // distance, so the frame in which the velocity is taken does not matter.
+   double closing = -Vector3::dot(position, rel_state.rel_state.trans.velocity) /
+                    distance;
+   if (closing <= 0.0) {
+      return -1.0;
+   }
+
+   return gap / closing;
+}
+
 /**
  * Determine if contact can occur between the two facets.
  * @return bool
@@ -165,6 +265,33 @@ ContactPair::initialize_relstate (
 
 
 
+/**
+ * Pass a contact found by in_contact to the pair's interaction, or add it
+ * to the batch if one is set.
+ * \param[in,out] subject_facet subject of the relative state
+ * \param[in,out] target_facet target of the relative state
+ * \param[in] penetration_vector vector that characterises the interpenetration of the subject and the target
+ * \param[in] rel_velocity relative velocity of the subject and the target in the subject frame
+ */
+void
+ContactPair::evaluate_interaction (
+   ContactFacet * subject_facet,
+   ContactFacet * target_facet,
+   double * penetration_vector,
+   double * rel_velocity)
+{
+   if (batch != nullptr) {
+      batch->add (interaction, subject_facet, target_facet, &rel_state,
+                  penetration_vector, rel_velocity);
+   }
+   else {
+      interaction->calculate_forces (subject_facet, target_facet, &rel_state,
+                                     penetration_vector, rel_velocity);
+   }
+
+   return;
+}
+
 } // End JEOD namespace
 
 /**
@@ -0,0 +1,119 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/src/contact_rel_state_cache.cc
+ * Per-step cache of relative states between the frames that carry contact
+ * facets, for use with contact interaction model
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((None)))
+
+ Assumptions and Limitations:
+     ((N/A))
+
+ Library dependencies:
+    ((contact_rel_state_cache.cc))
+
+
+*****************************************************************************/
+
+/* JEOD includes */
+#include "utils/ref_frames/include/ref_frame.hh"
+
+/* Model includes */
+#include "../include/contact_rel_state_cache.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default Constructor
+ */
+ContactRelStateCache::ContactRelStateCache (
+   void)
+   : // Return: -- None
+   step_count (1),
+   num_computed (0)
+{
+}
+
+
+/**
+ * Destructor
+ */
+ContactRelStateCache::~ContactRelStateCache (
+   void)
+{
+}
+
+
+/**
+ * Invalidate the states cached by the previous contact check.
+ */
+void
+ContactRelStateCache::begin_step (
+   void)
+{
+   ++step_count;
+   num_computed = 0;
+
+   return;
+}
+
+
+/**
+ * Get the state of a target frame with respect to a subject frame, in the
+ * subject frame. The state is computed through the frame tree the first time
+ * the pair is requested in a step and reused thereafter.
+ * @return Relative state of target_frame wrt subject_frame
+ * \param[in] subject_frame Subject frame
+ * \param[in] target_frame Target frame
+ */
+const RefFrameState &
+ContactRelStateCache::get_state (
+   const RefFrame & subject_frame,
+   const RefFrame & target_frame)
+{
+   std::pair<const RefFrame *, const RefFrame *> key (&subject_frame,
+                                                      &target_frame);
+   std::map<std::pair<const RefFrame *, const RefFrame *>,
+            unsigned int>::iterator found = entry_index.find (key);
+   unsigned int index;
+
+   if (found == entry_index.end()) {
+      index = static_cast<unsigned int> (states.size());
+      entry_index[key] = index;
+      states.push_back (RefFrameState());
+      computed_step.push_back (0);
+   }
+   else {
+      index = found->second;
+   }
+
+   if (computed_step[index] != step_count) {
+      target_frame.compute_relative_state (subject_frame, states[index]);
+      computed_step[index] = step_count;
+      ++num_computed;
+   }
+
+   return states[index];
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
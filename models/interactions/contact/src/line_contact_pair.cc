@@ -157,7 +157,7 @@ LineContactPair::in_contact(
       Vector3::cross (rel_state.rel_state.rot.ang_vel_this, subject_contact_point, rel_velocity);
       Vector3::diff (rel_velocity, rel_state.rel_state.trans.velocity, rel_velocity);
       // calculate the forces on the facets
-      interaction->calculate_forces(line_subject, line_target, &rel_state, vec, rel_velocity);
+      evaluate_interaction(line_subject, line_target, vec, rel_velocity);
    }
 
    return;
@@ -31,6 +31,12 @@ Library dependencies:
 /* System includes */
 #include <cstring>
 
+/* JEOD includes */
+#include "utils/math/include/vector3.hh"
+#include "dynamics/dyn_body/include/body_ref_frame.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/derived_state/include/relative_derived_state.hh"
+
 /* Model includes */
 #include "../include/pair_interaction.hh"
 #include "../include/contact_facet.hh"
@@ -84,6 +90,54 @@ PairInteraction::is_correct_interaction(
    return false;
 }
 
+/**
+ * Apply the force of a contact to the facets of the pair: the force acts on
+ * the subject, and its reaction on the target, if any.
+ * \param[in,out] subject subject of the relative state
+ * \param[in,out] target target of the relative state, or null
+ * \param[in] rel_state relative state between subject and target in subject frame
+ * \param[in] force force on the subject in the subject frame\n Units: N
+ */
+void
+PairInteraction::apply_forces (
+   ContactFacet * subject,
+   ContactFacet * target,
+   const RelativeDerivedState * rel_state,
+   const double * force)
+{
+   double reaction[3], vec[3], tmp_force[3];
+
+   /* add Force and Torque to Subject Facet */
+   // rotate force into vehicle structure frame
+   Vector3::transform_transpose (subject->vehicle_point->state.rot.T_parent_this,
+                                 force, vec);
+   Vector3::transform (subject->vehicle_body->structure.state.rot.T_parent_this,
+                       vec, tmp_force);
+   // calculate torque and add to facet total
+   subject->calculate_torque(tmp_force);
+   // add force to facet total
+   Vector3::sum (subject->force, tmp_force, subject->force);
+
+   /* add Force and Torque to Target Facet */
+   if (target != nullptr) {
+      // negate force to make it equal and opposite to force on subject
+      Vector3::negate(force, reaction);
+      // rotate force to target frame
+      Vector3::transform(rel_state->rel_state.rot.T_parent_this, reaction, vec);
+      // rotate force into vehicle structure frame
+      Vector3::transform_transpose (target->vehicle_point->state.rot.T_parent_this,
+                                    vec, reaction);
+      Vector3::transform (target->vehicle_body->structure.state.rot.T_parent_this,
+                          reaction, tmp_force);
+      // calculate torque and add to facet total
+      target->calculate_torque(tmp_force);
+      // add force to facet total
+      Vector3::sum (target->force, tmp_force, target->force);
+   }
+
+   return;
+}
+
 } // End JEOD namespace
 
 /**
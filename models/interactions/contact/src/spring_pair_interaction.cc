@@ -21,23 +21,25 @@ ASSUMPTIONS AND LIMITATIONS:
       ((None))
 
 Library dependencies:
-    ((spring_pair_interaction.cc))
+    ((spring_pair_interaction.cc)
+     (contact_messages.cc)
+     (pair_interaction.cc)
+     (utils/message/src/message_handler.cc))
 
 
 *******************************************************************************/
 
 /* System includes */
 #include <cmath>
+#include <cstddef>
 
 /* JEOD includes */
-#include "utils/math/include/vector3.hh"
-#include "dynamics/dyn_body/include/body_ref_frame.hh"
-#include "dynamics/dyn_body/include/dyn_body.hh"
-#include "dynamics/derived_state/include/relative_derived_state.hh"
+#include "utils/message/include/message_handler.hh"
 
 /* Model includes */
 #include "../include/spring_pair_interaction.hh"
-#include "../include/contact_facet.hh"
+#include "../include/contact_batch.hh"
+#include "../include/contact_messages.hh"
 
 
 //! Namespace jeod
@@ -52,7 +54,11 @@ SpringPairInteraction::SpringPairInteraction (
    : // Return: -- None
    spring_k (0.0),
    damping_b (0.0),
-   mu (0.0)
+   mu (0.0),
+   curve_step (0.0),
+   force_curve (),
+   curve_scale (0.0),
+   friction_mutex ()
 {
 
 }
@@ -75,7 +81,7 @@ SpringPairInteraction::~SpringPairInteraction (
  * force calculation for a simple spring based contact
  * dynamics model, takes in geometry information from the appropriate
  * ContactFacet::calculate_forces but doesn't know about specific type of
- * ContactFacet
+ * ContactFacet. The contact is evaluated as a batch of one.
  * \param[in,out] subject subject frame of the relative state
  * \param[in,out] target target frame of the relative state
  * \param[in] rel_state relative state between subject and target in subject frame
@@ -90,80 +96,194 @@ SpringPairInteraction::calculate_forces (
    double* penetration_vector,
    double* rel_velocity)
 {
-   double friction_vec[3];  /* Friction directional vector */
-   double damping_force[3]; /* Damping force */
-   double friction_force[3]; /* Friction force */
-   double nvec[3], vec[3]; /* temp vectors */
-   double mag, mag_force, damping_mag; /* vector magnitudes */
-   double force[3], tmp_force[3]; /* forces */
-
-   // normalize penetration vector and avoid really small values
-   Vector3::zero_small (1.0E-10, penetration_vector);
-   Vector3::normalize (penetration_vector, nvec);
-
-   /* Spring Constant Force */
-   // scale penetract vector with the spring constant
-   Vector3::scale (penetration_vector, this->spring_k, force);
-
-   /* Damping Force */
-   // mag of velocity in penetration direction
-   mag         = Vector3::dot (rel_velocity, nvec);
-   // calculate magnitude of damping force
-   damping_mag = mag * this->damping_b;
-   // scale nvec with force magnitue to get damping force
-   Vector3::scale (nvec,  -damping_mag, damping_force);
-
-   // add damping force to total force on facet
-   Vector3::sum (force, damping_force, force);
-
-   /* Friction Force */
-   Vector3::normalize (rel_velocity, friction_vec);
-   // cross velocity with penetration vector
-   Vector3::cross(friction_vec, nvec, vec);
-   // cross penetration vector with result to get vector along subject surface
-   Vector3::cross(nvec, vec, friction_vec);
-
-   // calcualte the magnitude of the spring force
-   mag_force = Vector3::vmag (force);
-   mag       = mag_force * this->mu;
-   // scale surface vector with magnitude
-   Vector3::scale (friction_vec,  -mag, friction_force);
-   Vector3::sum (force, friction_force, force);
-   friction_mag = Vector3::vmag(friction_force);
-
-   /* add Force and Torque to Subject Facet */
-   // rotate force into vehicle structure frame
-   Vector3::transform_transpose (subject->vehicle_point->state.rot.T_parent_this,
-                                 force, vec);
-   Vector3::transform (subject->vehicle_body->structure.state.rot.T_parent_this,
-                       vec, tmp_force);
-   // calculate torque and add to facet total
-   subject->calculate_torque(tmp_force);
-   // add force to facet total
-   Vector3::sum (subject->force, tmp_force, subject->force);
-
-   /* add Force and Torque to Target Facet */
-   if (target != nullptr) {
-      // negate force to make it equal and opposite to force on subject
-      Vector3::negate(force, force);
-      // rotate force to target frame
-      Vector3::transform(rel_state->rel_state.rot.T_parent_this, force, nvec);
-      // rotate force into vehicle structure frame
-      Vector3::transform_transpose (target->vehicle_point->state.rot.T_parent_this,
-                                 nvec, vec);
-      Vector3::transform (target->vehicle_body->structure.state.rot.T_parent_this,
-                       vec, tmp_force);
-      // calculate torque and add to facet total
-      target->calculate_torque(tmp_force);
-      // add force to facet total
-      Vector3::sum (target->force, tmp_force, target->force);
+   double force[3]; /* force on the subject */
+   ContactForceBlock block;
+
+   block.count = 1;
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      block.penetration[kk] = &penetration_vector[kk];
+      block.rel_velocity[kk] = &rel_velocity[kk];
+      block.force[kk] = &force[kk];
    }
 
+   calculate_batch_forces (block);
 
+   apply_forces (subject, target, rel_state, force);
 
    return;
 }
 
+
+/**
+ * Spring, damping, and friction forces of a block of contacts. The
+ * contacts are processed component-wise in one pass over the packed
+ * arrays, with no per-contact calls, so the loop is open to vectorization.
+ * friction_mag is set from the last contact of the block.
+ * @return True
+ * \param[in,out] block Packed contacts; the forces are set on return
+ */
+bool
+SpringPairInteraction::calculate_batch_forces (
+   ContactForceBlock & block)
+{
+   double * const px = block.penetration[0];
+   double * const py = block.penetration[1];
+   double * const pz = block.penetration[2];
+   const double * const vx = block.rel_velocity[0];
+   const double * const vy = block.rel_velocity[1];
+   const double * const vz = block.rel_velocity[2];
+   double * const fx = block.force[0];
+   double * const fy = block.force[1];
+   double * const fz = block.force[2];
+   bool tabulated = ! force_curve.empty();
+   double last_friction = 0.0;
+
+   for (unsigned int ii = 0; ii < block.count; ++ii) {
+
+      // avoid really small penetration components
+      if (std::fabs (px[ii]) < 1.0E-10) {
+         px[ii] = 0.0;
+      }
+      if (std::fabs (py[ii]) < 1.0E-10) {
+         py[ii] = 0.0;
+      }
+      if (std::fabs (pz[ii]) < 1.0E-10) {
+         pz[ii] = 0.0;
+      }
+
+      // normalize penetration vector
+      double depth = std::sqrt (px[ii]*px[ii] + py[ii]*py[ii] + pz[ii]*pz[ii]);
+      double nscale = (depth > 0.0) ? 1.0 / depth : 0.0;
+      double nx = px[ii] * nscale;
+      double ny = py[ii] * nscale;
+      double nz = pz[ii] * nscale;
+
+      /* Spring Force */
+      double sx, sy, sz;
+      if (tabulated) {
+         double spring_mag = spring_force (depth);
+         sx = nx * spring_mag;
+         sy = ny * spring_mag;
+         sz = nz * spring_mag;
+      }
+      else {
+         sx = px[ii] * spring_k;
+         sy = py[ii] * spring_k;
+         sz = pz[ii] * spring_k;
+      }
+
+      /* Damping Force */
+      // magnitude of damping force from velocity in penetration direction
+      double damping_mag = (vx[ii]*nx + vy[ii]*ny + vz[ii]*nz) * damping_b;
+      sx = sx + nx * -damping_mag;
+      sy = sy + ny * -damping_mag;
+      sz = sz + nz * -damping_mag;
+
+      /* Friction Force */
+      double vmag = std::sqrt (vx[ii]*vx[ii] + vy[ii]*vy[ii] + vz[ii]*vz[ii]);
+      double vscale = (vmag > 0.0) ? 1.0 / vmag : 0.0;
+      double ux = vx[ii] * vscale;
+      double uy = vy[ii] * vscale;
+      double uz = vz[ii] * vscale;
+      // cross velocity with penetration vector
+      double wx = uy * nz - uz * ny;
+      double wy = uz * nx - ux * nz;
+      double wz = ux * ny - uy * nx;
+      // cross penetration vector with result to get vector along subject surface
+      double tx = ny * wz - nz * wy;
+      double ty = nz * wx - nx * wz;
+      double tz = nx * wy - ny * wx;
+
+      double friction = std::sqrt (sx*sx + sy*sy + sz*sz) * mu;
+      double ffx = tx * -friction;
+      double ffy = ty * -friction;
+      double ffz = tz * -friction;
+
+      fx[ii] = sx + ffx;
+      fy[ii] = sy + ffy;
+      fz[ii] = sz + ffz;
+      last_friction = std::sqrt (ffx*ffx + ffy*ffy + ffz*ffz);
+   }
+
+   if (block.count > 0) {
+      std::lock_guard<std::mutex> lock (friction_mutex);
+      friction_mag = last_friction;
+   }
+
+   return true;
+}
+
+
+/**
+ * Replace the linear spring with a tabulated force-penetration curve. The
+ * curve is sampled at evenly spaced depths so that evaluating it costs one
+ * index computation and one linear interpolation per contact, the same for
+ * any number of samples. The curve is extended linearly beyond the last
+ * depth.
+ * \param[in] depth_step Spacing of the sampled depths\n Units: m
+ * \param[in] forces Spring force at the depths k*depth_step, k = 0, 1, ...\n Units: N
+ * \param[in] num_forces Number of samples, at least two
+ */
+void
+SpringPairInteraction::set_force_curve (
+   double depth_step,
+   const double * forces,
+   unsigned int num_forces)
+{
+   if ((depth_step <= 0.0) || (forces == nullptr) || (num_forces < 2)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, ContactMessages::initialization_error,
+         "A force-penetration curve needs a positive depth step and at "
+         "least two samples.");
+
+      // Not reached
+      return;
+   }
+
+   force_curve.assign (forces, forces + num_forces);
+   curve_step = depth_step;
+   curve_scale = 1.0 / depth_step;
+
+   return;
+}
+
+
+/**
+ * Discard the tabulated force-penetration curve and revert to the linear
+ * spring with constant spring_k.
+ */
+void
+SpringPairInteraction::clear_force_curve (
+   void)
+{
+   force_curve.clear ();
+   curve_step = 0.0;
+   curve_scale = 0.0;
+
+   return;
+}
+
+
+/**
+ * Interpolate the tabulated force-penetration curve.
+ * @return Spring force magnitude\n Units: N
+ * \param[in] depth Penetration depth\n Units: m
+ */
+double
+SpringPairInteraction::spring_force (
+   double depth)
+const
+{
+   double sample = depth * curve_scale;
+   std::size_t last = force_curve.size() - 2;
+   std::size_t index = (sample < static_cast<double> (last)) ?
+                       static_cast<std::size_t> (sample) : last;
+   double frac = sample - static_cast<double> (index);
+
+   return force_curve[index] +
+          frac * (force_curve[index+1] - force_curve[index]);
+}
+
 } // End JEOD namespace
 
 /**
@@ -0,0 +1,224 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup GravityTorque
+ * @{
+ *
+ * @file
+ * Defines the class DistributedGravityTorque.
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+   ()
+
+REFERENCE:
+   (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+   ((The sample points and their masses represent the body's mass
+     distribution. The torque is taken about the composite center of mass,
+     and the acceleration at the center of mass is removed from every point
+     before the moments are summed, so a point set whose mass-weighted
+     centroid is not the composite center of mass still sees no torque in a
+     uniform field.)
+    (Relativistic corrections are not applied at the sample points.))
+
+Library dependencies:
+   ((../src/distributed_gravity_torque.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_DISTRIBUTED_GRAVITY_TORQUE_HH
+#define JEOD_DISTRIBUTED_GRAVITY_TORQUE_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/class_declarations.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Computes the gravitational torque on an object represented by a set of
+ * mass points by evaluating the gravity field at every point.
+ * Unlike GravityTorque, which uses the gravity gradient at the center of
+ * mass and the composite inertia, this captures the variation of the field
+ * across long or flexible structures.
+ */
+class DistributedGravityTorque {
+
+   JEOD_MAKE_SIM_INTERFACES(DistributedGravityTorque)
+
+public:
+
+   // constructor
+   DistributedGravityTorque ();
+
+   // destructor
+   ~DistributedGravityTorque ();
+
+   // Add a sample point, in structural coordinates
+   void add_point (const double struct_posn[3], double point_mass);
+
+   // Remove all sample points
+   void clear_points ();
+
+   void initialize (DynBody& subject);
+
+   void update ();
+
+   /**
+    * Number of sample points.
+    * @return Number of points
+    */
+   unsigned int num_points () const
+   {
+      return static_cast<unsigned int> (point_mass.size());
+   }
+
+   /**
+    * The output torque, in the structural frame
+    */
+   double torque[3]; //!< trick_units(N*m)
+
+   /**
+    * Is the model active?
+    */
+   bool active; //!< trick_units(--)
+
+
+
+protected:
+
+   // Recompute the body-frame point positions from the structural ones
+   void update_body_points ();
+
+   /**
+    * The subject body for the torque
+    */
+   DynBody* subject_body; //!< trick_units(--)
+
+   /**
+    * Sample point positions, structural frame, one array per axis.
+    */
+   std::vector<double> struct_posn[3]; //!< trick_io(**)
+
+   /**
+    * Sample point masses.
+    */
+   std::vector<double> point_mass; //!< trick_io(**)
+
+   /**
+    * Sample point positions relative to the composite center of mass, body
+    * frame, one array per axis. Cached; rebuilt only when the composite
+    * mass properties move or the point set changes.
+    */
+   std::vector<double> body_posn[3]; //!< trick_io(**)
+
+   /**
+    * Sample point positions relative to the composite center of mass,
+    * integration frame, one array per axis.
+    */
+   std::vector<double> rel_posn[3]; //!< trick_io(**)
+
+   /**
+    * Batch positions (the points, then the center of mass), integration
+    * frame, one array per axis.
+    */
+   std::vector<double> batch_posn[3]; //!< trick_io(**)
+
+   /**
+    * Batch accelerations from one gravity control, one array per axis.
+    */
+   std::vector<double> batch_accel[3]; //!< trick_io(**)
+
+   /**
+    * Summed batch accelerations over all gravity controls, one array per
+    * axis.
+    */
+   std::vector<double> total_accel[3]; //!< trick_io(**)
+
+   /**
+    * Composite center of mass location (structural frame) for which
+    * body_posn was computed.
+    */
+   double cached_cm[3]; //!< trick_io(**)
+
+   /**
+    * Structure-to-body transformation for which body_posn was computed.
+    */
+   double cached_T_struct_body[3][3]; //!< trick_io(**)
+
+   /**
+    * Does body_posn reflect the current points and mass properties?
+    */
+   bool body_points_valid; //!< trick_io(**)
+
+
+
+private:
+
+   // operator = and copy constructor locked from use because they
+   // are declared private
+
+   DistributedGravityTorque& operator = (const DistributedGravityTorque& rhs);
+   DistributedGravityTorque (const DistributedGravityTorque& rhs);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
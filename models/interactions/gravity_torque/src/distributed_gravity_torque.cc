@@ -0,0 +1,297 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup GravityTorque
+ * @{
+ *
+ * @file models/interactions/gravity_torque/src/distributed_gravity_torque.cc
+ * Distributed-mass gravity torque model
+ */
+
+/************************** TRICK HEADER****************************************
+PURPOSE:
+   ()
+
+REFERENCE:
+   (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+   ((None))
+
+Library dependencies:
+   ((distributed_gravity_torque.cc)
+    (gravity_torque_messages.cc)
+    (dynamics/dyn_body/src/dyn_body.cc)
+    (environment/gravity/src/gravity_controls.cc)
+    (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "environment/gravity/include/gravity_controls.hh"
+#include "environment/gravity/include/gravity_point_batch.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/distributed_gravity_torque.hh"
+#include "../include/gravity_torque_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a DistributedGravityTorque object.
+ */
+DistributedGravityTorque::DistributedGravityTorque (
+   void)
+{
+   subject_body = nullptr;
+   Vector3::initialize (torque);
+   Vector3::initialize (cached_cm);
+   Matrix3x3::initialize (cached_T_struct_body);
+   body_points_valid = false;
+   active = true;
+}
+
+
+/**
+ * Destruct a DistributedGravityTorque object.
+ */
+DistributedGravityTorque::~DistributedGravityTorque (
+   void)
+{
+   // empty for now
+}
+
+
+/**
+ * Add a sample point.
+ * \param[in] posn Point location, structural frame\n Units: M
+ * \param[in] mass Mass represented by the point\n Units: kg
+ */
+void
+DistributedGravityTorque::add_point (
+   const double posn[3],
+   double mass)
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      struct_posn[kk].push_back (posn[kk]);
+   }
+   point_mass.push_back (mass);
+   body_points_valid = false;
+
+   return;
+}
+
+
+/**
+ * Remove all sample points.
+ */
+void
+DistributedGravityTorque::clear_points (
+   void)
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      struct_posn[kk].clear ();
+   }
+   point_mass.clear ();
+   body_points_valid = false;
+
+   return;
+}
+
+
+/**
+ * Initialize a DistributedGravityTorque object.
+ * \param[in,out] subject DynBody object subject to the torque
+ */
+void
+DistributedGravityTorque::initialize (
+   DynBody& subject)
+{
+   subject_body = &subject;
+   body_points_valid = false;
+
+   return;
+}
+
+
+/**
+ * Recompute the cached body-frame point positions. The body frame origin is
+ * the composite center of mass.
+ */
+void
+DistributedGravityTorque::update_body_points (
+   void)
+{
+   const MassProperties & props = subject_body->mass.composite_properties;
+   unsigned int npoints = num_points ();
+
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      body_posn[kk].resize (npoints);
+      rel_posn[kk].resize (npoints);
+      batch_posn[kk].resize (npoints + 1);
+      batch_accel[kk].resize (npoints + 1);
+      total_accel[kk].resize (npoints + 1);
+   }
+
+   for (unsigned int ii = 0; ii < npoints; ++ii) {
+      double struct_rel[3];
+      double body_rel[3];
+
+      struct_rel[0] = struct_posn[0][ii] - props.position[0];
+      struct_rel[1] = struct_posn[1][ii] - props.position[1];
+      struct_rel[2] = struct_posn[2][ii] - props.position[2];
+      Vector3::transform (props.T_parent_this, struct_rel, body_rel);
+
+      body_posn[0][ii] = body_rel[0];
+      body_posn[1][ii] = body_rel[1];
+      body_posn[2][ii] = body_rel[2];
+   }
+
+   Vector3::copy (props.position, cached_cm);
+   Matrix3x3::copy (props.T_parent_this, cached_T_struct_body);
+   body_points_valid = true;
+
+   return;
+}
+
+
+/**
+ * Perform DistributedGravityTorque updates.
+ * The gravity field of every active control of the subject body is evaluated
+ * at all sample points, and at the center of mass, in one batch per control.
+ */
+void
+DistributedGravityTorque::update (
+   void)
+{
+
+   if (active == false) {
+      torque[0] = 0.0;
+      torque[1] = 0.0;
+      torque[2] = 0.0;
+      return;
+   }
+
+   if (subject_body == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, GravityTorqueMessages::initialization_error,
+         "DistributedGravityTorque object was not properly initialized.");
+      return;
+   }
+
+   // The cached body-frame points depend on the composite mass properties.
+   const MassProperties & props = subject_body->mass.composite_properties;
+   if (! body_points_valid) {
+      update_body_points ();
+   }
+   else {
+      for (unsigned int ii = 0; body_points_valid && (ii < 3); ++ii) {
+         if (props.position[ii] != cached_cm[ii]) {
+            body_points_valid = false;
+         }
+         for (unsigned int jj = 0; body_points_valid && (jj < 3); ++jj) {
+            if (props.T_parent_this[ii][jj] != cached_T_struct_body[ii][jj]) {
+               body_points_valid = false;
+            }
+         }
+      }
+      if (! body_points_valid) {
+         update_body_points ();
+      }
+   }
+
+   unsigned int npoints = num_points ();
+   const double (&T_inrtl_body)[3][3] =
+      subject_body->composite_body.state.rot.T_parent_this;
+   const double * cm_posn = subject_body->composite_body.state.trans.position;
+
+   // Rotate the cached points into the integration frame.
+   for (unsigned int ii = 0; ii < npoints; ++ii) {
+      double bx = body_posn[0][ii];
+      double by = body_posn[1][ii];
+      double bz = body_posn[2][ii];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         double rel = T_inrtl_body[0][kk] * bx +
+                      T_inrtl_body[1][kk] * by +
+                      T_inrtl_body[2][kk] * bz;
+         rel_posn[kk][ii] = rel;
+         batch_posn[kk][ii] = cm_posn[kk] + rel;
+      }
+   }
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      batch_posn[kk][npoints] = cm_posn[kk];
+      for (unsigned int ii = 0; ii <= npoints; ++ii) {
+         total_accel[kk][ii] = 0.0;
+      }
+   }
+
+   // Sum the gravitation of all active controls at every point.
+   GravityPointBatch batch;
+   batch.npoints = npoints + 1;
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      batch.posn[kk] = batch_posn[kk].data();
+      batch.accel[kk] = batch_accel[kk].data();
+   }
+
+   const GravityInteraction & grav = subject_body->grav_interaction;
+   for (unsigned int ic = 0; ic < grav.grav_controls.size(); ++ic) {
+      GravityControls * controls = grav.grav_controls[ic];
+      if ((controls == nullptr) || (! controls->active)) {
+         continue;
+      }
+      controls->gravitation (grav.integ_frame_index, batch);
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         double * total = total_accel[kk].data();
+         const double * accel = batch_accel[kk].data();
+         for (unsigned int ii = 0; ii <= npoints; ++ii) {
+            total[ii] += accel[ii];
+         }
+      }
+   }
+
+   // Moment of the differential gravitational forces about the center of
+   // mass, integration frame.
+   double torque_inrtl[3] = {0.0, 0.0, 0.0};
+   double cm_accel[3] = {total_accel[0][npoints],
+                         total_accel[1][npoints],
+                         total_accel[2][npoints]};
+   for (unsigned int ii = 0; ii < npoints; ++ii) {
+      double mass = point_mass[ii];
+      double rx = rel_posn[0][ii];
+      double ry = rel_posn[1][ii];
+      double rz = rel_posn[2][ii];
+      double fx = mass * (total_accel[0][ii] - cm_accel[0]);
+      double fy = mass * (total_accel[1][ii] - cm_accel[1]);
+      double fz = mass * (total_accel[2][ii] - cm_accel[2]);
+      torque_inrtl[0] += ry * fz - rz * fy;
+      torque_inrtl[1] += rz * fx - rx * fz;
+      torque_inrtl[2] += rx * fy - ry * fx;
+   }
+
+   // Transform to body, then to structure.
+   Vector3::transform (T_inrtl_body, torque_inrtl, torque);
+   Vector3::transform_transpose (props.T_parent_this, torque);
+
+   return;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Converts a solar irradiance history into the binary table file read by
+RadiationSource (see RadiationSource::flux_table_file and EOPTableFile).
+
+Input:
+  A text file with one line per sample: the time, in seconds in the time
+  passed to RadiationPressure::update, and the total solar irradiance at
+  one astronomical unit, in W/m^2. Blank lines and lines starting with #
+  are ignored. Times must increase.
+
+Output:
+  table "solar_flux": when (s), luminosity (W)
+
+Usage:
+  make_solar_flux_table.py tsi.txt solar_flux.tbl
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+
+FORMAT_VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+ASTRONOMICAL_UNIT = 1.495978707e11
+
+
+def write_table (path, kind, columns):
+   """Write a table file; columns is a list of (name, values)."""
+   num_rows = len (columns[0][1])
+   with open (path, "wb") as out:
+      out.write (struct.pack ("=8sIIIIQ16s16x", b"JEODTBL", BYTE_ORDER_MARK,
+                              FORMAT_VERSION, len (columns), 0, num_rows,
+                              kind.encode ()))
+      for name, _ in columns:
+         out.write (struct.pack ("=16s", name.encode ()))
+      for _, values in columns:
+         out.write (struct.pack ("={0}d".format (num_rows), *values))
+
+
+def read_irradiance (path):
+   """Return lists of times and luminosities."""
+   times = []
+   luminosities = []
+   scale = 4.0 * math.pi * ASTRONOMICAL_UNIT * ASTRONOMICAL_UNIT
+   with open (path) as inp:
+      for line in inp:
+         fields = line.split ()
+         if not fields or fields[0].startswith ("#"):
+            continue
+         time = float (fields[0])
+         if times and time <= times[-1]:
+            sys.exit ("{0}: times must increase".format (path))
+         times.append (time)
+         luminosities.append (float (fields[1]) * scale)
+   if len (times) < 2:
+      sys.exit ("{0}: at least two samples are needed".format (path))
+   return times, luminosities
+
+
+def main ():
+   parser = argparse.ArgumentParser (
+      description = "Make a RadiationSource luminosity table.")
+   parser.add_argument ("input", help = "time and irradiance text file")
+   parser.add_argument ("output", help = "table file to write")
+   args = parser.parse_args ()
+
+   times, luminosities = read_irradiance (args.input)
+   write_table (args.output, "solar_flux",
+                [("when", times), ("luminosity", luminosities)])
+
+
+if __name__ == "__main__":
+   main ()
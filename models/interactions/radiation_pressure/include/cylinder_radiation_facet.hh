@@ -0,0 +1,161 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/include/cylinder_radiation_facet.hh
+ * Cylinder facets for use with rad environment interaction models
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+()
+
+REFERENCE:
+(((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+((Only the lateral surface of the cylinder is modeled; model the end caps,
+  if exposed, as flat plates)
+ (The lateral surface has a uniform temperature, so its thermal emission
+  produces no net force))
+
+Library dependencies:
+((../src/cylinder_radiation_facet.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_CYLINDER_RADIATION_FACET_HH
+#define JEOD_CYLINDER_RADIATION_FACET_HH
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "radiation_facet.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class CylinderThermal;
+class RadiationParams;
+
+/**
+ * A cylinder facet to be used for radiation interaction. The flat plate
+ * absorption and reflection are integrated in closed form over the
+ * illuminated half of the lateral surface.
+ */
+class CylinderRadiationFacet : public RadiationFacet {
+
+   JEOD_MAKE_SIM_INTERFACES(CylinderRadiationFacet)
+
+   // Member data
+public:
+
+   /**
+    * Unit vector along the cylinder axis (structural frame). Once the
+    * radiation surface is initialized, it points to the normal found in
+    * the Cylinder.
+    */
+   double* axis; //!< trick_units(--)
+
+   /**
+    * Radius of the cylinder.
+    */
+   double radius; //!< trick_units(m)
+
+   /**
+    * Length of the cylinder.
+    */
+   double length; //!< trick_units(m)
+
+   /**
+    * Torque about the center of the cylinder, accumulated over the incident
+    * radiation.
+    */
+   double torque_center[3]; //!< trick_units(N*m)
+
+   //Member methods
+public:
+
+   // constructor
+   CylinderRadiationFacet ();
+
+   // destructor
+   ~CylinderRadiationFacet () override;
+
+   void incident_radiation (
+      const double flux_mag,
+      const double flux_struct_hat[3],
+      const bool calculate_forces) override;
+
+   void initialize_geom (double center_grav[3]) override;
+
+   void initialize_runtime_values (void) override;
+
+   void define_facet (CylinderThermal * cylinder, RadiationParams * params);
+
+   void radiation_pressure (void) override;
+
+   // Area of the lateral surface.
+   double lateral_area (void) const;
+
+protected:
+
+private:
+
+   CylinderRadiationFacet& operator = (const CylinderRadiationFacet& rhs);
+   CylinderRadiationFacet (const CylinderRadiationFacet& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
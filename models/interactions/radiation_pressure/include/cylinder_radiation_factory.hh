@@ -0,0 +1,132 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/include/cylinder_radiation_factory.hh
+ * Factory that creates an interaction facet, for a specific
+ * environment interaction model, from a facet model
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+      ((None))
+
+Library dependencies:
+    ((../src/cylinder_radiation_factory.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_CYLINDER_RADIATION_FACTORY_HH
+#define JEOD_CYLINDER_RADIATION_FACTORY_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+#include "utils/surface_model/include/interaction_facet_factory.hh"
+
+// Model includes
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * The factory for building cylinder radiation facets
+ */
+class CylinderRadiationFactory : public InteractionFacetFactory {
+
+   JEOD_MAKE_SIM_INTERFACES(CylinderRadiationFactory)
+
+public:
+
+   // constructor
+   CylinderRadiationFactory ();
+
+   // destructor
+   ~CylinderRadiationFactory () override;
+
+   InteractionFacet* create_facet (Facet* facet, FacetParams* params) override;
+
+   InteractionFacet* create_facets (
+      Facet** facets,
+      FacetParams** params,
+      unsigned int count,
+      InteractionFacet** inter_facets) override;
+
+   bool is_correct_factory (Facet* facet) override;
+
+protected:
+
+private:
+
+   // operator = and copy constructor locked from use because they
+   // are declared private
+
+   CylinderRadiationFactory& operator = (const CylinderRadiationFactory& rhs);
+   CylinderRadiationFactory (const CylinderRadiationFactory& rhs);
+
+};
+
+} // End JEOD namespace
+
+#ifdef TRICK_VER
+#include "cylinder_radiation_facet.hh"
+#endif
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -96,6 +96,12 @@ public:
 
    InteractionFacet* create_facet (Facet* facet, FacetParams* params) override;
 
+   InteractionFacet* create_facets (
+      Facet** facets,
+      FacetParams** params,
+      unsigned int count,
+      InteractionFacet** inter_facets) override;
+
    bool is_correct_factory (Facet* facet) override;
 
 protected:
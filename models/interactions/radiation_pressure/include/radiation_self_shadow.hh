@@ -0,0 +1,210 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/include/radiation_self_shadow.hh
+ * Facet-on-facet shadowing of the primary source by a vehicle's own surface
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+()
+
+REFERENCE:
+(((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+((Facets occlude as flat disks: circular plates use their radius, other
+  flat plates a disk of equal area)
+ (Only flat plate facets cast or receive shadows)
+ (Facet geometry is fixed in the structural frame between invalidations))
+
+Library dependencies:
+((../src/radiation_self_shadow.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_RADIATION_SELF_SHADOW_HH
+#define JEOD_RADIATION_SELF_SHADOW_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+class RadiationSurface;
+
+
+/**
+ * Determines which parts of a RadiationSurface are hidden from the primary
+ * source by other facets of the same surface. A bounding-volume hierarchy is
+ * built over the facets once; the illuminated fraction of each facet is
+ * found by casting rays toward the source from sample points on the facet.
+ * The fractions are cached and recomputed only when the source direction in
+ * the structural frame moves by more than a tolerance.
+ */
+class RadiationSelfShadow {
+
+   JEOD_MAKE_SIM_INTERFACES(RadiationSelfShadow)
+
+public:
+
+   /**
+    * Angle the source direction must move, in the structural frame, before
+    * the illuminated fractions are recomputed.
+    */
+   double direction_tolerance; //!< trick_units(rad)
+
+   /**
+    * Number of sample points on a ring about each facet center, in
+    * addition to the center itself.
+    */
+   unsigned int num_ring_samples; //!< trick_units(count)
+
+   /**
+    * Fraction of each facet's area that is illuminated by the primary
+    * source, indexed as the surface's facets.
+    */
+   std::vector<double> lit_fraction; //!< trick_io(**)
+
+   // constructor
+   RadiationSelfShadow ();
+
+   // destructor
+   ~RadiationSelfShadow ();
+
+   // Update the illuminated fractions for the given flux direction
+   void update (RadiationSurface & surface, const double flux_struc_hat[3]);
+
+   // Force the hierarchy and the fractions to be rebuilt on the next update
+   void invalidate ();
+
+private:
+
+   // Build the facet disks and the bounding-volume hierarchy
+   void build (RadiationSurface & surface);
+
+   // Recursively build the hierarchy over ordered_disks[first, last)
+   unsigned int build_node (unsigned int first, unsigned int last);
+
+   // Does a ray toward the source hit any disk other than the given one?
+   bool is_occluded (
+      const double origin[3],
+      const double direction[3],
+      const double inv_direction[3],
+      unsigned int self) const;
+
+   // Recompute the illuminated fraction of each facet
+   void compute_lit_fractions (const double to_source[3]);
+
+   /**
+    * Has the hierarchy been built?
+    */
+   bool built; //!< trick_units(--)
+
+   /**
+    * Are the illuminated fractions current for last_to_source?
+    */
+   bool fractions_valid; //!< trick_units(--)
+
+   /**
+    * Number of facets the hierarchy was built for
+    */
+   unsigned int num_disks; //!< trick_units(count)
+
+   /**
+    * Direction to the source used for the current fractions
+    */
+   double last_to_source[3]; //!< trick_units(--)
+
+   /**
+    * Disk centers, normals and radii, one array per component; a zero
+    * radius marks a facet that takes no part in shadowing
+    */
+   std::vector<double> disk_center[3]; //!< trick_io(**)
+   std::vector<double> disk_normal[3]; //!< trick_io(**)
+   std::vector<double> disk_radius; //!< trick_io(**)
+
+   /**
+    * Disk indices, ordered so each hierarchy leaf covers a contiguous range
+    */
+   std::vector<unsigned int> ordered_disks; //!< trick_io(**)
+
+   /**
+    * Hierarchy node bounding boxes, one array per component
+    */
+   std::vector<double> node_min[3]; //!< trick_io(**)
+   std::vector<double> node_max[3]; //!< trick_io(**)
+
+   /**
+    * Index of each node's second child; the first child immediately
+    * follows its parent. Zero for leaves.
+    */
+   std::vector<unsigned int> node_second; //!< trick_io(**)
+
+   /**
+    * Range of ordered_disks covered by each node
+    */
+   std::vector<unsigned int> node_first; //!< trick_io(**)
+   std::vector<unsigned int> node_count; //!< trick_io(**)
+
+   // Operator = and copy constructor locked from use by being made private
+   RadiationSelfShadow & operator = (const RadiationSelfShadow & rhs);
+   RadiationSelfShadow (const RadiationSelfShadow & rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -74,6 +74,8 @@ Library dependencies:
 #include <utility>
 
 // JEOD includes
+#include "environment/time/include/eop_table_file.hh"
+#include "utils/integration/include/timestamp_cache.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 
@@ -131,6 +133,19 @@ public:
     */
   double luminosity; //!< trick_units(--)
 
+   /**
+    * Binary table file (see EOPTableFile) of kind "solar_flux", with
+    * columns "when" (s) and "luminosity" (W), from which luminosity is
+    * interpolated by update_source. Times are in the time passed to
+    * update_source. When empty, luminosity is as set by the user.
+    */
+  std::string flux_table_file; //!< trick_units(--)
+
+   /**
+    * Timestamp of the source state last set by update_source.
+    */
+  TimestampCache source_cache; //!< trick_units(--)
+
    /**
     * Radius of primary source
     */
@@ -225,9 +240,19 @@ public:
 
    virtual void initialize (DynManager * dyn_manager_ptr);
 
+   virtual void update_source (double time);
+
    virtual void calculate_flux (
       RefFrame& veh_struc_frame, const double center_grav[3]);
 
+   void calculate_flux (
+      unsigned int num_veh,
+      RefFrame * const veh_struc_frames[],
+      const double center_grav[][3],
+      double flux_inertial_out[][3],
+      double flux_mag_out[],
+      double flux_struc_hat_out[][3]) const;
+
 
    /**
     * Setter for the name.
@@ -238,9 +263,30 @@ public:
    }
 
 
+ private:
+
+   /**
+    * The mapped luminosity table, if any.
+    */
+  EOPTableFile flux_table; //!< trick_io(**)
+
+   /**
+    * Times of the luminosity table rows.
+    */
+  const double * flux_table_when; //!< trick_io(**)
+
+   /**
+    * Luminosities of the luminosity table rows.
+    */
+  const double * flux_table_luminosity; //!< trick_io(**)
+
+   /**
+    * Row of the luminosity table found by the last lookup.
+    */
+  unsigned int flux_table_cursor; //!< trick_io(**)
+
  // The copy constructor and assignment operator for this class are
  // declared private and are not implemented.
- private:
 
    RadiationSource (const RadiationSource&);
    RadiationSource & operator = (const RadiationSource&);
@@ -67,9 +67,11 @@ Library dependencies:
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
+#include "utils/surface_model/include/articulation_observer.hh"
 #include "utils/surface_model/include/interaction_surface.hh"
 
 // Model includes
+#include "radiation_self_shadow.hh"
 
 
 //! Namespace jeod
@@ -86,7 +88,7 @@ class DynBody;
 /**
  * The surface of the vehicle that interacts with the incident flux.
  */
-class RadiationSurface : public InteractionSurface {
+class RadiationSurface : public InteractionSurface, public ArticulationObserver {
 
    JEOD_MAKE_SIM_INTERFACES(RadiationSurface)
 
@@ -126,6 +128,20 @@ public:
     */
    double torque[3]; //!< trick_units(--)
 
+   /**
+    * Flag to instruct the model to account for facets shadowing other facets
+    * of this surface from the primary source.
+    */
+   bool self_shadowing; //!< trick_units(--)
+
+   /**
+    * Facet-on-facet shadowing of the primary source, used when
+    * self_shadowing is set.  Call self_shadow.invalidate() after the
+    * surface articulates, or register the surface as an articulation
+    * observer of its SurfaceModel.
+    */
+   RadiationSelfShadow self_shadow; //!< trick_units(--)
+
    /**
     * Simple counter, used repeatedly.
     */
@@ -150,8 +166,19 @@ public:
       FacetParams * params,
       unsigned int index) override;
 
+   void allocate_interaction_facets (
+      Facet ** base_facets,
+      InteractionFacetFactory * factory,
+      FacetParams ** params,
+      const unsigned int * indices,
+      unsigned int count) override;
+
    void initialize_runtime_values(void);
 
+   void facets_articulated (
+      const SurfaceModel & surface,
+      const std::vector<unsigned int> & changed_facets) override;
+
    void incident_radiation (
       double flux_mag, const double flux_struc_hat[3], bool calculate_forces);
 
@@ -163,6 +190,9 @@ public:
 
    void thermal_integrator (void) override;
 
+   void collect_thermal_riders (
+      std::vector<ThermalFacetRider *> & riders) override;
+
    void equalize_absorption_emission (void);
 
    void radiation_pressure (void);
@@ -73,6 +73,7 @@ Library dependencies:
 #include "utils/surface_model/include/interaction_surface_factory.hh"
 
 // Model includes
+#include "cylinder_radiation_factory.hh"
 #include "flat_plate_radiation_factory.hh"
 
 
@@ -110,6 +111,11 @@ protected:
     */
   FlatPlateRadiationFactory flat_plate_radiation_factory; //!< trick_units(--)
 
+   /**
+    * The factory to build cylinder thermal facets
+    */
+  CylinderRadiationFactory cylinder_radiation_factory; //!< trick_units(--)
+
 private:
 
    // operator = and copy constructor locked from use because they
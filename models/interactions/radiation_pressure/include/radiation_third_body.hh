@@ -96,6 +96,16 @@ public:
       Con = 3               /**< planet casts a conical shadow */
   };
 
+   /**
+    * The shadow region the vehicle occupies with respect to this body
+    */
+  enum ShadowRegion {
+      Lit = 0 ,       /**< no part of the source is blocked */
+      Penumbral = 1 , /**< the source is partially blocked */
+      Umbral = 2 ,    /**< the source is completely blocked */
+      Antumbral = 3   /**< the body lies wholly within the source disk */
+  };
+
    /**
     * Pointer to the primary illumination source
     */
@@ -146,6 +156,19 @@ public:
     */
   RefFrame * local_frame_ptr; //!< trick_units(--)
 
+   /**
+    * Predict shadow transitions and skip the shadow geometry while the
+    * vehicle is fully lit or fully shadowed and no transition is near.
+    * Default: false
+    */
+  bool predict_shadow_transitions; //!< trick_units(--)
+
+   /**
+    * Longest time the shadow geometry may go unevaluated when transition
+    * prediction is active.
+    */
+  double max_shadow_check_interval; //!< trick_units(s)
+
 
 protected:
 
@@ -231,6 +254,60 @@ protected:
    double source_to_third_hat_inrtl[3]; //!< trick_units(--)
 
 
+ // Shadow transition prediction:
+   /**
+    * Shadow region found by the last shadow evaluation.
+    */
+   ShadowRegion shadow_region; //!< trick_units(--)
+
+   /**
+    * Signed distance from the vehicle to the outer (penumbral) shadow
+    * boundary, measured perpendicular to the source-body line; positive
+    * outside the shadow.
+    */
+   double penumbra_distance; //!< trick_units(m)
+
+   /**
+    * Signed distance from the vehicle to the inner (umbral) shadow
+    * boundary, measured perpendicular to the source-body line; negative
+    * inside the umbra.
+    */
+   double umbra_distance; //!< trick_units(m)
+
+   /**
+    * Time at which the vehicle is predicted to leave its shadow region,
+    * extrapolated from the last two shadow evaluations.
+    */
+   double predicted_transition_time; //!< trick_units(s)
+
+   /**
+    * Time of the last shadow evaluation.
+    */
+   double shadow_eval_time; //!< trick_units(s)
+
+   /**
+    * Time before which the shadow geometry need not be evaluated.
+    */
+   double next_shadow_check_time; //!< trick_units(s)
+
+   /**
+    * Shadow region of the previous evaluation.
+    */
+   ShadowRegion prev_shadow_region; //!< trick_units(--)
+
+   /**
+    * Distance to the boundary of the previous evaluation's region, used to
+    * estimate the rate of approach to that boundary.
+    */
+   double prev_boundary_margin; //!< trick_units(m)
+
+   /**
+    * Indicates prev_shadow_region and prev_boundary_margin hold the results
+    * of an earlier evaluation.
+    */
+   bool have_prev_shadow; //!< trick_units(--)
+
+
 
 // Member functions
 public:
@@ -272,6 +349,36 @@ public:
    virtual void accumulate_rad_flux( RadiationBaseFacet * veh_surf_elem JEOD_UNUSED ,
                                      bool calculate_forces JEOD_UNUSED ) {};
 
+   /**
+    * Getter for the shadow region found by the last shadow evaluation.
+    * @return shadow_region
+    */
+   ShadowRegion get_shadow_region() const {return shadow_region;}
+
+   /**
+    * Getter for the signed distance to the penumbral boundary. It changes
+    * sign on shadow entry and exit, so it can serve as the error function
+    * of a simulation-level integration event.
+    * @return penumbra_distance
+    */
+   double get_penumbra_distance() const {return penumbra_distance;}
+
+   /**
+    * Getter for the signed distance to the umbral boundary. It changes
+    * sign on umbra entry and exit.
+    * @return umbra_distance
+    */
+   double get_umbra_distance() const {return umbra_distance;}
+
+   /**
+    * Getter for the predicted shadow transition time.
+    * @return predicted_transition_time
+    */
+   double get_predicted_transition_time() const
+   {
+      return predicted_transition_time;
+   }
+
    /**
     * Identifies this class as one that does not produce a radiaiton field
     * @return false
@@ -296,6 +403,7 @@ public:
 protected:
    double generate_alpha( double rho_adj, double delta);
    bool test_for_state_update( double time );
+   void predict_shadow_transition( double real_time );
    virtual bool update_third_body_state( void );
 
 
@@ -0,0 +1,290 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/src/cylinder_radiation_facet.cc
+ * Define member functions for class CylinderRadiationFacet
+ */
+
+/*****************************************************************************
+PURPOSE:
+()
+
+REFERENCE:
+(((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+((Only the lateral surface of the cylinder is modeled))
+
+LIBRARY DEPENDENCY:
+((cylinder_radiation_facet.cc)
+(radiation_facet.cc)
+(radiation_messages.cc)
+(radiation_params.cc)
+(interactions/thermal_rider/src/thermal_facet_rider.cc)
+(utils/message/src/message_handler.cc)
+(utils/surface_model/src/cylinder_thermal.cc))
+
+
+
+******************************************************************************/
+
+
+// System includes
+#include <cmath>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/surface_model/include/cylinder_thermal.hh"
+
+// Model includes
+#include "../include/cylinder_radiation_facet.hh"
+#include "../include/radiation_messages.hh"
+#include "../include/radiation_params.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a CylinderRadiationFacet
+ */
+CylinderRadiationFacet::CylinderRadiationFacet
+(
+   void) : // Return: -- void
+   axis(nullptr),
+   radius(0.0),
+   length(0.0)
+{
+   Vector3::initialize(torque_center);
+}
+
+
+/**
+ * Defines the facet data values. The heat capacity set by
+ * define_facet_core is replaced by that of the lateral surface.
+ * \param[in] cylinder pointer to the cylinder object
+ * \param[in] params pointer to the set of parameters for the facet
+ */
+void
+CylinderRadiationFacet::define_facet (
+   CylinderThermal * cylinder,
+   RadiationParams * params)
+{
+   // The center and axis are dynamic if the surface is articulated, so
+   // they are pointed to rather than copied.
+   center_pressure = cylinder->position;
+   axis = cylinder->normal;
+
+   radius = cylinder->radius;
+   length = cylinder->length;
+
+   thermal.heat_capacity = params->thermal.heat_capacity_per_area *
+                           lateral_area();
+
+   return;
+}
+
+
+/**
+ * Area of the lateral surface of the cylinder.
+ * @return The area\n Units: M2
+ */
+double
+CylinderRadiationFacet::lateral_area (
+   void)
+const
+{
+   return 2.0 * M_PI * radius * length;
+}
+
+
+/**
+ * Initializes the Facet for use in the model
+ * \param[in] center_grav center of gravity position\n Units: M
+ */
+void
+CylinderRadiationFacet::initialize_geom (
+   double center_grav[3])
+{
+   RadiationFacet::initialize();
+
+   thermal.initialize (base_facet->temperature, lateral_area());
+   Vector3::diff (center_pressure,
+                  center_grav,
+                  crot_to_cp);
+   return;
+}
+
+
+/**
+ * Zeroes the accumulated values, including the torque about the center.
+ */
+void
+CylinderRadiationFacet::initialize_runtime_values (
+   void)
+{
+   RadiationFacet::initialize_runtime_values();
+   Vector3::initialize (torque_center);
+   return;
+}
+
+
+/**
+ * Calculation of force and torque due to radiation pressure. With e the
+ * direction toward the source normal to the axis and w the sine of the
+ * angle between the axis and the flux, a surface element at angle psi from
+ * e is lit at an incidence whose sine is w cos(psi). Integrating the flat
+ * plate absorption and reflection over the lit half of the lateral surface
+ * gives a cross-sectional area of 2 r L w and
+ * - absorption: along the flux, as for a plate of that area;
+ * - diffuse reflection: along the flux less (2/3)(pi/4) e;
+ * - specular reflection: along -e, scaled by (2/3) w;
+ * - a torque about the center from the absorbed and diffusely reflected
+ *   momentum, along e x flux.
+ *
+ * \par Assumptions and Limitations
+ *  - Only called when flux_mag > 0
+ * \param[in] flux_mag incident flux (per unit area)\n Units: N/m
+ * \param[in] flux_struct_hat the flux unit vector in structural frame
+ * \param[in] calculate_forces on/off flag for whether to calculate forces.
+ */
+void
+CylinderRadiationFacet::incident_radiation (
+   const double flux_mag,
+   const double flux_struct_hat[3],
+   const bool calculate_forces)
+{
+   // Direction toward the source, normal to the axis.
+   double source_hat[3];
+   Vector3::scale (axis,
+                   Vector3::dot (axis, flux_struct_hat),
+                   source_hat);
+   Vector3::diff (source_hat, flux_struct_hat, source_hat);
+   double sin_cross = Vector3::vmag (source_hat);
+   if (sin_cross <= 0.0) { /* flux along the axis; lateral surface is not lit */
+      return;
+   }
+   Vector3::scale (1.0 / sin_cross, source_hat);
+
+   cx_area               = 2.0 * radius * length * sin_cross;
+
+   areaxflux_e           = cx_area * flux_mag;
+   thermal.power_absorb += (1.0 - albedo) * areaxflux_e;
+
+   if (!calculate_forces) {
+      return;
+   }
+
+   // Convert to momentum
+   areaxflux = areaxflux_e / speed_of_light;
+
+   double tempvec1[3];
+   double tempvec2[3];
+   // absorption
+   Vector3::scale (flux_struct_hat,
+                   areaxflux * (1.0 - albedo),
+                   tempvec1);
+   Vector3::incr (tempvec1,
+                  F_absorption);
+
+   // reflection
+   double ref_flux = areaxflux * albedo; // total reflected flux
+
+   // diffuse reflection
+   Vector3::scale (source_hat,
+                   two_thirds * M_PI_4,
+                   tempvec1);
+   Vector3::diff (flux_struct_hat,
+                  tempvec1,
+                  tempvec2);
+   Vector3::scale (diffuse * ref_flux,
+                   tempvec2);
+   Vector3::incr (tempvec2,
+                  F_diffuse);
+
+   // specular reflection
+   Vector3::scale (source_hat,
+                   2 * (diffuse - 1) * ref_flux * two_thirds * sin_cross,
+                   tempvec1); // (diffuse-1) < 0, this makes F point away
+   // from the source
+   Vector3::incr (tempvec1,
+                  F_specular);
+
+   // The absorbed and diffusely reflected momentum is not centered on the
+   // axis; the specular part acts along each element's normal.
+   Vector3::cross (source_hat,
+                   flux_struct_hat,
+                   tempvec1);
+   Vector3::scale_incr (tempvec1,
+                        ((1.0 - albedo) + diffuse * albedo) *
+                        areaxflux * radius * M_PI_4,
+                        torque_center);
+
+   return;
+}
+
+
+
+/**
+ * Calculates the accumulated force and torque acting on a facet. The
+ * thermal emission of a uniformly heated lateral surface cancels.
+ */
+void
+CylinderRadiationFacet::radiation_pressure (
+   void)
+{
+   if (thermal.integrable_object.active) {
+      thermal.integrable_object.compute_temp_dot();
+   }
+
+   if (thermal.power_emit < 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, RadiationMessages::unknown_numerical_error, "\n"
+         "On facet(%s), the calculation of emitted power yielded negative emission"
+         ",\n which is a non-physical situation corresponding to emission \n"
+         "producing a net gain in thermal energy.\n", base_facet->name.c_str());
+   }
+   Vector3::initialize (F_emission);
+
+   //  Combining, accumulating
+   Vector3::sum ( F_absorption,
+                  F_specular,
+                  F_diffuse,
+                  force);
+
+   // - Reminder crot_to_cp is the moment arm from cg (center of rotation) to
+   // the center of the cylinder
+   Vector3::cross (crot_to_cp,
+                   force,
+                   torque);
+   Vector3::incr (torque_center,
+                  torque);
+
+   return;
+}
+
+/**
+ * Destructor for CylinderRadiationFacet
+ */
+CylinderRadiationFacet::~CylinderRadiationFacet (
+   void)
+{
+
+   // empty for now
+
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
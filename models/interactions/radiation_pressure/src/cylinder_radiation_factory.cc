@@ -0,0 +1,217 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/src/cylinder_radiation_factory.cc
+ * Factory that creates a CylinderRadiationFacet, from a facet model
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+      ((None))
+
+Library dependencies:
+   ((cylinder_radiation_factory.cc)
+    (cylinder_radiation_facet.cc)
+    (radiation_facet.cc)
+    (radiation_messages.cc)
+    (radiation_params.cc)
+    (utils/message/src/message_handler.cc)
+    (utils/surface_model/src/facet.cc)
+    (utils/surface_model/src/facet_params.cc)
+    (utils/surface_model/src/cylinder_thermal.cc)
+    (utils/surface_model/src/interaction_facet_factory.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cstddef>
+#include <typeinfo>
+
+// JEOD includes
+#include "utils/surface_model/include/cylinder_thermal.hh" //includes Facet
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/cylinder_radiation_factory.hh"
+#include "../include/radiation_params.hh"  // includes FacetParams
+#include "../include/cylinder_radiation_facet.hh"
+#include "../include/radiation_messages.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+// Attributes used in allocations
+JEOD_DECLARE_ATTRIBUTES (CylinderRadiationFacet)
+
+
+/**
+ * Constructor for CylinderRadiationFactory
+ */
+CylinderRadiationFactory::CylinderRadiationFactory (
+   void)
+{
+   JEOD_REGISTER_CLASS(CylinderRadiationFacet);
+}
+
+
+/**
+ * Records the data for the Cylinder Radiation Facet.
+ * @return pointer to the interaction facet that this function creates.
+ * \param[in] facet pointer to the facet
+ * \param[in] params pointer to the set of parameters for the facet.
+ */
+InteractionFacet*
+CylinderRadiationFactory::create_facet (
+   Facet* facet,
+   FacetParams* params)
+{
+   RadiationParams* radiation_params = nullptr;
+   CylinderThermal* cylinder         = nullptr;
+
+   radiation_params = dynamic_cast<RadiationParams*> (params);
+   cylinder         = dynamic_cast<CylinderThermal*> (facet);
+
+   if (radiation_params == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, RadiationMessages::invalid_setup_error, "\n"
+         "The parameter list sent to the Cylinder Radiation Factory is\n"
+         "not a set of radiation parameters.  Radiation parameters\n"
+         "(class RadiationParams) should have the following elements:\n"
+         "name, albedo, diffuse, thermal.emissivity, "
+         "thermal.heat_capacity_per_area, \n"
+         "and (optional, default to 0.0) thermal.thermal_power_dump .\n");
+   }
+   if (cylinder == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, RadiationMessages::invalid_setup_error, "\n"
+         "The Facet sent to the Cylinder Radiation Factory is\n"
+         "not a Thermal Cylinder.  All Radiation facets must be \n"
+         "Thermal Facets (consider changing from Cylinder to \n"
+         "CylinderThermal in the data file that defines the radiation\n"
+         "surface).  This particular factory can only handle\n"
+         "Cylinders, a different factory must be used for any other\n"
+         "geometry.\n");
+   }
+
+   CylinderRadiationFacet* cyl_facet =
+      JEOD_ALLOC_CLASS_OBJECT (CylinderRadiationFacet, ());
+
+   cyl_facet->base_facet = facet;
+
+   // As in FlatPlateRadiationFactory::create_facet.
+   cyl_facet->RadiationFacet::define_facet_core (cylinder,
+                                                 cylinder->thermal,
+                                                 radiation_params);
+
+   // This call is specific to the facet geometry.
+   cyl_facet->define_facet (cylinder, radiation_params);
+
+   return cyl_facet;
+
+}
+
+/**
+ * Records the data for several Cylinder Radiation Facets, all created in
+ * one block.
+ * @return The first facet of the block, which is the allocated array, or
+ * NULL if a facet or its parameters are not of the required types; in that
+ * case create_facet reports the problem.
+ * \param[in] facets pointers to the facets
+ * \param[in] params pointers to the set of parameters for each facet.
+ * \param[in] count number of facets.
+ * \param[out] inter_facets the interaction facet created for each facet.
+ */
+InteractionFacet*
+CylinderRadiationFactory::create_facets (
+   Facet** facets,
+   FacetParams** params,
+   unsigned int count,
+   InteractionFacet** inter_facets)
+{
+   if (count == 0) {
+      return nullptr;
+   }
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if ((dynamic_cast<RadiationParams*> (params[ii]) == nullptr) ||
+          (dynamic_cast<CylinderThermal*> (facets[ii]) == nullptr)) {
+         return nullptr;
+      }
+   }
+
+   CylinderRadiationFacet* block =
+      JEOD_ALLOC_CLASS_ARRAY (count, CylinderRadiationFacet);
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      RadiationParams* radiation_params =
+         dynamic_cast<RadiationParams*> (params[ii]);
+      CylinderThermal* cylinder =
+         dynamic_cast<CylinderThermal*> (facets[ii]);
+      CylinderRadiationFacet* cyl_facet = &block[ii];
+
+      cyl_facet->base_facet = facets[ii];
+
+      // As in create_facet.
+      cyl_facet->RadiationFacet::define_facet_core (cylinder,
+                                                    cylinder->thermal,
+                                                    radiation_params);
+      cyl_facet->define_facet (cylinder, radiation_params);
+
+      inter_facets[ii] = cyl_facet;
+   }
+
+   return block;
+
+}
+
+/**
+ * Tests to ensure that the factory can function on the facet as
+ * intended.
+ * @return Boolean, is this the correct factory?
+ * \param[in] facet pointer to the facet being manipulated by the factory
+ */
+bool
+CylinderRadiationFactory::is_correct_factory (
+   Facet* facet)
+{
+
+   if (typeid(*facet) == typeid(CylinderThermal)) {
+      return true;
+   }
+   else {
+      return false;
+   }
+
+}
+
+
+
+/**
+ * Destructor for CylinderRadiationFactory
+ */
+CylinderRadiationFactory::~CylinderRadiationFactory (
+   void)
+{
+   // empty for now
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
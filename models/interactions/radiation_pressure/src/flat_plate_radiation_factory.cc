@@ -126,6 +126,60 @@ FlatPlateRadiationFactory::create_facet (
 
 }
 
+/**
+ * Records the data for several Flat Plate Radiation Facets, all created in
+ * one block.
+ * @return The first facet of the block, which is the allocated array, or
+ * NULL if a facet or its parameters are not of the required types; in that
+ * case create_facet reports the problem.
+ * \param[in] facets pointers to the facets
+ * \param[in] params pointers to the set of parameters for each facet.
+ * \param[in] count number of facets.
+ * \param[out] inter_facets the interaction facet created for each facet.
+ */
+InteractionFacet*
+FlatPlateRadiationFactory::create_facets (
+   Facet** facets,
+   FacetParams** params,
+   unsigned int count,
+   InteractionFacet** inter_facets)
+{
+   if (count == 0) {
+      return nullptr;
+   }
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if ((dynamic_cast<RadiationParams*> (params[ii]) == nullptr) ||
+          (dynamic_cast<FlatPlateThermal*> (facets[ii]) == nullptr)) {
+         return nullptr;
+      }
+   }
+
+   FlatPlateRadiationFacet* block =
+      JEOD_ALLOC_CLASS_ARRAY (count, FlatPlateRadiationFacet);
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      RadiationParams* radiation_params =
+         dynamic_cast<RadiationParams*> (params[ii]);
+      FlatPlateThermal* flat_plate =
+         dynamic_cast<FlatPlateThermal*> (facets[ii]);
+      FlatPlateRadiationFacet* fpr_facet = &block[ii];
+
+      fpr_facet->base_facet = facets[ii];
+
+      // As in create_facet.
+      fpr_facet->RadiationFacet::define_facet_core (flat_plate,
+                                                    flat_plate->thermal,
+                                                    radiation_params);
+      fpr_facet->define_facet (flat_plate);
+
+      inter_facets[ii] = fpr_facet;
+   }
+
+   return block;
+
+}
+
 /**
  * Tests to ensure that the factory can function on the facet as
  * intended.
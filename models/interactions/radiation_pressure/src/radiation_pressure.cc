@@ -127,6 +127,7 @@ RadiationPressure::update (
                            JeodSimulationInterface::get_job_cycle() * scale_factor;
 
 
+   source.update_source (real_time);
    source.calculate_flux (veh_struc_frame,
                               center_grav);
 
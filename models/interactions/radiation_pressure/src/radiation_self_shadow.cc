@@ -0,0 +1,444 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/src/radiation_self_shadow.cc
+ * Facet-on-facet shadowing of the primary source by a vehicle's own surface
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+()
+
+Library dependencies:
+((radiation_self_shadow.cc)
+(radiation_surface.cc)
+(flat_plate_radiation_facet.cc)
+(utils/surface_model/src/flat_plate_circular.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/surface_model/include/flat_plate_circular.hh"
+
+// Model includes
+#include "../include/radiation_self_shadow.hh"
+#include "../include/radiation_surface.hh"
+#include "../include/flat_plate_radiation_facet.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+   // Largest number of disks held in a hierarchy leaf.
+   const unsigned int max_leaf_disks = 4;
+
+   // Hits closer than this to a ray origin are ignored, so that a facet is
+   // not shadowed by coplanar neighbors.
+   const double min_hit_distance = 1.0e-9; // m
+}
+
+
+/**
+ * Constructor for RadiationSelfShadow
+ */
+RadiationSelfShadow::RadiationSelfShadow (
+   void)
+:
+   direction_tolerance(1.0e-3),
+   num_ring_samples(0),
+   lit_fraction(),
+   built(false),
+   fractions_valid(false),
+   num_disks(0)
+{
+   Vector3::initialize (last_to_source);
+}
+
+
+/**
+ * Destructor for RadiationSelfShadow
+ */
+RadiationSelfShadow::~RadiationSelfShadow (
+   void)
+{
+   // empty
+}
+
+
+/**
+ * Force the facet disks, the hierarchy and the illuminated fractions to be
+ * rebuilt on the next update, e.g. after the surface articulates.
+ */
+void
+RadiationSelfShadow::invalidate (
+   void)
+{
+   built = false;
+   fractions_valid = false;
+}
+
+
+/**
+ * Update the illuminated fraction of each facet. The fractions are
+ * recomputed only when the source direction has moved by more than
+ * direction_tolerance since they were last computed.
+ * \param[in] surface The radiation surface
+ * \param[in] flux_struc_hat unit vector of incident flux, structural frame
+ */
+void
+RadiationSelfShadow::update (
+   RadiationSurface & surface,
+   const double flux_struc_hat[3])
+{
+   if ((!built) || (num_disks != surface.num_facets)) {
+      build (surface);
+   }
+
+   double to_source[3];
+   Vector3::negate (flux_struc_hat, to_source);
+
+   if ((!fractions_valid) ||
+       (Vector3::dot (to_source, last_to_source) <
+        std::cos (direction_tolerance))) {
+      compute_lit_fractions (to_source);
+      Vector3::copy (to_source, last_to_source);
+      fractions_valid = true;
+   }
+}
+
+
+/**
+ * Represent each flat plate facet by a disk and build the hierarchy.
+ * \param[in] surface The radiation surface
+ */
+void
+RadiationSelfShadow::build (
+   RadiationSurface & surface)
+{
+   num_disks = surface.num_facets;
+   lit_fraction.assign (num_disks, 1.0);
+   disk_radius.assign (num_disks, 0.0);
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      disk_center[kk].assign (num_disks, 0.0);
+      disk_normal[kk].assign (num_disks, 0.0);
+   }
+   ordered_disks.clear();
+
+   for (unsigned int ii = 0; ii < num_disks; ++ii) {
+      FlatPlateRadiationFacet * plate =
+         dynamic_cast<FlatPlateRadiationFacet *> (surface.facets[ii]);
+      if (plate == nullptr) {
+         continue;
+      }
+
+      const FlatPlateCircular * circle =
+         dynamic_cast<const FlatPlateCircular *> (plate->base_facet);
+      if (circle != nullptr) {
+         disk_radius[ii] = circle->radius;
+      }
+      else {
+         disk_radius[ii] = std::sqrt (plate->base_facet->area / M_PI);
+      }
+      if (disk_radius[ii] <= 0.0) {
+         disk_radius[ii] = 0.0;
+         continue;
+      }
+
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         disk_center[kk][ii] = plate->center_pressure[kk];
+         disk_normal[kk][ii] = plate->normal[kk];
+      }
+      ordered_disks.push_back (ii);
+   }
+
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      node_min[kk].clear();
+      node_max[kk].clear();
+   }
+   node_second.clear();
+   node_first.clear();
+   node_count.clear();
+
+   if (! ordered_disks.empty()) {
+      build_node (0, static_cast<unsigned int> (ordered_disks.size()));
+   }
+
+   built = true;
+   fractions_valid = false;
+}
+
+
+/**
+ * Build the hierarchy node covering ordered_disks[first, last), splitting
+ * at the median disk center along the axis of greatest spread.
+ * \param[in] first First entry of ordered_disks covered by the node
+ * \param[in] last One past the last entry covered by the node
+ * \return Index of the node
+ */
+unsigned int
+RadiationSelfShadow::build_node (
+   unsigned int first,
+   unsigned int last)
+{
+   unsigned int node = static_cast<unsigned int> (node_first.size());
+   unsigned int count = last - first;
+
+   node_first.push_back (first);
+   node_count.push_back (count);
+   node_second.push_back (0);
+
+   double box_min[3];
+   double box_max[3];
+   double center_min[3];
+   double center_max[3];
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      box_min[kk] = center_min[kk] = HUGE_VAL;
+      box_max[kk] = center_max[kk] = -HUGE_VAL;
+   }
+
+   for (unsigned int jj = first; jj < last; ++jj) {
+      unsigned int disk = ordered_disks[jj];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         double center = disk_center[kk][disk];
+         double normal = disk_normal[kk][disk];
+         // A disk's extent along an axis is its radius times the sine of
+         // the angle between the axis and the disk normal.
+         double extent = disk_radius[disk] *
+                         std::sqrt (std::max (0.0, 1.0 - normal * normal));
+         box_min[kk] = std::min (box_min[kk], center - extent);
+         box_max[kk] = std::max (box_max[kk], center + extent);
+         center_min[kk] = std::min (center_min[kk], center);
+         center_max[kk] = std::max (center_max[kk], center);
+      }
+   }
+
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      node_min[kk].push_back (box_min[kk]);
+      node_max[kk].push_back (box_max[kk]);
+   }
+
+   if (count <= max_leaf_disks) {
+      return node;
+   }
+
+   unsigned int axis = 0;
+   for (unsigned int kk = 1; kk < 3; ++kk) {
+      if (center_max[kk] - center_min[kk] >
+          center_max[axis] - center_min[axis]) {
+         axis = kk;
+      }
+   }
+
+   const std::vector<double> & axis_center = disk_center[axis];
+   unsigned int mid = first + count / 2;
+   std::nth_element (
+      ordered_disks.begin() + first,
+      ordered_disks.begin() + mid,
+      ordered_disks.begin() + last,
+      [&axis_center] (unsigned int left, unsigned int right)
+      {
+         return axis_center[left] < axis_center[right];
+      });
+
+   build_node (first, mid);
+   unsigned int second = build_node (mid, last);
+   node_second[node] = second;
+
+   return node;
+}
+
+
+/**
+ * Test whether a ray from a point on one facet toward the source strikes
+ * any other facet.
+ * \param[in] origin Ray origin, structural frame\n Units: M
+ * \param[in] direction Unit vector toward the source, structural frame
+ * \param[in] inv_direction Componentwise inverse of direction
+ * \param[in] self Index of the facet the ray leaves from
+ * \return True if the ray is blocked
+ */
+bool
+RadiationSelfShadow::is_occluded (
+   const double origin[3],
+   const double direction[3],
+   const double inv_direction[3],
+   unsigned int self) const
+{
+   // The hierarchy depth is bounded by log2 of the disk count.
+   unsigned int stack[64];
+   unsigned int stack_size = 0;
+   stack[stack_size++] = 0;
+
+   while (stack_size > 0) {
+      unsigned int node = stack[--stack_size];
+
+      // Slab test of the ray against the node's bounding box.
+      double t_near = 0.0;
+      double t_far = HUGE_VAL;
+      bool missed = false;
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         if (direction[kk] == 0.0) {
+            if ((origin[kk] < node_min[kk][node]) ||
+                (origin[kk] > node_max[kk][node])) {
+               missed = true;
+               break;
+            }
+            continue;
+         }
+         double t_min = (node_min[kk][node] - origin[kk]) * inv_direction[kk];
+         double t_max = (node_max[kk][node] - origin[kk]) * inv_direction[kk];
+         if (t_min > t_max) {
+            std::swap (t_min, t_max);
+         }
+         t_near = std::max (t_near, t_min);
+         t_far = std::min (t_far, t_max);
+         if (t_near > t_far) {
+            missed = true;
+            break;
+         }
+      }
+      if (missed) {
+         continue;
+      }
+
+      if (node_second[node] != 0) {
+         stack[stack_size++] = node_second[node];
+         stack[stack_size++] = node + 1;
+         continue;
+      }
+
+      unsigned int end = node_first[node] + node_count[node];
+      for (unsigned int jj = node_first[node]; jj < end; ++jj) {
+         unsigned int disk = ordered_disks[jj];
+         if (disk == self) {
+            continue;
+         }
+
+         double to_center[3];
+         double normal[3];
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            to_center[kk] = disk_center[kk][disk] - origin[kk];
+            normal[kk] = disk_normal[kk][disk];
+         }
+         double denom = Vector3::dot (direction, normal);
+         if (std::fabs (denom) < 1.0e-12) {
+            continue;
+         }
+         double t_hit = Vector3::dot (to_center, normal) / denom;
+         if (t_hit <= min_hit_distance) {
+            continue;
+         }
+
+         double offset[3];
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            offset[kk] = t_hit * direction[kk] - to_center[kk];
+         }
+         if (Vector3::vmagsq (offset) <= disk_radius[disk] * disk_radius[disk]) {
+            return true;
+         }
+      }
+   }
+
+   return false;
+}
+
+
+/**
+ * Recompute the illuminated fraction of each facet as the fraction of its
+ * sample points that have an unobstructed view of the source. All rays are
+ * parallel, so the inverse direction is formed once for the whole pass.
+ * Facets facing away from the source are left fully lit; the facet model
+ * already gives them no incident flux.
+ * \param[in] to_source Unit vector toward the source, structural frame
+ */
+void
+RadiationSelfShadow::compute_lit_fractions (
+   const double to_source[3])
+{
+   double inv_direction[3];
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      inv_direction[kk] = (to_source[kk] != 0.0) ? 1.0 / to_source[kk] : 0.0;
+   }
+
+   double num_samples = 1.0 + num_ring_samples;
+
+   for (unsigned int ii = 0; ii < num_disks; ++ii) {
+      lit_fraction[ii] = 1.0;
+
+      double radius = disk_radius[ii];
+      if (radius <= 0.0) {
+         continue;
+      }
+
+      double center[3];
+      double normal[3];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         center[kk] = disk_center[kk][ii];
+         normal[kk] = disk_normal[kk][ii];
+      }
+      if (Vector3::dot (normal, to_source) <= 0.0) {
+         continue;
+      }
+
+      unsigned int num_lit = 0;
+      if (! is_occluded (center, to_source, inv_direction, ii)) {
+         ++num_lit;
+      }
+
+      if (num_ring_samples > 0) {
+         // Ring samples lie on the circle that halves the disk area.
+         double axis_u[3];
+         double axis_v[3];
+         double seed[3] = {0.0, 0.0, 0.0};
+         unsigned int min_axis = 0;
+         for (unsigned int kk = 1; kk < 3; ++kk) {
+            if (std::fabs (normal[kk]) < std::fabs (normal[min_axis])) {
+               min_axis = kk;
+            }
+         }
+         seed[min_axis] = 1.0;
+         Vector3::cross (normal, seed, axis_u);
+         Vector3::normalize (axis_u);
+         Vector3::cross (normal, axis_u, axis_v);
+
+         double ring_radius = radius * M_SQRT1_2;
+         for (unsigned int ss = 0; ss < num_ring_samples; ++ss) {
+            double angle = (2.0 * M_PI * ss) / num_ring_samples;
+            double cos_a = ring_radius * std::cos (angle);
+            double sin_a = ring_radius * std::sin (angle);
+            double sample[3];
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               sample[kk] = center[kk] + cos_a * axis_u[kk] + sin_a * axis_v[kk];
+            }
+            if (! is_occluded (sample, to_source, inv_direction, ii)) {
+               ++num_lit;
+            }
+         }
+      }
+
+      lit_fraction[ii] = num_lit / num_samples;
+   }
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
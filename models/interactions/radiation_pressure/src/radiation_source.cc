@@ -30,6 +30,8 @@ LIBRARY DEPENDENCY:
    ((radiation_source.cc)
     (radiation_messages.cc)
     (radiation_third_body.cc)
+    (environment/time/src/eop_table_file.cc)
+    (utils/integration/src/timestamp_cache.cc)
     (utils/message/src/message_handler.cc))
 
 
@@ -42,6 +44,7 @@ LIBRARY DEPENDENCY:
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "utils/math/include/sorted_table.hh"
 #include "utils/math/include/vector3.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
@@ -66,7 +69,13 @@ RadiationSource::RadiationSource (
 :
    solar_luminosity(3.827E+26),
    solar_radius(6.98E+08),
-   name("Sun")
+   name("Sun"),
+   flux_table_file(),
+   source_cache(),
+   flux_table(),
+   flux_table_when(nullptr),
+   flux_table_luminosity(nullptr),
+   flux_table_cursor(0)
 {
    Vector3::initialize (flux_hat);
    flux_mag           = 0.0;
@@ -88,6 +97,42 @@ RadiationSource::RadiationSource (
 
 /* ENTRY POINT: */
 
+/**
+ * Updates the state of the source that depends only on time: the
+ * luminosity, when interpolated from a luminosity table. The lookup is done
+ * once per time, however many vehicles share the source. Outside of the
+ * table, the luminosity is held at its first or last value.
+ * \param[in] time Time in the time scale of the table\n Units: s
+ */
+void
+RadiationSource::update_source (
+   double time)
+{
+   if ((flux_table_when == nullptr) || (! source_cache.needs_update (time))) {
+      return;
+   }
+
+   unsigned int row = SortedTable::find_interval (
+      flux_table_when, flux_table.num_rows(), time, flux_table_cursor);
+   flux_table_cursor = row;
+
+   double t0 = flux_table_when[row];
+   double t1 = flux_table_when[row + 1];
+   double frac = (time - t0) / (t1 - t0);
+   if (frac < 0.0) {
+      frac = 0.0;
+   }
+   else if (frac > 1.0) {
+      frac = 1.0;
+   }
+
+   luminosity = flux_table_luminosity[row] +
+                frac * (flux_table_luminosity[row + 1] -
+                        flux_table_luminosity[row]);
+   return;
+}
+
+
 /**
  * calculates the flux vector from the vehicle's position.
  * \param[in] veh_struc_frame the vehicle structural reference frame
@@ -157,6 +202,76 @@ RadiationSource::calculate_flux (
 }
 
 
+/**
+ * Calculates the flux from this source at many vehicles at once, as the
+ * single-vehicle calculate_flux does for each vehicle in turn. The source
+ * state is read once for the whole set and the members of this object are
+ * not modified; third body adjustments are left to the caller.
+ * \param[in] num_veh Number of vehicles
+ * \param[in] veh_struc_frames The vehicle structural reference frames
+ * \param[in] center_grav Position of each vehicle center of mass in its
+ *            structural frame\n Units: M
+ * \param[out] flux_inertial_out Flux vector at each vehicle, inertial\n Units: N/m2
+ * \param[out] flux_mag_out Flux magnitude at each vehicle\n Units: N/m2
+ * \param[out] flux_struc_hat_out Flux direction at each vehicle, structural;
+ *             may be NULL
+ */
+void
+RadiationSource::calculate_flux (
+   unsigned int num_veh,
+   RefFrame * const veh_struc_frames[],
+   const double center_grav[][3],
+   double flux_inertial_out[][3],
+   double flux_mag_out[],
+   double flux_struc_hat_out[][3])
+const
+{
+   // The source state is shared by all vehicles.
+   bool dark = (luminosity < 1.0E-6);
+
+   for (unsigned int iveh = 0; iveh < num_veh; ++iveh) {
+      RefFrame & veh_struc_frame = *veh_struc_frames[iveh];
+      double veh_source_to_struc_origin[3];
+      double veh_inertial_cg[3];
+      double veh_source_to_cg[3];
+      double veh_flux_hat[3];
+      double veh_flux_struc[3];
+
+      if (dark) {
+         flux_mag_out[iveh] = 0.0;
+         Vector3::initialize (flux_inertial_out[iveh]);
+         if (flux_struc_hat_out != nullptr) {
+            Vector3::initialize (flux_struc_hat_out[iveh]);
+         }
+         continue;
+      }
+
+      veh_struc_frame.compute_position_from (*inertial_frame_ptr,
+                                             veh_source_to_struc_origin);
+      Vector3::transform_transpose (veh_struc_frame.state.rot.T_parent_this,
+                                    center_grav[iveh],
+                                    veh_inertial_cg);
+      Vector3::sum (veh_source_to_struc_origin,
+                    veh_inertial_cg,
+                    veh_source_to_cg);
+
+      double d_cg = Vector3::vmag (veh_source_to_cg);
+      Vector3::scale (veh_source_to_cg, 1 / d_cg, veh_flux_hat);
+
+      flux_mag_out[iveh] = luminosity / (d_cg * d_cg * 4 * M_PI);
+      Vector3::scale (veh_flux_hat, flux_mag_out[iveh], flux_inertial_out[iveh]);
+
+      if (flux_struc_hat_out != nullptr) {
+         Vector3::transform (veh_struc_frame.state.rot.T_parent_this,
+                             flux_inertial_out[iveh],
+                             veh_flux_struc);
+         Vector3::normalize (veh_flux_struc, flux_struc_hat_out[iveh]);
+      }
+   }
+   return;
+}
+
+
 
 /**
  * Initializes the source object for use in the Radiation Pressure model
@@ -179,6 +294,21 @@ RadiationSource::initialize (
 
    dyn_mgr_ptr->subscribe_to_frame (*inertial_frame_ptr);
 
+   // Map the luminosity table, if one was named.
+   if (! flux_table_file.empty()) {
+      flux_table.open (flux_table_file, "solar_flux");
+      flux_table_when       = flux_table.column ("when");
+      flux_table_luminosity = flux_table.column ("luminosity");
+      flux_table_cursor     = 0;
+      if (flux_table.num_rows() < 2) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, RadiationMessages::incomplete_setup_error, "\n"
+            "Luminosity table '%s' must have at least two rows.\n",
+            flux_table_file.c_str());
+      }
+      source_cache.invalidate ();
+   }
+
    return;
 }
 
@@ -23,6 +23,7 @@ ASSUMPTIONS AND LIMITATIONS:
 Library dependencies:
 ((radiation_surface.cc)
 (radiation_facet.cc)
+(radiation_self_shadow.cc)
 (radiation_messages.cc)
 (interactions/thermal_rider/src/thermal_facet_rider.cc)
 (utils/sim_interface/src/memory_interface.cc)
@@ -36,6 +37,7 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <vector>
 
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
@@ -69,6 +71,7 @@ RadiationSurface::RadiationSurface (
    num_facets         = 0;
    include_conduction = false;
    thermal_conduction = nullptr;
+   self_shadowing     = false;
 
    Vector3::initialize (force);
    Vector3::initialize (torque);
@@ -228,6 +231,67 @@ RadiationSurface::allocate_interaction_facet (
 
 }
 
+/**
+ * Turns the memory of several facets that share a factory into radiation
+ * facet memory, in one block if the factory supports it.
+ * \param[in] base_facets pointers to the facets
+ * \param[in] factory pointer to the facet factory
+ * \param[in] params pointers to the generic facet parameters.
+ * \param[in] indices index value of each facet in the facet list.
+ * \param[in] count number of facets.
+ */
+void
+RadiationSurface::allocate_interaction_facets (
+   Facet** base_facets,
+   InteractionFacetFactory* factory,
+   FacetParams** params,
+   const unsigned int* indices,
+   unsigned int count)
+{
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      if (num_facets <= indices[ii]) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, RadiationMessages::invalid_setup_error, "\n"
+            "Attempting to allocate data for facet number %i, but the model has\n"
+            "allocated space for only %i facets (num_facets = %i).\n",
+            indices[ii], num_facets, num_facets);
+
+         return;
+
+      }
+   }
+
+   std::vector<InteractionFacet*> created (count, nullptr);
+
+   if (! create_facet_block (base_facets, factory, params, count,
+                             created.data())) {
+      InteractionSurface::allocate_interaction_facets (
+         base_facets, factory, params, indices, count);
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      RadiationFacet* temp_radiation_facet =
+         dynamic_cast<RadiationFacet*> (created[ii]);
+
+      // The block is owned by the surface, so nothing is released here
+      if (temp_radiation_facet == nullptr) {
+         MessageHandler::fail (
+            __FILE__, __LINE__, RadiationMessages::operational_setup_error, "\n"
+            "The InteractionFacet temp_facet exists, but it is not a\n"
+            "RadiationFacet; the cast to RadiationFacet failed.\n");
+         return;
+
+      }
+
+      facets[indices[ii]] = temp_radiation_facet;
+   }
+
+   return;
+
+}
+
+
 
 /**
  * systematically calls the method to calculate the interaction on each facet.
@@ -241,6 +305,20 @@ RadiationSurface::incident_radiation (
    const double flux_struc_hat[3],
    bool calculate_forces)
 {
+   if (self_shadowing) {
+      // Facets see only the unshadowed part of the flux; fully shadowed
+      // facets are treated as unlit.
+      self_shadow.update (*this, flux_struc_hat);
+      for (ii_facet = 0; ii_facet < num_facets; ++ii_facet) {
+         double lit_fraction = self_shadow.lit_fraction[ii_facet];
+         if (lit_fraction > 0.0) {
+            facets[ii_facet]->incident_radiation (flux_mag * lit_fraction,
+                                                  flux_struc_hat,
+                                                  calculate_forces);
+         }
+      }
+      return;
+   }
 
    for (ii_facet = 0; ii_facet < num_facets; ++ii_facet) {
       facets[ii_facet]->incident_radiation (flux_mag,
@@ -304,6 +382,22 @@ RadiationSurface::thermal_integrator (
    return;
 }
 
+/**
+ * Collects the thermal rider of each facet.
+ * \param[out] riders The thermal riders, one per facet
+ */
+void
+RadiationSurface::collect_thermal_riders (
+   std::vector<ThermalFacetRider *> & riders)
+{
+   riders.clear();
+   riders.reserve (num_facets);
+   for (ii_facet = 0; ii_facet < num_facets; ++ii_facet) {
+      riders.push_back (&facets[ii_facet]->thermal);
+   }
+   return;
+}
+
 /**
  * systematically calls the method to ensure that the same for each facet.
  */
@@ -368,6 +462,23 @@ RadiationSurface::add_thermal_integrators_to
    }
 
 }
+/**
+ * Invalidate the self shadowing when facets of the surface articulate.
+ * Facets are indexed as in the SurfaceModel the surface was created from.
+ * \param[in] surface The surface model that articulated
+ * \param[in] changed_facets Indices of the facets that moved
+ */
+void
+RadiationSurface::facets_articulated (
+   const SurfaceModel & surface JEOD_UNUSED,
+   const std::vector<unsigned int> & changed_facets)
+{
+   if ((! changed_facets.empty()) && (changed_facets.front() < num_facets)) {
+      self_shadow.invalidate ();
+   }
+}
+
+
 /**
  * Destructor for RadiationSurface
  */
@@ -378,7 +489,9 @@ RadiationSurface::~RadiationSurface (
    if (facets != nullptr) {
 
       for (ii_facet = 0; ii_facet < num_facets; ++ii_facet) {
-         if (facets[ii_facet] != nullptr) {
+         // Facets created in a block are released by InteractionSurface
+         if ((facets[ii_facet] != nullptr) &&
+             (! is_block_facet (facets[ii_facet]))) {
             JEOD_DELETE_OBJECT (facets[ii_facet]);
          }
       }
@@ -23,6 +23,7 @@ ASSUMPTIONS AND LIMITATIONS:
 
 Library dependencies:
     ((radiation_surface_factory.cc)
+     (cylinder_radiation_factory.cc)
      (flat_plate_radiation_factory.cc)
      (radiation_messages.cc)
      (radiation_params.cc)
@@ -58,6 +59,7 @@ RadiationSurfaceFactory::RadiationSurfaceFactory (
    // push the facet factories that JEOD knows about onto the
    // factories list
    factories.push_back (&flat_plate_radiation_factory);
+   factories.push_back (&cylinder_radiation_factory);
 }
 
 /**
@@ -26,6 +26,7 @@ CLASS:
 LIBRARY DEPENDENCY:
     ((radiation_third_body.cc)
      (radiation_messages.cc)
+     (utils/math/src/occultation.cc)
      (utils/message/src/message_handler.cc))
 
 
@@ -33,11 +34,15 @@ LIBRARY DEPENDENCY:
 
 
 // System includes
+#include <algorithm>
 #include <cstddef>
+#include <cmath>
+#include <limits>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
 #include "environment/planet/include/planet.hh"
+#include "utils/math/include/occultation.hh"
 #include "utils/math/include/vector3.hh"
 #include "utils/message/include/message_handler.hh"
 //#include "utils/ref_frames/include/ref_frame.hh"
@@ -75,7 +80,16 @@ RadiationThirdBody::RadiationThirdBody ()
    r_ratio(0.0),
    r_par(0.0),
    r_perp(0.0),
-   d_source_to_third(0.0)
+   d_source_to_third(0.0),
+   shadow_region(Lit),
+   penumbra_distance(0.0),
+   umbra_distance(0.0),
+   predicted_transition_time(std::numeric_limits<double>::max()),
+   shadow_eval_time(0.0),
+   next_shadow_check_time(0.0),
+   prev_shadow_region(Lit),
+   prev_boundary_margin(0.0),
+   have_prev_shadow(false)
 {
    Vector3::initialize (output_flux);
    Vector3::initialize (third_to_cg_inrtl);
@@ -237,6 +251,9 @@ RadiationThirdBody::calculate_shadow (
    // vehicle:
    if (r_par < 0) {
       illum_factor = 1;
+      shadow_region = Lit;
+      penumbra_distance = -r_par;
+      umbra_distance = -r_par;
       return;
    }
 
@@ -255,6 +272,9 @@ RadiationThirdBody::calculate_shadow (
          "Putting the vehicle in total shadow and exiting.\n",
           r_mag2, name.c_str());
       illum_factor = 0.0;
+      shadow_region = Umbral;
+      penumbra_distance = 0.0;
+      umbra_distance = 0.0;
       return;
    }
 
@@ -272,11 +292,15 @@ RadiationThirdBody::calculate_shadow (
       // Cylindrical shadow (this is the easy one)
       // if vehicle is outside the cylindrical radius, it is outside the
       // shadow.  Otherwise it is in full shadow,
+      penumbra_distance = r_perp - radius;
+      umbra_distance = penumbra_distance;
       if (r_perp < radius) {
          illum_factor = 0;
+         shadow_region = Umbral;
       }
       else {
          illum_factor = 1;
+         shadow_region = Lit;
       }
       // done, return
    }
@@ -284,24 +308,6 @@ RadiationThirdBody::calculate_shadow (
    else if  (shadow_geometry == Conical ||
              shadow_geometry == Con ) {
       // Conical shadow
-      // NOTE: the "regions" have been ordered based on mathematical complexity
-      //       with the more complex regions coming late.  The more complex
-      //       computations require some of the same variables that are needed
-      //       for earlier computations.  Consequently, a design decision was
-      //       made to structure this as
-      //
-      //        if(...) {... return}
-      //        <build complexity>
-      //        if(...) { ... return}
-      //        etc.
-      //
-      //       rather than
-      //        if(...) {...}
-      //        else if(...) {...}
-      //        etc.
-      //       which would require replicating code in the respective "else"
-      //       blocks
-
       if (d_source_to_third <= 0.0) {
          MessageHandler::error(
             __FILE__, __LINE__, RadiationMessages::invalid_setup_error, "\n"
@@ -311,62 +317,27 @@ RadiationThirdBody::calculate_shadow (
             "Deactivating this body.\n", d_source_to_third, name.c_str());
          active = false;
          illum_factor = 1.0;
+         shadow_region = Lit;
+         penumbra_distance = 0.0;
+         umbra_distance = 0.0;
          return;
       }
 
-
-
-      double r_perp_x_d = r_perp * d_source_to_third;
-      double radius_x_d = radius * d_source_to_third;
-
-      if (r_perp_x_d >= (r_plus * r_par) + radius_x_d) { // Region B (none):
-         illum_factor = 1;
-         return;
-      }
-      if ( r_perp_x_d <= (r_minus * r_par) + radius_x_d) { // Region C (total):
-         illum_factor = 0;
-         return;
-      }
-
-      // Here is the first example of why I'm using if(){return}.  All
-      // subsequent calculations will require the ratio of the angular sizes,
-      // shadow-body over source, but the previous calculations did not.
-      // So doing that now.  ang_ratio is shadow-body over source.
-      double ang_ratio_2_a = r_ratio * primary_source_ptr->d_source_to_cg;
-      double ang_ratio_2 = ang_ratio_2_a * ang_ratio_2_a / r_mag2;
-
-
-      if (r_perp_x_d <= -((r_minus * r_par) + radius_x_d)) { // Region D (annular)
-         illum_factor =  1 - ang_ratio_2;
-         return;
-      }
-
-
-
-      double ang_ratio = sqrt (ang_ratio_2);
-      // Introduce 2 new variables:
-      // delta:    fraction of partial eclipse from first contact (0) to
-      //           totality (1).  Note the delta here starts with only the
-      //           numerator part of the delta in the document; the numerator
-      //           is identical for both cases but the denominator differs.
-      double delta = radius_x_d - r_perp_x_d +
-                     (radius + primary_source_ptr->radius) * r_par;
-      if (ang_ratio_2 >= 1) { // ThirdBody has a larger angular size
-         illum_factor = 1 - generate_alpha(
-                              1/ang_ratio,
-                              delta / (2*primary_source_ptr->radius * r_par));
-      }
-      else {
-         illum_factor = 1 - ang_ratio_2 *
-                        generate_alpha(
-                            ang_ratio,
-                            delta / (2 * radius * (d_source_to_third + r_par)));
-      }
+      // The Occultation regions are enumerated as the ShadowRegion values.
+      shadow_region = static_cast<ShadowRegion> (
+         Occultation::conical_shadow (
+            r_par, r_perp, r_mag2,
+            d_source_to_third, primary_source_ptr->d_source_to_cg,
+            radius, primary_source_ptr->radius,
+            illum_factor, penumbra_distance, umbra_distance));
       // done, return
    }
 
    else {
       illum_factor = 1;
+      shadow_region = Lit;
+      penumbra_distance = 0.0;
+      umbra_distance = 0.0;
    }
 }
 
@@ -384,23 +355,7 @@ RadiationThirdBody::generate_alpha (
    // Coefficients are empirically derived to provide close match
    // to circular geometry.  See documentation for origin of
    // these values.
-   double a3 =  0.758656 * rho_adj * rho_adj +
-               -0.0637441 * rho_adj -
-                1.08955;
-   double a2 = -1.2205 * rho_adj * rho_adj +
-                0.61815 * rho_adj +
-                1.62909;
-   double a1 =  0.43723 * rho_adj * rho_adj +
-               -0.52921 * rho_adj +
-                0.473649;
-   double a0 = -0.01242 * rho_adj * rho_adj * rho_adj +
-               -0.0036715 * rho_adj * rho_adj +
-                0.0150263 * rho_adj +
-               -0.0078259;
-   return a3 * delta * delta * delta +
-          a2 * delta * delta +
-          a1 * delta +
-          a0;
+   return Occultation::eclipse_alpha (rho_adj, delta);
 }
 
 /**
@@ -454,6 +409,14 @@ RadiationThirdBody::process_third_body (
       return 1.0;
    }
 
+   // While fully lit or fully shadowed the illumination factor is constant;
+   // reuse it until the predicted transition draws near.
+   if (predict_shadow_transitions &&
+       ((shadow_region == Lit) || (shadow_region == Umbral)) &&
+       (real_time >= shadow_eval_time) &&
+       (real_time < next_shadow_check_time)) {
+      return illum_factor;
+   }
 
    // if state-update fails, return an illumination factor of 1.0
    if (!test_for_state_update (real_time)) {
@@ -466,9 +429,68 @@ RadiationThirdBody::process_third_body (
    }
 
    calculate_shadow();
+
+   if (predict_shadow_transitions) {
+      predict_shadow_transition (real_time);
+   }
+
    return illum_factor;
 }
 
+/**
+ * Predicts when the vehicle will leave its current shadow region by
+ * extrapolating the distance to the region boundary from the last two
+ * evaluations, and schedules the next shadow evaluation. The next
+ * evaluation comes no later than halfway to the predicted transition, so
+ * evaluations cluster around the transitions; it is also bounded by
+ * max_shadow_check_interval.
+ * \param[in] real_time Current time\n Units: s
+ */
+void
+RadiationThirdBody::predict_shadow_transition (
+   double real_time)
+{
+   double margin;
+   switch (shadow_region) {
+   case Lit:
+      margin = penumbra_distance;
+      break;
+   case Umbral:
+      margin = -umbra_distance;
+      break;
+   case Penumbral:
+      margin = std::min (-penumbra_distance, umbra_distance);
+      break;
+   default:
+      margin = -umbra_distance;
+      break;
+   }
+
+   predicted_transition_time = std::numeric_limits<double>::max();
+   next_shadow_check_time = real_time;
+
+   double delta_t = real_time - shadow_eval_time;
+   if (have_prev_shadow &&
+       (shadow_region == prev_shadow_region) &&
+       (delta_t > 0.0)) {
+      double margin_rate = (margin - prev_boundary_margin) / delta_t;
+      double check_interval = max_shadow_check_interval;
+      if (margin_rate < 0.0) {
+         double time_to_go = margin / -margin_rate;
+         predicted_transition_time = real_time + time_to_go;
+         check_interval = std::min (0.5 * time_to_go, check_interval);
+      }
+      if ((shadow_region == Lit) || (shadow_region == Umbral)) {
+         next_shadow_check_time = real_time + check_interval;
+      }
+   }
+
+   prev_shadow_region = shadow_region;
+   prev_boundary_margin = margin;
+   have_prev_shadow = true;
+   shadow_eval_time = real_time;
+}
+
 /**
  * Tests for necessity of updating third body state, and calls
  * appropriate update method (polymorphic) if needed.
@@ -69,7 +69,9 @@
 //! Namespace jeod
 namespace jeod {
 
+class ThermalFacetBatch;
 class ThermalFacetRider;
+class ThermalIntervalStep;
 class ThermalModelRider;
 class ThermalMessages;
 class ThermalParams;
@@ -0,0 +1,199 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup ThermalRider
+ * @{
+ *
+ * @file models/interactions/thermal_rider/include/thermal_facet_batch.hh
+ * Multirate temperature integration for all facets of a surface
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((The absorbed power is averaged over each integration interval, so
+      variations faster than the interval are not resolved.)
+     (Facets integrated by a ThermalIntegrableObject are not stepped by the
+      batch; their temperature is read from the integrable object.))
+
+Library dependencies:
+    ((../src/thermal_facet_batch.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_THERMAL_FACET_BATCH_HH
+#define JEOD_THERMAL_FACET_BATCH_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+class InteractionSurface;
+class ThermalFacetRider;
+
+
+/**
+ * Integrates the temperatures of all facets of an interaction surface,
+ * optionally at a slower rate than the interaction model runs. The energy
+ * absorbed by each facet is accumulated in contiguous arrays between
+ * integrations and integrated as an average power over the interval; the
+ * emitted power and temperature from the last integration are held in
+ * between.
+ */
+class ThermalFacetBatch {
+
+   JEOD_MAKE_SIM_INTERFACES(ThermalFacetBatch)
+
+public:
+
+   // Member methods
+   ThermalFacetBatch ();
+   ~ThermalFacetBatch ();
+
+   void build (InteractionSurface & surface);
+
+   /**
+    * Indicate whether the batch was built for the given surface.
+    * @return True if built for this surface
+    * \param[in] surface Surface to test
+    */
+   bool is_built_for (const InteractionSurface & surface) const
+   {
+      return built_surface == &surface;
+   }
+
+   /**
+    * Number of facet riders in the batch.
+    * @return Number of riders
+    */
+   unsigned int size () const
+   {
+      return num_riders;
+   }
+
+   /**
+    * Indicate whether absorbed power has been accumulated over part of an
+    * integration interval.
+    * @return True if an interval is under way
+    */
+   bool in_interval () const
+   {
+      return elapsed_time > 0.0;
+   }
+
+   void invalidate ();
+
+   void update (double cycle_time, double integration_interval);
+
+   void integrate (double step);
+
+
+protected:
+
+   /**
+    * Surface for which the batch was built.
+    */
+   const InteractionSurface * built_surface; //!< trick_io(**)
+
+   /**
+    * Number of facet riders in the batch.
+    */
+   unsigned int num_riders; //!< trick_units(count)
+
+   /**
+    * Time accumulated since the last integration when integrating at a
+    * slower rate than the batch is updated.
+    */
+   double elapsed_time; //!< trick_units(s)
+
+   /**
+    * Set when the next update must integrate regardless of the elapsed time.
+    */
+   bool step_pending; //!< trick_units(--)
+
+   /**
+    * Thermal riders of the surface facets.
+    */
+   std::vector<ThermalFacetRider *> riders; //!< trick_io(**)
+
+   /**
+    * Energy absorbed by each facet since the last integration.
+    */
+   std::vector<double> absorbed_energy; //!< trick_io(**)
+
+   /**
+    * Instantaneous absorbed power of each facet, saved while the
+    * interval-averaged power is being integrated.
+    */
+   std::vector<double> current_absorb; //!< trick_io(**)
+
+   /**
+    * Emitted power of each facet from the last integration.
+    */
+   std::vector<double> held_emit; //!< trick_io(**)
+
+
+private:
+
+   ThermalFacetBatch& operator = (const ThermalFacetBatch& rhs);
+   ThermalFacetBatch(const ThermalFacetBatch& rhs);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
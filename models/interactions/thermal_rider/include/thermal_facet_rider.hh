@@ -84,6 +84,9 @@ class ThermalFacetRider {
 
    JEOD_MAKE_SIM_INTERFACES(ThermalFacetRider)
 
+   // The multirate batch reads the predicted temperature.
+   friend class ThermalFacetBatch;
+
 public:
 
 
@@ -0,0 +1,135 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup ThermalRider
+ * @{
+ *
+ * @file models/interactions/thermal_rider/include/thermal_interval_step.hh
+ * Fidelity step that coarsens the thermal integration interval
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((Coarsening only affects surfaces that expose their thermal riders,
+      as with ThermalModelRider::integration_interval.))
+
+Library dependencies:
+    ((../src/thermal_interval_step.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_THERMAL_INTERVAL_STEP_HH
+#define JEOD_THERMAL_INTERVAL_STEP_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/fidelity_controller.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod {
+
+class ThermalModelRider;
+
+
+/**
+ * A fidelity step that raises the integration interval of a set of thermal
+ * model riders to coarse_interval. Riders already integrating at a longer
+ * interval are left alone. A partial interval is completed when the step is
+ * restored, so no absorbed energy is lost.
+ */
+class ThermalIntervalStep : public JeodFidelityStep {
+
+  JEOD_MAKE_SIM_INTERFACES(ThermalIntervalStep)
+
+public:
+   /**
+    * Integration interval while the step is applied.
+    */
+  double coarse_interval; //!< trick_units(s)
+
+
+// Member methods
+
+  ThermalIntervalStep();
+  ~ThermalIntervalStep() override;
+
+  void add_rider( ThermalModelRider & rider );
+
+  void degrade() override;
+  void restore() override;
+
+protected:
+
+   /**
+    * The riders affected by the step.
+    */
+  std::vector<ThermalModelRider *> riders; //!< trick_io(**)
+
+   /**
+    * Each rider's integration interval before the step was applied.
+    */
+  std::vector<double> saved_intervals; //!< trick_io(**)
+
+
+private:
+
+   ThermalIntervalStep& operator = (const ThermalIntervalStep& rhs);
+   ThermalIntervalStep (const ThermalIntervalStep& rhs);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -69,11 +69,13 @@ Library dependencies:
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
 
+// Model includes
+#include "thermal_facet_batch.hh"
+
 //! Namespace jeod
 namespace jeod {
 
 class InteractionSurface;
-// Model includes
 
 
 
@@ -97,6 +99,13 @@ public:
     */
   bool include_internal_thermal_effects; //!< trick_units(--)
 
+   /**
+    * Interval at which facet temperatures are integrated. When zero, the
+    * temperatures are integrated every update. When positive, the absorbed
+    * power is averaged over the interval and the temperatures are integrated
+    * once per interval. Requires a surface that exposes its thermal riders.
+    */
+  double integration_interval; //!< trick_units(s)
 
 
 
@@ -108,6 +117,12 @@ public:
 
   void update( InteractionSurface * surface_ptr );
 
+protected:
+
+   /**
+    * Multirate integrator for the facets of the surface.
+    */
+  ThermalFacetBatch facet_batch; //!< trick_units(--)
 
 
 private:
@@ -0,0 +1,216 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup ThermalRider
+ * @{
+ *
+ * @file models/interactions/thermal_rider/src/thermal_facet_batch.cc
+ * Multirate temperature integration for all facets of a surface
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((None))
+
+Library dependencies:
+   ((thermal_facet_batch.cc)
+    (thermal_facet_rider.cc)
+    (utils/surface_model/src/interaction_surface.cc))
+
+
+*******************************************************************************/
+
+/* System includes */
+#include <cstddef>
+
+/*  JEOD includes */
+#include "utils/surface_model/include/facet.hh"
+#include "utils/surface_model/include/interaction_facet.hh"
+#include "utils/surface_model/include/interaction_surface.hh"
+
+/* Model structure includes */
+#include "../include/thermal_facet_batch.hh"
+#include "../include/thermal_facet_rider.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Constructor
+ */
+ThermalFacetBatch::ThermalFacetBatch (
+   void)
+:
+   built_surface(nullptr),
+   num_riders(0),
+   elapsed_time(0.0),
+   step_pending(true)
+{
+}
+
+
+/**
+ * Destructor
+ */
+ThermalFacetBatch::~ThermalFacetBatch (
+   void)
+{
+}
+
+
+/**
+ * Gather the thermal riders of a surface.
+ * \param[in] surface Surface whose facets are to be integrated
+ */
+void
+ThermalFacetBatch::build (
+   InteractionSurface & surface)
+{
+   surface.collect_thermal_riders (riders);
+   num_riders = static_cast<unsigned int> (riders.size());
+
+   absorbed_energy.assign (num_riders, 0.0);
+   current_absorb.assign (num_riders, 0.0);
+   held_emit.assign (num_riders, 0.0);
+
+   built_surface = &surface;
+   elapsed_time  = 0.0;
+   step_pending  = true;
+
+   return;
+}
+
+
+/**
+ * Force the batch to be rebuilt before its next use.
+ */
+void
+ThermalFacetBatch::invalidate (
+   void)
+{
+   built_surface = nullptr;
+   return;
+}
+
+
+/**
+ * Advance the facet temperatures by one call of the thermal model.
+ * With a non-positive integration interval, every call integrates over the
+ * cycle time. Otherwise the absorbed power is accumulated until the
+ * interval has elapsed, and is then integrated as an average over the
+ * elapsed time, and the facet temperature is set to the temperature at the
+ * end of the interval. Between integrations, each facet keeps that
+ * temperature and the emitted power from the last integration.
+ * The interval may change between calls; a partial interval is completed
+ * at the first call at which the new interval has elapsed, or immediately
+ * if the new interval is non-positive.
+ * \param[in] cycle_time Time since the previous call\n Units: s
+ * \param[in] integration_interval Thermal integration interval\n Units: s
+ */
+void
+ThermalFacetBatch::update (
+   double cycle_time,
+   double integration_interval)
+{
+   if ((integration_interval <= 0.0) && (elapsed_time <= 0.0)) {
+      integrate (cycle_time);
+      return;
+   }
+
+   elapsed_time += cycle_time;
+   for (unsigned int ii = 0; ii < num_riders; ++ii) {
+      absorbed_energy[ii] += riders[ii]->power_absorb * cycle_time;
+   }
+
+   // Hold the last integrated state until the interval has elapsed.
+   // Inactive facets keep emitting what they absorb, as they do when
+   // integrated every call.
+   if ((!step_pending) && (integration_interval > 0.0) &&
+       (elapsed_time < integration_interval * (1.0 - 1.0e-9))) {
+      for (unsigned int ii = 0; ii < num_riders; ++ii) {
+         ThermalFacetRider & rider = *riders[ii];
+         if (rider.integrable_object.active) {
+            rider.facet->base_facet->temperature =
+               rider.integrable_object.get_temp();
+         }
+         else if (rider.active) {
+            rider.power_emit = held_emit[ii];
+         }
+         else {
+            rider.power_emit = rider.power_absorb;
+         }
+      }
+      return;
+   }
+
+   // Integrate the interval-averaged absorbed power over the elapsed time.
+   for (unsigned int ii = 0; ii < num_riders; ++ii) {
+      current_absorb[ii]       = riders[ii]->power_absorb;
+      riders[ii]->power_absorb  = absorbed_energy[ii] / elapsed_time;
+      absorbed_energy[ii]      = 0.0;
+   }
+
+   integrate (elapsed_time);
+
+   // The averaged power covers the interval that ends now, so the predicted
+   // temperature is the current one.
+   for (unsigned int ii = 0; ii < num_riders; ++ii) {
+      ThermalFacetRider & rider = *riders[ii];
+      held_emit[ii]      = rider.power_emit;
+      rider.power_absorb = current_absorb[ii];
+      if (rider.active && (!rider.integrable_object.active)) {
+         rider.facet->base_facet->temperature = rider.next_temperature;
+      }
+   }
+
+   elapsed_time = 0.0;
+   step_pending = false;
+
+   return;
+}
+
+
+/**
+ * Integrate the temperature of every facet over one step.
+ * \param[in] step Integration step\n Units: s
+ */
+void
+ThermalFacetBatch::integrate (
+   double step)
+{
+   double saved_cycle_time = ThermalFacetRider::cycle_time;
+   ThermalFacetRider::cycle_time = step;
+
+   for (unsigned int ii = 0; ii < num_riders; ++ii) {
+      ThermalFacetRider & rider = *riders[ii];
+      if (rider.integrable_object.active) {
+         rider.facet->base_facet->temperature =
+            rider.integrable_object.get_temp();
+      }
+      else {
+         rider.facet->base_facet->temperature = rider.integrate();
+      }
+   }
+
+   ThermalFacetRider::cycle_time = saved_cycle_time;
+
+   return;
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
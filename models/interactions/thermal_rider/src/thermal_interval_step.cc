@@ -0,0 +1,111 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup ThermalRider
+ * @{
+ *
+ * @file models/interactions/thermal_rider/src/thermal_interval_step.cc
+ * Fidelity step that coarsens the thermal integration interval
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((None))
+
+Library dependencies:
+   ((thermal_interval_step.cc)
+    (thermal_model_rider.cc))
+
+
+*******************************************************************************/
+
+/* System includes */
+#include <cstddef>
+
+/* Model structure includes */
+#include "../include/thermal_interval_step.hh"
+#include "../include/thermal_model_rider.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Constructor
+ */
+ThermalIntervalStep::ThermalIntervalStep (
+   void)
+:
+   JeodFidelityStep(),
+   coarse_interval(0.0),
+   riders(),
+   saved_intervals()
+{
+}
+
+
+/**
+ * Destructor
+ */
+ThermalIntervalStep::~ThermalIntervalStep (
+   void)
+{
+}
+
+
+/**
+ * Add a rider to those affected by the step.
+ * \param[in,out] rider The thermal model rider.
+ */
+void
+ThermalIntervalStep::add_rider (
+   ThermalModelRider & rider)
+{
+   riders.push_back (&rider);
+   saved_intervals.push_back (0.0);
+}
+
+
+/**
+ * Record the riders' intervals and raise them to the coarse interval.
+ */
+void
+ThermalIntervalStep::degrade (
+   void)
+{
+   for (std::size_t ii = 0; ii < riders.size(); ++ii) {
+      saved_intervals[ii] = riders[ii]->integration_interval;
+      if (riders[ii]->integration_interval < coarse_interval) {
+         riders[ii]->integration_interval = coarse_interval;
+      }
+   }
+}
+
+
+/**
+ * Reinstate the intervals recorded by degrade().
+ */
+void
+ThermalIntervalStep::restore (
+   void)
+{
+   for (std::size_t ii = 0; ii < riders.size(); ++ii) {
+      riders[ii]->integration_interval = saved_intervals[ii];
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -26,6 +26,7 @@ ASSUMPTIONS AND LIMITATIONS:
 
 Library dependencies:
    ((thermal_model_rider.cc)
+    (thermal_facet_batch.cc)
     (thermal_facet_rider.cc))
 
 
@@ -55,6 +56,7 @@ ThermalModelRider::ThermalModelRider (
 {
    active                           = false;
    include_internal_thermal_effects = false;
+   integration_interval             = 0.0;
 }
 
 /**
@@ -71,6 +73,24 @@ ThermalModelRider::update (
    }
 
    if (active && (std::fpclassify(ThermalFacetRider::cycle_time) != FP_ZERO)) {
+      // A partial interval left by lowering the interval to zero is
+      // completed by the batch.
+      if ((integration_interval > 0.0) ||
+          (facet_batch.in_interval() &&
+           facet_batch.is_built_for (*surface_ptr))) {
+         if (!facet_batch.is_built_for (*surface_ptr)) {
+            facet_batch.build (*surface_ptr);
+         }
+
+         // Surfaces that do not expose their riders are integrated
+         // every update.
+         if (facet_batch.size() > 0) {
+            facet_batch.update (ThermalFacetRider::cycle_time,
+                                integration_interval);
+            return;
+         }
+      }
+
       surface_ptr->thermal_integrator();
    }
    return;
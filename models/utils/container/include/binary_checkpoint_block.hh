@@ -0,0 +1,251 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Container
+ * @{
+ *
+ * @file models/utils/container/include/binary_checkpoint_block.hh
+ * Define class JeodBinaryCheckpointBlock and class template
+ * JeodBinaryContents, which checkpoint contiguous primitive containers
+ * as raw blocks of memory.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/binary_checkpoint_block.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_MEMORY_BINARY_CHECKPOINT_BLOCK_H
+#define JEOD_MEMORY_BINARY_CHECKPOINT_BLOCK_H
+
+
+// System includes
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodBinaryCheckpointBlock encodes and decodes the raw blocks in which
+ * contiguous primitive containers are checkpointed when the JEOD checkpoint
+ * file is written in binary form.
+ *
+ * A block comprises a fixed-size header followed by the elements, copied
+ * verbatim from memory. The header identifies the block, the byte order of
+ * the machine that wrote it, the element size, and the element count.
+ * Restoring a block on a machine with the same byte order is a single copy;
+ * restoring it on a machine with the opposite byte order swaps each element.
+ */
+class JeodBinaryCheckpointBlock {
+public:
+
+   // Static data
+
+   /**
+    * The name of the checkpoint action that introduces a raw block.
+    * The action value is the size of the block in bytes; the block itself
+    * immediately follows the action line.
+    */
+   static const char * action_name;
+
+   /**
+    * The size of the block header, in bytes.
+    */
+   static const std::size_t header_size = 16;
+
+
+   // Static methods
+
+   // Is the host little endian?
+   static bool host_is_little_endian ();
+
+   // Encode count elements of size elem_size as a raw block.
+   static void encode (
+      const void * data,
+      std::size_t elem_size,
+      std::size_t count,
+      std::string & block);
+
+   // Validate a block header and extract the element count.
+   static bool decode_header (
+      const char * block,
+      std::size_t size,
+      std::size_t elem_size,
+      std::size_t & count,
+      bool & swap_bytes);
+
+   // Copy the elements of a validated block to the destination.
+   static void decode_elements (
+      const char * block,
+      std::size_t elem_size,
+      std::size_t count,
+      bool swap_bytes,
+      void * data);
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   JeodBinaryCheckpointBlock ();
+
+   /**
+    * Not implemented.
+    */
+   JeodBinaryCheckpointBlock (const JeodBinaryCheckpointBlock &);
+
+   /**
+    * Not implemented.
+    */
+   JeodBinaryCheckpointBlock & operator= (const JeodBinaryCheckpointBlock &);
+};
+
+
+/**
+ * Checkpoint the contents of an STL container as a raw block.
+ * The general case does not support raw blocks; the container is
+ * checkpointed element by element as text.
+ * @tparam StlType  The STL container type.
+ * @tparam ElemType The element type.
+ * @tparam IsRaw    True if ElemType can be copied as raw memory.
+ */
+template <typename StlType, typename ElemType,
+          bool IsRaw = (std::is_arithmetic<ElemType>::value &&
+                        !std::is_same<ElemType, bool>::value)>
+class JeodBinaryContents {
+public:
+
+   /**
+    * Raw blocks are not supported.
+    */
+   static const bool supported = false;
+
+   /**
+    * Write the contents as a raw block; does nothing.
+    */
+   static void write (const StlType &, std::string &)
+   { }
+
+   /**
+    * Restore the contents from a raw block; always fails.
+    * @return Non-zero (failure).
+    */
+   static int restore (StlType &, const char *, std::size_t)
+   {
+      return -1;
+   }
+};
+
+
+/**
+ * Checkpoint the contents of a std::vector of arithmetic elements
+ * as a raw block. The vector's storage is contiguous, so the block is
+ * written and restored with a single copy.
+ * @tparam ElemType The element type.
+ */
+template <typename ElemType>
+class JeodBinaryContents<std::vector<ElemType>, ElemType, true> {
+public:
+
+   /**
+    * Raw blocks are supported.
+    */
+   static const bool supported = true;
+
+   /**
+    * Write the contents as a raw block.
+    * @param contents Vector to be written.
+    * @param block    Encoded block.
+    */
+   static void write (
+      const std::vector<ElemType> & contents,
+      std::string & block)
+   {
+      JeodBinaryCheckpointBlock::encode (
+         contents.data(), sizeof(ElemType), contents.size(), block);
+   }
+
+   /**
+    * Replace the contents with those recorded in a raw block.
+    * @param contents Vector to be restored.
+    * @param block    Encoded block.
+    * @param size     Size of the block, in bytes.
+    * @return         Success (zero) / failure (non-zero).
+    */
+   static int restore (
+      std::vector<ElemType> & contents,
+      const char * block,
+      std::size_t size)
+   {
+      std::size_t count;
+      bool swap_bytes;
+      if (! JeodBinaryCheckpointBlock::decode_header (
+               block, size, sizeof(ElemType), count, swap_bytes)) {
+         return -1;
+      }
+      contents.resize (count);
+      JeodBinaryCheckpointBlock::decode_elements (
+         block, sizeof(ElemType), count, swap_bytes, contents.data());
+      return 0;
+   }
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -62,6 +62,7 @@ Purpose:
 
 
 // System includes
+#include <cstddef>
 #include <string>
 #include <typeinfo>
 
@@ -125,6 +126,17 @@ public:
    // Return the value of the final action.
    virtual const std::string get_final_value (void);
 
+   // Can the object be checkpointed as a single raw block?
+   virtual bool supports_binary_checkpoint (void);
+
+   // Encode the object's contents as a raw block.
+   virtual void write_binary_checkpoint (std::string & block);
+
+   // Restore the object's contents from a raw block.
+   virtual int restore_binary_checkpoint (
+      const char * block,
+      std::size_t size);
+
 
    // Pure virtual functions
 
@@ -359,6 +371,58 @@ JeodCheckpointable::undo_initialize_checkpointable (
 }
 
 
+/**
+ * In general, indicate whether the object's contents can be checkpointed as a
+ * single raw block rather than item by item. The checkpoint writer uses the
+ * raw block in lieu of the item actions when the checkpoint file is binary;
+ * text checkpoint files always use the item actions.
+ *
+ * The default implementation is false.
+ */
+inline bool
+JeodCheckpointable::supports_binary_checkpoint (
+   void)
+{
+   return false;
+}
+
+
+/**
+ * In general, encode the object's contents as a raw block that
+ * restore_binary_checkpoint can restore without parsing.
+ * Called only if supports_binary_checkpoint returns true.
+ *
+ * The default implementation yields an empty block.
+ *
+ * @param block The encoded block.
+ */
+inline void
+JeodCheckpointable::write_binary_checkpoint (
+   std::string & block)
+{
+   block.clear();
+}
+
+
+/**
+ * In general, restore the object's contents from a block written by
+ * write_binary_checkpoint.
+ *
+ * The default implementation fails.
+ *
+ * @param block The encoded block.
+ * @param size  The size of the block, in bytes.
+ * @return      Success (zero) / failure (non-zero).
+ */
+inline int
+JeodCheckpointable::restore_binary_checkpoint (
+   const char * block JEOD_UNUSED,
+   std::size_t size JEOD_UNUSED)
+{
+   return -1;
+}
+
+
 } // End JEOD namespace
 
 #endif
@@ -0,0 +1,620 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Container
+ * @{
+ *
+ * @file models/utils/container/include/inline_vector.hh
+ * Define class template InlineVector.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_MEMORY_INLINE_VECTOR_H
+#define JEOD_MEMORY_INLINE_VECTOR_H
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A contiguous sequence container that holds up to InlineCapacity elements
+ * within the container object itself, moving to the heap only when it grows
+ * beyond that. Short lists thus live inline in their owning objects.
+ *
+ * InlineVector provides the subset of the std::vector interface used by
+ * JeodSequenceContainer and JeodVector, with the same iterator invalidation
+ * rules, with one difference: moving or swapping an InlineVector whose
+ * elements are held inline invalidates iterators to those elements.
+ */
+template <typename ElemType, std::size_t InlineCapacity>
+class InlineVector {
+
+   static_assert (InlineCapacity > 0, "InlineCapacity must be positive");
+
+public:
+
+   // Types
+
+   typedef ElemType value_type;
+   typedef std::allocator<ElemType> allocator_type;
+   typedef ElemType & reference;
+   typedef const ElemType & const_reference;
+   typedef ElemType * pointer;
+   typedef const ElemType * const_pointer;
+   typedef ElemType * iterator;
+   typedef const ElemType * const_iterator;
+   typedef std::reverse_iterator<iterator> reverse_iterator;
+   typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+   typedef std::ptrdiff_t difference_type;
+   typedef std::size_t size_type;
+
+
+   // Constructors and destructor
+
+   /**
+    * Default constructor.
+    */
+   InlineVector (void)
+   :
+      elems (inline_elems()),
+      count (0),
+      limit (InlineCapacity)
+   {}
+
+   /**
+    * Copy constructor.
+    * @param src Source container to be copied
+    */
+   InlineVector (const InlineVector & src)
+   :
+      elems (inline_elems()),
+      count (0),
+      limit (InlineCapacity)
+   {
+      append_copies (src);
+   }
+
+   /**
+    * Move constructor.
+    * @param src Source container to be moved
+    */
+   InlineVector (InlineVector && src)
+   :
+      elems (inline_elems()),
+      count (0),
+      limit (InlineCapacity)
+   {
+      take (src);
+   }
+
+   /**
+    * Destructor.
+    */
+   ~InlineVector (void)
+   {
+      clear ();
+      release ();
+   }
+
+
+   // Assignment operators
+
+   /**
+    * Copy contents from the given source.
+    */
+   InlineVector &
+   operator= (const InlineVector & src)
+   {
+      if (&src != this) {
+         clear ();
+         append_copies (src);
+      }
+      return *this;
+   }
+
+   /**
+    * Move contents from the given source.
+    */
+   InlineVector &
+   operator= (InlineVector && src)
+   {
+      if (&src != this) {
+         clear ();
+         release ();
+         take (src);
+      }
+      return *this;
+   }
+
+
+   /**
+    * Returns the allocator used for heap storage.
+    */
+   allocator_type
+   get_allocator (void) const
+   {
+      return allocator_type();
+   }
+
+
+   // Iterators
+
+   iterator begin (void) { return elems; }
+   const_iterator begin (void) const { return elems; }
+   iterator end (void) { return elems + count; }
+   const_iterator end (void) const { return elems + count; }
+
+   reverse_iterator rbegin (void) { return reverse_iterator (end()); }
+   const_reverse_iterator rbegin (void) const
+   { return const_reverse_iterator (end()); }
+   reverse_iterator rend (void) { return reverse_iterator (begin()); }
+   const_reverse_iterator rend (void) const
+   { return const_reverse_iterator (begin()); }
+
+
+   // Capacity
+
+   bool empty (void) const { return count == 0; }
+   size_type size (void) const { return count; }
+   size_type capacity (void) const { return limit; }
+
+   size_type
+   max_size (void) const
+   {
+      return std::numeric_limits<size_type>::max() / sizeof(ElemType);
+   }
+
+   /**
+    * Make the capacity at least @a n elements. Elements are moved to the
+    * heap if @a n exceeds the current capacity.
+    */
+   void
+   reserve (
+      size_type n)
+   {
+      if (n <= limit) {
+         return;
+      }
+
+      allocator_type allocator;
+      ElemType * new_elems = allocator.allocate (n);
+      for (size_type ii = 0; ii < count; ++ii) {
+         ::new (static_cast<void *> (new_elems + ii))
+            ElemType (std::move (elems[ii]));
+         elems[ii].~ElemType();
+      }
+      release ();
+      elems = new_elems;
+      limit = n;
+   }
+
+
+   // Element access
+
+   reference operator[] (size_type n) { return elems[n]; }
+   const_reference operator[] (size_type n) const { return elems[n]; }
+
+   reference
+   at (size_type n)
+   {
+      range_check (n);
+      return elems[n];
+   }
+
+   const_reference
+   at (size_type n) const
+   {
+      range_check (n);
+      return elems[n];
+   }
+
+   reference front (void) { return elems[0]; }
+   const_reference front (void) const { return elems[0]; }
+   reference back (void) { return elems[count-1]; }
+   const_reference back (void) const { return elems[count-1]; }
+
+   ElemType * data (void) { return elems; }
+   const ElemType * data (void) const { return elems; }
+
+
+   // Modifiers
+
+   /**
+    * Append a copy of @a elem, which may be an element of this container.
+    */
+   void
+   push_back (
+      const ElemType & elem)
+   {
+      if (count == limit) {
+         ElemType temp (elem);
+         grow (count + 1);
+         ::new (static_cast<void *> (elems + count))
+            ElemType (std::move (temp));
+      }
+      else {
+         ::new (static_cast<void *> (elems + count)) ElemType (elem);
+      }
+      ++count;
+   }
+
+   void
+   pop_back (void)
+   {
+      --count;
+      elems[count].~ElemType();
+   }
+
+   void
+   clear (void)
+   {
+      while (count > 0) {
+         pop_back ();
+      }
+   }
+
+   iterator
+   insert (
+      const_iterator position,
+      const ElemType & elem)
+   {
+      size_type offset = position - begin();
+      push_back (elem);
+      std::rotate (begin() + offset, end() - 1, end());
+      return begin() + offset;
+   }
+
+   void
+   insert (
+      const_iterator position,
+      size_type ncopies,
+      const ElemType & elem)
+   {
+      size_type offset = position - begin();
+      size_type old_count = count;
+      ElemType temp (elem);
+      reserve (count + ncopies);
+      for (size_type ii = 0; ii < ncopies; ++ii) {
+         push_back (temp);
+      }
+      std::rotate (begin() + offset, begin() + old_count, end());
+   }
+
+   template <class InputIterator>
+   typename std::enable_if<! std::is_integral<InputIterator>::value>::type
+   insert (
+      const_iterator position,
+      InputIterator first,
+      InputIterator last)
+   {
+      size_type offset = position - begin();
+      size_type old_count = count;
+      for (; first != last; ++first) {
+         push_back (*first);
+      }
+      std::rotate (begin() + offset, begin() + old_count, end());
+   }
+
+   iterator
+   erase (
+      const_iterator position)
+   {
+      return erase (position, position + 1);
+   }
+
+   iterator
+   erase (
+      const_iterator first,
+      const_iterator last)
+   {
+      iterator dest = begin() + (first - begin());
+      iterator new_end = std::move (begin() + (last - begin()), end(), dest);
+      while (end() != new_end) {
+         pop_back ();
+      }
+      return dest;
+   }
+
+   template <class InputIterator>
+   typename std::enable_if<! std::is_integral<InputIterator>::value>::type
+   assign (
+      InputIterator first,
+      InputIterator last)
+   {
+      clear ();
+      for (; first != last; ++first) {
+         push_back (*first);
+      }
+   }
+
+   void
+   assign (
+      size_type new_size,
+      const ElemType & new_elem)
+   {
+      ElemType temp (new_elem);
+      clear ();
+      resize (new_size, temp);
+   }
+
+   void
+   resize (
+      size_type new_size,
+      const ElemType & new_elem = ElemType())
+   {
+      while (count > new_size) {
+         pop_back ();
+      }
+      if (count < new_size) {
+         ElemType temp (new_elem);
+         reserve (new_size);
+         while (count < new_size) {
+            push_back (temp);
+         }
+      }
+   }
+
+   void
+   swap (
+      InlineVector & other)
+   {
+      InlineVector temp (std::move (other));
+      other = std::move (*this);
+      *this = std::move (temp);
+   }
+
+
+private:
+
+   /**
+    * Raw storage for one element.
+    */
+   typedef typename std::aligned_storage<
+      sizeof(ElemType), std::alignment_of<ElemType>::value>::type
+      StorageType;
+
+   ElemType *
+   inline_elems (void)
+   {
+      return reinterpret_cast<ElemType *> (storage);
+   }
+
+   bool
+   is_inline (void) const
+   {
+      return elems == reinterpret_cast<const ElemType *> (storage);
+   }
+
+   /**
+    * Grow the capacity geometrically to hold at least @a n elements.
+    */
+   void
+   grow (
+      size_type n)
+   {
+      reserve (std::max (n, 2 * limit));
+   }
+
+   /**
+    * Return heap storage, if any, and revert to the inline storage.
+    * The container must be empty.
+    */
+   void
+   release (void)
+   {
+      if (! is_inline()) {
+         allocator_type().deallocate (elems, limit);
+         elems = inline_elems();
+         limit = InlineCapacity;
+      }
+   }
+
+   /**
+    * Append copies of the elements of @a src.
+    */
+   void
+   append_copies (
+      const InlineVector & src)
+   {
+      reserve (count + src.count);
+      for (size_type ii = 0; ii < src.count; ++ii) {
+         push_back (src.elems[ii]);
+      }
+   }
+
+   /**
+    * Take the contents of @a src, leaving it empty. This container must be
+    * empty and inline. Heap storage is taken over; inline elements are moved.
+    */
+   void
+   take (
+      InlineVector & src)
+   {
+      if (src.is_inline()) {
+         for (size_type ii = 0; ii < src.count; ++ii) {
+            ::new (static_cast<void *> (elems + ii))
+               ElemType (std::move (src.elems[ii]));
+            ++count;
+         }
+         src.clear ();
+      }
+      else {
+         elems = src.elems;
+         count = src.count;
+         limit = src.limit;
+         src.elems = src.inline_elems();
+         src.count = 0;
+         src.limit = InlineCapacity;
+      }
+   }
+
+   void
+   range_check (
+      size_type n) const
+   {
+      if (n >= count) {
+         throw std::out_of_range ("InlineVector::at");
+      }
+   }
+
+
+   // Member data
+
+   /**
+    * The elements, either the inline storage or a heap array.
+    */
+   ElemType * elems; //!< trick_io(**)
+
+   /**
+    * Number of elements.
+    */
+   size_type count; //!< trick_io(**)
+
+   /**
+    * Number of elements the storage can hold.
+    */
+   size_type limit; //!< trick_io(**)
+
+   /**
+    * Inline storage.
+    */
+   StorageType storage[InlineCapacity]; //!< trick_io(**)
+};
+
+
+// Comparison operators, as for std::vector.
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline bool
+operator== (
+   const InlineVector<ElemType, InlineCapacity> & x,
+   const InlineVector<ElemType, InlineCapacity> & y)
+{
+   return (x.size() == y.size()) && std::equal (x.begin(), x.end(), y.begin());
+}
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline bool
+operator< (
+   const InlineVector<ElemType, InlineCapacity> & x,
+   const InlineVector<ElemType, InlineCapacity> & y)
+{
+   return std::lexicographical_compare (x.begin(), x.end(),
+                                        y.begin(), y.end());
+}
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline bool
+operator!= (
+   const InlineVector<ElemType, InlineCapacity> & x,
+   const InlineVector<ElemType, InlineCapacity> & y)
+{
+   return ! (x == y);
+}
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline bool
+operator> (
+   const InlineVector<ElemType, InlineCapacity> & x,
+   const InlineVector<ElemType, InlineCapacity> & y)
+{
+   return y < x;
+}
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline bool
+operator<= (
+   const InlineVector<ElemType, InlineCapacity> & x,
+   const InlineVector<ElemType, InlineCapacity> & y)
+{
+   return ! (y < x);
+}
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline bool
+operator>= (
+   const InlineVector<ElemType, InlineCapacity> & x,
+   const InlineVector<ElemType, InlineCapacity> & y)
+{
+   return ! (x < y);
+}
+
+template <typename ElemType, std::size_t InlineCapacity>
+inline void
+swap (
+   InlineVector<ElemType, InlineCapacity> & x,
+   InlineVector<ElemType, InlineCapacity> & y)
+{
+   x.swap (y);
+}
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,103 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Container
+ * @{
+ *
+ * @file models/utils/container/include/object_inline_vector.hh
+ * Define checkpointable replacements for STL sequence containers.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_MEMORY_OBJECT_INLINE_VECTOR_HH
+#define JEOD_MEMORY_OBJECT_INLINE_VECTOR_HH
+
+// Model includes
+#include "jeod_inline_vector.hh"
+#include "object_container.hh"
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// System includes
+#include <cstddef>
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Defines a registry for defining a checkpointable vector of objects that
+ * holds up to InlineCapacity elements inline, for short lists. Either this
+ * or JeodObjectVector is a flat replacement for a JeodObjectList that needs
+ * only order-stable iteration, but not the list's stable element addresses.
+ * Usage: JeodObjectInlineVector<type, capacity>::type variable_name
+ */
+template <typename ElemType, std::size_t InlineCapacity>
+class JeodObjectInlineVector {
+public:
+   /**
+    * Template typedef for a checkpointable inline vector of objects.
+    */
+   typedef JeodObjectContainer<
+              JeodInlineVector<ElemType, InlineCapacity>, ElemType> type;
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
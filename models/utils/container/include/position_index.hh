@@ -0,0 +1,221 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Container
+ * @{
+ *
+ * @file models/utils/container/include/position_index.hh
+ * Define the class template PositionIndex, which locates pointers in a
+ * vector of pointers in constant time.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_POSITION_INDEX_HH
+#define JEOD_POSITION_INDEX_HH
+
+// System includes
+#include <cstddef>
+#include <unordered_map>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Maps the elements of a vector of distinct pointers to their positions in
+ * the vector, making membership tests and removals constant-time.
+ * Removal swaps the last element into the removed element's place, so the
+ * order of the vector is not preserved; the address of an element is its
+ * stable handle.
+ *
+ * The index does not own the vector. It is a cache: it is rebuilt whenever
+ * its size does not match that of the vector, e.g., after the vector was
+ * restored from a checkpoint, and a position it reports is verified
+ * against the vector before it is used. The vector should be modified
+ * through the index so that the index stays current.
+ *
+ * The ContainerType must be a std::vector or a JeodVector of ElemType*.
+ */
+template <typename ElemType>
+class PositionIndex {
+
+   JEOD_MAKE_SIM_INTERFACES(PositionIndex)
+
+public:
+
+   /**
+    * The position returned for elements that are not in the vector.
+    */
+   static const unsigned int npos = ~0U;
+
+   /**
+    * Default constructor.
+    */
+   PositionIndex ()
+   :
+      positions ()
+   {}
+
+   /**
+    * Empty the index. The next query rebuilds it.
+    */
+   void clear ()
+   {
+      positions.clear ();
+   }
+
+   /**
+    * Rebuild the index from the vector.
+    * \param[in] items The vector
+    */
+   template <typename ContainerType>
+   void rebuild (const ContainerType & items) const
+   {
+      positions.clear ();
+      for (std::size_t ii = 0; ii < items.size(); ++ii) {
+         positions[items[ii]] = ii;
+      }
+   }
+
+   /**
+    * Find the position of an element.
+    * @return Position of the element, or npos if not found
+    * \param[in] items The vector
+    * \param[in] item  Element to be found
+    */
+   template <typename ContainerType>
+   unsigned int find (const ContainerType & items, const ElemType * item) const
+   {
+      if (positions.size() != items.size()) {
+         rebuild (items);
+      }
+
+      typename PositionMap::const_iterator iter = positions.find (item);
+      if (iter == positions.end()) {
+         return npos;
+      }
+
+      // Guard against a stale index by verifying the hit.
+      if ((iter->second >= items.size()) || (items[iter->second] != item)) {
+         rebuild (items);
+         iter = positions.find (item);
+         if (iter == positions.end()) {
+            return npos;
+         }
+      }
+
+      return iter->second;
+   }
+
+   /**
+    * Append an element to the vector.
+    * \param[in,out] items The vector
+    * \param[in]     item  Element to be added; not already in the vector
+    */
+   template <typename ContainerType>
+   void push_back (ContainerType & items, ElemType * item)
+   {
+      items.push_back (item);
+      if (positions.size() + 1 == items.size()) {
+         positions[item] = items.size() - 1;
+      }
+   }
+
+   /**
+    * Remove an element from the vector, moving the last element into its
+    * place.
+    * @return True if the element was found and removed
+    * \param[in,out] items The vector
+    * \param[in]     item  Element to be removed
+    */
+   template <typename ContainerType>
+   bool swap_remove (ContainerType & items, const ElemType * item)
+   {
+      unsigned int position = find (items, item);
+      if (position == npos) {
+         return false;
+      }
+
+      ElemType * last = items[items.size() - 1];
+      items[position] = last;
+      items.pop_back ();
+      positions.erase (item);
+      if (last != item) {
+         positions[last] = position;
+      }
+
+      return true;
+   }
+
+
+private:
+
+   /**
+    * Map type.
+    */
+   typedef std::unordered_map<const ElemType *, unsigned int> PositionMap;
+
+   /**
+    * Position of each element.
+    */
+   mutable PositionMap positions; //!< trick_io(**)
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -60,6 +60,7 @@ Purpose:
 #define JEOD_MEMORY_PRIMITIVE_CONTAINER_H
 
 // Model includes
+#include "binary_checkpoint_block.hh"
 #include "container.hh"
 #include "primitive_serializer.hh"
 
@@ -160,8 +161,48 @@ public:
       this->insert (this->end(), serializer.from_string (value));
    }
 
+   /**
+    * Indicate whether the contents can be checkpointed as a raw block.
+    * Vectors of arithmetic types can; other primitive containers cannot.
+    */
+   bool supports_binary_checkpoint (void) override
+   {
+      return binary_contents::supported;
+   }
+
+   /**
+    * Encode the contents as a raw block.
+    * @param block The encoded block.
+    */
+   void write_binary_checkpoint (std::string & block) override
+   {
+      binary_contents::write (this->contents, block);
+   }
+
+   /**
+    * Replace the contents with those recorded in a raw block.
+    * @param block The encoded block.
+    * @param size  The size of the block, in bytes.
+    * @return      Success (zero) / failure (non-zero).
+    */
+   int restore_binary_checkpoint (
+      const char * block,
+      std::size_t size) override
+   {
+      return binary_contents::restore (this->contents, block, size);
+   }
+
 protected:
 
+   // Types
+
+   /**
+    * Raw block encoder / decoder for the contents.
+    */
+   typedef JeodBinaryContents<
+      typename ContainerType::stl_container_type, ElemType> binary_contents;
+
+
    // Member data
 
    /**
@@ -0,0 +1,190 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Container
+ * @{
+ *
+ * @file models/utils/container/src/binary_checkpoint_block.cc
+ * Define class JeodBinaryCheckpointBlock static methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// JEOD includes
+
+// Model includes
+#include "../include/binary_checkpoint_block.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Block header layout, in bytes:
+ *  - 0..3   Magic "JCBB"
+ *  - 4      Byte order of the writer, 'L' (little) or 'B' (big)
+ *  - 5      Element size
+ *  - 6..7   Reserved, zero
+ *  - 8..15  Element count, as a 64 bit integer in the writer's byte order
+ */
+static const char block_magic[4] = {'J', 'C', 'B', 'B'};
+
+const char * JeodBinaryCheckpointBlock::action_name = "binary_block";
+
+
+/**
+ * Reverse the bytes of a single item in place.
+ * @param item Item whose bytes are to be reversed.
+ * @param size Size of the item, in bytes.
+ */
+static void
+reverse_bytes (
+   char * item,
+   std::size_t size)
+{
+   std::reverse (item, item + size);
+}
+
+
+/**
+ * Determine whether the host is little endian.
+ * @return True if the host stores the least significant byte first.
+ */
+bool
+JeodBinaryCheckpointBlock::host_is_little_endian (
+   void)
+{
+   const std::uint16_t probe = 1;
+   unsigned char first;
+   std::memcpy (&first, &probe, 1);
+   return first == 1;
+}
+
+
+/**
+ * Encode count elements of size elem_size as a raw block.
+ * \param[in] data Start of the contiguous elements
+ * \param[in] elem_size Size of one element, in bytes
+ * \param[in] count Number of elements
+ * \param[out] block Encoded block; previous contents are replaced
+ */
+void
+JeodBinaryCheckpointBlock::encode (
+   const void * data,
+   std::size_t elem_size,
+   std::size_t count,
+   std::string & block)
+{
+   char header[header_size] = {0};
+   std::uint64_t count64 = count;
+
+   std::memcpy (header, block_magic, sizeof(block_magic));
+   header[4] = host_is_little_endian() ? 'L' : 'B';
+   header[5] = static_cast<char> (elem_size);
+   std::memcpy (header + 8, &count64, sizeof(count64));
+
+   block.assign (header, header_size);
+   if (count > 0) {
+      block.append (static_cast<const char *> (data), elem_size * count);
+   }
+}
+
+
+/**
+ * Validate a block header and extract the element count.
+ * \param[in] block Encoded block
+ * \param[in] size Size of the block, in bytes
+ * \param[in] elem_size Expected size of one element, in bytes
+ * \param[out] count Number of elements in the block
+ * \param[out] swap_bytes True if the block was written in the opposite
+ *             byte order
+ * @return True if the block is well-formed and holds elements of elem_size
+ */
+bool
+JeodBinaryCheckpointBlock::decode_header (
+   const char * block,
+   std::size_t size,
+   std::size_t elem_size,
+   std::size_t & count,
+   bool & swap_bytes)
+{
+   std::uint64_t count64;
+
+   if ((size < header_size) ||
+       (std::memcmp (block, block_magic, sizeof(block_magic)) != 0) ||
+       ((block[4] != 'L') && (block[4] != 'B')) ||
+       (static_cast<unsigned char> (block[5]) != elem_size)) {
+      return false;
+   }
+
+   swap_bytes = ((block[4] == 'L') != host_is_little_endian());
+
+   std::memcpy (&count64, block + 8, sizeof(count64));
+   if (swap_bytes) {
+      reverse_bytes (reinterpret_cast<char *> (&count64), sizeof(count64));
+   }
+
+   if ((size - header_size) / elem_size < count64) {
+      return false;
+   }
+   count = static_cast<std::size_t> (count64);
+
+   return true;
+}
+
+
+/**
+ * Copy the elements of a block validated by decode_header to the destination.
+ * \param[in] block Encoded block
+ * \param[in] elem_size Size of one element, in bytes
+ * \param[in] count Number of elements
+ * \param[in] swap_bytes Reverse the bytes of each element?
+ * \param[out] data Destination, with room for count elements
+ */
+void
+JeodBinaryCheckpointBlock::decode_elements (
+   const char * block,
+   std::size_t elem_size,
+   std::size_t count,
+   bool swap_bytes,
+   void * data)
+{
+   if (count == 0) {
+      return;
+   }
+
+   char * dest = static_cast<char *> (data);
+   std::memcpy (dest, block + header_size, elem_size * count);
+
+   if (swap_bytes && (elem_size > 1)) {
+      for (std::size_t ii = 0; ii < count; ++ii) {
+         reverse_bytes (dest + ii * elem_size, elem_size);
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,116 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup ChebyshevPicard
+ * @{
+ *
+ * @file models/utils/integration/chebyshev_picard/include/chebyshev_picard_force_model.hh
+ * Define the class ChebyshevPicardForceModel.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_CHEBYSHEV_PICARD_FORCE_MODEL_HH
+#define JEOD_CHEBYSHEV_PICARD_FORCE_MODEL_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Supplies the accelerations a ChebyshevPicardIntegrator needs at all of a
+ * segment's nodes at once. The nodes are independent of one another, so an
+ * implementation is free to evaluate them in parallel or as a multi-point
+ * batch (see GravityBatchForceModel).
+ */
+class ChebyshevPicardForceModel {
+JEOD_MAKE_SIM_INTERFACES(ChebyshevPicardForceModel)
+
+public:
+
+   /**
+    * Destructor.
+    */
+   virtual ~ChebyshevPicardForceModel () {}
+
+   /**
+    * Compute the acceleration at each of a set of points. The arrays are
+    * structure-of-arrays: posn[k][i] is component k of the position of
+    * point i.
+    * @param[in]  npoints  Number of points.
+    * @param[in]  times    Dynamic time of each point, in seconds.
+    * @param[in]  posn     Positions, one array per axis.
+    * @param[in]  vel      Velocities, one array per axis.
+    * @param[out] accel    Accelerations, one array per axis.
+    */
+   virtual void compute_accelerations (
+      unsigned int npoints,
+      const double * times,
+      const double * const posn[3],
+      const double * const vel[3],
+      double * const accel[3]) = 0;
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,260 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup ChebyshevPicard
+ * @{
+ *
+ * @file models/utils/integration/chebyshev_picard/include/chebyshev_picard_integrator.hh
+ * Define the class ChebyshevPicardIntegrator, which propagates a
+ * translational state over a long segment by modified Chebyshev-Picard
+ * iteration.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Bai, X. and Junkins, J. L.)
+    (Modified Chebyshev-Picard Iteration Methods for Orbit Propagation)
+    (Journal of the Astronautical Sciences, Vol. 58, No. 4)
+    (2011)))
+
+Assumptions and limitations:
+  ((Picard iteration converges only over segments that are short compared
+    with the local dynamical time scale, roughly a third of an orbit.)
+   (The segment is propagated independently of the integration loop.))
+
+Library dependencies:
+  ((../src/chebyshev_picard_integrator.cc))
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_CHEBYSHEV_PICARD_INTEGRATOR_HH
+#define JEOD_CHEBYSHEV_PICARD_INTEGRATOR_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "chebyshev_picard_force_model.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Propagates a translational state x'' = f(t, x, x') over a segment
+ * [start_time, end_time] by modified Chebyshev-Picard iteration.
+ *
+ * The trajectory is represented by Chebyshev series in the segment's
+ * normalized time, sampled at the Chebyshev-Gauss-Lobatto nodes. Each Picard
+ * iteration evaluates the acceleration at every node in one call to the
+ * force model, fits the accelerations with a Chebyshev series, and integrates
+ * the series twice to obtain new velocities and positions. The node
+ * evaluations are independent, which lets the force model spread them over
+ * cores or evaluate them as a batch. Once converged, the series give the
+ * state anywhere in the segment.
+ *
+ * This is not an er7_utils state integrator: a segment spans many integration
+ * cycles, so the class suits reference trajectories and long high-accuracy
+ * arcs computed outside the integration loop.
+ */
+class ChebyshevPicardIntegrator {
+JEOD_MAKE_SIM_INTERFACES(ChebyshevPicardIntegrator)
+
+public:
+
+   // Member data
+
+   /**
+    * Degree of the Chebyshev series fit to the accelerations. The segment
+    * has degree+1 nodes.
+    */
+   unsigned int degree; //!< trick_units(--)
+
+   /**
+    * Convergence tolerance: the iteration stops when no node position
+    * changes by more than this times the largest node position magnitude.
+    */
+   double tolerance; //!< trick_units(--)
+
+   /**
+    * Maximum number of Picard iterations per segment.
+    */
+   unsigned int max_iterations; //!< trick_units(--)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   ChebyshevPicardIntegrator ();
+   ~ChebyshevPicardIntegrator ();
+
+   // Propagate a state over a segment.
+   bool integrate_segment (
+      ChebyshevPicardForceModel & force_model,
+      double start_time,
+      double end_time,
+      const double position[3],
+      const double velocity[3]);
+
+   // Evaluate the state within the most recent segment.
+   bool interpolate (
+      double time,
+      double position[3],
+      double velocity[3]) const;
+
+   /**
+    * Get the number of iterations used by the most recent segment.
+    * @return Iteration count.
+    */
+   unsigned int get_iterations () const
+   {
+      return iterations;
+   }
+
+
+private:
+
+   // Build the node and Chebyshev polynomial tables for the degree.
+   void build_tables ();
+
+   // Fit a Chebyshev series to values at the nodes.
+   void fit_series (
+      const double * values,
+      double * coeffs) const;
+
+   // Integrate a Chebyshev series, matching an initial value.
+   static void integrate_series (
+      unsigned int ncoeffs,
+      const double * coeffs,
+      double scale,
+      double initial_value,
+      double * integral);
+
+   // Evaluate a Chebyshev series at a normalized time.
+   static double evaluate_series (
+      const double * coeffs,
+      unsigned int ncoeffs,
+      double tau);
+
+
+   // Member data
+
+   /**
+    * Degree for which the tables were built.
+    */
+   unsigned int table_degree; //!< trick_io(**)
+
+   /**
+    * Is the most recent segment valid (converged)?
+    */
+   bool valid; //!< trick_units(--)
+
+   /**
+    * Number of iterations used by the most recent segment.
+    */
+   unsigned int iterations; //!< trick_units(--)
+
+   /**
+    * Start time of the most recent segment.
+    */
+   double seg_start; //!< trick_units(s)
+
+   /**
+    * Half the duration of the most recent segment.
+    */
+   double seg_half; //!< trick_units(s)
+
+   /**
+    * Chebyshev polynomial values T_k at the nodes, (degree+1) rows by
+    * (degree+3) columns.
+    */
+   std::vector<double> cheb; //!< trick_io(**)
+
+   /**
+    * Node times.
+    */
+   std::vector<double> times; //!< trick_io(**)
+
+   /**
+    * Node positions, velocities, and accelerations, one block of
+    * degree+1 values per axis.
+    */
+   std::vector<double> posn; //!< trick_io(**)
+   std::vector<double> vel; //!< trick_io(**)
+   std::vector<double> acc; //!< trick_io(**)
+
+   /**
+    * Chebyshev coefficients of the acceleration, velocity, and position, one
+    * block of degree+3 values per axis.
+    */
+   std::vector<double> acc_coeffs; //!< trick_io(**)
+   std::vector<double> vel_coeffs; //!< trick_io(**)
+   std::vector<double> pos_coeffs; //!< trick_io(**)
+
+
+   // Make the copy constructor and assignment operator private
+   // (and unimplemented) to avoid erroneous copies
+   ChebyshevPicardIntegrator (const ChebyshevPicardIntegrator &);
+   ChebyshevPicardIntegrator & operator= (const ChebyshevPicardIntegrator &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,357 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup ChebyshevPicard
+ * @{
+ *
+ * @file models/utils/integration/chebyshev_picard/src/chebyshev_picard_integrator.cc
+ * Define member functions for the class ChebyshevPicardIntegrator.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((chebyshev_picard_integrator.cc)
+   (utils/integration/src/integration_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/integration/include/integration_messages.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/chebyshev_picard_integrator.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * ChebyshevPicardIntegrator default constructor.
+ */
+ChebyshevPicardIntegrator::ChebyshevPicardIntegrator ()
+:
+   degree (32),
+   tolerance (1e-14),
+   max_iterations (40),
+   table_degree (0),
+   valid (false),
+   iterations (0),
+   seg_start (0.0),
+   seg_half (0.0),
+   cheb (),
+   times (),
+   posn (),
+   vel (),
+   acc (),
+   acc_coeffs (),
+   vel_coeffs (),
+   pos_coeffs ()
+{
+   return;
+}
+
+
+/**
+ * ChebyshevPicardIntegrator destructor.
+ */
+ChebyshevPicardIntegrator::~ChebyshevPicardIntegrator ()
+{
+   return;
+}
+
+
+/**
+ * Build the node and Chebyshev polynomial tables for the degree.
+ * The nodes are the Chebyshev-Gauss-Lobatto points tau_j = -cos(j*pi/N),
+ * in increasing order, so that node zero is the start of the segment.
+ */
+void
+ChebyshevPicardIntegrator::build_tables ()
+{
+   unsigned int nnodes = degree + 1;
+   unsigned int ncols = degree + 3;
+
+   cheb.resize (nnodes * ncols);
+   for (unsigned int jj = 0; jj < nnodes; ++jj) {
+      double theta = M_PI - (M_PI * jj) / degree;
+      for (unsigned int kk = 0; kk < ncols; ++kk) {
+         cheb[jj*ncols + kk] = std::cos (kk * theta);
+      }
+   }
+
+   times.resize (nnodes);
+   posn.resize (3 * nnodes);
+   vel.resize (3 * nnodes);
+   acc.resize (3 * nnodes);
+   acc_coeffs.resize (3 * ncols);
+   vel_coeffs.resize (3 * ncols);
+   pos_coeffs.resize (3 * ncols);
+
+   table_degree = degree;
+}
+
+
+/**
+ * Fit a Chebyshev series of the degree to values at the nodes. At the
+ * Gauss-Lobatto nodes the fit is a discrete cosine transform.
+ * @param[in]  values  Values at the degree+1 nodes.
+ * @param[out] coeffs  Coefficients of T_0 to T_degree.
+ */
+void
+ChebyshevPicardIntegrator::fit_series (
+   const double * values,
+   double * coeffs)
+const
+{
+   unsigned int ncols = degree + 3;
+
+   for (unsigned int kk = 0; kk <= degree; ++kk) {
+      double sum = 0.5 * (values[0] * cheb[kk] +
+                          values[degree] * cheb[degree*ncols + kk]);
+      for (unsigned int jj = 1; jj < degree; ++jj) {
+         sum += values[jj] * cheb[jj*ncols + kk];
+      }
+      coeffs[kk] = (2.0 / degree) * sum;
+   }
+   coeffs[0] *= 0.5;
+   coeffs[degree] *= 0.5;
+}
+
+
+/**
+ * Integrate a Chebyshev series with respect to normalized time, scale the
+ * result, and set the constant term so the integral starts at an initial
+ * value at tau = -1.
+ * @param[in]  ncoeffs        Number of coefficients in the series.
+ * @param[in]  coeffs         Series coefficients.
+ * @param[in]  scale          Scale factor (half the segment duration).
+ * @param[in]  initial_value  Value of the integral at the segment start.
+ * @param[out] integral       Coefficients of the integral, ncoeffs+1 values.
+ */
+void
+ChebyshevPicardIntegrator::integrate_series (
+   unsigned int ncoeffs,
+   const double * coeffs,
+   double scale,
+   double initial_value,
+   double * integral)
+{
+   // Integral of T_0 is T_1, of T_1 is T_2/4, and of T_k is
+   // T_(k+1)/(2(k+1)) - T_(k-1)/(2(k-1)).
+   for (unsigned int kk = 1; kk <= ncoeffs; ++kk) {
+      double prev = coeffs[kk-1];
+      double next = (kk+1 < ncoeffs) ? coeffs[kk+1] : 0.0;
+      if (kk == 1) {
+         integral[kk] = scale * (prev - 0.5 * next);
+      }
+      else {
+         integral[kk] = scale * (prev - next) / (2.0 * kk);
+      }
+   }
+
+   // T_k(-1) = (-1)^k.
+   double start = 0.0;
+   double sign = -1.0;
+   for (unsigned int kk = 1; kk <= ncoeffs; ++kk) {
+      start += sign * integral[kk];
+      sign = -sign;
+   }
+   integral[0] = initial_value - start;
+}
+
+
+/**
+ * Evaluate a Chebyshev series at a normalized time by Clenshaw recurrence.
+ * @param[in] coeffs   Series coefficients.
+ * @param[in] ncoeffs  Number of coefficients.
+ * @param[in] tau      Normalized time, between -1 and 1.
+ * @return Value of the series.
+ */
+double
+ChebyshevPicardIntegrator::evaluate_series (
+   const double * coeffs,
+   unsigned int ncoeffs,
+   double tau)
+{
+   double b1 = 0.0;
+   double b2 = 0.0;
+   for (unsigned int kk = ncoeffs; kk-- > 1;) {
+      double b0 = 2.0 * tau * b1 - b2 + coeffs[kk];
+      b2 = b1;
+      b1 = b0;
+   }
+   return tau * b1 - b2 + coeffs[0];
+}
+
+
+/**
+ * Propagate a translational state over a segment by Picard iteration.
+ * The iteration starts from the constant velocity trajectory through the
+ * initial state and stops when the node positions converge.
+ * @param[in,out] force_model  Supplies the accelerations at the nodes.
+ * @param[in]     start_time   Segment start time, in seconds.
+ * @param[in]     end_time     Segment end time, in seconds.
+ * @param[in]     position     Position at the segment start.
+ * @param[in]     velocity     Velocity at the segment start.
+ * @return True if the iteration converged.
+ */
+bool
+ChebyshevPicardIntegrator::integrate_segment (
+   ChebyshevPicardForceModel & force_model,
+   double start_time,
+   double end_time,
+   const double position[3],
+   const double velocity[3])
+{
+   if ((degree < 2) || (! (end_time > start_time))) {
+      MessageHandler::error (
+         __FILE__, __LINE__, IntegrationMessages::invalid_request,
+         "Invalid Chebyshev-Picard segment: degree %u, times %g to %g.\n",
+         degree, start_time, end_time);
+      valid = false;
+      return false;
+   }
+
+   if (degree != table_degree) {
+      build_tables ();
+   }
+
+   unsigned int nnodes = degree + 1;
+   unsigned int ncols = degree + 3;
+
+   seg_start = start_time;
+   seg_half = 0.5 * (end_time - start_time);
+
+   // Initial guess: Constant velocity.
+   for (unsigned int jj = 0; jj < nnodes; ++jj) {
+      double tau = cheb[jj*ncols + 1];
+      times[jj] = start_time + seg_half * (tau + 1.0);
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         vel[kk*nnodes + jj] = velocity[kk];
+         posn[kk*nnodes + jj] =
+            position[kk] + velocity[kk] * (times[jj] - start_time);
+      }
+   }
+
+   const double * posn_ptrs[3] =
+      {&posn[0], &posn[nnodes], &posn[2*nnodes]};
+   const double * vel_ptrs[3] =
+      {&vel[0], &vel[nnodes], &vel[2*nnodes]};
+   double * acc_ptrs[3] =
+      {&acc[0], &acc[nnodes], &acc[2*nnodes]};
+
+   valid = false;
+   for (iterations = 1; iterations <= max_iterations; ++iterations) {
+
+      force_model.compute_accelerations (
+         nnodes, &times[0], posn_ptrs, vel_ptrs, acc_ptrs);
+
+      double max_change = 0.0;
+      double max_posn = 0.0;
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         double * acoef = &acc_coeffs[kk*ncols];
+         double * vcoef = &vel_coeffs[kk*ncols];
+         double * pcoef = &pos_coeffs[kk*ncols];
+
+         fit_series (acc_ptrs[kk], acoef);
+         integrate_series (nnodes, acoef, seg_half, velocity[kk], vcoef);
+         integrate_series (nnodes+1, vcoef, seg_half, position[kk], pcoef);
+
+         for (unsigned int jj = 0; jj < nnodes; ++jj) {
+            const double * tk = &cheb[jj*ncols];
+            double new_vel = 0.0;
+            double new_pos = 0.0;
+            for (unsigned int ii = 0; ii < nnodes+1; ++ii) {
+               new_vel += vcoef[ii] * tk[ii];
+            }
+            for (unsigned int ii = 0; ii < nnodes+2; ++ii) {
+               new_pos += pcoef[ii] * tk[ii];
+            }
+            double & old_pos = posn[kk*nnodes + jj];
+            max_change = std::max (max_change, std::fabs (new_pos - old_pos));
+            max_posn = std::max (max_posn, std::fabs (new_pos));
+            old_pos = new_pos;
+            vel[kk*nnodes + jj] = new_vel;
+         }
+      }
+
+      if (max_change <= tolerance * max_posn) {
+         valid = true;
+         break;
+      }
+   }
+
+   if (! valid) {
+      iterations = max_iterations;
+      MessageHandler::warn (
+         __FILE__, __LINE__, IntegrationMessages::information,
+         "Chebyshev-Picard iteration did not converge in %u iterations "
+         "over the segment %g to %g.\n"
+         "Shorten the segment or raise the degree.\n",
+         max_iterations, start_time, end_time);
+   }
+
+   return valid;
+}
+
+
+/**
+ * Evaluate the state within the most recent segment from its Chebyshev
+ * series.
+ * @param[in]  time      Time, in seconds.
+ * @param[out] position  Position at the time.
+ * @param[out] velocity  Velocity at the time.
+ * @return True if the segment is valid and the time lies within it.
+ */
+bool
+ChebyshevPicardIntegrator::interpolate (
+   double time,
+   double position[3],
+   double velocity[3])
+const
+{
+   if (! valid) {
+      return false;
+   }
+
+   double tau = (time - seg_start) / seg_half - 1.0;
+   if ((tau < -1.0) || (tau > 1.0)) {
+      return false;
+   }
+
+   unsigned int ncols = table_degree + 3;
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      velocity[kk] = evaluate_series (
+                        &vel_coeffs[kk*ncols], table_degree + 2, tau);
+      position[kk] = evaluate_series (
+                        &pos_coeffs[kk*ncols], table_degree + 3, tau);
+   }
+   return true;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
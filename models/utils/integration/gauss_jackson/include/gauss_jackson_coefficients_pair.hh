@@ -170,6 +170,31 @@ public:
       double const * ER7_UTILS_RESTRICT const * ER7_UTILS_RESTRICT acc_hist,
       const GaussJacksonTwoState & state_sum) const ER7_UTILS_RESTRICT;
 
+   /**
+    * Apply both sets of coefficients to the supplied history data, then
+    * add an offset and scale the result, in a single pass over the output.
+    * The first element of the output is first_scale times the sum of the
+    * first element of offset and the summed Adams inner product; the second
+    * is second_scale times the sum of the second element of offset and the
+    * Gauss-Jackson inner product. This fuses the predictor and mid-corrector
+    * computations for second order ODEs.
+    * @param  nelem         Dimensionality of each acceleration history element
+    * @param  ncoeff        Number of elements in the acceleration history
+    * @param  acc_hist      Acceleration history
+    * @param  offset        Offsets added to the inner products
+    * @param  first_scale   Scale factor for the first element
+    * @param  second_scale  Scale factor for the second element
+    * @param  state         Output state; must not overlap offset or acc_hist
+    */
+   void apply_scaled (
+      int nelem,
+      int ncoeff,
+      double const * ER7_UTILS_RESTRICT const * ER7_UTILS_RESTRICT acc_hist,
+      const GaussJacksonTwoState & offset,
+      double first_scale,
+      double second_scale,
+      const GaussJacksonTwoState & state) const ER7_UTILS_RESTRICT;
+
    /**
     * Apply just the Adams coefficients to the supplied history data.
     * @param  nelem      Dimensionality of each acceleration history element
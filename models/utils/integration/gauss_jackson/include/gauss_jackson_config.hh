@@ -158,6 +158,22 @@ public:
     */
    double absolute_tolerance; //!< trick_units(--)
 
+   /**
+    * Tolerance on the local error of an operational step, relative to the
+    * largest element of the integrated state. The error is estimated from
+    * the difference between the predicted and first corrected states.
+    * A positive value makes the step variable: once operational, the
+    * integrator halves its step (or shrinks it further) and doubles it
+    * without going back through priming, and the integrators report their
+    * error estimates (see StepErrorEstimator) for a step size scheduler.
+    * Zero keeps the step fixed; any change in step size resets the
+    * integrator. Doubling the step multiplies the error by about
+    * 2^(final_order+2), which is how much smaller the error needs to be
+    * before a scheduler should double the step.
+    * Defaults to 0.
+    */
+   double step_error_tolerance; //!< trick_units(--)
+
 
 
    // Note: The implicitly-defined default constructor, copy constructor,
@@ -65,6 +65,9 @@ Purpose: ()
 #include "gauss_jackson_integrator_base_first.hh"
 
 // JEOD includes
+#include "utils/integration/include/rebasable_integrator.hh"
+#include "utils/integration/include/snapshot_integrator.hh"
+#include "utils/integration/include/step_error_estimator.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // ER7 utilities includes
@@ -81,7 +84,10 @@ namespace jeod {
  */
 class GaussJacksonFirstOrderODEIntegrator :
    public er7_utils::FirstOrderODEIntegrator,
-   public  GaussJacksonIntegratorBaseFirst { // changed from private to public to fixed "cannot access private member error when move into namespace"
+   public  GaussJacksonIntegratorBaseFirst, // changed from private to public to fixed "cannot access private member error when move into namespace"
+   public RebasableIntegrator,
+   public SnapshotIntegrator,
+   public StepErrorEstimator {
 
 JEOD_MAKE_SIM_INTERFACES(GaussJacksonFirstOrderODEIntegrator)
 
@@ -173,6 +179,30 @@ public:
       base_reset ();
    }
 
+   /**
+    * Rebase the history at the start of the next step.
+    */
+   bool request_rebase () override
+   {
+      return base_request_rebase ();
+   }
+
+   /**
+    * Register the history with a state snapshot.
+    */
+   void add_snapshot_regions (StateSnapshot & snapshot) override
+   {
+      base_add_snapshot_regions (snapshot);
+   }
+
+   /**
+    * Get the error estimate for the most recent operational step.
+    */
+   double get_step_error () const override
+   {
+      return step_error;
+   }
+
    /**
     * Integrate.
     */
@@ -283,6 +283,12 @@ private:
     */
    unsigned int edit_count; //!< trick_units(--)
 
+   /**
+    * Number of operational cycles taken at the current step size, a lower
+    * bound on the length of the integrators' back histories.
+    */
+   unsigned int steps_at_step_size; //!< trick_units(--)
+
    /**
     * Flag indicating that the current integration cycle is the last one in
     * an integration tour (i.e., that a major time step will be completed).
@@ -298,6 +304,19 @@ private:
    void start_cycle (
       double sim_dt);
 
+   /**
+    * Can a change in the step size be made without a reset?
+    */
+   bool can_rescale_step (
+      double sim_dt,
+      er7_utils::TimeInterface & time_interface) const;
+
+   /**
+    * Change the step size of an operational, variable step integration.
+    */
+   void rescale_step (
+      double sim_dt);
+
    /**
     * Guide integration while in BootstrapEdit mode.
     */
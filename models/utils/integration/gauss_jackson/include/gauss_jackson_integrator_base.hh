@@ -65,6 +65,8 @@ Purpose: ()
 #include "gauss_jackson_state_machine.hh"
 
 // JEOD includes
+#include "utils/math/include/numerical.hh"
+#include "utils/memory/include/state_snapshot.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // ER7 utilities includes
@@ -135,6 +137,13 @@ public:
     */
    er7_utils::DoubleTwoDArray pos_hist; //!< trick_units(--)
 
+   /**
+    * Accelerations that have rotated out of the operational acceleration
+    * history, newest last. These are kept for step doubling and are only
+    * allocated when the step is variable.
+    */
+   er7_utils::DoubleTwoDArray back_hist; //!< trick_units(--)
+
    /**
     * Number that indicates the allowable relative difference for two
     * states to be considered converged.
@@ -157,6 +166,23 @@ public:
     */
    double position_corrector; //!< trick_units(--)
 
+   /**
+    * Tolerance on the step error estimate, relative to the largest element
+    * of the integrated state. Zero means the step is fixed.
+    */
+   double step_error_tolerance; //!< trick_units(--)
+
+   /**
+    * Error estimate for the most recent operational step, normalized so
+    * that one means at tolerance, or zero if none.
+    */
+   double step_error; //!< trick_units(--)
+
+   /**
+    * Dynamic time step at the most recent start of cycle.
+    */
+   double step_size; //!< trick_units(s)
+
    /**
     * Finite state machine state.
     */
@@ -187,6 +213,22 @@ public:
     */
    unsigned int history_length; //!< trick_units(--)
 
+   /**
+    * Number of valid entries in back_hist.
+    */
+   unsigned int back_length; //!< trick_units(--)
+
+   /**
+    * Re-express the history in terms of the state and acceleration supplied
+    * at the start of the next step? See request_rebase().
+    */
+   bool rebase_pending; //!< trick_units(--)
+
+   /**
+    * Estimate the step error at the first correction of this step?
+    */
+   bool estimate_pending; //!< trick_units(--)
+
 
    // Constructors, destructor, etc.
 
@@ -204,6 +246,7 @@ public:
       corrector_sum (),
       acc_hist (),
       pos_hist (),
+      back_hist (),
 
       relative_tolerance (0.0),
       absolute_tolerance (0.0),
@@ -211,12 +254,19 @@ public:
       velocity_corrector (0.0),
       position_corrector (0.0),
 
+      step_error_tolerance (0.0),
+      step_error (0.0),
+      step_size (0.0),
+
       fsm_state (GaussJacksonStateMachine::Reset),
       max_history_size (0),
       initial_order (0),
       order (0),
       size (0),
-      history_length (0)
+      history_length (0),
+      back_length (0),
+      rebase_pending (false),
+      estimate_pending (false)
    {}
 
 
@@ -245,6 +295,7 @@ public:
       corrector_sum (),
       acc_hist (),
       pos_hist (),
+      back_hist (),
 
       relative_tolerance (controls.get_config().relative_tolerance),
       absolute_tolerance (controls.get_config().absolute_tolerance),
@@ -252,12 +303,19 @@ public:
       velocity_corrector (0.0),
       position_corrector (0.0),
 
+      step_error_tolerance (controls.get_config().step_error_tolerance),
+      step_error (0.0),
+      step_size (0.0),
+
       fsm_state (GaussJacksonStateMachine::Reset),
       max_history_size (state_machine->get_max_history_size()),
       initial_order (controls.get_config().initial_order),
       order (0),
       size (size_in),
-      history_length (0)
+      history_length (0),
+      back_length (0),
+      rebase_pending (false),
+      estimate_pending (false)
    {
       // Create the primer.
       primer = create_primer (priming_constructor, size_in, priming_controls);
@@ -270,6 +328,9 @@ public:
       // Allocate histories.
       acc_hist.allocate (max_history_size, size);
       pos_hist.allocate (max_history_size, size);
+      if (step_error_tolerance > 0.0) {
+         back_hist.allocate (max_history_size, size);
+      }
    }
 
 
@@ -290,6 +351,7 @@ public:
       corrector_sum (),
       acc_hist (src.acc_hist),
       pos_hist (src.pos_hist),
+      back_hist (src.back_hist),
 
       relative_tolerance (src.relative_tolerance),
       absolute_tolerance (src.absolute_tolerance),
@@ -297,12 +359,19 @@ public:
       velocity_corrector (src.velocity_corrector),
       position_corrector (src.position_corrector),
 
+      step_error_tolerance (src.step_error_tolerance),
+      step_error (src.step_error),
+      step_size (src.step_size),
+
       fsm_state (src.fsm_state),
       max_history_size (src.max_history_size),
       initial_order (src.initial_order),
       order (src.order),
       size (src.size),
-      history_length (src.history_length)
+      history_length (src.history_length),
+      back_length (src.back_length),
+      rebase_pending (src.rebase_pending),
+      estimate_pending (src.estimate_pending)
    {
       primer = replicate_primer (src.primer);
 
@@ -335,6 +404,51 @@ protected:
       fsm_state = GaussJacksonStateMachine::Reset;
       history_length = 0;
       order = initial_order;
+      back_length = 0;
+      step_error = 0.0;
+      rebase_pending = false;
+      estimate_pending = false;
+   }
+
+   /**
+    * Request that the history be rebased at the start of the next step.
+    * Only an operational integrator can be rebased; one that is still
+    * priming or bootstrapping needs to be reset instead.
+    * @return True if the request was accepted.
+    */
+   bool base_request_rebase ()
+   {
+      if (fsm_state != GaussJacksonStateMachine::Operational) {
+         return false;
+      }
+      rebase_pending = true;
+      return true;
+   }
+
+   /**
+    * Register the integrator's history and its position in the integration
+    * process with a state snapshot. The snapshot is meant to be saved and
+    * restored between integration steps; the primer, a single-step
+    * integrator, carries nothing from one step to the next.
+    * @param[in,out] snapshot  The snapshot.
+    */
+   void base_add_snapshot_regions (
+      StateSnapshot & snapshot)
+   {
+      add_state_snapshot_regions (init_state, snapshot);
+      add_state_snapshot_regions (delinv, snapshot);
+      add_state_snapshot_regions (corrector_sum, snapshot);
+      add_history_snapshot_regions (acc_hist, snapshot);
+      add_history_snapshot_regions (pos_hist, snapshot);
+      add_history_snapshot_regions (back_hist, snapshot);
+      snapshot.add_item (step_error);
+      snapshot.add_item (step_size);
+      snapshot.add_item (fsm_state);
+      snapshot.add_item (order);
+      snapshot.add_item (history_length);
+      snapshot.add_item (back_length);
+      snapshot.add_item (rebase_pending);
+      snapshot.add_item (estimate_pending);
    }
 
    /**
@@ -367,10 +481,28 @@ protected:
          // Rotate the acceleration history and save the incoming accels.
          // This is what start_cycle() would do, but that function would do so
          // with a meaningless function call and a bunch of meaningless tests.
+         // A change in the step size (allowed only with a variable step)
+         // resamples the history at the new step size.
          if (target_stage == 1) {
+            if (step_error_tolerance > 0.0) {
+               save_back_hist ();
+            }
             rotate_acc_hist ();
             er7_utils::integ_utils::copy_array (
                deriv, size, acc_hist[order]);
+            bool resampled = false;
+            if ((step_error_tolerance > 0.0) &&
+                (! Numerical::compare_exact (dyn_dt, step_size))) {
+               resample_hist (dyn_dt / step_size);
+               resampled = true;
+            }
+            if (rebase_pending) {
+               rebase_history (dyn_dt, state);
+               rebase_pending = false;
+            }
+            else if (resampled) {
+               rebase_integration_constants (dyn_dt, state);
+            }
          }
 
          // Integrate state via the Gauss-Jackson integrator.
@@ -447,6 +579,11 @@ protected:
          }
       }
 
+      // Record the step size at the start of the cycle.
+      if (target_stage == 1) {
+         step_size = dyn_dt;
+      }
+
       // Mark the result as failed if the integration didn't converge.
       if (! passed) {
          result.set_failed ();
@@ -472,17 +609,24 @@ protected:
 
       acc_hist.swap (other.acc_hist);
       pos_hist.swap (other.pos_hist);
+      back_hist.swap (other.back_hist);
 
       std::swap (relative_tolerance, other.relative_tolerance);
       std::swap (absolute_tolerance, other.absolute_tolerance);
       std::swap (velocity_corrector, other.velocity_corrector);
       std::swap (position_corrector, other.position_corrector);
+      std::swap (step_error_tolerance, other.step_error_tolerance);
+      std::swap (step_error, other.step_error);
+      std::swap (step_size, other.step_size);
       std::swap (fsm_state, other.fsm_state);
       std::swap (max_history_size, other.max_history_size);
       std::swap (initial_order, other.initial_order);
       std::swap (order, other.order);
       std::swap (size, other.size);
       std::swap (history_length, other.history_length);
+      std::swap (back_length, other.back_length);
+      std::swap (rebase_pending, other.rebase_pending);
+      std::swap (estimate_pending, other.estimate_pending);
    }
 
 
@@ -615,10 +759,17 @@ private:
          save_comparison_data (state, pos_hist[target_index]);
 
          coeff->corrector[order].apply (size, order, ahist+1, corrector_sum);
+         estimate_pending =
+            (step_error_tolerance > 0.0) &&
+            (fsm_state == GaussJacksonStateMachine::Operational);
          return true;
       }
       else {
          correct (dt, acc, state);
+         if (estimate_pending) {
+            estimate_step_error (state, pos_hist[target_index]);
+            estimate_pending = false;
+         }
          return test_for_convergence (state, pos_hist[target_index]);
       }
    }
@@ -643,6 +794,132 @@ private:
       acc_hist.rotate_down (order);
    }
 
+   /**
+    * Save the oldest acceleration in the operational history, which is about
+    * to be rotated out, in the back history.
+    */
+   void save_back_hist ()
+   {
+      back_hist.rotate_down (order-1);
+      er7_utils::integ_utils::copy_array (acc_hist[0], size, back_hist[order-1]);
+      if (back_length < order) {
+         ++back_length;
+      }
+   }
+
+   /**
+    * Resample the acceleration history (which ends with the acceleration at
+    * the start of the step) at a new step size.
+    * Doubling the step takes every other point from the history and the
+    * back history. Shrinking the step by a factor of two or more evaluates
+    * the polynomial through the history points; all of the new history and
+    * back history then lie within the span of the old history.
+    * @param  ratio  New step size divided by the old, 2 or at most 1/2.
+    */
+   void resample_hist (double ratio)
+   {
+      double* ER7_UTILS_RESTRICT new_row;
+
+      // Double: Take every other point.
+      if (ratio > 1.0) {
+         assert (Numerical::compare_exact (ratio, 2.0));
+         assert (back_length >= order);
+         for (unsigned int jj = 0; jj <= order; ++jj) {
+            int kk = 2*int(jj) - int(order);
+            const double* ER7_UTILS_RESTRICT src =
+               (kk >= 0) ? acc_hist[kk] : back_hist[int(order)+kk];
+            er7_utils::integ_utils::copy_array (src, size, pos_hist[jj]);
+         }
+         back_length = 0;
+      }
+
+      // Shrink: Interpolate. Interpolation indices are in units of the old
+      // step, measured from the start of the old history.
+      else {
+         assert (ratio <= 0.5);
+         for (unsigned int jj = 0; jj <= order; ++jj) {
+            new_row = pos_hist[jj];
+            interpolate_acc_hist (order - ratio*(order-jj), new_row);
+         }
+         for (unsigned int mm = 0; mm < order; ++mm) {
+            new_row = back_hist[order-1-mm];
+            interpolate_acc_hist (order - ratio*(order+1+mm), new_row);
+         }
+         back_length = order;
+      }
+
+      // The new history was built in the position history, which is
+      // scratch space at the start of an operational step.
+      acc_hist.swap (pos_hist);
+   }
+
+   /**
+    * Evaluate the polynomial through the order+1 acceleration history points.
+    * @param[in]  uu   Interpolation index, between 0 and order.
+    * @param[out] acc  Interpolated acceleration.
+    */
+   void interpolate_acc_hist (
+      double uu,
+      double* ER7_UTILS_RESTRICT acc)
+   {
+      for (unsigned int ii = 0; ii < size; ++ii) {
+         acc[ii] = 0.0;
+      }
+      for (unsigned int kk = 0; kk <= order; ++kk) {
+         double weight = 1.0;
+         for (unsigned int ll = 0; ll <= order; ++ll) {
+            if (ll != kk) {
+               weight *= (uu - ll) / (double(kk) - double(ll));
+            }
+         }
+         const double* ER7_UTILS_RESTRICT ahist_kk = acc_hist[kk];
+         for (unsigned int ii = 0; ii < size; ++ii) {
+            acc[ii] += weight * ahist_kk[ii];
+         }
+      }
+   }
+
+   /**
+    * Re-express the history in terms of the current state and acceleration,
+    * which may differ discontinuously from those the history was built on.
+    * The pre-discontinuity acceleration at the current time is extrapolated
+    * from the order previous history points (an order-1 degree polynomial,
+    * the same accuracy as the integrator itself), and the difference between
+    * that and the current acceleration is applied to those points. The
+    * integration constants are then rebuilt from the current state.
+    * When nothing has changed this reproduces the existing history and
+    * integration constants to within the corrector's convergence error.
+    * @param[in]  dt     Dynamic time step, in dynamic time seconds.
+    * @param[in]  state  State vector(s) at the start of the step.
+    */
+   void rebase_history (
+      double dt,
+      const State & state)
+   {
+      // The corrector sum is recomputed later in this step; use it as scratch.
+      double* ER7_UTILS_RESTRICT jump = corrector_sum.first;
+      double binom = 1.0;
+
+      er7_utils::integ_utils::copy_array (acc_hist[order], size, jump);
+      for (unsigned int jj = 1; jj <= order; ++jj) {
+         const double* ER7_UTILS_RESTRICT ahist_jj = acc_hist[order-jj];
+         binom = binom * (order-jj+1) / jj;
+         double weight = (jj & 1) ? binom : -binom;
+         for (unsigned int ii = 0; ii < size; ++ii) {
+            jump[ii] -= weight * ahist_jj[ii];
+         }
+      }
+
+      for (unsigned int jj = 0; jj < order; ++jj) {
+         double* ER7_UTILS_RESTRICT ahist_jj = acc_hist[jj];
+         for (unsigned int ii = 0; ii < size; ++ii) {
+            ahist_jj[ii] += jump[ii];
+         }
+      }
+
+      rebase_integration_constants (dt, state);
+   }
+
 
    // The remaining member functions are template-argument specific.
 
@@ -692,6 +969,16 @@ private:
     */
    void initialize_predictor_integration_constants (double dt);
 
+   /**
+    * Rebuild the integration constants (i.e., delinv) from the state at the
+    * start of an operational step and the (rotated) acceleration history.
+    * @param  dt     Dynamic time step.
+    * @param  state  State at the start of the step.
+    */
+   void rebase_integration_constants (
+      double dt,
+      const State & state);
+
    /**
     * Advance the integration constants by one cycle.
     * @param  index  Coefficient index.
@@ -737,6 +1024,16 @@ private:
       const double* ER7_UTILS_RESTRICT acc,
       State & state);
 
+   /**
+    * Estimate the error in the step from the difference between the first
+    * corrected and the predicted state, and save it in step_error.
+    * @param  state      Corrected state.
+    * @param  hist_data  Predicted state value.
+    */
+   void estimate_step_error (
+      const State & state,
+      const double * ER7_UTILS_RESTRICT hist_data);
+
    /**
     * Test for convergence.
     * @param  state      Item to be compared.
@@ -773,6 +1070,28 @@ private:
     */
    void deallocate_state_contents (State & item);
 
+   /**
+    * Register a state item's contents with a state snapshot.
+    * @param  item      State item.
+    * @param  snapshot  The snapshot.
+    */
+   void add_state_snapshot_regions (State & item, StateSnapshot & snapshot);
+
+   /**
+    * Register a history array with a state snapshot. Both the elements and
+    * the row pointers are registered as rows are rotated by pointer.
+    * @param  hist      History array.
+    * @param  snapshot  The snapshot.
+    */
+   void add_history_snapshot_regions (
+      er7_utils::DoubleTwoDArray & hist,
+      StateSnapshot & snapshot)
+   {
+      snapshot.add_array (hist.get_element_storage(),
+                          hist.num_rows() * hist.num_cols());
+      snapshot.add_array (hist.get_row_storage(), hist.num_rows());
+   }
+
 
    // Unimplemented functions.
 
@@ -193,6 +193,31 @@ er7_utils::FirstOrderODEIntegrator>::initialize_edit_integration_constants (
 }
 
 
+/**
+ * Rebuild the integration constants (i.e., delinv).
+ * The corrector that produced the state gives
+ * x/dt = delinv.first + sum(sa*acc) + acc[order], before the constants
+ * are advanced.
+ */
+template<>
+inline void
+GaussJacksonIntegratorBase <
+GaussJacksonOneState,
+er7_utils::FirstOrderODEIntegrator>::rebase_integration_constants (
+   double dt,
+   const GaussJacksonOneState & state)
+{
+   double* ER7_UTILS_RESTRICT first_dinv = delinv.first;
+   const double* ER7_UTILS_RESTRICT acc = acc_hist[order];
+
+   coeff->corrector[order].apply (size, order+1, acc_hist, delinv);
+
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      first_dinv[ii] = state.first[ii] / dt - first_dinv[ii] - acc[ii];
+   }
+}
+
+
 /**
  * Advance the integration constants by one cycle.
  */
@@ -319,6 +344,29 @@ er7_utils::FirstOrderODEIntegrator>::correct (
 }
 
 
+/**
+ * Estimate the step error from the predictor-corrector difference.
+ */
+template<>
+inline void
+GaussJacksonIntegratorBase <
+GaussJacksonOneState,
+er7_utils::FirstOrderODEIntegrator>::estimate_step_error (
+   const GaussJacksonOneState & state,
+   const double* ER7_UTILS_RESTRICT hist_data)
+{
+   const double* ER7_UTILS_RESTRICT new_data = state.first;
+   double max_diff = 0.0;
+   double max_value = 0.0;
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      max_diff = std::max (max_diff, std::abs(new_data[ii] - hist_data[ii]));
+      max_value = std::max (max_value, std::abs(new_data[ii]));
+   }
+   double scale = step_error_tolerance * max_value;
+   step_error = (scale > 0.0) ? max_diff / scale : 0.0;
+}
+
+
 /**
  * Test for convergence.
  */
@@ -403,6 +451,21 @@ er7_utils::FirstOrderODEIntegrator>::deallocate_state_contents (
 }
 
 
+/**
+ * Register a state item's contents with a state snapshot.
+ */
+template<>
+inline void
+GaussJacksonIntegratorBase <
+GaussJacksonOneState,
+er7_utils::FirstOrderODEIntegrator>::add_state_snapshot_regions (
+   GaussJacksonOneState & item,
+   StateSnapshot & snapshot)
+{
+   snapshot.add_array (item.first, size);
+}
+
+
 } // End JEOD namespace
 
 #endif
@@ -193,6 +193,31 @@ er7_utils::SecondOrderODEIntegrator>::initialize_edit_integration_constants (
    }
 }
 
+/**
+ * Rebuild the integration constants (i.e., delinv).
+ * The corrector that produced the state gives
+ * v/dt = delinv.first + sum(sa*acc) + acc[order] and
+ * x/dt^2 = delinv.second + sum(gj*acc), before the constants are advanced.
+ */
+template<>
+inline void
+GaussJacksonIntegratorBase <
+GaussJacksonTwoState,
+er7_utils::SecondOrderODEIntegrator>::rebase_integration_constants (
+   double dt,
+   const GaussJacksonTwoState & state)
+{
+   double dtsq = dt*dt;
+   const double* ER7_UTILS_RESTRICT acc = acc_hist[order];
+
+   coeff->corrector[order].apply (size, order+1, acc_hist, delinv);
+
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      delinv.first[ii]  = state.first[ii] / dt - delinv.first[ii] - acc[ii];
+      delinv.second[ii] = state.second[ii] / dtsq - delinv.second[ii];
+   }
+}
+
 /**
  * Advance the integration constants by one cycle.
  */
@@ -248,6 +273,8 @@ er7_utils::SecondOrderODEIntegrator>::advance_predictor_integration_constants (
 
 /**
  * Apply a mid-corrector.
+ * The inner products, integration constants and step size scaling are
+ * computed in a single fused pass.
  */
 template<>
 inline void
@@ -258,18 +285,14 @@ er7_utils::SecondOrderODEIntegrator>::mid_correct (
    double dt,
    GaussJacksonTwoState & state)
 {
-   double dtsq = dt*dt;
-
-   coeff->corrector[coeff_idx].apply (size, order+1, acc_hist, state);
-
-   for (unsigned int ii = 0; ii < size; ++ii) {
-      state.first[ii] = dt * (delinv.first[ii] + state.first[ii]);
-      state.second[ii] = dtsq * (delinv.second[ii] + state.second[ii]);
-   }
+   coeff->corrector[coeff_idx].apply_scaled (
+      size, order+1, acc_hist, delinv, dt, dt*dt, state);
 }
 
 /**
  * Apply the predictor.
+ * The inner products, integration constants and step size scaling are
+ * computed in a single fused pass.
  */
 template<>
 inline void
@@ -280,18 +303,8 @@ er7_utils::SecondOrderODEIntegrator>::predict (
    double const * const * ER7_UTILS_RESTRICT ahist,
    GaussJacksonTwoState & state)
 {
-   double dtsq = dt*dt;
-   double* ER7_UTILS_RESTRICT first_dinv = delinv.first;
-   double* ER7_UTILS_RESTRICT second_dinv = delinv.second;
-   double* ER7_UTILS_RESTRICT velocity = state.first;
-   double* ER7_UTILS_RESTRICT position = state.second;
-
-   coeff->predictor.apply (size, order+1, ahist, state);
-
-   for (unsigned int ii = 0; ii < size; ++ii) {
-      velocity[ii] = dt * (first_dinv[ii] + velocity[ii]);
-      position[ii] = dtsq * (second_dinv[ii] + position[ii]);
-   }
+   coeff->predictor.apply_scaled (
+      size, order+1, ahist, delinv, dt, dt*dt, state);
 }
 
 /**
@@ -326,6 +339,28 @@ er7_utils::SecondOrderODEIntegrator>::correct (
    }
 }
 
+/**
+ * Estimate the step error from the position predictor-corrector difference.
+ */
+template<>
+inline void
+GaussJacksonIntegratorBase <
+GaussJacksonTwoState,
+er7_utils::SecondOrderODEIntegrator>::estimate_step_error (
+   const GaussJacksonTwoState & state,
+   const double* ER7_UTILS_RESTRICT hist_data)
+{
+   const double* ER7_UTILS_RESTRICT new_data = state.second;
+   double max_diff = 0.0;
+   double max_value = 0.0;
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      max_diff = std::max (max_diff, std::abs(new_data[ii] - hist_data[ii]));
+      max_value = std::max (max_value, std::abs(new_data[ii]));
+   }
+   double scale = step_error_tolerance * max_value;
+   step_error = (scale > 0.0) ? max_diff / scale : 0.0;
+}
+
 /**
  * Test for convergence.
  */
@@ -409,6 +444,22 @@ er7_utils::SecondOrderODEIntegrator>::deallocate_state_contents (
 }
 
 
+/**
+ * Register a state item's contents with a state snapshot.
+ */
+template<>
+inline void
+GaussJacksonIntegratorBase <
+GaussJacksonTwoState,
+er7_utils::SecondOrderODEIntegrator>::add_state_snapshot_regions (
+   GaussJacksonTwoState & item,
+   StateSnapshot & snapshot)
+{
+   snapshot.add_array (item.first, size);
+   snapshot.add_array (item.second, size);
+}
+
+
 } // End JEOD namespace
 
 #endif
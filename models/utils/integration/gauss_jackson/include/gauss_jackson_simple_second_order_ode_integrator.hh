@@ -52,6 +52,8 @@
 
 /*
 Purpose: ()
+Library dependencies:
+  ((../src/gauss_jackson_simple_second_order_ode_integrator.cc))
 */
 
 
@@ -63,6 +65,10 @@ Purpose: ()
 #include "gauss_jackson_two_state.hh"
 
 // JEOD includes
+#include "utils/integration/include/dense_output_interpolator.hh"
+#include "utils/integration/include/rebasable_integrator.hh"
+#include "utils/integration/include/snapshot_integrator.hh"
+#include "utils/integration/include/step_error_estimator.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // ER7 utilities includes
@@ -81,10 +87,20 @@ namespace jeod {
  * Using composition instead of private inheritance would make Trick 13
  * checkpoint/restart a lot trickier to implement. With private inheritance,
  * the Trick 13 io_src file contains all the necessary information.
+ *
+ * Once operational, the integrator also provides its natural interpolant
+ * (the twice-integrated acceleration history polynomial) as dense output,
+ * its history can be rebased across a small state discontinuity or saved in
+ * a state snapshot, and with a variable step it estimates the error of each
+ * operational step.
  */
 class GaussJacksonSimpleSecondOrderODEIntegrator :
    public er7_utils::SecondOrderODEIntegrator,
-   public GaussJacksonIntegratorBaseSecond {  // changed from private to public to fixed "cannot access private member error when move into namespace"
+   public GaussJacksonIntegratorBaseSecond,
+   public DenseOutputInterpolator,
+   public RebasableIntegrator,
+   public SnapshotIntegrator,
+   public StepErrorEstimator {  // changed from private to public to fixed "cannot access private member error when move into namespace"
 JEOD_MAKE_SIM_INTERFACES(GaussJacksonSimpleSecondOrderODEIntegrator)
 
 public:
@@ -186,6 +202,35 @@ public:
    }
 
 
+   /**
+    * Rebase the history at the start of the next step.
+    * @return True if the request was accepted.
+    */
+   bool request_rebase () override
+   {
+      return base_request_rebase ();
+   }
+
+   /**
+    * Register the history with a state snapshot.
+    * @param[in,out] snapshot  The snapshot.
+    */
+   void add_snapshot_regions (StateSnapshot & snapshot) override
+   {
+      base_add_snapshot_regions (snapshot);
+   }
+
+
+   /**
+    * Get the error estimate for the most recent operational step.
+    * @return Normalized error estimate, zero if none.
+    */
+   double get_step_error () const override
+   {
+      return step_error;
+   }
+
+
    /**
     * Propagate state using Gauss-Jackson.
     * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
@@ -208,6 +253,15 @@ public:
                              GaussJacksonTwoState (vel, pos));
    }
 
+   // Evaluate the natural interpolant over the most recent step.
+   bool interpolate_second_order (
+      double step_dt,
+      double offset,
+      double const * end_velocity,
+      double const * end_position,
+      double * velocity,
+      double * position) const override;
+
 private:
 
    using SecondOrderODEIntegrator::swap;
@@ -264,6 +264,45 @@ public:
    }
 
 
+   /**
+    * Get the number of rows.
+    * @return Number of rows.
+    */
+   std::size_t num_rows () const
+   {
+      return static_cast<std::size_t> (n);
+   }
+
+   /**
+    * Get the number of columns.
+    * @return Number of columns.
+    */
+   std::size_t num_cols () const
+   {
+      return static_cast<std::size_t> (m);
+   }
+
+   /**
+    * Get the storage that holds the elements, num_rows()*num_cols()
+    * elements. Rows are not necessarily stored in order; the row pointers
+    * (see get_row_storage) give the order.
+    * @return The element storage.
+    */
+   T* get_element_storage ()
+   {
+      return data_array;
+   }
+
+   /**
+    * Get the storage that holds the num_rows() row pointers.
+    * @return The row pointer storage.
+    */
+   T** get_row_storage ()
+   {
+      return row_array;
+   }
+
+
    /**
     * Allocate the array.
     * @param  N  Number of rows in the array.
@@ -33,6 +33,206 @@ Purpose: ()
 //! Namespace jeod 
 namespace jeod {
 
+namespace {
+
+/**
+ * States with at most this many elements (e.g., a translational state)
+ * keep their sums in registers across the whole history.
+ */
+const int small_state_size = 4;
+
+
+/**
+ * Finish one output element: output = scale * (offset + sum) when Affine
+ * is set, output = sum otherwise.
+ */
+template <bool Affine>
+inline double
+finish_sum (
+   double sum,
+   double offset,
+   double scale)
+{
+   return Affine ? scale * (offset + sum) : sum;
+}
+
+
+/**
+ * Compute the summed Adams and Gauss-Jackson inner products for a state
+ * of exactly N elements, with the sums held in registers.
+ * The sums are accumulated in history order, so the results are identical
+ * to those of the history-major loop in two_state_sums.
+ */
+template <int N, bool Affine>
+inline void
+two_state_small (
+   int ncoeff,
+   const double * ER7_UTILS_RESTRICT sa_coefs,
+   const double * ER7_UTILS_RESTRICT gj_coefs,
+   double const * ER7_UTILS_RESTRICT const * ER7_UTILS_RESTRICT acc_hist,
+   const double * ER7_UTILS_RESTRICT first_offset,
+   const double * ER7_UTILS_RESTRICT second_offset,
+   double first_scale,
+   double second_scale,
+   double * ER7_UTILS_RESTRICT first_out,
+   double * ER7_UTILS_RESTRICT second_out)
+{
+   double vel_sum[N];
+   double pos_sum[N];
+
+   double sa_i = sa_coefs[0];
+   double gj_i = gj_coefs[0];
+   const double * ER7_UTILS_RESTRICT acc_i = acc_hist[0];
+   for (int kk = 0; kk < N; ++kk) {
+      vel_sum[kk] = acc_i[kk] * sa_i;
+      pos_sum[kk] = acc_i[kk] * gj_i;
+   }
+
+   for (int icoeff = 1; icoeff < ncoeff; ++icoeff) {
+      sa_i = sa_coefs[icoeff];
+      gj_i = gj_coefs[icoeff];
+      acc_i = acc_hist[icoeff];
+      for (int kk = 0; kk < N; ++kk) {
+         vel_sum[kk] += acc_i[kk] * sa_i;
+         pos_sum[kk] += acc_i[kk] * gj_i;
+      }
+   }
+
+   for (int kk = 0; kk < N; ++kk) {
+      first_out[kk] = finish_sum<Affine> (
+         vel_sum[kk], Affine ? first_offset[kk] : 0.0, first_scale);
+      second_out[kk] = finish_sum<Affine> (
+         pos_sum[kk], Affine ? second_offset[kk] : 0.0, second_scale);
+   }
+}
+
+
+/**
+ * Compute the summed Adams and Gauss-Jackson inner products.
+ * Small states use two_state_small. Larger states are summed history point
+ * by history point, each pass a unit-stride loop over all elements of both
+ * outputs; the last pass also applies the offset and scale.
+ */
+template <bool Affine>
+inline void
+two_state_sums (
+   int nelem,
+   int ncoeff,
+   const double * ER7_UTILS_RESTRICT sa_coefs,
+   const double * ER7_UTILS_RESTRICT gj_coefs,
+   double const * ER7_UTILS_RESTRICT const * ER7_UTILS_RESTRICT acc_hist,
+   const double * ER7_UTILS_RESTRICT first_offset,
+   const double * ER7_UTILS_RESTRICT second_offset,
+   double first_scale,
+   double second_scale,
+   double * ER7_UTILS_RESTRICT first_out,
+   double * ER7_UTILS_RESTRICT second_out)
+{
+   switch (nelem) {
+   case 3:
+      two_state_small<3, Affine> (
+         ncoeff, sa_coefs, gj_coefs, acc_hist, first_offset, second_offset,
+         first_scale, second_scale, first_out, second_out);
+      return;
+   case 4:
+      two_state_small<4, Affine> (
+         ncoeff, sa_coefs, gj_coefs, acc_hist, first_offset, second_offset,
+         first_scale, second_scale, first_out, second_out);
+      return;
+   case 2:
+      two_state_small<2, Affine> (
+         ncoeff, sa_coefs, gj_coefs, acc_hist, first_offset, second_offset,
+         first_scale, second_scale, first_out, second_out);
+      return;
+   case 1:
+      two_state_small<1, Affine> (
+         ncoeff, sa_coefs, gj_coefs, acc_hist, first_offset, second_offset,
+         first_scale, second_scale, first_out, second_out);
+      return;
+   default:
+      break;
+   }
+
+   int last = ncoeff - 1;
+   double sa_i = sa_coefs[0];
+   double gj_i = gj_coefs[0];
+   const double * ER7_UTILS_RESTRICT acc_i = acc_hist[0];
+
+   if (last == 0) {
+      for (int jj = 0; jj < nelem; ++jj) {
+         first_out[jj] = finish_sum<Affine> (
+            acc_i[jj] * sa_i, Affine ? first_offset[jj] : 0.0, first_scale);
+         second_out[jj] = finish_sum<Affine> (
+            acc_i[jj] * gj_i, Affine ? second_offset[jj] : 0.0, second_scale);
+      }
+      return;
+   }
+
+   for (int jj = 0; jj < nelem; ++jj) {
+      first_out[jj] = acc_i[jj] * sa_i;
+      second_out[jj] = acc_i[jj] * gj_i;
+   }
+
+   for (int icoeff = 1; icoeff < last; ++icoeff) {
+      sa_i = sa_coefs[icoeff];
+      gj_i = gj_coefs[icoeff];
+      acc_i = acc_hist[icoeff];
+      for (int jj = 0; jj < nelem; ++jj) {
+         first_out[jj] += acc_i[jj] * sa_i;
+         second_out[jj] += acc_i[jj] * gj_i;
+      }
+   }
+
+   sa_i = sa_coefs[last];
+   gj_i = gj_coefs[last];
+   acc_i = acc_hist[last];
+   for (int jj = 0; jj < nelem; ++jj) {
+      first_out[jj] = finish_sum<Affine> (
+         first_out[jj] + acc_i[jj] * sa_i,
+         Affine ? first_offset[jj] : 0.0, first_scale);
+      second_out[jj] = finish_sum<Affine> (
+         second_out[jj] + acc_i[jj] * gj_i,
+         Affine ? second_offset[jj] : 0.0, second_scale);
+   }
+}
+
+
+/**
+ * Compute the summed Adams inner products for a state of exactly N
+ * elements, with the sums held in registers.
+ */
+template <int N>
+inline void
+one_state_small (
+   int ncoeff,
+   const double * ER7_UTILS_RESTRICT sa_coefs,
+   double const * ER7_UTILS_RESTRICT const * ER7_UTILS_RESTRICT deriv_hist,
+   double * ER7_UTILS_RESTRICT out)
+{
+   double sum[N];
+
+   double sa_i = sa_coefs[0];
+   const double * ER7_UTILS_RESTRICT deriv_i = deriv_hist[0];
+   for (int kk = 0; kk < N; ++kk) {
+      sum[kk] = deriv_i[kk] * sa_i;
+   }
+
+   for (int icoeff = 1; icoeff < ncoeff; ++icoeff) {
+      sa_i = sa_coefs[icoeff];
+      deriv_i = deriv_hist[icoeff];
+      for (int kk = 0; kk < N; ++kk) {
+         sum[kk] += deriv_i[kk] * sa_i;
+      }
+   }
+
+   for (int kk = 0; kk < N; ++kk) {
+      out[kk] = sum[kk];
+   }
+}
+
+}
+
+
 void
 GaussJacksonCoefficientsPair::allocate_arrays (
    int size)
@@ -67,28 +267,26 @@ GaussJacksonCoefficientsPair::apply (
    const GaussJacksonTwoState & state_sum)
 const ER7_UTILS_RESTRICT
 {
-   double * ER7_UTILS_RESTRICT vel_sum = state_sum.first;
-   double * ER7_UTILS_RESTRICT pos_sum = state_sum.second;
+   two_state_sums<false> (
+      nelem, ncoeff, sa_coefs, gj_coefs, acc_hist, nullptr, nullptr, 1.0, 1.0,
+      state_sum.first, state_sum.second);
+}
 
-   double sa_i = sa_coefs[0];
-   double gj_i = gj_coefs[0];
-   const double * ER7_UTILS_RESTRICT acc_i = acc_hist[0];
-   for (int jj = 0; jj < nelem; ++jj) {
-      double acc_ij = acc_i[jj];
-      vel_sum[jj] = acc_ij * sa_i;
-      pos_sum[jj] = acc_ij * gj_i;
-   }
 
-   for (int icoeff = 1; icoeff < ncoeff; ++icoeff) {
-      sa_i = sa_coefs[icoeff];
-      gj_i = gj_coefs[icoeff];
-      acc_i = acc_hist[icoeff];
-      for (int jj = 0; jj < nelem; ++jj) {
-         double acc_ij = acc_i[jj];
-         vel_sum[jj] += acc_ij * sa_i;
-         pos_sum[jj] += acc_ij * gj_i;
-      }
-   }
+void
+GaussJacksonCoefficientsPair::apply_scaled (
+   int nelem,
+   int ncoeff,
+   double const * ER7_UTILS_RESTRICT const * ER7_UTILS_RESTRICT acc_hist,
+   const GaussJacksonTwoState & offset,
+   double first_scale,
+   double second_scale,
+   const GaussJacksonTwoState & state)
+const ER7_UTILS_RESTRICT
+{
+   two_state_sums<true> (
+      nelem, ncoeff, sa_coefs, gj_coefs, acc_hist, offset.first, offset.second,
+      first_scale, second_scale, state.first, state.second);
 }
 
 
@@ -102,6 +300,18 @@ const ER7_UTILS_RESTRICT
 {
    double * ER7_UTILS_RESTRICT vel_sum = state_sum.first;
 
+   // Small states (e.g., a rotational rate): sum in registers.
+   switch (nelem) {
+   case 3:
+      one_state_small<3> (ncoeff, sa_coefs, deriv_hist, vel_sum);
+      return;
+   case 4:
+      one_state_small<4> (ncoeff, sa_coefs, deriv_hist, vel_sum);
+      return;
+   default:
+      break;
+   }
+
    double sa_i = sa_coefs[0];
    const double * ER7_UTILS_RESTRICT deriv_i = deriv_hist[0];
    for (int jj = 0; jj < nelem; ++jj) {
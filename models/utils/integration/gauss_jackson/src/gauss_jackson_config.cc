@@ -48,6 +48,7 @@ GaussJacksonConfig::default_configuration ()
    result.relative_tolerance = -1;
    result.absolute_tolerance = -1;
    result.max_correction_iterations = -1;
+   result.step_error_tolerance = -1;
 
    return result;
 }
@@ -65,6 +66,7 @@ GaussJacksonConfig::standard_configuration ()
    result.relative_tolerance = 1e-14;
    result.absolute_tolerance = 1e-14;
    result.max_correction_iterations = 10;
+   result.step_error_tolerance = 0.0;
 
    return result;
 }
@@ -153,6 +155,10 @@ static GaussJacksonConfig set_default_config_values (
       result.absolute_tolerance = 1e-10;
    }
 
+   if (Numerical::compare_exact(result.step_error_tolerance,-1.0)) {
+      result.step_error_tolerance = 0.0;
+   }
+
    return result;
 }
 
@@ -226,6 +232,17 @@ static unsigned int validate_config (
       ++error_count;
    }
 
+   // The step error tolerance must be non-negative.
+   if (config.step_error_tolerance < 0.0) {
+      er7_utils::MessageHandler::error (
+         __FILE__, __LINE__,
+         er7_utils::IntegrationMessages::invalid_request,
+         "Illegal Gauss-Jackson configuration:\n"
+         "The step error tolerance %g must be non-negative.",
+         config.step_error_tolerance);
+      ++error_count;
+   }
+
    return error_count;
 }
 
@@ -62,6 +62,7 @@ GaussJacksonIntegrationControls::GaussJacksonIntegrationControls ()
    initial_order (0),
    order (0),
    edit_count (0),
+   steps_at_step_size (0),
    at_end_of_tour (false)
 {
    reset_needed = false;
@@ -88,6 +89,7 @@ GaussJacksonIntegrationControls::GaussJacksonIntegrationControls (
    initial_order (config_in.initial_order),
    order (config_in.initial_order),
    edit_count (0),
+   steps_at_step_size (0),
    at_end_of_tour (false)
 {
    priming_controls = priming_constructor.create_integration_controls();
@@ -117,6 +119,7 @@ GaussJacksonIntegrationControls::GaussJacksonIntegrationControls (
    initial_order (src.initial_order),
    order (src.order),
    edit_count (src.edit_count),
+   steps_at_step_size (src.steps_at_step_size),
    at_end_of_tour (src.at_end_of_tour)
 {
    if (src.priming_controls != nullptr) {
@@ -159,6 +162,7 @@ GaussJacksonIntegrationControls::swap (
    std::swap (initial_order, other.initial_order);
    std::swap (order, other.order);
    std::swap (edit_count, other.edit_count);
+   std::swap (steps_at_step_size, other.steps_at_step_size);
    std::swap (at_end_of_tour, other.at_end_of_tour);
 }
 
@@ -168,6 +172,7 @@ GaussJacksonIntegrationControls::reset_integrator ()
 {
    fsm_state = GaussJacksonStateMachine::Reset;
    edit_count = 0;
+   steps_at_step_size = 0;
    cycle_stage = 0;
    order = initial_order;
    at_end_of_tour = false;
@@ -186,8 +191,17 @@ GaussJacksonIntegrationControls::integrate (
    // Starting a new integration tour needs special processing.
    if (step_number == 0) {
 
+      // Rescale the step if the step size alone has changed and
+      // the integrators can carry their histories to the new step size.
+      if ((! reset_needed) &&
+          (! Numerical::compare_exact(integ_simdt,sim_dt)) &&
+          can_rescale_step (sim_dt, time_interface)) {
+         rescale_step (sim_dt);
+      }
+
       // Reset the integrators, time if the meaning of time has changed.
-      if (reset_needed || (!Numerical::compare_exact(integ_simdt,sim_dt))) {
+      else if (reset_needed ||
+               (!Numerical::compare_exact(integ_simdt,sim_dt))) {
 
          // Reset integrators.
          integ_group.reset_body_integrators ();
@@ -218,6 +232,7 @@ GaussJacksonIntegrationControls::integrate (
       // All that remains is to set the cycle start time.
       if (cycle_stage == 0) {
          cycle_starttime = start_time;
+         ++steps_at_step_size;
       }
       // Integrate using the Gauss-Jackson predictor/corrector.
       integrate_gj (time_interface, integ_group);
@@ -271,6 +286,45 @@ GaussJacksonIntegrationControls::integrate (
 }
 
 
+bool
+GaussJacksonIntegrationControls::can_rescale_step (
+   double sim_dt,
+   er7_utils::TimeInterface & time_interface)
+const
+{
+   // Only an operational, variable step integration can change step size,
+   // and only if the meaning of time has not changed as well.
+   if ((config.step_error_tolerance <= 0.0) ||
+       (fsm_state != GaussJacksonStateMachine::Operational) ||
+       (!Numerical::compare_exact(time_interface.get_time_scale_factor(),
+                                  time_scale_factor))) {
+      return false;
+   }
+
+   // The step can be shrunk by a factor of two or more at any time: the
+   // history is resampled by interpolation. The step can be doubled once
+   // the integrators have order steps of back history at the current size.
+   return (sim_dt <= 0.5*integ_simdt) ||
+          (Numerical::compare_exact(sim_dt, 2.0*integ_simdt) &&
+           (steps_at_step_size >= order));
+}
+
+
+void
+GaussJacksonIntegrationControls::rescale_step (
+   double sim_dt)
+{
+   // A shrunken step leaves the integrators with a full back history.
+   steps_at_step_size = (sim_dt > integ_simdt) ? 0 : order;
+
+   integ_simdt = sim_dt;
+   integ_dyndt = sim_dt * time_scale_factor;
+
+   cycle_simdt = sim_dt;
+   cycle_dyndt = cycle_simdt * time_scale_factor;
+}
+
+
 void
 GaussJacksonIntegrationControls::integrate_edit (
    er7_utils::TimeInterface & time_interface,
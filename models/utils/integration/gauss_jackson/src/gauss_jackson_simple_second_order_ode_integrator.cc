@@ -0,0 +1,155 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup GaussJackson
+ * @{
+ *
+ * @file models/utils/integration/gauss_jackson/src/gauss_jackson_simple_second_order_ode_integrator.cc
+ * Defines member functions for the class
+ * GaussJacksonSimpleSecondOrderODEIntegrator.
+ */
+
+
+/*
+Purpose: ()
+*/
+
+
+// Local includes
+#include "../include/gauss_jackson_simple_second_order_ode_integrator.hh"
+
+// System includes
+#include <cstddef>
+
+
+//! Namespace jeod 
+namespace jeod {
+
+namespace {
+
+/**
+ * Maximum number of acceleration history points used by the interpolant,
+ * one more than the maximum Gauss-Jackson order.
+ */
+const unsigned int max_interp_points = 16;
+
+/**
+ * Number of Gauss-Legendre points, which integrates polynomials of degree
+ * 2*num_gauss_points-1 = 15 exactly. The integrands below are of degree
+ * order+1 at most, with order no greater than 14.
+ */
+const unsigned int num_gauss_points = 8;
+
+/**
+ * Gauss-Legendre abscissae on [-1,1].
+ */
+const double gauss_abscissa[num_gauss_points] = {
+   -0.9602898564975363, -0.7966664774136267,
+   -0.5255324099163290, -0.1834346424956498,
+    0.1834346424956498,  0.5255324099163290,
+    0.7966664774136267,  0.9602898564975363};
+
+/**
+ * Gauss-Legendre weights.
+ */
+const double gauss_weight[num_gauss_points] = {
+   0.1012285362903763, 0.2223810344533745,
+   0.3137066458778873, 0.3626837833783620,
+   0.3626837833783620, 0.3137066458778873,
+   0.2223810344533745, 0.1012285362903763};
+
+} // End anonymous namespace
+
+
+/**
+ * Evaluate the natural interpolant over the most recent step.
+ *
+ * The acceleration history a_j, j=0..order, is taken at times
+ * t_end + (j-order-1)*h. With p(u) the polynomial through those points,
+ * in units of the step size h,
+ *   v(u) = v_end + h * integral_0^u p(w) dw
+ *   x(u) = x_end + u*h*v_end + h^2 * integral_0^u (u-w) p(w) dw
+ * for u = offset/h in [-1,0]. The integrals are evaluated by Gauss-Legendre
+ * quadrature, which is exact for these polynomial integrands.
+ *
+ * @param[in]  step_dt       Size of the most recent step.
+ * @param[in]  offset        Time relative to the end of the step.
+ * @param[in]  end_velocity  Velocity at the end of the step.
+ * @param[in]  end_position  Position at the end of the step.
+ * @param[out] velocity      Interpolated velocity.
+ * @param[out] position      Interpolated position.
+ * @return True if operational (and thus able to interpolate).
+ */
+bool
+GaussJacksonSimpleSecondOrderODEIntegrator::interpolate_second_order (
+   double step_dt,
+   double offset,
+   double const * end_velocity,
+   double const * end_position,
+   double * velocity,
+   double * position)
+const
+{
+   unsigned int npoints = order + 1;
+
+   if ((fsm_state != GaussJacksonStateMachine::Operational) ||
+       (npoints > max_interp_points) ||
+       (! (step_dt > 0.0))) {
+      return false;
+   }
+
+   double uu = offset / step_dt;
+   double vel_weight[max_interp_points];
+   double pos_weight[max_interp_points];
+
+   // Compute the quadrature weights for each history point.
+   for (unsigned int jj = 0; jj < npoints; ++jj) {
+      vel_weight[jj] = 0.0;
+      pos_weight[jj] = 0.0;
+   }
+   for (unsigned int iq = 0; iq < num_gauss_points; ++iq) {
+      double ww = 0.5 * uu * (1.0 + gauss_abscissa[iq]);
+      double wq = 0.5 * uu * gauss_weight[iq];
+      for (unsigned int jj = 0; jj < npoints; ++jj) {
+         double uj = static_cast<double>(jj) - npoints;
+         double basis = 1.0;
+         for (unsigned int kk = 0; kk < npoints; ++kk) {
+            if (kk != jj) {
+               double uk = static_cast<double>(kk) - npoints;
+               basis *= (ww - uk) / (uj - uk);
+            }
+         }
+         vel_weight[jj] += wq * basis;
+         pos_weight[jj] += wq * (uu - ww) * basis;
+      }
+   }
+
+   // Apply the weights to the acceleration history.
+   double dtsq = step_dt * step_dt;
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      double vsum = 0.0;
+      double psum = 0.0;
+      for (unsigned int jj = 0; jj < npoints; ++jj) {
+         double acc = acc_hist[jj][ii];
+         vsum += vel_weight[jj] * acc;
+         psum += pos_weight[jj] * acc;
+      }
+      velocity[ii] = end_velocity[ii] + step_dt * vsum;
+      position[ii] = end_position[ii] + offset * end_velocity[ii] + dtsq * psum;
+   }
+
+   return true;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
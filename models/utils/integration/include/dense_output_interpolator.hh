@@ -0,0 +1,123 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/include/dense_output_interpolator.hh
+ * Define the class DenseOutputInterpolator.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_DENSE_OUTPUT_INTERPOLATOR_HH
+#define JEOD_DENSE_OUTPUT_INTERPOLATOR_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A DenseOutputInterpolator is a state integrator that can evaluate its own
+ * continuous extension (natural interpolant) over the most recently
+ * completed integration step without additional derivative evaluations.
+ * State integrators that do not inherit from this class are interpolated
+ * by SecondOrderDenseOutput via Hermite interpolation.
+ */
+class DenseOutputInterpolator {
+
+ JEOD_MAKE_SIM_INTERFACES(DenseOutputInterpolator)
+
+public:
+
+   // NOTE:
+   // The default constructor, copy constructor, and assignment operator
+   // are not declared. The C++ defaults suffice.
+
+   /**
+    * Destructor.
+    */
+   virtual ~DenseOutputInterpolator () {}
+
+
+   /**
+    * Interpolate a second order state within the most recent step.
+    * @param[in]  step_dt       Size of the most recent step, dynamic seconds.
+    * @param[in]  offset        Time of interest relative to the end of the
+    *                           step, between -step_dt and zero.
+    * @param[in]  end_velocity  Generalized velocity at the end of the step.
+    * @param[in]  end_position  Generalized position at the end of the step.
+    * @param[out] velocity      Interpolated generalized velocity.
+    * @param[out] position      Interpolated generalized position.
+    * @return True if the interpolation was performed; false if the
+    *         integrator cannot currently interpolate (e.g., while priming).
+    */
+   virtual bool interpolate_second_order (
+      double step_dt,
+      double offset,
+      double const * end_velocity,
+      double const * end_position,
+      double * velocity,
+      double * position) const = 0;
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
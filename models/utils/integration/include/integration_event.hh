@@ -0,0 +1,193 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/include/integration_event.hh
+ * Define the class IntegrationEvent.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/integration_event.cc))
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_INTEGRATION_EVENT_HH
+#define JEOD_INTEGRATION_EVENT_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class JeodIntegrationGroup;
+
+
+/**
+ * An IntegrationEvent is a condition defined by the sign of a scalar guard
+ * function of the state, such as an altitude less a threshold or a shadow
+ * function. An integration group that records dense output checks the
+ * guards of its events after each integration step. When a guard changes
+ * sign over the step, the time at which it crossed zero is found by root
+ * finding on the interpolated state, and handle_event is called with that
+ * time. The step itself is neither shortened nor repeated: the event is
+ * reported after the step in which it occurred, and a handler that needs
+ * the state at the event can interpolate it from the group.
+ */
+class IntegrationEvent {
+
+ JEOD_MAKE_SIM_INTERFACES(IntegrationEvent)
+
+public:
+
+   /**
+    * Which zero crossings of the guard are events.
+    */
+   enum Direction {
+      Either  = 0, ///< Crossings in either direction
+      Rising  = 1, ///< Crossings from negative to non-negative
+      Falling = 2  ///< Crossings from positive to non-positive
+   };
+
+
+   // Constructor and destructor.
+   IntegrationEvent ();
+   virtual ~IntegrationEvent ();
+
+   /**
+    * Evaluate the guard function at a time within the group's most recent
+    * integration step, using JeodIntegrationGroup::interpolate_state.
+    * @param[in]  group     The group that detected the step.
+    * @param[in]  dyn_time  Dynamic time, in seconds.
+    * @param[out] value     Guard value.
+    * @return True if the guard could be evaluated.
+    */
+   virtual bool evaluate_guard (
+      const JeodIntegrationGroup & group,
+      double dyn_time,
+      double & value) = 0;
+
+   /**
+    * Respond to the event. The default records nothing beyond event_time
+    * and event_count, which are updated before this is called.
+    * @param[in] group     The group that detected the event.
+    * @param[in] dyn_time  Dynamic time of the event, in seconds.
+    */
+   virtual void handle_event (
+      JeodIntegrationGroup & group JEOD_UNUSED,
+      double dyn_time JEOD_UNUSED)
+   { }
+
+   // Look for a zero crossing of the guard within a step.
+   bool locate (
+      const JeodIntegrationGroup & group,
+      double start_time,
+      double end_time,
+      double & crossing_time);
+
+
+   // Member data
+
+   /**
+    * Is the event checked?
+    */
+   bool active; //!< trick_units(--)
+
+   /**
+    * Which zero crossings of the guard are events.
+    */
+   Direction direction; //!< trick_units(--)
+
+   /**
+    * Width of the time interval to which a crossing is narrowed.
+    */
+   double time_tolerance; //!< trick_units(s)
+
+   /**
+    * Maximum number of guard evaluations per crossing.
+    */
+   unsigned int max_iterations; //!< trick_units(--)
+
+   /**
+    * Dynamic time of the most recent event.
+    */
+   double event_time; //!< trick_units(s)
+
+   /**
+    * Number of events detected.
+    */
+   unsigned int event_count; //!< trick_units(--)
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   IntegrationEvent (const IntegrationEvent &);
+
+   /**
+    * Not implemented.
+    */
+   IntegrationEvent & operator= (const IntegrationEvent &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -70,6 +70,7 @@ Library dependencies:
 #include "utils/sim_interface/include/jeod_class.hh"
 
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/container/include/position_index.hh"
 #include "utils/sim_interface/include/jeod_integrator_interface.hh"
 
 // ER7 utilities includes
@@ -86,6 +87,7 @@ Library dependencies:
 namespace jeod {
 
 // Forward declarations
+class IntegrationEvent;
 class JeodIntegrationGroup;
 class JeodIntegrationTime;
 
@@ -226,6 +228,7 @@ public:
     */
    void reset_body_integrators (void) override
    {
+       dense_output_valid = false;
        reset_container (integrable_objects);
    }
 
@@ -264,6 +267,67 @@ public:
    virtual void remove_integrable_object (
       er7_utils::IntegrableObject & integrable_object);
 
+   /**
+    * Add an event to be checked after each integration step.
+    * Events are located by interpolation, so adding one enables dense output.
+    * @param[in] event  Event to be added.
+    */
+   virtual void add_event (IntegrationEvent & event);
+
+   /**
+    * Remove an event from the vector of such.
+    * @param[in] event  Event to be removed.
+    */
+   virtual void remove_event (IntegrationEvent & event);
+
+   /**
+    * Get the time interval spanned by the most recent integration step,
+    * within which interpolate_state can be used.
+    * @param[out] start_time  Dynamic time at the start of the step.
+    * @param[out] end_time    Dynamic time at the end of the step.
+    * @return True if dense output is enabled and a step has completed
+    *         since the last reset.
+    */
+   bool get_dense_output_interval (
+      double & start_time,
+      double & end_time)
+   const
+   {
+      start_time = dense_output_start;
+      end_time = dense_output_end;
+      return dense_output && dense_output_valid;
+   }
+
+   /**
+    * Interpolate the state of an object integrated by this group at a time
+    * within the most recent integration step, without evaluating derivatives.
+    * This default implementation supports no objects; derived classes
+    * that record dense output override it.
+    * @param[in]  object    Object whose state is wanted.
+    * @param[in]  dyn_time  Dynamic time, in seconds.
+    * @param[out] velocity  Interpolated generalized velocity.
+    * @param[out] position  Interpolated generalized position.
+    * @return True if the state was interpolated.
+    */
+   virtual bool interpolate_state (
+      const er7_utils::IntegrableObject & object JEOD_UNUSED,
+      double dyn_time JEOD_UNUSED,
+      double * velocity JEOD_UNUSED,
+      double * position JEOD_UNUSED)
+   const
+   {
+      return false;
+   }
+
+
+   // Member data
+
+   /**
+    * Record the states at the start and end of each integration step so
+    * that they can be interpolated within the step (dense output)?
+    */
+   bool dense_output; //!< trick_units(--)
+
 
 protected:
 
@@ -316,6 +380,14 @@ protected:
    }
 
 
+   /**
+    * Check the events against the most recent integration step, and
+    * handle those that occurred in time order. Derived classes that record
+    * dense output call this once a step has been recorded.
+    */
+   void detect_events (void);
+
+
    // Member data
 
    // Note: The first four of the following are const pointers rather than
@@ -351,6 +423,33 @@ protected:
    JeodPointerVector<er7_utils::IntegrableObject>::type
       integrable_objects; //!< trick_io(**)
 
+   /**
+    * Positions of the integrable objects, for constant-time addition and
+    * removal.
+    */
+   PositionIndex<er7_utils::IntegrableObject>
+      integrable_object_positions; //!< trick_io(**)
+
+   /**
+    * The events checked after each integration step.
+    */
+   JeodPointerVector<IntegrationEvent>::type events; //!< trick_io(**)
+
+   /**
+    * Dynamic time at the start of the most recent integration step.
+    */
+   double dense_output_start; //!< trick_units(s)
+
+   /**
+    * Dynamic time at the end of the most recent integration step.
+    */
+   double dense_output_end; //!< trick_units(s)
+
+   /**
+    * True once a step has been recorded since the last reset.
+    */
+   bool dense_output_valid; //!< trick_units(--)
+
 
 private:
 
@@ -0,0 +1,115 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/include/rebasable_integrator.hh
+ * Define the class RebasableIntegrator.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_REBASABLE_INTEGRATOR_HH
+#define JEOD_REBASABLE_INTEGRATOR_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A RebasableIntegrator is a multistep state integrator that can carry its
+ * history across a small discontinuity in the integrated state, such as that
+ * caused by a switch between inertially-aligned integration frames or by an
+ * impulsive maneuver, rather than restarting from scratch.
+ * Rebasing is much cheaper than a reset, which sends the integrator back
+ * through its priming phase. The results differ from those of a reset by
+ * the integrator's truncation error.
+ */
+class RebasableIntegrator {
+
+ JEOD_MAKE_SIM_INTERFACES(RebasableIntegrator)
+
+public:
+
+   // NOTE:
+   // The default constructor, copy constructor, and assignment operator
+   // are not declared. The C++ defaults suffice.
+
+   /**
+    * Destructor.
+    */
+   virtual ~RebasableIntegrator () {}
+
+
+   /**
+    * Request that the integrator re-express its history in terms of the
+    * state and derivatives supplied at the start of the next integration
+    * step rather than continuing to use that history as is.
+    * @return True if the request was accepted; false if the integrator
+    *         cannot currently rebase (e.g., while priming), in which case
+    *         the caller should reset the integrator instead.
+    */
+   virtual bool request_rebase () = 0;
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
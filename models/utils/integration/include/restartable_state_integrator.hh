@@ -64,6 +64,8 @@ Purpose:
 #include "restartable_state_integrator_templates.hh"
 #include "generalized_second_order_ode_technique.hh"
 #include "integration_messages.hh"
+#include "rebasable_integrator.hh"
+#include "snapshot_integrator.hh"
 
 // JEOD includes
 #include "utils/container/include/simple_checkpointable.hh"
@@ -165,6 +167,24 @@ public:
       integrator->reset_integrator();
    }
 
+   /**
+    * Register the integrator's history with a state snapshot, if the
+    * integrator supports it (see SnapshotIntegrator).
+    * @param[in,out] snapshot  The snapshot.
+    * @return True if the history was registered; false if the integrator
+    *         must instead be reset when the snapshot is restored.
+    */
+   bool add_snapshot_regions (StateSnapshot & snapshot)
+   {
+      SnapshotIntegrator * snapshot_integrator =
+         dynamic_cast<SnapshotIntegrator *> (integrator);
+      if (snapshot_integrator == nullptr) {
+         return false;
+      }
+      snapshot_integrator->add_snapshot_regions (snapshot);
+      return true;
+   }
+
    /**
     * Restore the integrator on restart.
     */
@@ -205,6 +225,156 @@ private:
 };
 
 
+/**
+ * A RestartableVectorFirstOrderODEIntegrator integrates a first order ODE,
+ *  dx/dt = v(x,t), where x is a vector whose size is set at run time.
+ */
+class RestartableVectorFirstOrderODEIntegrator : public SimpleCheckpointable {
+   JEOD_MAKE_SIM_INTERFACES(RestartableVectorFirstOrderODEIntegrator)
+
+public:
+
+   /**
+    * Default constructor.
+    */
+   RestartableVectorFirstOrderODEIntegrator ()
+   :
+      SimpleCheckpointable(),
+      integrator(nullptr),
+      integrator_manager(integrator)
+   {
+      JEOD_REGISTER_CLASS (RestartableVectorFirstOrderODEIntegrator);
+   }
+
+   /**
+    * Destructor.
+    */
+   ~RestartableVectorFirstOrderODEIntegrator () override { }
+
+   /**
+    * Create the integrator to be managed.
+    * @param[in] size       Dimensionality of the state vector.
+    * @param[in] generator  Integrator constructor used to create the integrator.
+    * @param[in,out] controls   Integration controls to be passed to the generator.
+    */
+   void create_integrator (
+      unsigned int size,
+      const er7_utils::IntegratorConstructor & generator,
+      er7_utils::IntegrationControls & controls)
+   {
+      integrator_manager.set_size (size);
+      integrator_manager.create_integrator (generator, controls);
+   }
+
+   /**
+    * Destroy the integrator.
+    */
+   void destroy_integrator ()
+   {
+      integrator_manager.destroy_integrator();
+   }
+
+   /**
+    * Indicate whether the integrator has been created.
+    * @return True if the integrator exists.
+    */
+   bool has_integrator () const
+   {
+      return integrator != nullptr;
+   }
+
+   /**
+    * Propagate state to the specified stage of the integration
+    * process for an overall integration time interval of dyn_dt.
+    *
+    * Note that this is a pass-through to the encapsulated integrator object.
+    * See er7_utils::FirstOrderODEIntegrator::integrate for details.
+    *
+    * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
+    * @param[in]     target_stage  The stage of the integration process
+    *                              that the integrator should try to attain.
+    * @param[in]     xdot          Time derivative of x.
+    * @param[in,out] x             Item to be integrated.
+    *
+    * @return The status (time advance, pass/fail status) of the integration.
+    */
+   er7_utils::IntegratorResult integrate (
+      double dyn_dt,
+      unsigned int target_stage,
+      double * ER7_UTILS_RESTRICT xdot,
+      double * ER7_UTILS_RESTRICT x)
+   ER7_UTILS_ALWAYS_INLINE
+   {
+      return integrator->integrate (dyn_dt, target_stage, xdot, x);
+   }
+
+   /**
+    * Tell the integrator to reset itself.
+    * See RestartableScalarFirstOrderODEIntegrator::reset_integrator.
+    */
+   void reset_integrator ()
+   {
+      integrator->reset_integrator();
+   }
+
+   /**
+    * Register the integrator's history with a state snapshot, if the
+    * integrator supports it (see SnapshotIntegrator).
+    * @param[in,out] snapshot  The snapshot.
+    * @return True if the history was registered; false if the integrator
+    *         must instead be reset when the snapshot is restored.
+    */
+   bool add_snapshot_regions (StateSnapshot & snapshot)
+   {
+      SnapshotIntegrator * snapshot_integrator =
+         dynamic_cast<SnapshotIntegrator *> (integrator);
+      if (snapshot_integrator == nullptr) {
+         return false;
+      }
+      snapshot_integrator->add_snapshot_regions (snapshot);
+      return true;
+   }
+
+   /**
+    * Restore the integrator on restart.
+    */
+   void simple_restore () override
+   {
+      integrator_manager.set_integrator_reference (integrator);
+      integrator_manager.simple_restore ();
+   }
+
+
+private:
+
+   /**
+    * Pointer to the object that performs integration. The object is created
+    * managed by the integrator manager.
+    */
+   er7_utils::FirstOrderODEIntegrator * integrator; //!< trick_units(--)
+
+   /**
+    * Object that creates and manages the integrator object.
+    */
+   RestartableSizedFirstOrderODEIntegrator integrator_manager; //!< trick_io(**)
+
+
+   // Unimplemented member functions
+
+   /**
+    * Not implemented.
+    */
+   RestartableVectorFirstOrderODEIntegrator (
+      const RestartableVectorFirstOrderODEIntegrator &);
+
+   /**
+    * Not implemented.
+    */
+   RestartableVectorFirstOrderODEIntegrator & operator= (
+      const RestartableVectorFirstOrderODEIntegrator &);
+};
+
+
 /**
  * A RestartableT3SecondOrderODEIntegrator integrates a second order ODE
  * in three space, d^2x/dt^2 = a(x,t), where x is a three-vector.
@@ -279,6 +449,15 @@ public:
                                     velocity, position);
    }
 
+   /**
+    * Get the encapsulated integrator object.
+    * @return Integrator, null if not yet created.
+    */
+   const er7_utils::SecondOrderODEIntegrator * get_integrator () const
+   {
+      return integrator;
+   }
+
    /**
     * Tell the integrator to reset itself. This should be called when the time
     * step or time direction changes or upon a discrete change in state such
@@ -290,6 +469,38 @@ public:
       integrator->reset_integrator();
    }
 
+   /**
+    * Register the integrator's history with a state snapshot, if the
+    * integrator supports it (see SnapshotIntegrator).
+    * @param[in,out] snapshot  The snapshot.
+    * @return True if the history was registered; false if the integrator
+    *         must instead be reset when the snapshot is restored.
+    */
+   bool add_snapshot_regions (StateSnapshot & snapshot)
+   {
+      SnapshotIntegrator * snapshot_integrator =
+         dynamic_cast<SnapshotIntegrator *> (integrator);
+      if (snapshot_integrator == nullptr) {
+         return false;
+      }
+      snapshot_integrator->add_snapshot_regions (snapshot);
+      return true;
+   }
+
+   /**
+    * Ask the integrator to carry its history across a small discontinuity
+    * in state, such as a switch between inertially-aligned integration
+    * frames, rather than restarting from scratch.
+    * @return True if the integrator will rebase its history; false if the
+    *         integrator cannot do so and must instead be reset.
+    */
+   bool rebase_integrator ()
+   {
+      RebasableIntegrator * rebasable =
+         dynamic_cast<RebasableIntegrator *> (integrator);
+      return (rebasable != nullptr) && rebasable->request_rebase();
+   }
+
    /**
     * Restore the integrator on restart.
     */
@@ -446,6 +657,24 @@ public:
       integrator->reset_integrator();
    }
 
+   /**
+    * Register the integrator's history with a state snapshot, if the
+    * integrator supports it (see SnapshotIntegrator).
+    * @param[in,out] snapshot  The snapshot.
+    * @return True if the history was registered; false if the integrator
+    *         must instead be reset when the snapshot is restored.
+    */
+   bool add_snapshot_regions (StateSnapshot & snapshot)
+   {
+      SnapshotIntegrator * snapshot_integrator =
+         dynamic_cast<SnapshotIntegrator *> (integrator);
+      if (snapshot_integrator == nullptr) {
+         return false;
+      }
+      snapshot_integrator->add_snapshot_regions (snapshot);
+      return true;
+   }
+
    /**
     * Restore the integrator on restart.
     */
@@ -393,6 +393,95 @@ private:
 };
 
 
+/**
+ * A RestartableSizedFirstOrderODEIntegrator is-a RestartableStateIntegrator
+ * that manages an er7_utils::FirstOrderODEIntegrator whose state size is
+ * set at run time rather than at compile time.
+ */
+class RestartableSizedFirstOrderODEIntegrator :
+   public RestartableStateIntegrator<er7_utils::FirstOrderODEIntegrator> {
+
+public:
+
+   /**
+    * Default constructor.
+    */
+   RestartableSizedFirstOrderODEIntegrator ()
+   :
+      RestartableStateIntegrator<er7_utils::FirstOrderODEIntegrator>(),
+      size(0)
+   { }
+
+   /**
+    * Non-default constructor.
+    * @param[in,out] integ_ref  Reference to the pointer to the integrator that
+    *                           is to be managed.
+    */
+   explicit RestartableSizedFirstOrderODEIntegrator (
+      er7_utils::FirstOrderODEIntegrator *& integ_ref)
+   :
+      RestartableStateIntegrator<er7_utils::FirstOrderODEIntegrator>(integ_ref),
+      size(0)
+   { }
+
+   /**
+    * Destructor.
+    */
+   ~RestartableSizedFirstOrderODEIntegrator () override
+   { }
+
+   /**
+    * Set the size of the state vector. This must be done before the
+    * integrator is created.
+    * @param[in] state_size  Dimensionality of the state vector.
+    */
+   void set_size (unsigned int state_size)
+   {
+      size = state_size;
+   }
+
+
+private:
+
+   // NVI methods
+
+   /**
+    * Create the integrator to be managed.
+    * @param[in] generator  Integrator constructor used to create the integrator.
+    * @param[in,out] controls   Integration controls to be passed to the generator.
+    */
+   er7_utils::FirstOrderODEIntegrator * create_integrator_internal (
+      const er7_utils::IntegratorConstructor & generator,
+      er7_utils::IntegrationControls & controls) override
+   {
+      return generator.create_first_order_ode_integrator (size, controls);
+   }
+
+
+   // Member data
+
+   /**
+    * Dimensionality of the state vector.
+    */
+   unsigned int size; //!< trick_units(--)
+
+
+   // Unimplemented member functions
+
+   /**
+    * Not implemented.
+    */
+   RestartableSizedFirstOrderODEIntegrator (
+      const RestartableSizedFirstOrderODEIntegrator &);
+
+   /**
+    * Not implemented.
+    */
+   RestartableSizedFirstOrderODEIntegrator & operator= (
+      const RestartableSizedFirstOrderODEIntegrator &);
+};
+
+
 /**
  * A RestartableSecondOrderODEIntegrator is-a
  * RestartableStateIntegrator that manages the integrator for a second
@@ -0,0 +1,232 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/include/second_order_dense_output.hh
+ * Define the class SecondOrderDenseOutput, which records a second order state
+ * at the start and end of an integration step and interpolates that state
+ * within the step.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/second_order_dense_output.cc))
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_SECOND_ORDER_DENSE_OUTPUT_HH
+#define JEOD_SECOND_ORDER_DENSE_OUTPUT_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DenseOutputInterpolator;
+
+
+/**
+ * A SecondOrderDenseOutput records the generalized position, velocity, and
+ * acceleration of a second order state at the start of an integration step
+ * and the position and velocity at the end of the step. The state can then
+ * be evaluated anywhere within the step without further derivative
+ * evaluations.
+ *
+ * The state integrator's natural interpolant is used when the integrator
+ * provides one (see DenseOutputInterpolator). Otherwise the state is
+ * interpolated with the quartic Hermite polynomial that matches the five
+ * recorded values, which is the appropriate continuous extension for
+ * single step (Runge-Kutta family) techniques.
+ */
+class SecondOrderDenseOutput {
+
+ JEOD_MAKE_SIM_INTERFACES(SecondOrderDenseOutput)
+
+public:
+
+   // Constructor and destructor.
+   SecondOrderDenseOutput ();
+   ~SecondOrderDenseOutput ();
+
+   // Size the recorded state.
+   void configure (unsigned int size_in);
+
+   // Discard the recorded data.
+   void reset (void);
+
+   // Record the state at the start of a step.
+   void begin_step (
+      double time,
+      double const * accel,
+      double const * velocity,
+      double const * position);
+
+   // Record the state at the end of the step begun by begin_step.
+   void end_step (
+      double time,
+      double const * velocity,
+      double const * position);
+
+   // Interpolate the state within the recorded step.
+   bool interpolate (
+      double time,
+      const DenseOutputInterpolator * interpolator,
+      double * velocity,
+      double * position) const;
+
+   /**
+    * Is a complete step available for interpolation?
+    * @return True if both ends of a step have been recorded.
+    */
+   bool is_valid () const
+   {
+      return interval_valid;
+   }
+
+   /**
+    * Get the time at the start of the recorded step.
+    * @return Dynamic time, in seconds.
+    */
+   double get_start_time () const
+   {
+      return start_time;
+   }
+
+   /**
+    * Get the time at the end of the recorded step.
+    * @return Dynamic time, in seconds.
+    */
+   double get_end_time () const
+   {
+      return end_time;
+   }
+
+
+private:
+
+   // Release the recorded state arrays.
+   void release (void);
+
+
+   /**
+    * Number of elements in each of the recorded vectors.
+    */
+   unsigned int size; //!< trick_units(--)
+
+   /**
+    * True when begin_step has been called for the step in progress.
+    */
+   bool start_valid; //!< trick_units(--)
+
+   /**
+    * True when both ends of a step have been recorded.
+    */
+   bool interval_valid; //!< trick_units(--)
+
+   /**
+    * Dynamic time at the start of the recorded step.
+    */
+   double start_time; //!< trick_units(s)
+
+   /**
+    * Dynamic time at the end of the recorded step.
+    */
+   double end_time; //!< trick_units(s)
+
+   /**
+    * Generalized acceleration at the start of the step.
+    */
+   double * start_accel; //!< trick_io(**)
+
+   /**
+    * Generalized velocity at the start of the step.
+    */
+   double * start_velocity; //!< trick_io(**)
+
+   /**
+    * Generalized position at the start of the step.
+    */
+   double * start_position; //!< trick_io(**)
+
+   /**
+    * Generalized velocity at the end of the step.
+    */
+   double * end_velocity; //!< trick_io(**)
+
+   /**
+    * Generalized position at the end of the step.
+    */
+   double * end_position; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   SecondOrderDenseOutput (const SecondOrderDenseOutput &);
+
+   /**
+    * Not implemented.
+    */
+   SecondOrderDenseOutput & operator= (const SecondOrderDenseOutput &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,211 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/include/timestamp_cache.hh
+ * Define the class TimestampCache.
+ */
+
+/******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/timestamp_cache.cc))
+
+
+
+******************************************************************************/
+
+#ifndef JEOD_TIMESTAMP_CACHE_HH
+#define JEOD_TIMESTAMP_CACHE_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "time_change_subscriber.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class JeodIntegrationTime;
+
+
+/**
+ * A TimestampCache records the time at which some model last computed a
+ * set of outputs that depend only on time. Multi-stage integrators evaluate
+ * derivatives repeatedly at the same time (e.g., the middle stages of RK4,
+ * corrector iterations, reevaluation after a reset); a model that guards its
+ * computations with needs_update skips those repeated evaluations.
+ *
+ * Times are compared exactly; the cache is meant to be keyed by the
+ * dynamic time used to timestamp objects, which is bit-for-bit identical
+ * across evaluations at the same integration stage time.
+ *
+ * A cache subscribed to a JeodIntegrationTime is invalidated whenever the
+ * nature of time changes.
+ */
+class TimestampCache : public TimeChangeSubscriber {
+
+ JEOD_MAKE_SIM_INTERFACES(TimestampCache)
+
+public:
+
+   // Member data
+
+   /**
+    * When false, needs_update always indicates that an update is needed.
+    */
+   bool enabled; //!< trick_units(--)
+
+   /**
+    * Number of needs_update calls that found the cache current.
+    */
+   unsigned int hit_count; //!< trick_io(*o) trick_units(count)
+
+   /**
+    * Number of needs_update calls that found the cache stale.
+    */
+   unsigned int miss_count; //!< trick_io(*o) trick_units(count)
+
+
+   // Member functions
+
+   // Note: The copy constructor and assignment operator for this class
+   // are private/unimplemented.
+
+   // Constructor
+   TimestampCache ();
+
+   // Destructor
+   ~TimestampCache () override;
+
+   // Invalidate the cache on changes in the nature of a time.
+   void subscribe (JeodIntegrationTime & time_source);
+
+   // Stop responding to changes in the nature of time.
+   void unsubscribe ();
+
+   // Check whether the cached outputs must be recomputed, stamping the
+   // cache with the time if so.
+   bool needs_update (double time);
+
+   // Check whether the cached outputs are those computed at the time.
+   bool is_current (double time) const;
+
+   // Mark the cached outputs as computed at the time.
+   void stamp (double time);
+
+   // Mark the cached outputs as stale.
+   void invalidate ();
+
+   // Invalidate the cache.
+   void respond_to_time_change () override;
+
+   /**
+    * Get the time with which the cache was last stamped.
+    * @return Cache time\n Units: s
+    */
+   double get_timestamp () const
+   {
+      return timestamp;
+   }
+
+   /**
+    * Indicate whether the cache holds outputs for some time.
+    * @return True if stamped and not since invalidated
+    */
+   bool is_valid () const
+   {
+      return valid;
+   }
+
+
+private:
+
+   // Member data
+
+   /**
+    * The time with which the cache was last stamped.
+    */
+   double timestamp; //!< trick_units(s)
+
+   /**
+    * Indicates that timestamp identifies the cached outputs.
+    */
+   bool valid; //!< trick_units(--)
+
+   /**
+    * The time source to which this cache is subscribed, if any.
+    */
+   JeodIntegrationTime * time_source; //!< trick_io(**)
+
+
+   // Deleted member functions
+
+   /**
+    * Not implemented.
+    */
+   TimestampCache (const TimestampCache &);
+
+   /**
+    * Not implemented.
+    */
+   TimestampCache & operator= (const TimestampCache &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -57,7 +57,8 @@ Reference:
   (((TBS)))
 
 Library dependencies:
-  ((../src/lsode_control_data_interface.cc))
+  ((../src/lsode_control_data_interface.cc)
+   (../src/lsode_workspace_pool.cc))
 
  
 
@@ -67,6 +68,7 @@ Library dependencies:
 #define JEOD_LSODE_CONTROL_DATA_INTERFACE_HH
 
 // System includes
+#include<memory>
 #include<vector>
 
 // JEOD includes
@@ -77,6 +79,10 @@ Library dependencies:
 
 namespace jeod
 {
+class LsodeJacobianProvider;
+class LsodeWorkspace;
+class LsodeWorkspacePool;
+
 /**
  * Specifies controls for an LSODE integrator.
  */
@@ -110,10 +116,8 @@ public:
                                    //   internally generated numerical Jacobian
      NewtonIterUserBandJac    = 4, ///< Modified Newton iteration with
                                    //   user-supplied banded Jacobian
-                                   //   NOT SUPPORTED
      NewtonIterInternalBandJac= 5  ///< Modified Newton iteration with internally
                                    //   generated banded Jacobian.
-                                   //   NOT SUPPORTED.
    };
 
    /**
@@ -181,6 +185,17 @@ public:
     */
    double * rel_tolerance_error_control;//!< trick_units(--)
 
+   /**
+    * The workspace holding the error tolerance arrays.
+    */
+   LsodeWorkspace * tolerance_workspace; //!< trick_units(--)
+
+   /**
+    * Pool of working storage. Copies of this object share the pool, so all
+    * of the integrators made from one interface draw on the same storage.
+    */
+   std::shared_ptr<LsodeWorkspacePool> workspace_pool; //!< trick_io(**)
+
    /**
     * Was N, in DLS001 common block.
     * Number of ODEs to be solved at next step.
@@ -241,6 +256,30 @@ public:
     * Maximum number of steps for which the same Jacobian can be used.
     */
    unsigned int max_num_steps_jacobian; //!< trick_units(--)
+   /**
+    * When set, a change in (step_size * method_coeff_first) alone does not
+    * cause the Jacobian to be re-evaluated.  The iteration matrix is instead
+    * rebuilt from the most recently evaluated Jacobian, provided that
+    * Jacobian is less than max_num_steps_jacobian steps old and the
+    * corrector did not just fail to converge with it.
+    * Applies to corrector methods 1, 2, 4, and 5.  Default false.
+    */
+   bool reuse_jacobian; //!< trick_units(--)
+   /**
+    * Was ML, in IWORK[1].
+    * Lower half-bandwidth of the Jacobian, corrector methods 4 and 5 only.
+    */
+   unsigned int jacobian_lower_bandwidth; //!< trick_units(--)
+   /**
+    * Was MU, in IWORK[2].
+    * Upper half-bandwidth of the Jacobian, corrector methods 4 and 5 only.
+    */
+   unsigned int jacobian_upper_bandwidth; //!< trick_units(--)
+   /**
+    * Was JAC.  Source of the analytic Jacobian for corrector methods 1 and 4.
+    * Not owned by the control data.
+    */
+   LsodeJacobianProvider * jacobian_provider; //!< trick_io(**)
    /**
     * Was MXNCF, in DLS001 common block.
     * Maximum number of convergence failures on one step.
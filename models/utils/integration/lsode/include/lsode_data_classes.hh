@@ -60,7 +60,8 @@ Assumptions and limitations:
   (())
 
 Library dependencies:
-  ((../src/lsode_data_classes.cc))
+  ((../src/lsode_data_classes.cc)
+   (../src/lsode_workspace_pool.cc))
 
  
 
@@ -70,12 +71,14 @@ Library dependencies:
 #define JEOD_LSODE_DATA_CLASSES_HH
 
 // System includes
+#include <memory>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Integration includes
 #include "lsode_control_data_interface.hh"
+#include "lsode_workspace_pool.hh"
 
 namespace jeod
 {
@@ -103,6 +106,10 @@ public:
    int index_max;
    double r0;
    double yj;
+   /**
+    * Value of hl0 at which saved_jacobian was scaled.
+    */
+   double saved_hl0; //!< trick_units(--)
 
 private:
    LsodeDataJacobianPrep & operator=(const LsodeDataJacobianPrep & src);
@@ -127,7 +134,9 @@ public:
   LsodeDataArrays(void);
 
   void allocate_arrays( unsigned int num_odes,
-                        LsodeControlDataInterface::CorrectorMethod corrector_method);
+                        LsodeControlDataInterface::CorrectorMethod corrector_method,
+                        bool reuse_jacobian,
+                        const std::shared_ptr<LsodeWorkspacePool> & pool_in);
   void destroy_allocated_arrays();
 
    /**
@@ -164,9 +173,16 @@ public:
     * 0:     0
     * 1,2:   n x n
     * 3:     1 x n
-    * 4,5:   (2*ml+mu+1) x n.
+    * 4,5:   n x n (the band is stored within a full matrix).
     */
    double ** lin_alg; //!< trick_units(--)
+   /**
+    * Copy of lin_alg holding -saved_hl0 * J, taken before the identity is
+    * added, so that the iteration matrix can be rebuilt for a new step size
+    * without re-evaluating the Jacobian.  Allocated (n x n) only when
+    * Jacobian reuse is enabled.
+    */
+   double ** saved_jacobian; //!< trick_units(--)
    /**
     * was RWORK[LEWT:LEWT+N-1].  LEWT = LWM + LENWM
     * error_weight[i] = rwork[lewt+i].
@@ -188,16 +204,42 @@ public:
     * Number of record, this is the value used for data allocation.
     */
    unsigned int lin_alg_index1; //!< trick_units(--)
+   /**
+    * Number of rows of saved_jacobian, zero if not allocated.
+    */
+   unsigned int saved_jacobian_index1; //!< trick_units(--)
    /**
     * Number of record, this is the value used for data allocation.
     */
    unsigned int num_odes;  //!< trick_units(--)
 
+   /**
+    * Distance between consecutive rows of history, a whole number of
+    * cache lines.
+    */
+   unsigned int history_stride; //!< trick_units(--)
+
+   /**
+    * Distance between consecutive rows of lin_alg and saved_jacobian,
+    * a whole number of cache lines.
+    */
+   unsigned int lin_alg_stride; //!< trick_units(--)
+
    /**
     * Indicator of whether the arrays have been allocated.
     */
    bool allocated; //!< trick_units(--)
 
+   /**
+    * The workspace from which the arrays are carved.
+    */
+   LsodeWorkspace * workspace; //!< trick_units(--)
+
+   /**
+    * The pool that provided the workspace.
+    */
+   std::shared_ptr<LsodeWorkspacePool> pool; //!< trick_io(**)
+
 private:
    LsodeDataArrays & operator=(const LsodeDataArrays & src);
    LsodeDataArrays(            const LsodeDataArrays & src);
@@ -90,6 +90,8 @@ Library dependencies:
 
 namespace jeod
 {
+class LsodeJacobianProvider;
+
 /**
  * Jeod-compatible version of the Livermore ODE solver, LSODE.
  */
@@ -197,6 +199,22 @@ public:
    EntryPoint get_re_entry_point() {return re_entry_point;}
 
 
+   /**
+    * Set the source of the analytic Jacobian used by corrector methods
+    * NewtonIterUserJac and NewtonIterUserBandJac.
+    * @param[in] provider  Jacobian provider; not owned by the integrator.
+    */
+   void set_jacobian_provider (LsodeJacobianProvider * provider)
+   {control_data.jacobian_provider = provider;}
+
+
+   /**
+    * Get the number of times the iteration matrix was rebuilt from a
+    * saved Jacobian rather than from a new Jacobian evaluation.
+    */
+   unsigned int get_num_jacobian_reuses () const {return num_jacobian_reuses;}
+
+
    // Manager (top-level) methods.  Most of these are from the DLSODE method
    // See lsode_first_order_ode_integrator__manager.cc
 
@@ -220,6 +238,7 @@ public:
 
 protected:
    void process_entry_point_cycle_start();
+   void process_entry_point_jacobian_prep();
    void manager_initialize_calculation_part1();       // was DLSODE
    void manager_initialize_calculation_part2();       // was DLSODE
    int  manager_check_stop_conditions();              // was DLSODE
@@ -260,6 +279,11 @@ protected:
    void jacobian_prep_init();                         // was DPREPJ
    bool jacobian_prep_loop();                         // was DPREPJ
    bool jacobian_prep_wrap_up();                      // was DPREPJ
+   bool jacobian_prep_finish();                       // was DSTODE
+   bool jacobian_prep_needs_derivatives() const;
+   bool jacobian_reuse_available() const;
+   bool jacobian_prep_reuse();
+   void jacobian_prep_band_perturb(unsigned int group);
    void linear_chord_iteration();                     // was DSOLSY, also SLVS
    void load_ew_values();                             // was DEWSET
 
@@ -410,18 +434,6 @@ public:
     */
    double max_rel_change_without_jacobian; //!< trick_units(--)
 
-// Used for corrector_method = 4 or 5, which are not supported.
-//   int jacobian_lower_half_bandwidth; /* trick_units(--) @n
-//       was ML/
-//       */
-//   int jacobian_upper_half_bandwidth; /* trick_units(--) @n
-//       was MU.
-//       */
-
-
-
-
-
 
 
 // Miscellaneous
@@ -646,6 +658,20 @@ protected:
     * Step number at last Jacobian update.
     */
    unsigned int step_at_last_jacobian_update; //!< trick_units(--)
+   /**
+    * Step number at the last evaluation of the Jacobian itself.  Differs
+    * from step_at_last_jacobian_update only when the iteration matrix is
+    * rebuilt from a saved Jacobian.
+    */
+   unsigned int step_at_last_jacobian_eval; //!< trick_units(--)
+   /**
+    * Number of iteration matrix rebuilds from a saved Jacobian.
+    */
+   unsigned int num_jacobian_reuses; //!< trick_units(--)
+   /**
+    * Indicates that arrays.saved_jacobian holds a usable Jacobian.
+    */
+   bool saved_jacobian_valid; //!< trick_units(--)
    /**
     * Was ICF, in DLS001 common block.
     * 0: Solution converged
@@ -0,0 +1,125 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Lsode
+ * @{
+ *
+ * @file models/utils/integration/lsode/include/lsode_jacobian_provider.hh
+ * Define the class LsodeJacobianProvider, the interface by which a model
+ * supplies an analytic Jacobian to the LSODE integrator.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((dlsode.f)))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_LSODE_JACOBIAN_PROVIDER_HH
+#define JEOD_LSODE_JACOBIAN_PROVIDER_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+namespace jeod
+{
+/**
+ * An LsodeJacobianProvider supplies the Jacobian of the state derivatives
+ * with respect to the state, replacing the user routine JAC of the original
+ * Fortran.  It is used with the corrector methods NewtonIterUserJac and
+ * NewtonIterUserBandJac.  Typically the integrable object whose state is
+ * being integrated implements this interface and is attached to the LSODE
+ * control data before the integrators are created.
+ */
+class LsodeJacobianProvider
+{
+JEOD_MAKE_SIM_INTERFACES(LsodeJacobianProvider)
+
+public:
+
+   // NOTE:
+   // The default constructor, copy constructor, and assignment operator
+   // are not declared. The C++ defaults suffice.
+
+   /**
+    * Destructor.
+    */
+   virtual ~LsodeJacobianProvider () {}
+
+   /**
+    * Compute the Jacobian of the state derivatives at the supplied state.
+    * The matrix is stored by column: jacobian[j][i] is the partial derivative
+    * of derivative i with respect to state element j.  On entry all elements
+    * are zero, so for a banded problem only the elements within the band
+    * need to be set.
+    * @param[in]  num_odes  Size of the state.
+    * @param[in]  state     State at which the Jacobian is to be evaluated.
+    * @param[in]  deriv     State derivatives at that state.
+    * @param[out] jacobian  The num_odes x num_odes Jacobian, column-major.
+    */
+   virtual void compute_lsode_jacobian (
+      unsigned int num_odes,
+      double const * state,
+      double const * deriv,
+      double ** jacobian) = 0;
+};
+
+} // namespace jeod
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
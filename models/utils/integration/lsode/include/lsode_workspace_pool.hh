@@ -0,0 +1,222 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Lsode
+ * @{
+ *
+ * @file models/utils/integration/lsode/include/lsode_workspace_pool.hh
+ * Define the classes that provide recyclable working storage to LSODE
+ * integrators.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  (())
+
+Library dependencies:
+  ((../src/lsode_workspace_pool.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_LSODE_WORKSPACE_POOL_HH
+#define JEOD_LSODE_WORKSPACE_POOL_HH
+
+// System includes
+#include <mutex>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+namespace jeod
+{
+
+/**
+ * A block of LSODE working storage: a real array whose first element is
+ * aligned to a cache line, a table of row pointers, and an integer array.
+ * Workspaces are owned by an LsodeWorkspacePool; a user carves its arrays
+ * out of the storage it acquires from the pool.
+ */
+class LsodeWorkspace
+{
+JEOD_MAKE_SIM_INTERFACES(LsodeWorkspace)
+
+friend class LsodeWorkspacePool;
+
+public:
+   LsodeWorkspace(void);
+   ~LsodeWorkspace(void);
+
+   /**
+    * Real storage, aligned to a cache line.
+    */
+   double * reals; //!< trick_units(--)
+
+   /**
+    * Row pointer storage.
+    */
+   double ** rows; //!< trick_units(--)
+
+   /**
+    * Integer storage.
+    */
+   int * ints; //!< trick_units(--)
+
+   /**
+    * Capacity of the real storage.
+    */
+   unsigned int num_reals; //!< trick_units(--)
+
+   /**
+    * Capacity of the row pointer storage.
+    */
+   unsigned int num_rows; //!< trick_units(--)
+
+   /**
+    * Capacity of the integer storage.
+    */
+   unsigned int num_ints; //!< trick_units(--)
+
+   /**
+    * Set while the workspace is acquired.
+    */
+   bool in_use; //!< trick_units(--)
+
+private:
+   void reserve (unsigned int num_reals_in,
+                 unsigned int num_rows_in,
+                 unsigned int num_ints_in);
+   void free_storage (void);
+
+   /**
+    * The real storage as allocated; reals lies within it.
+    */
+   double * real_storage; //!< trick_units(--)
+
+   LsodeWorkspace & operator=(const LsodeWorkspace & src);
+   LsodeWorkspace(const LsodeWorkspace & src);
+};
+
+
+/**
+ * A pool of LSODE workspaces shared by the LSODE integrators made by one
+ * LsodeIntegratorConstructor, and hence by the integrators of the
+ * integration group that uses that constructor. A workspace released by an
+ * integrator that is destroyed (e.g., when a body leaves the group) is
+ * handed to the next integrator that needs no more storage than it holds,
+ * so integrators that come and go do not allocate once the pool has grown
+ * to its working size. Workspaces are freed only when the pool is
+ * destroyed.
+ */
+class LsodeWorkspacePool
+{
+JEOD_MAKE_SIM_INTERFACES(LsodeWorkspacePool)
+
+public:
+
+   /**
+    * Number of doubles in a cache line. Reals are aligned to and rows of
+    * reals are padded to a multiple of this size.
+    */
+   static const unsigned int alignment = 8;
+
+   /**
+    * Round a number of reals up to a whole number of cache lines.
+    * @return Padded size
+    * \param[in] size Number of reals
+    */
+   static unsigned int padded_size (unsigned int size)
+   {
+      return (size + alignment - 1) / alignment * alignment;
+   }
+
+   LsodeWorkspacePool(void);
+   ~LsodeWorkspacePool(void);
+
+   LsodeWorkspace * acquire (unsigned int num_reals,
+                             unsigned int num_rows,
+                             unsigned int num_ints);
+
+   void release (LsodeWorkspace * workspace);
+
+   unsigned int get_num_workspaces (void) const;
+
+   unsigned int get_num_in_use (void) const;
+
+private:
+
+   /**
+    * The workspaces owned by the pool.
+    */
+   std::vector<LsodeWorkspace *> workspaces; //!< trick_io(**)
+
+   /**
+    * Serializes acquire and release.
+    */
+   mutable std::mutex mutex; //!< trick_io(**)
+
+   LsodeWorkspacePool & operator=(const LsodeWorkspacePool & src);
+   LsodeWorkspacePool(const LsodeWorkspacePool & src);
+};
+
+} // namespace jeod
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -24,23 +24,26 @@ Assumptions and limitations:
   (TBS)
 
 Library dependencies:
-  ((lsode_control_data_interface.cc))
+  ((lsode_control_data_interface.cc)
+   (lsode_workspace_pool.cc))
 
  
 *******************************************************************************/
 
 
 // System includes
+#include <algorithm>
+#include <memory>
 
 // Interface includes
 
 // Integration includes
 #include "er7_utils/interface/include/message_handler.hh"
 #include "er7_utils/integration/core/include/integration_messages.hh"
-#include "er7_utils/interface/include/alloc.hh"
 
 // Model includes
 #include "../include/lsode_control_data_interface.hh"
+#include "../include/lsode_workspace_pool.hh"
 
 using namespace jeod;
 
@@ -55,6 +58,8 @@ LsodeControlDataInterface::LsodeControlDataInterface()
    num_odes_at_alloc(0),
    abs_tolerance_error_control(nullptr),
    rel_tolerance_error_control(nullptr),
+   tolerance_workspace(nullptr),
+   workspace_pool(std::make_shared<LsodeWorkspacePool> ()),
    num_odes(3),
    integration_method(ImplicitAdamsNonStiff),
    corrector_method(FunctionalIteration),
@@ -65,6 +70,10 @@ LsodeControlDataInterface::LsodeControlDataInterface()
    max_num_small_step_warnings(10),
    max_correction_iters(3),
    max_num_steps_jacobian(20),
+   reuse_jacobian(false),
+   jacobian_lower_bandwidth(0),
+   jacobian_upper_bandwidth(0),
+   jacobian_provider(nullptr),
    max_num_conv_failure(10),
    max_num_steps(500)
 {
@@ -88,6 +97,10 @@ LsodeControlDataInterface::LsodeControlDataInterface(const LsodeControlDataInter
    // place, they will point to the same location as the data in the source.
    abs_tolerance_error_control(src.abs_tolerance_error_control),
    rel_tolerance_error_control(src.rel_tolerance_error_control),
+   // The copy does not own the source's tolerance storage, but does share
+   // its workspace pool.
+   tolerance_workspace(nullptr),
+   workspace_pool(src.workspace_pool),
 
    num_odes(src.num_odes),
    integration_method(src.integration_method),
@@ -99,6 +112,10 @@ LsodeControlDataInterface::LsodeControlDataInterface(const LsodeControlDataInter
    max_num_small_step_warnings(src.max_num_small_step_warnings),
    max_correction_iters(src.max_correction_iters),
    max_num_steps_jacobian(src.max_num_steps_jacobian),
+   reuse_jacobian(src.reuse_jacobian),
+   jacobian_lower_bandwidth(src.jacobian_lower_bandwidth),
+   jacobian_upper_bandwidth(src.jacobian_upper_bandwidth),
+   jacobian_provider(src.jacobian_provider),
    max_num_conv_failure(src.max_num_conv_failure),
    max_num_steps(src.max_num_steps)
 {
@@ -142,29 +159,26 @@ LsodeControlDataInterface::check_interface_data()
       er7_utils::MessageHandler::fail (__FILE__, __LINE__,
          er7_utils::IntegrationMessages::invalid_request,
          "Illegal value for corrector_method (%u).\n"
-         "corrector_method must be between 1 and 4 (inclusive).\n",
+         "corrector_method must be between 0 and 5 (inclusive).\n",
          corrector_method);
    }
-   //if (jacobian_lower_half_bandwidth < 0 ||
-   //    jacobian_lower_half_bandwidth >= num_odes) {
-   //   er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-   //      er7_utils::IntegrationMessages::invalid_request,
-   //      "jacobian_lower_half_bandwidth (%u) illegal value.\n"
-   //      "Must be >=0 and < %u (the number of equations to solve)",
-   //      jacobian_lower_half_bandwidth,num_equations_to_solve);
-   //   calculation_phase = -3;
-   //   return;
-   //}
-   //if (jacobian_upper_half_bandwidth < 0 ||
-   //    jacobian_upper_half_bandwidth >= num_odes) {
-   //   er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-   //      er7_utils::IntegrationMessages::invalid_request,
-   //      "jacobian_upper_half_bandwidth (%u) illegal value.\n"
-   //      "Must be >=0 and < %u (the number of equations to solve)",
-   //      jacobian_upper_half_bandwidth,num_equations_to_solve);
-   //   calculation_phase = -3;
-   //   return;
-   //}
+   if (corrector_method == NewtonIterUserBandJac ||
+       corrector_method == NewtonIterInternalBandJac) {
+      if (jacobian_lower_bandwidth >= num_odes) {
+         er7_utils::MessageHandler::fail (__FILE__, __LINE__,
+            er7_utils::IntegrationMessages::invalid_request,
+            "jacobian_lower_bandwidth (%u) illegal value.\n"
+            "Must be < %u (the number of equations to solve)",
+            jacobian_lower_bandwidth, num_odes);
+      }
+      if (jacobian_upper_bandwidth >= num_odes) {
+         er7_utils::MessageHandler::fail (__FILE__, __LINE__,
+            er7_utils::IntegrationMessages::invalid_request,
+            "jacobian_upper_bandwidth (%u) illegal value.\n"
+            "Must be < %u (the number of equations to solve)",
+            jacobian_upper_bandwidth, num_odes);
+      }
+   }
 
 // DGH: Commented out. These are unsigned ints. They cannot be negative.
 #if 0
@@ -260,30 +274,12 @@ LsodeControlDataInterface::check_interface_data()
            ii, abs_tolerance_error_control_vec[ii]);
       }
    }
-// Perform additional checks against values that are not supported
-// in this implementation:
-   if (corrector_method == 1) {
-      er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-         er7_utils::IntegrationMessages::invalid_request,
-         "Corrector_method =1 (i.e. newtonian iteration with user-supplied "
-         "jacobian)\nnot supported.  There is no means to specify a "
-         "Jacobian-generation function.\n");
-   }
-
-   if (corrector_method > 3) { // 4 or 5.  Uses banded Jacobian.
-                               //          Check bandwidth.
-      er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-         er7_utils::IntegrationMessages::invalid_request,
-         "Corrector_methods 4 and 5 (using banded Jacobians) not currently"
-         "supported.\n");
-
-
-   }
    return;
 }
 
 /**
- * allocates space for vector-populated data to allow for restart
+ * allocates space for vector-populated data to allow for restart.
+ * The space is taken from the workspace pool.
  */
 void LsodeControlDataInterface::allocate_arrays()
 {
@@ -310,10 +306,16 @@ void LsodeControlDataInterface::allocate_arrays()
          "error-control array.\n",
          num_odes,abs_vec_size,num_odes);
    }
-   abs_tolerance_error_control =
-                            er7_utils::alloc::allocate_array<double> (num_odes);
-   rel_tolerance_error_control =
-                            er7_utils::alloc::allocate_array<double> (num_odes);
+   if (! workspace_pool) {
+      workspace_pool = std::make_shared<LsodeWorkspacePool> ();
+   }
+   destroy_allocated_arrays();
+   unsigned int vector_stride = LsodeWorkspacePool::padded_size (num_odes);
+   tolerance_workspace = workspace_pool->acquire (2 * vector_stride, 0, 0);
+   abs_tolerance_error_control = tolerance_workspace->reals;
+   rel_tolerance_error_control = tolerance_workspace->reals + vector_stride;
+   std::fill (abs_tolerance_error_control,
+              abs_tolerance_error_control + 2 * vector_stride, 0.0);
 
    for (unsigned int ii = 0; ii < abs_vec_size; ii++) {
       abs_tolerance_error_control[ii] = abs_tolerance_error_control_vec[ii];
@@ -328,14 +330,16 @@ void LsodeControlDataInterface::allocate_arrays()
 }
 
 /**
- * De-allocates allocated array.
+ * Returns the allocated arrays' storage to the workspace pool.
  */
 void
 LsodeControlDataInterface::destroy_allocated_arrays()
 {
-   if (error_control_vector_copied_over) {
-      er7_utils::alloc::deallocate_array<double>(abs_tolerance_error_control);
-      er7_utils::alloc::deallocate_array<double>(rel_tolerance_error_control);
+   if (tolerance_workspace != nullptr) {
+      workspace_pool->release (tolerance_workspace);
+      tolerance_workspace = nullptr;
+      abs_tolerance_error_control = nullptr;
+      rel_tolerance_error_control = nullptr;
    }
    error_control_vector_copied_over = false;
    return;
@@ -24,7 +24,8 @@ Assumptions and limitations:
   (TBS)
 
 Library dependencies:
-  ((lsode_data_classes.cc))
+  ((lsode_data_classes.cc)
+   (lsode_workspace_pool.cc))
 
  
 
@@ -32,6 +33,8 @@ Library dependencies:
 
 
 // System includes
+#include <algorithm>
+#include <memory>
 
 // Integration includes
 #include "er7_utils/interface/include/message_handler.hh"
@@ -58,7 +61,8 @@ LsodeDataJacobianPrep::LsodeDataJacobianPrep()
    index(0),
    index_max(0),
    r0(0.0),
-   yj(0.0)
+   yj(0.0),
+   saved_hl0(0.0)
 {}
 
 
@@ -90,59 +94,66 @@ LsodeDataArrays::LsodeDataArrays()
    lin_alg_1(0.0),
    lin_alg_2(0.0),
    lin_alg(nullptr),
+   saved_jacobian(nullptr),
    error_weight(nullptr),
    save(nullptr),
    accum_correction(nullptr),
    lin_alg_index1(0),
+   saved_jacobian_index1(0),
    num_odes(3),
-   allocated(false)
+   history_stride(0),
+   lin_alg_stride(0),
+   allocated(false),
+   workspace(nullptr),
+   pool()
 {}
 
 
 /**
- * Allocates memory for the variable size arrays
+ * Carves the variable size arrays out of a workspace acquired from the pool.
+ * The arrays share one block of storage: each row of history, lin_alg, and
+ * saved_jacobian and each of error_weight, save, and accum_correction starts
+ * on a cache line, so that loops over a row or vector run over aligned,
+ * contiguous data. Storage released by a previous allocation, whether by
+ * this object or by another integrator served by the same pool, is reused.
+ * \param[in] num_odes_in Number of ODEs
+ * \param[in] corrector_method Corrector method
+ * \param[in] reuse_jacobian Whether the saved Jacobian is needed
+ * \param[in] pool_in Workspace pool; a private pool is made if null
  */
 void
 LsodeDataArrays::allocate_arrays(
       unsigned int num_odes_in,
-      LsodeControlDataInterface::CorrectorMethod corrector_method)
+      LsodeControlDataInterface::CorrectorMethod corrector_method,
+      bool reuse_jacobian,
+      const std::shared_ptr<LsodeWorkspacePool> & pool_in)
 {
 // This is a code chunk adapted from lines  1321-1325 in original fortran.
 
-   num_odes = num_odes_in;
-
-   // num_odes appears to be at least as large as num_equations, which
-   // may be variable (in original Lsode).
-   // In this version, they are identical.
-   // So allocate pivots and history, which should
-   // be sized by num_equations, by num_odes instead.
-   pivots = er7_utils::alloc::allocate_array<int>(num_odes);
+   destroy_allocated_arrays();
 
-
-   // history data must have size of at least 1 + the integrator order.
-   // The interator order is limited by :
-   //    the specified value of maximum order,
-   //    5 if integrator-method = 2
-   //    12 if integrator-method = 1.
-   //    To avoid checking on the size of this array, going straight
-   //    to 1+12, the largest it could possibly be.
-   history = er7_utils::alloc::allocate_array<double *>(num_odes);
-   for (unsigned int ii = 0; ii < num_odes; ++ii) {
-      history[ii] = er7_utils::alloc::allocate_array<double> (13);
-   }
+   num_odes = num_odes_in;
 
    // lin_alg was of length LWM.
    // Now it has two scalar components (lin_alg_1, lin_alg_2) and
    // a 2-d array.
    unsigned int index1, index2;
+   bool full_matrix = false;
    //if (miter.eq.0) lenwm=0
    if (corrector_method == LsodeControlDataInterface::FunctionalIteration) {
       index1 = index2 = 1;
    }
    // if (miter.eq.1 || 2) lenwm=n*n+2
+   // The banded methods (miter.ge.4) used lenwm=(2*ml+mu+1)*n+2 in compact
+   // band storage.  Here the band is stored within a full n x n matrix so
+   // that the dense factorization can be shared by all Newton methods.
    else if (corrector_method == LsodeControlDataInterface::NewtonIterUserJac ||
-            corrector_method == LsodeControlDataInterface::NewtonIterInternalJac ) {
+            corrector_method == LsodeControlDataInterface::NewtonIterInternalJac ||
+            corrector_method == LsodeControlDataInterface::NewtonIterUserBandJac ||
+            corrector_method ==
+                         LsodeControlDataInterface::NewtonIterInternalBandJac) {
       index1 = index2 = num_odes;
+      full_matrix = true;
    }
    // if (miter.eq.3) lenwm=n+2,
    // so 1xn + the two outstanding elements.
@@ -160,16 +171,6 @@ LsodeDataArrays::allocate_arrays(
       index2 = 0;
 
    }
-//   //if (miter.ge.4) lenwm=(2*ml+mu+1)*n+2
-// MITER = 4 or 5 not supported.
-//   else {
-//      index1 =
-//            2*jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth +1;
-//      if (index1 < 2) {
-//         index1 = 1;
-//      }
-//      index2 = num_odes;
-//   }
 
    // lin_alg[index1][index2]
    // lewt = lwm + lenwm means lin_alg takes up lenwm spaces:
@@ -177,17 +178,76 @@ LsodeDataArrays::allocate_arrays(
    // so the lin_alg array takes up lenwm-2 spaces.
    lin_alg_index1 = index1;
 
-   lin_alg = er7_utils::alloc::allocate_array <double*> (index1);
-   for (unsigned int ii = 0; ii < index1; ++ii) {
-      lin_alg[ii] = er7_utils::alloc::allocate_array <double> (index2);
+   // The saved Jacobian is only needed by the full-matrix Newton methods.
+   saved_jacobian_index1 = (reuse_jacobian && full_matrix) ? num_odes : 0;
+
+   // history data must have size of at least 1 + the integrator order.
+   // The interator order is limited by :
+   //    the specified value of maximum order,
+   //    5 if integrator-method = 2
+   //    12 if integrator-method = 1.
+   //    To avoid checking on the size of this array, going straight
+   //    to 1+12, the largest it could possibly be.
+   history_stride = LsodeWorkspacePool::padded_size (13);
+   lin_alg_stride = LsodeWorkspacePool::padded_size (index2);
+   unsigned int vector_stride = LsodeWorkspacePool::padded_size (num_odes);
+
+   unsigned int num_reals = num_odes * history_stride +
+                            (lin_alg_index1 + saved_jacobian_index1) *
+                            lin_alg_stride +
+                            3 * vector_stride;
+   unsigned int num_rows = num_odes + lin_alg_index1 + saved_jacobian_index1;
+
+   pool = pool_in;
+   if (! pool) {
+      pool = std::make_shared<LsodeWorkspacePool> ();
+   }
+
+   // num_odes appears to be at least as large as num_equations, which
+   // may be variable (in original Lsode).
+   // In this version, they are identical.
+   // So size pivots and history, which should
+   // be sized by num_equations, by num_odes instead.
+   workspace = pool->acquire (num_reals, num_rows, num_odes);
+
+   double * reals = workspace->reals;
+   double ** rows = workspace->rows;
+   std::fill (reals, reals + num_reals, 0.0);
+
+   pivots = workspace->ints;
+   std::fill (pivots, pivots + num_odes, 0);
+
+   history = rows;
+   for (unsigned int ii = 0; ii < num_odes; ++ii) {
+      history[ii] = reals;
+      reals += history_stride;
+   }
+   rows += num_odes;
+
+   lin_alg = rows;
+   for (unsigned int ii = 0; ii < lin_alg_index1; ++ii) {
+      lin_alg[ii] = reals;
+      reals += lin_alg_stride;
+   }
+   rows += lin_alg_index1;
+
+   saved_jacobian = nullptr;
+   if (saved_jacobian_index1 > 0) {
+      saved_jacobian = rows;
+      for (unsigned int ii = 0; ii < saved_jacobian_index1; ++ii) {
+         saved_jacobian[ii] = reals;
+         reals += lin_alg_stride;
+      }
    }
 
    //lsavf=lewt+n means ewt takes up n spaces.
-   error_weight = er7_utils::alloc::allocate_array(num_odes);//new double[num_odes];
+   error_weight = reals;
+   reals += vector_stride;
    //lacor=lsavf+n means savf takes up n spaces.
-   save = er7_utils::alloc::allocate_array(num_odes);//new double[num_odes];
+   save = reals;
+   reals += vector_stride;
    //lenrw=lacor+n-1 means accum_correction takes up n-1 spaces.
-   accum_correction = er7_utils::alloc::allocate_array(num_odes);//nnew double[num_odes];
+   accum_correction = reals;
 
    allocated = true;
 
@@ -195,27 +255,22 @@ LsodeDataArrays::allocate_arrays(
 }
 
 /**
- * Allows for refactoring and reallocation of newly sized arrays.
+ * Returns the arrays' storage to the pool for reuse.
  */
 void
 LsodeDataArrays::destroy_allocated_arrays()
 {
    if (allocated) {
-      er7_utils::alloc::deallocate_array<int>(pivots);
-      er7_utils::alloc::deallocate_array<double>(error_weight);
-      er7_utils::alloc::deallocate_array<double>(save);
-      er7_utils::alloc::deallocate_array<double>(accum_correction);
-
-
-      for (unsigned int ii = 0; ii < num_odes; ++ii) {
-         er7_utils::alloc::deallocate_array <double> (history[ii]);
-      }
-      er7_utils::alloc::deallocate_array <double*> (history);
-      for (unsigned int ii = 0; ii < lin_alg_index1; ++ii) {
-         er7_utils::alloc::deallocate_array <double> (lin_alg[ii]);
-      }
-      er7_utils::alloc::deallocate_array <double*> (lin_alg);
+      pool->release (workspace);
    }
+   workspace = nullptr;
+   pivots = nullptr;
+   history = nullptr;
+   lin_alg = nullptr;
+   saved_jacobian = nullptr;
+   error_weight = nullptr;
+   save = nullptr;
+   accum_correction = nullptr;
    allocated = false;
 
    return;
@@ -111,6 +111,8 @@ LsodeFirstOrderODEIntegrator::integrator_core()
       prev_step_size = step_size;
       prev_integration_method = control_data.integration_method;
       step_at_last_jacobian_update = 0;
+      step_at_last_jacobian_eval = 0;
+      saved_jacobian_valid = false;
       update_jacobian =
                       !control_data.is_corrector_method_functional_iteration();
       data_stode.iret = 3;
@@ -343,25 +345,32 @@ LsodeFirstOrderODEIntegrator::integrator_predict()
    // Flag the Jacobian for needing an update if the following holds true:
    // 1. The corrector method is NOT Functional Iteration AND EITHER
    // 2a. The relative change since the last update exceeds the limit OR
-   // 2b. The number of steps taken since the update exceeds the limit.
+   // 2b. The number of steps taken since the Jacobian was evaluated exceeds
+   //     the limit.
    //  To avoid running through the second two tests every time for
    //  functional iteration, do that test first.
+   //  Without Jacobian reuse every update is an evaluation, so 2b matches
+   //  the original test against NSLP.  With reuse, an update caused by 2a
+   //  alone may be satisfied from the saved Jacobian.
 
    update_jacobian =
      ((!control_data.is_corrector_method_functional_iteration()) &&
       ((std::abs(rel_change_since_jacobian-1.0) >
                     max_rel_change_without_jacobian) ||
        (num_steps_taken >=
-         step_at_last_jacobian_update + control_data.max_num_steps_jacobian)));
+         step_at_last_jacobian_eval + control_data.max_num_steps_jacobian)));
 
    stage_target_time = stage_target_time + step_size;
 
    // Multiply the history array by Pascal's Triangle.
-   for (unsigned int i_iter = method_order_current; i_iter > 0; i_iter--) {
-      for (unsigned int j_hist = i_iter-1; j_hist < method_order_current;
+   // The variables are independent, so each variable's row is updated in
+   // turn; the operations on a row are as in DSTODE.
+   for (unsigned int k_var = 0; k_var < num_equations; k_var++) {
+      double * row = arrays.history[k_var];
+      for (unsigned int i_iter = method_order_current; i_iter > 0; i_iter--) {
+         for (unsigned int j_hist = i_iter-1; j_hist < method_order_current;
                                                                 j_hist++) {
-         for (unsigned int k_var = 0; k_var < num_equations; k_var++) {
-            arrays.history[k_var][j_hist] += arrays.history[k_var][j_hist+1];
+            row[j_hist] += row[j_hist+1];
          }
       }
    }
@@ -631,11 +640,13 @@ LsodeFirstOrderODEIntegrator::integrator_corrector_converged()
    num_steps_taken ++;
    prev_good_step_size = step_size;
    prev_method_order = method_order_current;
-   for (unsigned int jj = 0; jj < num_nordsiek_cols; jj++) { // do 470
-      for (unsigned int ii = 0; ii < control_data.num_odes; ii++) { // do 470
+   // Loop 470, ordered to run along each variable's row of history.
+   for (unsigned int ii = 0; ii < control_data.num_odes; ii++) { // do 470
+      double * ER7_UTILS_RESTRICT row = arrays.history[ii];
+      double correction = arrays.accum_correction[ii];
+      for (unsigned int jj = 0; jj < num_nordsiek_cols; jj++) { // do 470
          // 470
-         arrays.history[ii][jj] += method_coeffs_current[jj] *
-                                        arrays.accum_correction[ii];
+         row[jj] += method_coeffs_current[jj] * correction;
       }
    }
    order_select_para --;
@@ -131,40 +131,7 @@ LsodeFirstOrderODEIntegrator::integrate (
       // derivatives are loaded into places dependent on
       // corrector_method, so load_derivatives is called from
       // jacobian_prep_loop.
-
-      // The re_entry_point is not changed until the looping iteration
-      // is finished and the jacobian_wrap_up finished.  Otherwise, we
-      // will keep coming back to this point.
-
-      if (jacobian_prep_loop()) {
-         if (jacobian_prep_wrap_up()) {
-            // Moving on to line 250 in DSTODE.
-
-            re_entry_point = CycleStartFinish;
-            integrator_reset_iteration_loop_part2();
-            integrator_corrector_iteration();
-            // Following the return from any part of the integrator
-            // (DSTODE), the rest of the manager (DLSODE) must be called
-            // UNLESS the integrator returned prematurely, in need of a
-            // recompute of the derivatives.  If it did, the
-            // re_entry_point will be set accordingly.  If
-            // re_entry_point has not been reset, wrap up the manger
-            // functionality.
-            // Comment applies to all calls to integrator_* from all
-            // re_entry_point cases.
-            if (re_entry_point == CycleStartFinish) {
-               manager_integration_loop_part3();
-            }
-         }
-         else if (step_error == -2) {
-            er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-               er7_utils::IntegrationMessages::internal_error,
-               "Infinite loop encountered in computing the Jacobian.\n"
-               "Repeated attempts keep producing a singular matrix.\n");
-         }
-      }
-      // else, the loop did not converge and need to return to it after
-      // recomputing derivatives.
+      process_entry_point_jacobian_prep();
       break;
 
    case ResetIterLoop:
@@ -188,7 +155,30 @@ LsodeFirstOrderODEIntegrator::integrate (
          // The first part, jacobian_prep_init, gets called here; this
          // method sets the re_entry_point to JacobianPrep, which
          // handles the other two parts.
-         jacobian_prep_init(); // sets re_entry_point to JacobianPrep
+         //
+         // When reuse is enabled and the saved Jacobian is still usable,
+         // only the iteration matrix is rebuilt and no external calls are
+         // needed.
+         if (jacobian_reuse_available()) {
+            if (jacobian_prep_reuse()) {
+               re_entry_point = CycleStartFinish;
+               integrator_reset_iteration_loop_part2();
+               integrator_corrector_iteration();
+               // See comment in process_entry_point_jacobian_prep
+               if (re_entry_point == CycleStartFinish) {
+                  manager_integration_loop_part3();
+               }
+            }
+         }
+         else {
+            jacobian_prep_init(); // sets re_entry_point to JacobianPrep
+
+            // A user-supplied Jacobian is already complete; there is no
+            // need to go out for derivatives before wrapping up.
+            if (!jacobian_prep_needs_derivatives()) {
+               process_entry_point_jacobian_prep();
+            }
+         }
       }
       else {
          // If the Jacobian does not require an update continue on to
@@ -196,7 +186,7 @@ LsodeFirstOrderODEIntegrator::integrate (
          re_entry_point = CycleStartFinish;
          integrator_reset_iteration_loop_part2();
          integrator_corrector_iteration();
-         // See comment at end of case JacobianPrep
+         // See comment in process_entry_point_jacobian_prep
          if (re_entry_point == CycleStartFinish) {
             manager_integration_loop_part3();
          }
@@ -208,7 +198,7 @@ LsodeFirstOrderODEIntegrator::integrate (
       load_derivatives(arrays.save);
       re_entry_point = CycleStartFinish;
       integrator_corrector_iteration();
-      // See comment at end of case JacobianPrep
+      // See comment in process_entry_point_jacobian_prep
       if (re_entry_point == CycleStartFinish) {
          manager_integration_loop_part3();
       }
@@ -219,7 +209,7 @@ LsodeFirstOrderODEIntegrator::integrate (
       load_derivatives(arrays.save);
       re_entry_point = CycleStartFinish;
       integrator_fail_reset_order_1_part2();
-      // See comment at end of case JacobianPrep
+      // See comment in process_entry_point_jacobian_prep
       if (re_entry_point == CycleStartFinish) {
          manager_integration_loop_part3();
       }
@@ -239,6 +229,52 @@ LsodeFirstOrderODEIntegrator::integrate (
    return return_val;
 }
 
+
+/**
+ * The code block from the main integrate routine for
+ * re_entry_point=JacobianPrep.  Continues the Jacobian preparation and, once
+ * it is complete, moves on to the corrector iteration.
+ */
+void
+LsodeFirstOrderODEIntegrator::process_entry_point_jacobian_prep()
+{
+   // The re_entry_point is not changed until the looping iteration
+   // is finished and the jacobian_wrap_up finished.  Otherwise, we
+   // will keep coming back to this point.
+
+   if (jacobian_prep_loop()) {
+      if (jacobian_prep_wrap_up()) {
+         // Moving on to line 250 in DSTODE.
+
+         re_entry_point = CycleStartFinish;
+         integrator_reset_iteration_loop_part2();
+         integrator_corrector_iteration();
+         // Following the return from any part of the integrator
+         // (DSTODE), the rest of the manager (DLSODE) must be called
+         // UNLESS the integrator returned prematurely, in need of a
+         // recompute of the derivatives.  If it did, the
+         // re_entry_point will be set accordingly.  If
+         // re_entry_point has not been reset, wrap up the manger
+         // functionality.
+         // Comment applies to all calls to integrator_* from all
+         // re_entry_point cases.
+         if (re_entry_point == CycleStartFinish) {
+            manager_integration_loop_part3();
+         }
+      }
+      else if (step_error == -2) {
+         er7_utils::MessageHandler::fail (__FILE__, __LINE__,
+            er7_utils::IntegrationMessages::internal_error,
+            "Infinite loop encountered in computing the Jacobian.\n"
+            "Repeated attempts keep producing a singular matrix.\n");
+      }
+   }
+   // else, the loop did not converge and need to return to it after
+   // recomputing derivatives.
+   return;
+}
+
+
 // Lines 70-95+ were for reconfiguring the integrator following a change to
 // parameters mid-integration, i.e. when calculation_phase (ISTATE) = 3.
 // This is no longer valid in this implementation. Deleting these lines.
@@ -332,7 +368,9 @@ void
 LsodeFirstOrderODEIntegrator::manager_initialize_calculation_part1()
 {
    arrays.allocate_arrays(control_data.num_odes,
-                          control_data.corrector_method);
+                          control_data.corrector_method,
+                          control_data.reuse_jacobian,
+                          control_data.workspace_pool);
    control_data.allocate_arrays();
 //##-----------------------------------------------------------------------
 //## Block C.
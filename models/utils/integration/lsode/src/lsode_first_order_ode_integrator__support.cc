@@ -33,6 +33,7 @@ Library dependencies:
 // System includes
 #include <math.h>  //sqrt
 #include <cmath> //std
+#include <algorithm> //std::min, std::max
 
 // Interface includes
 #include "er7_utils/interface/include/alloc.hh"
@@ -48,6 +49,7 @@ Library dependencies:
 
 // Model includes
 #include "../include/lsode_first_order_ode_integrator.hh"
+#include "../include/lsode_jacobian_provider.hh"
 
 using namespace jeod;
 
@@ -359,13 +361,18 @@ LsodeFirstOrderODEIntegrator::interpolate_y()
  * If corrector_method != JacobiNewtonInternalJac, P is subjected to
  * LU decomposition in preparation for later solution of linear systems with P as
  * coefficient matrix.
- * This is done by gauss_elim_factor (DGEFA) if
- *          corrector_method = NewtonIterUserJac or NewtonIterInternalJac,
- *       and by linear_solver (DGBFA) if
- *          corrector_method = NewtonIterUserBandJac or NewtonIterInternalBandJac.
+ * This is done by gauss_elim_factor (DGEFA) for all four Newton methods.
+ * The banded methods store the band within a full matrix rather than in the
+ * compact form used by DGBFA; their benefit is in the finite-difference
+ * Jacobian, which takes min(ml+mu+1, n) derivative evaluations rather than n.
  *
- * Note that the corrector_method using the banded Jacobians is not supported in
- * this release, so linear_solver is not used.
+ * The user-supplied Jacobian (was JAC) comes from the LsodeJacobianProvider
+ * in the control data.  It is called directly from jacobian_prep_init, so
+ * those methods need no external call (see jacobian_prep_needs_derivatives).
+ *
+ * When control_data.reuse_jacobian is set, -hl0*J is saved in
+ * arrays.saved_jacobian and jacobian_prep_reuse can later rebuild P for a new
+ * hl0 without evaluating the Jacobian.
  *
  * FTEM and ACOR were effectively the same, now arrays.accum_correction.
  * SAVF is now arrays.save.
@@ -392,16 +399,29 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_init()
 
    switch (control_data.corrector_method) {
    case LsodeControlDataInterface::NewtonIterUserJac:
-      // Prepare for calling the rest of jacobian_prep
-      // 100
-      // arrays.lin_alg is a  n*n matrix
+   case LsodeControlDataInterface::NewtonIterUserBandJac:
+      // 100, 400
+      // arrays.lin_alg is a  n*n matrix.  The banded form only sets the
+      // elements within the band.
+      if (control_data.jacobian_provider == nullptr) {
+         er7_utils::MessageHandler::fail (__FILE__, __LINE__,
+            er7_utils::IntegrationMessages::invalid_request,
+            "Corrector_method (MITER) %d requires a user-supplied Jacobian,\n"
+            "but no jacobian_provider has been set.",
+            control_data.corrector_method);
+      }
       for (unsigned int ii = 0; ii < control_data.num_odes; ii++) { // do 110
          for (unsigned int jj = 0; jj < control_data.num_odes; jj++) { // do 110
             // 110
             arrays.lin_alg[ii][jj] = 0.0;
          }
       }
-      break;  // return to exterior so that jac can be called.
+      // Was CALL JAC.  The provider is called directly rather than through
+      // an external call; y and arrays.save hold the predicted state and
+      // its derivatives.
+      control_data.jacobian_provider->compute_lsode_jacobian (
+         control_data.num_odes, y, arrays.save, arrays.lin_alg);
+      break;
 
    case LsodeControlDataInterface::NewtonIterInternalJac:
       // Need to make a series of calls to compute the derivatives in order
@@ -438,63 +458,34 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_init()
       }
       break;
 
-   case LsodeControlDataInterface::NewtonIterUserBandJac:
-      // Option not currently supported.
-      er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-         er7_utils::IntegrationMessages::invalid_request,
-         "Corrector_method (MITER) 4 (Modified Newton iteration with"
-         " user-supplied banded Jacobian) not supported.");
-//      // 400
-//      // arrays.lin_alg is a  (2*ml + mu *1)*n matrix
-//      //jacobian_lower_half_bandwidth = iwm[1];
-//      //jacobian_upper_half_bandwidth = iwm[2];
-//      //jacobian_lower_half_bandwidth3 = jacobian_lower_half_bandwidth + 3;
-//      mband = jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth + 1;
-//      meband = mband + jacobian_lower_half_bandwidth;
-//      for (int ii = 0; ii < meband; ii++) { // do 410
-//         for (int jj = 0; jj < control_data.num_odes; jj++) { // do 410
-//            // 410
-//            arrays.lin_alg[ii][jj] = 0.0;
-//         }
-//      }
-      break;
-
    case LsodeControlDataInterface::NewtonIterInternalBandJac:
-      // Option not currently supported.
-      er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-         er7_utils::IntegrationMessages::invalid_request,
-         "Corrector_method (MITER) 5 (Modified Newton iteration with"
-         " internally generated banded Jacobian) not supported.");
-//      // 500
-//      // arrays.lin_alg is a  (2*ml + mu + 1)*n matrix
-//      //jacobian_lower_half_bandwidth = iwm[1];
-//      //jacobian_upper_half_bandwidth = iwm[2];
-//      mband = jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth + 1;
-//
-//      // mba = min (mband, control_data.num_odes):
-//      mba = mband;
-//      if (mba > control_data.num_odes) {
-//         mba = control_data.num_odes;
-//      }
-//
-//      meband = mband + jacobian_lower_half_bandwidth;
-//      fac = magnitude_of_weighted_array (arrays.save);
-//      r0 = 1000.0 * std::abs(step_size) * epsilon * control_data.num_odes * fac;
-//      if (r0 == 0.0) {
-//          r0 = 1.0;
-//      }
-//      data_prepj.r0=r0;
-//      data_prepj.index_max = mba;
-//      data_prepj.index = 0;
-//
-//      for (int j = 0; j < mba; j++) { // do 560
-//      for (int ii = 0; ii < control_data.num_odes; ii+=mband) { // do 530
-//         r = std::max( (arrays.lin_alg_1 * std::abs(y[ii])) ,
-//                       (r0 / arrays.error_weight[ii]));
-//         // 530
-//         y[ii] = y[ii] + r;
-//      }}
+   {
+      // 500
+      // Columns that are at least mband apart share no rows within the band,
+      // so they are perturbed together and differenced from a single
+      // derivative evaluation.  Only mba = min(mband, n) evaluations are
+      // needed rather than n.
+      // arrays.lin_alg is a  n*n matrix; elements outside the band stay zero.
+      unsigned int mband = control_data.jacobian_lower_bandwidth +
+                           control_data.jacobian_upper_bandwidth + 1;
+      unsigned int mba = std::min (mband, control_data.num_odes);
+
+      for (unsigned int ii = 0; ii < control_data.num_odes; ii++) {
+         for (unsigned int jj = 0; jj < control_data.num_odes; jj++) {
+            arrays.lin_alg[ii][jj] = 0.0;
+         }
+      }
+      data_prepj.fac = magnitude_of_weighted_array (arrays.save);
+      data_prepj.r0 = 1000.0 * std::abs(step_size) * epsilon *
+                                       control_data.num_odes * data_prepj.fac;
+      if (std::fpclassify(data_prepj.r0) == FP_ZERO) {
+          data_prepj.r0 = 1.0;
+      }
+      data_prepj.index_max = mba;
+      jacobian_prep_band_perturb (0);
       break;
+   }
+
    case LsodeControlDataInterface::FunctionalIteration:
    default:
       break;
@@ -504,6 +495,45 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_init()
 }
 
 
+/**
+ * Indicates whether the current corrector method needs new derivatives
+ * (an external call) between jacobian_prep_init and jacobian_prep_loop.
+ * The user-supplied Jacobian methods do not.
+ */
+bool
+LsodeFirstOrderODEIntegrator::jacobian_prep_needs_derivatives() const
+{
+   return
+      (control_data.corrector_method !=
+                                 LsodeControlDataInterface::NewtonIterUserJac) &&
+      (control_data.corrector_method !=
+                             LsodeControlDataInterface::NewtonIterUserBandJac);
+}
+
+
+/**
+ * Perturbs the state elements in one column group of the banded
+ * finite-difference Jacobian: elements group, group+mband, group+2*mband, ...
+ * The unperturbed state is the prediction, arrays.history[*][0].
+ * @param[in] group  Index of the column group, 0 to mba-1.
+ */
+void
+LsodeFirstOrderODEIntegrator::jacobian_prep_band_perturb(
+   unsigned int group)
+{
+   unsigned int mband = control_data.jacobian_lower_bandwidth +
+                        control_data.jacobian_upper_bandwidth + 1;
+
+   for (unsigned int jj = group; jj < control_data.num_odes; jj += mband) {
+      // 530
+      double r = std::max( (arrays.lin_alg_1 * std::abs(y[jj])) ,
+                           (data_prepj.r0 / arrays.error_weight[jj]));
+      y[jj] += r;
+   }
+   return;
+}
+
+
 /***************************************************************************
 jacobian_prep_loop
 Purpose (Adapted from DPREPJ.  Gets called following the external function call
@@ -519,6 +549,7 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_loop()
    switch (control_data.corrector_method) {
 
    case LsodeControlDataInterface::NewtonIterUserJac:
+   case LsodeControlDataInterface::NewtonIterUserBandJac:
       // there is no loop in this case, go straight to wrap-up
       break;
 
@@ -550,56 +581,42 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_loop()
       // there is no loop in this case, go straight to wrap-up
       break;
 
-//Unsupported cases:
-//   case  LsodeControlDataInterface::NewtonIterUserBandJac:
-//      // there is no loop in this case, go straight to wrap-up
-//      break;
-
-//
-//
-//   case   LsodeControlDataInterface::NewtonIterInternalBandJac:
-//      load_derivatives(arrays.accum_correction);
-//      for (int jj = data_prepj.index; jj < control_data.num_odes; jj+=mband) { // do 550
-//         y[jj] = arrays.history[jj][0];
-//         r = std::max( (arrays.lin_alg_1 * std::abs(y[jj])) ,
-//                       (data_prepj.r0/arrays.error_weight[jj]));
-//         fac = -data_prepj.hl0/r;
-//         int i1 = std::max((jj+1)-jacobian_upper_half_bandwidth,1);
-//
-//         //int i2 = std::min((jj+1)+jacobian_lower_half_bandwidth,control_data.num_odes);
-//         int i2 = (jj+1)+jacobian_lower_half_bandwidth;
-//         if (i2 > control_data.num_odes) {
-//            i2 = control_data.num_odes;
-//         }
-//
-//         int ii = (jj+1)*(meband-1) - jacobian_lower_half_bandwidth + 2;
-//         //FIXME  Reconstruct this from documentation.  it looks
-//         //dodgy.  This is setting into arrays.lin_alg across data
-//         //adresses that span the first index.
-//         for (int i = i1-1; i < i2; i++) { // do 540
-//            // 540
-//            arrays.lin_alg[/*FIXME*/jj][i] = (arrays.accum_correction[i] - arrays.save[i]) * fac;
-//         }
-//      // 550
-//      }
-//
-//      data_prepj.index++;
-//      if (data_prepj.index < data_prepj.index_max) {
-//         // Prepare for next call to generate derivatives.
-//         for (int ii = data_prepj.index; ii < control_data.num_odes; ii+=mband) { // do 530
-//            r = std::max( (arrays.lin_alg_1 * std::abs(y[ii])) ,
-//                          (data_prepj.r0 / arrays.error_weight[ii]));
-//            // 530
-//            y[ii] = y[ii] + r;
-//         }
-//         return false; // re-cycle
-//      }
-//      break; // loop finished
+   case LsodeControlDataInterface::NewtonIterInternalBandJac:
+   {
+      unsigned int ml = control_data.jacobian_lower_bandwidth;
+      unsigned int mu = control_data.jacobian_upper_bandwidth;
+      unsigned int mband = ml + mu + 1;
+
+      load_derivatives(arrays.accum_correction);
+      for (unsigned int col = data_prepj.index;
+           col < control_data.num_odes;
+           col += mband) { // do 550
+         // Restore the unperturbed element and recover the increment.
+         y[col] = arrays.history[col][0];
+         double r = std::max( (arrays.lin_alg_1 * std::abs(y[col])) ,
+                              (data_prepj.r0 / arrays.error_weight[col]));
+         double fac = -data_prepj.hl0/r;
+         unsigned int i1 = (col > mu) ? col - mu : 0;
+         unsigned int i2 = std::min (col + ml, control_data.num_odes - 1);
+         for (unsigned int ii = i1; ii <= i2; ii++) { // do 540
+            // 540
+            arrays.lin_alg[col][ii] = (arrays.accum_correction[ii] -
+                                       arrays.save[ii]) * fac;
+         }
+      // 550
+      }
+
+      data_prepj.index++;
+      if (data_prepj.index < data_prepj.index_max) {
+         // Prepare for next call to generate derivatives.
+         jacobian_prep_band_perturb (data_prepj.index);
+         return false; // re-cycle
+      }
+      break; // loop finished
+   }
 
    // 560
    case LsodeControlDataInterface::FunctionalIteration:
-   case LsodeControlDataInterface::NewtonIterUserBandJac:
-   case LsodeControlDataInterface::NewtonIterInternalBandJac:
    default:
       break;
    }
@@ -616,25 +633,22 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_loop()
 bool
 LsodeFirstOrderODEIntegrator::jacobian_prep_wrap_up()
 {
+   bool full_matrix = false;
+
    switch (control_data.corrector_method) {
    case LsodeControlDataInterface::NewtonIterUserJac:
+   case LsodeControlDataInterface::NewtonIterUserBandJac:
       for (unsigned int ii = 0; ii < control_data.num_odes; ii++) { // do 110
          for (unsigned int jj = 0; jj < control_data.num_odes; jj++) { // do 110
-            // 120
+            // 120, 420
             arrays.lin_alg[ii][jj] *= (-data_prepj.hl0);
          }
       }
-      /* fall through */
+      full_matrix = true;
+      break;
    case LsodeControlDataInterface::NewtonIterInternalJac:
-      //## Add identity matrix. ----------------------------------------------
-      // 240
-      for (unsigned int ii = 0; ii < control_data.num_odes; ii++) { // do 250
-        arrays.lin_alg[ii][ii] += 1.0;
-      }
-   //## Do LU decomposition on P. --------------------------------------------
-      if ( gauss_elim_factor() != 0) { // was DGEFA, returns IER,
-          iteration_matrix_singular = true;
-      }
+   case LsodeControlDataInterface::NewtonIterInternalBandJac:
+      full_matrix = true;
       break;
    case LsodeControlDataInterface::JacobiNewtonInternalJac:
       load_derivatives(arrays.lin_alg[0]);
@@ -663,28 +677,6 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_wrap_up()
       }
       break;
 
-// Unsupported cases:
-   case LsodeControlDataInterface::NewtonIterUserBandJac:
-//      for (int ii = 0; ii < meband; ii++) { // do 420
-//         for (int jj = 0; jj < control_data.num_odes; jj++) { // do 420
-//            // 420
-//            arrays.lin_alg[ii][jj] *= (-data_prepj.hl0);
-//         }
-//      }
-//      // fall-through (go to 570)
-//
-
-   case LsodeControlDataInterface::NewtonIterInternalBandJac:
-//      // 570
-//      This code was so far from complete that it has been stripped.
-//      If this option gets implemented at a later date, the code from
-//      lines 570 - end must be re-implemented, including the DGBFA
-//      method.
-      er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-         er7_utils::IntegrationMessages::invalid_request,
-         "Illegal corrector method requested, corrector_method = %d.",
-         control_data.corrector_method);
-      break;
    case LsodeControlDataInterface::FunctionalIteration:
         // No action, impossible case, FuncIter has no Jacobian.
       er7_utils::MessageHandler::error (__FILE__, __LINE__,
@@ -700,7 +692,94 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_wrap_up()
       break;
    }
 
+   if (full_matrix) {
+      // lin_alg now holds -hl0 * J.  Keep a copy so that later steps can
+      // rescale it rather than re-evaluate it.
+      if (arrays.saved_jacobian != nullptr) {
+         for (unsigned int ii = 0; ii < control_data.num_odes; ii++) {
+            for (unsigned int jj = 0; jj < control_data.num_odes; jj++) {
+               arrays.saved_jacobian[ii][jj] = arrays.lin_alg[ii][jj];
+            }
+         }
+         data_prepj.saved_hl0 = data_prepj.hl0;
+         saved_jacobian_valid = true;
+      }
+
+      //## Add identity matrix. ----------------------------------------------
+      // 240, 570
+      for (unsigned int ii = 0; ii < control_data.num_odes; ii++) { // do 250
+        arrays.lin_alg[ii][ii] += 1.0;
+      }
+   //## Do LU decomposition on P. --------------------------------------------
+      // The banded methods store the band within a full matrix, so DGEFA
+      // serves all four Newton methods and DGBFA is not needed.
+      if ( gauss_elim_factor() != 0) { // was DGEFA, returns IER,
+          iteration_matrix_singular = true;
+      }
+   }
+
+   step_at_last_jacobian_eval = num_steps_taken;
+   return jacobian_prep_finish();
+}
 
+
+/**
+ * Indicates whether the iteration matrix can be rebuilt from the saved
+ * Jacobian instead of evaluating a new one.  This requires that reuse is
+ * enabled, the saved Jacobian is younger than max_num_steps_jacobian steps,
+ * and the corrector did not just fail to converge with a stale Jacobian
+ * (convergence_jacobian_flag == 1), which demands a fresh evaluation.
+ */
+bool
+LsodeFirstOrderODEIntegrator::jacobian_reuse_available() const
+{
+   return saved_jacobian_valid &&
+          (convergence_jacobian_flag != 1) &&
+          (num_steps_taken <
+             step_at_last_jacobian_eval + control_data.max_num_steps_jacobian);
+}
+
+
+/**
+ * Rebuilds the iteration matrix P = I - hl0*J from the saved Jacobian for the
+ * current hl0 = step_size * method_coeff_first and factors it.  No derivative
+ * evaluations are needed.  The Jacobian is marked as not current so that a
+ * convergence failure forces a fresh evaluation.
+ */
+bool
+LsodeFirstOrderODEIntegrator::jacobian_prep_reuse()
+{
+   data_prepj.hl0 = step_size * method_coeff_first;
+   double scale = data_prepj.hl0 / data_prepj.saved_hl0;
+
+   num_jacobian_reuses ++;
+   iteration_matrix_singular = false;
+   jacobian_current = false;
+
+   for (unsigned int ii = 0; ii < control_data.num_odes; ii++) {
+      for (unsigned int jj = 0; jj < control_data.num_odes; jj++) {
+         arrays.lin_alg[ii][jj] = scale * arrays.saved_jacobian[ii][jj];
+      }
+      arrays.lin_alg[ii][ii] += 1.0;
+   }
+   if (gauss_elim_factor() != 0) {
+      // Do not try the saved Jacobian again.
+      iteration_matrix_singular = true;
+      saved_jacobian_valid = false;
+   }
+
+   return jacobian_prep_finish();
+}
+
+
+/**
+ * Completes the preparation of the iteration matrix, whether newly evaluated
+ * or rebuilt from the saved Jacobian.
+ * @return True if the corrector iteration can proceed (line 250 of DSTODE).
+ */
+bool
+LsodeFirstOrderODEIntegrator::jacobian_prep_finish()
+{
    // This next code chunk comes from DSTODE, right after the call to
    // PJAC a little after line 230.  The only way to get to this little
    // nugget of code is to pass through the PJAC call, so it rightfully
@@ -724,7 +803,8 @@ LsodeFirstOrderODEIntegrator::jacobian_prep_wrap_up()
  * system arising from a chord iteration.
  * It is called if corrector_method != FunctionalIteration.
  *
- * If corrector_method == NewtonIterUserJac || NewtonIterInternalJac,
+ * For the Newton methods (NewtonIterUserJac, NewtonIterInternalJac,
+ * NewtonIterUserBandJac, NewtonIterInternalBandJac),
  * it calls linear_solver (was DGESL).
  * If corrector_method = JacobiNewtonInternalJac it updates the coefficient
  *     hl0 = step_size * method_coeff_first (previously H*EL0) in the diagonal
@@ -740,7 +820,11 @@ LsodeFirstOrderODEIntegrator::linear_chord_iteration()
    switch (control_data.corrector_method) {
    case LsodeControlDataInterface::NewtonIterUserJac:
    case LsodeControlDataInterface::NewtonIterInternalJac:
-      // 100
+   case LsodeControlDataInterface::NewtonIterUserBandJac:
+   case LsodeControlDataInterface::NewtonIterInternalBandJac:
+      // 100, 400
+      // The banded methods store the band within a full matrix,
+      // so DGESL serves in place of DGBSL.
       linear_solver();
       break;
    case LsodeControlDataInterface::JacobiNewtonInternalJac:
@@ -768,21 +852,7 @@ LsodeFirstOrderODEIntegrator::linear_chord_iteration()
       }
       break;
 
-// Not supported:
-//   case LsodeControlDataInterface::NewtonIterUserBandJac:
-//   case LsodeControlDataInterface::NewtonIterInternalBandJac:
-//      // 400
-//      //jacobian_lower_half_bandwidth = iwm[1];
-//      //jacobian_upper_half_bandwidth = iwm[2];
-//      //FIXME  Need to reconstruct to identify where the matrix starts
-//      //and ends in wm in this case.
-//      //meband = 2*jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth + 1;
-//      dgbsl(); // THIS METHOD HAS NOT BEEN IMPLEMENTED.  IT MUST BE
-//      IMPLEMENTED BEFORE THIS OPTION CAN BE PROVIDED.
-//      return;
    case LsodeControlDataInterface::FunctionalIteration:
-   case LsodeControlDataInterface::NewtonIterUserBandJac:
-   case LsodeControlDataInterface::NewtonIterInternalBandJac:
    default:
       break;
    }
@@ -94,6 +94,9 @@ LsodeFirstOrderODEIntegrator::LsodeFirstOrderODEIntegrator (
    jacobian_current(false),
    update_jacobian(true),
    step_at_last_jacobian_update(0),
+   step_at_last_jacobian_eval(0),
+   num_jacobian_reuses(0),
+   saved_jacobian_valid(false),
    convergence_jacobian_flag(0),
    rel_change_since_jacobian(0.0),
    iteration_matrix_singular(false),
@@ -166,6 +169,9 @@ LsodeFirstOrderODEIntegrator::LsodeFirstOrderODEIntegrator (
    jacobian_current(false),
    update_jacobian(true),
    step_at_last_jacobian_update(0),
+   step_at_last_jacobian_eval(0),
+   num_jacobian_reuses(0),
+   saved_jacobian_valid(false),
    convergence_jacobian_flag(0),
    rel_change_since_jacobian(0.0),
    iteration_matrix_singular(false),
@@ -274,12 +280,14 @@ double
 LsodeFirstOrderODEIntegrator::magnitude_of_weighted_array(
      const double     * v)
 {
+   const double * ER7_UTILS_RESTRICT weight = arrays.error_weight;
+   unsigned int num_odes = control_data.num_odes;
    double sum = 0.0;
-   for (unsigned int ii = 0; ii < control_data.num_odes; ii++) {
-      double mult = v[ii] * arrays.error_weight[ii];
+   for (unsigned int ii = 0; ii < num_odes; ii++) {
+      double mult = v[ii] * weight[ii];
       sum += (mult * mult);
    }
-   return sqrt(sum/control_data.num_odes);
+   return sqrt(sum/num_odes);
 }
 
 /**
@@ -294,12 +302,27 @@ LsodeFirstOrderODEIntegrator::magnitude_of_weighted_array(
      unsigned int      index,
      double    ** v)
 {
+   const double * ER7_UTILS_RESTRICT weight = arrays.error_weight;
+   unsigned int num_odes = control_data.num_odes;
    double sum = 0.0;
-   for (unsigned int ii = 0; ii < control_data.num_odes; ii++) {
-      double mult = v[ii][index] * arrays.error_weight[ii];
-      sum += (mult * mult);
+
+   // The rows of history are evenly spaced in one block; step through the
+   // column directly rather than through the row pointers.
+   if (v == arrays.history) {
+      const double * column = arrays.history[0] + index;
+      unsigned int stride = arrays.history_stride;
+      for (unsigned int ii = 0; ii < num_odes; ii++) {
+         double mult = column[ii*stride] * weight[ii];
+         sum += (mult * mult);
+      }
+   }
+   else {
+      for (unsigned int ii = 0; ii < num_odes; ii++) {
+         double mult = v[ii][index] * weight[ii];
+         sum += (mult * mult);
+      }
    }
-   return sqrt(sum/control_data.num_odes);
+   return sqrt(sum/num_odes);
 }
 
 /**
@@ -32,6 +32,7 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <memory>
 
 // Interface includes
 #include "er7_utils/interface/include/alloc.hh"
@@ -48,6 +49,7 @@ Library dependencies:
 #include "../include/lsode_simple_second_order_ode_integrator.hh"
 #include "../include/lsode_generalized_second_order_ode_integrator.hh"
 #include "../include/lsode_integration_controls.hh"
+#include "../include/lsode_workspace_pool.hh"
 
 using namespace jeod;
 
@@ -58,7 +60,11 @@ LsodeIntegratorConstructor::LsodeIntegratorConstructor(const LsodeIntegratorCons
 :
    er7_utils::IntegratorConstructor(),
    data_interface(src.data_interface)
-{ }
+{
+   // A copy serves a different integration group; give it its own
+   // workspace pool.
+   data_interface.workspace_pool = std::make_shared<LsodeWorkspacePool> ();
+}
 
 
 
@@ -0,0 +1,266 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Lsode
+ * @{
+ *
+ * @file models/utils/integration/lsode/src/lsode_workspace_pool.cc
+ * Define member functions for the LSODE workspace classes.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((TBS)))
+
+Assumptions and limitations:
+  (TBS)
+
+Library dependencies:
+  ((lsode_workspace_pool.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+
+// Interface includes
+#include "er7_utils/interface/include/alloc.hh"
+
+// Model includes
+#include "../include/lsode_workspace_pool.hh"
+
+using namespace jeod;
+
+
+/**
+ * LsodeWorkspace default constructor.
+ */
+LsodeWorkspace::LsodeWorkspace()
+:
+   reals(nullptr),
+   rows(nullptr),
+   ints(nullptr),
+   num_reals(0),
+   num_rows(0),
+   num_ints(0),
+   in_use(false),
+   real_storage(nullptr)
+{}
+
+
+/**
+ * LsodeWorkspace destructor.
+ */
+LsodeWorkspace::~LsodeWorkspace()
+{
+   free_storage();
+}
+
+
+/**
+ * Allocate storage of the given capacities. The real storage is
+ * over-allocated by up to one cache line so that reals can start on a
+ * cache line boundary.
+ * \param[in] num_reals_in Real capacity, a multiple of the alignment
+ * \param[in] num_rows_in  Row pointer capacity
+ * \param[in] num_ints_in  Integer capacity
+ */
+void
+LsodeWorkspace::reserve(
+   unsigned int num_reals_in,
+   unsigned int num_rows_in,
+   unsigned int num_ints_in)
+{
+   const unsigned int line_size =
+      LsodeWorkspacePool::alignment * sizeof(double);
+
+   free_storage();
+
+   if (num_reals_in > 0) {
+      real_storage = er7_utils::alloc::allocate_array<double> (
+                        num_reals_in + LsodeWorkspacePool::alignment - 1);
+      std::size_t misalignment =
+         reinterpret_cast<std::uintptr_t>(real_storage) % line_size;
+      reals = real_storage +
+              (misalignment == 0 ? 0 :
+               (line_size - misalignment) / sizeof(double));
+   }
+   if (num_rows_in > 0) {
+      rows = er7_utils::alloc::allocate_array<double *> (num_rows_in);
+   }
+   if (num_ints_in > 0) {
+      ints = er7_utils::alloc::allocate_array<int> (num_ints_in);
+   }
+
+   num_reals = num_reals_in;
+   num_rows = num_rows_in;
+   num_ints = num_ints_in;
+}
+
+
+/**
+ * Free the storage.
+ */
+void
+LsodeWorkspace::free_storage()
+{
+   if (real_storage != nullptr) {
+      er7_utils::alloc::deallocate_array<double> (real_storage);
+   }
+   if (rows != nullptr) {
+      er7_utils::alloc::deallocate_array<double *> (rows);
+   }
+   if (ints != nullptr) {
+      er7_utils::alloc::deallocate_array<int> (ints);
+   }
+
+   real_storage = nullptr;
+   reals = nullptr;
+   rows = nullptr;
+   ints = nullptr;
+   num_reals = 0;
+   num_rows = 0;
+   num_ints = 0;
+}
+
+
+/**
+ * LsodeWorkspacePool default constructor.
+ */
+LsodeWorkspacePool::LsodeWorkspacePool()
+:
+   workspaces(),
+   mutex()
+{}
+
+
+/**
+ * LsodeWorkspacePool destructor. Frees all workspaces.
+ */
+LsodeWorkspacePool::~LsodeWorkspacePool()
+{
+   for (auto workspace : workspaces) {
+      er7_utils::alloc::delete_object (workspace);
+   }
+   workspaces.clear();
+}
+
+
+/**
+ * Acquire a workspace with at least the given capacities. The smallest idle
+ * workspace that is large enough is preferred. Failing that, the largest
+ * idle workspace is regrown, and failing that a new workspace is made.
+ * @return Acquired workspace, to be returned with release
+ * \param[in] num_reals Number of reals needed, rounded up to a whole
+ *                      number of cache lines
+ * \param[in] num_rows  Number of row pointers needed
+ * \param[in] num_ints  Number of integers needed
+ */
+LsodeWorkspace *
+LsodeWorkspacePool::acquire(
+   unsigned int num_reals,
+   unsigned int num_rows,
+   unsigned int num_ints)
+{
+   std::lock_guard<std::mutex> lock (mutex);
+
+   num_reals = padded_size (num_reals);
+
+   LsodeWorkspace * best_fit = nullptr;
+   LsodeWorkspace * largest_idle = nullptr;
+   for (auto workspace : workspaces) {
+      if (workspace->in_use) {
+         continue;
+      }
+      if ((workspace->num_reals >= num_reals) &&
+          (workspace->num_rows >= num_rows) &&
+          (workspace->num_ints >= num_ints) &&
+          ((best_fit == nullptr) ||
+           (workspace->num_reals < best_fit->num_reals))) {
+         best_fit = workspace;
+      }
+      if ((largest_idle == nullptr) ||
+          (workspace->num_reals > largest_idle->num_reals)) {
+         largest_idle = workspace;
+      }
+   }
+
+   LsodeWorkspace * workspace = best_fit;
+   if (workspace == nullptr) {
+      workspace = largest_idle;
+      if (workspace == nullptr) {
+         workspace = er7_utils::alloc::allocate_object<LsodeWorkspace> ();
+         workspaces.push_back (workspace);
+      }
+      workspace->reserve (num_reals, num_rows, num_ints);
+   }
+
+   workspace->in_use = true;
+   return workspace;
+}
+
+
+/**
+ * Return a workspace to the pool. Its storage is kept for reuse.
+ * \param[in] workspace Workspace obtained from acquire; null is ignored
+ */
+void
+LsodeWorkspacePool::release(
+   LsodeWorkspace * workspace)
+{
+   if (workspace == nullptr) {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock (mutex);
+   workspace->in_use = false;
+}
+
+
+/**
+ * Get the number of workspaces owned by the pool.
+ * @return Number of workspaces
+ */
+unsigned int
+LsodeWorkspacePool::get_num_workspaces() const
+{
+   std::lock_guard<std::mutex> lock (mutex);
+   return workspaces.size();
+}
+
+
+/**
+ * Get the number of workspaces currently acquired.
+ * @return Number of workspaces in use
+ */
+unsigned int
+LsodeWorkspacePool::get_num_in_use() const
+{
+   std::lock_guard<std::mutex> lock (mutex);
+   unsigned int count = 0;
+   for (auto workspace : workspaces) {
+      if (workspace->in_use) {
+         ++count;
+      }
+   }
+   return count;
+}
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,145 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/src/integration_event.cc
+ * Define IntegrationEvent methods.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((integration_event.cc))
+
+
+******************************************************************************/
+
+
+// Local includes
+#include "../include/integration_event.hh"
+
+// System includes
+#include <cstddef>
+
+
+//! Namespace jeod
+namespace jeod {
+
+// IntegrationEvent default constructor.
+IntegrationEvent::IntegrationEvent ()
+:
+   active(true),
+   direction(Either),
+   time_tolerance(1.0e-6),
+   max_iterations(50),
+   event_time(0.0),
+   event_count(0)
+{
+   ; // Empty
+}
+
+
+// IntegrationEvent destructor.
+IntegrationEvent::~IntegrationEvent ()
+{
+   ; // Empty
+}
+
+
+/**
+ * Look for a zero crossing of the guard within a step and, if there is
+ * one, narrow it to time_tolerance by the Illinois variant of regula falsi.
+ * A guard that is zero at the start of the step is taken to have crossed
+ * in the previous step.
+ * @param[in]  group          The group whose step is searched.
+ * @param[in]  start_time     Dynamic time at the start of the step.
+ * @param[in]  end_time       Dynamic time at the end of the step.
+ * @param[out] crossing_time  The earliest time found on the far side of
+ *                            the crossing.
+ * @return True if the guard crossed zero in the specified direction.
+ */
+bool
+IntegrationEvent::locate (
+   const JeodIntegrationGroup & group,
+   double start_time,
+   double end_time,
+   double & crossing_time)
+{
+   double near_time = start_time;
+   double far_time = end_time;
+   double near_value;
+   double far_value;
+
+   if ((! evaluate_guard (group, near_time, near_value)) ||
+       (! evaluate_guard (group, far_time, far_value))) {
+      return false;
+   }
+
+   bool rising  = (near_value < 0.0) && (far_value >= 0.0);
+   bool falling = (near_value > 0.0) && (far_value <= 0.0);
+   if (! ((rising  && (direction != Falling)) ||
+          (falling && (direction != Rising)))) {
+      return false;
+   }
+
+   // Narrow the bracket. The near end keeps the sign of the guard at the
+   // start of the step; halving the value at the end that did not move
+   // (Illinois) keeps either end from stalling. A bisection is taken
+   // whenever two steps have failed to halve the bracket.
+   int last_side = 0;
+   double width_two_back = far_time - near_time;
+   double width_one_back = width_two_back;
+   for (unsigned int iter = 0;
+        (iter < max_iterations) && (far_time - near_time > time_tolerance);
+        ++iter) {
+
+      double width = far_time - near_time;
+      double trial_time =
+         far_time - far_value * width / (far_value - near_value);
+      if ((! (trial_time > near_time)) || (! (trial_time < far_time)) ||
+          ((iter >= 2) && (width > 0.5 * width_two_back))) {
+         trial_time = 0.5 * (near_time + far_time);
+      }
+      width_two_back = width_one_back;
+      width_one_back = width;
+
+      double trial_value;
+      if (! evaluate_guard (group, trial_time, trial_value)) {
+         break;
+      }
+
+      if ((trial_value == 0.0) || ((trial_value < 0.0) != (near_value < 0.0))) {
+         far_time = trial_time;
+         far_value = trial_value;
+         if (last_side == 1) {
+            near_value *= 0.5;
+         }
+         last_side = 1;
+      }
+      else {
+         near_time = trial_time;
+         near_value = trial_value;
+         if (last_side == -1) {
+            far_value *= 0.5;
+         }
+         last_side = -1;
+      }
+   }
+
+   crossing_time = far_time;
+   return true;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
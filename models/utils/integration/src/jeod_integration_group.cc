@@ -16,6 +16,7 @@ Purpose:
 
 Library dependencies:
   ((jeod_integration_group.cc)
+   (integration_event.cc)
    (jeod_integration_time.cc)
    (integration_messages.cc)
    (utils/message/src/message_handler.cc)
@@ -28,6 +29,7 @@ Library dependencies:
 // Local includes
 #include "../include/jeod_integration_group.hh"
 
+#include "../include/integration_event.hh"
 #include "../include/jeod_integration_time.hh"
 #include "../include/integration_messages.hh"
 
@@ -43,6 +45,8 @@ Library dependencies:
 // System includes
 #include <algorithm>
 #include <cstddef>
+#include <utility>
+#include <vector>
 
 
 //! Namespace jeod
@@ -56,6 +60,7 @@ JeodIntegrationGroup::register_classes ()
    JEOD_REGISTER_CLASS (JeodIntegrationGroup);
    JEOD_REGISTER_CLASS (JeodIntegrationGroupOwner);
    JEOD_REGISTER_CLASS (er7_utils::IntegrableObject);
+   JEOD_REGISTER_INCOMPLETE_CLASS (IntegrationEvent);
 }
 
 
@@ -63,15 +68,22 @@ JeodIntegrationGroup::register_classes ()
 JeodIntegrationGroup::JeodIntegrationGroup ()
 :
    BaseIntegrationGroup(),
+   dense_output(false),
    group_owner(nullptr),
    integ_merger(),
    jeod_integ_interface(nullptr),
    jeod_time_manager(nullptr),
-   integrable_objects()
+   integrable_objects(),
+   integrable_object_positions(),
+   events(),
+   dense_output_start(0.0),
+   dense_output_end(0.0),
+   dense_output_valid(false)
 {
    register_classes ();
 
    JEOD_REGISTER_CHECKPOINTABLE (this, integrable_objects);
+   JEOD_REGISTER_CHECKPOINTABLE (this, events);
 }
 
 
@@ -83,15 +95,22 @@ JeodIntegrationGroup::JeodIntegrationGroup (
    JeodIntegrationTime & time_mngr)
 :
    BaseIntegrationGroup(integ_cotr, integ_inter, time_mngr),
+   dense_output(false),
    group_owner(&owner),
    integ_merger(),
    jeod_integ_interface(&integ_inter),
    jeod_time_manager(&time_mngr),
-   integrable_objects()
+   integrable_objects(),
+   integrable_object_positions(),
+   events(),
+   dense_output_start(0.0),
+   dense_output_end(0.0),
+   dense_output_valid(false)
 {
    register_classes ();
 
    JEOD_REGISTER_CHECKPOINTABLE (this, integrable_objects);
+   JEOD_REGISTER_CHECKPOINTABLE (this, events);
 
    integ_merger.configure (integ_cotr);
    time_mngr.add_time_change_subscriber (*this);
@@ -101,6 +120,7 @@ JeodIntegrationGroup::JeodIntegrationGroup (
 // JeodIntegrationGroup destructor.
 JeodIntegrationGroup::~JeodIntegrationGroup ()
 {
+   JEOD_DEREGISTER_CHECKPOINTABLE (this, events);
    JEOD_DEREGISTER_CHECKPOINTABLE (this, integrable_objects);
 
    if (jeod_time_manager != nullptr) {
@@ -115,17 +135,12 @@ JeodIntegrationGroup::add_integrable_object (
    er7_utils::IntegrableObject & integrable_object)
 {
    // Remove the entry for this object if it's already present.
-   std::vector<er7_utils::IntegrableObject*>::iterator iter =
-      std::find (integrable_objects.begin(), integrable_objects.end(),
-                 &integrable_object);
-   if (iter != integrable_objects.end()) {
+   if (integrable_object_positions.swap_remove (
+          integrable_objects, &integrable_object)) {
       // Make the object destroy its integrator(s).
       if (integ_controls != nullptr) {
          integrable_object.destroy_integrators ();
       }
-
-       // Delete the object from the list of integrable objects.
-      integrable_objects.erase (iter);
    }
 
    // Make the object create its integrator(s).
@@ -136,22 +151,21 @@ JeodIntegrationGroup::add_integrable_object (
    }
 
    // Add the object to the list of integrable objects.
-   integrable_objects.push_back (&integrable_object);
+   integrable_object_positions.push_back (
+      integrable_objects, &integrable_object);
 }
 
 
 // Remove an integrable object from the vector of such.
+// The last object in the vector takes the removed object's place.
 void
 JeodIntegrationGroup::remove_integrable_object (
    er7_utils::IntegrableObject & integrable_object)
 {
-   // Find the entry for this object in the vector of such.
-   std::vector<er7_utils::IntegrableObject*>::iterator iter =
-      std::find (integrable_objects.begin(), integrable_objects.end(),
-                 &integrable_object);
-
+   // Delete the object from the list of integrable objects.
    // Not found: Nothing to delete.
-   if (iter == integrable_objects.end()) {
+   if (! integrable_object_positions.swap_remove (
+            integrable_objects, &integrable_object)) {
       MessageHandler::error (
          __FILE__, __LINE__,
          IntegrationMessages::invalid_item,
@@ -163,9 +177,85 @@ JeodIntegrationGroup::remove_integrable_object (
    if (integ_controls != nullptr) {
       integrable_object.destroy_integrators ();
    }
+}
+
+
+// Add an event to the vector of such.
+void
+JeodIntegrationGroup::add_event (
+   IntegrationEvent & event)
+{
+   if (std::find (events.begin(), events.end(), &event) != events.end()) {
+      MessageHandler::error (
+         __FILE__, __LINE__,
+         IntegrationMessages::invalid_item,
+         "Duplicate entry in IntegrationGroup::add_event()");
+      return;
+   }
+
+   events.push_back (&event);
+   dense_output = true;
+}
+
 
-    // Delete the object from the list of integrable objects.
-   integrable_objects.erase (iter);
+// Remove an event from the vector of such.
+void
+JeodIntegrationGroup::remove_event (
+   IntegrationEvent & event)
+{
+   std::vector<IntegrationEvent*>::iterator iter =
+      std::find (events.begin(), events.end(), &event);
+
+   if (iter == events.end()) {
+      MessageHandler::error (
+         __FILE__, __LINE__,
+         IntegrationMessages::invalid_item,
+         "Missing entry in IntegrationGroup::remove_event()");
+      return;
+   }
+
+   events.erase (iter);
+}
+
+
+/**
+ * Check the events against the most recent integration step and handle
+ * those that occurred, in time order. Events that occurred at the same
+ * time are handled in the order in which they were added.
+ */
+void
+JeodIntegrationGroup::detect_events (
+   void)
+{
+   if (events.empty() || (! dense_output_valid)) {
+      return;
+   }
+
+   std::vector<std::pair<double, IntegrationEvent*> > occurred;
+   for (std::vector<IntegrationEvent*>::iterator iter = events.begin();
+        iter != events.end();
+        ++iter) {
+      IntegrationEvent * event = *iter;
+      double crossing_time;
+      if (event->active &&
+          event->locate (
+             *this, dense_output_start, dense_output_end, crossing_time)) {
+         occurred.push_back (std::make_pair (crossing_time, event));
+      }
+   }
+
+   std::stable_sort (
+      occurred.begin(), occurred.end(),
+      [] (const std::pair<double, IntegrationEvent*> & lhs,
+          const std::pair<double, IntegrationEvent*> & rhs)
+      { return lhs.first < rhs.first; });
+
+   for (unsigned int ii = 0; ii < occurred.size(); ++ii) {
+      IntegrationEvent * event = occurred[ii].second;
+      event->event_time = occurred[ii].first;
+      ++event->event_count;
+      event->handle_event (*this, occurred[ii].first);
+   }
 }
 
 
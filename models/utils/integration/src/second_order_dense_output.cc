@@ -0,0 +1,234 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/src/second_order_dense_output.cc
+ * Define SecondOrderDenseOutput methods.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((second_order_dense_output.cc))
+
+
+******************************************************************************/
+
+
+// Local includes
+#include "../include/second_order_dense_output.hh"
+#include "../include/dense_output_interpolator.hh"
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+
+// System includes
+#include <cstddef>
+
+
+//! Namespace jeod
+namespace jeod {
+
+// SecondOrderDenseOutput default constructor.
+SecondOrderDenseOutput::SecondOrderDenseOutput ()
+:
+   size(0),
+   start_valid(false),
+   interval_valid(false),
+   start_time(0.0),
+   end_time(0.0),
+   start_accel(nullptr),
+   start_velocity(nullptr),
+   start_position(nullptr),
+   end_velocity(nullptr),
+   end_position(nullptr)
+{ }
+
+
+// SecondOrderDenseOutput destructor.
+SecondOrderDenseOutput::~SecondOrderDenseOutput ()
+{
+   release ();
+}
+
+
+/**
+ * Size the recorded state. Any previously recorded data are discarded.
+ * @param[in] size_in  Number of elements in the generalized position.
+ */
+void
+SecondOrderDenseOutput::configure (
+   unsigned int size_in)
+{
+   if (size_in != size) {
+      release ();
+      if (size_in > 0) {
+         start_accel    = JEOD_ALLOC_PRIM_ARRAY (size_in, double);
+         start_velocity = JEOD_ALLOC_PRIM_ARRAY (size_in, double);
+         start_position = JEOD_ALLOC_PRIM_ARRAY (size_in, double);
+         end_velocity   = JEOD_ALLOC_PRIM_ARRAY (size_in, double);
+         end_position   = JEOD_ALLOC_PRIM_ARRAY (size_in, double);
+      }
+      size = size_in;
+   }
+   reset ();
+}
+
+
+/**
+ * Discard the recorded data.
+ */
+void
+SecondOrderDenseOutput::reset ()
+{
+   start_valid = false;
+   interval_valid = false;
+}
+
+
+/**
+ * Record the state at the start of a step.
+ * The acceleration must be the derivative evaluated at the recorded state.
+ * @param[in] time      Dynamic time at the start of the step.
+ * @param[in] accel     Generalized acceleration.
+ * @param[in] velocity  Generalized velocity.
+ * @param[in] position  Generalized position.
+ */
+void
+SecondOrderDenseOutput::begin_step (
+   double time,
+   double const * accel,
+   double const * velocity,
+   double const * position)
+{
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      start_accel[ii] = accel[ii];
+      start_velocity[ii] = velocity[ii];
+      start_position[ii] = position[ii];
+   }
+   start_time = time;
+   start_valid = true;
+   interval_valid = false;
+}
+
+
+/**
+ * Record the state at the end of the step begun by begin_step.
+ * This may be called more than once per step (e.g., after each corrector
+ * pass of a predictor-corrector technique); the last call wins.
+ * @param[in] time      Dynamic time at the end of the step.
+ * @param[in] velocity  Generalized velocity.
+ * @param[in] position  Generalized position.
+ */
+void
+SecondOrderDenseOutput::end_step (
+   double time,
+   double const * velocity,
+   double const * position)
+{
+   if ((! start_valid) || (! (time > start_time))) {
+      interval_valid = false;
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      end_velocity[ii] = velocity[ii];
+      end_position[ii] = position[ii];
+   }
+   end_time = time;
+   interval_valid = true;
+}
+
+
+/**
+ * Interpolate the state within the recorded step.
+ * @param[in]  time          Dynamic time of interest; must lie within the
+ *                           recorded step.
+ * @param[in]  interpolator  The state integrator's natural interpolant,
+ *                           or null if the integrator provides none.
+ * @param[out] velocity      Interpolated generalized velocity.
+ * @param[out] position      Interpolated generalized position.
+ * @return True if the interpolation was performed, false if no step is
+ *         recorded or if the time is outside of the recorded step.
+ */
+bool
+SecondOrderDenseOutput::interpolate (
+   double time,
+   const DenseOutputInterpolator * interpolator,
+   double * velocity,
+   double * position)
+const
+{
+   if ((! interval_valid) || (time < start_time) || (time > end_time)) {
+      return false;
+   }
+
+   double dt = end_time - start_time;
+
+   // Use the integrator's own continuous extension when it has one.
+   if ((interpolator != nullptr) &&
+       interpolator->interpolate_second_order (
+          dt, time - end_time, end_velocity, end_position,
+          velocity, position)) {
+      return true;
+   }
+
+   // Otherwise use the quartic Hermite polynomial in s = (t-t0)/dt that
+   // matches x0, v0, a0 at s=0 and x1, v1 at s=1:
+   //   x(s) = x0 + s*V0 + s^2/2*A0 + c3*s^3 + c4*s^4
+   // with V = dt*v, A = dt^2*a, c3 = 4D-E, c4 = E-3D, where
+   //   D = x1 - x0 - V0 - A0/2 and E = V1 - V0 - A0.
+   double s = (time - start_time) / dt;
+   double s2 = s * s;
+   double s3 = s2 * s;
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      double vel0 = dt * start_velocity[ii];
+      double acc0 = dt * dt * start_accel[ii];
+      double dpos = end_position[ii] - start_position[ii] - vel0 - 0.5*acc0;
+      double dvel = dt * end_velocity[ii] - vel0 - acc0;
+      double c4 = dvel - 3.0*dpos;
+      double c3 = dpos - c4;
+
+      position[ii] = start_position[ii] +
+                     s * (vel0 + s * (0.5*acc0 + s * (c3 + s * c4)));
+      velocity[ii] = (vel0 + s * acc0 + 3.0*c3*s2 + 4.0*c4*s3) / dt;
+   }
+
+   return true;
+}
+
+
+// Release the recorded state arrays.
+void
+SecondOrderDenseOutput::release ()
+{
+   if (start_accel != nullptr) {
+      JEOD_DELETE_ARRAY (start_accel);
+      JEOD_DELETE_ARRAY (start_velocity);
+      JEOD_DELETE_ARRAY (start_position);
+      JEOD_DELETE_ARRAY (end_velocity);
+      JEOD_DELETE_ARRAY (end_position);
+      start_accel = nullptr;
+      start_velocity = nullptr;
+      start_position = nullptr;
+      end_velocity = nullptr;
+      end_position = nullptr;
+   }
+   size = 0;
+   start_valid = false;
+   interval_valid = false;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,171 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/src/timestamp_cache.cc
+ * Define TimestampCache methods.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((timestamp_cache.cc)
+   (jeod_integration_time.cc))
+
+
+******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/numerical.hh"
+
+// Local includes
+#include "../include/jeod_integration_time.hh"
+#include "../include/timestamp_cache.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * TimestampCache constructor.
+ */
+TimestampCache::TimestampCache ()
+:
+   TimeChangeSubscriber (),
+   enabled (true),
+   hit_count (0),
+   miss_count (0),
+   timestamp (0.0),
+   valid (false),
+   time_source (nullptr)
+{
+   ; // Empty
+}
+
+
+/**
+ * TimestampCache destructor.
+ */
+TimestampCache::~TimestampCache ()
+{
+   unsubscribe ();
+}
+
+
+/**
+ * Invalidate the cache whenever the nature of the given time changes.
+ * A cache subscribed to some other time is first unsubscribed from it.
+ * \param[in,out] source  Time whose changes are to invalidate the cache.
+ */
+void
+TimestampCache::subscribe (
+   JeodIntegrationTime & source)
+{
+   if (time_source == &source) {
+      return;
+   }
+
+   unsubscribe ();
+   source.add_time_change_subscriber (*this);
+   time_source = &source;
+}
+
+
+/**
+ * Stop responding to changes in the nature of time.
+ */
+void
+TimestampCache::unsubscribe ()
+{
+   if (time_source != nullptr) {
+      time_source->remove_time_change_subscriber (*this);
+      time_source = nullptr;
+   }
+}
+
+
+/**
+ * Check whether the cached outputs must be recomputed at the given time.
+ * If so, the cache is stamped with the time: the caller is expected to
+ * recompute the outputs.
+ * @return True if the outputs must be recomputed
+ * \param[in] time  Time at which the outputs are wanted.\n Units: s
+ */
+bool
+TimestampCache::needs_update (
+   double time)
+{
+   if (is_current (time)) {
+      ++hit_count;
+      return false;
+   }
+
+   ++miss_count;
+   stamp (time);
+   return true;
+}
+
+
+/**
+ * Check whether the cached outputs are those computed at the given time.
+ * @return True if enabled, valid, and stamped with the time
+ * \param[in] time  Time at which the outputs are wanted.\n Units: s
+ */
+bool
+TimestampCache::is_current (
+   double time)
+const
+{
+   return enabled && valid && Numerical::compare_exact (timestamp, time);
+}
+
+
+/**
+ * Mark the cached outputs as computed at the given time.
+ * \param[in] time  Time at which the outputs were computed.\n Units: s
+ */
+void
+TimestampCache::stamp (
+   double time)
+{
+   timestamp = time;
+   valid = true;
+}
+
+
+/**
+ * Mark the cached outputs as stale. The timestamp is retained.
+ */
+void
+TimestampCache::invalidate ()
+{
+   valid = false;
+}
+
+
+/**
+ * Respond to a change in the nature of time by invalidating the cache.
+ */
+void
+TimestampCache::respond_to_time_change ()
+{
+   invalidate ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
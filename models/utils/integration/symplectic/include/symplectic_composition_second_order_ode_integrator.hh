@@ -0,0 +1,232 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Symplectic
+ * @{
+ *
+ * @file models/utils/integration/symplectic/include/symplectic_composition_second_order_ode_integrator.hh
+ * Defines the class SymplecticCompositionSecondOrderODEIntegrator,
+ * which integrates a simple second order ODE using a symmetric composition
+ * of velocity Verlet steps.
+ */
+
+
+/*
+Purpose: ()
+Library dependencies:
+  ((../src/symplectic_composition_second_order_ode_integrator.cc))
+*/
+
+
+#ifndef JEOD_SYMPLECTIC_COMPOSITION_SECOND_ORDER_ODE_INTEGRATOR_HH
+#define JEOD_SYMPLECTIC_COMPOSITION_SECOND_ORDER_ODE_INTEGRATOR_HH
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// ER7 utilities includes
+#include "er7_utils/integration/core/include/second_order_ode_integrator.hh"
+#include "er7_utils/interface/include/alloc.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Integrates a simple second order ODE using a symmetric composition of
+ * velocity Verlet (kick-drift-kick) steps. Order two is velocity Verlet
+ * itself; orders four, six, and eight use Yoshida's compositions of three,
+ * seven, and fifteen Verlet sub-steps.
+ *
+ * The method is symplectic and time-reversible when the acceleration depends
+ * on position only, so the energy error of a conservative system stays
+ * bounded rather than drifting. Adjacent half kicks are merged, so each step
+ * takes one stage per sub-step plus a final kick, and each intermediate stage
+ * asks for the acceleration at the time to which the position has drifted.
+ * Those times lie outside the step for the higher orders. The velocity at an
+ * intermediate stage is a half-kicked velocity, which velocity-dependent
+ * accelerations should not rely upon.
+ *
+ * The integrator carries no state from one step to the next and needs no
+ * reset when the step size changes.
+ */
+class SymplecticCompositionSecondOrderODEIntegrator :
+   public er7_utils::SecondOrderODEIntegrator {
+JEOD_MAKE_SIM_INTERFACES(SymplecticCompositionSecondOrderODEIntegrator)
+
+public:
+
+   // Static member functions.
+
+   // Get the composition weights for an order.
+   static const double * get_weights (
+      unsigned int order_in,
+      unsigned int & num_weights);
+
+
+   // Constructors, destructor, and assignment operator.
+
+   /**
+    * Default constructor.
+    */
+   SymplecticCompositionSecondOrderODEIntegrator ()
+   :
+      er7_utils::Er7UtilsDeletable (),
+      er7_utils::SecondOrderODEIntegrator (),
+      order (2),
+      size (0)
+   {}
+
+
+   /**
+    * Non-default constructor. This is the constructor invoked by the
+    * SymplecticIntegratorConstructor.
+    * @param  order_in  Order of the composition, 2, 4, 6, or 8.
+    * @param  size_in   State size.
+    * @param  controls  The integration controls that drive this integrator.
+    */
+   SymplecticCompositionSecondOrderODEIntegrator (
+      unsigned int order_in,
+      unsigned int size_in,
+      er7_utils::IntegrationControls & controls)
+   :
+      er7_utils::Er7UtilsDeletable (),
+      er7_utils::SecondOrderODEIntegrator (size_in, controls),
+      order (order_in),
+      size (size_in)
+   {}
+
+
+   /**
+    * Copy constructor.
+    * @param  src  Item to be copied.
+    */
+   SymplecticCompositionSecondOrderODEIntegrator (
+      const SymplecticCompositionSecondOrderODEIntegrator & src)
+   :
+      er7_utils::Er7UtilsDeletable (),
+      er7_utils::SecondOrderODEIntegrator (src),
+      order (src.order),
+      size (src.size)
+   {}
+
+
+   /**
+    * Destructor.
+    */
+   ~SymplecticCompositionSecondOrderODEIntegrator () override
+   {}
+
+
+   /**
+    * Copy and swap assignment operator.
+    * @param  src  Item to be copied.
+    */
+   SymplecticCompositionSecondOrderODEIntegrator & operator= (
+      SymplecticCompositionSecondOrderODEIntegrator src)
+   {
+      swap (src);
+      return *this;
+   }
+
+
+   /**
+    * Non-throwing swap.
+    * @param  other  Item whose contents are to be swapped with this.
+    */
+   void swap (
+      SymplecticCompositionSecondOrderODEIntegrator & other)
+   {
+      SecondOrderODEIntegrator::swap (other);
+      std::swap (order, other.order);
+      std::swap (size, other.size);
+   }
+
+
+   /**
+    * Replicate this.
+    * @return Replicate of this.
+    */
+   er7_utils::SecondOrderODEIntegrator* create_copy() const override
+   {
+      return er7_utils::alloc::replicate_object (*this);
+   }
+
+
+   // Propagate state over one stage of the composition.
+   er7_utils::IntegratorResult integrate (
+      double dyn_dt,
+      unsigned int target_stage,
+      double const * ER7_UTILS_RESTRICT acc,
+      double * ER7_UTILS_RESTRICT vel,
+      double * ER7_UTILS_RESTRICT pos) override;
+
+private:
+
+   using SecondOrderODEIntegrator::swap;
+
+
+   // Member data
+
+   /**
+    * Order of the composition.
+    */
+   unsigned int order; //!< trick_units(--)
+
+   /**
+    * State size.
+    */
+   unsigned int size; //!< trick_units(--)
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
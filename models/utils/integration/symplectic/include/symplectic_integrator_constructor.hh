@@ -0,0 +1,249 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Symplectic
+ * @{
+ *
+ * @file models/utils/integration/symplectic/include/symplectic_integrator_constructor.hh
+ * Defines the class SymplecticIntegratorConstructor, which constructs
+ * integrators that use symmetric compositions of velocity Verlet steps.
+ */
+
+
+/*
+Purpose: ()
+Library dependencies:
+  ((../src/symplectic_integrator_constructor.cc))
+*/
+
+
+#ifndef JEOD_SYMPLECTIC_INTEGRATOR_CONSTRUCTOR_HH
+#define JEOD_SYMPLECTIC_INTEGRATOR_CONSTRUCTOR_HH
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// er7 utils integration includes
+#include "er7_utils/integration/core/include/integrator_constructor.hh"
+
+// System includes
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Create state integrators that propagate using a symplectic composition
+ * of velocity Verlet steps (see SymplecticCompositionSecondOrderODEIntegrator)
+ * for long-duration propagation of conservative systems.
+ *
+ * Only simple second order ODEs are supported. Bodies integrated with this
+ * technique must be three degree of freedom bodies (DynBody::three_dof), and
+ * integration groups that use it must not contain first order states.
+ */
+class SymplecticIntegratorConstructor :
+   public er7_utils::IntegratorConstructor {
+JEOD_MAKE_SIM_INTERFACES(SymplecticIntegratorConstructor)
+
+public:
+
+
+   // Static member functions.
+
+   /**
+    * Named constructor; create a SymplecticIntegratorConstructor instance.
+    * The caller is responsible for deleting the returned object.
+    * @return Newly created SymplecticIntegratorConstructor instance.
+    */
+   static er7_utils::IntegratorConstructor* create_constructor (void);
+
+
+   // Constructors, destructor, and assignment operator.
+
+   /**
+    * SymplecticIntegratorConstructor default constructor.
+    */
+   SymplecticIntegratorConstructor (void);
+
+   /**
+    * SymplecticIntegratorConstructor copy constructor.
+    */
+   SymplecticIntegratorConstructor (
+      const SymplecticIntegratorConstructor & src);
+
+   /**
+    * SymplecticIntegratorConstructor destructor.
+    */
+   ~SymplecticIntegratorConstructor () override;
+
+   /**
+    * SymplecticIntegratorConstructor assignment operator.
+    */
+   SymplecticIntegratorConstructor & operator= (
+      SymplecticIntegratorConstructor src)
+   {
+      swap (src);
+      return *this;
+   }
+
+
+   // Member functions.
+
+   /**
+    * Configure the symplectic integrator constructor.
+    */
+   void configure (unsigned int order_in);
+
+   /**
+    * Return the class name.
+    */
+   const char * get_class_name (void) const override
+   { return "SymplecticIntegratorConstructor"; }
+
+   /**
+    * The composition is implemented for simple second order ODEs only.
+    */
+   bool implements (
+      er7_utils::Integration::ODEProblemType problem_type)
+   const override
+   {
+      return (problem_type == er7_utils::Integration::SimpleSecondOrderODE);
+   }
+
+   /**
+    * The composition is provided for simple second order ODEs only.
+    */
+   bool provides (
+      er7_utils::Integration::ODEProblemType problem_type)
+   const override
+   {
+      return (problem_type == er7_utils::Integration::SimpleSecondOrderODE);
+   }
+
+   /**
+    * Non-throwing swap.
+    * @param[in,out] src  Object with which contents are to be swapped.
+    */
+   virtual void swap (SymplecticIntegratorConstructor & src);
+
+   /**
+    * Create a duplicate of the constructor.
+    * The caller is responsible for deleting the returned object.
+    * @return Duplicated constructor.
+    */
+   er7_utils::IntegratorConstructor * create_copy (void) const override;
+
+   /**
+    * Create an integration controls that guides the integration process,
+    * one stage per sub-step of the composition plus a final stage.
+    * The caller is responsible for deleting the created object.
+    * @return Integration controls object
+    */
+   er7_utils::IntegrationControls *
+   create_integration_controls (void) const override;
+
+   /**
+    * First order ODEs are not supported; calling this is an error.
+    * @return Null
+    * @param[in]     size      State size
+    * @param[in,out] controls  Integration controls
+    */
+   er7_utils::FirstOrderODEIntegrator *
+   create_first_order_ode_integrator (
+      unsigned int size,
+      er7_utils::IntegrationControls & controls) const override;
+
+   /**
+    * Create a symplectic state integrator for a simple second order ODE.
+    * The caller is responsible for deleting the created object.
+    * @return State integrator
+    * @param[in]     size      State size
+    * @param[in,out] controls  Integration controls
+    */
+   er7_utils::SecondOrderODEIntegrator *
+   create_second_order_ode_integrator (
+      unsigned int size,
+      er7_utils::IntegrationControls & controls) const override;
+
+   /**
+    * The composition uses one step per stage.
+    * @return Number of stages.
+    */
+   unsigned int get_buffer_size (void) const override
+   { return get_number_stages(); }
+
+   /**
+    * The composition uses one step per stage.
+    * @return Number of stages.
+    */
+   unsigned int get_transition_table_size (void) const override
+   { return get_number_stages(); }
+
+private:
+
+   // Number of stages per integration cycle.
+   unsigned int get_number_stages (void) const;
+
+   /**
+    * Order of the composition: 2 (velocity Verlet), 4, 6, or 8.
+    */
+   unsigned int order; //!< trick_units(--)
+
+};
+
+} // End JEOD namespace
+
+
+#ifdef TRICK_ICG
+#include "symplectic_composition_second_order_ode_integrator.hh"
+#endif
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
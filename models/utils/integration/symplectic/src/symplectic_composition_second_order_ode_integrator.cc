@@ -0,0 +1,196 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Symplectic
+ * @{
+ *
+ * @file models/utils/integration/symplectic/src/symplectic_composition_second_order_ode_integrator.cc
+ * Defines member functions for the class
+ * SymplecticCompositionSecondOrderODEIntegrator.
+ */
+
+
+/*
+Purpose: ()
+*/
+
+
+// Local includes
+#include "../include/symplectic_composition_second_order_ode_integrator.hh"
+
+// System includes
+#include <cstddef>
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Velocity Verlet: a single sub-step.
+ */
+const double order2_weights[1] = {
+   1.0
+};
+
+/**
+ * Yoshida's fourth order composition, w1 = 1/(2-2^(1/3)) and
+ * w0 = 1-2*w1.
+ */
+const double order4_weights[3] = {
+    1.35120719195965763405,
+   -1.70241438391931526810,
+    1.35120719195965763405
+};
+
+/**
+ * Yoshida's sixth order composition (solution A).
+ */
+const double order6_weights[7] = {
+    0.784513610477560,
+    0.235573213359357,
+   -1.17767998417887,
+    1.31518632068391,
+   -1.17767998417887,
+    0.235573213359357,
+    0.784513610477560
+};
+
+/**
+ * Yoshida's eighth order composition (solution D).
+ */
+const double order8_weights[15] = {
+    0.914844246229740,
+    0.253693336566229,
+   -1.44485223686048,
+   -0.158240635368243,
+    1.93813913762276,
+   -1.96061023297549,
+    0.102799849391985,
+    1.70845307078700,
+    0.102799849391985,
+   -1.96061023297549,
+    1.93813913762276,
+   -0.158240635368243,
+   -1.44485223686048,
+    0.253693336566229,
+    0.914844246229740
+};
+
+}
+
+
+/**
+ * Get the composition weights for an order. The weights are the sub-step
+ * sizes in units of the full step and sum to one.
+ * @param[in]  order_in     Order of the composition.
+ * @param[out] num_weights  Number of weights (sub-steps), zero if the
+ *                          order is not supported.
+ * @return Weights, null if the order is not supported.
+ */
+const double *
+SymplecticCompositionSecondOrderODEIntegrator::get_weights (
+   unsigned int order_in,
+   unsigned int & num_weights)
+{
+   switch (order_in) {
+   case 2:
+      num_weights = 1;
+      return order2_weights;
+
+   case 4:
+      num_weights = 3;
+      return order4_weights;
+
+   case 6:
+      num_weights = 7;
+      return order6_weights;
+
+   case 8:
+      num_weights = 15;
+      return order8_weights;
+
+   default:
+      num_weights = 0;
+      return nullptr;
+   }
+}
+
+
+/**
+ * Propagate state over one stage of the composition.
+ * Stage k of n sub-steps kicks the velocity by the merged half kicks of
+ * sub-steps k-1 and k and then drifts the position over sub-step k. Stage
+ * n+1 applies the final half kick.
+ * @param[in]     dyn_dt        Dynamic time step, in dynamic time seconds.
+ * @param[in]     target_stage  The stage of the integration process
+ *                              that the integrator should try to attain.
+ * @param[in]     acc           Acceleration vector.
+ * @param[in,out] vel           Velocity vector.
+ * @param[in,out] pos           Position vector.
+ *
+ * @return The status (time advance, pass/fail status) of the integration.
+ */
+er7_utils::IntegratorResult
+SymplecticCompositionSecondOrderODEIntegrator::integrate (
+   double dyn_dt,
+   unsigned int target_stage,
+   double const * ER7_UTILS_RESTRICT acc,
+   double * ER7_UTILS_RESTRICT vel,
+   double * ER7_UTILS_RESTRICT pos)
+{
+   er7_utils::IntegratorResult result;
+   unsigned int num_weights;
+   const double * weights = get_weights (order, num_weights);
+   unsigned int isub = target_stage - 1;
+
+   // Kick: merged half kicks of the previous and current sub-steps.
+   double kick;
+   if (isub == 0) {
+      kick = 0.5 * weights[0];
+   }
+   else if (isub < num_weights) {
+      kick = 0.5 * (weights[isub-1] + weights[isub]);
+   }
+   else {
+      kick = 0.5 * weights[num_weights-1];
+   }
+   kick *= dyn_dt;
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      vel[ii] += kick * acc[ii];
+   }
+
+   // Final stage: The state is at the end of the step.
+   if (isub >= num_weights) {
+      result.set_time_scale (1.0);
+      return result;
+   }
+
+   // Drift over the current sub-step, to the time at which the next
+   // acceleration is evaluated.
+   double drift = weights[isub] * dyn_dt;
+   for (unsigned int ii = 0; ii < size; ++ii) {
+      pos[ii] += drift * vel[ii];
+   }
+
+   double time_scale = 0.0;
+   for (unsigned int jj = 0; jj <= isub; ++jj) {
+      time_scale += weights[jj];
+   }
+   result.set_time_scale (time_scale);
+   return result;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,176 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ * @addtogroup Symplectic
+ * @{
+ *
+ * @file models/utils/integration/symplectic/src/symplectic_integrator_constructor.cc
+ * Defines member functions for the class SymplecticIntegratorConstructor.
+ */
+
+
+/*
+Purpose: ()
+*/
+
+
+// Model includes
+#include "../include/symplectic_integrator_constructor.hh"
+#include "../include/symplectic_composition_second_order_ode_integrator.hh"
+
+// Integration includes
+#include "er7_utils/integration/core/include/integration_messages.hh"
+#include "er7_utils/integration/core/include/standard_integration_controls.hh"
+
+// Interface includes
+#include "er7_utils/interface/include/alloc.hh"
+#include "er7_utils/interface/include/message_handler.hh"
+
+// System includes
+#include <algorithm>
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Named constructor; create a SymplecticIntegratorConstructor.
+er7_utils::IntegratorConstructor*
+SymplecticIntegratorConstructor::create_constructor ()
+{
+   return er7_utils::alloc::allocate_object<
+             SymplecticIntegratorConstructor> ();
+}
+
+
+// Default constructor.
+SymplecticIntegratorConstructor::SymplecticIntegratorConstructor ()
+:
+   er7_utils::Er7UtilsDeletable (),
+   er7_utils::IntegratorConstructor (),
+   order (4)
+{
+}
+
+
+// Copy constructor.
+SymplecticIntegratorConstructor::SymplecticIntegratorConstructor (
+   const SymplecticIntegratorConstructor & src)
+:
+   er7_utils::Er7UtilsDeletable (),
+   er7_utils::IntegratorConstructor (src),
+   order (src.order)
+{
+}
+
+
+// Destructor.
+SymplecticIntegratorConstructor::~SymplecticIntegratorConstructor ()
+{
+}
+
+
+// Non-throwing swap.
+void
+SymplecticIntegratorConstructor::swap (
+   SymplecticIntegratorConstructor & src)
+{
+   std::swap (order, src.order);
+}
+
+
+// Configure.
+void
+SymplecticIntegratorConstructor::configure (
+   unsigned int order_in)
+{
+   unsigned int num_weights;
+   SymplecticCompositionSecondOrderODEIntegrator::get_weights (
+      order_in, num_weights);
+   if (num_weights == 0) {
+      er7_utils::MessageHandler::fail (
+         __FILE__, __LINE__,
+         er7_utils::IntegrationMessages::invalid_request,
+         "Unsupported symplectic composition order %u; "
+         "the order must be 2, 4, 6, or 8.",
+         order_in);
+   }
+   order = order_in;
+}
+
+
+// Number of stages per integration cycle.
+unsigned int
+SymplecticIntegratorConstructor::get_number_stages ()
+const
+{
+   unsigned int num_weights;
+   SymplecticCompositionSecondOrderODEIntegrator::get_weights (
+      order, num_weights);
+   return num_weights + 1;
+}
+
+
+// Create a duplicate of the constructor.
+er7_utils::IntegratorConstructor *
+SymplecticIntegratorConstructor::create_copy ()
+const
+{
+   return er7_utils::alloc::replicate_object (*this);
+}
+
+
+// Create the integration controls.
+er7_utils::IntegrationControls *
+SymplecticIntegratorConstructor::create_integration_controls ()
+const
+{
+   return er7_utils::alloc::allocate_object<
+                er7_utils::StandardIntegrationControls,
+                unsigned int> (
+             get_number_stages());
+}
+
+
+// First order ODEs are not supported.
+er7_utils::FirstOrderODEIntegrator *
+SymplecticIntegratorConstructor::create_first_order_ode_integrator (
+   unsigned int,
+   er7_utils::IntegrationControls &)
+const
+{
+   er7_utils::MessageHandler::fail (
+      __FILE__, __LINE__,
+      er7_utils::IntegrationMessages::invalid_request,
+      "The symplectic integrators do not support first order ODEs.");
+   return nullptr;
+}
+
+
+// Create a symplectic state integrator for a second order ODE.
+er7_utils::SecondOrderODEIntegrator *
+SymplecticIntegratorConstructor::create_second_order_ode_integrator (
+   unsigned int size,
+   er7_utils::IntegrationControls & controls)
+const
+{
+   return er7_utils::alloc::allocate_object<
+                SymplecticCompositionSecondOrderODEIntegrator,
+                unsigned int,
+                unsigned int,
+                er7_utils::IntegrationControls &> (
+             order, size, controls);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
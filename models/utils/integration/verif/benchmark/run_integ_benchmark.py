@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""
+Runs an integration test simulation once per integrator and tabulates the
+accuracy / cost trade-off.
+
+The simulation is any Trick SIM whose S_define instantiates the
+IntegrationTestManager from models/utils/integration/verif. For each
+integrator a small input file is generated that executes the base input
+file, selects the integrator, and points the manager's benchmark_file at a
+common CSV file. The manager appends one record per test item at shutdown
+(derivative evaluations, wall time, final and maximum error); this script
+then prints a table of those records.
+
+Usage:
+  run_integ_benchmark.py [options] <S_main> <base_input.py>
+
+Example:
+  run_integ_benchmark.py -m integ_test.manager -o bench.csv \\
+     ./S_main_Linux_x86_64.exe SET_test/RUN_orbit/input.py
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+import tempfile
+
+
+# Integrators exercised by default: (label, input file assignments).
+# Options 122-134 select Gauss-Jackson of order (option - 120) and option
+# 140 selects LSODE with default tolerances; the Runge-Kutta integrators are
+# selected through the ER7 integration option.
+INTEGRATORS = [
+   ("RK4", ["{m}.integ_option = trick.Integration.RungeKutta4",
+            "{m}.integ_option_int = 0"]),
+   ("RKF45", ["{m}.integ_option = trick.Integration.RKFehlberg45",
+              "{m}.integ_option_int = 0"]),
+   ("RKF78", ["{m}.integ_option = trick.Integration.RKFehlberg78",
+              "{m}.integ_option_int = 0"]),
+   ("ABM4", ["{m}.integ_option = trick.Integration.ABM4",
+             "{m}.integ_option_int = 0"]),
+   ("GJ8", ["{m}.integ_option_int = 128"]),
+   ("GJ12", ["{m}.integ_option_int = 132"]),
+   ("LSODE", ["{m}.integ_option_int = 140"]),
+]
+
+
+def write_input (path, base_input, manager, label, assignments, bench_file):
+   """Write the input file for one integrator case."""
+   with open (path, "w") as out:
+      out.write ("exec(open('{0}').read())\n".format (base_input))
+      for line in assignments:
+         out.write (line.format (m=manager) + "\n")
+      out.write ("{0}.benchmark_file = '{1}'\n".format (manager, bench_file))
+      out.write ("{0}.benchmark_label = '{1}'\n".format (manager, label))
+
+
+def print_table (bench_file):
+   """Print the benchmark records as a table."""
+   with open (bench_file) as inp:
+      rows = list (csv.DictReader (inp))
+   fmt = "{0:<10} {1:<28} {2:>10} {3:>10} {4:>12} {5:>12}"
+   print (fmt.format ("integrator", "test item", "derivs", "wall (s)",
+                      "final err", "max err"))
+   for row in rows:
+      print (fmt.format (row["integrator"], row["test_item"][-28:],
+                         row["derivative_evals"],
+                         "{0:.4g}".format (float (row["wall_time"])),
+                         "{0:.3e}".format (float (row["final_error"])),
+                         "{0:.3e}".format (float (row["max_error"]))))
+
+
+def main ():
+   parser = argparse.ArgumentParser (
+      description="Benchmark integrators on an integration test SIM.")
+   parser.add_argument ("sim", help="SIM executable (S_main)")
+   parser.add_argument ("base_input", help="Base input file for the run")
+   parser.add_argument ("-m", "--manager", default="integ_test.manager",
+                        help="Input file name of the IntegrationTestManager")
+   parser.add_argument ("-o", "--output", default="integ_benchmark.csv",
+                        help="CSV file receiving the benchmark records")
+   parser.add_argument ("-i", "--integrators", default=None,
+                        help="Comma-separated subset of integrator labels")
+   args = parser.parse_args ()
+
+   cases = INTEGRATORS
+   if args.integrators:
+      wanted = args.integrators.split (",")
+      cases = [case for case in INTEGRATORS if case[0] in wanted]
+      if not cases:
+         sys.exit ("No known integrators in '{0}'".format (args.integrators))
+
+   bench_file = os.path.abspath (args.output)
+   base_input = os.path.abspath (args.base_input)
+   if os.path.exists (bench_file):
+      os.remove (bench_file)
+
+   input_dir = tempfile.mkdtemp (prefix="integ_bench_")
+   for label, assignments in cases:
+      input_file = os.path.join (input_dir, "input_{0}.py".format (label))
+      write_input (input_file, base_input, args.manager, label, assignments,
+                   bench_file)
+      status = subprocess.call ([args.sim, input_file],
+                                stdout=subprocess.DEVNULL)
+      if status != 0:
+         print ("{0}: simulation exited with status {1}".format (label, status),
+                file=sys.stderr)
+
+   if os.path.exists (bench_file):
+      print_table (bench_file)
+   else:
+      sys.exit ("No benchmark records were written to " + bench_file)
+
+
+if __name__ == "__main__":
+   main ()
@@ -180,6 +180,20 @@ public:
    // class on entry to shutdown.
    virtual void shutdown (double sim_time, double dyn_time, FILE * report);
 
+   /**
+     Report the final and the maximum state error, for benchmark records.
+     The default reports zero; derived classes report their primary error
+     measure.
+     \param[out] final_error Error at the last propagation
+     \param[out] max_error   Maximum error over the run
+   */
+   virtual void get_state_errors (double & final_error, double & max_error)
+   const
+   {
+      final_error = 0.0;
+      max_error = 0.0;
+   }
+
 
    // Pure virtual methods
 
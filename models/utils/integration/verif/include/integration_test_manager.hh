@@ -121,6 +121,9 @@ public:
    // Generate reports.
    void shutdown (double sim_time, double dyn_time);
 
+   // Append benchmark records to the benchmark file.
+   void write_benchmark (double sim_time, double dyn_time);
+
 
    // Setters for the template_items and integrator constructor
 
@@ -164,6 +167,18 @@ public:
    bool debug; /* trick_units(--) @n
       Print integration status. */
 
+   std::string benchmark_file; /* trick_units(--) @n
+      When not empty, a benchmark record per test item (integrator label,
+      derivative evaluations, wall time, final and maximum errors) is
+      appended to this CSV file at shutdown. */
+
+   std::string benchmark_label; /* trick_units(--) @n
+      Integrator label written to the benchmark records. Defaults to the
+      integrator constructor type and integ_option_int. */
+
+   unsigned long deriv_count; /* trick_io(*o) trick_units(count) @n
+      Number of derivative evaluation passes over the test items. */
+
    bool regression_test; /* trick_units(--) @n
       When set, orientations are not random and num_tests is forced to be 1. */
 
@@ -223,6 +238,9 @@ protected:
    bool initialized; /* trick_units(--) @n
       Set when initialization is complete. */
 
+   double wall_start; /* trick_io(**) @n
+      Monotonic wall clock time at the end of initialization, in seconds. */
+
   er7_utils::IntegratorConstructor * integ_constructor; /* trick_units(--) @n
       Integrator generator; typically created based on the integration
       option in the Trick integrator structure. */
@@ -297,6 +297,18 @@ public:
    // Generate shutdown report.
    void shutdown (double sim_time, double dyn_time, FILE * report) override;
 
+   /**
+     Report the orientation error angle, in radians.
+     \param[out] final_error Final abs(orient_error(theta))
+     \param[out] max_error   max_angle_error
+   */
+   void get_state_errors (double & final_error, double & max_error)
+   const override
+   {
+      final_error = std::fabs (orient_error.theta());
+      max_error = max_angle_error;
+   }
+
    /**
     * Compute the integrated and true potential energy.
     * The default implementation is that there is no potential.
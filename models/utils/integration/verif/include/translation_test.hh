@@ -261,6 +261,18 @@ public:
    // Generate shutdown report.
    void shutdown (double sim_time, double dyn_time, FILE * report) override;
 
+   /**
+     Report the scaled position error.
+     \param[out] final_error Final rel_position_err_mag
+     \param[out] max_error   max_position_error
+   */
+   void get_state_errors (double & final_error, double & max_error)
+   const override
+   {
+      final_error = rel_position_err_mag;
+      max_error = max_position_error;
+   }
+
 
    /**
     Compute the integrated and true potential energy.
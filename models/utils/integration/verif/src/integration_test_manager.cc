@@ -32,6 +32,7 @@ Library dependencies:
 #include "utils/named_item/include/named_item.hh"
 #include "utils/integration/gauss_jackson/include/gauss_jackson_integrator_constructor.hh"
 #include "utils/integration/lsode/include/lsode_integrator_constructor.hh"
+#include "utils/integration/symplectic/include/symplectic_integrator_constructor.hh"
 #include "utils/sim_interface/include/jeod_trick_integrator.hh"
 #include "utils/sim_interface/include/simulation_interface.hh"
 
@@ -40,14 +41,31 @@ Library dependencies:
 #include "er7_utils/integration/core/include/integrator_constructor_factory.hh"
 
 // System includes
+#include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <cstdio>
 #include <typeinfo>
 #include <sys/select.h>
 
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Monotonic wall clock time, in seconds.
+ */
+double
+wall_clock_seconds (
+   void)
+{
+   return std::chrono::duration<double> (
+             std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
 // Attributes used in allocations
 JEOD_DECLARE_ATTRIBUTES (TrickIntegrator)
 JEOD_DECLARE_ATTRIBUTES (IntegrationTest)
@@ -66,6 +84,9 @@ const unsigned int IntegrationTestManager::template_items_size = 6;
 IntegrationTestManager::IntegrationTestManager (void) :
    generate_report(true),
    debug(false),
+   benchmark_file(),
+   benchmark_label(),
+   deriv_count(0),
    regression_test(false),
    base_case(0),
    num_tests(1),
@@ -81,6 +102,7 @@ IntegrationTestManager::IntegrationTestManager (void) :
    time_scale(1),
    deprecated_rotation_integration(false),
    initialized(false),
+   wall_start(0.0),
    integ_constructor(nullptr),
    integ_interface(nullptr)
    // time_integrator(NULL)
@@ -247,6 +269,12 @@ IntegrationTestManager::initialize (   // Return: -- Void
 
          integ_constructor = lsode_integ_constructor.create_copy();
       }
+      else if ((integ_option_int == 152) || (integ_option_int == 154) ||
+               (integ_option_int == 156) || (integ_option_int == 158)) {
+         SymplecticIntegratorConstructor symplectic_integ_constructor;
+         symplectic_integ_constructor.configure (integ_option_int - 150);
+         integ_constructor = symplectic_integ_constructor.create_copy ();
+      }
       else {
          integ_constructor = er7_utils::IntegratorConstructorFactory::create (
                                 integ_option);
@@ -324,6 +352,8 @@ IntegrationTestManager::initialize (   // Return: -- Void
 
    // At this point the simulation should run to completion.
    initialized = true;
+   deriv_count = 0;
+   wall_start = wall_clock_seconds ();
 }
 
 
@@ -360,6 +390,7 @@ IntegrationTestManager::compute_derivatives (  // Return: -- Void
          test_items[ii]->compute_derivatives ();
       }
    }
+   ++deriv_count;
 }
 
 
@@ -470,9 +501,68 @@ IntegrationTestManager::shutdown ( // Return: -- Void
       fflush (report);
    }
 
+   // Append the benchmark records for a completed run.
+   if (initialized && (sim_time >= end_time - 1.5) &&
+       (! benchmark_file.empty())) {
+      write_benchmark (sim_time, dyn_time);
+   }
+
    // Close the report.
    if ((report_fid != 1) && (report != nullptr)) {
       fclose (report);
    }
 }
+
+
+/*
+Purpose:
+  (Append one CSV record per active test item to the benchmark file.
+   A header line is written when the file is new or empty.)
+*/
+void
+IntegrationTestManager::write_benchmark ( // Return: -- Void
+   double sim_time,                       // In:     s  Simulation time
+   double dyn_time)                       // In:     s  Dynamic time
+{
+   double wall_time = wall_clock_seconds () - wall_start;
+   std::string label = benchmark_label;
+   FILE * bench;
+
+   if (label.empty()) {
+      char option[32];
+      std::snprintf (option, sizeof(option), ":%d", integ_option_int);
+      label = NamedItem::demangle (typeid(*integ_constructor)) + option;
+   }
+
+   bench = std::fopen (benchmark_file.c_str(), "a");
+   if (bench == nullptr) {
+      MessageHandler::warn (__FILE__, __LINE__,
+                            IntegrationTestMessages::internal_error,
+                            "Unable to open benchmark file '%s'.",
+                            benchmark_file.c_str());
+      return;
+   }
+
+   std::fseek (bench, 0, SEEK_END);
+   if (std::ftell (bench) == 0) {
+      std::fprintf (bench,
+                    "integrator,test_item,sim_time,dyn_time,cycles,"
+                    "derivative_evals,wall_time,final_error,max_error\n");
+   }
+
+   for (unsigned int ii = 0; ii < total_tests; ++ii) {
+      if (test_items[ii]->get_active()) {
+         double final_error;
+         double max_error;
+         test_items[ii]->get_state_errors (final_error, max_error);
+         std::fprintf (bench, "%s,%s,%.9g,%.9g,%u,%lu,%.6g,%.9g,%.9g\n",
+                       label.c_str(),
+                       NamedItem::demangle (typeid(*test_items[ii])).c_str(),
+                       sim_time, dyn_time, cycle_count, deriv_count,
+                       wall_time, final_error, max_error);
+      }
+   }
+
+   std::fclose (bench);
+}
 } // End JEOD namespace
@@ -116,6 +116,11 @@ class LvlhFrame {
     */
    RefFrame * planet_centered_inertial; //!< trick_units(--)
 
+   /**
+    * Set once update() has computed the frame; see update_if_stale().
+    */
+   bool have_update; //!< trick_units(--)
+
  private:
 
    /**
@@ -138,6 +143,10 @@ class LvlhFrame {
    // frame, which is the planet-centered inertial.
    void update ();
 
+   // Update the LVLH frame unless it is already current with respect to
+   // the subject frame's time stamp.
+   void update_if_stale ();
+
    // Specify the defining frame's name
    void set_subject_name (const std::string & new_name);
 
@@ -150,6 +159,24 @@ class LvlhFrame {
    // Specify the reference planet whose PCI frame defines LVLH
    void set_planet (BasePlanet & new_planet);
 
+   /**
+    * Get the defining frame.
+    * @return Subject frame
+    */
+   const RefFrame * get_subject_frame () const
+   {
+      return subject_frame;
+   }
+
+   /**
+    * Get the planet-centered inertial frame that is the parent of LVLH.
+    * @return Planet-centered inertial frame
+    */
+   const RefFrame * get_planet_centered_inertial () const
+   {
+      return planet_centered_inertial;
+   }
+
  protected:
 
    // Calculate the current LVLH frame orientation based on given state.
@@ -0,0 +1,155 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup LvlhFrame
+ * @{
+ *
+ * @file models/utils/lvlh_frame/include/lvlh_frame_registry.hh
+ * Define the class LvlhFrameRegistry, which shares LVLH frames among the
+ * models that need the same subject/planet LVLH frame.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/lvlh_frame_registry.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_LVLH_FRAME_REGISTRY_HH
+#define JEOD_LVLH_FRAME_REGISTRY_HH
+
+// System includes
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/class_declarations.hh"
+#include "environment/planet/include/class_declarations.hh"
+#include "utils/ref_frames/include/class_declarations.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "lvlh_frame.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Owns one LvlhFrame per distinct subject frame / planet pair and hands that
+ * frame to every model that asks for the pair. LVLH derived states and
+ * LVLH body initializers that are given the same registry thus share one
+ * LVLH frame, which is computed once per subject time stamp.
+ *
+ * The LVLH frame depends only on the subject and the planet. The LvlhType
+ * used by relative states and initializers is a representation of states
+ * relative to that frame, so it is not part of the key.
+ */
+class LvlhFrameRegistry {
+
+ JEOD_MAKE_SIM_INTERFACES(LvlhFrameRegistry)
+
+ // Member data
+ protected:
+
+   /**
+    * The shared LVLH frames, owned by the registry.
+    */
+   std::vector<LvlhFrame *> frames; //!< trick_io(**)
+
+
+ // Methods
+ public:
+
+   // Default constructor and destructor
+   LvlhFrameRegistry ();
+   ~LvlhFrameRegistry ();
+
+   // Get the shared LVLH frame for a subject frame and planet,
+   // creating and initializing the frame on first request.
+   LvlhFrame & get_frame (
+      RefFrame & subject_frame, BasePlanet & planet,
+      DynManager & dyn_manager);
+
+   // Get the shared LVLH frame for a subject frame and named planet.
+   LvlhFrame & get_frame (
+      RefFrame & subject_frame, const std::string & planet_name,
+      DynManager & dyn_manager);
+
+   // Update all of the shared frames that are stale.
+   void update ();
+
+   /**
+    * Get the number of shared frames.
+    * @return Number of frames
+    */
+   unsigned int get_num_frames () const
+   {
+      return frames.size();
+   }
+
+
+ private:
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   LvlhFrameRegistry (const LvlhFrameRegistry&);
+   LvlhFrameRegistry & operator = (const LvlhFrameRegistry&);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -56,6 +56,7 @@ LvlhFrame::LvlhFrame (
    planet_name(""),
    subject_frame(nullptr),
    planet_centered_inertial(nullptr),
+   have_update(false),
    local_dm(nullptr)
 {
    ;
@@ -209,6 +210,25 @@ LvlhFrame::update (
 
    // Timestamp the frame per the vehicle timestamp.
    frame.set_timestamp (subject_frame->timestamp());
+   have_update = true;
+}
+
+
+/**
+ * Update the state unless the frame has already been updated at the subject
+ * frame's current time stamp. This lets several users of one LvlhFrame
+ * update it without recomputing it. Use update() when the subject state may
+ * have changed without its time stamp changing, as during initialization.
+ */
+void
+LvlhFrame::update_if_stale (
+   void)
+{
+   if (have_update && (frame.timestamp() == subject_frame->timestamp())) {
+      return;
+   }
+
+   update ();
 }
 
 
@@ -0,0 +1,155 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup LvlhFrame
+ * @{
+ *
+ * @file models/utils/lvlh_frame/src/lvlh_frame_registry.cc
+ * Define methods for the LVLH frame registry class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((lvlh_frame_registry.cc)
+   (lvlh_frame.cc)
+   (lvlh_frame_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "environment/planet/include/base_planet.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+
+// Model includes
+#include "../include/lvlh_frame_messages.hh"
+#include "../include/lvlh_frame_registry.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct an LvlhFrameRegistry object.
+ */
+LvlhFrameRegistry::LvlhFrameRegistry (
+   void)
+:
+   frames()
+{
+   ;
+}
+
+
+/**
+ * Destruct an LvlhFrameRegistry object, releasing the shared frames.
+ */
+LvlhFrameRegistry::~LvlhFrameRegistry (
+   void)
+{
+   for (std::vector<LvlhFrame *>::iterator it = frames.begin();
+        it != frames.end();
+        ++it) {
+      JEOD_DELETE_OBJECT (*it);
+   }
+}
+
+
+/**
+ * Get the shared LVLH frame for the given subject frame and planet.
+ * The first request for a pair creates and initializes the frame.
+ * @return Shared LVLH frame
+ * \param[in,out] subject_frame Frame whose motion defines LVLH
+ * \param[in,out] planet Planet whose inertial frame is the parent of LVLH
+ * \param[in,out] dyn_manager Dynamics manager
+ */
+LvlhFrame &
+LvlhFrameRegistry::get_frame (
+   RefFrame & subject_frame,
+   BasePlanet & planet,
+   DynManager & dyn_manager)
+{
+   for (std::vector<LvlhFrame *>::const_iterator it = frames.begin();
+        it != frames.end();
+        ++it) {
+      if (((*it)->get_subject_frame() == &subject_frame) &&
+          ((*it)->get_planet_centered_inertial() == &planet.inertial)) {
+         return **it;
+      }
+   }
+
+   LvlhFrame * lvlh = JEOD_ALLOC_CLASS_OBJECT (LvlhFrame, ());
+   lvlh->set_subject_frame (subject_frame);
+   lvlh->set_planet (planet);
+   lvlh->initialize (dyn_manager);
+   frames.push_back (lvlh);
+
+   return *lvlh;
+}
+
+
+/**
+ * Get the shared LVLH frame for the given subject frame and named planet.
+ * @return Shared LVLH frame
+ * \param[in,out] subject_frame Frame whose motion defines LVLH
+ * \param[in] planet_name Name of the planet
+ * \param[in,out] dyn_manager Dynamics manager
+ */
+LvlhFrame &
+LvlhFrameRegistry::get_frame (
+   RefFrame & subject_frame,
+   const std::string & planet_name,
+   DynManager & dyn_manager)
+{
+   BasePlanet * planet = dyn_manager.find_base_planet (planet_name.c_str());
+
+   if (planet == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, LvlhFrameMessages::invalid_name,
+         "Invalid planet name '%s' for LvlhFrameRegistry",
+         planet_name.c_str());
+
+      // Not reached
+   }
+
+   return get_frame (subject_frame, *planet, dyn_manager);
+}
+
+
+/**
+ * Update each shared frame that has not yet been updated at its subject
+ * frame's current time stamp.
+ */
+void
+LvlhFrameRegistry::update (
+   void)
+{
+   for (std::vector<LvlhFrame *>::const_iterator it = frames.begin();
+        it != frames.end();
+        ++it) {
+      (*it)->update_if_stale ();
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
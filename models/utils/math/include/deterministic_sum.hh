@@ -0,0 +1,197 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/include/deterministic_sum.hh
+ * Define the classes CompensatedSum and DeterministicSum, which sum
+ * floating point values in an order that does not depend on how the work
+ * that produced them was divided among threads.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/deterministic_sum.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_DETERMINISTIC_SUM_HH
+#define JEOD_DETERMINISTIC_SUM_HH
+
+// System includes
+#include <cmath>
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Accumulates a sum of doubles with Neumaier's variant of Kahan compensated
+ * summation. The rounding error of each addition is carried in a separate
+ * compensation term, so the error of the final sum does not grow with the
+ * number of terms. The result still depends on the order in which the terms
+ * are added; add them in an order fixed by the problem, not by the thread
+ * that produced them.
+ */
+class CompensatedSum {
+
+ public:
+
+   /**
+    * Default constructor; the sum is zero.
+    */
+   CompensatedSum ()
+   :
+      sum(0.0),
+      compensation(0.0)
+   { }
+
+   /**
+    * Add a term to the sum.
+    * \param[in] value Term
+    */
+   void add (double value)
+   {
+      double total = sum + value;
+      if (std::fabs (sum) >= std::fabs (value)) {
+         compensation += (sum - total) + value;
+      }
+      else {
+         compensation += (value - total) + sum;
+      }
+      sum = total;
+   }
+
+   /**
+    * Get the compensated sum.
+    * @return Sum of the terms added since construction or reset.
+    */
+   double get_sum () const
+   {
+      return sum + compensation;
+   }
+
+   /**
+    * Reset the sum to zero.
+    */
+   void reset ()
+   {
+      sum = 0.0;
+      compensation = 0.0;
+   }
+
+
+ private:
+
+   /**
+    * Uncompensated running sum.
+    */
+   double sum; //!< trick_units(--)
+
+   /**
+    * Accumulated rounding error of the running sum.
+    */
+   double compensation; //!< trick_units(--)
+};
+
+
+/**
+ * Provides static methods that reduce per-task partial results to a single
+ * result in a fixed order.
+ *
+ * A parallel computation that sums contributions should give each task, not
+ * each thread, its own partial: the partials then depend only on how the
+ * problem was divided into tasks. The methods below combine the partials in
+ * an order that depends only on the number of partials, so the result is
+ * bit-for-bit the same whatever the thread count.
+ *
+ * A partial is width doubles long, e.g. three for a force; consecutive
+ * partials are stride doubles apart, which allows for padding between them.
+ */
+class DeterministicSum {
+
+ public:
+
+   // Reduce the partials in place with a fixed pairwise tree.
+   static void pairwise_reduce (
+      unsigned int nparts,
+      unsigned int width,
+      unsigned int stride,
+      double * parts);
+
+   // Sum the partials in index order with compensated summation.
+   static void compensated_reduce (
+      unsigned int nparts,
+      unsigned int width,
+      unsigned int stride,
+      const double * parts,
+      double * result);
+
+   // Sum an array of values with a fixed pairwise tree.
+   static double pairwise_sum (
+      unsigned int num,
+      const double * values);
+
+
+ private:
+
+   /**
+    * Not implemented.
+    */
+   DeterministicSum ();
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
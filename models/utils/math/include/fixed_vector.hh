@@ -0,0 +1,1116 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/include/fixed_vector.hh
+ * Fixed-size 3-vector and 3x3 matrix value types with expression templates
+ */
+
+/*******************************************************************************
+Purpose:
+  (Value types and lazily evaluated expressions for 3-vectors and 3x3
+   matrices, interoperable with the double[3] and double[3][3] arrays used
+   by Vector3 and Matrix3x3.)
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_FIXED_VECTOR_HH
+#define JEOD_FIXED_VECTOR_HH
+
+
+//! Namespace jeod
+namespace jeod {
+
+/*******************************************************************************
+
+  Overview
+
+  Vec3 and Mat3 are value types holding a 3-vector and a 3x3 matrix.
+  Vec3Ref and Mat3Ref are writable views of existing double[3] and
+  double[3][3] arrays, and the functions vec3() and mat3() make read-only
+  views of them. Arithmetic on any of these (+, -, unary -, scalar *,
+  matrix * vector, matrix * matrix, cross, transpose) builds an expression
+  object that computes nothing until it is assigned or converted to a value.
+  Assignment then evaluates each element as one straight-line expression,
+  so a chain such as
+
+     Vec3Ref (pos) = vec3 (offset) + transpose (mat3 (T)) * vec3 (pos);
+
+  compiles to the arithmetic of Vector3::transform_transpose followed by
+  Vector3::incr, without the intermediate array. Assignment evaluates every
+  element before storing any, so the target may appear on the right-hand
+  side.
+
+  Each element is computed with the expression the corresponding Vector3
+  or Matrix3x3 method uses, so replacing a sequence of those calls with one
+  expression yields the same values.
+
+  Expression objects hold views (not copies) of their value-type operands.
+  Evaluate an expression within the statement that creates it; do not keep
+  it in an auto variable that outlives its operands.
+
+  Everything here is constexpr where C++11 allows it.
+
+*******************************************************************************/
+
+
+/**
+ * Base of every 3-vector expression; E is the derived expression type,
+ * which provides constexpr double operator[] (unsigned int).
+ */
+template <typename E>
+class Vec3Expr {
+ public:
+   /**
+    * Access the derived expression.
+    * @return Derived expression
+    */
+   constexpr const E & derived () const
+   {
+      return static_cast<const E &> (*this);
+   }
+};
+
+
+/**
+ * Base of every 3x3 matrix expression; E is the derived expression type,
+ * which provides constexpr double operator() (unsigned int, unsigned int).
+ */
+template <typename E>
+class Mat3Expr {
+ public:
+   /**
+    * Access the derived expression.
+    * @return Derived expression
+    */
+   constexpr const E & derived () const
+   {
+      return static_cast<const E &> (*this);
+   }
+};
+
+
+/**
+ * A 3-vector value.
+ */
+class Vec3 : public Vec3Expr<Vec3> {
+ public:
+
+   /**
+    * Default constructor; zero vector.
+    */
+   constexpr Vec3 ()
+   : elem{0.0, 0.0, 0.0}
+   { }
+
+   /**
+    * Construct from components.
+    * \param[in] x First component
+    * \param[in] y Second component
+    * \param[in] z Third component
+    */
+   constexpr Vec3 (double x, double y, double z)
+   : elem{x, y, z}
+   { }
+
+   /**
+    * Construct from an array.
+    * \param[in] vec Source vector
+    */
+   constexpr explicit Vec3 (const double vec[3])
+   : elem{vec[0], vec[1], vec[2]}
+   { }
+
+   /**
+    * Construct by evaluating an expression.
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   constexpr Vec3 (const Vec3Expr<E> & expr)
+   : elem{expr.derived()[0], expr.derived()[1], expr.derived()[2]}
+   { }
+
+   /**
+    * Assign an expression, which may refer to this vector.
+    * @return This vector
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Vec3 & operator= (const Vec3Expr<E> & expr)
+   {
+      const E & src = expr.derived();
+      double e0 = src[0];
+      double e1 = src[1];
+      double e2 = src[2];
+      elem[0] = e0;
+      elem[1] = e1;
+      elem[2] = e2;
+      return *this;
+   }
+
+   /**
+    * Add an expression to this vector.
+    * @return This vector
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Vec3 & operator+= (const Vec3Expr<E> & expr)
+   {
+      const E & src = expr.derived();
+      double e0 = src[0];
+      double e1 = src[1];
+      double e2 = src[2];
+      elem[0] += e0;
+      elem[1] += e1;
+      elem[2] += e2;
+      return *this;
+   }
+
+   /**
+    * Subtract an expression from this vector.
+    * @return This vector
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Vec3 & operator-= (const Vec3Expr<E> & expr)
+   {
+      const E & src = expr.derived();
+      double e0 = src[0];
+      double e1 = src[1];
+      double e2 = src[2];
+      elem[0] -= e0;
+      elem[1] -= e1;
+      elem[2] -= e2;
+      return *this;
+   }
+
+   /**
+    * Access an element.
+    * @return Element value
+    * \param[in] index Element index
+    */
+   constexpr double operator[] (unsigned int index) const
+   {
+      return elem[index];
+   }
+
+   /**
+    * Access an element.
+    * @return Element reference
+    * \param[in] index Element index
+    */
+   double & operator[] (unsigned int index)
+   {
+      return elem[index];
+   }
+
+   /**
+    * Access the elements as an array.
+    * @return Element array
+    */
+   double * data ()
+   {
+      return elem;
+   }
+
+   /**
+    * Access the elements as an array.
+    * @return Element array
+    */
+   constexpr const double * data () const
+   {
+      return elem;
+   }
+
+   /**
+    * Copy the vector to an array.
+    * \param[out] vec Destination vector
+    */
+   void store (double vec[3]) const
+   {
+      vec[0] = elem[0];
+      vec[1] = elem[1];
+      vec[2] = elem[2];
+   }
+
+ private:
+
+   /**
+    * Vector elements.
+    */
+   double elem[3]; //!< trick_units(--)
+};
+
+
+/**
+ * A 3x3 matrix value.
+ */
+class Mat3 : public Mat3Expr<Mat3> {
+ public:
+
+   /**
+    * Default constructor; zero matrix.
+    */
+   constexpr Mat3 ()
+   : elem{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}
+   { }
+
+   /**
+    * Construct from elements, row by row.
+    */
+   constexpr Mat3 (
+      double m00, double m01, double m02,
+      double m10, double m11, double m12,
+      double m20, double m21, double m22)
+   : elem{{m00, m01, m02}, {m10, m11, m12}, {m20, m21, m22}}
+   { }
+
+   /**
+    * Construct from an array.
+    * \param[in] mat Source matrix
+    */
+   constexpr explicit Mat3 (const double mat[3][3])
+   : elem{{mat[0][0], mat[0][1], mat[0][2]},
+          {mat[1][0], mat[1][1], mat[1][2]},
+          {mat[2][0], mat[2][1], mat[2][2]}}
+   { }
+
+   /**
+    * Construct by evaluating an expression.
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   constexpr Mat3 (const Mat3Expr<E> & expr)
+   : elem{{expr.derived()(0,0), expr.derived()(0,1), expr.derived()(0,2)},
+          {expr.derived()(1,0), expr.derived()(1,1), expr.derived()(1,2)},
+          {expr.derived()(2,0), expr.derived()(2,1), expr.derived()(2,2)}}
+   { }
+
+   /**
+    * The identity matrix.
+    * @return Identity matrix
+    */
+   static constexpr Mat3 identity ()
+   {
+      return Mat3 (1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0);
+   }
+
+   /**
+    * Assign an expression, which may refer to this matrix.
+    * @return This matrix
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Mat3 & operator= (const Mat3Expr<E> & expr)
+   {
+      Mat3 temp (expr);
+      *this = temp;
+      return *this;
+   }
+
+   /**
+    * Access an element.
+    * @return Element value
+    * \param[in] row Row index
+    * \param[in] col Column index
+    */
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return elem[row][col];
+   }
+
+   /**
+    * Access an element.
+    * @return Element reference
+    * \param[in] row Row index
+    * \param[in] col Column index
+    */
+   double & operator() (unsigned int row, unsigned int col)
+   {
+      return elem[row][col];
+   }
+
+   /**
+    * Access the elements as an array.
+    * @return Element array
+    */
+   constexpr const double (* data () const)[3]
+   {
+      return elem;
+   }
+
+   /**
+    * Copy the matrix to an array.
+    * \param[out] mat Destination matrix
+    */
+   void store (double mat[3][3]) const
+   {
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            mat[ii][jj] = elem[ii][jj];
+         }
+      }
+   }
+
+ private:
+
+   /**
+    * Matrix elements, row major.
+    */
+   double elem[3][3]; //!< trick_units(--)
+};
+
+
+/**
+ * A read-only view of a double[3] (or of a Vec3) as a vector expression.
+ */
+class Vec3View : public Vec3Expr<Vec3View> {
+ public:
+
+   /**
+    * Construct a view of an array.
+    * \param[in] vec Viewed vector
+    */
+   constexpr explicit Vec3View (const double vec[3])
+   : elem(vec)
+   { }
+
+   /**
+    * Construct a view of a vector value.
+    * \param[in] vec Viewed vector
+    */
+   constexpr Vec3View (const Vec3 & vec)
+   : elem(vec.data())
+   { }
+
+   /**
+    * Access an element.
+    * @return Element value
+    * \param[in] index Element index
+    */
+   constexpr double operator[] (unsigned int index) const
+   {
+      return elem[index];
+   }
+
+ private:
+
+   /**
+    * Viewed elements.
+    */
+   const double * elem; //!< trick_io(**)
+};
+
+
+/**
+ * A read-only view of a double[3][3] (or of a Mat3) as a matrix expression.
+ */
+class Mat3View : public Mat3Expr<Mat3View> {
+ public:
+
+   /**
+    * Construct a view of an array.
+    * \param[in] mat Viewed matrix
+    */
+   constexpr explicit Mat3View (const double mat[3][3])
+   : elem(mat)
+   { }
+
+   /**
+    * Construct a view of a matrix value.
+    * \param[in] mat Viewed matrix
+    */
+   constexpr Mat3View (const Mat3 & mat)
+   : elem(mat.data())
+   { }
+
+   /**
+    * Access an element.
+    * @return Element value
+    * \param[in] row Row index
+    * \param[in] col Column index
+    */
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return elem[row][col];
+   }
+
+ private:
+
+   /**
+    * Viewed elements.
+    */
+   const double (* elem)[3]; //!< trick_io(**)
+};
+
+
+/**
+ * A writable view of a double[3]. Assigning an expression to it stores the
+ * result in the viewed array.
+ */
+class Vec3Ref : public Vec3Expr<Vec3Ref> {
+ public:
+
+   /**
+    * Construct a view of an array.
+    * \param[in,out] vec Viewed vector
+    */
+   explicit Vec3Ref (double vec[3])
+   : elem(vec)
+   { }
+
+   /**
+    * Copy constructor; the copy views the same array.
+    */
+   Vec3Ref (const Vec3Ref &) = default;
+
+   /**
+    * Assign an expression, which may refer to the viewed vector.
+    * @return This view
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Vec3Ref & operator= (const Vec3Expr<E> & expr)
+   {
+      const E & src = expr.derived();
+      double e0 = src[0];
+      double e1 = src[1];
+      double e2 = src[2];
+      elem[0] = e0;
+      elem[1] = e1;
+      elem[2] = e2;
+      return *this;
+   }
+
+   /**
+    * Assign the contents of another view.
+    * @return This view
+    * \param[in] src Source view
+    */
+   Vec3Ref & operator= (const Vec3Ref & src)
+   {
+      return operator=<Vec3Ref> (src);
+   }
+
+   /**
+    * Add an expression to the viewed vector.
+    * @return This view
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Vec3Ref & operator+= (const Vec3Expr<E> & expr)
+   {
+      const E & src = expr.derived();
+      double e0 = src[0];
+      double e1 = src[1];
+      double e2 = src[2];
+      elem[0] += e0;
+      elem[1] += e1;
+      elem[2] += e2;
+      return *this;
+   }
+
+   /**
+    * Subtract an expression from the viewed vector.
+    * @return This view
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Vec3Ref & operator-= (const Vec3Expr<E> & expr)
+   {
+      const E & src = expr.derived();
+      double e0 = src[0];
+      double e1 = src[1];
+      double e2 = src[2];
+      elem[0] -= e0;
+      elem[1] -= e1;
+      elem[2] -= e2;
+      return *this;
+   }
+
+   /**
+    * Access an element.
+    * @return Element value
+    * \param[in] index Element index
+    */
+   double operator[] (unsigned int index) const
+   {
+      return elem[index];
+   }
+
+ private:
+
+   /**
+    * Viewed elements.
+    */
+   double * elem; //!< trick_io(**)
+};
+
+
+/**
+ * A writable view of a double[3][3]. Assigning an expression to it stores
+ * the result in the viewed array.
+ */
+class Mat3Ref : public Mat3Expr<Mat3Ref> {
+ public:
+
+   /**
+    * Construct a view of an array.
+    * \param[in,out] mat Viewed matrix
+    */
+   explicit Mat3Ref (double mat[3][3])
+   : elem(mat)
+   { }
+
+   /**
+    * Copy constructor; the copy views the same array.
+    */
+   Mat3Ref (const Mat3Ref &) = default;
+
+   /**
+    * Assign an expression, which may refer to the viewed matrix.
+    * @return This view
+    * \param[in] expr Expression
+    */
+   template <typename E>
+   Mat3Ref & operator= (const Mat3Expr<E> & expr)
+   {
+      Mat3 temp (expr);
+      temp.store (elem);
+      return *this;
+   }
+
+   /**
+    * Assign the contents of another view.
+    * @return This view
+    * \param[in] src Source view
+    */
+   Mat3Ref & operator= (const Mat3Ref & src)
+   {
+      return operator=<Mat3Ref> (src);
+   }
+
+   /**
+    * Access an element.
+    * @return Element value
+    * \param[in] row Row index
+    * \param[in] col Column index
+    */
+   double operator() (unsigned int row, unsigned int col) const
+   {
+      return elem[row][col];
+   }
+
+ private:
+
+   /**
+    * Viewed elements.
+    */
+   double (* elem)[3]; //!< trick_io(**)
+};
+
+
+/**
+ * How an expression node holds an operand of type E: through a view for
+ * the value types Vec3 and Mat3, and by value for everything else (views
+ * and expression nodes, which are a few pointers in size).
+ */
+template <typename E>
+struct ExprOperand {
+   typedef E type; ///< Stored operand type
+};
+
+/** Hold a Vec3 operand through a view. */
+template <>
+struct ExprOperand<Vec3> {
+   typedef Vec3View type; ///< Stored operand type
+};
+
+/** Hold a Mat3 operand through a view. */
+template <>
+struct ExprOperand<Mat3> {
+   typedef Mat3View type; ///< Stored operand type
+};
+
+
+/**
+ * Sum of two vector expressions.
+ */
+template <typename L, typename R>
+class Vec3Sum : public Vec3Expr<Vec3Sum<L, R> > {
+ public:
+   constexpr Vec3Sum (const L & lhs_in, const R & rhs_in)
+   : lhs(lhs_in), rhs(rhs_in)
+   { }
+
+   constexpr double operator[] (unsigned int index) const
+   {
+      return lhs[index] + rhs[index];
+   }
+
+ private:
+   typename ExprOperand<L>::type lhs; ///< Left operand
+   typename ExprOperand<R>::type rhs; ///< Right operand
+};
+
+
+/**
+ * Difference of two vector expressions.
+ */
+template <typename L, typename R>
+class Vec3Diff : public Vec3Expr<Vec3Diff<L, R> > {
+ public:
+   constexpr Vec3Diff (const L & lhs_in, const R & rhs_in)
+   : lhs(lhs_in), rhs(rhs_in)
+   { }
+
+   constexpr double operator[] (unsigned int index) const
+   {
+      return lhs[index] - rhs[index];
+   }
+
+ private:
+   typename ExprOperand<L>::type lhs; ///< Left operand
+   typename ExprOperand<R>::type rhs; ///< Right operand
+};
+
+
+/**
+ * Negation of a vector expression.
+ */
+template <typename E>
+class Vec3Negate : public Vec3Expr<Vec3Negate<E> > {
+ public:
+   constexpr explicit Vec3Negate (const E & arg_in)
+   : arg(arg_in)
+   { }
+
+   constexpr double operator[] (unsigned int index) const
+   {
+      return -arg[index];
+   }
+
+ private:
+   typename ExprOperand<E>::type arg; ///< Operand
+};
+
+
+/**
+ * Product of a vector expression and a scalar.
+ */
+template <typename E>
+class Vec3Scale : public Vec3Expr<Vec3Scale<E> > {
+ public:
+   constexpr Vec3Scale (const E & arg_in, double scalar_in)
+   : arg(arg_in), scalar(scalar_in)
+   { }
+
+   constexpr double operator[] (unsigned int index) const
+   {
+      return arg[index] * scalar;
+   }
+
+ private:
+   typename ExprOperand<E>::type arg; ///< Operand
+   double scalar;                     ///< Scale factor
+};
+
+
+/**
+ * Cross product of two vector expressions.
+ */
+template <typename L, typename R>
+class Vec3Cross : public Vec3Expr<Vec3Cross<L, R> > {
+ public:
+   constexpr Vec3Cross (const L & lhs_in, const R & rhs_in)
+   : lhs(lhs_in), rhs(rhs_in)
+   { }
+
+   constexpr double operator[] (unsigned int index) const
+   {
+      return (index == 0) ? lhs[1] * rhs[2] - lhs[2] * rhs[1] :
+             (index == 1) ? lhs[2] * rhs[0] - lhs[0] * rhs[2] :
+                            lhs[0] * rhs[1] - lhs[1] * rhs[0];
+   }
+
+ private:
+   typename ExprOperand<L>::type lhs; ///< Left operand
+   typename ExprOperand<R>::type rhs; ///< Right operand
+};
+
+
+/**
+ * Product of a matrix expression and a vector expression.
+ */
+template <typename M, typename V>
+class Mat3Vec3Product : public Vec3Expr<Mat3Vec3Product<M, V> > {
+ public:
+   constexpr Mat3Vec3Product (const M & mat_in, const V & vec_in)
+   : mat(mat_in), vec(vec_in)
+   { }
+
+   constexpr double operator[] (unsigned int index) const
+   {
+      return mat(index,0) * vec[0] +
+             mat(index,1) * vec[1] +
+             mat(index,2) * vec[2];
+   }
+
+ private:
+   typename ExprOperand<M>::type mat; ///< Matrix operand
+   typename ExprOperand<V>::type vec; ///< Vector operand
+};
+
+
+/**
+ * Transpose of a matrix expression.
+ */
+template <typename E>
+class Mat3Transpose : public Mat3Expr<Mat3Transpose<E> > {
+ public:
+   constexpr explicit Mat3Transpose (const E & arg_in)
+   : arg(arg_in)
+   { }
+
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return arg(col,row);
+   }
+
+ private:
+   typename ExprOperand<E>::type arg; ///< Operand
+};
+
+
+/**
+ * Sum of two matrix expressions.
+ */
+template <typename L, typename R>
+class Mat3Sum : public Mat3Expr<Mat3Sum<L, R> > {
+ public:
+   constexpr Mat3Sum (const L & lhs_in, const R & rhs_in)
+   : lhs(lhs_in), rhs(rhs_in)
+   { }
+
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return lhs(row,col) + rhs(row,col);
+   }
+
+ private:
+   typename ExprOperand<L>::type lhs; ///< Left operand
+   typename ExprOperand<R>::type rhs; ///< Right operand
+};
+
+
+/**
+ * Difference of two matrix expressions.
+ */
+template <typename L, typename R>
+class Mat3Diff : public Mat3Expr<Mat3Diff<L, R> > {
+ public:
+   constexpr Mat3Diff (const L & lhs_in, const R & rhs_in)
+   : lhs(lhs_in), rhs(rhs_in)
+   { }
+
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return lhs(row,col) - rhs(row,col);
+   }
+
+ private:
+   typename ExprOperand<L>::type lhs; ///< Left operand
+   typename ExprOperand<R>::type rhs; ///< Right operand
+};
+
+
+/**
+ * Product of a matrix expression and a scalar.
+ */
+template <typename E>
+class Mat3Scale : public Mat3Expr<Mat3Scale<E> > {
+ public:
+   constexpr Mat3Scale (const E & arg_in, double scalar_in)
+   : arg(arg_in), scalar(scalar_in)
+   { }
+
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return arg(row,col) * scalar;
+   }
+
+ private:
+   typename ExprOperand<E>::type arg; ///< Operand
+   double scalar;                     ///< Scale factor
+};
+
+
+/**
+ * Product of two matrix expressions. Each element of the product evaluates
+ * a row of the left operand and a column of the right; construct a Mat3
+ * from a product that is used more than once.
+ */
+template <typename L, typename R>
+class Mat3Product : public Mat3Expr<Mat3Product<L, R> > {
+ public:
+   constexpr Mat3Product (const L & lhs_in, const R & rhs_in)
+   : lhs(lhs_in), rhs(rhs_in)
+   { }
+
+   constexpr double operator() (unsigned int row, unsigned int col) const
+   {
+      return lhs(row,0) * rhs(0,col) +
+             lhs(row,1) * rhs(1,col) +
+             lhs(row,2) * rhs(2,col);
+   }
+
+ private:
+   typename ExprOperand<L>::type lhs; ///< Left operand
+   typename ExprOperand<R>::type rhs; ///< Right operand
+};
+
+
+/**
+ * View a double[3] as a vector expression.
+ * @return Read-only view
+ * \param[in] vec Viewed vector
+ */
+constexpr inline Vec3View
+vec3 (const double vec[3])
+{
+   return Vec3View (vec);
+}
+
+
+/**
+ * View a double[3][3] as a matrix expression.
+ * @return Read-only view
+ * \param[in] mat Viewed matrix
+ */
+constexpr inline Mat3View
+mat3 (const double mat[3][3])
+{
+   return Mat3View (mat);
+}
+
+
+/**
+ * Add vector expressions.
+ * @return Sum expression
+ */
+template <typename L, typename R>
+constexpr Vec3Sum<L, R>
+operator+ (const Vec3Expr<L> & lhs, const Vec3Expr<R> & rhs)
+{
+   return Vec3Sum<L, R> (lhs.derived(), rhs.derived());
+}
+
+
+/**
+ * Subtract vector expressions.
+ * @return Difference expression
+ */
+template <typename L, typename R>
+constexpr Vec3Diff<L, R>
+operator- (const Vec3Expr<L> & lhs, const Vec3Expr<R> & rhs)
+{
+   return Vec3Diff<L, R> (lhs.derived(), rhs.derived());
+}
+
+
+/**
+ * Negate a vector expression.
+ * @return Negation expression
+ */
+template <typename E>
+constexpr Vec3Negate<E>
+operator- (const Vec3Expr<E> & arg)
+{
+   return Vec3Negate<E> (arg.derived());
+}
+
+
+/**
+ * Scale a vector expression.
+ * @return Scaled expression
+ */
+template <typename E>
+constexpr Vec3Scale<E>
+operator* (const Vec3Expr<E> & arg, double scalar)
+{
+   return Vec3Scale<E> (arg.derived(), scalar);
+}
+
+
+/**
+ * Scale a vector expression.
+ * @return Scaled expression
+ */
+template <typename E>
+constexpr Vec3Scale<E>
+operator* (double scalar, const Vec3Expr<E> & arg)
+{
+   return Vec3Scale<E> (arg.derived(), scalar);
+}
+
+
+/**
+ * Cross product of vector expressions, as Vector3::cross.
+ * @return Cross product expression
+ */
+template <typename L, typename R>
+constexpr Vec3Cross<L, R>
+cross (const Vec3Expr<L> & lhs, const Vec3Expr<R> & rhs)
+{
+   return Vec3Cross<L, R> (lhs.derived(), rhs.derived());
+}
+
+
+/**
+ * Inner product of vector expressions, as Vector3::dot.
+ * @return Inner product
+ */
+template <typename L, typename R>
+constexpr double
+dot (const Vec3Expr<L> & lhs, const Vec3Expr<R> & rhs)
+{
+   return lhs.derived()[0] * rhs.derived()[0] +
+          lhs.derived()[1] * rhs.derived()[1] +
+          lhs.derived()[2] * rhs.derived()[2];
+}
+
+
+/**
+ * Transform a vector expression, as Vector3::transform.
+ * @return Product expression
+ */
+template <typename M, typename V>
+constexpr Mat3Vec3Product<M, V>
+operator* (const Mat3Expr<M> & mat, const Vec3Expr<V> & vec)
+{
+   return Mat3Vec3Product<M, V> (mat.derived(), vec.derived());
+}
+
+
+/**
+ * Transpose a matrix expression.
+ * @return Transpose expression
+ */
+template <typename E>
+constexpr Mat3Transpose<E>
+transpose (const Mat3Expr<E> & arg)
+{
+   return Mat3Transpose<E> (arg.derived());
+}
+
+
+/**
+ * Add matrix expressions.
+ * @return Sum expression
+ */
+template <typename L, typename R>
+constexpr Mat3Sum<L, R>
+operator+ (const Mat3Expr<L> & lhs, const Mat3Expr<R> & rhs)
+{
+   return Mat3Sum<L, R> (lhs.derived(), rhs.derived());
+}
+
+
+/**
+ * Subtract matrix expressions.
+ * @return Difference expression
+ */
+template <typename L, typename R>
+constexpr Mat3Diff<L, R>
+operator- (const Mat3Expr<L> & lhs, const Mat3Expr<R> & rhs)
+{
+   return Mat3Diff<L, R> (lhs.derived(), rhs.derived());
+}
+
+
+/**
+ * Scale a matrix expression.
+ * @return Scaled expression
+ */
+template <typename E>
+constexpr Mat3Scale<E>
+operator* (const Mat3Expr<E> & arg, double scalar)
+{
+   return Mat3Scale<E> (arg.derived(), scalar);
+}
+
+
+/**
+ * Scale a matrix expression.
+ * @return Scaled expression
+ */
+template <typename E>
+constexpr Mat3Scale<E>
+operator* (double scalar, const Mat3Expr<E> & arg)
+{
+   return Mat3Scale<E> (arg.derived(), scalar);
+}
+
+
+/**
+ * Multiply matrix expressions, as Matrix3x3::product.
+ * @return Product expression
+ */
+template <typename L, typename R>
+constexpr Mat3Product<L, R>
+operator* (const Mat3Expr<L> & lhs, const Mat3Expr<R> & rhs)
+{
+   return Mat3Product<L, R> (lhs.derived(), rhs.derived());
+}
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
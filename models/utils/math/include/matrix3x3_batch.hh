@@ -0,0 +1,203 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/include/matrix3x3_batch.hh
+ * Define the class Matrix3x3Batch, which applies the Matrix3x3 operations to
+ * many 3x3 matrices at a time.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/matrix3x3_batch.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_MATRIX3X3_BATCH_HH
+#define JEOD_MATRIX3X3_BATCH_HH
+
+// Model includes
+#include "vector3_batch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Provides static methods that apply the Matrix3x3 operations to n matrices.
+ *
+ * The layouts follow Vector3Batch:
+ *  - Structure of arrays (SoA). A batch is nine element arrays, each n long,
+ *    passed as a 3x3 array of pointers: mat[j][k][i] is element [j][k] of
+ *    matrix i.
+ *  - Array of structures of arrays (AoSoA). A batch is an array of blocks,
+ *    each holding Vector3Batch::Lanes matrices element by element:
+ *    mat[b][j][k][l] is element [j][k] of matrix b*Lanes+l.
+ *
+ * As with Vector3Batch, each element is computed exactly as the Matrix3x3
+ * method of the same name computes it. Outputs must be distinct from the
+ * inputs, as with the Matrix3x3 product methods.
+ */
+class Matrix3x3Batch {
+
+ public:
+
+   /**
+    * An AoSoA block of Vector3Batch::Lanes 3x3 matrices.
+    */
+   typedef double Block[3][3][Vector3Batch::Lanes];
+
+
+   // Structure of arrays
+
+   // Copy matrices :
+   // copy[i] = mat[i]
+   static void copy (
+      unsigned int num, double const * const mat[3][3],
+      double * const copy[3][3]);
+
+   // Transpose matrices :
+   // trans[i] = mat[i]^T
+   static void transpose (
+      unsigned int num, double const * const mat[3][3],
+      double * const trans[3][3]);
+
+   // Multiply matrices :
+   // prod[i] = mat_left[i] * mat_right[i]
+   static void product (
+      unsigned int num,
+      double const * const mat_left[3][3],
+      double const * const mat_right[3][3],
+      double * const prod[3][3]);
+
+   // Multiply matrices by a common left matrix :
+   // prod[i] = mat_left * mat_right[i]
+   static void product (
+      unsigned int num,
+      double const mat_left[3][3],
+      double const * const mat_right[3][3],
+      double * const prod[3][3]);
+
+   // Multiply matrices by a common right matrix :
+   // prod[i] = mat_left[i] * mat_right
+   static void product (
+      unsigned int num,
+      double const * const mat_left[3][3],
+      double const mat_right[3][3],
+      double * const prod[3][3]);
+
+   // Multiply transposed matrices by matrices :
+   // prod[i] = mat_left[i]^T * mat_right[i]
+   static void product_left_transpose (
+      unsigned int num,
+      double const * const mat_left[3][3],
+      double const * const mat_right[3][3],
+      double * const prod[3][3]);
+
+   // Multiply matrices by transposed matrices :
+   // prod[i] = mat_left[i] * mat_right[i]^T
+   static void product_right_transpose (
+      unsigned int num,
+      double const * const mat_left[3][3],
+      double const * const mat_right[3][3],
+      double * const prod[3][3]);
+
+   // Transform matrices by a common transformation :
+   // prod[i] = trans * mat[i] * trans^T
+   static void transform_matrix (
+      unsigned int num, double const trans[3][3],
+      double const * const mat[3][3], double * const prod[3][3]);
+
+   // Transform matrices by the transpose of a common transformation :
+   // prod[i] = trans^T * mat[i] * trans
+   static void transpose_transform_matrix (
+      unsigned int num, double const trans[3][3],
+      double const * const mat[3][3], double * const prod[3][3]);
+
+
+   // Array of structures of arrays
+
+   // Pack matrices into blocks, setting the padding lanes to identity :
+   // blocks[i/Lanes][j][k][i%Lanes] = mat[i][j][k]
+   static void pack (
+      unsigned int num, double const mat[][3][3], Block * blocks);
+
+   // Unpack matrices from blocks :
+   // mat[i][j][k] = blocks[i/Lanes][j][k][i%Lanes]
+   static void unpack (
+      unsigned int num, Block const * blocks, double mat[][3][3]);
+
+   // Multiply matrices :
+   // prod[i] = mat_left[i] * mat_right[i]
+   static void product (
+      unsigned int num, Block const * mat_left, Block const * mat_right,
+      Block * prod);
+
+   // Multiply matrices by transposed matrices :
+   // prod[i] = mat_left[i] * mat_right[i]^T
+   static void product_right_transpose (
+      unsigned int num, Block const * mat_left, Block const * mat_right,
+      Block * prod);
+
+   // Transform matrices by a common transformation :
+   // prod[i] = trans * mat[i] * trans^T
+   static void transform_matrix (
+      unsigned int num, double const trans[3][3], Block const * mat,
+      Block * prod);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,178 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/include/occultation.hh
+ * Define the class Occultation, which computes the blocking of a spherical
+ * light source by spherical occulting bodies.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The source and the occulting bodies are spheres.)
+   (The conical shadow model approximates the eclipsed fraction of the source
+    with an empirical polynomial in the relative disk size and the fraction
+    of maximum eclipse.))
+
+Library dependencies:
+  ((../src/occultation.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_OCCULTATION_HH
+#define JEOD_OCCULTATION_HH
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Provides static methods that compute how much of a spherical light source
+ * is hidden from an observer by a spherical occulting body.
+ *
+ * Two formulations are provided, each with a single-observer form and a
+ * batched form:
+ *  - Disk overlap. The source and the occulter are disks on the observer's
+ *    sky, given by their angular radii and the angle between their centers;
+ *    the occluded fraction is the exact area of overlap of the two circles
+ *    divided by the area of the source disk.
+ *  - Conical shadow. The occulter casts an umbral and a penumbral cone away
+ *    from the source; the observer is classified by region and, in the
+ *    penumbra, the illuminated fraction is approximated by an empirical
+ *    polynomial.
+ *
+ * The batched forms take structure-of-arrays inputs (vec[k][i] is component
+ * k of vector i). Each element is computed with the expressions of the
+ * single-observer form, so the results are bit-for-bit the same. The loops
+ * compute every candidate result and select among them rather than
+ * branching, leaving the compiler free to vectorize them.
+ */
+class Occultation {
+
+ public:
+
+   /**
+    * The shadow region an observer occupies with respect to an occulter.
+    */
+   enum Region {
+      Lit = 0,       /**< no part of the source is blocked */
+      Penumbral = 1, /**< the source is partially blocked */
+      Umbral = 2,    /**< the source is completely blocked */
+      Antumbral = 3  /**< the occulter lies wholly within the source disk */
+   };
+
+
+   // Disk overlap
+
+   // Compute the area of intersection of two circles.
+   static double circle_overlap_area (
+      double r_bottom, double r_top, double d_centers);
+
+   // Compute the fraction of a source disk hidden by an occulting disk.
+   static double occluded_fraction (
+      double source_radius, double occulter_radius, double separation);
+
+   // Compute the fractions of source disks hidden by occulting disks :
+   // fraction[i] = occluded_fraction(source_radius[i],
+   //                                 occulter_radius[i], separation[i])
+   static void occluded_fraction (
+      unsigned int num,
+      const double * source_radius,
+      const double * occulter_radius,
+      const double * separation,
+      double * fraction);
+
+
+   // Conical shadow
+
+   // Evaluate the empirical eclipsed-area polynomial.
+   static double eclipse_alpha (double rho_adj, double delta);
+
+   // Classify an observer with respect to an occulter's conical shadow.
+   static Region conical_shadow (
+      double r_par, double r_perp, double r_mag_sq,
+      double d_source_to_occulter, double d_source_to_observer,
+      double occulter_radius, double source_radius,
+      double & illum_factor,
+      double & penumbra_distance, double & umbra_distance);
+
+   // Compute the illumination factors of many observers with respect to
+   // each of several occulters :
+   // illum_factor[j*num_obs + i] = illumination of observer i with respect
+   //                               to occulter j
+   static void conical_shadow (
+      unsigned int num_obs,
+      double const * const observer[3],
+      unsigned int num_occ,
+      double const * const occulter[3],
+      const double * occulter_radius,
+      const double source[3],
+      double source_radius,
+      double * illum_factor);
+
+
+ private:
+
+   // This class is not instantiable.
+   // The constructors and assignment operator for this class are declared
+   // private and are not implemented.
+   Occultation ();
+   Occultation (const Occultation &);
+   Occultation & operator= (const Occultation &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,146 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/include/sorted_table_inline.hh
+ * Sorted table lookup inline functions
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_SORTED_TABLE_INLINE_H
+#define JEOD_SORTED_TABLE_INLINE_H
+
+// System includes
+#include <algorithm>
+
+// JEOD includes
+#include "sorted_table.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Find the interval of a sorted table containing a value
+ * @return Index i such that table[i] <= value < table[i+1], clamped to
+ *         [0, size-2]
+ * \param[in] table Values, in increasing order
+ * \param[in] size Number of entries in the table
+ * \param[in] value Value to locate
+ */
+inline unsigned int
+SortedTable::find_interval (
+   const double * table,
+   unsigned int size,
+   double value)
+{
+   if (size < 2) {
+      return 0;
+   }
+
+   const double * upper = std::upper_bound (table, table + size, value);
+   if (upper == table) {
+      return 0;
+   }
+
+   unsigned int index = static_cast<unsigned int> (upper - table) - 1;
+   return std::min (index, size - 2);
+}
+
+
+/**
+ * Find the interval of a sorted table containing a value, starting from
+ * the interval found by the previous lookup. Steps to an adjacent
+ * interval are resolved without a search, so monotone access costs O(1)
+ * per lookup while arbitrary jumps cost O(log n).
+ * @return Index i such that table[i] <= value < table[i+1], clamped to
+ *         [0, size-2]
+ * \param[in] table Values, in increasing order
+ * \param[in] size Number of entries in the table
+ * \param[in] value Value to locate
+ * \param[in] cursor Result of the previous lookup
+ */
+inline unsigned int
+SortedTable::find_interval (
+   const double * table,
+   unsigned int size,
+   double value,
+   unsigned int cursor)
+{
+   if ((size >= 2) && (cursor + 1 < size)) {
+      if (table[cursor] <= value) {
+         if ((value < table[cursor + 1]) || (cursor + 2 == size)) {
+            return cursor;
+         }
+         if ((cursor + 2 < size) && (value < table[cursor + 2])) {
+            return cursor + 1;
+         }
+      }
+      else if (cursor == 0) {
+         return 0;
+      }
+      else if (table[cursor - 1] <= value) {
+         return cursor - 1;
+      }
+   }
+
+   return find_interval (table, size, value);
+}
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,283 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/include/vector3_batch.hh
+ * Define the class Vector3Batch, which applies the Vector3 operations to
+ * many 3-vectors at a time.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/vector3_batch.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_VECTOR3_BATCH_HH
+#define JEOD_VECTOR3_BATCH_HH
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Provides static methods that apply the Vector3 operations to n vectors.
+ *
+ * Two storage layouts are supported:
+ *  - Structure of arrays (SoA). A batch is three component arrays, each
+ *    n long, passed as an array of three pointers: vec[k][i] is component k
+ *    of vector i.
+ *  - Array of structures of arrays (AoSoA). A batch is an array of blocks,
+ *    each holding Lanes vectors component by component: vec[b][k][l] is
+ *    component k of vector b*Lanes+l. A batch of n vectors occupies
+ *    num_blocks(n) blocks; the lanes past the n'th vector are padding,
+ *    which the operations process along with the rest of the last block.
+ *
+ * Each operation computes every element exactly as the Vector3 method of the
+ * same name does, in the same order, so the results are bit-for-bit those
+ * of the scalar methods. The loops are call-free arithmetic over contiguous
+ * arrays, which the compiler vectorizes for the target instruction set.
+ * Outputs may be the same arrays as inputs except where noted.
+ */
+class Vector3Batch {
+
+ public:
+
+   /**
+    * Number of vectors in an AoSoA block. Eight doubles fill one AVX-512
+    * register, two AVX registers or four SSE2/NEON registers.
+    */
+   static const unsigned int Lanes = 8;
+
+   /**
+    * An AoSoA block of Lanes 3-vectors.
+    */
+   typedef double Block[3][Lanes];
+
+   /**
+    * Number of AoSoA blocks needed to hold n vectors.
+    * @return Block count
+    * \param[in] num Number of vectors
+    */
+   static unsigned int num_blocks (unsigned int num)
+   {
+      return (num + Lanes - 1) / Lanes;
+   }
+
+
+   // Structure of arrays
+
+   // Zero-fill vectors :
+   // vec[k][i] = 0.0
+   static void initialize (unsigned int num, double * const vec[3]);
+
+   // Copy vectors :
+   // copy[k][i] = vec[k][i]
+   static void copy (
+      unsigned int num, double const * const vec[3], double * const copy[3]);
+
+   // Compute inner products :
+   // result[i] = vec1[i] . vec2[i]
+   static void dot (
+      unsigned int num,
+      double const * const vec1[3], double const * const vec2[3],
+      double * result);
+
+   // Compute squared magnitudes :
+   // result[i] = vec[i] . vec[i]
+   static void vmagsq (
+      unsigned int num, double const * const vec[3], double * result);
+
+   // Compute magnitudes :
+   // result[i] = sqrt(vmagsq(vec[i]))
+   static void vmag (
+      unsigned int num, double const * const vec[3], double * result);
+
+   // Normalize vectors in-place; zero vectors stay zero :
+   // vec[i] = vec[i] / vmag(vec[i])
+   static void normalize (unsigned int num, double * const vec[3]);
+
+   // Scale vectors by a common scalar :
+   // prod[i] = scalar * vec[i]
+   static void scale (
+      unsigned int num, double const * const vec[3], double scalar,
+      double * const prod[3]);
+
+   // Scale vectors by per-vector scalars :
+   // prod[i] = scalar[i] * vec[i]
+   static void scale (
+      unsigned int num, double const * const vec[3], double const * scalar,
+      double * const prod[3]);
+
+   // Add vectors :
+   // sum[i] = vec1[i] + vec2[i]
+   static void sum (
+      unsigned int num,
+      double const * const vec1[3], double const * const vec2[3],
+      double * const sum[3]);
+
+   // Subtract vectors :
+   // diff[i] = vec1[i] - vec2[i]
+   static void diff (
+      unsigned int num,
+      double const * const vec1[3], double const * const vec2[3],
+      double * const diff[3]);
+
+   // Increment vectors with scaled vectors :
+   // prod[i] += scalar * vec[i]
+   static void scale_incr (
+      unsigned int num, double const * const vec[3], double scalar,
+      double * const prod[3]);
+
+   // Compute cross products :
+   // prod[i] = vec_left[i] x vec_right[i]
+   static void cross (
+      unsigned int num,
+      double const * const vec_left[3], double const * const vec_right[3],
+      double * const prod[3]);
+
+   // Compute cross products with a common left vector :
+   // prod[i] = vec_left x vec_right[i]
+   static void cross (
+      unsigned int num,
+      double const vec_left[3], double const * const vec_right[3],
+      double * const prod[3]);
+
+   // Transform vectors by a common matrix :
+   // prod[i] = tmat * vec[i]
+   static void transform (
+      unsigned int num, double const tmat[3][3],
+      double const * const vec[3], double * const prod[3]);
+
+   // Transform vectors by the transpose of a common matrix :
+   // prod[i] = tmat^T * vec[i]
+   static void transform_transpose (
+      unsigned int num, double const tmat[3][3],
+      double const * const vec[3], double * const prod[3]);
+
+   // Transform vectors by per-vector matrices (see Matrix3x3Batch) :
+   // prod[i] = tmat[i] * vec[i]
+   static void transform (
+      unsigned int num, double const * const tmat[3][3],
+      double const * const vec[3], double * const prod[3]);
+
+   // Transform vectors by the transposes of per-vector matrices :
+   // prod[i] = tmat[i]^T * vec[i]
+   static void transform_transpose (
+      unsigned int num, double const * const tmat[3][3],
+      double const * const vec[3], double * const prod[3]);
+
+
+   // Array of structures of arrays
+
+   // Pack vectors into blocks, zero-filling the padding lanes :
+   // blocks[i/Lanes][k][i%Lanes] = vec[i][k]
+   static void pack (
+      unsigned int num, double const vec[][3], Block * blocks);
+
+   // Unpack vectors from blocks :
+   // vec[i][k] = blocks[i/Lanes][k][i%Lanes]
+   static void unpack (
+      unsigned int num, Block const * blocks, double vec[][3]);
+
+   // Compute inner products; result is num_blocks(num)*Lanes long :
+   // result[i] = vec1[i] . vec2[i]
+   static void dot (
+      unsigned int num, Block const * vec1, Block const * vec2,
+      double * result);
+
+   // Compute magnitudes; result is num_blocks(num)*Lanes long :
+   // result[i] = sqrt(vmagsq(vec[i]))
+   static void vmag (unsigned int num, Block const * vec, double * result);
+
+   // Increment vectors with scaled vectors :
+   // prod[i] += scalar * vec[i]
+   static void scale_incr (
+      unsigned int num, Block const * vec, double scalar, Block * prod);
+
+   // Compute cross products :
+   // prod[i] = vec_left[i] x vec_right[i]
+   static void cross (
+      unsigned int num, Block const * vec_left, Block const * vec_right,
+      Block * prod);
+
+   // Transform vectors by a common matrix :
+   // prod[i] = tmat * vec[i]
+   static void transform (
+      unsigned int num, double const tmat[3][3], Block const * vec,
+      Block * prod);
+
+   // Transform vectors by the transpose of a common matrix :
+   // prod[i] = tmat^T * vec[i]
+   static void transform_transpose (
+      unsigned int num, double const tmat[3][3], Block const * vec,
+      Block * prod);
+
+   // Transform vectors by per-vector matrices (Matrix3x3Batch blocks) :
+   // prod[i] = tmat[i] * vec[i]
+   static void transform (
+      unsigned int num, double const (* tmat)[3][3][Lanes],
+      Block const * vec, Block * prod);
+
+   // Transform vectors by the transposes of per-vector matrices :
+   // prod[i] = tmat[i]^T * vec[i]
+   static void transform_transpose (
+      unsigned int num, double const (* tmat)[3][3][Lanes],
+      Block const * vec, Block * prod);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
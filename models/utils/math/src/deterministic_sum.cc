@@ -0,0 +1,123 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/src/deterministic_sum.cc
+ * Define the static methods of the class DeterministicSum.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Library dependencies:
+    ((deterministic_sum.cc))
+
+
+*******************************************************************************/
+
+
+// Model includes
+#include "../include/deterministic_sum.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Reduce per-task partials in place with a fixed pairwise tree. At level
+ * L, partial i (a multiple of 2^(L+1)) absorbs partial i + 2^L. The shape
+ * of the tree depends only on the number of partials. On return the first
+ * partial holds the total; the others hold intermediate sums.
+ * \param[in] nparts Number of partials
+ * \param[in] width Doubles per partial
+ * \param[in] stride Doubles from the start of one partial to the next
+ * \param[in,out] parts Partials
+ */
+void
+DeterministicSum::pairwise_reduce (
+   unsigned int nparts,
+   unsigned int width,
+   unsigned int stride,
+   double * parts)
+{
+   for (unsigned int step = 1; step < nparts; step *= 2) {
+      for (unsigned int ii = 0; ii + step < nparts; ii += 2 * step) {
+         double * dest = parts + ii * stride;
+         const double * src = parts + (ii + step) * stride;
+         for (unsigned int kk = 0; kk < width; ++kk) {
+            dest[kk] += src[kk];
+         }
+      }
+   }
+}
+
+
+/**
+ * Sum per-task partials in index order with Neumaier compensated
+ * summation. Slower than pairwise_reduce but more accurate when the
+ * partials cancel.
+ * \param[in] nparts Number of partials
+ * \param[in] width Doubles per partial
+ * \param[in] stride Doubles from the start of one partial to the next
+ * \param[in] parts Partials
+ * \param[out] result Total, width doubles
+ */
+void
+DeterministicSum::compensated_reduce (
+   unsigned int nparts,
+   unsigned int width,
+   unsigned int stride,
+   const double * parts,
+   double * result)
+{
+   for (unsigned int kk = 0; kk < width; ++kk) {
+      CompensatedSum sum;
+      for (unsigned int ii = 0; ii < nparts; ++ii) {
+         sum.add (parts[ii * stride + kk]);
+      }
+      result[kk] = sum.get_sum ();
+   }
+}
+
+
+/**
+ * Sum an array of values with a fixed pairwise tree, without modifying the
+ * array. The association is that of pairwise_reduce.
+ * @return Sum of the values
+ * \param[in] num Number of values
+ * \param[in] values Values
+ */
+double
+DeterministicSum::pairwise_sum (
+   unsigned int num,
+   const double * values)
+{
+   if (num == 0) {
+      return 0.0;
+   }
+   if (num == 1) {
+      return values[0];
+   }
+
+   // Split at the largest power of two below num, which reproduces the
+   // association of pairwise_reduce.
+   unsigned int half = 1;
+   while (2 * half < num) {
+      half *= 2;
+   }
+   return pairwise_sum (half, values) +
+          pairwise_sum (num - half, values + half);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,570 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/src/matrix3x3_batch.cc
+ * Define the static methods of the class Matrix3x3Batch.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Library dependencies:
+    ((matrix3x3_batch.cc))
+
+
+*******************************************************************************/
+
+
+// Model includes
+#include "../include/matrix3x3_batch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/*******************************************************************************
+
+  Each loop body loads one matrix per operand into a local 3x3 array,
+  forms the result with the helpers below, and stores it. The helpers
+  reproduce the element expressions of Matrix3x3::product and friends.
+  Once inlined, the locals live in registers and each loop vectorizes
+  across elements.
+
+*******************************************************************************/
+
+namespace {
+
+/**
+ * Load matrix i from SoA element arrays.
+ * \param[in]  soa Element arrays
+ * \param[in]  ii  Matrix index
+ * \param[out] mat Matrix
+ */
+inline void
+load (
+   double const * const soa[3][3],
+   unsigned int ii,
+   double mat[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         mat[jj][kk] = soa[jj][kk][ii];
+      }
+   }
+}
+
+
+/**
+ * Store matrix i into SoA element arrays.
+ * \param[in]  mat Matrix
+ * \param[in]  ii  Matrix index
+ * \param[out] soa Element arrays
+ */
+inline void
+store (
+   const double mat[3][3],
+   unsigned int ii,
+   double * const soa[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         soa[jj][kk][ii] = mat[jj][kk];
+      }
+   }
+}
+
+
+/**
+ * Load lane l of an AoSoA block.
+ * \param[in]  block Block
+ * \param[in]  ll    Lane
+ * \param[out] mat   Matrix
+ */
+inline void
+load (
+   const Matrix3x3Batch::Block & block,
+   unsigned int ll,
+   double mat[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         mat[jj][kk] = block[jj][kk][ll];
+      }
+   }
+}
+
+
+/**
+ * Store lane l of an AoSoA block.
+ * \param[in]  mat   Matrix
+ * \param[in]  ll    Lane
+ * \param[out] block Block
+ */
+inline void
+store (
+   const double mat[3][3],
+   unsigned int ll,
+   Matrix3x3Batch::Block & block)
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         block[jj][kk][ll] = mat[jj][kk];
+      }
+   }
+}
+
+
+/**
+ * Compute P = L * R.
+ * \param[in]  L Left operand
+ * \param[in]  R Right operand
+ * \param[out] P Product; must not alias L or R
+ */
+inline void
+multiply (
+   const double L[3][3],
+   const double R[3][3],
+   double P[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         P[jj][kk] = L[jj][0] * R[0][kk] +
+                     L[jj][1] * R[1][kk] +
+                     L[jj][2] * R[2][kk];
+      }
+   }
+}
+
+
+/**
+ * Compute P = L^T * R.
+ * \param[in]  L Left operand
+ * \param[in]  R Right operand
+ * \param[out] P Product; must not alias L or R
+ */
+inline void
+multiply_left_transpose (
+   const double L[3][3],
+   const double R[3][3],
+   double P[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         P[jj][kk] = L[0][jj] * R[0][kk] +
+                     L[1][jj] * R[1][kk] +
+                     L[2][jj] * R[2][kk];
+      }
+   }
+}
+
+
+/**
+ * Compute P = L * R^T.
+ * \param[in]  L Left operand
+ * \param[in]  R Right operand
+ * \param[out] P Product; must not alias L or R
+ */
+inline void
+multiply_right_transpose (
+   const double L[3][3],
+   const double R[3][3],
+   double P[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         P[jj][kk] = L[jj][0] * R[kk][0] +
+                     L[jj][1] * R[kk][1] +
+                     L[jj][2] * R[kk][2];
+      }
+   }
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Copy matrices, copy[i] = mat[i]
+ * \param[in] num Number of matrices
+ * \param[in] mat Source matrices
+ * \param[out] copy Copied matrices
+ */
+void
+Matrix3x3Batch::copy (
+   unsigned int num,
+   double const * const mat[3][3],
+   double * const copy[3][3])
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         const double * src = mat[jj][kk];
+         double * dest = copy[jj][kk];
+         for (unsigned int ii = 0; ii < num; ++ii) {
+            dest[ii] = src[ii];
+         }
+      }
+   }
+}
+
+
+/**
+ * Transpose matrices, trans[i] = mat[i]^T
+ * \param[in] num Number of matrices
+ * \param[in] mat Source matrices
+ * \param[out] trans Transposed matrices
+ */
+void
+Matrix3x3Batch::transpose (
+   unsigned int num,
+   double const * const mat[3][3],
+   double * const trans[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double M[3][3];
+      load (mat, ii, M);
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            trans[jj][kk][ii] = M[kk][jj];
+         }
+      }
+   }
+}
+
+
+/**
+ * Multiply matrices, prod[i] = mat_left[i] * mat_right[i]
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operands
+ * \param[in] mat_right Right operands
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product (
+   unsigned int num,
+   double const * const mat_left[3][3],
+   double const * const mat_right[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double L[3][3];
+      double R[3][3];
+      double P[3][3];
+      load (mat_left, ii, L);
+      load (mat_right, ii, R);
+      multiply (L, R, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Multiply matrices by a common left matrix,
+ * prod[i] = mat_left * mat_right[i]
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operand
+ * \param[in] mat_right Right operands
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product (
+   unsigned int num,
+   double const mat_left[3][3],
+   double const * const mat_right[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double R[3][3];
+      double P[3][3];
+      load (mat_right, ii, R);
+      multiply (mat_left, R, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Multiply matrices by a common right matrix,
+ * prod[i] = mat_left[i] * mat_right
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operands
+ * \param[in] mat_right Right operand
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product (
+   unsigned int num,
+   double const * const mat_left[3][3],
+   double const mat_right[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double L[3][3];
+      double P[3][3];
+      load (mat_left, ii, L);
+      multiply (L, mat_right, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Multiply transposed matrices by matrices,
+ * prod[i] = mat_left[i]^T * mat_right[i]
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operands
+ * \param[in] mat_right Right operands
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product_left_transpose (
+   unsigned int num,
+   double const * const mat_left[3][3],
+   double const * const mat_right[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double L[3][3];
+      double R[3][3];
+      double P[3][3];
+      load (mat_left, ii, L);
+      load (mat_right, ii, R);
+      multiply_left_transpose (L, R, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Multiply matrices by transposed matrices,
+ * prod[i] = mat_left[i] * mat_right[i]^T
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operands
+ * \param[in] mat_right Right operands
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product_right_transpose (
+   unsigned int num,
+   double const * const mat_left[3][3],
+   double const * const mat_right[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double L[3][3];
+      double R[3][3];
+      double P[3][3];
+      load (mat_left, ii, L);
+      load (mat_right, ii, R);
+      multiply_right_transpose (L, R, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Transform matrices by a common transformation,
+ * prod[i] = trans * mat[i] * trans^T
+ * \param[in] num Number of matrices
+ * \param[in] trans Transformation matrix
+ * \param[in] mat Matrices to transform
+ * \param[out] prod Transformed matrices
+ */
+void
+Matrix3x3Batch::transform_matrix (
+   unsigned int num,
+   double const trans[3][3],
+   double const * const mat[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double M[3][3];
+      double temp[3][3];
+      double P[3][3];
+      load (mat, ii, M);
+      multiply (trans, M, temp);
+      multiply_right_transpose (temp, trans, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Transform matrices by the transpose of a common transformation,
+ * prod[i] = trans^T * mat[i] * trans
+ * \param[in] num Number of matrices
+ * \param[in] trans Transformation matrix
+ * \param[in] mat Matrices to transform
+ * \param[out] prod Transformed matrices
+ */
+void
+Matrix3x3Batch::transpose_transform_matrix (
+   unsigned int num,
+   double const trans[3][3],
+   double const * const mat[3][3],
+   double * const prod[3][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double M[3][3];
+      double temp[3][3];
+      double P[3][3];
+      load (mat, ii, M);
+      multiply_left_transpose (trans, M, temp);
+      multiply (temp, trans, P);
+      store (P, ii, prod);
+   }
+}
+
+
+/**
+ * Pack matrices into AoSoA blocks. Padding lanes in the last block are set
+ * to the identity so that they stay well-conditioned in any later product.
+ * \param[in] num Number of matrices
+ * \param[in] mat Matrices
+ * \param[out] blocks Blocks, Vector3Batch::num_blocks(num) long
+ */
+void
+Matrix3x3Batch::pack (
+   unsigned int num,
+   double const mat[][3][3],
+   Block * blocks)
+{
+   const unsigned int lanes = Vector3Batch::Lanes;
+   unsigned int nblocks = Vector3Batch::num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      for (unsigned int ll = 0; ll < lanes; ++ll) {
+         unsigned int ii = bb * lanes + ll;
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            for (unsigned int kk = 0; kk < 3; ++kk) {
+               blocks[bb][jj][kk][ll] =
+                  (ii < num) ? mat[ii][jj][kk] : ((jj == kk) ? 1.0 : 0.0);
+            }
+         }
+      }
+   }
+}
+
+
+/**
+ * Unpack matrices from AoSoA blocks.
+ * \param[in] num Number of matrices
+ * \param[in] blocks Blocks, Vector3Batch::num_blocks(num) long
+ * \param[out] mat Matrices
+ */
+void
+Matrix3x3Batch::unpack (
+   unsigned int num,
+   Block const * blocks,
+   double mat[][3][3])
+{
+   const unsigned int lanes = Vector3Batch::Lanes;
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      load (blocks[ii / lanes], ii % lanes, mat[ii]);
+   }
+}
+
+
+/**
+ * Multiply AoSoA matrices, prod[i] = mat_left[i] * mat_right[i]
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operands
+ * \param[in] mat_right Right operands
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product (
+   unsigned int num,
+   Block const * mat_left,
+   Block const * mat_right,
+   Block * prod)
+{
+   unsigned int nblocks = Vector3Batch::num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      for (unsigned int ll = 0; ll < Vector3Batch::Lanes; ++ll) {
+         double L[3][3];
+         double R[3][3];
+         double P[3][3];
+         load (mat_left[bb], ll, L);
+         load (mat_right[bb], ll, R);
+         multiply (L, R, P);
+         store (P, ll, prod[bb]);
+      }
+   }
+}
+
+
+/**
+ * Multiply AoSoA matrices by transposed matrices,
+ * prod[i] = mat_left[i] * mat_right[i]^T
+ * \param[in] num Number of matrices
+ * \param[in] mat_left Left operands
+ * \param[in] mat_right Right operands
+ * \param[out] prod Products
+ */
+void
+Matrix3x3Batch::product_right_transpose (
+   unsigned int num,
+   Block const * mat_left,
+   Block const * mat_right,
+   Block * prod)
+{
+   unsigned int nblocks = Vector3Batch::num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      for (unsigned int ll = 0; ll < Vector3Batch::Lanes; ++ll) {
+         double L[3][3];
+         double R[3][3];
+         double P[3][3];
+         load (mat_left[bb], ll, L);
+         load (mat_right[bb], ll, R);
+         multiply_right_transpose (L, R, P);
+         store (P, ll, prod[bb]);
+      }
+   }
+}
+
+
+/**
+ * Transform AoSoA matrices by a common transformation,
+ * prod[i] = trans * mat[i] * trans^T
+ * \param[in] num Number of matrices
+ * \param[in] trans Transformation matrix
+ * \param[in] mat Matrices to transform
+ * \param[out] prod Transformed matrices
+ */
+void
+Matrix3x3Batch::transform_matrix (
+   unsigned int num,
+   double const trans[3][3],
+   Block const * mat,
+   Block * prod)
+{
+   unsigned int nblocks = Vector3Batch::num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      for (unsigned int ll = 0; ll < Vector3Batch::Lanes; ++ll) {
+         double M[3][3];
+         double temp[3][3];
+         double P[3][3];
+         load (mat[bb], ll, M);
+         multiply (trans, M, temp);
+         multiply_right_transpose (temp, trans, P);
+         store (P, ll, prod[bb]);
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,478 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/src/occultation.cc
+ * Define the static methods of the class Occultation.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Library dependencies:
+    ((occultation.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cmath>
+
+// Model includes
+#include "../include/occultation.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/*******************************************************************************
+
+  The single-observer methods branch so that only the quantities needed for
+  the observer's case are computed. The batched methods compute the
+  quantities of every case with the same expressions and select the result,
+  so that their loops carry no branches; quantities computed for cases that
+  are not selected may be infinite or NaN and are discarded.
+
+*******************************************************************************/
+
+namespace {
+
+// Tolerance on the containment tests of the disk overlap, which protects
+// against the singularity of the overlap formula at coincident centers.
+const double containment_tolerance = 1.0e-12;
+
+
+/**
+ * Compute the area of intersection of two partially overlapping circles.
+ * @return Area of intersection
+ * \param[in] r_bottom Radius of the first circle
+ * \param[in] r_top Radius of the second circle
+ * \param[in] d_centers Distance between the centers
+ */
+inline double
+partial_overlap_area (
+   double r_bottom,
+   double r_top,
+   double d_centers)
+{
+   double d_c2    = d_centers * d_centers;
+   double r_t2    = r_top * r_top;
+   double r_b2    = r_bottom * r_bottom;
+   double diff_r2 = r_b2 - r_t2;
+
+   // Intersection angles (law of cosines).
+   double cos_bottom_ang = (d_c2 + diff_r2) / (2.0 * d_centers * r_bottom);
+   double bottom_ang     = std::acos (cos_bottom_ang);
+   double cos_top_ang    = (d_c2 - diff_r2) / (2.0 * d_centers * r_top);
+   double top_ang        = std::acos (cos_top_ang);
+
+   double top_area    = r_t2 * (top_ang - (std::sin (top_ang) * cos_top_ang));
+   double bottom_area =
+      r_b2 * (bottom_ang - (std::sin (bottom_ang) * cos_bottom_ang));
+   return top_area + bottom_area;
+}
+
+
+/**
+ * Conical shadow quantities shared by the single-observer and batched
+ * methods.
+ */
+struct ConicalTerms {
+   double r_perp_x_d;   //!< Off-axis distance times source-occulter distance
+   double outer_bound;  //!< Penumbral cone bound on r_perp_x_d
+   double inner_bound;  //!< Umbral cone bound on r_perp_x_d
+   double ang_ratio_2;  //!< Squared ratio of the angular radii
+};
+
+
+/**
+ * Compute the cone bounds of a conical shadow.
+ * \param[in] r_par Distance along the shadow axis
+ * \param[in] r_perp Distance off the shadow axis
+ * \param[in] d_source_to_occulter Source to occulter distance
+ * \param[in] occulter_radius Occulter radius
+ * \param[in] source_radius Source radius
+ * \param[out] terms Cone bounds
+ */
+inline void
+conical_bounds (
+   double r_par,
+   double r_perp,
+   double d_source_to_occulter,
+   double occulter_radius,
+   double source_radius,
+   ConicalTerms & terms)
+{
+   double r_plus  = occulter_radius + source_radius;
+   double r_minus = occulter_radius - source_radius;
+   double radius_x_d = occulter_radius * d_source_to_occulter;
+
+   terms.r_perp_x_d  = r_perp * d_source_to_occulter;
+   terms.outer_bound = (r_plus * r_par) + radius_x_d;
+   terms.inner_bound = (r_minus * r_par) + radius_x_d;
+}
+
+
+/**
+ * Compute the squared ratio of the occulter's to the source's angular radii.
+ * @return Squared angular radius ratio
+ * \param[in] r_mag_sq Squared occulter to observer distance
+ * \param[in] d_source_to_observer Source to observer distance
+ * \param[in] occulter_radius Occulter radius
+ * \param[in] source_radius Source radius
+ */
+inline double
+angular_ratio_sq (
+   double r_mag_sq,
+   double d_source_to_observer,
+   double occulter_radius,
+   double source_radius)
+{
+   double r_ratio = occulter_radius / source_radius;
+   double ang_ratio_2_a = r_ratio * d_source_to_observer;
+   return ang_ratio_2_a * ang_ratio_2_a / r_mag_sq;
+}
+
+
+/**
+ * Compute the illumination factor in the penumbra.
+ * @return Illumination factor
+ * \param[in] r_par Distance along the shadow axis
+ * \param[in] d_source_to_occulter Source to occulter distance
+ * \param[in] occulter_radius Occulter radius
+ * \param[in] source_radius Source radius
+ * \param[in] terms Cone bounds and angular radius ratio
+ */
+inline double
+penumbral_illumination (
+   double r_par,
+   double d_source_to_occulter,
+   double occulter_radius,
+   double source_radius,
+   const ConicalTerms & terms)
+{
+   double ang_ratio = std::sqrt (terms.ang_ratio_2);
+
+   // Fraction of partial eclipse from first contact (0) to totality (1);
+   // the numerator is common to both cases.
+   double delta = occulter_radius * d_source_to_occulter - terms.r_perp_x_d +
+                  (occulter_radius + source_radius) * r_par;
+
+   // Occulter with the larger angular size.
+   double larger = 1 - Occultation::eclipse_alpha (
+                          1 / ang_ratio,
+                          delta / (2 * source_radius * r_par));
+
+   // Occulter with the smaller angular size.
+   double smaller = 1 - terms.ang_ratio_2 *
+                    Occultation::eclipse_alpha (
+                       ang_ratio,
+                       delta / (2 * occulter_radius *
+                                (d_source_to_occulter + r_par)));
+
+   return (terms.ang_ratio_2 >= 1) ? larger : smaller;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Compute the area of intersection of two circles.
+ * @return Area of intersection
+ * \param[in] r_bottom Radius of the first circle
+ * \param[in] r_top Radius of the second circle
+ * \param[in] d_centers Distance between the centers
+ */
+double
+Occultation::circle_overlap_area (
+   double r_bottom,
+   double r_top,
+   double d_centers)
+{
+   // Disjoint circles.
+   if (d_centers > r_bottom + r_top) {
+      return 0.0;
+   }
+
+   // One circle contains the other.
+   if (r_bottom > r_top) {
+      if (d_centers < (r_bottom - r_top) + containment_tolerance) {
+         return M_PI * r_top * r_top;
+      }
+   }
+   else {
+      if (d_centers < (r_top - r_bottom) + containment_tolerance) {
+         return M_PI * r_bottom * r_bottom;
+      }
+   }
+
+   return partial_overlap_area (r_bottom, r_top, d_centers);
+}
+
+
+/**
+ * Compute the fraction of a source disk hidden by an occulting disk.
+ * The radii and separation are in any consistent measure, typically the
+ * angular radii and angular separation seen by the observer.
+ * @return Occluded fraction, 0 to 1
+ * \param[in] source_radius Source disk radius
+ * \param[in] occulter_radius Occulting disk radius
+ * \param[in] separation Distance between the disk centers
+ */
+double
+Occultation::occluded_fraction (
+   double source_radius,
+   double occulter_radius,
+   double separation)
+{
+   return circle_overlap_area (source_radius, occulter_radius, separation) /
+          (source_radius * source_radius * M_PI);
+}
+
+
+/**
+ * Compute the fractions of source disks hidden by occulting disks.
+ * \param[in] num Number of disk pairs
+ * \param[in] source_radius Source disk radii
+ * \param[in] occulter_radius Occulting disk radii
+ * \param[in] separation Distances between the disk centers
+ * \param[out] fraction Occluded fractions, 0 to 1
+ */
+void
+Occultation::occluded_fraction (
+   unsigned int num,
+   const double * source_radius,
+   const double * occulter_radius,
+   const double * separation,
+   double * fraction)
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double r_bottom = source_radius[ii];
+      double r_top = occulter_radius[ii];
+      double d_centers = separation[ii];
+
+      bool disjoint = d_centers > r_bottom + r_top;
+      bool bottom_larger = r_bottom > r_top;
+      bool top_inside =
+         d_centers < (r_bottom - r_top) + containment_tolerance;
+      bool bottom_inside =
+         d_centers < (r_top - r_bottom) + containment_tolerance;
+      double top_area = M_PI * r_top * r_top;
+      double bottom_area = M_PI * r_bottom * r_bottom;
+      double partial = partial_overlap_area (r_bottom, r_top, d_centers);
+
+      double area = bottom_larger ?
+                    (top_inside ? top_area : partial) :
+                    (bottom_inside ? bottom_area : partial);
+      area = disjoint ? 0.0 : area;
+
+      fraction[ii] = area / (r_bottom * r_bottom * M_PI);
+   }
+}
+
+
+/**
+ * Evaluate the empirical polynomial approximation to the eclipsed fraction
+ * of the smaller disk.
+ * @return Approximate eclipsed fraction
+ * \param[in] rho_adj Relative disk size, smaller over larger
+ * \param[in] delta Fraction of maximum eclipse achieved
+ */
+double
+Occultation::eclipse_alpha (
+   double rho_adj,
+   double delta)
+{
+   // Coefficients are empirically derived to provide close match
+   // to circular geometry.
+   double a3 =  0.758656 * rho_adj * rho_adj +
+               -0.0637441 * rho_adj -
+                1.08955;
+   double a2 = -1.2205 * rho_adj * rho_adj +
+                0.61815 * rho_adj +
+                1.62909;
+   double a1 =  0.43723 * rho_adj * rho_adj +
+               -0.52921 * rho_adj +
+                0.473649;
+   double a0 = -0.01242 * rho_adj * rho_adj * rho_adj +
+               -0.0036715 * rho_adj * rho_adj +
+                0.0150263 * rho_adj +
+               -0.0078259;
+   return a3 * delta * delta * delta +
+          a2 * delta * delta +
+          a1 * delta +
+          a0;
+}
+
+
+/**
+ * Classify an observer with respect to the conical shadow an occulter casts
+ * away from a source, and compute the illumination factor. The observer is
+ * assumed to be on the far side of the occulter from the source
+ * (r_par >= 0) and not at the occulter's center (r_mag_sq > 0).
+ * @return Shadow region
+ * \param[in] r_par Distance of the observer from the occulter along the
+ *            source to occulter direction\n Units: M
+ * \param[in] r_perp Distance of the observer from the shadow axis\n Units: M
+ * \param[in] r_mag_sq Squared occulter to observer distance\n Units: M2
+ * \param[in] d_source_to_occulter Source to occulter distance\n Units: M
+ * \param[in] d_source_to_observer Source to observer distance\n Units: M
+ * \param[in] occulter_radius Occulter radius\n Units: M
+ * \param[in] source_radius Source radius\n Units: M
+ * \param[out] illum_factor Unblocked fraction of the source
+ * \param[out] penumbra_distance Signed distance to the penumbral cone,
+ *             positive outside it\n Units: M
+ * \param[out] umbra_distance Signed distance to the umbral or antumbral
+ *             cone, positive outside it\n Units: M
+ */
+Occultation::Region
+Occultation::conical_shadow (
+   double r_par,
+   double r_perp,
+   double r_mag_sq,
+   double d_source_to_occulter,
+   double d_source_to_observer,
+   double occulter_radius,
+   double source_radius,
+   double & illum_factor,
+   double & penumbra_distance,
+   double & umbra_distance)
+{
+   ConicalTerms terms;
+   conical_bounds (r_par, r_perp, d_source_to_occulter,
+                   occulter_radius, source_radius, terms);
+
+   // Signed distances to the outer and inner shadow cones; the inner cone
+   // is the umbra ahead of its apex and the antumbra beyond it.
+   penumbra_distance =
+      (terms.r_perp_x_d - terms.outer_bound) / d_source_to_occulter;
+   umbra_distance =
+      (terms.r_perp_x_d - std::fabs (terms.inner_bound)) /
+      d_source_to_occulter;
+
+   if (terms.r_perp_x_d >= terms.outer_bound) {
+      illum_factor = 1;
+      return Lit;
+   }
+   if (terms.r_perp_x_d <= terms.inner_bound) {
+      illum_factor = 0;
+      return Umbral;
+   }
+
+   terms.ang_ratio_2 = angular_ratio_sq (
+                          r_mag_sq, d_source_to_observer,
+                          occulter_radius, source_radius);
+
+   if (terms.r_perp_x_d <= -terms.inner_bound) {
+      illum_factor = 1 - terms.ang_ratio_2;
+      return Antumbral;
+   }
+
+   illum_factor = penumbral_illumination (
+                     r_par, d_source_to_occulter,
+                     occulter_radius, source_radius, terms);
+   return Penumbral;
+}
+
+
+/**
+ * Compute the conical-shadow illumination factors of many observers with
+ * respect to each of several occulters. Observers on the near side of an
+ * occulter are fully lit by it. Positions are in any common frame.
+ * \param[in] num_obs Number of observers
+ * \param[in] observer Observer positions\n Units: M
+ * \param[in] num_occ Number of occulters
+ * \param[in] occulter Occulter positions\n Units: M
+ * \param[in] occulter_radius Occulter radii\n Units: M
+ * \param[in] source Source position\n Units: M
+ * \param[in] source_radius Source radius\n Units: M
+ * \param[out] illum_factor Illumination factors, num_occ blocks of num_obs,
+ *             block j holding the factors with respect to occulter j
+ */
+void
+Occultation::conical_shadow (
+   unsigned int num_obs,
+   double const * const observer[3],
+   unsigned int num_occ,
+   double const * const occulter[3],
+   const double * occulter_radius,
+   const double source[3],
+   double source_radius,
+   double * illum_factor)
+{
+   const double * obs_x = observer[0];
+   const double * obs_y = observer[1];
+   const double * obs_z = observer[2];
+   double src_x0 = source[0];
+   double src_y0 = source[1];
+   double src_z0 = source[2];
+
+   for (unsigned int jj = 0; jj < num_occ; ++jj) {
+      double occ_x = occulter[0][jj];
+      double occ_y = occulter[1][jj];
+      double occ_z = occulter[2][jj];
+      double radius = occulter_radius[jj];
+
+      // Shadow axis.
+      double axis_x = occ_x - src_x0;
+      double axis_y = occ_y - src_y0;
+      double axis_z = occ_z - src_z0;
+      double d_source_to_occ =
+         std::sqrt (axis_x * axis_x + axis_y * axis_y + axis_z * axis_z);
+      double inv_d = 1.0 / d_source_to_occ;
+      axis_x *= inv_d;
+      axis_y *= inv_d;
+      axis_z *= inv_d;
+
+      double * illum = illum_factor + static_cast<unsigned long> (jj) * num_obs;
+
+      for (unsigned int ii = 0; ii < num_obs; ++ii) {
+         double rel_x = obs_x[ii] - occ_x;
+         double rel_y = obs_y[ii] - occ_y;
+         double rel_z = obs_z[ii] - occ_z;
+         double src_x = obs_x[ii] - src_x0;
+         double src_y = obs_y[ii] - src_y0;
+         double src_z = obs_z[ii] - src_z0;
+
+         double r_par = rel_x * axis_x + rel_y * axis_y + rel_z * axis_z;
+         double r_mag_sq = rel_x * rel_x + rel_y * rel_y + rel_z * rel_z;
+         double r_perp_sq = r_mag_sq - r_par * r_par;
+         double r_perp = std::sqrt (r_perp_sq > 0.0 ? r_perp_sq : 0.0);
+         double d_source_to_obs =
+            std::sqrt (src_x * src_x + src_y * src_y + src_z * src_z);
+
+         ConicalTerms terms;
+         conical_bounds (r_par, r_perp, d_source_to_occ,
+                         radius, source_radius, terms);
+         terms.ang_ratio_2 = angular_ratio_sq (
+                                r_mag_sq, d_source_to_obs,
+                                radius, source_radius);
+         double penumbral = penumbral_illumination (
+                               r_par, d_source_to_occ,
+                               radius, source_radius, terms);
+
+         double value =
+            (terms.r_perp_x_d <= -terms.inner_bound) ?
+            1 - terms.ang_ratio_2 : penumbral;
+         value = (terms.r_perp_x_d <= terms.inner_bound) ? 0.0 : value;
+         value = (terms.r_perp_x_d >= terms.outer_bound) ? 1.0 : value;
+         value = (r_par < 0.0) ? 1.0 : value;
+
+         illum[ii] = value;
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,840 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Math
+ * @{
+ *
+ * @file models/utils/math/src/vector3_batch.cc
+ * Define the static methods of the class Vector3Batch.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Library dependencies:
+    ((vector3_batch.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cmath>
+
+// Model includes
+#include "../include/vector3_batch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/*******************************************************************************
+
+  Each loop body loads the inputs of one element into locals before storing
+  any output, so that outputs may alias inputs element for element. The
+  arithmetic in each body is that of the corresponding Vector3 method.
+
+  The AoSoA loops run over whole blocks and, within a block, over a
+  compile-time lane count, which lets the compiler emit full-width vector
+  code without a remainder loop.
+
+*******************************************************************************/
+
+/**
+ * Zero-fill vectors, vec[k][i] = 0.0
+ * \param[in] num Number of vectors
+ * \param[out] vec Vectors
+ */
+void
+Vector3Batch::initialize (
+   unsigned int num,
+   double * const vec[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      double * comp = vec[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         comp[ii] = 0.0;
+      }
+   }
+}
+
+
+/**
+ * Copy vectors, copy[k][i] = vec[k][i]
+ * \param[in] num Number of vectors
+ * \param[in] vec Source vectors
+ * \param[out] copy Copied vectors
+ */
+void
+Vector3Batch::copy (
+   unsigned int num,
+   double const * const vec[3],
+   double * const copy[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      const double * src = vec[kk];
+      double * dest = copy[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         dest[ii] = src[ii];
+      }
+   }
+}
+
+
+/**
+ * Compute inner products, result[i] = vec1[i] . vec2[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec1 First vectors
+ * \param[in] vec2 Second vectors
+ * \param[out] result Inner products
+ */
+void
+Vector3Batch::dot (
+   unsigned int num,
+   double const * const vec1[3],
+   double const * const vec2[3],
+   double * result)
+{
+   const double * ax = vec1[0];
+   const double * ay = vec1[1];
+   const double * az = vec1[2];
+   const double * bx = vec2[0];
+   const double * by = vec2[1];
+   const double * bz = vec2[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      result[ii] = ax[ii] * bx[ii] + ay[ii] * by[ii] + az[ii] * bz[ii];
+   }
+}
+
+
+/**
+ * Compute squared magnitudes, result[i] = vec[i] . vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors
+ * \param[out] result Squared magnitudes
+ */
+void
+Vector3Batch::vmagsq (
+   unsigned int num,
+   double const * const vec[3],
+   double * result)
+{
+   const double * vx = vec[0];
+   const double * vy = vec[1];
+   const double * vz = vec[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      result[ii] = vx[ii] * vx[ii] + vy[ii] * vy[ii] + vz[ii] * vz[ii];
+   }
+}
+
+
+/**
+ * Compute magnitudes, result[i] = sqrt(vmagsq(vec[i]))
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors
+ * \param[out] result Magnitudes
+ */
+void
+Vector3Batch::vmag (
+   unsigned int num,
+   double const * const vec[3],
+   double * result)
+{
+   const double * vx = vec[0];
+   const double * vy = vec[1];
+   const double * vz = vec[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      result[ii] = std::sqrt (vx[ii] * vx[ii] + vy[ii] * vy[ii] +
+                              vz[ii] * vz[ii]);
+   }
+}
+
+
+/**
+ * Normalize vectors in-place, vec[i] = vec[i] / vmag(vec[i]).
+ * As with Vector3::normalize, a vector of zero magnitude is set to zero.
+ * \param[in] num Number of vectors
+ * \param[in,out] vec Vectors
+ */
+void
+Vector3Batch::normalize (
+   unsigned int num,
+   double * const vec[3])
+{
+   double * vx = vec[0];
+   double * vy = vec[1];
+   double * vz = vec[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double mag = std::sqrt (vx[ii] * vx[ii] + vy[ii] * vy[ii] +
+                              vz[ii] * vz[ii]);
+      // Select rather than branch so the loop stays vectorizable.
+      double positive = (mag > 0.0) ? 1.0 : 0.0;
+      double scale = positive / ((mag > 0.0) ? mag : 1.0);
+      vx[ii] *= scale;
+      vy[ii] *= scale;
+      vz[ii] *= scale;
+   }
+}
+
+
+/**
+ * Scale vectors by a common scalar, prod[i] = scalar * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors
+ * \param[in] scalar Scale factor
+ * \param[out] prod Scaled vectors
+ */
+void
+Vector3Batch::scale (
+   unsigned int num,
+   double const * const vec[3],
+   double scalar,
+   double * const prod[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      const double * src = vec[kk];
+      double * dest = prod[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         dest[ii] = src[ii] * scalar;
+      }
+   }
+}
+
+
+/**
+ * Scale vectors by per-vector scalars, prod[i] = scalar[i] * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors
+ * \param[in] scalar Scale factors
+ * \param[out] prod Scaled vectors
+ */
+void
+Vector3Batch::scale (
+   unsigned int num,
+   double const * const vec[3],
+   double const * scalar,
+   double * const prod[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      const double * src = vec[kk];
+      double * dest = prod[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         dest[ii] = src[ii] * scalar[ii];
+      }
+   }
+}
+
+
+/**
+ * Add vectors, sum[i] = vec1[i] + vec2[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec1 First vectors
+ * \param[in] vec2 Second vectors
+ * \param[out] sum Sums
+ */
+void
+Vector3Batch::sum (
+   unsigned int num,
+   double const * const vec1[3],
+   double const * const vec2[3],
+   double * const sum[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      const double * src1 = vec1[kk];
+      const double * src2 = vec2[kk];
+      double * dest = sum[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         dest[ii] = src1[ii] + src2[ii];
+      }
+   }
+}
+
+
+/**
+ * Subtract vectors, diff[i] = vec1[i] - vec2[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec1 Minuends
+ * \param[in] vec2 Subtrahends
+ * \param[out] diff Differences
+ */
+void
+Vector3Batch::diff (
+   unsigned int num,
+   double const * const vec1[3],
+   double const * const vec2[3],
+   double * const diff[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      const double * src1 = vec1[kk];
+      const double * src2 = vec2[kk];
+      double * dest = diff[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         dest[ii] = src1[ii] - src2[ii];
+      }
+   }
+}
+
+
+/**
+ * Increment vectors with scaled vectors, prod[i] += scalar * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors to be scaled
+ * \param[in] scalar Scale factor
+ * \param[in,out] prod Incremented vectors
+ */
+void
+Vector3Batch::scale_incr (
+   unsigned int num,
+   double const * const vec[3],
+   double scalar,
+   double * const prod[3])
+{
+   for (unsigned int kk = 0; kk < 3; ++kk) {
+      const double * src = vec[kk];
+      double * dest = prod[kk];
+      for (unsigned int ii = 0; ii < num; ++ii) {
+         dest[ii] += scalar * src[ii];
+      }
+   }
+}
+
+
+/**
+ * Compute cross products, prod[i] = vec_left[i] x vec_right[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec_left Left operands
+ * \param[in] vec_right Right operands
+ * \param[out] prod Cross products
+ */
+void
+Vector3Batch::cross (
+   unsigned int num,
+   double const * const vec_left[3],
+   double const * const vec_right[3],
+   double * const prod[3])
+{
+   const double * ax = vec_left[0];
+   const double * ay = vec_left[1];
+   const double * az = vec_left[2];
+   const double * bx = vec_right[0];
+   const double * by = vec_right[1];
+   const double * bz = vec_right[2];
+   double * px = prod[0];
+   double * py = prod[1];
+   double * pz = prod[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double a0 = ax[ii];
+      double a1 = ay[ii];
+      double a2 = az[ii];
+      double b0 = bx[ii];
+      double b1 = by[ii];
+      double b2 = bz[ii];
+      px[ii] = a1 * b2 - a2 * b1;
+      py[ii] = a2 * b0 - a0 * b2;
+      pz[ii] = a0 * b1 - a1 * b0;
+   }
+}
+
+
+/**
+ * Compute cross products with a common left operand,
+ * prod[i] = vec_left x vec_right[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec_left Left operand
+ * \param[in] vec_right Right operands
+ * \param[out] prod Cross products
+ */
+void
+Vector3Batch::cross (
+   unsigned int num,
+   double const vec_left[3],
+   double const * const vec_right[3],
+   double * const prod[3])
+{
+   const double a0 = vec_left[0];
+   const double a1 = vec_left[1];
+   const double a2 = vec_left[2];
+   const double * bx = vec_right[0];
+   const double * by = vec_right[1];
+   const double * bz = vec_right[2];
+   double * px = prod[0];
+   double * py = prod[1];
+   double * pz = prod[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double b0 = bx[ii];
+      double b1 = by[ii];
+      double b2 = bz[ii];
+      px[ii] = a1 * b2 - a2 * b1;
+      py[ii] = a2 * b0 - a0 * b2;
+      pz[ii] = a0 * b1 - a1 * b0;
+   }
+}
+
+
+/**
+ * Transform vectors by a common matrix, prod[i] = tmat * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrix
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform (
+   unsigned int num,
+   double const tmat[3][3],
+   double const * const vec[3],
+   double * const prod[3])
+{
+   const double t00 = tmat[0][0], t01 = tmat[0][1], t02 = tmat[0][2];
+   const double t10 = tmat[1][0], t11 = tmat[1][1], t12 = tmat[1][2];
+   const double t20 = tmat[2][0], t21 = tmat[2][1], t22 = tmat[2][2];
+   const double * vx = vec[0];
+   const double * vy = vec[1];
+   const double * vz = vec[2];
+   double * px = prod[0];
+   double * py = prod[1];
+   double * pz = prod[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double v0 = vx[ii];
+      double v1 = vy[ii];
+      double v2 = vz[ii];
+      px[ii] = t00 * v0 + t01 * v1 + t02 * v2;
+      py[ii] = t10 * v0 + t11 * v1 + t12 * v2;
+      pz[ii] = t20 * v0 + t21 * v1 + t22 * v2;
+   }
+}
+
+
+/**
+ * Transform vectors by the transpose of a common matrix,
+ * prod[i] = tmat^T * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrix
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform_transpose (
+   unsigned int num,
+   double const tmat[3][3],
+   double const * const vec[3],
+   double * const prod[3])
+{
+   const double t00 = tmat[0][0], t01 = tmat[0][1], t02 = tmat[0][2];
+   const double t10 = tmat[1][0], t11 = tmat[1][1], t12 = tmat[1][2];
+   const double t20 = tmat[2][0], t21 = tmat[2][1], t22 = tmat[2][2];
+   const double * vx = vec[0];
+   const double * vy = vec[1];
+   const double * vz = vec[2];
+   double * px = prod[0];
+   double * py = prod[1];
+   double * pz = prod[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double v0 = vx[ii];
+      double v1 = vy[ii];
+      double v2 = vz[ii];
+      px[ii] = t00 * v0 + t10 * v1 + t20 * v2;
+      py[ii] = t01 * v0 + t11 * v1 + t21 * v2;
+      pz[ii] = t02 * v0 + t12 * v1 + t22 * v2;
+   }
+}
+
+
+/**
+ * Transform vectors by per-vector matrices, prod[i] = tmat[i] * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrices, Matrix3x3Batch SoA layout
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform (
+   unsigned int num,
+   double const * const tmat[3][3],
+   double const * const vec[3],
+   double * const prod[3])
+{
+   const double * t00 = tmat[0][0];
+   const double * t01 = tmat[0][1];
+   const double * t02 = tmat[0][2];
+   const double * t10 = tmat[1][0];
+   const double * t11 = tmat[1][1];
+   const double * t12 = tmat[1][2];
+   const double * t20 = tmat[2][0];
+   const double * t21 = tmat[2][1];
+   const double * t22 = tmat[2][2];
+   const double * vx = vec[0];
+   const double * vy = vec[1];
+   const double * vz = vec[2];
+   double * px = prod[0];
+   double * py = prod[1];
+   double * pz = prod[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double v0 = vx[ii];
+      double v1 = vy[ii];
+      double v2 = vz[ii];
+      px[ii] = t00[ii] * v0 + t01[ii] * v1 + t02[ii] * v2;
+      py[ii] = t10[ii] * v0 + t11[ii] * v1 + t12[ii] * v2;
+      pz[ii] = t20[ii] * v0 + t21[ii] * v1 + t22[ii] * v2;
+   }
+}
+
+
+/**
+ * Transform vectors by the transposes of per-vector matrices,
+ * prod[i] = tmat[i]^T * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrices, Matrix3x3Batch SoA layout
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform_transpose (
+   unsigned int num,
+   double const * const tmat[3][3],
+   double const * const vec[3],
+   double * const prod[3])
+{
+   const double * t00 = tmat[0][0];
+   const double * t01 = tmat[0][1];
+   const double * t02 = tmat[0][2];
+   const double * t10 = tmat[1][0];
+   const double * t11 = tmat[1][1];
+   const double * t12 = tmat[1][2];
+   const double * t20 = tmat[2][0];
+   const double * t21 = tmat[2][1];
+   const double * t22 = tmat[2][2];
+   const double * vx = vec[0];
+   const double * vy = vec[1];
+   const double * vz = vec[2];
+   double * px = prod[0];
+   double * py = prod[1];
+   double * pz = prod[2];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double v0 = vx[ii];
+      double v1 = vy[ii];
+      double v2 = vz[ii];
+      px[ii] = t00[ii] * v0 + t10[ii] * v1 + t20[ii] * v2;
+      py[ii] = t01[ii] * v0 + t11[ii] * v1 + t21[ii] * v2;
+      pz[ii] = t02[ii] * v0 + t12[ii] * v1 + t22[ii] * v2;
+   }
+}
+
+
+/**
+ * Pack vectors into AoSoA blocks. Padding lanes in the last block are set
+ * to zero.
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors
+ * \param[out] blocks Blocks, num_blocks(num) long
+ */
+void
+Vector3Batch::pack (
+   unsigned int num,
+   double const vec[][3],
+   Block * blocks)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         unsigned int ii = bb * Lanes + ll;
+         for (unsigned int kk = 0; kk < 3; ++kk) {
+            blocks[bb][kk][ll] = (ii < num) ? vec[ii][kk] : 0.0;
+         }
+      }
+   }
+}
+
+
+/**
+ * Unpack vectors from AoSoA blocks.
+ * \param[in] num Number of vectors
+ * \param[in] blocks Blocks, num_blocks(num) long
+ * \param[out] vec Vectors
+ */
+void
+Vector3Batch::unpack (
+   unsigned int num,
+   Block const * blocks,
+   double vec[][3])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         vec[ii][kk] = blocks[ii / Lanes][kk][ii % Lanes];
+      }
+   }
+}
+
+
+/**
+ * Compute inner products of AoSoA vectors, result[i] = vec1[i] . vec2[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec1 First vectors
+ * \param[in] vec2 Second vectors
+ * \param[out] result Inner products, num_blocks(num)*Lanes long
+ */
+void
+Vector3Batch::dot (
+   unsigned int num,
+   Block const * vec1,
+   Block const * vec2,
+   double * result)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const Block & aa = vec1[bb];
+      const Block & cc = vec2[bb];
+      double * res = result + bb * Lanes;
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         res[ll] = aa[0][ll] * cc[0][ll] + aa[1][ll] * cc[1][ll] +
+                   aa[2][ll] * cc[2][ll];
+      }
+   }
+}
+
+
+/**
+ * Compute magnitudes of AoSoA vectors, result[i] = sqrt(vmagsq(vec[i]))
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors
+ * \param[out] result Magnitudes, num_blocks(num)*Lanes long
+ */
+void
+Vector3Batch::vmag (
+   unsigned int num,
+   Block const * vec,
+   double * result)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const Block & vv = vec[bb];
+      double * res = result + bb * Lanes;
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         res[ll] = std::sqrt (vv[0][ll] * vv[0][ll] + vv[1][ll] * vv[1][ll] +
+                              vv[2][ll] * vv[2][ll]);
+      }
+   }
+}
+
+
+/**
+ * Increment AoSoA vectors with scaled vectors, prod[i] += scalar * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec Vectors to be scaled
+ * \param[in] scalar Scale factor
+ * \param[in,out] prod Incremented vectors
+ */
+void
+Vector3Batch::scale_incr (
+   unsigned int num,
+   Block const * vec,
+   double scalar,
+   Block * prod)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const Block & vv = vec[bb];
+      Block & pp = prod[bb];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         for (unsigned int ll = 0; ll < Lanes; ++ll) {
+            pp[kk][ll] += scalar * vv[kk][ll];
+         }
+      }
+   }
+}
+
+
+/**
+ * Compute cross products of AoSoA vectors,
+ * prod[i] = vec_left[i] x vec_right[i]
+ * \param[in] num Number of vectors
+ * \param[in] vec_left Left operands
+ * \param[in] vec_right Right operands
+ * \param[out] prod Cross products
+ */
+void
+Vector3Batch::cross (
+   unsigned int num,
+   Block const * vec_left,
+   Block const * vec_right,
+   Block * prod)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const Block & aa = vec_left[bb];
+      const Block & cc = vec_right[bb];
+      Block & pp = prod[bb];
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         double a0 = aa[0][ll];
+         double a1 = aa[1][ll];
+         double a2 = aa[2][ll];
+         double b0 = cc[0][ll];
+         double b1 = cc[1][ll];
+         double b2 = cc[2][ll];
+         pp[0][ll] = a1 * b2 - a2 * b1;
+         pp[1][ll] = a2 * b0 - a0 * b2;
+         pp[2][ll] = a0 * b1 - a1 * b0;
+      }
+   }
+}
+
+
+/**
+ * Transform AoSoA vectors by a common matrix, prod[i] = tmat * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrix
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform (
+   unsigned int num,
+   double const tmat[3][3],
+   Block const * vec,
+   Block * prod)
+{
+   unsigned int nblocks = num_blocks (num);
+   const double t00 = tmat[0][0], t01 = tmat[0][1], t02 = tmat[0][2];
+   const double t10 = tmat[1][0], t11 = tmat[1][1], t12 = tmat[1][2];
+   const double t20 = tmat[2][0], t21 = tmat[2][1], t22 = tmat[2][2];
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const Block & vv = vec[bb];
+      Block & pp = prod[bb];
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         double v0 = vv[0][ll];
+         double v1 = vv[1][ll];
+         double v2 = vv[2][ll];
+         pp[0][ll] = t00 * v0 + t01 * v1 + t02 * v2;
+         pp[1][ll] = t10 * v0 + t11 * v1 + t12 * v2;
+         pp[2][ll] = t20 * v0 + t21 * v1 + t22 * v2;
+      }
+   }
+}
+
+
+/**
+ * Transform AoSoA vectors by the transpose of a common matrix,
+ * prod[i] = tmat^T * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrix
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform_transpose (
+   unsigned int num,
+   double const tmat[3][3],
+   Block const * vec,
+   Block * prod)
+{
+   unsigned int nblocks = num_blocks (num);
+   const double t00 = tmat[0][0], t01 = tmat[0][1], t02 = tmat[0][2];
+   const double t10 = tmat[1][0], t11 = tmat[1][1], t12 = tmat[1][2];
+   const double t20 = tmat[2][0], t21 = tmat[2][1], t22 = tmat[2][2];
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const Block & vv = vec[bb];
+      Block & pp = prod[bb];
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         double v0 = vv[0][ll];
+         double v1 = vv[1][ll];
+         double v2 = vv[2][ll];
+         pp[0][ll] = t00 * v0 + t10 * v1 + t20 * v2;
+         pp[1][ll] = t01 * v0 + t11 * v1 + t21 * v2;
+         pp[2][ll] = t02 * v0 + t12 * v1 + t22 * v2;
+      }
+   }
+}
+
+
+/**
+ * Transform AoSoA vectors by per-vector matrices,
+ * prod[i] = tmat[i] * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrices, Matrix3x3Batch blocks
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform (
+   unsigned int num,
+   double const (* tmat)[3][3][Lanes],
+   Block const * vec,
+   Block * prod)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const double (& tt)[3][3][Lanes] = tmat[bb];
+      const Block & vv = vec[bb];
+      Block & pp = prod[bb];
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         double v0 = vv[0][ll];
+         double v1 = vv[1][ll];
+         double v2 = vv[2][ll];
+         pp[0][ll] = tt[0][0][ll] * v0 + tt[0][1][ll] * v1 + tt[0][2][ll] * v2;
+         pp[1][ll] = tt[1][0][ll] * v0 + tt[1][1][ll] * v1 + tt[1][2][ll] * v2;
+         pp[2][ll] = tt[2][0][ll] * v0 + tt[2][1][ll] * v1 + tt[2][2][ll] * v2;
+      }
+   }
+}
+
+
+/**
+ * Transform AoSoA vectors by the transposes of per-vector matrices,
+ * prod[i] = tmat[i]^T * vec[i]
+ * \param[in] num Number of vectors
+ * \param[in] tmat Transformation matrices, Matrix3x3Batch blocks
+ * \param[in] vec Source vectors
+ * \param[out] prod Transformed vectors
+ */
+void
+Vector3Batch::transform_transpose (
+   unsigned int num,
+   double const (* tmat)[3][3][Lanes],
+   Block const * vec,
+   Block * prod)
+{
+   unsigned int nblocks = num_blocks (num);
+
+   for (unsigned int bb = 0; bb < nblocks; ++bb) {
+      const double (& tt)[3][3][Lanes] = tmat[bb];
+      const Block & vv = vec[bb];
+      Block & pp = prod[bb];
+      for (unsigned int ll = 0; ll < Lanes; ++ll) {
+         double v0 = vv[0][ll];
+         double v1 = vv[1][ll];
+         double v2 = vv[2][ll];
+         pp[0][ll] = tt[0][0][ll] * v0 + tt[1][0][ll] * v1 + tt[2][0][ll] * v2;
+         pp[1][ll] = tt[0][1][ll] * v0 + tt[1][1][ll] * v1 + tt[2][1][ll] * v2;
+         pp[2][ll] = tt[0][2][ll] * v0 + tt[1][2][ll] * v1 + tt[2][2][ll] * v2;
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -64,6 +64,7 @@ Purpose:
 namespace jeod {
 
 class MemoryManager;
+class StateSnapshot;
 
 
 } // End JEOD namespace
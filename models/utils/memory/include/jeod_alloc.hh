@@ -105,6 +105,7 @@ Purpose:
 
 // Model includes
 #include "jeod_alloc_get_allocated_pointer.hh"
+#include "jeod_alloc_rows.hh"
 #include "memory_manager.hh"
 
 /**
@@ -441,6 +442,62 @@ Purpose:
       JEOD_REGISTER_CLASS(type))
 
 
+/**
+ * \def JEOD_ALLOC_PRIM_MATRIX(nrows,ncols,type)
+ *   Allocate a row-indexed @a nrows by @a ncols array of the specified
+ *   primitive @a type as two allocations: a single zero-filled data block
+ *   holding all rows back to back, and an array of @a nrows row pointers into
+ *   that block. The result is indexed as <tt>matrix[row][col]</tt>.
+ *   Memory allocated with this macro must be freed with
+ *   JEOD_DELETE_PRIM_ROWS.
+ * \note The arguments should not be computed items; they are evaluated
+ *   more than once.
+ * \return         Row pointer array.
+ * \param nrows    Number of rows, which must be positive.
+ * \param ncols    Number of elements per row, which must be positive.
+ * \param type     The underlying type, which must be a C++ primitive type.
+ * \par Example:
+ *   <tt>
+ *   double ** matrix = JEOD_ALLOC_PRIM_MATRIX(3,4,double);
+ *   </tt>\n\n
+ *   This allocates a 3x4 array of doubles.
+ */
+#define JEOD_ALLOC_PRIM_MATRIX(nrows,ncols,type) \
+   jeod::jeod_alloc_link_rows<type> ( \
+      JEOD_ALLOC_PRIM_ARRAY (nrows, type *), \
+      JEOD_ALLOC_PRIM_ARRAY ( \
+         jeod::jeod_alloc_rows_size (nrows, ncols, 0), type), \
+      nrows, ncols, 0)
+
+
+/**
+ * \def JEOD_ALLOC_PRIM_TRIANGLE(nrows,extra,type)
+ *   Allocate a row-indexed lower triangular array of the specified primitive
+ *   @a type in which row @a ii holds <tt>ii+1+extra</tt> elements.
+ *   The storage layout is that of JEOD_ALLOC_PRIM_MATRIX: one zero-filled
+ *   data block plus one array of row pointers into it.
+ *   Memory allocated with this macro must be freed with
+ *   JEOD_DELETE_PRIM_ROWS.
+ * \note The arguments should not be computed items; they are evaluated
+ *   more than once.
+ * \return         Row pointer array.
+ * \param nrows    Number of rows, which must be positive.
+ * \param extra    Number of elements beyond the diagonal in each row.
+ * \param type     The underlying type, which must be a C++ primitive type.
+ * \par Example:
+ *   <tt>
+ *   double ** Cnm = JEOD_ALLOC_PRIM_TRIANGLE(degree+1,0,double);
+ *   </tt>\n\n
+ *   This allocates a triangle of doubles indexed as Cnm[n][m], 0<=m<=n.
+ */
+#define JEOD_ALLOC_PRIM_TRIANGLE(nrows,extra,type) \
+   jeod::jeod_alloc_link_rows<type> ( \
+      JEOD_ALLOC_PRIM_ARRAY (nrows, type *), \
+      JEOD_ALLOC_PRIM_ARRAY ( \
+         jeod::jeod_alloc_rows_size (nrows, (extra)+1, 1), type), \
+      nrows, (extra)+1, 1)
+
+
 /**
  * \def JEOD_ALLOC_CLASS_OBJECT(type,constr)
  *   Allocate @b one instance of the specified class. The supplied
@@ -533,6 +590,27 @@ Purpose:
       __FILE__, __LINE__)
 
 
+/**
+ * \def JEOD_SET_RECONSTRUCTIBLE(ptr,reference,reconstructor)
+ *   Mark the primitive data at @a ptr, allocated by some
+ *   <tt>JEOD_ALLOC_PRIM_xxx</tt> macro, as reconstructible: checkpoints
+ *   record @a reference and a hash of the contents in lieu of the contents,
+ *   and on restart @a reconstructor refills the recreated allocation.
+ * \param ptr           Memory to be marked.
+ * \param reference     String that identifies the data source across runs.
+ * \param reconstructor JeodCheckpointReconstructor that refills the memory.
+ * \par Example:
+ *   <tt>
+ *   table = JEOD_ALLOC_PRIM_ARRAY(size, double);\n
+ *   ...\n
+ *   JEOD_SET_RECONSTRUCTIBLE(table, "my_table:" + name, *this);
+ *   </tt>
+ */
+#define JEOD_SET_RECONSTRUCTIBLE(ptr,reference,reconstructor) \
+   jeod::JeodMemoryManager::set_reconstructible ( \
+      ptr, reference, reconstructor, __FILE__, __LINE__)
+
+
 /**
  * \def JEOD_DELETE_ARRAY(ptr)
  *   Free memory at @a ptr that was earlier allocated with some
@@ -549,6 +627,28 @@ Purpose:
 #define JEOD_DELETE_ARRAY(ptr) JEOD_DELETE_INTERNAL(ptr,true)
 
 
+/**
+ * \def JEOD_DELETE_PRIM_ROWS(ptr)
+ *   Free a row-indexed array that was earlier allocated with
+ *   JEOD_ALLOC_PRIM_MATRIX or JEOD_ALLOC_PRIM_TRIANGLE. Both the data block
+ *   and the row pointer array are released and @a ptr is set to null.
+ * \param ptr    Row pointer array to be released.
+ * \par Example:
+ *   <tt>
+ *   double ** matrix = JEOD_ALLOC_PRIM_MATRIX(3,4,double);\n
+ *   ...\n
+ *   JEOD_DELETE_PRIM_ROWS(matrix);
+ *   </tt>
+ */
+#define JEOD_DELETE_PRIM_ROWS(ptr) \
+   do { \
+      if (ptr != nullptr) { \
+         JEOD_DELETE_ARRAY (ptr[0]); \
+         JEOD_DELETE_ARRAY (ptr); \
+      } \
+   } while (0)
+
+
 /**
  * \def JEOD_DELETE_OBJECT(ptr)
  *   Free memory at @a ptr that was earlier allocated with some
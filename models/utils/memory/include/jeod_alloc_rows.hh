@@ -0,0 +1,171 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/include/jeod_alloc_rows.hh
+ * Define function templates that support the row-indexed array macros
+ * JEOD_ALLOC_PRIM_MATRIX and JEOD_ALLOC_PRIM_TRIANGLE.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+ 
+
+*******************************************************************************/
+
+#ifndef JEOD_ALLOC_ROWS_HH
+#define JEOD_ALLOC_ROWS_HH
+
+// Model headers
+
+// System headers
+#include <cstddef>
+
+//! Namespace jeod
+namespace jeod {
+
+/*
+ * Internal definitions
+ * These support the JEOD_ALLOC_PRIM_MATRIX and JEOD_ALLOC_PRIM_TRIANGLE
+ * macros. Use in any other context is caveat emptor.
+ */
+
+
+/**
+ * Compute the number of elements in a row-indexed array whose row ii
+ * contains row_base + ii*row_step elements.
+ * @return          Total number of elements in all rows.
+ * @param  nrows    Number of rows.
+ * @param  row_base Number of elements in row 0.
+ * @param  row_step Growth in row size from one row to the next.
+ */
+inline std::size_t
+jeod_alloc_rows_size (
+   std::size_t nrows,
+   std::size_t row_base,
+   std::size_t row_step)
+{
+   return nrows * row_base + row_step * ((nrows * (nrows - 1)) / 2);
+}
+
+
+/**
+ * Point the elements of a row pointer array at consecutive rows of a single
+ * data block, row ii containing row_base + ii*row_step elements.
+ * @tparam T        Element type.
+ * @return          The row pointer array.
+ * @param  rows     Row pointer array, nrows elements.
+ * @param  data     Data block, jeod_alloc_rows_size(nrows,...) elements.
+ * @param  nrows    Number of rows.
+ * @param  row_base Number of elements in row 0.
+ * @param  row_step Growth in row size from one row to the next.
+ *
+ * <b>Assumptions and limitations:</b>@n
+ *  - Both arrays were allocated with JEOD_ALLOC_PRIM_ARRAY. The row pointers
+ *    point inside the registered data block, so a checkpoint records them
+ *    as references into that block and a restart restores them as such.
+ */
+template<typename T>
+inline T **
+jeod_alloc_link_rows (
+   T ** rows,
+   T * data,
+   std::size_t nrows,
+   std::size_t row_base,
+   std::size_t row_step)
+{
+   std::size_t offset = 0;
+   for (std::size_t ii = 0; ii < nrows; ++ii) {
+      rows[ii] = data + offset;
+      offset += row_base + ii * row_step;
+   }
+   return rows;
+}
+
+
+/**
+ * Determine whether the rows of a row pointer array are laid out as
+ * jeod_alloc_link_rows lays them out: back to back from rows[0], row ii
+ * containing row_base + ii*row_step elements.
+ * @tparam T        Element type.
+ * @return          True if the rows are consecutive in one block.
+ * @param  rows     Row pointer array, nrows elements.
+ * @param  nrows    Number of rows.
+ * @param  row_base Number of elements in row 0.
+ * @param  row_step Growth in row size from one row to the next.
+ *
+ * <b>Assumptions and limitations:</b>@n
+ *  - This only checks the row pointers. The caller must also check that
+ *    rows[0] is the start of an allocation before freeing it as one block.
+ */
+template<typename T>
+inline bool
+jeod_alloc_rows_are_linked (
+   T * const * rows,
+   std::size_t nrows,
+   std::size_t row_base,
+   std::size_t row_step)
+{
+   if ((rows == nullptr) || (nrows == 0) || (rows[0] == nullptr)) {
+      return false;
+   }
+   for (std::size_t ii = 1; ii < nrows; ++ii) {
+      if (rows[ii] != rows[ii-1] + row_base + (ii-1) * row_step) {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
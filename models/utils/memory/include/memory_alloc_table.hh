@@ -0,0 +1,248 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/include/memory_alloc_table.hh
+ * Define the JeodMemoryAllocTable class, the memory manager's table of
+ * registered allocations.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The table is not thread-safe; the memory manager serializes access.)
+   (Registered blocks do not overlap.))
+
+Library dependencies:
+  ((../src/memory_alloc_table.cc))
+
+ 
+*******************************************************************************/
+
+#ifndef JEOD_MEMORY_ALLOC_TABLE_HH
+#define JEOD_MEMORY_ALLOC_TABLE_HH
+
+// Swig has no reason to poke into the memory model.
+#ifndef SWIG
+
+// System includes
+#include <cstddef>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "memory_item.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Maps the start addresses of registered allocations to the descriptions of
+ * those allocations.
+ *
+ * Exact lookups, insertions and deletions are the memory manager's hot path.
+ * They are served by an open-addressing hash table with linear probing, so
+ * their cost does not grow with the number of allocations.
+ *
+ * The memory manager also needs ordered queries: whether an address lies
+ * inside some block, and whether a new block overlaps a registered one.
+ * These are served by an address-sorted index of block starts, split into
+ * short sorted runs so that an insertion or deletion moves at most a few
+ * kilobytes of pointers. A query binary searches the run fronts and then
+ * one run, touching contiguous memory rather than chasing tree nodes.
+ *
+ * Iteration in address or allocation order is provided on demand through
+ * get_entries, which copies and sorts the live entries.
+ */
+class JeodMemoryAllocTable {
+JEOD_MAKE_SIM_INTERFACES(JeodMemoryAllocTable)
+
+public:
+
+   /**
+    * A registered allocation.
+    */
+   struct Entry {
+      const void * addr;   ///< Start of the block; null marks an empty slot
+      const void * end;    ///< One past the end of the block
+      JeodMemoryItem item; ///< Description of the block
+   };
+
+   /**
+    * Orderings available from get_entries.
+    */
+   enum SortOrder {
+      ByAddress  = 0, ///< Ascending start address
+      ByUniqueId = 1  ///< Ascending unique id, i.e., allocation order
+   };
+
+
+   // Default constructor.
+   JeodMemoryAllocTable ();
+
+   // Destructor.
+   ~JeodMemoryAllocTable ();
+
+   // Find the entry whose block starts at addr.
+   const Entry * find (const void * addr) const;
+
+   // Find the entry whose block contains addr.
+   const Entry * find_containing (const void * addr) const;
+
+   // Test whether [start,end) overlaps a registered block.
+   bool overlaps (const void * start, const void * end) const;
+
+   // Register a block.
+   bool insert (const void * addr, const void * end,
+                const JeodMemoryItem & item);
+
+   // Deregister the block that starts at addr.
+   bool erase (const void * addr);
+
+   // Remove all entries.
+   void clear ();
+
+   // Copy the live entries, sorted as requested.
+   void get_entries (SortOrder order, std::vector<Entry> & entries) const;
+
+   // Copy up to max_entries live entries spread over the table, unsorted.
+   void get_sample (std::size_t max_entries,
+                    std::vector<Entry> & entries) const;
+
+   /**
+    * Number of registered blocks.
+    * @return Table size
+    */
+   std::size_t size () const
+   {
+      return count;
+   }
+
+   /**
+    * Test whether the table is empty.
+    * @return True if no blocks are registered
+    */
+   bool empty () const
+   {
+      return count == 0;
+   }
+
+
+private:
+
+   // Home slot of an address.
+   std::size_t home_slot (const void * addr) const;
+
+   // Slot holding addr, or the empty slot where it would go.
+   std::size_t probe (const void * addr) const;
+
+   // Resize the slot array.
+   void rehash (std::size_t new_capacity);
+
+   // Index of the run that would hold addr.
+   std::size_t index_run (const void * addr) const;
+
+   // Add a block start to the sorted index.
+   void index_insert (const void * addr);
+
+   // Remove a block start from the sorted index.
+   void index_erase (const void * addr);
+
+   // Greatest indexed start at or below addr.
+   const void * index_floor (const void * addr) const;
+
+
+   /**
+    * Hash slots; the capacity is a power of two.
+    */
+   std::vector<Entry> slots; //!< trick_io(**)
+
+   /**
+    * Block starts in ascending order, as a sequence of non-empty sorted runs.
+    */
+   std::vector<std::vector<const void *> > index_runs; //!< trick_io(**)
+
+   /**
+    * First element of each run, kept contiguous for the top-level search.
+    */
+   std::vector<const void *> index_fronts; //!< trick_io(**)
+
+   /**
+    * Number of live entries.
+    */
+   std::size_t count; //!< trick_io(**)
+
+   /**
+    * Number of bits in the slot index.
+    */
+   unsigned int index_bits; //!< trick_io(**)
+
+
+   ///
+   /// Not implemented.
+   JeodMemoryAllocTable (const JeodMemoryAllocTable &);
+
+   ///
+   /// Not implemented.
+   JeodMemoryAllocTable & operator= (const JeodMemoryAllocTable &);
+};
+
+
+} // End JEOD namespace
+
+#endif // End of #ifndef SWIG
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
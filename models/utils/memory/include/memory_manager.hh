@@ -54,7 +54,10 @@ Purpose:
 Library dependencies:
   ((../src/memory_manager.cc)
    (../src/memory_manager_protected.cc)
-   (../src/memory_manager_static.cc))
+   (../src/memory_manager_static.cc)
+   (../src/memory_manager_threading.cc)
+   (../src/memory_alloc_table.cc)
+   (../src/memory_pool.cc))
 
  
 *******************************************************************************/
@@ -79,6 +82,7 @@ Library dependencies:
 #include <ostream>
 #include <string>
 #include <typeinfo>
+#include <vector>
 #include <pthread.h>
 
 // JEOD includes
@@ -89,7 +93,9 @@ Library dependencies:
 #include "utils/sim_interface/include/simulation_interface.hh"
 
 // Model includes
+#include "memory_alloc_table.hh"
 #include "memory_item.hh"
+#include "memory_pool.hh"
 #include "memory_table.hh"
 #include "memory_type.hh"
 
@@ -143,6 +149,45 @@ namespace jeod {
  *    data but do so without atomic protection. These methods are called
  *    only by _atomic methods from within their atomic protection block.
  *
+ * \par Threading Modes
+ * JeodMemoryManager::set_threading_mode selects how the above protection
+ * is provided.
+ *  - Multi_threaded (the default): A single mutex guards all tables.
+ *  - Single_threaded: The mutex is bypassed entirely. Select this only when
+ *    one thread allocates and frees JEOD memory.
+ *  - Sharded: Allocations are recorded in per-thread shards, each guarded by
+ *    its own mutex, and unique ids are handed out to each shard in blocks.
+ *    Type lookups are cached per thread. Threads therefore do not contend
+ *    with one another for the common operations. A free issued by a thread
+ *    other than the allocating one searches the other shards. The overlap
+ *    sanity check covers only the allocating thread's shard. The shards
+ *    are merged into the allocation table when leaving Sharded mode and at
+ *    shutdown (other than a fast shutdown), and restart snapshots span all
+ *    shards.
+ *  .
+ * The mode must be changed only while no other thread is using the
+ * memory model.
+ *
+ * \par Memory Pool
+ * Allocated buffers are drawn from the JeodMemoryPool rather than from
+ * the global heap. The pool's per-thread
+ * caches serve most requests without locking, so the mutex above is the
+ * only lock an allocation normally takes. Registration, checkpointing and
+ * leak reporting are unaffected: every allocation is still recorded in the
+ * allocation table.
+ *
+ * \par Shutdown Modes
+ * JeodMemoryManager::set_shutdown_mode selects what the destructor does with
+ * memory that was never freed.
+ *  - Full_shutdown (the default): Each unfreed allocation is deregistered
+ *    from the simulation engine, and the shutdown report lists them all in
+ *    address order.
+ *  - Fast_shutdown: Unfreed allocations are left registered with the
+ *    simulation engine, which is itself shutting down, and the tables are
+ *    released wholesale. The shutdown report lists at most leak_report_limit
+ *    of the leaks, sampled across the tables without sorting them.
+ *  .
+ *
  * \par Forbidden Word - Mutable
  * The data member JeodMemoryManager::mutex is mutable, a forbidden word
  * per the JEOD coding standards. The coding standards allow for waivers to
@@ -238,6 +283,44 @@ public:
       Demangled_type_name = 1  ///< Name is what people might use
    };
 
+   /**
+    * How operations on the allocation table are synchronized.
+    * See the class description.
+    */
+   enum ThreadingMode {
+      Multi_threaded  = 0, ///< One mutex guards all tables.
+      Single_threaded = 1, ///< No locking; a single thread uses the model.
+      Sharded         = 2  ///< Per-thread allocation tables.
+   };
+
+   /**
+    * What the memory manager does with unfreed memory at shutdown.
+    */
+   enum ShutdownMode {
+      Full_shutdown = 0, ///< Deregister each allocation; report every leak.
+      Fast_shutdown = 1  ///< Release the tables wholesale; sample the leaks.
+   };
+
+   /**
+    * An allocation recorded in a checkpoint file, to be restored on restart.
+    */
+   struct RestartAllocation {
+      /**
+       * Unique identifier of the allocation.
+       */
+      uint32_t unique_id; //!< trick_units(--)
+
+      /**
+       * Number of elements.
+       */
+      uint32_t nelements; //!< trick_units(--)
+
+      /**
+       * Was the allocation an array?
+       */
+      bool is_array; //!< trick_units(--)
+   };
+
    /**
     * The type table is indexed by an integer and contains type descriptors.
     * This class bundles the two together.
@@ -315,6 +398,18 @@ public:
       const char * elem_name,
       JeodCheckpointable & checkpointable);
 
+   // Mark an allocation as reconstructible rather than checkpointed.
+   static void set_reconstructible (
+      const void * addr,
+      const std::string & reference,
+      JeodCheckpointReconstructor & reconstructor,
+      const char * file,
+      unsigned int line);
+
+   // Forget a reconstructor that is about to be destroyed.
+   static void forget_reconstructor (
+      JeodCheckpointReconstructor & reconstructor);
+
    // Set the mode. This should only be called from the sim interface.
    static void set_mode (
       JeodSimulationInterface::Mode new_mode);
@@ -326,6 +421,19 @@ public:
    // Enable/disable guard words
    static void set_guard_enabled (bool value);
 
+   // Set/get the threading mode.
+   static void set_threading_mode (ThreadingMode new_mode);
+   static ThreadingMode get_threading_mode ();
+
+   // Set the shutdown mode.
+   static void set_shutdown_mode (ShutdownMode new_mode);
+
+   // Set the number of leaks listed by a fast shutdown.
+   static void set_leak_report_limit (unsigned int limit);
+
+   // Get the number of allocations made so far, from any thread.
+   static unsigned long long get_allocation_count ();
+
    // Testing interfaces
 
    // Query whether all allocated memory has been freed.
@@ -343,7 +451,7 @@ public:
    virtual ~JeodMemoryManager();
 
 
-   // The next two members are public for the sake of the simulation interface.
+   // The next three members are public for the sake of the simulation interface.
    // These are mondo dangerous. The sim interface knows what it is doing.
    // Everyone else: You do not know what you are doing. Do not call these.
    // Never! Never ever ever ever ever ever ever call these functions! Never!
@@ -358,6 +466,11 @@ public:
       uint32_t nelements,
       bool is_array);
 
+   // Restore allocations of one type as recorded in a checkpoint file.
+   void restart_reallocate (
+      const std::string & mangled_type_name,
+      const std::vector<RestartAllocation> & allocations);
+
 
 private:
 
@@ -366,13 +479,76 @@ private:
    /**
     * An AllocTable maps memory addresses to memory descriptions.
     */
-   typedef std::map <const void *, JeodMemoryItem> AllocTable;
+   typedef JeodMemoryAllocTable AllocTable;
 
    /**
     * The type type itself is a memory table with copy implemented by clone().
     */
    typedef JeodMemoryTableClonable<JeodMemoryTypeDescriptor> TypeTable;
 
+   /**
+    * Outcome of looking up an address in an allocation table.
+    */
+   enum AllocLookup {
+      Alloc_not_found = 0, ///< The address is in no registered block.
+      Alloc_found     = 1, ///< The address starts a registered block.
+      Alloc_inside    = 2  ///< The address is inside a registered block.
+   };
+
+   /**
+    * A slice of the allocation table used by some threads in Sharded mode.
+    */
+   struct AllocShard {
+      /**
+       * Mutex that synchronizes access to the shard.
+       */
+      pthread_mutex_t mutex; //!< trick_io(**)
+
+      /**
+       * Allocations registered through this shard.
+       */
+      AllocTable table; //!< trick_io(**)
+
+      /**
+       * Number of user bytes registered through this shard.
+       */
+      JEOD_SIZE_T cur_data_size; //!< trick_io(**)
+
+      /**
+       * Maximum value attained by cur_data_size.
+       */
+      JEOD_SIZE_T max_data_size; //!< trick_io(**)
+
+      /**
+       * Maximum value attained by table.size().
+       */
+      unsigned int max_table_size; //!< trick_io(**)
+
+      /**
+       * Next unused unique id in the block reserved by this shard.
+       */
+      uint32_t next_id; //!< trick_io(**)
+
+      /**
+       * One past the last unique id in the reserved block.
+       */
+      uint32_t end_id; //!< trick_io(**)
+
+      // Constructor and destructor.
+      AllocShard ();
+      ~AllocShard ();
+
+    private:
+
+      ///
+      /// Not implemented.
+      AllocShard (const AllocShard &);
+
+      ///
+      /// Not implemented.
+      AllocShard & operator= (const AllocShard &);
+   };
+
 
    // Static functions
 
@@ -388,6 +564,17 @@ private:
     */
    static JeodMemoryManager * Master; //!< trick_io(*o) trick_units(--)
 
+   /**
+    * Number of shards used in Sharded mode.
+    * Threads beyond this number share shards.
+    */
+   static const unsigned int num_shards = 32; //!< trick_io(**)
+
+   /**
+    * Number of unique ids a shard reserves at a time.
+    */
+   static const uint32_t shard_id_block_size = 256; //!< trick_io(**)
+
 
    // Member functions
 
@@ -433,6 +620,10 @@ private:
    void set_mode_internal (
       JeodSimulationInterface::Mode new_mode);
 
+   // Set the threading mode.
+   void set_threading_mode_internal (
+      ThreadingMode new_mode);
+
 
    // Even more private methods
 
@@ -474,6 +665,20 @@ private:
    const JeodMemoryTypeDescriptor & get_type_descriptor_nolock (
       const JeodMemoryItem & item) const;
 
+   // Look up a type in the calling thread's type cache.
+   bool get_cached_type_index (
+      const std::type_info & typeid_info,
+      uint32_t & idx) const;
+
+   // Add a type to the calling thread's type cache.
+   void cache_type_entry (
+      const std::type_info & typeid_info,
+      const TypeEntry & entry) const;
+
+   // Get the descriptor for a type index via the calling thread's cache.
+   const JeodMemoryTypeDescriptor & get_type_descriptor_cached (
+      uint32_t idx) const;
+
 
    // string_table accessors
 
@@ -496,6 +701,14 @@ private:
    void reset_alloc_id_atomic (
       uint32_t unique_id);
 
+   // Find and maybe delete an entry from some table.
+   static AllocLookup find_table_entry_nolock (
+      AllocTable & table,
+      JEOD_SIZE_T & data_size,
+      const void * addr,
+      bool delete_entry,
+      JeodMemoryItem & found_item);
+
    // Find and maybe delete an entry from the table
    void find_alloc_entry_atomic (
       const void * addr,
@@ -514,11 +727,65 @@ private:
       const char * file,
       unsigned int line);
 
-   // Delete the oldest entry in the table.
-   void delete_oldest_alloc_entry_atomic (
-      void *& addr,
-      JeodMemoryItem & item,
-      const JeodMemoryTypeDescriptor *& type);
+   // Copy the table entries in allocation order.
+   void get_alloc_entries_atomic (
+      std::vector<AllocTable::Entry> & entries);
+
+
+   // Shard accessors
+
+   // Get the calling thread's shard.
+   AllocShard & get_thread_shard () const;
+
+   // Reserve a block of unique identifiers.
+   uint32_t reserve_alloc_ids_atomic (
+      uint32_t count,
+      const char * file,
+      unsigned int line);
+
+   // Create a unique identifier for an allocation from a shard.
+   uint32_t get_shard_alloc_id_atomic (
+      AllocShard & shard,
+      const char * file,
+      unsigned int line);
+
+   // Find and maybe delete an entry from a shard.
+   AllocLookup find_shard_entry_atomic (
+      AllocShard & shard,
+      const void * addr,
+      bool delete_entry,
+      JeodMemoryItem & found_item);
+
+   // Record allocation of memory in a shard.
+   void add_shard_allocation_atomic (
+      AllocShard & shard,
+      const void * addr,
+      const JeodMemoryItem & item,
+      const JeodMemoryTypeDescriptor & tdesc,
+      const char * file,
+      unsigned int line);
+
+   // Copy the shard table entries.
+   void get_shard_entries_atomic (
+      AllocShard & shard,
+      std::vector<AllocTable::Entry> & entries);
+
+   // Discard the unique identifier blocks reserved by the shards.
+   void release_shard_ids_atomic ();
+
+   // Move the shard contents into the allocation table.
+   void merge_shards_nolock ();
+
+   // Fold the shard statistics into the manager's statistics.
+   void fold_shard_statistics_nolock ();
+
+   // Count the allocations in the table and the shards.
+   std::size_t count_allocations_nolock () const;
+
+   // Copy a sample of the allocations in the table and the shards.
+   void sample_allocations_nolock (
+      std::size_t max_entries,
+      std::vector<AllocTable::Entry> & entries) const;
 
 
    // Memory allocation/deallocation
@@ -611,6 +878,40 @@ private:
     */
    bool guard_enabled; //!< trick_units(--)
 
+   /**
+    * How operations on the allocation table are synchronized.
+    */
+   ThreadingMode threading_mode; //!< trick_io(*o) trick_units(--)
+
+   /**
+    * What the destructor does with unfreed memory.
+    * A fast shutdown neither deregisters unfreed memory from the simulation
+    * engine, which is itself shutting down, nor sorts the allocation table.
+    */
+   ShutdownMode shutdown_mode; //!< trick_units(--)
+
+   /**
+    * Maximum number of unfreed allocations listed by a fast shutdown.
+    */
+   unsigned int leak_report_limit; //!< trick_units(--)
+
+   /**
+    * Per-thread allocation tables, created on first entry to Sharded mode.
+    */
+   AllocShard * shards; //!< trick_io(**)
+
+   /**
+    * Identifies this manager's Sharded-mode session to the per-thread
+    * type caches; a new value invalidates every thread's cache.
+    */
+   unsigned int shard_epoch; //!< trick_io(**)
+
+   /**
+    * Identifies this manager to the per-type JeodMemoryTypeSlot caches;
+    * a slot filled by another manager is ignored.
+    */
+   unsigned int type_slot_epoch; //!< trick_io(**)
+
 
    // Deleted automagic content:
    // Default constructor, copy constructor, assignment operator.
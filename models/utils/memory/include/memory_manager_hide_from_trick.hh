@@ -68,7 +68,7 @@ namespace jeod {
 /**
  * An AllocTable maps memory addresses to memory descriptions.
  */
-typedef std::map <const void *, JeodMemoryItem> AllocTable;
+typedef JeodMemoryAllocTable AllocTable;
 
 /**
  * The type type itself is a memory table with copy implemented by clone().
@@ -0,0 +1,208 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/include/memory_pool.hh
+ * Define the JeodMemoryPool class, the size-class pool that backs the
+ * memory manager's low-level allocations, and an STL allocator that draws
+ * from it.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Blocks are released with the size they were allocated with.)
+   (Pooled memory is retained by the process once carved; it is reused but
+    not returned to the system.)
+   (Building with JEOD_MEMORY_DISABLE_POOL defined reverts to new[]/delete[]
+    so external memory checkers see every allocation.))
+
+Library dependencies:
+  ((../src/memory_pool.cc))
+
+ 
+*******************************************************************************/
+
+#ifndef JEOD_MEMORY_POOL_HH
+#define JEOD_MEMORY_POOL_HH
+
+// Swig has no reason to poke into the memory model.
+#ifndef SWIG
+
+// System includes
+#include <cstddef>
+#include <new>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Size-class memory pool with per-thread caches.
+ *
+ * Requests up to max_pooled_size bytes are rounded up to one of a small set
+ * of size classes. Each thread keeps a free list per size class and refills
+ * it in batches from a mutex-protected central free list, which in turn
+ * carves new blocks from large slabs. A typical allocation or release thus
+ * touches only the calling thread's cache. Larger requests go straight to
+ * new[] and delete[].
+ *
+ * The class is a stateless facade; all state lives in the translation unit
+ * so that the pool is usable before and after any static object's lifetime.
+ */
+class JeodMemoryPool {
+JEOD_MAKE_SIM_INTERFACES(JeodMemoryPool)
+
+public:
+
+   /**
+    * Largest request, in bytes, that is served from the pool.
+    */
+   static const std::size_t max_pooled_size = 4096;
+
+   // Allocate a buffer of at least size bytes, aligned for any type.
+   static void * allocate (std::size_t size);
+
+   // Release a buffer obtained from allocate with the same size.
+   static void release (void * buf, std::size_t size);
+
+
+private:
+
+   ///
+   /// Not implemented.
+   JeodMemoryPool ();
+};
+
+
+/**
+ * STL allocator that draws from the JeodMemoryPool.
+ * Node-based containers that churn at runtime use this to keep their node
+ * allocations off the global heap.
+ */
+template <typename T>
+class JeodPoolAllocator {
+public:
+
+   /**
+    * Element type.
+    */
+   typedef T value_type;
+
+   /**
+    * Default constructor.
+    */
+   JeodPoolAllocator () noexcept
+   { }
+
+   /**
+    * Converting constructor, needed for container rebinding.
+    */
+   template <typename U>
+   JeodPoolAllocator (const JeodPoolAllocator<U> &) noexcept
+   { }
+
+   /**
+    * Allocate storage for nelems objects.
+    * @return Uninitialized storage
+    * \param[in] nelems Number of objects
+    */
+   T * allocate (std::size_t nelems)
+   {
+      return static_cast<T *> (JeodMemoryPool::allocate (nelems * sizeof(T)));
+   }
+
+   /**
+    * Release storage obtained from allocate.
+    * \param[in] ptr Storage to release
+    * \param[in] nelems Number of objects, as passed to allocate
+    */
+   void deallocate (T * ptr, std::size_t nelems) noexcept
+   {
+      JeodMemoryPool::release (ptr, nelems * sizeof(T));
+   }
+
+   // The comparisons are hidden friends, found only by argument-dependent
+   // lookup, so that they do not hide other operator== overloads from
+   // unqualified lookup in namespace jeod.
+
+   /**
+    * All pool allocators are interchangeable.
+    */
+   template <typename U>
+   friend bool
+   operator== (const JeodPoolAllocator &, const JeodPoolAllocator<U> &)
+   {
+      return true;
+   }
+
+   /**
+    * All pool allocators are interchangeable.
+    */
+   template <typename U>
+   friend bool
+   operator!= (const JeodPoolAllocator &, const JeodPoolAllocator<U> &)
+   {
+      return false;
+   }
+};
+
+
+} // End JEOD namespace
+
+#endif // End of #ifndef SWIG
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -77,10 +77,12 @@ Purpose:
 #include "utils/sim_interface/include/memory_attributes.hh"
 
 // System includes
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <new>
 #include <string>
+#include <stdint.h>
 #include <typeinfo>
 #include <type_traits>
 
@@ -567,6 +569,33 @@ private:
 };
 
 
+/**
+ * A per-type cache of the memory manager's type table entry for a type.
+ * There is one slot per type, a static member of the
+ * JeodMemoryTypePreDescriptorDerived class template, so the JEOD_ALLOC
+ * macros can resolve a type that has already been registered without a
+ * string construction, a table lookup, or taking the table lock.
+ *
+ * A slot is valid only for the memory manager that filled it; the key
+ * carries that manager's identity. Slots have static storage duration and
+ * are thus zero-initialized, i.e., empty.
+ */
+struct JeodMemoryTypeSlot {
+
+   /**
+    * The identity of the memory manager that filled the slot in the upper
+    * 32 bits and the type table index in the lower 32 bits; zero if empty.
+    * Written after the descriptor, with release semantics.
+    */
+   std::atomic<uint64_t> key; // trick_io(**)
+
+   /**
+    * The type table's descriptor for the type.
+    */
+   std::atomic<const JeodMemoryTypeDescriptor *> descriptor; // trick_io(**)
+};
+
+
 /**
  * Abstract class for describing a type without necessarily needing
  * to create a JeodMemoryTypeDescriptor of that type. The intent is to
@@ -602,6 +631,12 @@ public:
     * @return Type descriptor.
     */
    virtual const JeodMemoryTypeDescriptor & get_descriptor () = 0;
+
+   /**
+    * Get the type's type table cache slot.
+    * @return The slot shared by all pre-descriptors of the type.
+    */
+   virtual JeodMemoryTypeSlot & get_type_slot () = 0;
 };
 
 /**
@@ -695,12 +730,32 @@ public:
       return *descriptor;
    }
 
+   /**
+    * Get the type's type table cache slot.
+    * @return The slot shared by all pre-descriptors of the type.
+    */
+   JeodMemoryTypeSlot & get_type_slot () override
+   {
+      return type_slot;
+   }
+
 private:
    TypeDescriptor * descriptor; // trick_io(**)
    bool is_exportable; // trick_io(**)
 
+   /**
+    * The type's type table cache slot.
+    */
+   static JeodMemoryTypeSlot type_slot; // trick_io(**)
+
 };
 
+/**
+ * The type's type table cache slot, zero-initialized (empty).
+ */
+template <typename Type>
+JeodMemoryTypeSlot JeodMemoryTypePreDescriptorDerived<Type>::type_slot;
+
 
 } // End JEOD namespace
 
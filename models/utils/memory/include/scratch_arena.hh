@@ -0,0 +1,248 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/include/scratch_arena.hh
+ * Define the ScratchArena class, a bounded, aligned bump allocator for the
+ * temporary arrays of a computation.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((An arena is used by one thread at a time. Objects that are evaluated in
+    parallel each own an arena.)
+   (Allocations are released in the reverse order of allocation, by frame.))
+
+Library dependencies:
+  ((../src/scratch_arena.cc))
+
+ 
+*******************************************************************************/
+
+#ifndef JEOD_SCRATCH_ARENA_HH
+#define JEOD_SCRATCH_ARENA_HH
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Provides aligned temporary arrays of doubles from storage reserved ahead
+ * of time, in place of variable-length arrays on the stack.
+ *
+ * The owner reserves the arena's capacity when it learns its problem size,
+ * typically at initialization. Evaluations then open a Frame and carve
+ * their arrays with allocate(); closing the frame releases them. Each array
+ * starts on an alignment boundary, and allocation is a pointer bump, so the
+ * evaluations neither touch the heap nor grow the stack with the problem
+ * size. A request beyond the reserved capacity is a setup error.
+ */
+class ScratchArena {
+JEOD_MAKE_SIM_INTERFACES(ScratchArena)
+
+public:
+
+   /**
+    * Alignment of each array, in bytes: one cache line, which is also the
+    * widest SIMD register width.
+    */
+   static const std::size_t alignment = 64;
+
+   /**
+    * Number of doubles per alignment boundary.
+    */
+   static const std::size_t align_doubles = alignment / sizeof(double);
+
+
+   /**
+    * Releases the arrays allocated while it is in scope.
+    */
+   class Frame {
+   public:
+
+      /**
+       * Open a frame on an arena.
+       * \param[in,out] arena_in Arena
+       */
+      explicit Frame (ScratchArena & arena_in)
+      :
+         arena(arena_in),
+         mark(arena_in.used)
+      { }
+
+      /**
+       * Close the frame, releasing its arrays.
+       */
+      ~Frame ()
+      {
+         arena.used = mark;
+      }
+
+   private:
+
+      /**
+       * The arena.
+       */
+      ScratchArena & arena; //!< trick_io(**)
+
+      /**
+       * Arena usage when the frame was opened.
+       */
+      std::size_t mark; //!< trick_io(**)
+
+      // Not implemented.
+      Frame (const Frame &);
+      Frame & operator= (const Frame &);
+   };
+
+
+   /**
+    * Number of doubles an array of num doubles occupies in an arena.
+    * @return Padded size
+    * \param[in] num Array size
+    */
+   static std::size_t padded_size (std::size_t num)
+   {
+      return (num + align_doubles - 1) / align_doubles * align_doubles;
+   }
+
+
+   ScratchArena ();
+
+   ~ScratchArena ();
+
+   // Ensure capacity for arrays totaling num_doubles padded doubles.
+   void reserve (std::size_t num_doubles);
+
+   /**
+    * Allocate an aligned array from the arena.
+    * @return Uninitialized array
+    * \param[in] num Array size
+    */
+   double * allocate (std::size_t num)
+   {
+      std::size_t size = padded_size (num);
+      if (used + size > capacity) {
+         report_overflow (num);
+      }
+      double * array = aligned_base() + used;
+      used += size;
+      return array;
+   }
+
+   /**
+    * Get the reserved capacity, in doubles.
+    * @return Capacity
+    */
+   std::size_t get_capacity () const
+   {
+      return capacity;
+   }
+
+   /**
+    * Get the capacity in use, in doubles.
+    * @return Usage
+    */
+   std::size_t get_used () const
+   {
+      return used;
+   }
+
+
+private:
+
+   /**
+    * Get the first aligned element of the storage.
+    * The alignment is computed on each use so that copies of an arena
+    * remain valid.
+    * @return Aligned base
+    */
+   double * aligned_base ()
+   {
+      std::uintptr_t addr = reinterpret_cast<std::uintptr_t> (storage.data());
+      std::uintptr_t skip = (alignment - addr % alignment) % alignment;
+      return storage.data() + skip / sizeof(double);
+   }
+
+   // Report a request beyond the reserved capacity.
+   void report_overflow (std::size_t num) const;
+
+   /**
+    * Backing storage, with room to align its start.
+    */
+   std::vector<double> storage; //!< trick_io(**)
+
+   /**
+    * Usable capacity, in doubles.
+    */
+   std::size_t capacity; //!< trick_io(**)
+
+   /**
+    * Capacity in use, in doubles.
+    */
+   std::size_t used; //!< trick_io(**)
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,226 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/include/state_snapshot.hh
+ * Define the StateSnapshot class, an in-memory image of a set of registered
+ * memory regions that can be saved and restored by copying.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The registered regions hold plain data that can be copied byte for byte.
+    Objects with virtual functions or owning pointers are registered member
+    by member or array by array.)
+   (The regions must remain allocated from registration until the snapshot
+    is cleared.))
+
+Library dependencies:
+  ((../src/state_snapshot.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_STATE_SNAPSHOT_HH
+#define JEOD_STATE_SNAPSHOT_HH
+
+// System includes
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Saves and restores a set of memory regions, for "propagate ahead,
+ * evaluate, roll back" use cases such as maneuver planning.
+ *
+ * Models register the regions that hold their mutable state with
+ * add_region(), typically via an add_snapshot_regions() method, along with
+ * any actions needed to make derived data consistent after a restore.
+ * save() then copies every region into the snapshot's buffer and restore()
+ * copies them back and runs the restore actions. Both are a sequence of
+ * memcpy calls: there is no name lookup, no allocation after the first
+ * save, and no serialization, which makes a snapshot far cheaper than a
+ * checkpoint. Adjacent regions are merged as they are registered.
+ *
+ * A snapshot describes the regions as they were registered. Anything that
+ * allocates or frees state (adding or removing a body, recreating an
+ * integrator) requires the snapshot to be cleared and the regions to be
+ * registered again.
+ */
+class StateSnapshot {
+JEOD_MAKE_SIM_INTERFACES(StateSnapshot)
+
+public:
+
+   StateSnapshot ();
+
+   ~StateSnapshot ();
+
+   // Register a memory region.
+   void add_region (void * address, std::size_t size);
+
+   /**
+    * Register an object that can be copied byte for byte.
+    * \param[in] item The object
+    */
+   template<typename Type>
+   void add_item (Type & item)
+   {
+      add_region (&item, sizeof(Type));
+   }
+
+   /**
+    * Register an array of objects that can be copied byte for byte.
+    * \param[in] items The first object
+    * \param[in] count Number of objects
+    */
+   template<typename Type>
+   void add_array (Type * items, std::size_t count)
+   {
+      add_region (items, count * sizeof(Type));
+   }
+
+   // Register an action to be run after each restore.
+   void add_restore_action (const std::function<void ()> & action);
+
+   // Forget the registered regions, restore actions, and saved image.
+   void clear ();
+
+   // Copy the registered regions into the snapshot.
+   void save ();
+
+   // Copy the saved image back into the registered regions.
+   void restore ();
+
+   /**
+    * Has an image been saved?
+    * @return True if restore() can be called
+    */
+   bool is_saved () const
+   {
+      return saved;
+   }
+
+   /**
+    * Get the number of registered regions, after merging.
+    * @return Number of regions
+    */
+   std::size_t get_num_regions () const
+   {
+      return regions.size();
+   }
+
+   /**
+    * Get the size of the saved image.
+    * @return Size, in bytes
+    */
+   std::size_t get_size () const
+   {
+      return size;
+   }
+
+
+private:
+
+   /**
+    * A registered region and its place in the image.
+    */
+   struct Region {
+      char * address;      //!< Start of the region
+      std::size_t size;    //!< Size of the region, in bytes
+      std::size_t offset;  //!< Offset of the region in the image
+   };
+
+   /**
+    * The registered regions, in registration order.
+    */
+   std::vector<Region> regions; //!< trick_io(**)
+
+   /**
+    * Actions run after each restore.
+    */
+   std::vector<std::function<void ()> > restore_actions; //!< trick_io(**)
+
+   /**
+    * The saved image.
+    */
+   std::vector<char> image; //!< trick_io(**)
+
+   /**
+    * Total size of the registered regions, in bytes.
+    */
+   std::size_t size; //!< trick_io(**)
+
+   /**
+    * True when the image holds a save of the registered regions.
+    */
+   bool saved; //!< trick_io(**)
+
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+   StateSnapshot (const StateSnapshot &);
+   StateSnapshot & operator= (const StateSnapshot &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
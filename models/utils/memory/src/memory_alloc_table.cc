@@ -0,0 +1,528 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/src/memory_alloc_table.cc
+ * Implement the JeodMemoryAllocTable class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((memory_alloc_table.cc)
+   (memory_item.cc))
+
+ 
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdint.h>
+
+// Model includes
+#include "../include/memory_alloc_table.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Log2 of the initial slot count.
+ */
+const unsigned int min_index_bits = 6;
+
+/**
+ * Length at which a run of the sorted index is split in two.
+ */
+const std::size_t max_run_size = 512;
+
+
+/**
+ * Order entries by start address.
+ */
+bool
+address_less (
+   const JeodMemoryAllocTable::Entry & a,
+   const JeodMemoryAllocTable::Entry & b)
+{
+   return std::less<const void *>() (a.addr, b.addr);
+}
+
+
+/**
+ * Order entries by unique id.
+ */
+bool
+unique_id_less (
+   const JeodMemoryAllocTable::Entry & a,
+   const JeodMemoryAllocTable::Entry & b)
+{
+   return a.item.get_unique_id() < b.item.get_unique_id();
+}
+
+} // End anonymous namespace
+
+
+/**
+ * JeodMemoryAllocTable default constructor.
+ */
+JeodMemoryAllocTable::JeodMemoryAllocTable (
+   void)
+:
+   slots(),
+   index_runs(),
+   index_fronts(),
+   count(0),
+   index_bits(0)
+{
+   rehash (std::size_t(1) << min_index_bits);
+}
+
+
+/**
+ * JeodMemoryAllocTable destructor.
+ */
+JeodMemoryAllocTable::~JeodMemoryAllocTable (
+   void)
+{
+}
+
+
+/**
+ * Compute the home slot of an address.
+ * Allocations are at least 16-byte aligned, so the low bits carry no
+ * information; the rest are spread with a Fibonacci multiplier.
+ * @return Slot index
+ * \param[in] addr Block start
+ */
+std::size_t
+JeodMemoryAllocTable::home_slot (
+   const void * addr)
+const
+{
+   uint64_t key = static_cast<uint64_t> (reinterpret_cast<uintptr_t> (addr));
+   return static_cast<std::size_t> (
+      ((key >> 4) * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - index_bits));
+}
+
+
+/**
+ * Find the slot that holds addr or, if addr is not in the table,
+ * the empty slot that ends its probe sequence.
+ * @return Slot index
+ * \param[in] addr Block start
+ */
+std::size_t
+JeodMemoryAllocTable::probe (
+   const void * addr)
+const
+{
+   std::size_t mask = slots.size() - 1;
+   std::size_t idx = home_slot (addr);
+   while ((slots[idx].addr != nullptr) && (slots[idx].addr != addr)) {
+      idx = (idx + 1) & mask;
+   }
+   return idx;
+}
+
+
+/**
+ * Resize the slot array and reinsert the live entries.
+ * \param[in] new_capacity New slot count, a power of two
+ */
+void
+JeodMemoryAllocTable::rehash (
+   std::size_t new_capacity)
+{
+   std::vector<Entry> old_slots (new_capacity);
+   old_slots.swap (slots);
+   for (index_bits = 0;
+        (std::size_t(1) << index_bits) < new_capacity;
+        ++index_bits) {
+   }
+   for (std::size_t ii = 0; ii < old_slots.size(); ++ii) {
+      if (old_slots[ii].addr != nullptr) {
+         slots[probe (old_slots[ii].addr)] = old_slots[ii];
+      }
+   }
+}
+
+
+/**
+ * Find the entry whose block starts at addr.
+ * @return Entry, or null if addr is not a registered block start
+ * \param[in] addr Address
+ */
+const JeodMemoryAllocTable::Entry *
+JeodMemoryAllocTable::find (
+   const void * addr)
+const
+{
+   if (addr == nullptr) {
+      return nullptr;
+   }
+   const Entry & slot = slots[probe (addr)];
+   return (slot.addr != nullptr) ? &slot : nullptr;
+}
+
+
+/**
+ * Find the run of the sorted index that holds addr if addr is indexed:
+ * the last run whose front is at or below addr, or the first run.
+ * @return Run index; the index must not be empty
+ * \param[in] addr Address
+ */
+std::size_t
+JeodMemoryAllocTable::index_run (
+   const void * addr)
+const
+{
+   std::vector<const void *>::const_iterator iter =
+      std::upper_bound (index_fronts.begin(), index_fronts.end(), addr,
+                        std::less<const void *>());
+   return (iter != index_fronts.begin()) ?
+             static_cast<std::size_t> (iter - index_fronts.begin()) - 1 : 0;
+}
+
+
+/**
+ * Add a block start to the sorted index.
+ * \param[in] addr Block start, not already indexed
+ */
+void
+JeodMemoryAllocTable::index_insert (
+   const void * addr)
+{
+   std::less<const void *> less;
+
+   if (index_runs.empty()) {
+      index_runs.push_back (std::vector<const void *> (1, addr));
+      index_fronts.push_back (addr);
+      return;
+   }
+
+   std::size_t irun = index_run (addr);
+   std::vector<const void *> & run = index_runs[irun];
+   run.insert (std::upper_bound (run.begin(), run.end(), addr, less), addr);
+   index_fronts[irun] = run.front();
+
+   // Split long runs in half.
+   if (run.size() >= max_run_size) {
+      std::vector<const void *> upper (run.begin() + run.size() / 2,
+                                       run.end());
+      run.resize (run.size() / 2);
+      index_runs.insert (index_runs.begin() + irun + 1,
+                         std::vector<const void *>());
+      index_runs[irun + 1].swap (upper);
+      index_fronts.insert (index_fronts.begin() + irun + 1,
+                           index_runs[irun + 1].front());
+   }
+}
+
+
+/**
+ * Remove a block start from the sorted index.
+ * \param[in] addr Indexed block start
+ */
+void
+JeodMemoryAllocTable::index_erase (
+   const void * addr)
+{
+   std::less<const void *> less;
+
+   if (index_runs.empty()) {
+      return;
+   }
+
+   std::size_t irun = index_run (addr);
+   std::vector<const void *> & run = index_runs[irun];
+   std::vector<const void *>::iterator iter =
+      std::lower_bound (run.begin(), run.end(), addr, less);
+   if ((iter != run.end()) && (*iter == addr)) {
+      run.erase (iter);
+      if (run.empty()) {
+         index_runs.erase (index_runs.begin() + irun);
+         index_fronts.erase (index_fronts.begin() + irun);
+      }
+      else {
+         index_fronts[irun] = run.front();
+      }
+   }
+}
+
+
+/**
+ * Find the greatest indexed block start at or below addr.
+ * @return Block start, or null if there is none
+ * \param[in] addr Address
+ */
+const void *
+JeodMemoryAllocTable::index_floor (
+   const void * addr)
+const
+{
+   std::less<const void *> less;
+
+   if (index_runs.empty()) {
+      return nullptr;
+   }
+
+   const std::vector<const void *> & run = index_runs[index_run (addr)];
+   std::vector<const void *>::const_iterator iter =
+      std::upper_bound (run.begin(), run.end(), addr, less);
+   return (iter != run.begin()) ? *(iter - 1) : nullptr;
+}
+
+
+/**
+ * Find the entry whose block contains addr.
+ * Registered blocks do not overlap, so only the block with the greatest
+ * start at or below addr can contain it.
+ * @return Containing entry, or null if addr is in no registered block
+ * \param[in] addr Address
+ */
+const JeodMemoryAllocTable::Entry *
+JeodMemoryAllocTable::find_containing (
+   const void * addr)
+const
+{
+   const Entry * entry = find (addr);
+   if (entry != nullptr) {
+      return entry;
+   }
+
+   entry = find (index_floor (addr));
+   if ((entry != nullptr) && std::less<const void *>() (addr, entry->end)) {
+      return entry;
+   }
+
+   return nullptr;
+}
+
+
+/**
+ * Test whether the range [start,end) overlaps a registered block.
+ * @return True if some registered block overlaps the range
+ * \param[in] start Start of the range
+ * \param[in] end   One past the end of the range
+ */
+bool
+JeodMemoryAllocTable::overlaps (
+   const void * start,
+   const void * end)
+const
+{
+   std::less<const void *> less;
+
+   if (index_runs.empty()) {
+      return false;
+   }
+
+   std::size_t irun = index_run (start);
+   const std::vector<const void *> & run = index_runs[irun];
+   std::vector<const void *>::const_iterator iter =
+      std::lower_bound (run.begin(), run.end(), start, less);
+
+   // A block that starts inside the range overlaps it.
+   const void * next = nullptr;
+   if (iter != run.end()) {
+      next = *iter;
+   }
+   else if (irun + 1 < index_runs.size()) {
+      next = index_fronts[irun + 1];
+   }
+   if ((next != nullptr) && less (next, end)) {
+      return true;
+   }
+
+   // A block that starts before the range overlaps it if it extends past
+   // the start of the range.
+   if (iter != run.begin()) {
+      const Entry * prev = find (*(iter - 1));
+      if ((prev != nullptr) && less (start, prev->end)) {
+         return true;
+      }
+   }
+
+   return false;
+}
+
+
+/**
+ * Register a block.
+ * @return True if the block was added, false if addr was already registered
+ * \param[in] addr Block start
+ * \param[in] end  One past the end of the block
+ * \param[in] item Description of the block
+ */
+bool
+JeodMemoryAllocTable::insert (
+   const void * addr,
+   const void * end,
+   const JeodMemoryItem & item)
+{
+   if (addr == nullptr) {
+      return false;
+   }
+
+   // Keep the load factor at or below 5/8.
+   if ((count + 1) * 8 > slots.size() * 5) {
+      rehash (slots.size() * 2);
+   }
+
+   Entry & slot = slots[probe (addr)];
+   if (slot.addr != nullptr) {
+      return false;
+   }
+   slot.addr = addr;
+   slot.end  = end;
+   slot.item = item;
+   ++count;
+
+   index_insert (addr);
+
+   return true;
+}
+
+
+/**
+ * Deregister the block that starts at addr.
+ * Uses backward-shift deletion so that no tombstones accumulate.
+ * @return True if an entry was removed
+ * \param[in] addr Block start
+ */
+bool
+JeodMemoryAllocTable::erase (
+   const void * addr)
+{
+   if (addr == nullptr) {
+      return false;
+   }
+
+   std::size_t mask = slots.size() - 1;
+   std::size_t hole = probe (addr);
+   if (slots[hole].addr == nullptr) {
+      return false;
+   }
+
+   // Pull back each following entry whose probe sequence passes the hole.
+   for (std::size_t idx = (hole + 1) & mask;
+        slots[idx].addr != nullptr;
+        idx = (idx + 1) & mask) {
+      std::size_t home = home_slot (slots[idx].addr);
+      if (((idx - home) & mask) >= ((idx - hole) & mask)) {
+         slots[hole] = slots[idx];
+         hole = idx;
+      }
+   }
+   slots[hole].addr = nullptr;
+   --count;
+
+   index_erase (addr);
+
+   return true;
+}
+
+
+/**
+ * Remove all entries.
+ */
+void
+JeodMemoryAllocTable::clear (
+   void)
+{
+   std::vector<Entry>().swap (slots);
+   std::vector<std::vector<const void *> >().swap (index_runs);
+   std::vector<const void *>().swap (index_fronts);
+   count = 0;
+   rehash (std::size_t(1) << min_index_bits);
+}
+
+
+/**
+ * Copy the live entries into the supplied vector, sorted as requested.
+ * \param[in]  order   Sort order
+ * \param[out] entries Live entries
+ */
+void
+JeodMemoryAllocTable::get_entries (
+   SortOrder order,
+   std::vector<Entry> & entries)
+const
+{
+   entries.clear();
+   entries.reserve (count);
+   for (std::size_t ii = 0; ii < slots.size(); ++ii) {
+      if (slots[ii].addr != nullptr) {
+         entries.push_back (slots[ii]);
+      }
+   }
+   std::sort (entries.begin(), entries.end(),
+              (order == ByUniqueId) ? unique_id_less : address_less);
+}
+
+
+/**
+ * Copy a sample of the live entries into the supplied vector. The slot array
+ * is divided into max_entries strides and the first live entry in each
+ * stride is taken, so the cost is proportional to the sample size rather
+ * than to the table size. All entries are taken if there are no more than
+ * max_entries.
+ * \param[in]  max_entries Maximum number of entries to copy
+ * \param[out] entries     Sampled entries, in slot order
+ */
+void
+JeodMemoryAllocTable::get_sample (
+   std::size_t max_entries,
+   std::vector<Entry> & entries)
+const
+{
+   entries.clear();
+   if ((count == 0) || (max_entries == 0)) {
+      return;
+   }
+
+   std::size_t capacity = slots.size();
+   if (count <= max_entries) {
+      entries.reserve (count);
+      for (std::size_t ii = 0; ii < capacity; ++ii) {
+         if (slots[ii].addr != nullptr) {
+            entries.push_back (slots[ii]);
+         }
+      }
+      return;
+   }
+
+   entries.reserve (max_entries);
+   for (std::size_t kk = 0; kk < max_entries; ++kk) {
+      std::size_t begin = kk * capacity / max_entries;
+      std::size_t end = (kk + 1) * capacity / max_entries;
+      for (std::size_t ii = begin; ii < end; ++ii) {
+         if (slots[ii].addr != nullptr) {
+            entries.push_back (slots[ii]);
+            break;
+         }
+      }
+   }
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -17,9 +17,12 @@ Purpose:
 
 Library dependencies:
   ((memory_manager.cc)
+   (memory_alloc_table.cc)
    (memory_item.cc)
    (memory_messages.cc)
-   (memory_type.cc))
+   (memory_pool.cc)
+   (memory_type.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
  
 *******************************************************************************/
@@ -35,19 +38,23 @@ Library dependencies:
 #include <cstdlib>
 #include <iostream>
 #include <iomanip>
+#include <atomic>
 #include <map>
 #include <sstream>
 #include <typeinfo>
+#include <vector>
 #include <pthread.h>
 #include <stdint.h>
 
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/memory_manager.hh"
 #include "../include/memory_item.hh"
 #include "../include/memory_messages.hh"
+#include "../include/memory_pool.hh"
 
 
 #define MAGIC0 0x2203992c
@@ -57,6 +64,16 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Source of memory manager identities for the type slots.
+ * Zero is never issued.
+ */
+std::atomic<unsigned int> type_slot_epoch_source (0);
+
+} // End anonymous namespace
+
 /**
  * Construct a MemoryManager object.
  * \param[in,out] interface The memory interface with the simulation engine
@@ -74,7 +91,13 @@ JeodMemoryManager::JeodMemoryManager (
    type_table(),
    string_table(),
    mode(JeodSimulationInterface::Construction),
-   guard_enabled(true)
+   guard_enabled(true),
+   threading_mode(Multi_threaded),
+   shutdown_mode(Full_shutdown),
+   leak_report_limit(16),
+   shards(nullptr),
+   shard_epoch(0),
+   type_slot_epoch(0)
 {
    // Nominal case: There is no master memory manager yet.
    // This object will become that master memory manager.
@@ -84,6 +107,10 @@ JeodMemoryManager::JeodMemoryManager (
       // This is the master memory manager.
       Master = this;
 
+      // Claim a fresh identity so that type slots filled by an earlier
+      // master are not mistaken for this manager's.
+      type_slot_epoch = ++type_slot_epoch_source;
+
 
       // Populate the type table with commonly-used names for integer types.
       // This avoids someone overriding 'int' with 'int32_t' and such.
@@ -162,16 +189,39 @@ JeodMemoryManager::~JeodMemoryManager (
       // (With the mutex destroyed, unsafe operations are the only option.)
       pthread_mutex_destroy (&mutex);
 
+      // Fold any per-thread shards into the allocation table.
+      // A fast shutdown folds only their statistics.
+      if (threading_mode == Sharded) {
+         if (shutdown_mode == Fast_shutdown) {
+            fold_shard_statistics_nolock ();
+         }
+         else {
+            merge_shards_nolock ();
+         }
+      }
+
       // Report activity.
       generate_shutdown_report ();
 
+      delete[] shards;
+      shards = nullptr;
+
+      // A fast shutdown leaves the leaks registered with the simulation
+      // engine, which is shutting down as well, and lets the tables go with
+      // the manager.
+      if (shutdown_mode == Fast_shutdown) {
+         return;
+      }
+
       // Make leaks opaque to the simulation engine.
       // FUTURE_FEATURE: Garbage collect here?
-      for (AllocTable::iterator it = alloc_table.begin();
-           it != alloc_table.end();
+      std::vector<AllocTable::Entry> leaks;
+      alloc_table.get_entries (AllocTable::ByAddress, leaks);
+      for (std::vector<AllocTable::Entry>::const_iterator it = leaks.begin();
+           it != leaks.end();
            ++it) {
-         const void * addr           = it->first;
-         const JeodMemoryItem & item = it->second;
+         const void * addr           = it->addr;
+         const JeodMemoryItem & item = it->item;
          const JeodMemoryTypeDescriptor & tdesc =
             get_type_descriptor_nolock (item);
          if (item.get_is_registered()) {
@@ -201,12 +251,12 @@ JeodMemoryManager::generate_shutdown_report (
 {
    if (debug_level > 0) {
 
-      // FUTURE_FEATURE: Do a better job of counting.
-      // It would be nice to know the size of a red-black tree node.
-      unsigned int telem_size = sizeof (AllocTable::value_type);
+      // Table elements live in a hash table kept at most 5/8 full;
+      // the sorted index adds one pointer per element.
+      unsigned int telem_size = sizeof (AllocTable::Entry);
       unsigned int item_size  = sizeof (JeodMemoryItem);
       unsigned int  total_size = max_table_size *
-                                 (telem_size + item_size);
+                                 (telem_size * 8 / 5 + sizeof (void *));
 
       // Generate a summary report.
       MessageHandler::inform (
@@ -221,7 +271,9 @@ JeodMemoryManager::generate_shutdown_report (
 
       // Report any memory that has not been freed.
       // Note: This reports only. Unfreed memory is a leak.
-      if (alloc_table.empty()) {
+      // A fast shutdown lists only a sample of the leaks.
+      std::size_t num_leaks = count_allocations_nolock ();
+      if (num_leaks == 0) {
          MessageHandler::inform (
             __FILE__, __LINE__, MemoryMessages::debug,
             "All JEOD-allocated memory has been freed!");
@@ -231,11 +283,23 @@ JeodMemoryManager::generate_shutdown_report (
             __FILE__, __LINE__, MemoryMessages::corrupted_memory,
             "Not all JEOD-allocated memory has been freed!");
 
-         for (AllocTable::iterator it = alloc_table.begin();
-              it != alloc_table.end();
+         std::vector<AllocTable::Entry> leaks;
+         if (shutdown_mode == Fast_shutdown) {
+            sample_allocations_nolock (leak_report_limit, leaks);
+            MessageHandler::warn (
+               __FILE__, __LINE__, MemoryMessages::debug,
+               "Listing %u of %u unfreed allocations.",
+               static_cast<unsigned int> (leaks.size()),
+               static_cast<unsigned int> (num_leaks));
+         }
+         else {
+            alloc_table.get_entries (AllocTable::ByAddress, leaks);
+         }
+         for (std::vector<AllocTable::Entry>::const_iterator it = leaks.begin();
+              it != leaks.end();
               ++it) {
-            const void * addr           = it->first;
-            const JeodMemoryItem & item = it->second;
+            const void * addr           = it->addr;
+            const JeodMemoryItem & item = it->item;
             const JeodMemoryTypeDescriptor & tdesc =
                get_type_descriptor_nolock (item);
             unsigned int alloc_idx = item.get_alloc_index();
@@ -286,36 +350,51 @@ void
 JeodMemoryManager::restart_clear_memory (
    void)
 {
+   std::vector<AllocTable::Entry> entries;
    void * addr = nullptr;
    JeodMemoryItem item;
    const JeodMemoryTypeDescriptor * type = nullptr;
 
-   // Just keep a deletin' and destroyin' 'til nothing's left.
+   // Just keep a deletin' and destroyin' 'til nothing's left, oldest first.
+   // Destructors may free other entries in the snapshot or allocate new
+   // ones, so each entry is looked up (and removed) as it is reached, and
+   // the table is snapshot again until it comes up empty.
    // NOTE: This only works if we are using placement new.
-   for (delete_oldest_alloc_entry_atomic (addr, item, type);
-        addr != nullptr;
-        delete_oldest_alloc_entry_atomic (addr, item, type)) {
-
-      // De-register the item with the simulation engine.
-      if (item.get_is_registered()) {
-         sim_interface.deregister_allocation (
-            addr, item, *type, __FILE__, __LINE__);
-      }
+   for (get_alloc_entries_atomic (entries);
+        ! entries.empty();
+        get_alloc_entries_atomic (entries)) {
+      for (std::vector<AllocTable::Entry>::const_iterator it =
+              entries.begin();
+           it != entries.end();
+           ++it) {
+
+         find_alloc_entry_atomic (
+            it->addr, true, __FILE__, __LINE__, addr, item, type);
+         if (addr == nullptr) {
+            continue;
+         }
 
-      // Destruct and delete the item consistent with its creation.
-      type->destroy_memory (
-         item.get_placement_new(),
-         item.get_is_array(),
-         item.get_nelems(),
-         addr);
-
-      // Free memory that was allocated by this model for the item.
-      if (item.get_placement_new()) {
-         free_memory (addr,
-                      type->buffer_size (item.get_nelems()),
-                      item.get_is_guarded(),
-                      item.get_alloc_index(),
-                      __FILE__, __LINE__);
+         // De-register the item with the simulation engine.
+         if (item.get_is_registered()) {
+            sim_interface.deregister_allocation (
+               addr, item, *type, __FILE__, __LINE__);
+         }
+
+         // Destruct and delete the item consistent with its creation.
+         type->destroy_memory (
+            item.get_placement_new(),
+            item.get_is_array(),
+            item.get_nelems(),
+            addr);
+
+         // Free memory that was allocated by this model for the item.
+         if (item.get_placement_new()) {
+            free_memory (addr,
+                         type->buffer_size (item.get_nelems()),
+                         item.get_is_guarded(),
+                         item.get_alloc_index(),
+                         __FILE__, __LINE__);
+         }
       }
    }
    cur_data_size = 0;
@@ -341,31 +420,62 @@ JeodMemoryManager::restart_reallocate (
    uint32_t unique_id,
    uint32_t nelements,
    bool is_array)
+{
+   RestartAllocation allocation;
+   allocation.unique_id = unique_id;
+   allocation.nelements = nelements;
+   allocation.is_array = is_array;
+
+   restart_reallocate (
+      mangled_type_name, std::vector<RestartAllocation> (1, allocation));
+}
+
+
+/**
+ * Restore a batch of allocations of a single type per the checkpoint file.
+ * The type is looked up once for the whole batch.
+ *
+ * \par Assumptions and Limitations
+ *  - This restores the allocations, but not the contents. The contents will
+ *     soon be restored by the simulation engine.
+ * \param[in] mangled_type_name Mangled type name
+ * \param[in] allocations Allocations of that type
+ */
+void
+JeodMemoryManager::restart_reallocate (
+   const std::string & mangled_type_name,
+   const std::vector<RestartAllocation> & allocations)
 {
    TypeEntry tentry =
       get_type_entry_atomic (Typeid_type_name, mangled_type_name);
    const JeodMemoryTypeDescriptor * type = tentry.tdesc;
 
    if (type == nullptr) {
-      MessageHandler::error (
-         __FILE__, __LINE__, MemoryMessages::suspect_pointer,
-         "Unable to find type '%s' for jeod_alloc_%06d.\n"
-         "This object cannot be restored.",
-         mangled_type_name.c_str(), unique_id);
+      for (std::size_t ii = 0; ii < allocations.size(); ++ii) {
+         MessageHandler::error (
+            __FILE__, __LINE__, MemoryMessages::suspect_pointer,
+            "Unable to find type '%s' for jeod_alloc_%06d.\n"
+            "This object cannot be restored.",
+            mangled_type_name.c_str(), allocations[ii].unique_id);
+      }
       return;
    }
 
    std::size_t elem_size = type->get_size();
-   void * addr;
 
-   // Allocate and construct the object.
-   addr = allocate_memory (nelements, elem_size, guard_enabled, 0);
-   type->construct_array (nelements, addr);
+   for (std::size_t ii = 0; ii < allocations.size(); ++ii) {
+      const RestartAllocation & allocation = allocations[ii];
 
-   // Register with the simulation engine.
-   register_memory_internal (
-      addr, unique_id, true, is_array, nelements, tentry,
-      __FILE__, __LINE__);
+      // Allocate and construct the object.
+      void * addr = allocate_memory (
+                       allocation.nelements, elem_size, guard_enabled, 0);
+      type->construct_array (allocation.nelements, addr);
+
+      // Register with the simulation engine.
+      register_memory_internal (
+         addr, allocation.unique_id, true, allocation.is_array,
+         allocation.nelements, tentry, __FILE__, __LINE__);
+   }
 }
 
 
@@ -460,6 +570,8 @@ JeodMemoryManager::register_memory_internal (
    const char * file,
    unsigned int line)
 {
+   JEOD_PROFILE_SCOPE ("memory", "JeodMemoryManager::register_memory_internal");
+
    unsigned int alloc_idx = 0;
    uint32_t tidx = tentry.index;
    const JeodMemoryTypeDescriptor & tdesc = *(tentry.tdesc);
@@ -757,8 +869,8 @@ const
    // Compute the allocation buffer size, including guards.
    buf_len = length + start_offset + end_offset;
 
-   // Allocate the requisite amount of memory.
-   buf = new char[buf_len];
+   // Allocate the requisite amount of memory from the size-class pool.
+   buf = static_cast<char *> (JeodMemoryPool::allocate (buf_len));
 
    // Failure to allocate memory means either the program has consumed all
    // memory or the user asked for a huge amount.
@@ -868,9 +980,9 @@ const
       buf_len  = length;
    }
 
-   // Fill the buffer with garbage and free it.
+   // Fill the buffer with garbage and return it to the pool.
    std::memset (buf, 0xa5, buf_len);
-   delete[] buf;
+   JeodMemoryPool::release (buf, buf_len);
 }
 
 
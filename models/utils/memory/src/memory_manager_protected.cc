@@ -34,6 +34,8 @@ Library dependencies:
 
 // System includes
 #define __STDC_LIMIT_MACROS
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
@@ -41,6 +43,7 @@ Library dependencies:
 #include <map>
 #include <sstream>
 #include <typeinfo>
+#include <vector>
 #include <pthread.h>
 #include <stdint.h>
 
@@ -57,6 +60,22 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Order allocation table entries by unique id.
+ */
+bool
+entry_unique_id_less (
+   const JeodMemoryAllocTable::Entry & a,
+   const JeodMemoryAllocTable::Entry & b)
+{
+   return a.item.get_unique_id() < b.item.get_unique_id();
+}
+
+} // End anonymous namespace
+
+
 /*******************************************************************************
  * begin_atomic_block and end_atomic_block
  ******************************************************************************/
@@ -103,6 +122,11 @@ JeodMemoryManager::begin_atomic_block (
    void)
 const
 {
+   // Single-threaded mode: There is nothing to protect against.
+   if (threading_mode == Single_threaded) {
+      return;
+   }
+
    // Try to lock the mutex.
    int mutex_lock_status = pthread_mutex_lock (&mutex);
 
@@ -127,6 +151,11 @@ JeodMemoryManager::end_atomic_block (
    bool ignore_errors)
 const
 {
+   // Single-threaded mode: The mutex was not locked.
+   if (threading_mode == Single_threaded) {
+      return;
+   }
+
    // Try to unlock the mutex.
    int mutex_unlock_status = pthread_mutex_unlock (&mutex);
 
@@ -279,6 +308,10 @@ JeodMemoryManager::get_type_index_nolock (
  * Return the type entry for the input type descriptor, adding the
  * descriptor to the type table if the type has not yet been registered.
  *
+ * Repeat registrations of a type are served from the type's
+ * JeodMemoryTypeSlot without a lookup or the table lock. The slot is filled
+ * on the first registration of the type with this manager.
+ *
  * \par Assumptions and Limitations
  *  - The mangled name returned by the std::type_info name method is unique
  *     across all allocatable types and is invariant.
@@ -291,9 +324,25 @@ const JeodMemoryManager::TypeEntry
 JeodMemoryManager::get_type_entry_atomic (
    JeodMemoryTypePreDescriptor & tdesc)
 {
+   JeodMemoryTypeSlot & slot = tdesc.get_type_slot();
+   uint64_t slot_key = slot.key.load (std::memory_order_acquire);
+
+   // Registered with this manager: The slot holds the entry.
+   if ((slot_key >> 32) == type_slot_epoch) {
+      return TypeEntry (static_cast<uint32_t> (slot_key),
+                        slot.descriptor.load (std::memory_order_relaxed));
+   }
+
    const std::type_info & typeid_info = tdesc.get_typeid();
-   const std::string key (typeid_info.name());
    uint32_t index = 0;
+
+   // Sharded mode: Repeat registrations are served from the thread's cache.
+   if ((threading_mode == Sharded) &&
+       get_cached_type_index (typeid_info, index)) {
+      return TypeEntry (index, &get_type_descriptor_cached (index));
+   }
+
+   const std::string key (typeid_info.name());
    const JeodMemoryTypeDescriptor * table_tdesc = nullptr;
    bool added = false;
 
@@ -331,6 +380,15 @@ JeodMemoryManager::get_type_entry_atomic (
          table_tdesc->get_name().c_str());
    }
 
+   // Remember the type for the next registration. Table descriptors are
+   // never removed, so the slot stays valid for the life of this manager.
+   slot.descriptor.store (table_tdesc, std::memory_order_relaxed);
+   slot.key.store ((static_cast<uint64_t> (type_slot_epoch) << 32) | index,
+                   std::memory_order_release);
+   if (threading_mode == Sharded) {
+      cache_type_entry (typeid_info, TypeEntry (index, table_tdesc));
+   }
+
    // Return the found/added type index.
    return TypeEntry (index, table_tdesc);
 }
@@ -509,6 +567,32 @@ uint32_t
 JeodMemoryManager::get_alloc_id_atomic (
    const char * file,
    unsigned int line)
+{
+   // Sharded mode: Draw from the block reserved by the thread's shard.
+   if (threading_mode == Sharded) {
+      return get_shard_alloc_id_atomic (get_thread_shard(), file, line);
+   }
+
+   return reserve_alloc_ids_atomic (1, file, line);
+}
+
+
+/**
+ * Reserve a contiguous block of unique identifiers.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the map must be atomic.
+ *     This method satisfies that requirement.
+ * @return First identifier in the block, zero on failure
+ * \param[in] count Number of identifiers to reserve
+ * \param[in] file Source file containing JEOD_ALLOC
+ * \param[in] line Line number containing JEOD_ALLOC
+ */
+uint32_t
+JeodMemoryManager::reserve_alloc_ids_atomic (
+   uint32_t count,
+   const char * file,
+   unsigned int line)
 {
    uint32_t unique_id = 0;
 
@@ -516,12 +600,8 @@ JeodMemoryManager::get_alloc_id_atomic (
    try {
       begin_atomic_block ();
 
-      // Bump the allocation number.
-      ++allocation_number;
-
       // Check for overflow.
-      if ((allocation_number == UINT32_MAX) ||
-         (allocation_number == 0)) {
+      if (UINT32_MAX - allocation_number <= count) {
          end_atomic_block (true);
          MessageHandler::fail (
             __FILE__, __LINE__, MemoryMessages::corrupted_memory,
@@ -530,8 +610,11 @@ JeodMemoryManager::get_alloc_id_atomic (
          return unique_id;
       }
 
-      // The incremented allocation number is the unique identifier.
-      unique_id = allocation_number;
+      // The block starts just past the current allocation number.
+      unique_id = allocation_number + 1;
+
+      // Bump the allocation number.
+      allocation_number += count;
 
       end_atomic_block (false);
    }
@@ -571,6 +654,56 @@ JeodMemoryManager::reset_alloc_id_atomic (
       end_atomic_block (true);
       throw;
    }
+
+   // Sharded mode: Blocks reserved before the reset may now collide.
+   if (threading_mode == Sharded) {
+      release_shard_ids_atomic ();
+   }
+}
+
+
+/**
+ * Look up an address in an allocation table, deleting the matching entry
+ * if delete_entry is true.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the table must be atomic.
+ *     This method *does not* satisfy that requirement.
+ * @return Outcome of the lookup
+ * \param[in,out] table Allocation table
+ * \param[in,out] data_size Data size accounted to the table
+ * \param[in] addr Address
+ * \param[in] delete_entry Indicates entry is to be deleted
+ * \param[out] found_item Descriptor of the matching or containing entry
+ */
+JeodMemoryManager::AllocLookup
+JeodMemoryManager::find_table_entry_nolock (
+   AllocTable & table,
+   JEOD_SIZE_T & data_size,
+   const void * addr,
+   bool delete_entry,
+   JeodMemoryItem & found_item)
+{
+   const AllocTable::Entry * entry = table.find_containing (addr);
+
+   if (entry == nullptr) {
+      return Alloc_not_found;
+   }
+
+   found_item = entry->item;
+
+   if (entry->addr != addr) {
+      return Alloc_inside;
+   }
+
+   // Delete if requested to do so, updating the allocation statistics.
+   if (delete_entry) {
+      data_size -= static_cast<const char *> (entry->end) -
+                   static_cast<const char *> (entry->addr);
+      table.erase (addr);
+   }
+
+   return Alloc_found;
 }
 
 
@@ -613,77 +746,81 @@ JeodMemoryManager::find_alloc_entry_atomic (
    JeodMemoryItem & found_item,
    const JeodMemoryTypeDescriptor *& found_type)
 {
-   bool address_inside = false;
-   const void * test_addr = nullptr;
-   const JeodMemoryItem * test_item = nullptr;
+   AllocLookup result = Alloc_not_found;
+   JeodMemoryItem test_item;
    const JeodMemoryTypeDescriptor * test_type = nullptr;
 
    // Set the output values to indicate the address was not found.
    found_addr = nullptr;
    found_type = nullptr;
 
-   try {
-      begin_atomic_block ();
-
-      // Find first entry whose address is strictly greater than
-      // the subject address.
-      AllocTable::iterator iter = alloc_table.upper_bound (addr);
-
-      // There is no match if the upper bound is the beginning of the table.
-      // If the found iterator is not begin(), the entry before the found
-      // entry *might* be a match. It is:
-      // - A match if the input address and entry key are equal.
-      // - Not a match if the input address is outside of the memory space
-      //   represented by found entry.
-      // - A mismatch if the input address is inside the memory space
-      //   represented by found entry.
-      if (iter != alloc_table.begin()) {
-         --iter;
-         test_addr = iter->first;
-         test_item = &(iter->second);
-         test_type = &(get_type_descriptor_nolock (iter->second));
-
-         // Test as described above.
-         // Match: Set output values and delete if requested to do so.
-         if (addr == test_addr) {
-
-            // Set the outputs. Note that found_item is copied.
-            found_addr = const_cast<void *> (test_addr);
-            found_item = *test_item;
-            found_type = test_type;
-
-            // Delete if requested to do so.
-            if (delete_entry) {
-
-               // Update the allocation statistics.
-               cur_data_size -= found_type->buffer_size(found_item);
-
-               // Delete the entry.
-               alloc_table.erase (iter);
+   // Sharded mode: Search the calling thread's shard, then the others.
+   // An exact match anywhere trumps a pointer inside some other block.
+   if (threading_mode == Sharded) {
+      AllocShard & own_shard = get_thread_shard();
+      JeodMemoryItem shard_item;
+
+      result = find_shard_entry_atomic (
+                  own_shard, addr, delete_entry, test_item);
+
+      for (unsigned int ii = 0;
+           (result != Alloc_found) && (ii < num_shards);
+           ++ii) {
+         if (&shards[ii] != &own_shard) {
+            AllocLookup shard_result = find_shard_entry_atomic (
+                                          shards[ii], addr, delete_entry,
+                                          shard_item);
+            if ((shard_result == Alloc_found) ||
+                ((shard_result == Alloc_inside) &&
+                 (result == Alloc_not_found))) {
+               result    = shard_result;
+               test_item = shard_item;
             }
-            // No else: Nothing to do here if delete_entry is false.
-
          }
+      }
+   }
 
-         // Mismatch: Set error flag so condition can be reported.
-         // (The error report is generated outside the atomic block.)
-         else if (addr < test_type->buffer_end (test_addr, *test_item)) {
-            address_inside = true;
-
+   // Search the allocation table proper. In Sharded mode this holds only
+   // allocations made before the switch to that mode.
+   if (result != Alloc_found) {
+      try {
+         begin_atomic_block ();
+
+         JeodMemoryItem table_item;
+         AllocLookup table_result = find_table_entry_nolock (
+                                       alloc_table, cur_data_size,
+                                       addr, delete_entry, table_item);
+         if ((table_result == Alloc_found) ||
+             ((table_result == Alloc_inside) &&
+              (result == Alloc_not_found))) {
+            result    = table_result;
+            test_item = table_item;
+            test_type = &(get_type_descriptor_nolock (test_item));
          }
-         // No else: Output items set to indicate not_found at onset.
 
+         end_atomic_block (false);
       }
-      // No else: Output items set to indicate not_found at onset.
+      catch (...) {
+         end_atomic_block (true);
+         throw;
+      }
+   }
 
-      end_atomic_block (false);
+   // Entries found in a shard get their type from the thread's cache.
+   if ((result != Alloc_not_found) && (test_type == nullptr)) {
+      test_type = &(get_type_descriptor_cached (
+                       test_item.get_descriptor_index()));
    }
-   catch (...) {
-      end_atomic_block (true);
-      throw;
+
+   // Match: Set the outputs. Note that found_item is copied.
+   if (result == Alloc_found) {
+      found_addr = const_cast<void *> (addr);
+      found_item = test_item;
+      found_type = test_type;
    }
 
-   if (address_inside) {
+   // Mismatch: Report the condition.
+   else if (result == Alloc_inside) {
       MessageHandler::warn (
          __FILE__, __LINE__, MemoryMessages::suspect_pointer,
          "Suspect use of %s at %s:%d\n",
@@ -717,37 +854,27 @@ JeodMemoryManager::add_allocation_atomic (
    unsigned int line)
 {
 
+   // Sharded mode: Record the allocation in the thread's shard.
+   if (threading_mode == Sharded) {
+      add_shard_allocation_atomic (
+         get_thread_shard(), addr, item, tdesc, file, line);
+      return;
+   }
+
    // Insert/update the table with the table locked.
    try {
       begin_atomic_block ();
 
-      // Sanity check: The new buffer should not overlap with registered memory.
-      // First find the table entries whose addresses are:
-      //   beg_iter -- strictly greater than the start of the buffer
-      //   end_iter -- greater than or equal to the end of the buffer
-      AllocTable::iterator beg_iter (alloc_table.upper_bound (addr));
-      AllocTable::iterator end_iter (alloc_table.lower_bound (
-                                        tdesc.buffer_end (
-                                           addr, item.get_nelems())));
-
-      // Now bump the beg_iter down a notch if its predecessor contains
-      // the start of the buffer.
-      if (beg_iter != alloc_table.begin()) {
-         --beg_iter;
-        // Oops. Undo the above if there is no overlap with the predecessor.
-        if (addr >= get_type_descriptor_nolock(beg_iter->second).buffer_end (
-                       beg_iter->first, beg_iter->second)) {
-            ++beg_iter;
-         }
-      }
+      const void * end = tdesc.buffer_end (addr, item.get_nelems());
 
-      // We have an overlap if the end_iter is not equal to the beg_iter.
-      // Possible causes:
+      // Sanity check: The new buffer should not overlap with registered memory.
+      // We have an overlap if some registered block contains the start of
+      // the new buffer or starts inside it. Possible causes:
       //  1. C++ delete was used to delete the overlapping memory.
       //  2. The memory manager was called outside the jeod_alloc.hh context.
       //  3. Something is terribly fouled up.
       // Not knowing which is which, the prudent thing to do is to fail the sim.
-      if (beg_iter != end_iter) {
+      if (alloc_table.overlaps (addr, end)) {
          end_atomic_block (true);
          MessageHandler::fail (
             __FILE__, __LINE__, MemoryMessages::corrupted_memory,
@@ -758,12 +885,9 @@ JeodMemoryManager::add_allocation_atomic (
       }
 
       // No overlap: Insert the item in the table.
-      std::pair<AllocTable::iterator, bool> ret =
-         alloc_table.insert (AllocTable::value_type(addr, item));
-
       // The above *had* to work. The overlap check ensures no overlap.
       // Just in case it didn't, ...
-      if (! ret.second) {
+      if (! alloc_table.insert (addr, end, item)) {
          end_atomic_block (true);
          MessageHandler::fail (
             __FILE__, __LINE__, MemoryMessages::corrupted_memory,
@@ -794,63 +918,23 @@ JeodMemoryManager::add_allocation_atomic (
 
 
 /**
- * Find and delete the alloc table entry with the smallest unique id,
- * setting the provided references with info about the deleted item.
- * The addr and type are set to NULL if the table is empty.
+ * Copy the alloc table entries, ordered from oldest to newest by unique id.
  *
  * \par Assumptions and Limitations
  *  - Operations on the map must be atomic.
  *     This method satisfies that requirement.
- *  - If the restore doesn't work the sim will be knee deep in alligators.
- * \param[out] addr Address found in table
- * \param[out] item Descriptor for above
- * \param[out] type Type descriptor
+ * \param[out] entries Copy of the table entries
  */
 void
-JeodMemoryManager::delete_oldest_alloc_entry_atomic (
-   void *& addr,
-   JeodMemoryItem & item,
-   const JeodMemoryTypeDescriptor *& type)
+JeodMemoryManager::get_alloc_entries_atomic (
+   std::vector<AllocTable::Entry> & entries)
 {
 
-   // Insert/update the table with the table locked.
+   // Copy the table with the table locked.
    try {
       begin_atomic_block ();
 
-      // We are done when the table is finally empty.
-      if (alloc_table.empty()) {
-         allocation_number = 0;
-         addr = nullptr;
-         type = nullptr;
-      }
-
-      // Not done. Find the oldest element, set outputs, and delete.
-      else {
-         AllocTable::iterator target_iter;
-         uint32_t target_id = UINT32_MAX;
-
-         // Find the oldest element -- the one with the smallest unique id.
-         for (AllocTable::iterator iter = alloc_table.begin();
-              iter != alloc_table.end();
-              ++iter) {
-            uint32_t iter_id = iter->second.get_unique_id();
-            if (iter_id < target_id) {
-               target_iter = iter;
-               target_id   = iter_id;
-            }
-         }
-
-         // Save info about this found element in the function args.
-         addr = const_cast<void *> (target_iter->first);
-         item = target_iter->second;
-         type = &(get_type_descriptor_nolock (item));
-
-         // Update the allocation statistics.
-         cur_data_size -= type->buffer_size(item);
-
-         // Delete the entry.
-         alloc_table.erase (target_iter);
-      }
+      alloc_table.get_entries (AllocTable::ByUniqueId, entries);
 
       end_atomic_block (false);
    }
@@ -858,6 +942,17 @@ JeodMemoryManager::delete_oldest_alloc_entry_atomic (
       end_atomic_block (true);
       throw;
    }
+
+   // Sharded mode: Add the shard contents and restore the overall order.
+   if (threading_mode == Sharded) {
+      std::vector<AllocTable::Entry> shard_entries;
+      for (unsigned int ii = 0; ii < num_shards; ++ii) {
+         get_shard_entries_atomic (shards[ii], shard_entries);
+         entries.insert (
+            entries.end(), shard_entries.begin(), shard_entries.end());
+      }
+      std::sort (entries.begin(), entries.end(), entry_unique_id_less);
+   }
 }
 
 
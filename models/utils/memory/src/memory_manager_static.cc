@@ -32,6 +32,7 @@ Library dependencies:
  */
 
 // System includes
+#include <atomic>
 #include <string>
 
 // JEOD includes
@@ -49,6 +50,15 @@ namespace jeod {
 // Linkage for JeodMemoryManager::Master
 JeodMemoryManager * JeodMemoryManager::Master = nullptr;
 
+namespace {
+
+/**
+ * Number of successful create_memory calls, for get_allocation_count.
+ */
+std::atomic<unsigned long long> allocation_counter (0);
+
+} // End anonymous namespace
+
 
 /**
  * Many of the static methods are a pass-through to a private non-static method,
@@ -134,6 +144,95 @@ JeodMemoryManager::set_guard_enabled (
 }
 
 
+/**
+ * Set the threading mode.
+ *
+ * \par Assumptions and Limitations
+ *  - No other thread is using the memory model.
+ * \param[in] new_mode New threading mode
+ */
+void
+JeodMemoryManager::set_threading_mode (
+   ThreadingMode new_mode)
+{
+
+   // Throw a non-fatal error if the singleton memory manager is not available.
+   if (check_master (false, __LINE__)) {
+
+      // Tell the master memory manager about the new threading mode.
+      Master->set_threading_mode_internal (new_mode);
+   }
+}
+
+
+/**
+ * Set the shutdown mode.
+ * A fast shutdown suits short runs that exit as soon as they finish, e.g.,
+ * Monte Carlo runs: unfreed memory is left registered with the simulation
+ * engine and the allocation tables are released wholesale.
+ * \param[in] new_mode New shutdown mode
+ */
+void
+JeodMemoryManager::set_shutdown_mode (
+   ShutdownMode new_mode)
+{
+
+   // Throw a non-fatal error if the singleton memory manager is not available.
+   if (check_master (false, __LINE__)) {
+      Master->shutdown_mode = new_mode;
+   }
+}
+
+
+/**
+ * Set the number of unfreed allocations listed by a fast shutdown.
+ * \param[in] limit Maximum number of leaks listed
+ */
+void
+JeodMemoryManager::set_leak_report_limit (
+   unsigned int limit)
+{
+
+   // Throw a non-fatal error if the singleton memory manager is not available.
+   if (check_master (false, __LINE__)) {
+      Master->leak_report_limit = limit;
+   }
+}
+
+
+/**
+ * Get the threading mode.
+ * @return Current threading mode; Multi_threaded if there is no manager
+ */
+JeodMemoryManager::ThreadingMode
+JeodMemoryManager::get_threading_mode (
+   void)
+{
+   ThreadingMode threading_mode = Multi_threaded;
+
+   // Throw a non-fatal error if the singleton memory manager is not available.
+   if (check_master (false, __LINE__)) {
+      threading_mode = Master->threading_mode;
+   }
+
+   return threading_mode;
+}
+
+
+/**
+ * Get the number of allocations made through the memory manager so far,
+ * by any thread. Comparing counts taken before and after a section of code
+ * detects allocations made by the section, e.g., in a real-time frame.
+ * @return Allocation count
+ */
+unsigned long long
+JeodMemoryManager::get_allocation_count (
+   void)
+{
+   return allocation_counter.load (std::memory_order_relaxed);
+}
+
+
 /**
  * Query whether all allocated memory has been freed.
  *
@@ -153,6 +252,16 @@ JeodMemoryManager::is_table_empty (
 
       // See if the table is empty.
       is_empty = Master->alloc_table.empty();
+
+      // Sharded mode: The shards must be empty as well.
+      if (is_empty && (Master->shards != nullptr)) {
+         for (unsigned int ii = 0; ii < num_shards; ++ii) {
+            if (! Master->shards[ii].table.empty()) {
+               is_empty = false;
+               break;
+            }
+         }
+      }
    }
 
    return is_empty;
@@ -284,6 +393,10 @@ JeodMemoryManager::create_memory (
                 is_array, nelems, fill, tentry, file, line);
    }
 
+   if (addr != nullptr) {
+      allocation_counter.fetch_add (1, std::memory_order_relaxed);
+   }
+
    return addr;
 }
 
@@ -449,6 +562,85 @@ JeodMemoryManager::deregister_container (
 }
 
 
+/**
+ * Mark an allocation as reconstructible. A checkpoint records a reference to
+ * the allocation's data source and a hash of its contents rather than the
+ * contents; on restart the reconstructor refills the recreated allocation.
+ * Whether the contents are in fact withheld from a checkpoint is up to the
+ * simulation interface.
+ *
+ * \par Assumptions and Limitations
+ *  - This method must not be called before the singleton memory manager has
+ *     been created or after it has been destroyed.
+ *     A non-fatal error results when this is not true.
+ *  - The address must be the start of a JEOD allocation of primitive data.
+ *     The contents of a structured allocation cannot be compared by hash.
+ *  - Access to this method is through JEOD_SET_RECONSTRUCTIBLE.
+ * \param[in] addr Allocated memory
+ * \param[in] reference Identifies the data source across runs
+ * \param[in,out] reconstructor Rebuilds the contents on restart
+ * \param[in] file Source file containing JEOD_SET_RECONSTRUCTIBLE
+ * \param[in] line Line number containing JEOD_SET_RECONSTRUCTIBLE
+ */
+void
+JeodMemoryManager::set_reconstructible (
+   const void * addr,
+   const std::string & reference,
+   JeodCheckpointReconstructor & reconstructor,
+   const char * file,
+   unsigned int line)
+{
+
+   // Throw a non-fatal error if the singleton memory manager is not available.
+   if (check_master (false, __LINE__)) {
+      void * found_addr = nullptr;
+      JeodMemoryItem found_item;
+      const JeodMemoryTypeDescriptor * found_type = nullptr;
+
+      Master->find_alloc_entry_atomic (addr, false, file, line,
+                                       found_addr, found_item, found_type);
+
+      if (found_addr == nullptr) {
+         MessageHandler::error (
+            __FILE__, __LINE__, MemoryMessages::suspect_pointer,
+            "Pointer %p passed to JEOD_SET_RECONSTRUCTIBLE at %s:%d "
+            "is not the start of a JEOD allocation.",
+            addr, file, line);
+         return;
+      }
+
+      if (found_item.is_structured_data()) {
+         MessageHandler::error (
+            __FILE__, __LINE__, MemoryMessages::registration_error,
+            "Allocation of type %s passed to JEOD_SET_RECONSTRUCTIBLE at "
+            "%s:%d is structured; only primitive data can be reconstructed.",
+            found_type->get_name().c_str(), file, line);
+         return;
+      }
+
+      Master->sim_interface.set_reconstructible (
+         addr, found_item, *found_type, reference, reconstructor);
+   }
+}
+
+
+/**
+ * Withdraw a reconstructor from the simulation interface.
+ * Unlike the other static methods, this quietly does nothing when the
+ * memory manager no longer exists, as reconstructors that are global
+ * objects may well be destroyed after the memory manager.
+ * \param[in,out] reconstructor The reconstructor
+ */
+void
+JeodMemoryManager::forget_reconstructor (
+   JeodCheckpointReconstructor & reconstructor)
+{
+   if (Master != nullptr) {
+      Master->sim_interface.forget_reconstructor (reconstructor);
+   }
+}
+
+
 /**
  * Set the memory manager's simulation interface mode.
  *
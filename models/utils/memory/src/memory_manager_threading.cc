@@ -0,0 +1,715 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/src/memory_manager_threading.cc
+ * Implement the JeodMemoryManager methods that support the threading modes.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((memory_manager_threading.cc)
+   (memory_manager.cc)
+   (memory_alloc_table.cc)
+   (memory_item.cc)
+   (memory_messages.cc)
+   (memory_type.cc))
+
+ 
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <typeinfo>
+#include <vector>
+#include <pthread.h>
+#include <stdint.h>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/memory_manager.hh"
+#include "../include/memory_messages.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Source of Sharded-mode epochs. Zero is never issued.
+ */
+std::atomic<unsigned int> shard_epoch_source (0);
+
+/**
+ * Source of thread-to-shard assignments.
+ */
+std::atomic<unsigned int> shard_slot_source (0);
+
+/**
+ * The calling thread's shard index plus one; zero if not yet assigned.
+ */
+thread_local unsigned int thread_shard_slot = 0;
+
+
+/**
+ * A thread's cache of type table lookups, valid for one Sharded-mode epoch.
+ * Type descriptors are never removed from the type table, so a cached
+ * entry stays correct for the lifetime of the memory manager.
+ */
+struct ThreadTypeCache {
+
+   /**
+    * Epoch for which the cache is valid.
+    */
+   unsigned int epoch;
+
+   /**
+    * Type table index by type_info.
+    */
+   std::map<const std::type_info *, uint32_t> index_by_typeid;
+
+   /**
+    * Type descriptor by type table index; null where not yet cached.
+    */
+   std::vector<const JeodMemoryTypeDescriptor *> descriptor_by_index;
+
+   /**
+    * Default constructor.
+    */
+   ThreadTypeCache ()
+   :
+      epoch(0),
+      index_by_typeid(),
+      descriptor_by_index()
+   { }
+};
+
+/**
+ * The calling thread's type cache.
+ */
+thread_local ThreadTypeCache thread_type_cache;
+
+
+/**
+ * Get the calling thread's type cache, emptying it if it is stale.
+ * @return Type cache
+ * \param[in] epoch Current Sharded-mode epoch
+ */
+ThreadTypeCache &
+get_type_cache (
+   unsigned int epoch)
+{
+   if (thread_type_cache.epoch != epoch) {
+      thread_type_cache.index_by_typeid.clear();
+      thread_type_cache.descriptor_by_index.clear();
+      thread_type_cache.epoch = epoch;
+   }
+   return thread_type_cache;
+}
+
+
+/**
+ * Lock a shard's mutex.
+ * \param[in,out] mutex Shard mutex
+ */
+void
+lock_shard (
+   pthread_mutex_t & mutex)
+{
+   int mutex_lock_status = pthread_mutex_lock (&mutex);
+
+   // Failure to obtain a lock is a fatal error.
+   if (mutex_lock_status != 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MemoryMessages::lock_error,
+         "pthread_mutex_lock() failed: %s",
+         std::strerror(mutex_lock_status));
+   }
+}
+
+
+/**
+ * Unlock a shard's mutex.
+ * \param[in,out] mutex Shard mutex
+ * \param[in] ignore_errors Ignore errors from unlock?
+ */
+void
+unlock_shard (
+   pthread_mutex_t & mutex,
+   bool ignore_errors)
+{
+   int mutex_unlock_status = pthread_mutex_unlock (&mutex);
+
+   // Failure to release a lock is a fatal error.
+   if ((!ignore_errors) && (mutex_unlock_status != 0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MemoryMessages::lock_error,
+         "pthread_mutex_unlock() failed: %s",
+         std::strerror(mutex_unlock_status));
+   }
+}
+
+} // End anonymous namespace
+
+
+/*******************************************************************************
+ * AllocShard methods
+ ******************************************************************************/
+
+
+/**
+ * AllocShard default constructor.
+ */
+JeodMemoryManager::AllocShard::AllocShard (
+   void)
+:
+   table(),
+   cur_data_size(0),
+   max_data_size(0),
+   max_table_size(0),
+   next_id(0),
+   end_id(0)
+{
+   pthread_mutex_init (&mutex, nullptr);
+}
+
+
+/**
+ * AllocShard destructor.
+ */
+JeodMemoryManager::AllocShard::~AllocShard (
+   void)
+{
+   pthread_mutex_destroy (&mutex);
+}
+
+
+/*******************************************************************************
+ * Threading mode
+ ******************************************************************************/
+
+
+/**
+ * Set the threading mode.
+ *
+ * Leaving Sharded mode moves the shard contents into the allocation table.
+ * Entering it creates the shards if needed and invalidates every thread's
+ * type cache. Allocations made before entering Sharded mode stay in the
+ * allocation table, which remains searchable.
+ *
+ * \par Assumptions and Limitations
+ *  - No other thread is using the memory model.
+ * \param[in] new_mode New threading mode
+ */
+void
+JeodMemoryManager::set_threading_mode_internal (
+   ThreadingMode new_mode)
+{
+   if (new_mode == threading_mode) {
+      return;
+   }
+
+   if (threading_mode == Sharded) {
+      merge_shards_nolock ();
+   }
+
+   if (new_mode == Sharded) {
+      if (shards == nullptr) {
+         shards = new AllocShard[num_shards];
+      }
+      shard_epoch = ++shard_epoch_source;
+   }
+
+   threading_mode = new_mode;
+}
+
+
+/**
+ * Get the calling thread's shard, assigning one on first use.
+ * Threads are assigned to shards round-robin.
+ *
+ * \par Assumptions and Limitations
+ *  - The manager is in Sharded mode.
+ * @return Shard
+ */
+JeodMemoryManager::AllocShard &
+JeodMemoryManager::get_thread_shard (
+   void)
+const
+{
+   if (thread_shard_slot == 0) {
+      thread_shard_slot = 1 + (shard_slot_source++ % num_shards);
+   }
+   return shards[thread_shard_slot - 1];
+}
+
+
+/*******************************************************************************
+ * Per-thread type cache
+ ******************************************************************************/
+
+
+/**
+ * Look up a type in the calling thread's type cache.
+ * @return True if the type is cached
+ * \param[in] typeid_info C++ type descriptor
+ * \param[out] idx Type table index
+ */
+bool
+JeodMemoryManager::get_cached_type_index (
+   const std::type_info & typeid_info,
+   uint32_t & idx)
+const
+{
+   const ThreadTypeCache & cache = get_type_cache (shard_epoch);
+   std::map<const std::type_info *, uint32_t>::const_iterator iter =
+      cache.index_by_typeid.find (&typeid_info);
+
+   if (iter == cache.index_by_typeid.end()) {
+      return false;
+   }
+
+   idx = iter->second;
+   return true;
+}
+
+
+/**
+ * Add a type to the calling thread's type cache.
+ * \param[in] typeid_info C++ type descriptor
+ * \param[in] entry Type table entry for the type
+ */
+void
+JeodMemoryManager::cache_type_entry (
+   const std::type_info & typeid_info,
+   const TypeEntry & entry)
+const
+{
+   ThreadTypeCache & cache = get_type_cache (shard_epoch);
+
+   cache.index_by_typeid[&typeid_info] = entry.index;
+   if (cache.descriptor_by_index.size() <= entry.index) {
+      cache.descriptor_by_index.resize (entry.index + 1, nullptr);
+   }
+   cache.descriptor_by_index[entry.index] = entry.tdesc;
+}
+
+
+/**
+ * Get the descriptor for a type index, consulting the type table (and
+ * taking the table lock) only on the thread's first use of the type.
+ *
+ * \par Assumptions and Limitations
+ *  - The calling thread holds no shard lock.
+ * @return Type descriptor
+ * \param[in] idx Type table index
+ */
+const JeodMemoryTypeDescriptor &
+JeodMemoryManager::get_type_descriptor_cached (
+   uint32_t idx)
+const
+{
+   ThreadTypeCache & cache = get_type_cache (shard_epoch);
+
+   if ((idx < cache.descriptor_by_index.size()) &&
+       (cache.descriptor_by_index[idx] != nullptr)) {
+      return *(cache.descriptor_by_index[idx]);
+   }
+
+   const JeodMemoryTypeDescriptor & tdesc = get_type_descriptor_atomic (idx);
+   if (cache.descriptor_by_index.size() <= idx) {
+      cache.descriptor_by_index.resize (idx + 1, nullptr);
+   }
+   cache.descriptor_by_index[idx] = &tdesc;
+
+   return tdesc;
+}
+
+
+/*******************************************************************************
+ * Shard methods
+ * The lock order is shard mutex before the memory manager mutex; no method
+ * takes a shard mutex while holding the memory manager mutex.
+ ******************************************************************************/
+
+
+/**
+ * Create a unique identifier for an allocation from the block reserved by
+ * a shard, reserving a new block when the current one is exhausted.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the shard must be atomic.
+ *     This method satisfies that requirement.
+ * @return Allocation ID
+ * \param[in,out] shard Shard
+ * \param[in] file Source file containing JEOD_ALLOC
+ * \param[in] line Line number containing JEOD_ALLOC
+ */
+uint32_t
+JeodMemoryManager::get_shard_alloc_id_atomic (
+   AllocShard & shard,
+   const char * file,
+   unsigned int line)
+{
+   uint32_t unique_id = 0;
+
+   try {
+      lock_shard (shard.mutex);
+
+      if (shard.next_id == shard.end_id) {
+         uint32_t first_id =
+            reserve_alloc_ids_atomic (shard_id_block_size, file, line);
+         if (first_id == 0) {
+            unlock_shard (shard.mutex, true);
+            return unique_id;
+         }
+         shard.next_id = first_id;
+         shard.end_id  = first_id + shard_id_block_size;
+      }
+
+      unique_id = shard.next_id++;
+
+      unlock_shard (shard.mutex, false);
+   }
+   catch (...) {
+      unlock_shard (shard.mutex, true);
+      throw;
+   }
+
+   return unique_id;
+}
+
+
+/**
+ * Discard the unique identifier blocks reserved by the shards, forcing each
+ * to reserve a fresh block on its next allocation.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the shards must be atomic.
+ *     This method satisfies that requirement.
+ */
+void
+JeodMemoryManager::release_shard_ids_atomic (
+   void)
+{
+   for (unsigned int ii = 0; ii < num_shards; ++ii) {
+      AllocShard & shard = shards[ii];
+
+      try {
+         lock_shard (shard.mutex);
+
+         shard.next_id = 0;
+         shard.end_id  = 0;
+
+         unlock_shard (shard.mutex, false);
+      }
+      catch (...) {
+         unlock_shard (shard.mutex, true);
+         throw;
+      }
+   }
+}
+
+
+/**
+ * Find the shard table entry that matches the input address,
+ * and delete it if delete_entry is true.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the shard must be atomic.
+ *     This method satisfies that requirement.
+ * @return Outcome of the lookup
+ * \param[in,out] shard Shard
+ * \param[in] addr Address
+ * \param[in] delete_entry Indicates entry is to be deleted
+ * \param[out] found_item Descriptor of the matching or containing entry
+ */
+JeodMemoryManager::AllocLookup
+JeodMemoryManager::find_shard_entry_atomic (
+   AllocShard & shard,
+   const void * addr,
+   bool delete_entry,
+   JeodMemoryItem & found_item)
+{
+   AllocLookup result = Alloc_not_found;
+
+   try {
+      lock_shard (shard.mutex);
+
+      result = find_table_entry_nolock (
+                  shard.table, shard.cur_data_size,
+                  addr, delete_entry, found_item);
+
+      unlock_shard (shard.mutex, false);
+   }
+   catch (...) {
+      unlock_shard (shard.mutex, true);
+      throw;
+   }
+
+   return result;
+}
+
+
+/**
+ * Add the specified addr/item pair to a shard.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the shard must be atomic.
+ *     This method satisfies that requirement.
+ *  - The overlap check covers this shard only.
+ * \param[in,out] shard Shard
+ * \param[in] addr Newly allocated memory
+ * \param[in] item Description of that memory
+ * \param[in] tdesc Description of the type
+ * \param[in] file Source file containing JEOD_ALLOC
+ * \param[in] line Line number containing JEOD_ALLOC
+ */
+void
+JeodMemoryManager::add_shard_allocation_atomic (
+   AllocShard & shard,
+   const void * addr,
+   const JeodMemoryItem & item,
+   const JeodMemoryTypeDescriptor & tdesc,
+   const char * file,
+   unsigned int line)
+{
+   try {
+      lock_shard (shard.mutex);
+
+      const void * end = tdesc.buffer_end (addr, item.get_nelems());
+
+      // Sanity check: The new buffer should not overlap with registered memory.
+      // See add_allocation_atomic.
+      if (shard.table.overlaps (addr, end)) {
+         unlock_shard (shard.mutex, true);
+         MessageHandler::fail (
+            __FILE__, __LINE__, MemoryMessages::corrupted_memory,
+            "The memory manager is corrupted:\n"
+            "Memory allocated at %s:%d overlaps with registered memory.",
+            file, line);
+         return;
+      }
+
+      if (! shard.table.insert (addr, end, item)) {
+         unlock_shard (shard.mutex, true);
+         MessageHandler::fail (
+            __FILE__, __LINE__, MemoryMessages::corrupted_memory,
+            "Impossible condition!\n"
+            "Memory allocated at %s:%d has already been registered.",
+            file, line);
+         return;
+      }
+
+      // Update stats on allocated memory and the shard table.
+      shard.cur_data_size += tdesc.buffer_size (item);
+
+      if (shard.max_data_size < shard.cur_data_size) {
+         shard.max_data_size = shard.cur_data_size;
+      }
+
+      if (shard.max_table_size < shard.table.size()) {
+         shard.max_table_size = shard.table.size();
+      }
+
+      unlock_shard (shard.mutex, false);
+   }
+   catch (...) {
+      unlock_shard (shard.mutex, true);
+      throw;
+   }
+}
+
+
+/**
+ * Copy a shard's table entries.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the shard must be atomic.
+ *     This method satisfies that requirement.
+ * \param[in,out] shard Shard
+ * \param[out] entries Copy of the shard's entries
+ */
+void
+JeodMemoryManager::get_shard_entries_atomic (
+   AllocShard & shard,
+   std::vector<AllocTable::Entry> & entries)
+{
+   try {
+      lock_shard (shard.mutex);
+
+      shard.table.get_entries (AllocTable::ByUniqueId, entries);
+
+      unlock_shard (shard.mutex, false);
+   }
+   catch (...) {
+      unlock_shard (shard.mutex, true);
+      throw;
+   }
+}
+
+
+/**
+ * Move the contents of the shards into the allocation table.
+ * The table statistics become upper bounds: the shard maxima need not
+ * have occurred at the same time.
+ *
+ * \par Assumptions and Limitations
+ *  - No other thread is using the memory model.
+ */
+void
+JeodMemoryManager::merge_shards_nolock (
+   void)
+{
+   if (shards == nullptr) {
+      return;
+   }
+
+   std::vector<AllocTable::Entry> entries;
+   JEOD_SIZE_T peak_data_size = cur_data_size;
+   std::size_t peak_table_size = alloc_table.size();
+
+   for (unsigned int ii = 0; ii < num_shards; ++ii) {
+      AllocShard & shard = shards[ii];
+
+      shard.table.get_entries (AllocTable::ByAddress, entries);
+      for (std::vector<AllocTable::Entry>::const_iterator it = entries.begin();
+           it != entries.end();
+           ++it) {
+         if (! alloc_table.insert (it->addr, it->end, it->item)) {
+            MessageHandler::fail (
+               __FILE__, __LINE__, MemoryMessages::corrupted_memory,
+               "The memory manager is corrupted:\n"
+               "Memory at %p is registered in more than one table.",
+               it->addr);
+            return;
+         }
+      }
+
+      cur_data_size   += shard.cur_data_size;
+      peak_data_size  += shard.max_data_size;
+      peak_table_size += shard.max_table_size;
+
+      shard.table.clear();
+      shard.cur_data_size  = 0;
+      shard.max_data_size  = 0;
+      shard.max_table_size = 0;
+      shard.next_id = 0;
+      shard.end_id  = 0;
+   }
+
+   max_data_size  = std::max (max_data_size, peak_data_size);
+   max_table_size = std::max (max_table_size,
+                              static_cast<unsigned int> (peak_table_size));
+}
+
+
+/**
+ * Fold the shard statistics into the manager's statistics, leaving the
+ * shard contents in place. As with merge_shards_nolock, the table
+ * statistics become upper bounds.
+ *
+ * \par Assumptions and Limitations
+ *  - No other thread is using the memory model.
+ */
+void
+JeodMemoryManager::fold_shard_statistics_nolock (
+   void)
+{
+   if (shards == nullptr) {
+      return;
+   }
+
+   JEOD_SIZE_T peak_data_size = cur_data_size;
+   std::size_t peak_table_size = alloc_table.size();
+
+   for (unsigned int ii = 0; ii < num_shards; ++ii) {
+      const AllocShard & shard = shards[ii];
+      cur_data_size   += shard.cur_data_size;
+      peak_data_size  += shard.max_data_size;
+      peak_table_size += shard.max_table_size;
+   }
+
+   max_data_size  = std::max (max_data_size, peak_data_size);
+   max_table_size = std::max (max_table_size,
+                              static_cast<unsigned int> (peak_table_size));
+}
+
+
+/**
+ * Count the allocations registered in the allocation table and the shards.
+ *
+ * \par Assumptions and Limitations
+ *  - No other thread is using the memory model.
+ * @return Number of allocations
+ */
+std::size_t
+JeodMemoryManager::count_allocations_nolock (
+   void)
+const
+{
+   std::size_t count = alloc_table.size();
+   if (shards != nullptr) {
+      for (unsigned int ii = 0; ii < num_shards; ++ii) {
+         count += shards[ii].table.size();
+      }
+   }
+   return count;
+}
+
+
+/**
+ * Copy a sample of the allocations registered in the allocation table and
+ * the shards, taking from the allocation table first.
+ *
+ * \par Assumptions and Limitations
+ *  - No other thread is using the memory model.
+ * \param[in]  max_entries Maximum number of entries to copy
+ * \param[out] entries     Sampled entries
+ */
+void
+JeodMemoryManager::sample_allocations_nolock (
+   std::size_t max_entries,
+   std::vector<AllocTable::Entry> & entries)
+const
+{
+   alloc_table.get_sample (max_entries, entries);
+
+   if (shards != nullptr) {
+      std::vector<AllocTable::Entry> shard_entries;
+      for (unsigned int ii = 0;
+           (ii < num_shards) && (entries.size() < max_entries);
+           ++ii) {
+         shards[ii].table.get_sample (max_entries - entries.size(),
+                                      shard_entries);
+         entries.insert (entries.end(),
+                         shard_entries.begin(), shard_entries.end());
+      }
+   }
+}
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
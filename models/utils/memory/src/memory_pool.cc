@@ -0,0 +1,394 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/src/memory_pool.cc
+ * Implement the JeodMemoryPool class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((memory_pool.cc))
+
+ 
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <pthread.h>
+
+// Model includes
+#include "../include/memory_pool.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+#ifndef JEOD_MEMORY_DISABLE_POOL
+
+namespace {
+
+/**
+ * Number of size classes: 16-byte steps to 256 bytes, then powers of two
+ * to JeodMemoryPool::max_pooled_size.
+ */
+const unsigned int num_size_classes = 20;
+
+/**
+ * Size of the slabs from which blocks are carved.
+ */
+const std::size_t slab_size = 65536;
+
+/**
+ * A free block; the link occupies the block's first bytes.
+ */
+struct FreeBlock {
+   FreeBlock * next; ///< Next free block in the list
+};
+
+
+/**
+ * Map a request size to its size class.
+ * @return Size class index
+ * \param[in] size Request size, at most max_pooled_size
+ */
+inline unsigned int
+size_class (
+   std::size_t size)
+{
+   if (size <= 256) {
+      return (size <= 16) ? 0 : static_cast<unsigned int> ((size - 1) / 16);
+   }
+   else if (size <= 512) {
+      return 16;
+   }
+   else if (size <= 1024) {
+      return 17;
+   }
+   else if (size <= 2048) {
+      return 18;
+   }
+   return 19;
+}
+
+
+/**
+ * Block size of a size class.
+ * @return Block size in bytes
+ * \param[in] idx Size class index
+ */
+inline std::size_t
+class_size (
+   unsigned int idx)
+{
+   return (idx < 16) ? (idx + 1) * 16 : std::size_t(512) << (idx - 16);
+}
+
+
+/**
+ * Number of blocks moved between a thread cache and the central lists at
+ * a time.
+ * @return Batch size
+ * \param[in] idx Size class index
+ */
+inline unsigned int
+batch_size (
+   unsigned int idx)
+{
+   std::size_t count = 8192 / class_size (idx);
+   return (count < 4) ? 4 : ((count > 64) ? 64 : static_cast<unsigned int> (count));
+}
+
+
+/**
+ * The shared free lists and the slab from which new blocks are carved.
+ * The single instance is created on first use and is never destroyed, so
+ * blocks can be released at any point in the program's lifetime.
+ */
+class CentralPool {
+public:
+
+   /**
+    * Mutex that protects the central pool.
+    */
+   pthread_mutex_t mutex;
+
+   /**
+    * Central free list per size class.
+    */
+   FreeBlock * free_list[num_size_classes];
+
+   /**
+    * Next uncarved byte of the current slab.
+    */
+   char * slab_cursor;
+
+   /**
+    * End of the current slab.
+    */
+   char * slab_end;
+
+   CentralPool ()
+   :
+      slab_cursor(nullptr),
+      slab_end(nullptr)
+   {
+      pthread_mutex_init (&mutex, nullptr);
+      for (unsigned int ii = 0; ii < num_size_classes; ++ii) {
+         free_list[ii] = nullptr;
+      }
+   }
+
+   /**
+    * Move up to count blocks of a size class onto a list, carving new
+    * blocks when the central list runs dry.
+    * @return Number of blocks moved
+    * \param[in] idx Size class index
+    * \param[in] count Number of blocks wanted
+    * \param[in,out] list List to which the blocks are prepended
+    */
+   unsigned int fetch (unsigned int idx, unsigned int count, FreeBlock *& list)
+   {
+      std::size_t block_size = class_size (idx);
+      unsigned int moved = 0;
+
+      pthread_mutex_lock (&mutex);
+
+      while ((moved < count) && (free_list[idx] != nullptr)) {
+         FreeBlock * block = free_list[idx];
+         free_list[idx] = block->next;
+         block->next = list;
+         list = block;
+         ++moved;
+      }
+
+      while (moved < count) {
+         if (static_cast<std::size_t> (slab_end - slab_cursor) < block_size) {
+            // The tail of the old slab is abandoned; it is smaller than a
+            // block of this class.
+            slab_cursor = new char[slab_size];
+            slab_end = slab_cursor + slab_size;
+         }
+         FreeBlock * block = reinterpret_cast<FreeBlock *> (slab_cursor);
+         slab_cursor += block_size;
+         block->next = list;
+         list = block;
+         ++moved;
+      }
+
+      pthread_mutex_unlock (&mutex);
+
+      return moved;
+   }
+
+   /**
+    * Return count blocks from the head of a list to the central list.
+    * \param[in] idx Size class index
+    * \param[in] count Number of blocks to return
+    * \param[in,out] list List from which the blocks are taken
+    */
+   void give_back (unsigned int idx, unsigned int count, FreeBlock *& list)
+   {
+      pthread_mutex_lock (&mutex);
+
+      for (unsigned int ii = 0; (ii < count) && (list != nullptr); ++ii) {
+         FreeBlock * block = list;
+         list = block->next;
+         block->next = free_list[idx];
+         free_list[idx] = block;
+      }
+
+      pthread_mutex_unlock (&mutex);
+   }
+};
+
+
+/**
+ * Get the central pool, creating it on first use.
+ * @return Central pool
+ */
+CentralPool &
+central_pool ()
+{
+   static CentralPool * pool = new CentralPool;
+   return *pool;
+}
+
+
+/**
+ * Per-thread free lists. The cache is trivially destructible, so it remains
+ * usable while the thread's other thread_local and static objects are being
+ * destroyed; by then it has been retired and simply forwards to the central
+ * pool.
+ */
+struct ThreadCache {
+   /**
+    * Free list per size class.
+    */
+   FreeBlock * free_list[num_size_classes];
+
+   /**
+    * Number of blocks in each free list.
+    */
+   unsigned int count[num_size_classes];
+
+   /**
+    * Set once the cache has been flushed at thread exit.
+    */
+   bool retired;
+};
+
+thread_local ThreadCache thread_cache;
+
+
+/**
+ * Returns the calling thread's cached blocks to the central pool when the
+ * thread exits and retires the cache.
+ */
+class ThreadCacheReaper {
+public:
+   ~ThreadCacheReaper ()
+   {
+      for (unsigned int ii = 0; ii < num_size_classes; ++ii) {
+         if (thread_cache.count[ii] > 0) {
+            central_pool().give_back (
+               ii, thread_cache.count[ii], thread_cache.free_list[ii]);
+            thread_cache.count[ii] = 0;
+         }
+      }
+      thread_cache.retired = true;
+   }
+};
+
+thread_local ThreadCacheReaper thread_cache_reaper;
+
+} // End anonymous namespace
+
+
+/**
+ * Allocate a buffer of at least size bytes, aligned for any type.
+ * @return Allocated buffer
+ * \param[in] size Requested size in bytes
+ */
+void *
+JeodMemoryPool::allocate (
+   std::size_t size)
+{
+   if (size > max_pooled_size) {
+      return new char[size];
+   }
+
+   unsigned int idx = size_class (size);
+   ThreadCache & cache = thread_cache;
+
+   if (cache.retired) {
+      FreeBlock * block = nullptr;
+      central_pool().fetch (idx, 1, block);
+      return block;
+   }
+
+   if (cache.free_list[idx] == nullptr) {
+      // Refills are where a thread first touches the pool; make sure the
+      // reaper that flushes this thread's cache exists.
+      static_cast<void> (&thread_cache_reaper);
+      cache.count[idx] +=
+         central_pool().fetch (idx, batch_size (idx), cache.free_list[idx]);
+   }
+
+   FreeBlock * block = cache.free_list[idx];
+   cache.free_list[idx] = block->next;
+   --cache.count[idx];
+
+   return block;
+}
+
+
+/**
+ * Release a buffer obtained from allocate.
+ * \param[in] buf Buffer to release
+ * \param[in] size Size passed to allocate
+ */
+void
+JeodMemoryPool::release (
+   void * buf,
+   std::size_t size)
+{
+   if (buf == nullptr) {
+      return;
+   }
+
+   if (size > max_pooled_size) {
+      delete[] static_cast<char *> (buf);
+      return;
+   }
+
+   unsigned int idx = size_class (size);
+   ThreadCache & cache = thread_cache;
+   FreeBlock * block = static_cast<FreeBlock *> (buf);
+
+   if (cache.retired) {
+      block->next = nullptr;
+      central_pool().give_back (idx, 1, block);
+      return;
+   }
+
+   block->next = cache.free_list[idx];
+   cache.free_list[idx] = block;
+   ++cache.count[idx];
+
+   // Keep the cache bounded so memory freed by one thread can be reused by
+   // the others.
+   unsigned int batch = batch_size (idx);
+   if (cache.count[idx] > 2 * batch) {
+      central_pool().give_back (idx, batch, cache.free_list[idx]);
+      cache.count[idx] -= batch;
+   }
+}
+
+#else
+
+/**
+ * Allocate a buffer with new[]; the pool is disabled.
+ * @return Allocated buffer
+ * \param[in] size Requested size in bytes
+ */
+void *
+JeodMemoryPool::allocate (
+   std::size_t size)
+{
+   return new char[size];
+}
+
+
+/**
+ * Release a buffer with delete[]; the pool is disabled.
+ * \param[in] buf Buffer to release
+ * \param[in] size Size passed to allocate (unused)
+ */
+void
+JeodMemoryPool::release (
+   void * buf,
+   std::size_t size __attribute__ ((unused)))
+{
+   delete[] static_cast<char *> (buf);
+}
+
+#endif
+
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,113 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/src/scratch_arena.cc
+ * Implement the ScratchArena class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((scratch_arena.cc)
+   (memory_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+ 
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/memory_messages.hh"
+#include "../include/scratch_arena.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default constructor; the arena has no capacity until reserved.
+ */
+ScratchArena::ScratchArena ()
+:
+   storage(),
+   capacity(0),
+   used(0)
+{ }
+
+
+/**
+ * Destructor.
+ */
+ScratchArena::~ScratchArena ()
+{ }
+
+
+/**
+ * Ensure the arena can hold arrays totaling num_doubles doubles, counting
+ * each array at its padded_size(). The capacity only grows. Growing moves
+ * the storage, so it is an error while arrays are allocated.
+ * \param[in] num_doubles Required capacity, in doubles
+ */
+void
+ScratchArena::reserve (
+   std::size_t num_doubles)
+{
+   std::size_t new_capacity = padded_size (num_doubles);
+
+   if (new_capacity <= capacity) {
+      return;
+   }
+
+   if (used != 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MemoryMessages::internal_error,
+         "A scratch arena cannot grow while %lu doubles are in use.",
+         static_cast<unsigned long> (used));
+
+      // Not reached
+      return;
+   }
+
+   storage.assign (new_capacity + align_doubles - 1, 0.0);
+   capacity = new_capacity;
+}
+
+
+/**
+ * Report a request beyond the reserved capacity.
+ * \param[in] num Requested array size
+ */
+void
+ScratchArena::report_overflow (
+   std::size_t num) const
+{
+   MessageHandler::fail (
+      __FILE__, __LINE__, MemoryMessages::invalid_size,
+      "Scratch arena request for %lu doubles exceeds the capacity "
+      "(%lu of %lu doubles in use).",
+      static_cast<unsigned long> (num),
+      static_cast<unsigned long> (used),
+      static_cast<unsigned long> (capacity));
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,177 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/src/state_snapshot.cc
+ * Implement the StateSnapshot class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((state_snapshot.cc)
+   (memory_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <cstring>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/memory_messages.hh"
+#include "../include/state_snapshot.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default constructor; nothing is registered.
+ */
+StateSnapshot::StateSnapshot ()
+:
+   regions(),
+   restore_actions(),
+   image(),
+   size(0),
+   saved(false)
+{ }
+
+
+/**
+ * Destructor.
+ */
+StateSnapshot::~StateSnapshot ()
+{ }
+
+
+/**
+ * Register a memory region. A region that starts where the previously
+ * registered region ends is merged with it. Registering a region discards
+ * any saved image.
+ * \param[in] address Start of the region
+ * \param[in] region_size Size of the region, in bytes
+ */
+void
+StateSnapshot::add_region (
+   void * address,
+   std::size_t region_size)
+{
+   if (region_size == 0) {
+      return;
+   }
+   if (address == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MemoryMessages::null_pointer,
+         "Cannot add a null region to a state snapshot.");
+
+      // Not reached
+      return;
+   }
+
+   char * start = static_cast<char *> (address);
+   if ((! regions.empty()) &&
+       (regions.back().address + regions.back().size == start)) {
+      regions.back().size += region_size;
+   }
+   else {
+      Region region = {start, region_size, size};
+      regions.push_back (region);
+   }
+   size += region_size;
+   saved = false;
+}
+
+
+/**
+ * Register an action to be run after each restore, e.g., to invalidate data
+ * derived from the restored state.
+ * \param[in] action The action
+ */
+void
+StateSnapshot::add_restore_action (
+   const std::function<void ()> & action)
+{
+   restore_actions.push_back (action);
+}
+
+
+/**
+ * Forget the registered regions, restore actions, and saved image.
+ */
+void
+StateSnapshot::clear ()
+{
+   regions.clear();
+   restore_actions.clear();
+   size = 0;
+   saved = false;
+}
+
+
+/**
+ * Copy the registered regions into the snapshot, replacing any previously
+ * saved image. The image buffer is sized on the first save.
+ */
+void
+StateSnapshot::save ()
+{
+   if (image.size() < size) {
+      image.resize (size);
+   }
+
+   char * base = image.data();
+   for (const Region & region : regions) {
+      std::memcpy (base + region.offset, region.address, region.size);
+   }
+   saved = true;
+}
+
+
+/**
+ * Copy the saved image back into the registered regions and run the
+ * restore actions. The image is kept, so a snapshot can be restored any
+ * number of times.
+ */
+void
+StateSnapshot::restore ()
+{
+   if (! saved) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, MemoryMessages::internal_error,
+         "State snapshot restored before it was saved.");
+
+      // Not reached
+      return;
+   }
+
+   const char * base = image.data();
+   for (const Region & region : regions) {
+      std::memcpy (region.address, base + region.offset, region.size);
+   }
+   for (const auto & action : restore_actions) {
+      action ();
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,333 @@
+/*
+ * Compare JeodMemoryAllocTable against a std::map reference.
+ *
+ * The table is exercised with synthetic block addresses; it only stores and
+ * compares them. Random inserts and erases are checked after every step
+ * against a std::map from block start to block end, as are exact lookups,
+ * containment lookups and overlap queries. A second phase builds a probe
+ * cluster that wraps from the last slot to the first and erases its members
+ * in several orders, which exercises the backward-shift deletion across the
+ * end of the slot array.
+ */
+
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <vector>
+#include <stdint.h>
+
+#include "utils/memory/include/memory_alloc_table.hh"
+
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace jeod;
+
+
+typedef std::map<const void *, const void *> RefTable;
+
+unsigned int num_failures = 0;
+TestSimInterface sim_interface;
+
+
+/*
+ * Report a failed check.
+ */
+void
+check (
+   bool ok,
+   const char * what,
+   uintptr_t addr)
+{
+   if (! ok) {
+      ++num_failures;
+      if (num_failures <= 20) {
+         std::printf ("FAILED: %s at 0x%lx\n", what,
+                      static_cast<unsigned long> (addr));
+      }
+   }
+}
+
+
+/*
+ * Deterministic pseudo-random numbers (a 64 bit LCG).
+ */
+class Random {
+ public:
+   explicit Random (uint64_t seed) : state(seed) {}
+
+   unsigned int next (unsigned int limit)
+   {
+      state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+      return static_cast<unsigned int> ((state >> 33) % limit);
+   }
+
+ private:
+   uint64_t state;
+};
+
+
+/*
+ * Synthetic block addresses: block kk lives in the 256 byte cell at
+ * base + 256*kk and is at least 16 bytes long.
+ */
+const uintptr_t base_addr = 0x10000000;
+const uintptr_t cell_size = 256;
+
+const void *
+to_ptr (
+   uintptr_t addr)
+{
+   return reinterpret_cast<const void *> (addr);
+}
+
+
+/*
+ * Reference containment lookup.
+ */
+const void *
+ref_containing (
+   const RefTable & ref,
+   const void * addr)
+{
+   RefTable::const_iterator iter = ref.upper_bound (addr);
+   if (iter == ref.begin()) {
+      return nullptr;
+   }
+   --iter;
+   return std::less<const void *>() (addr, iter->second) ? iter->first : nullptr;
+}
+
+
+/*
+ * Reference overlap query.
+ */
+bool
+ref_overlaps (
+   const RefTable & ref,
+   const void * start,
+   const void * end)
+{
+   std::less<const void *> less;
+   RefTable::const_iterator iter = ref.lower_bound (start);
+   if ((iter != ref.end()) && less (iter->first, end)) {
+      return true;
+   }
+   if (iter != ref.begin()) {
+      --iter;
+      if (less (start, iter->second)) {
+         return true;
+      }
+   }
+   return false;
+}
+
+
+/*
+ * Check every query of the table against the reference.
+ */
+void
+compare (
+   const JeodMemoryAllocTable & table,
+   const RefTable & ref,
+   unsigned int ncells,
+   Random & random)
+{
+   check (table.size() == ref.size(), "size", 0);
+
+   // Every reference entry is found with the right extent.
+   for (RefTable::const_iterator iter = ref.begin(); iter != ref.end(); ++iter) {
+      const JeodMemoryAllocTable::Entry * entry = table.find (iter->first);
+      uintptr_t addr = reinterpret_cast<uintptr_t> (iter->first);
+      check ((entry != nullptr) && (entry->end == iter->second), "find", addr);
+   }
+
+   // Containment and overlap queries at random addresses and ranges.
+   for (unsigned int ii = 0; ii < 64; ++ii) {
+      uintptr_t addr = base_addr + random.next (ncells * cell_size);
+      const JeodMemoryAllocTable::Entry * entry =
+         table.find_containing (to_ptr (addr));
+      const void * expected = ref_containing (ref, to_ptr (addr));
+      check ((entry == nullptr) ? (expected == nullptr) :
+                                  (entry->addr == expected),
+             "find_containing", addr);
+
+      uintptr_t len = 1 + random.next (2 * cell_size);
+      check (table.overlaps (to_ptr (addr), to_ptr (addr + len)) ==
+             ref_overlaps (ref, to_ptr (addr), to_ptr (addr + len)),
+             "overlaps", addr);
+
+      // Exact lookups of non-starts fail.
+      if (ref.find (to_ptr (addr)) == ref.end()) {
+         check (table.find (to_ptr (addr)) == nullptr, "find absent", addr);
+      }
+   }
+
+   // The address-ordered listing matches the reference.
+   std::vector<JeodMemoryAllocTable::Entry> entries;
+   table.get_entries (JeodMemoryAllocTable::ByAddress, entries);
+   bool same = (entries.size() == ref.size());
+   RefTable::const_iterator iter = ref.begin();
+   for (std::size_t ii = 0; same && (ii < entries.size()); ++ii, ++iter) {
+      same = (entries[ii].addr == iter->first) &&
+             (entries[ii].end == iter->second);
+   }
+   check (same, "get_entries", 0);
+}
+
+
+/*
+ * Random inserts and erases, keeping at most max_live blocks.
+ */
+void
+random_test (
+   unsigned int ncells,
+   unsigned int max_live,
+   unsigned int nsteps,
+   uint64_t seed)
+{
+   JeodMemoryAllocTable table;
+   RefTable ref;
+   Random random (seed);
+   uint32_t next_id = 0;
+
+   for (unsigned int step = 0; step < nsteps; ++step) {
+      uintptr_t addr = base_addr + cell_size * random.next (ncells);
+      bool present = (ref.find (to_ptr (addr)) != ref.end());
+      bool do_insert = (ref.size() < max_live) && (random.next (3) != 0);
+
+      if (do_insert) {
+         uintptr_t end = addr + 16 * (1 + random.next (cell_size / 16));
+         JeodMemoryItem item (false, true, false, false,
+                              static_cast<unsigned int> (end - addr), 0, 0);
+         item.set_unique_id (++next_id);
+         check (table.insert (to_ptr (addr), to_ptr (end), item) == ! present,
+                "insert", addr);
+         if (! present) {
+            ref[to_ptr (addr)] = to_ptr (end);
+         }
+      }
+      else {
+         check (table.erase (to_ptr (addr)) == present, "erase", addr);
+         ref.erase (to_ptr (addr));
+      }
+
+      compare (table, ref, ncells, random);
+   }
+
+   // Empty the table in random order, then clear and reuse it.
+   while (! ref.empty()) {
+      RefTable::iterator iter = ref.begin();
+      std::advance (iter, random.next (static_cast<unsigned int> (ref.size())));
+      check (table.erase (iter->first), "drain",
+             reinterpret_cast<uintptr_t> (iter->first));
+      ref.erase (iter);
+      compare (table, ref, ncells, random);
+   }
+   check (table.empty(), "empty", 0);
+
+   JeodMemoryItem item;
+   table.insert (to_ptr (base_addr), to_ptr (base_addr + 16), item);
+   table.clear ();
+   check (table.empty() && (table.find (to_ptr (base_addr)) == nullptr),
+          "clear", base_addr);
+}
+
+
+/*
+ * Home slot in a 64 slot table. This mirrors the hash used by
+ * JeodMemoryAllocTable so that the test can build a cluster that wraps.
+ */
+unsigned int
+home_slot_64 (
+   uintptr_t addr)
+{
+   uint64_t key = static_cast<uint64_t> (addr);
+   return static_cast<unsigned int> (
+      ((key >> 4) * UINT64_C(0x9E3779B97F4A7C15)) >> 58);
+}
+
+
+/*
+ * Build a probe cluster whose members hash to the last slots of the table
+ * and spill over into the first slots, then erase the members in the given
+ * order, checking the survivors after each erase.
+ */
+void
+wraparound_test (
+   const std::vector<unsigned int> & erase_order)
+{
+   // Find addresses that hash to slots 62 and 63 and to slot 0. The table
+   // stays at its initial 64 slots while it holds no more than 40 blocks.
+   std::vector<uintptr_t> cluster;
+   unsigned int n62 = 0;
+   unsigned int n63 = 0;
+   unsigned int n0 = 0;
+   for (uintptr_t addr = base_addr;
+        (n62 < 2) || (n63 < 3) || (n0 < 2);
+        addr += 16) {
+      unsigned int home = home_slot_64 (addr);
+      if ((home == 62) && (n62 < 2)) {
+         cluster.push_back (addr);
+         ++n62;
+      }
+      else if ((home == 63) && (n63 < 3)) {
+         cluster.push_back (addr);
+         ++n63;
+      }
+      else if ((home == 0) && (n0 < 2)) {
+         cluster.push_back (addr);
+         ++n0;
+      }
+   }
+
+   JeodMemoryAllocTable table;
+   RefTable ref;
+   JeodMemoryItem item;
+   for (std::size_t ii = 0; ii < cluster.size(); ++ii) {
+      table.insert (to_ptr (cluster[ii]), to_ptr (cluster[ii] + 16), item);
+      ref[to_ptr (cluster[ii])] = to_ptr (cluster[ii] + 16);
+   }
+
+   Random random (erase_order.size());
+   compare (table, ref, 0x100000, random);
+   for (std::size_t ii = 0; ii < erase_order.size(); ++ii) {
+      uintptr_t addr = cluster[erase_order[ii] % cluster.size()];
+      bool present = (ref.erase (to_ptr (addr)) != 0);
+      check (table.erase (to_ptr (addr)) == present, "wrap erase", addr);
+      for (RefTable::const_iterator iter = ref.begin();
+           iter != ref.end();
+           ++iter) {
+         check (table.find (iter->first) != nullptr, "wrap find",
+                reinterpret_cast<uintptr_t> (iter->first));
+      }
+      check (table.find (to_ptr (addr)) == nullptr, "wrap erased", addr);
+   }
+}
+
+
+int
+main (
+   void)
+{
+   // Small tables stay at 64 slots, so probe sequences often wrap.
+   random_test (64, 40, 4000, 1);
+   random_test (200, 40, 4000, 2);
+
+   // Larger tables grow the slot array and split the sorted index runs.
+   random_test (4096, 3000, 8000, 3);
+
+   // Erase the wrapped cluster front first, back first, and interleaved.
+   unsigned int front[] = {0, 1, 2, 3, 4, 5, 6};
+   unsigned int back[]  = {6, 5, 4, 3, 2, 1, 0};
+   unsigned int mixed[] = {2, 5, 0, 6, 3, 1, 4};
+   wraparound_test (std::vector<unsigned int> (front, front + 7));
+   wraparound_test (std::vector<unsigned int> (back, back + 7));
+   wraparound_test (std::vector<unsigned int> (mixed, mixed + 7));
+
+   bool passed = (num_failures == 0);
+   std::printf ("Test %s (%u failed checks)\n",
+                (passed ? "passed" : "failed"), num_failures);
+
+   return passed ? 0 : 1;
+}
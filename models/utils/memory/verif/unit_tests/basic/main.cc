@@ -86,13 +86,19 @@ class MemoryPool {
    bool is_allocated (
       const void * ptr)
    {
-      bool allocated;
-      void * test_ptr = (void*)((char*)ptr - 16);
+      bool allocated = false;
+      const char * test_ptr = (const char*)ptr - 16;
 
+      // The guarded buffer either is a buffer obtained from operator new
+      // or lies within one (a slab carved up by the JEOD memory pool).
       active = false;
       {
-         AllocTable::iterator iter = alloc_table.find (test_ptr);
-         allocated = (iter != alloc_table.end());
+         AllocTable::iterator iter = alloc_table.upper_bound (test_ptr);
+         if (iter != alloc_table.begin()) {
+            --iter;
+            const char * buffer = (const char*)iter->first;
+            allocated = ((const char*)ptr < buffer + iter->second);
+         }
       }
       active = true;
       return allocated;
@@ -0,0 +1,307 @@
+/*
+ * Exercise the JeodMemoryPool size-class allocator.
+ *
+ * The global operator new[] and delete[] are replaced so that the test can
+ * see when the pool carves a new slab and when a request bypasses the pool.
+ * The test checks that
+ *  - released blocks are reused, within a size class and across the sizes
+ *    that share a class;
+ *  - blocks are aligned, distinct and do not overlap;
+ *  - exhausting the cached and central blocks of a class carves new slabs,
+ *    and blocks released afterwards are reused without carving more;
+ *  - requests above max_pooled_size fall back to new[] and are released
+ *    with delete[];
+ *  - blocks cached by a thread are returned to the central pool when the
+ *    thread exits and are then reused by other threads;
+ *  - a std::list using JeodPoolAllocator stops carving slabs once warm.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <new>
+#include <set>
+#include <vector>
+#include <pthread.h>
+#include <stdint.h>
+
+#include "utils/memory/include/memory_pool.hh"
+
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace jeod;
+
+
+/*
+ * Size of the slabs the pool carves blocks from; this matches slab_size in
+ * memory_pool.cc.
+ */
+const std::size_t pool_slab_size = 65536;
+
+// Counts of array allocations, by kind.
+unsigned long num_slab_news = 0;
+unsigned long num_large_news = 0;
+unsigned long num_large_deletes = 0;
+std::size_t large_size = 0;
+void * large_buffer = nullptr;
+
+unsigned int num_failures = 0;
+TestSimInterface sim_interface;
+
+
+void * operator new[] (std::size_t size)
+{
+   void * buf = std::malloc (size);
+   if (buf == nullptr) {
+      throw std::bad_alloc();
+   }
+   if (size == pool_slab_size) {
+      __sync_fetch_and_add (&num_slab_news, 1UL);
+   }
+   else if ((large_size != 0) && (size == large_size)) {
+      ++num_large_news;
+      large_buffer = buf;
+   }
+   return buf;
+}
+
+void operator delete[] (void * ptr) throw ()
+{
+   if ((ptr != nullptr) && (ptr == large_buffer)) {
+      ++num_large_deletes;
+      large_buffer = nullptr;
+   }
+   std::free (ptr);
+}
+
+
+/*
+ * Report a failed check.
+ */
+void
+check (
+   bool ok,
+   const char * what)
+{
+   if (! ok) {
+      ++num_failures;
+      std::printf ("FAILED: %s\n", what);
+   }
+}
+
+
+/*
+ * Allocate count blocks of the given size, checking that they are aligned,
+ * distinct, non-overlapping and writable.
+ */
+std::vector<void *>
+allocate_blocks (
+   std::size_t size,
+   unsigned int count)
+{
+   std::vector<void *> blocks;
+   std::set<uintptr_t> starts;
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      void * buf = JeodMemoryPool::allocate (size);
+      check ((reinterpret_cast<uintptr_t> (buf) % 16) == 0, "alignment");
+      std::memset (buf, static_cast<int> (ii & 0xff), size);
+      blocks.push_back (buf);
+      starts.insert (reinterpret_cast<uintptr_t> (buf));
+   }
+   check (starts.size() == count, "distinct blocks");
+
+   uintptr_t prev_end = 0;
+   for (std::set<uintptr_t>::const_iterator iter = starts.begin();
+        iter != starts.end();
+        ++iter) {
+      check (*iter >= prev_end, "non-overlapping blocks");
+      prev_end = *iter + size;
+   }
+
+   // Each block still holds its own fill pattern.
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      const unsigned char * bytes =
+         static_cast<const unsigned char *> (blocks[ii]);
+      check ((bytes[0] == (ii & 0xff)) && (bytes[size-1] == (ii & 0xff)),
+             "block contents");
+   }
+   return blocks;
+}
+
+
+/*
+ * Release blocks obtained from allocate_blocks.
+ */
+void
+release_blocks (
+   std::vector<void *> & blocks,
+   std::size_t size)
+{
+   for (std::size_t ii = 0; ii < blocks.size(); ++ii) {
+      JeodMemoryPool::release (blocks[ii], size);
+   }
+   blocks.clear();
+}
+
+
+/*
+ * Released blocks are reused.
+ */
+void
+test_reuse (
+   void)
+{
+   // The most recently released block of a class is handed out next.
+   void * first = JeodMemoryPool::allocate (40);
+   JeodMemoryPool::release (first, 40);
+   void * second = JeodMemoryPool::allocate (40);
+   check (second == first, "reuse of a released block");
+
+   // 33 through 48 bytes share a size class.
+   JeodMemoryPool::release (second, 40);
+   void * third = JeodMemoryPool::allocate (48);
+   check (third == first, "reuse across sizes of one class");
+   JeodMemoryPool::release (third, 48);
+
+   // A different class does not get the block.
+   void * other = JeodMemoryPool::allocate (64);
+   check (other != first, "classes are separate");
+   JeodMemoryPool::release (other, 64);
+
+   // A zero-byte request gets a usable block; a null release is ignored.
+   void * empty = JeodMemoryPool::allocate (0);
+   check (empty != nullptr, "zero-byte request");
+   JeodMemoryPool::release (empty, 0);
+   JeodMemoryPool::release (nullptr, 16);
+}
+
+
+/*
+ * Exhausting a class carves new slabs; released blocks are then reused.
+ */
+void
+test_exhaustion (
+   void)
+{
+   // A slab holds 16 blocks of the largest class; take three slabs' worth.
+   const std::size_t size = JeodMemoryPool::max_pooled_size;
+   const unsigned int count = 3 * (pool_slab_size / size);
+
+   unsigned long slabs_before = num_slab_news;
+   std::vector<void *> blocks = allocate_blocks (size, count);
+   check (num_slab_news >= slabs_before + 3, "exhaustion carves new slabs");
+
+   release_blocks (blocks, size);
+   unsigned long slabs_after = num_slab_news;
+   blocks = allocate_blocks (size, count);
+   check (num_slab_news == slabs_after, "released blocks are reused");
+   release_blocks (blocks, size);
+}
+
+
+/*
+ * Requests above max_pooled_size go to new[] and delete[].
+ */
+void
+test_large (
+   void)
+{
+   large_size = JeodMemoryPool::max_pooled_size + 1;
+   void * buf = JeodMemoryPool::allocate (large_size);
+   check ((num_large_news == 1) && (buf == large_buffer),
+          "large request uses new[]");
+   std::memset (buf, 0x5a, large_size);
+   JeodMemoryPool::release (buf, large_size);
+   check (num_large_deletes == 1, "large release uses delete[]");
+   large_size = 0;
+}
+
+
+/*
+ * Allocate and release blocks of one class in a worker thread.
+ */
+void *
+worker (
+   void * arg)
+{
+   std::size_t size = *static_cast<std::size_t *> (arg);
+   std::vector<void *> blocks = allocate_blocks (size, 200);
+   release_blocks (blocks, size);
+   return nullptr;
+}
+
+
+/*
+ * Blocks cached by an exiting thread become available to other threads.
+ */
+void
+test_thread_exit (
+   void)
+{
+   // 2048 bytes is a class no other test uses, so the main thread has no
+   // cached blocks of it.
+   std::size_t size = 2048;
+   pthread_t thread;
+   pthread_create (&thread, nullptr, worker, &size);
+   pthread_join (thread, nullptr);
+
+   unsigned long slabs_before = num_slab_news;
+   std::vector<void *> blocks = allocate_blocks (size, 200);
+   check (num_slab_news == slabs_before,
+          "blocks from an exited thread are reused");
+   release_blocks (blocks, size);
+}
+
+
+/*
+ * A list using the pool allocator stops carving slabs once warm.
+ */
+void
+test_allocator (
+   void)
+{
+   std::list<double, JeodPoolAllocator<double> > values;
+   for (int ii = 0; ii < 1000; ++ii) {
+      values.push_back (ii);
+   }
+   values.clear ();
+
+   unsigned long slabs_before = num_slab_news;
+   for (int pass = 0; pass < 10; ++pass) {
+      for (int ii = 0; ii < 1000; ++ii) {
+         values.push_back (ii);
+      }
+      double sum = 0.0;
+      for (std::list<double, JeodPoolAllocator<double> >::const_iterator
+              iter = values.begin();
+           iter != values.end();
+           ++iter) {
+         sum += *iter;
+      }
+      check (sum == 499500.0, "list contents");
+      values.clear ();
+   }
+   check (num_slab_news == slabs_before, "warm list allocates no slabs");
+
+   check (JeodPoolAllocator<double>() == JeodPoolAllocator<int>(),
+          "allocators compare equal");
+}
+
+
+int
+main (
+   void)
+{
+   test_reuse ();
+   test_exhaustion ();
+   test_large ();
+   test_thread_exit ();
+   test_allocator ();
+
+   bool passed = (num_failures == 0);
+   std::printf ("Test %s (%u failed checks)\n",
+                (passed ? "passed" : "failed"), num_failures);
+
+   return passed ? 0 : 1;
+}
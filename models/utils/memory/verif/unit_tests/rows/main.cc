@@ -0,0 +1,166 @@
+/*
+ * Exercise the row-indexed array macros JEOD_ALLOC_PRIM_MATRIX,
+ * JEOD_ALLOC_PRIM_TRIANGLE and JEOD_DELETE_PRIM_ROWS.
+ *
+ * Matrices and triangles of several shapes and element types are allocated,
+ * checked for layout (rows back to back in one zero-filled data block, each
+ * row the expected length) and for registration of both allocations with the
+ * memory manager, written and read back, and released. The test passes only
+ * if every check holds and the memory manager's allocation table is empty at
+ * the end; the memory model error codes are verboten, so releasing anything
+ * the manager does not know about also fails the test.
+ */
+
+#include <cstdio>
+
+#include "utils/memory/include/jeod_alloc.hh"
+
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace jeod;
+
+
+unsigned int num_failures = 0;
+TestSimInterface sim_interface;
+
+
+/*
+ * Report a failed check.
+ */
+void
+check (
+   bool ok,
+   const char * what,
+   unsigned int nrows)
+{
+   if (! ok) {
+      ++num_failures;
+      std::printf ("FAILED: %s (%u rows)\n", what, nrows);
+   }
+}
+
+
+/*
+ * Check the layout and contents of a row-indexed array whose row ii holds
+ * row_base + ii*row_step elements, then fill it with distinct values and
+ * read them back.
+ */
+template<typename T>
+void
+check_rows (
+   T ** rows,
+   unsigned int nrows,
+   unsigned int row_base,
+   unsigned int row_step)
+{
+   check ((rows != nullptr) && (rows[0] != nullptr), "allocation", nrows);
+   if ((rows == nullptr) || (rows[0] == nullptr)) {
+      return;
+   }
+
+   // Both the row pointer array and the data block are registered.
+   check (JEOD_IS_ALLOCATED (rows) && JEOD_IS_ALLOCATED (rows[0]),
+          "registration", nrows);
+
+   // The rows lie back to back in the data block.
+   check (jeod_alloc_rows_are_linked (rows, nrows, row_base, row_step),
+          "row layout", nrows);
+   std::size_t offset = 0;
+   for (unsigned int ii = 0; ii < nrows; ++ii) {
+      check (rows[ii] == rows[0] + offset, "row offset", nrows);
+      offset += row_base + ii * row_step;
+   }
+   check (offset == jeod_alloc_rows_size (nrows, row_base, row_step),
+          "data block size", nrows);
+
+   // The data block is zero-filled.
+   bool zero = true;
+   for (std::size_t kk = 0; kk < offset; ++kk) {
+      zero = zero && (rows[0][kk] == T(0));
+   }
+   check (zero, "zero fill", nrows);
+
+   // Every element is addressable as rows[ii][jj] and distinct.
+   T value = T(1);
+   for (unsigned int ii = 0; ii < nrows; ++ii) {
+      for (unsigned int jj = 0; jj < row_base + ii * row_step; ++jj) {
+         rows[ii][jj] = value;
+         value += T(1);
+      }
+   }
+   bool same = true;
+   for (std::size_t kk = 0; kk < offset; ++kk) {
+      same = same && (rows[0][kk] == T(kk + 1));
+   }
+   check (same, "element access", nrows);
+}
+
+
+int
+main (
+   void)
+{
+   MessageHandler::set_suppression_level (MessageHandler::Notice);
+   JeodMemoryManager::set_debug_level (2);
+   sim_interface.add_allowed_code ("utils/memory/debug");
+   sim_interface.add_verboten_code ("utils/memory");
+
+   // Matrices, including a single element and a single row and column.
+   double ** d1x1 = JEOD_ALLOC_PRIM_MATRIX (1, 1, double);
+   check_rows (d1x1, 1, 1, 0);
+   double ** d3x4 = JEOD_ALLOC_PRIM_MATRIX (3, 4, double);
+   check_rows (d3x4, 3, 4, 0);
+   int ** i1x9 = JEOD_ALLOC_PRIM_MATRIX (1, 9, int);
+   check_rows (i1x9, 1, 9, 0);
+   int ** i9x1 = JEOD_ALLOC_PRIM_MATRIX (9, 1, int);
+   check_rows (i9x1, 9, 1, 0);
+
+   // Triangles, with and without elements beyond the diagonal.
+   double ** tri = JEOD_ALLOC_PRIM_TRIANGLE (8, 0, double);
+   check_rows (tri, 8, 1, 1);
+   double ** tri_extra = JEOD_ALLOC_PRIM_TRIANGLE (5, 2, double);
+   check_rows (tri_extra, 5, 3, 1);
+   int ** tri_single = JEOD_ALLOC_PRIM_TRIANGLE (1, 0, int);
+   check_rows (tri_single, 1, 1, 1);
+
+   check (! JeodMemoryManager::is_table_empty(), "table while allocated", 0);
+
+   // Release in an order unrelated to the allocation order; the macro also
+   // nulls the pointer.
+   JEOD_DELETE_PRIM_ROWS (tri);
+   JEOD_DELETE_PRIM_ROWS (d3x4);
+   JEOD_DELETE_PRIM_ROWS (i9x1);
+   JEOD_DELETE_PRIM_ROWS (tri_single);
+   JEOD_DELETE_PRIM_ROWS (d1x1);
+   JEOD_DELETE_PRIM_ROWS (tri_extra);
+   JEOD_DELETE_PRIM_ROWS (i1x9);
+   check ((tri == nullptr) && (d3x4 == nullptr) && (tri_extra == nullptr),
+          "pointer nulled", 0);
+
+   // Releasing a null row array is a no-op.
+   JEOD_DELETE_PRIM_ROWS (tri);
+
+   // Allocate and release repeatedly, as a model that resizes its tables
+   // would.
+   for (unsigned int degree = 1; degree <= 20; ++degree) {
+      double ** Cnm = JEOD_ALLOC_PRIM_TRIANGLE (degree + 1, 0, double);
+      double ** Snm = JEOD_ALLOC_PRIM_TRIANGLE (degree + 1, 0, double);
+      check_rows (Cnm, degree + 1, 1, 1);
+      check_rows (Snm, degree + 1, 1, 1);
+      JEOD_DELETE_PRIM_ROWS (Cnm);
+      JEOD_DELETE_PRIM_ROWS (Snm);
+   }
+
+   // Determine whether this test passed.
+   bool all_freed = JeodMemoryManager::is_table_empty();
+   check (all_freed, "table empty after release", 0);
+
+   // Shutdown the memory manager.
+   sim_interface.shutdown ();
+
+   bool passed = (num_failures == 0);
+   std::printf ("Test %s (%u failed checks)\n",
+                (passed ? "passed" : "failed"), num_failures);
+
+   return passed ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Message
+ * @{
+ *
+ * @file models/utils/message/include/async_message_sink.hh
+ * Define the class AsyncMessageSink, which moves the output of formatted
+ * messages off the threads that generate them.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Messages posted by one thread are delivered in the order posted;
+    messages from different threads are interleaved in drain order.)
+   (A message that does not fit in a ring slot, or that is posted while the
+    poster's ring is full, is not queued.))
+
+Library dependencies:
+  ((../src/async_message_sink.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_ASYNC_MESSAGE_SINK_HH
+#define JEOD_ASYNC_MESSAGE_SINK_HH
+
+// System includes
+#include <cstddef>
+#include <pthread.h>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Delivers formatted messages from a background thread.
+ * Each thread that posts a message gets its own single-producer ring buffer
+ * on first use, so posting takes no locks. The output thread drains the
+ * rings periodically and passes each message to the delivery function.
+ * The output thread also limits the number of messages delivered per
+ * message code in each rate window and reports how many it discarded.
+ */
+class AsyncMessageSink {
+JEOD_MAKE_SIM_INTERFACES(AsyncMessageSink)
+
+public:
+
+   /**
+    * Function that writes one formatted message.
+    * @param context  Context supplied to start()
+    * @param text     Formatted message
+    */
+   typedef void (* DeliverFunction) (void * context, const char * text);
+
+
+   // Member data
+
+   /**
+    * Maximum number of messages with the same message code delivered per
+    * rate window. Zero disables rate limiting.
+    */
+   unsigned int rate_limit; //!< trick_units(count)
+
+   /**
+    * Length of the rate-limiting window, in wall-clock seconds.
+    */
+   double rate_window; //!< trick_units(s)
+
+   /**
+    * Interval at which the output thread drains the rings, in wall-clock
+    * seconds.
+    */
+   double drain_interval; //!< trick_units(s)
+
+   /**
+    * Number of message slots in each thread's ring. Rounded up to a power of
+    * two when the sink is first started.
+    */
+   unsigned int ring_slots; //!< trick_units(count)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   AsyncMessageSink (void);
+   ~AsyncMessageSink (void);
+
+   // Start the output thread.
+   bool start (DeliverFunction deliver_fn, void * deliver_context);
+
+   // Deliver everything posted so far and stop the output thread.
+   void stop (void);
+
+   // Queue a formatted message for delivery.
+   bool post (const char * msg_code, const char * text) const;
+
+   /**
+    * Is the output thread running?
+    * @return True if posted messages are delivered asynchronously
+    */
+   bool is_running (void) const
+   { return running; }
+
+   // Number of messages lost to full rings.
+   unsigned long get_num_overflowed (void) const;
+
+
+private:
+
+   struct Ring;
+   struct RingTable;
+
+   // Output thread entry point.
+   static void * output_thread_main (void * sink);
+
+   // Deliver the queued messages, applying the rate limit.
+   void drain (void);
+
+   // Report and reset the rate-limit counts.
+   void end_rate_window (void);
+
+
+   // Member data
+
+   /**
+    * Delivery function supplied to start().
+    */
+   DeliverFunction deliver; //!< trick_io(**)
+
+   /**
+    * Context supplied to start().
+    */
+   void * context; //!< trick_io(**)
+
+   /**
+    * The per-thread rings and the rate-limit counts.
+    */
+   RingTable * table; //!< trick_io(**)
+
+   /**
+    * The output thread.
+    */
+   pthread_t output_thread; //!< trick_io(**)
+
+   /**
+    * Is the output thread running?
+    */
+   bool running; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   AsyncMessageSink (const AsyncMessageSink &);
+
+   /**
+    * Not implemented.
+    */
+   AsyncMessageSink & operator= (const AsyncMessageSink &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
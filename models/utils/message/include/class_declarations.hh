@@ -69,6 +69,7 @@ Assumptions and limitations:
 //! Namespace jeod
 namespace jeod {
 
+class AsyncMessageSink;
 class MessageHandler;
 
 } // End JEOD namespace
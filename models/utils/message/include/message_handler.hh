@@ -73,6 +73,18 @@ Library dependencies:
 #include "class_declarations.hh"
 
 
+/**
+ * Compile-time severity limit. Messages generated through the
+ * JEOD_MESSAGE_WARN, JEOD_MESSAGE_INFORM and JEOD_MESSAGE_DEBUG macros whose
+ * severity exceeds this value are removed by the compiler, and
+ * MessageHandler::will_report never reports them.
+ * Failures and errors cannot be compiled out.
+ */
+#ifndef JEOD_MESSAGE_SEVERITY_LIMIT
+#define JEOD_MESSAGE_SEVERITY_LIMIT 999
+#endif
+
+
 
 //! Namespace jeod
 namespace jeod {
@@ -103,6 +115,11 @@ namespace jeod {
  *      sort. Enabling them may well result in spew.
  *  - A public default constructor and destructor.
  *    The constructor ensures that the created object is indeed a singleton.
+ *  - Filtering before dispatch. The static message generation functions
+ *    drop a message of positive severity that will_report rejects, so a
+ *    derived class's process_message never sees a suppressed message. A
+ *    derived class that wants to see every message sets
+ *    dispatch_suppressed and does its own filtering.
  *  -
  */
 class MessageHandler {
@@ -188,6 +205,38 @@ public:
 #endif
 
 
+   /**
+    * Would a message with the given severity and message code be reported?
+    * The test is inline and costs a few comparisons unless message codes are
+    * being suppressed; it lets callers skip building the arguments of a
+    * message that would be discarded. The test is conservative: it answers
+    * true when there is no handler, so that the message call diagnoses that,
+    * and when the handler has set dispatch_suppressed.
+    * @return True if the message would be reported
+    * @param severity  Severity level
+    * @param msg_code  Message code
+    */
+   static bool will_report (
+      int severity,
+      const char * msg_code)
+   {
+      if (severity <= 0) {
+         return true;
+      }
+      if (severity > JEOD_MESSAGE_SEVERITY_LIMIT) {
+         return false;
+      }
+      if ((handler == nullptr) || handler->dispatch_suppressed) {
+         return true;
+      }
+      if (static_cast<unsigned int>(severity) > handler->suppression_level) {
+         return false;
+      }
+      return ! (handler->codes_suppressed &&
+                handler->code_is_suppressed (msg_code));
+   }
+
+
    // The next set of public interfaces provide the ability to suppress certain
    // messages and to control the appearance of displayed messages.
 
@@ -261,7 +310,7 @@ public:
     * severity levels as fatal; they must not return to the calling procedure.
     * In other words, failures eventually result in a call to exit.
     */
-   const static int Failure; //!< trick_io(*o) trick_units(--)
+   const static int Failure = -1; //!< trick_io(*o) trick_units(--)
 
    /**
     * The severity value passed by the static public MessageHandler::error
@@ -273,7 +322,7 @@ public:
     * messages might nonetheless need to be generated, depending on the
     * value of the user-settable suppression_level.
     */
-   const static int Error; //!< trick_io(*o) trick_units(--)
+   const static int Error = 0; //!< trick_io(*o) trick_units(--)
 
    /**
     * The severity value passed by the static public MessageHandler::warn
@@ -281,7 +330,7 @@ public:
     * This is set to 9 in the implementation. The intent is to indicate a
     * condition that might indicate that results are suspect.
     */
-   const static int Warning; //!< trick_io(*o) trick_units(--)
+   const static int Warning = 9; //!< trick_io(*o) trick_units(--)
 
    /**
     * The severity value passed by the static public MessageHandler::inform
@@ -289,7 +338,7 @@ public:
     * This is set to 99 in the implementation. The intent is to indicate a
     * non-error condition that might be worthy of a user notification.
     */
-   const static int Notice; //!< trick_io(*o) trick_units(--)
+   const static int Notice = 99; //!< trick_io(*o) trick_units(--)
 
    /**
     * The severity value passed by the static public MessageHandler::debug
@@ -299,7 +348,7 @@ public:
     * Ideally, JEOD code, particularly initialization code, will be peppered
     * with calls to MessageHandler::debug.
     */
-   const static int Debug; //!< trick_io(*o) trick_units(--)
+   const static int Debug = 999; //!< trick_io(*o) trick_units(--)
 
 
  protected:
@@ -317,7 +366,10 @@ public:
     * handler in the form of a call to process_message().
     *
     * An instantiable derived MessageHandler class must supply this
-    * function.
+    * function. Messages that will_report rejects are dropped before this
+    * function is called unless dispatch_suppressed is set, in which case
+    * the function receives every message and must apply the suppression
+    * level and suppressed codes itself.
     *
     * @param severity  Severity level
     * @param prefix    Message prefix (e.g., Error)
@@ -379,6 +431,24 @@ public:
    {}
 
 
+   /**
+    * Is the message code in the set of suppressed message codes?
+    * Called by will_report only when codes_suppressed is set.
+    *
+    * As with process_add_suppressed_code, the default for this function is
+    * that no code is suppressed.
+    *
+    * @param msg_code  Message code
+    * @return True if messages with this code are suppressed
+    */
+   virtual bool code_is_suppressed (
+      const char * msg_code JEOD_UNUSED)
+   const
+   {
+      return false;
+   }
+
+
    // Static member data
 
    /**
@@ -421,6 +491,25 @@ public:
     */
    bool suppress_location; //!< trick_units(--)
 
+   /**
+    * Set by derived classes when at least one message code is suppressed,
+    * which lets will_report skip the code lookup in the usual case.
+    * Derived classes that suppress codes recompute this on restart from
+    * their own checkpointed set of codes.
+    *
+    * Default value: false.
+    */
+   bool codes_suppressed; //!< trick_io(**)
+
+   /**
+    * Set by derived classes whose process_message must see suppressed
+    * messages as well. will_report then reports every message, and the
+    * derived class does its own filtering.
+    *
+    * Default value: false.
+    */
+   bool dispatch_suppressed; //!< trick_units(--)
+
 
  private:
    // The copy constructor and assignment operator for this class are declared
@@ -440,6 +529,46 @@ public:
 
 } // End JEOD namespace
 
+
+#ifndef SWIG
+/**
+ * Generate a warning only if it would be reported. Unlike a direct call to
+ * MessageHandler::warn, the arguments after the message code are not
+ * evaluated for a suppressed message, and the whole statement is compiled
+ * out when JEOD_MESSAGE_SEVERITY_LIMIT is below MessageHandler::Warning.
+ */
+#define JEOD_MESSAGE_WARN(file, line, msg_code, ...)                          \
+   do {                                                                       \
+      if (jeod::MessageHandler::will_report (                                 \
+             jeod::MessageHandler::Warning, msg_code)) {                      \
+         jeod::MessageHandler::warn (file, line, msg_code, __VA_ARGS__);     \
+      }                                                                       \
+   } while (0)
+
+/**
+ * Generate a notice only if it would be reported; see JEOD_MESSAGE_WARN.
+ */
+#define JEOD_MESSAGE_INFORM(file, line, msg_code, ...)                        \
+   do {                                                                       \
+      if (jeod::MessageHandler::will_report (                                 \
+             jeod::MessageHandler::Notice, msg_code)) {                       \
+         jeod::MessageHandler::inform (file, line, msg_code, __VA_ARGS__);   \
+      }                                                                       \
+   } while (0)
+
+/**
+ * Generate a debug message only if it would be reported;
+ * see JEOD_MESSAGE_WARN.
+ */
+#define JEOD_MESSAGE_DEBUG(file, line, msg_code, ...)                         \
+   do {                                                                       \
+      if (jeod::MessageHandler::will_report (                                 \
+             jeod::MessageHandler::Debug, msg_code)) {                        \
+         jeod::MessageHandler::debug (file, line, msg_code, __VA_ARGS__);    \
+      }                                                                       \
+   } while (0)
+#endif
+
 #endif
 
 /**
@@ -81,6 +81,12 @@ class MessageMessages {
     */
    static char const * singleton_error; //!< trick_units(--)
 
+   /**
+    * Issued when the asynchronous message sink cannot start its output
+    * thread; messages are then written synchronously.
+    */
+   static char const * thread_error; //!< trick_units(--)
+
 
  // Member functions
  // This class is not instantiable.
@@ -67,6 +67,7 @@ Library dependencies:
 
 // JEOD includes
 #include "utils/container/include/primitive_set.hh"
+#include "utils/container/include/simple_checkpointable.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
@@ -76,6 +77,34 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+class SuppressedCodeMessageHandler;
+
+
+/**
+ * The codes_suppressed flag summarizes the checkpointed set of suppressed
+ * codes. This class recomputes it once a restart has restored that set.
+ */
+class SuppressedCodeRestart : public SimpleCheckpointable {
+
+public:
+   explicit SuppressedCodeRestart (SuppressedCodeMessageHandler & in);
+   ~SuppressedCodeRestart (void) override;
+
+   void simple_restore (void) override;
+   void post_restart (void) override;
+
+protected:
+   /**
+    * The handler whose flag is to be recomputed.
+    */
+   SuppressedCodeMessageHandler & message_handler; //!< trick_io(**)
+
+private:
+   SuppressedCodeRestart (const SuppressedCodeRestart &);
+   SuppressedCodeRestart & operator = (const SuppressedCodeRestart &);
+};
+
+
 /**
  * Adds the capability to suppress messages by their message code to the
    base MessageHandler class.
@@ -83,6 +112,8 @@ namespace jeod {
 class SuppressedCodeMessageHandler : public MessageHandler {
 JEOD_MAKE_SIM_INTERFACES(SuppressedCodeMessageHandler)
 
+   friend class SuppressedCodeRestart;
+
 public:
 
    // Member functions
@@ -99,7 +130,7 @@ public:
       Purpose:
         (Default constructor.)
     */
-   SuppressedCodeMessageHandler (void) {}
+   SuppressedCodeMessageHandler (void) : restart(*this) {}
 
       /**
     * Destructor.
@@ -126,6 +157,7 @@ protected:
       const char * msg_code) override
    {
       suppressed_codes.insert (msg_code);
+      codes_suppressed = true;
    }
 
 
@@ -137,6 +169,7 @@ protected:
       const char * msg_code) override
    {
       suppressed_codes.erase (msg_code);
+      codes_suppressed = ! suppressed_codes.empty();
    }
 
 
@@ -147,6 +180,31 @@ protected:
       void)
    {
       suppressed_codes.clear ();
+      codes_suppressed = false;
+   }
+
+
+      /**
+    * Clear the set of messages that are to be suppressed.
+    * This is the override that MessageHandler::clear_suppressed_codes calls.
+    */
+   void process_clear_suppressed_codes (
+      void) override
+   {
+      process_clear_suppressed_code ();
+   }
+
+
+      /**
+    * Determine whether a message code is in the set of suppressed codes.
+    * @return True => code is suppressed
+    * \param[in] msg_code Message code
+    */
+   bool code_is_suppressed (
+      const char * msg_code)
+   const override
+   {
+      return suppressed_codes.find (msg_code) != suppressed_codes.end();
    }
 
 
@@ -163,7 +221,7 @@ protected:
    {
       return (severity <= 0) ||
              ((static_cast<unsigned int>(severity) <= suppression_level) &&
-              (suppressed_codes.find (msg_code) == suppressed_codes.end()));
+              (! code_is_suppressed (msg_code)));
    }
 
 
@@ -174,6 +232,11 @@ protected:
     */
    JeodPrimitiveSet<std::string>::type suppressed_codes; //!< trick_io(**)
 
+   /**
+    * Recomputes codes_suppressed from suppressed_codes on restart.
+    */
+   SuppressedCodeRestart restart; //!< trick_io(**)
+
 
 
  private:
@@ -0,0 +1,494 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Message
+ * @{
+ *
+ * @file models/utils/message/src/async_message_sink.cc
+ * Define member functions for the class AsyncMessageSink.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((async_message_sink.cc)
+   (message_handler.cc)
+   (message_messages.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+
+// Model includes
+#include "../include/async_message_sink.hh"
+#include "../include/message_handler.hh"
+#include "../include/message_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Size of the message code field of a ring slot.
+ */
+const std::size_t slot_code_size = 64;
+
+/**
+ * Size of the message text field of a ring slot.
+ */
+const std::size_t slot_text_size = 1024;
+
+/**
+ * Maximum number of posting threads; later threads are not queued.
+ */
+const unsigned int max_rings = 256;
+
+/**
+ * Source of the ring table identifiers used by the per-thread cache.
+ */
+std::atomic<unsigned int> table_id_source (0);
+
+
+/**
+ * Current wall-clock time.
+ * @return Monotonic time, seconds
+ */
+double
+wall_time (
+   void)
+{
+   struct timespec now;
+   clock_gettime (CLOCK_MONOTONIC, &now);
+   return static_cast<double>(now.tv_sec) + 1e-9 * now.tv_nsec;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * One queued message.
+ */
+struct AsyncMessageSinkSlot {
+   char code[slot_code_size];
+   char text[slot_text_size];
+};
+
+
+/**
+ * A single-producer, single-consumer ring of message slots. The posting
+ * thread advances head; the output thread advances tail.
+ */
+struct AsyncMessageSink::Ring {
+   std::vector<AsyncMessageSinkSlot> slots;
+   unsigned long mask;
+   std::atomic<unsigned long> head;
+   std::atomic<unsigned long> tail;
+   std::atomic<unsigned long> overflowed;
+
+   explicit Ring (unsigned int nslots)
+   :
+      slots(nslots),
+      mask(nslots - 1),
+      head(0),
+      tail(0),
+      overflowed(0)
+   { }
+};
+
+
+/**
+ * The rings of the posting threads and the output thread's state.
+ */
+struct AsyncMessageSink::RingTable {
+
+   /**
+    * Messages delivered and discarded for one message code in the current
+    * rate window.
+    */
+   struct CodeCount {
+      unsigned int delivered;
+      unsigned int discarded;
+   };
+
+   unsigned int id;
+   unsigned int ring_slots;
+   std::atomic<bool> accepting;
+   std::atomic<bool> stop_requested;
+   std::atomic<unsigned int> num_rings;
+   Ring * rings[max_rings];
+   pthread_mutex_t register_mutex;
+
+   std::map<std::string, CodeCount> code_counts;
+   double window_start;
+   std::atomic<unsigned long> total_overflowed;
+
+   explicit RingTable (unsigned int nslots)
+   :
+      id(++table_id_source),
+      ring_slots(nslots),
+      accepting(false),
+      stop_requested(false),
+      num_rings(0),
+      code_counts(),
+      window_start(0.0),
+      total_overflowed(0)
+   {
+      pthread_mutex_init (&register_mutex, nullptr);
+   }
+
+   ~RingTable ()
+   {
+      for (unsigned int ii = 0; ii < num_rings.load(); ++ii) {
+         delete rings[ii];
+      }
+      pthread_mutex_destroy (&register_mutex);
+   }
+
+   Ring * register_ring (void);
+};
+
+
+namespace {
+
+/**
+ * The calling thread's ring, and the table it belongs to.
+ */
+struct ThreadRingCache {
+   unsigned int table_id;
+   void * ring;
+};
+
+thread_local ThreadRingCache thread_ring = {0, nullptr};
+
+} // End anonymous namespace
+
+
+/**
+ * Create and publish a ring for the calling thread.
+ * @return The ring, or null if the table is full
+ */
+AsyncMessageSink::Ring *
+AsyncMessageSink::RingTable::register_ring (
+   void)
+{
+   Ring * ring = nullptr;
+   pthread_mutex_lock (&register_mutex);
+   unsigned int nrings = num_rings.load (std::memory_order_relaxed);
+   if (nrings < max_rings) {
+      ring = new Ring (ring_slots);
+      rings[nrings] = ring;
+      num_rings.store (nrings + 1, std::memory_order_release);
+   }
+   pthread_mutex_unlock (&register_mutex);
+   return ring;
+}
+
+
+/**
+ * AsyncMessageSink default constructor.
+ */
+AsyncMessageSink::AsyncMessageSink (
+   void)
+:
+   rate_limit(10),
+   rate_window(1.0),
+   drain_interval(0.01),
+   ring_slots(256),
+   deliver(nullptr),
+   context(nullptr),
+   table(nullptr),
+   output_thread(),
+   running(false)
+{
+   JEOD_REGISTER_CLASS (AsyncMessageSink);
+}
+
+
+/**
+ * AsyncMessageSink destructor.
+ */
+AsyncMessageSink::~AsyncMessageSink (
+   void)
+{
+   stop ();
+   delete table;
+}
+
+
+/**
+ * Start the output thread. Messages posted from now until stop() is called
+ * are passed to the delivery function on that thread.
+ * @return True if the output thread was started
+ * \param[in] deliver_fn Function that writes one formatted message
+ * \param[in] deliver_context Context passed to deliver_fn
+ */
+bool
+AsyncMessageSink::start (
+   DeliverFunction deliver_fn,
+   void * deliver_context)
+{
+   if (running) {
+      return true;
+   }
+
+   // The ring table outlives stop() so that a thread still holding its ring
+   // never sees freed memory. It is sized when first created.
+   if (table == nullptr) {
+      unsigned int nslots = 2;
+      while (nslots < ring_slots) {
+         nslots *= 2;
+      }
+      table = new RingTable (nslots);
+   }
+
+   deliver = deliver_fn;
+   context = deliver_context;
+   table->stop_requested.store (false);
+   table->window_start = wall_time ();
+
+   if (pthread_create (&output_thread, nullptr,
+                       output_thread_main, this) != 0) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, MessageMessages::thread_error,
+         "Unable to start the asynchronous message output thread.\n"
+         "Messages will be written synchronously.");
+      return false;
+   }
+
+   running = true;
+   table->accepting.store (true, std::memory_order_release);
+   return true;
+}
+
+
+/**
+ * Stop accepting messages, deliver everything already posted, and stop the
+ * output thread.
+ */
+void
+AsyncMessageSink::stop (
+   void)
+{
+   if (! running) {
+      return;
+   }
+
+   table->accepting.store (false, std::memory_order_release);
+   table->stop_requested.store (true, std::memory_order_release);
+   pthread_join (output_thread, nullptr);
+   running = false;
+
+   // Pick up anything posted while the output thread was finishing.
+   drain ();
+   end_rate_window ();
+}
+
+
+/**
+ * Queue a formatted message for delivery. The call takes no locks except
+ * when a thread posts for the first time.
+ * A full ring discards the message; the discard is counted and reported.
+ * @return True if the sink took the message, false if the caller should
+ *         write it synchronously (sink not running, too many threads, or
+ *         message too long for a slot)
+ * \param[in] msg_code Message code
+ * \param[in] text Formatted message
+ */
+bool
+AsyncMessageSink::post (
+   const char * msg_code,
+   const char * text)
+const
+{
+   if ((table == nullptr) ||
+       (! table->accepting.load (std::memory_order_acquire))) {
+      return false;
+   }
+
+   std::size_t text_length = std::strlen (text);
+   if (text_length >= slot_text_size) {
+      return false;
+   }
+
+   if (thread_ring.table_id != table->id) {
+      thread_ring.ring = table->register_ring ();
+      thread_ring.table_id = table->id;
+   }
+   Ring * ring = static_cast<Ring *>(thread_ring.ring);
+   if (ring == nullptr) {
+      return false;
+   }
+
+   unsigned long head = ring->head.load (std::memory_order_relaxed);
+   unsigned long tail = ring->tail.load (std::memory_order_acquire);
+   if (head - tail > ring->mask) {
+      ring->overflowed.fetch_add (1, std::memory_order_relaxed);
+      return true;
+   }
+
+   AsyncMessageSinkSlot & slot = ring->slots[head & ring->mask];
+   std::strncpy (slot.code, msg_code, slot_code_size - 1);
+   slot.code[slot_code_size - 1] = '\0';
+   std::memcpy (slot.text, text, text_length + 1);
+   ring->head.store (head + 1, std::memory_order_release);
+
+   return true;
+}
+
+
+/**
+ * Number of messages discarded because a ring was full, including those
+ * not yet reported by the output thread.
+ * @return Overflow count
+ */
+unsigned long
+AsyncMessageSink::get_num_overflowed (
+   void)
+const
+{
+   if (table == nullptr) {
+      return 0;
+   }
+   unsigned long count =
+      table->total_overflowed.load (std::memory_order_relaxed);
+   for (unsigned int ii = 0; ii < table->num_rings.load(); ++ii) {
+      count += table->rings[ii]->overflowed.load (std::memory_order_relaxed);
+   }
+   return count;
+}
+
+
+/**
+ * Output thread entry point: drain the rings every drain_interval until
+ * stop() is called.
+ * @return Null
+ * \param[in] sink The AsyncMessageSink
+ */
+void *
+AsyncMessageSink::output_thread_main (
+   void * sink)
+{
+   AsyncMessageSink & self = *static_cast<AsyncMessageSink *>(sink);
+   RingTable & table = *self.table;
+
+   double interval = (self.drain_interval > 0.0) ? self.drain_interval : 0.01;
+   struct timespec pause;
+   pause.tv_sec = static_cast<time_t>(interval);
+   pause.tv_nsec = static_cast<long>((interval - pause.tv_sec) * 1e9);
+
+   while (! table.stop_requested.load (std::memory_order_acquire)) {
+      self.drain ();
+      if (wall_time () - table.window_start >= self.rate_window) {
+         self.end_rate_window ();
+      }
+      nanosleep (&pause, nullptr);
+   }
+   self.drain ();
+
+   return nullptr;
+}
+
+
+/**
+ * Deliver the messages queued in every ring, applying the rate limit.
+ * Only one thread (the output thread, or the stopping thread after the
+ * output thread has exited) drains at a time.
+ */
+void
+AsyncMessageSink::drain (
+   void)
+{
+   unsigned int nrings = table->num_rings.load (std::memory_order_acquire);
+
+   for (unsigned int ii = 0; ii < nrings; ++ii) {
+      Ring & ring = *table->rings[ii];
+      unsigned long tail = ring.tail.load (std::memory_order_relaxed);
+      unsigned long head = ring.head.load (std::memory_order_acquire);
+
+      for (; tail != head; ++tail) {
+         const AsyncMessageSinkSlot & slot = ring.slots[tail & ring.mask];
+
+         if (rate_limit > 0) {
+            RingTable::CodeCount & count = table->code_counts[slot.code];
+            if (count.delivered >= rate_limit) {
+               ++count.discarded;
+               continue;
+            }
+            ++count.delivered;
+         }
+
+         deliver (context, slot.text);
+      }
+      ring.tail.store (tail, std::memory_order_release);
+
+      unsigned long lost = ring.overflowed.exchange (0);
+      if (lost > 0) {
+         table->total_overflowed.fetch_add (lost, std::memory_order_relaxed);
+         char notice[128];
+         std::snprintf (notice, sizeof(notice),
+                        "\n%lu messages were lost to a full message ring.\n",
+                        lost);
+         deliver (context, notice);
+      }
+   }
+}
+
+
+/**
+ * Report the messages discarded by the rate limit in the window that just
+ * ended, and start a new window.
+ */
+void
+AsyncMessageSink::end_rate_window (
+   void)
+{
+   double now = wall_time ();
+
+   for (std::map<std::string, RingTable::CodeCount>::const_iterator it =
+           table->code_counts.begin();
+        it != table->code_counts.end();
+        ++it) {
+      if (it->second.discarded > 0) {
+         char notice[256];
+         std::snprintf (notice, sizeof(notice),
+                        "\n%u further messages with code %s were discarded "
+                        "in the last %.3g s.\n",
+                        it->second.discarded, it->first.c_str(),
+                        now - table->window_start);
+         deliver (context, notice);
+      }
+   }
+
+   table->code_counts.clear ();
+   table->window_start = now;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -45,14 +45,15 @@ Library dependencies:
 namespace jeod {
 
 /*
- Define message severity levels. See the header for documentation.
+ Define message severity levels. The values are set in the header, where
+ they are compile-time constants. See the header for documentation.
 */
 
-const int MessageHandler::Failure =  -1;
-const int MessageHandler::Error   =   0;
-const int MessageHandler::Warning =   9;
-const int MessageHandler::Notice  =  99;
-const int MessageHandler::Debug   = 999;
+const int MessageHandler::Failure;
+const int MessageHandler::Error;
+const int MessageHandler::Warning;
+const int MessageHandler::Notice;
+const int MessageHandler::Debug;
 
 
 
@@ -168,6 +169,11 @@ MessageHandler::warn (
    const char * format,
    ...)
 {
+   // Suppressed message: Nothing to do.
+   if (! will_report (MessageHandler::Warning, msg_code)) {
+      return;
+   }
+
    // No handler: Exit.
    if (handler == nullptr) {
       no_handler_error ();
@@ -202,6 +208,11 @@ MessageHandler::inform (
    const char * format,
    ...)
 {
+   // Suppressed message: Nothing to do.
+   if (! will_report (MessageHandler::Notice, msg_code)) {
+      return;
+   }
+
    // No handler: Exit.
    if (handler == nullptr) {
       no_handler_error ();
@@ -237,6 +248,11 @@ MessageHandler::debug (
    const char * format,
    ...)
 {
+   // Suppressed message: Nothing to do.
+   if (! will_report (MessageHandler::Debug, msg_code)) {
+      return;
+   }
+
    // No handler: Exit.
    if (handler == nullptr) {
       no_handler_error ();
@@ -276,6 +292,11 @@ MessageHandler::send_message (
    const char * format,
    ...)
 {
+   // Suppressed message: Nothing to do.
+   if (! will_report (severity, msg_code)) {
+      return;
+   }
+
    // No handler: Exit.
    if (handler == nullptr) {
       no_handler_error ();
@@ -571,7 +592,9 @@ MessageHandler::MessageHandler (
 :
    suppression_level(MessageHandler::Warning),
    suppress_id(false),
-   suppress_location(false)
+   suppress_location(false),
+   codes_suppressed(false),
+   dispatch_suppressed(false)
 {
 
    // No message handler yet: This is the handler.
@@ -43,6 +43,7 @@ namespace jeod {
 // Define MessageMessages static member data
 
 MAKE_MESSAGE_MESSAGE_CODE (singleton_error);
+MAKE_MESSAGE_MESSAGE_CODE (thread_error);
 
 #undef MAKE_MESSAGE_MESSAGE_CODE
 
@@ -41,6 +41,54 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+/**
+ * Construct a SuppressedCodeRestart object.
+ * \param[in] in The handler whose flag is to be recomputed
+ */
+SuppressedCodeRestart::SuppressedCodeRestart (
+   SuppressedCodeMessageHandler & in)
+:
+   SimpleCheckpointable(),
+   message_handler(in)
+{
+   ; // Empty
+}
+
+
+/**
+ * Destroy a SuppressedCodeRestart object.
+ */
+SuppressedCodeRestart::~SuppressedCodeRestart (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Nothing to do here; the suppressed codes may not be restored yet.
+ */
+void
+SuppressedCodeRestart::simple_restore (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Recompute codes_suppressed now that every container, including the set of
+ * suppressed codes, has been restored.
+ */
+void
+SuppressedCodeRestart::post_restart (
+   void)
+{
+   message_handler.codes_suppressed =
+      ! message_handler.suppressed_codes.empty();
+}
+
+
 /**
  * Register the MessageHandler's checkpointable contents.
  */
@@ -50,6 +98,7 @@ SuppressedCodeMessageHandler::register_contents (
 {
    JEOD_REGISTER_CLASS (SuppressedCodeMessageHandler);
    JEOD_REGISTER_CHECKPOINTABLE (this, suppressed_codes);
+   JEOD_REGISTER_CHECKPOINTABLE (this, restart);
 }
 
 
@@ -60,6 +109,7 @@ void
 SuppressedCodeMessageHandler::deregister_contents (
    void)
 {
+   JEOD_DEREGISTER_CHECKPOINTABLE (this, restart);
    JEOD_DEREGISTER_CHECKPOINTABLE (this, suppressed_codes);
 }
 
@@ -0,0 +1,317 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup NamedItem
+ * @{
+ *
+ * @file models/utils/named_item/include/name_table.hh
+ * Define the classes NameHandle, NameTable, and NameIndex, which intern
+ * names as small integer handles for allocation-free lookups.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Interned names are never removed from the table.))
+
+Library dependencies:
+  ((../src/name_table.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_NAME_TABLE_HH
+#define JEOD_NAME_TABLE_HH
+
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// System includes
+#include <string>               // std::string
+#include <vector>               // std::vector
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A handle to a name interned in the NameTable. Two handles are equal if
+ * and only if they refer to the same name. A default-constructed handle
+ * refers to no name.
+ */
+class NameHandle {
+
+   JEOD_MAKE_SIM_INTERFACES(NameHandle)
+
+public:
+
+   /**
+    * The identifier of the invalid handle.
+    */
+   static const unsigned int invalid_id = ~0U;
+
+   /**
+    * Default constructor; the handle refers to no name.
+    */
+   NameHandle ()
+   :
+      id (invalid_id)
+   {}
+
+   /**
+    * Construct a handle from an identifier issued by the NameTable.
+    * \param[in] id_in Identifier
+    */
+   explicit NameHandle (unsigned int id_in)
+   :
+      id (id_in)
+   {}
+
+   /**
+    * Get the handle's identifier, a dense index into the NameTable.
+    * @return Identifier
+    */
+   unsigned int get_id () const
+   {
+      return id;
+   }
+
+   /**
+    * Does the handle refer to a name?
+    * @return True if the handle is valid
+    */
+   bool is_valid () const
+   {
+      return id != invalid_id;
+   }
+
+   /**
+    * Do two handles refer to the same name?
+    * @return True if equal
+    * \param[in] other Other handle
+    */
+   bool operator== (const NameHandle & other) const
+   {
+      return id == other.id;
+   }
+
+   /**
+    * Do two handles refer to different names?
+    * @return True if not equal
+    * \param[in] other Other handle
+    */
+   bool operator!= (const NameHandle & other) const
+   {
+      return id != other.id;
+   }
+
+private:
+
+   /**
+    * Identifier.
+    */
+   unsigned int id; //!< trick_io(**)
+};
+
+
+/**
+ * The global table of interned names. Interning a name returns the same
+ * handle every time the name is interned; handles are issued densely,
+ * starting at zero. The table is guarded by a mutex.
+ */
+class NameTable {
+
+   JEOD_MAKE_SIM_INTERFACES(NameTable)
+
+public:
+
+   // Intern a name, adding it to the table if needed.
+   static NameHandle intern (const char * name);
+   static NameHandle intern (const std::string & name);
+
+   // Find the handle of a name without adding it to the table.
+   static NameHandle find (const char * name);
+   static NameHandle find (const std::string & name);
+
+   // Get the name to which a handle refers.
+   static const char * get_name (NameHandle handle);
+
+   // Get the number of interned names.
+   static unsigned int size ();
+
+private:
+
+   // This is a static class.
+   NameTable ();
+   NameTable (const NameTable &);
+   NameTable & operator= (const NameTable &);
+};
+
+
+/**
+ * Maps name handles to positions in a container of named items.
+ * A NameIndex is a vector indexed by handle identifier, so lookups
+ * involve neither hashing nor string comparisons.
+ */
+class NameIndex {
+
+   JEOD_MAKE_SIM_INTERFACES(NameIndex)
+
+public:
+
+   /**
+    * The position returned for names that are not in the index.
+    */
+   static const unsigned int npos = ~0U;
+
+   /**
+    * Default constructor.
+    */
+   NameIndex ()
+   :
+      positions (),
+      count (0)
+   {}
+
+   /**
+    * Empty the index.
+    */
+   void clear ()
+   {
+      positions.clear ();
+      count = 0;
+   }
+
+   /**
+    * Get the number of names in the index.
+    * @return Number of names
+    */
+   unsigned int size () const
+   {
+      return count;
+   }
+
+   /**
+    * Add a name to the index. The first position added for a name is kept.
+    * \param[in] handle Handle of the name
+    * \param[in] position Position of the named item
+    */
+   void add (NameHandle handle, unsigned int position)
+   {
+      if (! handle.is_valid()) {
+         return;
+      }
+      unsigned int id = handle.get_id();
+      if (id >= positions.size()) {
+         positions.resize (id + 1, npos);
+      }
+      if (positions[id] == npos) {
+         positions[id] = position;
+         ++count;
+      }
+   }
+
+   /**
+    * Change the position of a name already in the index, e.g., when the
+    * named item is moved within its container.
+    * \param[in] handle Handle of the name
+    * \param[in] position New position of the named item
+    */
+   void set (NameHandle handle, unsigned int position)
+   {
+      unsigned int id = handle.get_id();
+      if ((id < positions.size()) && (positions[id] != npos)) {
+         positions[id] = position;
+      }
+   }
+
+   /**
+    * Remove a name from the index.
+    * \param[in] handle Handle of the name
+    */
+   void remove (NameHandle handle)
+   {
+      unsigned int id = handle.get_id();
+      if ((id < positions.size()) && (positions[id] != npos)) {
+         positions[id] = npos;
+         --count;
+      }
+   }
+
+   /**
+    * Find the position of a name.
+    * @return Position of the named item, or npos if not found
+    * \param[in] handle Handle of the name
+    */
+   unsigned int find (NameHandle handle) const
+   {
+      unsigned int id = handle.get_id();
+      return (id < positions.size()) ? positions[id] : npos;
+   }
+
+private:
+
+   /**
+    * Positions, indexed by handle identifier.
+    */
+   std::vector<unsigned int> positions; //!< trick_io(**)
+
+   /**
+    * Number of names in the index.
+    */
+   unsigned int count; //!< trick_io(**)
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,192 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup NamedItem
+ * @{
+ *
+ * @file models/utils/named_item/src/name_table.cc
+ * Define the static member functions of the class NameTable.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library Dependency:
+  ((name_table.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Model includes
+#include "../include/name_table.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * The interned names and the map from name to handle identifier.
+ */
+struct NameTableContents {
+
+   /**
+    * Guards the table.
+    */
+   std::mutex mutex;
+
+   /**
+    * Interned names, indexed by handle identifier. A deque keeps the
+    * names in place as the table grows.
+    */
+   std::deque<std::string> names;
+
+   /**
+    * Map from name to handle identifier.
+    */
+   std::unordered_map<std::string, unsigned int> ids;
+};
+
+
+/**
+ * Get the table contents, constructing them on first use.
+ * @return Table contents
+ */
+NameTableContents &
+get_contents ()
+{
+   static NameTableContents contents;
+   return contents;
+}
+
+}
+
+
+const unsigned int NameHandle::invalid_id;
+const unsigned int NameIndex::npos;
+
+
+/**
+ * Intern a name, adding it to the table if it is not already there.
+ * @return Handle of the name; the invalid handle for a null name
+ * \param[in] name Name
+ */
+NameHandle
+NameTable::intern (
+   const char * name)
+{
+   if (name == nullptr) {
+      return NameHandle ();
+   }
+   return intern (std::string (name));
+}
+
+
+/**
+ * Intern a name, adding it to the table if it is not already there.
+ * @return Handle of the name
+ * \param[in] name Name
+ */
+NameHandle
+NameTable::intern (
+   const std::string & name)
+{
+   NameTableContents & contents = get_contents ();
+   std::lock_guard<std::mutex> lock (contents.mutex);
+
+   auto found = contents.ids.find (name);
+   if (found != contents.ids.end()) {
+      return NameHandle (found->second);
+   }
+
+   unsigned int id = contents.names.size();
+   contents.names.push_back (name);
+   contents.ids.emplace (name, id);
+   return NameHandle (id);
+}
+
+
+/**
+ * Find the handle of a name without adding the name to the table.
+ * @return Handle of the name, or the invalid handle if not interned
+ * \param[in] name Name
+ */
+NameHandle
+NameTable::find (
+   const char * name)
+{
+   if (name == nullptr) {
+      return NameHandle ();
+   }
+   return find (std::string (name));
+}
+
+
+/**
+ * Find the handle of a name without adding the name to the table.
+ * @return Handle of the name, or the invalid handle if not interned
+ * \param[in] name Name
+ */
+NameHandle
+NameTable::find (
+   const std::string & name)
+{
+   NameTableContents & contents = get_contents ();
+   std::lock_guard<std::mutex> lock (contents.mutex);
+
+   auto found = contents.ids.find (name);
+   return (found != contents.ids.end()) ?
+          NameHandle (found->second) : NameHandle ();
+}
+
+
+/**
+ * Get the name to which a handle refers.
+ * @return Name, or null for an invalid handle
+ * \param[in] handle Handle
+ */
+const char *
+NameTable::get_name (
+   NameHandle handle)
+{
+   NameTableContents & contents = get_contents ();
+   std::lock_guard<std::mutex> lock (contents.mutex);
+
+   return (handle.get_id() < contents.names.size()) ?
+          contents.names[handle.get_id()].c_str() : nullptr;
+}
+
+
+/**
+ * Get the number of interned names.
+ * @return Number of names
+ */
+unsigned int
+NameTable::size ()
+{
+   NameTableContents & contents = get_contents ();
+   std::lock_guard<std::mutex> lock (contents.mutex);
+
+   return contents.names.size();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
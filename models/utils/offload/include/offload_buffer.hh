@@ -0,0 +1,161 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Offload
+ * @{
+ *
+ * @file models/utils/offload/include/offload_buffer.hh
+ * Define the class OffloadBuffer, a page-locked host array that stages the
+ * inputs and outputs of offloaded kernels.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The buffer is page-locked only when JEOD is built with JEOD_OFFLOAD and
+    the OpenMP runtime supports pinned allocations; otherwise it is ordinary
+    host memory.))
+
+Library dependencies:
+  ((../src/offload_buffer.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_OFFLOAD_BUFFER_HH
+#define JEOD_OFFLOAD_BUFFER_HH
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Holds an array of doubles in page-locked (pinned) host memory. Copies
+ * between pinned memory and a device run at full bus bandwidth and without
+ * the intermediate copy the runtime makes for pageable memory, so offloaded
+ * kernels stage their per-call inputs and outputs in these buffers.
+ */
+class OffloadBuffer {
+JEOD_MAKE_SIM_INTERFACES(OffloadBuffer)
+
+public:
+
+   OffloadBuffer ();
+
+   ~OffloadBuffer ();
+
+   // Ensure capacity for num_doubles doubles.
+   void reserve (std::size_t num_doubles);
+
+   // Free the array.
+   void release ();
+
+   /**
+    * Get the array.
+    * @return Array of get_capacity() doubles, or null if none is reserved
+    */
+   double * data ()
+   {
+      return storage;
+   }
+
+   /**
+    * Get the array.
+    * @return Array of get_capacity() doubles, or null if none is reserved
+    */
+   const double * data () const
+   {
+      return storage;
+   }
+
+   /**
+    * Get the reserved capacity, in doubles.
+    * @return Capacity
+    */
+   std::size_t get_capacity () const
+   {
+      return capacity;
+   }
+
+
+private:
+
+   /**
+    * The array.
+    */
+   double * storage; //!< trick_io(**)
+
+   /**
+    * Number of doubles in storage.
+    */
+   std::size_t capacity; //!< trick_io(**)
+
+   /**
+    * Was storage obtained from the pinned allocator?
+    */
+   bool pinned; //!< trick_io(**)
+
+   // Not implemented.
+   OffloadBuffer (const OffloadBuffer &);
+   OffloadBuffer & operator= (const OffloadBuffer &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
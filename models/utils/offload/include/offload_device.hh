@@ -0,0 +1,160 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Offload
+ * @{
+ *
+ * @file models/utils/offload/include/offload_device.hh
+ * Define the class OffloadDevice, which selects the accelerator that batched
+ * kernels are offloaded to and manages that device's memory.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Offloading uses OpenMP target directives and is compiled only when JEOD
+    is built with JEOD_OFFLOAD, in which case JEOD_OFFLOAD is defined and
+    the compiler runs with OpenMP enabled.)
+   (Without offload support, the device is the host and device memory is
+    ordinary host memory, so offloaded kernels still run, serially.))
+
+Library dependencies:
+  ((../src/offload_device.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_OFFLOAD_DEVICE_HH
+#define JEOD_OFFLOAD_DEVICE_HH
+
+// System includes
+#include <cstddef>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+/**
+ * Emit an OpenMP directive in an offloaded kernel when offload support is
+ * compiled, and nothing otherwise.
+ */
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+#define JEOD_OFFLOAD_PRAGMA(directive) _Pragma(#directive)
+#else
+#define JEOD_OFFLOAD_PRAGMA(directive)
+#endif
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Identifies the device that an offloaded kernel runs on and moves data
+ * to and from it. Kernels obtain their device arrays from allocate(), fill
+ * them with copy_to_device(), pass get_device_number() to the device clause
+ * of their target directives, and read results back with
+ * copy_from_device().
+ */
+class OffloadDevice {
+JEOD_MAKE_SIM_INTERFACES(OffloadDevice)
+
+public:
+
+   /**
+    * OpenMP device number to offload to; a negative value selects the
+    * default device.
+    */
+   int device_number; //!< trick_units(--)
+
+
+   OffloadDevice ();
+
+   ~OffloadDevice ();
+
+   // Was JEOD built with offload support?
+   static bool is_compiled ();
+
+   // Get the number of accelerators visible to the process.
+   static int get_num_devices ();
+
+   // Is the selected accelerator present?
+   bool is_available () const;
+
+   // Get the device number of the selected device, or the host's when
+   // no accelerator is present.
+   int get_device_number () const;
+
+   // Allocate device memory.
+   void * allocate (std::size_t bytes) const;
+
+   // Free device memory obtained from allocate().
+   void release (void * device_ptr) const;
+
+   // Copy host memory to device memory.
+   void copy_to_device (
+      void * device_ptr, const void * host_ptr, std::size_t bytes) const;
+
+   // Copy device memory to host memory.
+   void copy_from_device (
+      void * host_ptr, const void * device_ptr, std::size_t bytes) const;
+
+
+private:
+
+   // Not implemented.
+   OffloadDevice (const OffloadDevice &);
+   OffloadDevice & operator= (const OffloadDevice &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
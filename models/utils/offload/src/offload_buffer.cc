@@ -0,0 +1,165 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Offload
+ * @{
+ *
+ * @file models/utils/offload/src/offload_buffer.cc
+ * Implement the class OffloadBuffer.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((offload_buffer.cc)
+   (offload_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <cstdlib>
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+#include <omp.h>
+#endif
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/offload_buffer.hh"
+#include "../include/offload_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+namespace {
+
+/**
+ * Get the process-wide pinned-memory allocator, created on first use. It
+ * falls back to pageable memory when the runtime cannot lock the pages.
+ * @return Allocator handle; omp_null_allocator if it cannot be created
+ */
+omp_allocator_handle_t
+pinned_allocator ()
+{
+   static const omp_allocator_handle_t allocator = [] () {
+      omp_alloctrait_t traits[1] = {{omp_atk_pinned, omp_atv_true}};
+      return omp_init_allocator (omp_default_mem_space, 1, traits);
+   } ();
+   return allocator;
+}
+
+}
+#endif
+
+
+/**
+ * Default constructor; the buffer has no capacity until reserved.
+ */
+OffloadBuffer::OffloadBuffer ()
+:
+   storage(nullptr),
+   capacity(0),
+   pinned(false)
+{ }
+
+
+/**
+ * Destructor.
+ */
+OffloadBuffer::~OffloadBuffer ()
+{
+   release ();
+}
+
+
+/**
+ * Ensure the buffer holds at least num_doubles doubles. The capacity only
+ * grows; growing discards the contents.
+ * \param[in] num_doubles Required capacity, in doubles
+ */
+void
+OffloadBuffer::reserve (
+   std::size_t num_doubles)
+{
+   if (num_doubles <= capacity) {
+      return;
+   }
+
+   release ();
+
+   std::size_t bytes = num_doubles * sizeof(double);
+   void * array = nullptr;
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   omp_allocator_handle_t allocator = pinned_allocator ();
+   if (allocator != omp_null_allocator) {
+      array = omp_alloc (bytes, allocator);
+      pinned = (array != nullptr);
+   }
+#endif
+
+   if (array == nullptr) {
+      array = std::malloc (bytes);
+   }
+
+   if (array == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, OffloadMessages::allocation_error,
+         "Cannot allocate a %lu byte offload staging buffer.",
+         static_cast<unsigned long> (bytes));
+
+      // Not reached
+      return;
+   }
+
+   storage = static_cast<double *> (array);
+   capacity = num_doubles;
+}
+
+
+/**
+ * Free the array.
+ */
+void
+OffloadBuffer::release ()
+{
+   if (storage == nullptr) {
+      return;
+   }
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   if (pinned) {
+      omp_free (storage, omp_null_allocator);
+   }
+   else {
+      std::free (storage);
+   }
+#else
+   std::free (storage);
+#endif
+
+   storage = nullptr;
+   capacity = 0;
+   pinned = false;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
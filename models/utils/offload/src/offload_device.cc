@@ -0,0 +1,235 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Offload
+ * @{
+ *
+ * @file models/utils/offload/src/offload_device.cc
+ * Implement the class OffloadDevice.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((offload_device.cc)
+   (offload_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+#include <omp.h>
+#endif
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/offload_device.hh"
+#include "../include/offload_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default constructor; selects the default device.
+ */
+OffloadDevice::OffloadDevice ()
+:
+   device_number(-1)
+{ }
+
+
+/**
+ * Destructor.
+ */
+OffloadDevice::~OffloadDevice ()
+{ }
+
+
+/**
+ * Was JEOD built with offload support?
+ * @return True if offloaded kernels can run on an accelerator
+ */
+bool
+OffloadDevice::is_compiled ()
+{
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   return true;
+#else
+   return false;
+#endif
+}
+
+
+/**
+ * Get the number of accelerators visible to the process.
+ * @return Number of devices; zero without offload support
+ */
+int
+OffloadDevice::get_num_devices ()
+{
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   return omp_get_num_devices ();
+#else
+   return 0;
+#endif
+}
+
+
+/**
+ * Is the selected accelerator present?
+ * @return True if kernels will run on an accelerator rather than the host
+ */
+bool
+OffloadDevice::is_available () const
+{
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   return get_device_number () != omp_get_initial_device ();
+#else
+   return false;
+#endif
+}
+
+
+/**
+ * Get the number to pass to the device clause of target directives: the
+ * selected device if it is present, and the host otherwise.
+ * @return OpenMP device number
+ */
+int
+OffloadDevice::get_device_number () const
+{
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   int device = (device_number < 0) ? omp_get_default_device () :
+                                      device_number;
+   if (device >= omp_get_num_devices ()) {
+      device = omp_get_initial_device ();
+   }
+   return device;
+#else
+   return 0;
+#endif
+}
+
+
+/**
+ * Allocate memory on the device.
+ * @return Device pointer; usable only in kernels and device copies
+ * \param[in] bytes Size of the allocation
+ */
+void *
+OffloadDevice::allocate (
+   std::size_t bytes) const
+{
+   void * device_ptr;
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   device_ptr = omp_target_alloc (bytes, get_device_number ());
+#else
+   device_ptr = std::malloc (bytes);
+#endif
+
+   if ((device_ptr == nullptr) && (bytes > 0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, OffloadMessages::allocation_error,
+         "Cannot allocate %lu bytes on offload device %d.",
+         static_cast<unsigned long> (bytes), get_device_number ());
+
+      // Not reached
+      return nullptr;
+   }
+
+   return device_ptr;
+}
+
+
+/**
+ * Free memory obtained from allocate().
+ * \param[in] device_ptr Device pointer; null is ignored
+ */
+void
+OffloadDevice::release (
+   void * device_ptr) const
+{
+   if (device_ptr == nullptr) {
+      return;
+   }
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   omp_target_free (device_ptr, get_device_number ());
+#else
+   std::free (device_ptr);
+#endif
+}
+
+
+/**
+ * Copy host memory to device memory.
+ * \param[in] device_ptr Destination, from allocate()
+ * \param[in] host_ptr Source
+ * \param[in] bytes Number of bytes
+ */
+void
+OffloadDevice::copy_to_device (
+   void * device_ptr,
+   const void * host_ptr,
+   std::size_t bytes) const
+{
+   if (bytes == 0) {
+      return;
+   }
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   omp_target_memcpy (device_ptr, const_cast<void *> (host_ptr), bytes, 0, 0,
+                      get_device_number (), omp_get_initial_device ());
+#else
+   std::memcpy (device_ptr, host_ptr, bytes);
+#endif
+}
+
+
+/**
+ * Copy device memory to host memory.
+ * \param[in] host_ptr Destination
+ * \param[in] device_ptr Source, from allocate()
+ * \param[in] bytes Number of bytes
+ */
+void
+OffloadDevice::copy_from_device (
+   void * host_ptr,
+   const void * device_ptr,
+   std::size_t bytes) const
+{
+   if (bytes == 0) {
+      return;
+   }
+
+#if (defined(JEOD_OFFLOAD) && defined(_OPENMP))
+   omp_target_memcpy (host_ptr, const_cast<void *> (device_ptr), bytes, 0, 0,
+                      omp_get_initial_device (), get_device_number ());
+#else
+   std::memcpy (host_ptr, device_ptr, bytes);
+#endif
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,53 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Offload
+ * @{
+ *
+ * @file models/utils/offload/src/offload_messages.cc
+ * Implement the class OffloadMessages.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((offload_messages.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "../include/offload_messages.hh"
+
+#define PATH "utils/offload/"
+#define CLASS OffloadMessages
+#define MAKE_MESSAGE_CODE(id) char const * CLASS::id = PATH #id
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Static member data
+
+MAKE_MESSAGE_CODE(allocation_error);
+
+} // End JEOD namespace
+
+#undef MAKE_MESSAGE_CODE
+#undef CLASS
+#undef PATH
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -194,12 +194,33 @@ class OrbitalElements {
    int nu_to_anomalies();
    int mean_anom_to_nu();
 
+   // Batched transformation routines
+   static void from_cartesian_batch (
+      double mu,
+      unsigned int num_states,
+      const double pos[][3],
+      const double vel[][3],
+      OrbitalElements * const elements[]);
+   static unsigned int to_cartesian_batch (
+      double mu,
+      unsigned int num_states,
+      OrbitalElements * const elements[],
+      bool from_mean_anom,
+      double pos[][3],
+      double vel[][3]);
+
   protected:
 
    int KepEqtnE (double M, double e, double * E);
 
+   int KepEqtnE (
+      double M, double e, double * E, double * sin_E, double * cos_E);
+
    int KepEqtnH (double M, double e, double * H);
 
+   int KepEqtnH (
+      double M, double e, double * H, double * sinh_H, double * cosh_H);
+
    int KepEqtnB (double M, double * B);
 
 };
@@ -531,12 +531,14 @@ int OrbitalElements::to_cartesian(
    }
 
    // Compute position and velocity in perifocal frame (PQW)
-   r_pqw[0] = (p * cos_v) / (1.0 + e*cos_v);
-   r_pqw[1] = (p * sin_v) / (1.0 + e*cos_v);
+   double r_scale = p / (1.0 + e*cos_v);
+   r_pqw[0] = r_scale * cos_v;
+   r_pqw[1] = r_scale * sin_v;
    r_pqw[2] = 0.0;
 
-   v_pqw[0] = -sqrt(mu/p) * sin_v;
-   v_pqw[1] =  sqrt(mu/p) * (e+cos_v);
+   double v_scale = sqrt(mu/p);
+   v_pqw[0] = -v_scale * sin_v;
+   v_pqw[1] =  v_scale * (e+cos_v);
    v_pqw[2] =  0.0;
 
    // Compute transformation matrix from PQW to inertial
@@ -558,6 +560,64 @@ int OrbitalElements::to_cartesian(
 }
 
 
+/**
+ * Compute the orbital elements for a batch of inertial cartesian states
+ * about a common central body.
+ * \param[in] mu Gravitational parameter of the central body\n Units: M3/s2
+ * \param[in] num_states Number of states
+ * \param[in] pos Positions\n Units: M
+ * \param[in] vel Velocities\n Units: M/s
+ * \param[in,out] elements Element sets to receive the results
+ */
+void
+OrbitalElements::from_cartesian_batch (
+   double mu,
+   unsigned int num_states,
+   const double pos[][3],
+   const double vel[][3],
+   OrbitalElements * const elements[])
+{
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      elements[ii]->from_cartesian (mu, pos[ii], vel[ii]);
+   }
+}
+
+
+/**
+ * Compute the inertial cartesian states for a batch of element sets about
+ * a common central body.
+ * @return Number of element sets that could not be converted
+ * \param[in] mu Gravitational parameter of the central body\n Units: M3/s2
+ * \param[in] num_states Number of element sets
+ * \param[in,out] elements Element sets to be converted
+ * \param[in] from_mean_anom Update the true anomaly from the mean anomaly
+ *            (mean_anom_to_nu) before converting?
+ * \param[out] pos Positions\n Units: M
+ * \param[out] vel Velocities\n Units: M/s
+ */
+unsigned int
+OrbitalElements::to_cartesian_batch (
+   double mu,
+   unsigned int num_states,
+   OrbitalElements * const elements[],
+   bool from_mean_anom,
+   double pos[][3],
+   double vel[][3])
+{
+   unsigned int num_failed = 0;
+
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      OrbitalElements & elem = *elements[ii];
+      if ((from_mean_anom && (elem.mean_anom_to_nu() != 0)) ||
+          (elem.to_cartesian (mu, pos[ii], vel[ii]) != 0)) {
+         ++num_failed;
+      }
+   }
+
+   return num_failed;
+}
+
+
 /******************************************************************************
 PURPOSE:
     (Calculation of the Mean Anomaly and the Eccentric, Hyperbolic, or
@@ -615,7 +675,7 @@ int OrbitalElements::nu_to_anomalies()
          orbital_anom += 2.0*M_PI;
       }
 
-      mean_anom = orbital_anom - e*sin(orbital_anom);
+      mean_anom = orbital_anom - e*sin_E;
    }
 
    // Hyperbolic orbit
@@ -623,7 +683,7 @@ int OrbitalElements::nu_to_anomalies()
 
       sinh_H = sqrt(e*e - 1.0) * sin_v / (1.0 + e*cos_v);
       orbital_anom  = asinh(sinh_H);
-      mean_anom = e*sinh(orbital_anom) - orbital_anom;
+      mean_anom = e*sinh_H - orbital_anom;
    }
 
    // Parabolic orbit
@@ -687,7 +747,7 @@ int OrbitalElements::mean_anom_to_nu()
    else if (e < (1.0 - switch_tol)) {
 
       // Use Kepler's Equation to compute the eccentric anomaly
-      Converge = KepEqtnE(M, e, &(orbital_anom));
+      Converge = KepEqtnE(M, e, &(orbital_anom), &sin_E, &cos_E);
 
       // Check iteration convergence
       if (Converge == -1) {
@@ -699,8 +759,6 @@ int OrbitalElements::mean_anom_to_nu()
       }
 
       // Compute the true anomaly
-      sin_E = sin(orbital_anom);
-      cos_E = cos(orbital_anom);
       sin_v = sqrt(1.0 - e*e)*sin_E / (1.0 - e*cos_E);
       cos_v = (cos_E - e) / (1.0 - e*cos_E);
       true_anom = atan2(sin_v, cos_v);
@@ -714,7 +772,7 @@ int OrbitalElements::mean_anom_to_nu()
    else if (e > (1.0 + switch_tol)) {
 
       // Use Kepler's Equation to compute the hyperbolic anomaly
-      Converge = KepEqtnH(M, e, &(orbital_anom));
+      Converge = KepEqtnH(M, e, &(orbital_anom), &sinh_H, &cosh_H);
 
       // Check iteration convergence
       if (Converge == -1) {
@@ -726,8 +784,6 @@ int OrbitalElements::mean_anom_to_nu()
       }
 
       // Compute the true anomaly
-      sinh_H = sinh(orbital_anom);
-      cosh_H = cosh(orbital_anom);
       sin_v = -sqrt(e*e - 1.0)*sinh_H / (1.0 - e*cosh_H);
       cos_v = (cosh_H - e) / (1.0 - e*cosh_H);
       true_anom = atan2(sin_v, cos_v);
@@ -766,10 +822,16 @@ PURPOSE:
 
 REFERENCE:
     (((Vallado, David A.) (Fundamentals of Astrodynamics and Applications)
-      (McGraw-Hill) (New York) (1997)))
+      (McGraw-Hill) (New York) (1997))
+     ((Danby, J.M.A.) (Fundamentals of Celestial Mechanics, 2nd Ed.)
+      (Willmann-Bell) (1988) (pages 149-154))
+     ((Mikkola, S.) (A cubic approximation for Kepler's equation)
+      (Celestial Mechanics 40) (1987) (pages 329-334)))
 
 ASSUMPTIONS AND LIMITATIONS:
     ((Only call this routine for elliptical orbits: e < 1.0)
+     (The starter followed by Halley iterations converges to machine
+      precision in at most three iterations for e < 0.99)
      (If a "-1" is returned, the solution did not converge; otherwise, the
       number of iterations required is returned))
 
@@ -783,33 +845,87 @@ int OrbitalElements::KepEqtnE(
    double   e,
    double * E)
 {
+   double sin_E;
+   double cos_E;
+
+   return KepEqtnE (M, e, E, &sin_E, &cos_E);
+}
+
+
+/**
+ * Solve Kepler's equation for an elliptical orbit, also returning the sine
+ * and cosine of the eccentric anomaly so callers need not recompute them.
+ * @return Number of iterations, or -1 if the solution did not converge
+ * \param[in] M Mean anomaly\n Units: r
+ * \param[in] e Eccentricity, less than one
+ * \param[out] E Eccentric anomaly\n Units: r
+ * \param[out] sin_E Sine of the eccentric anomaly
+ * \param[out] cos_E Cosine of the eccentric anomaly
+ */
+int OrbitalElements::KepEqtnE(
+   double   M,
+   double   e,
+   double * E,
+   double * sin_E,
+   double * cos_E)
+{
 
    // Declare local variables
    int     i;                       // Loop counter
-   double  tolerance = 1.0e-8;      // Iteration tolerance for eccentric anomaly
-   double  pi = 3.141592653589793;  /* Value of pi use for computing initial
-                                       guess for eccentric anomaly */
-
-   // Compute initial guess for E
-   if ( ((-pi < M) && (M < 0.0)) || (M > pi) ) {
-      *E = M - e;
+   double  tolerance = 1.0e-6;      /* Final correction size below which the
+                                       cubically convergent iteration has
+                                       reached machine precision */
+
+   // Solve for the mean anomaly reduced to [-pi, pi]; the revolution count
+   // is restored on return.
+   double M_red = (fabs(M) <= M_PI) ? M : remainder (M, 2.0*M_PI);
+   double E_red;
+
+   // Compute the starter for E.
+   // Danby's simple starter suffices for modest eccentricities. The more
+   // expensive Mikkola cubic starter bounds the iteration count for the
+   // remaining cases.
+   if (e < 0.55) {
+      E_red = M_red + ((M_red < 0.0) ? -0.85*e : 0.85*e);
    }
    else {
-      *E = M + e;
+      double denom = 4.0*e + 0.5;
+      double alpha = (1.0 - e) / denom;
+      double beta = M_red / (2.0*denom);
+      double z = cbrt (beta + copysign (sqrt (beta*beta + alpha*alpha*alpha),
+                                        beta));
+      double s = z - alpha/z;
+      double s2 = s*s;
+      s -= 0.078*s2*s2*s / (1.0 + e);
+      E_red = M_red + e*s*(3.0 - 4.0*s*s);
    }
 
-   // Begin looping through iterations
-   for (i = 1; i <= 1000; i++) {
-      double E_prev = *E; // Previous value of the eccentric anomaly
-      *E = E_prev + ((M - E_prev + e*sin(E_prev)) / (1.0 - e*cos(E_prev)));
-
-      // If iteration has converged, return number of iterations
-      if (fabs(*E - E_prev) < tolerance) {
+   // Refine with Halley's method.
+   for (i = 1; i <= 50; i++) {
+      double sin_E_red = sin(E_red);
+      double cos_E_red = cos(E_red);
+      double f = E_red - e*sin_E_red - M_red;
+      double df = 1.0 - e*cos_E_red;
+      double delta = f / (df - 0.5*f*e*sin_E_red/df);
+      E_red -= delta;
+
+      // If iteration has converged, return number of iterations.
+      // The sine and cosine follow from the angle-difference identities,
+      // with series for the (tiny) correction angle.
+      if (fabs(delta) < tolerance) {
+         double cos_delta = 1.0 - 0.5*delta*delta;
+         double sin_delta = delta * (1.0 - delta*delta/6.0);
+         *E = E_red + (M - M_red);
+         *sin_E = sin_E_red*cos_delta - cos_E_red*sin_delta;
+         *cos_E = cos_E_red*cos_delta + sin_E_red*sin_delta;
          return (i);
       }
    }
 
    // If the iteration does not converge, return -1
+   *E = E_red + (M - M_red);
+   *sin_E = sin(E_red);
+   *cos_E = cos(E_red);
    return (-1);
 }
 
@@ -821,10 +937,14 @@ PURPOSE:
 
 REFERENCE:
     (((Vallado, David A.) (Fundamentals of Astrodynamics and Applications)
-      (McGraw-Hill) (New York) (1997)))
+      (McGraw-Hill) (New York) (1997))
+     ((Mikkola, S.) (A cubic approximation for Kepler's equation)
+      (Celestial Mechanics 40) (1987) (pages 329-334)))
 
 ASSUMPTIONS AND LIMITATIONS:
     ((Only call this routine for hyperbolic orbits: e > 1.0)
+     (The Mikkola starter followed by Halley iterations converges to machine
+      precision in at most two iterations for e > 1.01)
      (If a "-1" is returned, the solution did not converge; otherwise, the
       number of iterations required is returned))
 
@@ -839,48 +959,69 @@ int OrbitalElements::KepEqtnH(
    double   e,
    double * H)
 {
+   double sinh_H;
+   double cosh_H;
 
-   // Declare local variables
-   int     i;                      // Loop counter
-   double  tolerance = 1.0e-08;    // Iteration tolerance for hyperbolic anomaly
-   double  pi = 3.141592653589793; /* Value of pi use for computing initial
-                                      guess for hyperbolic anomaly */
-
-   // Compute initial guess for H
-   if (e < 1.6) {
-      if ( ((-pi < M) && (M < 0.0)) || (M > pi) ) {
-         *H = M - e;
-      }
-      else {
-         *H = M + e;
-      }
-   }
-   else {
-      if ((e < 3.6) && (fabs(M) > pi)) {
-         if (M >= 0.0) {
-            *H = M - e;
-         }
-         else {
-            *H = M + e;
-         }
-      }
-      else {
-         *H = M / (e - 1.0);
-      }
-   }
+   return KepEqtnH (M, e, H, &sinh_H, &cosh_H);
+}
 
-   // Begin looping through iterations
-   for (i = 1; i <= 1000; i++) {
-      double H_prev = *H; // Previous value of hyperbolic anomaly
-      *H = H_prev + ( (M + H_prev - e*sinh(H_prev)) / (e*cosh(H_prev) - 1.0));
 
-      // If iteration has converged, return number of iterations
-      if (fabs(*H - H_prev) < tolerance) {
+/**
+ * Solve Kepler's equation for a hyperbolic orbit, also returning the
+ * hyperbolic sine and cosine of the hyperbolic anomaly.
+ * @return Number of iterations, or -1 if the solution did not converge
+ * \param[in] M Mean anomaly\n Units: r
+ * \param[in] e Eccentricity, greater than one
+ * \param[out] H Hyperbolic anomaly\n Units: r
+ * \param[out] sinh_H Hyperbolic sine of the hyperbolic anomaly
+ * \param[out] cosh_H Hyperbolic cosine of the hyperbolic anomaly
+ */
+int OrbitalElements::KepEqtnH(
+   double   M,
+   double   e,
+   double * H,
+   double * sinh_H,
+   double * cosh_H)
+{
+
+   // Declare local variables
+   int     i;                      // Loop counter
+   double  tolerance = 1.0e-6;     /* Relative final correction size below
+                                      which the cubically convergent iteration
+                                      has reached machine precision */
+
+   // Compute the Mikkola cubic starter for H.
+   double denom = 4.0*e + 0.5;
+   double alpha = (e - 1.0) / denom;
+   double beta = M / (2.0*denom);
+   double z = cbrt (beta + copysign (sqrt (beta*beta + alpha*alpha*alpha), beta));
+   double s = (z != 0.0) ? (z - alpha/z) : 0.0;
+   double s2 = s*s;
+   s += 0.071*s2*s2*s / ((1.0 + 0.45*s2) * (1.0 + 4.0*s2) * e);
+   *H = 3.0 * asinh (s);
+
+   // Refine with Halley's method.
+   for (i = 1; i <= 50; i++) {
+      double sinh_H_prev = sinh(*H);
+      double cosh_H_prev = cosh(*H);
+      double f = e*sinh_H_prev - *H - M;
+      double df = e*cosh_H_prev - 1.0;
+      double delta = f / (df - 0.5*f*e*sinh_H_prev/df);
+      *H -= delta;
+
+      // If iteration has converged, return number of iterations.
+      if (fabs(delta) < tolerance * (1.0 + fabs(*H))) {
+         double cosh_delta = 1.0 + 0.5*delta*delta;
+         double sinh_delta = delta * (1.0 + delta*delta/6.0);
+         *sinh_H = sinh_H_prev*cosh_delta - cosh_H_prev*sinh_delta;
+         *cosh_H = cosh_H_prev*cosh_delta - sinh_H_prev*sinh_delta;
          return (i);
       }
    }
 
    // If the iteration does not converge, return -1
+   *sinh_H = sinh(*H);
+   *cosh_H = cosh(*H);
    return (-1);
 }
 
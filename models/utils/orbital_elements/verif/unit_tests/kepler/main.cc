@@ -0,0 +1,258 @@
+/*
+ * Check the Kepler's equation solvers OrbitalElements::KepEqtnE and
+ * OrbitalElements::KepEqtnH.
+ *
+ * Over grids of eccentricity and mean anomaly, from circular through
+ * near-parabolic orbits on both sides of e = 1 and out to mean anomalies of
+ * many revolutions, the solution must
+ *  - satisfy Kepler's equation to rounding level,
+ *  - agree with the Newton iteration the solvers replaced (reproduced
+ *    below), wherever that iteration converged,
+ *  - come with sine and cosine (hyperbolic sine and cosine) values that
+ *    match those of the returned anomaly, and
+ *  - take no more iterations than the solvers' documented bounds.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#include "utils/orbital_elements/include/orbital_elements.hh"
+
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace jeod;
+
+
+/*
+ * Rounding-level tolerance: a few units in the last place.
+ */
+const double tol = 8.0 * std::numeric_limits<double>::epsilon();
+
+unsigned int num_failures = 0;
+TestSimInterface sim_interface;
+
+
+/*
+ * Expose the protected solvers.
+ */
+class KeplerSolver : public OrbitalElements {
+ public:
+   using OrbitalElements::KepEqtnE;
+   using OrbitalElements::KepEqtnH;
+};
+
+
+/*
+ * Report a failed check.
+ */
+void
+check (
+   bool ok,
+   const char * what,
+   double e,
+   double M)
+{
+   if (! ok) {
+      ++num_failures;
+      if (num_failures <= 20) {
+         std::printf ("FAILED: %s at e=%.17g M=%.17g\n", what, e, M);
+      }
+   }
+}
+
+
+/*
+ * The elliptic Newton iteration that KepEqtnE replaced.
+ */
+int
+newton_E (
+   double M,
+   double e,
+   double * E)
+{
+   const double pi = 3.141592653589793;
+   if (((-pi < M) && (M < 0.0)) || (M > pi)) {
+      *E = M - e;
+   }
+   else {
+      *E = M + e;
+   }
+   for (int i = 1; i <= 1000; i++) {
+      double E_prev = *E;
+      *E = E_prev + ((M - E_prev + e*sin(E_prev)) / (1.0 - e*cos(E_prev)));
+      if (fabs(*E - E_prev) < 1.0e-8) {
+         return i;
+      }
+   }
+   return -1;
+}
+
+
+/*
+ * The hyperbolic Newton iteration that KepEqtnH replaced.
+ */
+int
+newton_H (
+   double M,
+   double e,
+   double * H)
+{
+   const double pi = 3.141592653589793;
+   if (e < 1.6) {
+      if (((-pi < M) && (M < 0.0)) || (M > pi)) {
+         *H = M - e;
+      }
+      else {
+         *H = M + e;
+      }
+   }
+   else {
+      if ((e < 3.6) && (fabs(M) > pi)) {
+         *H = (M >= 0.0) ? M - e : M + e;
+      }
+      else {
+         *H = M / (e - 1.0);
+      }
+   }
+   for (int i = 1; i <= 1000; i++) {
+      double H_prev = *H;
+      *H = H_prev + ((M + H_prev - e*sinh(H_prev)) / (e*cosh(H_prev) - 1.0));
+      if (fabs(*H - H_prev) < 1.0e-8) {
+         return i;
+      }
+   }
+   return -1;
+}
+
+
+/*
+ * Check one elliptic solution.
+ */
+void
+check_E (
+   KeplerSolver & solver,
+   double e,
+   double M)
+{
+   double E, sin_E, cos_E;
+   int iters = solver.KepEqtnE (M, e, &E, &sin_E, &cos_E);
+   check (iters > 0, "KepEqtnE converged", e, M);
+   check ((e >= 0.99) || (iters <= 3), "KepEqtnE iteration count", e, M);
+
+   // Kepler's equation holds to rounding of the terms.
+   double scale = std::max (1.0, fabs(M));
+   check (fabs(E - e*sin(E) - M) <= tol * scale,
+          "KepEqtnE residual", e, M);
+
+   // The returned sine and cosine are those of E.
+   check ((fabs(sin_E - sin(E)) <= tol * scale) &&
+          (fabs(cos_E - cos(E)) <= tol * scale),
+          "KepEqtnE sin/cos", e, M);
+
+   // The short form agrees with the long form.
+   double E_short;
+   solver.KepEqtnE (M, e, &E_short);
+   check (E_short == E, "KepEqtnE overloads", e, M);
+
+   // The old iteration gets the same answer, to its tolerance, where it
+   // converged. Its error is magnified near the periapsis of near-parabolic
+   // orbits, where dM/dE = 1 - e cos E is small.
+   double E_old;
+   if (newton_E (M, e, &E_old) > 0) {
+      double slope = std::max (1.0 - e*cos(E), 1e-6);
+      check (fabs(E - E_old) <= 1e-8 / slope + 1e-15 * scale,
+             "KepEqtnE vs Newton", e, M);
+   }
+}
+
+
+/*
+ * Check one hyperbolic solution.
+ */
+void
+check_H (
+   KeplerSolver & solver,
+   double e,
+   double M)
+{
+   double H, sinh_H, cosh_H;
+   int iters = solver.KepEqtnH (M, e, &H, &sinh_H, &cosh_H);
+   check (iters > 0, "KepEqtnH converged", e, M);
+   check ((e <= 1.01) || (iters <= 2), "KepEqtnH iteration count", e, M);
+
+   // Kepler's equation holds to rounding of the terms.
+   double scale = std::max (1.0, std::max (fabs(M), e*fabs(sinh(H))));
+   check (fabs(e*sinh(H) - H - M) <= tol * scale,
+          "KepEqtnH residual", e, M);
+
+   // The returned sinh and cosh are those of H.
+   check ((fabs(sinh_H - sinh(H)) <= tol * std::max (1.0, fabs(sinh(H)))) &&
+          (fabs(cosh_H - cosh(H)) <= tol * cosh(H)),
+          "KepEqtnH sinh/cosh", e, M);
+
+   double H_short;
+   solver.KepEqtnH (M, e, &H_short);
+   check (H_short == H, "KepEqtnH overloads", e, M);
+
+   double H_old;
+   if (newton_H (M, e, &H_old) > 0) {
+      double slope = std::max (e*cosh(H) - 1.0, 1e-6);
+      check (fabs(H - H_old) <= 1e-8 / slope + 1e-15 * std::max (1.0, fabs(H)),
+             "KepEqtnH vs Newton", e, M);
+   }
+}
+
+
+int
+main (
+   void)
+{
+   KeplerSolver solver;
+
+   // Elliptic orbits: circular to near-parabolic, around the 0.55 starter
+   // switch, with mean anomalies within and far beyond one revolution.
+   const double ecc_E[] = {
+      0.0, 1e-8, 0.01, 0.1, 0.3, 0.5, 0.549999, 0.55, 0.7, 0.9, 0.95, 0.98,
+      0.99, 0.995, 0.999, 0.9999, 0.99999, 1.0 - 1e-6};
+   for (unsigned int ie = 0; ie < sizeof(ecc_E)/sizeof(ecc_E[0]); ++ie) {
+      double e = ecc_E[ie];
+      for (int im = -2000; im <= 2000; ++im) {
+         check_E (solver, e, im * (M_PI / 1000.0));
+      }
+      for (int im = -200; im <= 200; ++im) {
+         check_E (solver, e, im * 1e-6);
+      }
+      const double big_M[] = {
+         7.0, 100.0, 1000.5, 12345.678, 1e6 + 0.25, -7.0, -100.0, -1e6 - 0.25};
+      for (unsigned int im = 0; im < sizeof(big_M)/sizeof(big_M[0]); ++im) {
+         check_E (solver, e, big_M[im]);
+      }
+   }
+
+   // Hyperbolic orbits: near-parabolic to very eccentric, with mean
+   // anomalies from zero to very large.
+   const double ecc_H[] = {
+      1.0 + 1e-6, 1.00001, 1.0001, 1.001, 1.005, 1.01, 1.02, 1.1, 1.5, 1.6,
+      2.0, 3.6, 5.0, 10.0, 100.0, 1000.0};
+   for (unsigned int ie = 0; ie < sizeof(ecc_H)/sizeof(ecc_H[0]); ++ie) {
+      double e = ecc_H[ie];
+      for (int im = -2000; im <= 2000; ++im) {
+         check_H (solver, e, im * 0.01);
+      }
+      for (int im = -200; im <= 200; ++im) {
+         check_H (solver, e, im * 1e-6);
+      }
+      const double big_M[] = {50.0, 1e3, 1e5, 1e8, -50.0, -1e3, -1e5, -1e8};
+      for (unsigned int im = 0; im < sizeof(big_M)/sizeof(big_M[0]); ++im) {
+         check_H (solver, e, big_M[im]);
+      }
+   }
+
+   bool passed = (num_failures == 0);
+   std::printf ("Test %s (%u failed checks)\n",
+                (passed ? "passed" : "failed"), num_failures);
+
+   return passed ? 0 : 1;
+}
@@ -155,6 +155,19 @@ class Orientation {
    static void compute_euler_angles_from_matrix (
       const double trans[3][3], EulerSequence sequence, double angles[3]);
 
+   // Batched forms of the above: count conversions with a common sequence.
+   static void compute_quaternions_from_euler_angles (
+      EulerSequence sequence, unsigned int count,
+      const double (* angles)[3], Quaternion * quats);
+
+   static void compute_matrices_from_euler_angles (
+      EulerSequence sequence, unsigned int count,
+      const double (* angles)[3], double (* trans)[3][3]);
+
+   static void compute_euler_angles_from_matrices (
+      unsigned int count, const double (* trans)[3][3],
+      EulerSequence sequence, double (* angles)[3]);
+
    static void compute_matrix_from_eigen_rotation (
       double eigen_angle, const double eigen_axis[3], double trans[3][3]);
 
@@ -206,6 +219,9 @@ class Orientation {
    void set_transform (const double trans[3][3]);
    void get_transform (double trans[3][3]);
 
+   void set_transformation_and_quaternion (
+      const double trans[3][3], const Quaternion &quat);
+
    void set_eigen_rotation (double eigen_angle, const double eigen_axis[3]);
    void get_eigen_rotation (double * eigen_angle, double eigen_axis[3]);
 
@@ -93,9 +93,10 @@ struct EulerInfo {
 /**
  * Contains twelve EulerInfo objects, one per each of the JEOD Euler sequences.
  * The elements are arranged per the values of the Orientation::EulerSequence
- * enumeration items.
+ * enumeration items. The table is a compile-time constant so that the
+ * kernels below, which are specialized by sequence, see fixed axes.
  */
-static const EulerInfo Euler_info[12] = {
+static constexpr EulerInfo Euler_info[12] = {
    //  seq       altx  altz  right    aero
    { {0, 1, 2},   0,    2,    true,   true }, // EulerXYZ
    { {0, 2, 1},   0,    1,   false,   true }, // EulerXZY
@@ -114,55 +115,357 @@ static const EulerInfo Euler_info[12] = {
 
 
 /**
- * Compute the left transformation quaternion from the Euler sequence.
- * The quaternion is formed by generating a sequence of three simple
- * quaternions corresponding to the three rotations. The composite
- * quaternion is the reverse-order product of these three simple quaternions.
- * \param[in] euler_sequence Euler sequence
+ * Sequence-specialized kernels for the Euler angle conversions.
+ * Each is a template on the Euler sequence, so the axes and sign rules taken
+ * from Euler_info are compile-time constants, and each is applied to a batch
+ * of inputs in a loop that the compiler can unroll and schedule as a whole.
+ */
+namespace {
+
+/**
+ * Pre-multiply a transformation matrix by the transformation matrix of a
+ * rotation about a coordinate axis.
+ * \param[in] axis Rotation axis, X=0, Y=1, Z=2
+ * \param[in] cos_theta Cosine of the rotation angle
+ * \param[in] sin_theta Sine of the rotation angle
+ * \param[in,out] trans Transformation matrix
+ */
+template <unsigned int axis>
+inline void
+premultiply_axis_rotation (
+   double cos_theta,
+   double sin_theta,
+   double trans[3][3])
+{
+   constexpr unsigned int ia = (axis + 1) % 3;
+   constexpr unsigned int ib = (axis + 2) % 3;
+
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      double row_a = trans[ia][jj];
+      double row_b = trans[ib][jj];
+      trans[ia][jj] =  cos_theta * row_a + sin_theta * row_b;
+      trans[ib][jj] = -sin_theta * row_a + cos_theta * row_b;
+   }
+}
+
+
+/**
+ * Post-multiply a quaternion by the left transformation quaternion of a
+ * rotation about a coordinate axis, whose vector part is
+ * -sin(theta/2) along the axis.
+ * \param[in] axis Rotation axis, X=0, Y=1, Z=2
+ * \param[in] cos_htheta Cosine of half the rotation angle
+ * \param[in] sin_htheta Sine of half the rotation angle
+ * \param[in,out] quat Quaternion
+ */
+template <unsigned int axis>
+inline void
+postmultiply_axis_rotation (
+   double cos_htheta,
+   double sin_htheta,
+   Quaternion & quat)
+{
+   constexpr unsigned int ia = (axis + 1) % 3;
+   constexpr unsigned int ib = (axis + 2) % 3;
+
+   double qs = quat.scalar;
+   double qk = quat.vector[axis];
+   double qa = quat.vector[ia];
+   double qb = quat.vector[ib];
+
+   quat.scalar      = cos_htheta * qs + sin_htheta * qk;
+   quat.vector[axis] = cos_htheta * qk - sin_htheta * qs;
+   quat.vector[ia]   = cos_htheta * qa - sin_htheta * qb;
+   quat.vector[ib]   = cos_htheta * qb + sin_htheta * qa;
+}
+
+
+/**
+ * Compute left transformation quaternions from Euler angles.
+ * See Orientation::compute_quaternion_from_euler_angles.
+ * \param[in] seq Euler sequence
+ * \param[in] count Number of conversions
  * \param[in] euler_angles Euler angles\n Units: r
- * \param[out] quat Resultant quaternion
+ * \param[out] quats Resultant quaternions
  */
+template <unsigned int seq>
 void
-Orientation::compute_quaternion_from_euler_angles (
-   EulerSequence euler_sequence,
-   const double euler_angles[3],
-   Quaternion & quat)
+quaternions_from_euler_angles (
+   unsigned int count,
+   const double (* euler_angles)[3],
+   Quaternion * quats)
 {
-   // Validate the value of the euler_sequence member.
-   // Note that an invalid value means the object is left unchanged.
-   if ((euler_sequence < EulerXYZ) || (euler_sequence > EulerZYZ)) {
+   constexpr unsigned int axis0 = Euler_info[seq].indices[0];
+   constexpr unsigned int axis1 = Euler_info[seq].indices[1];
+   constexpr unsigned int axis2 = Euler_info[seq].indices[2];
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      const double * angles = euler_angles[ii];
+      Quaternion & quat = quats[ii];
+
+      double htheta = 0.5*angles[2];
+      quat.scalar = std::cos (htheta);
+      quat.vector[0] = quat.vector[1] = quat.vector[2] = 0.0;
+      quat.vector[axis2] = -std::sin (htheta);
+
+      htheta = 0.5*angles[1];
+      postmultiply_axis_rotation<axis1> (
+         std::cos (htheta), std::sin (htheta), quat);
+
+      htheta = 0.5*angles[0];
+      postmultiply_axis_rotation<axis0> (
+         std::cos (htheta), std::sin (htheta), quat);
+
+      quat.normalize ();
+   }
+}
+
+
+/**
+ * Compute transformation matrices from Euler angles.
+ * See Orientation::compute_matrix_from_euler_angles.
+ * \param[in] seq Euler sequence
+ * \param[in] count Number of conversions
+ * \param[in] euler_angles Euler angles\n Units: r
+ * \param[out] trans Resultant transformation matrices
+ */
+template <unsigned int seq>
+void
+matrices_from_euler_angles (
+   unsigned int count,
+   const double (* euler_angles)[3],
+   double (* trans)[3][3])
+{
+   constexpr unsigned int axis0 = Euler_info[seq].indices[0];
+   constexpr unsigned int axis1 = Euler_info[seq].indices[1];
+   constexpr unsigned int axis2 = Euler_info[seq].indices[2];
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      const double * angles = euler_angles[ii];
+      double (* mat)[3] = trans[ii];
+
+      Matrix3x3::identity (mat);
+      premultiply_axis_rotation<axis0> (
+         std::cos (angles[0]), std::sin (angles[0]), mat);
+      premultiply_axis_rotation<axis1> (
+         std::cos (angles[1]), std::sin (angles[1]), mat);
+      premultiply_axis_rotation<axis2> (
+         std::cos (angles[2]), std::sin (angles[2]), mat);
+   }
+}
+
+
+/**
+ * Extract Euler angles from transformation matrices.
+ * See Orientation::compute_euler_angles_from_matrix for the method.
+ * \param[in] seq Euler sequence
+ * \param[in] count Number of conversions
+ * \param[in] trans Transformation matrices
+ * \param[in] gimbal_lock_threshold Gimbal lock threshold
+ * \param[out] euler_angles Resultant Euler angles\n Units: r
+ */
+template <unsigned int seq>
+void
+euler_angles_from_matrices (
+   unsigned int count,
+   const double (* trans)[3][3],
+   double gimbal_lock_threshold,
+   double (* euler_angles)[3])
+{
+   constexpr unsigned int idx0 = Euler_info[seq].indices[0];
+   constexpr unsigned int idx1 = Euler_info[seq].indices[1];
+   constexpr unsigned int idx2 = Euler_info[seq].indices[2];
+   constexpr unsigned int alt_x = Euler_info[seq].alternate_x;
+   constexpr unsigned int alt_z = Euler_info[seq].alternate_z;
+   constexpr bool is_even = Euler_info[seq].is_even_permutation;
+   constexpr bool is_aero = Euler_info[seq].is_aerodynamics_sequence;
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      const double (* mat)[3] = trans[ii];
+      double phi;
+      double theta;
+      double psi;
+
+      // Key elements, assuming this is not a gimbal lock situation.
+      double theta_val = mat[idx2][idx0];
+      double sin_phi = mat[idx2][idx1];
+      double cos_phi = mat[idx2][alt_z];
+      double sin_psi = mat[idx1][idx0];
+      double cos_psi = mat[alt_x][idx0];
+
+      double alt_theta_val =
+         0.5 * (std::sqrt (sin_phi*sin_phi + cos_phi*cos_phi) +
+                std::sqrt (sin_psi*sin_psi + cos_psi*cos_psi));
+
+      if (is_aero && (! is_even)) {
+         theta_val = -theta_val;
+      }
+
+      // Compute theta.
+      if (alt_theta_val < std::fabs (theta_val)) {
+         double alt_theta = std::asin (alt_theta_val);
+         if (is_aero) {
+            theta = (theta_val < 0.0) ? -0.5*M_PI + alt_theta
+                                      :  0.5*M_PI - alt_theta;
+         }
+         else {
+            theta = (theta_val < 0.0) ? M_PI - alt_theta : alt_theta;
+         }
+      }
+      else {
+         theta = is_aero ? std::asin (theta_val) : std::acos (theta_val);
+      }
+
+      // Not in a gimbal lock situation: correct the signs and compute
+      // phi and psi.
+      if (alt_theta_val > gimbal_lock_threshold) {
+         if (is_aero) {
+            if (is_even) {
+               sin_phi = -sin_phi;
+               sin_psi = -sin_psi;
+            }
+         }
+         else if (is_even) {
+            cos_phi = -cos_phi;
+         }
+         else {
+            cos_psi = -cos_psi;
+         }
+
+         phi = std::atan2 (sin_phi, cos_phi);
+         psi = std::atan2 (sin_psi, cos_psi);
+      }
+
+      // In a gimbal lock situation: set psi to zero.
+      else {
+         sin_phi = mat[idx1][alt_z];
+         cos_phi = mat[idx1][idx1];
+         if (! is_even) {
+            sin_phi = -sin_phi;
+         }
+
+         phi = std::atan2 (sin_phi, cos_phi);
+         psi = 0.0;
+      }
+
+      euler_angles[ii][0] = phi;
+      euler_angles[ii][1] = theta;
+      euler_angles[ii][2] = psi;
+   }
+}
+
+
+/**
+ * The kernels, indexed by Orientation::EulerSequence.
+ */
+typedef void (* QuaternionKernel) (
+   unsigned int, const double (*)[3], Quaternion *);
+typedef void (* MatrixKernel) (
+   unsigned int, const double (*)[3], double (*)[3][3]);
+typedef void (* AnglesKernel) (
+   unsigned int, const double (*)[3][3], double, double (*)[3]);
+
+const QuaternionKernel quaternion_kernels[12] = {
+   quaternions_from_euler_angles<0>,  quaternions_from_euler_angles<1>,
+   quaternions_from_euler_angles<2>,  quaternions_from_euler_angles<3>,
+   quaternions_from_euler_angles<4>,  quaternions_from_euler_angles<5>,
+   quaternions_from_euler_angles<6>,  quaternions_from_euler_angles<7>,
+   quaternions_from_euler_angles<8>,  quaternions_from_euler_angles<9>,
+   quaternions_from_euler_angles<10>, quaternions_from_euler_angles<11>
+};
+
+const MatrixKernel matrix_kernels[12] = {
+   matrices_from_euler_angles<0>,  matrices_from_euler_angles<1>,
+   matrices_from_euler_angles<2>,  matrices_from_euler_angles<3>,
+   matrices_from_euler_angles<4>,  matrices_from_euler_angles<5>,
+   matrices_from_euler_angles<6>,  matrices_from_euler_angles<7>,
+   matrices_from_euler_angles<8>,  matrices_from_euler_angles<9>,
+   matrices_from_euler_angles<10>, matrices_from_euler_angles<11>
+};
+
+const AnglesKernel angles_kernels[12] = {
+   euler_angles_from_matrices<0>,  euler_angles_from_matrices<1>,
+   euler_angles_from_matrices<2>,  euler_angles_from_matrices<3>,
+   euler_angles_from_matrices<4>,  euler_angles_from_matrices<5>,
+   euler_angles_from_matrices<6>,  euler_angles_from_matrices<7>,
+   euler_angles_from_matrices<8>,  euler_angles_from_matrices<9>,
+   euler_angles_from_matrices<10>, euler_angles_from_matrices<11>
+};
+
+
+/**
+ * Check that a sequence identifies an Euler sequence.
+ * @return True if the sequence is valid
+ * \param[in] euler_sequence Euler sequence
+ */
+bool
+validate_sequence (
+   Orientation::EulerSequence euler_sequence)
+{
+   // Note that an invalid value means the output is left unchanged.
+   if ((euler_sequence < Orientation::EulerXYZ) ||
+       (euler_sequence > Orientation::EulerZYZ)) {
       MessageHandler::error (
          __FILE__, __LINE__, OrientationMessages::invalid_enum,
          "The euler_sequence data member has not been set or is invalid; "
          "value=%d",
          static_cast<int> (euler_sequence));
-      return;
+      return false;
    }
+   return true;
+}
 
-   const unsigned int * axes = Euler_info[euler_sequence].indices;
-   Quaternion q[3], q21;
+} // End anonymous namespace
 
-   for (int ii = 0; ii < 3; ii++) {
-      double htheta = 0.5*euler_angles[ii];
-      double cosht = std::cos (htheta);
-      double sinht = std::sin (htheta);
-      q[ii].scalar = cosht;
-      q[ii].vector[axes[ii]] = -sinht;
-   }
 
-   q[2].multiply (q[1], q21);
-   q21.multiply (q[0], quat);
-   quat.normalize ();
+/**
+ * Compute the left transformation quaternion from the Euler sequence.
+ * The quaternion is the reverse-order product of the three simple
+ * quaternions corresponding to the three rotations.
+ * \param[in] euler_sequence Euler sequence
+ * \param[in] euler_angles Euler angles\n Units: r
+ * \param[out] quat Resultant quaternion
+ */
+void
+Orientation::compute_quaternion_from_euler_angles (
+   EulerSequence euler_sequence,
+   const double euler_angles[3],
+   Quaternion & quat)
+{
+   compute_quaternions_from_euler_angles (
+      euler_sequence, 1,
+      reinterpret_cast<const double (*)[3]> (euler_angles), &quat);
+}
+
 
-   return;
+/**
+ * Compute the left transformation quaternions from a batch of Euler angles
+ * with a common Euler sequence.
+ * See compute_quaternion_from_euler_angles.
+ * \param[in] euler_sequence Euler sequence
+ * \param[in] count Number of conversions
+ * \param[in] euler_angles Euler angles\n Units: r
+ * \param[out] quats Resultant quaternions
+ */
+void
+Orientation::compute_quaternions_from_euler_angles (
+   EulerSequence euler_sequence,
+   unsigned int count,
+   const double (* euler_angles)[3],
+   Quaternion * quats)
+{
+   if (validate_sequence (euler_sequence)) {
+      quaternion_kernels[euler_sequence] (count, euler_angles, quats);
+   }
 }
 
 
 /**
  * Compute the transformation matrix from the Euler sequence.
- * The matrix is formed by generating a sequence of three simple transformation
- * matrices corresponding to the three rotations. The composite transformation
- * matrix is the reverse-order product of these three simple matrices.
+ * The matrix is the reverse-order product of the three simple transformation
+ * matrices corresponding to the three rotations. Each simple matrix alters
+ * only the two rows of the product off its rotation axis, so the product
+ * is accumulated in place.
  * \param[in] euler_sequence Euler sequence
  * \param[in] euler_angles Euler angles\n Units: r
  * \param[out] trans Resultant transformation matrix
@@ -173,54 +476,32 @@ Orientation::compute_matrix_from_euler_angles (
    const double euler_angles[3],
    double trans[3][3])
 {
-   // Validate the value of the euler_sequence member.
-   // Note that an invalid value means the object is left unchanged.
-   if ((euler_sequence < EulerXYZ) || (euler_sequence > EulerZYZ)) {
-      MessageHandler::error (
-         __FILE__, __LINE__, OrientationMessages::invalid_enum,
-         "The euler_sequence data member has not been set or is invalid; "
-         "value=%d",
-         static_cast<int> (euler_sequence));
-      return;
-   }
-   const unsigned int * axes = Euler_info[euler_sequence].indices;
-   double m[3][3][3], m21[3][3];
-
-   for (int ii = 0; ii < 3; ii++) {
-      Matrix3x3::initialize (m[ii]);
-      double sin_theta = std::sin (euler_angles[ii]);
-      double cos_theta = std::cos (euler_angles[ii]);
-      switch (axes[ii]) {
-      case 0:
-         m[ii][0][0] = 1.0;
-         m[ii][1][1] =  cos_theta;
-         m[ii][1][2] =  sin_theta;
-         m[ii][2][1] = -sin_theta;
-         m[ii][2][2] =  cos_theta;
-         break;
-      case 1:
-         m[ii][1][1] = 1.0;
-         m[ii][0][0] =  cos_theta;
-         m[ii][0][2] = -sin_theta;
-         m[ii][2][0] =  sin_theta;
-         m[ii][2][2] =  cos_theta;
-         break;
-      case 2:
-         m[ii][2][2] = 1.0;
-         m[ii][0][0] =  cos_theta;
-         m[ii][0][1] =  sin_theta;
-         m[ii][1][0] = -sin_theta;
-         m[ii][1][1] =  cos_theta;
-         break;
-      default:
-         break;
-      }
-   }
+   compute_matrices_from_euler_angles (
+      euler_sequence, 1,
+      reinterpret_cast<const double (*)[3]> (euler_angles),
+      reinterpret_cast<double (*)[3][3]> (trans));
+}
 
-   Matrix3x3::product (m[2], m[1], m21);
-   Matrix3x3::product (m21, m[0], trans);
 
-   return;
+/**
+ * Compute the transformation matrices from a batch of Euler angles with a
+ * common Euler sequence.
+ * See compute_matrix_from_euler_angles.
+ * \param[in] euler_sequence Euler sequence
+ * \param[in] count Number of conversions
+ * \param[in] euler_angles Euler angles\n Units: r
+ * \param[out] trans Resultant transformation matrices
+ */
+void
+Orientation::compute_matrices_from_euler_angles (
+   EulerSequence euler_sequence,
+   unsigned int count,
+   const double (* euler_angles)[3],
+   double (* trans)[3][3])
+{
+   if (validate_sequence (euler_sequence)) {
+      matrix_kernels[euler_sequence] (count, euler_angles, trans);
+   }
 }
 
 
@@ -307,157 +588,32 @@ Orientation::compute_euler_angles_from_matrix (
    EulerSequence euler_sequence,
    double euler_angles[3])
 {
-   // Validate the value of the euler_sequence member.
-   // Note that an invalid value means the object is left unchanged.
-   if ((euler_sequence < EulerXYZ) || (euler_sequence > EulerZYZ)) {
-      MessageHandler::error (
-         __FILE__, __LINE__, OrientationMessages::invalid_enum,
-         "The euler_sequence data member has not been set or is invalid; "
-         "value=%d",
-         static_cast<int> (euler_sequence));
-      return;
-   }
-   const EulerInfo & info = Euler_info[euler_sequence];  // See above
-
-   double phi;            // First Euler angle
-   double theta;          // Second Euler angle
-   double psi;            // Third Euler angle
-
-   double cos_phi;        // cos(phi) * extra stuff * sign
-   double sin_phi;        // sin(phi) * extra stuff * sign
-   double cos_psi;        // cos(psi) * extra stuff * sign
-   double sin_psi;        // sin(psi) * extra stuff * sign
-   double theta_val;      // sin(theta), -sin(theta) or cos(theta)
-   double alt_theta_val1; // Conceptually, 1-theta_val^2
-   double alt_theta_val2; // Conceptually, 1-theta_val^2
-   double alt_theta_val;  // Conceptually, 1-theta_val^2
-
-
-   // Extract the key elements from the matrix assuming that this is not
-   // a gimbal lock situation.
-   // The trans[info.indices[2]][info.indices[0]] element is
-   //  *  sin(theta) for even permutation aerodynamics sequences,
-   //  * -sin(theta) for odd permutation aerodynamics sequences, or
-   //  *  cos(theta) for all astronomical sequences.
-   theta_val = trans[info.indices[2]][info.indices[0]];
-
-   // Get terms containing the sines and cosines of the first and third Euler
-   // angle times sin(theta) or cos(theta) (and sometimes negated).
-   sin_phi = trans[info.indices[2]][info.indices[1]];
-   cos_phi = trans[info.indices[2]][info.alternate_z];
-   sin_psi = trans[info.indices[1]][info.indices[0]];
-   cos_psi = trans[info.alternate_x][info.indices[0]];
-
-   // Compute alternative theta values based on the above four terms.
-   alt_theta_val1 = std::sqrt (sin_phi*sin_phi + cos_phi*cos_phi);
-   alt_theta_val2 = std::sqrt (sin_psi*sin_psi + cos_psi*cos_psi);
-   alt_theta_val  = 0.5 * (alt_theta_val1 + alt_theta_val2);
-
-   // theta_val is -sin(theta) for odd permutation aerodynamics sequences.
-   // Negate to get rid of the minus sign.
-   if (info.is_aerodynamics_sequence && (! info.is_even_permutation)) {
-      theta_val = -theta_val;
-   }
-
-
-   // Compute theta.
-   if (alt_theta_val < std::fabs (theta_val)) {
-      double alt_theta = std::asin (alt_theta_val);
-
-      if (info.is_aerodynamics_sequence) {
-         if (theta_val < 0.0) {
-            theta = -0.5*M_PI + alt_theta;
-         }
-         else {
-            theta =  0.5*M_PI - alt_theta;
-         }
-      }
-      else {
-         if (theta_val < 0.0) {
-            theta = M_PI - alt_theta;
-         }
-         else {
-            theta =  alt_theta;
-         }
-      }
-   }
-   else {
-      if (info.is_aerodynamics_sequence) {
-         theta = std::asin (theta_val);
-      }
-      else {
-         theta = std::acos (theta_val);
-      }
-   }
-
-
-   // Not in a gimbal lock situation:
-   // Compute sin_phi, cos_phi, sin_psi, and cos_psi.
-   //  - These are not the sine and cosine of the Euler angles phi and psi.
-   //    Rather, they are sin(phi) etc. scaled by a common positive number.
-   //  - Key elements of the matrix are of the form
-   //      sign*cos(theta)*sin(phi) etc.
-   //  - The trick then is to find these key elements and then ensure that
-   //    sign*cos(theta) is positive for each of the four values.
-   //  - The specifics of the sign correction are depend on whether the
-   //    sequence is an aerodynamical or astronomical sequence.
-   if (alt_theta_val > gimbal_lock_threshold) {
-
-      // Correct signs for aerodynamic sequences.
-      if (info.is_aerodynamics_sequence) {
-
-         // The sine values have the wrong sign for right-handed aero sequences.
-         if (info.is_even_permutation) {
-            sin_phi = -sin_phi;
-            sin_psi = -sin_psi;
-         }
-      }
-
-      // Correct signs for astronomical sequences.
-      else {
-
-         // A cosine term has the wrong sign in the case of astro sequences.
-         // The term with the wrong sign is cos_phi for even permutations but
-         // cos_psi for odd permutations.
-         if (info.is_even_permutation) {
-            cos_phi = -cos_phi;
-         }
-         else {
-            cos_psi = -cos_psi;
-         }
-      }
-
-      // Compute phi and psi.
-      phi = std::atan2 (sin_phi, cos_phi);
-      psi = std::atan2 (sin_psi, cos_psi);
-   }
-
-
-   // In a gimbal lock situation:
-   // All that can be determine is the difference between / sum of phi and psi.
-   // Arbitrarily setting psi to zero resolves this issue.
-   else {
-      // Compute sin_phi and cos_phi with the same constraint on the
-      // common scale factor as outlined above.
-      sin_phi = trans[info.indices[1]][info.alternate_z];
-      cos_phi = trans[info.indices[1]][info.indices[1]];
+   compute_euler_angles_from_matrices (
+      1, reinterpret_cast<const double (*)[3][3]> (trans),
+      euler_sequence, reinterpret_cast<double (*)[3]> (euler_angles));
+}
 
-      // The sine value has the wrong sign for odd sequences.
-      if (! info.is_even_permutation) {
-         sin_phi = -sin_phi;
-      }
 
-      // Compute phi and psi.
-      phi = std::atan2 (sin_phi, cos_phi);
-      psi = 0.0;
+/**
+ * Extract Euler angles with a common Euler sequence from a batch of
+ * transformation matrices.
+ * See compute_euler_angles_from_matrix.
+ * \param[in] count Number of conversions
+ * \param[in] trans Transformation matrices
+ * \param[in] euler_sequence Euler sequence
+ * \param[out] euler_angles Resultant Euler angles\n Units: r
+ */
+void
+Orientation::compute_euler_angles_from_matrices (
+   unsigned int count,
+   const double (* trans)[3][3],
+   EulerSequence euler_sequence,
+   double (* euler_angles)[3])
+{
+   if (validate_sequence (euler_sequence)) {
+      angles_kernels[euler_sequence] (
+         count, trans, gimbal_lock_threshold, euler_angles);
    }
-
-   // Save the computed angles in the object.
-   euler_angles[0] = phi;
-   euler_angles[1] = theta;
-   euler_angles[2] = psi;
-
-   return;
 }
 
 } // End JEOD namespace
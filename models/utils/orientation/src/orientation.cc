@@ -547,6 +547,8 @@ Orientation::compute_euler_angles (
 
 /**
  * Compute all represented charts on SO3 from the specified source.
+ * The get_xxx methods compute only the representation requested; prefer
+ * those when not all representations are needed.
  */
 void
 Orientation::compute_all_products (
@@ -756,6 +758,31 @@ Orientation::set_transform (
 }
 
 
+/**
+ * Reset the instance with a new matrix and the corresponding quaternion.
+ * The matrix becomes the data source. The eigen rotation and Euler angles
+ * are not computed here; the compute_xxx and get_xxx methods compute them
+ * from the matrix when they are first requested.
+ * \param[in] trans_in New transformation matrix
+ * \param[in] quat_in  Left transformation quaternion corresponding to trans_in
+ */
+void
+Orientation::set_transformation_and_quaternion (
+   const double trans_in[3][3],
+   const Quaternion & quat_in)
+{
+   reset ();
+
+   have_transformation_ = true;
+   have_quaternion_ = true;
+   data_source = InputMatrix;
+   Matrix3x3::copy (trans_in, trans);
+   quat = quat_in;
+
+   return;
+}
+
+
 /**
  * Reset the instance with a new quaternion.
  * \param[in] quat_in New quaternion
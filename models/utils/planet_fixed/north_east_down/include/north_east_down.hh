@@ -116,6 +116,25 @@ class NorthEastDown : public PlanetFixedPosition {
     */
    AltLatLongType altlatlong_type; //!< trick_units(--)
 
+ protected:
+
+   /**
+    * The type, latitude, and longitude from which build_ned_orientation
+    * last built the NED frame orientation. The orientation is rebuilt only
+    * when these change.
+    */
+   AltLatLongType built_type; //!< trick_units(--)
+
+   /**
+    * Latitude from which the NED frame orientation was last built.
+    */
+   double built_latitude; //!< trick_units(rad)
+
+   /**
+    * Longitude from which the NED frame orientation was last built.
+    */
+   double built_longitude; //!< trick_units(rad)
+
 
  // Member functions
  public:
@@ -51,6 +51,9 @@ NorthEastDown::NorthEastDown(
    void)
 {
    altlatlong_type = undefined;
+   built_type = undefined;
+   built_latitude = 0.0;
+   built_longitude = 0.0;
 }
 
 
@@ -111,28 +114,19 @@ void NorthEastDown::update_from_ellip(
 
 /**
  * Build NED frame state based on current reference point information.
+ * The orientation depends only on the latitude and longitude of the
+ * reference point; it is rebuilt only when those change.
  */
 void NorthEastDown::build_ned_orientation(
    void)
 {
-   // Compute the sine and cosine of the latitude and longitude used to specify
-   // the NED frame orientation
-   double sinlat = 0.0;
-   double coslat = 0.0;
-   double sinlon = 0.0;
-   double coslon = 0.0;
+   const AltLatLongState * coords = nullptr;
 
    if (this->altlatlong_type == spherical) {
-      sinlat = std::sin (sphere_coords.latitude);
-      coslat = std::cos (sphere_coords.latitude);
-      sinlon = std::sin (sphere_coords.longitude);
-      coslon = std::cos (sphere_coords.longitude);
+      coords = &sphere_coords;
    }
    else if (this->altlatlong_type == elliptical) {
-      sinlat = std::sin (ellip_coords.latitude);
-      coslat = std::cos (ellip_coords.latitude);
-      sinlon = std::sin (ellip_coords.longitude);
-      coslon = std::cos (ellip_coords.longitude);
+      coords = &ellip_coords;
    }
    // Any other value is undefined/invalid
    else {
@@ -142,17 +136,36 @@ void NorthEastDown::build_ned_orientation(
       return;
    }
 
-   // Construct the NED frame's orientation
-   ned_frame.state.rot.T_parent_this[0][0] = -sinlat * coslon;
-   ned_frame.state.rot.T_parent_this[0][1] = -sinlat * sinlon;
-   ned_frame.state.rot.T_parent_this[0][2] =  coslat;
-   ned_frame.state.rot.T_parent_this[1][0] = -sinlon;
-   ned_frame.state.rot.T_parent_this[1][1] =  coslon;
-   ned_frame.state.rot.T_parent_this[1][2] =  0;
-   ned_frame.state.rot.T_parent_this[2][0] = -coslat * coslon;
-   ned_frame.state.rot.T_parent_this[2][1] = -coslat * sinlon;
-   ned_frame.state.rot.T_parent_this[2][2] = -sinlat;
-   ned_frame.state.rot.compute_quaternion ();
+   // Rebuild the orientation if the reference point has moved in latitude
+   // or longitude since the last build.
+   if ((built_type != altlatlong_type) ||
+       (built_latitude != coords->latitude) ||
+       (built_longitude != coords->longitude)) {
+
+      // Compute the sine and cosine of the latitude and longitude used to
+      // specify the NED frame orientation
+      double sinlat = std::sin (coords->latitude);
+      double coslat = std::cos (coords->latitude);
+      double sinlon = std::sin (coords->longitude);
+      double coslon = std::cos (coords->longitude);
+
+      // Construct the NED frame's orientation
+      ned_frame.state.rot.T_parent_this[0][0] = -sinlat * coslon;
+      ned_frame.state.rot.T_parent_this[0][1] = -sinlat * sinlon;
+      ned_frame.state.rot.T_parent_this[0][2] =  coslat;
+      ned_frame.state.rot.T_parent_this[1][0] = -sinlon;
+      ned_frame.state.rot.T_parent_this[1][1] =  coslon;
+      ned_frame.state.rot.T_parent_this[1][2] =  0;
+      ned_frame.state.rot.T_parent_this[2][0] = -coslat * coslon;
+      ned_frame.state.rot.T_parent_this[2][1] = -coslat * sinlon;
+      ned_frame.state.rot.T_parent_this[2][2] = -sinlat;
+      ned_frame.state.rot.compute_quaternion ();
+
+      built_type = altlatlong_type;
+      built_latitude = coords->latitude;
+      built_longitude = coords->longitude;
+   }
+
    Vector3::initialize (ned_frame.state.rot.ang_vel_this);
    ned_frame.state.rot.ang_vel_mag = 0.0;
 
@@ -56,7 +56,11 @@ Purpose:
 References:
    (((Vallado, David. A) (Fundamentals of Astrodynamics and Applications,
       2nd Ed.) (Microcosm Press: El Segundo, CA) (2004) (Page 139-140)
-      (ISBN:1-881883-12-4)))
+      (ISBN:1-881883-12-4))
+    ((Vermeille, H.)
+     (Direct transformation from geocentric coordinates to geodetic
+      coordinates)
+     (Journal of Geodesy, 76 (2002), pp. 451-454)))
 
 Assumptions and Limitations:
    ((Given Cartesian coordinates are assumed to be in planet-centered, planet-
@@ -159,6 +163,16 @@ class PlanetFixedPosition {
    // Update from elliptical position input
    virtual void update_from_ellip (const AltLatLongState &ellip);
 
+   // Convert many Cartesian positions to spherical coordinates
+   void convert_cart_to_spher (
+      unsigned int num, double const * const cart[3],
+      double * alt, double * lat, double * lon) const;
+
+   // Convert many Cartesian positions to elliptical coordinates
+   void convert_cart_to_ellip (
+      unsigned int num, double const * const cart[3],
+      double * alt, double * lat, double * lon) const;
+
 
  protected:
 
@@ -174,10 +188,14 @@ class PlanetFixedPosition {
    // Calculate the cartesian representation for the current elliptical coords
    void ellip_to_cart();
 
+   // Calculate elliptic latitude and altitude in closed form
+   bool get_elliptic_parameters_closed_form (
+      double r, double z, double &lat, double &alt) const;
+
 // Calculate elliptic latitude and altitude
 // FIXME Magic number 10
 int get_elliptic_parameters(
-double r, double z, double &f, double &h, int maxIters=10);
+double r, double z, double &f, double &h, int maxIters=10) const;
 
 };
 
@@ -43,6 +43,34 @@ Library Dependency:
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * Report that a position is too close to the planet center to be converted.
+ * \param[in] x X component of the position\n Units: M
+ */
+void
+report_small_radius (
+   double x)
+{
+   // Check for a NaN error having crept in before determining which
+   // error to send.
+   if (std::isnan(x)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, PlanetFixedMessages::domain_error,
+         "Prior computation of coordinates has introduced a NaN "
+         "(not-a-number) error.\n"
+         "Likely a problem with vehicle instability\n. Exiting.\n");
+   } else {
+      MessageHandler::fail (
+         __FILE__, __LINE__, PlanetFixedMessages::domain_error,
+         "Cartesian coordinates are nearly zero.");
+   }
+}
+
+} // End anonymous namespace
+
+
 /*******************************************************************************
 Purpose: (Specify radius below which coordinates should be deemed suspect.
           The current tiny setting protects against division by zero.
@@ -137,19 +165,7 @@ void PlanetFixedPosition::cart_to_spher(
 
    // Protect against division by zero.
    if (r_local < planet->r_eq * Small_radius_limit) {
-      // Check for a NaN error having crept in before determining which
-      // error to send.
-      if (std::isnan(cart_coords[0])) {
-         MessageHandler::fail (
-            __FILE__, __LINE__, PlanetFixedMessages::domain_error,
-            "Prior computation of coordinates has introduced a NaN "
-            "(not-a-number) error.\n"
-            "Likely a problem with vehicle instability\n. Exiting.\n");
-      } else {
-         MessageHandler::fail (
-            __FILE__, __LINE__, PlanetFixedMessages::domain_error,
-            "Cartesian coordinates are nearly zero.");
-      }
+      report_small_radius (cart_coords[0]);
       return;
    }
 
@@ -188,26 +204,19 @@ void PlanetFixedPosition::cart_to_ellip(
 
    // Protect against division by zero.
    if (r_ellipse < planet->r_eq * Small_radius_limit) {
-      // Check for a NaN error having crept in before determining which
-      // error to send.
-      if (std::isnan(cart_coords[0])) {
-         MessageHandler::fail (
-            __FILE__, __LINE__, PlanetFixedMessages::domain_error,
-            "Prior computation of coordinates has introduced a NaN "
-            "(not-a-number) error.\n"
-            "Likely a problem with vehicle instability\n. Exiting.\n");
-      } else {
-         MessageHandler::fail (
-            __FILE__, __LINE__, PlanetFixedMessages::domain_error,
-            "Cartesian coordinates are nearly zero.");
-      }
+      report_small_radius (cart_coords[0]);
       return;
    }
 
 
-// Solve for elliptic parameters
-   get_elliptic_parameters(x_ellipse, z_ellipse,
-                          ellip_coords.latitude, ellip_coords.altitude);
+// Solve for elliptic parameters, iterating only where the closed form
+// does not apply.
+   if (! get_elliptic_parameters_closed_form (
+            x_ellipse, z_ellipse,
+            ellip_coords.latitude, ellip_coords.altitude)) {
+      get_elliptic_parameters(x_ellipse, z_ellipse,
+                             ellip_coords.latitude, ellip_coords.altitude);
+   }
 
 // Check for being directly over the pole
    if(std::fpclassify(x_ellipse) != FP_ZERO) {
@@ -273,6 +282,144 @@ void PlanetFixedPosition::ellip_to_cart(
    return;
 }
 
+/**
+ * Convert Cartesian positions to spherical coordinates.
+ * The positions are passed as three arrays, each num long, holding the
+ * x, y, and z components.
+ * \param[in]  num  Number of positions
+ * \param[in]  cart Cartesian coords, PCPF\n Units: M
+ * \param[out] alt  Spherical altitudes\n Units: M
+ * \param[out] lat  Spherical latitudes\n Units: r
+ * \param[out] lon  Longitudes\n Units: r
+ */
+void
+PlanetFixedPosition::convert_cart_to_spher (
+   unsigned int num,
+   double const * const cart[3],
+   double * alt,
+   double * lat,
+   double * lon)
+const
+{
+   double r_eq = planet->r_eq;
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double x = cart[0][ii];
+      double y = cart[1][ii];
+      double z = cart[2][ii];
+      double r_local = std::sqrt (x*x + y*y + z*z);
+
+      if (r_local < r_eq * Small_radius_limit) {
+         report_small_radius (x);
+         return;
+      }
+
+      lat[ii] = std::asin (z / r_local);
+      lon[ii] = std::atan2 (y, x);
+      alt[ii] = r_local - r_eq;
+   }
+}
+
+
+/**
+ * Convert Cartesian positions to elliptical coordinates.
+ * The positions are passed as three arrays, each num long, holding the
+ * x, y, and z components. The longitude of a point on the polar axis is
+ * set to zero.
+ * \param[in]  num  Number of positions
+ * \param[in]  cart Cartesian coords, PCPF\n Units: M
+ * \param[out] alt  Elliptical altitudes\n Units: M
+ * \param[out] lat  Elliptical latitudes\n Units: r
+ * \param[out] lon  Longitudes\n Units: r
+ */
+void
+PlanetFixedPosition::convert_cart_to_ellip (
+   unsigned int num,
+   double const * const cart[3],
+   double * alt,
+   double * lat,
+   double * lon)
+const
+{
+   double r_limit = planet->r_eq * Small_radius_limit;
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double x = cart[0][ii];
+      double y = cart[1][ii];
+      double z = cart[2][ii];
+      double x_ellipse_sq = x*x + y*y;
+      double x_ellipse = std::sqrt (x_ellipse_sq);
+
+      if (std::sqrt (x_ellipse_sq + z*z) < r_limit) {
+         report_small_radius (x);
+         return;
+      }
+
+      if (! get_elliptic_parameters_closed_form (
+               x_ellipse, z, lat[ii], alt[ii])) {
+         get_elliptic_parameters (x_ellipse, z, lat[ii], alt[ii]);
+      }
+
+      if (std::fpclassify(x_ellipse) != FP_ZERO) {
+         lon[ii] = std::atan2 (y, x);
+      }
+      else {
+         lon[ii] = 0.0;
+      }
+   }
+}
+
+
+/**
+ * Calculate the latitude and altitude of a point relative to the planet's
+ * ellipsoid with Vermeille's closed-form solution.
+ * The solution applies everywhere except near the planet center, inside
+ * the ellipsoid's evolute (within about e^2 r_eq of the center). This
+ * method returns false for such points; use get_elliptic_parameters
+ * for them.
+ * @return True if the solution was computed
+ * \param[in]  r   Equatorial position, sqrt(x^2+y^2)\n Units: M
+ * \param[in]  z   Polar position\n Units: M
+ * \param[out] lat Elliptical latitude\n Units: r
+ * \param[out] alt Elliptical altitude\n Units: M
+ */
+bool
+PlanetFixedPosition::get_elliptic_parameters_closed_form (
+   double r,
+   double z,
+   double &lat,
+   double &alt)
+const
+{
+   double a_sq = planet->r_eq * planet->r_eq;
+   double e_sq = planet->e_ellip_sq;
+   double e_4th = e_sq * e_sq;
+
+   double p = r * r / a_sq;
+   double q = (1.0 - e_sq) * z * z / a_sq;
+   double rho = (p + q - e_4th) / 6.0;
+
+   // Inside the evolute: The closed form does not apply.
+   if (! (rho > 0.0)) {
+      return false;
+   }
+
+   double s = e_4th * p * q / (4.0 * rho * rho * rho);
+   double t = std::cbrt (1.0 + s + std::sqrt (s * (2.0 + s)));
+   double u = rho * (1.0 + t + 1.0 / t);
+   double v = std::sqrt (u * u + e_4th * q);
+   double w = e_sq * (u + v - q) / (2.0 * v);
+   double k = std::sqrt (u + v + w * w) - w;
+   double d = k * r / (k + e_sq);
+   double d_z = std::sqrt (d * d + z * z);
+
+   lat = 2.0 * std::atan2 (z, d + d_z);
+   alt = (k + e_sq - 1.0) / k * d_z;
+
+   return true;
+}
+
+
 /*******************************************************************************
 Function: PlanetFixedPosition::get_elliptic_parameters
 Purpose: Calculate latitude and altitude of a Cartesian point relative to
@@ -290,6 +437,7 @@ PlanetFixedPosition::get_elliptic_parameters (/* Return: --
    double &lat,       // Out: r Latitude
    double &alt,       // Out: M Altitude
    int maxIters)      // In: -- Maximum number of iterations
+const
 {
    int numIters = 0;
    double a = planet->r_eq;
@@ -63,6 +63,7 @@ Library dependencies:
    (../src/quat_to_mat.cc)
    (../src/quat_from_mat.cc)
    (../src/quat_to_eigenrot.cc)
+   (../src/quat_integ.cc)
    (../src/quat_messages.cc))
 
  
@@ -227,6 +228,13 @@ public:
       const double quat[4], const double ang_vel[3], const double ang_acc[3],
       double qddot[4]);
 
+   // Normalize an integrated quaternion (as normalize_integ) and compute
+   // the corresponding transformation matrix and quaternion derivative
+   // (as left_quat_to_transformation and compute_left_quat_deriv) in one
+   // pass over the quaternion.
+   void normalize_integ_transform_deriv (
+      const double ang_vel[3], double T[3][3], Quaternion & qdot);
+
    // SLERP Algorithm - interpolates the shortest and straightest (minimum)
    // geodescic between two quaternions.
    static Quaternion compute_slerp (
@@ -0,0 +1,140 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Quaternion
+ * @{
+ *
+ * @file models/utils/quaternion/include/quat_batch.hh
+ * Define the class QuaternionBatch, which applies the Quaternion operations
+ * to many quaternions at a time.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/quat_batch.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_QUATERNION_BATCH_HH
+#define JEOD_QUATERNION_BATCH_HH
+
+
+//! Namespace jeod
+namespace jeod {
+
+class Quaternion;
+
+/**
+ * Provides static methods that apply the Quaternion operations to n
+ * quaternions stored as structure of arrays: four arrays, each n long,
+ * passed as an array of four pointers, quat[0] holding the scalar parts and
+ * quat[1..3] the vector parts (the double[4] order). Transformation
+ * matrices and vectors use the Matrix3x3Batch and Vector3Batch SoA layouts.
+ *
+ * Each element is computed with the expression the Quaternion method of the
+ * same name uses, so the results are those of the scalar methods. The loops
+ * are branch-free and call-free, for the compiler to vectorize.
+ */
+class QuaternionBatch {
+
+ public:
+
+   // Normalize integrated quaternions in place, as
+   // Quaternion::normalize_integ
+   static void normalize_integ (unsigned int num, double * const quat[4]);
+
+   // Compute transformation matrices from left quaternions, as
+   // Quaternion::left_quat_to_transformation
+   static void left_quat_to_transformation (
+      unsigned int num, double const * const quat[4], double * const T[3][3]);
+
+   // Multiply quaternions, prod[i] = quat_left[i] * quat_right[i]
+   static void multiply (
+      unsigned int num,
+      double const * const quat_left[4], double const * const quat_right[4],
+      double * const prod[4]);
+
+   // Multiply quaternions by a common right quaternion,
+   // prod[i] = quat_left[i] * quat_right
+   static void multiply (
+      unsigned int num,
+      double const * const quat_left[4], const Quaternion & quat_right,
+      double * const prod[4]);
+
+   // Multiply quaternions by a common left quaternion,
+   // prod[i] = quat_left * quat_right[i]
+   static void multiply (
+      unsigned int num,
+      const Quaternion & quat_left, double const * const quat_right[4],
+      double * const prod[4]);
+
+   // Compute quaternion derivatives, as
+   // Quaternion::compute_left_quat_deriv
+   static void compute_left_quat_deriv (
+      unsigned int num,
+      double const * const quat[4], double const * const ang_vel[3],
+      double * const qdot[4]);
+
+   // Normalize integrated quaternions and compute their transformation
+   // matrices and derivatives, as
+   // Quaternion::normalize_integ_transform_deriv
+   static void normalize_integ_transform_deriv (
+      unsigned int num,
+      double * const quat[4], double const * const ang_vel[3],
+      double * const T[3][3], double * const qdot[4]);
+
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
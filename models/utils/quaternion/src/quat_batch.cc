@@ -0,0 +1,362 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Quaternion
+ * @{
+ *
+ * @file models/utils/quaternion/src/quat_batch.cc
+ * Define the static methods of the class QuaternionBatch.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((IEEE 754 / IEC 60559:1989 double precision floating point standard.))
+
+Library dependencies:
+  ((quat_batch.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+
+// JEOD includes
+
+// Model includes
+#include "../include/quat.hh"
+#include "../include/quat_batch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Compute the normalization factor of Quaternion::normalize_integ.
+ * Both candidate factors are computed and one is selected, which keeps the
+ * calling loops branch-free.
+ * @return Normalization factor
+ * \param[in] qmagsq Squared quaternion norm
+ */
+inline double
+normalization_factor (
+   double qmagsq)
+{
+   double diff1 = 1.0 - qmagsq;
+   bool near_unit = (diff1 > -2.107342e-08) && (diff1 < 2.107342e-08);
+   double first_order = 2.0 / (1.0 + qmagsq);
+   double exact = 1.0 / std::sqrt (qmagsq);
+   return near_unit ? first_order : exact;
+}
+
+
+/**
+ * Compute a transformation matrix from a normalized left quaternion, as
+ * Quaternion::left_quat_to_transformation.
+ * \param[in]  qs  Scalar part
+ * \param[in]  qv0 Vector part, x
+ * \param[in]  qv1 Vector part, y
+ * \param[in]  qv2 Vector part, z
+ * \param[in]  ii  Index into T
+ * \param[out] T   Transformation matrices
+ */
+inline void
+store_transformation (
+   double qs,
+   double qv0,
+   double qv1,
+   double qv2,
+   unsigned int ii,
+   double * const T[3][3])
+{
+   double cost = 2.0 * qs * qs - 1.0;
+   double qvx20 = qv0 + qv0;
+   double qvx21 = qv1 + qv1;
+   double qvx22 = qv2 + qv2;
+   double qsqv20 = qvx20 * qs;
+   double qsqv21 = qvx21 * qs;
+   double qsqv22 = qvx22 * qs;
+   double qvqv20 = qv1 * qvx22;
+   double qvqv21 = qv2 * qvx20;
+   double qvqv22 = qv0 * qvx21;
+
+   T[0][0][ii] = cost + qv0 * qvx20;
+   T[1][1][ii] = cost + qv1 * qvx21;
+   T[2][2][ii] = cost + qv2 * qvx22;
+   T[0][1][ii] = qvqv22 - qsqv22;
+   T[1][0][ii] = qvqv22 + qsqv22;
+   T[1][2][ii] = qvqv20 - qsqv20;
+   T[2][1][ii] = qvqv20 + qsqv20;
+   T[2][0][ii] = qvqv21 - qsqv21;
+   T[0][2][ii] = qvqv21 + qsqv21;
+}
+
+
+/**
+ * Compute a quaternion derivative, as Quaternion::compute_left_quat_deriv.
+ * \param[in]  qs  Scalar part
+ * \param[in]  qv0 Vector part, x
+ * \param[in]  qv1 Vector part, y
+ * \param[in]  qv2 Vector part, z
+ * \param[in]  w0  Angular velocity, x
+ * \param[in]  w1  Angular velocity, y
+ * \param[in]  w2  Angular velocity, z
+ * \param[in]  ii  Index into qdot
+ * \param[out] qdot Quaternion derivatives
+ */
+inline void
+store_deriv (
+   double qs,
+   double qv0,
+   double qv1,
+   double qv2,
+   double w0,
+   double w1,
+   double w2,
+   unsigned int ii,
+   double * const qdot[4])
+{
+   double mhw0 = w0 * -0.5;
+   double mhw1 = w1 * -0.5;
+   double mhw2 = w2 * -0.5;
+
+   qdot[0][ii] = - (mhw0 * qv0 + mhw1 * qv1 + mhw2 * qv2);
+   qdot[1][ii] = mhw0 * qs + (mhw1 * qv2 - mhw2 * qv1);
+   qdot[2][ii] = mhw1 * qs + (mhw2 * qv0 - mhw0 * qv2);
+   qdot[3][ii] = mhw2 * qs + (mhw0 * qv1 - mhw1 * qv0);
+}
+
+
+/**
+ * Compute a quaternion product, as Quaternion::multiply.
+ * \param[in]  as  Left scalar part
+ * \param[in]  av  Left vector part
+ * \param[in]  bs  Right scalar part
+ * \param[in]  bv  Right vector part
+ * \param[in]  ii  Index into prod
+ * \param[out] prod Quaternion products
+ */
+inline void
+store_product (
+   double as,
+   const double av[3],
+   double bs,
+   const double bv[3],
+   unsigned int ii,
+   double * const prod[4])
+{
+   prod[0][ii] = as * bs - (bv[0] * av[0] + bv[1] * av[1] + bv[2] * av[2]);
+   prod[1][ii] = bv[0] * as + bs * av[0] + (av[1] * bv[2] - av[2] * bv[1]);
+   prod[2][ii] = bv[1] * as + bs * av[1] + (av[2] * bv[0] - av[0] * bv[2]);
+   prod[3][ii] = bv[2] * as + bs * av[2] + (av[0] * bv[1] - av[1] * bv[0]);
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Normalize integrated quaternions in place, without forcing the scalar
+ * parts non-negative.
+ * \param[in] num Number of quaternions
+ * \param[in,out] quat Quaternions
+ */
+void
+QuaternionBatch::normalize_integ (
+   unsigned int num,
+   double * const quat[4])
+{
+   double * qs = quat[0];
+   double * qx = quat[1];
+   double * qy = quat[2];
+   double * qz = quat[3];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double qmagsq = qs[ii] * qs[ii] +
+                      (qx[ii] * qx[ii] + qy[ii] * qy[ii] + qz[ii] * qz[ii]);
+      double fact = normalization_factor (qmagsq);
+      qs[ii] *= fact;
+      qx[ii] *= fact;
+      qy[ii] *= fact;
+      qz[ii] *= fact;
+   }
+}
+
+
+/**
+ * Compute parent-to-child transformation matrices from normalized
+ * parent-to-child left quaternions.
+ * \param[in] num Number of quaternions
+ * \param[in] quat Quaternions
+ * \param[out] T Transformation matrices
+ */
+void
+QuaternionBatch::left_quat_to_transformation (
+   unsigned int num,
+   double const * const quat[4],
+   double * const T[3][3])
+{
+   const double * qs = quat[0];
+   const double * qx = quat[1];
+   const double * qy = quat[2];
+   const double * qz = quat[3];
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      store_transformation (qs[ii], qx[ii], qy[ii], qz[ii], ii, T);
+   }
+}
+
+
+/**
+ * Multiply quaternions, prod[i] = quat_left[i] * quat_right[i]
+ * \param[in] num Number of quaternions
+ * \param[in] quat_left Left multiplicands
+ * \param[in] quat_right Right multiplicands
+ * \param[out] prod Products
+ */
+void
+QuaternionBatch::multiply (
+   unsigned int num,
+   double const * const quat_left[4],
+   double const * const quat_right[4],
+   double * const prod[4])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double av[3] = {quat_left[1][ii], quat_left[2][ii], quat_left[3][ii]};
+      double bv[3] = {quat_right[1][ii], quat_right[2][ii], quat_right[3][ii]};
+      store_product (quat_left[0][ii], av, quat_right[0][ii], bv, ii, prod);
+   }
+}
+
+
+/**
+ * Multiply quaternions by a common right quaternion,
+ * prod[i] = quat_left[i] * quat_right
+ * \param[in] num Number of quaternions
+ * \param[in] quat_left Left multiplicands
+ * \param[in] quat_right Right multiplicand
+ * \param[out] prod Products
+ */
+void
+QuaternionBatch::multiply (
+   unsigned int num,
+   double const * const quat_left[4],
+   const Quaternion & quat_right,
+   double * const prod[4])
+{
+   const double bs = quat_right.scalar;
+   const double bv[3] = {quat_right.vector[0],
+                         quat_right.vector[1],
+                         quat_right.vector[2]};
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double av[3] = {quat_left[1][ii], quat_left[2][ii], quat_left[3][ii]};
+      store_product (quat_left[0][ii], av, bs, bv, ii, prod);
+   }
+}
+
+
+/**
+ * Multiply quaternions by a common left quaternion,
+ * prod[i] = quat_left * quat_right[i]
+ * \param[in] num Number of quaternions
+ * \param[in] quat_left Left multiplicand
+ * \param[in] quat_right Right multiplicands
+ * \param[out] prod Products
+ */
+void
+QuaternionBatch::multiply (
+   unsigned int num,
+   const Quaternion & quat_left,
+   double const * const quat_right[4],
+   double * const prod[4])
+{
+   const double as = quat_left.scalar;
+   const double av[3] = {quat_left.vector[0],
+                         quat_left.vector[1],
+                         quat_left.vector[2]};
+
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double bv[3] = {quat_right[1][ii], quat_right[2][ii], quat_right[3][ii]};
+      store_product (as, av, quat_right[0][ii], bv, ii, prod);
+   }
+}
+
+
+/**
+ * Compute the time derivatives of left quaternions.
+ * \param[in] num Number of quaternions
+ * \param[in] quat Quaternions
+ * \param[in] ang_vel Angular velocities\n Units: r/s
+ * \param[out] qdot Quaternion derivatives
+ */
+void
+QuaternionBatch::compute_left_quat_deriv (
+   unsigned int num,
+   double const * const quat[4],
+   double const * const ang_vel[3],
+   double * const qdot[4])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      store_deriv (quat[0][ii], quat[1][ii], quat[2][ii], quat[3][ii],
+                   ang_vel[0][ii], ang_vel[1][ii], ang_vel[2][ii],
+                   ii, qdot);
+   }
+}
+
+
+/**
+ * Complete a rotational integration step for each quaternion: normalize it,
+ * then compute its transformation matrix and derivative.
+ * \param[in] num Number of quaternions
+ * \param[in,out] quat Quaternions
+ * \param[in] ang_vel Angular velocities\n Units: r/s
+ * \param[out] T Transformation matrices
+ * \param[out] qdot Quaternion derivatives
+ */
+void
+QuaternionBatch::normalize_integ_transform_deriv (
+   unsigned int num,
+   double * const quat[4],
+   double const * const ang_vel[3],
+   double * const T[3][3],
+   double * const qdot[4])
+{
+   for (unsigned int ii = 0; ii < num; ++ii) {
+      double qs = quat[0][ii];
+      double qv0 = quat[1][ii];
+      double qv1 = quat[2][ii];
+      double qv2 = quat[3][ii];
+      double fact = normalization_factor (
+                       qs * qs + (qv0 * qv0 + qv1 * qv1 + qv2 * qv2));
+      qs  *= fact;
+      qv0 *= fact;
+      qv1 *= fact;
+      qv2 *= fact;
+      quat[0][ii] = qs;
+      quat[1][ii] = qv0;
+      quat[2][ii] = qv1;
+      quat[3][ii] = qv2;
+
+      store_transformation (qs, qv0, qv1, qv2, ii, T);
+      store_deriv (qs, qv0, qv1, qv2,
+                   ang_vel[0][ii], ang_vel[1][ii], ang_vel[2][ii],
+                   ii, qdot);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
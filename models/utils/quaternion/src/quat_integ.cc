@@ -0,0 +1,126 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Quaternion
+ * @{
+ *
+ * @file models/utils/quaternion/src/quat_integ.cc
+ * Define Quaternion::normalize_integ_transform_deriv, which completes a
+ * rotational integration step.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((IEEE 754 / IEC 60559:1989 double precision floating point standard.))
+
+Library dependencies:
+  ((quat_integ.cc))
+
+ 
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+
+// JEOD includes
+
+// Model includes
+#include "../include/quat.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Complete a rotational integration step: normalize the integrated
+ * quaternion without forcing the scalar part non-negative, then compute
+ * the parent-to-child transformation matrix and the quaternion time
+ * derivative.
+ *
+ * This is normalize_integ(), left_quat_to_transformation() and
+ * compute_left_quat_deriv() fused into one pass. The quaternion is read
+ * and written once, and the intermediate values stay in registers. Each
+ * output is computed with the same expression as the separate methods, so
+ * the results are identical to calling them in turn.
+ *
+ * \param[in]  ang_vel Angular velocity\n Units: r/s
+ * \param[out] T       Transformation matrix
+ * \param[out] qdot    Quaternion derivative
+ */
+void
+Quaternion::normalize_integ_transform_deriv (
+   const double ang_vel[3],
+   double T[3][3],
+   Quaternion & qdot)
+{
+   double qs = scalar;
+   double qv0 = vector[0];
+   double qv1 = vector[1];
+   double qv2 = vector[2];
+
+   // Normalize; see Quaternion::normalize for the first-order shortcut.
+   double qmagsq = qs * qs + (qv0 * qv0 + qv1 * qv1 + qv2 * qv2);
+   double diff1 = 1.0 - qmagsq;
+   double fact;
+   if ((diff1 > -2.107342e-08) && (diff1 < 2.107342e-08)) {
+      fact = 2.0 / (1.0 + qmagsq);
+   } else {
+      fact = 1.0 / std::sqrt (qmagsq);
+   }
+   qs  *= fact;
+   qv0 *= fact;
+   qv1 *= fact;
+   qv2 *= fact;
+
+   scalar = qs;
+   vector[0] = qv0;
+   vector[1] = qv1;
+   vector[2] = qv2;
+
+   // Transformation matrix; see quat_to_mat.cc for the derivation.
+   double cost = 2.0 * qs * qs - 1.0;
+   double qvx20 = qv0 + qv0;
+   double qvx21 = qv1 + qv1;
+   double qvx22 = qv2 + qv2;
+   double qsqv20 = qvx20 * qs;
+   double qsqv21 = qvx21 * qs;
+   double qsqv22 = qvx22 * qs;
+   double qvqv20 = qv1 * qvx22;
+   double qvqv21 = qv2 * qvx20;
+   double qvqv22 = qv0 * qvx21;
+
+   T[0][0] = cost + qv0 * qvx20;
+   T[1][1] = cost + qv1 * qvx21;
+   T[2][2] = cost + qv2 * qvx22;
+   T[0][1] = qvqv22 - qsqv22;
+   T[1][0] = qvqv22 + qsqv22;
+   T[1][2] = qvqv20 - qsqv20;
+   T[2][1] = qvqv20 + qsqv20;
+   T[2][0] = qvqv21 - qsqv21;
+   T[0][2] = qvqv21 + qsqv21;
+
+   // Quaternion derivative, qdot = q * [0, -w/2].
+   double mhw0 = ang_vel[0] * -0.5;
+   double mhw1 = ang_vel[1] * -0.5;
+   double mhw2 = ang_vel[2] * -0.5;
+
+   qdot.scalar = - (mhw0 * qv0 + mhw1 * qv1 + mhw2 * qv2);
+   qdot.vector[0] = mhw0 * qs + (mhw1 * qv2 - mhw2 * qv1);
+   qdot.vector[1] = mhw1 * qs + (mhw2 * qv0 - mhw0 * qv2);
+   qdot.vector[2] = mhw2 * qs + (mhw0 * qv1 - mhw1 * qv0);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -75,7 +75,10 @@ class RefFrameMessages;
 class RefFrameOwner;
 class RefFrameRot;
 class RefFrameState;
+class RefFrameStateBatch;
+class RefFrameStateSource;
 class RefFrameTrans;
+class RefFrameTreeIndex;
 
 template <class Links, class Container> class TreeLinksIterator;
 template <class Links, class Container> class TreeLinksParentIterator;
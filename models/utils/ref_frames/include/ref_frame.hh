@@ -70,6 +70,7 @@ Library dependencies:
 #include "ref_frame_state.hh"
 
 // JEOD includes
+#include "utils/memory/include/class_declarations.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // System includes
@@ -101,6 +102,7 @@ class RefFrame : public Subscription {
    JEOD_MAKE_SIM_INTERFACES(RefFrame)
 
    friend class RefFrameLinks;
+   friend class RefFrameTreeIndex;
 
  // Member data
  public:
@@ -208,6 +210,10 @@ class RefFrame : public Subscription {
    // timestamp: Return the last update time
    virtual double timestamp (void) const;
 
+   // add_snapshot_regions: Register the state and update time with a
+   // state snapshot
+   void add_snapshot_regions (StateSnapshot & snapshot);
+
 
    // set_owner: Identify who contains/updates this frame
    virtual void set_owner (RefFrameOwner * new_owner);
@@ -279,11 +285,49 @@ class RefFrame : public Subscription {
    // find_last_common_node: Find the point of departure between nodes
    const RefFrame * find_last_common_node (const RefFrame& frame) const;
 
+
+   // invalidate_relative_state_caches: Discard all cached frame-pair paths
+   // and relative states. Called whenever the tree structure changes.
+   static void invalidate_relative_state_caches (void);
+
+   // get_tree_revision: Get a counter that changes whenever the structure
+   // of any reference frame tree changes.
+   static unsigned long get_tree_revision (void);
+
+   // set_tree_index: Specify a flattened tree index to be consulted when
+   // locating the common node of a pair of frames; null for none.
+   static void set_tree_index (const RefFrameTreeIndex * index);
+
+   // get_tree_index: Get the tree index specified by set_tree_index.
+   static const RefFrameTreeIndex * get_tree_index (void);
+
+   // set_relative_state_memo: Enable or disable memoization of the relative
+   // states computed by compute_relative_state.
+   static void set_relative_state_memo (bool enable);
+
+   // get_relative_state_memo: Is relative state memoization enabled?
+   static bool get_relative_state_memo (void);
+
+   // defer_state_refresh: Have the next relative state query ask the source
+   // to bring its frame states up to date.
+   static void defer_state_refresh (RefFrameStateSource & source);
+
+   // cancel_state_refresh: Withdraw a deferred refresh request.
+   static void cancel_state_refresh (RefFrameStateSource & source);
+
+   // refresh_deferred_states: Perform the deferred refresh, if any.
+   static void refresh_deferred_states (void);
+
  protected:
 
    // find_last_common_index: Find the point of departure between nodes
    int find_last_common_index (const RefFrame& frame) const;
 
+ private:
+
+   // note_state_update: Invalidate memoized relative states.
+   static void note_state_update (void);
+
 };
 
 
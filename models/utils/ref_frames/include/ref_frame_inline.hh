@@ -152,6 +152,7 @@ RefFrame::set_timestamp (
    double time)
 {
    update_time = time;
+   note_state_update ();
    return;
 }
 
@@ -177,6 +178,7 @@ RefFrame::make_root (
    void)
 {
    links.make_root();
+   invalidate_relative_state_caches ();
 
    return;
 }
@@ -191,6 +193,7 @@ RefFrame::add_child (
    RefFrame & frame)
 {
    frame.links.attach (links);
+   invalidate_relative_state_caches ();
 
    return;
 }
@@ -204,6 +207,7 @@ RefFrame::remove_from_parent (
    void)
 {
    links.detach();
+   invalidate_relative_state_caches ();
 
    return;
 }
@@ -65,13 +65,17 @@ Library dependencies:
 
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/memory/include/class_declarations.hh"
+#include "utils/named_item/include/name_table.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // Model includes
 #include "base_ref_frame_manager.hh"
+#include "ref_frame_tree_index.hh"
 
 
 //! Namespace jeod
@@ -109,6 +113,7 @@ public:
    RefFrame * find_ref_frame (const char * name) const override;
    RefFrame * find_ref_frame (
       const char * prefix, const char * suffix) const override;
+   RefFrame * find_ref_frame (NameHandle handle) const;
 
    // Check whether each reference frame has an owner.
    void check_ref_frame_ownership (void) const override;
@@ -119,6 +124,24 @@ public:
    // Add a reference frame to the reference frame tree.
    void add_frame_to_tree (RefFrame & ref_frame, RefFrame * parent) override;
 
+   // Enable or disable the flattened reference frame tree index.
+   void set_tree_index_enabled (bool enable);
+
+   // Rebuild the flattened tree index if it is enabled and out of date.
+   void update_tree_index (void);
+
+   /**
+    * Get the flattened reference frame tree index.
+    * @return Tree index, which may be empty or out of date
+    */
+   const RefFrameTreeIndex & get_tree_index (void) const
+   {
+      return tree_index;
+   }
+
+   // Register the reference frame states with a state snapshot.
+   virtual void add_snapshot_regions (StateSnapshot & snapshot);
+
 
    // Add a subscription to a reference frame.
    void subscribe_to_frame (const char * frame_name) override;
@@ -137,6 +160,12 @@ protected:
 
    // Member functions
 
+   // Find a reference frame by its full name via the name index.
+   RefFrame * find_indexed_ref_frame (const std::string & name) const;
+
+   // Rebuild the name index from the list of reference frames.
+   void rebuild_ref_frame_index (void) const;
+
    // Validate a name (with error reporting)
    bool validate_name (
       const char * file,
@@ -166,6 +195,28 @@ protected:
     */
    JeodPointerVector<RefFrame>::type ref_frames; //!< trick_io(**)
 
+   /**
+    * Index from interned frame name to position in ref_frames.
+    * This is a cache; it is rebuilt whenever it is found to be out of date.
+    */
+   mutable NameIndex ref_frame_index; //!< trick_io(**)
+
+   /**
+    * Is the ref_frame_index consistent with ref_frames?
+    */
+   mutable bool ref_frame_index_valid; //!< trick_io(**)
+
+   /**
+    * Flattened copy of the reference frame tree, used to locate the common
+    * node of pairs of frames without walking their paths.
+    */
+   RefFrameTreeIndex tree_index; //!< trick_io(**)
+
+   /**
+    * Is the tree index maintained and used?
+    */
+   bool tree_index_enabled; //!< trick_units(--)
+
 
 private:
 
@@ -0,0 +1,231 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup RefFrames
+ * @{
+ *
+ * @file models/utils/ref_frames/include/ref_frame_state_batch.hh
+ * Define the class RefFrameStateBatch, which stores a set of reference frame
+ * states in structure-of-arrays form and composes them with a common state.
+ */
+
+/********************************* TRICK HEADER ********************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/ref_frame_state_batch.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_REF_FRAME_STATE_BATCH_HH
+#define JEOD_REF_FRAME_STATE_BATCH_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+#include "ref_frame_items.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A set of reference frame states stored in structure-of-arrays form.
+ * Element i of each component array pertains to state i.
+ *
+ * The composition methods mirror the RefFrameState methods of the same name,
+ * applying a single state operand to every state in the batch. Shortcuts
+ * based on the operand (identity transformation, zero rate) are taken once
+ * per call rather than once per state, leaving simple loops over contiguous
+ * arrays that the compiler can vectorize.
+ *
+ * Each method takes an optional items argument that selects the parts of the
+ * states to be updated. Any of Pos and Vel selects the translational state
+ * (both are updated); any of Att and Rate selects the rotational state.
+ */
+class RefFrameStateBatch {
+
+   JEOD_MAKE_SIM_INTERFACES(RefFrameStateBatch)
+
+ public:
+
+   /**
+    * Identifies a component array. Vector components occupy three successive
+    * arrays, the transformation matrix nine (row major).
+    */
+   enum Component {
+      Position    =  0, ///< Position, three arrays
+      Velocity    =  3, ///< Velocity, three arrays
+      QuatScalar  =  6, ///< Quaternion scalar part
+      QuatVector  =  7, ///< Quaternion vector part, three arrays
+      Transform   = 10, ///< Transformation matrix, nine arrays
+      AngVel      = 19, ///< Angular velocity, three arrays
+      AngVelMag   = 22, ///< Angular velocity magnitude
+      AngVelUnit  = 23, ///< Angular velocity unit vector, three arrays
+      NumComponents = 26 ///< Number of component arrays
+   };
+
+
+ // Member functions
+ public:
+
+   // Default constructor
+   RefFrameStateBatch ();
+
+   // Non-default constructor
+   explicit RefFrameStateBatch (unsigned int num_states);
+
+   // Destructor
+   ~RefFrameStateBatch ();
+
+   // resize: Change the number of states in the batch.
+   void resize (unsigned int num_states);
+
+   /**
+    * Get the number of states in the batch.
+    * @return Number of states
+    */
+   unsigned int size () const
+   {
+      return num_states;
+   }
+
+   /**
+    * Access a component array.
+    * @return Component array, num_states long
+    * \param[in] comp Component (plus offset for vector elements)
+    */
+   double * component (unsigned int comp)
+   {
+      return data.data() + comp * num_states;
+   }
+
+   /**
+    * Access a component array.
+    * @return Component array, num_states long
+    * \param[in] comp Component (plus offset for vector elements)
+    */
+   const double * component (unsigned int comp) const
+   {
+      return data.data() + comp * num_states;
+   }
+
+   // set_state: Store a state in the batch.
+   void set_state (unsigned int index, const RefFrameState & state);
+
+   // get_state: Retrieve a state from the batch.
+   void get_state (unsigned int index, RefFrameState & state) const;
+
+   // incr_left: 'Add' another frame, left operand, to each state
+   void incr_left (
+      const RefFrameState & s_ab,
+      RefFrameItems::Items items = RefFrameItems::Pos_Vel_Att_Rate);
+
+   // incr_right: 'Add' another frame, right operand, to each state
+   void incr_right (
+      const RefFrameState & s_bc,
+      RefFrameItems::Items items = RefFrameItems::Pos_Vel_Att_Rate);
+
+   // compose_fixed: Set each state to a fixed offset 'added' to a frame
+   void compose_fixed (
+      const RefFrameStateBatch & offsets,
+      const RefFrameState & s_ab,
+      RefFrameItems::Items items = RefFrameItems::Pos_Vel_Att_Rate);
+
+   // decr_left: 'Subtract' another frame, left operand, from each state
+   void decr_left (
+      const RefFrameState & s_ab,
+      RefFrameItems::Items items = RefFrameItems::Pos_Vel_Att_Rate);
+
+   // decr_right: 'Subtract' another frame, right operand, from each state
+   void decr_right (
+      const RefFrameState & s_bc,
+      RefFrameItems::Items items = RefFrameItems::Pos_Vel_Att_Rate);
+
+
+
+ // Member data
+ private:
+
+   /**
+    * Number of states in the batch.
+    */
+   unsigned int num_states; //!< trick_units(--)
+
+   /**
+    * Component arrays, NumComponents * num_states long.
+    */
+   std::vector<double> data; //!< trick_io(**)
+
+
+   // The copy constructor and assignment operator for this class are
+   // declared private and are not implemented.
+
+   /**
+    * Not implemented.
+    */
+   RefFrameStateBatch (const RefFrameStateBatch &);
+
+   /**
+    * Not implemented.
+    */
+   RefFrameStateBatch & operator= (const RefFrameStateBatch &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
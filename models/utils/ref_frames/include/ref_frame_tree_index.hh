@@ -0,0 +1,252 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup RefFrames
+ * @{
+ *
+ * @file models/utils/ref_frames/include/ref_frame_tree_index.hh
+ * Define the class RefFrameTreeIndex, a flattened copy of the structure of a
+ * reference frame tree that answers common ancestor queries.
+ */
+
+/********************************* TRICK HEADER ********************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/ref_frame_tree_index.cc))
+
+ 
+*******************************************************************************/
+
+
+#ifndef JEOD_REF_FRAME_TREE_INDEX_HH
+#define JEOD_REF_FRAME_TREE_INDEX_HH
+
+// System includes
+#include <unordered_map>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A flattened, contiguous copy of the structure of a reference frame tree.
+ *
+ * The frames are numbered in depth-first preorder, so that every subtree
+ * occupies a contiguous range of indices. The parent index and depth of each
+ * frame are stored in plain arrays; an ancestor walk is a walk through those
+ * arrays rather than a chase through the frames themselves.
+ *
+ * Large trees additionally get a sparse table of range-minimum depths over
+ * the preorder numbering. This is the Euler tour reduction of the lowest
+ * common ancestor problem applied to the preorder sequence: for frames a and
+ * b with preorder indices i < j, the shallowest frame in (i, j] is a child of
+ * their last common node. A query then costs two table lookups regardless
+ * of the depth of the tree.
+ *
+ * The index is a snapshot. It records the reference frame tree revision at
+ * which it was built and refuses to answer queries once the tree has changed;
+ * callers then fall back to the RefFrame methods.
+ */
+class RefFrameTreeIndex {
+
+   JEOD_MAKE_SIM_INTERFACES(RefFrameTreeIndex)
+
+ // Member data
+ public:
+
+   /**
+    * Minimum number of frames for which the range-minimum table is built.
+    * Smaller trees are queried by walking the parent array.
+    */
+   unsigned int rmq_min_frames; //!< trick_units(count)
+
+
+ // Member functions
+ public:
+
+   // Default constructor
+   RefFrameTreeIndex ();
+
+   // Destructor
+   ~RefFrameTreeIndex ();
+
+   // build: Flatten the tree rooted at the given frame.
+   void build (const RefFrame & root);
+
+   // clear: Discard the index.
+   void clear (void);
+
+   // is_current: Does the index reflect the current tree structure?
+   bool is_current (void) const;
+
+   /**
+    * Get the number of frames in the index.
+    * @return Number of indexed frames
+    */
+   unsigned int size (void) const
+   {
+      return frames.size();
+   }
+
+   // find_frame_index: Find the preorder index of a frame.
+   int find_frame_index (const RefFrame & frame) const;
+
+   /**
+    * Get an indexed frame.
+    * @return Frame with the given preorder index
+    * \param[in] index Preorder index, less than size()
+    */
+   const RefFrame * get_frame (unsigned int index) const
+   {
+      return frames[index];
+   }
+
+   /**
+    * Get the preorder index of an indexed frame's parent.
+    * @return Parent's preorder index, -1 for the root
+    * \param[in] index Preorder index, less than size()
+    */
+   int get_parent_index (unsigned int index) const
+   {
+      return parents[index];
+   }
+
+   /**
+    * Get the depth of an indexed frame (root=0).
+    * The depth is the frame's path index as used by RefFrame.
+    * @return Depth of the frame
+    * \param[in] index Preorder index, less than size()
+    */
+   unsigned int get_depth (unsigned int index) const
+   {
+      return depths[index];
+   }
+
+   // find_common_ancestor: Find the last common node of two indexed frames.
+   unsigned int find_common_ancestor (
+      unsigned int index_a, unsigned int index_b) const;
+
+   // find_last_common_index: Find the depth of the last common node.
+   int find_last_common_index (
+      const RefFrame & frame_a, const RefFrame & frame_b) const;
+
+   // find_last_common_node: Find the last common node of two frames.
+   const RefFrame * find_last_common_node (
+      const RefFrame & frame_a, const RefFrame & frame_b) const;
+
+
+ private:
+
+   // walk_to_common_ancestor: Find the last common node via the parent array.
+   unsigned int walk_to_common_ancestor (
+      unsigned int index_a, unsigned int index_b) const;
+
+   // build_rmq_table: Build the range-minimum table.
+   void build_rmq_table (void);
+
+
+ // Member data
+ private:
+
+   /**
+    * Reference frame tree revision at which the index was built;
+    * zero if the index is empty.
+    */
+   unsigned long built_revision; //!< trick_io(**)
+
+   /**
+    * Indexed frames, in preorder.
+    */
+   std::vector<const RefFrame *> frames; //!< trick_io(**)
+
+   /**
+    * Preorder index of each frame's parent, -1 for the root.
+    */
+   std::vector<int> parents; //!< trick_io(**)
+
+   /**
+    * Depth of each frame.
+    */
+   std::vector<unsigned int> depths; //!< trick_io(**)
+
+   /**
+    * Map from frame to preorder index.
+    */
+   std::unordered_map<const RefFrame *, unsigned int>
+      frame_map; //!< trick_io(**)
+
+   /**
+    * Range-minimum table. Row k, which starts at element k*size(), holds for
+    * each index i the index of the shallowest frame in [i, i + 2^k).
+    * Empty if the tree is smaller than rmq_min_frames.
+    */
+   std::vector<unsigned int> rmq_table; //!< trick_io(**)
+
+   /**
+    * Number of rows in the range-minimum table.
+    */
+   unsigned int rmq_levels; //!< trick_io(**)
+
+
+   // The copy constructor and assignment operator are deleted.
+   RefFrameTreeIndex (const RefFrameTreeIndex &) = delete;
+   RefFrameTreeIndex & operator= (const RefFrameTreeIndex &) = delete;
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -22,7 +22,8 @@
      (ref_frame_messages.cc)
      (ref_frame_set_name.cc)
      (ref_frame_state.cc)
-     (subscription.cc))
+     (subscription.cc)
+     (utils/memory/src/state_snapshot.cc))
 
    
 *******************************************************************************/
@@ -33,6 +34,7 @@
 
 // JEOD includes
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/state_snapshot.hh"
 
 // Model includes
 #include "../include/ref_frame.hh"
@@ -67,6 +69,7 @@ RefFrame::~RefFrame ()
    while (links.has_children()) {
       links.child_tail()->detach();
    }
+   invalidate_relative_state_caches ();
 
    // Sever the links from the parent and sibling nodes as well.
    remove_from_parent ();
@@ -109,6 +112,7 @@ RefFrame::transplant_node (
 
    // Transplant the node.
    links.reattach (new_parent.links);
+   invalidate_relative_state_caches ();
 
    // Reset the state.
    state = new_state;
@@ -124,6 +128,20 @@ RefFrame::reset_parent (
    RefFrame & new_parent)
 {
    links.reattach (new_parent.links);
+   invalidate_relative_state_caches ();
+}
+
+
+/**
+ * Register the frame's state and update time with a state snapshot.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+RefFrame::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   snapshot.add_item (state);
+   snapshot.add_item (update_time);
 }
 
 } // End JEOD namespace
@@ -18,6 +18,7 @@
     ((ref_frame_compute_relative_state.cc)
      (ref_frame_messages.cc)
      (ref_frame_state.cc)
+     (ref_frame_tree_index.cc)
      (utils/message/src/message_handler.cc))
 
    
@@ -25,7 +26,9 @@
 
 
 // System includes
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 
 // JEOD includes
 #include "utils/math/include/vector3.hh"
@@ -36,6 +39,8 @@
 #include "../include/ref_frame.hh"
 #include "../include/ref_frame_messages.hh"
 #include "../include/ref_frame_state.hh"
+#include "../include/ref_frame_state_source.hh"
+#include "../include/ref_frame_tree_index.hh"
 #include "../include/tree_links_iterator.hh"
 
 
@@ -43,6 +48,280 @@
 //! Namespace jeod
 namespace jeod {
 
+namespace {
+
+/**
+ * A cached relative state query: the point of departure between a pair of
+ * frames and, when memoization is enabled, the composed relative state.
+ */
+struct RelativeStateCacheEntry {
+
+   /**
+    * The frame whose state was requested; null for an empty entry.
+    */
+   const RefFrame * subject;
+
+   /**
+    * The frame with respect to which the state was requested.
+    */
+   const RefFrame * wrt_frame;
+
+   /**
+    * Tree revision at which the entry was made.
+    */
+   unsigned long tree_revision;
+
+   /**
+    * State revision at which rel_state was computed.
+    */
+   unsigned long state_revision;
+
+   /**
+    * Index of the last common node, or -1 if not yet found.
+    */
+   int common_node_index;
+
+   /**
+    * Does rel_state contain a memoized relative state?
+    */
+   bool have_state;
+
+   /**
+    * Memoized state of the subject with respect to the wrt_frame.
+    */
+   RefFrameState rel_state;
+
+   RelativeStateCacheEntry ()
+   :
+      subject(nullptr),
+      wrt_frame(nullptr),
+      tree_revision(0),
+      state_revision(0),
+      common_node_index(-1),
+      have_state(false),
+      rel_state()
+   { }
+};
+
+
+/**
+ * Number of entries in each thread's direct-mapped cache.
+ */
+const unsigned int cache_size = 64;
+
+/**
+ * Incremented whenever the structure of any reference frame tree changes.
+ */
+std::atomic<unsigned long> tree_revision(1);
+
+/**
+ * Incremented whenever any reference frame's state is timestamped.
+ */
+std::atomic<unsigned long> state_revision(1);
+
+/**
+ * Are composed relative states memoized?
+ */
+std::atomic<bool> memo_enabled(false);
+
+/**
+ * The source whose frame state update has been deferred, if any.
+ */
+std::atomic<RefFrameStateSource *> deferred_source(nullptr);
+
+/**
+ * Flattened tree index consulted on a cache miss, if any.
+ */
+std::atomic<const RefFrameTreeIndex *> active_tree_index(nullptr);
+
+/**
+ * The cache. Each thread has its own so that derivative jobs running in
+ * parallel can query frames without synchronization.
+ */
+thread_local RelativeStateCacheEntry relative_state_cache[cache_size];
+
+
+/**
+ * Find the cache entry for a frame pair, clearing it if it holds a
+ * different pair or was made for an older tree.
+ * @return Cache entry for the pair
+ * \param[in] subject   Frame whose state is requested
+ * \param[in] wrt_frame Frame with respect to which the state is requested
+ */
+RelativeStateCacheEntry &
+find_cache_entry (
+   const RefFrame & subject,
+   const RefFrame & wrt_frame)
+{
+   std::uintptr_t key =
+      (reinterpret_cast<std::uintptr_t> (&subject) >> 3) ^
+      (reinterpret_cast<std::uintptr_t> (&wrt_frame) >> 5);
+   RelativeStateCacheEntry & entry =
+      relative_state_cache[(key ^ (key >> 7)) % cache_size];
+   unsigned long current_revision =
+      tree_revision.load (std::memory_order_relaxed);
+
+   if ((entry.subject != &subject) ||
+       (entry.wrt_frame != &wrt_frame) ||
+       (entry.tree_revision != current_revision)) {
+      entry.subject = &subject;
+      entry.wrt_frame = &wrt_frame;
+      entry.tree_revision = current_revision;
+      entry.common_node_index = -1;
+      entry.have_state = false;
+   }
+
+   return entry;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Discard all cached frame-pair paths and relative states.
+ * The RefFrame tree editing methods and RefFrameManager::reset_tree_root_node
+ * call this; models that otherwise restructure a tree must call it as well.
+ */
+void
+RefFrame::invalidate_relative_state_caches (
+   void)
+{
+   tree_revision.fetch_add (1, std::memory_order_relaxed);
+}
+
+
+/**
+ * Get the reference frame tree revision counter.
+ * @return Counter that changes whenever the structure of any tree changes
+ */
+unsigned long
+RefFrame::get_tree_revision (
+   void)
+{
+   return tree_revision.load (std::memory_order_relaxed);
+}
+
+
+/**
+ * Specify a flattened tree index to be consulted when locating the common
+ * node of a pair of frames. The index is used only while it is current and
+ * contains both frames; otherwise the frames' paths are compared as usual.
+ * The index must not be rebuilt while relative states are being computed
+ * in other threads.
+ * \param[in] index Tree index, null to stop using one
+ */
+void
+RefFrame::set_tree_index (
+   const RefFrameTreeIndex * index)
+{
+   active_tree_index.store (index, std::memory_order_release);
+}
+
+
+/**
+ * Get the tree index specified by set_tree_index.
+ * @return Tree index, possibly null
+ */
+const RefFrameTreeIndex *
+RefFrame::get_tree_index (
+   void)
+{
+   return active_tree_index.load (std::memory_order_acquire);
+}
+
+
+/**
+ * Enable or disable memoization of relative states.
+ * A memoized state is reused until some frame is timestamped (set_timestamp)
+ * or the tree changes. Memoization is off by default. It is valid only if
+ * every model that changes a frame's state also sets that frame's timestamp.
+ * \param[in] enable True to enable memoization
+ */
+void
+RefFrame::set_relative_state_memo (
+   bool enable)
+{
+   memo_enabled.store (enable, std::memory_order_relaxed);
+   note_state_update ();
+}
+
+
+/**
+ * Is relative state memoization enabled?
+ * @return True if memoization is enabled
+ */
+bool
+RefFrame::get_relative_state_memo (
+   void)
+{
+   return memo_enabled.load (std::memory_order_relaxed);
+}
+
+
+/**
+ * Register a source whose frame states are to be brought up to date on the
+ * next relative state query. A different source that is already deferred is
+ * refreshed immediately, as only one deferred source is tracked.
+ *
+ * \par Assumptions and Limitations
+ *  - Only the RefFrame relative state methods trigger the refresh. Models
+ *    that read a frame's state data member directly must first call
+ *    refresh_deferred_states.
+ * \param[in,out] source Source that has deferred an update
+ */
+void
+RefFrame::defer_state_refresh (
+   RefFrameStateSource & source)
+{
+   RefFrameStateSource * previous = deferred_source.exchange (&source);
+   if ((previous != nullptr) && (previous != &source)) {
+      previous->refresh_frame_states ();
+   }
+}
+
+
+/**
+ * Withdraw the deferred refresh request made by a source.
+ * \param[in] source Source that no longer needs a refresh
+ */
+void
+RefFrame::cancel_state_refresh (
+   RefFrameStateSource & source)
+{
+   RefFrameStateSource * expected = &source;
+   deferred_source.compare_exchange_strong (expected, nullptr);
+}
+
+
+/**
+ * Ask the deferred source, if any, to bring its frame states up to date.
+ * The request is cleared before the source is invoked, so a source may
+ * query relative states while refreshing.
+ */
+void
+RefFrame::refresh_deferred_states (
+   void)
+{
+   if (deferred_source.load (std::memory_order_relaxed) != nullptr) {
+      RefFrameStateSource * source = deferred_source.exchange (nullptr);
+      if (source != nullptr) {
+         source->refresh_frame_states ();
+      }
+   }
+}
+
+
+/**
+ * Invalidate memoized relative states after a frame state update.
+ */
+void
+RefFrame::note_state_update (
+   void)
+{
+   state_revision.fetch_add (1, std::memory_order_relaxed);
+}
+
+
 /**
  * Compute the complete state of the invoking reference frame (*this)
  * with respect to the supplied wrt_frame reference frame.
@@ -68,6 +347,9 @@ const
    int common_node_index;              /* Index of last node in common between
                                           this frame and the wrt_frame */
    const RefFrame * common_node_frame; /* Last common frame */
+
+   // Bring deferred frame states up to date before any cache lookup.
+   refresh_deferred_states ();
 /*
    printf("%s - position: %f %f %f\n",
       this->get_name(),
@@ -82,7 +364,19 @@ const
 printf("compute_relative_state\n\n");
 */
    // Find the index of the node below which the path to the two frames diverge.
-   common_node_index = find_last_common_index (wrt_frame);
+   RelativeStateCacheEntry & entry = find_cache_entry (*this, wrt_frame);
+   if (entry.common_node_index < 0) {
+      const RefFrameTreeIndex * tree_index =
+         active_tree_index.load (std::memory_order_acquire);
+      if (tree_index != nullptr) {
+         entry.common_node_index =
+            tree_index->find_last_common_index (*this, wrt_frame);
+      }
+      if (entry.common_node_index < 0) {
+         entry.common_node_index = find_last_common_index (wrt_frame);
+      }
+   }
+   common_node_index = entry.common_node_index;
 
    // A negative number indicates a *serious* problem.
    if (common_node_index < 0) {
@@ -95,6 +389,17 @@ printf("compute_relative_state\n\n");
       return;
    }
 
+   // Reuse the memoized state if no frame has been updated since it was made.
+   bool use_memo = memo_enabled.load (std::memory_order_relaxed);
+   unsigned long current_state_revision =
+      state_revision.load (std::memory_order_relaxed);
+   if (use_memo &&
+       entry.have_state &&
+       (entry.state_revision == current_state_revision)) {
+      rel_state.copy (entry.rel_state);
+      return;
+   }
+
    // Get the frame corresponding to the common node.
    common_node_frame = links.nth_from_root (common_node_index);
 
@@ -133,6 +438,13 @@ printf("compute_relative_state\n\n");
          rel_state.decr_left (link->container().state);
       }
    }
+
+   // Memoize the result.
+   if (use_memo) {
+      entry.rel_state.copy (rel_state);
+      entry.state_revision = current_state_revision;
+      entry.have_state = true;
+   }
 }
 
 
@@ -239,6 +551,8 @@ RefFrame::compute_state_wrt_pred (
    RefFrameState & rel_state)
 const
 {
+   refresh_deferred_states ();
+
    // Initialize the relative state as that of the state of the invoking frame
    // wrt its immediate parent.
    rel_state.copy (state);
@@ -315,6 +629,8 @@ RefFrame::compute_pred_rel_state (
    RefFrameState & rel_state)
 const
 {
+   refresh_deferred_states ();
+
    // Initialize the relative state as the negative of state of the invoking
    // frame wrt its immediate parent.
    rel_state.negate (state);
@@ -361,8 +677,23 @@ const
    const RefFrame * link_frame;        /* Frame in path to node */
 
 
+   // Bring deferred frame states up to date before any cache lookup.
+   refresh_deferred_states ();
+
    // Find the index of the node below which the path to the two frames diverge.
-   common_node_index = find_last_common_index (in_frame);
+   RelativeStateCacheEntry & entry = find_cache_entry (*this, in_frame);
+   if (entry.common_node_index < 0) {
+      const RefFrameTreeIndex * tree_index =
+         active_tree_index.load (std::memory_order_acquire);
+      if (tree_index != nullptr) {
+         entry.common_node_index =
+            tree_index->find_last_common_index (*this, in_frame);
+      }
+      if (entry.common_node_index < 0) {
+         entry.common_node_index = find_last_common_index (in_frame);
+      }
+   }
+   common_node_index = entry.common_node_index;
 
    // A negative number indicates a *serious* problem.
    if (common_node_index < 0) {
@@ -376,6 +707,15 @@ const
    }
 
 
+   // A memoized relative state already contains the position.
+   if (memo_enabled.load (std::memory_order_relaxed) &&
+       entry.have_state &&
+       (entry.state_revision ==
+        state_revision.load (std::memory_order_relaxed))) {
+      Vector3::copy (entry.rel_state.trans.position, rel_pos);
+      return;
+   }
+
    Vector3::initialize (rel_pos);
 
    // First we step the current position back to the common node
@@ -16,7 +16,10 @@ Purpose:
 
 Library dependencies:
   ((ref_frame_manager.cc)
-   (ref_frame.cc))
+   (ref_frame.cc)
+   (ref_frame_tree_index.cc)
+   (utils/named_item/src/name_table.cc)
+   (utils/sim_interface/src/jeod_profiler.cc))
 
  
 ******************************************************************************/
@@ -24,11 +27,13 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <cstring>
 #include <algorithm> // std::find
 
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 
 // Model includes
 #include "../include/ref_frame.hh"
@@ -47,7 +52,11 @@ RefFrameManager::RefFrameManager (
 :
    BaseRefFrameManager (),
    root_node (nullptr),
-   ref_frames ()
+   ref_frames (),
+   ref_frame_index (),
+   ref_frame_index_valid (false),
+   tree_index (),
+   tree_index_enabled (false)
 {
    JEOD_REGISTER_CLASS (RefFrameManager);
    JEOD_REGISTER_CLASS (RefFrame);
@@ -62,6 +71,10 @@ RefFrameManager::~RefFrameManager (
    void)
 {
    JEOD_DEREGISTER_CHECKPOINTABLE (this, ref_frames);
+
+   if (RefFrame::get_tree_index() == &tree_index) {
+      RefFrame::set_tree_index (nullptr);
+   }
 }
 
 
@@ -88,20 +101,17 @@ RefFrameManager::add_ref_frame (
 
 
    // 2. The frame must not have been previously registered.
-   for (std::vector<RefFrame *>::const_iterator it = ref_frames.begin();
-        it != ref_frames.end();
-        ++it) {
-      if (*it == &ref_frame) {
-         MessageHandler::error (
-            __FILE__, __LINE__, RefFrameMessages::duplicate_entry,
-            "Reference frame '%s' was previously registered.",
-            ref_frame.get_name());
-         return;
-      }
+   RefFrame * found_frame = find_ref_frame (ref_frame.get_name());
+   if (found_frame == &ref_frame) {
+      MessageHandler::error (
+         __FILE__, __LINE__, RefFrameMessages::duplicate_entry,
+         "Reference frame '%s' was previously registered.",
+         ref_frame.get_name());
+      return;
    }
 
    // 3. The frame must have a unique name.
-   if (find_ref_frame (ref_frame.get_name()) != nullptr) {
+   if (found_frame != nullptr) {
       MessageHandler::error (
          __FILE__, __LINE__, RefFrameMessages::duplicate_entry,
          "Reference frame with name '%s' was previously registered.",
@@ -109,8 +119,14 @@ RefFrameManager::add_ref_frame (
       return;
    }
 
-   // Add the reference frame to the reference frame table.
+   // Add the reference frame to the reference frame table and the index.
+   // The name is interned even if the index is not valid so that
+   // find_indexed_ref_frame can look it up.
+   NameHandle handle = NameTable::intern (ref_frame.get_name());
    ref_frames.push_back (&ref_frame);
+   if (ref_frame_index_valid) {
+      ref_frame_index.add (handle, ref_frames.size() - 1);
+   }
 }
 
 
@@ -134,6 +150,9 @@ RefFrameManager::remove_ref_frame (
    }
 
    ref_frames.erase (it);
+
+   // Removal shifts the positions of the subsequent frames.
+   ref_frame_index_valid = false;
 }
 
 
@@ -147,21 +166,7 @@ RefFrameManager::find_ref_frame (
    const char * name)
 const
 {
-   RefFrame * found_frame = nullptr;
-
-   // Search the reference frame list until a match is found.
-   for (std::vector<RefFrame *>::const_iterator it = ref_frames.begin();
-        it != ref_frames.end();
-        ++it) {
-      RefFrame * ref_frame = *it;
-      if (std::strcmp (name, ref_frame->get_name()) == 0) {
-         found_frame = ref_frame;
-         break;
-      }
-   }
-
-   // Return the found frame (if any).
-   return found_frame;
+   return find_indexed_ref_frame (name);
 }
 
 
@@ -177,25 +182,97 @@ RefFrameManager::find_ref_frame (
    const char * suffix)
 const
 {
-   std::string pname(prefix);
-   RefFrame * found_frame = nullptr;
+   std::string full_name(prefix);
+   full_name += '.';
+   full_name += suffix;
 
-   // Search the reference frame list until a match is found.
-   for (std::vector<RefFrame *>::const_iterator it = ref_frames.begin();
-        it != ref_frames.end();
-        ++it) {
-      RefFrame * ref_frame = *it;
-      const char * ref_frame_name = ref_frame->get_name();
-      if ((std::strncmp (ref_frame_name, prefix, pname.length()) == 0) &&
-          (ref_frame_name[pname.length()] == '.') &&
-          (std::strcmp (&(ref_frame_name[pname.length()+1]), suffix) == 0)) {
-         found_frame = ref_frame;
-         break;
+   return find_indexed_ref_frame (full_name);
+}
+
+
+/**
+ * Find the reference frame with the given name using the name index.
+ * \par Assumptions and Limitations
+ *  - Frames are not renamed after they have been registered.
+ * @param name  Reference frame name
+ * @return Found reference frame, or NULL if not found
+ */
+RefFrame *
+RefFrameManager::find_indexed_ref_frame (
+   const std::string & name)
+const
+{
+   // A name that has never been interned cannot be a registered frame's
+   // name unless the index is stale, e.g., when ref_frames was restored
+   // from a checkpoint. Rebuilding the index interns the frames' names.
+   NameHandle handle = NameTable::find (name);
+   if ((! handle.is_valid()) &&
+       ((! ref_frame_index_valid) ||
+        (ref_frame_index.size() != ref_frames.size()))) {
+      rebuild_ref_frame_index ();
+      handle = NameTable::find (name);
+   }
+
+   return handle.is_valid() ? find_ref_frame (handle) : nullptr;
+}
+
+
+/**
+ * Find the reference frame with the given interned name.
+ * \par Assumptions and Limitations
+ *  - Frames are not renamed after they have been registered.
+ * @param handle  Handle of the reference frame name
+ * @return Found reference frame, or NULL if not found
+ */
+RefFrame *
+RefFrameManager::find_ref_frame (
+   NameHandle handle)
+const
+{
+   // The index is stale if frames were added or removed behind its back,
+   // e.g., when ref_frames was restored from a checkpoint.
+   if ((! ref_frame_index_valid) ||
+       (ref_frame_index.size() != ref_frames.size())) {
+      rebuild_ref_frame_index ();
+   }
+
+   unsigned int found = ref_frame_index.find (handle);
+   if (found == NameIndex::npos) {
+      return nullptr;
+   }
+
+   // Guard against a stale index by verifying the hit.
+   if ((found >= ref_frames.size()) ||
+       (std::strcmp (NameTable::get_name (handle),
+                     ref_frames[found]->get_name()) != 0)) {
+      rebuild_ref_frame_index ();
+      found = ref_frame_index.find (handle);
+      if (found == NameIndex::npos) {
+         return nullptr;
       }
    }
 
-   // Return the found frame (if any).
-   return found_frame;
+   return ref_frames[found];
+}
+
+
+/**
+ * Rebuild the name index from the list of reference frames.
+ */
+void
+RefFrameManager::rebuild_ref_frame_index (
+   void)
+const
+{
+   ref_frame_index.clear ();
+
+   // Names are unique, but keep the first entry in case they are not,
+   // which is what a linear search would find.
+   for (unsigned int ii = 0; ii < ref_frames.size(); ++ii) {
+      ref_frame_index.add (NameTable::intern (ref_frames[ii]->get_name()), ii);
+   }
+
+   ref_frame_index_valid = true;
 }
 
 
@@ -230,11 +307,17 @@ RefFrameManager::reset_tree_root_node (
    void)
 {
    root_node = nullptr;
+
+   // Paths cached for the old tree are no longer valid.
+   RefFrame::invalidate_relative_state_caches ();
 }
 
 
 /**
  * Insert a reference frame in the reference frame tree.
+ * A frame that is already attached to the specified parent (or that already
+ * is the root, for a null parent) is left in place; a frame attached
+ * elsewhere is moved, along with its subtree.
  * @param ref_frame  Reference frame to be added to the ref frame tree.
  * @param parent     Parent frame
 */
@@ -247,17 +330,90 @@ RefFrameManager::add_frame_to_tree (
    // FIXME: Check for errors!
    // Handle errors.
 
+   // Nothing to do if the frame is already in place.
+   if ((ref_frame.get_parent() == parent) &&
+       ((parent != nullptr) || (root_node == &ref_frame))) {
+      return;
+   }
+
    /* Insert the node in the tree. */
    if (parent == nullptr) {
+      if (ref_frame.get_parent() != nullptr) {
+         ref_frame.remove_from_parent ();
+      }
       root_node = &ref_frame;
       root_node->make_root ();
    }
+   else if (ref_frame.get_parent() != nullptr) {
+      ref_frame.reset_parent (*parent);
+   }
    else {
       parent->add_child (ref_frame);
    }
 }
 
 
+/**
+ * Enable or disable the flattened reference frame tree index.
+ * An enabled index is consulted by the RefFrame relative state methods
+ * whenever it is current. It is rebuilt by update_tree_index, which the
+ * ephemerides and dynamics managers call after building the tree and at the
+ * start of each ephemeris update.
+ * @param enable  True to enable the index
+ */
+void
+RefFrameManager::set_tree_index_enabled (
+   bool enable)
+{
+   tree_index_enabled = enable;
+
+   if (enable) {
+      update_tree_index ();
+      RefFrame::set_tree_index (&tree_index);
+   }
+   else {
+      if (RefFrame::get_tree_index() == &tree_index) {
+         RefFrame::set_tree_index (nullptr);
+      }
+      tree_index.clear ();
+   }
+}
+
+
+/**
+ * Rebuild the flattened tree index if it is enabled and out of date.
+ * This must not be called while relative states are being computed in
+ * other threads.
+ */
+void
+RefFrameManager::update_tree_index (
+   void)
+{
+   JEOD_PROFILE_SCOPE ("ref_frames", "RefFrameManager::update_tree_index");
+
+   if (tree_index_enabled && (root_node != nullptr) &&
+       (! tree_index.is_current())) {
+      tree_index.build (*root_node);
+   }
+}
+
+
+/**
+ * Register the state and update time of each reference frame with a state
+ * snapshot. The tree structure is not registered: frames that are added,
+ * removed, or reparented require the snapshot to be rebuilt.
+ * \param[in,out] snapshot The snapshot
+ */
+void
+RefFrameManager::add_snapshot_regions (
+   StateSnapshot & snapshot)
+{
+   for (RefFrame * frame : ref_frames) {
+      frame->add_snapshot_regions (snapshot);
+   }
+}
+
+
 /*******************************************************************************
 Frame subscription methods
 *******************************************************************************/
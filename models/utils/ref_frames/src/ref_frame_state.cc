@@ -28,6 +28,7 @@
 #include <cmath>
 
 // JEOD includes
+#include "utils/math/include/fixed_vector.hh"
 #include "utils/math/include/vector3.hh"
 #include "utils/math/include/matrix3x3.hh"
 #include "utils/math/include/numerical.hh"
@@ -271,14 +272,18 @@ RefFrameState::incr_left (
    //   v_A:C      v, x              None               3
 
 
+   bool ab_rotating = (std::fpclassify(s_ab.rot.ang_vel_mag) != FP_ZERO);
+   Vec3Ref position (trans.position);
+   Vec3Ref velocity (trans.velocity);
+
    // Compute the angular velocity of frame C wrt frame A in frame C:
    //   w_A:C = T_B:C * w_A:B + w_B:C
    // Shortcut: Don't bother if s_ab is not rotating wrt its parent.
-   if (std::fpclassify(s_ab.rot.ang_vel_mag) != FP_ZERO) {
+   if (ab_rotating) {
 
       // Compute as this <- this + T_B:C * w_A:B
-      Vector3::transform_incr (rot.T_parent_this, s_ab.rot.ang_vel_this,
-                               rot.ang_vel_this);
+      Vec3Ref (rot.ang_vel_this) +=
+         mat3 (rot.T_parent_this) * vec3 (s_ab.rot.ang_vel_this);
 
       // Compute the angular velocity magnitude and unit vector.
       rot.compute_ang_vel_products ();
@@ -298,34 +303,35 @@ RefFrameState::incr_left (
       // Compute the corresponding transformation matrix.
       rot.compute_transformation ();
 
-      // Compute v_B->C:A = T_A:B^T * (v_B:C + w_a:B X x_B:C)
-      // Note: This must be performed prior to computing the position
-      // because it uses x_B:C = trans.position.
-      if (std::fpclassify(s_ab.rot.ang_vel_mag) != FP_ZERO) {
-         Vector3::cross_incr (s_ab.rot.ang_vel_this, trans.position,
-                              trans.velocity);
+      // Compute v_A:C, and then x_A:C; the velocity uses x_B:C.
+      // Each is a single expression evaluated in registers.
+      Mat3Transpose<Mat3View> T_ab_trans =
+         transpose (mat3 (s_ab.rot.T_parent_this));
+      if (ab_rotating) {
+         velocity =
+            vec3 (s_ab.trans.velocity) +
+            T_ab_trans * (velocity +
+                          cross (vec3 (s_ab.rot.ang_vel_this), position));
       }
-
-      // Transform x_B:C to frame A.
-      Vector3::transform_transpose (s_ab.rot.T_parent_this,
-                                    trans.position);
-
-      Vector3::transform_transpose (s_ab.rot.T_parent_this,
-                                    trans.velocity);
+      else {
+         velocity = vec3 (s_ab.trans.velocity) + T_ab_trans * velocity;
+      }
+      position = vec3 (s_ab.trans.position) + T_ab_trans * position;
    }
 
    // T_A:B is identity. The only quantity needed is w_A:B X x_B:C.
    else {
-      if (std::fpclassify(s_ab.rot.ang_vel_mag) != FP_ZERO) {
-         Vector3::cross_incr (s_ab.rot.ang_vel_this, trans.position,
-                              trans.velocity);
+      if (ab_rotating) {
+         velocity =
+            vec3 (s_ab.trans.velocity) +
+            (velocity + cross (vec3 (s_ab.rot.ang_vel_this), position));
       }
+      else {
+         velocity += vec3 (s_ab.trans.velocity);
+      }
+      position += vec3 (s_ab.trans.position);
    }
 
-   // Add the X_A:B, v_A:B to the state.
-   Vector3::incr (s_ab.trans.velocity, trans.velocity);
-   Vector3::incr (s_ab.trans.position, trans.position);
-
    return;
 }
 
@@ -514,7 +520,9 @@ RefFrameState::decr_right (
    //   v_A:B      v                 T, w               4
 
 
-   double v_bc_in_b_obs_a[3];   // M/s  Vel. of C wrt B in B, observed from A
+   Vec3Ref position (trans.position);
+   Vec3Ref velocity (trans.velocity);
+   Vec3Ref ang_vel (rot.ang_vel_this);
 
 
    // Compute T_A:B, w_A:B, via
@@ -526,39 +534,38 @@ RefFrameState::decr_right (
       rot.Q_parent_this.normalize ();
       rot.compute_transformation ();
 
-      Vector3::decr (s_bc.rot.ang_vel_this, rot.ang_vel_this);
-      Vector3::transform_transpose (s_bc.rot.T_parent_this, rot.ang_vel_this);
+      ang_vel = transpose (mat3 (s_bc.rot.T_parent_this)) *
+                (ang_vel - vec3 (s_bc.rot.ang_vel_this));
       rot.compute_ang_vel_products ();
    }
 
    // Shortcuts for the case T_B:C is identity.
    else if (std::fpclassify(s_bc.rot.ang_vel_mag) != FP_ZERO) {
-      Vector3::decr (s_bc.rot.ang_vel_this, rot.ang_vel_this);
+      ang_vel -= vec3 (s_bc.rot.ang_vel_this);
       rot.compute_ang_vel_products ();
    }
 
 
    // Compute the velocity of frame C wrt frame B observed from frame A
    //   v_B->C:B(A) = v_B:C + w_A:B X x_B:C
-   Vector3::copy (s_bc.trans.velocity, v_bc_in_b_obs_a);
+   Vec3 v_bc_in_b_obs_a (s_bc.trans.velocity); // M/s
    if (std::fpclassify(rot.ang_vel_mag) != FP_ZERO) {
-      Vector3::cross_incr (rot.ang_vel_this, s_bc.trans.position,
-                           v_bc_in_b_obs_a);
+      v_bc_in_b_obs_a += cross (ang_vel, vec3 (s_bc.trans.position));
    }
 
    // Compute x_A:B, V_A:B via
    //   x_A:B = x_A:C - T_A:B^T * x_B:C
    //   v_A:B = v_A:C - T_A:B^T * (v_B:C + w_A:B X x_B:C)
    if (!Numerical::compare_exact(rot.Q_parent_this.scalar,1.0)) {
-      Vector3::transform_transpose_decr (rot.T_parent_this, s_bc.trans.position,
-                                         trans.position);
-      Vector3::transform_transpose_decr (rot.T_parent_this, v_bc_in_b_obs_a,
-                                         trans.velocity);
+      Mat3Transpose<Mat3View> T_ab_trans =
+         transpose (mat3 (rot.T_parent_this));
+      position -= T_ab_trans * vec3 (s_bc.trans.position);
+      velocity -= T_ab_trans * v_bc_in_b_obs_a;
    }
    // Shortcuts for the case T_A:B is identity.
    else {
-      Vector3::decr (s_bc.trans.position, trans.position);
-      Vector3::decr (v_bc_in_b_obs_a, trans.velocity);
+      position -= vec3 (s_bc.trans.position);
+      velocity -= v_bc_in_b_obs_a;
    }
 
    return;
@@ -0,0 +1,956 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup RefFrames
+ * @{
+ *
+ * @file models/utils/ref_frames/src/ref_frame_state_batch.cc
+ * Define methods for the RefFrameStateBatch class.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Library dependencies:
+    ((ref_frame_state_batch.cc)
+     (ref_frame_state.cc)
+     (ref_frame_items.cc))
+
+   
+*******************************************************************************/
+
+
+// System includes
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/numerical.hh"
+#include "utils/math/include/vector3.hh"
+
+// Model includes
+#include "../include/ref_frame_state.hh"
+#include "../include/ref_frame_state_batch.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/*******************************************************************************
+
+  The composition methods use the nomenclature and equations documented in
+  ref_frame_state.cc. The per-state arithmetic below is written out on plain
+  doubles so that each loop body is free of calls; the quaternion helpers
+  reproduce Quaternion::multiply and friends, Quaternion::normalize, and
+  Quaternion::left_quat_to_transformation.
+
+*******************************************************************************/
+
+namespace {
+
+/**
+ * Compute the quaternion product p = a * b.
+ * \param[in]  as Scalar part of a
+ * \param[in]  av Vector part of a
+ * \param[in]  bs Scalar part of b
+ * \param[in]  bv Vector part of b
+ * \param[out] ps Scalar part of p
+ * \param[out] pv Vector part of p
+ */
+inline void
+quat_product (
+   double as, const double av[3],
+   double bs, const double bv[3],
+   double & ps, double pv[3])
+{
+   ps = as * bs - (av[0] * bv[0] + av[1] * bv[1] + av[2] * bv[2]);
+   pv[0] = as * bv[0] + bs * av[0] + (av[1] * bv[2] - av[2] * bv[1]);
+   pv[1] = as * bv[1] + bs * av[1] + (av[2] * bv[0] - av[0] * bv[2]);
+   pv[2] = as * bv[2] + bs * av[2] + (av[0] * bv[1] - av[1] * bv[0]);
+}
+
+
+/**
+ * Normalize a quaternion and make its scalar part non-negative.
+ * \param[in,out] qs Scalar part
+ * \param[in,out] qv Vector part
+ */
+inline void
+normalize_quat (
+   double & qs,
+   double qv[3])
+{
+   double qmagsq = qs * qs + qv[0] * qv[0] + qv[1] * qv[1] + qv[2] * qv[2];
+   double diff1 = 1.0 - qmagsq;
+   double fact;
+
+   // See Quaternion::normalize for the rationale of the approximation.
+   if ((diff1 > -2.107342e-08) && (diff1 < 2.107342e-08)) {
+      fact = 2.0 / (1.0 + qmagsq);
+   } else {
+      fact = 1.0 / std::sqrt (qmagsq);
+   }
+   if (qs < 0.0) {
+      fact = -fact;
+   }
+
+   qs *= fact;
+   qv[0] *= fact;
+   qv[1] *= fact;
+   qv[2] *= fact;
+}
+
+
+/**
+ * Compute the transformation matrix from a left transformation quaternion.
+ * \param[in]  qs Scalar part
+ * \param[in]  qv Vector part
+ * \param[out] T  Transformation matrix
+ */
+inline void
+quat_to_transformation (
+   double qs,
+   const double qv[3],
+   double T[3][3])
+{
+   double cost = 2.0 * qs * qs - 1.0;
+   double qvx2[3] = {qv[0] + qv[0], qv[1] + qv[1], qv[2] + qv[2]};
+   double qsqv2[3] = {qvx2[0] * qs, qvx2[1] * qs, qvx2[2] * qs};
+   double qvqv2[3] = {qv[1] * qvx2[2], qv[2] * qvx2[0], qv[0] * qvx2[1]};
+
+   T[0][0] = cost + qv[0] * qvx2[0];
+   T[1][1] = cost + qv[1] * qvx2[1];
+   T[2][2] = cost + qv[2] * qvx2[2];
+   T[0][1] = qvqv2[2] - qsqv2[2];
+   T[1][0] = qvqv2[2] + qsqv2[2];
+   T[1][2] = qvqv2[0] - qsqv2[0];
+   T[2][1] = qvqv2[0] + qsqv2[0];
+   T[2][0] = qvqv2[1] - qsqv2[1];
+   T[0][2] = qvqv2[1] + qsqv2[1];
+}
+
+
+/**
+ * Compute y = T * x.
+ * \param[in]  T Matrix
+ * \param[in]  x Input vector
+ * \param[out] y Output vector; must not alias x
+ */
+inline void
+transform (
+   const double T[3][3],
+   const double x[3],
+   double y[3])
+{
+   y[0] = T[0][0] * x[0] + T[0][1] * x[1] + T[0][2] * x[2];
+   y[1] = T[1][0] * x[0] + T[1][1] * x[1] + T[1][2] * x[2];
+   y[2] = T[2][0] * x[0] + T[2][1] * x[1] + T[2][2] * x[2];
+}
+
+
+/**
+ * Compute y = T^T * x.
+ * \param[in]  T Matrix
+ * \param[in]  x Input vector
+ * \param[out] y Output vector; must not alias x
+ */
+inline void
+transform_transpose (
+   const double T[3][3],
+   const double x[3],
+   double y[3])
+{
+   y[0] = T[0][0] * x[0] + T[1][0] * x[1] + T[2][0] * x[2];
+   y[1] = T[0][1] * x[0] + T[1][1] * x[1] + T[2][1] * x[2];
+   y[2] = T[0][2] * x[0] + T[1][2] * x[1] + T[2][2] * x[2];
+}
+
+
+/**
+ * Compute c += a X b.
+ * \param[in]     a Left operand
+ * \param[in]     b Right operand
+ * \param[in,out] c Accumulated cross product
+ */
+inline void
+cross_incr (
+   const double a[3],
+   const double b[3],
+   double c[3])
+{
+   c[0] += a[1] * b[2] - a[2] * b[1];
+   c[1] += a[2] * b[0] - a[0] * b[2];
+   c[2] += a[0] * b[1] - a[1] * b[0];
+}
+
+
+/**
+ * Component arrays for one state batch, gathered once per method.
+ */
+struct BatchArrays {
+   double * x[3];    ///< Position
+   double * v[3];    ///< Velocity
+   double * qs;      ///< Quaternion scalar
+   double * qv[3];   ///< Quaternion vector
+   double * t[9];    ///< Transformation matrix
+   double * w[3];    ///< Angular velocity
+   double * wmag;    ///< Angular velocity magnitude
+   double * wunit[3];///< Angular velocity unit vector
+
+   /**
+    * Load the vector of the given component arrays for a state.
+    * \param[in]  arr    Component arrays
+    * \param[in]  ii     State index
+    * \param[out] vec    Vector
+    */
+   static void load (double * const arr[3], unsigned int ii, double vec[3])
+   {
+      vec[0] = arr[0][ii];
+      vec[1] = arr[1][ii];
+      vec[2] = arr[2][ii];
+   }
+
+   /**
+    * Store a vector in the given component arrays for a state.
+    * \param[in]  vec    Vector
+    * \param[in]  ii     State index
+    * \param[out] arr    Component arrays
+    */
+   static void store (const double vec[3], unsigned int ii, double * const arr[3])
+   {
+      arr[0][ii] = vec[0];
+      arr[1][ii] = vec[1];
+      arr[2][ii] = vec[2];
+   }
+
+   /**
+    * Load the transformation matrix for a state.
+    * \param[in]  ii State index
+    * \param[out] T  Matrix
+    */
+   void load_transform (unsigned int ii, double T[3][3]) const
+   {
+      for (unsigned int rr = 0; rr < 3; ++rr) {
+         for (unsigned int cc = 0; cc < 3; ++cc) {
+            T[rr][cc] = t[3*rr+cc][ii];
+         }
+      }
+   }
+
+   /**
+    * Store the quaternion and the corresponding matrix for a state.
+    * \param[in] ii   State index
+    * \param[in] q_s  Quaternion scalar part
+    * \param[in] q_v  Quaternion vector part
+    * \param[in] T    Matrix
+    */
+   void store_rotation (
+      unsigned int ii, double q_s, const double q_v[3], const double T[3][3])
+   {
+      qs[ii] = q_s;
+      store (q_v, ii, qv);
+      for (unsigned int rr = 0; rr < 3; ++rr) {
+         for (unsigned int cc = 0; cc < 3; ++cc) {
+            t[3*rr+cc][ii] = T[rr][cc];
+         }
+      }
+   }
+
+   /**
+    * Store an angular velocity and its magnitude and unit vector for a state.
+    * \param[in] ii    State index
+    * \param[in] omega Angular velocity
+    */
+   void store_rate (unsigned int ii, const double omega[3])
+   {
+      double mag = std::sqrt (
+         omega[0] * omega[0] + omega[1] * omega[1] + omega[2] * omega[2]);
+      store (omega, ii, w);
+      wmag[ii] = mag;
+      if (std::fpclassify(mag) != FP_ZERO) {
+         double inv = 1.0 / mag;
+         wunit[0][ii] = omega[0] * inv;
+         wunit[1][ii] = omega[1] * inv;
+         wunit[2][ii] = omega[2] * inv;
+      }
+      else {
+         wunit[0][ii] = 0.0;
+         wunit[1][ii] = 0.0;
+         wunit[2][ii] = 0.0;
+      }
+   }
+};
+
+
+/**
+ * Gather the component arrays of a batch.
+ * @return Component arrays
+ * \param[in,out] batch State batch
+ */
+BatchArrays
+gather_arrays (
+   RefFrameStateBatch & batch)
+{
+   BatchArrays arr;
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      arr.x[jj] = batch.component (RefFrameStateBatch::Position + jj);
+      arr.v[jj] = batch.component (RefFrameStateBatch::Velocity + jj);
+      arr.qv[jj] = batch.component (RefFrameStateBatch::QuatVector + jj);
+      arr.w[jj] = batch.component (RefFrameStateBatch::AngVel + jj);
+      arr.wunit[jj] = batch.component (RefFrameStateBatch::AngVelUnit + jj);
+   }
+   for (unsigned int jj = 0; jj < 9; ++jj) {
+      arr.t[jj] = batch.component (RefFrameStateBatch::Transform + jj);
+   }
+   arr.qs = batch.component (RefFrameStateBatch::QuatScalar);
+   arr.wmag = batch.component (RefFrameStateBatch::AngVelMag);
+   return arr;
+}
+
+
+/**
+ * Does the item set include the translational state?
+ * @return True if position or velocity is selected
+ * \param[in] items Item set
+ */
+inline bool
+selects_translation (
+   RefFrameItems::Items items)
+{
+   return (items & RefFrameItems::Pos_Vel) != 0;
+}
+
+
+/**
+ * Does the item set include the rotational state?
+ * @return True if attitude or rate is selected
+ * \param[in] items Item set
+ */
+inline bool
+selects_rotation (
+   RefFrameItems::Items items)
+{
+   return (items & RefFrameItems::Att_Rate) != 0;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * RefFrameStateBatch default constructor.
+ */
+RefFrameStateBatch::RefFrameStateBatch (
+   void)
+:
+   num_states(0),
+   data()
+{
+}
+
+
+/**
+ * RefFrameStateBatch non-default constructor.
+ * \param[in] num_states_in Number of states
+ */
+RefFrameStateBatch::RefFrameStateBatch (
+   unsigned int num_states_in)
+:
+   num_states(0),
+   data()
+{
+   resize (num_states_in);
+}
+
+
+/**
+ * RefFrameStateBatch destructor.
+ */
+RefFrameStateBatch::~RefFrameStateBatch (
+   void)
+{
+}
+
+
+/**
+ * Change the number of states in the batch.
+ * All states are reset to a null state (identity transformation, zero
+ * position, velocity, and rate).
+ * \param[in] num_states_in Number of states
+ */
+void
+RefFrameStateBatch::resize (
+   unsigned int num_states_in)
+{
+   num_states = num_states_in;
+   data.assign (NumComponents * num_states, 0.0);
+
+   double * qs = component (QuatScalar);
+   double * t00 = component (Transform);
+   double * t11 = component (Transform+4);
+   double * t22 = component (Transform+8);
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      qs[ii] = 1.0;
+      t00[ii] = 1.0;
+      t11[ii] = 1.0;
+      t22[ii] = 1.0;
+   }
+}
+
+
+/**
+ * Store a state in the batch.
+ * \param[in] index State index
+ * \param[in] state State to be stored
+ */
+void
+RefFrameStateBatch::set_state (
+   unsigned int index,
+   const RefFrameState & state)
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      component(Position+jj)[index] = state.trans.position[jj];
+      component(Velocity+jj)[index] = state.trans.velocity[jj];
+      component(QuatVector+jj)[index] = state.rot.Q_parent_this.vector[jj];
+      component(AngVel+jj)[index] = state.rot.ang_vel_this[jj];
+      component(AngVelUnit+jj)[index] = state.rot.ang_vel_unit[jj];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         component(Transform+3*jj+kk)[index] = state.rot.T_parent_this[jj][kk];
+      }
+   }
+   component(QuatScalar)[index] = state.rot.Q_parent_this.scalar;
+   component(AngVelMag)[index] = state.rot.ang_vel_mag;
+}
+
+
+/**
+ * Retrieve a state from the batch.
+ * \param[in]  index State index
+ * \param[out] state Retrieved state
+ */
+void
+RefFrameStateBatch::get_state (
+   unsigned int index,
+   RefFrameState & state)
+const
+{
+   for (unsigned int jj = 0; jj < 3; ++jj) {
+      state.trans.position[jj] = component(Position+jj)[index];
+      state.trans.velocity[jj] = component(Velocity+jj)[index];
+      state.rot.Q_parent_this.vector[jj] = component(QuatVector+jj)[index];
+      state.rot.ang_vel_this[jj] = component(AngVel+jj)[index];
+      state.rot.ang_vel_unit[jj] = component(AngVelUnit+jj)[index];
+      for (unsigned int kk = 0; kk < 3; ++kk) {
+         state.rot.T_parent_this[jj][kk] = component(Transform+3*jj+kk)[index];
+      }
+   }
+   state.rot.Q_parent_this.scalar = component(QuatScalar)[index];
+   state.rot.ang_vel_mag = component(AngVelMag)[index];
+}
+
+
+/**
+ * Compute S_A:C = S_A:B + S_B:C for each state in the batch,
+ * with each state initially containing S_B:C and
+ * the supplied argument containing S_A:B.
+ * \param[in] s_ab  Left addend
+ * \param[in] items Parts of the states to be updated
+ */
+void
+RefFrameStateBatch::incr_left (
+   const RefFrameState & s_ab,
+   RefFrameItems::Items items)
+{
+   //   T_A:C = T_B:C * T_A:B
+   //   w_A:C = T_B:C * w_A:B + w_B:C
+   //   x_A:C = x_A:B + T_A:B^T * x_B:C
+   //   v_A:C = v_A:B + T_A:B^T * (v_B:C + w_A:B X x_B:C)
+
+   BatchArrays arr = gather_arrays (*this);
+   const RefFrameRot & rot_ab = s_ab.rot;
+   bool rotating = (std::fpclassify(rot_ab.ang_vel_mag) != FP_ZERO);
+   bool transformed =
+      (!Numerical::compare_exact(rot_ab.Q_parent_this.scalar,1.0));
+
+   if (selects_rotation (items)) {
+      for (unsigned int ii = 0; ii < num_states; ++ii) {
+         double T[3][3];
+         arr.load_transform (ii, T);
+
+         // w_A:C uses the original T_B:C.
+         if (rotating) {
+            double omega[3];
+            BatchArrays::load (arr.w, ii, omega);
+            double tw[3];
+            transform (T, rot_ab.ang_vel_this, tw);
+            omega[0] += tw[0];
+            omega[1] += tw[1];
+            omega[2] += tw[2];
+            arr.store_rate (ii, omega);
+         }
+
+         if (transformed) {
+            double q_v[3];
+            double q_s;
+            double in_v[3];
+            BatchArrays::load (arr.qv, ii, in_v);
+            quat_product (arr.qs[ii], in_v,
+                          rot_ab.Q_parent_this.scalar,
+                          rot_ab.Q_parent_this.vector,
+                          q_s, q_v);
+            normalize_quat (q_s, q_v);
+            quat_to_transformation (q_s, q_v, T);
+            arr.store_rotation (ii, q_s, q_v, T);
+         }
+      }
+   }
+
+   if (selects_translation (items)) {
+      for (unsigned int ii = 0; ii < num_states; ++ii) {
+         double pos[3];
+         double vel[3];
+         BatchArrays::load (arr.x, ii, pos);
+         BatchArrays::load (arr.v, ii, vel);
+
+         if (rotating) {
+            cross_incr (rot_ab.ang_vel_this, pos, vel);
+         }
+         if (transformed) {
+            double tmp[3];
+            transform_transpose (rot_ab.T_parent_this, pos, tmp);
+            Vector3::copy (tmp, pos);
+            transform_transpose (rot_ab.T_parent_this, vel, tmp);
+            Vector3::copy (tmp, vel);
+         }
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            pos[jj] += s_ab.trans.position[jj];
+            vel[jj] += s_ab.trans.velocity[jj];
+         }
+
+         BatchArrays::store (pos, ii, arr.x);
+         BatchArrays::store (vel, ii, arr.v);
+      }
+   }
+}
+
+
+/**
+ * Compute S_A:C = S_A:B + S_B:C for each state in the batch,
+ * with each state initially containing S_A:B and
+ * the supplied argument containing S_B:C.
+ * The angular velocity is always computed as T_B:C * w_A:B + w_B:C; unlike
+ * RefFrameState::incr_right, no rate-based shortcut is taken per state.
+ * \param[in] s_bc  Right addend
+ * \param[in] items Parts of the states to be updated
+ */
+void
+RefFrameStateBatch::incr_right (
+   const RefFrameState & s_bc,
+   RefFrameItems::Items items)
+{
+   //   T_A:C = T_B:C * T_A:B
+   //   w_A:C = T_B:C * w_A:B + w_B:C
+   //   x_A:C = x_A:B + T_A:B^T * x_B:C
+   //   v_A:C = v_A:B + T_A:B^T * (v_B:C + w_A:B X x_B:C)
+
+   BatchArrays arr = gather_arrays (*this);
+   const RefFrameRot & rot_bc = s_bc.rot;
+   bool transformed =
+      (!Numerical::compare_exact(rot_bc.Q_parent_this.scalar,1.0));
+
+   // The translational state depends on the original T_A:B and w_A:B,
+   // so it is computed first.
+   if (selects_translation (items)) {
+      for (unsigned int ii = 0; ii < num_states; ++ii) {
+         double T[3][3];
+         double omega[3];
+         double pos[3];
+         double vel[3];
+         double v_obs[3];
+         double tmp[3];
+         arr.load_transform (ii, T);
+         BatchArrays::load (arr.w, ii, omega);
+         BatchArrays::load (arr.x, ii, pos);
+         BatchArrays::load (arr.v, ii, vel);
+
+         // v_B->C:B(A) = v_B:C + w_A:B X x_B:C
+         v_obs[0] = s_bc.trans.velocity[0];
+         v_obs[1] = s_bc.trans.velocity[1];
+         v_obs[2] = s_bc.trans.velocity[2];
+         cross_incr (omega, s_bc.trans.position, v_obs);
+
+         transform_transpose (T, s_bc.trans.position, tmp);
+         Vector3::incr (tmp, pos);
+         transform_transpose (T, v_obs, tmp);
+         Vector3::incr (tmp, vel);
+
+         BatchArrays::store (pos, ii, arr.x);
+         BatchArrays::store (vel, ii, arr.v);
+      }
+   }
+
+   if (selects_rotation (items)) {
+      for (unsigned int ii = 0; ii < num_states; ++ii) {
+         double omega[3];
+         double tw[3];
+         BatchArrays::load (arr.w, ii, omega);
+         transform (rot_bc.T_parent_this, omega, tw);
+         tw[0] += rot_bc.ang_vel_this[0];
+         tw[1] += rot_bc.ang_vel_this[1];
+         tw[2] += rot_bc.ang_vel_this[2];
+         arr.store_rate (ii, tw);
+
+         if (transformed) {
+            double T[3][3];
+            double q_v[3];
+            double q_s;
+            double in_v[3];
+            BatchArrays::load (arr.qv, ii, in_v);
+            quat_product (rot_bc.Q_parent_this.scalar,
+                          rot_bc.Q_parent_this.vector,
+                          arr.qs[ii], in_v,
+                          q_s, q_v);
+            normalize_quat (q_s, q_v);
+            quat_to_transformation (q_s, q_v, T);
+            arr.store_rotation (ii, q_s, q_v, T);
+         }
+      }
+   }
+}
+
+
+/**
+ * Compute S_B:C = (-S_A:B) + S_A:C for each state in the batch,
+ * with each state initially containing S_A:C and
+ * the supplied argument containing S_A:B.
+ * \param[in] s_ab  Left subtrahend
+ * \param[in] items Parts of the states to be updated
+ */
+void
+RefFrameStateBatch::decr_left (
+   const RefFrameState & s_ab,
+   RefFrameItems::Items items)
+{
+   //   T_B:C = T_A:C * T_A:B^T
+   //   w_B:C = w_A:C - T_B:C * w_A:B
+   //   x_B:C = T_A:B * (x_A:C - x_A:B)
+   //   v_B:C = T_A:B * (v_A:C - v_A:B) - w_A:B X x_B:C
+
+   BatchArrays arr = gather_arrays (*this);
+   const RefFrameRot & rot_ab = s_ab.rot;
+   bool rotating = (std::fpclassify(rot_ab.ang_vel_mag) != FP_ZERO);
+   bool transformed =
+      (!Numerical::compare_exact(rot_ab.Q_parent_this.scalar,1.0));
+   double neg_w_ab[3] = {
+      -rot_ab.ang_vel_this[0], -rot_ab.ang_vel_this[1], -rot_ab.ang_vel_this[2]};
+
+   if (selects_translation (items)) {
+      for (unsigned int ii = 0; ii < num_states; ++ii) {
+         double pos[3];
+         double vel[3];
+         BatchArrays::load (arr.x, ii, pos);
+         BatchArrays::load (arr.v, ii, vel);
+
+         for (unsigned int jj = 0; jj < 3; ++jj) {
+            pos[jj] -= s_ab.trans.position[jj];
+            vel[jj] -= s_ab.trans.velocity[jj];
+         }
+         if (transformed) {
+            double tmp[3];
+            transform (rot_ab.T_parent_this, pos, tmp);
+            Vector3::copy (tmp, pos);
+            transform (rot_ab.T_parent_this, vel, tmp);
+            Vector3::copy (tmp, vel);
+         }
+         if (rotating) {
+            cross_incr (neg_w_ab, pos, vel);
+         }
+
+         BatchArrays::store (pos, ii, arr.x);
+         BatchArrays::store (vel, ii, arr.v);
+      }
+   }
+
+   if (selects_rotation (items)) {
+      for (unsigned int ii = 0; ii < num_states; ++ii) {
+         double T[3][3];
+         arr.load_transform (ii, T);
+
+         if (transformed) {
+            double q_v[3];
+            double q_s;
+            double in_v[3];
+            double conj_v[3] = {
+               -rot_ab.Q_parent_this.vector[0],
+               -rot_ab.Q_parent_this.vector[1],
+               -rot_ab.Q_parent_this.vector[2]};
+            BatchArrays::load (arr.qv, ii, in_v);
+            quat_product (arr.qs[ii], in_v,
+                          rot_ab.Q_parent_this.scalar, conj_v,
+                          q_s, q_v);
+            normalize_quat (q_s, q_v);
+            quat_to_transformation (q_s, q_v, T);
+            arr.store_rotation (ii, q_s, q_v, T);
+         }
+
+         // w_B:C uses the updated T_B:C.
+         if (rotating) {
+            double omega[3];
+            double tw[3];
+            BatchArrays::load (arr.w, ii, omega);
+            transform (T, rot_ab.ang_vel_this, tw);
+            omega[0] -= tw[0];
+            omega[1] -= tw[1];
+            omega[2] -= tw[2];
+            arr.store_rate (ii, omega);
+         }
+      }
+   }
+}
+
+
+/**
+ * Compute S_A:B = S_A:C + (-S_B:C) for each state in the batch,
+ * with each state initially containing S_A:C and
+ * the supplied argument containing S_B:C.
+ * The translational state depends on the resulting T_A:B and w_A:B, which
+ * are computed (but not stored) for a translation-only update.
+ * \param[in] s_bc  Right subtrahend
+ * \param[in] items Parts of the states to be updated
+ */
+void
+RefFrameStateBatch::decr_right (
+   const RefFrameState & s_bc,
+   RefFrameItems::Items items)
+{
+   //   T_A:B = T_B:C^T * T_A:C
+   //   w_A:B = T_B:C^T * (w_A:C - w_B:C)
+   //   x_A:B = x_A:C - T_A:B^T * x_B:C
+   //   v_A:B = v_A:C - T_A:B^T * (v_B:C + w_A:B X x_B:C)
+
+   BatchArrays arr = gather_arrays (*this);
+   const RefFrameRot & rot_bc = s_bc.rot;
+   bool transformed =
+      (!Numerical::compare_exact(rot_bc.Q_parent_this.scalar,1.0));
+   bool do_trans = selects_translation (items);
+   bool do_rot = selects_rotation (items);
+   double conj_v[3] = {
+      -rot_bc.Q_parent_this.vector[0],
+      -rot_bc.Q_parent_this.vector[1],
+      -rot_bc.Q_parent_this.vector[2]};
+
+   if (! (do_trans || do_rot)) {
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < num_states; ++ii) {
+      double T[3][3];
+      double omega[3];
+      double dw[3];
+
+      // Rotational state.
+      arr.load_transform (ii, T);
+      if (transformed) {
+         double q_v[3];
+         double q_s;
+         double in_v[3];
+         BatchArrays::load (arr.qv, ii, in_v);
+         quat_product (rot_bc.Q_parent_this.scalar, conj_v,
+                       arr.qs[ii], in_v,
+                       q_s, q_v);
+         normalize_quat (q_s, q_v);
+         quat_to_transformation (q_s, q_v, T);
+         if (do_rot) {
+            arr.store_rotation (ii, q_s, q_v, T);
+         }
+      }
+
+      BatchArrays::load (arr.w, ii, dw);
+      dw[0] -= rot_bc.ang_vel_this[0];
+      dw[1] -= rot_bc.ang_vel_this[1];
+      dw[2] -= rot_bc.ang_vel_this[2];
+      transform_transpose (rot_bc.T_parent_this, dw, omega);
+      if (do_rot) {
+         arr.store_rate (ii, omega);
+      }
+
+      // Translational state.
+      if (do_trans) {
+         double pos[3];
+         double vel[3];
+         double v_obs[3];
+         double tmp[3];
+         BatchArrays::load (arr.x, ii, pos);
+         BatchArrays::load (arr.v, ii, vel);
+
+         v_obs[0] = s_bc.trans.velocity[0];
+         v_obs[1] = s_bc.trans.velocity[1];
+         v_obs[2] = s_bc.trans.velocity[2];
+         cross_incr (omega, s_bc.trans.position, v_obs);
+
+         transform_transpose (T, s_bc.trans.position, tmp);
+         Vector3::decr (tmp, pos);
+         transform_transpose (T, v_obs, tmp);
+         Vector3::decr (tmp, vel);
+
+         BatchArrays::store (pos, ii, arr.x);
+         BatchArrays::store (vel, ii, arr.v);
+      }
+   }
+}
+
+
+/**
+ * Compute S_A:C = S_A:B + S_B:C for each state in the batch, where the
+ * S_B:C are taken from the offsets batch and are fixed in frame B
+ * (zero velocity and angular velocity with respect to B), and the
+ * supplied argument contains S_A:B.
+ * The batch is resized to match the offsets. Parts of the states not
+ * selected by the items are left unset.
+ *
+ * Fixed offsets allow most of the work to be done once per call:
+ *   v_A:C = v_A:B + (T_A:B^T [w_A:B X]) x_B:C
+ *   w_A:C = T_B:C w_A:B, whose magnitude is that of w_A:B
+ * leaving each state with a few independent multiply-adds per component.
+ * \param[in] offsets Fixed states S_B:C
+ * \param[in] s_ab    Left addend
+ * \param[in] items   Parts of the states to be computed
+ */
+void
+RefFrameStateBatch::compose_fixed (
+   const RefFrameStateBatch & offsets,
+   const RefFrameState & s_ab,
+   RefFrameItems::Items items)
+{
+   const unsigned int count = offsets.num_states;
+   const RefFrameRot & rot_ab = s_ab.rot;
+
+   if (num_states != count) {
+      resize (count);
+   }
+
+   if (selects_translation (items)) {
+      const double * px = offsets.component (Position);
+      const double * py = offsets.component (Position+1);
+      const double * pz = offsets.component (Position+2);
+
+      // M = T_A:B^T [w_A:B X], so that T_A:B^T (w_A:B X x) = M x.
+      const double (&T)[3][3] = rot_ab.T_parent_this;
+      const double * w = rot_ab.ang_vel_this;
+      double M[3][3];
+      for (unsigned int rr = 0; rr < 3; ++rr) {
+         M[rr][0] = T[1][rr] * w[2] - T[2][rr] * w[1];
+         M[rr][1] = T[2][rr] * w[0] - T[0][rr] * w[2];
+         M[rr][2] = T[0][rr] * w[1] - T[1][rr] * w[0];
+      }
+
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         double * x = component (Position+jj);
+         double * v = component (Velocity+jj);
+         const double x0 = s_ab.trans.position[jj];
+         const double v0 = s_ab.trans.velocity[jj];
+         for (unsigned int ii = 0; ii < count; ++ii) {
+            x[ii] = x0 + T[0][jj] * px[ii] + T[1][jj] * py[ii]
+                       + T[2][jj] * pz[ii];
+            v[ii] = v0 + M[jj][0] * px[ii] + M[jj][1] * py[ii]
+                       + M[jj][2] * pz[ii];
+         }
+      }
+   }
+
+   if (selects_rotation (items)) {
+      const double * in_qs = offsets.component (QuatScalar);
+      const double * in_qv[3];
+      const double * in_t[9];
+      double * out_qv[3];
+      double * out_t[9];
+      double * out_w[3];
+      double * out_wunit[3];
+      double * qs = component (QuatScalar);
+      double * wmag = component (AngVelMag);
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         in_qv[jj] = offsets.component (QuatVector+jj);
+         out_qv[jj] = component (QuatVector+jj);
+         out_w[jj] = component (AngVel+jj);
+         out_wunit[jj] = component (AngVelUnit+jj);
+      }
+      for (unsigned int jj = 0; jj < 9; ++jj) {
+         in_t[jj] = offsets.component (Transform+jj);
+         out_t[jj] = component (Transform+jj);
+      }
+
+      // w_A:C = T_B:C w_A:B; the unit vector transforms the same way.
+      const double * w = rot_ab.ang_vel_this;
+      const double * wu = rot_ab.ang_vel_unit;
+      for (unsigned int rr = 0; rr < 3; ++rr) {
+         const double * t0 = in_t[3*rr];
+         const double * t1 = in_t[3*rr+1];
+         const double * t2 = in_t[3*rr+2];
+         double * wo = out_w[rr];
+         double * uo = out_wunit[rr];
+         for (unsigned int ii = 0; ii < count; ++ii) {
+            wo[ii] = t0[ii] * w[0] + t1[ii] * w[1] + t2[ii] * w[2];
+            uo[ii] = t0[ii] * wu[0] + t1[ii] * wu[1] + t2[ii] * wu[2];
+         }
+      }
+      for (unsigned int ii = 0; ii < count; ++ii) {
+         wmag[ii] = rot_ab.ang_vel_mag;
+      }
+
+      // Q_A:C = Q_B:C * Q_A:B, with the scalar part made non-negative.
+      // The product of unit quaternions is a unit quaternion, so the
+      // offsets are trusted to be normalized and the product is not
+      // renormalized.
+      const double bs = rot_ab.Q_parent_this.scalar;
+      const double * bv = rot_ab.Q_parent_this.vector;
+      const double * av0 = in_qv[0];
+      const double * av1 = in_qv[1];
+      const double * av2 = in_qv[2];
+      double * qv0 = out_qv[0];
+      double * qv1 = out_qv[1];
+      double * qv2 = out_qv[2];
+      for (unsigned int ii = 0; ii < count; ++ii) {
+         double as = in_qs[ii];
+         double ps = as * bs - (av0[ii] * bv[0] + av1[ii] * bv[1] +
+                                av2[ii] * bv[2]);
+         double p0 = as * bv[0] + bs * av0[ii] +
+                     (av1[ii] * bv[2] - av2[ii] * bv[1]);
+         double p1 = as * bv[1] + bs * av1[ii] +
+                     (av2[ii] * bv[0] - av0[ii] * bv[2]);
+         double p2 = as * bv[2] + bs * av2[ii] +
+                     (av0[ii] * bv[1] - av1[ii] * bv[0]);
+         double sign = (ps < 0.0) ? -1.0 : 1.0;
+         qs[ii] = sign * ps;
+         qv0[ii] = sign * p0;
+         qv1[ii] = sign * p1;
+         qv2[ii] = sign * p2;
+      }
+
+      // T_A:C = T_B:C * T_A:B
+      const double (&Tab)[3][3] = rot_ab.T_parent_this;
+      for (unsigned int rr = 0; rr < 3; ++rr) {
+         const double * t0 = in_t[3*rr];
+         const double * t1 = in_t[3*rr+1];
+         const double * t2 = in_t[3*rr+2];
+         for (unsigned int cc = 0; cc < 3; ++cc) {
+            double * to = out_t[3*rr+cc];
+            const double b0 = Tab[0][cc];
+            const double b1 = Tab[1][cc];
+            const double b2 = Tab[2][cc];
+            for (unsigned int ii = 0; ii < count; ++ii) {
+               to[ii] = t0[ii] * b0 + t1[ii] * b1 + t2[ii] * b2;
+            }
+         }
+      }
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,306 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup RefFrames
+ * @{
+ *
+ * @file models/utils/ref_frames/src/ref_frame_tree_index.cc
+ * Define methods for the RefFrameTreeIndex class.
+ */
+
+/*******************************************************************************
+  Purpose:
+    ()
+
+  Library dependencies:
+    ((ref_frame_tree_index.cc)
+     (ref_frame_compute_relative_state.cc))
+
+   
+*******************************************************************************/
+
+
+// System includes
+#include <cstddef>
+#include <utility>
+
+// Model includes
+#include "../include/ref_frame.hh"
+#include "../include/ref_frame_tree_index.hh"
+#include "../include/tree_links_iterator.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * RefFrameTreeIndex default constructor.
+ */
+RefFrameTreeIndex::RefFrameTreeIndex (
+   void)
+:
+   rmq_min_frames(64),
+   built_revision(0),
+   frames(),
+   parents(),
+   depths(),
+   frame_map(),
+   rmq_table(),
+   rmq_levels(0)
+{ }
+
+
+/**
+ * RefFrameTreeIndex destructor.
+ */
+RefFrameTreeIndex::~RefFrameTreeIndex (
+   void)
+{ }
+
+
+/**
+ * Discard the index.
+ */
+void
+RefFrameTreeIndex::clear (
+   void)
+{
+   built_revision = 0;
+   frames.clear();
+   parents.clear();
+   depths.clear();
+   frame_map.clear();
+   rmq_table.clear();
+   rmq_levels = 0;
+}
+
+
+/**
+ * Flatten the tree rooted at the given frame.
+ * \param[in] root Root of the tree to be indexed
+ */
+void
+RefFrameTreeIndex::build (
+   const RefFrame & root)
+{
+   // Pending frames and the preorder indices of their parents.
+   std::vector<std::pair<const RefFrame *, int>> pending;
+
+   clear();
+
+   // Number the frames in preorder. Popping from the back of the pending list
+   // finishes each subtree before any frame pushed ahead of it is visited.
+   pending.emplace_back (&root, -1);
+   while (! pending.empty()) {
+      const RefFrame * frame = pending.back().first;
+      int parent = pending.back().second;
+      int index = static_cast<int> (frames.size());
+      pending.pop_back();
+
+      frames.push_back (frame);
+      parents.push_back (parent);
+      depths.push_back ((parent < 0) ? 0 : depths[parent] + 1);
+      frame_map[frame] = index;
+
+      for (auto * link : TreeLinksChildrenRange<const RefFrameLinks>(
+              frame->links)) {
+         pending.emplace_back (&(link->container()), index);
+      }
+   }
+
+   if (frames.size() >= rmq_min_frames) {
+      build_rmq_table ();
+   }
+
+   built_revision = RefFrame::get_tree_revision ();
+}
+
+
+/**
+ * Build the range-minimum table over the preorder depths.
+ */
+void
+RefFrameTreeIndex::build_rmq_table (
+   void)
+{
+   unsigned int nframes = frames.size();
+
+   rmq_levels = 1;
+   while ((2u << (rmq_levels-1)) <= nframes) {
+      ++rmq_levels;
+   }
+   rmq_table.resize (rmq_levels * nframes);
+
+   for (unsigned int ii = 0; ii < nframes; ++ii) {
+      rmq_table[ii] = ii;
+   }
+
+   for (unsigned int kk = 1; kk < rmq_levels; ++kk) {
+      const unsigned int * prev = &rmq_table[(kk-1) * nframes];
+      unsigned int * row = &rmq_table[kk * nframes];
+      unsigned int half = 1u << (kk-1);
+      for (unsigned int ii = 0; ii + 2*half <= nframes; ++ii) {
+         unsigned int lo = prev[ii];
+         unsigned int hi = prev[ii + half];
+         row[ii] = (depths[hi] < depths[lo]) ? hi : lo;
+      }
+   }
+}
+
+
+/**
+ * Does the index reflect the current reference frame tree structure?
+ * @return True if the index is non-empty and no tree has changed since it
+ *   was built
+ */
+bool
+RefFrameTreeIndex::is_current (
+   void)
+const
+{
+   return (built_revision != 0) &&
+          (built_revision == RefFrame::get_tree_revision ());
+}
+
+
+/**
+ * Find the preorder index of a frame.
+ * @return Preorder index, -1 if the frame is not in the index
+ * \param[in] frame Frame to be found
+ */
+int
+RefFrameTreeIndex::find_frame_index (
+   const RefFrame & frame)
+const
+{
+   auto iter = frame_map.find (&frame);
+   return (iter != frame_map.end()) ? static_cast<int> (iter->second) : -1;
+}
+
+
+/**
+ * Find the last common node of two indexed frames via the parent array.
+ * @return Preorder index of the last common node
+ * \param[in] index_a Preorder index of the first frame
+ * \param[in] index_b Preorder index of the second frame
+ */
+unsigned int
+RefFrameTreeIndex::walk_to_common_ancestor (
+   unsigned int index_a,
+   unsigned int index_b)
+const
+{
+   while (depths[index_a] > depths[index_b]) {
+      index_a = parents[index_a];
+   }
+   while (depths[index_b] > depths[index_a]) {
+      index_b = parents[index_b];
+   }
+   while (index_a != index_b) {
+      index_a = parents[index_a];
+      index_b = parents[index_b];
+   }
+   return index_a;
+}
+
+
+/**
+ * Find the last common node of two indexed frames.
+ * @return Preorder index of the last common node
+ * \param[in] index_a Preorder index of the first frame
+ * \param[in] index_b Preorder index of the second frame
+ */
+unsigned int
+RefFrameTreeIndex::find_common_ancestor (
+   unsigned int index_a,
+   unsigned int index_b)
+const
+{
+   if (index_a == index_b) {
+      return index_a;
+   }
+   if (rmq_levels == 0) {
+      return walk_to_common_ancestor (index_a, index_b);
+   }
+
+   // Find the shallowest frame in the preorder range (lo, hi]. That frame is
+   // a child of the last common node.
+   unsigned int nframes = frames.size();
+   unsigned int lo = (index_a < index_b) ? index_a + 1 : index_b + 1;
+   unsigned int hi = (index_a < index_b) ? index_b : index_a;
+   unsigned int kk = 0;
+   while ((2u << kk) <= hi - lo + 1) {
+      ++kk;
+   }
+   const unsigned int * row = &rmq_table[kk * nframes];
+   unsigned int left = row[lo];
+   unsigned int right = row[hi + 1 - (1u << kk)];
+   unsigned int shallowest = (depths[right] < depths[left]) ? right : left;
+
+   return parents[shallowest];
+}
+
+
+/**
+ * Find the depth of the last common node of two frames, which is the value
+ * RefFrame::find_last_common_index would return.
+ * @return Depth of the last common node, -1 if the index is out of date or
+ *   either frame is not indexed
+ * \param[in] frame_a First frame
+ * \param[in] frame_b Second frame
+ */
+int
+RefFrameTreeIndex::find_last_common_index (
+   const RefFrame & frame_a,
+   const RefFrame & frame_b)
+const
+{
+   if (! is_current()) {
+      return -1;
+   }
+
+   int index_a = find_frame_index (frame_a);
+   int index_b = find_frame_index (frame_b);
+   if ((index_a < 0) || (index_b < 0)) {
+      return -1;
+   }
+
+   return depths[find_common_ancestor (index_a, index_b)];
+}
+
+
+/**
+ * Find the last common node of two frames.
+ * @return Last common node, null if the index is out of date or either
+ *   frame is not indexed
+ * \param[in] frame_a First frame
+ * \param[in] frame_b Second frame
+ */
+const RefFrame *
+RefFrameTreeIndex::find_last_common_node (
+   const RefFrame & frame_a,
+   const RefFrame & frame_b)
+const
+{
+   if (! is_current()) {
+      return nullptr;
+   }
+
+   int index_a = find_frame_index (frame_a);
+   int index_b = find_frame_index (frame_b);
+   if ((index_a < 0) || (index_b < 0)) {
+      return nullptr;
+   }
+
+   return frames[find_common_ancestor (index_a, index_b)];
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,225 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/branch_driver.hh
+ * Define the classes JeodBranchDispersion and JeodBranchDriver, which run
+ * Monte Carlo cases as forked copies of a single initialized simulation.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/branch_driver.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_BRANCH_DRIVER_HH
+#define JEOD_BRANCH_DRIVER_HH
+
+// System includes
+#include <vector>
+
+// Model includes
+#include "jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodBranchDispersion changes some part of the simulation state in a
+ * branched Monte Carlo run. Derived classes apply run-specific changes to
+ * the objects they are attached to.
+ */
+class JeodBranchDispersion {
+JEOD_MAKE_SIM_INTERFACES(JeodBranchDispersion)
+
+public:
+
+   /**
+    * Default constructor.
+    */
+   JeodBranchDispersion (void) {}
+
+   /**
+    * Destructor.
+    */
+   virtual ~JeodBranchDispersion (void) {}
+
+   /**
+    * Apply the dispersion for the specified run.
+    * Called in the worker process that executes the run, once, right after
+    * the worker is forked.
+    * @param run_index Zero-based index of the run.
+    */
+   virtual void apply_dispersion (unsigned int run_index) = 0;
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   JeodBranchDispersion (const JeodBranchDispersion &);
+
+   /**
+    * Not implemented.
+    */
+   JeodBranchDispersion & operator= (const JeodBranchDispersion &);
+};
+
+
+/**
+ * A JeodBranchDriver runs a Monte Carlo campaign by forking an initialized
+ * simulation. The simulation initializes once, up to a branch point where it
+ * calls branch(). The driver then forks one worker process per run, at most
+ * max_workers at a time. The workers share the initialized state with the
+ * parent copy-on-write, so ephemerides, gravity tables, and the like are
+ * built once per campaign rather than once per run. Each worker applies the
+ * registered dispersions for its run index and continues the simulation
+ * from the branch point; the parent waits for all workers to finish.
+ *
+ * \par Assumptions and Limitations
+ *  - branch() must be called from the main thread at a quiescent point:
+ *    no other thread may be running (e.g., a background checkpoint write).
+ *    Only the calling thread exists in a forked worker.
+ *  - Workers inherit the parent's open files. Runs should select distinct
+ *    output locations based on get_run_index().
+ *  - A worker's exit status is its result. A non-zero status or a signal
+ *    counts as a failed run.
+ */
+class JeodBranchDriver {
+JEOD_MAKE_SIM_INTERFACES(JeodBranchDriver)
+
+public:
+
+   // Constructor and destructor.
+   JeodBranchDriver (void);
+   ~JeodBranchDriver (void);
+
+   // Register a dispersion to be applied in each worker.
+   void add_dispersion (JeodBranchDispersion & dispersion);
+
+   /**
+    * Set the maximum number of workers that run at the same time.
+    * @param num_workers Maximum number of concurrent workers; zero means one.
+    */
+   void set_max_workers (unsigned int num_workers)
+   { max_workers = (num_workers == 0) ? 1 : num_workers; }
+
+   // Fork the workers and, in the parent, wait for them to finish.
+   int branch (unsigned int num_runs);
+
+   /**
+    * Is this process a worker?
+    * @return True in a worker, false in the parent.
+    */
+   bool is_worker (void) const
+   { return run_index >= 0; }
+
+   /**
+    * Get the index of the run executed by this process.
+    * @return Run index in a worker, -1 in the parent.
+    */
+   int get_run_index (void) const
+   { return run_index; }
+
+   /**
+    * Get the number of runs whose worker failed.
+    * @return Number of failed runs; valid in the parent after branch().
+    */
+   unsigned int get_num_failed_runs (void) const
+   { return num_failed_runs; }
+
+
+private:
+
+   // Member data
+
+   /**
+    * Dispersions applied in each worker, in registration order.
+    */
+   std::vector<JeodBranchDispersion *> dispersions; //!< trick_io(**)
+
+   /**
+    * Maximum number of concurrent workers.
+    */
+   unsigned int max_workers; //!< trick_units(--)
+
+   /**
+    * Run index of this process, or -1 in the parent.
+    */
+   int run_index; //!< trick_io(*o) trick_units(--)
+
+   /**
+    * Number of runs whose worker failed.
+    */
+   unsigned int num_failed_runs; //!< trick_io(*o) trick_units(--)
+
+
+   /**
+    * Not implemented.
+    */
+   JeodBranchDriver (const JeodBranchDriver &);
+
+   /**
+    * Not implemented.
+    */
+   JeodBranchDriver & operator= (const JeodBranchDriver &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
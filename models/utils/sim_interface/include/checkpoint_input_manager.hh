@@ -58,6 +58,7 @@
 // JEOD includes
 #include "utils/sim_interface/include/config.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
+#include "utils/sim_interface/include/checkpoint_section_codec.hh"
 
 // System includes
 #include <cstddef>
@@ -65,6 +66,8 @@
 #include <fstream>
 #include <string>
 #include <map>
+#include <stdint.h>
+#include <vector>
 
 
 //! Namespace jeod 
@@ -103,7 +106,7 @@ public:
     @return False if object is OK.
     */
    bool operator ! () const
-   { return file_buf == nullptr; }
+   { return (file_buf == nullptr) && (memory == nullptr); }
 #endif
 
 private:
@@ -116,12 +119,17 @@ private:
    // Activate the object
    void activate (std::ifstream & stream, std::size_t spos, std::size_t epos);
 
+   // Activate the object to read section content held in memory.
+   void activate (const char * section_memory, std::size_t size);
+
    /**
     Deactivate the object.
     Used to force a badly behaving stream to disconnect.
     */
    void deactivate (void) {
       file_buf = nullptr;
+      memory = nullptr;
+      this->setg (nullptr, nullptr, nullptr);
       at_eof = true;
    }
 
@@ -136,6 +144,12 @@ private:
     */
    std::filebuf * file_buf; //!< trick_io(**)
 
+   /**
+    * Section contents held in memory (a mapped text section or the decoded
+    * contents of a binary section), read in place of file_buf.
+    */
+   const char * memory; //!< trick_io(**)
+
    /**
     * The position of the start of the contents of the
     * checkpoint file section being read by this object.
@@ -356,6 +370,13 @@ private:
       std::size_t spos,
       std::size_t epos);
 
+   // Construct a SectionedInputStream that reads content held in memory.
+   SectionedInputStream (
+      CheckPointInputManager * mngr,
+      std::ifstream & fstream,
+      const char * section_memory,
+      std::size_t size);
+
 
    // Member data
 
@@ -386,6 +407,11 @@ private:
     */
    JEOD_SIZE_T end_pos; //!< trick_io(**)
 
+   /**
+    * Section contents held in memory, or null to read from the file stream.
+    */
+   const char * memory; //!< trick_io(**)
+
    /**
     * Is this a copy of some other SectionedInputStream?
     * Copies of copies are verboten.
@@ -415,6 +441,16 @@ private:
  input streams that other objects can use to read the contents of one of
  those checkpoint file sections. The interpretation of the contents of
  a checkpoint file section is the responsibility of those other objects.
+
+ Binary sections (see CheckPointOutputManager) are decoded in full when a
+ reader is created, with reference records resolved against the earlier
+ checkpoint files that hold their content. Readers see the same text a
+ text section would have held.
+
+ The file is mapped into memory when the platform allows it. Section
+ markers are then located by scanning the mapped bytes, text sections are
+ read in place, and binary payloads are decoded directly from the mapping.
+ The file stream remains the fallback when the file cannot be mapped.
  */
 class CheckPointInputManager {
 
@@ -425,6 +461,9 @@ public:
                           const std::string & start_marker,
                           const std::string & end_marker);
 
+   // Destructor.
+   ~CheckPointInputManager ();
+
    /**
     Create a C++ input stream that reads from a checkpoint file section.
     @par Error handling
@@ -480,6 +519,12 @@ private:
        */
       JEOD_SIZE_T end_pos; //!< trick_io(**)
 
+      /**
+       * Is the section a binary section? If so, the start and end
+       * positions delimit its payload.
+       */
+      bool binary; //!< trick_io(**)
+
             /**
        * Non-default constructor.
        * \param[in] start Start position
@@ -487,13 +532,25 @@ private:
        */
       SectionInfo (
          std::size_t start,
-         std::size_t end)
-      : start_pos(start), end_pos(end) {}
+         std::size_t end,
+         bool is_binary = false)
+      : start_pos(start), end_pos(end), binary(is_binary) {}
    };
 
+   /**
+    * The records of a binary section.
+    */
+   typedef std::vector<CheckPointSectionCodec::Record> RecordList;
+
 
    // Member functions
 
+   // Map the file into memory.
+   void map_file (void);
+
+   // Get the next line of the file.
+   bool next_line (std::size_t & pos, std::string & line);
+
    // Record locations of section markers.
    void initialize (void);
 
@@ -505,6 +562,18 @@ private:
    // Create a C++ input stream that reads the Trick checkpoint file section.
    SectionedInputStream create_trick_section_reader (); //cppcheck-suppress unusedPrivateFunction
 
+   // Get the decoded records of a binary section.
+   const RecordList * get_binary_records (const std::string & tag);
+
+   // Decode a binary section into the text its writer produced.
+   bool decode_binary_section (const std::string & tag, std::string & text);
+
+   // Find the content of a data record in this file.
+   bool find_record_content (const std::string & tag,
+                             const std::string & key,
+                             uint64_t hash,
+                             const std::string * & content);
+
 
    // Member data
 
@@ -513,6 +582,21 @@ private:
     */
    std::map<std::string, SectionInfo> sections; //!< trick_io(**)
 
+   /**
+    * Maps binary section names to their decoded records.
+    */
+   std::map<std::string, RecordList> binary_records; //!< trick_io(**)
+
+   /**
+    * Maps binary section names to their decoded text.
+    */
+   std::map<std::string, std::string> decoded_sections; //!< trick_io(**)
+
+   /**
+    * Earlier checkpoint files referenced by this file's binary sections.
+    */
+   std::map<std::string, CheckPointInputManager *> referenced_files; //!< trick_io(**)
+
    /**
     * The C++ file stream that reads the checkpoint file.
     */
@@ -543,6 +627,16 @@ private:
     */
    bool is_open; //!< trick_io(**)
 
+   /**
+    * The checkpoint file mapped into memory, or null if not mapped.
+    */
+   const char * mapped_data; //!< trick_io(**)
+
+   /**
+    * The size of the mapped file.
+    */
+   std::size_t mapped_size; //!< trick_io(**)
+
 
 
    // Nix to the C++ freebie copy constructor and assignment operator.
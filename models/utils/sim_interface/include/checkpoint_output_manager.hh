@@ -62,6 +62,10 @@
 #include <fstream>
 #include <string>
 #include <map>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+#include <pthread.h>
 
 
 //! Namespace jeod 
@@ -72,6 +76,71 @@ class CheckPointOutputManager;
 class MemoryManagerWrapper;
 
 
+/**
+ A CheckPointRecordHistory remembers, across checkpoints, which checkpoint
+ file holds the content of each binary section record and the hash of that
+ content. Incremental checkpoints consult it to replace unchanged records
+ with references to the file that already holds them.
+
+ The history is not itself checkpointed. The first checkpoint after a
+ restart is therefore a full checkpoint.
+ */
+class CheckPointRecordHistory {
+
+public:
+
+   // Default constructor.
+   CheckPointRecordHistory ();
+
+   // Prepare for writing the given checkpoint file.
+   void start_checkpoint (const std::string & file,
+                          unsigned int full_interval);
+
+   // Find the file that holds a record with the given content hash.
+   bool find (const std::string & record_id,
+              uint64_t hash,
+              std::string & file) const;
+
+   // Note that a file holds a record with the given content hash.
+   void update (const std::string & record_id,
+                uint64_t hash,
+                const std::string & file);
+
+   // Forget all records held by a file.
+   void forget_file (const std::string & file);
+
+   // Forget everything.
+   void clear ();
+
+private:
+
+   /**
+    Where a record's content is stored.
+    */
+   struct Entry {
+      /**
+       * Hash of the record content.
+       */
+      uint64_t hash; //!< trick_io(**)
+
+      /**
+       * Checkpoint file that holds the content.
+       */
+      std::string file; //!< trick_io(**)
+   };
+
+   /**
+    * Record locations, keyed by section tag and record key.
+    */
+   std::map<std::string, Entry> entries; //!< trick_io(**)
+
+   /**
+    * Number of checkpoints started since the history was created.
+    */
+   unsigned int checkpoint_count; //!< trick_io(**)
+};
+
+
 /**
  A SectionedOutputBuffer is a std::streambuf that writes a section of a
  checkpoint file.
@@ -100,7 +169,7 @@ public:
     @return False if object is OK.
     */
    bool operator ! () const
-   { return file_buf == nullptr; }
+   { return (file_buf == nullptr) && (capture == nullptr); }
 #endif
 
 private:
@@ -114,20 +183,27 @@ private:
    // Activate the object.
    void activate (std::ofstream & stream);
 
+   // Activate the object to collect output in memory.
+   void activate (std::string & content);
+
    /**
     Deactivate the object.
     Used to disconnect the buffer when the stream is done, sometimes by force.
     */
    void deactivate (void) {
-      if (!!*this) {
+      if (file_buf != nullptr) {
          this->sync();
       }
       file_buf = nullptr;
+      capture = nullptr;
    }
 
    // Write a character to the file when the output buffer overflows.
    std::streambuf::int_type overflow (std::streambuf::int_type c) override;
 
+   // Write a sequence of characters.
+   std::streamsize xsputn (const char * str, std::streamsize count) override;
+
 
    // Member data
 
@@ -136,6 +212,11 @@ private:
     */
    std::filebuf * file_buf; //!< trick_io(**)
 
+   /**
+    * The string that collects the contents of a binary or deferred section.
+    */
+   std::string * capture; //!< trick_io(**)
+
 
    // Deleted contents
 
@@ -187,6 +268,16 @@ public:
    // Deactivate the object.
    void deactivate ();
 
+   // End the current record of a binary section.
+   void end_record (const std::string & key);
+
+   /**
+    Does this object write a binary section?
+    @return True if the section is written in the binary format.
+    */
+   bool writes_binary () const
+   { return is_binary; }
+
 #ifndef SWIG
    /**
     Conversion to boolean.
@@ -260,6 +351,11 @@ private:
     */
    bool is_active; //!< trick_io(**)
 
+   /**
+    * Is this object writing a binary section?
+    */
+   bool is_binary; //!< trick_io(**)
+
 
    // Deleted contents
 
@@ -275,9 +371,26 @@ private:
  file. Section markers split a Trick 10 checkpoint file into multiple parts.
  This class generates C++ output streams that write the section markers and
  that other objects can use to write checkpoint file section data.
+
+ By default sections are written as the text that the writers produce.
+ With the binary format enabled, the manager instead collects each section
+ in memory as a sequence of records (see SectionedOutputStream::end_record),
+ and writes it as a CheckPointSectionCodec payload, optionally compressed.
+ Given a CheckPointRecordHistory, records whose content is unchanged since
+ the checkpoint that last stored them are written as references to that
+ earlier file, making the checkpoint incremental. The Trick section is
+ always written as text.
+
+ With asynchronous writing enabled, every section is collected in memory
+ when its writer is deactivated. The collected content is the snapshot of
+ the simulation state; encoding, compression, and file output are deferred
+ until start_background_write, which performs them on a background thread
+ so that the simulation can resume as soon as the sections are collected.
+ The destructor waits for the background thread to finish.
  */
 class CheckPointOutputManager {
 friend class MemoryManagerWrapper;
+friend class SectionedOutputStream;
 
 public:
 
@@ -286,6 +399,9 @@ public:
                            const std::string & start_marker,
                            const std::string & end_marker);
 
+   // Destructor.
+   ~CheckPointOutputManager ();
+
    /**
     Create a C++ output stream that writes a checkpoint file section.
     @return Constructed SectionedOutputStream.
@@ -315,10 +431,90 @@ public:
    // Denote a writer as no longer being *the* currently active writer.
    bool deregister_writer (const SectionedOutputStream * writer);
 
+   // Write subsequent sections in binary form.
+   void enable_binary_format (bool compress_records,
+                              CheckPointRecordHistory * record_history);
+
+   /**
+    Are sections written in binary form?
+    @return True if the binary format is enabled.
+   */
+   bool is_binary () const
+   { return binary; }
+
+   // Defer writing sections until start_background_write is called.
+   void enable_asynchronous_write ();
+
+   /**
+    Are sections collected in memory and written in the background?
+    @return True if asynchronous writing is enabled.
+   */
+   bool is_asynchronous () const
+   { return asynchronous; }
+
+   // Write the deferred sections to the file on a background thread.
+   bool start_background_write ();
+
+   // Wait for the background thread to finish writing the file.
+   bool wait_for_background_write ();
+
 private:
 
+   // Types
+
+   /**
+    Records (key, content) of a binary section.
+    */
+   typedef std::vector<std::pair<std::string, std::string> > RecordList;
+
+   /**
+    A section whose output is deferred until the background write.
+    */
+   struct DeferredSection {
+      /**
+       * Section name.
+       */
+      std::string tag; //!< trick_io(**)
+
+      /**
+       * Is the section written in binary form?
+       */
+      bool binary; //!< trick_io(**)
+
+      /**
+       * Content of a text section.
+       */
+      std::string content; //!< trick_io(**)
+
+      /**
+       * Records of a binary section.
+       */
+      RecordList records; //!< trick_io(**)
+   };
+
+
    // Member functions
 
+   // End the current record of the binary section being written.
+   void end_record (const std::string & key);
+
+   // Complete a section collected in memory.
+   void end_section (const std::string & tag, bool binary_section);
+
+   // Write a text section to the file.
+   void write_text_section (const std::string & tag,
+                            const std::string & content);
+
+   // Write a binary section to the file.
+   void write_binary_section (const std::string & tag,
+                              const RecordList & section_records);
+
+   // Write the deferred sections to the file.
+   void write_deferred_sections ();
+
+   // Background thread entry point.
+   static void * background_write_main (void * manager);
+
    // Create a C++ output stream that writes a checkpoint file section.
    SectionedOutputStream create_section_writer (
       bool trick,
@@ -364,6 +560,51 @@ private:
     */
    bool is_open; //!< trick_io(**)
 
+   /**
+    * Are sections written in binary form?
+    */
+   bool binary; //!< trick_io(**)
+
+   /**
+    * Are binary section records compressed?
+    */
+   bool compress; //!< trick_io(**)
+
+   /**
+    * Record history for incremental checkpoints, null for full checkpoints.
+    */
+   CheckPointRecordHistory * history; //!< trick_io(**)
+
+   /**
+    * Content written to the current binary record so far.
+    */
+   std::string pending; //!< trick_io(**)
+
+   /**
+    * Completed records (key, content) of the current binary section.
+    */
+   RecordList records; //!< trick_io(**)
+
+   /**
+    * Are sections deferred and written in the background?
+    */
+   bool asynchronous; //!< trick_io(**)
+
+   /**
+    * Sections awaiting the background write.
+    */
+   std::vector<DeferredSection> deferred; //!< trick_io(**)
+
+   /**
+    * Is the background thread running (or not yet joined)?
+    */
+   bool background_active; //!< trick_io(**)
+
+   /**
+    * The background thread.
+    */
+   pthread_t background_thread; //!< trick_io(**)
+
 
    // Deleted contents.
 
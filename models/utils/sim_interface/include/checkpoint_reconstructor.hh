@@ -0,0 +1,135 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/checkpoint_reconstructor.hh
+ * Define the abstract class JeodCheckpointReconstructor, which rebuilds the
+ * contents of allocations that are not written to a checkpoint file.
+ */
+
+/*******************************************************************************
+
+Purpose:
+   ()
+
+Library dependencies:
+   ((../src/checkpoint_reconstructor.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_CHECKPOINT_RECONSTRUCTOR_HH
+#define JEOD_CHECKPOINT_RECONSTRUCTOR_HH
+
+// System includes
+#include <cstddef>
+#include <string>
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodCheckpointReconstructor rebuilds the contents of a reconstructible
+ * allocation after a restart.
+ *
+ * An allocation whose contents are immutable once computed, or that can be
+ * recomputed from some original data source (a coefficient file, a table
+ * tabulated from model parameters), can be marked reconstructible with
+ * JEOD_SET_RECONSTRUCTIBLE. A checkpoint then records the allocation and a
+ * reference to its data source plus a hash of its contents rather than the
+ * contents themselves. On restart the allocation is recreated and the
+ * reconstructor registered under the reference is asked to refill it; the
+ * refilled contents are checked against the recorded hash.
+ *
+ * The reference identifies the data source across runs and must therefore
+ * be derived from something that does not change from run to run, such as
+ * the simulation name of the owning object. A reconstructor must outlive
+ * the allocations it reconstructs; the destructor withdraws it.
+ */
+class JeodCheckpointReconstructor {
+
+public:
+
+   // Constructor and destructor.
+   JeodCheckpointReconstructor ();
+   virtual ~JeodCheckpointReconstructor ();
+
+   /**
+    * Rebuild the contents of a reconstructible allocation.
+    * \param[in] reference  Reference the allocation was marked with
+    * \param[in] addr       The recreated allocation
+    * \param[in] size       Size of the allocation, in bytes
+    * \return True if the contents were rebuilt
+    */
+   virtual bool reconstruct_contents (
+      const std::string & reference,
+      void * addr,
+      std::size_t size) = 0;
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   JeodCheckpointReconstructor (const JeodCheckpointReconstructor &);
+
+   /**
+    * Not implemented.
+    */
+   JeodCheckpointReconstructor & operator= (
+      const JeodCheckpointReconstructor &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
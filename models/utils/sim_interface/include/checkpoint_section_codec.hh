@@ -0,0 +1,223 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/checkpoint_section_codec.hh
+ * Define class CheckPointSectionCodec, which encodes and decodes the
+ * contents of binary checkpoint file sections.
+ */
+
+/*
+ PURPOSE: ()
+*/
+
+
+#ifndef JEOD_CHECKPOINTSECTIONCODEC_HH
+#define JEOD_CHECKPOINTSECTIONCODEC_HH
+
+// System includes
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ A CheckPointSectionCodec converts between the records that make up a binary
+ checkpoint file section and the byte payload stored in the file.
+
+ A binary section comprises the section start marker, a header line
+ "<binary_tag> <version> <payload size>", the payload, and the section end
+ marker. The payload is a sequence of records, each identified by a key that
+ is unique within the section and carrying a 64 bit hash of its content.
+ A data record carries the content, raw or compressed. A reference record
+ carries only the name of an earlier checkpoint file whose section of the
+ same name holds a data record with the same key and hash; incremental
+ checkpoints use references for content that did not change.
+
+ All members are static. This class is not instantiable.
+ */
+class CheckPointSectionCodec {
+
+public:
+
+   // Types
+
+   /**
+    A Record is one decoded record of a binary checkpoint section.
+    */
+   struct Record {
+
+      /**
+       * Key that identifies the record within its section.
+       */
+      std::string key; //!< trick_io(**)
+
+      /**
+       * FNV-1a hash of the uncompressed content.
+       */
+      uint64_t hash; //!< trick_io(**)
+
+      /**
+       * True for a reference record, false for a data record.
+       */
+      bool is_reference; //!< trick_io(**)
+
+      /**
+       * Reference records: The checkpoint file that holds the content.
+       * Data records: The uncompressed content.
+       */
+      std::string value; //!< trick_io(**)
+
+      /**
+       * Default constructor.
+       */
+      Record ()
+      : key(), hash(0), is_reference(false), value() {}
+   };
+
+
+   // Static data
+
+   /**
+    * Leading word of the header line of a binary section.
+    */
+   static const char * binary_tag; //!< trick_io(**)
+
+   /**
+    * Payload format version written in the header line.
+    */
+   static const unsigned int format_version = 1; //!< trick_io(**)
+
+
+   // Static member functions
+
+   // Compute the 64 bit FNV-1a hash of a byte string.
+   static uint64_t hash (const std::string & data);
+   static uint64_t hash (const void * data, std::size_t size);
+
+   // Append a data record to a payload.
+   static void encode_data_record (
+      const std::string & key,
+      uint64_t content_hash,
+      const std::string & content,
+      bool compress,
+      std::string & payload);
+
+   // Append a reference record to a payload.
+   static void encode_reference_record (
+      const std::string & key,
+      uint64_t content_hash,
+      const std::string & file,
+      std::string & payload);
+
+   // Split a payload into records, decompressing data records.
+   static bool decode_records (
+      const std::string & payload,
+      std::vector<Record> & records);
+
+   // Split a payload held in memory into records.
+   static bool decode_records (
+      const char * data,
+      std::size_t size,
+      std::vector<Record> & records);
+
+   // Compress a byte string.
+   static void compress (const std::string & input, std::string & output);
+
+   // Decompress a byte string produced by compress.
+   static bool decompress (
+      const char * input,
+      std::size_t input_size,
+      std::size_t output_size,
+      std::string & output);
+
+
+private:
+
+   // Append a variable-length unsigned integer to a byte string.
+   static void put_varint (uint64_t value, std::string & output);
+
+   // Extract a variable-length unsigned integer from a byte range.
+   static bool get_varint (
+      const char * data, std::size_t size, std::size_t & pos,
+      uint64_t & value);
+
+   // Append the fields common to data and reference records.
+   static void put_record_head (
+      char kind,
+      const std::string & key,
+      uint64_t content_hash,
+      std::string & payload);
+
+
+   // Deleted contents
+
+   /**
+    Not implemented.
+    */
+   CheckPointSectionCodec ();
+
+   /**
+    Not implemented.
+    */
+   CheckPointSectionCodec (const CheckPointSectionCodec &);
+
+   /**
+    Not implemented.
+    */
+   CheckPointSectionCodec & operator= (const CheckPointSectionCodec &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -63,9 +63,24 @@ Purpose:
 //! Namespace jeod
 namespace jeod {
 
+class DataModuleLoader;
+class EmbeddedMessageHandler;
+class JeodBranchDispersion;
+class JeodBranchDriver;
+class JeodCheckpointReconstructor;
+class JeodEmbeddedMemoryInterface;
+class JeodEmbeddedSimInterface;
+class JeodGraphFunctionTask;
+class JeodGraphTask;
+class JeodInitializationPhase;
 class JeodMemoryInterface;
+class JeodParallelIntegrationLoops;
+class JeodProfileGroupScope;
+class JeodProfileTimer;
+class JeodProfiler;
 class JeodSimulationInterface;
 class JeodSimulationInterfaceInit;
+class JeodTaskGraph;
 class JeodTrickMemoryInterface;
 class JeodTrickSimInterface;
 class SimInterfaceMessages;
@@ -64,11 +64,11 @@ Purpose:
 #include "config_trick10.hh"
 
 // Standalone JEOD unit tests use the test harness configuration.
-#elif (defined JEOD_UNIT_TEST)
+// Applications that embed JEOD without a simulation engine (see
+// JeodEmbeddedSimInterface) have the same needs and use it as well.
+#elif (defined JEOD_UNIT_TEST) || (defined JEOD_EMBEDDED)
 #include "config_test_harness.hh"
 
-// FUTURE, if needed: configure for the non-Trick demo capability.
-
 
 // Non-Trick installations should consolidate requisite configuration
 // information in a single header file and compile JEOD with
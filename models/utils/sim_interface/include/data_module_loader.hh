@@ -0,0 +1,165 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/data_module_loader.hh
+ * Define the class DataModuleLoader, which initializes a model object from
+ * a separately built, dynamically loaded data module.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((A data module is a shared library named libjeod_data_<name>.so that
+    exports an entry point jeod_data_initialize_<type> for the type of object
+    it initializes. The JEOD_DATA_MODULES build option generates these
+    modules from the default data sources.)
+   (Loaded modules are never unloaded.))
+
+Library dependencies:
+  ((../src/data_module_loader.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_DATA_MODULE_LOADER_HH
+#define JEOD_DATA_MODULE_LOADER_HH
+
+// System includes
+#include <string>
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Initializes model objects from data modules, the separately built shared
+ * libraries that each hold one default data set (a gravity field, a time
+ * conversion table, a polar motion table, ...). A simulation loads only the
+ * data sets its input file names rather than linking all of them.
+ *
+ * A module name without a slash is resolved by looking for
+ * libjeod_data_<name>.so in the colon-separated directories named by the
+ * JEOD_DATA_MODULE_PATH environment variable and then through the dynamic
+ * loader's own search path. A name with a slash is a path to the library.
+ */
+class DataModuleLoader {
+
+ // Static member data
+ public:
+
+   /**
+    * Environment variable that lists the directories searched for modules.
+    */
+   static char const * search_path_variable; //!< trick_units(--)
+
+
+ // Static member functions
+ public:
+
+   /**
+    * Initialize an object from a data module.
+    * The module must have been generated for the type named by target_type.
+    * \param[in] module_name Data module name or path
+    * \param[in] target_type Name of the class of the target
+    * \param[in,out] target Object to be initialized
+    */
+   template <typename TargetType>
+   static void initialize (
+      const std::string & module_name,
+      const char * target_type,
+      TargetType * target)
+   {
+      initialize_object (module_name, target_type, static_cast<void *>(target));
+   }
+
+   // Initialize the object at target from a data module.
+   static void initialize_object (
+      const std::string & module_name,
+      const char * target_type,
+      void * target);
+
+   // Name of the entry point a module exports for the given type.
+   static std::string entry_point_name (const char * target_type);
+
+   // File name of the library that holds the named module.
+   static std::string library_name (const std::string & module_name);
+
+
+ // Member functions
+ // This class is not instantiable.
+ // The constructors and assignment operator for this class are declared
+ // private and are not implemented.
+ private:
+   DataModuleLoader (void);
+   DataModuleLoader (const DataModuleLoader &);
+   DataModuleLoader & operator= (const DataModuleLoader &);
+
+ // Static member functions
+ private:
+
+   // Open (or find the already open) library for the named module.
+   static void * open_module (const std::string & module_name);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,268 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/embedded_memory_interface.hh
+ * Define the class JeodEmbeddedMemoryInterface.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Checkpoint/restart and address/name translation are not supported.))
+
+Library dependencies:
+  ((../src/memory_interface.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_EMBEDDED_MEMORY_INTERFACE_HH
+#define JEOD_EMBEDDED_MEMORY_INTERFACE_HH
+
+// System includes
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+
+// Model includes
+#include "jeod_class.hh"
+#include "memory_interface.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodEmbeddedMemoryInterface specializes the JeodMemoryInterface for use
+ * without a simulation engine. There is no engine to describe allocations
+ * to, so there are no attributes to translate and nothing to register:
+ * an allocation costs only the memory manager's own bookkeeping.
+ */
+class JeodEmbeddedMemoryInterface : public JeodMemoryInterface {
+JEOD_MAKE_SIM_INTERFACES(JeodEmbeddedMemoryInterface)
+
+public:
+
+   // Member functions
+
+   /**
+    * Default constructor.
+    */
+   JeodEmbeddedMemoryInterface ()
+   :
+      JeodMemoryInterface()
+   {}
+
+   /**
+    * Destructor.
+    */
+   ~JeodEmbeddedMemoryInterface () override {}
+
+   /**
+    * Find the attributes for a given class name.
+    * @return Null; there are no attributes.
+    */
+   const JEOD_ATTRIBUTES_POINTER_TYPE find_attributes (
+      const std::string & type_name JEOD_UNUSED) const override
+   {
+      return nullptr;
+   }
+
+   /**
+    * Find the attributes for a given class.
+    * @return Null; there are no attributes.
+    */
+   const JEOD_ATTRIBUTES_POINTER_TYPE find_attributes (
+      const std::type_info & data_type JEOD_UNUSED) const override
+   {
+      return nullptr;
+   }
+
+   /**
+    * Create an attributes structure that represents a primitive type.
+    * @return Empty attributes.
+    */
+   JEOD_ATTRIBUTES_TYPE primitive_attributes (
+      const std::type_info & data_type JEOD_UNUSED) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   /**
+    * Create an attributes structure that represents a pointer type.
+    * @return Empty attributes.
+    */
+   JEOD_ATTRIBUTES_TYPE pointer_attributes (
+      const JEOD_ATTRIBUTES_TYPE & pointed_to_attr JEOD_UNUSED) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   /**
+    * Create a simulation engine description of void*.
+    * @return Empty attributes.
+    */
+   JEOD_ATTRIBUTES_TYPE void_pointer_attributes (void) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   /**
+    * Create an attributes structure that represents a structured type.
+    * @return Empty attributes.
+    */
+   JEOD_ATTRIBUTES_TYPE structure_attributes (
+      const JEOD_ATTRIBUTES_POINTER_TYPE target_attr JEOD_UNUSED,
+      std::size_t target_size JEOD_UNUSED) const override
+   {
+      return JEOD_ATTRIBUTES_TYPE();
+   }
+
+   /**
+    * Register allocated memory; there is nothing to register with.
+    * @return True.
+    */
+   bool register_allocation (
+      const void * addr JEOD_UNUSED,
+      const JeodMemoryItem & item JEOD_UNUSED,
+      const JeodMemoryTypeDescriptor & tdesc JEOD_UNUSED,
+      const char * file JEOD_UNUSED,
+      unsigned int line JEOD_UNUSED) override
+   {
+      return true;
+   }
+
+   /**
+    * Revoke registation of memory; there is nothing to revoke.
+    */
+   void deregister_allocation (
+      const void * addr JEOD_UNUSED,
+      const JeodMemoryItem & item JEOD_UNUSED,
+      const JeodMemoryTypeDescriptor & tdesc JEOD_UNUSED,
+      const char * file JEOD_UNUSED,
+      unsigned int line JEOD_UNUSED) override
+   {}
+
+   /**
+    * Register a checkpointable object; there is no checkpoint to write.
+    */
+   void register_container (
+      const void * container JEOD_UNUSED,
+      const JeodMemoryTypeDescriptor & container_type JEOD_UNUSED,
+      const char * elem_name JEOD_UNUSED,
+      JeodCheckpointable & checkpointable JEOD_UNUSED) override
+   {}
+
+   /**
+    * Deregister a checkpointable object.
+    */
+   void deregister_container (
+      const void * container JEOD_UNUSED,
+      const JeodMemoryTypeDescriptor & container_type JEOD_UNUSED,
+      const char * elem_name JEOD_UNUSED,
+      JeodCheckpointable & checkpointable JEOD_UNUSED) override
+   {}
+
+   /**
+    * Indicates whether the checkpoint/restart methods are viable.
+    * @return False.
+    */
+   bool is_checkpoint_restart_supported (void) const override
+   {
+      return false;
+   }
+
+   /**
+    * Get the simulation engine's name of the address.
+    * @return Empty string; names are not supported.
+    */
+   const std::string get_name_at_address (
+      const void * addr JEOD_UNUSED,
+      const JeodMemoryTypeDescriptor * tdesc JEOD_UNUSED) const override
+   {
+      return std::string();
+   }
+
+   /**
+    * Get the address identified by the given name.
+    * @return Null; names are not supported.
+    */
+   void * get_address_at_name (
+      const std::string & name JEOD_UNUSED) const override
+   {
+      return nullptr;
+   }
+
+
+private:
+
+   // The copy constructor and assignment operator for this class are declared
+   // private and are not implemented.
+
+   /**
+    * Not implemented.
+    */
+   JeodEmbeddedMemoryInterface (const JeodEmbeddedMemoryInterface &);
+
+   /**
+    * Not implemented.
+    */
+   JeodEmbeddedMemoryInterface & operator= (
+      const JeodEmbeddedMemoryInterface &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
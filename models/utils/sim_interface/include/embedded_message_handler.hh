@@ -0,0 +1,194 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/embedded_message_handler.hh
+ * Define the class EmbeddedMessageHandler, the message handler designed for
+ * use when JEOD is embedded in an application without a simulation engine.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((A failure terminates the process unless the sink throws.))
+
+Library dependencies:
+  ((../src/embedded_message_handler.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_EMBEDDED_MESSAGE_HANDLER_HH
+#define JEOD_EMBEDDED_MESSAGE_HANDLER_HH
+
+// System includes
+#include <cstdarg>
+
+// JEOD includes
+#include "utils/message/include/suppressed_code_message_handler.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * The MessageHandler class designed for use when JEOD is embedded in an
+ * application. Suppressed messages are dropped before they are formatted,
+ * and the formatted messages go to an application-supplied sink rather
+ * than to a simulation engine.
+ */
+class EmbeddedMessageHandler: public SuppressedCodeMessageHandler {
+   JEOD_MAKE_SIM_INTERFACES(EmbeddedMessageHandler)
+
+public:
+
+   // Types
+
+   /**
+    * A function that receives formatted messages.
+    * A failure (negative severity) terminates the process once the sink
+    * returns; a sink that must keep the process alive can throw instead.
+    * \param[in] context  The context supplied with the sink
+    * \param[in] severity Severity level
+    * \param[in] msg_code Message code
+    * \param[in] text     Formatted message
+    */
+   typedef void (*MessageSink) (
+      void * context, int severity, const char * msg_code, const char * text);
+
+
+   // Member functions
+
+   // Default constructor and destructor
+
+   /**
+    * Default constructor. Messages are written to standard error.
+    */
+   EmbeddedMessageHandler (void)
+   :
+      sink(nullptr),
+      sink_context(nullptr)
+   {}
+
+   /**
+    * Destructor.
+    */
+   ~EmbeddedMessageHandler (void) override {}
+
+   // register_contents() registers the checkpointable contents.
+   void register_contents (void) override;
+
+   /**
+    * Send formatted messages to a sink.
+    * \param[in] new_sink    The sink, or null to write to standard error
+    * \param[in] new_context Context passed to the sink
+    */
+   void set_sink (MessageSink new_sink, void * new_context)
+   {
+      sink = new_sink;
+      sink_context = new_context;
+   }
+
+
+ protected:
+
+   // Member functions
+
+   // process_message() handles all messages.
+   void process_message (
+      int severity,
+      const char * prefix,
+      const char * file,
+      unsigned int line,
+      const char * msg_code,
+      const char * format,
+      va_list args)
+   const override;
+
+
+   // Member data
+
+   /**
+    * The function that receives formatted messages.
+    */
+   MessageSink sink; //!< trick_io(**)
+
+   /**
+    * Context passed to the sink.
+    */
+   void * sink_context; //!< trick_io(**)
+
+
+ // The copy constructor and assignment operator for this class are declared
+ // private and are not implemented.
+ private:
+
+   /**
+    * Not implemented.
+    */
+   EmbeddedMessageHandler (const EmbeddedMessageHandler &);
+
+   /**
+    * Not implemented.
+    */
+   EmbeddedMessageHandler & operator= (const EmbeddedMessageHandler &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
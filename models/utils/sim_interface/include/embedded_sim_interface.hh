@@ -0,0 +1,201 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/embedded_sim_interface.hh
+ * Define the class JeodEmbeddedSimInterface.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((JEOD is driven by the application, e.g. through
+    JeodStandaloneIntegrationLoop, rather than by a simulation engine.)
+   (Checkpoint/restart is not supported.))
+
+Library dependencies:
+  ((../src/embedded_sim_interface.cc))
+
+ 
+
+*******************************************************************************/
+
+#ifndef JEOD_EMBEDDED_SIM_INTERFACE_HH
+#define JEOD_EMBEDDED_SIM_INTERFACE_HH
+
+// System includes
+#include <string>
+
+// JEOD includes
+#include "utils/memory/include/memory_manager.hh"
+
+// Model includes
+#include "embedded_memory_interface.hh"
+#include "embedded_message_handler.hh"
+#include "jeod_class.hh"
+#include "simulation_interface.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodEmbeddedSimInterface implements the required capabilities of the
+ * generic JeodSimulationInterface for an application that embeds JEOD
+ * without a simulation engine, e.g. a service that steps its own
+ * JeodStandaloneIntegrationLoop objects. By virtue of member data
+ * ownership, the class creates the requisite MessageHandler and
+ * MemoryManager and does so in the correct order.
+ *
+ * As with any JeodSimulationInterface, there is one per process; every
+ * simulation the application runs shares it.
+ */
+class JeodEmbeddedSimInterface : public JeodSimulationInterface {
+JEOD_MAKE_SIM_INTERFACES(JeodEmbeddedSimInterface)
+
+public:
+
+   // Methods
+
+   // Constructors and destructor
+   JeodEmbeddedSimInterface ();
+   explicit JeodEmbeddedSimInterface (
+      const JeodSimulationInterfaceInit & config);
+   ~JeodEmbeddedSimInterface () override;
+
+   // Set the mode.
+   void set_mode (JeodSimulationInterface::Mode new_mode) override;
+
+   /**
+    * Get the message handler, e.g. to give it a sink or to suppress codes.
+    * @return The message handler
+    */
+   EmbeddedMessageHandler & get_message_handler ()
+   {
+      return message_handler;
+   }
+
+   /**
+    * Set the value reported as the cycle time of the executing job.
+    * \param[in] cycle Cycle time\n Units: s
+    */
+   void set_job_cycle (double cycle)
+   {
+      job_cycle = cycle;
+   }
+
+
+protected:
+
+   // Member functions
+
+   // Create an integration interface object.
+   JeodIntegratorInterface * create_integrator_internal (
+      void) override;
+
+   // Get the currently executing function's cycle time.
+   double get_job_cycle_internal (void) override;
+
+   // Get the interface with the simulation memory manager.
+   JeodMemoryInterface & get_memory_interface_internal (void) override;
+
+   // Get a checkpoint section reader.
+   SectionedInputStream get_checkpoint_reader_internal (
+      const std::string & section_id) override;
+
+   // Get a checkpoint section writer.
+   SectionedOutputStream get_checkpoint_writer_internal (
+      const std::string & section_id) override;
+
+
+   // Member data
+
+   /**
+    * The global MessageHandler.
+    */
+   EmbeddedMessageHandler message_handler; //!< trick_io(**)
+
+   /**
+    * The interface between JEOD and the (absent) simulation engine.
+    */
+   JeodEmbeddedMemoryInterface memory_interface; //!< trick_io(**)
+
+   /**
+    * The global JEOD memory manager.
+    */
+   JeodMemoryManager memory_manager; //!< trick_io(**)
+
+   /**
+    * The value reported as the cycle time of the executing job.
+    */
+   double job_cycle; //!< trick_units(s)
+
+
+private:
+
+   // The parent SimulationInterface hides the copy constructor and
+   // assignment operator. These are hidden here as well.
+
+   /**
+    * Not implemented.
+    */
+   JeodEmbeddedSimInterface (const JeodEmbeddedSimInterface &);
+
+   /**
+    * Not implemented.
+    */
+   JeodEmbeddedSimInterface & operator= (const JeodEmbeddedSimInterface &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,369 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/fidelity_controller.hh
+ * Define the classes JeodFidelityStep, JeodFidelityFunctionStep, and
+ * JeodFidelityController, which trade model fidelity for frame time in
+ * real-time simulations.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/fidelity_controller.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_FIDELITY_CONTROLLER_HH
+#define JEOD_FIDELITY_CONTROLLER_HH
+
+// System includes
+#include <functional>
+#include <string>
+#include <vector>
+
+// Model includes
+#include "jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodFidelityStep is one rung of a JeodFidelityController's degradation
+ * ladder, e.g., lowering the degree of a gravity field. A step records
+ * whatever it needs to undo its degradation.
+ */
+class JeodFidelityStep {
+JEOD_MAKE_SIM_INTERFACES(JeodFidelityStep)
+
+public:
+
+   /**
+    * Default constructor.
+    */
+   JeodFidelityStep (void) {}
+
+   /**
+    * Destructor.
+    */
+   virtual ~JeodFidelityStep (void) {}
+
+   /**
+    * Lower the fidelity of the models affected by this step.
+    */
+   virtual void degrade (void) = 0;
+
+   /**
+    * Undo the most recent degrade().
+    */
+   virtual void restore (void) = 0;
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   JeodFidelityStep (const JeodFidelityStep &);
+
+   /**
+    * Not implemented.
+    */
+   JeodFidelityStep & operator= (const JeodFidelityStep &);
+};
+
+
+/**
+ * A JeodFidelityFunctionStep calls a pair of function objects, typically
+ * lambdas that change a model setting and change it back.
+ */
+class JeodFidelityFunctionStep : public JeodFidelityStep {
+public:
+
+   /**
+    * Constructor.
+    * @param degrade_in The function that lowers the fidelity.
+    * @param restore_in The function that restores the fidelity.
+    */
+   JeodFidelityFunctionStep (
+      const std::function<void (void)> & degrade_in,
+      const std::function<void (void)> & restore_in)
+   :
+      degrade_function(degrade_in),
+      restore_function(restore_in)
+   { }
+
+   /**
+    * Destructor.
+    */
+   virtual ~JeodFidelityFunctionStep (void) {}
+
+   /**
+    * Call the degrade function.
+    */
+   virtual void degrade (void)
+   {
+      degrade_function ();
+   }
+
+   /**
+    * Call the restore function.
+    */
+   virtual void restore (void)
+   {
+      restore_function ();
+   }
+
+private:
+
+   /**
+    * The function called by degrade().
+    */
+   std::function<void (void)> degrade_function; //!< trick_io(**)
+
+   /**
+    * The function called by restore().
+    */
+   std::function<void (void)> restore_function; //!< trick_io(**)
+
+   /**
+    * Not implemented.
+    */
+   JeodFidelityFunctionStep (const JeodFidelityFunctionStep &);
+
+   /**
+    * Not implemented.
+    */
+   JeodFidelityFunctionStep & operator= (const JeodFidelityFunctionStep &);
+};
+
+
+/**
+ * A JeodFidelityController keeps a real-time simulation within its frame
+ * budget by walking a ladder of fidelity steps. The steps are applied in
+ * the order in which they were added and undone in reverse order; the
+ * level is the number of steps applied.
+ *
+ * The controller compares the wall time of each frame with the budget:
+ *  - After degrade_frames consecutive frames longer than
+ *    degrade_fraction * frame_budget, the next step is applied.
+ *  - After restore_frames consecutive frames shorter than
+ *    restore_fraction * frame_budget, the last step applied is undone.
+ * Counting restarts at each transition, so the controller moves one rung
+ * at a time and the steps' effect on the frame time is seen before the
+ * next move. Every transition is reported as an informational message.
+ *
+ * Usage: Add the steps with add_step(), then either call start_frame() at
+ * the top of each frame and end_frame() at its end, or pass externally
+ * measured frame times to record_frame_time().
+ *
+ * \par Assumptions and Limitations
+ *  - The controller does not own the steps.
+ *  - The steps are applied on the calling thread, between frames.
+ */
+class JeodFidelityController {
+JEOD_MAKE_SIM_INTERFACES(JeodFidelityController)
+
+public:
+
+   // Member data
+
+   /**
+    * Wall time available to a frame. The controller is inert unless this
+    * is positive.
+    */
+   double frame_budget; //!< trick_units(s)
+
+   /**
+    * Fraction of the budget above which a frame counts as an overrun.
+    * The default is 0.9.
+    */
+   double degrade_fraction; //!< trick_units(--)
+
+   /**
+    * Fraction of the budget below which a frame counts as having slack.
+    * The default is 0.5.
+    */
+   double restore_fraction; //!< trick_units(--)
+
+   /**
+    * Number of consecutive overruns that trigger a degradation.
+    * The default is 1.
+    */
+   unsigned int degrade_frames; //!< trick_units(--)
+
+   /**
+    * Number of consecutive frames with slack that trigger a restoration.
+    * The default is 50.
+    */
+   unsigned int restore_frames; //!< trick_units(--)
+
+   /**
+    * Is the controller active? An inactive controller neither degrades
+    * nor restores, but leaves the current level in place.
+    */
+   bool active; //!< trick_units(--)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   JeodFidelityController (void);
+   ~JeodFidelityController (void);
+
+   // Add a step to the end of the ladder.
+   void add_step (JeodFidelityStep & step, const std::string & name);
+
+   // Mark the start of a frame.
+   void start_frame (void);
+
+   // Mark the end of a frame and assess its wall time.
+   void end_frame (void);
+
+   // Assess the wall time of a frame.
+   void record_frame_time (double frame_time);
+
+   // Move directly to a level.
+   void set_level (unsigned int new_level);
+
+   /**
+    * Get the number of steps applied.
+    * @return Level.
+    */
+   unsigned int get_level (void) const
+   { return level; }
+
+   /**
+    * Get the number of steps in the ladder.
+    * @return Step count.
+    */
+   unsigned int get_num_steps (void) const
+   { return steps.size(); }
+
+   /**
+    * Get the wall time of the most recently assessed frame.
+    * @return Frame time.
+    */
+   double get_last_frame_time (void) const
+   { return last_frame_time; }
+
+
+protected:
+
+   // Member data
+
+   /**
+    * The ladder of steps.
+    */
+   std::vector<JeodFidelityStep *> steps; //!< trick_io(**)
+
+   /**
+    * Step names, for the transition messages.
+    */
+   std::vector<std::string> step_names; //!< trick_io(**)
+
+   /**
+    * Number of steps applied.
+    */
+   unsigned int level; //!< trick_units(--)
+
+   /**
+    * Consecutive overruns since the last transition.
+    */
+   unsigned int overrun_count; //!< trick_units(--)
+
+   /**
+    * Consecutive frames with slack since the last transition.
+    */
+   unsigned int slack_count; //!< trick_units(--)
+
+   /**
+    * Monotonic clock reading at start_frame(), nanoseconds.
+    */
+   unsigned long long frame_start; //!< trick_io(**)
+
+   /**
+    * Wall time of the most recently assessed frame.
+    */
+   double last_frame_time; //!< trick_units(s)
+
+   /**
+    * Number of level changes.
+    */
+   unsigned int num_transitions; //!< trick_units(--)
+
+
+private:
+
+   // Apply or undo one step and report the transition.
+   void degrade_one (const char * reason);
+   void restore_one (const char * reason);
+
+   /**
+    * Not implemented.
+    */
+   JeodFidelityController (const JeodFidelityController &);
+
+   /**
+    * Not implemented.
+    */
+   JeodFidelityController & operator= (const JeodFidelityController &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
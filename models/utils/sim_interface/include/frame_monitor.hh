@@ -0,0 +1,357 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/frame_monitor.hh
+ * Define the classes JeodFrameStatistics and JeodFrameMonitor, which
+ * record frame-time distributions and in-frame page faults and allocations
+ * for real-time simulations.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/frame_monitor.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_FRAME_MONITOR_HH
+#define JEOD_FRAME_MONITOR_HH
+
+// System includes
+#include <string>
+#include <vector>
+
+// Model includes
+#include "jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Summary of a distribution of frame or phase times.
+ * Percentiles are resolved to within 1/16 of their value.
+ */
+class JeodFrameStatistics {
+JEOD_MAKE_SIM_INTERFACES(JeodFrameStatistics)
+
+public:
+
+   /**
+    * Number of samples.
+    */
+   unsigned long long count; //!< trick_units(count)
+
+   /**
+    * Mean time.
+    */
+   double mean; //!< trick_units(s)
+
+   /**
+    * Median time.
+    */
+   double p50; //!< trick_units(s)
+
+   /**
+    * 99th percentile time.
+    */
+   double p99; //!< trick_units(s)
+
+   /**
+    * 99.9th percentile time.
+    */
+   double p999; //!< trick_units(s)
+
+   /**
+    * Longest time.
+    */
+   double max; //!< trick_units(s)
+
+   /**
+    * Default constructor.
+    */
+   JeodFrameStatistics (void)
+   :
+      count(0),
+      mean(0.0),
+      p50(0.0),
+      p99(0.0),
+      p999(0.0),
+      max(0.0)
+   { }
+};
+
+
+/**
+ * A JeodFrameMonitor records the wall time of each frame of a real-time
+ * simulation, broken down by phase (e.g., environment, gravity,
+ * integration), along with the page faults incurred and the JEOD
+ * allocations made during the frame.
+ *
+ * The simulation thread marks the frame with start_frame(), end_phase()
+ * and end_frame(). These read the monotonic clock, and optionally the
+ * thread's page fault counts, and push a fixed-size record onto a lock-free
+ * single-producer, single-consumer ring; they neither lock nor allocate.
+ * Another job, typically a non-real-time logging job or thread, calls
+ * collect() to drain the ring into log-linear histograms and to refresh the
+ * statistics members, which can be logged through the simulation interface.
+ *
+ * \par Assumptions and Limitations
+ *  - One thread marks the frames and one thread calls collect().
+ *  - Allocations are counted through JeodMemoryManager; memory obtained
+ *    otherwise is not seen.
+ *  - Records that find the ring full are counted and dropped.
+ */
+class JeodFrameMonitor {
+JEOD_MAKE_SIM_INTERFACES(JeodFrameMonitor)
+
+public:
+
+   // Constants
+
+   /**
+    * Maximum number of phases.
+    */
+   static const unsigned int max_phases = 8; //!< trick_io(**)
+
+
+   // Member data
+
+   /**
+    * Record frames? Frames marked while inactive are ignored.
+    */
+   bool active; //!< trick_units(--)
+
+   /**
+    * Read the thread's page fault counts at the start and end of each
+    * frame? Each read is a system call.
+    */
+   bool track_page_faults; //!< trick_units(--)
+
+   /**
+    * Frames longer than this count as overruns; zero disables the count.
+    */
+   double overrun_threshold; //!< trick_units(s)
+
+   /**
+    * Number of records the ring holds. Rounded up to a power of two when
+    * the first frame is recorded.
+    */
+   unsigned int ring_slots; //!< trick_units(count)
+
+   /**
+    * Frame time statistics, as of the last collect().
+    */
+   JeodFrameStatistics frame_stats; //!< trick_units(--)
+
+   /**
+    * Phase time statistics, as of the last collect().
+    */
+   JeodFrameStatistics phase_stats[max_phases]; //!< trick_units(--)
+
+   /**
+    * Number of frames collected.
+    */
+   unsigned long long num_frames; //!< trick_units(count)
+
+   /**
+    * Number of collected frames longer than overrun_threshold.
+    */
+   unsigned long long num_overruns; //!< trick_units(count)
+
+   /**
+    * Number of collected frames that incurred page faults.
+    */
+   unsigned long long num_fault_frames; //!< trick_units(count)
+
+   /**
+    * Minor page faults incurred in collected frames.
+    */
+   unsigned long long num_minor_faults; //!< trick_units(count)
+
+   /**
+    * Major page faults incurred in collected frames.
+    */
+   unsigned long long num_major_faults; //!< trick_units(count)
+
+   /**
+    * Number of collected frames in which JEOD allocated memory.
+    */
+   unsigned long long num_alloc_frames; //!< trick_units(count)
+
+   /**
+    * JEOD allocations made in collected frames, by any thread.
+    */
+   unsigned long long num_allocations; //!< trick_units(count)
+
+   /**
+    * Number of frame records dropped because the ring was full.
+    */
+   unsigned long long num_dropped; //!< trick_units(count)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   JeodFrameMonitor (void);
+   ~JeodFrameMonitor (void);
+
+   // Add a phase; returns the phase's index.
+   unsigned int add_phase (const std::string & name);
+
+   // Mark the start of a frame.
+   void start_frame (void);
+
+   // Mark the end of a phase; the phase began at the previous mark.
+   void end_phase (unsigned int phase_index);
+
+   // Mark the end of a frame and queue its record.
+   void end_frame (void);
+
+   // Drain the queued records and refresh the statistics.
+   void collect (void);
+
+   // Discard the collected data.
+   void reset (void);
+
+   // Collect, then issue the statistics as an informational message.
+   void report (void);
+
+   /**
+    * Get the number of phases.
+    * @return Phase count.
+    */
+   unsigned int get_num_phases (void) const
+   { return phase_names.size(); }
+
+
+private:
+
+   struct Ring;
+   struct Histogram;
+
+   // Refresh a statistics member from its histogram.
+   static void summarize (const Histogram & histogram,
+                          JeodFrameStatistics & stats);
+
+
+   // Member data
+
+   /**
+    * Phase names.
+    */
+   std::vector<std::string> phase_names; //!< trick_io(**)
+
+   /**
+    * The queued frame records.
+    */
+   Ring * ring; //!< trick_io(**)
+
+   /**
+    * The frame time histogram followed by the phase time histograms.
+    */
+   Histogram * histograms; //!< trick_io(**)
+
+   /**
+    * Is a frame being marked?
+    */
+   bool in_frame; //!< trick_io(**)
+
+   /**
+    * Clock reading at start_frame(), nanoseconds.
+    */
+   unsigned long long frame_start; //!< trick_io(**)
+
+   /**
+    * Clock reading at the most recent mark, nanoseconds.
+    */
+   unsigned long long last_mark; //!< trick_io(**)
+
+   /**
+    * Phase times of the frame being marked, nanoseconds.
+    */
+   unsigned long long phase_times[max_phases]; //!< trick_io(**)
+
+   /**
+    * Minor page fault count at start_frame().
+    */
+   long start_minor_faults; //!< trick_io(**)
+
+   /**
+    * Major page fault count at start_frame().
+    */
+   long start_major_faults; //!< trick_io(**)
+
+   /**
+    * JEOD allocation count at start_frame().
+    */
+   unsigned long long start_allocations; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   JeodFrameMonitor (const JeodFrameMonitor &);
+
+   /**
+    * Not implemented.
+    */
+   JeodFrameMonitor & operator= (const JeodFrameMonitor &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
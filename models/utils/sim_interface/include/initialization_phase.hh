@@ -0,0 +1,226 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/initialization_phase.hh
+ * Define the class JeodInitializationPhase, which runs independent model
+ * initializations concurrently.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/initialization_phase.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_INITIALIZATION_PHASE_HH
+#define JEOD_INITIALIZATION_PHASE_HH
+
+
+// System includes
+#include <string>
+#include <vector>
+
+// Model includes
+#include "jeod_class.hh"
+#include "task_graph.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+
+/**
+ * A JeodInitializationPhase runs a set of model initializations, such as
+ * building the recursion tables of each gravity source, loading ephemeris
+ * files, and setting up the time tables, with those that do not depend on
+ * one another running concurrently.
+ *
+ * Each initialization names the resources it provides and the resources it
+ * requires, e.g. "time", "ephemerides", or "gravity/Earth". The ordering is
+ * derived from these names rather than from the order of addition:
+ *  - An initialization runs after every initialization that provides a
+ *    resource it requires.
+ *  - Initializations that provide the same resource run one at a time, in
+ *    order of addition, since they typically register with the same model.
+ * A required resource that no initialization in the phase provides is
+ * taken to have been provided before the phase runs.
+ *
+ * A typical phase, run before DynManager::initialize_simulation:
+ * @code
+ *    JeodGraphFunctionTask time_init (
+ *       [&] () { time_manager.initialize (&time_manager_init); });
+ *    JeodGraphMethodTask<SphericalHarmonicsGravitySource> earth_init (
+ *       earth_grav_source, &SphericalHarmonicsGravitySource::initialize_body);
+ *    JeodGraphFunctionTask de4xx_init (
+ *       [&] () { de4xx.initialize_model (time_manager, dyn_manager); });
+ *
+ *    unsigned int task;
+ *    task = phase.add_initialization (time_init, "time");
+ *    phase.add_provision (task, "time");
+ *    task = phase.add_initialization (earth_init, "Earth gravity");
+ *    phase.add_provision (task, "gravity/Earth");
+ *    task = phase.add_initialization (de4xx_init, "DE4xx ephemeris");
+ *    phase.add_requirement (task, "time");
+ *    phase.add_provision (task, "ephemerides");
+ *
+ *    phase.num_threads = 4;
+ *    phase.run ();
+ * @endcode
+ *
+ * \par Assumptions and Limitations
+ *  - Initializations that run concurrently must not modify a common object
+ *    unless it is thread safe. Allocations through the JEOD memory manager
+ *    are, provided the manager is not in single-threaded mode.
+ *  - The phase does not own the tasks.
+ */
+class JeodInitializationPhase {
+
+JEOD_MAKE_SIM_INTERFACES(JeodInitializationPhase)
+
+public:
+
+   // Member data
+
+   /**
+    * Number of threads, including the calling thread, used to run the
+    * initializations. Values less than two run them on the calling thread,
+    * in a dependency-respecting order. The default is one.
+    */
+   unsigned int num_threads; //!< trick_units(--)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   JeodInitializationPhase (void);
+   ~JeodInitializationPhase (void);
+
+   // Add an initialization; returns its index.
+   unsigned int add_initialization (
+      JeodGraphTask & task, const std::string & name);
+
+   // Declare that an initialization requires a resource.
+   void add_requirement (unsigned int index, const std::string & resource);
+
+   // Declare that an initialization provides a resource.
+   void add_provision (unsigned int index, const std::string & resource);
+
+   // Run every initialization once, then remove them.
+   void run (void);
+
+   /**
+    * Get the number of initializations not yet run.
+    * @return Initialization count.
+    */
+   unsigned int get_num_initializations (void) const
+   { return entries.size(); }
+
+
+private:
+
+   /**
+    * An initialization and the resources it names.
+    */
+   struct Entry {
+      /**
+       * The initialization.
+       */
+      JeodGraphTask * task;
+
+      /**
+       * Name, for diagnostics.
+       */
+      std::string name;
+
+      /**
+       * Resources the initialization requires.
+       */
+      std::vector<std::string> required;
+
+      /**
+       * Resources the initialization provides.
+       */
+      std::vector<std::string> provided;
+   };
+
+   // Fail if an index is out of range.
+   void check_index (unsigned int index, const char * function) const;
+
+   /**
+    * The initializations, in order of addition.
+    */
+   std::vector<Entry> entries; //!< trick_io(**)
+
+   /**
+    * The graph that runs the initializations.
+    */
+   JeodTaskGraph graph; //!< trick_io(**)
+
+   /**
+    * Not implemented.
+    */
+   JeodInitializationPhase (const JeodInitializationPhase &);
+
+   /**
+    * Not implemented.
+    */
+   JeodInitializationPhase & operator= (const JeodInitializationPhase &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,314 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/jeod_profiler.hh
+ * Define the class JeodProfiler and the scoped timers that feed it, which
+ * measure the wall-clock time spent in the models' main entry points.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The timers are compiled in only when JEOD_PROFILING is nonzero.)
+   (Time is attributed to the integration group that is active on the
+    calling thread; derivative worker threads have no active group.)
+   (The summary and export functions must not be called while other threads
+    are inside timed functions.))
+
+Library dependencies:
+  ((../src/jeod_profiler.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_PROFILER_HH
+#define JEOD_PROFILER_HH
+
+// System includes
+#include <string>
+
+// Model includes
+#include "class_declarations.hh"
+
+
+/**
+ * @def JEOD_PROFILING
+ * Set to a nonzero value to compile the profiling timers into the models.
+ * The default, zero, compiles them out entirely.
+ */
+#ifndef JEOD_PROFILING
+#define JEOD_PROFILING 0
+#endif
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Collects call counts and wall-clock times for the timed functions, per
+ * model and per integration group.
+ * All members are static; the class is not instantiable.
+ *
+ * A simulation built with JEOD_PROFILING typically schedules
+ * report_summary() as a periodic logging job and calls write_trace() at
+ * shutdown. The trace is in the Chrome trace event format.
+ *
+ * Initialization is profiled separately by calling set_init_profiling()
+ * before the initialization jobs run. The main initialization entry points
+ * (memory registration, gravity table builds, data module loading,
+ * ephemeris setup, body actions, the reference frame tree) are timed, and
+ * the profile is reported at the end of DynManager::initialize_simulation.
+ */
+class JeodProfiler {
+
+public:
+
+   // Register a timed function.
+   static unsigned int register_site (
+      const char * model,
+      const char * function);
+
+   // Make an integration group the calling thread's active group.
+   static unsigned int enter_group (const void * group);
+
+   // Restore the calling thread's previous active group.
+   static void leave_group (unsigned int previous);
+
+   // Monotonic wall-clock time.
+   static unsigned long long now (void);
+
+   // Record one call to a timed function.
+   static void record (
+      unsigned int site,
+      unsigned long long start,
+      unsigned long long stop);
+
+   // Turn trace event recording on or off.
+   static void set_tracing (bool tracing, unsigned long max_events = 1000000);
+
+   // Discard all counts and trace events.
+   static void reset (void);
+
+   // Format the accumulated counts as a table.
+   static std::string summary (void);
+
+   // Format the accumulated counts as a table sorted by total time.
+   static std::string sorted_summary (void);
+
+   // Issue the summary table as an informational message.
+   static void report_summary (void);
+
+   // Write the accumulated counts as JSON.
+   static bool write_summary_json (const std::string & file_name);
+
+   // Write the recorded trace events in the Chrome trace format.
+   static bool write_trace (const std::string & file_name);
+
+   // Turn initialization profiling on or off.
+   static void set_init_profiling (
+      bool enabled,
+      const std::string & trace_file = "");
+
+   // Report the initialization profile, if it is being collected.
+   static void report_initialization (void);
+
+
+ // This class is not instantiable.
+ // The constructors and assignment operator for this class are declared
+ // private and are not implemented.
+ private:
+
+   /**
+    * Not implemented.
+    */
+   JeodProfiler (void);
+
+   /**
+    * Not implemented.
+    */
+   JeodProfiler (const JeodProfiler &);
+
+   /**
+    * Not implemented.
+    */
+   JeodProfiler & operator= (const JeodProfiler &);
+};
+
+
+/**
+ * Times the enclosing scope and records the result against a site.
+ */
+class JeodProfileTimer {
+
+public:
+
+   /**
+    * Constructor; starts the timer.
+    * @param site_in Site index returned by JeodProfiler::register_site.
+    */
+   explicit JeodProfileTimer (unsigned int site_in)
+   :
+      site(site_in),
+      start(JeodProfiler::now())
+   { }
+
+   /**
+    * Destructor; records the elapsed time.
+    */
+   ~JeodProfileTimer (void)
+   {
+      JeodProfiler::record (site, start, JeodProfiler::now());
+   }
+
+
+private:
+
+   /**
+    * The timed site.
+    */
+   unsigned int site; //!< trick_io(**)
+
+   /**
+    * Time at entry to the scope.
+    */
+   unsigned long long start; //!< trick_io(**)
+
+   /**
+    * Not implemented.
+    */
+   JeodProfileTimer (const JeodProfileTimer &);
+
+   /**
+    * Not implemented.
+    */
+   JeodProfileTimer & operator= (const JeodProfileTimer &);
+};
+
+
+/**
+ * Makes an integration group the calling thread's active group for the
+ * duration of the enclosing scope.
+ */
+class JeodProfileGroupScope {
+
+public:
+
+   /**
+    * Constructor; activates the group.
+    * @param group The integration group.
+    */
+   explicit JeodProfileGroupScope (const void * group)
+   :
+      previous(JeodProfiler::enter_group (group))
+   { }
+
+   /**
+    * Destructor; restores the previously active group.
+    */
+   ~JeodProfileGroupScope (void)
+   {
+      JeodProfiler::leave_group (previous);
+   }
+
+
+private:
+
+   /**
+    * The group that was active on entry to the scope.
+    */
+   unsigned int previous; //!< trick_io(**)
+
+   /**
+    * Not implemented.
+    */
+   JeodProfileGroupScope (const JeodProfileGroupScope &);
+
+   /**
+    * Not implemented.
+    */
+   JeodProfileGroupScope & operator= (const JeodProfileGroupScope &);
+};
+
+} // End JEOD namespace
+
+
+/**
+ * @def JEOD_PROFILE_SCOPE(model, function)
+ * Time the rest of the enclosing scope and charge it to the named model
+ * and function. Expands to nothing unless JEOD_PROFILING is nonzero.
+ */
+
+/**
+ * @def JEOD_PROFILE_GROUP(group)
+ * Charge the timed functions called in the rest of the enclosing scope to
+ * the given integration group. Expands to nothing unless JEOD_PROFILING
+ * is nonzero.
+ */
+
+#if JEOD_PROFILING
+#define JEOD_PROFILE_SCOPE(model, function)                                \
+   static const unsigned int jeod_profile_site_ =                          \
+      jeod::JeodProfiler::register_site (model, function);                 \
+   jeod::JeodProfileTimer jeod_profile_timer_ (jeod_profile_site_)
+
+#define JEOD_PROFILE_GROUP(group)                                          \
+   jeod::JeodProfileGroupScope jeod_profile_group_ (group)
+#else
+#define JEOD_PROFILE_SCOPE(model, function)
+#define JEOD_PROFILE_GROUP(group)
+#endif
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,252 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/jeod_standalone_integrator.hh
+ * Define the integration interface used when JEOD is driven without a
+ * simulation engine.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_STANDALONE_INTEGRATOR_HH
+#define JEOD_STANDALONE_INTEGRATOR_HH
+
+// Local includes
+#include "jeod_class.hh"
+#include "jeod_integrator_interface.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodStandaloneIntegrator specializes the JeodIntegratorInterface for use
+ * without a simulation engine. It simply records the values that the
+ * integration controls communicate to the simulation engine.
+*/
+class JeodStandaloneIntegrator: public JeodIntegratorInterface {
+JEOD_MAKE_SIM_INTERFACES(JeodStandaloneIntegrator)
+
+public:
+
+   // Methods
+
+   /**
+    * Default constructor
+    */
+   JeodStandaloneIntegrator ()
+   :
+      JeodIntegratorInterface(),
+      dt(0.0),
+      time(0.0),
+      step_number(0),
+      first_step_deriv(false),
+      default_first_step_deriv(false)
+   {}
+
+
+   /**
+    * Destructor.
+    */
+   ~JeodStandaloneIntegrator () override {}
+
+   /**
+    * Interpret the integration technique.
+    * Without a simulation engine the value is already an ER7 technique.
+    */
+   er7_utils::Integration::Technique interpret_integration_type (
+      int integ_technique)
+   const override
+   {
+      return static_cast<er7_utils::Integration::Technique> (integ_technique);
+   }
+
+   /**
+    * Get the simulation engine's integrator.
+    * @return Null; there is no simulation engine integrator.
+    */
+   JEOD_SIM_INTEGRATOR_POINTER_TYPE get_integrator () override
+   {
+      return nullptr;
+   }
+
+   /**
+    * Get the integration cycle time step.
+    * @return                Simulation time delta t, in seconds
+    */
+   double get_dt () const override
+   {
+      return dt;
+   }
+
+   /**
+    * Set the integration cycle time step.
+    * @param[in] value       Simulation time delta t, in seconds
+    */
+   void set_dt (double value)
+   {
+      dt = value;
+   }
+
+   /**
+    * Get the flag that tells the driver to compute derivatives
+    * on the initial step of each integration cycle.
+    * @return Value of the first step derivatives flag
+    */
+   bool get_first_step_derivs_flag () const override
+   {
+      return first_step_deriv;
+   }
+
+   /**
+    * Set the flag that tells the driver to compute derivatives
+    * on the initial step of each integration cycle.
+    * @param[in] value       Value of the first step derivatives flag
+    */
+   void set_first_step_derivs_flag (bool value) override
+   {
+      first_step_deriv = value;
+   }
+
+   /**
+    * Reset the flag that tells the driver to compute derivatives
+    * on the initial step of each integration cycle. Derivatives are always
+    * needed just after a reset. The behavior should revert to nominal after
+    * the reset has been performed.
+    */
+   void reset_first_step_derivs_flag () override
+   {
+      default_first_step_deriv = first_step_deriv;
+      first_step_deriv = true;
+   }
+
+   /**
+    * Restore the flag that tells the driver to compute derivatives
+    * on the initial step of each integration cycle to it's value prior to
+    * the most recent call to reset_first_step_derivs_flag.
+    */
+   void restore_first_step_derivs_flag () override
+   {
+      first_step_deriv = default_first_step_deriv;
+   }
+
+   /**
+    * Set the step number within an integration cycle.
+    * @param[in] stepno      Step number
+    */
+   void set_step_number (unsigned int stepno) override
+   {
+      step_number = stepno;
+   }
+
+   /**
+    * Update the time model given the simulation time.
+    * @param[in] sim_time Simulation time
+    */
+   void set_time (double sim_time) override
+   {
+      time = sim_time;
+   }
+
+
+private:
+
+   // Member data
+
+   /**
+    * Integration cycle time step.
+    */
+   double dt; //!< trick_units(s)
+
+   /**
+    * Simulation time as last set by the integration controls.
+    */
+   double time; //!< trick_units(s)
+
+   /**
+    * Step number within the current integration cycle.
+    */
+   unsigned int step_number; //!< trick_units(--)
+
+   /**
+    * Compute derivatives on the initial step of each integration cycle?
+    */
+   bool first_step_deriv; //!< trick_units(--)
+
+   /**
+    * Value of first_step_deriv prior to the last reset.
+    */
+   bool default_first_step_deriv; //!< trick_units(--)
+
+
+   // Deleted methods: copy constructor and assignment operator
+
+   /**
+    * Not implemented.
+    */
+   JeodStandaloneIntegrator (const JeodStandaloneIntegrator &);
+
+   /**
+    * Not implemented.
+    */
+   JeodStandaloneIntegrator & operator= (const JeodStandaloneIntegrator &);
+
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -80,6 +80,7 @@ namespace jeod {
 
 // Forward declarations
 class JeodCheckpointable;
+class JeodCheckpointReconstructor;
 class JeodMemoryItem;
 class JeodMemoryTypeDescriptor;
 
@@ -102,7 +103,7 @@ public:
    JeodMemoryInterface & operator = (const JeodMemoryInterface &);
 
 
-   // Virtual methods, all pure virtual.
+   // Pure virtual methods.
 
    /**
     * Find the attributes for a given class name.
@@ -252,6 +253,42 @@ public:
     */
    virtual void * get_address_at_name (
       const std::string & name) const = 0;
+
+
+   // Virtual methods with default implementations.
+
+   /**
+    * Mark an allocation as reconstructible: a checkpoint is to record a
+    * reference to the allocation's data source rather than its contents,
+    * and the reconstructor is to refill the allocation on restart.
+    * 
+ote
+    * The default implementation does nothing; the contents of the
+    * allocation are checkpointed as usual, if at all.
+    * \param[in] addr          Address of the allocated memory
+    * \param[in] item          JEOD descriptor of the allocated memory
+    * \param[in] tdesc         JEOD descriptor of the type of the memory
+    * \param[in] reference     Identifies the data source across runs
+    * \param[in] reconstructor Rebuilds the contents on restart
+    */
+   virtual void set_reconstructible (
+      const void * addr JEOD_UNUSED,
+      const JeodMemoryItem & item JEOD_UNUSED,
+      const JeodMemoryTypeDescriptor & tdesc JEOD_UNUSED,
+      const std::string & reference JEOD_UNUSED,
+      JeodCheckpointReconstructor & reconstructor JEOD_UNUSED)
+   {}
+
+   /**
+    * Forget a reconstructor that is about to be destroyed.
+    * 
+ote
+    * The default implementation does nothing.
+    * \param[in] reconstructor The reconstructor
+    */
+   virtual void forget_reconstructor (
+      JeodCheckpointReconstructor & reconstructor JEOD_UNUSED)
+   {}
 };
 
 
@@ -0,0 +1,230 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/parallel_integ_loops.hh
+ * Define the class JeodParallelIntegrationLoops, which advances independent
+ * standalone integration loops together, evaluating their derivatives
+ * concurrently.
+ */
+
+/*******************************************************************************
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The loops are independent: no loop's derivatives depend on the state of
+    bodies integrated by another loop))
+
+Library dependencies:
+  ((../src/parallel_integ_loops.cc))
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_PARALLEL_INTEG_LOOPS_HH
+#define JEOD_PARALLEL_INTEG_LOOPS_HH
+
+// System includes
+#include <vector>
+
+// Local includes
+#include "jeod_class.hh"
+
+// JEOD includes
+#include "utils/container/include/pointer_vector.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Forward declarations
+class DerivativeThreadPool;
+class JeodStandaloneIntegrationLoop;
+
+
+/**
+ * A JeodParallelIntegrationLoops advances a set of JeodStandaloneIntegrationLoop
+ * objects whose bodies do not interact, e.g., vehicles about different
+ * planets or separate vehicle clusters.
+ *
+ * Loops that are due at the same time, have the same cycle, use the same
+ * integrator constructor, and take the same number of sub-steps are stepped
+ * in lock step. At each integration stage, the shared environment (the
+ * ephemerides and the deferred frame states) is brought up to date once on
+ * the calling thread. The loops' derivatives are then evaluated
+ * concurrently, one loop per thread, and the loops' states are integrated
+ * one after the other from the common stage time. Loops that cannot be
+ * stepped together are integrated one after the other as a driver of
+ * separate loops would.
+ *
+ * Adding loops to the set declares them independent. check_independence
+ * verifies what the dynamics model can see: that no body is integrated by
+ * two loops and that no loop integrates a body attached to a body of
+ * another loop. Couplings it cannot see, such as relative states, contact
+ * pairs, or user derivative functions that read another loop's bodies,
+ * must not span loops. User derivative functions are called concurrently.
+ */
+class JeodParallelIntegrationLoops {
+
+   JEOD_MAKE_SIM_INTERFACES(JeodParallelIntegrationLoops)
+
+public:
+
+   // Member data
+
+   /**
+    * Number of threads used to evaluate derivatives, including the calling
+    * thread. One evaluates the loops' derivatives on the calling thread.
+    */
+   unsigned int num_threads; //!< trick_units(--)
+
+   /**
+    * Number of loop cycles integrated in lock step with other loops.
+    */
+   unsigned int lockstep_cycles; //!< trick_io(*o) trick_units(count)
+
+   /**
+    * Number of loop cycles integrated on their own.
+    */
+   unsigned int separate_cycles; //!< trick_io(*o) trick_units(count)
+
+
+   // Member functions
+
+   // Constructor and destructor
+   JeodParallelIntegrationLoops ();
+   ~JeodParallelIntegrationLoops ();
+
+   // Add a loop to the set.
+   void add_loop (JeodStandaloneIntegrationLoop & loop);
+
+   // Remove a loop from the set.
+   void remove_loop (JeodStandaloneIntegrationLoop & loop);
+
+   // Check that the loops do not share or attach bodies across loops.
+   bool check_independence (void) const;
+
+   // Integrate the loops until each reaches the specified time.
+   int integrate_to (double end_sim_time);
+
+
+private:
+
+   // Integrate one cycle of loops that are due at the same time.
+   int integrate_due_loops (void);
+
+   // Integrate one cycle of loops in lock step.
+   int integrate_lockstep (unsigned int nsub);
+
+   // Integrate one lock step sub-step.
+   int integrate_lockstep_substep (double beg_sim_time, double del_sim_time);
+
+   // Evaluate the derivatives of the loops flagged in need_derivs.
+   void compute_derivatives (void);
+
+   // Obtain the thread pool, creating or resizing it as needed.
+   DerivativeThreadPool * prepare_thread_pool (void);
+
+
+   // Member data
+
+   /**
+    * The loops in the set.
+    */
+   JeodPointerVector<JeodStandaloneIntegrationLoop>::type loops; //!< trick_io(**)
+
+   /**
+    * The loops being integrated this cycle.
+    */
+   std::vector<JeodStandaloneIntegrationLoop *> due_loops; //!< trick_io(**)
+
+   /**
+    * Number of sub-steps each due loop takes this cycle.
+    */
+   std::vector<unsigned int> due_nsubs; //!< trick_io(**)
+
+   /**
+    * Loops whose integration of the current sub-step is not complete.
+    */
+   std::vector<bool> running; //!< trick_io(**)
+
+   /**
+    * Loops that need derivatives at the current stage.
+    */
+   std::vector<bool> need_derivs; //!< trick_io(**)
+
+   /**
+    * Loops whose derivatives are evaluated at the current stage.
+    */
+   std::vector<JeodStandaloneIntegrationLoop *> deriv_loops; //!< trick_io(**)
+
+   /**
+    * Thread pool used to evaluate derivatives, if num_threads exceeds one.
+    */
+   DerivativeThreadPool * thread_pool; //!< trick_io(**)
+
+
+   // The set refers to the loops and owns a thread pool.
+
+   /**
+    * Not implemented.
+    */
+   JeodParallelIntegrationLoops (const JeodParallelIntegrationLoops &);
+
+   /**
+    * Not implemented.
+    */
+   JeodParallelIntegrationLoops & operator= (
+      const JeodParallelIntegrationLoops &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -108,6 +108,22 @@ class SimInterfaceMessages {
     */
    static char const * implementation_error; //!< trick_units(--)
 
+   /**
+    * Message issued for profiling summaries and profile export problems.
+    */
+   static char const * profiling; //!< trick_units(--)
+
+   /**
+    * Message issued when a data module cannot be loaded or lacks the
+    * entry point for the object it is asked to initialize.
+    */
+   static char const * data_module_error; //!< trick_units(--)
+
+   /**
+    * Message issued when a fidelity controller changes the fidelity level.
+    */
+   static char const * fidelity_change; //!< trick_units(--)
+
 
  // Member functions
  // This class is not instantiable.
@@ -0,0 +1,465 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/standalone_dynbody_integ_loop.hh
+ * Define the class JeodStandaloneIntegrationLoop, the counterpart of
+ * JeodDynbodyIntegrationLoop for simulations that are not driven by Trick.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The driver is responsible for calling the loop's integrate functions
+    and for keeping multiple loops synchronized in time.))
+
+Library dependencies:
+  ((../src/standalone_dynbody_integ_loop.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_STANDALONE_DYNBODY_INTEG_LOOP_HH
+#define JEOD_STANDALONE_DYNBODY_INTEG_LOOP_HH
+
+// Local includes
+#include "jeod_class.hh"
+#include "jeod_standalone_integrator.hh"
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
+#include "utils/container/include/pointer_vector.hh"
+#include "utils/container/include/position_index.hh"
+#include "utils/integration/include/jeod_integration_group.hh"
+
+
+/**
+ * Namespace er7_utils contains the state integration models used by JEOD.
+ */
+namespace er7_utils {
+class IntegrableObject;
+class IntegratorConstructor;
+}
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Forward declarations
+class DynBody;
+class DynManager;
+class GravityManager;
+class TimeManager;
+
+
+/**
+ * A JeodStandaloneIntegrationLoop integrates a set of DynBody objects and
+ * associated integrable objects over time without a simulation engine.
+ * It has the same semantics as a JeodDynbodyIntegrationLoop:
+ * - The bodies are integrated by a DynamicsIntegrationGroup created from the
+ *   supplied group factory and registered with the dynamics manager.
+ * - Each integration cycle is split into the number of sub-steps selected
+ *   by DynManager::schedule_substeps.
+ * - Time is advanced through the TimeManager by the integration group.
+ * - The group's integrators are reset on the cycle following a change
+ *   in the set of bodies the loop integrates.
+ *
+ * Bodies are added explicitly rather than via sim objects. Derivatives
+ * are computed by the loop itself: gravitation, an optional user derivative
+ * function, and force and torque collection, in that order. None of these
+ * steps go through the simulation interface.
+ */
+class JeodStandaloneIntegrationLoop :
+   virtual public JeodIntegrationGroupOwner
+{
+
+   JEOD_MAKE_SIM_INTERFACES(JeodStandaloneIntegrationLoop)
+
+public:
+
+   // Types
+
+   /**
+    * User derivative function, called once per derivative evaluation
+    * after gravitation and before forces and torques are collected.
+    * The argument is the context supplied with the function.
+    */
+   typedef void (*DerivativeFunction) (void * context);
+
+
+   // Constructor and destructor
+
+   /**
+    * JeodStandaloneIntegrationLoop default constructor.
+    * @note This exists only for the purpose of automated checkpoint/restart.
+    * @warning Do not use the default constructor outside of this context.
+    */
+   JeodStandaloneIntegrationLoop ();
+
+
+   /**
+    * JeodStandaloneIntegrationLoop non-default constructor.
+    * @param cycle
+    *   The integration interval in simulation seconds.
+    * @param time_manager_in
+    *   The simulation's time manager object.
+    * @param dyn_manager_in
+    *   The simulation's dynamics manager object.
+    * @param grav_manager_in
+    *   The simulation's gravity manager object.
+    * @param integ_cotr_in
+    *   The integrator constructor used to create integration artifacts.
+    * @param integ_group_factory
+    *   The integration group object used to create this loop's integ group.
+    */
+   JeodStandaloneIntegrationLoop (
+      double cycle,
+      TimeManager & time_manager_in,
+      DynManager & dyn_manager_in,
+      GravityManager & grav_manager_in,
+      er7_utils::IntegratorConstructor *& integ_cotr_in,
+      DynamicsIntegrationGroup & integ_group_factory);
+
+
+   /**
+    * JeodStandaloneIntegrationLoop destructor.
+    */
+   ~JeodStandaloneIntegrationLoop () override;
+
+
+   // Member functions
+
+   /**
+    * Initialize the integration loop.
+    * This must be called after the integrator constructor has been set
+    * and before DynManager::initialize_simulation.
+    */
+   void initialize_integ_loop (void);
+
+
+   /**
+    * Reset JEOD time to the time at the start of the loop's next cycle.
+    * Drivers of simulations with multiple integration loops should call
+    * this before integrating each loop.
+    */
+   void set_time_to_loop_start (void);
+
+
+   /**
+    * Update the provided integration group, which must be the integration group
+    * contained within this integration loop object.
+    *
+    * @note This function is public because it is called (indirectly) from
+    * DynManager::initialize_simulation. It should otherwise be viewed
+    * as a protected or private function.
+    *
+    * @param group  The IntegrationGroup to be updated, which must be
+    *               the integration loop's integration group object.
+    */
+   void update_integration_group (
+      JeodIntegrationGroup & group) override;
+
+
+   /**
+    * Add a DynBody to the set of bodies integrated by this loop.
+    * Bodies added before the dynamics manager is initialized are added to
+    * the integration group during DynManager::initialize_simulation.
+    *
+    * @param dyn_body  Body to be added.
+    */
+   void add_dyn_body (DynBody & dyn_body);
+
+
+   /**
+    * Remove a DynBody from the set of bodies integrated by this loop.
+    *
+    * @param dyn_body  Body to be removed.
+    */
+   void remove_dyn_body (DynBody & dyn_body);
+
+
+   /**
+    * Add the specified integrable object, which should not be a DynBody,
+    * to the integration group's set of integrable objects.
+    *
+    * @param integrable_object  Object to be added.
+    */
+   void add_integrable_object (
+      er7_utils::IntegrableObject & integrable_object);
+
+
+   /**
+    * Remove the specified integrable object from the integration group's
+    * set of integrable objects.
+    *
+    * @param integrable_object  Object to be removed.
+    */
+   void remove_integrable_object (
+      er7_utils::IntegrableObject & integrable_object);
+
+
+   /**
+    * Set the user derivative function.
+    * @param function  Function to be called, or null for none.
+    * @param context   Argument passed to the function.
+    */
+   void set_derivative_function (
+      DerivativeFunction function,
+      void * context)
+   {
+      deriv_function = function;
+      deriv_context = context;
+   }
+
+
+   /**
+    * Compute the derivatives of the bodies integrated by this loop.
+    */
+   void compute_derivatives (void);
+
+
+   /**
+    * Compute the derivatives of the bodies integrated by this loop,
+    * skipping the environment update that compute_derivatives performs.
+    * The environment must already be up to date at the current time.
+    */
+   void compute_body_derivatives (void);
+
+
+   /**
+    * Integrate the loop's bodies over one integration cycle.
+    * @return  Zero => success, non-zero => error.
+    */
+   int integrate_cycle (void);
+
+
+   /**
+    * Integrate whole cycles until the loop reaches the specified time.
+    * @param end_sim_time  Simulation time at which to stop, in seconds.
+    * @return  Zero => success, non-zero => error.
+    */
+   int integrate_to (double end_sim_time);
+
+
+   /**
+    * Get the integration cycle.
+    * @return Integration interval, simulation seconds.
+    */
+   double get_cycle (void) const
+   {
+      return cycle;
+   }
+
+
+   /**
+    * Get the simulation time at the start of the next cycle.
+    * @return Simulation time, seconds.
+    */
+   double get_sim_time (void) const
+   {
+      return start_sim_time + cycle_count * cycle;
+   }
+
+
+   /**
+    * Get the loop's integration group.
+    * @return Integration group, null until the loop is initialized.
+    */
+   DynamicsIntegrationGroup * get_integ_group (void)
+   {
+      return integ_group;
+   }
+
+
+   /**
+    * Set the deriv_ephem_update flag for the integration group.
+    * @param val  New value for deriv_ephem_update.
+    */
+   void set_deriv_ephem_update (bool val)
+   {
+      deriv_ephem_update = val;
+      if (integ_group != nullptr) {
+         integ_group->deriv_ephem_update = deriv_ephem_update;
+      }
+   }
+
+
+protected:
+
+   // The parallel driver steps loops through their cycles itself.
+   friend class JeodParallelIntegrationLoops;
+
+   // Member functions
+
+   /**
+    * Prepare the loop for its next integration cycle: reset the integration
+    * group if the set of bodies has changed and select the number of
+    * sub-steps.
+    * @return  Number of sub-steps in the cycle.
+    */
+   unsigned int begin_cycle (void);
+
+   /**
+    * Finish an integration cycle: count it and notify the cycle observers.
+    */
+   void end_cycle (void);
+
+   /**
+    * Integrate the loop's bodies over one sub-step of an integration cycle.
+    *
+    * @return               Zero => success, non-zero => error.
+    * @param beg_sim_time   The time at the start of the sub-step.
+    * @param del_sim_time   The time span of the sub-step.
+    */
+   int integrate_substep (double beg_sim_time, double del_sim_time);
+
+
+   // Member data
+
+   /**
+    * Integration interval in simulation seconds.
+    */
+   double cycle; //!< trick_units(s)
+
+   /**
+    * Simulation time when the loop was initialized.
+    */
+   double start_sim_time; //!< trick_units(s)
+
+   /**
+    * Number of cycles completed since initialization. Cycle start times
+    * are computed from this count so that round-off does not accumulate.
+    */
+   unsigned int cycle_count; //!< trick_units(--)
+
+   /**
+    * The JEOD dynamics manager.
+    */
+   DynManager * dyn_manager; //!< trick_units(--)
+
+   /**
+    * The JEOD time manager.
+    */
+   TimeManager * time_manager; //!< trick_units(--)
+
+   /**
+    * The gravity model manager.
+    */
+   GravityManager * gravity_manager; //!< trick_units(--)
+
+   /**
+    * Integration interface; needed by the integ_group.
+    */
+   JeodStandaloneIntegrator integ_interface; //!< trick_units(--)
+
+   /**
+    * Handle to the integration constructor used to create integrators.
+    */
+   er7_utils::IntegratorConstructor ** integ_constructor; //!< trick_units(--)
+
+   /**
+    * The externally-supplied integration group used as a template for
+    * creating this integration loop's integration group.
+    */
+   const DynamicsIntegrationGroup * integ_group_factory; //!< trick_units(--)
+
+   /**
+    * The integration group that performs the integration.
+    */
+   DynamicsIntegrationGroup * integ_group; //!< trick_units(--)
+
+   /**
+    * The bodies integrated by this loop.
+    */
+   JeodPointerVector<DynBody>::type dyn_bodies; //!< trick_io(**)
+
+   /**
+    * Positions of the bodies in dyn_bodies.
+    */
+   PositionIndex<DynBody> dyn_body_positions; //!< trick_io(**)
+
+   /**
+    * User derivative function.
+    */
+   DerivativeFunction deriv_function; //!< trick_io(**)
+
+   /**
+    * Argument passed to the user derivative function.
+    */
+   void * deriv_context; //!< trick_io(**)
+
+   /**
+    * If set, ephemerides will be updated at the derivative rate.
+    */
+   bool deriv_ephem_update; //!< trick_units(--)
+
+   /**
+    * Set when the set of bodies changes; the integration group is reset
+    * at the start of the next cycle.
+    */
+   bool group_changed; //!< trick_units(--)
+
+
+private:
+
+   //!< Deleted.
+   JeodStandaloneIntegrationLoop (const JeodStandaloneIntegrationLoop &);
+
+   //!< Deleted.
+   JeodStandaloneIntegrationLoop& operator=
+      (const JeodStandaloneIntegrationLoop &);
+};
+
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,495 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/task_graph.hh
+ * Define the classes JeodGraphTask, JeodGraphMethodTask, JeodGraphFunctionTask,
+ * and JeodTaskGraph, which run the model updates of a simulation step as a
+ * dependency graph.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/task_graph.cc))
+
+ 
+
+*******************************************************************************/
+
+
+#ifndef JEOD_TASK_GRAPH_HH
+#define JEOD_TASK_GRAPH_HH
+
+// System includes
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Model includes
+#include "jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * A JeodGraphTask is one model update in a JeodTaskGraph, such as an
+ * ephemeris update or an atmosphere update.
+ */
+class JeodGraphTask {
+JEOD_MAKE_SIM_INTERFACES(JeodGraphTask)
+
+public:
+
+   /**
+    * Default constructor.
+    */
+   JeodGraphTask (void) {}
+
+   /**
+    * Destructor.
+    */
+   virtual ~JeodGraphTask (void) {}
+
+   /**
+    * Perform the update. Called once per JeodTaskGraph::execute, possibly
+    * on a worker thread, after every task it depends on has completed.
+    */
+   virtual void execute (void) = 0;
+
+
+private:
+
+   /**
+    * Not implemented.
+    */
+   JeodGraphTask (const JeodGraphTask &);
+
+   /**
+    * Not implemented.
+    */
+   JeodGraphTask & operator= (const JeodGraphTask &);
+};
+
+
+/**
+ * A JeodGraphMethodTask calls an argument-free member function of a model,
+ * e.g. EphemeridesManager::update_ephemerides or PlanetRNP::update_rnp.
+ * Updates that take arguments need a class derived from JeodGraphTask.
+ * @tparam ModelType The class of the model.
+ */
+template<typename ModelType>
+class JeodGraphMethodTask : public JeodGraphTask {
+
+public:
+
+   /**
+    * The type of the member function called by the task.
+    */
+   typedef void (ModelType::*Method) (void);
+
+   /**
+    * Constructor.
+    * @param model_in The model to be updated.
+    * @param method_in The member function that updates the model.
+    */
+   JeodGraphMethodTask (ModelType & model_in, Method method_in)
+   :
+      model(model_in),
+      method(method_in)
+   { }
+
+   /**
+    * Destructor.
+    */
+   virtual ~JeodGraphMethodTask (void) {}
+
+   /**
+    * Call the member function on the model.
+    */
+   virtual void execute (void)
+   {
+      (model.*method) ();
+   }
+
+
+private:
+
+   /**
+    * The model to be updated.
+    */
+   ModelType & model; //!< trick_io(**)
+
+   /**
+    * The member function that updates the model.
+    */
+   Method method; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   JeodGraphMethodTask (const JeodGraphMethodTask &);
+
+   /**
+    * Not implemented.
+    */
+   JeodGraphMethodTask & operator= (const JeodGraphMethodTask &);
+};
+
+
+/**
+ * A JeodGraphFunctionTask calls a function object, typically a lambda that
+ * binds the arguments of a model method, e.g.
+ * TimeManager::initialize (&time_manager_init).
+ */
+class JeodGraphFunctionTask : public JeodGraphTask {
+public:
+
+   /**
+    * Constructor.
+    * @param function_in The function to be called.
+    */
+   explicit JeodGraphFunctionTask (const std::function<void (void)> & function_in)
+   :
+      function(function_in)
+   { }
+
+   /**
+    * Destructor.
+    */
+   virtual ~JeodGraphFunctionTask (void) {}
+
+   /**
+    * Call the function.
+    */
+   virtual void execute (void)
+   {
+      function ();
+   }
+
+private:
+
+   /**
+    * The function called by the task.
+    */
+   std::function<void (void)> function; //!< trick_io(**)
+
+   /**
+    * Not implemented.
+    */
+   JeodGraphFunctionTask (const JeodGraphFunctionTask &);
+
+   /**
+    * Not implemented.
+    */
+   JeodGraphFunctionTask & operator= (const JeodGraphFunctionTask &);
+};
+
+
+/**
+ * A JeodTaskGraph runs the model updates of a simulation step, with updates
+ * that do not depend on one another running concurrently.
+ *
+ * Tasks are added in the order in which a serial schedule would run them,
+ * and declare the data they read and write. Data items are identified by
+ * address, typically that of the model object or of the state it produces
+ * (a planet's reference frame, an atmosphere state). From these
+ * declarations the graph derives the dependencies:
+ *  - A task that reads an item runs after the last earlier task that
+ *    writes it.
+ *  - A task that writes an item runs after the last earlier task that
+ *    writes it and after every task since then that reads it.
+ * Dependencies that the data declarations do not capture can be added
+ * explicitly. Every item a task touches must be declared; two tasks that
+ * touch an undeclared item in common may run at the same time.
+ *
+ * Each call to execute() runs every task once. The ready tasks are executed
+ * on a pool of worker threads plus the calling thread. A thread that
+ * completes a task pushes the tasks it makes ready onto its own queue and
+ * continues with the most recent of them; a thread whose queue is empty
+ * steals the oldest task from another thread's queue.
+ *
+ * \par Assumptions and Limitations
+ *  - Tasks and dependencies must not be added while execute() is running.
+ *  - The graph does not own the tasks.
+ */
+class JeodTaskGraph {
+JEOD_MAKE_SIM_INTERFACES(JeodTaskGraph)
+
+public:
+
+   // Member data
+
+   /**
+    * Number of threads, including the calling thread, used to execute the
+    * graph. Values less than two execute every task on the calling thread,
+    * in a dependency-respecting order. The default is one.
+    */
+   unsigned int num_threads; //!< trick_units(--)
+
+
+   // Member functions
+
+   // Constructor and destructor.
+   JeodTaskGraph (void);
+   ~JeodTaskGraph (void);
+
+   // Add a task; returns the task's index.
+   unsigned int add_task (JeodGraphTask & task, const std::string & name);
+
+   // Declare that a task reads a data item.
+   void add_input (unsigned int task_index, const void * item);
+
+   // Declare that a task writes a data item.
+   void add_output (unsigned int task_index, const void * item);
+
+   // Declare that one task must complete before another starts.
+   void add_dependency (unsigned int before, unsigned int after);
+
+   // Remove all tasks.
+   void clear (void);
+
+   // Execute every task once and wait for completion.
+   void execute (void);
+
+   /**
+    * Get the number of tasks.
+    * @return Task count.
+    */
+   unsigned int get_num_tasks (void) const
+   { return nodes.size(); }
+
+   /**
+    * Get the name of a task.
+    * @return Task name.
+    * @param task_index Task index.
+    */
+   const std::string & get_task_name (unsigned int task_index) const
+   { return nodes[task_index].name; }
+
+   // Get the tasks a task waits for.
+   std::vector<unsigned int> get_predecessors (unsigned int task_index);
+
+
+private:
+
+   /**
+    * A task and its place in the graph.
+    */
+   struct Node {
+      /**
+       * The task.
+       */
+      JeodGraphTask * task;
+
+      /**
+       * Task name, for diagnostics.
+       */
+      std::string name;
+
+      /**
+       * Data items the task reads.
+       */
+      std::vector<const void *> inputs;
+
+      /**
+       * Data items the task writes.
+       */
+      std::vector<const void *> outputs;
+
+      /**
+       * Explicit predecessors.
+       */
+      std::vector<unsigned int> explicit_before;
+
+      /**
+       * Tasks that wait for this task, derived by build().
+       */
+      std::vector<unsigned int> successors;
+
+      /**
+       * Number of tasks this task waits for, derived by build().
+       */
+      unsigned int num_predecessors;
+   };
+
+   /**
+    * A worker's queue of ready tasks. The owner pushes and pops at the
+    * back; other threads steal from the front.
+    */
+   struct ReadyQueue {
+      /**
+       * Guards the tasks.
+       */
+      std::mutex mutex;
+
+      /**
+       * Indices of the ready tasks.
+       */
+      std::deque<unsigned int> tasks;
+   };
+
+
+   // Check a task index.
+   void check_index (unsigned int task_index, const char * function) const;
+
+   // Derive the successor lists and the serial order.
+   void build (void);
+
+   // Create, resize, or stop the worker threads.
+   void prepare_workers (void);
+
+   // Stop the worker threads.
+   void stop_workers (void);
+
+   // Worker thread main loop.
+   void worker_loop (
+      unsigned int thread_index,
+      unsigned long start_generation);
+
+   // Execute ready tasks until the step is complete.
+   void run_tasks (unsigned int thread_index);
+
+   // Take a task from this thread's queue or steal one.
+   bool next_task (unsigned int thread_index, unsigned int & task_index);
+
+
+   /**
+    * The tasks, in order of addition.
+    */
+   std::vector<Node> nodes; //!< trick_io(**)
+
+   /**
+    * Order in which the tasks run serially: the lowest-numbered ready task
+    * first.
+    */
+   std::vector<unsigned int> serial_order; //!< trick_io(**)
+
+   /**
+    * Set when the successor lists reflect the current tasks.
+    */
+   bool built; //!< trick_io(**)
+
+   /**
+    * Per-task count of predecessors not yet complete in this step, guarded
+    * by the mutex.
+    */
+   std::vector<unsigned int> waiting; //!< trick_io(**)
+
+   /**
+    * Number of tasks not yet complete in this step.
+    */
+   std::atomic<unsigned int> remaining; //!< trick_io(**)
+
+   /**
+    * Ready queues, one per thread.
+    */
+   std::vector<ReadyQueue *> queues; //!< trick_io(**)
+
+   /**
+    * The worker threads.
+    */
+   std::vector<std::thread> workers; //!< trick_io(**)
+
+   /**
+    * Guards the waiting counts and the members below.
+    */
+   std::mutex mutex; //!< trick_io(**)
+
+   /**
+    * Signals the workers that a step (or shutdown) has started.
+    */
+   std::condition_variable start_cond; //!< trick_io(**)
+
+   /**
+    * Signals the caller that all workers have left the step.
+    */
+   std::condition_variable done_cond; //!< trick_io(**)
+
+   /**
+    * Incremented for each step, so workers can tell a new step from a
+    * spurious wakeup.
+    */
+   unsigned long generation; //!< trick_io(**)
+
+   /**
+    * Number of workers still in the current step.
+    */
+   unsigned int pending; //!< trick_io(**)
+
+   /**
+    * Set to tell the workers to exit.
+    */
+   bool shutdown; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   JeodTaskGraph (const JeodTaskGraph &);
+
+   /**
+    * Not implemented.
+    */
+   JeodTaskGraph & operator= (const JeodTaskGraph &);
+};
+
+} // End JEOD namespace
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -176,6 +176,15 @@ protected:
 
    void * translate_name_to_addr (const std::string & spec) const;
 
+   // Record the reconstructible allocations and withhold their contents.
+   void checkpoint_references (void);
+
+   // Declare withheld allocations to Trick in full again.
+   void release_withheld_allocations (void);
+
+   // Reconstruct the reconstructible allocations per the checkpoint file.
+   void restore_references (void);
+
    // Member data
    /**
     * Trick checkpoint agent.
@@ -350,6 +350,17 @@ protected:
     */
    int integrate_dt (double beg_sim_time, double del_sim_time) override;
 
+   /**
+    * Integrate sim objects over one sub-step of an integration interval.
+    * integrate_dt divides the interval into the number of sub-steps chosen
+    * by DynManager::schedule_substeps, one in a single rate simulation.
+    *
+    * @return               Zero/non-zero success indicator.
+    * @param beg_sim_time   The time at the start of the sub-step.
+    * @param del_sim_time   The time span of the sub-step.
+    */
+   virtual int integrate_substep (double beg_sim_time, double del_sim_time);
+
 
    // Member data
 
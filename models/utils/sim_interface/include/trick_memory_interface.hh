@@ -69,8 +69,11 @@ Library dependencies:
 #include <cstring>
 #include <list>
 #include <map>
+#include <mutex>
 #include <stdint.h>
 #include <string>
+#include <typeinfo>
+#include <unordered_map>
 
 // JEOD includes
 
@@ -86,6 +89,7 @@ namespace jeod {
 
 // Forward declarations
 class JeodCheckpointable;
+class JeodCheckpointReconstructor;
 class JeodMemoryItem;
 class JeodMemoryManager;
 class JeodMemoryTypeDescriptor;
@@ -182,6 +186,18 @@ public:
    void * get_address_at_name (
       const std::string & name) const override;
 
+   // Mark an allocation as reconstructible.
+   void set_reconstructible (
+      const void * addr,
+      const JeodMemoryItem & item,
+      const JeodMemoryTypeDescriptor & tdesc,
+      const std::string & reference,
+      JeodCheckpointReconstructor & reconstructor) override;
+
+   // Forget a reconstructor that is about to be destroyed.
+   void forget_reconstructor (
+      JeodCheckpointReconstructor & reconstructor) override;
+
 
    /**
     * The generic Trick memory interface does not support checkpoint/restart.
@@ -327,16 +343,112 @@ protected:
    };
 
 
+   /**
+    * Describes a reconstructible chunk of JEOD-allocated memory.
+    */
+   struct ReconstructibleEntry {
+      /**
+       * The allocated memory.
+       */
+      const void * addr; //!< trick_io(**)
+
+      /**
+       * Type description of the allocated memory.
+       */
+      const JeodMemoryTypeDescriptor * tdesc; //!< trick_io(**)
+
+      /**
+       * The number of elements in the allocated chunk of memory.
+       */
+      uint32_t nelements; //!< trick_io(**)
+
+      /**
+       * Identifies the data source; keys the reconstructor map.
+       */
+      std::string reference; //!< trick_io(**)
+
+      /**
+       * Is the memory declared to Trick as a single element while a
+       * checkpoint is being written?
+       */
+      bool withheld; //!< trick_io(**)
+   };
+
    /**
     * Maps JEOD-allocated data names to (type, size) pairs.
     */
    typedef std::map <uint32_t, AllocationMapEntry> AllocationMap;
 
+   /**
+    * Maps JEOD-allocated data names to reconstructible entries.
+    */
+   typedef std::map <uint32_t, ReconstructibleEntry> ReconstructibleMap;
+
+   /**
+    * Maps data source references to the reconstructors that rebuild them.
+    */
+   typedef std::map <std::string, JeodCheckpointReconstructor *>
+      ReconstructorMap;
+
    /**
     * Container of a list of ContainerListEntry objects.
     */
    typedef std::list <ContainerListEntry> ContainerList;
 
+   /**
+    * Maps demangled type names to resolved attributes.
+    */
+   typedef std::unordered_map <std::string,
+                               const JEOD_ATTRIBUTES_POINTER_TYPE>
+      AttributesByName;
+
+   /**
+    * Maps C++ types to resolved attributes.
+    */
+   typedef std::unordered_map <const std::type_info *,
+                               const JEOD_ATTRIBUTES_POINTER_TYPE>
+      AttributesByType;
+
+   /**
+    * A translated address: the attributes it was interpreted with and the
+    * resulting name.
+    */
+   struct AddressName {
+
+      /**
+       * The attributes the address was interpreted with.
+       */
+      const void * attr; //!< trick_io(**)
+
+      /**
+       * The simulation name of the address, or empty if none.
+       */
+      std::string name; //!< trick_io(**)
+   };
+
+   /**
+    * Maps addresses to their translated names.
+    */
+   typedef std::unordered_map <const void *, AddressName> NameByAddress;
+
+   /**
+    * Maps names to their translated addresses.
+    */
+   typedef std::unordered_map <std::string, void *> AddressByName;
+
+
+   // Member functions
+
+   // Forget the name and address translations.
+   void clear_translation_cache () const;
+
+   // Declare allocated memory to Trick.
+   bool declare_allocation (
+      const void * addr,
+      const JeodMemoryTypeDescriptor & tdesc,
+      uint32_t unique_id,
+      uint32_t nelems);
+
 
    // Member data
 
@@ -355,6 +467,17 @@ protected:
     */
    ContainerList container_list; //!< trick_io(**)
 
+   /**
+    * Reconstructible allocations, a subset of the allocation map.
+    */
+   ReconstructibleMap reconstructible_map; //!< trick_io(**)
+
+   /**
+    * Reconstructors by reference. Unlike the reconstructible map, this
+    * survives the clearing of memory at restart.
+    */
+   ReconstructorMap reconstructor_map; //!< trick_io(**)
+
    /**
     * Prefix used for constructing a unique name for JEOD-allocated memory.
     */
@@ -370,6 +493,34 @@ protected:
     */
    JeodSimulationInterface::Mode mode; //!< trick_units(--)
 
+   /**
+    * Guards the attribute and translation caches.
+    */
+   mutable std::mutex translation_mutex; //!< trick_io(**)
+
+   /**
+    * Attributes found by type name, including those not found (null), so
+    * that the symbol table is searched once per type.
+    */
+   mutable AttributesByName attributes_by_name; //!< trick_io(**)
+
+   /**
+    * Attributes found by type, which spares the name demangling as well.
+    */
+   mutable AttributesByType attributes_by_type; //!< trick_io(**)
+
+   /**
+    * Address to name translations. Valid while the set of allocations is
+    * unchanged; cleared by clear_translation_cache().
+    */
+   mutable NameByAddress name_by_address; //!< trick_io(**)
+
+   /**
+    * Name to address translations that succeeded. Valid while the set of
+    * allocations is unchanged; cleared by clear_translation_cache().
+    */
+   mutable AddressByName address_by_name; //!< trick_io(**)
+
 
 private:
 
@@ -75,6 +75,7 @@ Library dependencies:
 
 // JEOD includes
 #include "utils/container/include/primitive_set.hh"
+#include "utils/message/include/async_message_sink.hh"
 #include "utils/message/include/suppressed_code_message_handler.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
@@ -92,6 +93,17 @@ class TrickMessageHandler: public SuppressedCodeMessageHandler {
    JEOD_MAKE_SIM_INTERFACES(TrickMessageHandler)
 
 public:
+
+   // Member data
+
+   /**
+    * Sink that writes non-fatal messages from a background thread once
+    * set_asynchronous(true) has been called. Its rate limit and drain
+    * interval are set before that call.
+    */
+   AsyncMessageSink async_sink; //!< trick_units(--)
+
+
    // Member functions
 
    // Default constructor and destructor
@@ -110,11 +122,14 @@ public:
       /**
     * Destructor.
     */
-   ~TrickMessageHandler (void) override {}
+   ~TrickMessageHandler (void) override;
 
    // register_contents() registers the checkpointable contents.
    void register_contents (void) override;
 
+   // set_asynchronous() turns the asynchronous message sink on or off.
+   void set_asynchronous (bool asynchronous);
+
 
  protected:
 
@@ -132,6 +147,12 @@ public:
    const override;
 
 
+ private:
+
+   // deliver_message() writes a message posted to the asynchronous sink.
+   static void deliver_message (void * handler, const char * text);
+
+
  // The copy constructor and assignment operator for this class are declared
  // private and are not implemented.
  private:
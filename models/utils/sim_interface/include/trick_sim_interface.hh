@@ -110,6 +110,42 @@ public:
    std::string get_checkpoint_file_name () const
    { return checkpoint_file_name; }
 
+   /**
+    * Select the format of the JEOD checkpoint file.
+    * \param[in] binary      Write sections in binary form?
+    * \param[in] incremental Write unchanged records as references to the
+    *                        earlier checkpoint files that hold them?
+    *                        Restarting from an incremental checkpoint
+    *                        requires those files.
+    * \param[in] compress    Compress record contents?
+    */
+   void set_checkpoint_format (bool binary, bool incremental, bool compress)
+   {
+      checkpoint_binary = binary;
+      checkpoint_incremental = incremental;
+      checkpoint_compress = compress;
+      finish_background_checkpoint ();
+      checkpoint_history.clear();
+   }
+
+   /**
+    * Set how often an incremental checkpoint is instead written in full.
+    * \param[in] interval Every interval'th checkpoint is full; zero means
+    *                     only the first checkpoint after startup or restart.
+    */
+   void set_checkpoint_full_interval (unsigned int interval)
+   { checkpoint_full_interval = interval; }
+
+   /**
+    * Select whether the JEOD checkpoint file is written in the background.
+    * When set, the checkpoint jobs collect the sections in memory and
+    * close_checkpoint_file hands them to a background thread that encodes
+    * and writes them, so the simulation pauses only for the collection.
+    * \param[in] asynchronous Write the checkpoint file in the background?
+    */
+   void set_checkpoint_asynchronous (bool asynchronous)
+   { checkpoint_asynchronous = asynchronous; }
+
 
    // The next set of functions are public because they are called by the
    // JEODSysSimObject sim object (see).
@@ -172,6 +208,9 @@ protected:
    SectionedOutputStream get_checkpoint_writer_internal (
       const std::string & section_id) override;
 
+   // Wait for the checkpoint file being written in the background, if any.
+   void finish_background_checkpoint (void);
+
 
    // Member data
 
@@ -199,6 +238,36 @@ protected:
     */
    std::string checkpoint_file_name; //!< trick_units(--)
 
+   /**
+    * Write the JEOD checkpoint file sections in binary form?
+    */
+   bool checkpoint_binary; //!< trick_units(--)
+
+   /**
+    * Write binary checkpoints incrementally?
+    */
+   bool checkpoint_incremental; //!< trick_units(--)
+
+   /**
+    * Compress binary checkpoint records?
+    */
+   bool checkpoint_compress; //!< trick_units(--)
+
+   /**
+    * Interval, in checkpoints, between full incremental checkpoints.
+    */
+   unsigned int checkpoint_full_interval; //!< trick_units(--)
+
+   /**
+    * Where the records of earlier binary checkpoints were stored.
+    */
+   CheckPointRecordHistory checkpoint_history; //!< trick_io(**)
+
+   /**
+    * Write the JEOD checkpoint file on a background thread?
+    */
+   bool checkpoint_asynchronous; //!< trick_units(--)
+
    /**
     * String indicating the start of a checkpoint file section.
     */
@@ -219,6 +288,12 @@ protected:
     */
    CheckPointOutputManager * checkpoint_writer; //!< trick_io(**)
 
+   /**
+    * The object that is writing the previous checkpoint file
+    * in the background.
+    */
+   CheckPointOutputManager * background_checkpoint_writer; //!< trick_io(**)
+
 
 private:
 
@@ -0,0 +1,185 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/branch_driver.cc
+ * Define JeodBranchDriver methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((branch_driver.cc)
+   (sim_interface_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/branch_driver.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a JeodBranchDriver.
+ */
+JeodBranchDriver::JeodBranchDriver (
+   void)
+:
+   dispersions(),
+   max_workers(1),
+   run_index(-1),
+   num_failed_runs(0)
+{
+   ; // Empty
+}
+
+
+/**
+ * Destruct a JeodBranchDriver.
+ * The dispersions are not owned by the driver.
+ */
+JeodBranchDriver::~JeodBranchDriver (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Register a dispersion to be applied in each worker.
+ * \param[in] dispersion Dispersion to be applied
+ */
+void
+JeodBranchDriver::add_dispersion (
+   JeodBranchDispersion & dispersion)
+{
+   dispersions.push_back (&dispersion);
+}
+
+
+/**
+ * Fork one worker per run, at most max_workers at a time.
+ * In a worker, the registered dispersions are applied for the worker's run
+ * and the run index is returned; the worker then continues the simulation.
+ * In the parent, the call returns after every worker has finished.
+ * @return Run index in a worker, -1 in the parent.
+ * \param[in] num_runs Number of runs
+ */
+int
+JeodBranchDriver::branch (
+   unsigned int num_runs)
+{
+   unsigned int next_run = 0;
+   std::vector<pid_t> workers;
+
+   if (run_index >= 0) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::phasing_error,
+         "Illegal attempt to branch from within branched run %d.",
+         run_index);
+      return run_index;
+   }
+
+   num_failed_runs = 0;
+
+   while ((next_run < num_runs) || (! workers.empty())) {
+
+      // Start workers until the limit is reached or all runs are started.
+      while ((next_run < num_runs) && (workers.size() < max_workers)) {
+
+         // Buffered output would otherwise be written by parent and worker.
+         std::fflush (nullptr);
+
+         pid_t pid = fork ();
+
+         // Worker: Apply the dispersions and run.
+         if (pid == 0) {
+            run_index = static_cast<int> (next_run);
+            for (std::vector<JeodBranchDispersion *>::iterator iter =
+                    dispersions.begin();
+                 iter != dispersions.end();
+                 ++iter) {
+               (*iter)->apply_dispersion (next_run);
+            }
+            return run_index;
+         }
+
+         // Fork failed: Count the run as failed and move on.
+         else if (pid < 0) {
+            MessageHandler::error (
+               __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+               "Unable to fork the worker for run %u: %s",
+               next_run, std::strerror (errno));
+            ++num_failed_runs;
+         }
+
+         else {
+            workers.push_back (pid);
+         }
+         ++next_run;
+      }
+
+      // Wait for a worker to finish. Other children are not ours to count.
+      if (! workers.empty()) {
+         int status;
+         pid_t pid = waitpid (-1, &status, 0);
+         if (pid < 0) {
+            if (errno == EINTR) {
+               continue;
+            }
+            MessageHandler::error (
+               __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+               "Unable to wait for branched runs: %s",
+               std::strerror (errno));
+            num_failed_runs += workers.size() + (num_runs - next_run);
+            break;
+         }
+         std::vector<pid_t>::iterator worker =
+            std::find (workers.begin(), workers.end(), pid);
+         if (worker == workers.end()) {
+            continue;
+         }
+         workers.erase (worker);
+         if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+            ++num_failed_runs;
+         }
+      }
+   }
+
+   return -1;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
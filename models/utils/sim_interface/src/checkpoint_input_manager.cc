@@ -20,6 +20,11 @@
 #include <cstddef>
 #include <cstring>
 #include <iostream>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
@@ -46,6 +51,7 @@ SectionedInputBuffer::SectionedInputBuffer ()
 :
    std::streambuf (),
    file_buf       (nullptr),
+   memory         (nullptr),
    start_pos      (0),
    end_pos        (0),
    curr_pos       (0),
@@ -71,12 +77,35 @@ SectionedInputBuffer::activate (
    std::size_t epos)
 {
    file_buf = stream.rdbuf();
+   memory   = nullptr;
    curr_pos = start_pos = spos;
    end_pos  = epos;
    at_eof   = start_pos >= end_pos;
 }
 
 
+/**
+ * Activate the object to read section contents held in memory, either a text
+ * section of a mapped file or the decoded contents of a binary section.
+ * The entire contents form the get area; there is no further input.
+ * \param[in] section_memory Start of the section contents
+ * \param[in] size Size of the section contents
+ */
+void
+SectionedInputBuffer::activate (
+   const char * section_memory,
+   std::size_t size)
+{
+   char * begin = const_cast<char *> (section_memory);
+   file_buf = nullptr;
+   memory   = section_memory;
+   curr_pos = start_pos = 0;
+   end_pos  = size;
+   at_eof   = (size == 0);
+   this->setg (begin, begin, begin + size);
+}
+
+
 /**
  * Get a character in the case of depletion of the read buffer.
  * For now, the buffer is always depleted.
@@ -93,8 +122,9 @@ SectionedInputBuffer::underflow (
       result = std::streambuf::traits_type::eof();
    }
 
+   // Content in memory is entirely in the get area; it has been consumed.
    // End of section *is* end of file.
-   else if (curr_pos >= end_pos) {
+   else if ((memory != nullptr) || (curr_pos >= end_pos)) {
       at_eof = true;
       result = std::streambuf::traits_type::eof();
    }
@@ -135,6 +165,7 @@ SectionedInputStream::SectionedInputStream ()
    stream       (nullptr),
    start_pos    (0),
    end_pos      (0),
+   memory       (nullptr),
    is_copy      (false),
    is_active    (false)
 {
@@ -162,6 +193,35 @@ SectionedInputStream::SectionedInputStream (
    stream       (&ifstream),
    start_pos    (spos),
    end_pos      (epos),
+   memory       (nullptr),
+   is_copy      (false),
+   is_active    (false)
+{
+   ; // Empty
+}
+
+
+/**
+ * Construct a SectionedInputStream object that reads section contents held
+ * in memory on behalf of a CheckPointInputManager.
+ * \param[in] mngr The stream manager
+ * \param[in] ifstream The input file stream
+ * \param[in] section_memory Section contents, owned by mngr
+ * \param[in] size Size of the section contents
+ */
+SectionedInputStream::SectionedInputStream (
+   CheckPointInputManager * mngr,
+   std::ifstream & ifstream,
+   const char * section_memory,
+   std::size_t size)
+:
+   std::istream (&sectbuf),
+   sectbuf      (),
+   manager      (mngr),
+   stream       (&ifstream),
+   start_pos    (0),
+   end_pos      (size),
+   memory       (section_memory),
    is_copy      (false),
    is_active    (false)
 {
@@ -183,6 +243,7 @@ SectionedInputStream::SectionedInputStream (
    stream       (source.stream),
    start_pos    (source.start_pos),
    end_pos      (source.end_pos),
+   memory       (source.memory),
    is_copy      (true),
    is_active    (false)
 {
@@ -269,11 +330,17 @@ SectionedInputStream::activate (
    }
 
    // All is cool.
-   // Point the file to the start of the checkpoint section and
+   // Point the buffer at section contents held in memory, or
+   // point the file to the start of the checkpoint section and
    // activate the buffer.
-   stream->clear();
-   stream->seekg(start_pos);
-   sectbuf.activate (*stream, start_pos, end_pos);
+   if (memory != nullptr) {
+      sectbuf.activate (memory, end_pos - start_pos);
+   }
+   else {
+      stream->clear();
+      stream->seekg(start_pos);
+      sectbuf.activate (*stream, start_pos, end_pos);
+   }
    is_active = true;
 
    return true;
@@ -317,14 +384,20 @@ CheckPointInputManager::CheckPointInputManager (
    const std::string & end_marker)
 :
    sections       (),
-   stream         (fname.c_str(), std::ios::in),
+   binary_records   (),
+   decoded_sections (),
+   referenced_files (),
+   stream         (fname.c_str(), std::ios::in | std::ios::binary),
    current_reader (nullptr),
    filename       (fname),
    section_start  (start_marker),
    section_end    (end_marker),
-   is_open        (true)
+   is_open        (true),
+   mapped_data    (nullptr),
+   mapped_size    (0)
 {
    if (stream.is_open ()) {
+      map_file();
       initialize();
    }
    else {
@@ -337,8 +410,89 @@ CheckPointInputManager::CheckPointInputManager (
 }
 
 
+/**
+ * Destruct a CheckPointInputManager object.
+ */
+CheckPointInputManager::~CheckPointInputManager (
+   void)
+{
+   for (std::map<std::string, CheckPointInputManager *>::iterator iter =
+           referenced_files.begin();
+        iter != referenced_files.end();
+        ++iter) {
+      delete iter->second;
+   }
+
+   if (mapped_data != nullptr) {
+      munmap (const_cast<char *> (mapped_data), mapped_size);
+   }
+}
+
+
+/**
+ * Map the checkpoint file into memory, read-only.
+ * Failure is not an error; the file stream is used instead.
+ */
+void
+CheckPointInputManager::map_file (void)
+{
+   struct stat file_stat;
+   int fd = open (filename.c_str(), O_RDONLY);
+
+   if (fd < 0) {
+      return;
+   }
+
+   if ((fstat (fd, &file_stat) == 0) && (file_stat.st_size > 0)) {
+      void * addr = mmap (nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE,
+                          fd, 0);
+      if (addr != MAP_FAILED) {
+         mapped_data = static_cast<const char *> (addr);
+         mapped_size = file_stat.st_size;
+      }
+   }
+
+   close (fd);
+}
+
+
+/**
+ * Get the line of the file that starts at @a pos, without the newline.
+ * @return True if a line was read, false at end of file.
+ * \param[in,out] pos Position of the line; updated to that of the next line
+ * \param[out] line The line
+ */
+bool
+CheckPointInputManager::next_line (
+   std::size_t & pos,
+   std::string & line)
+{
+   if (mapped_data != nullptr) {
+      if (pos >= mapped_size) {
+         return false;
+      }
+      const char * begin = mapped_data + pos;
+      const char * newline = static_cast<const char *> (
+         std::memchr (begin, '\n', mapped_size - pos));
+      std::size_t length =
+         (newline != nullptr) ? (newline - begin) : (mapped_size - pos);
+      line.assign (begin, length);
+      pos += (newline != nullptr) ? length + 1 : length;
+      return true;
+   }
+
+   if (! std::getline (stream, line)) {
+      return false;
+   }
+   pos = static_cast<std::size_t>(stream.tellg());
+   return true;
+}
+
+
 /**
  * Determine the locations of the various sections that comprise the file.
+ * The payload of a binary section is skipped rather than scanned, as its
+ * bytes are arbitrary.
  */
 void
 CheckPointInputManager::initialize (void)
@@ -348,16 +502,24 @@ CheckPointInputManager::initialize (void)
    bool have_sections = false;
    bool old_style = false;
    bool corrupted = false;
+   bool binary = false;
+   bool at_section_top = false;
    std::size_t prev_pos = 0;
    std::size_t start_pos = 0;
+   std::size_t payload_end = 0;
    std::string section_id;
+   const std::string binary_tag =
+      std::string (CheckPointSectionCodec::binary_tag) + ' ';
+
+   std::size_t next_pos = 0;
 
-   while (std::getline(stream, line)) {
-      std::size_t next_pos = static_cast<std::size_t>(stream.tellg());
+   while (next_line (next_pos, line)) {
       if (! in_section) {
          if (line.compare(0, section_start.length(), section_start) == 0) {
             section_id = line.substr (section_start.length());
             start_pos = next_pos;
+            binary = false;
+            at_section_top = true;
             have_sections = in_section = true;
             corrupted = corrupted || old_style;
          }
@@ -372,12 +534,36 @@ CheckPointInputManager::initialize (void)
          }
       }
 
+      // A binary section header can only be the first non-blank line.
+      else if (at_section_top &&
+               (line.compare(0, binary_tag.length(), binary_tag) == 0)) {
+         unsigned int version = 0;
+         std::size_t payload_size = 0;
+         std::istringstream header (line.substr (binary_tag.length()));
+         header >> version >> payload_size;
+         if ((! header) ||
+             (version != CheckPointSectionCodec::format_version)) {
+            corrupted = true;
+         }
+         binary = true;
+         at_section_top = false;
+         start_pos = next_pos;
+         payload_end = next_pos + payload_size;
+         if (mapped_data == nullptr) {
+            stream.seekg (payload_end);
+         }
+         next_pos = payload_end;
+      }
+
       else {
+         at_section_top = at_section_top && line.empty();
          if (line.compare(0, section_end.length(), section_end) == 0) {
             if (line.substr(section_end.length()). compare(section_id) == 0) {
                sections.insert (
                   std::pair<std::string, SectionInfo> (
-                     section_id, SectionInfo(start_pos, prev_pos)));
+                     section_id,
+                     binary ? SectionInfo(start_pos, payload_end, true) :
+                              SectionInfo(start_pos, prev_pos)));
             }
             else {
                corrupted = true;
@@ -451,6 +637,28 @@ CheckPointInputManager::create_section_reader (
       return SectionedInputStream ();
    }
 
+   else if (iter->second.binary) {
+      std::map<std::string, std::string>::iterator decoded =
+         decoded_sections.find (tag);
+      if (decoded == decoded_sections.end()) {
+         decoded = decoded_sections.insert (
+                      std::make_pair (tag, std::string())).first;
+         if (! decode_binary_section (tag, decoded->second)) {
+            decoded_sections.erase (decoded);
+            return SectionedInputStream ();
+         }
+      }
+      return SectionedInputStream (
+                this, stream, decoded->second.data(), decoded->second.size());
+   }
+
+   else if (mapped_data != nullptr) {
+      SectionInfo info(iter->second);
+      return SectionedInputStream (
+                 this, stream, mapped_data + info.start_pos,
+                 info.end_pos - info.start_pos);
+   }
+
    else {
       SectionInfo info(iter->second);
       return SectionedInputStream (
@@ -459,6 +667,142 @@ CheckPointInputManager::create_section_reader (
 }
 
 
+/**
+ * Get the decoded records of a binary section, decoding them on first use.
+ * @return Records, or null if the section is missing, not binary, or corrupt.
+ * \param[in] tag Section name
+ */
+const CheckPointInputManager::RecordList *
+CheckPointInputManager::get_binary_records (
+   const std::string & tag)
+{
+   std::map<std::string, RecordList>::iterator found =
+      binary_records.find (tag);
+   if (found != binary_records.end()) {
+      return &found->second;
+   }
+
+   std::map<std::string, SectionInfo>::iterator iter = sections.find(tag);
+   if ((!*this) || (iter == sections.end()) || (! iter->second.binary)) {
+      return nullptr;
+   }
+
+   // Decode the payload in place if the file is mapped.
+   const SectionInfo & info = iter->second;
+   std::size_t payload_size = info.end_pos - info.start_pos;
+   bool ok;
+   RecordList records;
+   if ((mapped_data != nullptr) && (info.end_pos <= mapped_size)) {
+      ok = CheckPointSectionCodec::decode_records (
+              mapped_data + info.start_pos, payload_size, records);
+   }
+   else {
+      std::string payload (payload_size, '\0');
+      stream.clear();
+      stream.seekg (info.start_pos);
+      stream.read (&payload[0], payload.size());
+      ok = (!! stream) &&
+           CheckPointSectionCodec::decode_records (payload, records);
+   }
+
+   if (! ok) {
+      stream.clear();
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "Checkpoint file '%s' section '%s' is corrupted.",
+         filename.c_str(), tag.c_str());
+      return nullptr;
+   }
+
+   RecordList & stored = binary_records[tag];
+   stored.swap (records);
+   return &stored;
+}
+
+
+/**
+ * Find the content of a data record in a binary section of this file.
+ * @return True if the record was found.
+ * \param[in] tag Section name
+ * \param[in] key Record key
+ * \param[in] hash Hash of the record content
+ * \param[out] content Record content, owned by this object
+ */
+bool
+CheckPointInputManager::find_record_content (
+   const std::string & tag,
+   const std::string & key,
+   uint64_t hash,
+   const std::string * & content)
+{
+   const RecordList * records = get_binary_records (tag);
+   if (records == nullptr) {
+      return false;
+   }
+   for (RecordList::const_iterator iter = records->begin();
+        iter != records->end();
+        ++iter) {
+      if ((! iter->is_reference) &&
+          (iter->hash == hash) &&
+          (iter->key == key)) {
+         content = &iter->value;
+         return true;
+      }
+   }
+   return false;
+}
+
+
+/**
+ * Reconstruct the text written to a binary section by concatenating its
+ * records, fetching the content of reference records from the earlier
+ * checkpoint files that hold them.
+ * @return True if every record was resolved.
+ * \param[in] tag Section name
+ * \param[out] text Section text
+ */
+bool
+CheckPointInputManager::decode_binary_section (
+   const std::string & tag,
+   std::string & text)
+{
+   const RecordList * records = get_binary_records (tag);
+   if (records == nullptr) {
+      return false;
+   }
+
+   text.clear();
+   for (RecordList::const_iterator iter = records->begin();
+        iter != records->end();
+        ++iter) {
+      if (! iter->is_reference) {
+         text += iter->value;
+         continue;
+      }
+
+      CheckPointInputManager *& source = referenced_files[iter->value];
+      if (source == nullptr) {
+         source = new CheckPointInputManager (
+                         iter->value, section_start, section_end);
+      }
+
+      const std::string * content = nullptr;
+      if (! source->find_record_content (tag, iter->key, iter->hash, content)) {
+         MessageHandler::error (
+            __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+            "Checkpoint file '%s' section '%s' refers to record '%s' in "
+            "'%s', which does not hold it.",
+            filename.c_str(), tag.c_str(), iter->key.c_str(),
+            iter->value.c_str());
+         return false;
+      }
+      text += *content;
+   }
+
+   return true;
+}
+
+
 /**
  * Create a C++ input stream that reads from the Trick checkpoint file section.
  * @return Trick SectionedInputStream object.
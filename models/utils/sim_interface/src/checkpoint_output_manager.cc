@@ -26,6 +26,7 @@
 
 // Model includes
 #include "../include/checkpoint_output_manager.hh"
+#include "../include/checkpoint_section_codec.hh"
 #include "../include/sim_interface_messages.hh"
 
 
@@ -33,6 +34,114 @@
 //! Namespace jeod 
 namespace jeod {
 
+/**
+ * Construct an empty CheckPointRecordHistory object.
+ */
+CheckPointRecordHistory::CheckPointRecordHistory ()
+:
+   entries(),
+   checkpoint_count(0)
+{
+   ; // Empty
+}
+
+
+/**
+ * Prepare for writing a checkpoint file.
+ * Records held by a file of the same name are about to be overwritten and
+ * are forgotten. Every full_interval'th checkpoint forgets everything, which
+ * makes that checkpoint a full one and ends the dependence on earlier files.
+ * \param[in] file Name of the checkpoint file about to be written
+ * \param[in] full_interval Full checkpoint interval; zero means only the
+ *            first checkpoint is full
+ */
+void
+CheckPointRecordHistory::start_checkpoint (
+   const std::string & file,
+   unsigned int full_interval)
+{
+   if ((full_interval > 0) && ((checkpoint_count % full_interval) == 0)) {
+      entries.clear();
+   }
+   else {
+      forget_file (file);
+   }
+   ++checkpoint_count;
+}
+
+
+/**
+ * Find the file that holds a record with the given content hash.
+ * @return True if some earlier file holds exactly this content.
+ * \param[in] record_id Section tag and record key
+ * \param[in] hash Hash of the record content
+ * \param[out] file File that holds the record
+ */
+bool
+CheckPointRecordHistory::find (
+   const std::string & record_id,
+   uint64_t hash,
+   std::string & file)
+const
+{
+   std::map<std::string, Entry>::const_iterator iter = entries.find (record_id);
+   if ((iter == entries.end()) || (iter->second.hash != hash)) {
+      return false;
+   }
+   file = iter->second.file;
+   return true;
+}
+
+
+/**
+ * Note that a file holds a record with the given content hash.
+ * \param[in] record_id Section tag and record key
+ * \param[in] hash Hash of the record content
+ * \param[in] file File that holds the record
+ */
+void
+CheckPointRecordHistory::update (
+   const std::string & record_id,
+   uint64_t hash,
+   const std::string & file)
+{
+   Entry & entry = entries[record_id];
+   entry.hash = hash;
+   entry.file = file;
+}
+
+
+/**
+ * Forget all records held by a file.
+ * \param[in] file File name
+ */
+void
+CheckPointRecordHistory::forget_file (
+   const std::string & file)
+{
+   std::map<std::string, Entry>::iterator iter = entries.begin();
+   while (iter != entries.end()) {
+      if (iter->second.file == file) {
+         entries.erase (iter++);
+      }
+      else {
+         ++iter;
+      }
+   }
+}
+
+
+/**
+ * Forget everything. The next checkpoint will be a full checkpoint.
+ */
+void
+CheckPointRecordHistory::clear (
+   void)
+{
+   entries.clear();
+}
+
+
 /**
  * Default constructor.
  *
@@ -45,7 +154,8 @@ namespace jeod {
 SectionedOutputBuffer::SectionedOutputBuffer ()
 :
    std::streambuf(),
-   file_buf(nullptr)
+   file_buf(nullptr),
+   capture(nullptr)
 {
    setp (nullptr,nullptr);
 }
@@ -62,6 +172,21 @@ SectionedOutputBuffer::activate (
    std::ofstream & stream)
 {
    file_buf = stream.rdbuf();
+   capture = nullptr;
+   setp (nullptr,nullptr);
+}
+
+
+/**
+ * Activate the object to append everything written to a string.
+ * \param[in,out] content String that collects the output
+ */
+void
+SectionedOutputBuffer::activate (
+   std::string & content)
+{
+   file_buf = nullptr;
+   capture = &content;
    setp (nullptr,nullptr);
 }
 
@@ -87,13 +212,19 @@ SectionedOutputBuffer::overflow (
    else if (std::streambuf::traits_type::eq_int_type (
                ch, std::streambuf::traits_type::eof())) {
       try {
-         result = file_buf->pubsync();
+         result = (file_buf != nullptr) ? file_buf->pubsync() : 0;
       }
       catch (...) {
          result = std::streambuf::traits_type::eof();
       }
    }
 
+   // Collecting in memory: Append the character to the string.
+   else if (capture != nullptr) {
+      capture->push_back (std::streambuf::traits_type::to_char_type(ch));
+      result = ch;
+   }
+
    // The response to non-EOF is write the character to the real buffer.
    else {
       try {
@@ -109,6 +240,45 @@ SectionedOutputBuffer::overflow (
 }
 
 
+/**
+ * Write a sequence of characters. Sections collected in memory append the
+ * sequence in one step rather than character by character.
+ * @return Number of characters written
+ * \param[in] str Characters to be written
+ * \param[in] count Number of characters
+ */
+std::streamsize
+SectionedOutputBuffer::xsputn (
+   const char * str,
+   std::streamsize count)
+{
+   std::streamsize result;
+
+   // Protect against writes to an inoperable object.
+   if (!*this) {
+      result = 0;
+   }
+
+   // Collecting in memory: Append the characters to the string.
+   else if (capture != nullptr) {
+      capture->append (str, static_cast<std::size_t>(count));
+      result = count;
+   }
+
+   // Otherwise pass the characters to the real buffer.
+   else {
+      try {
+         result = file_buf->sputn (str, count);
+      }
+      catch (...) {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+
 /**
  * Construct a SectionedOutputStream object.
  * @note
@@ -125,7 +295,8 @@ SectionedOutputStream::SectionedOutputStream ()
    section_end   (nullptr),
    tag           (""),
    is_copy       (false),
-   is_active     (false)
+   is_active     (false),
+   is_binary     (false)
 {
    ; // Empty
 }
@@ -155,7 +326,8 @@ SectionedOutputStream::SectionedOutputStream (
     section_end   (&end_marker),
     tag           (section_name),
     is_copy       (false),
-    is_active     (false)
+    is_active     (false),
+    is_binary     (false)
 {
     ; // Empty
 }
@@ -177,7 +349,8 @@ SectionedOutputStream::SectionedOutputStream (
    section_end   (source.section_end),
    tag           (source.tag),
    is_copy       (true),
-   is_active     (false)
+   is_active     (false),
+   is_binary     (false)
 {
    // No making copies of a copy, an active object, or an invalid object.
    // Oops. Too late now; we just did just that. Undo the copy.
@@ -259,6 +432,16 @@ SectionedOutputStream::activate (
       return false;
    }
 
+   // Binary and deferred sections are collected in memory and handed to the
+   // manager when the section is deactivated. The Trick section is always
+   // text.
+   is_binary = manager->is_binary() && (tag.compare ("Trick") != 0);
+   if (is_binary || manager->is_asynchronous()) {
+      sectbuf.activate (manager->pending);
+      is_active = true;
+      return true;
+   }
+
    // All is cool. Write the section header to the file and activate.
    // Note: The destructor eventually writes the corresponding section trailer.
 
@@ -289,9 +472,15 @@ SectionedOutputStream::deactivate (
    void)
 {
 
-   // Write the section trailer to the file if OK.
+   // Complete the section collected in memory or write the text section
+   // trailer to the file if OK.
    if (!!*this) {
-      *stream << "\n" << *section_end << tag << std::endl;
+      if (is_binary || manager->is_asynchronous()) {
+         manager->end_section (tag, is_binary);
+      }
+      else {
+         *stream << "\n" << *section_end << tag << std::endl;
+      }
    }
 
    // Deregister this object as the active writer.
@@ -306,6 +495,23 @@ SectionedOutputStream::deactivate (
    manager = nullptr;
    stream = nullptr;
    is_active = false;
+   is_binary = false;
+}
+
+
+/**
+ * End the current record of a binary section. Everything written since the
+ * previous record ended becomes a record identified by @a key, which must be
+ * unique within the section. Text sections are unaffected.
+ * \param[in] key Record key
+ */
+void
+SectionedOutputStream::end_record (
+   const std::string & key)
+{
+   if (is_active && is_binary) {
+      manager->end_record (key);
+   }
 }
 
 
@@ -325,7 +531,16 @@ CheckPointOutputManager::CheckPointOutputManager (
    filename       (fname),
    section_start  (start_marker),
    section_end    (end_marker),
-   is_open        (true)
+   is_open        (true),
+   binary         (false),
+   compress       (false),
+   history        (nullptr),
+   pending        (),
+   records        (),
+   asynchronous   (false),
+   deferred       (),
+   background_active (false),
+   background_thread ()
 {
    if (! stream.is_open ()) {
       is_open = false;
@@ -337,6 +552,23 @@ CheckPointOutputManager::CheckPointOutputManager (
 }
 
 
+/**
+ * Destruct a CheckPointOutputManager object.
+ * Sections that are still deferred are written, in the background if that
+ * was started and in the foreground otherwise.
+ */
+CheckPointOutputManager::~CheckPointOutputManager (
+   void)
+{
+   if (background_active) {
+      wait_for_background_write ();
+   }
+   else if (! deferred.empty()) {
+      write_deferred_sections ();
+   }
+}
+
+
 /**
  * Create a C++ output stream that writes to a checkpoint file section.
  * @par Usage
@@ -354,7 +586,15 @@ CheckPointOutputManager::create_section_writer (
    const std::string & tag)
 {
 
-   if (!*this) {
+   if (background_active) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "Checkpoint file '%s' is being written in the background.",
+         filename.c_str());
+      return SectionedOutputStream ();
+   }
+
+   else if (!*this) {
       MessageHandler::error (
          __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
          "Checkpoint file '%s' is %s.",
@@ -394,6 +634,249 @@ CheckPointOutputManager::create_trick_section_writer (
 }
 
 
+/**
+ * Write sections other than the Trick section in binary form.
+ * \param[in] compress_records Compress record contents?
+ * \param[in,out] record_history History for incremental checkpoints, or
+ *                null to write every record in full
+ */
+void
+CheckPointOutputManager::enable_binary_format (
+   bool compress_records,
+   CheckPointRecordHistory * record_history)
+{
+   binary = true;
+   compress = compress_records;
+   history = record_history;
+}
+
+
+/**
+ * Collect sections in memory and defer writing them to the file until
+ * start_background_write is called.
+ */
+void
+CheckPointOutputManager::enable_asynchronous_write (
+   void)
+{
+   asynchronous = true;
+}
+
+
+/**
+ * Start a background thread that writes the deferred sections to the file.
+ * The caller must not create section writers until the thread has finished,
+ * which wait_for_background_write (or the destructor) ensures.
+ * @return True if the thread was started. If it could not be started the
+ *         sections are written in the foreground.
+ */
+bool
+CheckPointOutputManager::start_background_write (
+   void)
+{
+   if (background_active || (current_writer != nullptr)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "Illegal attempt to start writing '%s' in the background "
+         "while it is being written.",
+         filename.c_str());
+      return false;
+   }
+
+   if (pthread_create (&background_thread, nullptr,
+                       background_write_main, this) != 0) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "Unable to start the background writer for '%s'; "
+         "writing in the foreground.",
+         filename.c_str());
+      write_deferred_sections ();
+      return false;
+   }
+
+   background_active = true;
+   return true;
+}
+
+
+/**
+ * Wait for the background thread, if any, to finish writing the file.
+ * @return True if the file was written successfully.
+ */
+bool
+CheckPointOutputManager::wait_for_background_write (
+   void)
+{
+   if (background_active) {
+      pthread_join (background_thread, nullptr);
+      background_active = false;
+   }
+
+   if (is_open && !stream) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "Error writing checkpoint file '%s'.",
+         filename.c_str());
+      return false;
+   }
+   return true;
+}
+
+
+/**
+ * Background thread entry point.
+ * @return Null
+ * \param[in,out] manager The CheckPointOutputManager
+ */
+void *
+CheckPointOutputManager::background_write_main (
+   void * manager)
+{
+   static_cast<CheckPointOutputManager *>(manager)->write_deferred_sections();
+   return nullptr;
+}
+
+
+/**
+ * Write the deferred sections to the file, in the order in which they were
+ * collected, and flush the file.
+ * @note
+ * This runs on the background thread. It must not issue messages.
+ */
+void
+CheckPointOutputManager::write_deferred_sections (
+   void)
+{
+   for (std::size_t ii = 0; ii < deferred.size(); ++ii) {
+      DeferredSection & section = deferred[ii];
+      if (section.binary) {
+         write_binary_section (section.tag, section.records);
+      }
+      else {
+         write_text_section (section.tag, section.content);
+      }
+      // Release each section's memory as soon as it is written.
+      DeferredSection().records.swap (section.records);
+      std::string().swap (section.content);
+   }
+   deferred.clear();
+   stream.flush();
+}
+
+
+/**
+ * End the current record of the binary section being written.
+ * \param[in] key Record key
+ */
+void
+CheckPointOutputManager::end_record (
+   const std::string & key)
+{
+   records.push_back (std::make_pair (key, std::string()));
+   records.back().second.swap (pending);
+}
+
+
+/**
+ * Complete a section collected in memory. Any content of a binary section
+ * written after the last record ended forms a final record with an empty key.
+ * The section is written to the file now, or deferred if asynchronous
+ * writing is enabled.
+ * \param[in] tag Section name
+ * \param[in] binary_section Is the section written in binary form?
+ */
+void
+CheckPointOutputManager::end_section (
+   const std::string & tag,
+   bool binary_section)
+{
+   if (binary_section && ((! pending.empty()) || records.empty())) {
+      end_record ("");
+   }
+
+   if (asynchronous) {
+      deferred.push_back (DeferredSection());
+      DeferredSection & section = deferred.back();
+      section.tag = tag;
+      section.binary = binary_section;
+      section.content.swap (pending);
+      section.records.swap (records);
+   }
+   else if (binary_section) {
+      write_binary_section (tag, records);
+   }
+   else {
+      write_text_section (tag, pending);
+   }
+
+   pending.clear();
+   records.clear();
+}
+
+
+/**
+ * Write a text section to the file, bracketed by the section markers.
+ * \param[in] tag Section name
+ * \param[in] content Section content
+ */
+void
+CheckPointOutputManager::write_text_section (
+   const std::string & tag,
+   const std::string & content)
+{
+   if (static_cast<std::size_t>(stream.tellp()) != 0) {
+      stream << "\n\n";
+   }
+   stream << section_start << tag << "\n\n";
+   stream.write (content.data(), content.size());
+   stream << "\n" << section_end << tag << "\n";
+}
+
+
+/**
+ * Write a binary section to the file.
+ * \param[in] tag Section name
+ * \param[in] section_records The section's records
+ */
+void
+CheckPointOutputManager::write_binary_section (
+   const std::string & tag,
+   const RecordList & section_records)
+{
+   std::string payload;
+
+   for (std::size_t ii = 0; ii < section_records.size(); ++ii) {
+      const std::string & key = section_records[ii].first;
+      const std::string & content = section_records[ii].second;
+      uint64_t hash = CheckPointSectionCodec::hash (content);
+      std::string record_id = tag + '\n' + key;
+      std::string stored_in;
+
+      if ((history != nullptr) && history->find (record_id, hash, stored_in)) {
+         CheckPointSectionCodec::encode_reference_record (
+            key, hash, stored_in, payload);
+      }
+      else {
+         CheckPointSectionCodec::encode_data_record (
+            key, hash, content, compress, payload);
+         if (history != nullptr) {
+            history->update (record_id, hash, filename);
+         }
+      }
+   }
+
+   if (static_cast<std::size_t>(stream.tellp()) != 0) {
+      stream << "\n\n";
+   }
+   stream << section_start << tag << "\n\n"
+          << CheckPointSectionCodec::binary_tag << ' '
+          << CheckPointSectionCodec::format_version << ' '
+          << payload.size() << '\n';
+   stream.write (payload.data(), payload.size());
+   stream << "\n" << section_end << tag << std::endl;
+}
+
+
 /**
  * Register the supplied section writer as the currently-active writer.
  * @return True => success.
@@ -0,0 +1,66 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/checkpoint_reconstructor.cc
+ * Define JeodCheckpointReconstructor methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+   ()
+
+Library dependencies:
+   ((checkpoint_reconstructor.cc)
+    (utils/memory/src/memory_manager_static.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "utils/memory/include/memory_manager.hh"
+
+// Model includes
+#include "../include/checkpoint_reconstructor.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Default constructor.
+ */
+JeodCheckpointReconstructor::JeodCheckpointReconstructor (
+   void)
+{
+   ; // Nothing to do.
+}
+
+
+/**
+ * Destructor. Withdraws the reconstructor from the simulation interface so
+ * that a later restart does not call upon it.
+ */
+JeodCheckpointReconstructor::~JeodCheckpointReconstructor (
+   void)
+{
+   JeodMemoryManager::forget_reconstructor (*this);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
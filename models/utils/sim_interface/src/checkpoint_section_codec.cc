@@ -0,0 +1,447 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/checkpoint_section_codec.cc
+ * Define CheckPointSectionCodec static member functions.
+ */
+
+/*
+ PURPOSE:
+   ()
+*/
+
+
+// System includes
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Model includes
+#include "../include/checkpoint_section_codec.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+const char * CheckPointSectionCodec::binary_tag = "JEOD_BINARY_SECTION";
+
+const unsigned int CheckPointSectionCodec::format_version;
+
+
+namespace {
+
+/**
+ * Shortest back-reference the compressor emits.
+ */
+const std::size_t min_match = 4;
+
+/**
+ * log2 of the number of compressor hash table slots.
+ */
+const unsigned int hash_bits = 14;
+
+
+/**
+ * Hash the four bytes at the given location for the compressor match table.
+ * @return Table slot
+ * \param[in] data Four readable bytes
+ */
+inline uint32_t
+match_slot (
+   const unsigned char * data)
+{
+   uint32_t word = static_cast<uint32_t>(data[0])        |
+                   (static_cast<uint32_t>(data[1]) << 8)  |
+                   (static_cast<uint32_t>(data[2]) << 16) |
+                   (static_cast<uint32_t>(data[3]) << 24);
+   return (word * 2654435761U) >> (32 - hash_bits);
+}
+
+}
+
+
+/**
+ * Compute the 64 bit FNV-1a hash of a byte string.
+ * @return Hash value
+ * \param[in] data Bytes to be hashed
+ */
+uint64_t
+CheckPointSectionCodec::hash (
+   const std::string & data)
+{
+   return hash (data.data(), data.size());
+}
+
+
+/**
+ * Compute the 64 bit FNV-1a hash of a block of memory.
+ * @return Hash value
+ * \param[in] data Memory to be hashed
+ * \param[in] size Size of the memory, in bytes
+ */
+uint64_t
+CheckPointSectionCodec::hash (
+   const void * data,
+   std::size_t size)
+{
+   const unsigned char * bytes = static_cast<const unsigned char *> (data);
+   uint64_t value = 14695981039346656037ULL;
+   for (std::size_t ii = 0; ii < size; ++ii) {
+      value ^= bytes[ii];
+      value *= 1099511628211ULL;
+   }
+   return value;
+}
+
+
+/**
+ * Append a variable-length unsigned integer (seven bits per byte, low
+ * bits first) to a byte string.
+ * \param[in] value Value to be appended
+ * \param[in,out] output Byte string
+ */
+void
+CheckPointSectionCodec::put_varint (
+   uint64_t value,
+   std::string & output)
+{
+   while (value >= 0x80) {
+      output += static_cast<char>((value & 0x7f) | 0x80);
+      value >>= 7;
+   }
+   output += static_cast<char>(value);
+}
+
+
+/**
+ * Extract a variable-length unsigned integer from a byte range.
+ * @return True if a complete integer was extracted
+ * \param[in] data Byte range
+ * \param[in] size Size of the byte range
+ * \param[in,out] pos Read position, advanced past the integer
+ * \param[out] value Extracted value
+ */
+bool
+CheckPointSectionCodec::get_varint (
+   const char * data,
+   std::size_t size,
+   std::size_t & pos,
+   uint64_t & value)
+{
+   value = 0;
+   for (unsigned int shift = 0; (shift < 64) && (pos < size); shift += 7) {
+      unsigned char byte = static_cast<unsigned char>(data[pos++]);
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+         return true;
+      }
+   }
+   return false;
+}
+
+
+/**
+ * Append the kind, key, and hash of a record to a payload.
+ * \param[in] kind Record kind, 'D' (data) or 'R' (reference)
+ * \param[in] key Record key
+ * \param[in] content_hash Hash of the record content
+ * \param[in,out] payload Section payload
+ */
+void
+CheckPointSectionCodec::put_record_head (
+   char kind,
+   const std::string & key,
+   uint64_t content_hash,
+   std::string & payload)
+{
+   payload += kind;
+   put_varint (key.size(), payload);
+   payload += key;
+   for (unsigned int ii = 0; ii < 8; ++ii) {
+      payload += static_cast<char>((content_hash >> (8 * ii)) & 0xff);
+   }
+}
+
+
+/**
+ * Append a data record to a payload. The content is stored compressed only
+ * if compression was requested and actually reduces its size.
+ * \param[in] key Record key
+ * \param[in] content_hash Hash of the content
+ * \param[in] content Record content
+ * \param[in] compress Compress the content?
+ * \param[in,out] payload Section payload
+ */
+void
+CheckPointSectionCodec::encode_data_record (
+   const std::string & key,
+   uint64_t content_hash,
+   const std::string & content,
+   bool compress,
+   std::string & payload)
+{
+   std::string packed;
+   if (compress) {
+      CheckPointSectionCodec::compress (content, packed);
+   }
+   bool use_packed = compress && (packed.size() < content.size());
+   const std::string & stored = use_packed ? packed : content;
+
+   put_record_head ('D', key, content_hash, payload);
+   payload += use_packed ? 'Z' : 'R';
+   put_varint (content.size(), payload);
+   put_varint (stored.size(), payload);
+   payload += stored;
+}
+
+
+/**
+ * Append a reference record to a payload.
+ * \param[in] key Record key
+ * \param[in] content_hash Hash of the referenced content
+ * \param[in] file Checkpoint file that holds the content
+ * \param[in,out] payload Section payload
+ */
+void
+CheckPointSectionCodec::encode_reference_record (
+   const std::string & key,
+   uint64_t content_hash,
+   const std::string & file,
+   std::string & payload)
+{
+   put_record_head ('R', key, content_hash, payload);
+   put_varint (file.size(), payload);
+   payload += file;
+}
+
+
+/**
+ * Split a payload into records. Data records are decompressed and checked
+ * against their hash.
+ * @return True if the entire payload was well formed
+ * \param[in] payload Section payload
+ * \param[out] records Decoded records
+ */
+bool
+CheckPointSectionCodec::decode_records (
+   const std::string & payload,
+   std::vector<Record> & records)
+{
+   return decode_records (payload.data(), payload.size(), records);
+}
+
+
+/**
+ * Split a payload held in memory, e.g. a mapped checkpoint file, into records.
+ * @return True if the entire payload was well formed
+ * \param[in] data Start of the section payload
+ * \param[in] size Size of the payload, in bytes
+ * \param[out] records Decoded records
+ */
+bool
+CheckPointSectionCodec::decode_records (
+   const char * data,
+   std::size_t size,
+   std::vector<Record> & records)
+{
+   std::size_t pos = 0;
+   uint64_t length;
+
+   records.clear();
+
+   while (pos < size) {
+      Record record;
+      char kind = data[pos++];
+
+      if (((kind != 'D') && (kind != 'R')) ||
+          (!get_varint (data, size, pos, length)) ||
+          (length > size - pos)) {
+         return false;
+      }
+      record.key.assign (data + pos, length);
+      pos += length;
+
+      if (size - pos < 8) {
+         return false;
+      }
+      for (unsigned int ii = 0; ii < 8; ++ii) {
+         record.hash |= static_cast<uint64_t>(
+                           static_cast<unsigned char>(data[pos++])) << (8 * ii);
+      }
+
+      if (kind == 'R') {
+         if ((!get_varint (data, size, pos, length)) ||
+             (length > size - pos)) {
+            return false;
+         }
+         record.is_reference = true;
+         record.value.assign (data + pos, length);
+         pos += length;
+      }
+
+      else {
+         uint64_t raw_size;
+         char encoding = (pos < size) ? data[pos++] : '\0';
+         if (((encoding != 'R') && (encoding != 'Z')) ||
+             (!get_varint (data, size, pos, raw_size)) ||
+             (!get_varint (data, size, pos, length)) ||
+             (length > size - pos)) {
+            return false;
+         }
+         if (encoding == 'R') {
+            if (length != raw_size) {
+               return false;
+            }
+            record.value.assign (data + pos, length);
+         }
+         else if (!decompress (data + pos, length, raw_size, record.value)) {
+            return false;
+         }
+         pos += length;
+
+         if (hash (record.value) != record.hash) {
+            return false;
+         }
+      }
+
+      records.push_back (record);
+   }
+
+   return true;
+}
+
+
+/**
+ * Compress a byte string. The output is a sequence of tokens, each a
+ * literal run (varint length*2, then the bytes) or a back-reference
+ * (varint (length-min_match)*2+1, then varint offset).
+ * Matches are found greedily through a table of recent four-byte sequences,
+ * which suits the repetitive identifiers of checkpoint text.
+ * \param[in] input Bytes to be compressed
+ * \param[out] output Compressed bytes
+ */
+void
+CheckPointSectionCodec::compress (
+   const std::string & input,
+   std::string & output)
+{
+   const unsigned char * data =
+      reinterpret_cast<const unsigned char *>(input.data());
+   std::size_t size = input.size();
+   std::vector<std::size_t> table (std::size_t(1) << hash_bits, size);
+   std::size_t literal_start = 0;
+   std::size_t pos = 0;
+
+   output.clear();
+   output.reserve (size / 2 + 16);
+
+   while (pos + min_match <= size) {
+      uint32_t slot = match_slot (data + pos);
+      std::size_t candidate = table[slot];
+      table[slot] = pos;
+
+      if ((candidate < pos) &&
+          (std::memcmp (data + candidate, data + pos, min_match) == 0)) {
+         std::size_t length = min_match;
+         while ((pos + length < size) &&
+                (data[candidate + length] == data[pos + length])) {
+            ++length;
+         }
+
+         if (pos > literal_start) {
+            put_varint ((pos - literal_start) << 1, output);
+            output.append (input, literal_start, pos - literal_start);
+         }
+         put_varint (((length - min_match) << 1) | 1, output);
+         put_varint (pos - candidate, output);
+
+         // Index the interior of the match sparsely to keep the cost linear.
+         std::size_t end = pos + length;
+         for (pos += 2; pos + min_match <= end && pos + min_match <= size;
+              pos += 2) {
+            table[match_slot (data + pos)] = pos;
+         }
+         pos = literal_start = end;
+      }
+      else {
+         ++pos;
+      }
+   }
+
+   if (size > literal_start) {
+      put_varint ((size - literal_start) << 1, output);
+      output.append (input, literal_start, size - literal_start);
+   }
+}
+
+
+/**
+ * Decompress a byte string produced by compress.
+ * @return True if the input decoded to exactly output_size bytes
+ * \param[in] input Compressed bytes
+ * \param[in] input_size Number of compressed bytes
+ * \param[in] output_size Expected number of decompressed bytes
+ * \param[out] output Decompressed bytes
+ */
+bool
+CheckPointSectionCodec::decompress (
+   const char * input,
+   std::size_t input_size,
+   std::size_t output_size,
+   std::string & output)
+{
+   std::size_t pos = 0;
+   uint64_t token;
+
+   output.clear();
+   output.reserve (output_size);
+
+   while (pos < input_size) {
+      if (!get_varint (input, input_size, pos, token)) {
+         return false;
+      }
+
+      if ((token & 1) == 0) {
+         uint64_t length = token >> 1;
+         if ((length > input_size - pos) ||
+             (length > output_size - output.size())) {
+            return false;
+         }
+         output.append (input + pos, length);
+         pos += length;
+      }
+
+      else {
+         uint64_t length = (token >> 1) + min_match;
+         uint64_t offset;
+         if ((!get_varint (input, input_size, pos, offset)) ||
+             (offset == 0) || (offset > output.size()) ||
+             (length > output_size - output.size())) {
+            return false;
+         }
+         // Byte-wise copy: the source may overlap the bytes being produced.
+         std::size_t from = output.size() - offset;
+         for (uint64_t ii = 0; ii < length; ++ii) {
+            output += output[from + ii];
+         }
+      }
+   }
+
+   return output.size() == output_size;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
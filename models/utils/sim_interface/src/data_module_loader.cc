@@ -0,0 +1,216 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/data_module_loader.cc
+ * Define static member functions for the class DataModuleLoader.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((data_module_loader.cc)
+   (sim_interface_messages.cc)
+   (utils/message/src/message_handler.cc)
+   (jeod_profiler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <dlfcn.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
+
+// Model includes
+#include "../include/data_module_loader.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Signature of the entry point exported by a data module.
+ */
+typedef void (*DataModuleEntry) (void * target);
+
+/**
+ * Guards the table of open modules.
+ */
+std::mutex module_mutex;
+
+/**
+ * Open modules, keyed by module name.
+ */
+std::map<std::string, void *> open_modules;
+
+}
+
+
+char const * DataModuleLoader::search_path_variable = "JEOD_DATA_MODULE_PATH";
+
+
+/**
+ * Name of the entry point a data module exports for the given type.
+ * @return Entry point name
+ * \param[in] target_type Name of the class of the target
+ */
+std::string
+DataModuleLoader::entry_point_name (
+   const char * target_type)
+{
+   return std::string ("jeod_data_initialize_") + target_type;
+}
+
+
+/**
+ * File name of the library that holds the named data module.
+ * @return Library file name
+ * \param[in] module_name Data module name
+ */
+std::string
+DataModuleLoader::library_name (
+   const std::string & module_name)
+{
+   return "libjeod_data_" + module_name + ".so";
+}
+
+
+/**
+ * Open the library for the named module, or return the handle of the
+ * already open library. Failure to open the library is fatal.
+ * @return Library handle
+ * \param[in] module_name Data module name or path
+ */
+void *
+DataModuleLoader::open_module (
+   const std::string & module_name)
+{
+   JEOD_PROFILE_SCOPE ("data_module", "DataModuleLoader::open_module");
+
+   std::lock_guard<std::mutex> lock (module_mutex);
+
+   std::map<std::string, void *>::const_iterator found =
+      open_modules.find (module_name);
+   if (found != open_modules.end()) {
+      return found->second;
+   }
+
+   void * handle = nullptr;
+   std::string tried;
+
+   if (module_name.find ('/') != std::string::npos) {
+      handle = dlopen (module_name.c_str(), RTLD_NOW | RTLD_LOCAL);
+      tried = module_name;
+   }
+   else {
+      std::string file_name = library_name (module_name);
+      const char * search_path = std::getenv (search_path_variable);
+
+      if (search_path != nullptr) {
+         std::string dirs (search_path);
+         std::string::size_type start = 0;
+         while ((handle == nullptr) && (start <= dirs.size())) {
+            std::string::size_type end = dirs.find (':', start);
+            if (end == std::string::npos) {
+               end = dirs.size();
+            }
+            if (end > start) {
+               std::string path =
+                  dirs.substr (start, end - start) + "/" + file_name;
+               if (access (path.c_str(), R_OK) == 0) {
+                  handle = dlopen (path.c_str(), RTLD_NOW | RTLD_LOCAL);
+                  tried = path;
+               }
+            }
+            start = end + 1;
+         }
+      }
+
+      if (handle == nullptr) {
+         handle = dlopen (file_name.c_str(), RTLD_NOW | RTLD_LOCAL);
+         if (tried.empty()) {
+            tried = file_name;
+         }
+      }
+   }
+
+   if (handle == nullptr) {
+      const char * error = dlerror();
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::data_module_error,
+         "Unable to load data module '%s' (%s): %s",
+         module_name.c_str(), tried.c_str(),
+         (error != nullptr) ? error : "unknown error");
+      return nullptr;
+   }
+
+   open_modules[module_name] = handle;
+
+   return handle;
+}
+
+
+/**
+ * Initialize the object at target from a data module. The module must
+ * export the entry point for target_type; a module generated for some other
+ * type is rejected rather than being applied to the wrong kind of object.
+ * \param[in] module_name Data module name or path
+ * \param[in] target_type Name of the class of the target
+ * \param[in,out] target Object to be initialized
+ */
+void
+DataModuleLoader::initialize_object (
+   const std::string & module_name,
+   const char * target_type,
+   void * target)
+{
+   void * handle = open_module (module_name);
+   if (handle == nullptr) {
+      return;
+   }
+
+   std::string entry_name = entry_point_name (target_type);
+
+   dlerror();
+   void * symbol = dlsym (handle, entry_name.c_str());
+   if (symbol == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::data_module_error,
+         "Data module '%s' does not initialize objects of type %s.",
+         module_name.c_str(), target_type);
+      return;
+   }
+
+   DataModuleEntry entry = reinterpret_cast<DataModuleEntry> (symbol);
+   entry (target);
+
+   return;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,122 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/embedded_message_handler.cc
+ * Define member functions for the class EmbeddedMessageHandler.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((embedded_message_handler.cc)
+   (utils/message/src/suppressed_code_message_handler.cc)
+   (utils/message/src/message_handler.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+
+// Model includes
+#include "../include/embedded_message_handler.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Register the EmbeddedMessageHandler's checkpointable contents.
+ */
+void
+EmbeddedMessageHandler::register_contents (
+   void)
+{
+   JEOD_REGISTER_CLASS (EmbeddedMessageHandler);
+   SuppressedCodeMessageHandler::register_contents ();
+}
+
+
+/**
+ * Handle a message.
+ * Messages that are not to be printed are dropped before formatting.
+ * The rest are formatted into a fixed-size buffer, without the header
+ * that identifies the message when suppress_id is set and without the
+ * location when suppress_location is set, and passed to the sink.
+ * A failure terminates the process once the sink returns.
+ * \param[in] severity Severity level
+ * \param[in] prefix Message prefix (e.g., Error)
+ * \param[in] file Typically __FILE__
+ * \param[in] line Typically __LINE__
+ * \param[in] msg_code Message code
+ * \param[in] format sprintf format
+ * \param[in] args Arguments
+ */
+void
+EmbeddedMessageHandler::process_message (
+   int severity,
+   const char * prefix,
+   const char * file,
+   unsigned int line,
+   const char * msg_code,
+   const char * format,
+   va_list args)
+const
+{
+   if (! message_is_to_be_printed (severity, msg_code)) {
+      return;
+   }
+
+   char message[4096];
+   int length = 0;
+
+   // Failures always identify themselves.
+   if ((severity < 0) || (! suppress_id)) {
+      length = std::snprintf (message, sizeof(message),
+                              "%s %s:\n", prefix, msg_code);
+   }
+   if (((severity < 0) || (! suppress_location)) &&
+       (static_cast<std::size_t>(length) < sizeof(message))) {
+      length += std::snprintf (message + length, sizeof(message) - length,
+                               "%s line %u\n", file, line);
+   }
+   if (static_cast<std::size_t>(length) < sizeof(message)) {
+      std::vsnprintf (message + length, sizeof(message) - length, // flawfinder: ignore
+                      format, args);
+   }
+
+   if (sink != nullptr) {
+      sink (sink_context, severity, msg_code, message);
+   }
+   else {
+      std::fprintf (stderr, "%s\n", message);
+   }
+
+   if (severity < 0) {
+      std::exit (1);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,180 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/embedded_sim_interface.cc
+ * Define member functions for the class JeodEmbeddedSimInterface.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((embedded_sim_interface.cc)
+   (embedded_message_handler.cc)
+   (memory_interface.cc)
+   (sim_interface_messages.cc)
+   (simulation_interface.cc)
+   (utils/memory/src/memory_manager.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/embedded_sim_interface.hh"
+#include "../include/jeod_standalone_integrator.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a JeodEmbeddedSimInterface object.
+ */
+JeodEmbeddedSimInterface::JeodEmbeddedSimInterface (
+   void)
+:
+   JeodSimulationInterface(),
+   message_handler(),
+   memory_interface(),
+   memory_manager(memory_interface),
+   job_cycle(0.0)
+{
+   // The message handler could not register its checkpointable content when
+   // it was constructed because the memory manager did not yet exist.
+   message_handler.register_contents ();
+
+   // Register classes.
+   JEOD_REGISTER_CLASS (JeodStandaloneIntegrator);
+}
+
+
+/**
+ * Construct a JeodEmbeddedSimInterface object and configure the message
+ * handler and memory manager.
+ * \param[in] config Configuration spec
+ */
+JeodEmbeddedSimInterface::JeodEmbeddedSimInterface (
+   const JeodSimulationInterfaceInit & config)
+:
+   JeodEmbeddedSimInterface()
+{
+   configure (config);
+}
+
+
+/**
+ * Destroy a JeodEmbeddedSimInterface object.
+ */
+JeodEmbeddedSimInterface::~JeodEmbeddedSimInterface (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Set the mode.
+ *
+ * \par Assumptions and Limitations
+ *  - See SimulationInterface::set_mode.
+ * \param[in] new_mode New mode.
+ */
+void
+JeodEmbeddedSimInterface::set_mode (
+   JeodSimulationInterface::Mode new_mode)
+{
+   JeodSimulationInterface::set_mode (new_mode);
+   memory_manager.set_mode (get_mode());
+}
+
+
+/**
+ * Create an integration interface object.
+ * @return Integrator interface that records the integration controls.
+ */
+JeodIntegratorInterface *
+JeodEmbeddedSimInterface::create_integrator_internal (
+   void)
+{
+   return JEOD_ALLOC_CLASS_OBJECT (JeodStandaloneIntegrator, ());
+}
+
+
+/**
+ * Get the current job's cycle time.
+ * @return Value set by set_job_cycle\n Units: s
+ */
+double
+JeodEmbeddedSimInterface::get_job_cycle_internal (
+   void)
+{
+   return job_cycle;
+}
+
+
+/**
+ * Get the memory interface.
+ * @return Memory interface
+ */
+JeodMemoryInterface &
+JeodEmbeddedSimInterface::get_memory_interface_internal (
+   void)
+{
+   return memory_interface;
+}
+
+
+/**
+ * Get a checkpoint section reader. Checkpoint/restart is not supported.
+ * @return Empty reader
+ * \param[in] section_id Section name (unused)
+ */
+SectionedInputStream
+JeodEmbeddedSimInterface::get_checkpoint_reader_internal (
+   const std::string & section_id JEOD_UNUSED)
+{
+   MessageHandler::error (
+      __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+      "Checkpoint/restart is not supported by an embedded JEOD.");
+   return SectionedInputStream ();
+}
+
+
+/**
+ * Get a checkpoint section writer. Checkpoint/restart is not supported.
+ * @return Empty writer
+ * \param[in] section_id Section name (unused)
+ */
+SectionedOutputStream
+JeodEmbeddedSimInterface::get_checkpoint_writer_internal (
+   const std::string & section_id JEOD_UNUSED)
+{
+   MessageHandler::error (
+      __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+      "Checkpoint/restart is not supported by an embedded JEOD.");
+   return SectionedOutputStream ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
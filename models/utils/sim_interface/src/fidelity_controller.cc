@@ -0,0 +1,234 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/fidelity_controller.cc
+ * Define the member functions of the class JeodFidelityController.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((fidelity_controller.cc)
+   (jeod_profiler.cc)
+   (sim_interface_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstdio>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/fidelity_controller.hh"
+#include "../include/jeod_profiler.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * JeodFidelityController default constructor.
+ */
+JeodFidelityController::JeodFidelityController (
+   void)
+:
+   frame_budget(0.0),
+   degrade_fraction(0.9),
+   restore_fraction(0.5),
+   degrade_frames(1),
+   restore_frames(50),
+   active(true),
+   steps(),
+   step_names(),
+   level(0),
+   overrun_count(0),
+   slack_count(0),
+   frame_start(0),
+   last_frame_time(0.0),
+   num_transitions(0)
+{
+   ; // Empty
+}
+
+
+/**
+ * JeodFidelityController destructor.
+ */
+JeodFidelityController::~JeodFidelityController (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Add a step to the end of the degradation ladder.
+ * \param[in] step The step
+ * \param[in] name Step name, used in the transition messages
+ */
+void
+JeodFidelityController::add_step (
+   JeodFidelityStep & step,
+   const std::string & name)
+{
+   steps.push_back (&step);
+   step_names.push_back (name);
+}
+
+
+/**
+ * Mark the start of a frame.
+ */
+void
+JeodFidelityController::start_frame (
+   void)
+{
+   frame_start = JeodProfiler::now ();
+}
+
+
+/**
+ * Mark the end of a frame started with start_frame() and assess the wall
+ * time between the two.
+ */
+void
+JeodFidelityController::end_frame (
+   void)
+{
+   record_frame_time (
+      static_cast<double> (JeodProfiler::now () - frame_start) * 1.0e-9);
+}
+
+
+/**
+ * Assess the wall time of a frame, applying or undoing a step if the
+ * frame times call for it.
+ * \param[in] frame_time Wall time of the frame\n Units: s
+ */
+void
+JeodFidelityController::record_frame_time (
+   double frame_time)
+{
+   last_frame_time = frame_time;
+
+   if ((! active) || (frame_budget <= 0.0)) {
+      return;
+   }
+
+   if (frame_time > degrade_fraction * frame_budget) {
+      ++overrun_count;
+      slack_count = 0;
+   }
+   else if (frame_time < restore_fraction * frame_budget) {
+      ++slack_count;
+      overrun_count = 0;
+   }
+   else {
+      overrun_count = 0;
+      slack_count = 0;
+   }
+
+   char reason[80];
+   std::snprintf (reason, sizeof(reason),
+                  "frame time %.3f ms, budget %.3f ms",
+                  frame_time * 1.0e3, frame_budget * 1.0e3);
+
+   if ((overrun_count >= degrade_frames) && (level < steps.size())) {
+      degrade_one (reason);
+   }
+   else if ((slack_count >= restore_frames) && (level > 0)) {
+      restore_one (reason);
+   }
+}
+
+
+/**
+ * Apply or undo steps until the given number of steps is applied.
+ * \param[in] new_level Number of steps to be applied
+ */
+void
+JeodFidelityController::set_level (
+   unsigned int new_level)
+{
+   if (new_level > steps.size()) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::fidelity_change,
+         "Requested fidelity level %u exceeds the %u steps of the ladder; "
+         "using %u.",
+         new_level, static_cast<unsigned int> (steps.size()),
+         static_cast<unsigned int> (steps.size()));
+      new_level = steps.size();
+   }
+
+   while (level < new_level) {
+      degrade_one ("requested");
+   }
+   while (level > new_level) {
+      restore_one ("requested");
+   }
+}
+
+
+/**
+ * Apply the next step of the ladder and report the transition.
+ * \param[in] reason Why the step is applied
+ */
+void
+JeodFidelityController::degrade_one (
+   const char * reason)
+{
+   steps[level]->degrade ();
+   ++level;
+   ++num_transitions;
+   overrun_count = 0;
+   slack_count = 0;
+
+   MessageHandler::inform (
+      __FILE__, __LINE__, SimInterfaceMessages::fidelity_change,
+      "Fidelity level %u -> %u: degraded '%s' (%s).",
+      level - 1, level, step_names[level - 1].c_str(), reason);
+}
+
+
+/**
+ * Undo the last step applied and report the transition.
+ * \param[in] reason Why the step is undone
+ */
+void
+JeodFidelityController::restore_one (
+   const char * reason)
+{
+   --level;
+   steps[level]->restore ();
+   ++num_transitions;
+   overrun_count = 0;
+   slack_count = 0;
+
+   MessageHandler::inform (
+      __FILE__, __LINE__, SimInterfaceMessages::fidelity_change,
+      "Fidelity level %u -> %u: restored '%s' (%s).",
+      level + 1, level, step_names[level].c_str(), reason);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,580 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/frame_monitor.cc
+ * Define the member functions of the class JeodFrameMonitor.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((frame_monitor.cc)
+   (jeod_profiler.cc)
+   (sim_interface_messages.cc)
+   (utils/memory/src/memory_manager_static.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <vector>
+
+// JEOD includes
+#include "utils/memory/include/memory_manager.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/frame_monitor.hh"
+#include "../include/jeod_profiler.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Number of histogram buckets per power of two, as a power of two.
+ */
+const unsigned int sub_bucket_bits = 4;
+
+/**
+ * Number of histogram buckets per power of two.
+ */
+const unsigned int sub_buckets = 1U << sub_bucket_bits;
+
+/**
+ * Number of powers of two covered above the exact buckets; times up to
+ * 2^44 ns (about five hours) are resolved.
+ */
+const unsigned int num_octaves = 40;
+
+/**
+ * Number of histogram buckets.
+ */
+const unsigned int num_buckets = sub_buckets * (num_octaves + 1);
+
+/**
+ * Longest time the histograms resolve; longer times are binned with it.
+ */
+const unsigned long long max_resolved =
+   (1ULL << (num_octaves + sub_bucket_bits)) - 1;
+
+
+/**
+ * Index of the most significant set bit.
+ * @return floor(log2(value))
+ * \param[in] value Nonzero value
+ */
+unsigned int
+floor_log2 (
+   unsigned long long value)
+{
+   unsigned int exponent = 0;
+   for (unsigned int shift = 32; shift > 0; shift /= 2) {
+      if ((value >> shift) != 0) {
+         value >>= shift;
+         exponent += shift;
+      }
+   }
+   return exponent;
+}
+
+
+/**
+ * Histogram bucket for a time. Times below sub_buckets ns have their own
+ * buckets; each power of two above that is split into sub_buckets buckets.
+ * @return Bucket index
+ * \param[in] time Time, nanoseconds
+ */
+unsigned int
+bucket_index (
+   unsigned long long time)
+{
+   if (time < sub_buckets) {
+      return static_cast<unsigned int> (time);
+   }
+   if (time > max_resolved) {
+      time = max_resolved;
+   }
+   unsigned int exponent = floor_log2 (time);
+   unsigned int shift = exponent - sub_bucket_bits;
+   return sub_buckets * (shift + 1) +
+          static_cast<unsigned int> ((time >> shift) - sub_buckets);
+}
+
+
+/**
+ * Largest time that falls in a bucket.
+ * @return Time, nanoseconds
+ * \param[in] bucket Bucket index
+ */
+unsigned long long
+bucket_upper_bound (
+   unsigned int bucket)
+{
+   if (bucket < sub_buckets) {
+      return bucket;
+   }
+   unsigned int shift = bucket / sub_buckets - 1;
+   unsigned long long mantissa = sub_buckets + bucket % sub_buckets;
+   return ((mantissa + 1) << shift) - 1;
+}
+
+
+/**
+ * The record of one frame, as queued by end_frame.
+ */
+struct FrameRecord {
+   unsigned long long frame_time;
+   unsigned long long phase_times[JeodFrameMonitor::max_phases];
+   long minor_faults;
+   long major_faults;
+   unsigned long long allocations;
+};
+
+
+/**
+ * Read the calling thread's page fault counts.
+ * \param[out] minor_faults Minor fault count
+ * \param[out] major_faults Major fault count
+ */
+void
+read_page_faults (
+   long & minor_faults,
+   long & major_faults)
+{
+   struct rusage usage;
+#ifdef RUSAGE_THREAD
+   int status = getrusage (RUSAGE_THREAD, &usage);
+#else
+   int status = getrusage (RUSAGE_SELF, &usage);
+#endif
+   if (status == 0) {
+      minor_faults = usage.ru_minflt;
+      major_faults = usage.ru_majflt;
+   }
+   else {
+      minor_faults = 0;
+      major_faults = 0;
+   }
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Single-producer, single-consumer ring of frame records.
+ */
+struct JeodFrameMonitor::Ring {
+   std::vector<FrameRecord> slots;
+   unsigned long mask;
+   std::atomic<unsigned long> head;
+   std::atomic<unsigned long> tail;
+
+   explicit Ring (unsigned int nslots)
+   :
+      slots(nslots),
+      mask(nslots - 1),
+      head(0),
+      tail(0)
+   { }
+};
+
+
+/**
+ * Log-linear histogram of times, in nanoseconds.
+ */
+struct JeodFrameMonitor::Histogram {
+   unsigned long long counts[num_buckets];
+   unsigned long long count;
+   unsigned long long max;
+   double sum;
+
+   Histogram ()
+   {
+      clear ();
+   }
+
+   void clear ()
+   {
+      for (unsigned int ii = 0; ii < num_buckets; ++ii) {
+         counts[ii] = 0;
+      }
+      count = 0;
+      max = 0;
+      sum = 0.0;
+   }
+
+   void add (unsigned long long time)
+   {
+      ++counts[bucket_index (time)];
+      ++count;
+      sum += static_cast<double> (time);
+      if (time > max) {
+         max = time;
+      }
+   }
+
+   double percentile (double fraction) const
+   {
+      if (count == 0) {
+         return 0.0;
+      }
+      unsigned long long rank =
+         static_cast<unsigned long long> (fraction * count);
+      if (rank >= count) {
+         rank = count - 1;
+      }
+      unsigned long long seen = 0;
+      for (unsigned int ii = 0; ii < num_buckets; ++ii) {
+         seen += counts[ii];
+         if (seen > rank) {
+            unsigned long long bound = bucket_upper_bound (ii);
+            return static_cast<double> ((bound < max) ? bound : max) * 1.0e-9;
+         }
+      }
+      return static_cast<double> (max) * 1.0e-9;
+   }
+};
+
+
+/**
+ * JeodFrameMonitor default constructor.
+ */
+JeodFrameMonitor::JeodFrameMonitor (
+   void)
+:
+   active(true),
+   track_page_faults(true),
+   overrun_threshold(0.0),
+   ring_slots(4096),
+   frame_stats(),
+   num_frames(0),
+   num_overruns(0),
+   num_fault_frames(0),
+   num_minor_faults(0),
+   num_major_faults(0),
+   num_alloc_frames(0),
+   num_allocations(0),
+   num_dropped(0),
+   phase_names(),
+   ring(nullptr),
+   histograms(nullptr),
+   in_frame(false),
+   frame_start(0),
+   last_mark(0),
+   start_minor_faults(0),
+   start_major_faults(0),
+   start_allocations(0)
+{
+   for (unsigned int ii = 0; ii < max_phases; ++ii) {
+      phase_times[ii] = 0;
+   }
+}
+
+
+/**
+ * JeodFrameMonitor destructor.
+ */
+JeodFrameMonitor::~JeodFrameMonitor (
+   void)
+{
+   delete ring;
+   delete[] histograms;
+}
+
+
+/**
+ * Add a phase. Phases should be added before the first frame.
+ * @return Phase index, for end_phase()
+ * \param[in] name Phase name, used in reports
+ */
+unsigned int
+JeodFrameMonitor::add_phase (
+   const std::string & name)
+{
+   if (phase_names.size() >= max_phases) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::profiling,
+         "Cannot add frame phase '%s': the limit is %u phases.",
+         name.c_str(), max_phases);
+
+      // Not reached
+      return 0;
+   }
+
+   phase_names.push_back (name);
+   return phase_names.size() - 1;
+}
+
+
+/**
+ * Mark the start of a frame. The ring and histograms are created on the
+ * first call, which should therefore precede real-time operation.
+ */
+void
+JeodFrameMonitor::start_frame (
+   void)
+{
+   if (! active) {
+      in_frame = false;
+      return;
+   }
+
+   if (ring == nullptr) {
+      unsigned int nslots = 2;
+      while (nslots < ring_slots) {
+         nslots *= 2;
+      }
+      ring_slots = nslots;
+      ring = new Ring (nslots);
+      histograms = new Histogram[max_phases + 1];
+   }
+
+   for (unsigned int ii = 0; ii < max_phases; ++ii) {
+      phase_times[ii] = 0;
+   }
+   if (track_page_faults) {
+      read_page_faults (start_minor_faults, start_major_faults);
+   }
+   start_allocations = JeodMemoryManager::get_allocation_count ();
+
+   in_frame = true;
+   frame_start = JeodProfiler::now ();
+   last_mark = frame_start;
+}
+
+
+/**
+ * Mark the end of a phase. The phase is charged with the time since the
+ * previous mark (the start of the frame or the end of the previous phase).
+ * A phase may be marked more than once per frame.
+ * \param[in] phase_index Index returned by add_phase()
+ */
+void
+JeodFrameMonitor::end_phase (
+   unsigned int phase_index)
+{
+   if ((! in_frame) || (phase_index >= max_phases)) {
+      return;
+   }
+
+   unsigned long long now = JeodProfiler::now ();
+   phase_times[phase_index] += now - last_mark;
+   last_mark = now;
+}
+
+
+/**
+ * Mark the end of a frame and queue its record for collect().
+ */
+void
+JeodFrameMonitor::end_frame (
+   void)
+{
+   if (! in_frame) {
+      return;
+   }
+   in_frame = false;
+
+   unsigned long long now = JeodProfiler::now ();
+
+   unsigned long head = ring->head.load (std::memory_order_relaxed);
+   unsigned long tail = ring->tail.load (std::memory_order_acquire);
+   if (head - tail > ring->mask) {
+      ++num_dropped;
+      return;
+   }
+
+   FrameRecord & record = ring->slots[head & ring->mask];
+   record.frame_time = now - frame_start;
+   for (unsigned int ii = 0; ii < max_phases; ++ii) {
+      record.phase_times[ii] = phase_times[ii];
+   }
+   if (track_page_faults) {
+      long minor_faults;
+      long major_faults;
+      read_page_faults (minor_faults, major_faults);
+      record.minor_faults = minor_faults - start_minor_faults;
+      record.major_faults = major_faults - start_major_faults;
+   }
+   else {
+      record.minor_faults = 0;
+      record.major_faults = 0;
+   }
+   record.allocations =
+      JeodMemoryManager::get_allocation_count () - start_allocations;
+
+   ring->head.store (head + 1, std::memory_order_release);
+}
+
+
+/**
+ * Drain the queued frame records into the histograms and counters, and
+ * refresh the statistics members.
+ */
+void
+JeodFrameMonitor::collect (
+   void)
+{
+   if (ring == nullptr) {
+      return;
+   }
+
+   unsigned long long overrun_ns =
+      static_cast<unsigned long long> (overrun_threshold * 1.0e9);
+   unsigned int nphases = phase_names.size();
+
+   unsigned long tail = ring->tail.load (std::memory_order_relaxed);
+   unsigned long head = ring->head.load (std::memory_order_acquire);
+   for (; tail != head; ++tail) {
+      const FrameRecord & record = ring->slots[tail & ring->mask];
+
+      histograms[0].add (record.frame_time);
+      for (unsigned int ii = 0; ii < nphases; ++ii) {
+         histograms[ii + 1].add (record.phase_times[ii]);
+      }
+
+      ++num_frames;
+      if ((overrun_ns > 0) && (record.frame_time > overrun_ns)) {
+         ++num_overruns;
+      }
+      if ((record.minor_faults > 0) || (record.major_faults > 0)) {
+         ++num_fault_frames;
+         num_minor_faults += record.minor_faults;
+         num_major_faults += record.major_faults;
+      }
+      if (record.allocations > 0) {
+         ++num_alloc_frames;
+         num_allocations += record.allocations;
+      }
+   }
+   ring->tail.store (tail, std::memory_order_release);
+
+   summarize (histograms[0], frame_stats);
+   for (unsigned int ii = 0; ii < nphases; ++ii) {
+      summarize (histograms[ii + 1], phase_stats[ii]);
+   }
+}
+
+
+/**
+ * Discard the collected data. Queued records are collected first so that
+ * they are discarded as well.
+ */
+void
+JeodFrameMonitor::reset (
+   void)
+{
+   collect ();
+
+   if (histograms != nullptr) {
+      for (unsigned int ii = 0; ii <= max_phases; ++ii) {
+         histograms[ii].clear ();
+      }
+   }
+   frame_stats = JeodFrameStatistics ();
+   for (unsigned int ii = 0; ii < max_phases; ++ii) {
+      phase_stats[ii] = JeodFrameStatistics ();
+   }
+   num_frames = 0;
+   num_overruns = 0;
+   num_fault_frames = 0;
+   num_minor_faults = 0;
+   num_major_faults = 0;
+   num_alloc_frames = 0;
+   num_allocations = 0;
+   num_dropped = 0;
+}
+
+
+/**
+ * Collect the queued records and issue the statistics as an informational
+ * message. Suitable for use as a periodic logging job.
+ */
+void
+JeodFrameMonitor::report (
+   void)
+{
+   collect ();
+
+   std::string text;
+   char line[160];
+
+   std::snprintf (line, sizeof(line),
+                  "Frame times over %llu frames (ms):\n"
+                  "%-20s %10s %10s %10s %10s %10s\n",
+                  num_frames, "", "mean", "p50", "p99", "p99.9", "max");
+   text += line;
+
+   for (unsigned int ii = 0; ii <= phase_names.size(); ++ii) {
+      const JeodFrameStatistics & stats =
+         (ii == 0) ? frame_stats : phase_stats[ii - 1];
+      const char * name = (ii == 0) ? "frame" : phase_names[ii - 1].c_str();
+      std::snprintf (line, sizeof(line),
+                     "%-20.20s %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                     name, stats.mean * 1.0e3, stats.p50 * 1.0e3,
+                     stats.p99 * 1.0e3, stats.p999 * 1.0e3,
+                     stats.max * 1.0e3);
+      text += line;
+   }
+
+   std::snprintf (line, sizeof(line),
+                  "Overruns: %llu; frames with page faults: %llu "
+                  "(%llu minor, %llu major); frames with allocations: %llu "
+                  "(%llu allocations); dropped records: %llu",
+                  num_overruns, num_fault_frames, num_minor_faults,
+                  num_major_faults, num_alloc_frames, num_allocations,
+                  num_dropped);
+   text += line;
+
+   MessageHandler::inform (
+      __FILE__, __LINE__, SimInterfaceMessages::profiling,
+      "%s", text.c_str());
+}
+
+
+/**
+ * Refresh a statistics member from its histogram.
+ * \param[in] histogram The histogram
+ * \param[out] stats The statistics
+ */
+void
+JeodFrameMonitor::summarize (
+   const Histogram & histogram,
+   JeodFrameStatistics & stats)
+{
+   stats.count = histogram.count;
+   stats.mean = (histogram.count > 0) ?
+                histogram.sum / histogram.count * 1.0e-9 : 0.0;
+   stats.p50 = histogram.percentile (0.5);
+   stats.p99 = histogram.percentile (0.99);
+   stats.p999 = histogram.percentile (0.999);
+   stats.max = static_cast<double> (histogram.max) * 1.0e-9;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,212 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/initialization_phase.cc
+ * Define JeodInitializationPhase methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((initialization_phase.cc)
+   (task_graph.cc)
+   (sim_interface_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+#include <map>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/initialization_phase.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a JeodInitializationPhase with no initializations.
+ */
+JeodInitializationPhase::JeodInitializationPhase (
+   void)
+:
+   num_threads(1),
+   entries(),
+   graph()
+{
+   ; // Empty
+}
+
+
+/**
+ * Destruct a JeodInitializationPhase.
+ * The tasks are not owned by the phase.
+ */
+JeodInitializationPhase::~JeodInitializationPhase (
+   void)
+{
+   ; // Empty
+}
+
+
+/**
+ * Add an initialization to the phase.
+ * @return Index of the initialization, used to name its resources.
+ * \param[in] task The initialization
+ * \param[in] name Name for diagnostics
+ */
+unsigned int
+JeodInitializationPhase::add_initialization (
+   JeodGraphTask & task,
+   const std::string & name)
+{
+   Entry entry;
+   entry.task = &task;
+   entry.name = name;
+   entries.push_back (entry);
+   return entries.size() - 1;
+}
+
+
+/**
+ * Declare that an initialization requires a resource.
+ * \param[in] index Index of the initialization
+ * \param[in] resource Resource name
+ */
+void
+JeodInitializationPhase::add_requirement (
+   unsigned int index,
+   const std::string & resource)
+{
+   check_index (index, "add_requirement");
+   entries[index].required.push_back (resource);
+}
+
+
+/**
+ * Declare that an initialization provides a resource.
+ * \param[in] index Index of the initialization
+ * \param[in] resource Resource name
+ */
+void
+JeodInitializationPhase::add_provision (
+   unsigned int index,
+   const std::string & resource)
+{
+   check_index (index, "add_provision");
+   entries[index].provided.push_back (resource);
+}
+
+
+/**
+ * Run every initialization once, each after the providers of the resources
+ * it requires, and wait for completion. The initializations are then
+ * removed, so the phase can be reused. Fails if the requirements form a
+ * cycle.
+ */
+void
+JeodInitializationPhase::run (
+   void)
+{
+   unsigned int nentries = entries.size();
+
+   // Providers of each resource, in order of addition.
+   std::map<std::string, std::vector<unsigned int> > providers;
+   for (unsigned int ii = 0; ii < nentries; ++ii) {
+      const std::vector<std::string> & provided = entries[ii].provided;
+      for (unsigned int jj = 0; jj < provided.size(); ++jj) {
+         std::vector<unsigned int> & list = providers[provided[jj]];
+         if (list.empty() || (list.back() != ii)) {
+            list.push_back (ii);
+         }
+      }
+   }
+
+   graph.clear ();
+   for (unsigned int ii = 0; ii < nentries; ++ii) {
+      graph.add_task (*entries[ii].task, entries[ii].name);
+   }
+
+   for (std::map<std::string, std::vector<unsigned int> >::const_iterator it =
+           providers.begin();
+        it != providers.end();
+        ++it) {
+      const std::vector<unsigned int> & list = it->second;
+      for (unsigned int jj = 1; jj < list.size(); ++jj) {
+         graph.add_dependency (list[jj-1], list[jj]);
+      }
+   }
+
+   for (unsigned int ii = 0; ii < nentries; ++ii) {
+      const std::vector<std::string> & required = entries[ii].required;
+      for (unsigned int jj = 0; jj < required.size(); ++jj) {
+         std::map<std::string, std::vector<unsigned int> >::const_iterator it =
+            providers.find (required[jj]);
+         if (it == providers.end()) {
+            continue;
+         }
+         const std::vector<unsigned int> & list = it->second;
+         for (unsigned int kk = 0; kk < list.size(); ++kk) {
+            if (list[kk] == ii) {
+               MessageHandler::fail (
+                  __FILE__, __LINE__, SimInterfaceMessages::phasing_error,
+                  "Initialization '%s' both requires and provides '%s'.",
+                  entries[ii].name.c_str(), required[jj].c_str());
+               return;
+            }
+            graph.add_dependency (list[kk], ii);
+         }
+      }
+   }
+
+   graph.num_threads = num_threads;
+   graph.execute ();
+
+   graph.clear ();
+   entries.clear ();
+}
+
+
+/**
+ * Fail if an initialization index is out of range.
+ * \param[in] index Index to be checked
+ * \param[in] function Name of the calling method
+ */
+void
+JeodInitializationPhase::check_index (
+   unsigned int index,
+   const char * function) const
+{
+   if (index >= entries.size()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "JeodInitializationPhase::%s: index %u is out of range; "
+         "the phase has %u initializations.",
+         function, index, static_cast<unsigned int>(entries.size()));
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,672 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/jeod_profiler.cc
+ * Define static member functions for the class JeodProfiler.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((jeod_profiler.cc)
+   (sim_interface_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/jeod_profiler.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Maximum number of timed functions.
+ */
+const unsigned int max_sites = 128;
+
+/**
+ * Maximum number of integration groups tracked separately. Slot zero
+ * collects time spent outside any group and in groups beyond the limit.
+ */
+const unsigned int max_groups = 16;
+
+/**
+ * Counts for one timed function in one integration group.
+ */
+struct SiteStats {
+   std::atomic<unsigned long long> calls;
+   std::atomic<unsigned long long> total_ns;
+   std::atomic<unsigned long long> max_ns;
+};
+
+/**
+ * One call recorded for the trace.
+ */
+struct TraceEvent {
+   unsigned int site;
+   unsigned int group;
+   unsigned long long start;
+   unsigned long long stop;
+};
+
+/**
+ * The trace events recorded by one thread.
+ */
+struct TraceBuffer {
+   unsigned int thread_number;
+   std::vector<TraceEvent> events;
+};
+
+/**
+ * The profiler's accumulated state.
+ */
+struct ProfileData {
+   SiteStats stats[max_sites][max_groups];
+   const char * site_model[max_sites];
+   const char * site_function[max_sites];
+   std::atomic<unsigned int> num_sites;
+
+   const void * group_key[max_groups];
+   std::atomic<unsigned int> num_groups;
+
+   std::atomic<bool> tracing;
+   std::atomic<long> trace_budget;
+   std::vector<std::unique_ptr<TraceBuffer> > trace_buffers;
+
+   unsigned long long epoch;
+   pthread_mutex_t mutex;
+
+   std::atomic<bool> init_profiling;
+   std::string init_trace_file;
+
+   ProfileData ()
+   :
+      num_sites(0),
+      num_groups(1),
+      tracing(false),
+      trace_budget(0),
+      trace_buffers(),
+      epoch(JeodProfiler::now()),
+      init_profiling(false),
+      init_trace_file()
+   {
+      group_key[0] = nullptr;
+      pthread_mutex_init (&mutex, nullptr);
+   }
+};
+
+
+/**
+ * The profiler's state, created on first use.
+ * @return Profile data
+ */
+ProfileData &
+profile_data (
+   void)
+{
+   static ProfileData data;
+   return data;
+}
+
+/**
+ * The calling thread's active integration group.
+ */
+thread_local unsigned int active_group = 0;
+
+/**
+ * The calling thread's trace buffer, created when the thread first records
+ * a trace event.
+ */
+thread_local TraceBuffer * thread_trace = nullptr;
+
+
+/**
+ * Append a string to a JSON document as a quoted string.
+ * @param out  Document
+ * @param text String to append
+ */
+void
+append_json_string (
+   std::string & out,
+   const char * text)
+{
+   out += '"';
+   for (const char * cp = text; *cp != '\0'; ++cp) {
+      if ((*cp == '"') || (*cp == '\\')) {
+         out += '\\';
+      }
+      out += *cp;
+   }
+   out += '"';
+}
+
+
+/**
+ * Label of an integration group slot.
+ * @return Label
+ * @param group Group slot
+ */
+std::string
+group_label (
+   unsigned int group)
+{
+   if (group == 0) {
+      return "-";
+   }
+   char label[32];
+   std::snprintf (label, sizeof(label), "group %u", group);
+   return label;
+}
+
+
+/**
+ * Write a string to a file.
+ * @return True if the file was written
+ * @param file_name File name
+ * @param text      File contents
+ */
+bool
+write_file (
+   const std::string & file_name,
+   const std::string & text)
+{
+   std::FILE * file = std::fopen (file_name.c_str(), "w");
+   if (file == nullptr) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, SimInterfaceMessages::profiling,
+         "Unable to open profile output file '%s'.",
+         file_name.c_str());
+      return false;
+   }
+   bool ok = (std::fwrite (text.data(), 1, text.size(), file) == text.size());
+   ok = (std::fclose (file) == 0) && ok;
+   if (! ok) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, SimInterfaceMessages::profiling,
+         "Error writing profile output file '%s'.",
+         file_name.c_str());
+   }
+   return ok;
+}
+
+
+/**
+ * Format the accumulated counts as a table with one row per timed function
+ * and integration group.
+ * @return Summary table
+ * @param sorted Sort the rows by decreasing total time?
+ */
+std::string
+format_summary (
+   bool sorted)
+{
+   ProfileData & data = profile_data ();
+   unsigned int nsites = data.num_sites.load (std::memory_order_acquire);
+   unsigned int ngroups = data.num_groups.load (std::memory_order_acquire);
+   char line[256];
+
+   std::snprintf (line, sizeof(line),
+                  "Profile over %.3f s of wall-clock time\n"
+                  "%-14s %-44s %-9s %10s %12s %12s %12s\n",
+                  1e-9 * (JeodProfiler::now () - data.epoch),
+                  "Model", "Function", "Group",
+                  "Calls", "Total (s)", "Mean (us)", "Max (us)");
+   std::string out = line;
+
+   // Rows as (total time, site, group), in site order.
+   std::vector<std::pair<unsigned long long,
+                         std::pair<unsigned int, unsigned int> > > rows;
+   for (unsigned int isite = 0; isite < nsites; ++isite) {
+      for (unsigned int igroup = 0; igroup < ngroups; ++igroup) {
+         const SiteStats & stats = data.stats[isite][igroup];
+         if (stats.calls.load () != 0) {
+            rows.push_back (std::make_pair (stats.total_ns.load (),
+                                            std::make_pair (isite, igroup)));
+         }
+      }
+   }
+   if (sorted) {
+      std::stable_sort (
+         rows.begin(), rows.end(),
+         [] (const std::pair<unsigned long long,
+                             std::pair<unsigned int, unsigned int> > & lhs,
+             const std::pair<unsigned long long,
+                             std::pair<unsigned int, unsigned int> > & rhs)
+         { return lhs.first > rhs.first; });
+   }
+
+   for (unsigned int irow = 0; irow < rows.size(); ++irow) {
+      unsigned int isite = rows[irow].second.first;
+      unsigned int igroup = rows[irow].second.second;
+      const SiteStats & stats = data.stats[isite][igroup];
+      unsigned long long calls = stats.calls.load ();
+      double total = 1e-9 * stats.total_ns.load ();
+      std::snprintf (line, sizeof(line),
+                     "%-14s %-44s %-9s %10llu %12.6f %12.3f %12.3f\n",
+                     data.site_model[isite], data.site_function[isite],
+                     group_label (igroup).c_str(),
+                     calls, total, 1e6 * total / calls,
+                     1e-3 * stats.max_ns.load ());
+      out += line;
+   }
+
+   return out;
+}
+
+} // End anonymous namespace
+
+
+/**
+ * Register a timed function. Called once per function, by the
+ * JEOD_PROFILE_SCOPE macro.
+ * @return Site index, or max_sites if the site table is full
+ * \param[in] model    Model name, e.g., "gravity"
+ * \param[in] function Function name
+ */
+unsigned int
+JeodProfiler::register_site (
+   const char * model,
+   const char * function)
+{
+   ProfileData & data = profile_data ();
+   unsigned int site = max_sites;
+
+   pthread_mutex_lock (&data.mutex);
+   unsigned int nsites = data.num_sites.load (std::memory_order_relaxed);
+   if (nsites < max_sites) {
+      site = nsites;
+      data.site_model[site] = model;
+      data.site_function[site] = function;
+      data.num_sites.store (nsites + 1, std::memory_order_release);
+   }
+   pthread_mutex_unlock (&data.mutex);
+
+   return site;
+}
+
+
+/**
+ * Make an integration group the calling thread's active group.
+ * @return The previously active group slot
+ * \param[in] group The integration group
+ */
+unsigned int
+JeodProfiler::enter_group (
+   const void * group)
+{
+   ProfileData & data = profile_data ();
+   unsigned int previous = active_group;
+   unsigned int slot = 0;
+
+   unsigned int ngroups = data.num_groups.load (std::memory_order_acquire);
+   for (unsigned int ii = 1; ii < ngroups; ++ii) {
+      if (data.group_key[ii] == group) {
+         slot = ii;
+         break;
+      }
+   }
+
+   if (slot == 0) {
+      pthread_mutex_lock (&data.mutex);
+      ngroups = data.num_groups.load (std::memory_order_relaxed);
+      for (unsigned int ii = 1; ii < ngroups; ++ii) {
+         if (data.group_key[ii] == group) {
+            slot = ii;
+            break;
+         }
+      }
+      if ((slot == 0) && (ngroups < max_groups)) {
+         slot = ngroups;
+         data.group_key[slot] = group;
+         data.num_groups.store (ngroups + 1, std::memory_order_release);
+      }
+      pthread_mutex_unlock (&data.mutex);
+   }
+
+   active_group = slot;
+   return previous;
+}
+
+
+/**
+ * Restore the calling thread's previously active group.
+ * \param[in] previous Group slot returned by enter_group
+ */
+void
+JeodProfiler::leave_group (
+   unsigned int previous)
+{
+   active_group = previous;
+}
+
+
+/**
+ * Monotonic wall-clock time.
+ * @return Time, nanoseconds
+ */
+unsigned long long
+JeodProfiler::now (
+   void)
+{
+   struct timespec time;
+   clock_gettime (CLOCK_MONOTONIC, &time);
+   return static_cast<unsigned long long>(time.tv_sec) * 1000000000ULL +
+          static_cast<unsigned long long>(time.tv_nsec);
+}
+
+
+/**
+ * Record one call to a timed function.
+ * \param[in] site  Site index
+ * \param[in] start Time at entry, nanoseconds
+ * \param[in] stop  Time at exit, nanoseconds
+ */
+void
+JeodProfiler::record (
+   unsigned int site,
+   unsigned long long start,
+   unsigned long long stop)
+{
+   if (site >= max_sites) {
+      return;
+   }
+
+   ProfileData & data = profile_data ();
+   unsigned int group = active_group;
+   unsigned long long elapsed = stop - start;
+   SiteStats & stats = data.stats[site][group];
+
+   stats.calls.fetch_add (1, std::memory_order_relaxed);
+   stats.total_ns.fetch_add (elapsed, std::memory_order_relaxed);
+   unsigned long long max_ns = stats.max_ns.load (std::memory_order_relaxed);
+   while ((elapsed > max_ns) &&
+          (! stats.max_ns.compare_exchange_weak (
+                max_ns, elapsed, std::memory_order_relaxed))) {
+   }
+
+   if (data.tracing.load (std::memory_order_relaxed) &&
+       (data.trace_budget.fetch_sub (1, std::memory_order_relaxed) > 0)) {
+      if (thread_trace == nullptr) {
+         pthread_mutex_lock (&data.mutex);
+         data.trace_buffers.emplace_back (new TraceBuffer);
+         thread_trace = data.trace_buffers.back().get();
+         thread_trace->thread_number = data.trace_buffers.size();
+         pthread_mutex_unlock (&data.mutex);
+      }
+      TraceEvent event = {site, group, start, stop};
+      thread_trace->events.push_back (event);
+   }
+}
+
+
+/**
+ * Turn trace event recording on or off.
+ * Each timed call made while tracing is on is recorded, up to max_events
+ * calls in total.
+ * \param[in] tracing    True to record trace events
+ * \param[in] max_events Maximum number of events to record
+ */
+void
+JeodProfiler::set_tracing (
+   bool tracing,
+   unsigned long max_events)
+{
+   ProfileData & data = profile_data ();
+   data.trace_budget.store (static_cast<long>(max_events));
+   data.tracing.store (tracing);
+}
+
+
+/**
+ * Discard all counts and trace events. The registered sites and groups
+ * are retained.
+ */
+void
+JeodProfiler::reset (
+   void)
+{
+   ProfileData & data = profile_data ();
+
+   pthread_mutex_lock (&data.mutex);
+   for (unsigned int isite = 0; isite < max_sites; ++isite) {
+      for (unsigned int igroup = 0; igroup < max_groups; ++igroup) {
+         SiteStats & stats = data.stats[isite][igroup];
+         stats.calls.store (0);
+         stats.total_ns.store (0);
+         stats.max_ns.store (0);
+      }
+   }
+   for (std::unique_ptr<TraceBuffer> & buffer : data.trace_buffers) {
+      buffer->events.clear ();
+   }
+   data.epoch = now ();
+   pthread_mutex_unlock (&data.mutex);
+}
+
+
+/**
+ * Format the accumulated counts as a table with one row per timed function
+ * and integration group. Group "-" is time spent outside any group.
+ * @return Summary table
+ */
+std::string
+JeodProfiler::summary (
+   void)
+{
+   return format_summary (false);
+}
+
+
+/**
+ * Format the accumulated counts as a table like that of summary(), with
+ * the rows sorted by decreasing total time.
+ * @return Summary table
+ */
+std::string
+JeodProfiler::sorted_summary (
+   void)
+{
+   return format_summary (true);
+}
+
+
+/**
+ * Issue the summary table as an informational message. Suitable for use
+ * as a periodic logging job.
+ */
+void
+JeodProfiler::report_summary (
+   void)
+{
+   MessageHandler::inform (
+      __FILE__, __LINE__, SimInterfaceMessages::profiling,
+      "%s", summary().c_str());
+}
+
+
+/**
+ * Write the accumulated counts as a JSON array with one object per timed
+ * function and integration group.
+ * @return True if the file was written
+ * \param[in] file_name Output file name
+ */
+bool
+JeodProfiler::write_summary_json (
+   const std::string & file_name)
+{
+   ProfileData & data = profile_data ();
+   unsigned int nsites = data.num_sites.load (std::memory_order_acquire);
+   unsigned int ngroups = data.num_groups.load (std::memory_order_acquire);
+   std::string out = "[";
+   bool first = true;
+   char numbers[128];
+
+   for (unsigned int isite = 0; isite < nsites; ++isite) {
+      for (unsigned int igroup = 0; igroup < ngroups; ++igroup) {
+         const SiteStats & stats = data.stats[isite][igroup];
+         unsigned long long calls = stats.calls.load ();
+         if (calls == 0) {
+            continue;
+         }
+         out += first ? "\n" : ",\n";
+         first = false;
+         out += "{\"model\":";
+         append_json_string (out, data.site_model[isite]);
+         out += ",\"function\":";
+         append_json_string (out, data.site_function[isite]);
+         out += ",\"group\":";
+         append_json_string (out, group_label (igroup).c_str());
+         std::snprintf (numbers, sizeof(numbers),
+                        ",\"calls\":%llu,\"total_ns\":%llu,\"max_ns\":%llu}",
+                        calls, stats.total_ns.load (), stats.max_ns.load ());
+         out += numbers;
+      }
+   }
+   out += "\n]\n";
+
+   return write_file (file_name, out);
+}
+
+
+/**
+ * Write the recorded trace events in the Chrome trace event format, with
+ * one complete ("X") event per recorded call.
+ * @return True if the file was written
+ * \param[in] file_name Output file name
+ */
+bool
+JeodProfiler::write_trace (
+   const std::string & file_name)
+{
+   ProfileData & data = profile_data ();
+   std::string out = "{\"traceEvents\":[";
+   bool first = true;
+   char numbers[128];
+
+   pthread_mutex_lock (&data.mutex);
+   for (const std::unique_ptr<TraceBuffer> & buffer : data.trace_buffers) {
+      for (const TraceEvent & event : buffer->events) {
+         out += first ? "\n" : ",\n";
+         first = false;
+         out += "{\"name\":";
+         append_json_string (out, data.site_function[event.site]);
+         out += ",\"cat\":";
+         append_json_string (out, data.site_model[event.site]);
+         std::snprintf (numbers, sizeof(numbers),
+                        ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                        "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"group\":",
+                        buffer->thread_number,
+                        1e-3 * (static_cast<double>(event.start) -
+                                static_cast<double>(data.epoch)),
+                        1e-3 * (event.stop - event.start));
+         out += numbers;
+         append_json_string (out, group_label (event.group).c_str());
+         out += "}}";
+      }
+   }
+   pthread_mutex_unlock (&data.mutex);
+   out += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+   return write_file (file_name, out);
+}
+
+/**
+ * Turn initialization profiling on or off. When on, the counts are reset
+ * so that they cover initialization alone, and if a trace file is named,
+ * trace events are recorded until report_initialization is called.
+ * Initialization profiling must be turned on before the initialization
+ * jobs run, e.g. from the input file.
+ * \param[in] enabled    True to profile initialization
+ * \param[in] trace_file Trace output file; empty for no trace
+ */
+void
+JeodProfiler::set_init_profiling (
+   bool enabled,
+   const std::string & trace_file)
+{
+   ProfileData & data = profile_data ();
+
+   pthread_mutex_lock (&data.mutex);
+   data.init_trace_file = enabled ? trace_file : std::string();
+   pthread_mutex_unlock (&data.mutex);
+
+   data.init_profiling.store (enabled);
+   if (enabled) {
+      reset ();
+      if (! trace_file.empty()) {
+         set_tracing (true);
+      }
+   }
+}
+
+
+/**
+ * Report the initialization profile if initialization profiling is on:
+ * issue the summary table, sorted by decreasing total time, as an
+ * informational message and write the trace file, if one was named.
+ * The counts and trace are then reset so that subsequent profiling covers
+ * the run alone. Called at the end of DynManager::initialize_simulation.
+ */
+void
+JeodProfiler::report_initialization (
+   void)
+{
+   ProfileData & data = profile_data ();
+
+   if (! data.init_profiling.exchange (false)) {
+      return;
+   }
+
+   MessageHandler::inform (
+      __FILE__, __LINE__, SimInterfaceMessages::profiling,
+      "Initialization profile\n%s", sorted_summary().c_str());
+
+   pthread_mutex_lock (&data.mutex);
+   std::string trace_file = data.init_trace_file;
+   data.init_trace_file.clear ();
+   pthread_mutex_unlock (&data.mutex);
+
+   if (! trace_file.empty()) {
+      set_tracing (false);
+      write_trace (trace_file);
+   }
+
+   reset ();
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,456 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/parallel_integ_loops.cc
+ * Define member functions for the class JeodParallelIntegrationLoops.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The loops are independent: no loop's derivatives depend on the state of
+    bodies integrated by another loop))
+
+Library dependencies:
+  ((parallel_integ_loops.cc)
+   (standalone_dynbody_integ_loop.cc)
+   (sim_interface_messages.cc)
+   (dynamics/dyn_manager/src/derivative_thread_pool.cc))
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+
+// JEOD includes
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_manager/include/derivative_thread_pool.hh"
+#include "environment/time/include/time_manager.hh"
+#include "utils/math/include/numerical.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Local includes
+#include "../include/parallel_integ_loops.hh"
+#include "../include/sim_interface_messages.hh"
+#include "../include/standalone_dynbody_integ_loop.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Computes the derivatives of the bodies of one loop.
+ */
+class LoopDerivativesTask : public DerivativeThreadTask {
+public:
+   LoopDerivativesTask (
+      std::vector<JeodStandaloneIntegrationLoop *> & loops_in,
+      unsigned int offset_in)
+   :
+      loops (loops_in),
+      offset (offset_in)
+   { }
+
+   void execute (unsigned int index) override
+   {
+      loops[index + offset]->compute_body_derivatives ();
+   }
+
+private:
+   std::vector<JeodStandaloneIntegrationLoop *> & loops;
+   unsigned int offset;
+};
+
+} // End anonymous namespace
+
+
+/**
+ * JeodParallelIntegrationLoops default constructor.
+ */
+JeodParallelIntegrationLoops::JeodParallelIntegrationLoops (
+   void)
+:
+   num_threads (1),
+   lockstep_cycles (0),
+   separate_cycles (0),
+   loops (),
+   due_loops (),
+   due_nsubs (),
+   running (),
+   need_derivs (),
+   deriv_loops (),
+   thread_pool (nullptr)
+{
+   JEOD_REGISTER_CLASS (JeodStandaloneIntegrationLoop);
+   JEOD_REGISTER_CHECKPOINTABLE (this, loops);
+}
+
+
+/**
+ * JeodParallelIntegrationLoops destructor.
+ */
+JeodParallelIntegrationLoops::~JeodParallelIntegrationLoops (
+   void)
+{
+   JEOD_DEREGISTER_CHECKPOINTABLE (this, loops);
+
+   DerivativeThreadPool::release (thread_pool);
+}
+
+
+/**
+ * Add a loop to the set, declaring it independent of the other loops.
+ * \param[in] loop  Loop to be added.
+ */
+void
+JeodParallelIntegrationLoops::add_loop (
+   JeodStandaloneIntegrationLoop & loop)
+{
+   if (std::find (loops.begin(), loops.end(), &loop) != loops.end()) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "The integration loop is already in the set.");
+      return;
+   }
+
+   loops.push_back (&loop);
+}
+
+
+/**
+ * Remove a loop from the set.
+ * \param[in] loop  Loop to be removed.
+ */
+void
+JeodParallelIntegrationLoops::remove_loop (
+   JeodStandaloneIntegrationLoop & loop)
+{
+   std::vector<JeodStandaloneIntegrationLoop *>::iterator iter =
+      std::find (loops.begin(), loops.end(), &loop);
+
+   if (iter == loops.end()) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "The integration loop is not in the set.");
+      return;
+   }
+
+   loops.erase (iter);
+}
+
+
+/**
+ * Check that the loops do not share bodies: no body may be integrated by
+ * two loops, and a body integrated by one loop must not be attached to a
+ * body integrated by another. Each violation is reported as an error.
+ * @return True if no violation was found.
+ */
+bool
+JeodParallelIntegrationLoops::check_independence (
+   void)
+const
+{
+   std::unordered_map<const DynBody *, unsigned int> owner;
+   bool independent = true;
+
+   for (unsigned int iloop = 0; iloop < loops.size(); ++iloop) {
+      for (DynBody * body : loops[iloop]->dyn_bodies) {
+         if (! owner.insert (std::make_pair (body, iloop)).second) {
+            MessageHandler::error (
+               __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+               "DynBody '%s' is integrated by more than one loop.",
+               body->name.c_str());
+            independent = false;
+         }
+      }
+   }
+
+   for (unsigned int iloop = 0; iloop < loops.size(); ++iloop) {
+      for (DynBody * body : loops[iloop]->dyn_bodies) {
+         const DynBody * root = body->get_root_body();
+         std::unordered_map<const DynBody *, unsigned int>::const_iterator
+            root_owner = owner.find (root);
+         if ((root_owner != owner.end()) && (root_owner->second != iloop)) {
+            MessageHandler::error (
+               __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+               "DynBody '%s' is attached to '%s', which is integrated by "
+               "another loop.",
+               body->name.c_str(), root->name.c_str());
+            independent = false;
+         }
+      }
+   }
+
+   return independent;
+}
+
+
+/**
+ * Integrate the loops until each reaches the specified time. The loops
+ * that are due earliest are advanced one cycle at a time, so that loops
+ * with different cycles stay synchronized in time.
+ * \param[in] end_sim_time  Simulation time at which to stop, in seconds.
+ * @return  Zero => success, non-zero => error.
+ */
+int
+JeodParallelIntegrationLoops::integrate_to (
+   double end_sim_time)
+{
+   for (;;) {
+
+      // Find the loops short of the end time that are due earliest.
+      double due_time = 0.0;
+      due_loops.clear ();
+      for (JeodStandaloneIntegrationLoop * loop : loops) {
+         if (loop->integ_group == nullptr) {
+            MessageHandler::error (
+               __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+               "A JeodStandaloneIntegrationLoop in the set has not been "
+               "initialized.");
+            return 1;
+         }
+
+         // Stop at the cycle boundary nearest the end time.
+         double loop_time = loop->get_sim_time();
+         if (end_sim_time - loop_time <= 0.5 * loop->cycle) {
+            continue;
+         }
+
+         if (due_loops.empty() || (loop_time < due_time)) {
+            due_loops.clear ();
+            due_loops.push_back (loop);
+            due_time = loop_time;
+         }
+         else if (Numerical::compare_exact (loop_time, due_time)) {
+            due_loops.push_back (loop);
+         }
+      }
+
+      if (due_loops.empty()) {
+         return 0;
+      }
+
+      int status = integrate_due_loops ();
+      if (status != 0) {
+         return status;
+      }
+   }
+}
+
+
+/**
+ * Integrate one cycle of the due loops, in lock step if their integration
+ * stages coincide and one after the other otherwise.
+ * @return  Zero => success, non-zero => error.
+ */
+int
+JeodParallelIntegrationLoops::integrate_due_loops (
+   void)
+{
+   JeodStandaloneIntegrationLoop * first = due_loops.front();
+
+   // The loops' stages coincide if they share a cycle, an integrator, and
+   // a number of sub-steps.
+   bool lockstep = (due_loops.size() > 1);
+   due_nsubs.clear ();
+   for (JeodStandaloneIntegrationLoop * loop : due_loops) {
+      due_nsubs.push_back (loop->begin_cycle());
+      lockstep = lockstep &&
+                 Numerical::compare_exact (loop->cycle, first->cycle) &&
+                 (*loop->integ_constructor == *first->integ_constructor) &&
+                 (loop->time_manager == first->time_manager) &&
+                 (due_nsubs.back() == due_nsubs.front());
+   }
+
+   if (lockstep) {
+      return integrate_lockstep (due_nsubs.front());
+   }
+
+   for (unsigned int iloop = 0; iloop < due_loops.size(); ++iloop) {
+      JeodStandaloneIntegrationLoop * loop = due_loops[iloop];
+      double beg_sim_time = loop->get_sim_time();
+      double sub_sim_time = loop->cycle / due_nsubs[iloop];
+
+      loop->set_time_to_loop_start ();
+      for (unsigned int isub = 0; isub < due_nsubs[iloop]; ++isub) {
+         int status = loop->integrate_substep (
+                         beg_sim_time + isub * sub_sim_time, sub_sim_time);
+         if (status != 0) {
+            return status;
+         }
+      }
+      loop->end_cycle ();
+      ++separate_cycles;
+   }
+
+   return 0;
+}
+
+
+/**
+ * Integrate one cycle of the due loops in lock step.
+ * \param[in] nsub  Number of sub-steps in the cycle.
+ * @return  Zero => success, non-zero => error.
+ */
+int
+JeodParallelIntegrationLoops::integrate_lockstep (
+   unsigned int nsub)
+{
+   JeodStandaloneIntegrationLoop * first = due_loops.front();
+   double beg_sim_time = first->get_sim_time();
+   double sub_sim_time = first->cycle / nsub;
+
+   first->set_time_to_loop_start ();
+   for (unsigned int isub = 0; isub < nsub; ++isub) {
+      int status = integrate_lockstep_substep (
+                      beg_sim_time + isub * sub_sim_time, sub_sim_time);
+      if (status != 0) {
+         return status;
+      }
+   }
+
+   for (JeodStandaloneIntegrationLoop * loop : due_loops) {
+      loop->end_cycle ();
+   }
+   lockstep_cycles += due_loops.size();
+
+   return 0;
+}
+
+
+/**
+ * Integrate one sub-step of the due loops in lock step. Each pass
+ * evaluates the derivatives of the loops that need them and then
+ * integrates each loop's state, with time reset to the stage time before
+ * each loop so that every loop sees the time it would see on its own.
+ * \param[in] beg_sim_time  The time at the start of the sub-step.
+ * \param[in] del_sim_time  The time span of the sub-step.
+ * @return  Zero => success, non-zero => error.
+ */
+int
+JeodParallelIntegrationLoops::integrate_lockstep_substep (
+   double beg_sim_time,
+   double del_sim_time)
+{
+   TimeManager & time_manager = *due_loops.front()->time_manager;
+   unsigned int nloops = due_loops.size();
+
+   running.assign (nloops, true);
+   need_derivs.assign (nloops, false);
+   for (unsigned int iloop = 0; iloop < nloops; ++iloop) {
+      JeodStandaloneIntegrationLoop * loop = due_loops[iloop];
+      need_derivs[iloop] =
+         loop->integ_group->get_first_step_derivs_flag() ||
+         loop->integ_interface.get_first_step_derivs_flag();
+      loop->integ_interface.set_dt (del_sim_time);
+   }
+
+   // Integrate until the integrators say "we're done" by returning zero.
+   bool any_running = true;
+   while (any_running) {
+      compute_derivatives ();
+
+      double stage_sim_time = time_manager.simtime;
+      any_running = false;
+      for (unsigned int iloop = 0; iloop < nloops; ++iloop) {
+         if (! running[iloop]) {
+            continue;
+         }
+
+         time_manager.update (stage_sim_time);
+         unsigned int ipass = due_loops[iloop]->integ_group->integrate_group (
+                                 beg_sim_time, del_sim_time);
+         need_derivs[iloop] = true;
+         running[iloop] = (ipass != 0);
+         any_running = any_running || running[iloop];
+      }
+   }
+
+   return 0;
+}
+
+
+/**
+ * Evaluate the derivatives of the running loops that need them. The shared
+ * environment is brought up to date once, on the calling thread. The first
+ * loop is then evaluated alone so that state shared across loops (frame
+ * offsets, cached body deltas) is brought up to date before the remaining
+ * loops are evaluated concurrently.
+ */
+void
+JeodParallelIntegrationLoops::compute_derivatives (
+   void)
+{
+   deriv_loops.clear ();
+   for (unsigned int iloop = 0; iloop < due_loops.size(); ++iloop) {
+      if (running[iloop] && need_derivs[iloop]) {
+         deriv_loops.push_back (due_loops[iloop]);
+      }
+   }
+   if (deriv_loops.empty()) {
+      return;
+   }
+
+   // A loop that updates ephemerides at the derivative rate does so for all.
+   JeodStandaloneIntegrationLoop * env_loop = deriv_loops.front();
+   for (JeodStandaloneIntegrationLoop * loop : deriv_loops) {
+      if (loop->integ_group->deriv_ephem_update) {
+         env_loop = loop;
+         break;
+      }
+   }
+   env_loop->integ_group->update_environment (*env_loop->dyn_manager);
+
+   deriv_loops.front()->compute_body_derivatives ();
+
+   LoopDerivativesTask rest (deriv_loops, 1);
+   unsigned int nrest = deriv_loops.size() - 1;
+   DerivativeThreadPool * pool = prepare_thread_pool ();
+   if (pool != nullptr) {
+      pool->run (nrest, rest);
+   }
+   else {
+      for (unsigned int ii = 0; ii < nrest; ++ii) {
+         rest.execute (ii);
+      }
+   }
+}
+
+
+/**
+ * Obtain the thread pool, creating or resizing it as needed.
+ * @return Thread pool, or null if derivatives are to be evaluated serially.
+ */
+DerivativeThreadPool *
+JeodParallelIntegrationLoops::prepare_thread_pool (
+   void)
+{
+   if (num_threads < 2) {
+      return nullptr;
+   }
+
+   return DerivativeThreadPool::acquire (thread_pool, num_threads);
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -49,6 +49,9 @@ MAKE_MESSAGE_CODE(interface_error);
 MAKE_MESSAGE_CODE(phasing_error);
 MAKE_MESSAGE_CODE(integration_error);
 MAKE_MESSAGE_CODE(implementation_error);
+MAKE_MESSAGE_CODE(profiling);
+MAKE_MESSAGE_CODE(data_module_error);
+MAKE_MESSAGE_CODE(fidelity_change);
 
 } // End JEOD namespace
 
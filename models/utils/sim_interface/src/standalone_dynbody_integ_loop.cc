@@ -0,0 +1,377 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/standalone_dynbody_integ_loop.cc
+ * Define JeodStandaloneIntegrationLoop methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The driver is responsible for calling the loop's integrate functions
+    and for keeping multiple loops synchronized in time.))
+
+Library dependencies:
+  ((standalone_dynbody_integ_loop.cc)
+   (sim_interface_messages.cc))
+
+ 
+*******************************************************************************/
+
+
+// Local includes
+#include "../include/standalone_dynbody_integ_loop.hh"
+#include "../include/sim_interface_messages.hh"
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "environment/time/include/time_manager.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+
+
+//! Namespace jeod
+namespace jeod {
+
+// JeodStandaloneIntegrationLoop default constructor.
+JeodStandaloneIntegrationLoop::JeodStandaloneIntegrationLoop ()
+:
+   cycle(0.0),
+   start_sim_time(0.0),
+   cycle_count(0),
+   dyn_manager(nullptr),
+   time_manager(nullptr),
+   gravity_manager(nullptr),
+   integ_constructor(nullptr),
+   integ_group_factory(nullptr),
+   integ_group(nullptr),
+   deriv_function(nullptr),
+   deriv_context(nullptr),
+   deriv_ephem_update(false),
+   group_changed(false)
+{
+}
+
+
+// JeodStandaloneIntegrationLoop non-default constructor.
+JeodStandaloneIntegrationLoop::JeodStandaloneIntegrationLoop (
+   double cycle_in,
+   TimeManager & time_manager_in,
+   DynManager & dyn_manager_in,
+   GravityManager & grav_manager_in,
+   er7_utils::IntegratorConstructor *& integ_cotr_in,
+   DynamicsIntegrationGroup & integ_group_factory_in)
+:
+   cycle(cycle_in),
+   start_sim_time(0.0),
+   cycle_count(0),
+   dyn_manager(&dyn_manager_in),
+   time_manager(&time_manager_in),
+   gravity_manager(&grav_manager_in),
+   integ_constructor(&integ_cotr_in),
+   integ_group_factory(&integ_group_factory_in),
+   integ_group(nullptr),
+   deriv_function(nullptr),
+   deriv_context(nullptr),
+   deriv_ephem_update(false),
+   group_changed(false)
+{
+   if (cycle <= 0.0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "The integration cycle for a JeodStandaloneIntegrationLoop "
+         "must be positive.");
+   }
+   integ_interface.set_dt (cycle);
+}
+
+
+// JeodStandaloneIntegrationLoop destructor.
+JeodStandaloneIntegrationLoop::~JeodStandaloneIntegrationLoop (
+   void)
+{
+   if ((integ_group != nullptr) && (JEOD_IS_ALLOCATED (integ_group))) {
+      JEOD_DELETE_OBJECT (integ_group);
+   }
+}
+
+
+// Initialize an integration loop object.
+void
+JeodStandaloneIntegrationLoop::initialize_integ_loop (
+   void)
+{
+   // The integrator_constructor should have been populated at this point.
+   if (*integ_constructor == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "The integrator constructor for a JeodStandaloneIntegrationLoop "
+         "has not been initialized.");
+   }
+
+   // Create the loop's integration group object by
+   // using the provided integration group as a factory.
+   integ_group =
+      integ_group_factory->create_group (
+         *this, **integ_constructor, integ_interface,
+         time_manager->get_jeod_integration_time());
+   integ_group->deriv_ephem_update = deriv_ephem_update;
+
+   // Let the dynamics manager know about the group.
+   dyn_manager->add_integ_group (*integ_group);
+
+   // Cycles are counted from the current time.
+   start_sim_time = time_manager->simtime;
+   cycle_count = 0;
+}
+
+
+// Set JEOD time to the time at the start of the next cycle.
+void
+JeodStandaloneIntegrationLoop::set_time_to_loop_start (
+   void)
+{
+   time_manager->update (get_sim_time());
+}
+
+
+// Add a DynBody to the set of bodies integrated by this loop.
+void
+JeodStandaloneIntegrationLoop::add_dyn_body (
+   DynBody & dyn_body)
+{
+   if (dyn_body_positions.find (dyn_bodies, &dyn_body) !=
+       dyn_body_positions.npos) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "DynBody '%s' is already integrated by this loop.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   dyn_body_positions.push_back (dyn_bodies, &dyn_body);
+
+   // Add the body to the group now if the dynamics manager is initialized.
+   // (If not, it will be added during DynManager::initialize_simulation.)
+   if ((integ_group != nullptr) && dyn_manager->is_initialized()) {
+      integ_group->add_dyn_body (dyn_body);
+      group_changed = true;
+   }
+}
+
+
+// Remove a DynBody from the set of bodies integrated by this loop.
+void
+JeodStandaloneIntegrationLoop::remove_dyn_body (
+   DynBody & dyn_body)
+{
+   if (! dyn_body_positions.swap_remove (dyn_bodies, &dyn_body)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "DynBody '%s' is not integrated by this loop.",
+         dyn_body.name.c_str());
+      return;
+   }
+
+   if ((integ_group != nullptr) && dyn_manager->is_initialized()) {
+      integ_group->delete_dyn_body (dyn_body);
+      group_changed = true;
+   }
+}
+
+
+// Add the specified integrable object to the integration group.
+void
+JeodStandaloneIntegrationLoop::add_integrable_object (
+   er7_utils::IntegrableObject & integrable_object)
+{
+   // The object must not be a DynBody.
+   if (dynamic_cast<DynBody*> (&integrable_object)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "Do not use add_integrable_object on DynBody objects.");
+      return;
+   }
+
+   // Add the object to the loop's integration group.
+   integ_group->add_integrable_object (integrable_object);
+}
+
+
+// Remove the specified integrable object from the integration group.
+void
+JeodStandaloneIntegrationLoop::remove_integrable_object (
+   er7_utils::IntegrableObject & integrable_object)
+{
+   integ_group->remove_integrable_object (integrable_object);
+}
+
+
+// Compute the derivatives of the bodies integrated by this loop.
+void
+JeodStandaloneIntegrationLoop::compute_derivatives (
+   void)
+{
+   integ_group->update_environment (*dyn_manager);
+   compute_body_derivatives ();
+}
+
+
+// Compute the derivatives of the bodies integrated by this loop
+// against an environment that is already up to date.
+void
+JeodStandaloneIntegrationLoop::compute_body_derivatives (
+   void)
+{
+   integ_group->body_gravitation (*gravity_manager);
+
+   if (deriv_function != nullptr) {
+      deriv_function (deriv_context);
+   }
+
+   integ_group->collect_derivatives ();
+}
+
+
+// Integrate over one integration cycle.
+int
+JeodStandaloneIntegrationLoop::integrate_cycle (
+   void)
+{
+   if (integ_group == nullptr) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "The JeodStandaloneIntegrationLoop has not been initialized.");
+      return 1;
+   }
+
+   double beg_sim_time = get_sim_time();
+   unsigned int nsub = begin_cycle ();
+   double sub_sim_time = cycle / nsub;
+
+   for (unsigned int isub = 0; isub < nsub; ++isub) {
+      int status = integrate_substep (
+                      beg_sim_time + isub * sub_sim_time, sub_sim_time);
+      if (status != 0) {
+         return status;
+      }
+   }
+
+   end_cycle ();
+
+   return 0;
+}
+
+
+// Prepare the loop for its next integration cycle.
+unsigned int
+JeodStandaloneIntegrationLoop::begin_cycle (
+   void)
+{
+   // Start afresh after a change in the set of integrated bodies.
+   if (group_changed) {
+      integ_group->reset_integrators ();
+      group_changed = false;
+   }
+
+   // Split the cycle into the number of sub-steps the dynamics manager's
+   // multirate scheduler selects for this loop's integration group.
+   return dyn_manager->schedule_substeps (*integ_group, cycle);
+}
+
+
+// Finish an integration cycle.
+void
+JeodStandaloneIntegrationLoop::end_cycle (
+   void)
+{
+   ++cycle_count;
+
+   dyn_manager->end_integration_cycle (*integ_group);
+}
+
+
+// Integrate whole cycles until the loop reaches the specified time.
+int
+JeodStandaloneIntegrationLoop::integrate_to (
+   double end_sim_time)
+{
+   // Stop at the cycle boundary nearest the end time.
+   while (end_sim_time - get_sim_time() > 0.5 * cycle) {
+      int status = integrate_cycle ();
+      if (status != 0) {
+         return status;
+      }
+   }
+
+   return 0;
+}
+
+
+// Integrate over one sub-step of the integration cycle.
+int
+JeodStandaloneIntegrationLoop::integrate_substep (
+   double beg_sim_time,
+   double del_sim_time)
+{
+   unsigned int ipass = 0;
+   bool need_derivs =
+      integ_group->get_first_step_derivs_flag() ||
+      integ_interface.get_first_step_derivs_flag();
+
+   integ_interface.set_dt (del_sim_time);
+
+   // Integrate until the integrators say "we're done" by returning zero.
+   do {
+      if (need_derivs) {
+         compute_derivatives ();
+      }
+      need_derivs = true;
+
+      ipass = integ_group->integrate_group (beg_sim_time, del_sim_time);
+   } while (ipass != 0);
+
+   return 0;
+}
+
+
+// Update the provided group.
+void
+JeodStandaloneIntegrationLoop::update_integration_group (
+   JeodIntegrationGroup & group)
+{
+   // The provided group must be this loop object's integration group.
+   if (&group != integ_group) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::integration_error,
+         "Internal error.");
+   }
+
+   for (JeodPointerVector<DynBody>::type::const_iterator iter =
+           dyn_bodies.begin();
+        iter != dyn_bodies.end();
+        ++iter) {
+      integ_group->add_dyn_body (**iter);
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
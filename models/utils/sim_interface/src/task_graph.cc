@@ -0,0 +1,554 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/task_graph.cc
+ * Define JeodTaskGraph methods.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((task_graph.cc)
+   (sim_interface_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+
+// JEOD includes
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/task_graph.hh"
+#include "../include/sim_interface_messages.hh"
+
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * Construct a JeodTaskGraph with no tasks.
+ */
+JeodTaskGraph::JeodTaskGraph (
+   void)
+:
+   num_threads(1),
+   nodes(),
+   serial_order(),
+   built(false),
+   waiting(),
+   remaining(0),
+   queues(),
+   workers(),
+   mutex(),
+   start_cond(),
+   done_cond(),
+   generation(0),
+   pending(0),
+   shutdown(false)
+{
+   ; // Empty
+}
+
+
+/**
+ * Destruct a JeodTaskGraph, stopping the workers.
+ * The tasks are not owned by the graph.
+ */
+JeodTaskGraph::~JeodTaskGraph (
+   void)
+{
+   stop_workers ();
+}
+
+
+/**
+ * Add a task to the graph. Tasks are to be added in the order in which a
+ * serial schedule would execute them.
+ * @return Index of the task, for use in declaring its data.
+ * \param[in] task Task
+ * \param[in] name Task name, for diagnostics
+ */
+unsigned int
+JeodTaskGraph::add_task (
+   JeodGraphTask & task,
+   const std::string & name)
+{
+   Node node;
+   node.task = &task;
+   node.name = name;
+   node.num_predecessors = 0;
+   nodes.push_back (node);
+   built = false;
+
+   return nodes.size() - 1;
+}
+
+
+/**
+ * Declare that a task reads a data item.
+ * \param[in] task_index Index of the task
+ * \param[in] item Address that identifies the data item
+ */
+void
+JeodTaskGraph::add_input (
+   unsigned int task_index,
+   const void * item)
+{
+   check_index (task_index, "add_input");
+   nodes[task_index].inputs.push_back (item);
+   built = false;
+}
+
+
+/**
+ * Declare that a task writes a data item.
+ * \param[in] task_index Index of the task
+ * \param[in] item Address that identifies the data item
+ */
+void
+JeodTaskGraph::add_output (
+   unsigned int task_index,
+   const void * item)
+{
+   check_index (task_index, "add_output");
+   nodes[task_index].outputs.push_back (item);
+   built = false;
+}
+
+
+/**
+ * Declare that one task must complete before another starts.
+ * \param[in] before Index of the task that runs first
+ * \param[in] after Index of the task that waits
+ */
+void
+JeodTaskGraph::add_dependency (
+   unsigned int before,
+   unsigned int after)
+{
+   check_index (before, "add_dependency");
+   check_index (after, "add_dependency");
+   if (before == after) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::phasing_error,
+         "Task '%s' cannot depend on itself.",
+         nodes[after].name.c_str());
+      return;
+   }
+   nodes[after].explicit_before.push_back (before);
+   built = false;
+}
+
+
+/**
+ * Remove all tasks. The worker threads are kept.
+ */
+void
+JeodTaskGraph::clear (
+   void)
+{
+   nodes.clear ();
+   serial_order.clear ();
+   built = false;
+}
+
+
+/**
+ * Get the tasks that a task waits for, in index order.
+ * @return Indices of the predecessors.
+ * \param[in] task_index Index of the task
+ */
+std::vector<unsigned int>
+JeodTaskGraph::get_predecessors (
+   unsigned int task_index)
+{
+   check_index (task_index, "get_predecessors");
+   if (! built) {
+      build ();
+   }
+
+   std::vector<unsigned int> predecessors;
+   for (unsigned int ii = 0; ii < nodes.size(); ++ii) {
+      const std::vector<unsigned int> & succ = nodes[ii].successors;
+      if (std::find (succ.begin(), succ.end(), task_index) != succ.end()) {
+         predecessors.push_back (ii);
+      }
+   }
+   return predecessors;
+}
+
+
+/**
+ * Fail if a task index is out of range.
+ * \param[in] task_index Index to be checked
+ * \param[in] function Name of the calling method
+ */
+void
+JeodTaskGraph::check_index (
+   unsigned int task_index,
+   const char * function) const
+{
+   if (task_index >= nodes.size()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::implementation_error,
+         "JeodTaskGraph::%s: task index %u is out of range; "
+         "the graph has %u tasks.",
+         function, task_index, static_cast<unsigned int>(nodes.size()));
+   }
+}
+
+
+/**
+ * Derive the dependencies from the data declarations and the explicit
+ * dependencies, and compute the serial order. Fails if the explicit
+ * dependencies form a cycle.
+ */
+void
+JeodTaskGraph::build (
+   void)
+{
+   unsigned int ntasks = nodes.size();
+
+   // Most recent writer and the readers since, per data item.
+   struct ItemUse {
+      int last_writer;
+      std::vector<unsigned int> readers;
+      ItemUse () : last_writer(-1), readers() {}
+   };
+   std::map<const void *, ItemUse> items;
+   std::vector<std::vector<unsigned int> > before (ntasks);
+
+   for (unsigned int ii = 0; ii < ntasks; ++ii) {
+      Node & node = nodes[ii];
+      std::vector<unsigned int> & preds = before[ii];
+
+      // Read after write.
+      for (unsigned int jj = 0; jj < node.inputs.size(); ++jj) {
+         ItemUse & use = items[node.inputs[jj]];
+         if (use.last_writer >= 0) {
+            preds.push_back (use.last_writer);
+         }
+      }
+
+      // Write after write and write after read.
+      for (unsigned int jj = 0; jj < node.outputs.size(); ++jj) {
+         ItemUse & use = items[node.outputs[jj]];
+         if (use.last_writer >= 0) {
+            preds.push_back (use.last_writer);
+         }
+         preds.insert (preds.end(), use.readers.begin(), use.readers.end());
+      }
+
+      for (unsigned int jj = 0; jj < node.inputs.size(); ++jj) {
+         items[node.inputs[jj]].readers.push_back (ii);
+      }
+      for (unsigned int jj = 0; jj < node.outputs.size(); ++jj) {
+         ItemUse & use = items[node.outputs[jj]];
+         use.last_writer = ii;
+         use.readers.clear ();
+      }
+
+      preds.insert (preds.end(),
+                    node.explicit_before.begin(), node.explicit_before.end());
+      std::sort (preds.begin(), preds.end());
+      preds.erase (std::unique (preds.begin(), preds.end()), preds.end());
+      preds.erase (std::remove (preds.begin(), preds.end(), ii), preds.end());
+   }
+
+   for (unsigned int ii = 0; ii < ntasks; ++ii) {
+      nodes[ii].successors.clear ();
+   }
+   for (unsigned int ii = 0; ii < ntasks; ++ii) {
+      nodes[ii].num_predecessors = before[ii].size();
+      for (unsigned int jj = 0; jj < before[ii].size(); ++jj) {
+         nodes[before[ii][jj]].successors.push_back (ii);
+      }
+   }
+
+   // Serial order: repeatedly run the lowest-numbered ready task. Without
+   // explicit dependencies this is the order of addition.
+   std::priority_queue<unsigned int, std::vector<unsigned int>,
+                       std::greater<unsigned int> > ready;
+   std::vector<unsigned int> count (ntasks);
+   for (unsigned int ii = 0; ii < ntasks; ++ii) {
+      count[ii] = nodes[ii].num_predecessors;
+      if (count[ii] == 0) {
+         ready.push (ii);
+      }
+   }
+   serial_order.clear ();
+   while (! ready.empty()) {
+      unsigned int ii = ready.top();
+      ready.pop ();
+      serial_order.push_back (ii);
+      const std::vector<unsigned int> & succ = nodes[ii].successors;
+      for (unsigned int jj = 0; jj < succ.size(); ++jj) {
+         if (--count[succ[jj]] == 0) {
+            ready.push (succ[jj]);
+         }
+      }
+   }
+
+   if (serial_order.size() < ntasks) {
+      unsigned int stuck = 0;
+      while (count[stuck] == 0) {
+         ++stuck;
+      }
+      MessageHandler::fail (
+         __FILE__, __LINE__, SimInterfaceMessages::phasing_error,
+         "The task graph has a dependency cycle involving task '%s'.",
+         nodes[stuck].name.c_str());
+      return;
+   }
+
+   waiting.resize (ntasks);
+   built = true;
+}
+
+
+/**
+ * Execute every task once, each after the tasks it depends on, and wait
+ * for completion.
+ */
+void
+JeodTaskGraph::execute (
+   void)
+{
+   if (! built) {
+      build ();
+      if (! built) {
+         return;
+      }
+   }
+
+   unsigned int ntasks = nodes.size();
+
+   // Serial execution.
+   if ((num_threads < 2) || (ntasks < 2)) {
+      for (unsigned int ii = 0; ii < ntasks; ++ii) {
+         nodes[serial_order[ii]].task->execute ();
+      }
+      return;
+   }
+
+   prepare_workers ();
+
+   // Seed the calling thread's queue with the tasks that are ready at the
+   // start, lowest index at the back so that it runs first.
+   for (unsigned int ii = 0; ii < ntasks; ++ii) {
+      waiting[ii] = nodes[ii].num_predecessors;
+   }
+   remaining = ntasks;
+   for (unsigned int ii = ntasks; ii-- > 0; ) {
+      if (waiting[ii] == 0) {
+         queues[0]->tasks.push_back (ii);
+      }
+   }
+
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      pending = workers.size();
+      ++generation;
+   }
+   start_cond.notify_all ();
+
+   run_tasks (0);
+
+   std::unique_lock<std::mutex> lock (mutex);
+   while (pending > 0) {
+      done_cond.wait (lock);
+   }
+}
+
+
+/**
+ * Start num_threads-1 worker threads and one ready queue per thread,
+ * restarting the workers if the thread count has changed.
+ */
+void
+JeodTaskGraph::prepare_workers (
+   void)
+{
+   if (workers.size() == num_threads - 1) {
+      return;
+   }
+
+   stop_workers ();
+
+   queues.reserve (num_threads);
+   for (unsigned int ii = 0; ii < num_threads; ++ii) {
+      queues.push_back (new ReadyQueue);
+   }
+   workers.reserve (num_threads - 1);
+   for (unsigned int ii = 1; ii < num_threads; ++ii) {
+      workers.push_back (
+         std::thread (&JeodTaskGraph::worker_loop, this, ii, generation));
+   }
+}
+
+
+/**
+ * Stop and join the worker threads and release the ready queues.
+ */
+void
+JeodTaskGraph::stop_workers (
+   void)
+{
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      shutdown = true;
+   }
+   start_cond.notify_all ();
+
+   for (std::vector<std::thread>::iterator it = workers.begin();
+        it != workers.end();
+        ++it) {
+      it->join ();
+   }
+   workers.clear ();
+
+   for (unsigned int ii = 0; ii < queues.size(); ++ii) {
+      delete queues[ii];
+   }
+   queues.clear ();
+
+   shutdown = false;
+}
+
+
+/**
+ * Worker thread main loop.
+ * \param[in] thread_index Thread index, 1 to num_threads-1
+ * \param[in] start_generation Step generation when the worker was started
+ */
+void
+JeodTaskGraph::worker_loop (
+   unsigned int thread_index,
+   unsigned long start_generation)
+{
+   unsigned long seen_generation = start_generation;
+
+   for (;;) {
+      {
+         std::unique_lock<std::mutex> lock (mutex);
+         while ((! shutdown) && (generation == seen_generation)) {
+            start_cond.wait (lock);
+         }
+         if (shutdown) {
+            return;
+         }
+         seen_generation = generation;
+      }
+
+      run_tasks (thread_index);
+
+      {
+         std::lock_guard<std::mutex> lock (mutex);
+         --pending;
+      }
+      done_cond.notify_one ();
+   }
+}
+
+
+/**
+ * Execute ready tasks until every task of the step has completed. The
+ * successors a task makes ready go onto this thread's queue. A thread with
+ * nothing to do yields rather than blocks, since the tasks of a step are
+ * expected to be short.
+ * \param[in] thread_index Thread index, zero for the calling thread
+ */
+void
+JeodTaskGraph::run_tasks (
+   unsigned int thread_index)
+{
+   ReadyQueue & own = *queues[thread_index];
+
+   while (remaining.load() > 0) {
+      unsigned int task_index;
+      if (! next_task (thread_index, task_index)) {
+         std::this_thread::yield ();
+         continue;
+      }
+
+      nodes[task_index].task->execute ();
+
+      {
+         std::lock_guard<std::mutex> lock (mutex);
+         const std::vector<unsigned int> & succ = nodes[task_index].successors;
+         for (unsigned int ii = 0; ii < succ.size(); ++ii) {
+            if (--waiting[succ[ii]] == 0) {
+               std::lock_guard<std::mutex> queue_lock (own.mutex);
+               own.tasks.push_back (succ[ii]);
+            }
+         }
+      }
+
+      // Successors are queued before this task counts as complete, so
+      // remaining cannot reach zero while any task is outstanding.
+      remaining.fetch_sub (1);
+   }
+}
+
+
+/**
+ * Take the most recently queued task from this thread's queue or, if that
+ * is empty, steal the oldest task from another thread's queue.
+ * @return True if a task was obtained.
+ * \param[in] thread_index Thread index
+ * \param[out] task_index Index of the task obtained
+ */
+bool
+JeodTaskGraph::next_task (
+   unsigned int thread_index,
+   unsigned int & task_index)
+{
+   {
+      ReadyQueue & own = *queues[thread_index];
+      std::lock_guard<std::mutex> lock (own.mutex);
+      if (! own.tasks.empty()) {
+         task_index = own.tasks.back();
+         own.tasks.pop_back ();
+         return true;
+      }
+   }
+
+   unsigned int nqueues = queues.size();
+   for (unsigned int ii = 1; ii < nqueues; ++ii) {
+      ReadyQueue & victim = *queues[(thread_index + ii) % nqueues];
+      std::lock_guard<std::mutex> lock (victim.mutex);
+      if (! victim.tasks.empty()) {
+         task_index = victim.tasks.front();
+         victim.tasks.pop_front ();
+         return true;
+      }
+   }
+
+   return false;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -222,6 +222,32 @@ int
 JeodDynbodyIntegrationLoop::integrate_dt (
    double beg_sim_time,
    double del_sim_time)
+{
+   // Split the span into the number of sub-steps the dynamics manager's
+   // multirate scheduler selects for this loop's integration group.
+   unsigned int nsub =
+      dyn_manager->schedule_substeps (*integ_group, del_sim_time);
+   double sub_sim_time = del_sim_time / nsub;
+
+   for (unsigned int isub = 0; isub < nsub; ++isub) {
+      int status = integrate_substep (
+                      beg_sim_time + isub * sub_sim_time, sub_sim_time);
+      if (status != 0) {
+         return status;
+      }
+   }
+
+   dyn_manager->end_integration_cycle (*integ_group);
+
+   return 0;
+}
+
+
+// Integrate over one sub-step of the integration interval.
+int
+JeodDynbodyIntegrationLoop::integrate_substep (
+   double beg_sim_time,
+   double del_sim_time)
 {
    int ipass = 0;
    bool need_derivs =
@@ -56,9 +56,16 @@ JeodTrickMemoryInterface::JeodTrickMemoryInterface ()
 :
    allocation_map(),
    container_list(),
+   reconstructible_map(),
+   reconstructor_map(),
    id_prefix("jeod_alloc_"),
    id_length(6),
-   mode(JeodSimulationInterface::Construction)
+   mode(JeodSimulationInterface::Construction),
+   translation_mutex(),
+   attributes_by_name(),
+   attributes_by_type(),
+   name_by_address(),
+   address_by_name()
 {
    dlhandle = dlopen (nullptr, RTLD_LAZY);
 
@@ -91,6 +98,24 @@ JeodTrickMemoryInterface::set_mode (
    JeodSimulationInterface::Mode new_mode)
 {
    mode = new_mode;
+   clear_translation_cache ();
+}
+
+
+/**
+ * Forget the name and address translations. Called whenever the set of
+ * allocations may have changed: on JEOD allocation and deallocation, on
+ * mode transitions, and at the start of each checkpoint and restart step.
+ * The attribute caches are kept; a type's attributes do not change.
+ */
+void
+JeodTrickMemoryInterface::clear_translation_cache (
+   void)
+const
+{
+   std::lock_guard<std::mutex> lock (translation_mutex);
+   name_by_address.clear ();
+   address_by_name.clear ();
 }
 
 
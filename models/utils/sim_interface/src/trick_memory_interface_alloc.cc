@@ -82,6 +82,9 @@ JeodTrickMemoryInterface::register_allocation (
    unsigned int nelems = item.get_nelems();
    uint32_t unique_id = item.get_unique_id();
 
+   // The new allocation may change how addresses translate.
+   clear_translation_cache ();
+
    // Register for checkpoint/restart in the allocation map.
    allocation_map.insert (
       AllocationMap::value_type (
@@ -89,6 +92,37 @@ JeodTrickMemoryInterface::register_allocation (
          AllocationMapEntry (
             tdesc.get_typeid(), nelems, item.get_is_array())));
 
+   // Declare the memory to Trick.
+   if (! declare_allocation (addr, tdesc, unique_id, nelems)) {
+
+      // Handle failed parse / failed registration.
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+         "Memory registration failed with allocation at %s:%d",
+         file, line);
+      return false;
+   }
+
+   return true;
+}
+
+
+/**
+ * Declare allocated memory to Trick as an array of the given number of
+ * elements, named per construct_identifier.
+ * @return True if declared
+ * \param[in] addr Allocated memory
+ * \param[in] tdesc Description of the type
+ * \param[in] unique_id Unique identifier of the allocation
+ * \param[in] nelems Number of elements to declare
+ */
+bool
+JeodTrickMemoryInterface::declare_allocation (
+   const void * addr,
+   const JeodMemoryTypeDescriptor & tdesc,
+   uint32_t unique_id,
+   uint32_t nelems)
+{
    // Construct a string that emulates the declaration of the memory.
    std::stringstream sstream;
    sstream << tdesc.get_name()
@@ -100,25 +134,15 @@ JeodTrickMemoryInterface::register_allocation (
    Trick::ADefParseContext context(&sstream);
 
    // Parse the declaration context and register the memory.
-   if ((ADEF_parse (&context) != 0) ||
-       (trick_MM->declare_extern_var (
-           const_cast <void *>(addr),
-           context.type,
-           context.user_type_name,
-           context.n_stars,
-           context.var_name,
-           context.n_cdims,
-           context.cdims) == nullptr)) {
-
-      // Handle failed parse / failed registration.
-      MessageHandler::error (
-         __FILE__, __LINE__, SimInterfaceMessages::interface_error,
-         "Memory registration failed with allocation at %s:%d",
-         file, line);
-      return false;
-   }
-
-   return true;
+   return (ADEF_parse (&context) == 0) &&
+          (trick_MM->declare_extern_var (
+              const_cast <void *>(addr),
+              context.type,
+              context.user_type_name,
+              context.n_stars,
+              context.var_name,
+              context.n_cdims,
+              context.cdims) != nullptr);
 }
 
 
@@ -143,8 +167,12 @@ JeodTrickMemoryInterface::deregister_allocation (
    unsigned int line)
 {
 
-   // Erase the allocation map entry for this item.
+   // Erase the allocation map entries for this item.
    allocation_map.erase (item.get_unique_id());
+   reconstructible_map.erase (item.get_unique_id());
+
+   // Translations into the freed memory are no longer valid.
+   clear_translation_cache ();
 
    // Revoke the registration of the allocated memory with Trick.
    int return_code = trick_MM->delete_extern_var (const_cast <void *>(addr));
@@ -161,6 +189,87 @@ JeodTrickMemoryInterface::deregister_allocation (
    return;
 }
 
+
+/**
+ * Mark an allocation as reconstructible. Its contents are withheld from
+ * checkpoints, which instead record the reference and a hash of the
+ * contents; the reconstructor is registered under the reference to refill
+ * the allocation on restart.
+ * \param[in] addr Allocated memory
+ * \param[in] item Description of the memory
+ * \param[in] tdesc Description of the type
+ * \param[in] reference Identifies the data source across runs
+ * \param[in,out] reconstructor Rebuilds the contents on restart
+ */
+void
+JeodTrickMemoryInterface::set_reconstructible (
+   const void * addr,
+   const JeodMemoryItem & item,
+   const JeodMemoryTypeDescriptor & tdesc,
+   const std::string & reference,
+   JeodCheckpointReconstructor & reconstructor)
+{
+   // The reference must fit on one line of the checkpoint file.
+   if (reference.empty() ||
+       (reference.find ('\n') != std::string::npos)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+         "Invalid reconstructible reference '%s'.",
+         reference.c_str());
+      return;
+   }
+
+   // A reference can identify one data source only.
+   ReconstructorMap::iterator found = reconstructor_map.find (reference);
+   if ((found != reconstructor_map.end()) &&
+       (found->second != &reconstructor)) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+         "Reconstructible reference '%s' is already in use.",
+         reference.c_str());
+      return;
+   }
+   reconstructor_map[reference] = &reconstructor;
+
+   ReconstructibleEntry & entry = reconstructible_map[item.get_unique_id()];
+   entry.addr = addr;
+   entry.tdesc = &tdesc;
+   entry.nelements = item.get_nelems();
+   entry.reference = reference;
+   entry.withheld = false;
+}
+
+
+/**
+ * Forget a reconstructor. Allocations it would have reconstructed revert
+ * to being checkpointed in full.
+ * \param[in,out] reconstructor The reconstructor
+ */
+void
+JeodTrickMemoryInterface::forget_reconstructor (
+   JeodCheckpointReconstructor & reconstructor)
+{
+   for (ReconstructorMap::iterator iter = reconstructor_map.begin();
+        iter != reconstructor_map.end();) {
+      if (iter->second == &reconstructor) {
+         const std::string & reference = iter->first;
+         for (ReconstructibleMap::iterator entry = reconstructible_map.begin();
+              entry != reconstructible_map.end();) {
+            if (entry->second.reference == reference) {
+               entry = reconstructible_map.erase (entry);
+            }
+            else {
+               ++entry;
+            }
+         }
+         iter = reconstructor_map.erase (iter);
+      }
+      else {
+         ++iter;
+      }
+   }
+}
+
 } // End JEOD namespace
 
 #endif
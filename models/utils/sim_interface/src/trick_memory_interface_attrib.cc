@@ -29,6 +29,7 @@ Library Dependency:
 #include <cstddef>
 #include <cstring>
 #include <dlfcn.h>
+#include <mutex>
 
 // Trick includes
 #include "sim_services/MemoryManager/include/attributes.h"
@@ -47,7 +48,9 @@ Library Dependency:
 namespace jeod {
 
 /**
- * Find the attributes for a class in the symbol table.
+ * Find the attributes for a class in the symbol table. The result, found
+ * or not, is cached, so the symbol table is searched (and a missing type
+ * reported) once per type name.
  * @return Found attributes
  * \param[in] type_name Demangled type name
  */
@@ -56,6 +59,14 @@ JeodTrickMemoryInterface::find_attributes (
    const std::string & type_name)
 const
 {
+   std::lock_guard<std::mutex> lock (translation_mutex);
+
+   AttributesByName::const_iterator cached =
+      attributes_by_name.find (type_name);
+   if (cached != attributes_by_name.end()) {
+      return cached->second;
+   }
+
    std::string attr_name = "attr" + type_name;
    for (size_t idx = attr_name.find(':');
         idx < std::string::npos;
@@ -73,12 +84,16 @@ const
          type_name.c_str());
    }
 
-   return reinterpret_cast<ATTRIBUTES*> (symbol);
+   ATTRIBUTES * attr = reinterpret_cast<ATTRIBUTES*> (symbol);
+   attributes_by_name.insert (AttributesByName::value_type (type_name, attr));
+
+   return attr;
 }
 
 
 /**
- * Find the attributes for a class in the symbol table.
+ * Find the attributes for a class in the symbol table. The result is
+ * cached by type, which also spares demangling the type name.
  * @return Found attributes
  * \param[in] data_type Data type descriptor
  */
@@ -87,7 +102,21 @@ JeodTrickMemoryInterface::find_attributes (
    const std::type_info & data_type)
 const
 {
-   return find_attributes (NamedItem::demangle (data_type));
+   {
+      std::lock_guard<std::mutex> lock (translation_mutex);
+      AttributesByType::const_iterator cached =
+         attributes_by_type.find (&data_type);
+      if (cached != attributes_by_type.end()) {
+         return cached->second;
+      }
+   }
+
+   const ATTRIBUTES * attr = find_attributes (NamedItem::demangle (data_type));
+
+   std::lock_guard<std::mutex> lock (translation_mutex);
+   attributes_by_type.insert (AttributesByType::value_type (&data_type, attr));
+
+   return attr;
 }
 
 
@@ -18,6 +18,8 @@ Purpose:
 Library Dependency:
   ((trick_memory_interface_chkpnt.cc)
    (trick10_memory_interface.cc)
+   (checkpoint_section_codec.cc)
+   (utils/container/src/binary_checkpoint_block.cc)
    (utils/container/src/primitive_serializer.cc))
 
  
@@ -44,6 +46,7 @@ Library Dependency:
 extern Trick::MemoryManager * trick_MM;
 
 // JEOD includes
+#include "utils/container/include/binary_checkpoint_block.hh"
 #include "utils/container/include/checkpointable.hh"
 #include "utils/memory/include/memory_item.hh"
 #include "utils/memory/include/memory_manager.hh"
@@ -51,6 +54,8 @@ extern Trick::MemoryManager * trick_MM;
 #include "utils/message/include/message_handler.hh"
 
 // Model includes
+#include "../include/checkpoint_reconstructor.hh"
+#include "../include/checkpoint_section_codec.hh"
 #include "../include/sim_interface_messages.hh"
 #include "../include/simulation_interface.hh"
 #include "../include/trick10_memory_interface.hh"
@@ -243,6 +248,13 @@ void
 JeodTrick10MemoryInterface::checkpoint_containers (
    void)
 {
+   // Trick has written its part of the checkpoint by now. Undo the
+   // withholding of reconstructible contents done by checkpoint_allocations.
+   release_withheld_allocations ();
+
+   // Trick's view of memory may have changed since the last lookup.
+   clear_translation_cache ();
+
    SectionedOutputStream writer (
       JeodSimulationInterface::get_checkpoint_writer ("JEOD_containers"));
 
@@ -255,6 +267,7 @@ JeodTrick10MemoryInterface::checkpoint_containers (
    }
 
    // Checkpoint each of the containers.
+   std::string block;
    for (ContainerList::iterator iter = container_list.begin();
         iter != container_list.end();
         ++iter) {
@@ -271,15 +284,30 @@ JeodTrick10MemoryInterface::checkpoint_containers (
          writer << identifier << "." << init_action << "(" << value << ");\n";
       }
 
-      // Walk over the checkpointable, writing entries of the form
+      // Binary sections: Write checkpointables that support it as a single
+      //    identifier.binary_block(size);
+      // line followed by the size-byte raw block and a newline.
+      if (writer.writes_binary() &&
+          checkpointable.supports_binary_checkpoint()) {
+         checkpointable.write_binary_checkpoint (block);
+         writer << identifier << "."
+                << JeodBinaryCheckpointBlock::action_name
+                << "(" << block.size() << ");\n";
+         writer.write (block.data(), block.size());
+         writer << "\n";
+      }
+
+      // Otherwise walk over the checkpointable, writing entries of the form
       //    identifier.action(value)
       // to the checkpoint section until the checkpointable says it is done.
-      for (checkpointable.start_checkpoint();
-           !checkpointable.is_checkpoint_finished();
-           checkpointable.advance_checkpoint()) {
-         const std::string & action = checkpointable.get_item_name();
-         const std::string & value  = checkpointable.get_item_value();
-         writer << identifier << "." << action << "(" << value << ");\n";
+      else {
+         for (checkpointable.start_checkpoint();
+              !checkpointable.is_checkpoint_finished();
+              checkpointable.advance_checkpoint()) {
+            const std::string & action = checkpointable.get_item_name();
+            const std::string & value  = checkpointable.get_item_value();
+            writer << identifier << "." << action << "(" << value << ");\n";
+         }
       }
 
       // Add identifier.final_action() to the checkpoint section,
@@ -289,6 +317,10 @@ JeodTrick10MemoryInterface::checkpoint_containers (
          const std::string & value  = checkpointable.get_final_value();
          writer << identifier << "." << final_action << "(" << value << ");\n";
       }
+
+      // Each container is a record of a binary checkpoint, which lets an
+      // incremental checkpoint skip containers that did not change.
+      writer.end_record (identifier);
    }
 
    // Deactivate the writer.
@@ -319,10 +351,18 @@ JeodTrick10MemoryInterface::restore_containers (
    std::string ident;
    std::string action;
    std::string value;
+   std::string block;
 
    typedef std::map <const std::string, JeodCheckpointable *> ContainerMap;
    ContainerMap container_map;
 
+   // Refill the reconstructible allocations, whose contents the checkpoint
+   // does not hold, before any container looks at them.
+   restore_references ();
+
+   // Trick's view of memory may have changed since the last lookup.
+   clear_translation_cache ();
+
    // Create an entry in the container map for each valid entry in the
    // container list.
    for (ContainerList::iterator iter = container_list.begin();
@@ -394,12 +434,35 @@ JeodTrick10MemoryInterface::restore_containers (
             "Unable to find container for checkpoint file line '%s'\n"
             "Skipping processing of the line.",
             line.c_str());
+         // Skip the raw block as well; it is not line-structured.
+         if (action.compare (JeodBinaryCheckpointBlock::action_name) == 0) {
+            reader.ignore (std::strtoul (value.c_str(), nullptr, 10) + 1);
+         }
          continue;
       }
 
       // Object found: Have it perform the action.
+      // A binary_block action is followed by a raw block of the indicated
+      // size, which the object restores in one step.
       JeodCheckpointable * checkpointable = iter->second;
-      int status = checkpointable->perform_restore_action (action, value);
+      int status;
+      if (action.compare (JeodBinaryCheckpointBlock::action_name) == 0) {
+         std::size_t size = std::strtoul (value.c_str(), nullptr, 10);
+         block.resize (size);
+         if ((size > 0) && (! reader.read (&block[0], size))) {
+            MessageHandler::error (
+               __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+               "Truncated binary block for checkpoint file line '%s'",
+               line.c_str());
+            break;
+         }
+         reader.ignore (1);
+         status = checkpointable->restore_binary_checkpoint (
+                     block.data(), size);
+      }
+      else {
+         status = checkpointable->perform_restore_action (action, value);
+      }
 
       // Action failed: Report.
       if (status != 0) {
@@ -431,6 +494,9 @@ void
 JeodTrick10MemoryInterface::checkpoint_allocations (
    void)
 {
+   // Trick's view of memory may have changed since the last lookup.
+   clear_translation_cache ();
+
    std::stringstream sstream;
    SectionedOutputStream writer (
       JeodSimulationInterface::get_checkpoint_writer ("JEOD_allocations"));
@@ -490,6 +556,188 @@ JeodTrick10MemoryInterface::checkpoint_allocations (
       }
       // No else: Error has already been addressed.
    }
+
+   // Deactivate the writer so the references can be written.
+   writer.deactivate ();
+
+   checkpoint_references ();
+}
+
+
+/**
+ * Write the JEOD_references section, which records each reconstructible
+ * allocation's reference and a hash of its contents, and withhold the
+ * contents from Trick's part of the checkpoint by declaring each such
+ * allocation to Trick as its first element only. Pointers into the
+ * allocation that Trick checkpoints should therefore point to its start.
+ * The full declarations are restored by release_withheld_allocations,
+ * which runs as part of checkpoint_containers.
+ */
+void
+JeodTrick10MemoryInterface::checkpoint_references (
+   void)
+{
+   SectionedOutputStream writer (
+      JeodSimulationInterface::get_checkpoint_writer ("JEOD_references"));
+
+   // Activate the writer.
+   if (! writer.activate()) {
+      MessageHandler::error (
+         __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+         "Unable to create JEOD_references checkpoint writer.");
+      return;
+   }
+
+   // Lines are of the form "id_num hash size reference", with the hash in
+   // hexadecimal and the size in bytes.
+   for (ReconstructibleMap::iterator iter = reconstructible_map.begin();
+        iter != reconstructible_map.end();
+        ++iter) {
+      uint32_t unique_id = iter->first;
+      ReconstructibleEntry & entry = iter->second;
+      std::size_t size = entry.tdesc->buffer_size (entry.nelements);
+
+      writer << unique_id
+             << " " << std::hex
+             << CheckPointSectionCodec::hash (entry.addr, size)
+             << std::dec
+             << " " << size
+             << " " << entry.reference
+             << "\n";
+
+      if ((entry.nelements > 1) &&
+          (trick_MM->delete_extern_var (const_cast<void *> (entry.addr))
+           == 0) &&
+          declare_allocation (entry.addr, *entry.tdesc, unique_id, 1)) {
+         entry.withheld = true;
+      }
+   }
+
+   writer.deactivate ();
+
+   // The declarations changed.
+   clear_translation_cache ();
+}
+
+
+/**
+ * Declare the allocations withheld by checkpoint_references to Trick in
+ * full again.
+ */
+void
+JeodTrick10MemoryInterface::release_withheld_allocations (
+   void)
+{
+   for (ReconstructibleMap::iterator iter = reconstructible_map.begin();
+        iter != reconstructible_map.end();
+        ++iter) {
+      ReconstructibleEntry & entry = iter->second;
+      if (! entry.withheld) {
+         continue;
+      }
+      entry.withheld = false;
+
+      if ((trick_MM->delete_extern_var (const_cast<void *> (entry.addr))
+           != 0) ||
+          (! declare_allocation (
+                entry.addr, *entry.tdesc, iter->first, entry.nelements))) {
+         MessageHandler::error (
+            __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+            "Unable to redeclare reconstructible allocation %s.",
+            construct_identifier (iter->first).c_str());
+      }
+   }
+
+   clear_translation_cache ();
+}
+
+
+/**
+ * Refill the reconstructible allocations recorded in the JEOD_references
+ * section of the checkpoint file. Each allocation was recreated by
+ * restore_allocations; its reconstructor, found by the recorded reference,
+ * refills it, and the result is checked against the recorded hash. The
+ * allocation is then marked reconstructible anew.
+ */
+void
+JeodTrick10MemoryInterface::restore_references (
+   void)
+{
+   std::string line;
+
+   clear_translation_cache ();
+
+   SectionedInputStream reader (
+      JeodSimulationInterface::get_checkpoint_reader ("JEOD_references"));
+
+   // A checkpoint that predates the section has nothing to reconstruct.
+   if (! reader.activate()) {
+      return;
+   }
+
+   while (std::getline (reader, line)) {
+      // Skip blank lines.
+      if (line.length() == 0) {
+         continue;
+      }
+
+      std::istringstream fields (line);
+      uint32_t unique_id;
+      uint64_t hash;
+      std::size_t size;
+      std::string reference;
+      if (! (fields >> unique_id >> std::hex >> hash >> std::dec >> size)) {
+         MessageHandler::error (
+            __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+            "Badly formatted checkpoint file line '%s'\n"
+            "Skipping processing of the line.",
+            line.c_str());
+         continue;
+      }
+      fields >> std::ws;
+      std::getline (fields, reference);
+
+      void * addr = translate_name_to_addr (construct_identifier (unique_id));
+      ReconstructorMap::iterator found = reconstructor_map.find (reference);
+
+      if (addr == nullptr) {
+         MessageHandler::error (
+            __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+            "Reconstructible allocation %s for '%s' was not restored.",
+            construct_identifier (unique_id).c_str(), reference.c_str());
+         continue;
+      }
+
+      if (found == reconstructor_map.end()) {
+         MessageHandler::error (
+            __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+            "No reconstructor for '%s'; the contents of %s are not restored.",
+            reference.c_str(), construct_identifier (unique_id).c_str());
+         continue;
+      }
+
+      JeodCheckpointReconstructor & reconstructor = *found->second;
+      if (! reconstructor.reconstruct_contents (reference, addr, size)) {
+         MessageHandler::error (
+            __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+            "Reconstruction of %s from '%s' failed.",
+            construct_identifier (unique_id).c_str(), reference.c_str());
+         continue;
+      }
+
+      if (CheckPointSectionCodec::hash (addr, size) != hash) {
+         MessageHandler::warn (
+            __FILE__, __LINE__, SimInterfaceMessages::interface_error,
+            "Reconstructed %s does not match the checkpointed contents of "
+            "'%s'; the data source may have changed.",
+            construct_identifier (unique_id).c_str(), reference.c_str());
+      }
+
+      JeodMemoryManager::set_reconstructible (
+         addr, reference, reconstructor, __FILE__, __LINE__);
+   }
+
+   reader.deactivate ();
 }
 
 
@@ -502,14 +750,21 @@ JeodTrick10MemoryInterface::restore_allocations (
    JeodMemoryManager & memory_manager)
 {
    std::string line;
-   std::stringstream sstream;
    std::string mangled_type_name;
-   std::string ident_and_size;
+   std::size_t type_end;
+   std::size_t ident_pos;
    std::size_t semicolon_pos;
    std::size_t end_unique_id_pos;
-   uint32_t unique_id;
-   bool is_array;
-   uint32_t nelements;
+   JeodMemoryManager::RestartAllocation allocation;
+
+   // Allocations are gathered by type and restored one type at a time.
+   typedef std::map<std::string,
+                    std::vector<JeodMemoryManager::RestartAllocation> >
+      AllocationBatches;
+   AllocationBatches batches;
+
+   // Trick's view of memory may have changed since the last lookup.
+   clear_translation_cache ();
 
 
    SectionedInputStream reader (
@@ -546,21 +801,24 @@ JeodTrick10MemoryInterface::restore_allocations (
          continue;
       }
 
-      // Split the line into two words, the mangled type name and the rest.
-      sstream.clear ();
-      sstream.str (line);
-      sstream >> mangled_type_name >> ident_and_size;
-
-      // ident_and_size should be comprise
+      // Split the line into two words, the mangled type name and the rest,
+      // which should comprise
       // - A sequence of digits
       // - An optional size spec of the form "[<digits>]"
       // - A terminating semicolon
-      end_unique_id_pos = ident_and_size.find_first_not_of ("0123456789");
-      semicolon_pos = ident_and_size.find (';');
+      type_end = line.find (' ');
+      ident_pos = line.find_first_not_of (' ', type_end);
+      semicolon_pos = line.find (';', ident_pos);
+      end_unique_id_pos =
+         line.find_first_not_of ("0123456789", ident_pos);
 
       // Sanity check: Make sure we have something close to the above form.
-      if ((end_unique_id_pos == 0) ||
-          (semicolon_pos != ident_and_size.length() - 1)) {
+      if ((type_end == 0) ||
+          (ident_pos == std::string::npos) ||
+          (semicolon_pos == std::string::npos) ||
+          (end_unique_id_pos == ident_pos) ||
+          ((semicolon_pos + 1 < line.length()) &&
+           (line[semicolon_pos + 1] != ' '))) {
          MessageHandler::error (
             __FILE__, __LINE__, SimInterfaceMessages::interface_error,
             "Badly formatted checkpoint file line '%s'\n"
@@ -570,20 +828,19 @@ JeodTrick10MemoryInterface::restore_allocations (
       }
 
       // Convert the identifier string to a number.
-      sstream.clear ();
-      sstream.str (ident_and_size);
-      sstream >> unique_id;
+      allocation.unique_id = static_cast<uint32_t> (
+         std::strtoul (line.c_str() + ident_pos, nullptr, 10));
 
       // String is all digits: We have an object rather than an array.
       if (end_unique_id_pos == semicolon_pos) {
-         nelements = 1;
-         is_array = false;
+         allocation.nelements = 1;
+         allocation.is_array = false;
       }
 
       // Not all digits: The post-identifier should be of the form "[size]".
       else {
-         if ((ident_and_size[end_unique_id_pos] != '[') ||
-             (ident_and_size[ident_and_size.length()-2] != ']')) {
+         if ((line[end_unique_id_pos] != '[') ||
+             (line[semicolon_pos-1] != ']')) {
             MessageHandler::error (
                __FILE__, __LINE__, SimInterfaceMessages::interface_error,
                "Badly formatted checkpoint file line '%s'\n"
@@ -593,15 +850,21 @@ JeodTrick10MemoryInterface::restore_allocations (
          }
 
          // Form is good. Extract the array dimension.
-         sstream.clear ();
-         sstream.str (ident_and_size.substr(end_unique_id_pos+1));
-         sstream >> nelements;
-         is_array = true;
+         allocation.nelements = static_cast<uint32_t> (
+            std::strtoul (line.c_str() + end_unique_id_pos + 1, nullptr, 10));
+         allocation.is_array = true;
       }
 
-      // Restore the allocation.
-      memory_manager.restart_reallocate (
-         mangled_type_name, unique_id, nelements, is_array);
+      // Add the allocation to its type's batch.
+      mangled_type_name.assign (line, 0, type_end);
+      batches[mangled_type_name].push_back (allocation);
+   }
+
+   // Restore the allocations.
+   for (AllocationBatches::const_iterator iter = batches.begin();
+        iter != batches.end();
+        ++iter) {
+      memory_manager.restart_reallocate (iter->first, iter->second);
    }
 }
 
@@ -28,6 +28,7 @@ Library Dependency:
 // System includes
 #include <cstddef>
 #include <cstdlib>
+#include <mutex>
 #include <string>
 
 // Trick includes
@@ -80,6 +81,7 @@ JeodTrick10MemoryInterface::get_trick_checkpoint_file (
 
 /**
  * Get the simulation name, if any, associated with the address.
+ * Translations are cached by address until the set of allocations changes.
  * @return Name of the address, if any
  * \param[in] addr Address of memory whose name is to be found
  * \param[in] tdesc How to interpret address
@@ -100,6 +102,17 @@ const
 
    else {
 
+      // Use the cached translation if the address was translated with the
+      // same attributes.
+      {
+         std::lock_guard<std::mutex> lock (translation_mutex);
+         NameByAddress::const_iterator cached = name_by_address.find (addr);
+         if ((cached != name_by_address.end()) &&
+             (cached->second.attr == &item_attr)) {
+            return cached->second.name;
+         }
+      }
+
       // Interpret the address as a pointer to the specified type.
       result = translate_addr_to_name (addr, &item_attr);
 
@@ -109,6 +122,11 @@ const
          // FIXME: Error message.
          result = "";
       }
+
+      std::lock_guard<std::mutex> lock (translation_mutex);
+      AddressName & entry = name_by_address[addr];
+      entry.attr = &item_attr;
+      entry.name = result;
    }
 
    return result;
@@ -189,6 +207,7 @@ const
 /**
 Translate the given address specification string to an address.
 This is the inverse of translate_addr_to_name.
+Successful translations are cached until the set of allocations changes.
 @param spec The address specification to be interpreted.
 @return    Address corresponding to the address specification.
 */
@@ -197,6 +216,14 @@ JeodTrick10MemoryInterface::translate_name_to_addr (
    const std::string & spec)
 const
 {
+   {
+      std::lock_guard<std::mutex> lock (translation_mutex);
+      AddressByName::const_iterator cached = address_by_name.find (spec);
+      if (cached != address_by_name.end()) {
+         return cached->second;
+      }
+   }
+
    std::string name(spec);
    void * result;
    std::size_t position;
@@ -252,6 +279,9 @@ const
             result = static_cast<void*> (
                         static_cast<char*> (ref->address) + offset);
 
+            std::lock_guard<std::mutex> lock (translation_mutex);
+            address_by_name[spec] = result;
+
             // Clean up the REFidue before returning the result.
             std::free (ref->reference);
             std::free (ref->units);
@@ -23,6 +23,7 @@ Assumptions and limitations:
 
 Library dependencies:
   ((trick_message_handler.cc)
+   (utils/message/src/async_message_sink.cc)
    (utils/message/src/message_handler.cc))
 
  
@@ -55,6 +56,16 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+/**
+ * Destructor. Delivers any messages still queued in the asynchronous sink.
+ */
+TrickMessageHandler::~TrickMessageHandler (
+   void)
+{
+   async_sink.stop ();
+}
+
+
 /**
  * Register the TrickMessageHandler's checkpointable contents.
  */
@@ -67,6 +78,40 @@ TrickMessageHandler::register_contents (
 }
 
 
+/**
+ * Turn asynchronous message output on or off.
+ * When on, non-fatal messages are formatted on the calling thread and
+ * written by the sink's output thread, which also rate-limits each message
+ * code. Turning it off delivers everything already queued.
+ * \param[in] asynchronous True to write messages from the output thread
+ */
+void
+TrickMessageHandler::set_asynchronous (
+   bool asynchronous)
+{
+   if (asynchronous) {
+      async_sink.start (deliver_message, this);
+   }
+   else {
+      async_sink.stop ();
+   }
+}
+
+
+/**
+ * Write a message taken from the asynchronous sink.
+ * \param[in] handler The TrickMessageHandler (unused)
+ * \param[in] text Formatted message
+ */
+void
+TrickMessageHandler::deliver_message (
+   void * handler JEOD_UNUSED,
+   const char * text)
+{
+   send_hs (stderr, const_cast<char*>("%s"), text);
+}
+
+
 /**
  * Handle a message.
  * All calls to the message-generating MessageHandler methods eventually result
@@ -93,6 +138,13 @@ TrickMessageHandler::process_message (
    va_list args)
 const
 {
+   // Low-level messages (high severity number) can be suppressed via the
+   // user-controllable suppression_level or by the suppressed code mechanism.
+   // Suppressed messages are dropped before the message is formatted.
+   if (! message_is_to_be_printed (severity, msg_code)) {
+      return;
+   }
+
    int buffer_length = MAX_MSG_SIZE-strlen(prefix)-strlen(msg_code);
    char buffer[buffer_length];
 
@@ -109,17 +161,16 @@ const
                "%s %s:\n%s\n",
                prefix, msg_code, buffer);
 
+      // ... flush the messages queued ahead of it ...
+      const_cast<AsyncMessageSink &>(async_sink).stop ();
+
       // ... and terminate the simulation.
       exec_terminate_with_return (1, file, line, message);
    }
 
    // Messages with non-negative severity are not fatal.
-   // Low-level messages (high severity number) can be suppressed via the
-   // user-controllable suppression_level or by the suppressed code mechanism.
-   // Generate a message only if is not suppressed.
-   else if ((severity == 0) ||
-            ((suppressed_codes.find (msg_code) == suppressed_codes.end()) &&
-             (static_cast<unsigned int>(severity) <= suppression_level))) {
+   else {
+      char message[MAX_MSG_SIZE];
 
       // *Safely* generate the location information.
       char where[256];
@@ -132,36 +183,37 @@ const
 
       // Suppress both: Just print the message.
       if (suppress_id && suppress_location) {
-         send_hs (stderr,
-                  const_cast<char*>("\n%s\n"),
-                  buffer);
+         std::snprintf (message, sizeof(message),
+                        "\n%s\n",
+                        buffer);
       }
 
       // Suppress ID but not location: Print location and message.
       else if (suppress_id && (! suppress_location)) {
-         send_hs (stderr,
-                  const_cast<char*>("\n%s\n%s\n"),
-                  where, buffer);
+         std::snprintf (message, sizeof(message),
+                        "\n%s\n%s\n",
+                        where, buffer);
       }
 
       // Suppress location but not ID: Print ID and message.
       else if ((! suppress_id) && suppress_location) {
-         send_hs (stderr,
-                  const_cast<char*>("\n%s %s:\n%s\n"),
-                  prefix, msg_code, buffer);
+         std::snprintf (message, sizeof(message),
+                        "\n%s %s:\n%s\n",
+                        prefix, msg_code, buffer);
       }
 
       // Suppress neither: Generate a full report.
       else {
-         send_hs (stderr,
-                  const_cast<char*>("\n%s %s at %s:\n%s\n"),
-                  prefix, msg_code, where, buffer);
+         std::snprintf (message, sizeof(message),
+                        "\n%s %s at %s:\n%s\n",
+                        prefix, msg_code, where, buffer);
       }
 
-   }
-
-   // Empty else (message is suppressed).
-   else {
+      // Hand the message to the asynchronous sink if it is running;
+      // otherwise (or if the sink cannot take it) write it now.
+      if (! async_sink.post (msg_code, message)) {
+         send_hs (stderr, const_cast<char*>("%s"), message);
+      }
    }
 }
 
@@ -19,6 +19,7 @@ Library dependencies:
   ((trick_sim_interface.cc)
    (checkpoint_input_manager.cc)
    (checkpoint_output_manager.cc)
+   (checkpoint_section_codec.cc)
    (sim_interface_messages.cc)
    (simulation_interface.cc)
    (trick_memory_interface.cc)
@@ -66,10 +67,17 @@ BasicJeodTrickSimInterface::BasicJeodTrickSimInterface (
    trick_memory_interface(),
    memory_manager(trick_memory_interface),
    checkpoint_file_name(),
+   checkpoint_binary(false),
+   checkpoint_incremental(false),
+   checkpoint_compress(false),
+   checkpoint_full_interval(0),
+   checkpoint_history(),
+   checkpoint_asynchronous(false),
    section_start(),
    section_end(),
    checkpoint_reader(nullptr),
-   checkpoint_writer(nullptr)
+   checkpoint_writer(nullptr),
+   background_checkpoint_writer(nullptr)
 {
 
    // Tell the message handler to register its checkpointable content, which it
@@ -102,6 +110,7 @@ BasicJeodTrickSimInterface::~BasicJeodTrickSimInterface (
    checkpoint_reader = nullptr;
    delete checkpoint_writer;
    checkpoint_writer = nullptr;
+   finish_background_checkpoint ();
 }
 
 
@@ -176,6 +185,10 @@ BasicJeodTrickSimInterface::open_checkpoint_file (
       return;
    }
 
+   // The previous checkpoint must be complete: it updates the record history
+   // and may even be writing the same file.
+   finish_background_checkpoint ();
+
    if (checkpoint_file_name.empty()) {
       output_file_name =
          trick_memory_interface.get_trick_checkpoint_file (true);
@@ -198,6 +211,24 @@ BasicJeodTrickSimInterface::open_checkpoint_file (
 
    checkpoint_writer = new CheckPointOutputManager (
       output_file_name, section_start, section_end);
+   if (checkpoint_asynchronous) {
+      checkpoint_writer->enable_asynchronous_write ();
+   }
+
+   // Records stored in a file of this name are about to be overwritten.
+   if (checkpoint_binary && checkpoint_incremental) {
+      checkpoint_history.start_checkpoint (
+         output_file_name, checkpoint_full_interval);
+      checkpoint_writer->enable_binary_format (
+         checkpoint_compress, &checkpoint_history);
+   }
+   else {
+      checkpoint_history.forget_file (output_file_name);
+      if (checkpoint_binary) {
+         checkpoint_writer->enable_binary_format (
+            checkpoint_compress, nullptr);
+      }
+   }
 }
 
 
@@ -229,11 +260,36 @@ void
 BasicJeodTrickSimInterface::close_checkpoint_file (
    void)
 {
-   delete checkpoint_writer;
+   // Asynchronous checkpoints: Hand the collected sections to a background
+   // thread. The writer is deleted once that thread is finished.
+   if ((checkpoint_writer != nullptr) &&
+       checkpoint_writer->is_asynchronous() &&
+       checkpoint_writer->start_background_write()) {
+      background_checkpoint_writer = checkpoint_writer;
+   }
+   else {
+      delete checkpoint_writer;
+   }
    checkpoint_writer = nullptr;
 }
 
 
+/**
+ * Wait for the checkpoint file being written in the background, if any,
+ * and release the object that wrote it.
+ */
+void
+BasicJeodTrickSimInterface::finish_background_checkpoint (
+   void)
+{
+   if (background_checkpoint_writer != nullptr) {
+      background_checkpoint_writer->wait_for_background_write ();
+      delete background_checkpoint_writer;
+      background_checkpoint_writer = nullptr;
+   }
+}
+
+
 /**
  * Open the checkpoint input file.
  */
@@ -247,6 +303,9 @@ BasicJeodTrickSimInterface::open_restart_file (
       return;
    }
 
+   // The file to be read may still be being written.
+   finish_background_checkpoint ();
+
    if (checkpoint_file_name.empty()) {
       input_file_name =
          trick_memory_interface.get_trick_checkpoint_file (false);
@@ -0,0 +1,332 @@
+/*
+ * Exercise the CheckPointSectionCodec compressor and record decoder.
+ *
+ * The compressor is checked by round-tripping empty, short, incompressible,
+ * highly repetitive and checkpoint-like inputs, and a hand-built token stream
+ * checks that back-references which overlap the bytes they produce are
+ * expanded byte by byte. Truncated and corrupted compressed streams, and
+ * truncated and corrupted section payloads, must be rejected.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "utils/sim_interface/include/checkpoint_section_codec.hh"
+
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace jeod;
+
+
+typedef CheckPointSectionCodec Codec;
+
+unsigned int num_failures = 0;
+TestSimInterface sim_interface;
+
+
+/*
+ * Report a failed check.
+ */
+void
+check (
+   bool ok,
+   const char * what,
+   std::size_t where)
+{
+   if (! ok) {
+      ++num_failures;
+      if (num_failures <= 20) {
+         std::printf ("FAILED: %s at %lu\n", what,
+                      static_cast<unsigned long> (where));
+      }
+   }
+}
+
+
+/*
+ * Deterministic pseudo-random bytes (a 64 bit LCG).
+ */
+std::string
+random_bytes (
+   std::size_t size,
+   uint64_t seed)
+{
+   std::string bytes;
+   uint64_t state = seed;
+   for (std::size_t ii = 0; ii < size; ++ii) {
+      state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+      bytes += static_cast<char> (state >> 56);
+   }
+   return bytes;
+}
+
+
+/*
+ * Text resembling the body of a checkpoint section.
+ */
+std::string
+checkpoint_text (
+   unsigned int nlines)
+{
+   std::string text;
+   char line[128];
+   for (unsigned int ii = 0; ii < nlines; ++ii) {
+      std::snprintf (line, sizeof(line),
+                     "sv_dyn.dyn_body.composite_body.state.trans.position[%u] = %u.%03u;\n",
+                     ii % 3, ii * 7919, ii % 1000);
+      text += line;
+   }
+   return text;
+}
+
+
+/*
+ * Compress and decompress an input, checking the round trip and that every
+ * truncation of the compressed stream and every wrong output size is
+ * rejected. Returns the compressed size.
+ */
+std::size_t
+round_trip (
+   const std::string & input,
+   const char * what)
+{
+   std::string packed;
+   std::string unpacked;
+   Codec::compress (input, packed);
+
+   check (Codec::decompress (packed.data(), packed.size(), input.size(),
+                             unpacked) &&
+          (unpacked == input),
+          what, input.size());
+
+   for (std::size_t len = 0; len < packed.size(); ++len) {
+      check (! Codec::decompress (packed.data(), len, input.size(), unpacked),
+             "truncated stream accepted", len);
+   }
+
+   check (! Codec::decompress (packed.data(), packed.size(), input.size() + 1,
+                               unpacked),
+          "short output accepted", input.size());
+   if (! input.empty()) {
+      check (! Codec::decompress (packed.data(), packed.size(),
+                                  input.size() - 1, unpacked),
+             "long output accepted", input.size());
+   }
+
+   return packed.size();
+}
+
+
+/*
+ * Round trips of representative inputs.
+ */
+void
+test_round_trips (
+   void)
+{
+   check (round_trip ("", "empty") == 0, "empty compresses to nothing", 0);
+   round_trip ("a", "one byte");
+   round_trip ("abcd", "minimum match length");
+   round_trip ("abcdabcd", "one back-reference");
+
+   std::string noise = random_bytes (20000, 1);
+   std::size_t noise_size = round_trip (noise, "incompressible");
+   check (noise_size <= noise.size() + 8, "incompressible growth", noise_size);
+
+   // A run of one byte is coded as a literal and a back-reference whose
+   // offset is shorter than its length.
+   std::string run (10000, 'x');
+   check (round_trip (run, "single byte run") < 16, "run compression", 0);
+
+   std::string period3;
+   for (unsigned int ii = 0; ii < 3000; ++ii) {
+      period3 += "abc";
+   }
+   check (round_trip (period3, "period three") < 16, "period compression", 0);
+
+   std::string text = checkpoint_text (2000);
+   check (round_trip (text, "checkpoint text") < text.size() / 2,
+          "text compression", text.size());
+
+   // Repetitive text interrupted by noise, and noise repeated at a distance.
+   std::string mixed = text.substr (0, 5000) + random_bytes (3000, 2) +
+                       text.substr (0, 5000) + random_bytes (3000, 2);
+   round_trip (mixed, "mixed");
+}
+
+
+/*
+ * Hand-built token streams.
+ */
+void
+test_streams (
+   void)
+{
+   std::string output;
+
+   // Literal "ab" (token 2*2), then a match of length 6 at offset 2
+   // (token (6-4)*2+1); the match reads bytes it writes.
+   const char overlap[] = {4, 'a', 'b', 5, 2};
+   check (Codec::decompress (overlap, sizeof(overlap), 8, output) &&
+          (output == "abababab"),
+          "overlapping match", 0);
+
+   // Offset 1 repeats the last byte.
+   const char repeat[] = {2, 'z', 9, 1};
+   check (Codec::decompress (repeat, sizeof(repeat), 9, output) &&
+          (output == std::string (9, 'z')),
+          "offset one match", 0);
+
+   // Empty stream, empty output.
+   check (Codec::decompress (overlap, 0, 0, output) && output.empty(),
+          "empty stream", 0);
+
+   // Corrupt streams.
+   const char zero_offset[] = {4, 'a', 'b', 5, 0};
+   check (! Codec::decompress (zero_offset, sizeof(zero_offset), 8, output),
+          "zero offset accepted", 0);
+
+   const char far_offset[] = {4, 'a', 'b', 5, 3};
+   check (! Codec::decompress (far_offset, sizeof(far_offset), 8, output),
+          "offset before start accepted", 0);
+
+   const char leading_match[] = {1, 1};
+   check (! Codec::decompress (leading_match, sizeof(leading_match), 4, output),
+          "match without history accepted", 0);
+
+   const char long_literal[] = {8, 'a', 'b'};
+   check (! Codec::decompress (long_literal, sizeof(long_literal), 4, output),
+          "literal past end of input accepted", 0);
+
+   check (! Codec::decompress (overlap, sizeof(overlap), 5, output),
+          "match past end of output accepted", 0);
+
+   const char open_varint[] = {static_cast<char> (0x80)};
+   check (! Codec::decompress (open_varint, sizeof(open_varint), 0, output),
+          "unterminated varint accepted", 0);
+}
+
+
+/*
+ * Encode a payload, decode it, and check that truncations and corruptions
+ * of it are rejected.
+ */
+void
+test_records (
+   void)
+{
+   std::string text = checkpoint_text (200);
+   std::string noise = random_bytes (500, 3);
+
+   // Record boundaries, for the truncation checks.
+   std::vector<std::size_t> ends;
+   std::string payload;
+   Codec::encode_data_record ("text", Codec::hash (text), text, true, payload);
+   ends.push_back (payload.size());
+   Codec::encode_data_record ("noise", Codec::hash (noise), noise, true,
+                              payload);
+   ends.push_back (payload.size());
+   Codec::encode_data_record ("raw", Codec::hash (text), text, false, payload);
+   ends.push_back (payload.size());
+   Codec::encode_data_record ("empty", Codec::hash (""), "", true, payload);
+   ends.push_back (payload.size());
+   Codec::encode_reference_record ("ref", Codec::hash (text), "chkpnt_1.0",
+                                   payload);
+   ends.push_back (payload.size());
+
+   std::vector<Codec::Record> records;
+   bool ok = Codec::decode_records (payload, records) && (records.size() == 5);
+   check (ok, "decode", payload.size());
+   if (ok) {
+      check ((records[0].key == "text") && (records[0].value == text) &&
+             (! records[0].is_reference),
+             "compressed record", 0);
+      check ((records[1].key == "noise") && (records[1].value == noise),
+             "incompressible record", 1);
+      check ((records[2].key == "raw") && (records[2].value == text),
+             "raw record", 2);
+      check ((records[3].key == "empty") && records[3].value.empty(),
+             "empty record", 3);
+      check ((records[4].key == "ref") && records[4].is_reference &&
+             (records[4].value == "chkpnt_1.0") &&
+             (records[4].hash == Codec::hash (text)),
+             "reference record", 4);
+   }
+
+   check (Codec::decode_records ("", records) && records.empty(),
+          "empty payload", 0);
+
+   // A truncated payload is rejected unless it ends on a record boundary,
+   // in which case it holds the records before the boundary.
+   std::size_t nwhole = 0;
+   for (std::size_t len = 1; len < payload.size(); ++len) {
+      bool decoded = Codec::decode_records (payload.data(), len, records);
+      if ((nwhole < ends.size()) && (len == ends[nwhole])) {
+         ++nwhole;
+         check (decoded && (records.size() == nwhole),
+                "truncation at record boundary", len);
+      }
+      else {
+         check (! decoded, "truncated payload accepted", len);
+      }
+   }
+
+   // A change to a data record after its key, whether it hits the hash, the
+   // encoding, the sizes or the content, is rejected unless the record still
+   // decodes to the same content. (An offset that moves a back-reference to
+   // an identical stretch of text is harmless, for example.)
+   std::vector<Codec::Record> expected;
+   Codec::decode_records (payload.data(), ends[3], expected);
+   for (std::size_t rec = 0; rec < 4; ++rec) {
+      std::size_t begin = (rec == 0) ? 0 : ends[rec-1];
+      std::size_t key_len = static_cast<unsigned char> (payload[begin + 1]);
+      for (std::size_t pos = begin + 2 + key_len; pos < ends[rec]; ++pos) {
+         for (unsigned int bit = 0; bit < 8; ++bit) {
+            std::string bad = payload.substr (0, ends[3]);
+            bad[pos] = static_cast<char> (bad[pos] ^ (1 << bit));
+            bool unchanged = Codec::decode_records (bad, records) &&
+                             (records.size() == expected.size());
+            for (std::size_t ii = 0; unchanged && (ii < records.size()); ++ii) {
+               unchanged = (records[ii].key == expected[ii].key) &&
+                           (records[ii].hash == expected[ii].hash) &&
+                           (records[ii].value == expected[ii].value);
+            }
+            check (unchanged || ! Codec::decode_records (bad, records),
+                   "corrupted payload accepted", pos);
+         }
+      }
+   }
+
+   // Unknown record kinds are rejected.
+   std::string bad_kind = payload;
+   bad_kind[0] = 'X';
+   check (! Codec::decode_records (bad_kind, records), "unknown kind", 0);
+
+   // A record whose hash does not match its content is rejected.
+   std::string bad_hash;
+   Codec::encode_data_record ("text", Codec::hash (noise), text, true,
+                              bad_hash);
+   check (! Codec::decode_records (bad_hash, records), "hash mismatch", 0);
+}
+
+
+int
+main (
+   void)
+{
+   // FNV-1a reference values.
+   check (Codec::hash ("") == UINT64_C(0xcbf29ce484222325), "hash of \"\"", 0);
+   check (Codec::hash ("a") == UINT64_C(0xaf63dc4c8601ec8c), "hash of \"a\"", 0);
+
+   test_round_trips ();
+   test_streams ();
+   test_records ();
+
+   bool passed = (num_failures == 0);
+   std::printf ("Test %s (%u failed checks)\n",
+                (passed ? "passed" : "failed"), num_failures);
+
+   return passed ? 0 : 1;
+}
@@ -0,0 +1,349 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StateLogger
+ * @{
+ *
+ * @file models/utils/state_logger/include/state_logger.hh
+ * Define the class StateLogger, which streams the states of reference
+ * frames, bodies and derived states to a binary columnar log file.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Values are written in the host's native byte order.)
+   (Sources are sampled by address; they must outlive the logger or
+    logging must be finished before they are destroyed.)
+   (record and finish must be called from one thread.))
+
+Library dependencies:
+  ((../src/state_logger.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_STATE_LOGGER_HH
+#define JEOD_STATE_LOGGER_HH
+
+// System includes
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+class RefFrame;
+class RefFrameState;
+class RelativeDerivedState;
+
+
+/**
+ * A StateLogger samples a set of double-valued columns each time record is
+ * called and streams them to a binary log file.
+ *
+ * Samples are collected in chunks of chunk_rows rows. Each chunk is stored
+ * column by column (all times, then all values of the first column, ...)
+ * and is optionally compressed. Two chunk buffers are used: while the
+ * simulation fills one, a background thread compresses and writes the
+ * other, so the simulation thread only copies values. The simulation waits
+ * only when it fills a chunk before the writer has finished the previous
+ * one.
+ *
+ * The file starts with the header
+ *   - the eight characters "JEODSLOG",
+ *   - uint32 format version and uint32 number of columns (including time),
+ *   - for each column, a uint32 name length and the name.
+ *
+ * Each chunk is
+ *   - the four characters "JSLC",
+ *   - uint32 number of rows and uint32 flags (1 = compressed),
+ *   - uint64 uncompressed size and uint64 stored size of the payload,
+ *   - the payload: rows doubles per column, columns in header order.
+ *
+ * A compressed payload is transformed before it is compressed with
+ * CheckPointSectionCodec::compress: within each column, each value's bits
+ * are replaced by their exclusive or with the previous row's bits, and the
+ * bytes of the column are then regrouped by byte position (all first
+ * bytes, then all second bytes, ...). Slowly varying states then compress
+ * well.
+ */
+class StateLogger {
+JEOD_MAKE_SIM_INTERFACES(StateLogger)
+
+public:
+
+   // Static data
+
+   /**
+    * Magic characters that start a state log file.
+    */
+   static const char * file_magic; //!< trick_io(**)
+
+   /**
+    * Magic characters that start a chunk.
+    */
+   static const char * chunk_magic; //!< trick_io(**)
+
+   /**
+    * File format version.
+    */
+   static const unsigned int format_version = 1; //!< trick_io(**)
+
+
+   // Member data
+
+   /**
+    * Name of the log file.
+    */
+   std::string file_name; //!< trick_units(--)
+
+   /**
+    * Record every decimation'th call to record; 0 and 1 record every call.
+    */
+   unsigned int decimation; //!< trick_units(count)
+
+   /**
+    * Number of rows in a chunk.
+    */
+   unsigned int chunk_rows; //!< trick_units(count)
+
+   /**
+    * Compress the chunks.
+    */
+   bool compress; //!< trick_units(--)
+
+
+   // Constructor and destructor.
+   StateLogger ();
+   ~StateLogger ();
+
+   // Log a reference frame state as 13 columns: position, velocity,
+   // the parent-to-frame quaternion and the angular velocity.
+   void add_ref_frame_state (
+      const std::string & source_name,
+      const RefFrameState & state);
+
+   // Log the state of a reference frame.
+   void add_ref_frame (const RefFrame & frame);
+
+   // Log the composite body state of a DynBody.
+   void add_dyn_body (const DynBody & body);
+
+   // Log the relative state computed by a RelativeDerivedState.
+   void add_relative_state (const RelativeDerivedState & derived_state);
+
+   // Log an array of doubles, such as a derived state's outputs.
+   void add_values (
+      const std::string & source_name,
+      const double * values,
+      unsigned int count);
+
+   // Open the log file and start the writer thread.
+   void start ();
+
+   // Sample the columns, subject to decimation.
+   void record (double time);
+
+   // Write the remaining samples, stop the writer and close the file.
+   void finish ();
+
+   // Number of columns, including time.
+   unsigned int get_num_columns () const;
+
+   // Name of a column.
+   const std::string & get_column_name (unsigned int index) const;
+
+   // Number of rows recorded.
+   uint64_t get_rows_recorded () const;
+
+   // Number of chunks written.
+   uint64_t get_chunks_written () const;
+
+
+private:
+
+   // Add a column.
+   void add_column (const std::string & name, const double * value);
+
+   // Hand the active buffer to the writer.
+   void hand_off ();
+
+   // Writer thread main loop.
+   void writer_loop ();
+
+   // Write one chunk; called by the writer thread.
+   bool write_chunk (const double * buffer, unsigned int rows);
+
+   // Write the file header.
+   bool write_header ();
+
+
+   /**
+    * Column names; the first is the time column.
+    */
+   std::vector<std::string> column_names; //!< trick_io(**)
+
+   /**
+    * Addresses of the sampled values, one per column after time.
+    */
+   std::vector<const double *> column_values; //!< trick_io(**)
+
+   /**
+    * The two chunk buffers, each chunk_rows rows by the number of columns,
+    * stored column by column.
+    */
+   std::vector<double> buffers[2]; //!< trick_io(**)
+
+   /**
+    * Index of the buffer being filled by record.
+    */
+   unsigned int active; //!< trick_io(**)
+
+   /**
+    * Number of rows in the active buffer.
+    */
+   unsigned int fill_rows; //!< trick_io(**)
+
+   /**
+    * Number of calls to record, used for decimation.
+    */
+   uint64_t record_calls; //!< trick_io(**)
+
+   /**
+    * Number of rows recorded.
+    */
+   uint64_t rows_recorded; //!< trick_io(**)
+
+   /**
+    * Number of chunks written.
+    */
+   uint64_t chunks_written; //!< trick_io(**)
+
+   /**
+    * The log file.
+    */
+   std::FILE * file; //!< trick_io(**)
+
+   /**
+    * Set between start and finish.
+    */
+   bool started; //!< trick_io(**)
+
+   /**
+    * The writer thread.
+    */
+   std::thread writer; //!< trick_io(**)
+
+   /**
+    * Guards the members below.
+    */
+   std::mutex mutex; //!< trick_io(**)
+
+   /**
+    * Signals the writer that a buffer (or shutdown) is available.
+    */
+   std::condition_variable work_cond; //!< trick_io(**)
+
+   /**
+    * Signals record that the writer has released its buffer.
+    */
+   std::condition_variable done_cond; //!< trick_io(**)
+
+   /**
+    * Set while the writer owns the inactive buffer.
+    */
+   bool pending; //!< trick_io(**)
+
+   /**
+    * Number of rows in the buffer owned by the writer.
+    */
+   unsigned int pending_rows; //!< trick_io(**)
+
+   /**
+    * Set when a write fails; further chunks are dropped.
+    */
+   bool write_failed; //!< trick_io(**)
+
+   /**
+    * Set to tell the writer to exit.
+    */
+   bool shutdown; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   StateLogger (const StateLogger &);
+
+   /**
+    * Not implemented.
+    */
+   StateLogger & operator= (const StateLogger &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,581 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StateLogger
+ * @{
+ *
+ * @file models/utils/state_logger/src/state_logger.cc
+ * Define member functions for the class StateLogger.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((state_logger.cc)
+   (state_logger_messages.cc)
+   (utils/sim_interface/src/checkpoint_section_codec.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/derived_state/include/relative_derived_state.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+#include "utils/sim_interface/include/checkpoint_section_codec.hh"
+
+// Model includes
+#include "../include/state_logger.hh"
+#include "../include/state_logger_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+namespace {
+
+/**
+ * Append the bytes of a value to a byte string.
+ * \param[in] value Value to be appended
+ * \param[in,out] output Byte string
+ */
+template <typename ValueType>
+void
+put_value (
+   ValueType value,
+   std::string & output)
+{
+   output.append (reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+
+/**
+ * Transform a column for compression: replace each value's bits by their
+ * exclusive or with the previous value's bits, then group the bytes by
+ * byte position.
+ * \param[in] column Column values
+ * \param[in] rows Number of values
+ * \param[out] output Transformed bytes, 8*rows of them
+ */
+void
+shuffle_column (
+   const double * column,
+   unsigned int rows,
+   char * output)
+{
+   uint64_t prev = 0;
+
+   for (unsigned int ii = 0; ii < rows; ++ii) {
+      uint64_t bits;
+      std::memcpy (&bits, &column[ii], sizeof(bits));
+      uint64_t delta = bits ^ prev;
+      prev = bits;
+      for (unsigned int bb = 0; bb < sizeof(bits); ++bb) {
+         output[bb*rows + ii] = static_cast<char>((delta >> (8*bb)) & 0xff);
+      }
+   }
+}
+
+}
+
+
+const char * StateLogger::file_magic = "JEODSLOG";
+const char * StateLogger::chunk_magic = "JSLC";
+const unsigned int StateLogger::format_version;
+
+
+/**
+ * StateLogger default constructor.
+ */
+StateLogger::StateLogger ()
+:
+   file_name(),
+   decimation(1),
+   chunk_rows(1024),
+   compress(false),
+   column_names(1, "time"),
+   column_values(),
+   active(0),
+   fill_rows(0),
+   record_calls(0),
+   rows_recorded(0),
+   chunks_written(0),
+   file(nullptr),
+   started(false),
+   writer(),
+   mutex(),
+   work_cond(),
+   done_cond(),
+   pending(false),
+   pending_rows(0),
+   write_failed(false),
+   shutdown(false)
+{
+   ; // Empty
+}
+
+
+/**
+ * StateLogger destructor. Finishes the log if it is still open.
+ */
+StateLogger::~StateLogger ()
+{
+   finish ();
+}
+
+
+/**
+ * Add a column. Columns can only be added before logging starts.
+ * \param[in] name Column name
+ * \param[in] value Address of the sampled value
+ */
+void
+StateLogger::add_column (
+   const std::string & name,
+   const double * value)
+{
+   if (started) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StateLoggerMessages::phasing_error,
+         "Column '%s' cannot be added to the state log '%s' after logging "
+         "has started.",
+         name.c_str(), file_name.c_str());
+      return;
+   }
+
+   column_names.push_back (name);
+   column_values.push_back (value);
+}
+
+
+/**
+ * Log a reference frame state as 13 columns named <source_name>.position[i],
+ * .velocity[i], .Q_parent_this.scalar, .Q_parent_this.vector[i] and
+ * .ang_vel_this[i].
+ * \param[in] source_name Prefix of the column names
+ * \param[in] state State to be logged
+ */
+void
+StateLogger::add_ref_frame_state (
+   const std::string & source_name,
+   const RefFrameState & state)
+{
+   static const char * const index[3] = {"[0]", "[1]", "[2]"};
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_column (source_name + ".position" + index[ii],
+                  &state.trans.position[ii]);
+   }
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_column (source_name + ".velocity" + index[ii],
+                  &state.trans.velocity[ii]);
+   }
+   add_column (source_name + ".Q_parent_this.scalar",
+               &state.rot.Q_parent_this.scalar);
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_column (source_name + ".Q_parent_this.vector" + index[ii],
+                  &state.rot.Q_parent_this.vector[ii]);
+   }
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_column (source_name + ".ang_vel_this" + index[ii],
+                  &state.rot.ang_vel_this[ii]);
+   }
+}
+
+
+/**
+ * Log the state of a reference frame, with respect to its parent.
+ * \param[in] frame Frame to be logged
+ */
+void
+StateLogger::add_ref_frame (
+   const RefFrame & frame)
+{
+   add_ref_frame_state (frame.get_name(), frame.state);
+}
+
+
+/**
+ * Log the composite body state of a DynBody, with respect to its
+ * integration frame.
+ * \param[in] body Body to be logged
+ */
+void
+StateLogger::add_dyn_body (
+   const DynBody & body)
+{
+   add_ref_frame_state (body.name.get_name(), body.composite_body.state);
+}
+
+
+/**
+ * Log the relative state computed by a RelativeDerivedState.
+ * \param[in] derived_state Derived state to be logged
+ */
+void
+StateLogger::add_relative_state (
+   const RelativeDerivedState & derived_state)
+{
+   add_ref_frame_state (derived_state.name, derived_state.rel_state);
+}
+
+
+/**
+ * Log an array of doubles as columns named <source_name>[i], e.g., the
+ * outputs of a derived state.
+ * \param[in] source_name Prefix of the column names
+ * \param[in] values Values to be logged
+ * \param[in] count Number of values
+ */
+void
+StateLogger::add_values (
+   const std::string & source_name,
+   const double * values,
+   unsigned int count)
+{
+   if ((values == nullptr) && (count > 0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StateLoggerMessages::invalid_setup,
+         "Null values for column '%s' of the state log '%s'.",
+         source_name.c_str(), file_name.c_str());
+      return;
+   }
+
+   if (count == 1) {
+      add_column (source_name, values);
+      return;
+   }
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      add_column (source_name + "[" + std::to_string (ii) + "]",
+                  &values[ii]);
+   }
+}
+
+
+/**
+ * Open the log file, write its header and start the writer thread.
+ */
+void
+StateLogger::start ()
+{
+   if (started) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StateLoggerMessages::phasing_error,
+         "The state log '%s' has already been started.", file_name.c_str());
+      return;
+   }
+
+   if (file_name.empty() || (chunk_rows == 0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StateLoggerMessages::invalid_setup,
+         "A state log needs a file name and a nonzero chunk_rows.");
+      return;
+   }
+
+   file = std::fopen (file_name.c_str(), "wb");
+   if (file == nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StateLoggerMessages::file_error,
+         "Unable to open the state log '%s'.", file_name.c_str());
+      return;
+   }
+
+   if (! write_header ()) {
+      std::fclose (file);
+      file = nullptr;
+      MessageHandler::fail (
+         __FILE__, __LINE__, StateLoggerMessages::file_error,
+         "Unable to write the header of the state log '%s'.",
+         file_name.c_str());
+      return;
+   }
+
+   std::size_t buffer_size =
+      static_cast<std::size_t>(chunk_rows) * column_names.size();
+   buffers[0].assign (buffer_size, 0.0);
+   buffers[1].assign (buffer_size, 0.0);
+
+   active = 0;
+   fill_rows = 0;
+   record_calls = 0;
+   rows_recorded = 0;
+   chunks_written = 0;
+   pending = false;
+   write_failed = false;
+   shutdown = false;
+   started = true;
+
+   writer = std::thread (&StateLogger::writer_loop, this);
+}
+
+
+/**
+ * Sample the columns into the active buffer, subject to decimation, and
+ * hand the buffer to the writer when it is full.
+ * \param[in] time Value of the time column
+ */
+void
+StateLogger::record (
+   double time)
+{
+   if (! started) {
+      return;
+   }
+
+   uint64_t call = record_calls++;
+   if ((decimation > 1) && ((call % decimation) != 0)) {
+      return;
+   }
+
+   double * buffer = buffers[active].data();
+   const double * const * values = column_values.data();
+   unsigned int ncols = column_values.size();
+
+   buffer[fill_rows] = time;
+   buffer += fill_rows + chunk_rows;
+   for (unsigned int ii = 0; ii < ncols; ++ii, buffer += chunk_rows) {
+      *buffer = *values[ii];
+   }
+
+   ++fill_rows;
+   ++rows_recorded;
+
+   if (fill_rows == chunk_rows) {
+      hand_off ();
+   }
+}
+
+
+/**
+ * Hand the active buffer to the writer and switch to the other buffer,
+ * waiting for the writer to release it if need be.
+ */
+void
+StateLogger::hand_off ()
+{
+   std::unique_lock<std::mutex> lock (mutex);
+
+   while (pending) {
+      done_cond.wait (lock);
+   }
+
+   pending = true;
+   pending_rows = fill_rows;
+   active = 1 - active;
+   fill_rows = 0;
+
+   lock.unlock ();
+   work_cond.notify_one ();
+}
+
+
+/**
+ * Writer thread main loop: write each buffer handed off until shut down.
+ */
+void
+StateLogger::writer_loop ()
+{
+   std::unique_lock<std::mutex> lock (mutex);
+
+   while (true) {
+      while ((! pending) && (! shutdown)) {
+         work_cond.wait (lock);
+      }
+      if (! pending) {
+         break;
+      }
+
+      const double * buffer = buffers[1 - active].data();
+      unsigned int rows = pending_rows;
+      bool skip = write_failed;
+
+      lock.unlock ();
+      bool ok = skip || write_chunk (buffer, rows);
+      lock.lock ();
+
+      if (! ok) {
+         write_failed = true;
+      }
+      else if (! skip) {
+         ++chunks_written;
+      }
+      pending = false;
+      done_cond.notify_all ();
+   }
+}
+
+
+/**
+ * Write the file header.
+ * @return True if the header was written
+ */
+bool
+StateLogger::write_header ()
+{
+   std::string header (file_magic);
+
+   put_value (static_cast<uint32_t>(format_version), header);
+   put_value (static_cast<uint32_t>(column_names.size()), header);
+   for (std::vector<std::string>::const_iterator it = column_names.begin();
+        it != column_names.end();
+        ++it) {
+      put_value (static_cast<uint32_t>(it->size()), header);
+      header.append (*it);
+   }
+
+   return std::fwrite (header.data(), 1, header.size(), file) == header.size();
+}
+
+
+/**
+ * Write one chunk. Called by the writer thread, which owns the buffer.
+ * @return True if the chunk was written
+ * \param[in] buffer Chunk buffer, chunk_rows rows per column
+ * \param[in] rows Number of rows in the chunk
+ */
+bool
+StateLogger::write_chunk (
+   const double * buffer,
+   unsigned int rows)
+{
+   unsigned int ncols = column_names.size();
+   std::size_t column_bytes = static_cast<std::size_t>(rows) * sizeof(double);
+   std::string payload (column_bytes * ncols, '\0');
+
+   for (unsigned int ii = 0; ii < ncols; ++ii) {
+      const double * column = buffer + static_cast<std::size_t>(ii)*chunk_rows;
+      char * out = &payload[ii * column_bytes];
+      if (compress) {
+         shuffle_column (column, rows, out);
+      }
+      else {
+         std::memcpy (out, column, column_bytes);
+      }
+   }
+
+   std::string stored;
+   if (compress) {
+      CheckPointSectionCodec::compress (payload, stored);
+   }
+   const std::string & data = compress ? stored : payload;
+
+   std::string head (chunk_magic);
+   put_value (static_cast<uint32_t>(rows), head);
+   put_value (static_cast<uint32_t>(compress ? 1 : 0), head);
+   put_value (static_cast<uint64_t>(payload.size()), head);
+   put_value (static_cast<uint64_t>(data.size()), head);
+
+   return (std::fwrite (head.data(), 1, head.size(), file) == head.size()) &&
+          (std::fwrite (data.data(), 1, data.size(), file) == data.size());
+}
+
+
+/**
+ * Write the remaining samples, stop the writer thread and close the file.
+ * Does nothing if logging has not been started.
+ */
+void
+StateLogger::finish ()
+{
+   if (! started) {
+      return;
+   }
+
+   if (fill_rows > 0) {
+      hand_off ();
+   }
+
+   {
+      std::lock_guard<std::mutex> lock (mutex);
+      shutdown = true;
+   }
+   work_cond.notify_all ();
+   writer.join ();
+
+   started = false;
+
+   bool close_failed = (std::fclose (file) != 0);
+   file = nullptr;
+
+   if (write_failed || close_failed) {
+      MessageHandler::error (
+         __FILE__, __LINE__, StateLoggerMessages::file_error,
+         "Errors occurred writing the state log '%s'; it is incomplete.",
+         file_name.c_str());
+   }
+}
+
+
+/**
+ * Number of columns, including the time column.
+ * @return Number of columns
+ */
+unsigned int
+StateLogger::get_num_columns () const
+{
+   return column_names.size();
+}
+
+
+/**
+ * Name of a column; column 0 is time.
+ * @return Column name
+ * \param[in] index Column index
+ */
+const std::string &
+StateLogger::get_column_name (
+   unsigned int index) const
+{
+   return column_names.at (index);
+}
+
+
+/**
+ * Number of rows recorded.
+ * @return Rows recorded
+ */
+uint64_t
+StateLogger::get_rows_recorded () const
+{
+   return rows_recorded;
+}
+
+
+/**
+ * Number of chunks written. Only final once the log is finished.
+ * @return Chunks written
+ */
+uint64_t
+StateLogger::get_chunks_written () const
+{
+   std::lock_guard<std::mutex> lock (const_cast<std::mutex &>(mutex));
+   return chunks_written;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,55 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StateLogger
+ * @{
+ *
+ * @file models/utils/state_logger/src/state_logger_messages.cc
+ * Implement the class StateLoggerMessages.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((state_logger_messages.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "../include/state_logger_messages.hh"
+
+#define PATH "utils/state_logger/"
+#define CLASS StateLoggerMessages
+#define MAKE_MESSAGE_CODE(id) char const * CLASS::id = PATH #id
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Static member data
+
+MAKE_MESSAGE_CODE(phasing_error);
+MAKE_MESSAGE_CODE(invalid_setup);
+MAKE_MESSAGE_CODE(file_error);
+
+} // End JEOD namespace
+
+#undef MAKE_MESSAGE_CODE
+#undef CLASS
+#undef PATH
+
+/**
+ * @}
+ * @}
+ * @}
+ */
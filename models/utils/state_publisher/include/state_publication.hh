@@ -0,0 +1,317 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StatePublisher
+ * @{
+ *
+ * @file models/utils/state_publisher/include/state_publication.hh
+ * Define the layout of the shared memory region written by StatePublisher
+ * and the class StatePublicationReader, which reads it from any process.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((The writer and the readers run on the same host.)
+   (64 bit atomic operations are lock free.))
+
+Library dependencies:
+  ((../src/state_publication_reader.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_STATE_PUBLICATION_HH
+#define JEOD_STATE_PUBLICATION_HH
+
+// System includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#error "The state publication region needs lock-free 64 bit atomics."
+#endif
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * The header at the start of a state publication region. The header is
+ * followed by num_entries StatePublicationEntry records and then, at
+ * values_offset, by the num_values published doubles.
+ *
+ * The values are guarded by a sequence lock. The publisher makes sequence
+ * odd before it updates the values and time and even again afterwards.
+ * A reader that sees the same even sequence before and after it reads
+ * has read a consistent snapshot.
+ */
+struct StatePublicationHeader {
+
+   /**
+    * Identifies the region: "JEODPUB" and a terminating null.
+    */
+   char magic[8]; //!< trick_io(**)
+
+   /**
+    * Layout version.
+    */
+   uint32_t version; //!< trick_io(**)
+
+   /**
+    * Number of entries in the directory.
+    */
+   uint32_t num_entries; //!< trick_io(**)
+
+   /**
+    * Number of published values.
+    */
+   uint64_t num_values; //!< trick_io(**)
+
+   /**
+    * Byte offset of the values from the start of the region.
+    */
+   uint64_t values_offset; //!< trick_io(**)
+
+   /**
+    * Size of the region in bytes.
+    */
+   uint64_t region_size; //!< trick_io(**)
+
+   /**
+    * Sequence lock; odd while an update is in progress.
+    */
+   std::atomic<uint64_t> sequence; //!< trick_io(**)
+
+   /**
+    * Number of updates published.
+    */
+   uint64_t publish_count; //!< trick_io(**)
+
+   /**
+    * Dynamic time of the published values.
+    */
+   double time; //!< trick_io(**)
+};
+
+
+/**
+ * A directory entry of a state publication region: a named run of values.
+ */
+struct StatePublicationEntry {
+
+   /**
+    * The kinds of entries.
+    */
+   enum Kind {
+      /**
+       * 13 values: position[3], velocity[3], Q_parent_this scalar and
+       * vector[3], ang_vel_this[3].
+       */
+      RefFrameStateKind = 1,
+
+      /**
+       * 13 values: mass, center of mass position[3], inertia[3][3].
+       */
+      MassKind = 2,
+
+      /**
+       * count values.
+       */
+      ValuesKind = 3
+   };
+
+   /**
+    * Size of the name field, including the terminating null.
+    */
+   static const unsigned int name_size = 56;
+
+   /**
+    * Entry name, null terminated and truncated if need be.
+    */
+   char name[name_size]; //!< trick_io(**)
+
+   /**
+    * The entry's Kind.
+    */
+   uint32_t kind; //!< trick_io(**)
+
+   /**
+    * Number of values.
+    */
+   uint32_t count; //!< trick_io(**)
+
+   /**
+    * Index of the entry's first value in the value array.
+    */
+   uint64_t first; //!< trick_io(**)
+};
+
+
+/**
+ * A StatePublicationReader maps a state publication region read-only.
+ * Readers can take copies with snapshot, or read values in place between
+ * read_begin and read_validate:
+ * @code
+ *    uint64_t seq;
+ *    do {
+ *       seq = reader.read_begin();
+ *       ... use reader.get_values()[entry->first + ii] ...
+ *    } while (! reader.read_validate (seq));
+ * @endcode
+ * Reading never blocks the publisher.
+ */
+class StatePublicationReader {
+JEOD_MAKE_SIM_INTERFACES(StatePublicationReader)
+
+public:
+
+   // Constructor and destructor.
+   StatePublicationReader ();
+   ~StatePublicationReader ();
+
+   // Map the named region; returns false if it does not exist or is not
+   // a state publication region.
+   bool open (const std::string & region_name);
+
+   // Unmap the region.
+   void close ();
+
+   /**
+    * Is a region mapped?
+    * @return True if a region is mapped
+    */
+   bool is_open () const
+   {
+      return header != nullptr;
+   }
+
+   // Number of directory entries.
+   unsigned int get_num_entries () const;
+
+   // Directory entry by index.
+   const StatePublicationEntry * get_entry (unsigned int index) const;
+
+   // Directory entry by name; null if there is none.
+   const StatePublicationEntry * find_entry (const char * name) const;
+
+   // Number of published values.
+   std::size_t get_num_values () const;
+
+   /**
+    * The published values, to be read between read_begin and read_validate.
+    * @return Value array in the shared region
+    */
+   const double * get_values () const
+   {
+      return values;
+   }
+
+   // Start a read: wait for the publisher to be outside an update.
+   uint64_t read_begin () const;
+
+   // End a read: were the values read since read_begin consistent?
+   bool read_validate (uint64_t sequence) const;
+
+   // Copy a consistent snapshot of all values and their time.
+   bool snapshot (
+      double * values_out,
+      double & time_out,
+      unsigned int max_tries = 1000) const;
+
+
+private:
+
+   /**
+    * The mapped region.
+    */
+   const StatePublicationHeader * header; //!< trick_io(**)
+
+   /**
+    * The directory in the mapped region.
+    */
+   const StatePublicationEntry * entries; //!< trick_io(**)
+
+   /**
+    * The values in the mapped region.
+    */
+   const double * values; //!< trick_io(**)
+
+   /**
+    * Size of the mapping.
+    */
+   std::size_t mapped_size; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   StatePublicationReader (const StatePublicationReader &);
+
+   /**
+    * Not implemented.
+    */
+   StatePublicationReader & operator= (const StatePublicationReader &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,229 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2023 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StatePublisher
+ * @{
+ *
+ * @file models/utils/state_publisher/include/state_publisher.hh
+ * Define the class StatePublisher, which publishes selected states in a
+ * shared memory region at the end of each integration cycle.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Assumptions and limitations:
+  ((Sources are sampled by address; they must outlive the publisher.)
+   (There is one publisher per region.))
+
+Library dependencies:
+  ((../src/state_publisher.cc))
+
+
+
+*******************************************************************************/
+
+
+#ifndef JEOD_STATE_PUBLISHER_HH
+#define JEOD_STATE_PUBLISHER_HH
+
+// System includes
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/integration_cycle_observer.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "state_publication.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+class DynBody;
+class DynManager;
+class MassProperties;
+class RefFrame;
+class RefFrameState;
+class RelativeDerivedState;
+
+
+/**
+ * A StatePublisher places selected reference frame states, mass properties
+ * and derived-state outputs in a POSIX shared memory region (see
+ * state_publication.hh for the layout) so that other processes, such as the
+ * hardware of a hardware-in-the-loop rig, can read them. The publisher
+ * observes the DynManager's integration cycles and updates the region under
+ * a sequence lock at the end of each cycle; readers never block it.
+ *
+ * Sources are added before initialize, which creates the region.
+ */
+class StatePublisher : public IntegrationCycleObserver {
+JEOD_MAKE_SIM_INTERFACES(StatePublisher)
+
+public:
+
+   /**
+    * Name of the shared memory object, e.g. "/jeod_states".
+    */
+   std::string region_name; //!< trick_units(--)
+
+   /**
+    * Remove the shared memory object when the publisher shuts down?
+    */
+   bool unlink_on_shutdown; //!< trick_units(--)
+
+
+   // Constructor and destructor.
+   StatePublisher ();
+   ~StatePublisher () override;
+
+   // Publish a reference frame state.
+   void add_ref_frame_state (
+      const std::string & entry_name,
+      const RefFrameState & state);
+
+   // Publish the state of a reference frame.
+   void add_ref_frame (const RefFrame & frame);
+
+   // Publish the composite body state and mass properties of a DynBody.
+   void add_dyn_body (const DynBody & body);
+
+   // Publish a set of mass properties.
+   void add_mass_properties (
+      const std::string & entry_name,
+      const MassProperties & properties);
+
+   // Publish the relative state computed by a RelativeDerivedState.
+   void add_relative_state (const RelativeDerivedState & derived_state);
+
+   // Publish an array of doubles, such as a derived state's outputs.
+   void add_values (
+      const std::string & entry_name,
+      const double * values,
+      unsigned int count);
+
+   // Create the region, publish the initial values, and register with the
+   // dynamics manager.
+   void initialize (DynManager & manager);
+
+   // Update the region.
+   void publish ();
+
+   // Publish at the end of each integration cycle.
+   void integration_cycle_complete (
+      DynamicsIntegrationGroup & integ_group) override;
+
+   // Deregister and unmap the region.
+   void shutdown ();
+
+
+private:
+
+   // Add a directory entry.
+   void add_entry (
+      const std::string & entry_name,
+      StatePublicationEntry::Kind kind,
+      unsigned int count);
+
+   // Add a value source.
+   void add_source (const double * value);
+
+
+   /**
+    * The dynamics manager, once initialized.
+    */
+   DynManager * dyn_manager; //!< trick_io(**)
+
+   /**
+    * Directory entries.
+    */
+   std::vector<StatePublicationEntry> entries; //!< trick_io(**)
+
+   /**
+    * Addresses of the published values.
+    */
+   std::vector<const double *> sources; //!< trick_io(**)
+
+   /**
+    * The mapped region.
+    */
+   StatePublicationHeader * header; //!< trick_io(**)
+
+   /**
+    * The values in the mapped region.
+    */
+   double * values; //!< trick_io(**)
+
+   /**
+    * Size of the mapping.
+    */
+   std::size_t mapped_size; //!< trick_io(**)
+
+
+   /**
+    * Not implemented.
+    */
+   StatePublisher (const StatePublisher &);
+
+   /**
+    * Not implemented.
+    */
+   StatePublisher & operator= (const StatePublisher &);
+};
+
+} // End JEOD namespace
+
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,270 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StatePublisher
+ * @{
+ *
+ * @file models/utils/state_publisher/src/state_publication_reader.cc
+ * Define member functions for the class StatePublicationReader.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((state_publication_reader.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Model includes
+#include "../include/state_publication.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * StatePublicationReader default constructor.
+ */
+StatePublicationReader::StatePublicationReader ()
+:
+   header(nullptr),
+   entries(nullptr),
+   values(nullptr),
+   mapped_size(0)
+{
+   ; // Empty
+}
+
+
+/**
+ * StatePublicationReader destructor.
+ */
+StatePublicationReader::~StatePublicationReader ()
+{
+   close ();
+}
+
+
+/**
+ * Map the named state publication region read-only.
+ * @return True if the region was mapped
+ * \param[in] region_name Name of the shared memory object
+ */
+bool
+StatePublicationReader::open (
+   const std::string & region_name)
+{
+   close ();
+
+   int fd = shm_open (region_name.c_str(), O_RDONLY, 0);
+   if (fd < 0) {
+      return false;
+   }
+
+   struct stat info;
+   void * addr = MAP_FAILED;
+   std::size_t size = 0;
+   if ((fstat (fd, &info) == 0) &&
+       (static_cast<std::size_t>(info.st_size) >=
+        sizeof(StatePublicationHeader))) {
+      size = info.st_size;
+      addr = mmap (nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+   }
+   ::close (fd);
+
+   if (addr == MAP_FAILED) {
+      return false;
+   }
+
+   // Reject regions that are not state publications, that are not yet
+   // completely written, or whose layout does not fit the mapping.
+   const StatePublicationHeader * region =
+      static_cast<const StatePublicationHeader *>(addr);
+   std::size_t directory_end =
+      sizeof(StatePublicationHeader) +
+      region->num_entries * sizeof(StatePublicationEntry);
+   if ((std::memcmp (region->magic, "JEODPUB", 8) != 0) ||
+       (region->version != 1) ||
+       (region->region_size > size) ||
+       (region->values_offset < directory_end) ||
+       (region->values_offset + region->num_values * sizeof(double) >
+        region->region_size)) {
+      munmap (addr, size);
+      return false;
+   }
+
+   header = region;
+   entries = reinterpret_cast<const StatePublicationEntry *>(region + 1);
+   values = reinterpret_cast<const double *>(
+               static_cast<const char *>(addr) + region->values_offset);
+   mapped_size = size;
+
+   return true;
+}
+
+
+/**
+ * Unmap the region.
+ */
+void
+StatePublicationReader::close ()
+{
+   if (header != nullptr) {
+      munmap (const_cast<StatePublicationHeader *>(header), mapped_size);
+      header = nullptr;
+      entries = nullptr;
+      values = nullptr;
+      mapped_size = 0;
+   }
+}
+
+
+/**
+ * Get the number of directory entries.
+ * @return Number of entries
+ */
+unsigned int
+StatePublicationReader::get_num_entries ()
+const
+{
+   return (header != nullptr) ? header->num_entries : 0;
+}
+
+
+/**
+ * Get a directory entry by index.
+ * @return Entry, or null if the index is out of range
+ * \param[in] index Entry index
+ */
+const StatePublicationEntry *
+StatePublicationReader::get_entry (
+   unsigned int index)
+const
+{
+   return (index < get_num_entries()) ? &entries[index] : nullptr;
+}
+
+
+/**
+ * Find a directory entry by name.
+ * @return Entry, or null if there is none with the given name
+ * \param[in] name Entry name
+ */
+const StatePublicationEntry *
+StatePublicationReader::find_entry (
+   const char * name)
+const
+{
+   unsigned int nentries = get_num_entries();
+
+   for (unsigned int ii = 0; ii < nentries; ++ii) {
+      if (std::strncmp (entries[ii].name, name,
+                        StatePublicationEntry::name_size) == 0) {
+         return &entries[ii];
+      }
+   }
+
+   return nullptr;
+}
+
+
+/**
+ * Get the number of published values.
+ * @return Number of values
+ */
+std::size_t
+StatePublicationReader::get_num_values ()
+const
+{
+   return (header != nullptr) ? header->num_values : 0;
+}
+
+
+/**
+ * Start a read, waiting for the publisher to finish an update in progress.
+ * @return Sequence to be passed to read_validate
+ */
+uint64_t
+StatePublicationReader::read_begin ()
+const
+{
+   uint64_t seq = header->sequence.load (std::memory_order_acquire);
+   while ((seq & 1) != 0) {
+      seq = header->sequence.load (std::memory_order_acquire);
+   }
+   return seq;
+}
+
+
+/**
+ * End a read.
+ * @return True if the values read since read_begin are consistent
+ * \param[in] sequence Sequence returned by read_begin
+ */
+bool
+StatePublicationReader::read_validate (
+   uint64_t sequence)
+const
+{
+   std::atomic_thread_fence (std::memory_order_acquire);
+   return header->sequence.load (std::memory_order_relaxed) == sequence;
+}
+
+
+/**
+ * Copy a consistent snapshot of all published values and their time.
+ * @return True if a consistent snapshot was taken within max_tries attempts
+ * \param[out] values_out Copy of the values, num_values long
+ * \param[out] time_out Dynamic time of the values
+ * \param[in] max_tries Maximum number of attempts
+ */
+bool
+StatePublicationReader::snapshot (
+   double * values_out,
+   double & time_out,
+   unsigned int max_tries)
+const
+{
+   if (header == nullptr) {
+      return false;
+   }
+
+   std::size_t nvalues = header->num_values;
+
+   for (unsigned int tries = 0; tries < max_tries; ++tries) {
+      uint64_t seq = read_begin ();
+      std::memcpy (values_out, values, nvalues * sizeof(double));
+      time_out = header->time;
+      if (read_validate (seq)) {
+         return true;
+      }
+   }
+
+   return false;
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
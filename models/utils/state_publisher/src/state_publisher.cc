@@ -0,0 +1,414 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StatePublisher
+ * @{
+ *
+ * @file models/utils/state_publisher/src/state_publisher.cc
+ * Define member functions for the class StatePublisher.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((state_publisher.cc)
+   (state_publisher_messages.cc)
+   (dynamics/dyn_manager/src/integ_group_primitives.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+
+// System includes
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "dynamics/derived_state/include/relative_derived_state.hh"
+#include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "dynamics/mass/include/mass_properties.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/sim_interface/include/config.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+// Model includes
+#include "../include/state_publisher.hh"
+#include "../include/state_publisher_messages.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * StatePublisher default constructor.
+ */
+StatePublisher::StatePublisher ()
+:
+   IntegrationCycleObserver(),
+   region_name(),
+   unlink_on_shutdown(false),
+   dyn_manager(nullptr),
+   entries(),
+   sources(),
+   header(nullptr),
+   values(nullptr),
+   mapped_size(0)
+{
+   ; // Empty
+}
+
+
+/**
+ * StatePublisher destructor.
+ */
+StatePublisher::~StatePublisher ()
+{
+   shutdown ();
+}
+
+
+/**
+ * Add a directory entry for the next count sources.
+ * \param[in] entry_name Entry name
+ * \param[in] kind Entry kind
+ * \param[in] count Number of values
+ */
+void
+StatePublisher::add_entry (
+   const std::string & entry_name,
+   StatePublicationEntry::Kind kind,
+   unsigned int count)
+{
+   if (header != nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StatePublisherMessages::phasing_error,
+         "Entry '%s' cannot be added to the state publication '%s' after "
+         "it has been initialized.",
+         entry_name.c_str(), region_name.c_str());
+      return;
+   }
+
+   if (entry_name.size() >= StatePublicationEntry::name_size) {
+      MessageHandler::warn (
+         __FILE__, __LINE__, StatePublisherMessages::invalid_setup,
+         "Entry name '%s' is truncated to %u characters.",
+         entry_name.c_str(), StatePublicationEntry::name_size - 1);
+   }
+
+   StatePublicationEntry entry;
+   std::memset (&entry, 0, sizeof(entry));
+   std::strncpy (entry.name, entry_name.c_str(),
+                 StatePublicationEntry::name_size - 1);
+   entry.kind = kind;
+   entry.count = count;
+   entry.first = sources.size();
+
+   entries.push_back (entry);
+}
+
+
+/**
+ * Add a value source.
+ * \param[in] value Address of the published value
+ */
+void
+StatePublisher::add_source (
+   const double * value)
+{
+   sources.push_back (value);
+}
+
+
+/**
+ * Publish a reference frame state as a RefFrameStateKind entry.
+ * \param[in] entry_name Entry name
+ * \param[in] state State to be published
+ */
+void
+StatePublisher::add_ref_frame_state (
+   const std::string & entry_name,
+   const RefFrameState & state)
+{
+   add_entry (entry_name, StatePublicationEntry::RefFrameStateKind, 13);
+
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_source (&state.trans.position[ii]);
+   }
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_source (&state.trans.velocity[ii]);
+   }
+   add_source (&state.rot.Q_parent_this.scalar);
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_source (&state.rot.Q_parent_this.vector[ii]);
+   }
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_source (&state.rot.ang_vel_this[ii]);
+   }
+}
+
+
+/**
+ * Publish the state of a reference frame, with respect to its parent.
+ * \param[in] frame Frame to be published
+ */
+void
+StatePublisher::add_ref_frame (
+   const RefFrame & frame)
+{
+   add_ref_frame_state (frame.get_name(), frame.state);
+}
+
+
+/**
+ * Publish the composite body state of a DynBody as the entry <body name>
+ * and its composite mass properties as the entry <body name>.mass.
+ * \param[in] body Body to be published
+ */
+void
+StatePublisher::add_dyn_body (
+   const DynBody & body)
+{
+   const std::string & body_name = body.name.get_name();
+
+   add_ref_frame_state (body_name, body.composite_body.state);
+   add_mass_properties (body_name + ".mass", body.mass.composite_properties);
+}
+
+
+/**
+ * Publish a set of mass properties as a MassKind entry.
+ * \param[in] entry_name Entry name
+ * \param[in] properties Mass properties to be published
+ */
+void
+StatePublisher::add_mass_properties (
+   const std::string & entry_name,
+   const MassProperties & properties)
+{
+   add_entry (entry_name, StatePublicationEntry::MassKind, 13);
+
+   add_source (&properties.mass);
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      add_source (&properties.position[ii]);
+   }
+   for (unsigned int ii = 0; ii < 3; ++ii) {
+      for (unsigned int jj = 0; jj < 3; ++jj) {
+         add_source (&properties.inertia[ii][jj]);
+      }
+   }
+}
+
+
+/**
+ * Publish the relative state computed by a RelativeDerivedState.
+ * \param[in] derived_state Derived state to be published
+ */
+void
+StatePublisher::add_relative_state (
+   const RelativeDerivedState & derived_state)
+{
+   add_ref_frame_state (derived_state.name, derived_state.rel_state);
+}
+
+
+/**
+ * Publish an array of doubles as a ValuesKind entry.
+ * \param[in] entry_name Entry name
+ * \param[in] values_in Values to be published
+ * \param[in] count Number of values
+ */
+void
+StatePublisher::add_values (
+   const std::string & entry_name,
+   const double * values_in,
+   unsigned int count)
+{
+   if ((values_in == nullptr) && (count > 0)) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StatePublisherMessages::invalid_setup,
+         "Null values for entry '%s' of the state publication '%s'.",
+         entry_name.c_str(), region_name.c_str());
+      return;
+   }
+
+   add_entry (entry_name, StatePublicationEntry::ValuesKind, count);
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      add_source (&values_in[ii]);
+   }
+}
+
+
+/**
+ * Create and map the shared memory region, write its header and directory,
+ * publish the initial values, and register with the dynamics manager.
+ * \param[in,out] manager Dynamics manager whose cycles trigger publication
+ */
+void
+StatePublisher::initialize (
+   DynManager & manager)
+{
+   if (header != nullptr) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StatePublisherMessages::phasing_error,
+         "The state publication '%s' has already been initialized.",
+         region_name.c_str());
+      return;
+   }
+
+   if (region_name.empty()) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StatePublisherMessages::invalid_setup,
+         "A state publication needs a region name.");
+      return;
+   }
+
+   std::size_t directory_end =
+      sizeof(StatePublicationHeader) +
+      entries.size() * sizeof(StatePublicationEntry);
+   std::size_t values_offset =
+      (directory_end + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+   std::size_t size = values_offset + sources.size() * sizeof(double);
+
+   int fd = shm_open (region_name.c_str(), O_RDWR | O_CREAT, 0644);
+   if (fd < 0) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StatePublisherMessages::shared_memory_error,
+         "Unable to open the state publication '%s': %s",
+         region_name.c_str(), std::strerror(errno));
+      return;
+   }
+
+   void * addr = MAP_FAILED;
+   if (ftruncate (fd, size) == 0) {
+      addr = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   }
+   ::close (fd);
+
+   if (addr == MAP_FAILED) {
+      MessageHandler::fail (
+         __FILE__, __LINE__, StatePublisherMessages::shared_memory_error,
+         "Unable to map the state publication '%s': %s",
+         region_name.c_str(), std::strerror(errno));
+      return;
+   }
+
+   // Mark the region as being updated while its layout is written, so that
+   // a reader of a previous region of the same name does not mistake the
+   // partially written one for a consistent one.
+   std::memset (addr, 0, size);
+   header = new (addr) StatePublicationHeader;
+   header->sequence.store (1, std::memory_order_relaxed);
+   std::atomic_thread_fence (std::memory_order_release);
+
+   header->version = 1;
+   header->num_entries = entries.size();
+   header->num_values = sources.size();
+   header->values_offset = values_offset;
+   header->region_size = size;
+   header->publish_count = 0;
+   header->time = 0.0;
+   if (! entries.empty()) {
+      std::memcpy (static_cast<char *>(addr) + sizeof(StatePublicationHeader),
+                   entries.data(),
+                   entries.size() * sizeof(StatePublicationEntry));
+   }
+   values = reinterpret_cast<double *>(static_cast<char *>(addr) +
+                                       values_offset);
+   mapped_size = size;
+   std::memcpy (header->magic, "JEODPUB", 8);
+
+   header->sequence.store (2, std::memory_order_release);
+
+   dyn_manager = &manager;
+   publish ();
+   dyn_manager->add_cycle_observer (*this);
+}
+
+
+/**
+ * Copy the current values of the sources into the region under the
+ * sequence lock.
+ */
+void
+StatePublisher::publish ()
+{
+   if (header == nullptr) {
+      return;
+   }
+
+   uint64_t seq = header->sequence.load (std::memory_order_relaxed);
+   header->sequence.store (seq + 1, std::memory_order_relaxed);
+   std::atomic_thread_fence (std::memory_order_release);
+
+   const double * const * source = sources.data();
+   unsigned int nvalues = sources.size();
+   for (unsigned int ii = 0; ii < nvalues; ++ii) {
+      values[ii] = *source[ii];
+   }
+   header->time = dyn_manager->timestamp();
+   ++header->publish_count;
+
+   header->sequence.store (seq + 2, std::memory_order_release);
+}
+
+
+/**
+ * Publish at the end of each integration cycle. With several integration
+ * loops, each loop's cycle publishes all entries.
+ * \param[in] integ_group The group whose cycle is complete (unused)
+ */
+void
+StatePublisher::integration_cycle_complete (
+   DynamicsIntegrationGroup & integ_group JEOD_UNUSED)
+{
+   publish ();
+}
+
+
+/**
+ * Deregister from the dynamics manager and unmap the region, removing the
+ * shared memory object if unlink_on_shutdown is set.
+ */
+void
+StatePublisher::shutdown ()
+{
+   if (header == nullptr) {
+      return;
+   }
+
+   dyn_manager->remove_cycle_observer (*this);
+
+   munmap (header, mapped_size);
+   header = nullptr;
+   values = nullptr;
+   mapped_size = 0;
+
+   if (unlink_on_shutdown) {
+      shm_unlink (region_name.c_str());
+   }
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
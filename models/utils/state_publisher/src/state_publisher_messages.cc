@@ -0,0 +1,55 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup StatePublisher
+ * @{
+ *
+ * @file models/utils/state_publisher/src/state_publisher_messages.cc
+ * Implement the class StatePublisherMessages.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((state_publisher_messages.cc))
+
+ 
+
+*******************************************************************************/
+
+
+// System includes
+
+// JEOD includes
+#include "../include/state_publisher_messages.hh"
+
+#define PATH "utils/state_publisher/"
+#define CLASS StatePublisherMessages
+#define MAKE_MESSAGE_CODE(id) char const * CLASS::id = PATH #id
+
+
+//! Namespace jeod
+namespace jeod {
+
+// Static member data
+
+MAKE_MESSAGE_CODE(phasing_error);
+MAKE_MESSAGE_CODE(invalid_setup);
+MAKE_MESSAGE_CODE(shared_memory_error);
+
+} // End JEOD namespace
+
+#undef MAKE_MESSAGE_CODE
+#undef CLASS
+#undef PATH
+
+/**
+ * @}
+ * @}
+ * @}
+ */
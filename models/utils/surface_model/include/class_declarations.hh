@@ -78,6 +78,7 @@ class SurfaceModelMessages;
 class PlateEllipse;
 class PlatePolygon;
 class Cylinder;
+class CylinderThermal;
 class Ellipsoid;
 class PlateEllipseHole;
 class PlatePolygonHole;
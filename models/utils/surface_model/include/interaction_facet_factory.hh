@@ -128,6 +128,14 @@ public:
       Facet* facet)
  = 0; /* In: -- The facet that is being checked */
 
+   // Create the interaction facets for several facets in one contiguous
+   // block. Factories that do not support this return NULL.
+   virtual InteractionFacet* create_facets (
+      Facet** facets,
+      FacetParams** params,
+      unsigned int count,
+      InteractionFacet** inter_facets);
+
 protected:
 
    /**
@@ -68,6 +68,7 @@ Library dependencies:
 #define JEOD_INTERACTION_SURFACE_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
@@ -79,8 +80,10 @@ Library dependencies:
 namespace jeod {
 
 class Facet;
+class InteractionFacet;
 class InteractionFacetFactory;
 class FacetParams;
+class ThermalFacetRider;
 
 /**
  * A base class for interaction specific surfaces.
@@ -122,6 +125,19 @@ public:
       void)
    {};
 
+   /**
+    * Collects the thermal riders of the facets of this surface, for models
+    * that integrate all facet temperatures at once. Surfaces that do not
+    * override this expose no riders.
+    * \param[out] riders The thermal riders, one per facet
+    */
+   virtual void
+   collect_thermal_riders (
+      std::vector<ThermalFacetRider *> & riders)
+   {
+      riders.clear();
+   };
+
    /**
     * A pure virtual function that will allocate the array of
     * pointers to the correct interaction facet type, of the given
@@ -152,10 +168,38 @@ public:
                                       array the interaction facet will be
                                       placed */
 
+   // Allocates the interaction facets for several facets that share one
+   // factory, in one block if the surface and the factory support it.
+   virtual void allocate_interaction_facets (
+      Facet** facets,
+      InteractionFacetFactory* factory,
+      FacetParams** params,
+      const unsigned int* indices,
+      unsigned int count);
+
 
 
 protected:
 
+   // Creates the interaction facets for several facets in one block.
+   bool create_facet_block (
+      Facet** facets,
+      InteractionFacetFactory* factory,
+      FacetParams** params,
+      unsigned int count,
+      InteractionFacet** inter_facets);
+
+   // Is the interaction facet part of a block made by create_facet_block?
+   bool is_block_facet (const InteractionFacet* inter_facet) const;
+
+   /**
+    * The first and last interaction facets of each block made by
+    * create_facet_block. The first facet is the block's allocation and is
+    * released by the destructor; facets in a block must not be released
+    * individually.
+    */
+   std::vector<InteractionFacet*> facet_block_bounds; //!< trick_io(**)
+
 
 private:
 
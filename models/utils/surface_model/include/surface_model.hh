@@ -66,6 +66,7 @@ Library dependencies:
 #define JEOD_SURFACE_MODEL_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
@@ -80,6 +81,7 @@ Library dependencies:
 //! Namespace jeod
 namespace jeod {
 
+class ArticulationObserver;
 class Facet;
 class MassBody;
 class BaseDynManager;
@@ -108,10 +110,26 @@ struct FacetStateInfo {
     */
    MassBody* mass_body; //!< trick_io(**)
 
+   /**
+    * Indices, into the surface model's facets, of the facets attached
+    * to mass_body
+    */
+   std::vector<unsigned int> facet_indices; //!< trick_io(**)
+
+   /**
+    * Must the facets attached to mass_body be updated at the next
+    * articulation update regardless of whether mass_state changes?
+    */
+   bool moved; //!< trick_io(**)
+
    /**
     * Default constructor to keep the memory manager happy.
     */
-   FacetStateInfo(){}
+   FacetStateInfo()
+      :
+      mass_body(nullptr),
+      moved(true)
+      {}
 
    /**
     * FacetStateInfo non-default constructor.
@@ -119,7 +137,8 @@ struct FacetStateInfo {
     */
    explicit FacetStateInfo(MassBody* new_mass_body)
       :
-      mass_body(new_mass_body)
+      mass_body(new_mass_body),
+      moved(true)
       {}
 
    /**
@@ -128,7 +147,8 @@ struct FacetStateInfo {
     */
    explicit FacetStateInfo(MassBody& new_mass_body)
       :
-      mass_body(&new_mass_body)
+      mass_body(&new_mass_body),
+      moved(true)
       {}
 
    /**
@@ -173,6 +193,21 @@ public:
 
    void update_articulation ();
 
+   void invalidate_articulation ();
+
+   void add_articulation_observer (ArticulationObserver & observer);
+
+   void remove_articulation_observer (ArticulationObserver & observer);
+
+   /**
+    * Getter for the indices of the facets moved by the most recent
+    * update_articulation.
+    */
+   const std::vector<unsigned int> & get_changed_facets () const
+   {
+      return changed_facets;
+   }
+
    /**
     * The name of the MassBody representing the overall structural
     * frame of the vehicle associated with this surface model.
@@ -206,6 +241,23 @@ protected:
     */
    JeodObjectList<FacetStateInfo>::type articulation_states; //!< trick_io(**)
 
+   /**
+    * Number of facets, from the start of facets, that are indexed in
+    * articulation_states. Facets added later are updated at every
+    * articulation update.
+    */
+   unsigned int num_indexed_facets; //!< trick_io(**)
+
+   /**
+    * Indices of the facets moved by the most recent update_articulation
+    */
+   std::vector<unsigned int> changed_facets; //!< trick_io(**)
+
+   /**
+    * Observers told which facets moved at each articulation update
+    */
+   std::vector<ArticulationObserver*> articulation_observers; //!< trick_io(**)
+
 
 private:
 
@@ -0,0 +1,66 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SurfaceModel
+ * @{
+ *
+ * @file models/utils/surface_model/src/cylinder_thermal.cc
+ * Cylinders for use in the surface model, with the thermal rider
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+      ((None))
+
+Library dependencies:
+    ((cylinder_thermal.cc)
+     (cylinder.cc)
+     (interactions/thermal_rider/src/thermal_facet_rider.cc))
+
+ 
+*******************************************************************************/
+
+#include "../include/cylinder_thermal.hh"
+
+
+//! Namespace jeod
+namespace jeod {
+
+/**
+ * DefaultConstructor
+ */
+
+CylinderThermal::CylinderThermal (
+   void)
+{
+   // empty
+
+}
+
+/**
+ * Destructor
+ */
+
+CylinderThermal::~CylinderThermal (
+   void)
+{
+
+   // empty
+
+}
+
+} // End JEOD namespace
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -62,6 +62,33 @@ InteractionFacetFactory::~InteractionFacetFactory (
 
 }
 
+/**
+ * Create the interaction facets for several facets, all of which this
+ * factory is correct for, in one contiguous block allocated as a single
+ * JEOD array. The first facet of the block is the allocated array and is
+ * the one to be released with JEOD_DELETE_ARRAY; the other facets must not
+ * be released individually. This default implementation supports no such
+ * block and creates nothing; the facets are then created one at a time
+ * with create_facet.
+ * @return The first facet of the block, or NULL if blocks are not supported
+ * \param[in] facets The facets the interaction facets are created from
+ * \param[in] params The parameters for each facet
+ * \param[in] count Number of facets\n Units: cnt
+ * \param[out] inter_facets The interaction facet created for each facet
+ */
+
+InteractionFacet*
+InteractionFacetFactory::create_facets (
+   Facet** facets JEOD_UNUSED,
+   FacetParams** params JEOD_UNUSED,
+   unsigned int count JEOD_UNUSED,
+   InteractionFacet** inter_facets JEOD_UNUSED)
+{
+
+   return nullptr;
+
+}
+
 } // End JEOD namespace
 
 /**
@@ -21,12 +21,23 @@ ASSUMPTIONS AND LIMITATIONS:
       ((None))
 
 Library dependencies:
-    ((interaction_surface.cc))
+    ((interaction_surface.cc)
+     (interaction_facet_factory.cc))
 
  
 *******************************************************************************/
 
+// System includes
+#include <cstddef>
+#include <functional>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+
+// Model includes
 #include "../include/interaction_surface.hh"
+#include "../include/interaction_facet.hh"
+#include "../include/interaction_facet_factory.hh"
 
 
 //! Namespace jeod
@@ -52,7 +63,105 @@ InteractionSurface::~InteractionSurface (
    void)
 {
 
-   // empty for now
+   // Facets created one at a time are released by the inheriting class;
+   // the blocks are released here.
+   for (std::size_t ii = 0; ii < facet_block_bounds.size(); ii += 2) {
+      JEOD_DELETE_ARRAY (facet_block_bounds[ii]);
+   }
+
+}
+
+/**
+ * Allocates the interaction facets for several facets that share the
+ * factory. This default implementation allocates each facet with
+ * allocate_interaction_facet. Inheriting classes that store the facets
+ * made by create_facet_block override it.
+ * \param[in] facets The facets used to create the interaction facets
+ * \param[in] factory The factory used to create the interaction facets
+ * \param[in] params The parameters used to create each interaction facet
+ * \param[in] indices Where in the interaction facet array each interaction facet will be placed
+ * \param[in] count Number of facets\n Units: cnt
+ */
+
+void
+InteractionSurface::allocate_interaction_facets (
+   Facet** facets,
+   InteractionFacetFactory* factory,
+   FacetParams** params,
+   const unsigned int* indices,
+   unsigned int count)
+{
+
+   for (unsigned int ii = 0; ii < count; ++ii) {
+      allocate_interaction_facet (facets[ii], factory, params[ii], indices[ii]);
+   }
+
+   return;
+
+}
+
+/**
+ * Creates the interaction facets for several facets with one call to the
+ * factory, which allocates them in a single block. The block is owned by
+ * this surface.
+ * @return True if the block was created; false if the factory does not
+ * support blocks, in which case nothing was created
+ * \param[in] facets The facets used to create the interaction facets
+ * \param[in] factory The factory used to create the interaction facets
+ * \param[in] params The parameters used to create each interaction facet
+ * \param[in] count Number of facets\n Units: cnt
+ * \param[out] inter_facets The interaction facet created for each facet
+ */
+
+bool
+InteractionSurface::create_facet_block (
+   Facet** facets,
+   InteractionFacetFactory* factory,
+   FacetParams** params,
+   unsigned int count,
+   InteractionFacet** inter_facets)
+{
+
+   if (count == 0) {
+      return false;
+   }
+
+   InteractionFacet* block =
+      factory->create_facets (facets, params, count, inter_facets);
+
+   if (block == nullptr) {
+      return false;
+   }
+
+   facet_block_bounds.push_back (inter_facets[0]);
+   facet_block_bounds.push_back (inter_facets[count - 1]);
+
+   return true;
+
+}
+
+/**
+ * Determine whether an interaction facet was created in one of the blocks
+ * made by create_facet_block.
+ * @return True if the facet is part of a block
+ * \param[in] inter_facet The interaction facet
+ */
+
+bool
+InteractionSurface::is_block_facet (
+   const InteractionFacet* inter_facet)
+const
+{
+   std::less<const InteractionFacet*> before;
+
+   for (std::size_t ii = 0; ii < facet_block_bounds.size(); ii += 2) {
+      if ((! before (inter_facet, facet_block_bounds[ii])) &&
+          (! before (facet_block_bounds[ii+1], inter_facet))) {
+         return true;
+      }
+   }
+
+   return false;
 
 }
 
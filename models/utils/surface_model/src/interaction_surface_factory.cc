@@ -34,6 +34,9 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // JEOD includes
 #include "utils/message/include/message_handler.hh"
@@ -118,14 +121,27 @@ InteractionSurfaceFactory::create_surface (
 
 
 
+   // Index the facet parameters by name. The first parameters with a given
+   // name are the ones used.
+   std::unordered_map<std::string, FacetParams*> params_by_name;
+   params_by_name.reserve (params.size());
+   for (unsigned int jj = 0; jj < params.size(); ++jj) {
+      params_by_name.insert (std::make_pair (params[jj]->name, params[jj]));
+   }
+
+   unsigned int num_facets = surface->facets.size();
+   std::vector<InteractionFacetFactory*> facet_factories (num_facets, nullptr);
+   std::vector<FacetParams*> facet_params (num_facets, nullptr);
+
+
    // Allocate the array, through this virtual function, in the
    // interaction surface
-   inter_surface->allocate_array (surface->facets.size());
+   inter_surface->allocate_array (num_facets);
 
 
 
    // For all facets in the surface, match up an interaction facet factory
-   for (unsigned int ii = 0; ii < surface->facets.size(); ++ii) {
+   for (unsigned int ii = 0; ii < num_facets; ++ii) {
 
       InteractionFacetFactory* facet_factory = nullptr;
 
@@ -152,25 +168,23 @@ InteractionSurfaceFactory::create_surface (
       // For each facet, try to match up a facet_params that matches
       // them.
 
-      FacetParams* facet_params = nullptr;
-
-      for (unsigned int jj = 0; jj < params.size(); ++jj) {
+      FacetParams* facet_params_ptr = nullptr;
 
-         if (surface->facets[ii]->param_name == nullptr) {
-            MessageHandler::fail (
-               __FILE__, __LINE__,
-               SurfaceModelMessages::initialization_error,
-               "A Facet was found with no param_name set.");
-         }
-
-         if (strcmp (params[jj]->name.c_str(), surface->facets[ii]->param_name)
-             == 0) {
-            facet_params = params[jj];
-            break;
+      if (surface->facets[ii]->param_name == nullptr) {
+         MessageHandler::fail (
+            __FILE__, __LINE__,
+            SurfaceModelMessages::initialization_error,
+            "A Facet was found with no param_name set.");
+      }
+      else {
+         std::unordered_map<std::string, FacetParams*>::const_iterator found =
+            params_by_name.find (surface->facets[ii]->param_name);
+         if (found != params_by_name.end()) {
+            facet_params_ptr = found->second;
          }
       }
 
-      if (facet_params == nullptr) {
+      if (facet_params_ptr == nullptr) {
 
          MessageHandler::fail (
             __FILE__, __LINE__,
@@ -180,12 +194,38 @@ InteractionSurfaceFactory::create_surface (
 
       }
 
+      facet_factories[ii] = facet_factory;
+      facet_params[ii]    = facet_params_ptr;
 
-      inter_surface->allocate_interaction_facet (surface->facets[ii],
-                                                 facet_factory,
-                                                 facet_params,
-                                                 ii);
    } // for(unsigned int ii = 0)
+
+
+   // Hand each run of consecutive facets that share a factory to the
+   // interaction surface at once, so that the facets can be created in a
+   // single block. The facets are still created in order.
+   std::vector<unsigned int> indices (num_facets);
+   for (unsigned int ii = 0; ii < num_facets; ++ii) {
+      indices[ii] = ii;
+   }
+
+   unsigned int run_begin = 0;
+   while (run_begin < num_facets) {
+      unsigned int run_end = run_begin + 1;
+      while ((run_end < num_facets) &&
+             (facet_factories[run_end] == facet_factories[run_begin])) {
+         ++run_end;
+      }
+
+      inter_surface->allocate_interaction_facets (
+         &surface->facets[run_begin],
+         facet_factories[run_begin],
+         &facet_params[run_begin],
+         &indices[run_begin],
+         run_end - run_begin);
+
+      run_begin = run_end;
+   }
+
    return;
 }
 
@@ -41,6 +41,7 @@ Library dependencies:
 #include "utils/named_item/include/named_item.hh"
 
 // Model includes
+#include "../include/articulation_observer.hh"
 #include "../include/surface_model.hh"
 #include "../include/surface_model_messages.hh"
 #include "../include/facet.hh"
@@ -58,7 +59,8 @@ SurfaceModel::SurfaceModel (
 :
    articulation_active(false),
    struct_body_name(nullptr),
-   struct_body_ptr(nullptr)
+   struct_body_ptr(nullptr),
+   num_indexed_facets(0)
 {
 
    JEOD_REGISTER_CLASS(SurfaceModel);
@@ -171,6 +173,14 @@ SurfaceModel::initialize_mass_connections (
    // relative states over and over again, so for each "attached to"
    // mass body we see, create a new FacetStateInfo for it.
 
+   // Any previous facet indexing is replaced by this one.
+   for(std::list<FacetStateInfo>::iterator ii = articulation_states.begin();
+       ii != articulation_states.end();
+       ++ii) {
+      ii->facet_indices.clear();
+      ii->moved = true;
+   }
+
    // create an iterator to search the vector of FacetStateInfos.
    std::list<FacetStateInfo>::iterator it;
    for(unsigned int ii = 0; ii < facets.size(); ++ii){
@@ -187,14 +197,14 @@ SurfaceModel::initialize_mass_connections (
       if(it == articulation_states.end()) {
          articulation_states.push_back(
             FacetStateInfo(facets[ii]->get_mass_body_ptr() ));
-         facets[ii]->mass_rel_struct = &articulation_states.back().mass_state;
-      }
-      else {
-         facets[ii]->mass_rel_struct = &(it->mass_state);
+         it = --articulation_states.end();
       }
+      facets[ii]->mass_rel_struct = &(it->mass_state);
+      it->facet_indices.push_back(ii);
 
    } // for(unsigned int ii)
 
+   num_indexed_facets = facets.size();
 
 
    return;
@@ -204,7 +214,10 @@ SurfaceModel::initialize_mass_connections (
 /*******************************************************************************
   function: update_articulation
   purpose: (update the global zeroth order state, in the vehicle structural
-            frame, of the facets in this surface model)
+            frame, of the facets in this surface model. Only the facets
+            attached to mass bodies whose state relative to the structural
+            body changed are updated; the indices of those facets are
+            passed to the articulation observers.)
 *******************************************************************************/
 
 void
@@ -216,7 +229,12 @@ SurfaceModel::update_articulation (
       return;
    }
 
-   // update all of the MassPointStates we have knowledge of.
+   changed_facets.clear();
+
+   // update all of the MassPointStates we have knowledge of, and the
+   // facets attached to the ones that moved.
+
+   MassPointState new_state;
 
    // for(unsigned int ii = 0; ii < articulation_states.size(); ++ii) {
    for(std::list<FacetStateInfo>::iterator ii = articulation_states.begin();
@@ -241,14 +259,106 @@ struct_body_name, current_state.mass_body->name.c_str());
       }
 
       current_state.mass_body->structure_point.compute_relative_state(
-         struct_body_ptr->structure_point, current_state.mass_state);
+         struct_body_ptr->structure_point, new_state);
+
+      // A joint that didn't move leaves its facets where they are.
+      if((!current_state.moved) &&
+         std::equal(&new_state.position[0], &new_state.position[0] + 3,
+                    &current_state.mass_state.position[0]) &&
+         std::equal(&new_state.T_parent_this[0][0],
+                    &new_state.T_parent_this[0][0] + 9,
+                    &current_state.mass_state.T_parent_this[0][0])) {
+         continue;
+      }
+
+      current_state.mass_state.copy_state(new_state);
+      current_state.moved = false;
+
+      // All of the facets of the group share the one transformation, so
+      // they are transformed together.
+      for(unsigned int jj = 0; jj < current_state.facet_indices.size(); ++jj){
+         unsigned int index = current_state.facet_indices[jj];
+         facets[index]->update_articulation();
+         changed_facets.push_back(index);
+      }
 
    }
 
-   for(unsigned int ii = 0; ii < facets.size(); ++ii){
+   // Facets added after the mass connections were initialized are not
+   // indexed, so they are updated every time.
+   for(unsigned int ii = num_indexed_facets; ii < facets.size(); ++ii){
       facets[ii]->update_articulation();
+      changed_facets.push_back(ii);
    } // for(unsigned int ii)
 
+   if(!changed_facets.empty()) {
+      std::sort(changed_facets.begin(), changed_facets.end());
+
+      for(unsigned int ii = 0; ii < articulation_observers.size(); ++ii){
+         articulation_observers[ii]->facets_articulated(*this, changed_facets);
+      }
+   }
+
+   return;
+
+}
+
+/*******************************************************************************
+  function: invalidate_articulation
+  purpose: (force every facet to be updated at the next update_articulation,
+            e.g. after a checkpoint restart or after a facet's local position
+            or normal is changed)
+*******************************************************************************/
+
+void
+SurfaceModel::invalidate_articulation (
+   void)
+{
+   for(std::list<FacetStateInfo>::iterator ii = articulation_states.begin();
+       ii != articulation_states.end();
+       ++ii) {
+      ii->moved = true;
+   }
+
+   return;
+
+}
+
+/*******************************************************************************
+  function: add_articulation_observer
+  purpose: (register an observer to be told which facets moved at each
+            articulation update)
+*******************************************************************************/
+
+void
+SurfaceModel::add_articulation_observer (
+   ArticulationObserver & observer)
+{
+   if(std::find(articulation_observers.begin(),
+                articulation_observers.end(),
+                &observer) == articulation_observers.end()) {
+      articulation_observers.push_back(&observer);
+   }
+
+   return;
+
+}
+
+/*******************************************************************************
+  function: remove_articulation_observer
+  purpose: (deregister an articulation observer)
+*******************************************************************************/
+
+void
+SurfaceModel::remove_articulation_observer (
+   ArticulationObserver & observer)
+{
+   articulation_observers.erase(
+      std::remove(articulation_observers.begin(),
+                  articulation_observers.end(),
+                  &observer),
+      articulation_observers.end());
+
    return;
 
 }
@@ -36,6 +36,7 @@
 //
 #include "dynamics/body_action/include/body_action.hh"
 #include "dynamics/body_action/include/dyn_body_frame_switch.hh"
+#include "dynamics/body_action/include/dyn_body_freeze.hh"
 #include "dynamics/body_action/include/dyn_body_init.hh"
 #include "dynamics/body_action/include/dyn_body_init_lvlh_rot_state.hh"
 #include "dynamics/body_action/include/dyn_body_init_lvlh_state.hh"
@@ -48,6 +49,7 @@
 #include "dynamics/body_action/include/dyn_body_init_rot_state.hh"
 #include "dynamics/body_action/include/dyn_body_init_trans_state.hh"
 #include "dynamics/body_action/include/dyn_body_init_wrt_planet.hh"
+#include "dynamics/body_action/include/dyn_body_wake.hh"
 #include "dynamics/body_action/include/body_attach.hh"
 #include "dynamics/body_action/include/body_attach_aligned.hh"
 #include "dynamics/body_action/include/body_attach_matrix.hh"
@@ -55,7 +57,11 @@
 #include "dynamics/body_action/include/body_detach_specific.hh"
 #include "dynamics/body_action/include/body_reattach.hh"
 #include "dynamics/body_action/include/mass_body_init.hh"
+#include "dynamics/conjunction/include/conjunction_messages.hh"
+#include "dynamics/conjunction/include/conjunction_screening.hh"
 #include "dynamics/derived_state/include/derived_state.hh"
+#include "dynamics/derived_state/include/derived_state_scheduler.hh"
+#include "dynamics/derived_state/include/derived_state_skip_step.hh"
 #include "dynamics/derived_state/include/euler_derived_state.hh"
 #include "dynamics/derived_state/include/lvlh_derived_state.hh"
 #include "dynamics/derived_state/include/lvlh_relative_derived_state.hh"
@@ -64,10 +70,15 @@
 #include "dynamics/derived_state/include/planetary_derived_state.hh"
 #include "dynamics/derived_state/include/relative_derived_state.hh"
 #include "dynamics/derived_state/include/solar_beta_derived_state.hh"
+#include "dynamics/dyn_body/include/analytic_orbit_propagator.hh"
+#include "dynamics/dyn_body/include/body_collect_plan.hh"
 #include "dynamics/dyn_body/include/body_force_collect.hh"
 #include "dynamics/dyn_body/include/body_ref_frame.hh"
+#include "dynamics/dyn_body/include/body_wrench_buffer.hh"
 #include "dynamics/dyn_body/include/body_wrench_collect.hh"
 #include "dynamics/dyn_body/include/dyn_body.hh"
+#include "dynamics/dyn_body/include/dyn_body_branch_dispersion.hh"
+#include "dynamics/dyn_body/include/dyn_body_cost.hh"
 #include "dynamics/dyn_body/include/force.hh"
 #include "dynamics/dyn_body/include/frame_derivs.hh"
 #include "dynamics/dyn_body/include/structure_integrated_dyn_body.hh"
@@ -76,18 +87,29 @@
 #include "dynamics/dyn_body/include/vehicle_properties.hh"
 #include "dynamics/dyn_body/include/wrench.hh"
 #include "dynamics/dyn_manager/include/base_dyn_manager.hh"
+#include "dynamics/dyn_manager/include/distributed_partition.hh"
+#include "dynamics/dyn_manager/include/distributed_transport.hh"
 #include "dynamics/dyn_manager/include/dynamics_integration_group.hh"
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
 #include "dynamics/dyn_manager/include/dyn_manager_init.hh"
+#include "dynamics/dyn_manager/include/energy_monitor.hh"
+#include "dynamics/dyn_manager/include/mpi_transport.hh"
+#include "dynamics/dyn_manager/include/parareal_driver.hh"
+#include "dynamics/ground_access/include/ground_access.hh"
+#include "dynamics/ground_access/include/ground_access_messages.hh"
 #include "dynamics/mass/include/mass_body_links.hh"
 #include "dynamics/mass/include/mass.hh"
+#include "dynamics/mass/include/mass_moments.hh"
 #include "dynamics/mass/include/mass_point.hh"
 #include "dynamics/mass/include/mass_point_init.hh"
 #include "dynamics/mass/include/mass_point_links.hh"
 #include "dynamics/mass/include/mass_point_state.hh"
 #include "dynamics/mass/include/mass_properties.hh"
 #include "dynamics/mass/include/mass_properties_init.hh"
+#include "dynamics/mass/include/mass_tank.hh"
 #include "dynamics/rel_kin/include/relative_kinematics.hh"
+#include "dynamics/uncertainty/include/uncertainty_messages.hh"
+#include "dynamics/uncertainty/include/unscented_propagator.hh"
 #include "environment/atmosphere/MET/data/include/solar_max.hh"
 #include "environment/atmosphere/MET/data/include/solar_mean.hh"
 #include "environment/atmosphere/MET/data/include/solar_min.hh"
@@ -95,6 +117,8 @@
 #include "environment/atmosphere/base_atmos/include/atmosphere.hh"
 #include "environment/atmosphere/base_atmos/include/atmosphere_state.hh"
 #include "environment/atmosphere/MET/include/MET_atmosphere.hh"
+#include "environment/atmosphere/MET/include/MET_density_table_step.hh"
+#include "environment/atmosphere/MET/include/MET_atmosphere_offload.hh"
 #include "environment/atmosphere/MET/include/MET_atmosphere_state.hh"
 #include "environment/atmosphere/MET/include/MET_atmosphere_state_vars.hh"
 #include "environment/atmosphere/base_atmos/include/wind_velocity_base.hh"
@@ -127,6 +151,7 @@
 #include "environment/gravity/data/include/moon_LP150Q.hh"
 #include "environment/gravity/data/include/moon_spherical.hh"
 #include "environment/gravity/data/include/sun_spherical.hh"
+#include "environment/gravity/include/gravity_batch_force_model.hh"
 #include "environment/gravity/include/gravity_controls.hh"
 #include "environment/gravity/include/gravity_integ_frame.hh"
 #include "environment/gravity/include/gravity_interaction.hh"
@@ -134,7 +159,9 @@
 #include "environment/gravity/include/spherical_harmonics_delta_coeffs.hh"
 #include "environment/gravity/include/spherical_harmonics_delta_coeffs_init.hh"
 #include "environment/gravity/include/spherical_harmonics_delta_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_degree_step.hh"
 #include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_offload.hh"
 #include "environment/gravity/include/spherical_harmonics_solid_body_tides.hh"
 #include "environment/gravity/include/spherical_harmonics_solid_body_tides_init.hh"
 #include "environment/gravity/include/spherical_harmonics_tidal_effects.hh"
@@ -201,20 +228,28 @@
 #include "environment/time/include/time_ut1.hh"
 #include "environment/time/include/time_utc.hh"
 #include "interactions/aerodynamics/data/include/aero_model.hh"
+#include "interactions/aerodynamics/include/aero_coef_table.hh"
 #include "interactions/aerodynamics/include/aero_drag.hh"
 #include "interactions/aerodynamics/include/aero_facet.hh"
 #include "interactions/aerodynamics/include/aero_params.hh"
 #include "interactions/aerodynamics/include/aero_surface_factory.hh"
 #include "interactions/aerodynamics/include/aero_surface.hh"
+#include "interactions/aerodynamics/include/cylinder_aero_facet.hh"
+#include "interactions/aerodynamics/include/cylinder_aero_factory.hh"
 #include "interactions/aerodynamics/include/default_aero.hh"
+#include "interactions/aerodynamics/include/flat_plate_aero_batch.hh"
 #include "interactions/aerodynamics/include/flat_plate_aero_facet.hh"
 #include "interactions/aerodynamics/include/flat_plate_aero_factory.hh"
 #include "interactions/aerodynamics/include/flat_plate_aero_params.hh"
 #include "interactions/aerodynamics/include/flat_plate_thermal_aero_factory.hh"
+#include "interactions/contact/include/contact_batch.hh"
+#include "interactions/contact/include/contact_broad_phase.hh"
 #include "interactions/contact/include/contact_facet.hh"
 #include "interactions/contact/include/contact.hh"
+#include "interactions/contact/include/contact_narrow_phase.hh"
 #include "interactions/contact/include/contact_pair.hh"
 #include "interactions/contact/include/contact_params.hh"
+#include "interactions/contact/include/contact_rel_state_cache.hh"
 #include "interactions/contact/include/contact_surface_factory.hh"
 #include "interactions/contact/include/contact_surface.hh"
 #include "interactions/contact/include/contact_utils.hh"
@@ -230,6 +265,8 @@
 #include "interactions/contact/include/spring_pair_interaction.hh"
 #include "interactions/gravity_torque/include/gravity_torque.hh"
 // #include "interactions/gravity_torque/include/gravity_torque_messages.hh"
+#include "interactions/radiation_pressure/include/cylinder_radiation_facet.hh"
+#include "interactions/radiation_pressure/include/cylinder_radiation_factory.hh"
 #include "interactions/radiation_pressure/include/flat_plate_radiation_facet.hh"
 #include "interactions/radiation_pressure/include/flat_plate_radiation_factory.hh"
 #include "interactions/radiation_pressure/include/radiation_base_facet.hh"
@@ -238,30 +275,38 @@
 // #include "interactions/radiation_pressure/include/radiation_messages.hh"
 #include "interactions/radiation_pressure/include/radiation_params.hh"
 #include "interactions/radiation_pressure/include/radiation_pressure.hh"
+#include "interactions/radiation_pressure/include/radiation_self_shadow.hh"
 #include "interactions/radiation_pressure/include/radiation_source.hh"
 #include "interactions/radiation_pressure/include/radiation_surface_factory.hh"
 #include "interactions/radiation_pressure/include/radiation_surface.hh"
 #include "interactions/radiation_pressure/include/radiation_third_body.hh"
 // #include "interactions/thermal_rider/include/class_declarations.hh"
+#include "interactions/thermal_rider/include/thermal_facet_batch.hh"
 #include "interactions/thermal_rider/include/thermal_facet_rider.hh"
+#include "interactions/thermal_rider/include/thermal_interval_step.hh"
 #include "interactions/thermal_rider/include/thermal_integrable_object.hh"
 // #include "interactions/thermal_rider/include/thermal_messages.hh"
 #include "interactions/thermal_rider/include/thermal_model_rider.hh"
 #include "interactions/thermal_rider/include/thermal_params.hh"
+#include "utils/container/include/binary_checkpoint_block.hh"
 #include "utils/container/include/checkpointable.hh"
 #include "utils/container/include/container.hh"
+#include "utils/container/include/inline_vector.hh"
 #include "utils/container/include/jeod_associative_container.hh"
 #include "utils/container/include/jeod_container_compare.hh"
+#include "utils/container/include/jeod_inline_vector.hh"
 #include "utils/container/include/jeod_list.hh"
 #include "utils/container/include/jeod_sequence_container.hh"
 #include "utils/container/include/jeod_set.hh"
 #include "utils/container/include/jeod_stl_container.hh"
 #include "utils/container/include/jeod_vector.hh"
 #include "utils/container/include/object_container.hh"
+#include "utils/container/include/object_inline_vector.hh"
 #include "utils/container/include/object_list.hh"
 #include "utils/container/include/object_set.hh"
 #include "utils/container/include/object_vector.hh"
 #include "utils/container/include/pointer_container.hh"
+#include "utils/container/include/pointer_inline_vector.hh"
 #include "utils/container/include/pointer_list.hh"
 #include "utils/container/include/pointer_set.hh"
 #include "utils/container/include/pointer_vector.hh"
@@ -271,6 +316,7 @@
 #include "utils/container/include/primitive_set.hh"
 #include "utils/container/include/primitive_vector.hh"
 #include "utils/container/include/simple_checkpointable.hh"
+#include "utils/integration/chebyshev_picard/include/chebyshev_picard_integrator.hh"
 #include "utils/integration/gauss_jackson/include/gauss_jackson_coeffs.hh"
 #include "utils/integration/gauss_jackson/include/gauss_jackson_config.hh"
 #include "utils/integration/gauss_jackson/include/gauss_jackson_integration_controls.hh"
@@ -281,27 +327,44 @@
 #include "utils/integration/include/restartable_state_integrator.hh"
 #include "utils/integration/include/restartable_state_integrator_templates.hh"
 #include "utils/integration/include/time_change_subscriber.hh"
+#include "utils/integration/include/timestamp_cache.hh"
 #include "utils/integration/lsode/include/lsode_control_data_interface.hh"
 #include "utils/integration/lsode/include/lsode_data_classes.hh"
 #include "utils/integration/lsode/include/lsode_integration_controls.hh"
 #include "utils/integration/lsode/include/lsode_integrator_constructor.hh"
+#include "utils/integration/lsode/include/lsode_workspace_pool.hh"
+#include "utils/integration/symplectic/include/symplectic_integrator_constructor.hh"
 #include "utils/lvlh_frame/include/lvlh_frame.hh"
+#include "utils/lvlh_frame/include/lvlh_frame_registry.hh"
 #include "utils/lvlh_frame/include/lvlh_type.hh"
+#include "utils/math/include/deterministic_sum.hh"
 #include "utils/math/include/gauss_quadrature.hh"
 #include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/matrix3x3_batch.hh"
 #include "utils/math/include/numerical.hh"
+#include "utils/math/include/occultation.hh"
 #include "utils/math/include/vector3.hh"
+#include "utils/math/include/vector3_batch.hh"
 #include "utils/memory/include/jeod_alloc_construct_destruct.hh"
 #include "utils/memory/include/jeod_alloc_get_allocated_pointer.hh"
+#include "utils/memory/include/jeod_alloc_rows.hh"
 #include "utils/memory/include/jeod_alloc.hh"
+#include "utils/memory/include/memory_alloc_table.hh"
 #include "utils/memory/include/memory_attributes_templates.hh"
 #include "utils/memory/include/memory_item.hh"
 #include "utils/memory/include/memory_manager.hh"
+#include "utils/memory/include/memory_pool.hh"
 #include "utils/memory/include/memory_table.hh"
 #include "utils/memory/include/memory_type.hh"
+#include "utils/memory/include/scratch_arena.hh"
+#include "utils/memory/include/state_snapshot.hh"
+#include "utils/message/include/async_message_sink.hh"
 #include "utils/message/include/make_message_code.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/message/include/suppressed_code_message_handler.hh"
+#include "utils/offload/include/offload_buffer.hh"
+#include "utils/offload/include/offload_device.hh"
+#include "utils/offload/include/offload_messages.hh"
 #include "utils/orbital_elements/include/orbital_elements.hh"
 #include "utils/orbital_elements/include/orbital_elements_messages.hh"
 #include "utils/orientation/include/orientation.hh"
@@ -310,6 +373,7 @@
 #include "utils/planet_fixed/planet_fixed_posn/include/alt_lat_long_state.hh"
 #include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
 #include "utils/quaternion/include/quat.hh"
+#include "utils/quaternion/include/quat_batch.hh"
 #include "utils/ref_frames/include/base_ref_frame_manager.hh"
 #include "utils/ref_frames/include/ref_frame.hh"
 #include "utils/ref_frames/include/ref_frame_interface.hh"
@@ -320,18 +384,33 @@
 #include "utils/ref_frames/include/subscription.hh"
 #include "utils/ref_frames/include/tree_links.hh"
 #include "utils/ref_frames/include/tree_links_iterator.hh"
+#include "utils/sim_interface/include/branch_driver.hh"
 #include "utils/sim_interface/include/checkpoint_input_manager.hh"
 #include "utils/sim_interface/include/checkpoint_output_manager.hh"
+#include "utils/sim_interface/include/checkpoint_reconstructor.hh"
+#include "utils/sim_interface/include/checkpoint_section_codec.hh"
+#include "utils/sim_interface/include/data_module_loader.hh"
+#include "utils/sim_interface/include/fidelity_controller.hh"
+#include "utils/sim_interface/include/frame_monitor.hh"
+#include "utils/sim_interface/include/initialization_phase.hh"
 #include "utils/sim_interface/include/jeod_integrator_interface.hh"
 #include "utils/sim_interface/include/jeod_trick_integrator.hh"
+#include "utils/sim_interface/include/jeod_profiler.hh"
 #include "utils/sim_interface/include/memory_attributes.hh"
 #include "utils/sim_interface/include/memory_interface.hh"
 #include "utils/sim_interface/include/simulation_interface.hh"
+#include "utils/sim_interface/include/task_graph.hh"
 #include "utils/sim_interface/include/trick10_memory_interface.hh"
 #include "utils/sim_interface/include/trick_dynbody_integ_loop.hh"
 #include "utils/sim_interface/include/trick_memory_interface.hh"
 #include "utils/sim_interface/include/trick_sim_interface.hh"
+#include "utils/state_logger/include/state_logger.hh"
+#include "utils/state_logger/include/state_logger_messages.hh"
+#include "utils/state_publisher/include/state_publication.hh"
+#include "utils/state_publisher/include/state_publisher.hh"
+#include "utils/state_publisher/include/state_publisher_messages.hh"
 #include "utils/surface_model/include/cylinder.hh"
+#include "utils/surface_model/include/cylinder_thermal.hh"
 #include "utils/surface_model/include/facet.hh"
 #include "utils/surface_model/include/facet_params.hh"
 #include "utils/surface_model/include/flat_plate_circular.hh"